@@ -5,19 +5,20 @@
 #include <memory>
 #include <array>
 #include <functional>
+#include <algorithm>
 
 #include "config.h"
 
 #include "Attributes.h"
 #include "AttribScores.h"
 #include "SGFTree.h"
-#include "SGFParser.h"
+#include "SGFStream.h"
 #include "Utils.h"
 #include "FastBoard.h"
 #include "MCOTable.h"
 #include "Random.h"
-
-#include "Weights.h"
+#include "Resources.h"
+#include "Timing.h"
 
 using namespace Utils;
 
@@ -33,20 +34,43 @@ AttribScores* AttribScores::get_attribscores(void) {
 }
 
 void AttribScores::gather_attributes(std::string filename, LearnVector & data) {
-    std::vector<std::string> games = SGFParser::chop_all(filename);
-    int gametotal = games.size();
+    SGFStream games(filename);
+    std::vector<std::string> batch;
+    std::vector<std::unique_ptr<SGFTree>> trees;
+    size_t next_tree = 0;
     int gamecount = 0;
     int allcount = 0;
+    Time start;
 
-    myprintf("Total games in file: %d\n", gametotal);
+    myprintf("Reading games from %d file(s)\n", games.get_file_count());
 
-    while (gamecount < gametotal) {
-        std::unique_ptr<SGFTree> sgftree(new SGFTree);
+    for (;;) {
+        // Games are loaded across the pool, a batch at a time. The
+        // positions are done one by one: mc_owner fills the one
+        // ownership table, and spreads its playouts over the pool.
+        if (next_tree == trees.size()) {
+            if (!games.next_batch(batch, 64)) {
+                break;
+            }
+            trees.clear();
+            trees.resize(batch.size());
+            thread_pool.parallel_for(0, batch.size(), [&batch, &trees](int i) {
+                std::unique_ptr<SGFTree> sgftree(new SGFTree);
+                try {
+                    sgftree->load_from_string(batch[i]);
+                } catch (...) {
+                    // Only part of the tree could be set up
+                    return;
+                };
+                trees[i] = std::move(sgftree);
+            });
+            next_tree = 0;
+        }
 
-        try {
-            sgftree->load_from_string(games[gamecount]);
-        } catch (...) {
-        };
+        std::unique_ptr<SGFTree> sgftree = std::move(trees[next_tree++]);
+        if (!sgftree) {
+            continue;
+        }
 
         int movecount = sgftree->count_mainline_moves();                                
         
@@ -185,8 +209,10 @@ void AttribScores::gather_attributes(std::string filename, LearnVector & data) {
 skipnext:
         gamecount++;                
         
-        myprintf("Game %d, %3d moves, %d positions, %d allpos\n", 
-                 gamecount, movecount, data.size(), allcount);                
+        int elapsed = std::max(1, Time::timediff(start, Time()));
+        myprintf("Game %d, %3d moves, %d positions, %d allpos, %d games/s\n",
+                 gamecount, movecount, data.size(), allcount,
+                 gamecount * 100 / elapsed);
     }
     
     myprintf("Gathering pass done.\n");
@@ -424,13 +450,20 @@ void AttribScores::load_internal() {
     m_fweight.clear();
     m_pat.clear();
 
-    m_fweight.reserve(internal_weights.size());
+    size_t weights = Resources::size("attrib_weights");
+    size_t patterns = Resources::size("attrib_patterns");
+    auto internal_weights = Resources::get<double>("attrib_weights", weights);
+    auto internal_patterns = Resources::get<int>("attrib_patterns", patterns);
+    auto internal_patweights =
+        Resources::get<double>("attrib_patweights", patterns);
+
+    m_fweight.reserve(weights);
 
-    for (size_t i = 0; i < internal_weights.size(); i++) {
+    for (size_t i = 0; i < weights; i++) {
         m_fweight.push_back((float)internal_weights[i]);
     }
 
-    for (size_t i = 0; i < internal_patterns.size(); i++) {
+    for (size_t i = 0; i < patterns; i++) {
         m_pat.insert(std::make_pair(internal_patterns[i], (float)internal_patweights[i]));
     }
 
@@ -0,0 +1,211 @@
+#include "config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "GameState.h"
+#include "GTP.h"
+#include "Matcher.h"
+#include "Network.h"
+#include "Random.h"
+#include "SGFParser.h"
+#include "SGFTree.h"
+#include "TTable.h"
+#include "UCTSearch.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+constexpr int Benchmark::DEFAULT_PLAYOUTS;
+constexpr uint32 Benchmark::SEED;
+double Benchmark::s_startup_ms = 0.0;
+
+namespace {
+    struct Position {
+        const char * m_name;
+        const char * m_sgf;
+    };
+
+    const Position s_positions[] = {
+        {"opening",
+         "(;GM[1]FF[4]RU[Chinese]SZ[19]KM[7.5]"
+         ";B[qj];W[pl];B[qm];W[pn];B[qp];W[ql];B[qo];W[nn];B[op];W[mp]"
+         ";B[kq];W[mq])"},
+        {"middlegame",
+         "(;GM[1]FF[4]RU[Chinese]SZ[19]KM[7.5]"
+         ";B[qj];W[pl];B[qm];W[pn];B[qp];W[ql];B[qo];W[nn];B[op];W[mp]"
+         ";B[kq];W[mq];B[rl];W[po];B[oo];W[on];B[qk];W[pm];B[rm];W[pp]"
+         ";B[pq];W[pk];B[qh];W[pj];B[pi];W[oh];B[ni];W[oi];B[mj];W[nh]"
+         ";B[mh];W[mg];B[lh];W[kf];B[kd];W[ic];B[md];W[od];B[nc];W[nf]"
+         ";B[oc];W[pc];B[pd];W[qd];B[pe];W[oe];B[pb];W[qc];B[qb];W[qf]"
+         ";B[rg];W[ph];B[nk];W[qe];B[mf];W[le];B[lf];W[lg];B[me];W[kh]"
+         ";B[li];W[kj];B[ki];W[jj];B[jh];W[kg];B[ji];W[hi];B[ij];W[kl]"
+         ";B[hj];W[ik];B[gj];W[fk];B[fj];W[dj];B[cl];W[bk];B[bl];W[dh])"},
+        {"endgame",
+         "(;GM[1]FF[4]RU[Chinese]SZ[9]KM[7.5]"
+         ";B[dc];W[cf];B[ff];W[ge];B[gc];W[gg];B[gf];W[hf];B[he];W[hg]"
+         ";B[dg];W[fe];B[df];W[de];B[ee];W[ed];B[ef];W[dd];B[fd];W[fc]"
+         ";B[gd];W[cc];B[fh];W[cg];B[fb];W[ec];B[eb];W[gb];B[db];W[dh]"
+         ";B[eh];W[gh];B[cb];W[bd];B[bb];W[ie];B[id])"},
+        // Black just took the ko, White has to find a threat
+        {"ko",
+         "(;GM[1]FF[4]RU[Chinese]SZ[9]KM[7.5]"
+         "AB[cc][dc][dd][ce][cf][df][dg][eg][fh]"
+         "AW[ec][ed][fc][fd][de][fe][ff][ef][gg][ge]PL[B]"
+         ";B[ee])"},
+    };
+
+    // Puts a global back however the benchmark is left
+    template <typename T>
+    class Restore {
+    public:
+        explicit Restore(T & value) : m_value(value), m_saved(value) {}
+        ~Restore() { m_value = m_saved; }
+    private:
+        T & m_value;
+        T m_saved;
+    };
+
+    /*
+        Runs with fewer threads also shrink the pool, so mc_owner and
+        the leaf playouts can't borrow the threads the row leaves out.
+    */
+    class PoolSize {
+    public:
+        PoolSize() : m_saved(thread_pool.size()) {}
+        ~PoolSize() { thread_pool.resize(m_saved); }
+        void set_threads(int threads) {
+            // As in Leela.cpp, the calling thread is one of them
+            thread_pool.resize(cfg_deterministic ? 0 : threads - 1);
+        }
+    private:
+        size_t m_saved;
+    };
+
+    double percentile(std::vector<float> & sorted, double fraction) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+}
+
+void Benchmark::set_startup_time(double ms) {
+    s_startup_ms = ms;
+}
+
+std::string Benchmark::run(int playouts) {
+    const int max_threads = cfg_num_threads;
+    const bool quiet = cfg_quiet;
+    Restore<int> restore_threads(cfg_num_threads);
+    Restore<bool> restore_quiet(cfg_quiet);
+    Restore<bool> restore_book(cfg_allow_book);
+    PoolSize pool;
+
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    // Books would skip the search in the opening
+    cfg_allow_book = false;
+
+    std::string json = "{\"engine\":\"" PROGRAM_NAME " " PROGRAM_VERSION "\"";
+    char buff[512];
+    std::snprintf(buff, sizeof(buff),
+                  ",\"playouts\":%d,\"seed\":%u,\"deterministic\":%s,",
+                  playouts, (unsigned int)SEED,
+                  cfg_deterministic ? "true" : "false");
+    json += buff;
+    auto matcher = Matcher::get_Matcher();
+    std::snprintf(buff, sizeof(buff),
+                  "\n\"startup_ms\":%.1f,\"matcher_ms\":%.2f,"
+                  "\"matcher_cached\":%s,\"results\":[",
+                  s_startup_ms, matcher->get_init_time(),
+                  matcher->is_cached() ? "true" : "false");
+    json += buff;
+
+    bool first = true;
+    for (const auto & position : s_positions) {
+        std::istringstream sgfstream(position.m_sgf);
+        auto games = SGFParser::chop_stream(sgfstream);
+        std::unique_ptr<SGFTree> sgftree(new SGFTree);
+        sgftree->load_from_string(games[0]);
+        GameState position_state = sgftree->follow_mainline_state();
+        // no byo yomi stones or periods: the search never runs out of time
+        position_state.set_timecontrol(0, 1, 0, 0);
+
+        for (auto threads : thread_counts) {
+            // the leaf playout threads come out of the same budget
+            if (threads - cfg_leaf_threads < 1 && !cfg_enable_nets) {
+                continue;
+            }
+            cfg_num_threads = threads;
+            pool.set_threads(threads);
+
+            GameState game = position_state;
+            Random::seed_all(SEED);
+            TTable::get_TT()->clear();
+            uint64 evals = Network::get_eval_count();
+
+            cfg_quiet = true;
+            auto start_time = std::chrono::steady_clock::now();
+            int move;
+            int done;
+            int nodes;
+            std::vector<float> latencies;
+            {
+                UCTSearch search(game);
+                search.set_playout_limit(playouts);
+                search.set_quiet(true);
+                search.set_record_latency(true);
+                move = search.think(game.get_to_move());
+                done = search.get_playouts();
+                nodes = search.get_node_count();
+                latencies = search.get_latencies();
+            }
+            auto end_time = std::chrono::steady_clock::now();
+            cfg_quiet = quiet;
+
+            double seconds = std::chrono::duration<double>(end_time - start_time).count();
+            seconds = std::max(seconds, 1e-6);
+            evals = Network::get_eval_count() - evals;
+            std::sort(begin(latencies), end(latencies));
+
+            std::string vertex = game.move_to_text(move);
+            std::snprintf(buff, sizeof(buff),
+                          "%s\n{\"position\":\"%s\",\"boardsize\":%d,"
+                          "\"threads\":%d,\"simulations\":%d,\"seconds\":%.3f,"
+                          "\"playouts_per_sec\":%.1f,\"nodes_per_sec\":%.1f,"
+                          "\"nn_evals_per_sec\":%.1f,"
+                          "\"latency_p50_us\":%.1f,\"latency_p99_us\":%.1f,"
+                          "\"peak_memory_mb\":%.1f,\"move\":\"%s\"}",
+                          first ? "" : ",",
+                          position.m_name, game.board.get_boardsize(),
+                          threads, (int)latencies.size(), seconds,
+                          done / seconds, nodes / seconds,
+                          evals / seconds,
+                          percentile(latencies, 0.50),
+                          percentile(latencies, 0.99),
+                          get_peak_memory() / (1024.0 * 1024.0),
+                          vertex.c_str());
+            json += buff;
+            first = false;
+
+            myprintf("%-10s %2d threads: %8.1f p/s, %s\n",
+                     position.m_name, threads, done / seconds,
+                     vertex.c_str());
+        }
+    }
+    json += "\n]}";
+
+    return json;
+}
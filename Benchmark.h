@@ -0,0 +1,28 @@
+#ifndef BENCHMARK_H_INCLUDED
+#define BENCHMARK_H_INCLUDED
+
+#include "config.h"
+
+#include <string>
+
+/*
+    Searches a fixed set of positions with a fixed number of playouts
+    and a fixed seed, at 1, 2, 4... up to the configured number of
+    threads, so runs on different builds and machines can be compared.
+    The results come back as JSON. Only with --deterministic do two
+    runs search exactly the same trees.
+*/
+class Benchmark {
+public:
+    static constexpr int DEFAULT_PLAYOUTS = 1000;
+    static constexpr uint32 SEED = 5489;
+
+    static std::string run(int playouts = DEFAULT_PLAYOUTS);
+    // From process start until ready for commands
+    static void set_startup_time(double ms);
+
+private:
+    static double s_startup_ms;
+};
+
+#endif
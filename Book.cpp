@@ -1,4 +1,5 @@
 #include "config.h"
+#include <algorithm>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -8,33 +9,30 @@
 #include <fstream>
 #include <boost/utility.hpp>
 #include <boost/format.hpp>
-#include <boost/next_prior.hpp>
 
 #include "Book.h"
 #include "Utils.h"
-#include "SGFParser.h"
+#include "SGFStream.h"
 #include "SGFTree.h"
 #include "Random.h"
-#include "BookData.h"
+#include "Resources.h"
+#include "Timing.h"
 
 using namespace Utils;
 
 // #define DUMP_BOOK
 
-void Book::bookgen_from_file(std::string filename) {
-    std::unordered_map<uint64, int> hash_book;
-    std::vector<std::string> games = SGFParser::chop_all(filename);
-    size_t gametotal = games.size();
-    size_t gamecount = 0;
-
-    myprintf("Total games in file: %d\n", gametotal);
-
-    while (gamecount < gametotal) {
+namespace {
+    // The positions of the first 40 moves of a game
+    std::vector<uint64> book_positions(const std::string & gamebuff) {
+        std::vector<uint64> positions;
         std::unique_ptr<SGFTree> sgftree(new SGFTree);
 
         try {
-            sgftree->load_from_string(games[gamecount]);
+            sgftree->load_from_string(gamebuff);
         } catch (...) {
+            // Only part of the tree could be set up
+            return positions;
         };
 
         int movecount = sgftree->count_mainline_moves();
@@ -61,27 +59,44 @@ void Book::bookgen_from_file(std::string filename) {
                 break;
             }
 
-            uint64 canon_hash = state->board.get_canonical_hash();
-
-            auto it = hash_book.find(canon_hash);
-            if (it == hash_book.end()) {
-                hash_book.insert(std::make_pair(canon_hash, 1));
-            } else {
-                it->second++;
-            }
+            positions.push_back(state->board.get_canonical_hash());
 
             counter++;
             treewalk = treewalk->get_child(0);
         }
 
-        gamecount++;
-        if (gamecount % 100 == 0) {
-            myprintf("Game %d, %d total positions\n", gamecount, hash_book.size());
+        return positions;
+    }
+}
+
+void Book::bookgen_from_file(std::string filename) {
+    std::unordered_map<uint64, int> hash_book;
+    SGFStream games(filename);
+    std::vector<std::string> batch;
+    size_t gamecount = 0;
+    Time start;
+
+    myprintf("Reading games from %d file(s)\n", games.get_file_count());
+
+    while (games.next_batch(batch, 1000)) {
+        // Games are independent, merge them in file order afterwards
+        std::vector<std::vector<uint64>> positions(batch.size());
+        thread_pool.parallel_for(0, batch.size(), [&batch, &positions](int i) {
+            positions[i] = book_positions(batch[i]);
+        });
+        for (auto & game : positions) {
+            for (auto canon_hash : game) {
+                hash_book[canon_hash]++;
+            }
         }
+
+        gamecount += batch.size();
+        int elapsed = std::max(1, Time::timediff(start, Time()));
+        myprintf("Game %d, %d total positions, %d games/s\n",
+                 gamecount, hash_book.size(), (int)(gamecount * 100 / elapsed));
     }
 
-    games.clear();
-    myprintf("%d total positions\n", hash_book.size());
+    myprintf("%d games, %d total positions\n", gamecount, hash_book.size());
 
     // Filter book
     std::map<uint64, int> filtered_book;
@@ -95,17 +110,12 @@ void Book::bookgen_from_file(std::string filename) {
     hash_book.clear();
     myprintf("%d filtered positions\n", filtered_book.size());
 
-    std::ofstream out("BookData.h");
-    out << "static std::unordered_map<uint64, int> book_data{" << std::endl;
+    // params/mkdata.py puts this into the data file
+    std::ofstream out("book.txt");
     for (auto it = filtered_book.cbegin(); it != filtered_book.cend(); ++it) {
-        out << boost::format("{0x%08X, %d}") % it->first % it->second;
-        if (boost::next(it) != filtered_book.cend()) {
-            out << "," << std::endl;
-        }
+        out << boost::format("0x%08X %d") % it->first % it->second << std::endl;
     }
 
-    out << "};" << std::endl;
-
     out.close();
 }
 
@@ -114,6 +124,11 @@ int Book::get_book_move(FastState & state) {
     std::vector<std::pair<int, int>> scored_moves;
     std::vector<std::pair<int, int>> candidate_moves;
 
+    // Sorted by hash
+    size_t book_size = Resources::size("book_keys");
+    auto book_keys = Resources::get<uint64>("book_keys", book_size);
+    auto book_counts = Resources::get<int>("book_counts", book_size);
+
     int max_score = 0;
     for (auto & move : moves) {
         FastState currstate = state;
@@ -122,10 +137,11 @@ int Book::get_book_move(FastState & state) {
             currstate.play_move(move);
             uint64 hash = currstate.board.get_canonical_hash();
 
-            auto bid = book_data.find(hash);
-            if (bid != book_data.end()) {
-                max_score = std::max(max_score, bid->second);
-                scored_moves.emplace_back(bid->second, move);
+            auto bid = std::lower_bound(book_keys, book_keys + book_size, hash);
+            if (bid != book_keys + book_size && *bid == hash) {
+                int count = book_counts[bid - book_keys];
+                max_score = std::max(max_score, count);
+                scored_moves.emplace_back(count, move);
             }
         }
     }
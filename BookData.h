@@ -1,12025 +0,0 @@
-static std::unordered_map<uint64, int> book_data{
-{0xD041ECBE8A1F, 269},
-{0xD45DE46F780F, 276},
-{0x1D577B6A8CE1D, 557},
-{0x2185DC6D86A35, 1532},
-{0x28C2053F7AA27, 210},
-{0x3D8DB23064363, 294},
-{0x3FCBE9E15F09E, 1662},
-{0x48126A72BB986, 838},
-{0x50C1B8A083572, 68575},
-{0x5126B44F9CCC8, 7573},
-{0x7A19E5BDAE232, 1156},
-{0x928D4392C2CD9, 249},
-{0xA4AFB09B239B2, 201},
-{0xAE4170A76DB7B, 210},
-{0xAE6FE7033827B, 1370},
-{0xB2CFB261C9FB0, 220},
-{0xB36306CEFA769, 4051},
-{0xBED062CB22E93, 379},
-{0xC75E9A8370B6C, 6310},
-{0xCF4DDFE8997A2, 357},
-{0xCFE887D037B72, 1803},
-{0xD726FA87CE046, 222},
-{0xD72FBD0EC0348, 228},
-{0xD99A47C1B5B41, 3031},
-{0xDC9CA80B9DD50, 292},
-{0xE3F4061257396, 365},
-{0xF4EAA7A23D444, 514},
-{0x10B1E69278CA27, 1035},
-{0x10CCEDA4FFCB2F, 1389},
-{0x12588F64E595E7, 5016},
-{0x127B525CB8E212, 626},
-{0x135858A3CBCBA0, 953},
-{0x139D948E8AA38B, 323},
-{0x13B2E6B3E31AB5, 605},
-{0x13CB2EAF588EA4, 467},
-{0x14297181E194CB, 362},
-{0x14CEB10F8A9378, 249},
-{0x15E4EF4291D46D, 644},
-{0x166C9D2F33FE2B, 1737},
-{0x16BF7378677F53, 240},
-{0x1747C40DC6D91E, 255},
-{0x176281E06B3CF5, 3338},
-{0x1777345112ECD9, 1921},
-{0x1921A6C6FC5F6A, 384},
-{0x1A31D950198930, 243},
-{0x1A6566A2DA7C4D, 1101},
-{0x1ADB32204CE42E, 232},
-{0x1AE1ECB2BC3E29, 1445},
-{0x1B6E520CDC393B, 382},
-{0x1BFA22C45CB66B, 220},
-{0x1C5F1A60E6F9D4, 222},
-{0x1C6F0CB5614364, 209},
-{0x1D5815733D4B25, 458},
-{0x1DAEF525BFA70F, 2919},
-{0x1EAAAAFD7D1A30, 201},
-{0x1EC4BA88C9579D, 313},
-{0x2012BB1A9C2A8E, 409},
-{0x215950E7664FED, 332},
-{0x21EF3B62D91ADB, 258},
-{0x24724F00B1F519, 1390},
-{0x25104E37CCBF11, 244},
-{0x25F40CEBC85D96, 310},
-{0x2792535F6E5AA4, 260},
-{0x27FFE056C99102, 1382},
-{0x28885B2A62F59A, 220},
-{0x299A3D6531D59D, 6696},
-{0x29DEECBDD93EFA, 393},
-{0x2A02C73AAD3AF3, 686},
-{0x2AFB76E6E1601E, 273},
-{0x2B17396C8A1303, 383},
-{0x2D92D769BA8910, 325},
-{0x2DAAB5B074C141, 237},
-{0x2DCD7819ED222B, 1314},
-{0x2E71971CD3F4BD, 638},
-{0x306C46111A985A, 420},
-{0x306D4A5DADC46C, 389},
-{0x30E556E50F5FD9, 304},
-{0x3111F065DA3C41, 479},
-{0x327B8BA5EF0A69, 251},
-{0x32911B5F4005B4, 748},
-{0x32F9C7E74787AE, 212},
-{0x33D8698478D964, 531},
-{0x34B6C0F913E3EB, 206},
-{0x34C4A9AF1F069F, 209},
-{0x35FA4F4C81ADC5, 267},
-{0x362CAA26060310, 346},
-{0x36B77CC7944161, 469},
-{0x36F5A2DDE4E8E4, 769},
-{0x39F93CF6545B5E, 552},
-{0x3B50593B93B508, 448},
-{0x3C4591E02D2427, 440},
-{0x3DA8CF9AD4B2D6, 215},
-{0x3EFBAE9EDB2A18, 206},
-{0x3FB62AB4A2FB2E, 436},
-{0x40F214E34D9760, 312},
-{0x42924906B72448, 229},
-{0x42DF5973F9FBC4, 377},
-{0x42E8CAAFD6F4DF, 353},
-{0x4324CEFEA36010, 684},
-{0x448A2E103570CC, 283},
-{0x455CFF72FC0C66, 351},
-{0x45A4B666AD3DF9, 471},
-{0x463F0B84F458D6, 233},
-{0x47F25D308AD9C7, 565},
-{0x4858EBC172D31A, 250},
-{0x48B96688247A6B, 230},
-{0x49479DC2671C64, 236},
-{0x4A6C12D9D0AB78, 207},
-{0x4B31CD9B4290D8, 266},
-{0x4C89085B0E6BEE, 1325},
-{0x4C8D41D40AF08A, 703},
-{0x4D0D4AE630BB5E, 526},
-{0x4D3865CFE624FF, 223},
-{0x4D71752619B4A4, 204},
-{0x4EF1F704287593, 812},
-{0x4F0D32A442BC42, 255},
-{0x501BDDE204A4C3, 1242},
-{0x50776168FD3A73, 2315},
-{0x519D48DF7D6952, 410},
-{0x561619780D8806, 202},
-{0x5637EAAAD39013, 229},
-{0x570D587F94D90D, 770},
-{0x5713ECECDEECA7, 331},
-{0x578051C13C5D2B, 18370},
-{0x5787B800C8B26C, 242},
-{0x579B55DDEB6E48, 593},
-{0x57D57792CB658E, 290},
-{0x57DA2BD1FF5151, 240},
-{0x591A01A7C81568, 681},
-{0x59B5A94A4FB4B1, 207},
-{0x59C67DF4D1A5E1, 283},
-{0x5A281628C3D0EC, 695},
-{0x5B0CAECC247581, 1146},
-{0x5BAC69A9CBDE61, 382},
-{0x5BB8826360A1CF, 212},
-{0x5FF373F6484FCC, 242},
-{0x6045ACEBAE3B93, 376},
-{0x609FB04BE46226, 407},
-{0x60CA17C5E94476, 798},
-{0x60E83C6994232A, 3254},
-{0x6111B9B8D9375E, 3134},
-{0x619ACE2896A3B2, 1301},
-{0x61D22AAB490066, 279},
-{0x6222E989DB5F3E, 3332},
-{0x624E08CA546342, 274},
-{0x627C26C31D8952, 2181},
-{0x628ACA3AA29575, 814},
-{0x62BDCB039A40AA, 378},
-{0x62C190539BF216, 435},
-{0x65097D8DFB1C4B, 519},
-{0x6B5B3DFA99BA59, 243},
-{0x6B7B1BE9270A3B, 596},
-{0x6BC1289A04D7DB, 260},
-{0x6C4B5837D0DB9F, 1412},
-{0x6D3AA8887D8A87, 290},
-{0x6D7C29704A106D, 461},
-{0x6F44793750CF12, 286},
-{0x703D40C9265D80, 209},
-{0x72F37C5B05A65D, 554},
-{0x732D348EDF1A58, 272},
-{0x736B02B7C83FD6, 339},
-{0x74137140C7F193, 382},
-{0x74DF4FBD7EF194, 494},
-{0x75602A4932C857, 876},
-{0x77F0FD3687DBCB, 592},
-{0x7813FEFDF2C88B, 627},
-{0x7840B85A007187, 1023},
-{0x7BF0B2165E32CD, 3459},
-{0x7C01D53A39563A, 1545},
-{0x7D41243F6B6A1D, 238},
-{0x7F26C151687295, 206},
-{0x8052EEC2A90889, 529},
-{0x8075DB0F4B5532, 277},
-{0x80CE28FBFD4672, 1180},
-{0x8130D85FA2F4D2, 202},
-{0x8171838E9DEC14, 484},
-{0x81A5FBD7EC73D8, 363},
-{0x8316BE3D6A3504, 268},
-{0x84D40A55F2F3F0, 222},
-{0x851D4B43BCA198, 708},
-{0x859A4B2D533579, 653},
-{0x85E9D1E9F7F983, 250},
-{0x865D91C3F83B1C, 601},
-{0x86A3997DB1A92C, 281},
-{0x874EC88C5231E5, 308},
-{0x880DBF69ABF06B, 259},
-{0x883EE120D04FA3, 469},
-{0x887CF5030B2746, 224},
-{0x8A0C1BE75F4552, 12494},
-{0x8ADD0CE1510D54, 215},
-{0x8BD8F9349602DD, 202},
-{0x8C28BA0F42F7A7, 219},
-{0x8C49DAC81F35E3, 432},
-{0x8D861F8D5030E9, 286},
-{0x8E7EBB4A718713, 3274},
-{0x8E8778486E78F7, 451},
-{0x8F138E98CE77BC, 248},
-{0x8FA02996001AE7, 589},
-{0x913DC8FEC5B904, 454},
-{0x91AD3447FE8799, 1221},
-{0x92DB487EEE28F6, 2866},
-{0x930AF2685F543B, 744},
-{0x941DFC9947A6FB, 578},
-{0x9464E3012DB076, 525},
-{0x94C58147AF44A7, 230},
-{0x95DD7AE98EA200, 591},
-{0x961CB9D6A903FA, 1281},
-{0x9787E73B5E30BB, 1764},
-{0x98B6100A0CF5F1, 204},
-{0x99D6E996BDFD0D, 317},
-{0x9A08B924D7E9B4, 790},
-{0x9A75092F9F44B9, 1831},
-{0x9B5457B54384E3, 290},
-{0x9BA178534DA7BC, 399},
-{0x9C419156EFB28D, 601},
-{0x9C502449E58B90, 298},
-{0x9C73840E7DAFE2, 277},
-{0x9D5577398FA1D1, 547},
-{0x9D731A836AB49C, 1536},
-{0x9E5E788DF07AE7, 238},
-{0x9F24E116A4484C, 220},
-{0x9F362F12E88C4F, 637},
-{0x9F4E3ADCC482E0, 322},
-{0x9F6BFE35F0BAA5, 618},
-{0xA0499EB169F457, 361},
-{0xA1EAC6F9412855, 414},
-{0xA2A4421ED5A3C6, 572},
-{0xA3268EEC4AAED8, 449},
-{0xA3D304FFD0F4B2, 372},
-{0xA46F2F856E285A, 561},
-{0xA521F3E78FB86C, 329},
-{0xA63491179B579F, 2917},
-{0xA682BE6F7BC51F, 491},
-{0xA6CE9474EE68E3, 617},
-{0xA87475558F7731, 236},
-{0xA890379DFF9C73, 294},
-{0xA9454BBEBD0D36, 541},
-{0xAC93F1AD747C98, 1079},
-{0xACAB5C674880E2, 382},
-{0xACE867DC2544D9, 366},
-{0xACFDD1B6BA0CEB, 2419},
-{0xAF0AE98A27B13F, 220},
-{0xAF46EBCF7B53CA, 177055},
-{0xAFA78FF6481433, 4494},
-{0xAFCB9A485D7CD0, 266},
-{0xB2867E53F48363, 345},
-{0xB34231F9A56144, 247},
-{0xB3C3FB166ECBD0, 372},
-{0xB492EBEB414C6F, 702},
-{0xB61DA30A656BC7, 2258},
-{0xB65530F5D2BCA8, 506},
-{0xB6D263BF37FF2C, 675},
-{0xB72AFA55508855, 2335},
-{0xB76BFE781174D1, 1109},
-{0xB7E979C087C84E, 3829},
-{0xB8CD3F25F7F771, 212},
-{0xB8E6A38CC1DE24, 309},
-{0xB8EC36BC167C38, 298},
-{0xB92CEFDEE30A03, 215},
-{0xB9376AF8BB7E01, 220},
-{0xB9A00A643699F6, 406},
-{0xBBA6C2F5CC9253, 1566},
-{0xBBDCC3E2EE6EFF, 234},
-{0xBC74E23AA603F7, 249},
-{0xBD66E157F2F61C, 224},
-{0xBE68B49FAE5D3F, 4211},
-{0xBE74FBFDC41848, 1999},
-{0xBF17C89712D591, 213},
-{0xBF50CDF6045F1C, 1147},
-{0xBF931629B4560D, 387},
-{0xBF9FE84A081290, 619},
-{0xBFA9743B1CE14F, 213},
-{0xBFFD3CE4A7A648, 273},
-{0xC053097B48F534, 230},
-{0xC07D580B62D38D, 270},
-{0xC18433B0E1F2CB, 546},
-{0xC18B8A090AF432, 880},
-{0xC2DB7653FFA07D, 726},
-{0xC3D5082DDC4490, 351},
-{0xC3D52F64038768, 255},
-{0xC3F45B5D7F80F6, 319},
-{0xC544ED0973DC1B, 294},
-{0xC5E4D700E03BBA, 348},
-{0xC6EC9AF03CF763, 598},
-{0xC72FCDE2224A0A, 221},
-{0xC735A88554B1C3, 539},
-{0xC7A8BB88C65743, 261},
-{0xC828B5AE5541B1, 458},
-{0xC8A82AE63D0009, 842},
-{0xC8EEAD68111630, 370},
-{0xC8FDCFCCFAFA4D, 587},
-{0xC98F09390C2B7C, 272},
-{0xCB3CE361FE1637, 286},
-{0xCCA51CD3F8CF06, 10448},
-{0xCCCDD19FE06E8D, 733},
-{0xCD82DC9504F40C, 648},
-{0xCDAE5192BBAD44, 720},
-{0xCDAF92BB057438, 224},
-{0xCDCA0F8FA55933, 321},
-{0xCDF67821C5F77D, 432},
-{0xD0544BF8C06C13, 406},
-{0xD079E6732405CD, 3319},
-{0xD15F4153BB441C, 1228},
-{0xD17C93B798754B, 594},
-{0xD1E29A1E8ADA71, 294},
-{0xD262921F0AFE93, 532},
-{0xD30BDB23687E4A, 259},
-{0xD31FC4D4C970BA, 1077},
-{0xD37DE14F61A80F, 287},
-{0xD4B653F4162E82, 7919},
-{0xD4D6C4F813DACD, 347},
-{0xD53A7317BFB7FE, 2267},
-{0xD5758FC1EC0673, 1461},
-{0xD5F8FE869A9FF8, 578},
-{0xD6322401BDFD4E, 242},
-{0xD63D8179AC7287, 359},
-{0xD6E65E3163F485, 224},
-{0xD7774827281FBD, 289},
-{0xD77B050DB4199C, 12962},
-{0xD83709D49BFFCE, 223},
-{0xD9626FFB639800, 257},
-{0xD99D45CE72EE8C, 236},
-{0xD9B5962509C7A0, 1266},
-{0xD9D6F3BF293E4D, 260},
-{0xD9EEE3ED141F26, 261},
-{0xDA170D1F5FDFF8, 249},
-{0xDB510A276CD165, 256},
-{0xDE11D1F931FD86, 1333},
-{0xDE660685712466, 253},
-{0xDE95885BC8B2D9, 484},
-{0xDEFDD4AD9EBC1A, 514},
-{0xE01DA0203AC0A4, 5678},
-{0xE0841BCE493520, 387},
-{0xE3824C5DF66D8C, 553},
-{0xE3D68958537AD6, 210},
-{0xE430D8C31AA329, 482},
-{0xE6A3F9EEF86CD2, 1122},
-{0xE6F505D7398F78, 2200},
-{0xE89890245B39D7, 369},
-{0xE9B40B57B5865E, 203},
-{0xEA5234071D582A, 236},
-{0xEB4C977984265A, 344},
-{0xEBB60EA7FBBB1A, 622},
-{0xEBB733AF0460CD, 747},
-{0xEC1F196135DC1B, 2649},
-{0xED584BA2338D38, 246},
-{0xED8259C65668D7, 213},
-{0xEDA537C9833A86, 839},
-{0xEDDCDC08C8B29E, 401},
-{0xEDF7C5E823D6A9, 952},
-{0xEE980292B579A0, 254},
-{0xEECE58959BF74F, 590},
-{0xEEDC46E715F7C5, 1279},
-{0xEFF18301EDFA91, 207},
-{0xF005277B83C6AD, 1875},
-{0xF04B2140095324, 280},
-{0xF148A58A38CE91, 347},
-{0xF14B068ECF9AAB, 280},
-{0xF3237B94DDFAA1, 208},
-{0xF3A6C00664F643, 206},
-{0xF458D2B789EDDC, 1254},
-{0xF52D09159AA006, 11876},
-{0xF54FC5A25F5EAF, 1554},
-{0xF7B91A1DFADE59, 3405},
-{0xF82E5225043966, 380},
-{0xF8381F9D97A385, 476},
-{0xF892297CAE6DDF, 760},
-{0xF8D68BF09048D7, 258},
-{0xF939547E3FE4D4, 352},
-{0xF94AF93CAE2BFC, 306},
-{0xF9F9FD13E163CF, 256},
-{0xFA5DB06F5113E1, 868},
-{0xFA75C819ECD18F, 1654},
-{0xFADD77D12B6027, 746},
-{0xFBD92C1886668B, 362},
-{0xFC4E6F1570D387, 332},
-{0xFF2A3FEEEBF7B8, 484},
-{0xFF81465A0A4EF5, 291},
-{0xFFA6969575E23E, 2809},
-{0x1007EAC7828AE1C, 271},
-{0x10195FD9B15FC5E, 264},
-{0x103018ACB547958, 649},
-{0x1034ABF7F7C13FA, 597},
-{0x104CD6B407645E1, 248},
-{0x104E5F7874C2CEE, 229},
-{0x105079614C852F4, 384},
-{0x10640364935AE1C, 665},
-{0x107805E5AE381F1, 343},
-{0x107900892CA9EF3, 619},
-{0x107C03321694A7E, 258},
-{0x1086295C1CF0298, 679},
-{0x1087C64052B86CD, 289},
-{0x10A83CA9A535CAD, 398},
-{0x10A8981924186DB, 416},
-{0x10AD3815AA3D90D, 318},
-{0x10B1214085AF944, 1076},
-{0x10D78879599BF46, 615},
-{0x10E09BA08A2CF81, 520},
-{0x10E1B1B8A80B442, 902},
-{0x10E3AE0284D04E2, 1165},
-{0x10E75A5128C3CDE, 202},
-{0x10E9DDF2A4B6E2E, 509},
-{0x10EC6A065B0C23A, 249},
-{0x10ED38917EC8943, 2388},
-{0x10FBCA7BDE1F71D, 680},
-{0x10FF07D50066CB2, 31019},
-{0x1104E740768BCFB, 1066},
-{0x11186869EA8569F, 347},
-{0x1119794656C8658, 333},
-{0x11227E3B5479806, 220},
-{0x112CC1205C00C93, 487},
-{0x112D76702AE797B, 917},
-{0x113456F61540212, 276},
-{0x113F2C5A76D7F50, 214},
-{0x11416FB728EE682, 1048},
-{0x11448A677123E0B, 271},
-{0x1151CDF5607AD2E, 253},
-{0x116C908AF07BC64, 267},
-{0x117474525E76070, 374},
-{0x1175B2603A2BD5F, 362},
-{0x11A0094FD96FDEC, 208},
-{0x11A1646D60AC690, 3553},
-{0x11A9F53F7CAD006, 303},
-{0x11C62746F9DE38A, 288},
-{0x11DC519A9477724, 304},
-{0x11E060293F9D911, 1258},
-{0x11E29E8A5D76B6A, 357},
-{0x11EC39806DB884F, 296},
-{0x120AA9E70E0D9DB, 245},
-{0x1210BFFA1BD2437, 210},
-{0x12269853CDE4CDF, 790},
-{0x12281248FD0B27E, 478},
-{0x123255420314B28, 229},
-{0x1232A75E05BC39B, 579},
-{0x123912880D42E04, 253},
-{0x123C870298EF5B7, 223},
-{0x1256FFA8E5E0BC9, 225},
-{0x125CE829C10F902, 254},
-{0x126E95D06B32F40, 267},
-{0x126F4E548EAC687, 251},
-{0x128E6A07BDF8193, 202},
-{0x1295C9128E52A00, 1522},
-{0x12A509C0FC5302B, 305},
-{0x12AA34D94C0D776, 552},
-{0x12D0BEF421B5A64, 215},
-{0x12D7C9E478C4F43, 468},
-{0x12E1CF728AE286E, 274},
-{0x12E863F20CECE0D, 311},
-{0x12FA3F9F83F305B, 1034},
-{0x131FDB06C0B846C, 937},
-{0x1335100C21731CC, 964},
-{0x133A36F2AA5F423, 295},
-{0x134231C7AA8F965, 548},
-{0x13447B17D2D7C32, 3815},
-{0x1346B3201AB8E36, 201},
-{0x134E7D0ADCD4397, 667},
-{0x134E8605A835B74, 491},
-{0x135EAA458C3103D, 357},
-{0x1384DEE47E24E95, 229},
-{0x1388DDC185B984C, 344},
-{0x139A08BC97B31C4, 1802},
-{0x13B7199ECB2DA44, 342},
-{0x13BB53E3D6BCE9E, 302},
-{0x13C5A6EE64855F1, 1474},
-{0x13D4A554B900821, 4032},
-{0x13DBA873A1A902E, 941},
-{0x13E77A1F83B8758, 419},
-{0x13F0E77F69CACEF, 206},
-{0x13FEDDBB28DA0FB, 333},
-{0x1419E6123E24DB0, 918},
-{0x141BDB8A8DF2FBE, 266},
-{0x142067233CB4534, 1753},
-{0x1422833468FC7CC, 683},
-{0x1426B3F81070F64, 12804},
-{0x14302AAB5D60D69, 841},
-{0x1439174FF082A7E, 246},
-{0x144D554307819F6, 209},
-{0x14541BEFC0D26AD, 240},
-{0x145F6C796C0FC6E, 395},
-{0x146B3B376E84B97, 450},
-{0x1481E8C14876D77, 249},
-{0x148EDD2C56C3FBD, 464},
-{0x14994D50909DB8B, 1464},
-{0x149E62D436137AF, 352},
-{0x14A1B709F0CDE13, 266},
-{0x14AE1344D5C3B3E, 212},
-{0x14BCAC6591BF29D, 218},
-{0x14C0EBDD189C80D, 228},
-{0x14E2F3C7403B8B1, 491},
-{0x14E9DD65AC8DE99, 655},
-{0x1500AA672B8D794, 672},
-{0x1501AE3D320663D, 201},
-{0x151AB10C7085A6A, 232},
-{0x152BC4441C892F6, 733},
-{0x15341FD8928CE38, 339},
-{0x153825F59A28301, 434},
-{0x153B9F81C7822B8, 994},
-{0x154659CE4DC1D40, 347},
-{0x155490ABE88D15F, 843},
-{0x15605F95BCA1974, 9677},
-{0x156816680C1DBF5, 745},
-{0x156DB5184FCA8CD, 297},
-{0x158D85065653EF1, 240},
-{0x15B74CBEBB23393, 339},
-{0x15E976CFF1080DB, 503},
-{0x15EE9D0F76AAD8A, 241},
-{0x15F0E9C2A7BBBA7, 816},
-{0x15F6E8705BA4132, 298},
-{0x15F871B34D88E53, 208},
-{0x16013B699C2B89F, 2738},
-{0x16123B12718AE86, 284},
-{0x162480774255BA6, 213},
-{0x162C6559C072DCE, 414},
-{0x163184056BDA227, 447},
-{0x1633656987D3ECA, 298},
-{0x16354A60FB5D819, 327},
-{0x16366B205DBFB85, 212},
-{0x1636B3FEF623BE7, 369},
-{0x164663CD6E15C7E, 215},
-{0x1646E677BB08BD2, 1680},
-{0x16478E3D56C39E6, 2748},
-{0x164A31C78CB8F35, 13665},
-{0x1665E6544D408B7, 252},
-{0x166EC1AC671BB1C, 217},
-{0x1672EEC919BFF6D, 351},
-{0x167E41DF9F342B8, 214},
-{0x16870D8084FD39A, 225},
-{0x168F730C69ED231, 232},
-{0x1694E40298C88F5, 210},
-{0x16988C8BB80A812, 259},
-{0x169D3553834F4CA, 311},
-{0x16A2CC9148EC4A7, 554},
-{0x16A801B2035432E, 797},
-{0x16B6F89269DB112, 376},
-{0x16C331B8547E1D7, 308},
-{0x16C9B03A99FC15E, 3130},
-{0x16CE1C80D07AE25, 795},
-{0x16E8CE50ACCD4A7, 436},
-{0x16F825ECA8CBE16, 679},
-{0x17059EFE3D91E2D, 240},
-{0x170D032605CA772, 201},
-{0x1710D4CA6EC3C6D, 542},
-{0x171B473F4803D1C, 345},
-{0x171F4C1D9817366, 301},
-{0x172B575CC7E852B, 389},
-{0x1733D6D250A5796, 2382},
-{0x1736D11E50B1178, 864},
-{0x174BCF2060AE4D5, 2634},
-{0x1750BFE100BFD8E, 241},
-{0x175AF55D0559D34, 238},
-{0x175C9FC0FDAF1AE, 899},
-{0x1760F154EFF9D7C, 334},
-{0x17681F2C85C8E4E, 245},
-{0x176B4579BBDD68E, 429},
-{0x177F259EC82DDF5, 1482},
-{0x17865FE8BA7F780, 806},
-{0x17A013171619C72, 208},
-{0x17A9413631C6993, 279},
-{0x17ACD534F48B6C2, 473},
-{0x17E52374D766215, 280},
-{0x17F2E94C2144195, 924},
-{0x17F33828B80B817, 249},
-{0x17FDC20B91E55F9, 488},
-{0x181684EDA4B1505, 663},
-{0x18289252E9FAD28, 435},
-{0x182DE2371586C4A, 265},
-{0x18350E951A5AA6D, 367},
-{0x183BC622DFBF98E, 598},
-{0x18400A0BBCD8AC1, 618},
-{0x184A7132B4500A4, 441},
-{0x185B325200A429C, 373},
-{0x189984F269CE34A, 453},
-{0x189B7D2A50D1199, 231},
-{0x189C84AA85C470B, 232},
-{0x18B02A544052DCF, 759},
-{0x18BAF882015C6D0, 226},
-{0x18E60DB57B617FD, 234},
-{0x18EED183C6B49A5, 11116},
-{0x18F1BA13B122C21, 236},
-{0x18F2EF5C0A83632, 242},
-{0x18FB4BD8D44FB4A, 373},
-{0x19184DD37B0A4FE, 308},
-{0x191AC2096879661, 260},
-{0x191D5D0B04ABDFB, 3703},
-{0x192682E42BC86A2, 528},
-{0x1927FB274EA23AF, 726},
-{0x192C43540FBC0F9, 293},
-{0x193209809FD8994, 888},
-{0x193A83237003404, 2619},
-{0x19520D8491D8211, 215},
-{0x19544888AC0C273, 770},
-{0x1957EF443BB35A7, 439},
-{0x1958E19994EDC0F, 204},
-{0x195E6358E8B6886, 1296},
-{0x19636391EA21768, 316},
-{0x1969F06D4D99717, 283},
-{0x196AA09EF3E652A, 274},
-{0x199E295B95EA288, 230},
-{0x19A766363A68EFB, 447},
-{0x19AE1770333A586, 4487},
-{0x19B2E2ACD825CB0, 94333},
-{0x19BC22320F2D761, 216},
-{0x19C1E1B3B133675, 345},
-{0x19D52E17133E4E8, 326},
-{0x19F68EB1FED4952, 217},
-{0x1A15A74500E0ED6, 7156},
-{0x1A1F1174442A9CB, 432},
-{0x1A354E8DAF2546B, 377},
-{0x1A5FDBFFF0B656C, 234},
-{0x1A906025D4818B1, 562},
-{0x1A9E76AB7B9AE4A, 3516},
-{0x1AA1374801B53E9, 326},
-{0x1AB8EB3CFFDA0EF, 2185},
-{0x1AC0B259F948F49, 553},
-{0x1AC6552A3B96C76, 384},
-{0x1ACC44D35CBE576, 296},
-{0x1ACF08CCD8D9BE8, 828},
-{0x1AD048FCBA6E546, 480},
-{0x1AEC908B9B4624D, 329},
-{0x1B02312E3B4DDCB, 390},
-{0x1B175A10AED9664, 205},
-{0x1B1CD13898EDDF7, 414},
-{0x1B23246D2B20614, 236},
-{0x1B380C0DCF864B2, 224},
-{0x1B4095B812417C2, 1069},
-{0x1B4BC5E57326AFD, 4028},
-{0x1B5E20BB5E87694, 232},
-{0x1B61372333E5DBE, 711},
-{0x1B6E6F4127D7CC9, 9308},
-{0x1B759C99BEC95D0, 451},
-{0x1B9529D325486D3, 231},
-{0x1B98A3A9558EB39, 1155},
-{0x1B9F53B1080CC6D, 324},
-{0x1BA0F7046707D16, 531},
-{0x1BA29C2866C6951, 367},
-{0x1BA8B87B97F24E1, 227},
-{0x1BA9E5D43AC2719, 1663},
-{0x1BC37EE5EF7960B, 526},
-{0x1BCAEB95CA74F4A, 1523},
-{0x1BCE2022578F948, 232},
-{0x1BD68F0E09E554B, 299},
-{0x1BD7F6C37BCC39D, 362},
-{0x1BDB9A43296BA5F, 218},
-{0x1BF94562788620E, 403},
-{0x1C0A76F7684ACE3, 333},
-{0x1C29B1B8B00BE3A, 545},
-{0x1C29D7BAEB27F3B, 250},
-{0x1C2D189002D47E3, 1751},
-{0x1C3F5E052E6F340, 279},
-{0x1C47A955901080F, 353},
-{0x1C4F87004F7625E, 324},
-{0x1C5472DBA0DDEB3, 634},
-{0x1C6DDB6A9D5FBCB, 463},
-{0x1C737A2AC32D6E5, 395},
-{0x1C86642E38A4156, 1410},
-{0x1C8D0F0322B080E, 202},
-{0x1CA0A238BBE889D, 16358},
-{0x1CA786B2033AFD5, 320},
-{0x1CB5CBD45EAAF44, 277},
-{0x1CB9DA9D3396C98, 300},
-{0x1CD62B87062D01B, 1205},
-{0x1CDB8B502B09394, 308},
-{0x1CDCBC01110676B, 405},
-{0x1CE434F8003FB09, 209},
-{0x1CE548BB2F65694, 1539},
-{0x1CE6DC079A7635F, 287},
-{0x1CE8A0149E90BB6, 281},
-{0x1CF10289AB36FB1, 276},
-{0x1CF718A7AD47FE9, 287},
-{0x1CF9652DF5E86C8, 237},
-{0x1CFADE08D093BC5, 1073},
-{0x1D0C2779338EC0F, 1089},
-{0x1D1207E5BDBBF78, 224},
-{0x1D3AAC475473B94, 986},
-{0x1D3C5B890912F06, 1695},
-{0x1D4C3089E794290, 747},
-{0x1D5DD94D64325E1, 368},
-{0x1D71ED7B0EDF8C0, 780},
-{0x1D793070EA5C906, 379},
-{0x1D80F35849FDF5A, 382},
-{0x1D844CD08BA54C9, 3290},
-{0x1DA1210B766D2A6, 255},
-{0x1DA44998FE10B44, 298},
-{0x1DA9C9B9E2C2F96, 802},
-{0x1DB69B588401A56, 2651},
-{0x1DC3A6CEBFE6340, 540},
-{0x1DCD3713064E659, 820},
-{0x1DD0B992DDB3976, 285},
-{0x1DD80F7A796429D, 242},
-{0x1DDB154E064E0D8, 213},
-{0x1DF30C0776C0B5A, 231},
-{0x1DF518E8015B5A0, 307},
-{0x1E0F6CA29D7ABFE, 424},
-{0x1E2247E752CD1AA, 212},
-{0x1E3468C8ECF140F, 224},
-{0x1E3538641FB5555, 1513},
-{0x1E36BD9C60FCE3F, 544},
-{0x1E4E6416DD0CC9F, 1556},
-{0x1E6FCC7EE347E1F, 459},
-{0x1E7DA6A3E5CAA6A, 229},
-{0x1E7DFA12DBFBE18, 293},
-{0x1E842E527831A06, 6070},
-{0x1E994F90BC491A0, 747},
-{0x1EA79D0BE59F192, 214},
-{0x1EAA45AFBAF90A2, 373},
-{0x1EAF17607CBF7BF, 522},
-{0x1EBA92ADFAA83E5, 323},
-{0x1EC7CCD0832E29F, 213},
-{0x1EDAD979BBAE6B0, 373},
-{0x1EDE17C62BEE26B, 596},
-{0x1EF2490C5CF058A, 1042},
-{0x1EFC16DAEECECD9, 632},
-{0x1F01F238381BF29, 265},
-{0x1F1B4F6279ED3F0, 335},
-{0x1F1CDF9870AB815, 276},
-{0x1F1FB986179D549, 258},
-{0x1F30758F7E2BD40, 1139},
-{0x1F3F246B6F0843A, 4407},
-{0x1F4FC8B0F18D6B6, 513},
-{0x1F5268E3E352925, 211},
-{0x1F59B293AA126D1, 4992},
-{0x1F5B13AAC5B48AC, 632},
-{0x1F8E1872086AE02, 212},
-{0x1F985201A0B2F8B, 851},
-{0x1F99326A07BAE50, 447},
-{0x1FAEC4F95178FE3, 233},
-{0x1FB03C3719B5DAF, 2147},
-{0x1FBEF8DF0910D7A, 268},
-{0x1FBF519B4BD296C, 620},
-{0x1FCC58B91E01FF3, 371},
-{0x1FD96EE7ADD6F68, 542},
-{0x1FDC6F678F8F8C8, 227},
-{0x200D9BCE01D87B2, 200},
-{0x200DF3720FCB1B6, 340},
-{0x200FB264975E1B4, 1080},
-{0x201A577666A5723, 691},
-{0x201B7749AFBD596, 213},
-{0x202E4D2013B9018, 5489},
-{0x203822BA8B35949, 781},
-{0x204EA30FE1D586E, 341},
-{0x205A612B5AFB025, 417},
-{0x205B3DA9207BCBB, 205},
-{0x205F8DFF8D3A74A, 441},
-{0x206065EDFECBE91, 430},
-{0x206754828B3C9D8, 945},
-{0x2073FE927C5BFCB, 490},
-{0x207C3C9B16B32F0, 1300},
-{0x207EAD9A8950B40, 389},
-{0x2082F1BDB055DBF, 323},
-{0x208B6D453364AE2, 271},
-{0x208F12815432411, 1797},
-{0x208F4404BD5E4CF, 267},
-{0x20A9047F3FE2D26, 1480},
-{0x20BE422B38A3140, 223},
-{0x20C84B13EF5DBCC, 213},
-{0x20D8C19023E963B, 497},
-{0x20DEF863F1A0BA9, 205},
-{0x20E8D7F9F02EBF6, 208},
-{0x20EB42A46EBF28A, 433},
-{0x20FA282F5D7E462, 252},
-{0x2102DC893F25308, 511},
-{0x21057A9D128B564, 288},
-{0x210658BFB1BF179, 4991},
-{0x2112E59F5E8EBF2, 267},
-{0x213B6A9F488CAA6, 215},
-{0x214CAC901F175E9, 489},
-{0x215775AEFA70A88, 223},
-{0x21601BB6CF3059E, 2934},
-{0x2162DA539208993, 1019},
-{0x21725EF308B9E9B, 5983},
-{0x217659DA1D3C9D5, 209},
-{0x21864DAF8F43C2E, 2811},
-{0x218DB5CE3A94E36, 232},
-{0x21AB97D27793CA3, 344},
-{0x21AC2EB562804E2, 285},
-{0x21AD90D718811A9, 547},
-{0x21CB514E8BFAD2D, 604},
-{0x21E093DC1C1022F, 1312},
-{0x2200F4D32055043, 268},
-{0x220D7AE61AA7C24, 234},
-{0x221B8AE9ACB93D1, 255},
-{0x2228FB795591F7B, 457},
-{0x222AD92E6CCBF3F, 452},
-{0x22335BF2237D1C2, 395},
-{0x2234DD508DEEC97, 373},
-{0x2242D5B15A4AA3A, 375},
-{0x22483450483DE21, 702},
-{0x224B4A27902501D, 362},
-{0x225B7B9C91D510A, 332},
-{0x226E3DB62164EF0, 797},
-{0x2273C19946DB5A6, 411},
-{0x2278AB0D1BAE588, 324},
-{0x227908B05352C46, 6064},
-{0x22880180D558972, 672},
-{0x228F9FC418DFA9B, 205},
-{0x229B99F261335B1, 216},
-{0x22A677DF0E9F34D, 382},
-{0x22ACA0C563CC17F, 719},
-{0x22B361B6345696D, 232},
-{0x22B9276CF4F8191, 270},
-{0x22BD785F520DE1E, 554},
-{0x22E04A2CF9A4D8B, 682},
-{0x22E636AE5EBFE6F, 552},
-{0x22F620AD4DEDEFA, 219},
-{0x2301E018957C956, 992},
-{0x230AB4CD8797A47, 512},
-{0x2315C965EDEBEA6, 1938},
-{0x2336231EC124779, 273},
-{0x233968FFA34C5B5, 439},
-{0x23604B6FA2F45D3, 807},
-{0x236E3061966A282, 8051},
-{0x237454C01E20643, 274},
-{0x23760D523B6D325, 264},
-{0x239174348406803, 800},
-{0x239660166A558E3, 215},
-{0x23A0D2A04860C31, 343},
-{0x23A1642BFC4E37C, 220},
-{0x23A5F315C3F66CB, 314},
-{0x23AF5B588D0BC79, 659},
-{0x23B5141D7B2F5FB, 240},
-{0x23B9A4B2FA18086, 221},
-{0x23D0D3AD0E5E4CC, 632},
-{0x23D478B3B405983, 303},
-{0x23D70727E4F30E0, 406},
-{0x23E11488D8425CA, 261},
-{0x23EAEDFBC6CB0C6, 210},
-{0x23F1865585647D2, 232},
-{0x23F5F54EACA86F5, 776},
-{0x23FB42763C6DFE3, 970},
-{0x240E91A41C39A55, 759},
-{0x241047AA6AD1638, 558},
-{0x246168C5996C25D, 767},
-{0x2469C31C752A108, 271},
-{0x246E92FCFED3F67, 277},
-{0x247FC39EF14BCB8, 523},
-{0x248368A369CFF18, 214},
-{0x24899CC67C67C53, 205},
-{0x24914F8E114D21B, 21961},
-{0x24930360337C1F3, 1914},
-{0x249848D6CB71B83, 229},
-{0x2498D5247E65B9F, 225},
-{0x24A00D708333193, 719},
-{0x24B4408413D235E, 239},
-{0x24C68BE8F4A0DD5, 288},
-{0x24CEDD89BDBF10A, 358},
-{0x24D1FE581B6EBB8, 349},
-{0x24E10CA5DC55B1A, 590},
-{0x24ECE6FD4DE2561, 243},
-{0x24F27FBEA98227D, 299},
-{0x24F341C0D9A0F24, 465},
-{0x2515DB0254E27B8, 3825},
-{0x25182894C898BCC, 203},
-{0x252F8CE01FA5D4E, 211},
-{0x253DBF2CB14A43C, 1219},
-{0x2547EC8341FB41E, 663},
-{0x255062B8E87B719, 1522},
-{0x255700900836495, 1138},
-{0x256866757321B7A, 536},
-{0x256D9ABB1DB7E92, 308},
-{0x2580343979CE384, 3743},
-{0x258BA299275F602, 298},
-{0x258BC9D4E537530, 235},
-{0x258D7B321F12B6F, 236},
-{0x25904BFB54E343B, 351},
-{0x2593AFD73A71491, 219},
-{0x259DF7A3276CA6C, 1168},
-{0x25A02A1AC8382AC, 1467},
-{0x25A38711DC3A010, 579},
-{0x25AE374E47E6A1D, 202},
-{0x25C75F263BA86D1, 355},
-{0x25CFF6DBC265058, 427},
-{0x25D35B40B3FE48F, 687770},
-{0x25D57F7CA329195, 207},
-{0x25E6CBDC6A1E860, 656},
-{0x25EB1FEE5EEEEB8, 295},
-{0x25EF32A15EDF7E1, 202},
-{0x26003B2B2EE3B2B, 310},
-{0x2600F5640799CF3, 1296},
-{0x26051D7530E1429, 577},
-{0x2610C68087DDDA1, 327},
-{0x261AE166986218E, 272},
-{0x2627098D70D6E30, 3085},
-{0x2628A16410E691D, 478},
-{0x262EDEAE9A1E11D, 376},
-{0x263A37B50DB9126, 206},
-{0x263D0602F73844B, 637},
-{0x2643224838B159B, 443},
-{0x26685311AEB4311, 8913},
-{0x266B01B2D206FF3, 239},
-{0x266EBB900AC93BF, 381},
-{0x267A905DB1117FF, 265},
-{0x267DA1E9128EEFC, 277},
-{0x268AC6906AE8F2A, 357},
-{0x268CF70DC48C494, 893},
-{0x26AC78903214B43, 247},
-{0x26B09CED0BB2BE9, 296},
-{0x26B4C28D5AB5BE5, 402},
-{0x26B724820ABF921, 300},
-{0x26C5B04AADC7B49, 508},
-{0x26C84E7B8C30D7A, 213},
-{0x26CEE8A94BAA14D, 224},
-{0x26D9A47204E55D7, 299},
-{0x26DB5FB5EF0EF27, 1809},
-{0x26F7256A594A3A8, 261},
-{0x26FFB0DDD74DED0, 245},
-{0x270713AF3754C56, 849},
-{0x270E51E5FAA4710, 240},
-{0x271542E525E3381, 881},
-{0x2744391F01EEBDE, 335},
-{0x275AEE5BA2C9242, 255},
-{0x275BF308D91A741, 354},
-{0x2760A10F6CA32F4, 219},
-{0x2764736C1C33145, 7265},
-{0x2768249E09D83FC, 229},
-{0x276F628E862D78C, 491},
-{0x2775EFBA2ABD859, 359},
-{0x277A3705EF315F8, 606},
-{0x278E5907F9C2CEA, 275},
-{0x279AFBF3F3D6F37, 11299},
-{0x279B5A9FE94205A, 3054},
-{0x279FECF97F50CC1, 301},
-{0x27A437998D9AA63, 862},
-{0x27A735000E70EDE, 325},
-{0x27BDEC97485CC8C, 690},
-{0x27D184A60121594, 2564},
-{0x27D3D2A8B31ECC1, 540},
-{0x27FAAB5742C1DAA, 256},
-{0x28028A44B0AD50C, 232},
-{0x280BDFFB8E4286F, 602},
-{0x2814156574F3A2F, 272},
-{0x281CA8AC0D3F655, 304},
-{0x281CCAEE44E42B8, 341},
-{0x28203B19329AC69, 202},
-{0x28218CC3E407332, 260},
-{0x282A65FC0184CDA, 430},
-{0x283019C593AD14B, 290},
-{0x284698856AF40C8, 337},
-{0x2850299CCB0CAD9, 283},
-{0x2852685B4575697, 200},
-{0x28781B0EFCAC338, 303},
-{0x2883952E937E440, 305},
-{0x28966640A73B712, 599},
-{0x289F1D7C56F3670, 565},
-{0x28A4F68F1F7CF95, 393},
-{0x28B9B900E2F6918, 1735},
-{0x28C54A9E759170B, 252},
-{0x28DD330D81BA759, 223},
-{0x28FBCC37E1BC26C, 225},
-{0x28FDF29CC99A09C, 341},
-{0x28FF24470318F7D, 1547},
-{0x2903C159C381A0B, 208},
-{0x2904F9F09B8BDBC, 7608},
-{0x291F9F790E12F90, 416},
-{0x2920417C8AB06FC, 421},
-{0x2920FE2A48EC01D, 223},
-{0x29284F1948D78EB, 4817},
-{0x295372F9C5DD454, 315},
-{0x2953A7ECD2A571A, 572},
-{0x2962D751FED7EBC, 5302},
-{0x2969D54536612E0, 284},
-{0x296A379D480E63B, 1085},
-{0x297664CBDC73D00, 265},
-{0x297EBDBAACA46C7, 205},
-{0x298B04A3BF77C89, 261},
-{0x299E97B7A5F9198, 341},
-{0x29A5B76D174CCBB, 280},
-{0x29A7330BE85ABDC, 371},
-{0x29AB5807CD00BF8, 272},
-{0x29AC52A21A8DD37, 259},
-{0x29B3F549E7733EC, 1055},
-{0x29B436BF5A164CA, 1219},
-{0x29C1E51F07E5F2B, 972},
-{0x29C4733BF25871E, 218},
-{0x29C7482625FB30A, 214},
-{0x29CF8947807E979, 239},
-{0x29CFF86B9C33943, 207},
-{0x29D0D77BB01C193, 201},
-{0x29DF86083873E24, 714},
-{0x29E7843D99BC63B, 241},
-{0x29F48764A90402F, 375},
-{0x2A1C06887944F82, 799},
-{0x2A233000CCDF581, 869},
-{0x2A2AE598C53FE07, 311},
-{0x2A345FFB88299E3, 870},
-{0x2A401A04207F233, 320},
-{0x2A44869CDDD56FA, 212},
-{0x2A4B35983B7C04F, 491},
-{0x2A4B4661A13D3AC, 348},
-{0x2A5C029E7F5E953, 222},
-{0x2A5CBDB813305F6, 209},
-{0x2A5E8A92F631FC6, 437},
-{0x2A6B60A2517DD72, 310},
-{0x2A702380890EAB2, 290},
-{0x2A72153109440EA, 265},
-{0x2A94F9F000958A2, 659},
-{0x2A9C8151D3EEF00, 784},
-{0x2AA0B79B44C3A31, 226},
-{0x2AA5C2963973EB9, 448},
-{0x2ABA3753EA02045, 274},
-{0x2ABE85BF608F9C4, 252},
-{0x2ABFDB800EB8394, 310},
-{0x2AD763DC584B023, 309},
-{0x2AE1E5796C5757C, 703},
-{0x2AE32B396E0BBBB, 317},
-{0x2AE6BC8A0E81108, 295},
-{0x2AF1148A0A1CF9E, 382},
-{0x2AFD4F1AF03BC75, 1226},
-{0x2B5CB1269143F61, 228},
-{0x2B6B76F72A94F01, 361},
-{0x2B71A1691A016D5, 616},
-{0x2B7AB7C68CB7B77, 346},
-{0x2B84031DC950AB5, 1248},
-{0x2B8775F6EEF9D0E, 815},
-{0x2BA1BBE2BD5D890, 787},
-{0x2BB07ABD1B33847, 375},
-{0x2BBFAD978371899, 306},
-{0x2BC6BB62E396439, 817},
-{0x2BD14B071D29B7A, 205},
-{0x2BE31271235709E, 219},
-{0x2BEB5298968DE6B, 403},
-{0x2BEE682372240CD, 2363},
-{0x2C11171AA3E85E5, 393},
-{0x2C1A324C2342847, 889},
-{0x2C2237424C17A9F, 386},
-{0x2C27AC707E53470, 2526},
-{0x2C2BA670BA95FD0, 207},
-{0x2C343066A4C092A, 219},
-{0x2C43B41BB555DF7, 255},
-{0x2C555F2761DCDCC, 393},
-{0x2C5A654C7761F78, 1994},
-{0x2C5C22288A56BA6, 427},
-{0x2C694724C7677A9, 204},
-{0x2C6EAA32F695F51, 204},
-{0x2C762475250D6ED, 243},
-{0x2C879B3EFFF96A4, 484},
-{0x2C8AEE7A749497E, 256},
-{0x2CB11C16A8CE9BE, 503},
-{0x2CB24709410E272, 362},
-{0x2CB682AFB38F845, 1467},
-{0x2CCFDC4819EBAFB, 386},
-{0x2CDB61981C5C409, 641},
-{0x2D09C71EBC4131D, 293},
-{0x2D0BB0FAF3E882E, 569},
-{0x2D123D8FD9ADDA5, 374},
-{0x2D1AE06E29A0389, 1797},
-{0x2D298585C39439D, 508},
-{0x2D483FCF503149D, 310},
-{0x2D4921E4FBFD2CE, 7733},
-{0x2D49E4D145D5036, 262},
-{0x2D4D91484C3F674, 566},
-{0x2D4E527F6D51E18, 1064},
-{0x2D5AC769C72726D, 212},
-{0x2D70E7CC72852B9, 2068},
-{0x2D8DC5D4F548080, 1912},
-{0x2D8F6009074BE1B, 2619},
-{0x2DC479C889A8EC9, 232},
-{0x2DC637CF5DD4F87, 1099},
-{0x2DC70DAD0CA1390, 751},
-{0x2DE2B05D14699A7, 389},
-{0x2DEC7B1BEF432AA, 283},
-{0x2E01F35B7045B2B, 268},
-{0x2E06FF4133B34B8, 756},
-{0x2E08336F0111083, 11636},
-{0x2E0877ADF6B4728, 422},
-{0x2E0FBE1F4E46812, 240},
-{0x2E1F49C5C1CDF5A, 390},
-{0x2E27162B00DF55C, 400},
-{0x2E28ED1FBD5579A, 1503},
-{0x2E2A84F820AA586, 1528},
-{0x2E2E65E63CFF7CA, 510},
-{0x2E2FD5D14382498, 418},
-{0x2E39D213450DFED, 824},
-{0x2E42152B0A942EF, 485},
-{0x2E61D84731E219F, 261},
-{0x2E63DB8B1C7A7E9, 263},
-{0x2E9058D87302B18, 474},
-{0x2E9E4211E17DDF1, 472},
-{0x2EA63DD0D549B44, 409},
-{0x2ECABEF208E3F28, 206},
-{0x2EDA380FBEDDD52, 226},
-{0x2EDB5F8F52B1EAB, 326},
-{0x2EFD05183844B95, 2772},
-{0x2EFE9B7D0A3E86A, 497},
-{0x2EFFA8CF036B241, 612},
-{0x2F001DCBAF7185C, 295},
-{0x2F0588DA16EEC9C, 1079},
-{0x2F1476B9656D33A, 23690},
-{0x2F176AEA15C8295, 269},
-{0x2F1AC93ED524C48, 214},
-{0x2F28C09AB6981C7, 239},
-{0x2F48CED01379C84, 272},
-{0x2F4D232E36238A4, 320},
-{0x2F5A16E344DF820, 248},
-{0x2F711FE3F219A4D, 385},
-{0x2F75FD2BB322F21, 277},
-{0x2F786153D3693A2, 344},
-{0x2F7FEC0DDF8BBD0, 293},
-{0x2FA98B4723AE37B, 266},
-{0x2FAF5D1FDFBF1B1, 261},
-{0x2FB10ED294B5135, 960},
-{0x2FB1B32CCD458B0, 3886},
-{0x2FB6340825770B2, 301},
-{0x2FB8AD33E01B1B2, 447},
-{0x2FC0ED88C9C0114, 254},
-{0x2FC24147FFC4A3C, 502},
-{0x2FC7A4345DCBF2A, 291},
-{0x2FC9C999A692401, 238},
-{0x2FCA2D1AA30DFA6, 474},
-{0x2FF85B2060C577F, 275},
-{0x3019D1FE29B507E, 281},
-{0x3029EA0C02036BB, 552},
-{0x303042A5AF6058A, 209},
-{0x3030611222E0F74, 315},
-{0x30366EFD6B3CBA2, 386},
-{0x30482ABB5D99B62, 260},
-{0x304CA979B8A9D02, 783},
-{0x30503D9A2FBDDBF, 203},
-{0x305CFC892B74FE9, 201},
-{0x3067FDE06EA047E, 209},
-{0x307ABF40E093EC8, 676},
-{0x308C634CD1C4403, 1076},
-{0x308DD08A77EF83D, 343},
-{0x30A9BAE955A1D35, 264},
-{0x30B3BA9AAC125EF, 953},
-{0x30B95927D57CCF4, 2835},
-{0x30E7971A086BA0C, 342},
-{0x30F3987A177BF88, 302},
-{0x30F546651F7E4A9, 831},
-{0x30F8282F77D5B22, 723},
-{0x310921C54942D25, 216},
-{0x310FE6E06B0F106, 256},
-{0x311BB90C661C869, 514},
-{0x313577CCB29F5DA, 2636},
-{0x314D2969DE596B2, 465},
-{0x314D3FDC23D34A7, 567},
-{0x314D928159BE8BF, 342},
-{0x315D399F7A37ED5, 328},
-{0x316327164040F15, 215},
-{0x316775BEC60BBAF, 203},
-{0x316C4FB6C73CDD8, 343},
-{0x316D77B477A1F5B, 2177},
-{0x316DA5E348EE51A, 245},
-{0x3170B6EAB5276AC, 513},
-{0x318E7FCC60AB1BE, 322},
-{0x319D40A39522D36, 257},
-{0x319FD1F65D4AF90, 264},
-{0x31C001419B6A01A, 204},
-{0x31CEC676B7EF393, 1561},
-{0x31CEEB210ABF7FF, 575},
-{0x32032AF6DA23CEA, 366},
-{0x3210D8E64258236, 337},
-{0x3216C76BEFD6F25, 1698},
-{0x322214F312CC2BE, 793},
-{0x323B8ADA165C1A1, 252},
-{0x323D968EA2C3C6E, 321},
-{0x3248BA7D3729FE5, 469},
-{0x3253871559BD067, 808},
-{0x32556A342906F9C, 3245},
-{0x326CD78BCB65095, 220},
-{0x3272A87B800C2DA, 3015},
-{0x328ABC12AD66D87, 2521},
-{0x328AF87C6026020, 240},
-{0x32ABABFC3AE7691, 388},
-{0x32AD9AC759132A0, 242},
-{0x32B8B65AD2929C5, 258},
-{0x32BBC51093DE91E, 288},
-{0x32CB620B111DF6B, 277},
-{0x32F3D3678D5AB1B, 204},
-{0x32FAC399536AB08, 1254},
-{0x33064C9CD5AA76B, 649},
-{0x3310E116BC1908E, 420},
-{0x331F5AA990BE853, 480},
-{0x33213E9E38175AA, 215},
-{0x332F120BF1F4297, 362},
-{0x3358974AC546CA5, 584},
-{0x335BFB15782D796, 203},
-{0x336658AB72FF672, 1471},
-{0x337AF5842AD9608, 283},
-{0x3382B0F1392A8F5, 250},
-{0x3385AE3F06C54ED, 776},
-{0x3386366BCEA9A6C, 340},
-{0x338650420C708A2, 275},
-{0x339679729566B99, 482},
-{0x339BAF89C15A162, 353},
-{0x33AB4C91A39AF57, 1065},
-{0x33AD0A57AFBEB2A, 395},
-{0x33B31118CBA402E, 500},
-{0x33B962804BECA05, 722},
-{0x33D6B24EE29DE2E, 523},
-{0x33DAC909F9CDA75, 344},
-{0x33E58A929359F3C, 2354},
-{0x33F9D38356FBA7E, 307},
-{0x34104BD171BD054, 444},
-{0x341C8937A0CBAB8, 3224},
-{0x341EDC45C7C51CA, 238},
-{0x3423F57EAAF71EA, 235},
-{0x3425311C40D464F, 213},
-{0x343160870CD9EE8, 414},
-{0x343A5DF1BA83F6D, 374},
-{0x343F1B8938479B9, 359},
-{0x344A99A72996767, 267},
-{0x344C6639285C2B9, 283},
-{0x344ED682CCBDC93, 7689},
-{0x3467832D6DA89A0, 203},
-{0x3467A2C605E4717, 334},
-{0x346EAF9127F75ED, 319},
-{0x347C92ADB371BEE, 273},
-{0x349745A632EE0C1, 654},
-{0x349B59A2625B1B2, 237},
-{0x34A08CB92F74638, 490},
-{0x34A5ACEAD4CAE31, 364},
-{0x34A62C80EF0169A, 2155},
-{0x34ADD29513281AF, 298},
-{0x34B425442F3C7F2, 7979},
-{0x34C8EE67E3C667E, 235},
-{0x34DACCDD40F1D75, 400},
-{0x34E4B65B04D71A2, 1204},
-{0x34EBA7211A68417, 317},
-{0x34FD1E7E79E780B, 706},
-{0x34FE49295B19875, 262},
-{0x3526B8B3E7F1134, 7480},
-{0x352AC8F93B30185, 383},
-{0x353618F2CB2CB84, 378},
-{0x35365101A111027, 316},
-{0x3544231EE062033, 636},
-{0x3546CBD65B07051, 408},
-{0x354795AAC3F49A0, 241},
-{0x354A2B2E4D421F8, 209},
-{0x3559EBEC31DD818, 1433},
-{0x3575D389CE51636, 1444},
-{0x3585E6E2679ED86, 2852},
-{0x3587698C0CD22DB, 703},
-{0x3595B81303D8FC0, 218},
-{0x35AC9D471D189AE, 245},
-{0x35B5C62B09B28FC, 453},
-{0x35CC1C02A3C4F9E, 329},
-{0x35D836F5512E9A6, 1713},
-{0x35E53BC28E5D2B0, 347},
-{0x35E695CBFF8483F, 261},
-{0x35EF8A511663302, 245},
-{0x35F33FBC9962BF8, 493},
-{0x35F3CA7FCF7AA45, 403},
-{0x3615C70013FF92F, 226},
-{0x36268B18C834EEA, 243},
-{0x3628C30AAE22D0C, 265},
-{0x3637B1BEB21B7B7, 604},
-{0x36737D729288CD7, 221},
-{0x3676DAB0FA59472, 206},
-{0x3678B08B9581A13, 395},
-{0x36823C41ECD444B, 363},
-{0x36888BAA31F7964, 303},
-{0x3691F8EE9E79A18, 215},
-{0x3693399AA0FC94E, 818},
-{0x36995D932595C9E, 452},
-{0x36B1799D847909E, 399},
-{0x36BA53C606CB8F7, 319},
-{0x36C18A516B08BD0, 242},
-{0x36C5174C88DAE50, 465},
-{0x36CDE5442582106, 245},
-{0x36D9B3361B17F07, 206},
-{0x36FAEC787F7224C, 404},
-{0x36FAFDAFFBAF65B, 203},
-{0x37298F340CD2340, 220},
-{0x372E0CCD6E8658B, 246},
-{0x3733059D9455D59, 522},
-{0x373C569C3F9518C, 289},
-{0x3744477DDEE957F, 234},
-{0x374A9C909A1D79C, 206},
-{0x37598C282A3052A, 238},
-{0x37723EDC6BA57DC, 2034},
-{0x37910B805322C29, 214},
-{0x37949BFD70FB05D, 357},
-{0x37B745B82AFB9FD, 277},
-{0x37BE2D404CEFD30, 233},
-{0x37C11113C008DEF, 856},
-{0x37C747F841F2D74, 370},
-{0x37D5C8E10B9B4BD, 687},
-{0x37E5DD10235F84C, 324},
-{0x37E7DC3EEBC53A6, 317},
-{0x37E8C9A434F97EA, 374},
-{0x37EBFA548AE6C8E, 370},
-{0x37F2BEC03F1D3CF, 297},
-{0x37F9A057938F2BB, 568},
-{0x3803D72D27025A0, 324},
-{0x3810A3994438A10, 478},
-{0x3818DFEF47EFC3C, 242},
-{0x3819E538BD547BF, 272},
-{0x382686AE0958CAE, 267},
-{0x383F4C7BC07E5E0, 242},
-{0x38689A44D1243F5, 1051},
-{0x3894F6D03D89956, 4356},
-{0x38AEEA48EF5AE3A, 1150},
-{0x38AF6B45B64BAB8, 555},
-{0x38C3E71F1B72016, 218},
-{0x38C564137B9DC3B, 340},
-{0x38D2CEF0117DCB4, 890},
-{0x38E2019B4A44BD8, 201},
-{0x38E415314EAC6A0, 267},
-{0x38E9B4C68666607, 845},
-{0x38ED387A9EC7D22, 452},
-{0x38EF0CF88213C5F, 1117},
-{0x38F3B356CB56FA4, 457},
-{0x3927B41194232A6, 537},
-{0x392F753B6BA6F62, 548},
-{0x394389FC78234A5, 6655},
-{0x394CEF070CB3D4A, 403},
-{0x39551936E65447C, 427},
-{0x396385E71EAF9BB, 348},
-{0x396544591A9BCEC, 221},
-{0x39717F276F84D3C, 222},
-{0x3972193128210A7, 50439},
-{0x397A27098379F72, 979},
-{0x397C6D9ACE64063, 227},
-{0x397F59A13456FC6, 448},
-{0x39893895AF30DC1, 350},
-{0x3991F8C7E18A331, 471},
-{0x399A1BF22129F95, 465},
-{0x399C84D394936CE, 804},
-{0x39AEAF46A126582, 593},
-{0x39B230E72244FCA, 892},
-{0x39C3D3099E22620, 287},
-{0x39CA909BCF2B966, 481},
-{0x39CAAA269BF3916, 349},
-{0x39D2D844D71F86A, 345},
-{0x39E4D0DA8EA72FB, 222},
-{0x39E7FFA07E83A3B, 346},
-{0x39F8245A8DF28B0, 321},
-{0x3A051E126ED0E60, 289},
-{0x3A0F2056D43A870, 459},
-{0x3A1DA0E586F2C05, 660},
-{0x3A3227144605B90, 247},
-{0x3A335EC78DC0E5E, 383},
-{0x3A412723D85C689, 286},
-{0x3A42651796B9057, 256},
-{0x3A5A6C8C36325E0, 178006},
-{0x3A5E1690DA62FAC, 2150},
-{0x3A6498E4D8C98DE, 2112},
-{0x3A65B304B8ECD78, 333},
-{0x3A6E16B93D5C519, 312},
-{0x3A89158F45580E0, 331},
-{0x3A893AD8E7D483F, 368},
-{0x3A8BDEF01E63AA7, 1137},
-{0x3A9171FC0437CA9, 10608},
-{0x3A921D11F91FD05, 406},
-{0x3A94E3375051919, 200},
-{0x3A9F5917144AA98, 375},
-{0x3AA9EB21CF54B55, 667},
-{0x3ABB9CAAC73A9FF, 312},
-{0x3AC12E04EFEE6C8, 278},
-{0x3AD0CDA92C76884, 202},
-{0x3AD6C98B8BD4F1B, 2639},
-{0x3ADC8507B492D90, 213},
-{0x3AF0A1A033ABBE0, 330},
-{0x3AF77A0041B6A2C, 543},
-{0x3B064EF2AF0B176, 1269},
-{0x3B068612E2B9004, 1363},
-{0x3B0930D59E239DA, 277},
-{0x3B0F4FE8279FF82, 288},
-{0x3B169FC54B70003, 727},
-{0x3B20CC220250950, 203},
-{0x3B3396EC9B6CD2D, 347},
-{0x3B3489691590CEA, 309},
-{0x3B39ABC05CBD2FE, 303},
-{0x3B461874203D577, 1216},
-{0x3B7EF416F880C1E, 336},
-{0x3B8631776BA57BB, 386},
-{0x3B89BE7701344A2, 484},
-{0x3B9D9FC587C658F, 653},
-{0x3BA449E6CDDED5B, 239},
-{0x3BB1CB24B92D28E, 363},
-{0x3BBD9135620B33A, 226},
-{0x3BC1804D7FC7DC5, 290},
-{0x3BD39A546DC7269, 1219},
-{0x3BD99C86F6771BA, 470},
-{0x3BE79179CA7446B, 1411},
-{0x3BFDD25FDD31F7F, 207},
-{0x3C010949109A618, 220},
-{0x3C05872E5278F25, 631},
-{0x3C302DD51EF01BB, 354},
-{0x3C32F005764A499, 831},
-{0x3C398D7D27D197C, 271},
-{0x3C4536D8AF6A581, 278},
-{0x3C4E9811B838B0B, 402},
-{0x3C5242C0ADCE362, 226},
-{0x3C580B1AA6363C5, 207},
-{0x3C7379421683E9D, 863},
-{0x3C7B4D25862B695, 5243},
-{0x3C7E25DE41E3067, 1034},
-{0x3C914DDDF98566E, 5673},
-{0x3CA3EBF3C6AC8D0, 457},
-{0x3CA45425B8A79BD, 374},
-{0x3CAC83B4C56D61F, 335},
-{0x3CAE1F2714080F9, 746},
-{0x3CAFF6C180BD0D1, 347},
-{0x3CB1E33DCC8E359, 341},
-{0x3CBFDA1CE2FCD2F, 279},
-{0x3CC7F05BB201713, 594},
-{0x3CCCE912C5CCEDF, 971},
-{0x3CCD5628B14699D, 207},
-{0x3CD94EF1F7B7397, 803},
-{0x3CDDB783FA0EC8B, 427},
-{0x3CF66D80D0016D1, 317},
-{0x3CFD792224C7A23, 225},
-{0x3D024AC2633F917, 308},
-{0x3D10570622F85AF, 261},
-{0x3D1EF2F3BFF5BEB, 2841},
-{0x3D22BD45E8EE5FB, 1646},
-{0x3D2647C2E5796C9, 364},
-{0x3D2FAA0A7967080, 232},
-{0x3D32C65AA049D36, 210},
-{0x3D4C9C38810E390, 243},
-{0x3D5932DA08CD8E8, 288},
-{0x3D64A97B5318CFF, 5945},
-{0x3D7BAC118A70ADA, 511},
-{0x3D91D1D08999B9B, 965},
-{0x3D9661728A7D2CE, 898},
-{0x3D9700C1467C879, 260},
-{0x3DA6D72BBCC1508, 205},
-{0x3DA9245F5A2DCE4, 621},
-{0x3DCEBEC524EC55A, 3127},
-{0x3DDAAC704849598, 329},
-{0x3E01357812D704F, 1015},
-{0x3E02E4EC7A04280, 530},
-{0x3E0493B9B0B2012, 891},
-{0x3E1565568A84FC1, 206},
-{0x3E1AB90458078F2, 411},
-{0x3E354C156F5642C, 250},
-{0x3E3D35B6C9CEDCA, 694},
-{0x3E3FE22F6773D14, 346},
-{0x3E41310CA6B2683, 1598},
-{0x3E5847355AA3527, 502},
-{0x3E5D59A677C9C44, 445},
-{0x3E604A02840AD90, 347},
-{0x3E6C42E63930912, 228},
-{0x3E7DEE651EA3CA4, 2082},
-{0x3EA97D89496CEAF, 240},
-{0x3EABB32CCF31105, 24196},
-{0x3EADE7804E9A30C, 1409},
-{0x3EB5E72DEF93E6D, 3227},
-{0x3EC2CA0189ECE2E, 8653},
-{0x3ED9DA49B89A66E, 303},
-{0x3EE4566475E078B, 277},
-{0x3EE75EED74BB5EE, 351},
-{0x3EEC9B28E8A4ECC, 347},
-{0x3EEEE6DC78CC555, 330},
-{0x3EEF3DF45ADE7FA, 420},
-{0x3EF1B59F1691DD9, 221},
-{0x3EF94C04DD7EF4B, 310},
-{0x3F00D73C8C943C9, 322},
-{0x3F07D961C56AB9C, 370},
-{0x3F0BF045DFB26D6, 2533},
-{0x3F1F12B49FBF3D7, 828},
-{0x3F27E3C445757A2, 254},
-{0x3F29B3BA6DFCA17, 309},
-{0x3F36EB06CFBBC8C, 1033},
-{0x3F3DC6060B45368, 306},
-{0x3F470F42E2CE096, 439},
-{0x3F641C230F01653, 309},
-{0x3F67CDB604DA5FB, 17893},
-{0x3F858EDEDBB77FB, 10047},
-{0x3F88E373EEE61FC, 660},
-{0x3FAE90D661AD431, 251},
-{0x3FB25136CB6904D, 447},
-{0x3FB2D7FA47CFE06, 220},
-{0x3FBC1FB213C537B, 578},
-{0x3FD151C47CD3875, 557},
-{0x3FD6C49D4104EF6, 1100},
-{0x3FF25770398E3C4, 414},
-{0x3FF3BE2B7495B87, 823},
-{0x4003E998F9764E1, 2353},
-{0x400683B07BEFFDF, 7479},
-{0x400A891A28E5DB0, 374},
-{0x400E93AF7362B3C, 229},
-{0x401500CE9F92678, 582},
-{0x401F2646D4B4EF2, 354},
-{0x402274571420DCB, 314},
-{0x4031EB2F8808EEC, 209},
-{0x4033610607C6D44, 1049},
-{0x403B17F0DA16262, 246},
-{0x403CBACFAAA2C5B, 451},
-{0x403FFF1CAFC2A0F, 618},
-{0x4055A0064D88FBD, 258},
-{0x4061CAC7B2B022D, 255},
-{0x40836F5FBB9920B, 600},
-{0x40888C92A0E0D43, 241},
-{0x408B0E64A30FC00, 230},
-{0x4095070EEE4ED80, 214},
-{0x40A6F8B3D3FD9E0, 393},
-{0x40AF4BAE912DA95, 426},
-{0x40C13AFC9F6990D, 261},
-{0x40C3CE30E0048A8, 278},
-{0x40CB7DFAC93DF9C, 812},
-{0x40CE888559EBC21, 278},
-{0x40F1FC2FF62A76C, 272},
-{0x40FAF2F654D89AE, 285},
-{0x40FD1EAA0111FF9, 628},
-{0x4100FF89ACFC787, 372},
-{0x4102BE791325F94, 4327},
-{0x41104AE860E9B58, 512},
-{0x412FC5D6E541C7A, 439},
-{0x413E43D4E4D8B4F, 465},
-{0x413F559182BC532, 1293},
-{0x4158CB6AE39FEF1, 207},
-{0x4160350455054A1, 653},
-{0x4162CE99A9D1DCB, 290},
-{0x416D9B4E140B7FB, 3569},
-{0x416F6306835826B, 366},
-{0x4184D298F1842D6, 743},
-{0x418C948DB0DD374, 486},
-{0x4199AE4333EBEF1, 318},
-{0x41A327DAE7CB29D, 226},
-{0x41C05E15FAF4347, 384},
-{0x41CD679914FA329, 227},
-{0x41E5F5E31A2C945, 224},
-{0x41EE4B157098D61, 1914},
-{0x41F295741EC9363, 315},
-{0x41FA4E198578297, 230},
-{0x420E6FBEFAC257F, 660},
-{0x420E9020CE08128, 222},
-{0x422AFC6A9E4A4E7, 979},
-{0x422FC124A385BFA, 525},
-{0x4236DC6294DB6A7, 311},
-{0x424E91FBCDCAC59, 235},
-{0x42503F1BE918BDB, 293},
-{0x42505A647C8D7BD, 562},
-{0x426604296CCE646, 212},
-{0x427B9EC745C823F, 1139},
-{0x4286B0A5AB745C8, 7932},
-{0x428BBC9C1D5E20C, 4766},
-{0x4297EE97381A608, 373},
-{0x42A4AE8115014A3, 279},
-{0x42ADDDD31BB45D7, 989},
-{0x42B13158B01D960, 1541},
-{0x42B6C6FF2B61E4E, 2728},
-{0x42BED8E4A8A251D, 495},
-{0x42C00E775A17298, 338},
-{0x42D5A9BFE19A966, 236},
-{0x42F3B0BB41370B1, 226},
-{0x42F6DED805A899A, 3524},
-{0x4303FA3F6E70908, 704},
-{0x431BCD75CD276F9, 493},
-{0x4330A9F5B3C7D48, 632},
-{0x433DFB5B9030B54, 268},
-{0x433F46FF27DB493, 220},
-{0x43561A81174C2AF, 722},
-{0x435CD6C1739355D, 229},
-{0x436D494D4C357CE, 7586},
-{0x4372F75A02258DA, 243},
-{0x4376C7C1C60D131, 425},
-{0x43AC00F8C15478E, 376},
-{0x43BFF125C962BA4, 408},
-{0x43C43683D81238D, 326},
-{0x43D7B78D5D2D042, 336},
-{0x43DC052098938AB, 449},
-{0x43EE94FB458FF55, 928},
-{0x43F01AF997625A3, 234},
-{0x43F3132ED821C70, 541},
-{0x440B1C83A17A074, 404},
-{0x442F83410394B9E, 472},
-{0x443FED1F121C676, 271},
-{0x444BE80C127910A, 2305},
-{0x444E8724E95547F, 1867},
-{0x444FB4AFC1841AA, 324},
-{0x44507823FEEFF7F, 1415},
-{0x4467391CE7B4CD9, 386},
-{0x446FA96F3452A34, 675},
-{0x44754B096E4F9DA, 497},
-{0x447B67C0C4C9CBC, 1539},
-{0x447F42C012E45A7, 1687},
-{0x4481F476F7D8F6C, 506},
-{0x449B9BED97B2318, 909},
-{0x449F4C2A8F5111B, 1194},
-{0x44AE011F2F00763, 251},
-{0x44B0245130604BF, 2337},
-{0x44C2BCFB93BC35A, 2242},
-{0x44D0814651664E0, 533},
-{0x44EE35F003D8501, 238},
-{0x4512A180CDA0A23, 649},
-{0x45279699AE5A1CB, 295},
-{0x452B85977E89453, 3778},
-{0x452DB238FB69DB6, 504},
-{0x453E979414D0E9D, 335},
-{0x4550DDA762CF270, 215},
-{0x455BE7CD1BC8548, 233},
-{0x45800CEFAC0449F, 606},
-{0x4584598CDA78B32, 200},
-{0x4591646A6234D81, 304},
-{0x459DBD37839888C, 631},
-{0x459ED221AD44139, 370},
-{0x45A37340C906A03, 221},
-{0x45A9855875BDD95, 255},
-{0x45AD4DF8737A8A4, 599},
-{0x45B5849F94A721E, 424},
-{0x45C949DE844EC49, 1011},
-{0x45DA31373D34FD6, 242},
-{0x45E299F4A3DC9EA, 414},
-{0x45E7D89C316E111, 13243},
-{0x45EF1B644F9386C, 314},
-{0x45F06B79AFB76DA, 240},
-{0x4606C6FD821D407, 970},
-{0x460881261A2C7BF, 589},
-{0x46140E7E98812CC, 530},
-{0x4616A799C4A04C1, 330},
-{0x461AD4D848AF744, 840},
-{0x463A5053AF4EAC1, 204},
-{0x463E89D3BE6FAAB, 1809},
-{0x4667EE01D88072F, 3423},
-{0x4670A87DC934ECF, 39544},
-{0x4675CE0578C8572, 242},
-{0x467FF14F7038B26, 301},
-{0x4689E590A1B5855, 269},
-{0x46985CF0D82B0CF, 234},
-{0x469B60F4B09D058, 278},
-{0x46A19F971ED2E48, 202},
-{0x46A6A6F80D6581F, 1342},
-{0x46AB50A89E786EF, 247},
-{0x46C059736B52DB4, 732},
-{0x46D90BF6221FE01, 240},
-{0x46DA23722AB8A23, 706},
-{0x46E22366603B615, 451},
-{0x47217CFA6B42BBE, 357},
-{0x4723EC02EF88714, 1202},
-{0x4728F4D44BFA5D0, 404},
-{0x4736D75C4CA9169, 463},
-{0x47498F88FDC2E33, 332},
-{0x47561F91873B713, 236},
-{0x475A93D3BFFFAC1, 502},
-{0x475BE2BA39D4B4B, 216},
-{0x477BDE1F9DF4C3F, 229},
-{0x478B748C9CC09B3, 463},
-{0x479D43F2D961848, 526},
-{0x47ABD7AC61567E8, 376},
-{0x47B4FFA91C91420, 212},
-{0x47C1DAF4022ABA6, 237},
-{0x47CBAE3030B9766, 561},
-{0x47DE3647244BF7C, 295},
-{0x47EABC8EA165421, 315},
-{0x47EF66F4AE14F11, 1971},
-{0x47F092619E334F9, 582},
-{0x47F4C0418A3CDA5, 1121},
-{0x4809A83CB392690, 529},
-{0x480CF150DA4BE69, 229},
-{0x481B504F955A3F9, 342},
-{0x4829A11484C2CFE, 467},
-{0x482DE0506E68ECD, 270},
-{0x483944A59E3A391, 301},
-{0x483EAD9FA0A3F4C, 656},
-{0x484BD7DAD63564B, 214},
-{0x484F1F30C847947, 2621},
-{0x4851378115FD825, 709},
-{0x485744B27B80534, 362},
-{0x4857F08355D6757, 317},
-{0x4869F6321B341C1, 429},
-{0x488B937F4325DAC, 373},
-{0x48AC2B1DBB25BBD, 322},
-{0x48AE15DDCACF5C2, 386},
-{0x48B55E9D41C5DD4, 294},
-{0x48C3685DD131B98, 229},
-{0x48D01B6A136BCF9, 348},
-{0x48D32AEC5EEACBA, 285},
-{0x48E72AF5838C782, 6567},
-{0x48EB785956DCB21, 210},
-{0x48F2482D0DF74B9, 241},
-{0x4913A30D87E7F08, 666},
-{0x491EF42BFEE1FE8, 675},
-{0x491F266E873CCE9, 296},
-{0x49228DF0F7EBE95, 249},
-{0x49273079D36D4C2, 983},
-{0x49273C058735E31, 211},
-{0x493FDADC51C3F7B, 966},
-{0x49487A23A3640C6, 248},
-{0x494E88C90E1DE13, 244},
-{0x49585517E526C17, 514},
-{0x49707980CD4897D, 200},
-{0x4970A8011BA9929, 217},
-{0x49867346FD4F98D, 234},
-{0x49998ABBFDDF407, 1205},
-{0x499E5B873EC8850, 286},
-{0x49A907C857E67CF, 1430},
-{0x49AA8DD0F8DCD6A, 700},
-{0x49D49CEABC2C979, 895},
-{0x49D5F7358A67434, 222},
-{0x49DAF4C66DA17CA, 587},
-{0x49DE05FC463F7C7, 1107},
-{0x4A2057866C527D5, 360},
-{0x4A2D3D37547012E, 252},
-{0x4A30225BE1A4A9B, 408},
-{0x4A3D6A7A4501DFA, 430},
-{0x4A43C47404C9F1E, 358},
-{0x4A449DD31750484, 269},
-{0x4A710C47B8E567C, 1955},
-{0x4A81FF8886DEDBB, 265},
-{0x4A89043C21FDD5D, 221},
-{0x4A985FCDE99D911, 298},
-{0x4AA1AF1569557B0, 448},
-{0x4AAE572B40EB364, 201},
-{0x4AB44164AC703C7, 313},
-{0x4AC009F42992A89, 1085},
-{0x4AC840AC65C98D9, 654},
-{0x4AD0129AFD2B583, 229},
-{0x4AF2F5209C9D651, 885},
-{0x4AF776A9FEDFFE4, 346},
-{0x4AFB7744E54ADBB, 952},
-{0x4AFE9F931FF9FE9, 472},
-{0x4B1D2B905E12A90, 275},
-{0x4B2230390EFE68A, 293},
-{0x4B25F0324A67A3A, 1030},
-{0x4B2F43398539021, 10402},
-{0x4B365B6817D495A, 265},
-{0x4B3BC490F9C5B9F, 402},
-{0x4B4D061932EF766, 311},
-{0x4B51516260B9E83, 291},
-{0x4B545F60343D8D1, 262},
-{0x4B553A4C8A28E29, 214},
-{0x4B5FFC301889646, 311},
-{0x4B6881FE858F0BD, 804},
-{0x4B770090DFCBAC0, 231},
-{0x4B7C8C521F6047E, 899},
-{0x4B7FE03CF7CB3EA, 2778},
-{0x4B8044393F6EBFD, 1635},
-{0x4B8DAEFB0379F62, 469},
-{0x4B9A7E3C74B061C, 794},
-{0x4BAAE58B17139D8, 214},
-{0x4BAF4D387A10798, 629},
-{0x4BB0200740694F4, 284},
-{0x4BB6F6FB3EDE3A8, 793},
-{0x4BCBEACF154FD45, 305},
-{0x4BF081C38695B4D, 289},
-{0x4BFAB729598B71B, 565},
-{0x4C00496C68F0346, 230},
-{0x4C039E6CFDBA603, 310},
-{0x4C19F71856047F7, 452},
-{0x4C2B00619CBE3BB, 648},
-{0x4C2DFA1FFF18E18, 773},
-{0x4C3066417120CE6, 1850},
-{0x4C35D10906192DA, 360},
-{0x4C518BEB3D3106A, 894},
-{0x4C5D0E08B42D89F, 494},
-{0x4C63F4A0C27CBBD, 419},
-{0x4C66F56789D1D8E, 2955},
-{0x4C6B034E720D31F, 459},
-{0x4C6C35A2C26978D, 1032},
-{0x4C77EECA646EB09, 356},
-{0x4C7DC096CE6D21F, 2170},
-{0x4C80FB75794C9FB, 1923},
-{0x4C95A30C1BFF3E1, 561},
-{0x4C9743DC224C0C9, 570},
-{0x4CAC591751D7170, 404},
-{0x4CB54087BEA9E95, 402},
-{0x4CBA63CBC7CE4A5, 465},
-{0x4CC47EB04AF69D2, 1032},
-{0x4CD8BC114033769, 669},
-{0x4CE0646A7C86B29, 319},
-{0x4CE52A91544A3EB, 1042},
-{0x4CEA95575623BB1, 235},
-{0x4CF618C3AF2AF52, 225},
-{0x4CF8C644C05AC90, 395},
-{0x4CFD06FB182B180, 763},
-{0x4D0B13893D6B99C, 232},
-{0x4D0C6220E46E097, 1687},
-{0x4D2E6864DCC85DE, 405},
-{0x4D4AF5BFEB30980, 245},
-{0x4D4CE25451CF9DA, 247},
-{0x4D5715DB86D8C70, 2414},
-{0x4D630FE35E938B9, 1203},
-{0x4D67E83DE90D135, 444},
-{0x4D698DF76550AC6, 213},
-{0x4D6DD200BBD0E67, 339},
-{0x4D8680518682CDE, 1575},
-{0x4D909EB6340A8F7, 213},
-{0x4D96E26FCFCE955, 584},
-{0x4DB3FC71E9A1321, 203},
-{0x4DBD571975E77CC, 738},
-{0x4DD250A7913985C, 395},
-{0x4DDB77147710522, 416},
-{0x4DDD1A38B42B58D, 455},
-{0x4DE2811BE344CAF, 425},
-{0x4DECD2F9F74FA91, 4795},
-{0x4DEEBA50E1EF110, 355},
-{0x4DF37A0AC5E6D58, 309},
-{0x4DF563832302FFB, 460},
-{0x4E122281567FCFF, 241},
-{0x4E3F4C37F5A43BC, 276},
-{0x4E4D12F2975E45D, 374},
-{0x4E54DEA59E57C93, 792},
-{0x4E56CDE26FEE475, 3472},
-{0x4E5F854A6B05480, 458},
-{0x4E622EEDE67DA54, 691},
-{0x4E6AAB1E32F3642, 516},
-{0x4E90D4216C5F803, 4833},
-{0x4EA41606553787E, 294},
-{0x4EB46A88379F7A6, 206},
-{0x4EBBA8704FAC506, 622},
-{0x4EBE5E09AEBE7DA, 1752},
-{0x4EC58DE42F0A682, 258},
-{0x4EC6F5723D7E0E1, 3338},
-{0x4ED6579D5822631, 263},
-{0x4EE1BC67E7E23FD, 202},
-{0x4EE57FA5C53A11C, 480},
-{0x4EE9E9CFE5AAB97, 228},
-{0x4EED7011D789672, 715},
-{0x4EF0AB145A9B61E, 341},
-{0x4EF761EEF307E02, 919},
-{0x4F0A661087CF3D8, 339},
-{0x4F17AEC4F9D119B, 276},
-{0x4F222163EA9548C, 637},
-{0x4F382F581E7F656, 1753},
-{0x4F4339F3B236051, 6478},
-{0x4F527CFFE1B91AC, 350},
-{0x4F5C3B56533C2E3, 709},
-{0x4F6E0082F4D4F7B, 295},
-{0x4F71C249190B57B, 935},
-{0x4F75A5D4C84D496, 282},
-{0x4F9533667AD72BA, 367},
-{0x4FAC413270C8021, 432},
-{0x4FB6C7270B517F8, 225},
-{0x4FB8E9FDCC45798, 318},
-{0x4FBEBF274BF51C8, 217},
-{0x4FCCBF92CDEE4BA, 292},
-{0x4FDCE73EE7B1D54, 815},
-{0x4FDCFE776538942, 359},
-{0x4FE0E0CA78E553C, 1470},
-{0x4FE6C5E86619C4B, 317},
-{0x5000B09C6E819AA, 1122},
-{0x5002AC2E0D0F4CF, 358},
-{0x5006032DD3C84DB, 225},
-{0x500E88148AB9A44, 335},
-{0x501EFE6AEE75F3E, 404},
-{0x503C4DBA90A6C42, 2650},
-{0x505F0E543F0ADA6, 277},
-{0x506F151378CAAE4, 1549},
-{0x5070C312D301C57, 610},
-{0x507667C36DBCB7A, 214},
-{0x507A3F2E45358F0, 408},
-{0x508752D9703F0B5, 672},
-{0x508A9306A323C29, 241},
-{0x509C90A44F469F5, 559},
-{0x50B0DC4FD63E3B5, 1082},
-{0x50BD3CAF93E74F5, 1567},
-{0x50BFE5859C4BD5B, 1839},
-{0x50C9C5B42E60F42, 846},
-{0x50D8EAB1A85FFCB, 282},
-{0x50DE17E8CD1BB7D, 721},
-{0x5100E37C25190CE, 306},
-{0x510187518D551C4, 1129},
-{0x51114F7939AFEF2, 2666},
-{0x5132915FC1150E2, 651},
-{0x5141681F632B114, 304},
-{0x514C04715AC6B01, 797},
-{0x5161BEEC002407C, 493},
-{0x516B8F0461128C4, 690},
-{0x51725593A77CFAF, 265},
-{0x517A1ECE599E59A, 207},
-{0x5186682B8396CAA, 230},
-{0x51877BB4E6AD5A2, 238},
-{0x51AC5888DB9C575, 589},
-{0x51B64F12FA78B73, 321},
-{0x51C4D6E6CE233AF, 2937},
-{0x51CAEFA4B67131F, 2973},
-{0x51CEE0A25D8D1F9, 313},
-{0x51D2F6A48C7FCF0, 550},
-{0x51D50AD7B476E74, 379},
-{0x51E49AA455EC3E2, 200},
-{0x51E5C968F585BF0, 231},
-{0x51F40292C29CD36, 240},
-{0x5207F4F2D24F2BE, 218},
-{0x5230F202CFFFB79, 264},
-{0x524E5372F7DC7D0, 345},
-{0x5261A2ADC8C1004, 256},
-{0x5265CFBD5FE9556, 257},
-{0x526A400CF573C78, 250},
-{0x527B76C295EDD4C, 273},
-{0x5281AB215EE5609, 542},
-{0x528A6191220C858, 508},
-{0x528C477FBD3E724, 1216},
-{0x52996F193CF07FE, 582},
-{0x52A8FD8B83EE62E, 498},
-{0x52AD7AEE5144D7A, 404},
-{0x52D86DCC5399514, 1480},
-{0x53259BC250C6F22, 5094},
-{0x5345039CD23A43F, 1050},
-{0x534B8D76F0C45F1, 688},
-{0x535C9920A86DFD3, 1387},
-{0x539576E7EBDE68E, 365},
-{0x539BA950800B29C, 2389},
-{0x53AC65C23974106, 1683},
-{0x53AE990170F57E5, 455},
-{0x53B081E909EAA07, 229},
-{0x53B6C7F358CF3D0, 239},
-{0x53BE01920370875, 220},
-{0x53BE0EE618A0F3F, 898},
-{0x53C9F2B2905C263, 862},
-{0x53CBC5D21EBF7BE, 4054},
-{0x53D276B327F73A4, 398},
-{0x53D515C6D02DC54, 703},
-{0x53EDED3B38A6F54, 245},
-{0x53EFCBE34BEAA02, 218},
-{0x54033645883ECD7, 266},
-{0x5410CFD8FA8F156, 212},
-{0x54331BAB889389C, 17289},
-{0x54404C7C1C73F34, 5746},
-{0x5442A967B5061D9, 656},
-{0x54443807832E97C, 209},
-{0x544711F77365257, 1405},
-{0x546C41DC97ECE7C, 443},
-{0x546DD561B849C36, 220},
-{0x5487E78E694FC31, 277},
-{0x548E834AB6B2C57, 690},
-{0x54A9B1CB6CD11E4, 255},
-{0x54B03FDACD24310, 346},
-{0x54B91DF4F2F0F48, 4424},
-{0x54C02E11202F628, 427},
-{0x54D4E18CF077132, 276},
-{0x54D5F458B0C213D, 1073},
-{0x54E564FA10E2BDE, 280},
-{0x550C8B7E098364A, 1827},
-{0x550E30C6AE31287, 298},
-{0x551130C1D7D1D85, 404},
-{0x551E2EA2244C662, 385},
-{0x5529968F2D8976B, 296},
-{0x5532DA0F8917BB0, 201},
-{0x553514D94A2B8D2, 3312},
-{0x55392220C6C6BDE, 257},
-{0x55392964B12B1C3, 169338},
-{0x555B15E24253587, 299},
-{0x555BDEC0B16B583, 236},
-{0x5583162F73D4209, 313},
-{0x55835AE6860BA7E, 282},
-{0x5586D2B2CA9D3AE, 305},
-{0x559868E7AD9830F, 371},
-{0x55A3901C531B1D1, 289},
-{0x55B68E21AA43777, 481},
-{0x55B74729360E1A4, 888},
-{0x55C22A0ADFC1D26, 349},
-{0x55FF9C668A46596, 323},
-{0x5614947B7BA21E3, 253},
-{0x561CB6F866A0E4D, 209},
-{0x563218B40089378, 298},
-{0x563732D41AC675A, 229},
-{0x563A239FD6FF274, 265},
-{0x563C921F351FDB9, 770},
-{0x5644170C00FF076, 253},
-{0x565076B3D015AAB, 285},
-{0x566685E25C94E56, 2648},
-{0x5667B7521C59C7F, 1418},
-{0x566A387620AA48A, 436},
-{0x5673E0A9B561785, 208},
-{0x56995FBCEE63CA8, 366},
-{0x56997AF730EDDEF, 429},
-{0x56CD7553854DA60, 205},
-{0x56D2072FFE0C151, 334},
-{0x56ED5DD392DBDD4, 634},
-{0x56F8D9C3C7E214C, 224},
-{0x56FAE8A24DB1061, 227},
-{0x57038073BFAFC59, 663},
-{0x5705748E9233B9C, 970},
-{0x570E1F2A3797BB0, 302},
-{0x571AF36EC6EA244, 360},
-{0x5738372F63A83E6, 552},
-{0x57442B2631BFD43, 559},
-{0x57501937C31CBF4, 297},
-{0x575E4450AD8C7D1, 267},
-{0x57811593A31613D, 348},
-{0x578C1907B5E3F6D, 241},
-{0x578D4C020016DEF, 1074},
-{0x5798011D9585AC2, 274},
-{0x579DCF0B351967C, 1111},
-{0x57BBAF096FDB38A, 228},
-{0x57C1F1F87ED1C49, 913},
-{0x57CC4A9782F69B4, 494},
-{0x57D74F08C630387, 391},
-{0x57DC40BF420457B, 587},
-{0x57E79BE54D8B7C4, 621},
-{0x5800DCBC02DE2BB, 265},
-{0x58083EBAAF52C3E, 275},
-{0x58093486259A47E, 1417},
-{0x580F8138ACF9FA6, 546},
-{0x5819A20288C2CD4, 392},
-{0x5851528D606791C, 1732},
-{0x585A43F8E6347A5, 328},
-{0x585CE6C1754971B, 350},
-{0x58628AE2AAA9022, 366},
-{0x586605917A6EC78, 762},
-{0x586C5B0083C0CBD, 237},
-{0x58720837F28D2D4, 1657},
-{0x5878F6D4A61AF9F, 2315},
-{0x587A9C5E476DC62, 419},
-{0x588B20D94402DCF, 2919},
-{0x5897ECB50B497F9, 299},
-{0x589986AABE33807, 698},
-{0x58AA32AC5039306, 372},
-{0x58B0A1567B7CA65, 365},
-{0x58D0755EE5786F6, 214},
-{0x58DA441596F49DB, 1467},
-{0x58DE309F07CA2B2, 554},
-{0x58E24765CB8614E, 231},
-{0x58E3B9D6E4A2898, 226},
-{0x590025E109B5843, 375},
-{0x59027FFE337DBB0, 859},
-{0x591013426817609, 9075},
-{0x591FCFEEC8DC985, 636},
-{0x59391432C024B3C, 751},
-{0x5943490DD343EF6, 463},
-{0x59707AA1692345C, 314},
-{0x59795BF1E5ABB3A, 455},
-{0x59805B18C1C1C39, 2449},
-{0x5981B79E008017E, 335},
-{0x59866403A427D69, 255},
-{0x5989C2C6E87D4B4, 1321},
-{0x598F1BD1EF8F434, 261},
-{0x599DC5016942B1D, 302},
-{0x59B3F3E7A5DF494, 3129},
-{0x59C0227021719D1, 214},
-{0x59CBF50A58A3156, 325},
-{0x59D2518E561A6BC, 206},
-{0x5A204940C932A21, 518},
-{0x5A22F5035699593, 390},
-{0x5A3348AE51CDC7E, 571},
-{0x5A4CF07AF59B364, 420},
-{0x5A5C2EF04D1E14D, 367},
-{0x5A626572FF25EFB, 380},
-{0x5A66FB67C5FB64D, 839},
-{0x5A6979EDD9736D2, 283},
-{0x5A71ADBC8D636C2, 454},
-{0x5A7AC6EA6BC3F60, 1455},
-{0x5A93C39D9A31545, 327},
-{0x5A9FDF00319C2C0, 470},
-{0x5AB99A6CE327242, 313},
-{0x5ACB3A1C43EAB6E, 232},
-{0x5ACF869A74C2BC5, 350},
-{0x5ADFF882DF061A2, 1769},
-{0x5AE374D98A871A0, 411},
-{0x5AFF9D7F3C787B3, 693},
-{0x5B04C8F24DF66CC, 467},
-{0x5B0A33C788D151D, 1448},
-{0x5B145AE7E3BC787, 711},
-{0x5B1A9F92A96ABB1, 969},
-{0x5B1B9B50CFE7EC2, 321},
-{0x5B2A8AB7ABE282D, 499},
-{0x5B34C25B338C72F, 3993},
-{0x5B350FFFA099157, 236},
-{0x5B351634F89ABE3, 210},
-{0x5B38F2926429569, 566},
-{0x5B3A578A17A5949, 266},
-{0x5B613BAE1DFE3E4, 737},
-{0x5B63B649DA7B5CA, 1525},
-{0x5B77A337CDE9063, 1237},
-{0x5B8EF93E53E553B, 398},
-{0x5BC879115B73D45, 507},
-{0x5BC9CBA720F5606, 125321},
-{0x5BD84EC5FF04F7B, 359},
-{0x5BE3823406780B0, 448},
-{0x5C12AFBBB7CDC6F, 26029},
-{0x5C16EE0333E6D93, 204},
-{0x5C1B502582C975E, 407},
-{0x5C582032ABB0C19, 6329},
-{0x5C6F18F4F638F48, 3346},
-{0x5C943B8CDAB7BDA, 418},
-{0x5C97DEE7496D5A2, 859},
-{0x5C9E6977B55C9C5, 443},
-{0x5CACB637DD63D1F, 252},
-{0x5CB02E80BD10A0E, 364},
-{0x5CB5B7551D77FE8, 263},
-{0x5CBEF2605E4CB0B, 373},
-{0x5CE7528EC94D71D, 591},
-{0x5CFC444E950CCC8, 298},
-{0x5D220D94612CCF6, 800},
-{0x5D27BDBACCBBA8F, 326},
-{0x5D4393E1D909D7C, 235},
-{0x5D443BE8CF4514F, 309},
-{0x5D51BB0C5A5814C, 485},
-{0x5D5882A3AB0C3A6, 398},
-{0x5D62046C73F9B94, 419},
-{0x5D6BB4A14769543, 420},
-{0x5D6D881327B4D78, 254},
-{0x5D6EDAA87986C67, 203},
-{0x5D92CD8574B02FF, 1385},
-{0x5D94D4300FF8EA6, 322},
-{0x5D998F2FA557F83, 363},
-{0x5D9AC2739CCC95F, 634},
-{0x5DA3DEC832B0D6A, 3555},
-{0x5DB868963147CCA, 253},
-{0x5DBD7638FC45A5C, 1627},
-{0x5DC64123E41D0C6, 230},
-{0x5DDCBE3418A9D26, 307},
-{0x5DE909B3DE6E27A, 434},
-{0x5DED48C67DC409B, 248},
-{0x5DF42D54BA541A2, 215},
-{0x5DF9853C26302B6, 271},
-{0x5DF9FA160B3D90B, 237},
-{0x5E0F3B5C78A8A8C, 627},
-{0x5E11735150E5722, 1396},
-{0x5E137BD97AABF5E, 524},
-{0x5E1892A06D46B31, 608},
-{0x5E199EA25A13365, 353},
-{0x5E26F99AF34E9F6, 892},
-{0x5E28A56B62992DC, 202},
-{0x5E3E4AE7DE31919, 212},
-{0x5E44A06824BF766, 419},
-{0x5E50E4A16517B20, 352},
-{0x5E7252097609820, 260},
-{0x5E85D3DB700FE2E, 283},
-{0x5E94D59E0F601A9, 347},
-{0x5E98C0C9D5F1DDB, 469},
-{0x5EA3784951D5EBC, 4424},
-{0x5EAC241054749C8, 903},
-{0x5EB31089C3DC075, 1426},
-{0x5EBBBBDF584A03F, 6470},
-{0x5ECB3E373ACB223, 393},
-{0x5EFBA123BDD5498, 663},
-{0x5EFEAA692EE66FF, 285},
-{0x5F0CA7D7A7F50CF, 1623},
-{0x5F0F6D96F25AF26, 971},
-{0x5F1736DE508762F, 723},
-{0x5F281CDACD06859, 236},
-{0x5F2B4CF8F2AA14E, 3010},
-{0x5F43BAD793B839E, 228},
-{0x5F476077107EC3E, 277},
-{0x5F513C79D13B958, 243},
-{0x5F5505232045DC8, 1092},
-{0x5F6306D75BD7020, 431},
-{0x5F840228119A8D8, 892},
-{0x5F8906597A0F0E3, 621},
-{0x5FA99E97DB6B607, 220},
-{0x5FAE00620475A85, 296},
-{0x5FCC530FEB26DE8, 296},
-{0x5FD82F81EFFCBFD, 393},
-{0x5FF29C6C3D22AA2, 355},
-{0x5FF815EF4E2DD17, 734},
-{0x601828CB47DE126, 252},
-{0x6021843EC927E4A, 212},
-{0x60289E87B667392, 671},
-{0x60448175D628DEE, 239},
-{0x60451861B521180, 254},
-{0x60460D80680875D, 1771},
-{0x6047E83CEEADCD9, 723},
-{0x605505372068E4A, 285},
-{0x605851C8DB00395, 414},
-{0x605A56D17F34BD2, 386},
-{0x606D6E6C8B573FC, 329},
-{0x606F2C1FAF16BB1, 606},
-{0x607265340FFA3C3, 225},
-{0x6076B06387DB576, 215},
-{0x6087AF5F097FFA0, 408},
-{0x608C8AA872E540D, 1253},
-{0x6097ECBF5100E62, 416},
-{0x60B8AAC6599A22C, 719},
-{0x60C0F09F1999D7C, 375},
-{0x60C9F7C0D4E0DBF, 2369},
-{0x60D45E436D3DB6A, 479},
-{0x60DC2ED51D72542, 228},
-{0x60E5A943B492E64, 368},
-{0x60F46AF639A61ED, 259},
-{0x61023C5ED5B85F2, 807},
-{0x6109C3716FE4929, 208},
-{0x610AFF5E29FF608, 443},
-{0x611027709A2F1BE, 321},
-{0x61174CBE18719F0, 2306},
-{0x611A8419CE4B89E, 314},
-{0x613D7C1FDFA93D0, 448},
-{0x614309FFE547861, 634},
-{0x6162D7565498C86, 1227},
-{0x61687BCC039C6F0, 653},
-{0x6187D16529C96EC, 225},
-{0x6189691087F5DF9, 1960},
-{0x619FC09AAF164D9, 392},
-{0x61A3A1A98F7CDB9, 531},
-{0x61B1D827C34E8FC, 305},
-{0x61B4C46E2C6047B, 215},
-{0x61C3BF7F7C140AC, 1080},
-{0x61CB11B3FE11F8D, 205},
-{0x61CC2D6B4EDE03E, 207},
-{0x61CD83BD3014792, 204},
-{0x61D16ED17B60542, 259},
-{0x620222F37E38812, 234},
-{0x620763E1896CD48, 262},
-{0x620986B9C2A1450, 29038},
-{0x6214AA96B0C3526, 208},
-{0x621711256339203, 263},
-{0x622E332ECE51687, 390},
-{0x6243C37970E89AF, 706},
-{0x624DE21DBD401F1, 811},
-{0x624E2303C9FA337, 925},
-{0x625ADB107FA20F1, 318},
-{0x62774EBFE826CFD, 313},
-{0x6297E09EBA44CFC, 525},
-{0x62C5B42EB6B1669, 308},
-{0x62D0F5FBA429CFF, 258},
-{0x62D3CE9A397D271, 285},
-{0x62D3DE9CCDD2126, 3384},
-{0x62ECA20661CA8FC, 3037},
-{0x6304F4707FEF48B, 3094},
-{0x6343580FF12FE32, 408},
-{0x6354D924F6B6026, 480},
-{0x635D86EAC9A4F8E, 238},
-{0x6361F2B9EE605AC, 316},
-{0x637632D4E3F92E9, 227},
-{0x6378BF6DA861C60, 377},
-{0x637AEF848138398, 768},
-{0x637C49B390FEA98, 370},
-{0x638FF6E12AD04E4, 273},
-{0x6395915E7F30BC2, 236},
-{0x63B67628A6DE3B9, 349},
-{0x63BD8640DB9D9BB, 298},
-{0x63CF5E5BEDEDE90, 234},
-{0x63E2C9014AE6E51, 5272},
-{0x63E55A7D09120C3, 376},
-{0x63E82496224A397, 228},
-{0x63F5A250959D73C, 473},
-{0x63F7E8E1224B35B, 222},
-{0x63F9A47945C807B, 1563},
-{0x63FD885AE5C429E, 359},
-{0x64378126F99F2B0, 262},
-{0x643F05B864E15BF, 250},
-{0x644067E4A376CA7, 1935},
-{0x644A495D561FCD8, 230},
-{0x644A805212C1B69, 230},
-{0x644E486E119DD70, 429},
-{0x64544DFD8A2BC45, 1299},
-{0x645CF4C52A36477, 429},
-{0x64702DD29C25484, 425},
-{0x648F7A35C4F89B1, 380},
-{0x649AE86FA61D59F, 419},
-{0x64A0B93380155EF, 3615},
-{0x64A94D3AEE63A3A, 427},
-{0x64B2CFE45326159, 281},
-{0x64CF93E7D856199, 344},
-{0x64DC0C11284B0DF, 208},
-{0x64F3626A28ACEAE, 657},
-{0x64F58E65E13B6CE, 455},
-{0x64FE712A1E0CD66, 890},
-{0x65009484FECB1A8, 546},
-{0x6503C56E98B71DE, 332},
-{0x65150A130978067, 342},
-{0x654C435D320F7C1, 213},
-{0x65575B726EF4035, 501},
-{0x6570D1E2C0A9ED7, 489},
-{0x6571B7AB4F7C40D, 257},
-{0x6582644C0EC8EB9, 395},
-{0x658E9CF9A6B3828, 269},
-{0x6597CB89A411FB6, 270},
-{0x659A37ED28FCE18, 322},
-{0x659AA839CDFFEC2, 680},
-{0x65C07D71C8C221E, 270},
-{0x65D67763AB2F9A8, 1147},
-{0x65DDF709A1BA903, 215},
-{0x65E4FE88250F721, 260},
-{0x65EA9FDEDE1D640, 448},
-{0x65EEBE3F3D5ABC0, 433},
-{0x66020F83D9750CD, 2235},
-{0x660566F22D481CF, 566},
-{0x660903613A318CA, 1035},
-{0x6618A8FEF28D15A, 269},
-{0x6622BCD448FA3C7, 5838},
-{0x66266288458A981, 468},
-{0x66538C4AE4283F8, 220},
-{0x665AD294C1EF5E2, 543},
-{0x6660158830E02E7, 360},
-{0x666DD4A15EB7116, 371},
-{0x66701C2BDB19844, 382},
-{0x66851112A36D87B, 853},
-{0x669654D00A95903, 285},
-{0x66A82F77E8589CC, 354},
-{0x66A97BD9523D17A, 225},
-{0x66B92BBCAF2A0C2, 213},
-{0x66C92E0705F6B51, 285},
-{0x66D6694372EB4BD, 257},
-{0x671AE0B065314F0, 1060},
-{0x672B989D1DDC801, 206},
-{0x6730319D03F1C76, 272},
-{0x6745D2DBAB0E6F1, 384},
-{0x67475FB3D57EB97, 359},
-{0x6755EF05824E2E3, 215},
-{0x67698AF9A036C46, 616},
-{0x67BBAC6D238FA07, 7547},
-{0x67BC39A002E4681, 447},
-{0x67C52C7D1FC9D2B, 219},
-{0x67E0DC3993DCC61, 326},
-{0x6828EB8689118FF, 3450},
-{0x682CB1A15DA6A29, 1915},
-{0x68305F8D6730B33, 3844},
-{0x684470FCB03742B, 400},
-{0x68591EF00D18864, 3117},
-{0x685F013C37FEFFA, 1998},
-{0x68607CA07C46E05, 320},
-{0x68613AA4E1E73C2, 1774},
-{0x687B02F6508F51C, 4091},
-{0x6881E34FD3004A3, 437},
-{0x689485263B2D2B2, 217},
-{0x689C7959A34172B, 262},
-{0x68A35D365FB689E, 662},
-{0x68B0C583FE0D700, 1023},
-{0x68C3BE44CCE5648, 558},
-{0x68CD75F5E1640D9, 3253},
-{0x68D79F3957B11B1, 497},
-{0x68DD08433E30A2F, 1119},
-{0x68EC74294ED6971, 524},
-{0x68FAA6F85375A5E, 1315},
-{0x69270D8A501AE15, 409},
-{0x69286973992F3BC, 355},
-{0x695E49F126C86BA, 486},
-{0x6969E35D69ACBC4, 212},
-{0x696AD7B4CA47987, 273},
-{0x696D1AF8AC0A052, 234},
-{0x696ED7789731BB5, 296},
-{0x696ED97783B6966, 614},
-{0x6997D46AA036B53, 937},
-{0x69A58167A260544, 334},
-{0x69AB802B9222B25, 331},
-{0x69AEC2961BA88D1, 700},
-{0x69B180B4AEBC5B2, 384},
-{0x69B8DBAE87F8509, 248},
-{0x69B9AD488C82973, 335},
-{0x69E0A479D4293A6, 4279},
-{0x69EFFDC5A784A0C, 1021},
-{0x69FCCE7A3A1989A, 311},
-{0x6A0006FE4BED999, 220},
-{0x6A0C6064178B282, 2155},
-{0x6A0FF71A6EB53FA, 553},
-{0x6A27C35C4F3BA3F, 786},
-{0x6A29F23006CA15C, 203},
-{0x6A2C8C97EEAD145, 657},
-{0x6A47533850D7989, 390},
-{0x6A5FBEAC17DF6F2, 3413},
-{0x6A70FC6AC87FFC5, 447},
-{0x6A73A81493BCA52, 477},
-{0x6A7E41786CBCF82, 3014},
-{0x6A8A1847D6F6C36, 210},
-{0x6A9AD9613F308C5, 329},
-{0x6AA5B6ECBC1F100, 303},
-{0x6AA8D39B46FF95F, 327},
-{0x6ABFEEC2C127E6C, 620},
-{0x6AD3118979B8136, 245},
-{0x6AD9C5404B1B225, 1050},
-{0x6AE97FBD6493CAE, 404},
-{0x6AECA258A4A5E6C, 315},
-{0x6B0FA80AF9493A4, 2275},
-{0x6B188C163AA2738, 391},
-{0x6B1F8FD381371DD, 1876},
-{0x6B2184F12EA7902, 296},
-{0x6B280C1A8FE62BD, 349},
-{0x6B3EB8D419717F6, 287},
-{0x6B44ACD1BC8509C, 1130},
-{0x6B45520A1992AEC, 371},
-{0x6B47F83D31B0836, 1045},
-{0x6B4A852065D285A, 1711},
-{0x6B4CB649D455F48, 234},
-{0x6B52B26A8D4432E, 683},
-{0x6B8DF0C4419E305, 781},
-{0x6B96C35262E9E1D, 430},
-{0x6B988FB444607C7, 1781},
-{0x6BA7086DDCA26E3, 208},
-{0x6BAA8EC909DFAB5, 283},
-{0x6BACB3DA285D33C, 468},
-{0x6BC5639BF776793, 296},
-{0x6BCCD3EFD285545, 211},
-{0x6BD8C16D4050DC3, 200},
-{0x6BF15648649740A, 433},
-{0x6BF8FF55E009B1C, 214},
-{0x6C0CFB9C2C77D1E, 279},
-{0x6C21BFCA46A6CB4, 237},
-{0x6C251C31BAD25DF, 289},
-{0x6C28CB579C8A679, 500},
-{0x6C6D759A9274DD1, 2897},
-{0x6C763D69B45D543, 262},
-{0x6C880BA0BB7E441, 617},
-{0x6CA18CB9F31EBA3, 619},
-{0x6CA5084F3BBCC2D, 466},
-{0x6CB1DA6AA813BD1, 222},
-{0x6CC05D93BEC9D4E, 262},
-{0x6CC96034FD031EC, 1637},
-{0x6CCE4EDE5733032, 551},
-{0x6CD04105E6A68FC, 1073},
-{0x6CD3898E2B94B70, 290},
-{0x6CDED1457960FAA, 335},
-{0x6CEBD9C52967DFD, 289},
-{0x6CF607479E6F26E, 348},
-{0x6D083E047D64F69, 696},
-{0x6D1A844FE8E019C, 203},
-{0x6D26358E142F225, 1558},
-{0x6D311347506A763, 247},
-{0x6D3C3219C2858E6, 406},
-{0x6D515DC89FD95CC, 313},
-{0x6D58048D4C1136E, 30480},
-{0x6D597F523EF5537, 257},
-{0x6D640CBD453C939, 269},
-{0x6D77F4CFD0A49D7, 282},
-{0x6D81CC445D0098C, 18616},
-{0x6D9F550E1E6E797, 426},
-{0x6DA3F07FB0E1022, 421},
-{0x6DA468FEF301912, 1678},
-{0x6DC5DEA391DBF8B, 321},
-{0x6DCA87A59D4F7DD, 248},
-{0x6E045B024565999, 405},
-{0x6E0B028C85B99AA, 1089},
-{0x6E1E0F5D9897C49, 5459},
-{0x6E452D0931F087F, 215},
-{0x6E522ECE8FE17E2, 746},
-{0x6E553E98DED4948, 447},
-{0x6E7361D39BCA99F, 205},
-{0x6E73D3EE6E1268C, 1001},
-{0x6E780F47142FACE, 409},
-{0x6E7D5BF977339EE, 464},
-{0x6E8890A859CEAC5, 345},
-{0x6E8ACF84DF8D21E, 205},
-{0x6E8DE281B738E5F, 470},
-{0x6E96CF23E7A0669, 714},
-{0x6E9857A5A0D1539, 284},
-{0x6E9DCE3D26A8425, 420},
-{0x6EA9F3D3B98D067, 298},
-{0x6EB35716B3B526F, 486},
-{0x6EBFE06F7F45E3A, 204},
-{0x6EC1AA23D44E26B, 338},
-{0x6EC7E6BF33AFCF8, 365},
-{0x6ECD27E9885418E, 288},
-{0x6ED9E43836FB44C, 791},
-{0x6EDB07AF271E397, 1604},
-{0x6EDF5781AF75AB2, 470},
-{0x6F0386D105F9956, 208},
-{0x6F117874FC7C20D, 249},
-{0x6F1329A3D9CD125, 1552},
-{0x6F1A8BAC2D2589A, 711},
-{0x6F49AD323420D77, 307},
-{0x6F66CCCF4720E5E, 213},
-{0x6F7D7383465D74D, 262},
-{0x6F8633013CEEC8B, 347},
-{0x6F91F7670495D12, 389},
-{0x6F92F3D86F94CF7, 262},
-{0x6FA6D706D806957, 211},
-{0x6FAE0D2CD0EA719, 1037},
-{0x6FB89DC539E3B7F, 4641},
-{0x6FCA64FA1BE82AC, 200},
-{0x6FD563FF63822E6, 422},
-{0x6FDCA4DC9ED7BEE, 475},
-{0x6FE0FC5B6D427C9, 702},
-{0x6FF6E81A00BFD56, 2074},
-{0x700C3E891F93FF6, 252},
-{0x70254C3EB71F800, 5409},
-{0x703627729D5F3CA, 424},
-{0x7041750209B5E3A, 848},
-{0x70437E255CFFFF0, 1470},
-{0x705B297EE82D441, 235},
-{0x705F93B80680095, 212},
-{0x706284C62FD983B, 200},
-{0x7065E50733E0E80, 584},
-{0x70692AA334EBEFD, 1538},
-{0x7069FA3F55061B9, 303},
-{0x708153AD413CE3F, 234},
-{0x708874E6571D8CC, 316},
-{0x70A75A08F3DE0EC, 245},
-{0x70C3BA204A3896A, 1147},
-{0x70CBF7F86F53F79, 217},
-{0x70D1415A2019A52, 2644},
-{0x711A993E3E3E781, 356},
-{0x711B3A4DB7179C3, 327},
-{0x711EF95E8BFC96C, 490},
-{0x7123E895B6B000A, 233},
-{0x712D3C8114AF687, 943},
-{0x71399061CBCEB73, 1369},
-{0x713D2D5F35A5C53, 23283},
-{0x71440BE2EC02128, 229},
-{0x716E97E4459A1BE, 224},
-{0x717646ADED198A2, 1305},
-{0x71786126843B042, 323},
-{0x717AF9B545D61B5, 362},
-{0x7184D8E67F88A35, 1229},
-{0x7191340D465BAA9, 839},
-{0x719950EB842D62F, 2857},
-{0x719FEF26C9B777C, 476},
-{0x71B0536BF1BC4A3, 236},
-{0x71B73B9132E60CE, 335},
-{0x71BD0DE17CD67DE, 1002},
-{0x71BFD9D91A47D97, 345},
-{0x71C5566D9FDF5DF, 761},
-{0x71CC64C4952294E, 1230},
-{0x7208AE06A5C91A1, 201},
-{0x7217407238B9DA6, 1754},
-{0x7258BBDD98FBA55, 812},
-{0x725FF186A399C17, 1668},
-{0x726AB558ADC37A1, 263},
-{0x728A48E1EAAB4D3, 270},
-{0x729D49D838D59FA, 264},
-{0x72A89F7E33C381C, 964},
-{0x72CD880EC24945D, 454},
-{0x72DCC0408583EFD, 347},
-{0x72E5DB1A18D56CB, 556},
-{0x72E7B476543D3BE, 2447},
-{0x72F9232B848E1C9, 678},
-{0x732657A685ED702, 272},
-{0x732B54CB28D16D5, 240},
-{0x732C0946E3E5396, 365},
-{0x7340563BC382C0C, 239},
-{0x7343D7251E5956E, 250},
-{0x734B7CF49041103, 856},
-{0x734FC81512C28AD, 269},
-{0x73528A5E2C148D1, 1316},
-{0x7354C5F88585BE8, 219},
-{0x735B71C4A6DF042, 383},
-{0x735E2D264E8AB0A, 340},
-{0x7380E08BE52C631, 1331},
-{0x739224AE945D819, 257},
-{0x73A5BDC87460D01, 239},
-{0x73D006FA1E47355, 202},
-{0x73E1AF3F8E65093, 4021},
-{0x73FDC5DEA2B5F94, 1927},
-{0x7405DC49E2800A1, 210},
-{0x7407DD8AA0CF6B4, 830},
-{0x7409259D4A8A749, 270},
-{0x740B10FB831426D, 318},
-{0x7415C89CBE52C86, 988},
-{0x741D592838B306A, 4928},
-{0x74380C177FA81E3, 540},
-{0x7449D4F123CD710, 1210},
-{0x744EF5F83FDDA79, 379},
-{0x747C102C05A650D, 231},
-{0x7484CB9DD8D03F9, 315},
-{0x7485580B7EF2D7F, 244},
-{0x748700DB274908D, 267},
-{0x748F67EBC1C01FC, 291},
-{0x749BBECCF978453, 355},
-{0x74A326E9BF54FBA, 491},
-{0x74C6068A9A72C50, 1012},
-{0x74C6094C733144B, 346},
-{0x74C77E5EF79DE36, 1396},
-{0x74CAACF7ACD01CF, 336},
-{0x74CFC35F45AD5DA, 277},
-{0x74D476302D4E43E, 642},
-{0x74DA8374A39D94B, 234},
-{0x74E25EDB6AE95C4, 2330},
-{0x74EB74E7E2701F8, 547},
-{0x74F50AC6B6D7F4D, 480},
-{0x752986311183C51, 363},
-{0x752CAEE5D721D95, 257},
-{0x7545E344066C019, 328},
-{0x755FF6DA5682F0F, 416},
-{0x757A4062CF14E4A, 42198},
-{0x758ABD6848B6910, 228},
-{0x758DEAF6ABDE608, 273},
-{0x75A5090A7B6C791, 652},
-{0x75AD19A437B2976, 771},
-{0x75BCFA8F529F33E, 274},
-{0x75C1E8DA8BD66A4, 947},
-{0x75C2D7C734BF61F, 630},
-{0x75C7ECC9A15485A, 1646},
-{0x75C981B1A7D7C7B, 401},
-{0x75CB9C14142DD25, 358},
-{0x75DA11364F1A556, 414},
-{0x75EA93B82986B9C, 1400},
-{0x75F368DEA6BF45B, 556},
-{0x7615800A2BBC4C9, 3180},
-{0x762FC7A1F4D3C92, 294},
-{0x763C7B128951910, 286},
-{0x763EDEE71CEB222, 231},
-{0x764B1B8379F141F, 206},
-{0x765CD4D81370381, 363},
-{0x766738C765D2555, 280},
-{0x7668F470DAC6BEC, 1912},
-{0x76731FAA4A05DFB, 408},
-{0x768D9D59A42D85F, 1254},
-{0x769E253A85AA000, 250},
-{0x76BF80E50397B32, 591},
-{0x76C509AA9FBC546, 459},
-{0x76CCC24C4CB5C0E, 266},
-{0x76CDE2A06D93BF1, 1560},
-{0x76CF366B9164E47, 330},
-{0x76FC87E923D27B8, 333},
-{0x77105A702CDBC12, 333},
-{0x7726CDBDFC12E27, 259},
-{0x77284D4670D74E4, 9739},
-{0x772F53DC7380C40, 1332},
-{0x778CF2232A94CA0, 323},
-{0x779954ED80892D4, 370},
-{0x77A40054B5573AD, 810},
-{0x77A469C660202CF, 252},
-{0x77AB5B17BFDE56A, 210},
-{0x77B2CD2D3DD4B3F, 249},
-{0x77BCCAD9E0D1702, 204},
-{0x77C0C088C5AC846, 207},
-{0x77CA91B493F2B47, 318},
-{0x77DF108204C4FE1, 2053},
-{0x77E415F4E10884B, 350},
-{0x77FB532D4C5F4B9, 1896},
-{0x77FBFDBAC54898A, 699},
-{0x77FCE24C9D4E7F1, 1024},
-{0x78037F4A7617BF5, 334},
-{0x780F93657C9BBB1, 371},
-{0x781465DEED6712F, 952},
-{0x782BA91402DE031, 927},
-{0x7851E2D67E78885, 299},
-{0x787E42AC579FF8F, 228},
-{0x787E5E2862F9E38, 237},
-{0x788ACC243417B3F, 1894},
-{0x78AC3BB699282EB, 403},
-{0x78BAFAF77152139, 374},
-{0x78C4879C1A38027, 1082},
-{0x78D15148652F347, 1100},
-{0x78D4573DCCE2979, 201},
-{0x78DEBDCDCC2EBAB, 368},
-{0x78F368C2E6F076B, 2454},
-{0x78F7029BAE4AB6D, 232},
-{0x78FAFF7ED91C497, 1695},
-{0x7901C3289FC24A0, 693},
-{0x79092900B2A4F3A, 283},
-{0x7909439E64755BC, 223},
-{0x7913CAAE9970B0F, 215},
-{0x793944EE11D8D30, 253},
-{0x793EFE88A78ED1B, 267},
-{0x79419093ABD26A6, 2336},
-{0x794A7393F26192E, 335},
-{0x795BCD4E236CA9E, 734},
-{0x798369E1EC495BC, 303},
-{0x798517B86F84FDD, 202},
-{0x79915876D47E946, 562},
-{0x79918DB05AB0959, 1287},
-{0x79A78DFE9F9D5C2, 229},
-{0x79B45FC25F615A3, 1767},
-{0x79C86C59FC642DE, 793},
-{0x79F37041BB55EF2, 293},
-{0x79F87147283132D, 266},
-{0x79FB006997F04F9, 419},
-{0x7A127D0E7A6F913, 729},
-{0x7A1726DC463FE74, 582},
-{0x7A2F45D7B0D2007, 214},
-{0x7A43338DE670C46, 266},
-{0x7A536096D197BE6, 229},
-{0x7A7471A8559FB13, 281},
-{0x7A8C20A65F7A386, 377},
-{0x7A956E70FF2B0DB, 217},
-{0x7A97C75C1C35574, 552},
-{0x7A9915EB2883735, 1874},
-{0x7ABB6AA8665140C, 3806},
-{0x7AC1836A48451FB, 209},
-{0x7AC99FF56A026D4, 1551},
-{0x7AD1DA00EF095F1, 676},
-{0x7AD5EE937BA71E1, 458},
-{0x7ADBE11B4431BA6, 380},
-{0x7B06E508CB6F81A, 1442},
-{0x7B10A970A155B45, 228},
-{0x7B1B79C62819C05, 403},
-{0x7B2C10CA59AC46A, 1305},
-{0x7B3263E352863E2, 206},
-{0x7B32D00BB6982D9, 384},
-{0x7B504B8B79315A5, 237},
-{0x7B57013207C1D13, 268},
-{0x7B68E87AA382218, 464},
-{0x7B6B6864E8B86AF, 320},
-{0x7B73848955B19AF, 327},
-{0x7B91EDA668C8A9E, 3481},
-{0x7BA13E36F6FCB27, 561},
-{0x7BAC81F6CF979A0, 741},
-{0x7BC3705048E09CF, 1049},
-{0x7BC536CCBC1BCC5, 221},
-{0x7BD3953E132FAD5, 233},
-{0x7BE1C65A928D092, 3224},
-{0x7BE3C36D1B22262, 355},
-{0x7BE7EF204AC6534, 296},
-{0x7BF916237A2DA30, 399},
-{0x7C11F3125F18F9E, 214},
-{0x7C1B5836ECFCF84, 407},
-{0x7C3C4EF240E8431, 3702},
-{0x7C511EB3E8EF34C, 407},
-{0x7C5D4F384F5AD5A, 2129},
-{0x7C5DBCBA74C8CB2, 260},
-{0x7C5F3C7411C7EFE, 1036},
-{0x7C65396530126C5, 1393},
-{0x7C678A8159F9084, 494},
-{0x7C6A52EECAD8732, 294},
-{0x7C72C8AABDE3AB4, 271},
-{0x7C7468FFD7541DE, 375},
-{0x7C8568E55EA0C40, 1141},
-{0x7CB5EF4B2B7D904, 243},
-{0x7CBF66B20FA77C4, 219},
-{0x7CBFDB0878DAC5E, 212},
-{0x7CC7443F6F4436D, 1147},
-{0x7CDC937B23E498C, 3131},
-{0x7CE7156E45941E1, 239},
-{0x7D255BDA4597A39, 305},
-{0x7D32EC7DE2287BE, 1123},
-{0x7D40186FA19ABC2, 724},
-{0x7D51E7D61A897F1, 297},
-{0x7D8DE4828FA2163, 230},
-{0x7D9E4E6ACBC083F, 224},
-{0x7DBD3DF7338F4E7, 220},
-{0x7DC79ED3DEE3CB3, 380},
-{0x7DCEBCB56072642, 710},
-{0x7DE0C5555E9F1BC, 1345},
-{0x7DF7A6080685738, 323},
-{0x7DFCF1D7CBC5B5A, 622},
-{0x7E14567EA3CB28A, 257},
-{0x7E1AFC5FF4E54C1, 339},
-{0x7E21818C0ABD56C, 262},
-{0x7E22F3F19C7CC81, 349},
-{0x7E27E65240F08C5, 569},
-{0x7E384D73E77A5A7, 388},
-{0x7E39FA6FB89FA91, 373},
-{0x7E4CFD65DADD15E, 1031},
-{0x7E55444BCA3B686, 362},
-{0x7E5FA261C6CF0CB, 309},
-{0x7E621BE9D90AAB9, 201},
-{0x7E68FCEF08616F4, 255},
-{0x7E6B6461CDB8139, 213},
-{0x7E73CF67FB46274, 313},
-{0x7E740E604A15573, 222},
-{0x7E795243CC9A96F, 967},
-{0x7E8CF581C281599, 658},
-{0x7E96045FCF80536, 2335},
-{0x7E9FB464D2F9DE3, 573},
-{0x7EA6A5F67191150, 352},
-{0x7EBED1216A69F67, 919},
-{0x7EC3DC52B04D9B4, 467},
-{0x7EC56986F85F647, 1830},
-{0x7ED07F54851C38C, 1734},
-{0x7ED1561F6128200, 2919},
-{0x7ED3C6025A60601, 334},
-{0x7ED97BB16965521, 252},
-{0x7EEE4A2FC6AA78B, 224},
-{0x7EEF8639A34D163, 774},
-{0x7F067933D66195F, 228},
-{0x7F1751D621952D2, 255},
-{0x7F2176F8C4CC56D, 293},
-{0x7F23F7F42EC9A1C, 266},
-{0x7F24369AFA64047, 423},
-{0x7F2B02F76A98ECF, 291},
-{0x7F38ABFC93809F8, 299},
-{0x7F468486CDBF7A6, 3131},
-{0x7F612A532CD62A9, 247},
-{0x7F77DFCEEF249D5, 1563},
-{0x7F7F14DF1263129, 241},
-{0x7F89AAC79B0453B, 394},
-{0x7F8CC84A4D8FC38, 530},
-{0x7F90620D34A0E70, 423},
-{0x7F974B2D4164692, 4794},
-{0x7FAE54BD37F5A28, 231},
-{0x7FBC49E1E66857F, 257},
-{0x7FC49CA14BE66FD, 207},
-{0x7FD804C18EF3088, 623},
-{0x7FE3C993A47F2C8, 504},
-{0x80040F7DF07E31B, 312},
-{0x8005B0D075F32D2, 1624},
-{0x803C805A5C02226, 1883},
-{0x803F49B9EE93A02, 381},
-{0x80573FE8F254D67, 412},
-{0x805EA06A26E0463, 345},
-{0x80651D49F8EFAD1, 742},
-{0x8066E78A9B4B025, 3311},
-{0x80684954B8A2D2E, 219},
-{0x806D1E4910BF115, 3841},
-{0x806FA1F84A05A88, 525},
-{0x80734275D41B325, 229},
-{0x8083FD89FDF2F46, 796},
-{0x808444EF0AE143A, 1821},
-{0x809C80DFAE59293, 222},
-{0x809CE1E9FE5FF05, 291},
-{0x80B25728A6E2FD8, 257},
-{0x80B4A8AEA575018, 437},
-{0x80BA58F0B45AF94, 249},
-{0x80CB73747749018, 428},
-{0x80D373CBB89A458, 272},
-{0x80E0FAEBE495BF9, 678},
-{0x80E769F24A9C9E8, 280},
-{0x80F24FA238EFE10, 676},
-{0x80F33E62E02CBEF, 212},
-{0x80F5A22C6B55711, 207},
-{0x8108828513BF3EF, 245},
-{0x8108897D4141065, 1058},
-{0x8109B7143CF6245, 553},
-{0x810E695E699CBEE, 250},
-{0x810F6C36AD9E173, 290},
-{0x8112E807C1312F5, 2374},
-{0x8117C8F175968E2, 248},
-{0x811FA2246F8887D, 207},
-{0x8137B493FF2EC8E, 867},
-{0x8143F0187205399, 286},
-{0x8146BD646F2BA94, 303},
-{0x814B89B59FA61C3, 505},
-{0x81517E010537291, 26749},
-{0x815391E2579CCC5, 2991},
-{0x816251CA233BD97, 323},
-{0x816547902B4DA55, 475},
-{0x817651FF3E060CC, 294},
-{0x8179C50468001F1, 245},
-{0x8191B2CAEE763FE, 5327},
-{0x819B68384A17243, 236},
-{0x81C4B16DFCBA601, 1581},
-{0x81CF2EEA2B59001, 211},
-{0x81F22C079F129D9, 246},
-{0x81F50D4E48A254C, 3897},
-{0x81FAD784E557C52, 239},
-{0x81FF3CC563BDAA1, 202},
-{0x82024FF0C86D9B7, 256},
-{0x820B9DB238448F1, 3994},
-{0x820D12D2CE0AE55, 3258},
-{0x82109EA1CC586AE, 2640},
-{0x821C7532DE16517, 237},
-{0x822120646E72F91, 478},
-{0x8229A10A4BB3680, 319},
-{0x822B638ADA6FBF7, 392},
-{0x823D1405C19B273, 222},
-{0x8248ABAE9C95642, 464},
-{0x824F08B0A5B7962, 263},
-{0x82555A64FAA8881, 226},
-{0x825B645E9504003, 378},
-{0x825F28C4C9916DC, 277},
-{0x82608890C1E111F, 745},
-{0x8278EF0666E15B8, 201},
-{0x82A1CB14023DEC7, 207},
-{0x82A2B93553DFCEF, 1494},
-{0x82B21C4F2F2306B, 305},
-{0x82B990871C3E0BE, 503},
-{0x82B9BB03CA33F25, 7834},
-{0x82BC02573382EBB, 310},
-{0x82C2550F5CF1B93, 934},
-{0x82C945AD445E3B3, 254},
-{0x82F352B29E4ADA3, 318},
-{0x82F8E1891EABF1B, 302},
-{0x82FB5BF3FF826A5, 1755},
-{0x8300E2D2C74478C, 266},
-{0x8306E4551BC7D72, 229},
-{0x830EC925FAAEBDD, 250},
-{0x83156E1599A66BC, 319},
-{0x831952356473249, 395},
-{0x8321311F6439822, 1148},
-{0x833239FF16FCE9F, 275},
-{0x83481FF8E02520B, 628},
-{0x83547331FF974BC, 448},
-{0x8357B94F9A44730, 474},
-{0x8359A4A928421CC, 220},
-{0x83685174533209A, 308},
-{0x838BB48FA2AEE2C, 206},
-{0x83960CA56BA8F6C, 693},
-{0x83973A6AA0CE31E, 545},
-{0x839779F0973CAE3, 335},
-{0x83B7D2E325A7C62, 2138},
-{0x83ED641883D67CE, 769},
-{0x83F38EC7BE18856, 351},
-{0x83FEC8826FB9F5E, 292},
-{0x8407D48D248714D, 469},
-{0x840FE2ACA3032D1, 202},
-{0x841001A6D6CFD4E, 1004},
-{0x841ED5AEF7D1083, 703},
-{0x842815BD044BDE5, 251},
-{0x8439D36F9DA4FFF, 303},
-{0x8442878AD1830D2, 555},
-{0x8457D8943E5A5D0, 33515},
-{0x8458CBE9738A4DA, 230},
-{0x84667530D1752AA, 364},
-{0x84691FF1FF67D18, 2609},
-{0x8482F3284FBAC4F, 893},
-{0x8484FAA440BB218, 267},
-{0x84A0D9295098A70, 337},
-{0x84ADA98D2A7905F, 433},
-{0x84BA4122B4CBF4C, 375},
-{0x84BCD50300ECC12, 200},
-{0x84C91CA22BACA7B, 449},
-{0x84D1D149027C123, 217},
-{0x84D1FE69DEF09AB, 611},
-{0x84EF09C0E551A71, 555},
-{0x84FCBE84C3FBC8C, 276},
-{0x84FE3A0C856C6AF, 220},
-{0x8502124A2854D71, 320},
-{0x85061C458E60591, 520},
-{0x85080A391CC73A5, 255},
-{0x8508751609089C4, 219},
-{0x8519513DFD265D0, 267},
-{0x851C4D4CAB6ADFB, 438},
-{0x851D88F72AA09A3, 258},
-{0x85263762B58C689, 265},
-{0x85263C94BC58363, 845},
-{0x853BD7298527E8C, 475},
-{0x85484B919936EEF, 479},
-{0x855202878C4B2D9, 2905},
-{0x8565C9010789C29, 220},
-{0x859FA3319B0BC4A, 499},
-{0x85B3EDA1EECE9AF, 237},
-{0x85BC4CF2CE7C707, 264},
-{0x85D6CB1075BA3D0, 303},
-{0x85E695C7B53A13C, 231},
-{0x85FF11F5C4BE2F7, 382},
-{0x860600D822255C4, 334},
-{0x861423DB1044E9C, 342},
-{0x8620CEF75576BA6, 276},
-{0x86216E2BEB0945E, 236},
-{0x8623BD6A8F0E75B, 204},
-{0x863D73C13A693AA, 563},
-{0x864F601E8103FA8, 301},
-{0x865013C2BA45BFE, 6183},
-{0x8652C16B4FB7C31, 351},
-{0x86533C89C0672DE, 246},
-{0x865EE3FD39344C4, 207},
-{0x867D2CC446D499E, 540},
-{0x867DDBF3C4B7253, 15536},
-{0x868DA407CFFB789, 327},
-{0x868DCA8EC2E4F10, 1699},
-{0x868E78B890E09DB, 789},
-{0x8694DBE96C5A381, 741},
-{0x869A64490978CF9, 2104},
-{0x86DF17835594912, 278},
-{0x86FA1131A4EB674, 240},
-{0x87051A73CB2CECA, 301},
-{0x872A34FC4760DF2, 207},
-{0x872AF86D905B0F0, 205},
-{0x8739BA7C8343F9B, 860},
-{0x87415941CEB2DA9, 829},
-{0x874DCBDF298AACA, 2437},
-{0x875E38FA4FCCEC1, 263},
-{0x875E7C47543A993, 387},
-{0x87764F7ED45BF9D, 3949},
-{0x8798F8B8A245985, 344},
-{0x87A8E97CBCD7720, 524},
-{0x87D6F7B1CD979B7, 276},
-{0x87DAD20C81FC07D, 277},
-{0x87E343CB7F47ED3, 411},
-{0x87E706F9D539C8A, 291},
-{0x87F457A90737DA4, 772},
-{0x88018C35F8F2595, 491},
-{0x880AB897D0979C0, 863},
-{0x881B7B93231F844, 367},
-{0x8824D539E47CBC9, 385},
-{0x883137B200000C0, 252},
-{0x8841E3D07814630, 405},
-{0x884FCBAC81DF428, 464},
-{0x8852019D66DD0CA, 255},
-{0x8854B072D7EF6DB, 297},
-{0x8855AF7D30F2A1D, 424},
-{0x8863EC77235FF16, 244},
-{0x886657EC44C2F2C, 350},
-{0x886AA3DEC7F1683, 353},
-{0x887A320C1A3935A, 814},
-{0x888985B3F1528E5, 420},
-{0x88993C4D6F2944C, 272},
-{0x889BA7F15EF5446, 273},
-{0x88BC2ED3EE9C118, 1904},
-{0x88C6E47847F2B95, 217},
-{0x88D62BAF949BCCA, 361},
-{0x88E098ED762CB4C, 325},
-{0x88E9F23282E0B91, 471},
-{0x88F3B5D5DEEE327, 285},
-{0x88F99CC3DA621E6, 413},
-{0x88FC4C66500A094, 1026},
-{0x890003BEE356BFB, 954},
-{0x89015A4E522D807, 236},
-{0x8909A2F71E8FDFC, 726},
-{0x890D66F9AC0C929, 1223},
-{0x8918DC34B2AD442, 760},
-{0x891BD6DCA8C4D6C, 303},
-{0x89211B1A812CBD5, 227},
-{0x89438BE1EEDDE54, 235},
-{0x89555E00C83C7F9, 66159},
-{0x8961052ACAC691E, 651},
-{0x897C064AFB4E174, 353},
-{0x897CF6EAEF77E47, 5627},
-{0x8988264785B0651, 280},
-{0x898A3B824615A99, 223},
-{0x8994305BDE8C9F1, 2151},
-{0x89A7CCC6CE9455B, 994},
-{0x89B95F1DB09240A, 993},
-{0x89C00476CA2502A, 1329},
-{0x89C8489685CDB94, 2990},
-{0x89CE717DF9D02BB, 399},
-{0x89D17FA2D18B60F, 1673},
-{0x89EB96E739E7683, 794},
-{0x8A064226733FC12, 269},
-{0x8A40239FF4072F5, 296},
-{0x8A629392A451742, 1760},
-{0x8A6449B4D6B3647, 494},
-{0x8A691C9E7F1A7EF, 1380},
-{0x8A81711D2695673, 230},
-{0x8A92EBE9FE1EFAB, 784},
-{0x8AA3BA303CE788F, 2530},
-{0x8AB16114E27F616, 291},
-{0x8AC3FCF4D70A027, 5896},
-{0x8ACE7ED862DE202, 257},
-{0x8ACE9713C0D7C8D, 229},
-{0x8AD23940A7FD25E, 444},
-{0x8AD8AE36EF634F5, 234},
-{0x8AE1D40A479362C, 333},
-{0x8AEF928FB432A2B, 249},
-{0x8AF4E732A10B9B0, 663},
-{0x8AFCFE105A82786, 209},
-{0x8B038EDD4FEBEFA, 302},
-{0x8B10B47C557F8C5, 363},
-{0x8B3FD5D7776B279, 513},
-{0x8B45B86EAA3EE70, 559},
-{0x8B4CFD123913904, 208},
-{0x8B68A972F360D08, 236},
-{0x8B805CD64772F27, 216},
-{0x8B8E31B541E88CC, 307},
-{0x8B9196639168CCF, 280},
-{0x8BA164979D13840, 399},
-{0x8BABE41746BF044, 1470},
-{0x8BAC964B286428F, 312},
-{0x8BB2F39C766E5B9, 244},
-{0x8BB59A03F82F06A, 623},
-{0x8BBDAB1C4AFFE03, 568},
-{0x8BDA8C820B21394, 349},
-{0x8BE2699344FBFC7, 566},
-{0x8BE50B5A113A054, 509},
-{0x8BEBD2EFA314462, 1168},
-{0x8BED7A6AC29A8FA, 369},
-{0x8BF33AA244D0C53, 3893},
-{0x8C39E11FBADB453, 557},
-{0x8C40D52880802C0, 356},
-{0x8C574240E3D20EA, 4669},
-{0x8C60D5A854386F8, 419},
-{0x8C7C75B95315614, 208},
-{0x8C82139DC88C5D3, 981},
-{0x8C8459E49669BF5, 268},
-{0x8C8C95711F28519, 294},
-{0x8C9BCE4E6CA1EBD, 1814},
-{0x8C9D0878E9DC4A1, 1031},
-{0x8C9DE4C843904B9, 445},
-{0x8CB7D9CB3F59342, 658},
-{0x8CD10369A2F795A, 303},
-{0x8CD1BBA17F7A75B, 236},
-{0x8CD5D3B946D4FDC, 2088},
-{0x8CF52D5B88C5CF3, 228},
-{0x8CFC72C4277C71B, 2689},
-{0x8CFFDDFECB58CE4, 290},
-{0x8D058EECB4C3176, 521},
-{0x8D27E570A457B9A, 289},
-{0x8D32F1D9F2A6F35, 667},
-{0x8D584B138B5B5D4, 935},
-{0x8D59030C9B42765, 212},
-{0x8D63E1EA6ADCE45, 1208},
-{0x8D73972C9C1CF90, 719},
-{0x8D817EB828628CF, 401},
-{0x8D820D366E4DC40, 216},
-{0x8D8B9E6398BE581, 942},
-{0x8D9FC9AB4D958F4, 2146},
-{0x8DB39FB1A6A35B4, 458},
-{0x8DC3B3C6A0C550D, 323},
-{0x8DC9442DBF9B26B, 334},
-{0x8DD45919B78A516, 209},
-{0x8DD5D1DE06BA254, 271},
-{0x8DE3C991886A847, 511},
-{0x8DF3A080C64D52A, 388},
-{0x8E1F70675766C24, 447},
-{0x8E651CC24661E87, 565},
-{0x8E96E83235C84CA, 564},
-{0x8EAB014F1992880, 674},
-{0x8EB68F2EC5CB3CE, 416},
-{0x8EC74138FD5D8A9, 290},
-{0x8EDC1CC4802CEC1, 203},
-{0x8EE24BAF49A4708, 326},
-{0x8EE8751EBE623B6, 355},
-{0x8EF12FE82C3AEB0, 207},
-{0x8EFDA6B19AD7A69, 767},
-{0x8EFFD05D1B51C64, 452},
-{0x8F003A73B7A7DED, 211},
-{0x8F051C01ACBFD3C, 202},
-{0x8F1438C71414B35, 353},
-{0x8F1695886D9CBDD, 264},
-{0x8F1C352B0727521, 253},
-{0x8F21D93BD606E91, 201},
-{0x8F27FD122540BF8, 434},
-{0x8F36DBCCBA286A4, 609},
-{0x8F40FC47A88DF9C, 237},
-{0x8F6468F2667CA28, 228},
-{0x8F7E2F1EAC82138, 518},
-{0x8F7E6390A946572, 557},
-{0x8F873625BE743F7, 553},
-{0x8FA8BA6BE3BE0EF, 202},
-{0x8FB8327EE92DE24, 1003},
-{0x8FBD9BDC824A15A, 818},
-{0x8FC95DB516FD326, 1221},
-{0x8FDA304781B5129, 389},
-{0x8FE060FEE89D5A1, 239},
-{0x8FF771B8407F43A, 221},
-{0x90013A35F7D25F8, 2279},
-{0x9007D1B30F22857, 234},
-{0x9023DD2C126691D, 228},
-{0x902DFC1FA64BE95, 272},
-{0x903738DEFEFD6C6, 231},
-{0x903EE932BB9690F, 95391},
-{0x904FED5582C88F6, 249},
-{0x90695BE39F0F9FD, 2183},
-{0x906A54A179353F2, 3448},
-{0x90763563202158D, 246},
-{0x9078A5C85E83BD4, 3416},
-{0x907A29473977610, 444},
-{0x907D69F42F0F2CF, 4130},
-{0x908D24BE9E16AD9, 2121},
-{0x908D7A1E1DA6060, 254},
-{0x9094BE993F0A8CF, 319},
-{0x909B6380B100D12, 813},
-{0x909CEAEC8CED275, 2199},
-{0x90B8D541A9D337D, 229},
-{0x90DE34A0590765E, 659},
-{0x90EC4E3C03C39D4, 220},
-{0x90EDD3626816E42, 297},
-{0x910998004DA7291, 1167},
-{0x91211EBFB3BCEB8, 357},
-{0x913AFCB3302837E, 521},
-{0x914232E9E09C5A6, 1923},
-{0x914287681391B74, 248},
-{0x914855A0EBF398B, 525},
-{0x914D1E074DA5345, 296},
-{0x9153C8C5FE9A3E3, 449},
-{0x915795FC30B79E0, 262},
-{0x9164372E2D8F7E8, 3152},
-{0x916785C1402E0D7, 328},
-{0x9167F3DA29E3C2D, 240},
-{0x91739B46B411639, 1390},
-{0x91748786FFCB73D, 445},
-{0x9176C95410D8A30, 776},
-{0x918BED9F5133248, 259},
-{0x91AED35D3219A7A, 412},
-{0x91BB5593523DFEE, 479},
-{0x91C8761FEE0669B, 3278},
-{0x91DD4BDBD41982F, 202},
-{0x91FD9BAC17C6438, 253},
-{0x922095200B83412, 759},
-{0x92346190373D4B1, 209},
-{0x923EC6FE1BE5C24, 853},
-{0x92487C990298317, 1851},
-{0x92580D00840A7BA, 841},
-{0x925BDAC4B8F8724, 919},
-{0x926F1FD7430162B, 533},
-{0x9289C37202B2AEC, 1002},
-{0x929BE6F3DDD121D, 386},
-{0x930AE4EF7465297, 212},
-{0x9310A2F83BA59FD, 763},
-{0x9311DC1E91608EB, 810},
-{0x933C1C8CBDD63F1, 237},
-{0x934AA750DEF7178, 259},
-{0x93589F61D865C16, 387},
-{0x935D8D173B6A3F3, 210},
-{0x935E6D67D24B238, 328},
-{0x93784440DFE11E5, 226},
-{0x9378E1BE3A25044, 424},
-{0x937E2374F03622B, 282},
-{0x9387FFFF892C2D7, 4567},
-{0x939DF43EACAC463, 1356},
-{0x93BAD8D74DDAF6F, 233},
-{0x93BEE9B6F0E80C8, 887},
-{0x93C2D7A248FAE05, 210},
-{0x93CCE3D6B93E07B, 241},
-{0x93D7208E2960BB9, 1877},
-{0x93E7E0E6232DE54, 460},
-{0x93EF6976E2B293C, 563},
-{0x93F19B73443CC42, 1442},
-{0x93F362AC204691D, 621},
-{0x9401D9A82970BBF, 485},
-{0x94094C681EBCEA8, 286},
-{0x9426388D27DBA62, 344},
-{0x945E9881B00B329, 250},
-{0x9489214D0B5D307, 737},
-{0x948D4B185967386, 216},
-{0x949E5AFA18E144A, 239},
-{0x94B029DB9C26210, 954},
-{0x94FF0D349271FAA, 1854},
-{0x9501D4E8918CFDB, 907},
-{0x9506317298BB4DB, 528},
-{0x9512B6E6B2E5FB6, 307},
-{0x951319E16378CE9, 385},
-{0x952497810C6C1A2, 279},
-{0x9527AA94802263E, 576},
-{0x9559BBA2D6C7998, 281},
-{0x955BA418FA1C938, 864},
-{0x9579E6654229C7A, 402},
-{0x957C60CBBC3D54A, 315},
-{0x95886AFBA62F2F4, 1014},
-{0x958DDD2D8F7D8AF, 470},
-{0x9590FACF44D7A0B, 222},
-{0x95986E45EA73888, 913},
-{0x959BB4C4ACAC73D, 205},
-{0x959F6EF64BFC25D, 224},
-{0x95C1DE39275F117, 254},
-{0x95E27D16A210D4B, 342},
-{0x96382AA7F243275, 231},
-{0x963A7A3B891577E, 2145},
-{0x9643C52004E0BFF, 371},
-{0x964B54C06BD2FA8, 991},
-{0x9665DFFD8557342, 394},
-{0x96719478577BD81, 372},
-{0x96737E415B9BC95, 2213},
-{0x967B26A133B3935, 227},
-{0x96874A731A99998, 2845},
-{0x9689399C79DDCC2, 1493},
-{0x968CF4D60F719B2, 246},
-{0x969245AEB10C972, 411},
-{0x96A1EB26E02ACC3, 301},
-{0x96B548555ADDB0A, 396},
-{0x96E9B0E44618E9D, 208},
-{0x96ECBBE4ACD7363, 222},
-{0x97185329FF0CD39, 340},
-{0x9727D123FCBF523, 501},
-{0x97282383DF65361, 552},
-{0x97312C315D99B73, 229},
-{0x9738C09EAB371E8, 2649},
-{0x974269BCF0C4142, 2695},
-{0x974663B18D268E0, 373},
-{0x975057317171C65, 538},
-{0x9751EF6495FFFAE, 510},
-{0x977199912FACBD2, 1287},
-{0x97759287BC4031C, 483},
-{0x977E3B6C5E7DA1F, 251},
-{0x977F3142B9890CB, 32358},
-{0x977F34C3F8A728E, 512},
-{0x97983C5A6C4C1C0, 201},
-{0x97ABDB3A84D2A19, 252},
-{0x97B559D24C88B6B, 1553},
-{0x97B7B0639EAE939, 464},
-{0x97C95877E664569, 293},
-{0x97D79BBCD772BA1, 972},
-{0x97D801127B7FB49, 772},
-{0x97DB0565525FEDD, 671},
-{0x97DDEF6DD2C961E, 1285},
-{0x97DF8055EF60D50, 355},
-{0x980465AAB77D076, 290},
-{0x980F02AD9734DB7, 306},
-{0x980FF11C99920E5, 223},
-{0x98210BE0E72304D, 250},
-{0x984AD3F0C3E37E3, 335},
-{0x985E4C34920126A, 1067},
-{0x98783A5334D9D68, 777},
-{0x9885FBF3C338371, 259},
-{0x9890124B177D67D, 219},
-{0x989B11815404890, 6310},
-{0x989C8BF205F09EF, 1547},
-{0x98A12AF971728E9, 314},
-{0x98B5798B20BABC7, 290},
-{0x98B733DD8496633, 205},
-{0x98CB2B1E060ECC7, 359},
-{0x98EBCC8B4F85CF0, 3145},
-{0x98F042F41B37400, 248},
-{0x98F2175EA15E02B, 218},
-{0x9902D59F6E6CF11, 391},
-{0x9922008A2441C78, 241},
-{0x9925492E0B0CD5B, 319},
-{0x99386DDC4CA6CA1, 285},
-{0x993DE21B2D1530F, 347},
-{0x9979B6689CFDEBC, 723},
-{0x999628A98C06C43, 271},
-{0x99970D3050C3A99, 1577},
-{0x99A8AE22D15C033, 519},
-{0x99B549684D1B4CE, 260},
-{0x99B7A5944869F19, 566},
-{0x99B9C0E25775277, 230},
-{0x99C2C93AAF6DFBC, 393},
-{0x99C79E0C09852A2, 2014},
-{0x9A087800B896BDF, 564},
-{0x9A187695905FB5A, 734},
-{0x9A226921B1FB934, 724},
-{0x9A2E930EA5DF8BD, 860},
-{0x9A311DA514A6936, 407},
-{0x9A56E6888ADCB7A, 746},
-{0x9A5A9C787ABE935, 303},
-{0x9A6D95E842729DD, 260},
-{0x9A6FCC56E31BA56, 364},
-{0x9A7123D5716086C, 226},
-{0x9A804AC8FB2F4C8, 770},
-{0x9AA2DB8C6FF8BC5, 280},
-{0x9AA536B1C1ACF9D, 274},
-{0x9AA847D2A73EE5A, 506},
-{0x9ABF5168C4CDF8C, 279},
-{0x9AD186DF8205434, 2238},
-{0x9AD5276A45ED07F, 5699},
-{0x9AD8EE3907A2D5C, 332},
-{0x9ADA82FFCD88D82, 258},
-{0x9ADAA79C094BD3B, 1372},
-{0x9ADE116A6F601CE, 230},
-{0x9AE22A7CE65BDA7, 265},
-{0x9B06E1773B85F32, 276},
-{0x9B09F88C6219686, 315},
-{0x9B122E2270602B7, 374},
-{0x9B3D24886910031, 231},
-{0x9B513C8DAAFFAA3, 233},
-{0x9B5AC4D9CFEB3D9, 201},
-{0x9B7D7733CCA08C5, 393},
-{0x9B9A786EEAAFD3C, 76744},
-{0x9B9D1F550567EDA, 690},
-{0x9BA4506A3E36241, 400},
-{0x9BAA26AFFA6E6E5, 438},
-{0x9BBFE257479F10A, 1342},
-{0x9BC21D62C61C159, 1031},
-{0x9BC731716684B6E, 901},
-{0x9BF66B6836FE895, 206},
-{0x9BFB78A1C354E06, 255},
-{0x9BFDB3363B74E19, 1618},
-{0x9C0663582C53411, 235},
-{0x9C08F70C8A321CA, 13590},
-{0x9C418F555EAE412, 871},
-{0x9C43DBC1CFBD2FC, 245},
-{0x9C489485901BD9E, 572},
-{0x9C4B43AF1294D19, 374},
-{0x9C4E7444CAC8DF4, 484},
-{0x9C59531B8134391, 494},
-{0x9C6B4C5C5069657, 220},
-{0x9C7152D2CF116B3, 782},
-{0x9C8F2DEE2B7A884, 354},
-{0x9CA3F6EA1887939, 14237},
-{0x9CAA32F0F74FAF3, 220},
-{0x9CAF26CF64CBAAE, 429},
-{0x9CAF2D0F45EDFE7, 251},
-{0x9CC5B3876E50FA8, 282},
-{0x9CD1D562C945431, 654},
-{0x9CD5C5ACFF14B7D, 1262},
-{0x9CDDE0E79C4147B, 235},
-{0x9CE338906A80B7D, 312},
-{0x9CED5EF8C1E64B9, 224},
-{0x9D0E1955A654477, 218},
-{0x9D1184BD462A4A8, 231},
-{0x9D197EC64814BA9, 315},
-{0x9D2080AD3041D6F, 269},
-{0x9D341003851F3B5, 467},
-{0x9D3EA829B93DA11, 336},
-{0x9D4324D6A5BAC63, 238},
-{0x9D4B15CEE8C6685, 267},
-{0x9D52C80033E5E7A, 761},
-{0x9D6B833451C0E4B, 306},
-{0x9D6F2231D973CF2, 247},
-{0x9D788B71D319AE8, 227},
-{0x9D7A22605C05F7E, 3411},
-{0x9D84993851686EE, 673},
-{0x9DA45A99E602D6A, 235},
-{0x9DADC0CC444B312, 262},
-{0x9DB5BA8DC456B47, 404},
-{0x9DEC85BB05E88E3, 289},
-{0x9DED8A2F3620E47, 236},
-{0x9E0E306F7ABE405, 584},
-{0x9E296860E15BE49, 206},
-{0x9E2FBC44D9B42B1, 704},
-{0x9E3C87EB18228AC, 397},
-{0x9E674F622EE7F0C, 4472},
-{0x9E8DB1153FDAC48, 501},
-{0x9EA1C96AD43FBC3, 1527},
-{0x9EAB4DD958DE23C, 603},
-{0x9EAE42DE44BB426, 295},
-{0x9EB5709A9F5B03F, 258},
-{0x9EE8D3A8CADE19B, 647},
-{0x9EECB34D7D9E249, 544},
-{0x9EFB5E5A0514009, 1185},
-{0x9F2F1AABC050379, 213},
-{0x9F3DA7218F8DB1B, 7153},
-{0x9F423C64743FDFC, 223},
-{0x9F4F149A7443D92, 219},
-{0x9F5A1FC6669863D, 398},
-{0x9F74B1B380D6BF9, 255},
-{0x9F82AFFB62EE7FC, 207},
-{0x9F8FDD0BEC8994C, 502},
-{0x9F9D1333D0B5A99, 865},
-{0x9FC83267FAA1CC1, 282},
-{0xA00303AC71974EC, 1751},
-{0xA006354D6CBCDE0, 395},
-{0xA00A2701A7A043B, 7184},
-{0xA02840006E501E9, 283},
-{0xA030E353A6D2336, 331},
-{0xA043C1600596B14, 359},
-{0xA05CDE7C380951A, 656},
-{0xA07AACFE33AEF73, 5421},
-{0xA08A7FDC87CC069, 225},
-{0xA09AE1199F33F37, 203},
-{0xA0A754CA57F601E, 502},
-{0xA0C791CD011CF60, 232},
-{0xA0D24309411826C, 330},
-{0xA10DB9A71BFEDF6, 562},
-{0xA1288B2C0BF5A9A, 1720},
-{0xA12CA23C583D5F0, 202},
-{0xA12ED42398A7DDC, 1200},
-{0xA136E37E1E15A4F, 7856},
-{0xA15C2296FEF9162, 1358},
-{0xA16191CEC45E22D, 632},
-{0xA16E966A6533919, 501},
-{0xA18707957738DFC, 200},
-{0xA187DB6A984CB8C, 216},
-{0xA19EDF29228D266, 397},
-{0xA1B05F509447095, 363},
-{0xA1C4B908D1CACE0, 413},
-{0xA1CF3884C39D3AE, 384},
-{0xA1D2030354D3D92, 1099},
-{0xA1DBA9FC2A68BCC, 256},
-{0xA1DD2C99F5F05FD, 255},
-{0xA1F015258E3EB63, 471},
-{0xA20580219C1EAC0, 797},
-{0xA2069B3C3442FA9, 269},
-{0xA20FA02D9E1E1C4, 322},
-{0xA218CFF84F38C0B, 556},
-{0xA23123A59449A57, 227},
-{0xA23764915BC0319, 244},
-{0xA247A607E22F8F0, 812},
-{0xA2596B97E61B268, 418},
-{0xA26684C3BD398EE, 524},
-{0xA27B63651AF308C, 239},
-{0xA28279D55C679E3, 290},
-{0xA28975DADBA51F7, 949},
-{0xA29DBEECFC5E10A, 401},
-{0xA2A22BD8BF089DA, 372},
-{0xA2B8F5F06A4912F, 272},
-{0xA2B91F8BEF1E36C, 222},
-{0xA2C9E066B17FE1D, 244},
-{0xA2CC23A30784DC5, 216},
-{0xA2D7529459D7167, 235},
-{0xA2F3B25EEC1A023, 1108},
-{0xA310E44A26BBC31, 290},
-{0xA31856BB35C6673, 421},
-{0xA32023BFABAE696, 431},
-{0xA348BF31A541E52, 524},
-{0xA35E6CC77DE6351, 315},
-{0xA36B6D404D1C372, 264},
-{0xA36CE0D17A16964, 220},
-{0xA37D39A0255DD2B, 914},
-{0xA385D819966D236, 401},
-{0xA39F5308ECD3692, 651},
-{0xA3B5D8C3EED1F74, 3324},
-{0xA3CC2EDE75A28A3, 1716},
-{0xA3D1BE91DDB01E5, 4529},
-{0xA3DAFB9A9FF5D0A, 203},
-{0xA3F2932DF1B9EB7, 265},
-{0xA3FE5A37FF1C915, 921},
-{0xA40E3622A9F1135, 695},
-{0xA40E4EF7602C461, 605},
-{0xA42BA00121AB043, 201},
-{0xA42D23673EDC9EE, 2649},
-{0xA442246347E0116, 283},
-{0xA445CCE7363070E, 203},
-{0xA44D7D57A782F4B, 308},
-{0xA4723D0B39CE308, 274},
-{0xA48241FE32EB0F1, 429},
-{0xA48839558B5F117, 208},
-{0xA48FE071137351E, 1111},
-{0xA49A6C59D8CB5B1, 3570},
-{0xA49B528DFA4A0F1, 275},
-{0xA4A70EC092A2FF5, 393},
-{0xA4ACE66F52D9A98, 536},
-{0xA4B53EB1B477310, 262},
-{0xA4D0384C2BDEF53, 327},
-{0xA4D6BCE0D939827, 215},
-{0xA4DA346F400AD39, 1207},
-{0xA4EDD5168DA38F4, 472},
-{0xA504F45BC67BE21, 910},
-{0xA51ED8237820F69, 7321},
-{0xA532A29BE3FA93A, 264},
-{0xA53C913469297D0, 2809},
-{0xA551EF7FBF13A6D, 6123},
-{0xA554FF539361AC5, 373},
-{0xA55C59F8A2387D0, 248},
-{0xA57178E136ACA8C, 236},
-{0xA57D5C916086266, 220},
-{0xA5853493970E718, 2149},
-{0xA59F99BEC385D15, 608},
-{0xA5A1124AE745703, 1553},
-{0xA5AA576662CF60D, 200},
-{0xA5AC37AAB0C96A0, 566},
-{0xA5CD066161D2AD9, 209},
-{0xA5D458E405764E2, 419},
-{0xA5EDD9402C25031, 1613},
-{0xA60E4FFC6517F46, 1298},
-{0xA616B0049DE9DC5, 2131},
-{0xA61B2962309DBAF, 297},
-{0xA6408D8BAF7D48C, 7482},
-{0xA65D53D511EAB32, 210},
-{0xA65EB7CBEF0D058, 234},
-{0xA679C78430533E6, 226},
-{0xA68D8BCCEF4173F, 632},
-{0xA68E554587831D7, 556},
-{0xA697D5BF68DF30D, 609},
-{0xA6A9D88032D3B09, 692},
-{0xA6DB48BE5328BB0, 418},
-{0xA6E4B8DEE8F5E51, 201},
-{0xA6EF3FFBBDE18C1, 1540},
-{0xA6F42E28A0D36BA, 372},
-{0xA6F4670DB79D376, 891},
-{0xA6FACEF079017C0, 1196},
-{0xA703B5FE5E921EB, 231},
-{0xA712435BB5085AF, 293},
-{0xA71A28BDC09A064, 523},
-{0xA71AD06245F9798, 2050},
-{0xA736CDBF9A536F2, 453},
-{0xA738EC851BD9454, 737},
-{0xA738F8BEC42A03B, 236},
-{0xA73B450E7F48642, 289},
-{0xA7452C354E2307E, 1731},
-{0xA74802D8652D43F, 3571},
-{0xA750FC7767FBD40, 231},
-{0xA751A00C56B44AA, 201},
-{0xA764132A11C541E, 1074},
-{0xA7694BF88838526, 544},
-{0xA77388B128CED0D, 521},
-{0xA774DA344A0EC7D, 406},
-{0xA7843095720922B, 229},
-{0xA795423B8D93B5C, 1926},
-{0xA7A88C794FFCA92, 250},
-{0xA7AF1FC3565C1AF, 454},
-{0xA7DBEA91A1A3A48, 303},
-{0xA7E28DAFAA34734, 258},
-{0xA7E70A1A01C5CE4, 257},
-{0xA81B5B28AEF9DAE, 311},
-{0xA8410756721F665, 618},
-{0xA844B60B2C3B4C8, 231},
-{0xA852BAF4FA46DF2, 236},
-{0xA85C181F56C7FD7, 6336},
-{0xA85E71E611460C6, 368},
-{0xA86114DB1C9F562, 363},
-{0xA8619564F0FD39A, 225},
-{0xA86FAA9C6FD6CEF, 856},
-{0xA86FF7D9C056686, 271},
-{0xA8842D056647393, 362},
-{0xA88E357D44B6181, 401},
-{0xA89B375F51C4964, 389},
-{0xA9184E592B187BF, 202},
-{0xA91C5748608D9EF, 7620},
-{0xA91C8449159C8D7, 249},
-{0xA936BB44B6349C2, 2235},
-{0xA93FAAE27A3816F, 762},
-{0xA946DCD6CC49E5F, 226},
-{0xA94DF5206799786, 361},
-{0xA95022DF32DA202, 447},
-{0xA9700F9D98EADCD, 290},
-{0xA973876D672A0D0, 267},
-{0xA97E4AF8DF768C9, 519},
-{0xA994C363BE921A8, 222},
-{0xA995B9BD02C94C6, 278},
-{0xA9C1DD3A9903A38, 440},
-{0xA9C61F093B260F7, 243},
-{0xA9DA3780D9E3625, 996},
-{0xA9E57B11A813F19, 528},
-{0xA9EDC9FB7517412, 869},
-{0xA9EF9406EA2A23C, 795},
-{0xA9F7D43C175C791, 476},
-{0xAA06CEC2499DF36, 216},
-{0xAA301D95D7984B3, 238},
-{0xAA3E5E6BAA9FB0D, 528},
-{0xAA3F361AFCE5855, 1266},
-{0xAA466627A2BAF38, 424},
-{0xAA4DE0F0B6651CE, 316},
-{0xAA5252BB3614C2F, 209},
-{0xAA63CC60153438E, 267},
-{0xAA68BEA7FFDD0DB, 339},
-{0xAA7854E7ADD3746, 855},
-{0xAA7BB44FDC279C7, 284},
-{0xAAB2FC1F5642B8D, 201},
-{0xAAB471E7A8B2DA5, 275},
-{0xAAC1E5E9482DCD9, 3197},
-{0xAAC9F17B4F41B37, 725},
-{0xAAD9F30D4A1D3AC, 209},
-{0xAADBFDFBFD7D8B1, 301},
-{0xAAE36116D44BFD0, 5685},
-{0xAB0C43D5320697F, 282},
-{0xAB0CB9E0DDE36A7, 1051},
-{0xAB1E6B4EBC52B34, 1215},
-{0xAB278CBD032E3DD, 261},
-{0xAB39FC48CE5C069, 651},
-{0xAB3D53DC46DDC34, 330},
-{0xAB590010A9D4C8D, 427},
-{0xAB66E7D5550F177, 603},
-{0xAB69D0EA8AC9B5A, 272},
-{0xAB7874DAF338459, 1178},
-{0xAB959F323124F53, 382},
-{0xABA3F027DA3CBBD, 959},
-{0xABA514E0B5ED01A, 333},
-{0xABAF276C9CFAE08, 440},
-{0xABC4DCC64CDE40A, 985},
-{0xABD07B4D827B90D, 473},
-{0xABE3E52F31DFA8E, 268},
-{0xABE53A92D1D9897, 259},
-{0xABEF3439E862287, 1336},
-{0xABF41B07D37F67E, 783},
-{0xABFD6E2497FB4DF, 3945},
-{0xAC18E98B9C63E42, 606},
-{0xAC36C782DD68C49, 283},
-{0xAC555995E80430D, 401},
-{0xAC6AA578B9462DD, 229},
-{0xAC70E4C65CCE3F7, 430},
-{0xAC75D63E346B8F1, 1050},
-{0xAC85B2CF39E03B5, 202},
-{0xAC993F0377D5FF1, 723},
-{0xACAF3E3C1276B34, 431},
-{0xACB81EA6BE9D039, 1360},
-{0xACBD53C41E1B80B, 600},
-{0xACC8123DB7746D1, 257},
-{0xACDE96D3EAE2F4B, 263},
-{0xACFC2502D2D554D, 261},
-{0xAD2107325CBE122, 213},
-{0xAD2B510D48CF85C, 454},
-{0xAD3D462DCDFF601, 2098},
-{0xAD53856C27C33BE, 794},
-{0xAD72A4414800222, 484},
-{0xAD7A1A9CEE37CAC, 302},
-{0xAD7AFFD440DBC3E, 385},
-{0xAD8BEC519CD8A23, 998},
-{0xAD93FCD53F74503, 204},
-{0xAD9860C12944C40, 635},
-{0xAD9B153B60ADAFF, 6055},
-{0xADB87486E137A08, 647},
-{0xADBAFD4403EDF93, 309},
-{0xADC56445EF99C84, 341},
-{0xADCB38942C2A8C2, 23536},
-{0xADDDDB6A795785B, 450},
-{0xADDEE81894F2D86, 495},
-{0xADE2A9E1AA0CF2E, 246},
-{0xADF0010CAC04C95, 1933},
-{0xADF6023EC2CC6B6, 245},
-{0xADF691D7C0B331D, 417},
-{0xAE091FC35F394A3, 685},
-{0xAE20055D730CE33, 433},
-{0xAE296308B54EF1F, 242},
-{0xAE309DA763FDD9C, 232},
-{0xAE30A4F7E66F642, 251},
-{0xAE394C8A4100661, 371},
-{0xAE4E081F9BD6F3F, 802},
-{0xAE5EFA1A1E6888D, 445},
-{0xAE657ED782D3B52, 213},
-{0xAEA065079742A12, 216},
-{0xAEA34DD5B8001AC, 380},
-{0xAEA5DE1773ECE0E, 264},
-{0xAEB2223BFD781CE, 373},
-{0xAEB559BA9A3D8D7, 243},
-{0xAEB55BFAEFA456C, 203},
-{0xAECAF654B26C8CC, 213},
-{0xAEE0954104E367A, 1095},
-{0xAEE5900E494CF56, 284},
-{0xAEEE95C002249B3, 834},
-{0xAEF1E87CE8AD95F, 2289},
-{0xAEFB233466C881C, 2379},
-{0xAF089F16A6DB753, 247},
-{0xAF0C7A84222C969, 229},
-{0xAF0F43ACC4CCCB1, 507},
-{0xAF2A97EFB5D14EC, 270},
-{0xAF4EA69D88C24BD, 425},
-{0xAF513A07D8CAB6F, 3783},
-{0xAF688FB1C31E2E2, 262},
-{0xAF817CDBFAC4D44, 393},
-{0xAF9A94E580FDB0E, 632},
-{0xAFA016E20D10E7F, 507},
-{0xAFA26F9E29274C9, 564},
-{0xAFADEA2584FEDF5, 338},
-{0xAFB839E4B4F73B1, 507},
-{0xAFCF914C4C0093A, 358},
-{0xAFF8B2DD54C4318, 205},
-{0xB007F3F55F2C380, 401},
-{0xB012FB168D7BCAB, 238},
-{0xB02084D756A2F21, 404},
-{0xB02D1B8ABC73FBE, 218},
-{0xB04B725D9328FB5, 414},
-{0xB067228E2ECF276, 208},
-{0xB0690458DDA5793, 236},
-{0xB08120C2F0C4951, 823},
-{0xB0A105E9F8832F4, 216},
-{0xB0AA4F2A114D51E, 212},
-{0xB0B39F4C531D64F, 1924},
-{0xB0C3C29ADDD8EFC, 4036},
-{0xB0CC1205193D462, 449},
-{0xB0CECEBEC5B8CC4, 490},
-{0xB0D1CC60F8A300B, 236},
-{0xB0DCF619E2DFDF7, 299},
-{0xB0F18F711B5A2E4, 365},
-{0xB0F2D2D325B8C4D, 230},
-{0xB10A6B84F9AD0E1, 212},
-{0xB10E30E47D2BA88, 346},
-{0xB110EE5F3BFC669, 967},
-{0xB1138DE456253EC, 286},
-{0xB129590088B40C3, 2610},
-{0xB133E77C7C3CC03, 237},
-{0xB134EE1004E70BB, 366},
-{0xB13FF777B0B68B5, 697},
-{0xB143AD2FD109719, 487},
-{0xB1445F65D072484, 201},
-{0xB147505AECD8A8D, 4591},
-{0xB16A1F6AAB619A9, 3463},
-{0xB17CB44C58FEF25, 1169},
-{0xB17F8CE5E7326BF, 338},
-{0xB189DAE04BE6261, 395},
-{0xB1C15F6BDA41193, 295},
-{0xB1CAED69355A064, 222},
-{0xB1CF265192567C7, 395},
-{0xB20D291EA11D3AA, 201},
-{0xB2189CB3810D333, 599},
-{0xB21D6B006D36A3C, 582},
-{0xB22D636A05E446A, 573},
-{0xB23725059E6E15D, 1038},
-{0xB23C5148A70029A, 286},
-{0xB2479190773F2B7, 228},
-{0xB24FAC6479C78A7, 1790},
-{0xB2598CCD6B5C4C7, 237},
-{0xB29458DB282C851, 260},
-{0xB29C7787FB18C1D, 615},
-{0xB2C53D6D49D6150, 265},
-{0xB2CB03A68E8AB61, 5592},
-{0xB2CB91A89CFD419, 577},
-{0xB2D5B3064ED60EA, 437},
-{0xB2E5F08BC1BE62B, 376},
-{0xB2EB618749E709C, 889},
-{0xB2EC9AD225CE89B, 227},
-{0xB2F1067F127BDA3, 229},
-{0xB2F2F7AC8C23DD7, 200},
-{0xB2F618FB7727D99, 799},
-{0xB34E0B95948D94D, 1652},
-{0xB35149921E67FD1, 502},
-{0xB3524C9B3B4C776, 625},
-{0xB35994DE3EFF664, 220},
-{0xB35A37A34ACDB89, 479},
-{0xB35C8B98E24FB29, 1893},
-{0xB3606087F84F3BC, 480},
-{0xB36F176C7B83C6A, 449},
-{0xB37426BF8DBB717, 600},
-{0xB3870138894EFFD, 1724},
-{0xB38D6B2085852AC, 1054},
-{0xB39FE518DFF1C33, 239},
-{0xB39FF8DACE76B60, 477},
-{0xB3A184EBCB1FA22, 1667},
-{0xB3A3A64BC63CDA0, 250},
-{0xB3A9B90CAD83D4E, 208},
-{0xB3D9BA2CBCDC509, 216},
-{0xB3DBD06B0EF45F0, 236},
-{0xB3DBE20C3C2092D, 523},
-{0xB3DCA845FDEAB73, 353},
-{0xB3DFEF7CCB88778, 238},
-{0xB3E2DB6C14F174B, 247},
-{0xB3F6801FAA6F2BD, 400},
-{0xB4024CC27CA5AC1, 237},
-{0xB4384C3C7751EDB, 460},
-{0xB4460DCBA92D209, 265},
-{0xB44CFCF1B528ED3, 235},
-{0xB456FF8AA3252E8, 442},
-{0xB46E3EBA99C16A4, 965},
-{0xB47A010C567E6DA, 641},
-{0xB488BA509F7529C, 469},
-{0xB49789CE23A2387, 204},
-{0xB4998195208542F, 219},
-{0xB4B20E88C6A07B7, 4499},
-{0xB4B7425CA879C8B, 726},
-{0xB4CCB21CF72A846, 586},
-{0xB4E0291F641616A, 350},
-{0xB4EE16CA4E7B19C, 679},
-{0xB4F8995F30A9631, 2906},
-{0xB4FE0BDF3EFC32A, 314},
-{0xB50C45139CD8435, 30824},
-{0xB54AEBAA167F26C, 298},
-{0xB56732372AE9369, 342},
-{0xB56DE82DB908461, 9410},
-{0xB56F9CE538864AB, 258},
-{0xB57466180A0182A, 232},
-{0xB57D74E41C548DC, 237},
-{0xB5C4F76A85CE497, 282},
-{0xB5C54227D14B772, 301},
-{0xB5E0787AF1E159C, 227},
-{0xB5E5AD4E922EAB8, 344},
-{0xB5EE5B2035F4C39, 927},
-{0xB6076AB830A968E, 539},
-{0xB60E1BA5B721820, 311},
-{0xB61795FB86E5449, 255},
-{0xB6297302E6ED658, 1304},
-{0xB6315FCDAD4A1C9, 13868},
-{0xB63551BB4A7A9E3, 933},
-{0xB640F35E1E49E5C, 1026},
-{0xB649764D0D2FDA9, 229},
-{0xB6635052B88DBA9, 648},
-{0xB67967AA6DF8257, 205},
-{0xB6824A83A9C579E, 220},
-{0xB6B4E54502F9BE1, 241},
-{0xB6C9AF7AAE2AF66, 1455},
-{0xB6CD7DF7C739708, 367},
-{0xB6D2997DD754807, 238},
-{0xB6F5788C45628E6, 393},
-{0xB6FBE6602015B74, 229},
-{0xB7057E7A9BB6521, 278},
-{0xB716F21BCD070CA, 358},
-{0xB71E270E8865A1E, 329},
-{0xB72A3FEE23E3E3A, 1751},
-{0xB74EAA9D26B3534, 839},
-{0xB78309598D8D487, 375},
-{0xB7A1D68EA0A1B63, 326},
-{0xB7AA739FE222308, 1573},
-{0xB7AE2C94A78E38E, 361},
-{0xB7B0170EE779BC5, 792},
-{0xB7BBEC8BEB7F682, 2859},
-{0xB7CA5BEDC39AED8, 397},
-{0xB7CAF55AD947EF3, 265},
-{0xB7D827CB1D44824, 370},
-{0xB7E135C63D2A5FE, 251},
-{0xB7EF7F947B112E6, 811},
-{0xB7FEAE4D069C72F, 2695},
-{0xB8081FFE2C73704, 453},
-{0xB80E49E37E4193A, 333},
-{0xB815F9FA76AF5BD, 209},
-{0xB8167798F28B334, 220},
-{0xB829BC487D6B1C2, 443},
-{0xB83C5789E469C27, 255},
-{0xB856E7D69B6F56E, 19304},
-{0xB85DCC44DCF643C, 270},
-{0xB862A517D79A9BD, 203},
-{0xB872F92B016D8F7, 796},
-{0xB8740C1B23470DE, 720},
-{0xB8758D20610CD85, 296},
-{0xB87B0F0A096968F, 253},
-{0xB8B3696B96DA38C, 1101},
-{0xB8DD7C619119372, 299},
-{0xB8E04E2D5F0D186, 722},
-{0xB8ED2CC15D2F0DC, 500},
-{0xB908CDDC915FD53, 535},
-{0xB93DD1A98037376, 1226},
-{0xB9403E75138CC8A, 371},
-{0xB96688F20CC5094, 879},
-{0xB969CD20B9509B1, 213},
-{0xB9823D905E21E62, 3964},
-{0xB9B0AA42079FBC9, 229},
-{0xB9B70A9AEDB15A2, 260},
-{0xB9B7A122082E1DF, 6103},
-{0xB9E9EABFCDF9B3E, 717},
-{0xB9F1508CB8B6947, 469},
-{0xB9F278442D21D49, 312},
-{0xB9F67684A2C964B, 898},
-{0xB9FC40979A26723, 252},
-{0xBA0D60AB12AADEE, 1225},
-{0xBA0EC58328DF937, 3021},
-{0xBA1824AA543E583, 5452},
-{0xBA29BFA50793C21, 211},
-{0xBA3715AD330171C, 539},
-{0xBA3A29800B93D86, 370},
-{0xBA4134203F58B02, 363},
-{0xBA49AE4C012FC3E, 342},
-{0xBA63FC24E3D3390, 447},
-{0xBA71452039CEFF6, 223},
-{0xBA8C13B5289F90A, 549},
-{0xBA8DA27F8828FCD, 352},
-{0xBA95456EBB1453A, 252},
-{0xBAE51FD5AE7CE6B, 979},
-{0xBB07D386CD779F0, 265},
-{0xBB1F4B6739E1709, 876},
-{0xBB1F5D2925E4696, 221},
-{0xBB23391CB745378, 443},
-{0xBB28472B62476AF, 231},
-{0xBB295C701F019E7, 381},
-{0xBB50096AEB42A72, 249},
-{0xBB5126DCD232214, 235},
-{0xBB6048F3ABA1E8E, 249},
-{0xBB8190F9C5F406F, 393},
-{0xBB87F74578ECAC9, 237},
-{0xBBC2BB60AC2C477, 200},
-{0xBBCD2A37128ECB0, 727},
-{0xBBD68E114624891, 1186},
-{0xBBDDC3C6253D134, 300},
-{0xBBF48A862A85DF5, 464},
-{0xBC09F7A8C93D73D, 230},
-{0xBC0E01DDD46AE84, 1085},
-{0xBC0ED27138069AE, 419},
-{0xBC167BF11F2D9FE, 2147},
-{0xBC40071CD8CCFEA, 1136},
-{0xBC40AF96C4C1753, 829},
-{0xBC40DE3396DADBD, 603},
-{0xBC615964773EC17, 254},
-{0xBC69700B0F23667, 1102},
-{0xBC8AB78C301BC90, 360},
-{0xBC8DF865B7DDCD2, 225},
-{0xBCB42984A5062B4, 649},
-{0xBCBA8674690A45C, 372},
-{0xBCC9945CCD9AE13, 289},
-{0xBCF0D5481D2C2E3, 367},
-{0xBCF9A05E9E3EECE, 372},
-{0xBD2490E77B17E1E, 231},
-{0xBD266D6B4C12D30, 255},
-{0xBD3F4A9603476FE, 2372},
-{0xBD4671D520C6781, 223},
-{0xBD5ADD6659874DE, 1067},
-{0xBD6BBD17C205CD0, 317},
-{0xBD6D19D5B44F0D3, 501},
-{0xBD7E9FE70A97E6F, 588},
-{0xBD8D1360C270D6B, 1510},
-{0xBD90F8759B3B6C1, 219},
-{0xBDBB96C19A6A2C5, 477},
-{0xBDF8E6984F2A44F, 248},
-{0xBE083DF7BFC75C4, 973},
-{0xBE117B41439F1F0, 566},
-{0xBE11DF8C146028A, 405},
-{0xBE128E7E2B0CD63, 766},
-{0xBE13F550E83F6C8, 1006},
-{0xBE1C01FC3CA57A6, 202},
-{0xBE1DD81BEEF017A, 334},
-{0xBE228B663BF845C, 266},
-{0xBE2A9726CA4F3AC, 469},
-{0xBE2FDDEE714C8A9, 1580},
-{0xBE34FBAFE95236D, 1853},
-{0xBE38C2976FB89AC, 256},
-{0xBE53052737A59D0, 1193},
-{0xBE6BFCAFB107E5E, 451},
-{0xBE6D2C457DBB397, 256},
-{0xBE727326B91A6E2, 218},
-{0xBEB7DF71FDED8C5, 230},
-{0xBEC5E65AE5FD372, 834},
-{0xBED6B189CA4C455, 1015},
-{0xBEEF1D381411FD4, 3044},
-{0xBEF50987CCA1975, 244},
-{0xBEFF669EE9780F4, 983},
-{0xBF046BC584D2A70, 377},
-{0xBF18BF8EE4F18DB, 687},
-{0xBF1EE2D2C09BC31, 2100},
-{0xBF32180BDC33BB5, 1307},
-{0xBF34E18DE1E17DB, 13423},
-{0xBF3D6ED15E40F3E, 354},
-{0xBF5BF6585B61A55, 1249},
-{0xBF6658A8DD7710E, 2053},
-{0xBF89BCE5B8D6F7B, 577},
-{0xBF8BFBC4F666A69, 271},
-{0xBF908D3CB83C3CC, 841},
-{0xBF9253138113614, 2088},
-{0xBFBC49E64D3E68C, 382},
-{0xBFC58296BC9BBA2, 1892},
-{0xBFC6C0584457BF9, 213},
-{0xBFCD1DD77B48FD8, 1850},
-{0xBFD8C530DC3CE84, 335},
-{0xBFDA2BE36587AD2, 2778},
-{0xBFECFDBA0B2554D, 6455},
-{0xBFFF897AA0BC02F, 234},
-{0xC0482CF47C3FE4C, 5346},
-{0xC06EFE8CA1E9834, 416},
-{0xC06F13C79BDE607, 215},
-{0xC097E557BFB3913, 366},
-{0xC0AA4B130B7B85F, 234},
-{0xC0B373B1255119D, 265},
-{0xC0BB5EA42467F12, 206},
-{0xC0BF344060A19DE, 499},
-{0xC0C5A80A23F0007, 440},
-{0xC0C6E450666B3B6, 484},
-{0xC0C81B38268D21D, 395},
-{0xC0CF15288256EC7, 381},
-{0xC0D3B5B0FA28149, 586},
-{0xC0D59BD7F93BCF1, 452},
-{0xC0E0BF38494A37C, 1204},
-{0xC0E9DA14D4780F7, 574},
-{0xC10F1F29988FC88, 316},
-{0xC1180F504702E2F, 595},
-{0xC11FE10F2C200E5, 6630},
-{0xC122D66D9B889D9, 341},
-{0xC1455A155FEE90C, 214},
-{0xC14D2FD5A75E7D4, 1646},
-{0xC1526EBA8D6606B, 256},
-{0xC1603157DEDA90E, 352},
-{0xC1647299DFB1A2D, 397},
-{0xC17D36B064EEA50, 220},
-{0xC192D89616607F1, 2948},
-{0xC199C4043728E39, 236},
-{0xC19F9531D09B20D, 264},
-{0xC1C89CF277933EC, 1974},
-{0xC1FD754D1E87AD3, 1197},
-{0xC210065AD61A21C, 428},
-{0xC22B9315CF7224F, 1028},
-{0xC23108FAA3C3F1E, 2980},
-{0xC24E065045CADDD, 1404},
-{0xC24FF3B8452BC3A, 456},
-{0xC26CA49502D63B9, 431},
-{0xC26E0EF1D2CA642, 1723},
-{0xC27009EEC41939E, 426},
-{0xC270DCAEEF2F68F, 212},
-{0xC2801B5EAA6B3A1, 230},
-{0xC2835DA81889D8A, 232},
-{0xC28A4B8BD866653, 1549},
-{0xC28ACEE2BD7E5D4, 3415},
-{0xC296125994673C5, 696},
-{0xC2CBF78223A0A1A, 369},
-{0xC2D264FF7218A3E, 455},
-{0xC2DA10A72210F00, 333},
-{0xC2F7FB3AAC34133, 219},
-{0xC2FA7685B8D82B6, 1278},
-{0xC2FEF2B24B44556, 2944},
-{0xC30A1449E500524, 364},
-{0xC32A331EECF0EB5, 1780},
-{0xC33E0D1E53C1880, 2100},
-{0xC34615BCC566EBD, 246},
-{0xC34F1A485FB27AC, 544},
-{0xC3577DFD290E494, 231},
-{0xC35FE736B29D42C, 494},
-{0xC36A80D372AEF50, 8153},
-{0xC3713D7F67C6CA9, 211},
-{0xC380696D547F261, 681},
-{0xC3BDC89F7893AB7, 201},
-{0xC4004E1BD15C3ED, 626},
-{0xC411C7490F2E6C1, 263},
-{0xC4458A0EA55B97F, 235},
-{0xC44661EC61106C9, 335},
-{0xC44B585CB0E1C66, 262},
-{0xC451E21396DA694, 330},
-{0xC4521E69E948995, 1834},
-{0xC45302FCE4998CE, 757},
-{0xC45335EF05A56EC, 233},
-{0xC45919D60C10F73, 606},
-{0xC473E6BEA99BEC5, 835},
-{0xC477ACBC3505061, 212},
-{0xC47AC3AFA76B878, 240},
-{0xC4822D7AC2F0682, 330},
-{0xC4860D96D5921FA, 383},
-{0xC4A315BA7340D42, 2353},
-{0xC4BBC7A12234D36, 376},
-{0xC4BED1FAF133617, 345},
-{0xC4C6BC84F3DB68A, 223},
-{0xC4E6E5EEF0EB952, 640},
-{0xC4E82B961CE78BC, 239},
-{0xC4E97CC15BE6A91, 963},
-{0xC4ED0E46C6EC6C8, 604},
-{0xC4F63C656AD4AE4, 227},
-{0xC4F704349FECF73, 618},
-{0xC4FA25F1CAADAD1, 251},
-{0xC4FFE0134AAD6D3, 767},
-{0xC511938AE0DE860, 227},
-{0xC51802C16B015AA, 806},
-{0xC5187155FE367F4, 203},
-{0xC55122E85BF173C, 598},
-{0xC567CE8CD9000C1, 479},
-{0xC57997BE48BB1F0, 355},
-{0xC5799E5345A4615, 325},
-{0xC5831A756033241, 224},
-{0xC584162EAA8662F, 986},
-{0xC589041F5AA7C9F, 231},
-{0xC58F3F0E50B0341, 213},
-{0xC59507F475378FD, 2418},
-{0xC5F2F6D91A7DD89, 272},
-{0xC620CE9E95CBC4C, 310},
-{0xC6249B710000D8C, 1006},
-{0xC63A2363E2EA187, 262},
-{0xC64A5AE54836FD9, 444},
-{0xC651212E5FAE94F, 207},
-{0xC6610D8DC710F13, 276},
-{0xC67998CFC28B444, 767},
-{0xC68CDA34C6C44A4, 236},
-{0xC6A7C21E1AA2433, 399},
-{0xC6B0D9AC85FB17F, 228},
-{0xC6B3285C3492542, 302},
-{0xC6CF531A8F83ACD, 255},
-{0xC6DFDAE26AD3F8A, 2449},
-{0xC6FC485871A4BBB, 325},
-{0xC6FD34B84C4F36A, 246},
-{0xC717BB78B858B36, 261},
-{0xC71A599FE50EE61, 242},
-{0xC71BAB8577F43AC, 231},
-{0xC71C70F419B3EE3, 313},
-{0xC73B67FADE2672E, 1807},
-{0xC75045FDD0EF39A, 441},
-{0xC785A351983C558, 363},
-{0xC798204AD1174C2, 944},
-{0xC7A1A5DEA9FDFCE, 214},
-{0xC7A7FCD1C02EAA7, 201},
-{0xC7AF8F5F0CA7509, 953},
-{0xC7B0C25ADFD6A88, 350},
-{0xC7C18724F8072F5, 1192},
-{0xC7C62905E941F5A, 667},
-{0xC7CF55FBD6E8B8F, 289},
-{0xC7E2AFED8C8FD60, 1126},
-{0xC7FCA802678A140, 257},
-{0xC80B8384692A448, 289},
-{0xC818049D363525D, 2236},
-{0xC81E9F64E5F3568, 2471},
-{0xC8263A8350B09ED, 248},
-{0xC82C469D5208EA3, 301},
-{0xC83F8A466A2A4E3, 235},
-{0xC84E45403F57D86, 563},
-{0xC87149E29374F13, 211},
-{0xC88932E2E829F29, 11901},
-{0xC8934C59E2241DC, 1376},
-{0xC8A690151418DC9, 218},
-{0xC8AC31553C0B944, 321},
-{0xC8C5F0387B26C7F, 205},
-{0xC8CB79FAE469D29, 282},
-{0xC8D7A87F3B77FB4, 560},
-{0xC8E9B05D54140C5, 259},
-{0xC8EE3C92458953B, 882},
-{0xC8FA1919CC994B9, 527},
-{0xC9178E2BAE3AE9C, 307},
-{0xC93202C52E55A13, 262},
-{0xC94281507E6AA9F, 280},
-{0xC9585D0E3868A00, 799},
-{0xC95EFC0318A1EF4, 1374},
-{0xC976CF39F41D62C, 365},
-{0xC97AD43631AB0B3, 222},
-{0xC97ED35F228EEB9, 490},
-{0xC97F749A26009E9, 642},
-{0xC988DC90F7FAE0B, 4240},
-{0xC99BCA0F64E59F4, 201},
-{0xC9A7F9C8584DCAA, 978},
-{0xC9AC6D50C2C6C69, 238},
-{0xC9B34F7569EB74E, 225},
-{0xC9B6094D9BF38D1, 406},
-{0xC9BD53EF2961D41, 2141},
-{0xC9BF5DD51C46E3F, 316},
-{0xC9D116EE201AE65, 454},
-{0xC9E0806918809F0, 252},
-{0xCA0C08F88352DA9, 866},
-{0xCA1543B1D44BC86, 272},
-{0xCA158EAFC97660B, 321},
-{0xCA1D19983E2FDD3, 606},
-{0xCA1F6DA4782DF3D, 1100},
-{0xCA206B250BC3B7A, 293},
-{0xCA21FB8215D4335, 691},
-{0xCA3FC313A9265F4, 438},
-{0xCA5448F77D27754, 259},
-{0xCA5EBCD69F423FD, 274},
-{0xCA6CB0B6D552CE3, 201},
-{0xCA6CD62FB9CD4D4, 1231},
-{0xCA841881D0F5BD6, 980},
-{0xCA87FF841ED52A1, 569},
-{0xCAA3D0B76C8E6F3, 328},
-{0xCAB9986A51A33B9, 265},
-{0xCAD0B68EA989844, 214},
-{0xCAD7FAEEFCACAB9, 876},
-{0xCADA97BAE8EB19E, 1053},
-{0xCADB2A006E437A2, 302},
-{0xCAE0D1436414BA7, 5457},
-{0xCAE7DEBF27BFA32, 303},
-{0xCAEB130C9A44FA6, 1070},
-{0xCAFDFB20454DDD4, 322},
-{0xCB1CA944F02CC98, 380},
-{0xCB221B5A472133B, 683},
-{0xCB35BB1E75E9403, 752},
-{0xCB502A861A6B93F, 2048},
-{0xCB5037684CA1496, 265},
-{0xCB63FC424560570, 301},
-{0xCB64081BA625F50, 433},
-{0xCB67056F28FFAE9, 481},
-{0xCB68C72E1F3D011, 512},
-{0xCB7E05FBD8CB8D8, 459},
-{0xCBA2387F7FACE74, 586},
-{0xCBA76D4F9D8D362, 377},
-{0xCBAF3D9B0A8B393, 298},
-{0xCBC208E5479EFC4, 236},
-{0xCBCF0BE35B1BCDF, 471},
-{0xCC2FCA981628941, 222},
-{0xCC364F55CEBB256, 236},
-{0xCC368E5D6130C1E, 391},
-{0xCC3D5C920E0F75E, 306},
-{0xCC3D98FFB64D4A7, 203},
-{0xCC48D2C7ACEECE5, 874},
-{0xCC6AD1C116B69AB, 439},
-{0xCC82B3F09AD1C9C, 346},
-{0xCC856168C667384, 436},
-{0xCCB49F681A9453A, 240},
-{0xCCD5C2A9D86F9A4, 1317},
-{0xCCD63629F7E142C, 554},
-{0xCCF0FC89BE39FD0, 699},
-{0xCCFDD31FFF036C4, 32550},
-{0xCD060AAAC81EE97, 271},
-{0xCD08CDF523ED5B4, 2662},
-{0xCD1B9FF80F04936, 430},
-{0xCD3D164E9EB5493, 517},
-{0xCD442EEAFA90055, 651},
-{0xCD464BDE1BA6BEB, 504},
-{0xCD4A62B80201883, 207},
-{0xCD64E3B60EA68DA, 300},
-{0xCD683250EDD8439, 218},
-{0xCD96A3E75E11A0B, 201},
-{0xCDB4ED97CA6FC7D, 307},
-{0xCDB57113E9CBA43, 2223},
-{0xCDB8EDE6589867F, 208},
-{0xCDC5151FC6950D5, 786},
-{0xCDCC3D2D0BED813, 290},
-{0xCDD1214C21F9F31, 816},
-{0xCDD5F27028F2BD5, 1398},
-{0xCDD6D6AEC29F691, 470},
-{0xCDE6798D97D2A4D, 1507},
-{0xCDE9BE97B0160D3, 255},
-{0xCDFE96B0D5B3B0D, 349},
-{0xCE01511932A7380, 2355},
-{0xCE0717BD9A0A03C, 240},
-{0xCE3663D7587F830, 357},
-{0xCE68922BFE2E837, 2041},
-{0xCE73C6409596FAF, 637},
-{0xCE80C7013F6534A, 429},
-{0xCE82A981BA3A66F, 910},
-{0xCE881BE4440849E, 361},
-{0xCE8981FF9E4FD3B, 303},
-{0xCE92F4F9E1450EC, 215},
-{0xCE9A1D0DE89B40F, 721},
-{0xCE9EB872E7CAFF8, 1121},
-{0xCEAB4C1A3F71684, 1429},
-{0xCECE4E2FBC009C0, 1167},
-{0xCEDE8A5E099274E, 432},
-{0xCEE359AD1F3798B, 317},
-{0xCEE7D65929BF41B, 13607},
-{0xCEEB14A173B76C6, 3941},
-{0xCEF17890746403F, 1431},
-{0xCF07EF1606882B8, 270},
-{0xCF2FCF95017D2E2, 294},
-{0xCF470E61276AAE2, 203},
-{0xCF58FAC0E3E4F59, 374},
-{0xCF7A98FE39BD35D, 809},
-{0xCF9796EBA1B2C9C, 3886},
-{0xCFC877938680307, 317},
-{0xCFEF89E762D4FD3, 263},
-{0xCFF8AD85F0DB160, 774},
-{0xD01C04C2AA4290F, 208},
-{0xD03106523A7822A, 306},
-{0xD04440D8063E455, 258},
-{0xD0719211BFBEA14, 220},
-{0xD07F03D599B26E2, 232},
-{0xD082C252E93CD4A, 343},
-{0xD0921D232CAA5C5, 589},
-{0xD0A8EB64DFDEFED, 246},
-{0xD0B572D54541DB9, 379},
-{0xD0CB47F1FB8E1D0, 798},
-{0xD0CE11F6C4A4C19, 226},
-{0xD0CFE07606432F0, 381},
-{0xD0D26BFF711423A, 258},
-{0xD0D7B35C88D357A, 1938},
-{0xD0DB8AE16695EB2, 416},
-{0xD0E2CAD9114CA4B, 222},
-{0xD0EC6EC333219DD, 326},
-{0xD0FC35DAB21F068, 237},
-{0xD11ABB9463431F8, 13954},
-{0xD124AAF805D97F3, 223},
-{0xD13F80C11AFED11, 395},
-{0xD140F5F6019D2C8, 316},
-{0xD15C4E2169909EB, 250},
-{0xD179D32C4099A84, 291},
-{0xD188AAA79369B63, 234},
-{0xD199411FC35CACC, 275},
-{0xD1AB2216F4A81EB, 405},
-{0xD1ABEFA5154EB81, 346},
-{0xD1D4C6E2A7E77B4, 208},
-{0xD21194B266DE25E, 263},
-{0xD2148873512A82F, 265},
-{0xD214E03A6827714, 1925},
-{0xD214F646B1F55A7, 468},
-{0xD2252FDC7062893, 702},
-{0xD22E41EAA2502B8, 594},
-{0xD252C614E4B0C95, 425},
-{0xD254BF62120BCC4, 372},
-{0xD25A3A090C1C070, 263},
-{0xD268A530F8D117A, 293},
-{0xD270122E423231B, 336},
-{0xD2744F4A62B99EA, 259},
-{0xD2A44973C344D6B, 275},
-{0xD2B91EA12A8B018, 333},
-{0xD2DE5420171DFEE, 493},
-{0xD2F9E6122740061, 223},
-{0xD30BB8601BCB6ED, 395},
-{0xD314CB878B0C1AC, 262},
-{0xD32606CAA375F2B, 461},
-{0xD32B95FEECADA99, 230},
-{0xD32E4CAB215809A, 269},
-{0xD33291F6BCC6D33, 766},
-{0xD33F752F4DE4009, 1579},
-{0xD354DA9AA431146, 806},
-{0xD35CB7B465356CC, 738},
-{0xD36627A6E3925BE, 277},
-{0xD36E97592E4C8BD, 6325},
-{0xD36FC0E3523DC2E, 33211},
-{0xD381BD37A693C85, 295},
-{0xD382883D3816DF3, 239},
-{0xD3A3A55C242EB1D, 1667},
-{0xD3AB8B548FB67AA, 283},
-{0xD3ACB005B911CF3, 621},
-{0xD3BA99EFABFEFA3, 2405},
-{0xD3BF20041B064D5, 5726},
-{0xD3D7A69B1C2BDB5, 208},
-{0xD3EDF003B91B31C, 314},
-{0xD3F7E2176F7EC40, 356},
-{0xD4190653E80E9E2, 370},
-{0xD419F1FE7B102BC, 228},
-{0xD439D4D3C4B66A3, 1553},
-{0xD44BC290AAB6A7D, 286},
-{0xD4588A3199C62F2, 218},
-{0xD465F2016B2F0C3, 4578},
-{0xD47876DD36E64BE, 296},
-{0xD48395A16A5E947, 9256},
-{0xD4872B4116A93EB, 632},
-{0xD492FEE3507C032, 501},
-{0xD499CA011550DED, 1059},
-{0xD4A3FB9696FC2A4, 227},
-{0xD4A76A1C58E0346, 866},
-{0xD4C2CF3EAFACEA9, 339},
-{0xD4C317B8041FB69, 216},
-{0xD4CC0857604450C, 470},
-{0xD4CEC1DA7EAA33D, 335},
-{0xD4E0415231528F3, 402},
-{0xD4E09F288F33C50, 378},
-{0xD4E9538ACC2622A, 710},
-{0xD4EB917D715FC36, 249},
-{0xD4F058AC872934E, 308},
-{0xD4F3581A4D9408D, 1087},
-{0xD5116C4319C706B, 202},
-{0xD52361D6B26477A, 238},
-{0xD543892AD4E55A8, 394},
-{0xD58A095F46EBD1B, 205},
-{0xD58C34AF36714A3, 275},
-{0xD59E7221EA24996, 1684},
-{0xD5B218F41E93C30, 223},
-{0xD5CC02DFD7C7D6C, 248},
-{0xD5CC15FA38A667A, 852},
-{0xD5D95CD8B93D724, 327},
-{0xD5DD41F1D825113, 893},
-{0xD5E4C85C2FEF77F, 392},
-{0xD5E9459C6BA5EE3, 292},
-{0xD5EC0D8D05C2D9C, 268},
-{0xD5F1075F10F4F85, 965},
-{0xD5F26AAFF78C750, 228},
-{0xD5F89E103219D3E, 210},
-{0xD60BF8D27FE7241, 273},
-{0xD60C53F90ABA2F0, 326},
-{0xD61454735161D7C, 473},
-{0xD61DBFF86926860, 290},
-{0xD61EF975F64D7F2, 224},
-{0xD62CB70AFFAFDB0, 425},
-{0xD63C9FF759E92D4, 335},
-{0xD645855E765C014, 295},
-{0xD6710EEB04F12E8, 10277},
-{0xD6B96031ACC50EF, 243},
-{0xD6C73A30E33061F, 556},
-{0xD6CAF9049FBCA32, 302},
-{0xD6D70600177E3AC, 374},
-{0xD6FD396E3C3D459, 302},
-{0xD71481887DC6341, 303},
-{0xD734C1A7F1D06D8, 236},
-{0xD73EF3B420E8141, 2424},
-{0xD753EF724050AB0, 468},
-{0xD77B016262602B1, 393},
-{0xD795D07C9C46BD0, 408},
-{0xD7B193956C5FD48, 431},
-{0xD7B8698D1A786AA, 276},
-{0xD7BCC468EAE7E42, 274},
-{0xD7F20CD393D99C8, 258},
-{0xD82B38C59232F78, 450},
-{0xD82BF6C0BAE11FE, 353},
-{0xD83404A0194A358, 306},
-{0xD835A79094F2320, 225},
-{0xD83ED4195659AFE, 558},
-{0xD843909C7427FCC, 281},
-{0xD844FF48C67E016, 3994},
-{0xD86FD4EF89EAC56, 204},
-{0xD8709B0A7A2241F, 338},
-{0xD871356C36AB296, 1053},
-{0xD890779BA0F672B, 311},
-{0xD8916FAA828562C, 4990},
-{0xD89A866543260B1, 208},
-{0xD89FB4B2F006F11, 204},
-{0xD8AAA9A31835511, 209},
-{0xD8ABBF664D4C400, 483},
-{0xD8B662D6763B516, 226},
-{0xD8B6A49929C09D6, 5577},
-{0xD8BA9D5915BC9E3, 961},
-{0xD8DB9B80C888615, 211},
-{0xD8F5CA502489044, 504},
-{0xD91D18F715EE3C8, 1523},
-{0xD921DD924C9FA49, 538},
-{0xD92A461A11FAA36, 291},
-{0xD93F8D85AA1067F, 219},
-{0xD941C5A6C5E852E, 233},
-{0xD9447268CECC9DC, 257},
-{0xD97F5A5C66F8BDA, 707},
-{0xD9854AA9C33C59A, 316},
-{0xD9974BBA01E142D, 731},
-{0xD9A676170D4AA3C, 301},
-{0xD9B41BF2DBADDFB, 251},
-{0xD9DCDFDD8C0D0A7, 227},
-{0xD9F249D5E48DC5F, 373},
-{0xDA07D67964154ED, 230},
-{0xDA0E9C6219DEB70, 349},
-{0xDA1E152F982A5B7, 373},
-{0xDA68E3FBD6B56C5, 677},
-{0xDA70AF6D28B2E90, 6262},
-{0xDA721DE92246467, 506},
-{0xDA7690BE3F39C63, 279},
-{0xDAB21AEC312219A, 608},
-{0xDAC50A86B9940B2, 5739},
-{0xDAD51054D8226AA, 403},
-{0xDADDCBC98C7AE0B, 774},
-{0xDAF154269BF673C, 438},
-{0xDB32B994CD25170, 2896},
-{0xDB35A5048C59BC4, 342},
-{0xDB3C7758F368A6E, 710},
-{0xDB64E6D6BA5660F, 307},
-{0xDB8B493AEB68E8C, 9081},
-{0xDB99555364A22A3, 240},
-{0xDB99B984BCA2B4A, 228},
-{0xDB9FBD3B22A1727, 318},
-{0xDBA0A8E37AD4599, 285},
-{0xDBC60443A40E25F, 792},
-{0xDBC915FF46C0FAD, 222},
-{0xDBE169F0751130B, 888},
-{0xDBF747563C29B76, 222},
-{0xDC437F7669E4A99, 305},
-{0xDC5049D44CB2556, 713},
-{0xDC587F51E61498D, 6817},
-{0xDC6213246033534, 2425},
-{0xDC6875FC79FDDEF, 275},
-{0xDC9B15162ED5859, 218},
-{0xDCA150E815AE218, 371},
-{0xDCB92EA5D1C701F, 245},
-{0xDCBF41FB53955B7, 205},
-{0xDCDC69418491591, 366},
-{0xDCEAD2D57E73FD7, 680},
-{0xDD152300708C83E, 343},
-{0xDD39D7713E54DDB, 452},
-{0xDD3FFA33ACE2109, 238},
-{0xDD40CE7CFB57C27, 323},
-{0xDD42CCDB86ED230, 289},
-{0xDD4FB8F9143FC94, 284},
-{0xDD5DE214CFBC4DB, 1685},
-{0xDD69E36602338A2, 278},
-{0xDD7A3EE6951185C, 246},
-{0xDD81637A4C57FD9, 482},
-{0xDDB4D53D5B4D1F4, 596},
-{0xDDD4B2092C01C12, 292},
-{0xDDDFBC3906C8B6A, 793},
-{0xDDE76B35B5AE32D, 582},
-{0xDE03EAF49E74BA2, 750},
-{0xDE08A6442764249, 209},
-{0xDE18ED484B4BBF6, 473},
-{0xDE29F5BED9CB362, 496},
-{0xDE3D53E1942E9BF, 376},
-{0xDE5F8EB864B9A7F, 208},
-{0xDE7AF77BAACA1C6, 322},
-{0xDE8E8C6733663BD, 366},
-{0xDE976E844F86F86, 575},
-{0xDE9FAF1059B3C07, 561},
-{0xDEA122283B0C9AE, 205},
-{0xDEA6D4DAD95AEB7, 280},
-{0xDEC4F219F7F1291, 376},
-{0xDEC6956AD0A8408, 540},
-{0xDED0A4CB34AE9EC, 210},
-{0xDEF466BA88619D6, 326},
-{0xDF0D0A653CC6093, 209},
-{0xDF110D85B96962A, 1042},
-{0xDF1324A7A333BB6, 402},
-{0xDF35F91B339958F, 241},
-{0xDF38DB3072F4A83, 228},
-{0xDF5CC6C57C6A342, 323},
-{0xDF7CF3EFA1AE22B, 321},
-{0xDF801C4BAA12F95, 746},
-{0xDF8FD24AA04E9A8, 266},
-{0xDF915AAAA32247D, 868},
-{0xDFB9C380B2946D8, 255},
-{0xDFC5FA78C4E1132, 7689},
-{0xDFC808872DFA510, 276},
-{0xDFDA7C696B37B0F, 384},
-{0xDFF95C0BF9D6961, 707},
-{0xE015FA18CE74AA8, 664},
-{0xE0171A905EC9DC2, 270},
-{0xE019D9DDA12570C, 239},
-{0xE022CD546C37BD8, 737},
-{0xE06C203094936EC, 274},
-{0xE07134657B3B37E, 338},
-{0xE07B56B7D630F94, 214},
-{0xE082A3323B37CFA, 559},
-{0xE09275C5B2F5D87, 303},
-{0xE0AAB490F920011, 236},
-{0xE1010B37B6BCA50, 235},
-{0xE1216DC77175FF7, 253},
-{0xE14121163BF8CD7, 1252},
-{0xE1481B9BEFF328E, 389},
-{0xE14FA645E839078, 218},
-{0xE166AEE0713DF76, 292},
-{0xE17AAFF9185D8E1, 255},
-{0xE17E94700B4577B, 249},
-{0xE1A99F7B2705C04, 558},
-{0xE1C7A7AB32E85F7, 331},
-{0xE1D659DC9B48B0E, 259},
-{0xE1EED0B0FB75200, 2142},
-{0xE214477B4699EFB, 8559},
-{0xE2342312D908F87, 246},
-{0xE24D39B0116EFDD, 377},
-{0xE25C76FAE271FE1, 388},
-{0xE26A4EF41D86E54, 235},
-{0xE2853DD9D6ADDE7, 254},
-{0xE286AE2617A5580, 277},
-{0xE2ADB83E9AD1AC7, 243},
-{0xE2B1AEA095632A5, 809},
-{0xE2BEAE28B797564, 457},
-{0xE307C8407E05F06, 276},
-{0xE3317D4CA609031, 219},
-{0xE33246963EB4CF7, 208},
-{0xE33C93B025E9CE4, 2131},
-{0xE35B482AAE5D758, 400},
-{0xE36820DB4901BCD, 642},
-{0xE379666BF01BD2B, 263},
-{0xE398A9741AEDEBD, 4250},
-{0xE3A01CB74F81AFC, 307},
-{0xE3A77DC2114BA82, 239},
-{0xE3B7F5B9F7BE9E4, 763},
-{0xE3B81A238B62DB7, 386},
-{0xE3D2576F1B1C0AE, 1173},
-{0xE42F71E9263D1E7, 311},
-{0xE44BB285DA4A693, 236},
-{0xE454973DFCB3CC4, 3205},
-{0xE4648D672A7BFC2, 763},
-{0xE487BDB13CA657E, 510},
-{0xE491500C4A1A778, 265},
-{0xE49E5B535E43CE8, 480},
-{0xE4C38413B12F010, 236},
-{0xE4C5F15DF7015A8, 200},
-{0xE4E1B686ACE05EB, 365},
-{0xE4EA75BDB198A23, 223},
-{0xE4FBD4F44144025, 294},
-{0xE5052043F577397, 255},
-{0xE51D14FFA8B20D6, 288},
-{0xE52530648AF547B, 207},
-{0xE53193AC51F7ED6, 327},
-{0xE53228551FBA3E9, 1023},
-{0xE53B0A6DACF91DF, 518},
-{0xE5424FBF137E6C1, 972},
-{0xE55638996EE3A3C, 204},
-{0xE55B8A10D304908, 220},
-{0xE565B9A2B6F899F, 774},
-{0xE5739705E74E193, 2098},
-{0xE5772A2EC8F9D52, 723},
-{0xE589B8E04A1BB9E, 417},
-{0xE595CA93196D70C, 228},
-{0xE59FB162A23165D, 288},
-{0xE5A17E4B5C11563, 203},
-{0xE5A5BC66F1E8E0F, 222},
-{0xE5A71EADAC00E4D, 216},
-{0xE5AA8A69DC33AB2, 227},
-{0xE5B28795E1566BF, 364},
-{0xE5D69D6F476C6B1, 317},
-{0xE5DC817BF8C98A0, 5816},
-{0xE5ED91D610C1073, 365},
-{0xE61F0F9F9E5E620, 6479},
-{0xE62BAE4EF95FCDB, 206},
-{0xE62EA39D6E75721, 228},
-{0xE63D5FA5A7359EA, 217},
-{0xE6497FD7FE5A63B, 4409},
-{0xE658DCA118F132B, 4700},
-{0xE65CF7495F6E5B8, 930},
-{0xE661E99EE45E3D8, 290},
-{0xE662204A3B94974, 433},
-{0xE66DB9411DC3572, 1575},
-{0xE66F6EA55101605, 266},
-{0xE670F2F053489E5, 250},
-{0xE6732C87B184F9C, 370},
-{0xE67DADEE1DB8DA3, 211},
-{0xE6826637BD080EB, 236},
-{0xE6CB8175773C9AA, 368},
-{0xE6D2BC5A228BA13, 399},
-{0xE6DF0BDDE8CB0FB, 357},
-{0xE6F475767D060A8, 3467},
-{0xE70E5FF785F5D7B, 342},
-{0xE715ACF222631EA, 4719},
-{0xE73B36B7974CAA3, 341},
-{0xE7416EA0A757D8D, 551},
-{0xE75A535BF389410, 244},
-{0xE75CAC30D6F5752, 264},
-{0xE761357FD41C7A5, 333},
-{0xE772A6134B2EA6A, 242},
-{0xE783C585FD8789C, 302},
-{0xE79CA818408C16C, 730},
-{0xE7DD4F759AD0315, 579},
-{0xE7E50D32C45D26D, 417},
-{0xE7FA11338FAC311, 238},
-{0xE80D96E2B1648CB, 1078},
-{0xE8186F06E70E6CC, 1173},
-{0xE81A73EB1B33827, 419},
-{0xE83C9D8343816A0, 268},
-{0xE86A9E4DBAD15FD, 473},
-{0xE88C69D5464145C, 310},
-{0xE8986E2C2D8A0F9, 683},
-{0xE8A5CFC15E198AB, 202},
-{0xE8C7049B40696DB, 1910},
-{0xE8C87BBA661781E, 200},
-{0xE8DAEE0137ED525, 749},
-{0xE8E025961D92728, 226},
-{0xE8F07C7AE7C1417, 1000},
-{0xE8FA7D9FB15EC01, 323},
-{0xE91B5F400D3ABE4, 227},
-{0xE924C9A2417172A, 258},
-{0xE93A2C131C6D74D, 766},
-{0xE93AE707EDF9E05, 315},
-{0xE96062D9FA20337, 288},
-{0xE96CBEDEB1D8FA8, 726},
-{0xE97374D48589BEF, 2915},
-{0xE98074FD76D2707, 2032},
-{0xE9A286948AEC801, 221},
-{0xE9AA89650D8C88E, 9738},
-{0xE9BFE0572143304, 295},
-{0xE9C224518AEC449, 561},
-{0xE9D2050966E7F5A, 1021},
-{0xE9D3A1AC128D9B2, 970},
-{0xE9D7603AC0630AB, 2908},
-{0xE9DA08A5F68159A, 230},
-{0xE9E60189D4658AC, 602},
-{0xE9F427B0AA1EF03, 299},
-{0xE9F9701D9EDE201, 1282},
-{0xE9FCD045DEC8FF1, 2661},
-{0xEA29E476E679700, 240},
-{0xEA2BD404DD604E4, 337},
-{0xEA2C36FA4EBD11C, 1205},
-{0xEA36DC57DFC13EC, 262},
-{0xEA3F89CD11CA25E, 454},
-{0xEA471B55FDAE0A4, 259},
-{0xEA4D620F89DEB3E, 484},
-{0xEA598BA23540806, 1050},
-{0xEA66A4971C02B5E, 415},
-{0xEA687CB5D32A6D3, 534},
-{0xEA98DE494A22A67, 323},
-{0xEA9DBFB6ABFEE6B, 214},
-{0xEAA3CA4371EFC72, 292},
-{0xEAAEA29FAF63D0E, 589},
-{0xEACBDB13E318332, 347},
-{0xEADEEFD8BC521BD, 535},
-{0xEAE203EEAFC8E02, 437},
-{0xEAE48309A2944C1, 295},
-{0xEAE4F88A6D2ED10, 432},
-{0xEAE90E41DB630AC, 241},
-{0xEAF6F455EA1FB73, 272},
-{0xEAF780F2D312B1C, 546},
-{0xEAFF6C9AC7CB322, 479},
-{0xEB196FBF5899506, 418},
-{0xEB1A448E5CB0DE5, 670},
-{0xEB273E296BE3612, 457},
-{0xEB3578BAA9164FE, 1076},
-{0xEB4595B1F9351CA, 296},
-{0xEB4EC898F33D0CD, 520},
-{0xEB6895BEDE16CC3, 22548},
-{0xEB8F6E04A4EBD19, 712},
-{0xEB931ED76AB43EB, 232},
-{0xEBA831425E148C7, 235},
-{0xEBD379F2CD12166, 2250},
-{0xEBF8396C484224F, 472},
-{0xEC0EBF0AF2D8688, 2568},
-{0xEC1B3C35EBB3D60, 443},
-{0xEC1BD3AEEFBC604, 308},
-{0xEC2CEAD7BADBA77, 507},
-{0xEC353BFD2598636, 733},
-{0xEC357AECC2C955A, 854},
-{0xEC365499D9A53D8, 259},
-{0xEC3EDF986D60108, 441},
-{0xEC4779D940B822F, 933},
-{0xEC56B45DCE04363, 552},
-{0xEC630601052834E, 1581},
-{0xEC6D5CF557DC27B, 332},
-{0xECA6767ECE2247C, 520},
-{0xECB97B70A5912BB, 224},
-{0xECC3AD3DA5B9D1A, 212},
-{0xECCE40BE8148047, 284},
-{0xECD0EE28D92BBE7, 310},
-{0xECD95EE34A866BC, 1523},
-{0xECDF85546A8AA8E, 543},
-{0xECF29F436DEF92C, 454},
-{0xECFA1A9F95D7FD7, 435},
-{0xED14F3EDAF5BB19, 244},
-{0xED27BB8EB44B0FC, 276},
-{0xED2E020F644B77F, 525},
-{0xED303862C6C4C16, 226},
-{0xED33B844F9BD758, 1309},
-{0xED3BF6EF81179D9, 16337},
-{0xED415949920109D, 577},
-{0xED4E872D29E6972, 498},
-{0xED7DDA8693BB6AA, 630},
-{0xED87C1B4C65650D, 227},
-{0xEDCF1A6DF8A523B, 210},
-{0xEDF7566E094DAD6, 267},
-{0xEE11A4837C8AB52, 1037},
-{0xEE269DB68EF6889, 530},
-{0xEE3C2250A99167D, 402},
-{0xEE3C6C747ECF428, 258},
-{0xEE44426092232B9, 225},
-{0xEE6B5557EA1E4B9, 2568},
-{0xEE9308583CB12D9, 1427},
-{0xEEA7EF1A98DDF32, 203},
-{0xEEB662C30F07EB7, 777},
-{0xEEB7532A622CB93, 241},
-{0xEEBBEAAC6D06BEA, 527},
-{0xEEBFDAE303A3920, 332},
-{0xEEC6B71B1181168, 278},
-{0xEED70CD8751BD5F, 468},
-{0xEEE2BDECDCC0FD3, 222},
-{0xEEEC73A05916337, 212},
-{0xEEEDE55D67714CF, 2077},
-{0xEEF526EDB73C33C, 220},
-{0xEF0F95A3CDE0125, 223},
-{0xEF332FBC7759146, 219},
-{0xEF3F16F55AFE89B, 8935},
-{0xEF8E10365038D00, 225},
-{0xEF9193915499D63, 558},
-{0xEF944B5865D56EB, 707},
-{0xEF9CCDCC9F03364, 220},
-{0xEFA5BD9DB40FCC3, 609},
-{0xEFAFEE94A99923F, 346},
-{0xEFBF505CE955E14, 292},
-{0xEFC9BC1A1FE9764, 244},
-{0xEFCCFC35C7FCEE1, 565},
-{0xEFEC5E9192C2139, 232},
-{0xEFFBF025DD78905, 3626},
-{0xF0013E5BBA11586, 730},
-{0xF0129218B875797, 201},
-{0xF014068CEEDCBF5, 230},
-{0xF033EF7477D731D, 1614},
-{0xF050DAEB2A4FB14, 314},
-{0xF0579C71117A492, 468},
-{0xF072A3FB38D7BA7, 893},
-{0xF07FC17A2D438F2, 223},
-{0xF0959A36C6BA3BC, 369},
-{0xF09AE55DF6BAB34, 597},
-{0xF0A0D8AE78EB7F5, 377},
-{0xF0A3582144D3603, 236},
-{0xF0AAF6EBDE7F128, 232},
-{0xF0D313E8021040C, 286},
-{0xF0DA64AB16272D0, 784},
-{0xF0E1F5444E97130, 919},
-{0xF0F0BFE2DE7D273, 227},
-{0xF0F7AA7C90A1888, 1278},
-{0xF101FAE71291DE3, 817},
-{0xF10C0D7DEAF3A94, 539},
-{0xF1162770FFEA67A, 227},
-{0xF11F606983B9689, 220},
-{0xF11F8BAE0672E64, 238},
-{0xF13D6AA6B39B758, 317},
-{0xF1653B0E235FBF2, 338},
-{0xF17C5D46A51422D, 394},
-{0xF17EA70E75949B7, 303},
-{0xF18685343D59564, 597},
-{0xF18EF54F989FAE1, 400},
-{0xF19309E9034A3BD, 1089},
-{0xF1B8E421A375F93, 262},
-{0xF1C41623ADFB532, 203},
-{0xF1CCCDB0FD1B671, 228},
-{0xF1E245D6C0CD363, 323},
-{0xF1E6B11AC451F8D, 221},
-{0xF2057E19F628BD4, 910},
-{0xF20B2B1BB187501, 1475},
-{0xF210D9C4A981323, 542},
-{0xF21E15F4E740ED7, 810},
-{0xF234DDFDC1D05CE, 262},
-{0xF250EC544F4EEBC, 360},
-{0xF26A2987309A1EC, 323},
-{0xF26AAA301040B13, 276},
-{0xF27AC129CC03911, 514},
-{0xF28A73F2BB0C8B8, 617},
-{0xF28C7F397EE05E5, 259},
-{0xF290FB800554C9D, 300},
-{0xF2A3D8C0A0AC409, 236},
-{0xF2B8755947524E0, 242},
-{0xF2BE4BAD1F2DE4C, 443},
-{0xF2BF70C4B5CEDFD, 532},
-{0xF2CCD14243BF2B8, 318},
-{0xF2EF4FA55445C34, 1284},
-{0xF2FE6FE3CC76A06, 660},
-{0xF3500BEDFC6329C, 292},
-{0xF35F828174E53E8, 1774},
-{0xF3742ECB4794892, 212},
-{0xF38D3A5C99D1833, 838},
-{0xF394165D611E7D6, 1721},
-{0xF3D9E1B7B005944, 268},
-{0xF3F10E232BE6965, 206},
-{0xF408D4B1FDCDA4E, 262},
-{0xF42F0A77C69EEAB, 209},
-{0xF4421E2DEF0B3BA, 6900},
-{0xF4732DE135C4C36, 547},
-{0xF4A2236512DFFB4, 250},
-{0xF4D473B8EE46AF9, 1180},
-{0xF4E09E08DE0DA91, 224},
-{0xF4E673EFBE2AB16, 800},
-{0xF4F1B48D0176C58, 279},
-{0xF4FE4FD082D1FB0, 4410},
-{0xF52CA01B9B89B1F, 255},
-{0xF530CED307299AF, 222},
-{0xF5333FE96D3FD3C, 240},
-{0xF540DE50AED28DF, 248},
-{0xF56A2D0D196055A, 1196},
-{0xF581325122C493C, 270},
-{0xF588847BDEDC921, 16889},
-{0xF59500B0C3FB54E, 208},
-{0xF59B2320996F4CB, 323},
-{0xF5BBAB07031D8C5, 251},
-{0xF5C40F4DC1B76C9, 569},
-{0xF5D1E4AA5808722, 517},
-{0xF5D85EDD0C7989B, 205},
-{0xF5F8468973A5800, 625},
-{0xF60514B38CCE795, 330},
-{0xF6075189401BCC7, 220},
-{0xF61290726C4EF2E, 411},
-{0xF61705A98744218, 413},
-{0xF62629A683BA8E9, 234},
-{0xF62888105C64603, 483},
-{0xF63A905B0395D0E, 249},
-{0xF64178676EEC0EB, 251},
-{0xF642B6815536BE7, 979},
-{0xF64D72287DDB744, 329},
-{0xF655952E10B1D6D, 343},
-{0xF655C1A1648B972, 212},
-{0xF6579C7C3F0712D, 1334},
-{0xF65BBB4860AE651, 213},
-{0xF6854EF4F6E8CDE, 304},
-{0xF69D1C6801F3C34, 4321},
-{0xF6A5CC6B0AEE7B1, 1758},
-{0xF6AFFC093FC1049, 1156},
-{0xF6D9A215C41BED3, 359},
-{0xF6F667E9A02F250, 224},
-{0xF6F7158A30B65EC, 311},
-{0xF712B9F420E0D18, 1929},
-{0xF716C87FC6C9E7B, 1056},
-{0xF71EF694B2F401B, 250},
-{0xF72497C86E5C0BA, 325},
-{0xF732744FD74B91F, 231},
-{0xF7629A78B1689C0, 395},
-{0xF7974F5D4E416F4, 802},
-{0xF79B75D75891B6D, 428},
-{0xF7D172C7DA34F37, 333},
-{0xF7D26FF115679CE, 200},
-{0xF7DB03F11034E82, 296},
-{0xF7E9D53330A3824, 275},
-{0xF7F62517E2BD630, 499},
-{0xF8186F6F2FCD110, 202},
-{0xF81AA6C8F728DEC, 1007},
-{0xF832BF2344B325F, 2530},
-{0xF86836EB2ABBB3B, 310},
-{0xF8691F19C2FB599, 3477},
-{0xF87E4F3B0DBD029, 530},
-{0xF881E658D3206CE, 1382},
-{0xF8AE7D452A94296, 511},
-{0xF8C52F4BF84B709, 1092},
-{0xF8E7A735372B1A8, 290},
-{0xF8FD7A5469DB8CF, 278},
-{0xF9094443B238ACB, 4817},
-{0xF928049759988FE, 202},
-{0xF928AE092A39648, 1043},
-{0xF93DF41DCE5BC5F, 765},
-{0xF94AF97EE8297F9, 3332},
-{0xF94B2BECF650301, 609},
-{0xF94CE900B96ED3C, 266},
-{0xF95A47E651A3344, 1716},
-{0xF95B0B6FC6FB902, 264},
-{0xF98A8B34BB7ADBE, 16409},
-{0xF99814BAA928F62, 258},
-{0xF9D47095091ECA8, 234},
-{0xF9D94571638E63D, 1255},
-{0xF9EC7B6EBBBE2F3, 228},
-{0xFA0E113CA327A65, 603},
-{0xFA4DA0B33699E7D, 316},
-{0xFA5CAD324DFB8FB, 253},
-{0xFA611D36BB25541, 4106},
-{0xFA70C64444251C6, 340},
-{0xFA71110063B42BF, 212},
-{0xFA786D7D818FA22, 405},
-{0xFA969901EB5BD4B, 472},
-{0xFAA2DDF96811EA7, 215},
-{0xFAB4928420AFDEC, 246},
-{0xFACFEF21A11D26D, 333},
-{0xFAD287F8DCDCC3D, 226},
-{0xFADC7833FC5C476, 1178},
-{0xFADD5B7DCB9FFCF, 438},
-{0xFAE74DBED0970E6, 455},
-{0xFAEEA9D6666A131, 556},
-{0xFAF7DCDB98F2409, 6846},
-{0xFB0DEC06CD0C971, 691},
-{0xFB25468120DCA78, 230},
-{0xFB55A18A9377101, 305},
-{0xFB5EE1B29662EF2, 386},
-{0xFB662852E757443, 358},
-{0xFBA56E05D987FE7, 268},
-{0xFBB3304589F2874, 231},
-{0xFBDE5D2D2663FC3, 408},
-{0xFBE4287ED6175BF, 1038},
-{0xFBF8D2FE68C1304, 593},
-{0xFC04F2E4D127564, 389},
-{0xFC30A813551AD07, 305},
-{0xFC347EB42685DB7, 412},
-{0xFC3897DE832C235, 1891},
-{0xFC4A46E816B4F8F, 499},
-{0xFC5A3915D252E85, 1053},
-{0xFC72491216D0DBF, 269},
-{0xFC963CAAC398DFD, 430},
-{0xFC9E15788A69629, 380},
-{0xFCAC751894A53EA, 639},
-{0xFCBBD688CDD59DA, 229},
-{0xFCD40A4F9A71F8B, 234},
-{0xFCE2F79C8B8B066, 3226},
-{0xFCE69338EF4E187, 542},
-{0xFCF2F57FA654A08, 279},
-{0xFD2B92DD8AD8198, 329},
-{0xFD338D146D6338C, 708},
-{0xFD541068E5CF93D, 285},
-{0xFD5CE77747ACE47, 218},
-{0xFD627BFC6A94BB5, 349},
-{0xFD76EF775C0176B, 212},
-{0xFD78CF9E4854C3B, 244},
-{0xFDAB612DCFE5443, 538},
-{0xFDC5F59100FBAB6, 841},
-{0xFDD262BD473E39D, 251},
-{0xFDD5F201F0DC1E2, 822},
-{0xFDD67CCF06A9625, 332},
-{0xFDDE54AD2824727, 2626},
-{0xFDE45BC75CDEDCC, 212},
-{0xFDFC708377E2701, 271},
-{0xFE06AC39F90F137, 386},
-{0xFE0C1F95EC2B9EF, 773},
-{0xFE0CDE482425C21, 216},
-{0xFE26CE5FA60F4F8, 239},
-{0xFE2BBCAFF5B7855, 642},
-{0xFE5AF91FB55D8F9, 1447},
-{0xFE6923AC07EA05A, 934},
-{0xFE7B921FE7CEAE3, 353},
-{0xFE8430AF9D202EB, 214},
-{0xFE9CB112AF782E7, 216},
-{0xFEAAC97DCD6DFB8, 3863},
-{0xFEC06C1D3BFFCD0, 516},
-{0xFEC140DE0FEFAAC, 4345},
-{0xFEC561CB62B8FE2, 259},
-{0xFEFA1B3CD8EA99D, 264},
-{0xFF1D1BDE9B4C43A, 832},
-{0xFF1D500BBC10E63, 245},
-{0xFF1E3222BACC632, 447},
-{0xFF65B4BECAEAB8D, 986},
-{0xFFB8366E6412B85, 262},
-{0xFFDC0784F722FC8, 242},
-{0xFFDE74D4DB23D3D, 762},
-{0xFFE6BFC073BA771, 353},
-{0xFFF750A2343C01F, 7945},
-{0xFFFF21E9C6B4268, 213},
-{0x100004758085A360, 223},
-{0x1000112179BCABBD, 301},
-{0x1002231FD540DA92, 1379},
-{0x100292C75F494187, 203},
-{0x1002DA40D42E7E47, 1182},
-{0x100329B5B6B91564, 518},
-{0x1006013BDF2DFEF8, 200},
-{0x100647E9D0D34AA2, 17901},
-{0x1006A46109CD3B50, 278},
-{0x10083F7D0426C5A3, 577},
-{0x10098BFE79E29007, 395},
-{0x100CB18578398EAB, 202},
-{0x100CE26EF51B78E5, 248},
-{0x100D07DEB6E7657B, 229},
-{0x100EDC5F88F36216, 288},
-{0x100FD08780F90D5D, 263},
-{0x10112CE8F992DB37, 457},
-{0x10119A73E10A6D4C, 412},
-{0x1012B1F6B6161B42, 215},
-{0x1012F648BF324B41, 269},
-{0x101369446156F23C, 256},
-{0x10140CD227F7327C, 343},
-{0x10154E2F4602F752, 1444},
-{0x1015CD82C6D60D86, 218},
-{0x10164C57A08506DA, 4918},
-{0x10185F6801D3615C, 273},
-{0x10198C632078C730, 466},
-{0x101CCEB627DD226A, 351},
-{0x101D15824FD5A1B4, 239},
-{0x101D447DB1F8E543, 258},
-{0x101EFCBB72B1E41E, 237},
-{0x101FAC770F63D89F, 723},
-{0x101FC921F0C8FF2E, 335},
-{0x10208B34BF39CB1F, 354},
-{0x1021B29659722E86, 298},
-{0x10220FA78A8C79A5, 611},
-{0x10221AC3FA9D9870, 463},
-{0x10229BF01ED8E816, 306},
-{0x1023609BCF4774F8, 224},
-{0x1023A926EF6E1E35, 403},
-{0x10276D7A526E5A27, 987},
-{0x1028B99F1FFC48E4, 215},
-{0x102910A72E518AE9, 599},
-{0x102A21F6E8A6B0BE, 423},
-{0x102ABDF8BECD094F, 819},
-{0x102B0B0A633734ED, 851},
-{0x102CA2CF8E80F151, 352},
-{0x102CA63C154DB455, 1018},
-{0x102DA9FCA33874C4, 650},
-{0x102DDB3F35823574, 3254},
-{0x102E9D497C5D4BEB, 524},
-{0x102EC624D1FF7509, 232},
-{0x102EE2D3AF8F2DA6, 403},
-{0x1030417EDDAFEE4F, 538},
-{0x103344727BA8BE34, 257},
-{0x1033CA9AE7410F76, 5945},
-{0x103400227FE7A41A, 223},
-{0x1034C7019FFBCC09, 223},
-{0x103615B242B7C8AA, 548},
-{0x1036AF9EEAD64D0C, 2659},
-{0x1037D4931A5F8C36, 865},
-{0x1038D149E43AC16D, 553},
-{0x10392307CB143DD4, 696},
-{0x1039435015F3F8E4, 256},
-{0x103A06B5D25A00A1, 289},
-{0x103A31B6DC5E2AB0, 227},
-{0x103D1AEA7C8B67C6, 544},
-{0x104004C9F2F30137, 276},
-{0x1040B81DEC4219BE, 1465},
-{0x1041B7E92B0E9277, 346},
-{0x1044450989CAF516, 658},
-{0x1044B081CAD05159, 2297},
-{0x1045CD44983B4863, 217},
-{0x104773025D14CD14, 1010},
-{0x104915867CE74331, 1472},
-{0x1049879629816AF7, 642},
-{0x104C55EDD400E944, 749},
-{0x104C61CA5ADE1264, 224},
-{0x104FD677E8DD257E, 588},
-{0x105160C10EB16368, 223},
-{0x10530A439D59A4E1, 2319},
-{0x1054125548597E09, 355},
-{0x1055245F1675E466, 385},
-{0x105567D8C8116A8F, 17963},
-{0x10561538DF7E372B, 894},
-{0x10571BD481BC5FDA, 584},
-{0x1057FF02FBD15245, 1332},
-{0x105819C7876EB408, 1174},
-{0x1058AAB51CD75D64, 552},
-{0x105BDCACE20A57CC, 205},
-{0x105D2531BA950D7E, 737},
-{0x105E8D1C2DDAC067, 327},
-{0x105F16600EDDD3D8, 211},
-{0x105FA3A053A45021, 734},
-{0x10611957001D436E, 451},
-{0x106182A0C14A34A4, 273},
-{0x106250FDDA30D65B, 240},
-{0x1064AD3FD40CCD5A, 5630},
-{0x1065700AFE3C19E1, 252},
-{0x1067C7579933A67F, 278},
-{0x1069520B64E0EC5C, 914},
-{0x106A0F412F340D33, 340},
-{0x106A9217C6AB51E2, 630},
-{0x106AACF10BF03D3D, 5320},
-{0x106B060FA57563EA, 361},
-{0x106DD960CAD2784A, 329},
-{0x106EBF96B0F7501E, 278},
-{0x1070A7D27FFD0CD1, 714},
-{0x107293E920E165FD, 241},
-{0x10729A64AB107924, 333},
-{0x10756600946D53EA, 334},
-{0x10758FCE8463E330, 425},
-{0x107771ACA6BAC1E4, 336},
-{0x1077D2E6720347A0, 494},
-{0x1078920CC4AA1D2C, 227},
-{0x107B39EE10C98407, 238},
-{0x107C674B41CCD5B9, 500},
-{0x107E5DD51DDBFDAC, 265},
-{0x107F3CDE735CDADC, 3581},
-{0x107FB682E9D021D2, 449},
-{0x1081C7B1124EAC3E, 209},
-{0x1081F4C60A652914, 747},
-{0x10844730EC9038C5, 229},
-{0x1084972B79A68B06, 226},
-{0x1084B90348433529, 1645},
-{0x1084E7A6C5CB8C58, 216},
-{0x1084F841606FEFE7, 204},
-{0x10879F117CA8F458, 216},
-{0x1087F20F4EF19523, 636},
-{0x10897E7FB2C6E960, 437},
-{0x108A8634D6FA0709, 221},
-{0x108B32074CEC600C, 590},
-{0x108BA4692F645FF4, 411},
-{0x108C05B604FF4D9A, 569},
-{0x108C3C775D9A2B9C, 233},
-{0x108E0F4E808C1FE0, 241},
-{0x108EA48B1A64C0C8, 443},
-{0x108FA5D4DFEF35F6, 443},
-{0x10907B6988304CF9, 406},
-{0x10924C3459CA88DA, 494},
-{0x1092D04C2336473A, 376},
-{0x109581211D16E30F, 295},
-{0x109605E38A0C9DF5, 361},
-{0x10968CFA5C60487B, 209},
-{0x1097D18F24BEB18B, 331},
-{0x1098B90CFE6A8C48, 710},
-{0x10997C394680B4B6, 234},
-{0x109A6F4F68709075, 297},
-{0x109AB489506B765C, 220},
-{0x109B40EFC9C0F055, 1549},
-{0x109DE9DC90CD044F, 606},
-{0x109EBD45832D6666, 1577},
-{0x10A0EA52E8312A58, 366},
-{0x10A10895FAE16A4E, 210},
-{0x10A17EF158FFEABF, 417},
-{0x10A1E38C68DDF4A1, 261},
-{0x10A253B10BBC57E4, 1235},
-{0x10A2701BD7F00EB8, 2151},
-{0x10A42C4155ABBCAA, 424},
-{0x10A47B1CD77F1662, 334},
-{0x10A49818F6D0E841, 958},
-{0x10A55D21E1D10F83, 3282},
-{0x10A6716B1D3950F1, 1936},
-{0x10A7B1C5629F54AE, 420},
-{0x10A887E6C36EB39C, 242},
-{0x10A894F25D4FCDE3, 321},
-{0x10AA64FC8736DBF6, 240},
-{0x10AA6BA80604D41D, 214},
-{0x10AB93B10D187019, 552},
-{0x10ACE9B83DF289CE, 403},
-{0x10ACF6FA38192DBE, 670},
-{0x10AD1A72FA88F597, 516},
-{0x10AE9AB29ED55A9D, 576},
-{0x10AEC522497C3955, 593},
-{0x10B2B2AD004BB40A, 257},
-{0x10B4F5D80481E53A, 969},
-{0x10B5A20F179E25B0, 655},
-{0x10B67658FD3F1324, 1450},
-{0x10B87505602016C8, 265},
-{0x10B90FF7751AAF52, 244},
-{0x10BA001FF19510E6, 224},
-{0x10BA066D6DD49D91, 1303},
-{0x10BA6600142B09D8, 285},
-{0x10BBC1B2E58BA9A8, 247},
-{0x10BDE1E18D3B9D48, 256},
-{0x10BE66DC4C826DDD, 905},
-{0x10C17FB91E779BCA, 286},
-{0x10C4FD1262BDA1D1, 471},
-{0x10C64357F494A17D, 508},
-{0x10C90B3E19E6F2C5, 215},
-{0x10CA8D64B60A319C, 430},
-{0x10CA911400A07889, 246},
-{0x10CC42F5741A681D, 313},
-{0x10CCF57F2276E4AE, 317},
-{0x10CEC30752E799AE, 287},
-{0x10D271C782E7E3B9, 362},
-{0x10D3638272C61A79, 450},
-{0x10D4799F29C5836E, 262},
-{0x10D5ECA12DEB6856, 283},
-{0x10D85F37B7589D45, 626},
-{0x10D8B1C29E83CA80, 490},
-{0x10DC9666D2845001, 731},
-{0x10DCF50C192781BF, 1348},
-{0x10DE367EB28A1FEE, 440},
-{0x10DE4D91D67B6F51, 638},
-{0x10DFBA7D1AA7F1CC, 202},
-{0x10DFD755E5C3FF83, 614},
-{0x10E1F199CF13CFD2, 302},
-{0x10E2B681FD2DA452, 703},
-{0x10E42A20335C5852, 215},
-{0x10E516DDC5BBA3E5, 337},
-{0x10E53D0790FA1BF0, 229},
-{0x10E550ECDE7A6B0A, 2610},
-{0x10E6233DF82A463C, 323},
-{0x10EB0B7E1FB35D54, 1417},
-{0x10EE31BC6F160441, 663},
-{0x10EE36E5CB83762E, 342},
-{0x10EF230C8A58916D, 1842},
-{0x10EFCADA1E8FBB5B, 362},
-{0x10F0781B61605E69, 466},
-{0x10F16DD363241F4C, 221},
-{0x10F2239C5C780C9D, 666},
-{0x10F3B39BF36E90CB, 286},
-{0x10F41E5FE5025B33, 203},
-{0x10F538C9ECBF9D0A, 284},
-{0x10F58074ACC7B050, 234},
-{0x10F6069C4C9005D2, 248},
-{0x10FAA28BA89AA50A, 232},
-{0x10FCA7960868BC88, 779},
-{0x10FE7FBE5361A49B, 202},
-{0x10FE992B3A0D2505, 619},
-{0x11002E50DB5A3917, 301},
-{0x11009D700E81380B, 416},
-{0x11017A512F32D1E6, 231},
-{0x11037E9BF496E80D, 262},
-{0x110430427E503934, 637},
-{0x1106A3BBB1FC69CA, 1976},
-{0x110980B0E5934F40, 720},
-{0x110993E5D7DCA543, 269},
-{0x110B931811579FED, 1758},
-{0x110C872931BA7C1C, 355},
-{0x1116E09F7BD8D89C, 1114},
-{0x1117693929558558, 488},
-{0x1117A0BF1F84C921, 689},
-{0x1119421EDF9FEF54, 579},
-{0x111B74B58D06E11D, 406},
-{0x111EEEECCCA79068, 220},
-{0x111FD3B3BE269855, 305},
-{0x1125487BBB74A7EC, 257},
-{0x1125541FB0E75A65, 240},
-{0x1126462FA311C705, 362},
-{0x11278D2F9B1FB6C4, 2049},
-{0x1127D967F6D8277E, 1493},
-{0x11286CC2616EA318, 644},
-{0x112A61C2269A50E8, 319},
-{0x112B2821F0144CAC, 841},
-{0x112B51CBA6F3F9FA, 3485},
-{0x112C0C06476EBEB4, 259},
-{0x112C18D3152E6940, 269},
-{0x112CD360C8189216, 444},
-{0x112E703C1E899C4C, 338},
-{0x112E715ADB235C74, 292},
-{0x112E88AE97604614, 686},
-{0x112EBC19BA417A53, 510},
-{0x112FFAE4FC021B77, 334},
-{0x11300D8A21AE1F64, 463},
-{0x11304B2AB556AB00, 239},
-{0x11304FECC2F6548F, 257},
-{0x11328C47C2ACB367, 391},
-{0x1132AFDD3E31D231, 268},
-{0x1134136BD5E2434A, 237},
-{0x1135C3ECABBE49C2, 996},
-{0x11365EC046CB0EC1, 273},
-{0x1138EA571B694E9D, 293},
-{0x113906B1FEB264C4, 221},
-{0x113B2AB18BE057B6, 243},
-{0x113B6BF10A337D62, 8799},
-{0x113E006457D1A1AD, 433},
-{0x113E7E7F464500CA, 457},
-{0x11402E86571C9CDB, 1096},
-{0x114230E65803BFFC, 273},
-{0x11432C6FA373578D, 281},
-{0x114494675DD1E7D4, 210},
-{0x1144D64A7565ECB6, 358},
-{0x1146895DB93C0303, 452},
-{0x11497B39AACF05D6, 747},
-{0x114B8C6739E8E193, 265},
-{0x114BACB391A51BA5, 2512},
-{0x114BE98C4EBCFD0C, 1449},
-{0x114C190963A2A697, 663},
-{0x114DA80A14B7ACC7, 667},
-{0x1150704F2A5BC0D8, 456},
-{0x1150F190CC88DFA9, 6235},
-{0x1151AA332084A40D, 200},
-{0x1155DF4FFBA5B6F3, 325},
-{0x11560F057ADC2433, 455},
-{0x1156397572B82AF9, 277},
-{0x115755E6C7F76339, 387},
-{0x1157B7E79E7E0E59, 1904},
-{0x1159A291D3E406AE, 258},
-{0x115C53186D000DF7, 201},
-{0x115D2AC1910D6D79, 4876},
-{0x115DFADDCD4963C1, 258},
-{0x115E1F098B7BEC76, 277},
-{0x1160000BE6473648, 794},
-{0x1160646453CCD61B, 310},
-{0x1160EA0E168A3A7F, 241},
-{0x1162D230C4AA8FB5, 596},
-{0x1167A9036C9D1E3F, 282},
-{0x116A6354A0245C89, 428},
-{0x116B69B26F2B8909, 289},
-{0x116BBBF1F624EF99, 577},
-{0x116C07C63F8292D6, 524},
-{0x116D17C954D495F9, 289},
-{0x116DF4E1A17B3335, 477},
-{0x11703C84828A81D3, 261},
-{0x1171190955BF5E86, 384},
-{0x11722F1266D06CAC, 206},
-{0x1172CBC3692C0BB9, 481},
-{0x117470DEFF1C6206, 330},
-{0x117566412E7FEB9E, 2284},
-{0x117638CAFFB1B93D, 212},
-{0x1176956D666A5552, 225},
-{0x1177C86BFA3B57BE, 2401},
-{0x1179CAC37EF9AE0E, 314},
-{0x1179E3BD66E8F61E, 663},
-{0x117A4275A1D091DF, 222},
-{0x117AA3814FE7CB6A, 213},
-{0x117B06E50210DB04, 230},
-{0x117CEAAB34464C0C, 3547},
-{0x117ECF88212472AE, 272},
-{0x117F53630332D705, 612},
-{0x117FCCC625A31530, 355},
-{0x118027311B8207F5, 278},
-{0x118075505F03A62B, 287},
-{0x1180CD61FE97100E, 272},
-{0x1180E9F9C419FE81, 346},
-{0x11812281F8E86201, 246},
-{0x1181830CC179AC45, 228},
-{0x1181DA960AF18546, 2033},
-{0x11823C31D75AD97F, 318},
-{0x11826D21D29008B6, 377},
-{0x1182ADCC64F364A1, 304},
-{0x118323E8B8123D26, 221},
-{0x118578E7A8F25957, 252},
-{0x118834AEB7A1CDBE, 1238},
-{0x11893846D46B5299, 2678},
-{0x11898B585B12D7E6, 309},
-{0x118A447EA8FDF44E, 8289},
-{0x118B02AFABD497CF, 1354},
-{0x118C012DFFC95A67, 387},
-{0x118C5ECD847B6FE9, 1123},
-{0x118D10EA13AD7ACC, 1193},
-{0x118D36DF962FA1C8, 210},
-{0x118E95B475189247, 699},
-{0x118F5D65B9310F49, 218},
-{0x118FC3B97A35BA2A, 202},
-{0x1190C628748EB928, 223},
-{0x1192DB75FE6FF83E, 305},
-{0x1192F2856D688D2A, 615},
-{0x1193599FEE421FA5, 270},
-{0x1195F66D0C91F4BA, 453},
-{0x11963703D158A63A, 667},
-{0x119692120904597A, 365},
-{0x1196E0763509CFC1, 358},
-{0x11998F12A1AD6C16, 870},
-{0x119ABB43D3C036B0, 2819},
-{0x119DA164BA1D3586, 223},
-{0x11A0BE2A310F8E70, 223},
-{0x11A283D07F227708, 561},
-{0x11A2B980AC318D63, 288},
-{0x11A3BA4DF3E63D16, 383},
-{0x11A3BD4DF57D2BA0, 289},
-{0x11A401B8321E6CFA, 1337},
-{0x11A46F295E16974F, 486},
-{0x11A4939EF8843ACC, 479},
-{0x11A4CDA5E57DD30F, 294},
-{0x11A4ED29E0C587AF, 416},
-{0x11A54FEBAD8652DA, 756},
-{0x11A55CF722A02C37, 362},
-{0x11A61CE94D698413, 248},
-{0x11A6C7CB122C0FF7, 299},
-{0x11AB6606C4CD554E, 1132},
-{0x11AC86AD0878D06A, 236},
-{0x11ACECE7A8C76C3E, 430},
-{0x11AD245BF30B83A9, 527},
-{0x11AD4A13F5EC465D, 276},
-{0x11AD9F2E46B85C2F, 445},
-{0x11B07906FFC985BC, 224},
-{0x11B108AE1A7D479A, 490},
-{0x11B1C66B3159F274, 405},
-{0x11B2196340DF8188, 344},
-{0x11B27FB305A3C00B, 1124},
-{0x11B2AD564E3992EE, 1717},
-{0x11B2DC15CB786778, 241},
-{0x11B4B3480D10057B, 1936},
-{0x11B538E8034AE989, 802},
-{0x11B571B04DD5D321, 287},
-{0x11B5E7A2CE438C79, 200},
-{0x11B6AFE563F0A027, 326},
-{0x11B9A59B9F535605, 243},
-{0x11B9C7EB5207163B, 786},
-{0x11BC45C558E76889, 869},
-{0x11BDBF1938DCCB94, 1334},
-{0x11C0004B43BE5E3A, 553},
-{0x11C07366B73D9954, 252},
-{0x11C075143625F7A7, 324},
-{0x11C0868CC8D7F502, 324},
-{0x11C0ADB6C8C5B931, 244},
-{0x11C0C58C833A18EE, 16337},
-{0x11C18DF97F8063D5, 508},
-{0x11C194C46DCED6B7, 316},
-{0x11C1CFE053E609F6, 381},
-{0x11C33DD75A07B513, 447},
-{0x11C3485A65BA62D4, 2768},
-{0x11C42F434976C2C3, 266},
-{0x11C470AFE277395D, 233},
-{0x11C7D7D29B956668, 206},
-{0x11C960DDAA73C791, 213},
-{0x11CA1EEDA6C5B5C5, 4699},
-{0x11CA7591479915E0, 682},
-{0x11CB6A42A18B2A2B, 222},
-{0x11CC6FFCB91586E1, 2441},
-{0x11CCD4587C582882, 201},
-{0x11CDB38198BC6E4B, 269},
-{0x11CDC099C60C95B7, 326},
-{0x11CF4C815010FA27, 224},
-{0x11D0512309AD5FDB, 881},
-{0x11D0A70809319914, 771},
-{0x11D0D65CCD2D7C60, 1018},
-{0x11D0EA67CB423CA3, 481},
-{0x11D3C7F752F688DC, 507},
-{0x11D427E9D87FDEC5, 470},
-{0x11D528FD367C90F7, 256},
-{0x11D57F6D6211F326, 2581},
-{0x11D5FA3CF5EBC885, 300},
-{0x11D6353B17D2F7AB, 709},
-{0x11D6C8660934967E, 271},
-{0x11D6FE4E0D822C9A, 4095},
-{0x11D80B5852CE126E, 204},
-{0x11D8248889CCBCD4, 214},
-{0x11D8E95279B1B0DA, 560},
-{0x11D9F5009E271132, 261},
-{0x11DA65828DE6C34E, 1060},
-{0x11DE325E503A3C69, 262},
-{0x11DEB2300354E08A, 3745},
-{0x11DFA26133FDE4FB, 412},
-{0x11E0693B0A596306, 1403},
-{0x11E23D19A8B4A73D, 301},
-{0x11E2A6F968794351, 233},
-{0x11E2FC18CDC3F348, 2786},
-{0x11E478CC17972CCB, 1013},
-{0x11E4AE06D998431F, 295},
-{0x11E543B604CD0564, 3003},
-{0x11E5739FA04708B0, 246},
-{0x11E59DB138C0F012, 487},
-{0x11E5AC113F84E898, 209},
-{0x11E5B1582A91139E, 327},
-{0x11E63EBF330CE6EB, 355},
-{0x11E6979B5420A075, 549},
-{0x11E814AC6C1DC13E, 201},
-{0x11E8F9D25593E92C, 1258},
-{0x11E9D987F888304F, 693},
-{0x11EA730C67B33D48, 265},
-{0x11EB7651D108B834, 708},
-{0x11F08D5DF2C29124, 2634},
-{0x11F09BCC2CCC455C, 446},
-{0x11F14FBC93B2C826, 253},
-{0x11F369C7C83E4B90, 4396},
-{0x11F4D7D783758A38, 283},
-{0x11F6102AF652DA4F, 363},
-{0x11F62D5885C48EA6, 244},
-{0x11F64990560ADEF9, 397},
-{0x11F7B55E7A550F4F, 1866},
-{0x11F8A2BA24A894C6, 250},
-{0x11F9702A090BD1D8, 379},
-{0x11FA4BCD5D0557AF, 666},
-{0x11FBEE22C09AC6E6, 1574},
-{0x11FC1F0B2D5F7E30, 245},
-{0x11FD10C1E042049F, 239},
-{0x11FD84B8601486F3, 330},
-{0x11FE084A105C48E4, 661},
-{0x11FE1B7FD7BAE4C6, 559},
-{0x11FE2129FD4FAB60, 307},
-{0x11FE813DA8987BEC, 422},
-{0x11FEBEF59FB00F89, 2920},
-{0x11FEC4A3BD3774D4, 326},
-{0x120017D85B6E7429, 245},
-{0x120045559FDCBDBA, 222},
-{0x120091B511BF6EB0, 565},
-{0x1202383B7943A491, 2374},
-{0x1204881CE638641F, 1260},
-{0x1205347FE3199FBF, 235},
-{0x1206225C85F5F63B, 216},
-{0x1206A4967C94E7CC, 380},
-{0x12081410EB5F9E1A, 518},
-{0x120994B32F6F763F, 346},
-{0x120A1379CAC10BA5, 511},
-{0x120B242FE22E97FC, 216},
-{0x120C49D3EA9396D0, 302},
-{0x120C556CC9168207, 200},
-{0x120C8842DAF311B4, 219},
-{0x120EAE97CEE9E058, 374},
-{0x1211AB29E6F6657C, 208},
-{0x1212753E75CD8E66, 281},
-{0x121277AFAE33F213, 685},
-{0x1213BB02B64DA11C, 443},
-{0x121473B243A29B15, 393},
-{0x1214A0AB4D2B3487, 330},
-{0x1214A7458D12CBAA, 647},
-{0x121538F7BC6D8F41, 690},
-{0x12155FA765AE02B4, 5353},
-{0x12171299D4949BEA, 485},
-{0x12179F0F57F7D573, 391},
-{0x1217E8B7C5600DCA, 3291},
-{0x12183A99BDC7F492, 765},
-{0x121E4E9FB5249817, 326},
-{0x121E6DEA21A61B75, 592},
-{0x121F0A8982243194, 1983},
-{0x1220275C7BEED38F, 698},
-{0x1220706383FE155F, 8762},
-{0x12210E3CA67C8441, 562},
-{0x12221F55EDC1185D, 304},
-{0x1226C9F61A79CE7B, 2332},
-{0x1229C3330747BFDF, 1678},
-{0x122B8B532F67F59D, 2354},
-{0x122CC7652F9FF3D2, 210},
-{0x1230EAE218AEBEE1, 367},
-{0x1231243012EABDE8, 593},
-{0x12315D3F5D9F845E, 204},
-{0x12317636ED3657C6, 508},
-{0x123268E26C1EE969, 217},
-{0x1235A0E84D03EDBA, 234},
-{0x1236FBF67986F7E7, 611},
-{0x1237756A5986AE04, 335},
-{0x123788B3AD4F571A, 230},
-{0x1239796FDB3AC676, 246},
-{0x123995A97FABE78C, 285},
-{0x1239F5C68D592315, 276},
-{0x123A1284D940A7BF, 315},
-{0x123A258A79512CBB, 328},
-{0x123BC59642D72B0B, 264},
-{0x123CD0976ADDB933, 354},
-{0x123D70F5E8A4472B, 400},
-{0x123E3D4C816A04DE, 215},
-{0x123E7E7845FFBB9E, 222},
-{0x123EF4C750FF2FA3, 350},
-{0x123F41C0119582DA, 238},
-{0x123F4786C96F82DF, 285},
-{0x1240A8BF14C9CE9B, 257},
-{0x1242D06B26948357, 232},
-{0x12439E838DA443A0, 311},
-{0x1243E3F3AF80219C, 1676},
-{0x1245D45A485A369F, 204},
-{0x1247817A355D7B14, 236},
-{0x1247A2EAEFCFA57D, 423},
-{0x12488560141E13CB, 2619},
-{0x1248F3FF8A4E97FA, 511},
-{0x124B3347365E96D6, 327},
-{0x124C963F8A89D3D2, 444},
-{0x124E1322400E8DBE, 375},
-{0x124F9764A8664F86, 397},
-{0x125074BDDD6BFB91, 271},
-{0x1251BE0F17B4A0AC, 202},
-{0x12520231E1303767, 245},
-{0x1254B24098E4AAEF, 637},
-{0x1256E924FD2A5816, 345},
-{0x12576B64B561C1D5, 209},
-{0x12585FBBBC4576E8, 241},
-{0x1259A05E7C08D7E2, 207},
-{0x125A8B6CBA21386B, 294},
-{0x125C633ACFF2B4A2, 365},
-{0x125FE55B90B706D5, 503},
-{0x1260508D2D81B6FE, 466},
-{0x1261395B7A3C5E90, 501},
-{0x12639DCC00E425D1, 860},
-{0x126572803AF92228, 567},
-{0x12681AE37FF6281E, 241},
-{0x126834FD0F448FB5, 1023},
-{0x1268DD788F07A0C6, 228},
-{0x126B54E91FD9C323, 624},
-{0x126D4ED21576DA6E, 413},
-{0x126D55921DE65070, 237},
-{0x126DD43B62174B05, 669},
-{0x127194CA05AC7AD3, 257},
-{0x1271BF3376870624, 215},
-{0x127450386E085E23, 401},
-{0x1274D508EA666E19, 671},
-{0x127591BDE61AC7E2, 380},
-{0x12759BDFFB408FB9, 210},
-{0x1276CB66820E0D7D, 987},
-{0x127869E2D14FD9E7, 358},
-{0x127C3B6090E8AD8A, 390},
-{0x127C7004A1ACF12F, 391},
-{0x127C831CC98D189E, 409},
-{0x127DBC1B5B50D4CB, 3790},
-{0x127F1818D4BD897D, 372},
-{0x127FD2798C5DE81F, 4609},
-{0x12800E1E37DD38BC, 252},
-{0x1282755510675691, 21235},
-{0x128558E8C7F2B762, 1662},
-{0x128A7712871C3FE9, 209},
-{0x128AFE1C559FA20F, 252},
-{0x128B46EC657C1134, 374},
-{0x128BFE30941AF19D, 543},
-{0x128C4537727F6B9A, 306},
-{0x128D72AC94021CFC, 5451},
-{0x128F09DDAA5EC7CF, 1087},
-{0x128F88DE5B2D5D10, 964},
-{0x12925572BD678838, 1742},
-{0x12928D10DCC42DF5, 258},
-{0x1293531F30327B63, 298},
-{0x12963CFC97EB50B1, 235},
-{0x12965D78B2730CC5, 324},
-{0x129797CDA078D1AD, 783},
-{0x1297E6059AD82D0A, 281},
-{0x1299489A4E6D9050, 26196},
-{0x1299612DF14A1EF7, 1911},
-{0x1299FFFAF988FB5B, 416},
-{0x129A0D768A8A1DA4, 262},
-{0x129B337EA8F83FDA, 4119},
-{0x129B41148FCB3C95, 225},
-{0x129C166162261445, 226},
-{0x129CE056ECEA8926, 1221},
-{0x129D3700BBFC040C, 218},
-{0x129E8FA2649C8BE3, 276},
-{0x129FA93902DCC678, 387},
-{0x12A07C6D1ED23CBA, 262},
-{0x12A07F3AC60BB7D2, 248},
-{0x12A31BD9CCEB0565, 219},
-{0x12A40ED42FADECC2, 239},
-{0x12A494979F42AF31, 257},
-{0x12A4B7572E3BEFF9, 540},
-{0x12A5021D8DB96B6D, 499},
-{0x12A575FC2AB533D3, 214},
-{0x12A5973A6B975EE4, 416},
-{0x12A5A35304EEE41A, 250},
-{0x12A5DAB61BDC5711, 1832},
-{0x12A7392B238DDF80, 382},
-{0x12A95E41A43F6C1E, 259},
-{0x12AA57C35005194F, 1029},
-{0x12AB2B8C03913883, 2338},
-{0x12AB2D071CE033FF, 473},
-{0x12ABAABE41C7E665, 560},
-{0x12ACA580A281EA2A, 448},
-{0x12ACDCF319EB5AB4, 305},
-{0x12AE6B1710251CE1, 370},
-{0x12AEED8C7AF3A24F, 265},
-{0x12B090D759298166, 2920},
-{0x12B173994741884B, 266},
-{0x12B3002CCD84ED3C, 522},
-{0x12B65643DAAD16BB, 766},
-{0x12B686C9999C75A8, 532},
-{0x12B6F45081F1DE24, 463},
-{0x12B71D333D61C1FF, 321},
-{0x12B7D384850AD29D, 318},
-{0x12B8735B75FBFA87, 2276},
-{0x12B8F7411DFEAF98, 269},
-{0x12BB18753E460D38, 635},
-{0x12BCE63A8AD8563A, 1078},
-{0x12BD6201467C1A1D, 678},
-{0x12BF4C898F14C05C, 569},
-{0x12C09F24C615D238, 578},
-{0x12C11170EEAC2A8E, 512},
-{0x12C17285415EB6BC, 301},
-{0x12C30FB38639CC75, 216},
-{0x12C49BEB4EF4A398, 354},
-{0x12C54F11290BB763, 597},
-{0x12C5EB1D72545E09, 276},
-{0x12C771D829F82EB2, 237},
-{0x12C8588FB2CB0058, 2944},
-{0x12C87BF0B6FC8F33, 337},
-{0x12C883B65445CD64, 382},
-{0x12C88EB0E732F046, 218},
-{0x12C88FC812BA6C6F, 466},
-{0x12C90BC9E2A91B69, 211},
-{0x12CB199D9DE313D1, 286},
-{0x12CC9768461D2809, 377},
-{0x12CCC3D229ED9D60, 213},
-{0x12CD43E56B1F4CE5, 210},
-{0x12CDF0495624BAD7, 2650},
-{0x12CE88A6926B8BC7, 234},
-{0x12CF5E9C1E3EF07D, 1276},
-{0x12CF61715692F942, 347},
-{0x12D250A3279BE1D4, 303},
-{0x12D2785E1FEF486D, 355},
-{0x12D3954F3BEE6FEA, 237},
-{0x12D3E657F2E20AB3, 273},
-{0x12D46CD5EC71FF6E, 309},
-{0x12D4B62BCDCE460F, 302},
-{0x12D79867F5058323, 306},
-{0x12D9A590A0105CDB, 214},
-{0x12DA037A5942A001, 2158},
-{0x12DA1440970460C6, 344},
-{0x12DCA6013C776DD4, 223},
-{0x12E07B17981CC553, 1190},
-{0x12E1855C6E163753, 294},
-{0x12E4173C748658D1, 1607},
-{0x12E4902CC09C97F5, 375},
-{0x12E5299DDEC8FFC5, 698},
-{0x12E60D06E7BE7FDA, 241},
-{0x12E65AC83CCF759B, 763},
-{0x12E683DC7B3E7405, 457},
-{0x12E73C0CE82F7DDC, 617},
-{0x12E7A9E154EFFE84, 1003},
-{0x12E826EC5DB9A6B7, 1215},
-{0x12E9FD63790C29B9, 1916},
-{0x12EB1F32EBE3D0FF, 5378},
-{0x12ECF2809D1206DA, 842},
-{0x12EEBFED11CF6C0C, 216},
-{0x12F0D0C496AABC85, 243},
-{0x12F12FD676624109, 675},
-{0x12F14833C108DA43, 236},
-{0x12F335CB73A99AC4, 345},
-{0x12F5F05DB314BD87, 231},
-{0x12F8267BD52E49A5, 674},
-{0x12FAAFCA8B0B392D, 218},
-{0x12FB0CBA6012B0FD, 3099},
-{0x12FC6275E34F91D9, 424},
-{0x12FDD49E6033E8B3, 2284},
-{0x12FEDEDC82527AEC, 17164},
-{0x13014CB9AE3EB1C1, 1110},
-{0x1302E17A5905C78A, 787},
-{0x130367E3506FD213, 372},
-{0x130428164B883E25, 277},
-{0x13084E3EF6F57805, 388},
-{0x1309E1F26B6D78F4, 948},
-{0x130A93A3CB5BA5F7, 223},
-{0x130B0FA2541AC139, 1103},
-{0x130B2F0DD5A7CF59, 250},
-{0x130BA286B373ADD7, 282},
-{0x130C4B2102F734E3, 3137},
-{0x130E11EF7C7FC5E5, 565},
-{0x130F11C6C139771E, 261},
-{0x13135FED721BC0A8, 516},
-{0x1315B584AF75081A, 272},
-{0x131746CCD6A79DDA, 441},
-{0x13177135A9E8B8FD, 309},
-{0x131ADBB40D78D368, 340},
-{0x131BD8A73E1E0D22, 2279},
-{0x131E32636D48F7ED, 471},
-{0x131FF0315AC2E0CC, 1991},
-{0x1321E728243707E3, 709},
-{0x1321F42F727E08B6, 516},
-{0x1322957EBF8017C3, 969},
-{0x1323164690FE6CE9, 25437},
-{0x13249B150A09DFD4, 319},
-{0x1325031292F63BBA, 491},
-{0x1327A8B59E7543FB, 333},
-{0x132DD2FB8BD24322, 1071},
-{0x132DDBCF2DBB1009, 279},
-{0x132E170644C9EB93, 314},
-{0x132E374455135EEE, 829},
-{0x133769DA5C328AFD, 419},
-{0x1338D233D0AEA114, 354},
-{0x1338FBC8305194F5, 266},
-{0x1339F10F2D51C7B2, 513},
-{0x133ABE71015C0EDA, 325},
-{0x133D1EF5946BABF4, 347},
-{0x133D886B6DBA63B9, 292},
-{0x133FBC51334BD059, 718},
-{0x1340538A13FB43FF, 257},
-{0x13414DACF161FC6C, 257},
-{0x134177704A4A46F8, 230},
-{0x1343F315993134AC, 328},
-{0x1345CCE6BC0FC67E, 408},
-{0x13493528F6116A54, 272},
-{0x134A1D8FAA9E7254, 2815},
-{0x134C9AF037F25F22, 207},
-{0x134E06E10C705850, 230},
-{0x134E554D09DDADD2, 255},
-{0x134F495D31E5EB5B, 562},
-{0x134F92E0B1204E20, 374},
-{0x1356149E8A280CCC, 563},
-{0x13561878ADAA9294, 688},
-{0x1356B40C98E674FB, 2130},
-{0x13577ADB934D52A5, 277},
-{0x1358744AEDAFADC9, 392},
-{0x13589B00763A7D9C, 234},
-{0x13590DB24D42CD48, 301},
-{0x135C6E0E67D9FF1E, 1431},
-{0x135CB3981E419545, 1633},
-{0x135D3CDE6F411194, 379},
-{0x135D43B936202AC7, 755},
-{0x136167986EC236C9, 246},
-{0x1362B894FB2EA5B0, 352},
-{0x136416186D1CDC75, 439},
-{0x1364DE07888711C4, 263},
-{0x1365AF54706537E8, 346},
-{0x136A19FD64E18F55, 273},
-{0x136ED94A7508F748, 1443},
-{0x13721AC241DBEEE3, 1034},
-{0x13726B1EF906483A, 290},
-{0x137975D8D76728AE, 369},
-{0x137987F387CDF026, 336},
-{0x137A41FCFC5BC0BE, 249},
-{0x137BF57DB62F8AFB, 351},
-{0x137CE89C2929F7F7, 248},
-{0x137FCA5C80732DA2, 249},
-{0x13802A591B1F7188, 680},
-{0x1381657E99079EAF, 378},
-{0x1383F44282DA3CDE, 216},
-{0x1384291A94DFB07B, 324},
-{0x138C1494B9B3A914, 1693},
-{0x138C1B1B1B563C59, 240},
-{0x138CA30240DEBEAA, 347},
-{0x138CE940918DEDAA, 365},
-{0x138D0257B49F28B2, 1627},
-{0x138F170EA5705055, 339},
-{0x13902F527F1A339E, 3858},
-{0x1391982A0BBB849E, 2335},
-{0x13931469E2F2ECF4, 278},
-{0x13949A345EF764BA, 323},
-{0x13949A45917EE683, 209},
-{0x1394C91CE838126E, 208},
-{0x1396F83FDC399802, 941},
-{0x139786028B1310FD, 239},
-{0x139847E19C70D528, 1676},
-{0x13998812E79042DF, 306},
-{0x1399F4A2AE7F7AA6, 336},
-{0x139A82E683E6A05D, 703},
-{0x139AA39DC27E1C37, 361},
-{0x139C19E8423995E1, 436},
-{0x139EBADE66108E89, 223},
-{0x13A10189DF240367, 221},
-{0x13A3E1B3E98B5060, 240},
-{0x13A45D95E8780D8D, 451},
-{0x13A47CAB833D54B2, 390},
-{0x13A4B65F71E5539B, 1247},
-{0x13A5372D9A24E509, 214},
-{0x13A6AC3389D9EABF, 492},
-{0x13A7C3C89CC29A6C, 475},
-{0x13A93CE16CF41B03, 216},
-{0x13AA3426054DE8DC, 466},
-{0x13AC69A88F1F4DCE, 310},
-{0x13B1C4FB60AD4827, 222},
-{0x13B2F28B5746CEC4, 362},
-{0x13B3E98DBD1F5335, 242},
-{0x13B4D33017D72957, 236},
-{0x13B853E7FDE52EA5, 765},
-{0x13BADB79DFEBE76C, 277},
-{0x13BC6EDD3278612A, 239},
-{0x13BCB95D13F58A44, 1010},
-{0x13BE97EAA2904B45, 1264},
-{0x13BEB5A5BD4F2B79, 223},
-{0x13BF1C188AD19FE1, 302},
-{0x13BF7E41664A461E, 208},
-{0x13C0DE2DD19CB650, 546},
-{0x13C1684CD5B13FAB, 518},
-{0x13C3665E253EB132, 232},
-{0x13C5535B514F8131, 5737},
-{0x13C63B1AC58818EE, 322},
-{0x13C75995D87BBCD6, 5414},
-{0x13CA214801CCA5EE, 266},
-{0x13CA437E2E4CFD96, 239},
-{0x13CBD24D8E4B3F89, 536},
-{0x13CE48B9BDEBF88A, 707},
-{0x13CEB5835235299D, 1590},
-{0x13D10BBF1C2C92FC, 276},
-{0x13D18B21D4710750, 214},
-{0x13D2EFAFF28596A2, 1337},
-{0x13D309EA02188C4A, 361},
-{0x13D36590C08FC09D, 271},
-{0x13D388ABE35C211F, 698},
-{0x13D739516764F17D, 1013},
-{0x13DBEA76A9B97203, 829},
-{0x13DCF4AF5618A63D, 217},
-{0x13DDDE98AFAC5FAD, 337},
-{0x13DE0833E8950B2F, 533},
-{0x13E1AD4E5FBC910B, 3456},
-{0x13E224D9361BB19A, 255},
-{0x13E23BE92AEEA32D, 254},
-{0x13E2934F2FF184BB, 271},
-{0x13E32550B7B92E2D, 253},
-{0x13E6D47EA9CF54D9, 10190},
-{0x13E747CC37855303, 1025},
-{0x13E8C0DA5FC228AA, 214},
-{0x13E97E2A84350BF8, 327},
-{0x13EC958BC8558B9F, 417},
-{0x13ECF3B10ABF0D76, 304},
-{0x13ED304161624B83, 248},
-{0x13EE7D919DD3A908, 346},
-{0x13EF465BAEB2AB33, 1037},
-{0x13EFA5AE9E61CCC9, 418},
-{0x13F2090D9B378356, 258},
-{0x13F36F2F393BC6CC, 507},
-{0x13F4260F9C7495B5, 1142},
-{0x13F483298767248E, 777},
-{0x13FB122E11002EB2, 363},
-{0x13FBC64ED14601CB, 279},
-{0x13FC2F80638F3A90, 2781},
-{0x13FD515BC406F3AC, 272},
-{0x13FDF5A99C84798E, 888},
-{0x13FE1706CF66C9D2, 467},
-{0x1400601C86C909D8, 1063},
-{0x14017E9991034463, 429},
-{0x1403252519838D05, 240},
-{0x140505CB7AFDA807, 266},
-{0x140542E5CB5D295B, 491},
-{0x140612A1967D454A, 233},
-{0x140A226BF648458F, 902},
-{0x140BC2503916EE5B, 238},
-{0x140C52D92B5BBBAF, 633},
-{0x140CC22CDB11453F, 396},
-{0x140E815362A94AE1, 350},
-{0x140F832D91316501, 233},
-{0x140FF3D2DC80F586, 609},
-{0x140FF57E9F84EB91, 201},
-{0x1410DAD11BD2A583, 275},
-{0x1411F2BC3B216A8C, 320},
-{0x141321CD0ED0B6FA, 2641},
-{0x141327277A7805B6, 232},
-{0x1413F09C14822F4A, 292},
-{0x1415F68EDB683056, 211},
-{0x141709B092A1AF2A, 217},
-{0x1419D992791B0E5F, 217},
-{0x141A1D03BC5987C1, 341},
-{0x141AE00A4C8FC3ED, 242},
-{0x141D6A4721D12DDE, 365},
-{0x1420950C34E0EB7C, 313},
-{0x142120F6100B0652, 450},
-{0x142360C8FD99EACA, 205},
-{0x142444CE00BF9DC9, 2333},
-{0x1424FD9BF6E22CC1, 209},
-{0x142616B680829CA1, 848},
-{0x14269726D5611D1C, 283},
-{0x1427043130EEBB61, 3570},
-{0x142AFEBCAC1546CF, 1162},
-{0x142B994D83D34F65, 1007},
-{0x142C5A6E83D41BC9, 424},
-{0x142D22F2F6F22BC1, 425},
-{0x142E3ECD8E33B7B6, 549},
-{0x142E48C7388E2569, 226},
-{0x142E97EFD02889E4, 206},
-{0x142F1DAF1B6EA32F, 437},
-{0x14313ECAAEEEF9E6, 1425},
-{0x1433117089464FBF, 843},
-{0x1433AE7D9BB97D74, 253},
-{0x1436B18A1B5833F1, 375},
-{0x1436C262C80854E8, 305},
-{0x143A337A9ADD0249, 446},
-{0x143BFB85EB58D1A4, 134706},
-{0x143CEBE7A9E4DB6D, 736},
-{0x143E8DCCDB86BB29, 1725},
-{0x1441A38059B01971, 875},
-{0x1442F7D62E3C64EB, 472},
-{0x1446813B5CDFE340, 496},
-{0x1448230102C4451A, 246},
-{0x1448460BC871C987, 1409},
-{0x14485C1D09D886EA, 3005},
-{0x1448CC2587DB34C1, 663},
-{0x144955E9AA39C17C, 246},
-{0x144A4D3617AFE100, 339},
-{0x144C19C1B9352068, 418},
-{0x144CEEB114185BE1, 247},
-{0x144EF3051E59C591, 249},
-{0x144F69CB65551A4C, 241},
-{0x145028E6AFCE921B, 542},
-{0x1451804DD1434502, 257},
-{0x1451B177A7ECCEB6, 477},
-{0x1451EADA21F43EF2, 242},
-{0x1453E9F4948E3E1F, 318},
-{0x1454D6164FC59BCA, 205},
-{0x1455A1A2DBBE7E27, 581},
-{0x1458612D178D7752, 2269},
-{0x145907C7D99AD5E0, 1351},
-{0x145922396F5423B8, 267},
-{0x145B8DC61D2B8534, 223},
-{0x145E06CCF8465257, 1350},
-{0x146213FCAB4C2DFE, 223},
-{0x146338DC50EDF933, 941},
-{0x14639CDE739CFFD1, 522},
-{0x1463B79CF215AF9E, 234},
-{0x1465BCDFD6F77BCB, 756},
-{0x14679CFD2237C678, 213},
-{0x1469D515F3A86640, 247},
-{0x146AF3C7773FAD69, 5697},
-{0x146B549D8EE38331, 4588},
-{0x146D04E4351882C7, 300},
-{0x146F5346889CEC92, 819},
-{0x1471100EA5DF096F, 7139},
-{0x1472CDADB2F82F5E, 224},
-{0x147477E6D3EC6015, 200},
-{0x1474C029FCBDA439, 323},
-{0x147649F1BA8F8E8F, 558},
-{0x1478807A2E421BF5, 452},
-{0x147998E5EA3E0FE5, 1551},
-{0x1479BA58821C2423, 958},
-{0x147A67BABBC5A6EB, 260},
-{0x147A811D1895D174, 1819},
-{0x147C6D7D655B213D, 1601},
-{0x1480C1AEDC17DFDD, 913},
-{0x148134EE9D3E9CA6, 213},
-{0x1481370967CD179A, 204},
-{0x14817F934E7713F3, 490},
-{0x148189C0EE323EBC, 259},
-{0x14840D2157D8C752, 247},
-{0x1486F6449DB256CB, 411},
-{0x1487B619181BB354, 285},
-{0x148FFE6F8906BFA0, 573},
-{0x1490A5C8E699D5CC, 361},
-{0x14947970A1203A31, 8477},
-{0x14949B11931BDB90, 1278},
-{0x1494B663612E4C19, 832},
-{0x149608D56EFE4088, 200},
-{0x14992F7F9D048AE1, 343},
-{0x149C62DC9DDFE842, 257},
-{0x149CF5A924B4F490, 1036},
-{0x149D0AD5535F617E, 1511},
-{0x149EBDE1719A6264, 392},
-{0x149FE7E27D58F417, 457},
-{0x14A0A6D59319A582, 705},
-{0x14A14002565E792D, 1181},
-{0x14A18BEB2A685AC1, 1966},
-{0x14A18CECED55E8E3, 223},
-{0x14A40B9746C2DF38, 1726},
-{0x14A46A3F7887F42C, 1087},
-{0x14A5B09BB1DBBA25, 248},
-{0x14A625735469993C, 226},
-{0x14A654564C7A38FF, 322},
-{0x14A6EC19879A6252, 255},
-{0x14A7C68E1D7A93E5, 748},
-{0x14A8866082BE27F5, 583},
-{0x14A94A3DAD8C13E1, 637},
-{0x14A9F0D64A6DC6A9, 3028},
-{0x14AAEF80A067D90A, 420},
-{0x14AC0B9756A2D04D, 873},
-{0x14AD4DB7C2CB9ADA, 220},
-{0x14AD6F8798F8E157, 400},
-{0x14AE5888118D19A0, 555},
-{0x14B35570740DCC38, 1394},
-{0x14B39C8ABE50D670, 438},
-{0x14B3C7F39925D806, 386},
-{0x14B4B9DFAF5C359C, 705},
-{0x14B504A616A90DC7, 244},
-{0x14B557CA217A4EF2, 310},
-{0x14B60DD52A57D176, 303},
-{0x14B7AA4A8C2ABF76, 6297},
-{0x14B7AD6624058CCD, 316},
-{0x14B89BEFC3D05753, 3471},
-{0x14B977834AFB176D, 567},
-{0x14BBA859FE9C9910, 205},
-{0x14BE8753F70506D6, 314},
-{0x14C05B9F4AB871E7, 380},
-{0x14C27D63BD950BC1, 547},
-{0x14C2AEE21EC99ABD, 201},
-{0x14C39F2A4798BEBB, 362},
-{0x14C3EAAB16880317, 277},
-{0x14C4FA1CF415EFAC, 212},
-{0x14C7F7565FCE6DBF, 206},
-{0x14C93444A0B1D432, 792},
-{0x14CAB6394AF74DF7, 218},
-{0x14CC19AB8BE7C244, 235},
-{0x14CC3C952610F692, 282},
-{0x14CD6B53BF7E6ABA, 241},
-{0x14CD7EB2B5397CF3, 307},
-{0x14CE14E7316A7BF4, 443},
-{0x14CEF5AA2B180AE6, 606},
-{0x14D017B0EECBEB37, 81916},
-{0x14D05BB2AB9709C2, 308},
-{0x14D3244087725792, 227},
-{0x14D3449F9892A1D8, 227},
-{0x14D446E96D34947D, 228},
-{0x14D6B52312F4B47A, 490},
-{0x14D7173409A14162, 495},
-{0x14DA186F33220126, 845},
-{0x14DB509C41DEFFC6, 746},
-{0x14DBDCAD1D01A4D0, 1154},
-{0x14DCBCF02816DB46, 370},
-{0x14DD56C53A987FCC, 452},
-{0x14DF20E2B52A5B1E, 414},
-{0x14E161582A69E458, 4128},
-{0x14E229D020E1620B, 528},
-{0x14E4500E2E9C961D, 357},
-{0x14E4BA8EDDE57B6E, 312},
-{0x14E4F66508FA7864, 1748},
-{0x14E66570E38E3FC0, 383},
-{0x14E667A208BA6685, 1925},
-{0x14E76460D4C0FE33, 301},
-{0x14E7E74B2BBC4D0C, 263},
-{0x14E820BC0A807CAA, 287},
-{0x14E8EEA2A2BCF8EC, 203},
-{0x14EA44C9FCEDAA30, 449},
-{0x14EB6FB3608827B1, 1127},
-{0x14EB73E5FF120896, 308},
-{0x14EBD70CAED2E86E, 338},
-{0x14ED5C4C13A3BDD8, 225},
-{0x14EE17934E792B7A, 210},
-{0x14EE2BA4E6D1D86B, 699},
-{0x14EE3ADD0A1C42A9, 537},
-{0x14EFCD98513CB409, 251},
-{0x14F15D7DCEBAD665, 8322},
-{0x14F2D6A14646F088, 224},
-{0x14F2D6B0E8E223B4, 253},
-{0x14F2EF6CAE0177A6, 16920},
-{0x14F630613E8FFFE5, 3767},
-{0x14F63C817816C0D3, 440},
-{0x14F6DF2BCF05A567, 944},
-{0x14FB5A73242E48C5, 10695},
-{0x150371491A564E16, 430},
-{0x15044EE544FC7A71, 247},
-{0x1504931573B32C22, 1119},
-{0x15052AA2795A5BB2, 212},
-{0x1505CF8C7488B6C6, 1198},
-{0x15068F4A63891644, 635},
-{0x150764E647B15183, 395},
-{0x15081B344FE57A50, 1926},
-{0x150C92D62DAFCB3E, 7589},
-{0x150D80D4540C2753, 246},
-{0x150D825BC864CFCE, 203},
-{0x150E4FFCC5787AC4, 1169},
-{0x150EA59AF831CB9B, 280},
-{0x151063F7E86E698C, 369},
-{0x15135AE008DBA022, 441},
-{0x15139EFD52F64725, 206},
-{0x151425085C0A7236, 2149},
-{0x1516D6416F80C214, 548},
-{0x1517F13BB0D63F96, 665},
-{0x15181526B5BE7C07, 223},
-{0x15181E9201A8C896, 463},
-{0x15191938EDE0196B, 1685},
-{0x151A5033386435A8, 237},
-{0x151A62D15A658F75, 4706},
-{0x151B405DE9541409, 281},
-{0x151CFB2F0C01AE20, 220},
-{0x151DA6583B0F9A6D, 232},
-{0x151E72ABC12CBBBC, 1037},
-{0x151F172626632C99, 363},
-{0x152274DDFA210EBF, 791},
-{0x1522A38D7C656334, 307},
-{0x152462165962B8A1, 359},
-{0x15253843B5127D40, 894},
-{0x152972FEAFEE8DB9, 279},
-{0x152AC2BCC7A004D5, 243},
-{0x152B1F954F9237D9, 230},
-{0x152C3A241E1DC1CD, 217},
-{0x152C8D4E6209AD15, 329},
-{0x15368ABB4F7D013A, 212},
-{0x1537A06E02727815, 231},
-{0x154194F71E6F8FCB, 236},
-{0x15431732ADB9040F, 283},
-{0x1543911FA554D9C3, 697},
-{0x1545CF494F4E3513, 680},
-{0x154852C5EF629B63, 756},
-{0x15489BF2CBF69A77, 244},
-{0x154A5E988B8913DA, 288},
-{0x154A96F6C62F7551, 235},
-{0x154C822ADC664676, 221},
-{0x154D5E1AE6A8995B, 219},
-{0x154F590CC6B82C75, 290},
-{0x1551AE074A889146, 653},
-{0x1551E9547DEAE8EA, 358},
-{0x1552675C2E248A13, 2374},
-{0x1552B43B0FF59416, 307},
-{0x1552FA2F6D11F792, 46015},
-{0x155312B0F2805AF3, 1617},
-{0x1554F345D97E0888, 447},
-{0x1554F6BECFBAEBCD, 782},
-{0x15552AFDF4A1C220, 558},
-{0x155604E6121AC8FF, 215},
-{0x15577F56DAD04CC4, 28458},
-{0x15591C045C52186E, 577},
-{0x15591F0D5FEF6BE5, 1678},
-{0x155C782DC3BBB909, 219},
-{0x155C80B61E172C59, 469},
-{0x155CCB580C9ABFCC, 1879},
-{0x155D546C240169DA, 5854},
-{0x155EFFE9C7E73B33, 516},
-{0x155FE48F5EE1B37D, 546},
-{0x1560737723F7D8FC, 329},
-{0x156073C47D0633D5, 2679},
-{0x1560AC872AEAF10B, 349},
-{0x156399188B163DAD, 13884},
-{0x156444690E8E303E, 2497},
-{0x1565D99AA0076711, 274},
-{0x156746A555721E39, 265},
-{0x15694D51355E8499, 7965},
-{0x15697F6B08786932, 593},
-{0x1569B7EED5C429AA, 364},
-{0x156B9FF6547F3E7A, 753},
-{0x156C4BDA20987620, 913},
-{0x156CBBB02B2ECE85, 258},
-{0x156DB3BF054F685A, 214},
-{0x156F225AEC4EA50B, 598},
-{0x156F94549F735604, 244},
-{0x157014686491B56B, 1154},
-{0x1570BA8AE5C2DF22, 363},
-{0x1570ED09E05776E4, 570},
-{0x157193A07B11E4D1, 564},
-{0x1572E3D1FD232CD0, 3950},
-{0x15732D687BA7F048, 337},
-{0x1575A488F9C8A8D8, 506},
-{0x1576996E8A4B9391, 256},
-{0x15787B70BBF532E4, 259},
-{0x1578D58E92397E89, 227},
-{0x157CBF6A7441B0AF, 346},
-{0x157EE1CFCB2BFA24, 657},
-{0x158391A7B9024FDB, 414},
-{0x1583C4BB8434E2E9, 770},
-{0x15851D215BAF443A, 217},
-{0x15851F4565959443, 239},
-{0x15866A38E54C0C7B, 246},
-{0x158759A616C0E343, 202},
-{0x1588891755C56345, 220},
-{0x1589308D1D9E0AA3, 278},
-{0x158A32385DA2A2D3, 2561},
-{0x158A859627E7FB71, 203},
-{0x158AC2591D99953A, 246},
-{0x158AFE0BF8E5E6B3, 543},
-{0x158CF7271E6A16A2, 2338},
-{0x1591B36B07FC5FE0, 261},
-{0x1592456DD580E06D, 699},
-{0x15944F9359250701, 273},
-{0x1594A40A917ECE8D, 495},
-{0x1594AA05B789EA54, 446},
-{0x1595D798E167815C, 373},
-{0x159882E3B8167AC1, 1207},
-{0x159886454779F786, 510},
-{0x159AE11E8BB087C6, 236},
-{0x159CC9761FA2BAD2, 467},
-{0x159ED172F632DCC0, 215},
-{0x159ED2E81DD60CAE, 234},
-{0x159FBAB28469D7C7, 503},
-{0x15A07CA1A71EC4F0, 758},
-{0x15A440F465079850, 249},
-{0x15A4C6E2F0418E05, 569},
-{0x15A4FBA6716A5155, 527},
-{0x15A5F5856B7F7222, 203},
-{0x15A751BD33764103, 732},
-{0x15A7C8BCA0626C3E, 423},
-{0x15A8C3FCCD5EBADA, 200},
-{0x15A97E2FC71F45E6, 304},
-{0x15A9903ED238B7CC, 343},
-{0x15AA8CCFF7F39D1C, 206},
-{0x15AB91ED701F59D4, 283},
-{0x15AC969C5B51477C, 256},
-{0x15AFE7B1753329AC, 1677},
-{0x15B027E404335A23, 200},
-{0x15B4162A2A946C2D, 211},
-{0x15B439FCF5D6B952, 204},
-{0x15B54DF6727114D9, 315},
-{0x15B56E590C491BED, 363},
-{0x15B76FF3B97E814D, 397},
-{0x15B8E530B5B9C86E, 287},
-{0x15B92BE7C2C4DF7F, 242},
-{0x15BC5674FD879FE5, 987},
-{0x15BDE2D6FC961D4C, 609},
-{0x15C07B8489A89A19, 234},
-{0x15C15731807C7820, 328},
-{0x15C2040ED2E73C40, 258},
-{0x15C35E597BE36F94, 205},
-{0x15C53FD7A8FF9DE7, 269},
-{0x15C774FA67A849F1, 781},
-{0x15C7A75F118EC895, 207},
-{0x15C97E16F67F89A8, 688},
-{0x15CD3400D7A7A967, 247},
-{0x15CDC74BD618E28D, 282},
-{0x15CF7249C2046536, 396},
-{0x15D084FB294331CD, 823},
-{0x15D0DD89DAA80E8C, 231},
-{0x15D30BC75EA9E987, 335},
-{0x15D58019F7F6532B, 248},
-{0x15D5FE386B2FEA81, 437},
-{0x15D818995F9B100E, 2927},
-{0x15D9C54E5FB33FDD, 1368},
-{0x15D9FB50A0F5B99B, 1640},
-{0x15DC1C4455F4CC02, 397},
-{0x15DEE676E92F7922, 1265},
-{0x15DF3274192D5307, 509},
-{0x15E08E2F0904D92E, 286},
-{0x15E4BB24A4F0C98D, 5332},
-{0x15E9E2B36CB98DF2, 524},
-{0x15ECCADFF3BEB3ED, 289},
-{0x15ED60BCEE54E74C, 377},
-{0x15EE166ED7D85E38, 4700},
-{0x15EF373DA68FA58E, 212},
-{0x15F26F4EF8E8DFFD, 289},
-{0x15F296405D79F3E5, 710},
-{0x15F6E093D2CBC1F6, 611},
-{0x15F7C292116EA1E5, 251},
-{0x15F94D93D41B6D57, 569},
-{0x15FCEE55D10B8BE5, 984},
-{0x15FD28416B028A34, 861},
-{0x15FFAE1D0DEE90AF, 3863},
-{0x16009A8944BC10A8, 18582},
-{0x1601DB1F239481C3, 1713},
-{0x160253EFF1A79C8D, 201},
-{0x1602949178D292BD, 214},
-{0x1602DA1880DE63BD, 426},
-{0x16030573A5A4A92E, 774},
-{0x1603D99B8EE56449, 303},
-{0x1604A5530605A087, 776},
-{0x1607F4D26246F9E7, 599},
-{0x1608A2F767D58CD3, 450},
-{0x160A4E60D955865F, 256},
-{0x160A80E2F72D07ED, 467},
-{0x160B3B429D82275B, 235},
-{0x160E4F808D3C1DC3, 205},
-{0x160F17705152929F, 806},
-{0x160F1A81DE608529, 2388},
-{0x16108693AB6298AF, 2777},
-{0x1612CE080A0D752F, 460},
-{0x1615005EE5BCC231, 245},
-{0x161AA1D0ECAA7D9E, 1105},
-{0x161AE0F632E4F218, 400},
-{0x161BBF5857E91A76, 260},
-{0x161C9865E6E55063, 7630},
-{0x161FFEB7FF7E00B3, 1026},
-{0x1623D5EE9D9034FE, 510},
-{0x1624522D6F67BDA5, 407},
-{0x1626AC94ADBC3D9F, 302},
-{0x162736D78D951BD7, 291},
-{0x16279E44AB79DA75, 5617},
-{0x162A679129027961, 309},
-{0x162AB8C278D58B18, 302},
-{0x162ABCE9F4854F0F, 729},
-{0x162C75DC673C0CE1, 2187},
-{0x162D1FD1C2379DAE, 355},
-{0x162FE53A69372C9D, 345},
-{0x163011360210FF86, 301},
-{0x1631D9F94DD88518, 239},
-{0x1632666E16A33862, 606},
-{0x16350B64AAFB7B94, 494},
-{0x163695E8F17CC827, 540},
-{0x16382F133EDB5C30, 757},
-{0x1638DFB9E470EEEE, 825},
-{0x16393457D03BD626, 5219},
-{0x16396A07FA08BC5D, 928},
-{0x163AAC5C19BA003D, 224},
-{0x163ABE8CB50441C5, 216},
-{0x163B4444F357586D, 276},
-{0x163C134C606B74CE, 275},
-{0x163D8D34DEAD975A, 503},
-{0x163E17CDCF972D05, 934},
-{0x163E5AF90A31627C, 403},
-{0x163E7C03760929D1, 489},
-{0x163F3E4257770CA5, 216},
-{0x1640E767EC08D7FD, 392},
-{0x164115E1B79483D1, 254},
-{0x16411939BF32A3D2, 960},
-{0x16427827F5140EBA, 205},
-{0x1643C40E9615D44B, 315},
-{0x16440DA99D47A47F, 978},
-{0x16461FA439A08F7C, 347},
-{0x1647FFE064158DAD, 314},
-{0x1647FFF210887F84, 167461},
-{0x16492E746E0EF783, 856},
-{0x164A9F1100373B9E, 558},
-{0x164B0A508CA169B7, 950},
-{0x164B96E8B2D20406, 443},
-{0x164C16F2038D05B4, 232},
-{0x164D04AB30823508, 292},
-{0x164D1861B7F06400, 1531},
-{0x164DB6D8A778D14C, 219},
-{0x1650CB466C58AFC8, 701},
-{0x165196F1EB02F440, 571},
-{0x16523FF972C51ED5, 230},
-{0x1653A6F75354F13F, 884},
-{0x165480CCACDFBD36, 201},
-{0x1654C57786E0E253, 395},
-{0x165530BFD67BE9C6, 1479},
-{0x1658AA9C76B3E12D, 448},
-{0x1658B93CC365F349, 783},
-{0x165967F3E0BD31A2, 323},
-{0x165A16698F88044B, 369},
-{0x165ACA9969CA898D, 1882},
-{0x165C1764B9B5F93B, 258},
-{0x165CE58A7C45493A, 307},
-{0x165CF207A9865489, 386},
-{0x16633D8CB82DF2DC, 210},
-{0x166549B718500D4E, 212},
-{0x16666EFE0A431491, 325},
-{0x16687FC114A012BC, 446},
-{0x166924EBD99D65F4, 256},
-{0x1669AC05527F74F8, 204},
-{0x166BBFF4E97F6EA7, 356},
-{0x166CB231DA6DDC76, 27918},
-{0x166CDD26A0CAA4B7, 695},
-{0x166F8A7B40EEA387, 418},
-{0x16706EA7229D43F6, 1219},
-{0x167159D3E0E85FDA, 351},
-{0x1671E571675B4A77, 368},
-{0x16725F3D3409CEE1, 215},
-{0x1672D8B8E29FF4B0, 297},
-{0x1674E4D6F5C0DFFA, 228},
-{0x1675E6A2FE6D1B20, 383},
-{0x16762B99F1C1E520, 304},
-{0x1679068CD2D57CFF, 304},
-{0x16791F98CC662B75, 2002},
-{0x167A17D435E92BC8, 414},
-{0x167ED2922FE2A3BB, 260},
-{0x168288342B0EA1E3, 731},
-{0x16831E6282CF035B, 592},
-{0x16860588E53B160E, 1157},
-{0x1687B4580421A225, 477},
-{0x16885463B9C212F7, 431},
-{0x168A51038279897D, 296},
-{0x168D7D01FDE7A5DB, 396},
-{0x168D88340EA919F8, 208},
-{0x16905989ADED6C57, 381},
-{0x16951FC597581D12, 473},
-{0x1695B27D682EDC0C, 247},
-{0x1695D64DED4D0140, 229},
-{0x1696C125B9CCF719, 228},
-{0x169781F2FA6ECC93, 304},
-{0x1697F9640B33DA12, 552},
-{0x1698B6EAFC7BF672, 1503},
-{0x169BBBCE289B2410, 247},
-{0x169EBCBF4053982A, 542},
-{0x169EE596F1422ED8, 387},
-{0x16A25C58BAE4EC9D, 2370},
-{0x16A34E32C0AFBD9B, 512},
-{0x16A3A3D48086EDCF, 273},
-{0x16A42A0735FAB44C, 393},
-{0x16A690F385B45777, 259},
-{0x16A73C43CA843E1E, 846},
-{0x16A98FF7B64FFD84, 335},
-{0x16AA5B6A76B4194F, 340},
-{0x16ABC3456E0F6A33, 332},
-{0x16AD77D084D4E333, 229},
-{0x16AFE82393213CEB, 931},
-{0x16B203B23D6B49BA, 2665},
-{0x16B411519A65CF90, 540},
-{0x16B43EC32A8F0CB3, 200},
-{0x16B5733B54878162, 235},
-{0x16B64CB7801872D9, 10567},
-{0x16B743CABAECB90F, 539},
-{0x16B8137EFBD2A16F, 262},
-{0x16B8BA1C07F0163C, 222},
-{0x16BD239A9475D0FE, 349},
-{0x16BDC052063A4C12, 2192},
-{0x16BDF4C367B5B79F, 650},
-{0x16C03DE159055550, 510},
-{0x16C0C8FC51FD167C, 2853},
-{0x16C14E474666C3DC, 410},
-{0x16C2E0C38E5734E1, 956},
-{0x16C33878EDB3786C, 285},
-{0x16C35334D8A77732, 1070},
-{0x16C40E94F5989AC6, 257},
-{0x16C4CF7A60C65EF2, 264},
-{0x16C571D1C9BEB49B, 253},
-{0x16C9E25C5395732D, 3324},
-{0x16C9F15C00C41CEE, 224},
-{0x16CC85928FEB6539, 550},
-{0x16CD1386EED21355, 395},
-{0x16CD13C7DCAE6375, 205},
-{0x16D02C7186631AC5, 275},
-{0x16D1573B61D2B49C, 277},
-{0x16D2D119130DB02F, 3470},
-{0x16D420173F6C46DB, 212},
-{0x16D50A58A16DEB89, 253},
-{0x16D781DF8464C9CF, 212},
-{0x16D9446B3DD43FB2, 222},
-{0x16D9F89A28F4CB1C, 983},
-{0x16DD0054C635C9E5, 202},
-{0x16DD1B1D21850D49, 201},
-{0x16DE7A76938A3DC5, 226},
-{0x16DF5A1006C5AC54, 294},
-{0x16E0A1A36D049BD8, 206},
-{0x16E35CE857A23831, 368},
-{0x16E4D37170FBBD42, 374},
-{0x16E5BF12C771CC09, 882},
-{0x16E7ED013C0A1855, 2523},
-{0x16E8E046929F8121, 430},
-{0x16EAF55507C7A0AD, 1129},
-{0x16EB3D85BFBBFBCB, 214},
-{0x16EC85450D910048, 230},
-{0x16ED50C85731C218, 2045},
-{0x16EFA64F97DB4E6B, 4053},
-{0x16F13F8DA9BF3C05, 378},
-{0x16F1BE150FEEAD71, 524},
-{0x16F34466FEFA80B5, 625},
-{0x16F386F46B230FAF, 618},
-{0x16F5260967B06FFF, 466},
-{0x16F6D152C0E12F41, 477},
-{0x16F78A97A8001AE4, 224},
-{0x16F8A32626826579, 367},
-{0x16F907199F5DB080, 203},
-{0x16F9799ABCB56096, 1201},
-{0x16FA6A6BBBD7EAAA, 256},
-{0x16FB920CCC920910, 796},
-{0x16FD56FB0A14A10B, 307},
-{0x16FDB6E7D59BEBB7, 5027},
-{0x16FE18D82717F8D8, 233},
-{0x1700C0DB0EBA07BE, 263},
-{0x170223D21850FA59, 305},
-{0x1702468A74AB4B90, 1048},
-{0x17045D413F520AF9, 336},
-{0x1704B1DE800B90D5, 1117},
-{0x1704F5CA5E9262F5, 1308},
-{0x1706FF170CAC4BFA, 713},
-{0x170881318013F9F1, 242},
-{0x1708ECC0478C88B6, 262},
-{0x170943EC119BA214, 376},
-{0x1709E9ED47EC1D86, 333},
-{0x170AA6E27DD7FE28, 377},
-{0x170AB9E2CA69676B, 209},
-{0x170B3B476CCD7B26, 1240},
-{0x170B68E34270EE4E, 745},
-{0x170B930849E5558D, 383},
-{0x170C476F5BF0B929, 329},
-{0x170CE0EB730A3F8D, 290},
-{0x170E8DCE555EBC7E, 303},
-{0x17133770B92C09D6, 385},
-{0x1713E1E141E2E823, 375},
-{0x1715078A982C00EA, 218},
-{0x171973A20E5CE38E, 438},
-{0x171AE666BFA5A998, 210},
-{0x171F7E7DF456D93A, 821},
-{0x171FD6781A5C5BCD, 518},
-{0x1723909B0B8CF763, 327},
-{0x17286EFA56CB6975, 247},
-{0x1728ED5284F35FBC, 265},
-{0x1729D04643D357EF, 692},
-{0x172AC34908D646DC, 1832},
-{0x172C3ABAE973B7B4, 306},
-{0x1731C783D0638CE7, 388},
-{0x1733E2BBD937D743, 288},
-{0x173437C0CDBFE066, 256},
-{0x1735597E6EEE8477, 227},
-{0x173621D0435BA213, 4546},
-{0x173730D201475828, 428},
-{0x173882392275237B, 419},
-{0x173995D0F267207D, 810},
-{0x173A4FAA97E1C19E, 983},
-{0x173DBA1A3B584D94, 2342},
-{0x173DBE920E4331D5, 384},
-{0x173E8C1316FEBEFD, 227},
-{0x173F634B5B00F381, 498},
-{0x17432FC6F369ED4D, 558},
-{0x174596E381B60389, 336},
-{0x17480C733F8CC17F, 200},
-{0x174C043D4558007A, 235},
-{0x174C99B10343DD36, 849},
-{0x174DB9742116520B, 510},
-{0x174E52814825A44C, 214},
-{0x174E5C26413718B4, 248},
-{0x174FF4E3596AC9FA, 337},
-{0x1752A3BC84C396C7, 423},
-{0x1752FDCF96D453E3, 234},
-{0x17535BD4BE364C1C, 717},
-{0x1753E3EC3642124E, 255},
-{0x1756E84D95310163, 717},
-{0x1757646F7F01171E, 213},
-{0x1757EBED359B5AAE, 893},
-{0x17598F8BFEC8AD83, 318},
-{0x175AE1724E229B4E, 204},
-{0x175BD1FCDC428E6A, 1345},
-{0x175EAE65EAE3B3E3, 418},
-{0x175F4EDD4B3E060A, 251},
-{0x175F7C9DAEA3618E, 244},
-{0x17616285AF6061CE, 462},
-{0x17649D6358846886, 249},
-{0x1766D2FDD76083C7, 1192},
-{0x176740BA206D6056, 1033},
-{0x17698BEAA1A2823E, 348},
-{0x176A0DA220154A1D, 201},
-{0x176AA948A0924ED9, 578},
-{0x176DD051C56CA511, 862},
-{0x176E2B8AEA73A2C9, 448},
-{0x176E89431A8EA9D7, 854},
-{0x176F0DD2477AC72A, 1397},
-{0x176FB7BB751AA478, 268},
-{0x176FBD5D4B8921AD, 228},
-{0x177049439EE0B31B, 414},
-{0x1770EB3190621869, 662},
-{0x1773E7B06035F8E0, 260},
-{0x1773FD83462D7571, 218},
-{0x17741D2EA6E5C69F, 271},
-{0x17742E000BE7D02E, 2832},
-{0x1775A267ED0F41AB, 270},
-{0x1776F78641664ABF, 531},
-{0x1777013AEEFB67AE, 820},
-{0x177732FECA5ED814, 8185},
-{0x177871FC290CAAD7, 809},
-{0x1779D182D0C8BD33, 3785},
-{0x177AFC2219EB4171, 581},
-{0x177BABA2E2DB740E, 607},
-{0x177C54C580AAAE50, 227},
-{0x178122F610DE6779, 1640},
-{0x17818EF7665AEF9D, 232},
-{0x17841576E5E50029, 262},
-{0x1785ED7D5399FAD3, 503},
-{0x17865AB393D2530F, 260},
-{0x1789BD5DA70EABB1, 482},
-{0x178CBF5475960B72, 889},
-{0x178DA1A820AB6F22, 572},
-{0x178DAF9F48C973F8, 204},
-{0x1794A0D0A4FB6867, 12818},
-{0x1795657723BF9D07, 366},
-{0x1795E28B2B8C8EAA, 1118},
-{0x17977BA404954803, 213},
-{0x1799BC39076E705E, 1073},
-{0x179B53AC3CC6532B, 712},
-{0x179B9D8F04E7DC13, 1392},
-{0x179C1A2DCAAE2B6E, 243},
-{0x179C4FD76FCAAEEC, 280},
-{0x179EA675DCF2086F, 6957},
-{0x17A0C2D832F10241, 317},
-{0x17AA15EF15AD5258, 8360},
-{0x17AA1A2E730E805F, 371},
-{0x17AAC276813C6015, 289},
-{0x17AACA8F845B45BF, 1678},
-{0x17AB1B32783156AE, 289},
-{0x17AE9E3DB11BC980, 214},
-{0x17B07ACD699C3C97, 294},
-{0x17B2C0528015D0DD, 845},
-{0x17B3DB7160473862, 13780},
-{0x17B494AF4FBD38AA, 547},
-{0x17B4DEFB57894407, 234},
-{0x17B4F46A9798F233, 573},
-{0x17B660571098BD07, 309},
-{0x17B6C264B24CCE55, 763},
-{0x17B796C0849E8037, 444},
-{0x17B7BA39976E7AEA, 827},
-{0x17B7BBFC9EC2B89A, 478},
-{0x17B7EAA7CB24C595, 248},
-{0x17B9BD80754FF7CF, 1382},
-{0x17BD821DA8AFE818, 331},
-{0x17BE44C226E77CE1, 422},
-{0x17BFE2822C7DAA4D, 320},
-{0x17C08D02948C301B, 351},
-{0x17C261A829162961, 4236},
-{0x17C3024AF9CE7D90, 30380},
-{0x17C42BF6FBD16814, 295},
-{0x17C7411FF4BA7D1E, 612},
-{0x17C8E1A769546AD3, 298},
-{0x17C96FC753E8AD83, 1896},
-{0x17CB427444513FA0, 325},
-{0x17CC4A4838E5ECB0, 1168},
-{0x17D05B41228A031D, 325},
-{0x17D1448137B2D172, 842},
-{0x17D20C6FEB6BCF59, 764},
-{0x17D44180CA828451, 223},
-{0x17D5A9ECBFA9DABB, 996},
-{0x17D6FADBA40E6343, 227},
-{0x17D9F1458A7F1A25, 963},
-{0x17DA69422189F94A, 224},
-{0x17DF2E3EB60A579B, 930},
-{0x17DF6F17BCFC2E3D, 302},
-{0x17E0544D28618A60, 382},
-{0x17E0CBE00ADA484F, 253},
-{0x17E26E3536F287CE, 2983},
-{0x17E2CD185110A2A4, 519},
-{0x17E6718BB3F4D4C2, 559},
-{0x17E87A62694CF973, 205},
-{0x17E9573D5AC6366F, 619},
-{0x17E9A7E206968A1D, 364},
-{0x17E9CC6717C35577, 396},
-{0x17ED2BA4AD6737F9, 1034},
-{0x17EDC3C6D2E14316, 317},
-{0x17EE7D788CA22CAA, 268},
-{0x17EF5DFC9500D158, 508},
-{0x17F0FF5837E2B1DD, 407},
-{0x17F3D99E2E4143D9, 214},
-{0x17F5C4CA6A651455, 389},
-{0x17F5F50B423C89FD, 648},
-{0x17F6DAF667D4B8F7, 991},
-{0x17F788154C5B8196, 276},
-{0x17F79427DA5641F7, 16580},
-{0x17F961A895F53F1D, 539},
-{0x17FCD35888152FD2, 371},
-{0x17FE983E8D98D959, 1277},
-{0x1801EA4F43A14DE6, 302},
-{0x180223CA0A5866C5, 281},
-{0x1802399AA024D74D, 565},
-{0x18028B3A260F8592, 312},
-{0x18038EBF9FBCC01C, 301},
-{0x180613C5C9B9BCB1, 512},
-{0x1806D9A2619CEB6B, 313},
-{0x1807D81A6EE0597F, 411},
-{0x1807ECDD90EE7523, 253},
-{0x180870A1AFC43324, 355},
-{0x1809B4D740DF4B4B, 492},
-{0x1809DCFEC89BC260, 588},
-{0x180AB840EAA8E06D, 282},
-{0x180AFDFF54D4BEE0, 219},
-{0x180B89FCF0E6D7DE, 466},
-{0x180C82EBB0DFF800, 453},
-{0x180DF34DBBAD1346, 436},
-{0x180FD40FC28826C4, 671},
-{0x18103A70826456E0, 236},
-{0x181196EC27812E0B, 478},
-{0x18132577B4FED50C, 415},
-{0x1813BE3C2A31967A, 222},
-{0x1815A00472C95D15, 329},
-{0x1815DA9A80FB51BB, 1671},
-{0x18166BD3B30D0FA8, 367},
-{0x18181FC48DBF7AF6, 1329},
-{0x18182879B31D17D1, 45640},
-{0x18199F94BC9AFC98, 372},
-{0x181A0780D4FA0AA6, 372},
-{0x181B19ED4D7344EA, 1385},
-{0x181B83BB7D200871, 207},
-{0x181BF24C306AEC71, 1688},
-{0x1821B701D0D67BE3, 304},
-{0x1825542946173A1D, 1472},
-{0x182557E4E9CA4F5F, 509},
-{0x18262A5D2830B6C4, 311},
-{0x1826A0F871FA57B2, 296},
-{0x182AD64156DF353A, 200},
-{0x182C0BB5FD164588, 337},
-{0x182F6FCD4978CF30, 564},
-{0x18300F3A79A2C495, 351},
-{0x183130E3A97417BC, 407},
-{0x1837898C83BA3C91, 216},
-{0x183A84725ECB3B38, 489},
-{0x183BE7BC57322566, 320},
-{0x183E13CF0062DC83, 267},
-{0x184049BD7E00AB06, 258},
-{0x184189994569C185, 310},
-{0x18437A548D0C6CAE, 596},
-{0x1843ECD1875B1AE1, 224},
-{0x1844EC14AC0C8067, 206},
-{0x1846965F91F4A359, 607},
-{0x1846E2D6F7950697, 204},
-{0x18482F801261DBE7, 212},
-{0x184CD6334C96547C, 440},
-{0x184D8B0E093C9F6F, 1286},
-{0x184EFCF67B2B9563, 411},
-{0x18536F3765E2E3DC, 362},
-{0x1854900D505F8773, 258},
-{0x18555DEF9BBA2CB2, 273},
-{0x1858155964B8F164, 327},
-{0x185A07BF51425BBC, 211},
-{0x185A558DD727E42E, 248},
-{0x185C9318CACF9265, 331},
-{0x185D8239994C4373, 203},
-{0x185DA973BD0065DE, 367},
-{0x185DB59BC8624556, 307},
-{0x1861D8F3F0F7395F, 610},
-{0x18626FB1A2679D8B, 297},
-{0x186287848B0F6260, 317},
-{0x186425522D2DEC44, 374},
-{0x18687581C37FED48, 236},
-{0x186B3E9AE77EE67B, 220},
-{0x186BFAFC07FF95ED, 257},
-{0x186EF4AD68F81F17, 276},
-{0x186F77B277E0F17C, 1152},
-{0x186FE0AB8DE8B212, 214},
-{0x1871525F35BB3BA3, 291},
-{0x1871739056EC86A3, 336},
-{0x1871BC9B0BB77DBC, 15735},
-{0x18720D96C4A7D3A7, 284},
-{0x187216469A3EAE2F, 383},
-{0x18737A41D98C40AB, 260},
-{0x18744BF5D38ED309, 809},
-{0x1876BDD0B0A62987, 929},
-{0x18788C457D25F2B4, 384},
-{0x187CA45D4CB51355, 308},
-{0x18814F09FE9D96F9, 239},
-{0x18832E5F633BA0D8, 240},
-{0x1883744E61CA818B, 207},
-{0x18850B67249E85F3, 1031},
-{0x188512CCC31A750F, 454},
-{0x18852FFDDF927C38, 268},
-{0x18874F14457667D9, 575},
-{0x1887543633C83189, 1332},
-{0x1888364BBE7566C7, 261},
-{0x18896F84E6982E73, 531},
-{0x188A3A4CFFC9B7E2, 250},
-{0x188BE0F3C497315A, 416},
-{0x188D46E5759F0426, 347},
-{0x18925D609607F84B, 264},
-{0x18938FE310D9AD6E, 220},
-{0x1893F740382F0B61, 364},
-{0x1895CAA98593A704, 501},
-{0x1895EF4318E62E89, 274},
-{0x1898A1CC948F5B9A, 402},
-{0x189971ED5427D77E, 216},
-{0x189DFCF18A3CBCB4, 367},
-{0x189E5980CAC6A657, 1124},
-{0x189EC5003D97485A, 487},
-{0x189F75849999AC63, 207},
-{0x18A1E3B386D0AE28, 235},
-{0x18A407CE85BAC934, 671},
-{0x18A4F4A82E856DC9, 809},
-{0x18A5260079C7FAA3, 229},
-{0x18A5EC3D73837DAD, 356},
-{0x18A75D029EF694EB, 346},
-{0x18A814E95678B502, 244},
-{0x18A8444ACDF970D8, 296},
-{0x18A8F41F25EFB307, 547},
-{0x18AC0CEF74E2FF93, 298},
-{0x18AC763E06608CA2, 203},
-{0x18AD0A895F08CA7A, 355},
-{0x18AE75F6AD7AB961, 282},
-{0x18B06C9BB411A413, 8768},
-{0x18B08113CDD21EA7, 243},
-{0x18B290E1E00C579A, 255},
-{0x18BB77E3C7E21270, 293},
-{0x18BC3C198FFA6728, 293},
-{0x18C1F0D458045D73, 210},
-{0x18C5E9BF5BDEB801, 1459},
-{0x18C85662D3A0F60C, 225},
-{0x18C921806DF53463, 994},
-{0x18C932775C99BF99, 396},
-{0x18CB19BFFDD9DDBE, 226},
-{0x18CB82FD9F5D64B9, 209},
-{0x18CBAFE9D5287981, 212},
-{0x18CC81B1878574A4, 269},
-{0x18CCD18D4C884D2B, 215},
-{0x18D191D91405AE92, 314},
-{0x18D245CD4378249A, 366},
-{0x18D56C15C06AFA92, 3047},
-{0x18D6EFD26DCC25F8, 421},
-{0x18D7A5372970E44F, 278},
-{0x18DF174169957CA6, 375},
-{0x18E141C6AABEAA48, 258},
-{0x18E143B3F8BADC01, 244},
-{0x18E7CDF1CDBB4D1E, 921},
-{0x18EB1320122B50BF, 617},
-{0x18EB6E903BF71B12, 263},
-{0x18EC306F53F503AD, 358},
-{0x18ED8B6B23653BA4, 393},
-{0x18EDA7D4CC3C98BD, 331},
-{0x18EE86F6C370F44B, 2764},
-{0x18F032EB08390D63, 334},
-{0x18F08C10DEBCE679, 1206},
-{0x18F18439FD22F6C8, 1389},
-{0x18F2B86DCCF86526, 403},
-{0x18F33B10A5D4F616, 211},
-{0x18F3C4C8FDA5920D, 417},
-{0x18F3D48C5AE63348, 240},
-{0x18F4381FC523FAC0, 459},
-{0x18F7B5DF3ED25DA7, 293},
-{0x18F86380ACE9A72F, 361},
-{0x18F9C45DEA39778E, 843},
-{0x18FA4F4B4722559C, 273},
-{0x18FC84A2942ABCBA, 210},
-{0x18FD06EB9E04D1F8, 503},
-{0x18FE8FEB6C4B643F, 236},
-{0x18FEFC0D6A4C8899, 3456},
-{0x18FF28F5121FEBD4, 275},
-{0x18FF756F6C5B6EC7, 492},
-{0x19001B32737F7DCE, 279},
-{0x1901B0605E44D066, 329},
-{0x19028BE20D2763C9, 710},
-{0x19046A7C55E3EA2E, 320},
-{0x19052CF0C332BFCB, 205},
-{0x19076ADC38E138C3, 312},
-{0x1909D1D27487E43B, 442},
-{0x19106C5151C0886A, 223},
-{0x1912A8DE8C5658FF, 304},
-{0x191461FC28E91FDD, 321},
-{0x1914D227184C9AE3, 312},
-{0x1915A68DBCFB47D3, 270},
-{0x1915DE5B330F9C84, 300},
-{0x19197C0704185F65, 235},
-{0x191BDFCA03F458EC, 228},
-{0x191D75431812FE06, 311},
-{0x191DF09E551E082B, 290},
-{0x191E4E50C15ECA36, 4427},
-{0x19205D3FC4E58F77, 256},
-{0x1920766564CCAD9A, 308},
-{0x19227C2C861BCA5A, 570},
-{0x192439A70347BC40, 815},
-{0x192463B337128134, 1075},
-{0x1926A01352ECF5E6, 403},
-{0x19279BEAB0E92937, 287},
-{0x1928AC4404E43FCE, 545},
-{0x192B1205FD087709, 237},
-{0x192C4391058BE5F1, 542},
-{0x192C4584C3B1F5B6, 259},
-{0x192DD03B2082E090, 243},
-{0x1930A5B715E73F31, 651},
-{0x193210522A2200BB, 602},
-{0x1933CF517AE1443B, 286},
-{0x1934D0CA648D4012, 313},
-{0x1935D592E76F6F1E, 567},
-{0x193724A0FAD46A2F, 338},
-{0x1939B9C6E920D98A, 219},
-{0x193B282C5E8DE11F, 354},
-{0x193CAAF26898DDB4, 381},
-{0x193CEFB1343C091F, 300},
-{0x193D666C07F55BB2, 437},
-{0x193E0AF3A138042D, 246},
-{0x19405104F95820E5, 213},
-{0x194269A8FA5AFA73, 969},
-{0x19439A9D22E5A08C, 245},
-{0x194505273C7E8EC7, 213},
-{0x19460C22CE068052, 374},
-{0x19469168C73F47F1, 657},
-{0x19469FFFC83940F9, 480},
-{0x1947114BC707248C, 208},
-{0x1947E74CF1568BAF, 615},
-{0x19485989E7EE2047, 484},
-{0x194B080387E930ED, 2565},
-{0x194BD139EDAF412B, 731},
-{0x194DA2ADB242F8D0, 421},
-{0x195042955AF178E3, 97596},
-{0x195173942FAF8733, 341},
-{0x1952ED982A024448, 664},
-{0x1959E32AEEF637B8, 1519},
-{0x195AB96F273999A8, 201},
-{0x195BB011226EB5D7, 211},
-{0x195C009397F7B90D, 1021},
-{0x195DA45BABFEB15B, 286},
-{0x1962B306AA2561FA, 2545},
-{0x1963B0E1E02F9FEA, 665},
-{0x1965CFE6351A8B31, 635},
-{0x1965E484DAD3B329, 239},
-{0x19685570EB57C819, 298},
-{0x19685CAE4D37BCEB, 276},
-{0x1968C03710FBC038, 984},
-{0x19696DF2F49BE0A7, 268},
-{0x19697A4B89F4BE5C, 456},
-{0x196B8B51A2801809, 349},
-{0x196D5A50F8016BF0, 208},
-{0x196E0B3D626121EF, 601},
-{0x196E6D2131B14DF6, 812},
-{0x196E85C1456714D6, 233},
-{0x196F3C2D4B148667, 286},
-{0x19700B7F829BBA29, 802},
-{0x1972825265BBFD9F, 751},
-{0x19745A69D0E4076F, 238},
-{0x197479E0AEC05122, 251},
-{0x1974B980A9FD61C4, 232},
-{0x1977D870545724E4, 567},
-{0x19782F5AD87A13B6, 376},
-{0x197A02541C2054E3, 707},
-{0x197AD6EDA8FF62EB, 257},
-{0x197B5DF386504153, 233},
-{0x197DCAC185C05A43, 398},
-{0x197F58FAE18FD3C8, 598},
-{0x1981EBB7013B9DFD, 1450},
-{0x198B04EA85FA9766, 336},
-{0x198B15B06E56A81E, 249},
-{0x198BE4852F9B57A1, 3255},
-{0x198C845966F28B24, 403},
-{0x198EF93D2921997C, 532},
-{0x198EFED4D3CCFE5B, 218},
-{0x19938B5C5280251D, 369},
-{0x1993D6842CCF90FF, 347},
-{0x1994062C261CCCFD, 269},
-{0x19949E3F3336ECFD, 327},
-{0x199837D8781A4986, 470},
-{0x199A01333CB26C5C, 525},
-{0x199A2D44FFA929D6, 364},
-{0x199CA7DF21129C80, 3346},
-{0x199CDB7A07F51421, 1380},
-{0x199D312977B4DB23, 419},
-{0x199DFD2741BF43AE, 239},
-{0x199E5F6B77FEDA6B, 228},
-{0x199F1356CC6529BD, 314},
-{0x199FB966D762A8BB, 2202},
-{0x19A09C50F7328AC6, 478},
-{0x19A127E87AEA5BD0, 580},
-{0x19A1F7E991135F87, 523},
-{0x19A296F4E2978212, 1517},
-{0x19A44C46F0EAFDAC, 657},
-{0x19A48E05DB449C33, 222},
-{0x19A651C6AF48BB32, 320},
-{0x19A9ABF0AF6CB843, 3891},
-{0x19AC0593B3F63C35, 258},
-{0x19AE38A261D57812, 588},
-{0x19AF696A99571AF8, 760},
-{0x19B0DE63A7F6E829, 236},
-{0x19B1B030DF37D755, 314},
-{0x19B1E7F480032F5D, 471},
-{0x19B40CCBB3506B6A, 1586},
-{0x19B88C94B848263D, 224},
-{0x19B95A15E26B0D08, 457},
-{0x19BB4C89FB4807EC, 983},
-{0x19BBAF7DE936866A, 349},
-{0x19BD43C2AA487F29, 238},
-{0x19C0741E1DC08E72, 293},
-{0x19C16AE09CEEEC42, 389},
-{0x19C1D505E7299590, 227},
-{0x19C1FB6F4B714014, 402},
-{0x19C22603A1A72AE9, 567},
-{0x19C6E16ADBF96681, 282},
-{0x19C7861EEF6E3DF7, 219},
-{0x19C81AAA4CE46E43, 3457},
-{0x19C896AD1942BF49, 3941},
-{0x19CC9D54CC72B683, 209},
-{0x19CDC80EEBE38EDF, 468},
-{0x19CF4CCCA4870969, 200},
-{0x19D0E2065B80F9C4, 203},
-{0x19D1150552D77A74, 297},
-{0x19D1971C03E5CF42, 307},
-{0x19D3BE599749B042, 367},
-{0x19D409CDA53A3BE0, 249},
-{0x19D4985736339658, 204},
-{0x19D4C997846C8671, 802},
-{0x19D4F45845B5F841, 332},
-{0x19D60855DCC9E4D6, 335},
-{0x19D6546E5894855A, 864},
-{0x19D679FAD8416A7C, 562},
-{0x19D72F17F15ADB05, 300},
-{0x19D84F44E0650C27, 1720},
-{0x19DC20A35A40184A, 652},
-{0x19DF932A16521762, 288},
-{0x19DFDDFB46A326FB, 497},
-{0x19E31F3AF820FE36, 287},
-{0x19E396DC9CCB11EE, 622},
-{0x19E3EC3F9B1C0656, 223},
-{0x19E5EC70CEB0E73B, 228},
-{0x19E619990A36AB6A, 345},
-{0x19E703135A882D8A, 258},
-{0x19E73960A9532B36, 442},
-{0x19E8B2A96D5B2834, 273},
-{0x19E9BF288EFAEE10, 304},
-{0x19EB017A15BE012E, 791},
-{0x19EB0FAC19CFEE20, 577},
-{0x19EB167DAD5C7121, 257},
-{0x19EB59BDF464BA82, 2074},
-{0x19EC18A9200E6841, 763},
-{0x19EC7DE23A3D9A84, 1773},
-{0x19ED2217D369614B, 367},
-{0x19ED6D65141D3127, 317},
-{0x19F07EBCFCDFCB71, 2070},
-{0x19F31F657F6964F9, 290},
-{0x19F388460243D900, 232},
-{0x19F3888AD28CA01B, 215},
-{0x19F3891C060321BB, 212},
-{0x19F4E1E916346458, 233},
-{0x19F515806D208A1A, 224},
-{0x19F6D94308AB272D, 771},
-{0x19F72D6563749ADF, 672},
-{0x19FAAD657190C230, 222},
-{0x19FB4F5ECE74FA43, 804},
-{0x19FC6DCBFD8AB54A, 500},
-{0x19FC74133FA91261, 1915},
-{0x19FCCA5A44E0C097, 226},
-{0x19FEB80AE14E247B, 349},
-{0x19FF67C96FDF0E4A, 435},
-{0x1A00F5305905C684, 452},
-{0x1A00FD84719B8CFE, 223},
-{0x1A01D3FF0B46AB5B, 390},
-{0x1A02514DF2FCF3E1, 454},
-{0x1A02CA42698781F1, 214},
-{0x1A057E08C567B2EE, 583},
-{0x1A06BA565063F19B, 646},
-{0x1A06F2F6D13C26E2, 211},
-{0x1A08417BBE3DFFC0, 1534},
-{0x1A0D6A02D2FD8CF6, 1266},
-{0x1A16F7FF2D43773D, 202},
-{0x1A171405C213A208, 242},
-{0x1A1BD6AF1FDA70FC, 218},
-{0x1A1C332C05AAC619, 235},
-{0x1A1D2EF77A6BE821, 1172},
-{0x1A206FE8F560295D, 530},
-{0x1A2452690B9A2093, 243},
-{0x1A25DDF2F3F12AC6, 1358},
-{0x1A2EBF66B3DC5DB5, 218},
-{0x1A2F386C49E56F92, 235},
-{0x1A32E8CE543D04D7, 1035},
-{0x1A33F2EE7F089733, 215},
-{0x1A35952D1E403001, 235},
-{0x1A35C37D4306623D, 948},
-{0x1A37B0C46560A52C, 285},
-{0x1A3AA533DBBACEEE, 291},
-{0x1A3C823A283C759A, 32150},
-{0x1A3CB022D0E48A33, 3117},
-{0x1A3E0ABD7229FEA3, 550},
-{0x1A3E8C262069C94E, 409},
-{0x1A3F9D637E2262D3, 213},
-{0x1A407A0DC1B47E62, 274},
-{0x1A41AD9B1EEFB7FE, 423},
-{0x1A4291911F714C36, 204},
-{0x1A437A0C5A8AD7BC, 1468},
-{0x1A447EE5E7C929A1, 7629},
-{0x1A44D96405326185, 258},
-{0x1A44EA0D8CF0F4BF, 216},
-{0x1A4573629F1CA0B7, 463},
-{0x1A4589F69FC336E4, 216},
-{0x1A46CA005CE2599C, 229},
-{0x1A4842D2E513289A, 228},
-{0x1A48FCA1E2DDF544, 245},
-{0x1A4AE58B8694FDC6, 23250},
-{0x1A4C5856544EEB5A, 334},
-{0x1A4CBE3484FB4386, 352},
-{0x1A4F000E29C13C93, 287},
-{0x1A4F01F1480A49FD, 19656},
-{0x1A5118C81DE9F72B, 324},
-{0x1A525C7A58D0FDD0, 196305},
-{0x1A567D823CF24349, 435},
-{0x1A58294F444E3359, 621},
-{0x1A58ADF21510A064, 973},
-{0x1A5A3D6AAA419A52, 1084},
-{0x1A5A742E7B49D2D8, 345},
-{0x1A5AD2D2FE4EE756, 344},
-{0x1A5BD1F6D6933442, 2373},
-{0x1A5CF4F0F42E0747, 6327},
-{0x1A5D984212A04506, 244},
-{0x1A5E915BD1151796, 486},
-{0x1A5EC83F1E000EA0, 13592},
-{0x1A5FEB2D52353454, 322},
-{0x1A6368ED49BB1FE3, 281},
-{0x1A64CD92213597A5, 320},
-{0x1A66FFFF08B35420, 400},
-{0x1A67EC76776600F9, 4089},
-{0x1A6874DC8A268A6C, 259},
-{0x1A6D8EB229495340, 376},
-{0x1A6F6B88A88D5E12, 221},
-{0x1A6FC5554EE51C63, 218},
-{0x1A70E3F0E5325B98, 435},
-{0x1A751A29AC7150E3, 740},
-{0x1A76427926A0485B, 4046},
-{0x1A76EA796A62AF77, 2451},
-{0x1A76F7D79F841F92, 234},
-{0x1A7705C93C83EBF4, 958},
-{0x1A774ACC35974B47, 365},
-{0x1A77ADBF1874EEF0, 1079},
-{0x1A78192C708F165F, 379},
-{0x1A790DB66FD71674, 530},
-{0x1A796974209A43AD, 360},
-{0x1A799426257D4A0B, 249},
-{0x1A79F23A92975582, 2734},
-{0x1A7A2D57AC501CA1, 241},
-{0x1A7A339AE40D6115, 405},
-{0x1A7A9497EF487268, 203},
-{0x1A7AC65C82831B3C, 245},
-{0x1A7BDE8A85400655, 799},
-{0x1A7D4CE9B13F6331, 217},
-{0x1A81F403C0C30413, 450},
-{0x1A83C81A7EEE157C, 215},
-{0x1A851C267DFB1150, 236},
-{0x1A8527C9A7404AC0, 2948},
-{0x1A87198AF697EADB, 297},
-{0x1A895A384D6ED2CD, 473},
-{0x1A8D190AC2FD1A6F, 471},
-{0x1A8DEB70DF646528, 406},
-{0x1A8DEB94FF5DBE48, 601},
-{0x1A8E168A1E1662A9, 295},
-{0x1A8E8CA81B0D07A4, 1041},
-{0x1A8FEB5934CB0E0E, 1828},
-{0x1A915C92C4F08398, 726},
-{0x1A915FFA712CB9EF, 396},
-{0x1A92680377730481, 248},
-{0x1A95B8269222E1C4, 220},
-{0x1A9740529373AF5C, 224},
-{0x1A9820AECA318389, 211},
-{0x1A985ECA418EC4A7, 1069},
-{0x1A98A1AB83534D2D, 265},
-{0x1A9AD12A0F823448, 218},
-{0x1A9C9CF84C2D176C, 282},
-{0x1A9D171E15D62A22, 296},
-{0x1AA1278173926873, 13991},
-{0x1AA1EC3DC00F9F65, 349},
-{0x1AA33256F347C53D, 250},
-{0x1AA4419B22822FF2, 1117},
-{0x1AA6DD289A1D7C6E, 516},
-{0x1AA6F5FEE93527A1, 723},
-{0x1AA7E1EC8DA057D7, 336},
-{0x1AA94A5AEB1A1281, 274},
-{0x1AAB0EBC820C9C3F, 3535},
-{0x1AAE5FC41F97C719, 5203},
-{0x1AAF827C5EB7E018, 209},
-{0x1AAFBCA914D30328, 228},
-{0x1AAFD8BD1778D1EC, 498},
-{0x1AB03220F21E2FF7, 294},
-{0x1AB0AF37BBC86300, 216},
-{0x1AB1B046BD37F176, 536},
-{0x1AB62774725F1F88, 299},
-{0x1ABA4F3DB058F6F6, 5407},
-{0x1ABB43B16C76EAD6, 293},
-{0x1ABC904885CB127B, 374},
-{0x1ABCB0BE8602DBAC, 234},
-{0x1ABE921EFB978286, 800},
-{0x1ABEB1FF69BCB5B5, 463},
-{0x1ABEB9567E94B3A7, 361},
-{0x1ABFDC035D25A321, 527},
-{0x1AC3D110AD694534, 200},
-{0x1AC7C28F21795AB0, 2203},
-{0x1ACA49A777EDA44A, 311},
-{0x1ACA554FC3F35623, 423},
-{0x1ACFD046ADFC65F2, 352},
-{0x1AD1F40DA686EE41, 393},
-{0x1AD329FC5BC968B6, 958},
-{0x1AD3EAEE3C49702D, 247},
-{0x1AD4E8F5469B69A9, 334},
-{0x1AD50714F05B9F8E, 451},
-{0x1AD58AD0A9FD67C6, 253},
-{0x1AD80ECD6A57C444, 270},
-{0x1AD95DCCBE614548, 602},
-{0x1ADD2111874E2B25, 810},
-{0x1ADD79F2DA1A0204, 3801},
-{0x1ADECDAEF2DEB956, 562},
-{0x1AE2EBD7D539CB74, 955},
-{0x1AE36E62952F8714, 335},
-{0x1AE4C41A94EBB350, 817},
-{0x1AE592C73612D02D, 361},
-{0x1AE97C1BB0349734, 226},
-{0x1AEA5B267759A094, 1847},
-{0x1AEAA72132075A35, 325},
-{0x1AEBAF5A1AD26709, 422},
-{0x1AEC88BB32DC3BE8, 258},
-{0x1AEDEBEBB2E7CC02, 226},
-{0x1AF3D22426E579F9, 320},
-{0x1AF599961C1DAA3C, 450},
-{0x1AF645BCD68DDCA6, 367},
-{0x1AF6F1449410BE91, 1360},
-{0x1AF7D33E35C41BB1, 914},
-{0x1AF80251397B192A, 547},
-{0x1AFA0A2BA0AE215B, 870},
-{0x1AFA8270DB497863, 287},
-{0x1AFAC27761221110, 629},
-{0x1AFCE7C1F4075AF3, 279},
-{0x1AFE692DEF43FFBA, 256},
-{0x1B03924B0593918F, 237},
-{0x1B03B2AF8C09CFD0, 332},
-{0x1B051669B09E06DD, 845},
-{0x1B05656F6B2BF92F, 200},
-{0x1B05F2A8BED76163, 605},
-{0x1B06BF84FB705600, 311},
-{0x1B07610765459E42, 807},
-{0x1B07E1D2107D8263, 525},
-{0x1B08CF7BD7AFF6A5, 703},
-{0x1B0A253FC415DFED, 219},
-{0x1B0B4EAE17AA34E5, 289},
-{0x1B0DAF8840A213E2, 279},
-{0x1B0E26A60E2463C3, 202},
-{0x1B0E5F5063B9874D, 330},
-{0x1B1031AF53048218, 1193},
-{0x1B169573A3288641, 218},
-{0x1B17B468BAE01DC5, 520},
-{0x1B19DE3AD4D26AB5, 2277},
-{0x1B22C5E9FA291417, 275},
-{0x1B29DF5F97687443, 333},
-{0x1B2D65685322B563, 232},
-{0x1B2E3BE2F258AF06, 232},
-{0x1B32E7F6E3FBCB1A, 4710},
-{0x1B33D328B3422401, 376},
-{0x1B345AF64DED34DB, 411},
-{0x1B3520587B433454, 1714},
-{0x1B3765F313C9F757, 263},
-{0x1B38537BF97108BF, 596},
-{0x1B38C70095F65356, 1914},
-{0x1B39D168EB2930F8, 778},
-{0x1B3B9760BE7414B0, 286},
-{0x1B3D24969796906C, 209},
-{0x1B3EA8606A76B8B1, 350},
-{0x1B3FFFBD01E8AB9A, 1308},
-{0x1B4021A5C41B65E1, 228},
-{0x1B406AC81E3DB887, 265},
-{0x1B43D7D86AEE22D3, 289},
-{0x1B447AE8D8E9A5A5, 237},
-{0x1B46AAF52AC6B15A, 364},
-{0x1B475B1DF59B244E, 874},
-{0x1B4A21C2CC1D7788, 418},
-{0x1B4CBB8A47F33D18, 484},
-{0x1B4FCB9886B2C9BF, 955},
-{0x1B4FDA729F8FAC64, 220},
-{0x1B511F27BB1F6F01, 325},
-{0x1B51BB817BE9465B, 522},
-{0x1B533FDDCEABD627, 232},
-{0x1B541794028A1D3D, 563},
-{0x1B5437E9F29F47E7, 208},
-{0x1B57DA46281A0CE9, 896},
-{0x1B580DC3A3361D61, 264},
-{0x1B5A7FB7ED80F65F, 242},
-{0x1B5BA290E4082C9E, 267},
-{0x1B5C2E9CAA1AB4B6, 453},
-{0x1B5C51D18CE809E1, 230},
-{0x1B5CE1A7812E59C3, 639},
-{0x1B5D076A5CDB7F1B, 796},
-{0x1B5ECA3740AA916E, 772},
-{0x1B667F2F25D6CB39, 346},
-{0x1B66F5CD20CC70BF, 1373},
-{0x1B67CCC4E3DEA68A, 380},
-{0x1B68A2B7FCCDA1C1, 486},
-{0x1B6A44CF8151B825, 625},
-{0x1B6BF95B9884A76A, 414},
-{0x1B6C45DCAFF9681E, 420},
-{0x1B733F25905F50D4, 220},
-{0x1B7517506758697C, 7536},
-{0x1B76481AF249C9EE, 269},
-{0x1B78DA16605AA72C, 272},
-{0x1B795AF5135E8CF0, 2193},
-{0x1B835D8AACE6B518, 222},
-{0x1B83EACF6789467D, 443},
-{0x1B84A52C731D8613, 694},
-{0x1B854F0A81C33790, 528},
-{0x1B88F704C5857891, 457},
-{0x1B895FE423F51D92, 6388},
-{0x1B8A6EC3582B043F, 284},
-{0x1B8A7E343E4D8F48, 422},
-{0x1B8A85124BBF1AAE, 285},
-{0x1B8BC792A155CF66, 2049},
-{0x1B8CAFAC47AA79AC, 1853},
-{0x1B8CF2D31E56639D, 470},
-{0x1B8EAD9E98603A00, 222},
-{0x1B8ECE8D3FB4DCCA, 378},
-{0x1B8F297FB70711CB, 2290},
-{0x1B9200BF3F010CB8, 304},
-{0x1B92D081E09CC889, 2710},
-{0x1B93D1AA2AA4FA90, 747},
-{0x1B955A38974B29C9, 210},
-{0x1B95F557C6A33A86, 1591},
-{0x1B9946A6681204CC, 3672},
-{0x1B99F79F0B90E1E4, 424},
-{0x1B9A45583B423257, 1476},
-{0x1B9BA2696A6F9239, 268},
-{0x1B9DE609B9748082, 650},
-{0x1B9ECFF050AC6F6C, 254},
-{0x1B9EF201546EFC4B, 8232},
-{0x1BA007BF4A5D62E6, 835},
-{0x1BA0CA634D47F94A, 421},
-{0x1BA0FD7F5CD6E6E9, 1297},
-{0x1BA187F8623C8A0D, 323},
-{0x1BA66FD2B9992F4C, 1423},
-{0x1BA6B41E5FCAD7FB, 229},
-{0x1BA840A054916136, 573},
-{0x1BA9C41D233F44A8, 243},
-{0x1BAA0D2F26A358E7, 360},
-{0x1BAC1E9E00DC01EA, 424},
-{0x1BACF9D99EB33C4D, 392},
-{0x1BAD2C5AD85764EA, 664},
-{0x1BB0A27D7F9318A9, 3603},
-{0x1BB113061055D7C8, 538},
-{0x1BB1740D2825C788, 236},
-{0x1BB4504BDB9088CB, 291},
-{0x1BB480A40C73A394, 230},
-{0x1BB50333EC184227, 291},
-{0x1BB56A542C591E96, 552},
-{0x1BBDAD1F282C50F4, 491},
-{0x1BBE3BEC0F43551B, 243},
-{0x1BBE7D47245F621D, 452},
-{0x1BC02D2EBE35D769, 262},
-{0x1BC421B1B44F3473, 325},
-{0x1BC8791D718C84C0, 365},
-{0x1BC94AAD64323404, 10668},
-{0x1BD153442B822E1D, 1479},
-{0x1BD1B1AF9CBD5D74, 670},
-{0x1BD2A6862E22C8A4, 216},
-{0x1BD33ED5F4249080, 1440},
-{0x1BD4467BF4841323, 622},
-{0x1BD5A2009F343798, 408},
-{0x1BD5D7414E53E284, 256},
-{0x1BD69AAD4D67A2D2, 724},
-{0x1BD7481A94AC90D0, 365},
-{0x1BD80E49A739E0A7, 209},
-{0x1BD8AE55BC32A848, 293},
-{0x1BD99312FC2C238F, 242},
-{0x1BDBCB718E5985F1, 270},
-{0x1BDBF09978BD8985, 220},
-{0x1BDC0ED76B112C68, 3172},
-{0x1BDE3B4CD348D0A4, 874},
-{0x1BDE3BF29B0C4177, 362},
-{0x1BDE9B7A0244219B, 294},
-{0x1BDFE19DC02EC561, 267},
-{0x1BE05FD6A69C7937, 318},
-{0x1BE07A8E453A6E01, 367},
-{0x1BE0B0F4D7B66854, 909},
-{0x1BE0D0E7CCCC6C6F, 314},
-{0x1BE2A8D93ED785F4, 291},
-{0x1BE32288BCA8A117, 672},
-{0x1BE3662320E58425, 278},
-{0x1BE5197DF038DD80, 2381},
-{0x1BE54080708AC43C, 310},
-{0x1BE71F9DA9232928, 474},
-{0x1BE8D334E238DE47, 291},
-{0x1BEAB191148BD7EA, 242},
-{0x1BEB68ECD93FC7A9, 209},
-{0x1BEB77E55E7CE354, 787},
-{0x1BED8D4AA2DFD897, 784},
-{0x1BEE182B9504ED3B, 411},
-{0x1BEE6E21957B3468, 201},
-{0x1BEEBBB1CFDDE791, 703},
-{0x1BEEF034F1CF7A2E, 358},
-{0x1BEFDB32C1F09023, 205},
-{0x1BF3E9848DC5FF94, 1068},
-{0x1BF7F470999E620D, 517},
-{0x1BF80C99B8248C3F, 221},
-{0x1BF85FC76D9FB8C1, 646},
-{0x1BF8F8887840BFA5, 463},
-{0x1BFAD1749070ECB7, 337},
-{0x1BFBE34BCA12A4D4, 747},
-{0x1BFC8065B06B2A90, 228},
-{0x1BFE6894EE4B84F2, 1006},
-{0x1BFECD083AEA0CA8, 845},
-{0x1BFF2EF55A3C9CE9, 4513},
-{0x1C002DD93A49D121, 275},
-{0x1C00B8F59CF2244F, 378},
-{0x1C0379AB317B5871, 312},
-{0x1C050B3FA3AAD4E8, 236},
-{0x1C0A4CF1423507E4, 2318},
-{0x1C0BA77A6D63E6E7, 475},
-{0x1C0C4CF2C74576A3, 247},
-{0x1C0D36C492D93E34, 405},
-{0x1C0E2395704CDF50, 268},
-{0x1C0EAD34762208AB, 227},
-{0x1C101530F1CE72EF, 237},
-{0x1C11C3DD19B255A0, 362},
-{0x1C12B9C6D53CAFCA, 1349},
-{0x1C13AB8D38A048E8, 449},
-{0x1C14D1BCD56B0B2C, 346},
-{0x1C150F8532D86DE3, 214},
-{0x1C16D227976B3510, 218},
-{0x1C17DAC65AE1EC82, 797},
-{0x1C18F76BF3CCCCD9, 563},
-{0x1C1CB001B2FD8A0C, 1186},
-{0x1C1D7AB6147A14DF, 1157},
-{0x1C1DA9B91E5821DD, 289},
-{0x1C1DDEFBC51499A7, 367},
-{0x1C222B1CC7C473F9, 205},
-{0x1C227C546672836F, 529},
-{0x1C240CD7E32D85C1, 319},
-{0x1C2738C82EBCBB15, 263},
-{0x1C2984F6A8145145, 636},
-{0x1C2A083D5B1E9DE5, 227},
-{0x1C2BB7A223E1B7C5, 431},
-{0x1C2C2E0533C25E8E, 581},
-{0x1C2C2EFDEE01D67C, 222},
-{0x1C2F526719350B8F, 237},
-{0x1C34263BA81DAD7B, 41673},
-{0x1C34FBF324527133, 222},
-{0x1C366F4F7218E08C, 4638},
-{0x1C37696A9A6BBF82, 782},
-{0x1C37BC11B103462E, 333},
-{0x1C3898C6C68EDD2F, 327},
-{0x1C38D44BECB62225, 342},
-{0x1C3AF13D5089EDC9, 208},
-{0x1C3E930278946920, 228},
-{0x1C40AC69A7DCB1C5, 217},
-{0x1C415382DD436BC4, 309},
-{0x1C4333BFD886E770, 562},
-{0x1C4443A239144D79, 497},
-{0x1C4520DBF976B36F, 491},
-{0x1C454249A511EEA6, 297},
-{0x1C454F0D6133EF4D, 803},
-{0x1C455145B4D64BE9, 559},
-{0x1C4725C69E762FE4, 1756},
-{0x1C47ED421E342F1E, 257},
-{0x1C48CFCC153AED0E, 5734},
-{0x1C4B1411C5AC2A17, 8773},
-{0x1C4BA859EE8BFFB3, 433},
-{0x1C4BF0F60DD158CA, 242},
-{0x1C50C7F20624BA6B, 296},
-{0x1C528BE8142EFFAA, 3456},
-{0x1C54E90D310E8CEE, 257},
-{0x1C555B9580CDEAC6, 232},
-{0x1C56241B91926701, 336},
-{0x1C56EB9508F6462C, 286},
-{0x1C57A863DFC245E7, 233},
-{0x1C591E54AE3128D3, 339},
-{0x1C5B91C9C16BA96E, 814},
-{0x1C5E4DCBD9F10EEE, 274},
-{0x1C5ECA2799D91B53, 268},
-{0x1C5FE185A7DECC4A, 416},
-{0x1C6013EFF09052CA, 226},
-{0x1C608108093FDA78, 642},
-{0x1C609A7FB01DB20C, 258},
-{0x1C60B9A1E4E39B53, 277},
-{0x1C65FFD0826C5973, 335},
-{0x1C6682E106EEF170, 367},
-{0x1C688FA039E04134, 225},
-{0x1C6B15DE55DFEB67, 1649},
-{0x1C6B50734DD99A5D, 889},
-{0x1C6C8177D5F4209A, 2260},
-{0x1C6FA5E0CC7D2ABA, 339},
-{0x1C7052E5E4C2E616, 694},
-{0x1C718AE076BCA0F5, 253},
-{0x1C7338D7F8551B11, 266},
-{0x1C7476091D37DC2B, 774},
-{0x1C758EFC07B6E6D6, 645},
-{0x1C7A5919F1CFECDC, 1697},
-{0x1C7D0F2E900E3606, 691},
-{0x1C7D2DE9485C4215, 9463},
-{0x1C7D5C819D964B11, 1071},
-{0x1C7E6979C0E90D5D, 221},
-{0x1C7EF00E39B92658, 353},
-{0x1C80EEDCF0D0869B, 231},
-{0x1C843B7C8CCEC9E4, 213},
-{0x1C8888B0F6E465EE, 575},
-{0x1C89C4E4DE17A10F, 215},
-{0x1C8AD2BF49D9424C, 356},
-{0x1C8B1BC23E8308B8, 367},
-{0x1C8BAB83A5D07E8A, 264},
-{0x1C8C0CE8DBD98EC5, 237},
-{0x1C8F9F3CB5A4EE57, 554},
-{0x1C914D63F1D45C3A, 206},
-{0x1C94A89650C2183F, 297},
-{0x1C94C050BE0C4FDA, 217},
-{0x1C955110570970B7, 274},
-{0x1C95541101E0C4BE, 288},
-{0x1C95EF134E0AF81D, 240},
-{0x1C95F2897890D781, 1096},
-{0x1C964AFC47B5168D, 334},
-{0x1C971EE6DECF3AB8, 422},
-{0x1C98BA4DFF14EB51, 263},
-{0x1C9ADF67CC6B08D6, 993},
-{0x1C9B75FB691610A7, 493},
-{0x1C9C51D4B680EAD4, 562},
-{0x1C9E35081D296418, 574},
-{0x1C9E52E176239F5C, 348},
-{0x1C9ED656B9A3EF2A, 10297},
-{0x1CA05530FF36BF24, 4809},
-{0x1CA44D96E77CAC06, 767},
-{0x1CA6B24C4F03C34E, 356},
-{0x1CA83BC75D8BD7BB, 301},
-{0x1CA8AFE41B228993, 1002},
-{0x1CA90CBCEDFD53BB, 558},
-{0x1CA99308142FC82F, 246},
-{0x1CAADCAF6951CD86, 470},
-{0x1CAB424E1688347A, 630},
-{0x1CAD2823C9EAC7F7, 384},
-{0x1CB082D95E0FC062, 750},
-{0x1CB174799FB188A1, 6895},
-{0x1CB25B74153F9D53, 228},
-{0x1CB273EE24934086, 1088},
-{0x1CB28D36553F536D, 516},
-{0x1CB324FF9152BB2A, 482},
-{0x1CBC3815E88AE41A, 280},
-{0x1CBEE97BFF1F9799, 2800},
-{0x1CBF3210D5E4E05E, 7985},
-{0x1CBFCB376D9A7170, 213},
-{0x1CC015FD4E1DAF0E, 340},
-{0x1CC070859CEDA4E4, 773},
-{0x1CC14B8CF57CF3AA, 290},
-{0x1CC2375E88557F87, 268},
-{0x1CC52A60072C468D, 710},
-{0x1CC592E0C9DC08C5, 1067},
-{0x1CC7A47946350032, 239},
-{0x1CC7EFD8B7FC64BA, 4303},
-{0x1CC837C3E0B948DE, 406},
-{0x1CC9047701F2DA51, 213},
-{0x1CCA0B071BA0FA4D, 1844},
-{0x1CCEA499A628416D, 756},
-{0x1CCF66DE06FBC8E6, 364},
-{0x1CD0897D4C686B47, 744},
-{0x1CD09710DEFD159D, 436},
-{0x1CD0AE715CE9B5F4, 214},
-{0x1CD3D012D48767CE, 773},
-{0x1CD4C52BCD72CADC, 567},
-{0x1CD76C97341A2895, 343},
-{0x1CDAC034947D02D1, 1110},
-{0x1CDB0D392EECED7A, 746},
-{0x1CDCCE165C7ABA8A, 600},
-{0x1CE306B305D0E32B, 300},
-{0x1CE601FE7A2DBA7C, 797},
-{0x1CE7AD3016ADE9FB, 206},
-{0x1CE8C21E4EE78EE6, 374},
-{0x1CF17C1BFD0B55EE, 395},
-{0x1CF224A7319B49E6, 300},
-{0x1CF6B182932E67A7, 275},
-{0x1CF6BF0F0B93430B, 609},
-{0x1CF9BD890B05FAFA, 461},
-{0x1CFA88975B27F5A2, 217},
-{0x1CFF050E1D9193F2, 382},
-{0x1D033DF1DBC6D422, 5345},
-{0x1D038A794871F29C, 1027},
-{0x1D07A29FCAFCA3F9, 740},
-{0x1D087CB29130C0A4, 351},
-{0x1D0A117FC33A8F67, 366},
-{0x1D0A4B73452D5285, 211},
-{0x1D0D07E0B90EB961, 264},
-{0x1D0DF9220ACD6142, 1309},
-{0x1D0FAD291EFBE547, 217},
-{0x1D0FDB4160693F4D, 1197},
-{0x1D119AE56B7DCB9E, 226},
-{0x1D11EDADE7AF940E, 437},
-{0x1D152270B6822B0B, 323},
-{0x1D16DC69C86B38D2, 1921},
-{0x1D18966192994A30, 206},
-{0x1D18EFD371AAD9AF, 1152},
-{0x1D191EE3CCACCFDF, 231},
-{0x1D1DE3D79EA0EA8D, 326},
-{0x1D1E1AAD0854E387, 351},
-{0x1D1EF00026DF41C0, 463},
-{0x1D1F180CE63E4EFF, 236},
-{0x1D20D37ADDE219C7, 301},
-{0x1D21903D03BA9B13, 579},
-{0x1D226B5F25F254C9, 375},
-{0x1D26361890F0CD21, 227},
-{0x1D2759A01E988D04, 281},
-{0x1D29B9C5447F5686, 438},
-{0x1D2A93BDC45D47D4, 424},
-{0x1D2B4BEE26B0145A, 314},
-{0x1D2CC99FAA39D3D3, 245},
-{0x1D2F2467F0E0C74C, 277},
-{0x1D2FFF30F6EC3FA4, 215},
-{0x1D301DD60248DD59, 666},
-{0x1D33333F15B724F7, 348},
-{0x1D34757907640074, 258},
-{0x1D34AD2F2DB7976F, 532},
-{0x1D361DEC0EFC6106, 1837},
-{0x1D36D8F2E589BA4F, 224},
-{0x1D38B5CE72980360, 330},
-{0x1D39C911D1863EA5, 341},
-{0x1D39FF692146E490, 1360},
-{0x1D3A7B45F3358180, 292},
-{0x1D3BCC63A70C22F7, 462},
-{0x1D4351A6265730CD, 324},
-{0x1D43746568C52B67, 305},
-{0x1D439436CEBC1D71, 217},
-{0x1D463EBF802052F0, 944},
-{0x1D4727999B0DC2D2, 348},
-{0x1D47E3B04BF93A11, 312},
-{0x1D47F2670FE70AAA, 340},
-{0x1D491E6119DEA448, 424},
-{0x1D4A61D223F955FE, 387},
-{0x1D4B11BF93C6B8AF, 205},
-{0x1D4C9B077AA8030D, 375},
-{0x1D529AD8D3104CF5, 253},
-{0x1D5373EE6FA6FCD5, 1238},
-{0x1D55D57F8A688E16, 999},
-{0x1D56BEB736F339FA, 309},
-{0x1D57ED0BB7A50605, 432},
-{0x1D5A601CEA60E87E, 2631},
-{0x1D5B381813B1E53A, 497},
-{0x1D5D503DD9C1B3A8, 816},
-{0x1D629C2B93E46043, 288},
-{0x1D62F8F2CAA34E06, 208},
-{0x1D63FDEAF0A86AE7, 904},
-{0x1D6A1EBE76567C34, 348},
-{0x1D6AB5CEFA957E02, 227},
-{0x1D6AF0EBB79A582B, 289},
-{0x1D6E7C6A039B5415, 217},
-{0x1D6EB1A10F704839, 1322},
-{0x1D701C1B23894BC6, 254},
-{0x1D71E3F8A420EAFD, 530},
-{0x1D734C5B855A987E, 1087},
-{0x1D7395365237D2C7, 258},
-{0x1D79C4E518404100, 2205},
-{0x1D7C34ECADF10E4E, 280},
-{0x1D7CDDD6A8755BA7, 424},
-{0x1D7D432A4BC43486, 453},
-{0x1D7E285538305952, 2350},
-{0x1D7F598E6B762216, 327},
-{0x1D8064911EC3BC79, 621},
-{0x1D8186BCC39FBC7E, 341},
-{0x1D85E53463A771EA, 8660},
-{0x1D8739B8911581B4, 610},
-{0x1D8E552407F53B55, 815},
-{0x1D9176FE22A61EDA, 236},
-{0x1D932337523959D1, 293},
-{0x1D942B3B0817000A, 375},
-{0x1D94CD8B598973F9, 350},
-{0x1D94D1EF9820DCAA, 1238},
-{0x1D964C1D0E182CC8, 220},
-{0x1D97CBBBB8E53B23, 219},
-{0x1D9C604826BDB4B5, 406},
-{0x1D9CD8DBAEFFE8FB, 1454},
-{0x1DA58DC725D67BCF, 349},
-{0x1DA6B92EB93BB30D, 540},
-{0x1DA7884B59897AFE, 283},
-{0x1DA81DD4C95F0F00, 241},
-{0x1DACFC4302A030CB, 638},
-{0x1DAE73538DC2C683, 436},
-{0x1DB1473417097D3E, 275},
-{0x1DB41A6520D5CBCC, 579},
-{0x1DB86C0548659321, 213},
-{0x1DB9FDE79C95A3FD, 799},
-{0x1DBC5CAF881DA36D, 2110},
-{0x1DBC60E3B1039DD4, 403},
-{0x1DBE5CC2FC6DB841, 213},
-{0x1DC1BEB9AD5DF000, 1647},
-{0x1DC2A9B70EFE8FF5, 281},
-{0x1DC3D7613E2424B5, 296},
-{0x1DC46FD6C235FF71, 1494},
-{0x1DCBA9B3D70DF5BF, 236},
-{0x1DCC6A36FCDCCC29, 427},
-{0x1DCC93EA103A7FD6, 395},
-{0x1DCF0ED35B0586F2, 774},
-{0x1DD1B673101F7E79, 307},
-{0x1DD393BEBFF98B01, 202},
-{0x1DD584A7519E43F2, 329},
-{0x1DD6D2ACC4968208, 839},
-{0x1DD8069B74D5B890, 247},
-{0x1DD883CAFC6BDF70, 929},
-{0x1DD8BFC1233A96D6, 367},
-{0x1DD9FE6315CFFCCD, 250},
-{0x1DDA3C8E8150D6D3, 1359},
-{0x1DDC069065A9C211, 273},
-{0x1DDD438C586BD2D5, 702},
-{0x1DE07377521FDE07, 380},
-{0x1DE5511FBBF0E173, 246},
-{0x1DE859CF92D18726, 13393},
-{0x1DEAE4D95668F2EB, 419},
-{0x1DEAF7543F85A27A, 988},
-{0x1DED0A4D4DC1D266, 319},
-{0x1DEDDE1730F22492, 327},
-{0x1DF2D319F56AB56F, 2235},
-{0x1DF312C71DBA759A, 1877},
-{0x1DF8B3B3CE47C7EA, 540},
-{0x1DFBD537197A29CB, 2610},
-{0x1DFC1205D247961A, 454},
-{0x1DFC396D378B696E, 233},
-{0x1E00A2D604FE537B, 1810},
-{0x1E00FF8F115B2A24, 265},
-{0x1E033C07E596E87D, 408},
-{0x1E03B933E8849C7F, 254},
-{0x1E06020F60E84FD3, 1795},
-{0x1E0844BC6C811C7A, 710},
-{0x1E0B3108B61E4146, 884},
-{0x1E0BB1474EE78696, 1397},
-{0x1E0D3D3D7D7D6ED9, 258},
-{0x1E0E82A284AE97A1, 637},
-{0x1E10EA1471D98EEE, 322},
-{0x1E12B6A085CB024E, 334},
-{0x1E13373A3FE19D8F, 994},
-{0x1E15F9345B6BC186, 1147},
-{0x1E167624181466BC, 270},
-{0x1E17003095416A57, 1206},
-{0x1E17ED173534C8A7, 564},
-{0x1E182980EFDDA7F2, 260},
-{0x1E1D273477754F6B, 241},
-{0x1E1EECF86B93749B, 342},
-{0x1E1FD5C27A645A1D, 206},
-{0x1E2265DB142E9992, 374},
-{0x1E2361444F06CD59, 282},
-{0x1E23801BF9E9D448, 684},
-{0x1E23CD0DC0FD3860, 379},
-{0x1E24D94A915B3D9D, 480},
-{0x1E26C29D851104A3, 317},
-{0x1E272DA891521BF8, 371},
-{0x1E29B5E4DF6AAE3E, 1064},
-{0x1E2C7AE87AF8D5E1, 1026},
-{0x1E2E0DCBFD43930D, 374},
-{0x1E2E2DCC35A5055B, 885},
-{0x1E2EEC15FD618C34, 712},
-{0x1E3041A5BA392367, 882},
-{0x1E3070F32DA4826D, 885},
-{0x1E360CA49CED3A76, 786},
-{0x1E36A9EDBA6AAF72, 5687},
-{0x1E37CE45B6B19FEE, 213},
-{0x1E38BD97FF86D0E9, 208},
-{0x1E399DF9870E9DE7, 660},
-{0x1E3BD27E63CF287A, 563},
-{0x1E3DDE662B71AA4F, 304},
-{0x1E3FAD523A6E3799, 266},
-{0x1E40B089C9031CFF, 3043},
-{0x1E44636899DF92E2, 638},
-{0x1E462A6CCCBCFBBC, 1087},
-{0x1E4701D682A608DB, 411},
-{0x1E4B83D466F13729, 463},
-{0x1E4C90AC39A64CE9, 225},
-{0x1E4CE5B25DF8268F, 342},
-{0x1E4FCFDB0D30C8CA, 400},
-{0x1E500C5DDB953E92, 294},
-{0x1E538329AD799C40, 204},
-{0x1E542ED2592BD569, 552},
-{0x1E555E9235583693, 279},
-{0x1E586AAFEFF1C507, 509},
-{0x1E5902B38EBEA5E9, 290},
-{0x1E59F9724422CC2A, 284},
-{0x1E5D83FB03064E1A, 307},
-{0x1E5DA4F6D4F2F608, 291},
-{0x1E5DC86541002CED, 200},
-{0x1E5F3DE8C54985DC, 721},
-{0x1E5F7FA2F83A2117, 289},
-{0x1E608FA0964B63A0, 219},
-{0x1E633E1A16743B14, 677},
-{0x1E6358C306128C90, 899},
-{0x1E6538CF892660E0, 247},
-{0x1E65B6FE1FB4BB8A, 368},
-{0x1E65CAA71D7F6A6F, 213},
-{0x1E668C22CE8A2F64, 204},
-{0x1E67457306B62D58, 260},
-{0x1E67A2ABCB29FB37, 311},
-{0x1E686ADB037BE2D7, 248},
-{0x1E6940F87E17D2BF, 256},
-{0x1E697CA44424BEFC, 202},
-{0x1E6A50FED7B7ACE9, 1431},
-{0x1E6CBB2D42C8186C, 3338},
-{0x1E6E7DB13354779F, 223},
-{0x1E6F099AB2462255, 393},
-{0x1E7741C205ABEAC9, 702},
-{0x1E7855D4C1957A20, 627},
-{0x1E79F29A49A09171, 558},
-{0x1E7A38DEEEF03327, 361},
-{0x1E7B9EA4B5D529BA, 1442},
-{0x1E7DBE8EA94136BE, 577},
-{0x1E830EEAC7ADC291, 881},
-{0x1E862CCE0E94C32C, 272},
-{0x1E875F546AB4E321, 282},
-{0x1E88FAD7367EDE38, 208},
-{0x1E89C4A2F5FD062C, 213},
-{0x1E8BC138AFAA89B1, 470},
-{0x1E8CD5EAEB2199AD, 581},
-{0x1E8CFB29DE1DCFAD, 512},
-{0x1E906B2A324B5A23, 1034},
-{0x1E90AA2D1DE1A5B9, 214},
-{0x1E9197F7C5255826, 238},
-{0x1E929E6E99F843EB, 279},
-{0x1E944A4E1E4B0376, 614},
-{0x1E964B9054CAFD23, 275},
-{0x1E97C79FC46BE25B, 618},
-{0x1E984918EC79B347, 378},
-{0x1E98ACD16750E7DB, 212},
-{0x1E9B087FE48FB1C3, 1608},
-{0x1E9C1FB09584594F, 229},
-{0x1E9CA6CD73C91FA2, 451},
-{0x1E9E10A4BE821F10, 384},
-{0x1E9EB0646E8CDF0B, 203},
-{0x1E9F5BC7A2724CDB, 272},
-{0x1EA14C1CBE7053B2, 271},
-{0x1EA19A8C4F2ABB6B, 268},
-{0x1EA3A055F0220601, 315},
-{0x1EA3DBF2FD294BAA, 719},
-{0x1EA5CD7BAEEAE72B, 440},
-{0x1EA63EF814850758, 325},
-{0x1EA75CA3FB7B0271, 2400},
-{0x1EA774A464350C83, 298},
-{0x1EA79A06F740A02A, 712},
-{0x1EA8764880B14CB6, 905},
-{0x1EA9B29D6BC39E6E, 203},
-{0x1EAA2477286FBE15, 1503},
-{0x1EAF6C1F2C05B488, 226},
-{0x1EB174A2A905D62D, 211},
-{0x1EB1B217759B8777, 344},
-{0x1EB2888C23779365, 208},
-{0x1EB33DC2876FDD2D, 290},
-{0x1EB47FAD1101B17D, 212},
-{0x1EB59B6390CA0475, 258},
-{0x1EB6DE332968596F, 433},
-{0x1EB7281801BF30DA, 7017},
-{0x1EBAEC002492863B, 452},
-{0x1EBE0DDE34DD0B62, 701},
-{0x1EBE3FE53CB53D17, 224},
-{0x1EBF9E9A05434E48, 1027},
-{0x1EC0723C6FE8E0BF, 1310},
-{0x1EC082323C7ED62A, 271},
-{0x1EC19D282539ABD4, 1415},
-{0x1EC1FEDD8ACB37E6, 238},
-{0x1EC242F791F3F474, 223},
-{0x1EC24F35774F543D, 332},
-{0x1EC30BB2DD247475, 261},
-{0x1EC499890B989922, 517},
-{0x1EC4F6F04181EAA9, 8023},
-{0x1EC6108CDDD5E99B, 413},
-{0x1EC7068FD886DBE2, 261},
-{0x1EC7B1AE3CB948C8, 947},
-{0x1ECA0DD44C5E5219, 276},
-{0x1ECDAF65DF5478C3, 274},
-{0x1ECDEC0130B205FD, 227},
-{0x1ECE4CBCEE07EC27, 1088},
-{0x1ECEB3154ABBB85B, 319},
-{0x1ECED1A27101F990, 408},
-{0x1ECFA9F384A0561E, 531},
-{0x1ECFF154A75B4CE9, 498},
-{0x1ED114D22D6BCDCA, 230},
-{0x1ED340E6F19BC0D9, 378},
-{0x1ED75DF1082F2D9E, 243},
-{0x1EDDF13282E7EECC, 3994},
-{0x1EDDF5A6BAD40906, 344},
-{0x1EDE179D045E3840, 277},
-{0x1EDE82300D8707D3, 260},
-{0x1EDED0AAE2CEFFB5, 485},
-{0x1EE18DC496E1CCEF, 262},
-{0x1EE2A75EBDCCFA24, 447},
-{0x1EE35795F6279D5D, 262},
-{0x1EE35D5B0BC4DA62, 3932},
-{0x1EE4E861DC6417DE, 520},
-{0x1EE50371C43F371A, 250},
-{0x1EE570D60F439EDE, 373},
-{0x1EE613F273182E99, 227},
-{0x1EEA3960A22B4A10, 288},
-{0x1EED68CB4DAC2811, 374},
-{0x1EEE5F472564E9B5, 299},
-{0x1EF0043E7B2EA8ED, 651},
-{0x1EF1B38FDBC17CC0, 232},
-{0x1EF38C0FF2E3D881, 244},
-{0x1EF8775606339CFE, 1121},
-{0x1EF919CD7EF7561B, 299},
-{0x1EFB154DC853550D, 1100},
-{0x1EFC01EAA5F926A8, 1167},
-{0x1EFD28D7F07E6A63, 227},
-{0x1EFEF787B4C62B7E, 786},
-{0x1F00A6D75EBC2E69, 235},
-{0x1F02BAA2CBA1ED33, 248},
-{0x1F037DCB51B853AD, 839},
-{0x1F0487B4A815ED9B, 3026},
-{0x1F0709CFECAFF8E5, 16054},
-{0x1F07E755B5CF6C61, 6213},
-{0x1F07F7D699C07F91, 4604},
-{0x1F0806E8A6E8D8BC, 14907},
-{0x1F081E4DB77CEDF7, 504},
-{0x1F085E3DBE1102E4, 5365},
-{0x1F095FB92727CF74, 346},
-{0x1F0A065BA860D4CE, 200},
-{0x1F0BD25928D04135, 2221},
-{0x1F0BDA930A23D934, 323},
-{0x1F0F627DEA86526E, 220},
-{0x1F1228808BB7C62E, 205},
-{0x1F12AE65366BD074, 670},
-{0x1F1427F821EE9114, 437},
-{0x1F143457147DCBE6, 234},
-{0x1F143BB5A4D7CC9D, 900},
-{0x1F1530B0B676ECF5, 2330},
-{0x1F178CEC9FCEFBC2, 232},
-{0x1F1A771636B46963, 1866},
-{0x1F1AC1E4F57076B6, 247},
-{0x1F1B94AA8ECBF636, 4244},
-{0x1F1E27B77B49C53D, 225},
-{0x1F21CE430A2AFE2B, 248},
-{0x1F22A8955F05FA6C, 1012},
-{0x1F25E6772E2AE696, 867},
-{0x1F273FA11395F121, 283},
-{0x1F2946B739A0B989, 890},
-{0x1F2A6F1FB274C061, 728},
-{0x1F2C9B2C3FBFBB11, 326},
-{0x1F2D08DF9CAC867A, 1042},
-{0x1F3182AC149D87D9, 246},
-{0x1F32C0D2ACC2CF76, 227},
-{0x1F39DD6ECF7142E1, 293},
-{0x1F3E7D8ECA9A55DE, 248},
-{0x1F3FC44F0110F2EE, 388},
-{0x1F40EEDA8D1437C5, 485},
-{0x1F41D6F67BF06BF1, 242},
-{0x1F425E447D3120D7, 33792},
-{0x1F43A8417A29AF1B, 720},
-{0x1F46F02DE5B66D62, 245},
-{0x1F47AA8D4AA91312, 275},
-{0x1F48277989267F77, 947},
-{0x1F499B63774F6D7B, 1332},
-{0x1F4F0061457A39B1, 681},
-{0x1F52276316AB7182, 583},
-{0x1F564EBDD2FE1138, 580169},
-{0x1F56ABD01F43C68A, 217},
-{0x1F5FB059BF40F337, 1021},
-{0x1F605576DA2CA457, 225},
-{0x1F606973F646BAEE, 357},
-{0x1F649B263F5082A8, 543},
-{0x1F654227A1317662, 205},
-{0x1F661AA8809FFFBF, 291},
-{0x1F665B75C7338D5E, 258},
-{0x1F6A298C5B69C38C, 1838},
-{0x1F6DD5FAE072C7B2, 210},
-{0x1F71407D2B6167F8, 371},
-{0x1F75F5A980A46DE3, 209},
-{0x1F766159E78D7305, 207},
-{0x1F773DC1FE095881, 618},
-{0x1F791383A57CEFD6, 236},
-{0x1F7D31485A74C98D, 285},
-{0x1F7D34BDFA979E52, 680},
-{0x1F7D6D0E7DA9A432, 261},
-{0x1F7DE376BE62E0FB, 213},
-{0x1F7E7204562B529F, 785},
-{0x1F7F07A38F2182B5, 1130},
-{0x1F7FCFBD8426082A, 207},
-{0x1F803B74488A4C41, 310},
-{0x1F80B46A3289D670, 2767},
-{0x1F8229EE0817384F, 664},
-{0x1F826C174751E177, 329},
-{0x1F829861581598C1, 1487},
-{0x1F863D78AC9430DC, 343},
-{0x1F8AEF00ECFEDD5C, 539},
-{0x1F8C9EEF677516D3, 266},
-{0x1F8EA8568AA38B2F, 411},
-{0x1F8F5AD7818308A3, 247},
-{0x1F9058DAAEFABE17, 292},
-{0x1F93FA4E179C75C3, 921},
-{0x1F9909BA4B1430D5, 351},
-{0x1F9AFDA9F2668A89, 662},
-{0x1F9C75BFBC391799, 366},
-{0x1F9D867E3BB74543, 315},
-{0x1F9F271F48264BC7, 205},
-{0x1FA365DF55F8BF6C, 1025},
-{0x1FA3672FF8C277EA, 1227},
-{0x1FA8116DB1764D58, 252},
-{0x1FA91968F31E5BC4, 722},
-{0x1FA9F21B25E14A75, 1200},
-{0x1FABA3A6E1AEAD01, 380},
-{0x1FAC61A138035EB5, 485},
-{0x1FAD9693FCE833FD, 1121},
-{0x1FAE458D57DED2B9, 455},
-{0x1FAE8807DCB91FD9, 1646},
-{0x1FB15E2A322333EA, 720},
-{0x1FB1B1963EF19419, 304},
-{0x1FB1FE54C5037C73, 4860},
-{0x1FB27B4B1B1CF058, 289},
-{0x1FB536F859F963DB, 293},
-{0x1FB7E23E3BA7A0F4, 286},
-{0x1FB839CA1DA7925C, 204},
-{0x1FB8EE967BE84FAE, 288},
-{0x1FB9710BD0A6CD8D, 3119},
-{0x1FBB19A423C86131, 331},
-{0x1FC04D71F0AB527F, 407},
-{0x1FC07A21D1F4255D, 615},
-{0x1FC1E3920238F61B, 2858},
-{0x1FC2F3885A232459, 292},
-{0x1FC448489125208D, 6414},
-{0x1FC5F69FAD167EC6, 321},
-{0x1FC68B1C3B0765FC, 410},
-{0x1FC7D595C6CFA06F, 759},
-{0x1FC99C0EA36F28D1, 201},
-{0x1FCAC98B881538C5, 254},
-{0x1FD79C4A33E4C871, 558},
-{0x1FD7F6E33BAB5152, 297},
-{0x1FD86C5FDF7B07BC, 279},
-{0x1FDA4FF5CB718BB2, 202},
-{0x1FDA87098D796452, 1306},
-{0x1FDA966DDB1F2A2F, 285},
-{0x1FDC9159CFE7AFDC, 381},
-{0x1FE18CECEB23B82C, 242},
-{0x1FE295BB79B9D0BB, 271},
-{0x1FE37FABDBCC2D8A, 325},
-{0x1FE5633E31B26CA8, 477},
-{0x1FE8FAB5833CB54A, 379},
-{0x1FEA1675F601A1A1, 253},
-{0x1FEB5DD8D6315A9D, 2486},
-{0x1FEDEB7DFD813FC3, 549},
-{0x1FEE951A70F9DEA0, 15944},
-{0x1FEEB87D37B00C26, 564},
-{0x1FF09AFA3E311358, 381},
-{0x1FF3A7A57F936A21, 206},
-{0x1FF4E92C499127D4, 275},
-{0x1FF55D8E0665EBA9, 250},
-{0x1FF5A46E04B2E1A5, 302},
-{0x1FF9E3CE228CC682, 213},
-{0x1FFBF631ADA5691F, 3470},
-{0x1FFD290AF9CF351B, 336},
-{0x20058B01062CA7A2, 251},
-{0x20062D627F7F6FCF, 266},
-{0x20072D65F79E4083, 521},
-{0x20086552586758EF, 7951},
-{0x200AEC313223C618, 265},
-{0x200B4714F3EBBEEE, 445},
-{0x20121EAF5F573EAB, 342},
-{0x20125EC44916A6E8, 283},
-{0x2014190C4518F7F0, 291},
-{0x20149C2202100B10, 332},
-{0x20180FE6AD8BDE29, 220},
-{0x201970171D967263, 202},
-{0x201FFE3EE9846502, 292},
-{0x2020D7315F238E7A, 324},
-{0x2020EC46EBB5F9B3, 268},
-{0x20221156BBA08129, 699},
-{0x2028A391DEDAEA36, 719},
-{0x2028EF15F8626313, 428},
-{0x202EB280567D3E6E, 607},
-{0x2032F490FBED0CBA, 289},
-{0x2033BDD69DF2F1EA, 277},
-{0x20369BB93CB49810, 4151},
-{0x20397F74103B1457, 739},
-{0x203A3C91EABFBCD8, 313},
-{0x203AB02C791F540C, 250},
-{0x204130FD4204473A, 223},
-{0x2041E2C3722CB880, 607},
-{0x20422FC89EF211D9, 216},
-{0x20424071006219D7, 342},
-{0x204315C22E5F8E01, 669},
-{0x20431F88C8DBF1EB, 3601},
-{0x2043EB229B11566B, 237},
-{0x2046EF126195481B, 693},
-{0x2048A0400A97F0B4, 268},
-{0x204AF012B726EDD1, 322},
-{0x204C60A763FE74BA, 219},
-{0x204F203001DAE144, 517},
-{0x204FD85F9E54A537, 310},
-{0x2051F95877AC0F23, 220},
-{0x2056B0159795B80D, 295},
-{0x2058C65AD79B58E9, 553},
-{0x205909025A9B5A80, 934},
-{0x2059A217D6BFB98E, 340},
-{0x205B3B49ED0D281A, 2487},
-{0x205BEE74E8145B53, 515},
-{0x205CB8EEE0088994, 1039},
-{0x2061B12AF17F2E74, 731},
-{0x20652DAFD9770AF7, 258},
-{0x20653E141241FC03, 218},
-{0x206830B9D88086C5, 382},
-{0x206C5EAB1678574A, 300},
-{0x206EB550E918E9BD, 230},
-{0x206FDAABCCB50AD8, 612},
-{0x207169FCBF907255, 444},
-{0x207702DAF47FAA0E, 419},
-{0x20777A27E99E49FB, 1409},
-{0x20788BB9176952A2, 230},
-{0x2078A9709CF05AC8, 609},
-{0x207CE10B40144581, 6047},
-{0x207D16353B4EC3ED, 205},
-{0x207D2F1358DDCA10, 1869},
-{0x207D9B9E83AE3B80, 701},
-{0x207DA4E85A520152, 366},
-{0x207DEB9A5A534CE6, 290},
-{0x207FA11AF76B4750, 217},
-{0x20812BF14BEC60B1, 4678},
-{0x2082D48A109FAC33, 758},
-{0x2083DD675DBA56F0, 249},
-{0x2083E7674C30D0A2, 489},
-{0x20856E89201E9B60, 2767},
-{0x2085C8A3453B8E77, 245},
-{0x208641EF022EEC34, 4517},
-{0x20878BD2B0ACAB89, 335},
-{0x20888D4E9AF36C98, 467},
-{0x208AE5D770E65584, 1595},
-{0x208B099C32841532, 255},
-{0x208D5EA573211FA8, 526},
-{0x208D6B67C51EDF42, 242},
-{0x208ED4E03AF2BDA2, 328},
-{0x2090B9EE19EB2347, 354},
-{0x2097EBB55EACADF1, 27933},
-{0x2097FD616A4CD26C, 285},
-{0x20981EAC94977048, 345},
-{0x209B2CB478474D08, 263},
-{0x209D0191101EE7C6, 443},
-{0x209E48A8BFB39FC2, 570},
-{0x20A0D6BBFD8B31E2, 443},
-{0x20A2578558F4244D, 373},
-{0x20A3947AEA95DE5D, 305},
-{0x20A4AB5F49AA3728, 333},
-{0x20A58B89DD12F6CC, 529},
-{0x20A59BC9883279B1, 1511},
-{0x20A90867BAE1C1AB, 1536},
-{0x20A953562B5C77A9, 456},
-{0x20AA0D09C3B514F9, 1016},
-{0x20AEE840B22D4AE3, 4130},
-{0x20B000AAC4A0C872, 541},
-{0x20B150E563A6898E, 244},
-{0x20B17AB2B41CF703, 8762},
-{0x20B1CE3D3B94CE77, 383},
-{0x20B2785A34A12ED6, 856},
-{0x20B3F68E57C0DC80, 309},
-{0x20B4351023FE2E21, 244},
-{0x20B4EE958D965D7D, 290},
-{0x20B6E2DDD4BE1F90, 236},
-{0x20BB8DD67CBD2A28, 296},
-{0x20BC2ACF08C1DD4C, 214},
-{0x20C2B93575BA55D2, 288},
-{0x20C57D25A3118C12, 522},
-{0x20C6218AE90F9BE8, 551},
-{0x20C711CFA9F0B7B7, 377},
-{0x20C778896697FA59, 409},
-{0x20CCDFC4C9D1D73C, 615},
-{0x20CDF464EFD3F0C2, 551},
-{0x20CFA440A5D29788, 258},
-{0x20D4CA7E82B5C1E4, 590},
-{0x20D4E2F0EE05907F, 558},
-{0x20D71A41053560AA, 281},
-{0x20D8B5A6428A70AB, 1974},
-{0x20DD48C064612552, 486},
-{0x20DDD0DA7DBED18C, 239},
-{0x20E26D0C81D2BF37, 3971},
-{0x20E6E6E720836BC1, 521},
-{0x20E72B5E2E08B98D, 1467},
-{0x20EBAF6A7D5EF645, 213},
-{0x20ED0471BE738478, 226},
-{0x20EEEBB966F7E327, 692},
-{0x20F1191DC03A7B4F, 427},
-{0x20F25ED08D5A2FAD, 1192},
-{0x20F40ADF7D1AB07B, 480},
-{0x20F49F121430A979, 1159},
-{0x20FA20D15F713CC5, 1350},
-{0x20FD288A5822C8CC, 765},
-{0x20FE22A726888958, 422},
-{0x20FF1D5E42DACF71, 201},
-{0x2100A0E54169F34F, 659},
-{0x210160E352AB8B6C, 240},
-{0x21037DE088AC7D91, 309},
-{0x210384BDB4B30FF0, 726},
-{0x2106589C6002561C, 671},
-{0x2108E8471C22F504, 200},
-{0x210B09989F1F9A12, 270},
-{0x210C4DBE775BE780, 2056},
-{0x210CF9C757BE0610, 1275},
-{0x21148F852A473C27, 258},
-{0x2118378E18443C89, 4079},
-{0x2119BF53FDF3309A, 400},
-{0x211BAAD1B5DE270C, 310},
-{0x211D671F7C6FE201, 206},
-{0x211E7827B644F182, 399},
-{0x21218C11A73B16F6, 242},
-{0x21235EE4C660E307, 228},
-{0x21248D4854350F7A, 338},
-{0x212924D2B84B12D9, 201},
-{0x212A97BFF3594014, 1558},
-{0x212C037F9242AB81, 355},
-{0x212DB1BB8BF49B8D, 201},
-{0x212F1BA5416FC17A, 219},
-{0x213166B77778F887, 636},
-{0x2132E7210481E7D2, 317},
-{0x2133454CD3C91A71, 246},
-{0x2135E4E271064710, 547},
-{0x213B752D957F9C08, 418},
-{0x213BA9D618F10ED4, 2894},
-{0x213BBB9B9EE64A63, 567},
-{0x213EB755662BCF94, 272},
-{0x21400949F6A3F51B, 232},
-{0x214061E8A70DB3CF, 3670},
-{0x214137266D6D7B08, 243},
-{0x2141623B7D65A026, 810},
-{0x2142A0FBED04A925, 420},
-{0x2142D47EE08915C0, 688},
-{0x2145871484D3D425, 222},
-{0x2145F55C14EF4511, 209},
-{0x2148407D7D46EB4D, 213},
-{0x214A31ED40F7B210, 202},
-{0x214E11DF055EC7C2, 228},
-{0x214E379D8DB007CB, 409},
-{0x214F95CC8C52121B, 381},
-{0x2152A84B2E95AB5E, 378},
-{0x2153695B3F596C5F, 825},
-{0x2153FCE00FBC3C86, 426},
-{0x215529D5D5659A25, 480},
-{0x215576C6DEEBF7C1, 1554},
-{0x21576EDD25CDBB27, 236},
-{0x2157D72A4E9A9C1E, 384},
-{0x2158609FB742557F, 302},
-{0x215AA2B064995283, 767},
-{0x215BE878BE2C5CAB, 499},
-{0x215E9121F0AA7FB4, 1249},
-{0x2160876C00AAB766, 420},
-{0x216107A7DEE2A18A, 388},
-{0x21619AE909F53A29, 232},
-{0x21634D34D5D0658C, 537},
-{0x2164EC420DCC3ECE, 205},
-{0x2165AB7A82B09EBE, 376},
-{0x216A718E60EA62CD, 327},
-{0x216AC917E810412A, 545},
-{0x216BBBFF0126BF58, 11731},
-{0x2173A0CD1E5F6EF3, 220},
-{0x2175657ED13F2DD7, 254},
-{0x21763C9173547D77, 374},
-{0x2177605382CDA31C, 257},
-{0x217C460DCAF8FE70, 326},
-{0x217CFFAA241D1AC8, 203},
-{0x217EED99C747FFE2, 593},
-{0x217F2E0D6CF2BE20, 365},
-{0x217F72C300111A21, 865},
-{0x21806BA564B897C8, 743},
-{0x21809487F0ED6302, 222},
-{0x2183105FC86A4AB3, 288},
-{0x2185724787D9101D, 2076},
-{0x2188F3D1E6010773, 846},
-{0x218BEA1A90FE585D, 3754},
-{0x218CB6A0AB8D5227, 387},
-{0x218D0459C55CEFFC, 249},
-{0x218D1E3E3BCA0CA5, 3339},
-{0x218D5F8E8860CC6C, 239},
-{0x218EA329EB9ADCB8, 249},
-{0x2198A11744150E12, 593},
-{0x219D47913DA865BF, 274},
-{0x219EE103D1F8ABC9, 2196},
-{0x21A1E18FB6B1D7AF, 1774},
-{0x21AB1851F0185C65, 763},
-{0x21ABB4A036BEEC86, 530},
-{0x21ACC05C9EDA1C65, 253},
-{0x21AE299E66BAFB3C, 502},
-{0x21AEA9BF76CFFB24, 240},
-{0x21B09550043C5399, 211},
-{0x21B1ABE31C24EAEC, 530},
-{0x21B52869BA1A41B3, 253},
-{0x21B82794767BF02B, 375},
-{0x21BA5DEC3E4C09F8, 2671},
-{0x21BAE695D4A6CF43, 439},
-{0x21BB5DC2F9523B3C, 241},
-{0x21BC6E1B78D6F425, 415},
-{0x21BC7BFCE3724BCD, 350},
-{0x21BDB63EC23A17BC, 672},
-{0x21C2F26EDF95C159, 560},
-{0x21C8A854EA37C60F, 734},
-{0x21CA1C9CA0A671DE, 1143},
-{0x21CA4BE02A8E2A14, 228},
-{0x21CFCCF889ECAAF3, 249},
-{0x21D13CEAEFCCD6C8, 2365},
-{0x21D25EA6B0D2A77F, 510},
-{0x21D7A5FDDEDA94FF, 426},
-{0x21D85E3666469BF2, 247},
-{0x21DBD3C121A8BC32, 1921},
-{0x21DBF14BDB248D40, 625},
-{0x21DCCC40B8A78C29, 265},
-{0x21DD4F67F01C69B2, 823},
-{0x21DE4D961168C6D2, 213},
-{0x21DF97E254A1C156, 208},
-{0x21E02FC7D5937FD4, 592},
-{0x21E11ED488C31539, 224},
-{0x21E4DE65FADBD830, 2960},
-{0x21E5C2A1057D6843, 346},
-{0x21E5F262DA43DC84, 220},
-{0x21ED0C08B7940C0B, 291},
-{0x21ED70CA4794DBDA, 1454},
-{0x21EE6056628DEE25, 447},
-{0x21EF043AC76D2B90, 383},
-{0x21EF4D010375BA47, 295},
-{0x21F11CB362B399F8, 267},
-{0x21F49EFB75FE7493, 2077},
-{0x21F4B4F87D27BF13, 276},
-{0x21F58949F4F53405, 249},
-{0x21F92F3AD0A60F14, 1377},
-{0x21F99027B2F5636C, 629},
-{0x21F9CC22D136509F, 227},
-{0x21FACBA8F3B3C269, 5307},
-{0x21FB9ACE89BADBDD, 829},
-{0x21FCAE1ADFB9375C, 229},
-{0x21FD086F6C85C100, 304},
-{0x2201641D2B1C029E, 266},
-{0x220595F9425F0176, 332},
-{0x22077C53F2B47ADC, 919},
-{0x220796E143C00AFB, 253},
-{0x220871667718EF36, 226},
-{0x220F03429B1CEE58, 1016},
-{0x220F937BD6E999F4, 1118},
-{0x2210F92DAE8DB0C9, 3096},
-{0x221119CE4ADC9A05, 559},
-{0x2211460AF41B53C8, 1011},
-{0x2211F38872C2A781, 292},
-{0x221553D3EFAA9E7F, 2028},
-{0x2218DA96E59F74BB, 368},
-{0x221A4933BB0055B9, 227},
-{0x221DA5DCB1DC8E11, 239},
-{0x221F5C5331CA4AC9, 773},
-{0x222860D7827A0AAF, 2937},
-{0x222C954B7324E51F, 227},
-{0x222DBE43BFFA98DF, 1560},
-{0x222DEE7FA4182980, 242},
-{0x2231B58EACE95BBD, 416},
-{0x2232407E49616D7B, 202},
-{0x2234F081C8DD61E2, 255},
-{0x22360BE632F68040, 244},
-{0x22380ECA0099A300, 233},
-{0x223B35756F04408F, 399},
-{0x223CE0DCB92DA4BD, 282},
-{0x223CE346FA64F872, 1063},
-{0x223CFC6492DBF763, 938},
-{0x223DB617AE1A73F8, 347},
-{0x22419447C47A2DA2, 224},
-{0x2242D704EC7A8314, 200},
-{0x22436A77B59A7CD2, 795},
-{0x2243F236284EAA24, 532},
-{0x2246B736C15321FF, 817},
-{0x22485FBAB9E2B155, 321},
-{0x2249F5126B659995, 307},
-{0x224BBEAF049CAA5B, 509},
-{0x224DCC2AECC39367, 1538},
-{0x224E77413BD6E392, 619},
-{0x224F3D84D8CDDACD, 237},
-{0x2250D4F34616A2E1, 1974},
-{0x2251661137F8D1D0, 558},
-{0x225232C83455E0A0, 555},
-{0x22525F64A16638C6, 260},
-{0x2252A35DFD5A0DF9, 678},
-{0x225365D67873FFC4, 245},
-{0x22596096D6177696, 769},
-{0x225A387FBC5BD561, 211},
-{0x225A58E1A5135EC5, 438},
-{0x225B243ACB96252D, 359},
-{0x225D943CA638F5CD, 213},
-{0x225E30A24E90D067, 2132},
-{0x225EB8108C0340BB, 226},
-{0x225F2AD6DFE8EB40, 4516},
-{0x2260B06A8F7D7EF5, 351},
-{0x226140B5D4814E4E, 531},
-{0x2261906488CD42EE, 1033},
-{0x2261A1CB7AFAE39F, 281},
-{0x22620B600D8CFD53, 270},
-{0x22641483394FD386, 375},
-{0x22673206CCFF157B, 232},
-{0x226AAA5E9D6EB780, 530},
-{0x226DF9DF8F69C6E3, 419},
-{0x2273F6B3CD613703, 203},
-{0x22740E994831E76E, 293},
-{0x22746F0280E8E81B, 846},
-{0x2275AABD7A56465C, 1507},
-{0x2275C688DB891C9A, 403},
-{0x227916B455A99F23, 365},
-{0x2279F164D1A07E52, 551},
-{0x227B6F48C91FC628, 578},
-{0x227B806264138DCF, 1735},
-{0x227BB44E9D5680F6, 706},
-{0x227C0BC7334A5467, 215},
-{0x227E03EDF250831F, 1234},
-{0x22802B8B1396F4BE, 226},
-{0x22802DDBD7B742DB, 469},
-{0x22808C3EF4EA10CA, 218},
-{0x2280CE8ABC00621B, 419},
-{0x2280EAEE383219F4, 792},
-{0x22810797FF4B6A28, 317},
-{0x2285355DC2AABB43, 427},
-{0x2285DAF5249D2316, 3527},
-{0x2286672A80E58437, 327},
-{0x228AFC3B060A4339, 422},
-{0x228B34E17C64126E, 308},
-{0x22910528047D364E, 317},
-{0x2291329AA8BDD198, 284},
-{0x229303C64950404F, 305},
-{0x2296D039287A0472, 771},
-{0x229824D87FD10C60, 1413},
-{0x2299A8661105CABC, 374},
-{0x229B552A96436950, 231},
-{0x229EBEF38CE27E40, 263},
-{0x22A052D886EC4FC2, 545},
-{0x22A63CA086F422E1, 960},
-{0x22A7BBFC1B8B42E6, 404},
-{0x22AB471D5A78060E, 579},
-{0x22ABC9F7521EC47D, 313},
-{0x22AD2AB92FC956B8, 287},
-{0x22ADF0A1690A7D45, 270},
-{0x22AE4FFDC92DE870, 1387},
-{0x22AF9F5705A9494D, 440},
-{0x22B0BCDE13C3EB0A, 738},
-{0x22B3CD38637B1CDF, 892},
-{0x22B6024E9DCC5C9A, 210},
-{0x22B64CDEAA837F4B, 275},
-{0x22B72271C522B292, 388},
-{0x22B7EC7C3FA588D9, 272},
-{0x22B9084AA570C355, 493},
-{0x22B985804514F130, 758},
-{0x22BB3D847EC2E4C7, 598},
-{0x22BB918EE30F987B, 200},
-{0x22BC120494AEFC91, 242},
-{0x22BC958AB7246853, 327},
-{0x22BD53DD90BD309B, 258},
-{0x22C074AEE045872D, 263},
-{0x22C301C4BA67BAEA, 225},
-{0x22C6723328A11691, 323},
-{0x22C85D8BC43427EE, 978},
-{0x22CB39EBE9C1AF0F, 417},
-{0x22CFA4B6961E9E8B, 371},
-{0x22CFAF78EB442AE9, 739},
-{0x22D0C84EB73AE5DF, 257},
-{0x22D2F7AEED8C7D0D, 899},
-{0x22D6B7366EC60D1B, 3203},
-{0x22D89A56515D6334, 1858},
-{0x22DB5C33FD0F0FA3, 1165},
-{0x22DCB4C6F492B847, 681},
-{0x22DCE738557AD714, 211},
-{0x22DF6FE008F21D44, 209},
-{0x22E3A4290E61FB70, 220},
-{0x22E4B1447ABA948E, 368},
-{0x22E524E76F48A4E0, 316},
-{0x22E596F25087F8CA, 707},
-{0x22E9D0F9F26EEF30, 1861},
-{0x22EA47EC93AA6DF4, 2231},
-{0x22ED90A486D00A40, 457},
-{0x22EF9757252615CA, 1319},
-{0x22F2E6CBE1150894, 572},
-{0x22F3D2E8A9B82C61, 203},
-{0x22F52E12B62E2AAE, 424},
-{0x22F60D6F182A2A5E, 213},
-{0x22FACC8F46EE25B1, 348},
-{0x22FBAD9E39C8545D, 497},
-{0x23029C2CB98FAED0, 1275},
-{0x2303EA5D583E5E5B, 222},
-{0x23040E3D754BF916, 262},
-{0x23041023BE936900, 1749},
-{0x2307D12A3F1105FF, 501},
-{0x230870A68CA23561, 601},
-{0x2309EE96DBB9A952, 15928},
-{0x2309F53081C4A7A6, 307},
-{0x230B7D59ACC9B9F4, 792},
-{0x230BCCED8C2B6FCD, 223},
-{0x230D61531FCA8F2F, 444},
-{0x231830B2BD1F5BD0, 1730},
-{0x231D6DE7A305F65C, 944},
-{0x231E576BF8CA6049, 2619},
-{0x231ED2D69080602F, 3742},
-{0x231F7F474460E9B9, 277},
-{0x2323015A65540F3E, 788},
-{0x23249FB2DEBCA915, 362},
-{0x2328A75ED0C26DD6, 541},
-{0x2329BFC47B2FE949, 263},
-{0x232AB0E512D56FEF, 540},
-{0x232B62DF80E53C08, 466},
-{0x232DBF132790D356, 412},
-{0x232DC7DF8C994AED, 362},
-{0x232DE75CD94CCF8D, 1310},
-{0x232F135D3BE7DA7E, 201},
-{0x2330C4E43C06914A, 461},
-{0x2330EC48415AC169, 233},
-{0x233401DA2851F02B, 1442},
-{0x2339B1B811DFD3B1, 425},
-{0x233BD58B8506F2F7, 356},
-{0x233CF91366206612, 3712},
-{0x233D866964605694, 274},
-{0x2340C35D2B7DD683, 499},
-{0x2342E6B4B32800F8, 245},
-{0x2343E03A446B6F69, 878},
-{0x23448FD716E0048C, 474},
-{0x234490F73F26F381, 309},
-{0x2346273EC6E65CFC, 212},
-{0x23475F578EBF86BF, 325},
-{0x2349F3A86B6D8A50, 237},
-{0x234B6FE9B63C1521, 625},
-{0x234D51DE14849F94, 368},
-{0x234DC45839DA2300, 199186},
-{0x235017463E9A67D9, 239},
-{0x235BC5161EBBC991, 275},
-{0x235D392CBBE22656, 303},
-{0x235F57E283B9881F, 228},
-{0x236576E269C69071, 1126},
-{0x2368F26D8CD8000F, 854},
-{0x236F5AE8CD9BA5C5, 390},
-{0x2372C3B9348526A4, 237},
-{0x2372C8E05590BE40, 410},
-{0x23737A1B9F7084F4, 770},
-{0x237874156309258B, 502},
-{0x237924C7D98287DD, 203},
-{0x2379D87CF30389B9, 230},
-{0x237A0D508FBF7371, 557},
-{0x237CA00655468A54, 424},
-{0x237DC4C20E723897, 209},
-{0x23808A4700C9C27B, 285},
-{0x23856C23ECCA5AB1, 15536},
-{0x2387ECC37726C173, 2000},
-{0x238B8E426CA9F987, 544},
-{0x238CF317196C5272, 817},
-{0x238D9ED67EA74841, 285},
-{0x23944533A8E943D8, 257},
-{0x2394BF6A297C105A, 3277},
-{0x2395E8D8418E72D9, 304},
-{0x2397D064859E62BB, 1227},
-{0x23984056E2CF8B2A, 1650},
-{0x239A8C605DAA8F54, 542},
-{0x239C77844C08CB8F, 1157},
-{0x239D77AF59392596, 1164},
-{0x239DF8668B9647FE, 367},
-{0x239E8FD8E9AA80B5, 234},
-{0x23A0BC72C42B149C, 621},
-{0x23A1DF911335D16E, 1431},
-{0x23A25193B44B8562, 2699},
-{0x23A5D71FD1522826, 2549},
-{0x23A6A5FACEDDCF73, 314},
-{0x23A87860FE902C55, 686},
-{0x23AB068703D2A14A, 232},
-{0x23AFBC4B2794BC86, 283},
-{0x23B05D055B4F4461, 552},
-{0x23B0FF3666CF00AF, 629},
-{0x23B17474CE9EFDB5, 205},
-{0x23B17D9A6C9B842F, 282},
-{0x23B27703FAFC9FCB, 278},
-{0x23B35DCCEF85BF60, 238318},
-{0x23B6899DD524E878, 269},
-{0x23B81F23704C4D2D, 266},
-{0x23BC469D212D19EC, 224},
-{0x23BC9FB0E34DAFE0, 331},
-{0x23BE175D3B4B3F65, 213},
-{0x23BFB548C05B1EC4, 1298},
-{0x23BFE610DF85F755, 3488},
-{0x23C04E8A3DF38851, 519},
-{0x23C13A019EC6F468, 1031},
-{0x23C1B77C87539F51, 500},
-{0x23C1C40423A720FD, 219},
-{0x23C1E0F328373C38, 3369},
-{0x23C2B0B17E00A038, 270},
-{0x23C3A195DD245BB2, 272},
-{0x23C77B6C8FFF8069, 1439},
-{0x23C90672513B2B4D, 3844},
-{0x23CCF98E458556A6, 570},
-{0x23D07C8A5EB76B0B, 245},
-{0x23D14E3B255FAD76, 567},
-{0x23D3B6DB24A45206, 1349},
-{0x23D874EA2A69BD19, 276},
-{0x23DD37DCC9ACA398, 234},
-{0x23E297AE06324B7F, 395},
-{0x23E89DD30C63F8E8, 288},
-{0x23E95815D3BF01F8, 3313},
-{0x23EAC7597AF8C161, 5061},
-{0x23EBD24A7EE927B3, 324},
-{0x23EDF28BE2762B38, 201},
-{0x23EFC5B7ECDCC8B6, 438},
-{0x23F137BF5F7301D6, 2683},
-{0x23F291E232DF1122, 249},
-{0x23F36F6B7DA7F2F3, 472},
-{0x23F3F203D1A4465C, 254},
-{0x23F438B7BBB1D04C, 27841},
-{0x23F47C6663593B2B, 3754},
-{0x23F8FBE7816AD130, 244},
-{0x23FF997C628FE7BF, 238},
-{0x24000DA8DE513DA0, 227},
-{0x24007663F4F767C1, 1008},
-{0x24010CA4516F1764, 705},
-{0x240165CF905BF301, 278},
-{0x240389ECDC30C74D, 747},
-{0x2405A67BDA8903DD, 1433},
-{0x2407FB63B1297FF5, 216},
-{0x24083F6087919F77, 1446},
-{0x240A1CCB60BDCF6D, 8687},
-{0x240FE59B02C39E32, 261},
-{0x2410CCAC67DDCBA4, 603},
-{0x2411E188FBC0C580, 531},
-{0x24147EBE357130C7, 212},
-{0x24180C5E54A9DC07, 1393},
-{0x2419AC839985764B, 541},
-{0x241DB86CB6AB9AC1, 1163},
-{0x241E1A838B784C88, 34829},
-{0x241E8CFEDCF6D6C5, 1276},
-{0x2423FA034577477F, 6945},
-{0x2425854C5DA62064, 222},
-{0x2426A4D3D0AC805C, 911},
-{0x242751312454082F, 219},
-{0x2429121C9F66622D, 329},
-{0x242A23623DF044E0, 204},
-{0x242D63AEA7C644CF, 791},
-{0x242E19E2170AE6F8, 541},
-{0x242F32676043439A, 343},
-{0x242F81AF0F292983, 397},
-{0x24331A73FA69A991, 524},
-{0x24348BD6D2F47336, 247},
-{0x2434F3734A8F18F8, 218},
-{0x2436ADF55ED3B74B, 208},
-{0x2436D03D3B8749BB, 471},
-{0x2437EA649AB7A230, 217},
-{0x243C0EF9C034E190, 453},
-{0x243CBD2C5D75BFAC, 333},
-{0x243D2AB6AD084615, 384},
-{0x243D98B8F88E2773, 400},
-{0x243DAA1621ABC488, 202},
-{0x243E5F26D27440B1, 1611},
-{0x243E914AA0DA6C50, 211},
-{0x243ED7AFB894D504, 138381},
-{0x2441BBEC60B40C64, 1369},
-{0x24436CAAC8581AEB, 371},
-{0x2445CB19BC070B00, 870},
-{0x244A83E0BC989D21, 209},
-{0x244E34AD6DECCC95, 37964},
-{0x2451A66941FF2C6A, 1402},
-{0x24550CD46681023C, 257},
-{0x2456842238EC0794, 1175},
-{0x2458EAD46EBED2E8, 808},
-{0x245A863CC581668E, 278},
-{0x245C202C14CA7F15, 450},
-{0x245DF929B8FCD54F, 344},
-{0x245E0CD9FB24726D, 244},
-{0x245FC4383BC095AA, 1777},
-{0x245FCDB5DA65A48D, 436},
-{0x246263CB45738195, 227},
-{0x24646B614A3FF99B, 450},
-{0x2467228292B3EEE1, 336},
-{0x24676DE59027E04D, 297},
-{0x2469278ACBF2ED87, 202},
-{0x2469FF1672110BBA, 4131},
-{0x246A7C4926EECCFB, 346},
-{0x246AA13B95C68467, 639},
-{0x246B40603CA6D0E9, 844},
-{0x246F28960CEA4236, 587},
-{0x24714283B17DA837, 11926},
-{0x247315FEB5E7D4F5, 2367},
-{0x2473EFE86577C6D2, 398},
-{0x2476BBF164D94D3B, 331},
-{0x2477688D3ACEC84D, 778},
-{0x2477F6F84F54DF23, 402},
-{0x2478A31300C49A83, 327},
-{0x2479B2D4ECA0BA28, 270},
-{0x247C2077303A16D9, 260},
-{0x247D444759086252, 19027},
-{0x24807B64E51E6812, 286},
-{0x2482144C9CD842C3, 288},
-{0x2483251C3F2AF2D5, 247},
-{0x2484BFCB4859822E, 247},
-{0x248732C34BBB59A3, 407},
-{0x24887EA836E6FC6D, 2410},
-{0x248C185424D6EEAD, 224},
-{0x248EDEB8CAA866F7, 297},
-{0x248FD19B41AB2D46, 814},
-{0x2493B5BB90D40271, 327},
-{0x24984A66FAB6140F, 258},
-{0x24988DCDFC38B1FC, 600},
-{0x249F3A3074F3DEF4, 424},
-{0x24A00A03F53EA39B, 232},
-{0x24A11217824875A0, 266},
-{0x24A3B6AA18AC5802, 230},
-{0x24A3F80ACE5718CA, 639},
-{0x24A8F126920DCD13, 345},
-{0x24AA76E68139A825, 230},
-{0x24AC3F91E80B713B, 396},
-{0x24AD102F6CE120D7, 353},
-{0x24ADBE70B19839C2, 478},
-{0x24AED8A7DDE3D828, 256},
-{0x24B26453A8469652, 586},
-{0x24BA6FB7F8286421, 973},
-{0x24BAF6D9CC34A7FB, 245},
-{0x24BC0BC80F6B348D, 289},
-{0x24BC3EBD7D44D4F3, 379898},
-{0x24C5EDC6E0F1A019, 311},
-{0x24C68AEBC5421C2C, 993},
-{0x24C941086CB26EDC, 240},
-{0x24CEB3B28ABC599D, 221},
-{0x24CF7959ABB28305, 236},
-{0x24D4BB3EE0C6C70C, 448},
-{0x24D5395146F8E99A, 548},
-{0x24D684EF27B25D9E, 209},
-{0x24DCCE140C3FBD9E, 230},
-{0x24E1441F9AA923B8, 1667},
-{0x24E50985E2FC151F, 264},
-{0x24E801DE61B8EE3F, 218},
-{0x24EAE264DBE973DE, 328},
-{0x24ECA5521D2EE1FB, 395},
-{0x24EE218E08C0C716, 415},
-{0x24EF77DE6DC466CC, 203},
-{0x24F36149F12E3D4F, 456},
-{0x24F388A41EF2FA16, 270},
-{0x24F3EF770600805C, 2556},
-{0x24F4622E71B22479, 311},
-{0x24F6984309D6E17F, 268},
-{0x24F71998A45062A2, 655},
-{0x24FBCAFA3E28834F, 201},
-{0x24FD73707C876F69, 666},
-{0x250396661AA0953D, 374},
-{0x2505F602493DB8F6, 370},
-{0x250CAE01B37035EF, 369},
-{0x250DF2C67124D869, 765},
-{0x250F54E023512ECE, 342},
-{0x250FC17811542716, 498},
-{0x25111AE10BAC5E85, 281},
-{0x25153163975F0154, 266},
-{0x2515C3D11A521B08, 1373},
-{0x251775E48FC0F4F1, 208},
-{0x2519D5A993A530E1, 204},
-{0x251B4876BE457A07, 1428},
-{0x251B4C593E697726, 233},
-{0x251C10091DAAC843, 354},
-{0x251D1AE251538D96, 1220},
-{0x2522E537369FC20D, 371},
-{0x2526A2ABEB8639FD, 1214},
-{0x25274BB729A25B42, 302},
-{0x25285732E62A415B, 867},
-{0x2528D9515F825C07, 201},
-{0x252A7EECB3E95033, 247},
-{0x252C2EF3A2041264, 2377},
-{0x252CFFE038AE331D, 536},
-{0x252E73191FDA5DA9, 267},
-{0x2531828AD4A296B2, 232},
-{0x2534AD7F40B8B56A, 651},
-{0x2537226DE6EF7B19, 615},
-{0x2539C10D52317D31, 494},
-{0x253A718304C647F0, 506},
-{0x253E2630D241AC74, 387},
-{0x253F7B78F2FE8D3F, 443},
-{0x253FD5BACA1A1593, 232},
-{0x25412ED86C5E3753, 26241},
-{0x2542DC2AA86BEB4A, 482},
-{0x25446072C6F674DA, 1717},
-{0x254B8FAA8AC4B986, 242},
-{0x254BA81F66CA3684, 522},
-{0x254E11F9CB87EC26, 282},
-{0x25535A2E7AC402B4, 353},
-{0x25551B750E920BAB, 244},
-{0x25553BEDBD90DC6E, 262},
-{0x2561EE1723F90B80, 267},
-{0x2563ECC2AB97D739, 367},
-{0x2565667BD7C2C6B6, 236},
-{0x2565E714DF93D746, 391},
-{0x2569C23BF0776A8F, 261},
-{0x256A3DCDE493677F, 508},
-{0x256D6B4EF2AF656E, 838},
-{0x256E7C1709F1D81D, 991},
-{0x257026765AEA2C4A, 529},
-{0x2571005FC356A49B, 23020},
-{0x2571608E62B16A02, 404},
-{0x2572598876F6B0E7, 225},
-{0x25725BD82612C503, 212},
-{0x2573033C0F3CAADA, 1908},
-{0x2573918682CD0697, 1794},
-{0x2579238FD9414A4D, 226},
-{0x2579A4639ACBFA25, 5689},
-{0x257A297AE76356E5, 206},
-{0x257B0E301EE2F3D6, 346},
-{0x257EA3FCCB7FAA94, 214},
-{0x2581008723E48D95, 3622},
-{0x25811F6412670FFC, 253},
-{0x258144998095FD1B, 764},
-{0x2581F75CE9C7CC06, 283},
-{0x25832D1258CF795A, 1330},
-{0x25871209A93F0899, 622},
-{0x2587CC9D657CA43E, 259},
-{0x2588969F17A9627D, 204},
-{0x258AC61D04BAE6D1, 264},
-{0x258BE6AFC6618C37, 364},
-{0x258DE46635CB2B25, 397},
-{0x258E9E69F257B4FF, 340},
-{0x258EBF9F3C2E33F3, 366},
-{0x258EC9AF869F95BC, 225},
-{0x258ECBCACB1B1336, 334},
-{0x2590C18B0F4DBCE3, 256},
-{0x259338EE4909AD36, 213},
-{0x2595FF572E1430A4, 226},
-{0x259862B2C5973D76, 328},
-{0x259BF943D575CF63, 353},
-{0x259C071BE8073C4C, 297},
-{0x259CA3C1D617AAC8, 247},
-{0x259D5E0ADA19AB84, 840},
-{0x25A1A6ADFB1794CC, 351},
-{0x25A66C348232D9EF, 302},
-{0x25A6878C166544D8, 355},
-{0x25A7AEDF3DC9B098, 288},
-{0x25A9B46E7D2A000B, 4647},
-{0x25AA69B7373F5CFB, 420},
-{0x25AC9A783CBDEA06, 262},
-{0x25AD0A08394AA167, 1047},
-{0x25B1A587BA94BDEC, 275},
-{0x25B1B9EA7B9A66B3, 419},
-{0x25B464E89565E691, 201},
-{0x25B965FA4933428D, 200},
-{0x25BD127CA4610482, 876},
-{0x25BE8198A7BBC559, 240},
-{0x25C082700BBE395E, 626},
-{0x25C2B78CBDBA084E, 2584},
-{0x25C30C8BDFE3BFF1, 802},
-{0x25C702509E6EA160, 267},
-{0x25C9872864CE26CD, 705},
-{0x25CC19ABE2F0EB23, 236},
-{0x25CE5FF86ADAE604, 704},
-{0x25CF195DC8C11735, 214},
-{0x25D054B6C1C8B818, 453},
-{0x25D5922B748472F1, 957},
-{0x25D6637B331AE553, 207},
-{0x25DBD49964AAFC87, 221},
-{0x25E0546A974E283F, 374},
-{0x25E1FF257CE0021B, 439},
-{0x25E270ADF8529EFA, 448},
-{0x25ECE94986F3727F, 482},
-{0x25EF53EA7DBF2882, 829},
-{0x25F04D8D5DF6C812, 247},
-{0x25F1179FBC63935E, 515},
-{0x25F4FC6075F3AE7F, 2487},
-{0x25F63CDE9DF1AFDF, 415},
-{0x25F6F7E1C537FA0D, 248},
-{0x25F79C2098CA699D, 508},
-{0x25FBD1702DD8ECB5, 580},
-{0x260072AD820D7576, 373},
-{0x2608E4E5D1E155F2, 221},
-{0x26098038FD43F826, 454},
-{0x260DD3D78EE231B5, 413},
-{0x260E47976419366E, 6214},
-{0x260E8EE27297F4A6, 2096},
-{0x261023517FDDDF61, 520},
-{0x2613BBDF7BBC1EE8, 453},
-{0x26142062A09B2350, 330},
-{0x2615979EFE69E826, 352},
-{0x261997EA27603615, 555},
-{0x261A8ADA79F86803, 819},
-{0x261CD33717A4BEE0, 404},
-{0x261EC8677F48847E, 1021},
-{0x2623E8193030D171, 1473},
-{0x2625E1588969A0C6, 477},
-{0x2628E47E53D62A8C, 3294},
-{0x2629F79B422E05ED, 266},
-{0x262CE6A619494D14, 538},
-{0x262ED64F87A5F971, 250},
-{0x262F37DB8E488C18, 590},
-{0x2631CCF7A4D4CE86, 277},
-{0x263238F4CDB0B124, 215},
-{0x2633699B6971CEEF, 1201},
-{0x2634FF180D5593A2, 229},
-{0x26365926B0AE17A5, 287},
-{0x26383D73E920E9C2, 2386},
-{0x26396CC9FB1D26BD, 263},
-{0x2639901FBDBEB788, 308},
-{0x263AC91CDC1516AA, 1786},
-{0x263ACC23A742264D, 611},
-{0x263E009CE691A9B3, 314},
-{0x263E54A4CEEDF7D6, 607},
-{0x264105A6292EF75B, 428},
-{0x264514A059D864D9, 350},
-{0x2646A632A74C514D, 894},
-{0x2648D56BBA39817A, 1393},
-{0x264E60AD6FAC171A, 247},
-{0x264EEF5D093A5FBE, 259},
-{0x26529D9B06FA6AE9, 433},
-{0x2653730A46AD16B8, 406},
-{0x265B81EE28A494C4, 541},
-{0x265CB93A2510D19D, 754},
-{0x265DC6661C3BFE07, 147294},
-{0x26622C5926B7F1A4, 408},
-{0x266370B23510A5F9, 219},
-{0x2664B571D0FE058A, 2508},
-{0x2665D95B3A9ADB94, 369},
-{0x266646AC4612D51F, 229},
-{0x26687880771C35CD, 14610},
-{0x26689DDC71508EF5, 350},
-{0x266DC944AAA7DF9C, 271},
-{0x266DE872805EEB44, 430},
-{0x26705663392369DC, 2574},
-{0x26743E3188203FE3, 2083},
-{0x2679AA58D56285F9, 2497},
-{0x267F045A2D0E33C7, 1549},
-{0x2684D1C043B867B4, 3083},
-{0x26880C6731E3C3BC, 226},
-{0x2689B4142E6DC482, 374},
-{0x268E3506EB82E287, 259},
-{0x268FE2324BAD0214, 1182},
-{0x269059601C007ED5, 1676},
-{0x26937BA26306DD2C, 5037},
-{0x26954981DCA41620, 1734},
-{0x2697AC313B6371BE, 323},
-{0x26985970181A1A8F, 263},
-{0x26996857FE274F4A, 279},
-{0x269D7393A585BE3E, 3335},
-{0x269FB2D925089B6D, 7760},
-{0x26A2C16500097FC5, 419},
-{0x26A63924C5A5CC04, 1864},
-{0x26AA2106E3B930E6, 432},
-{0x26AA26BEA440BB32, 231},
-{0x26AC477CAAB20B2B, 331},
-{0x26AD1B5A6F1B171D, 1399},
-{0x26AF7D9806D24641, 212},
-{0x26B3D568210BB9F8, 259},
-{0x26B515468221F419, 637},
-{0x26B5CC7DB064B8CA, 3902},
-{0x26B6B730D28A2795, 232},
-{0x26B75DB071E405C4, 248},
-{0x26B8448EC2A5CFDD, 349},
-{0x26B89C9CB7A0B8D3, 361},
-{0x26B997B3D47D7CB9, 227},
-{0x26BCAE568A4169B8, 4658},
-{0x26BD1C0B2F79D8B8, 223},
-{0x26BFD205D4D26E1E, 327},
-{0x26C219ABCC54264B, 829},
-{0x26CB63F1837065AB, 663},
-{0x26CC98F112FF0403, 227},
-{0x26CCDE4A9532B834, 290},
-{0x26D0B223DF9A74DC, 225},
-{0x26D256CEA9ED1058, 734},
-{0x26D579A2CA23E574, 307},
-{0x26D67F4034E90DC7, 461},
-{0x26E13A7AE44373AA, 296},
-{0x26E2E85E433E2562, 549},
-{0x26E3B59435CFE6CD, 5533},
-{0x26EBA5185D006BAC, 307},
-{0x26EBF5A8F4F8450D, 224},
-{0x26EDC980E8DB275D, 479},
-{0x26EE63FEA0C8E414, 404},
-{0x26F0E4CC7F8A1683, 218},
-{0x26F199D079F9A695, 361},
-{0x26F3AFEAD3FE4C70, 217},
-{0x26F50ECFD9280BB0, 291},
-{0x26F64D644C75BBC8, 1514},
-{0x26F890829D329BB5, 210},
-{0x26FAF38CA20047EF, 382},
-{0x26FD30A39BE841ED, 525},
-{0x2702C37BEFDC2257, 1743},
-{0x270358CF4D765C57, 1774},
-{0x2703EA7DE1596A55, 289},
-{0x270426EC461AFB8D, 224},
-{0x270452521FAB1EE1, 243},
-{0x270C6E7F36869068, 314},
-{0x27100E5496FFCDE4, 214},
-{0x2712CB91E4E9094C, 583},
-{0x27130BDFABE23E60, 2708},
-{0x271AB57F324D0C86, 885},
-{0x271CC119523B4DC2, 722},
-{0x271D0172F8E0C35C, 375},
-{0x271D42BB1B04C6A8, 266},
-{0x271E710A0CEA7CB4, 891},
-{0x271EC96AB77F8604, 297},
-{0x271FA7DADEC056C1, 221},
-{0x272043FD04A60A7B, 913},
-{0x2720628CA6D1F4F0, 769},
-{0x2722AB4EC05BCA98, 5304},
-{0x27277C7CE8048D21, 676},
-{0x272836640C3E2F6E, 285},
-{0x2728F4B02E937F02, 335},
-{0x2729647B64599627, 294},
-{0x27297955C0593B0E, 304},
-{0x272987D5F0955D12, 297},
-{0x272A39828B044B43, 777},
-{0x272FD366DC8F3132, 348},
-{0x2730FBE1301C5C4D, 662},
-{0x2732AE53C965A4E7, 260},
-{0x2734B3F038C0100A, 3031},
-{0x273619C733D2F53C, 320},
-{0x2736980E78DEF97A, 415},
-{0x2737E1B3473017F0, 208},
-{0x27391060FB93A75B, 648},
-{0x273BB211761A0CF3, 713},
-{0x273F6BA156409308, 260},
-{0x27423DB6D3DB3A6B, 454},
-{0x274288ABD82BD968, 457},
-{0x2744A729EA565060, 381},
-{0x2748BDB175B82898, 638},
-{0x274963529BC05F19, 317},
-{0x27499E5748587677, 212},
-{0x274A33C5315C3C08, 539},
-{0x274A994468900773, 3677},
-{0x274B523B6E36DF3B, 341},
-{0x274B993C64E759E7, 849},
-{0x274EA904FBF04280, 703},
-{0x274EB4D354AF1C38, 382},
-{0x2750046F5E326669, 422},
-{0x2751DCB6141738B1, 279},
-{0x27560D2898F4FE4F, 693},
-{0x27591E208C369854, 387},
-{0x2759882C86316C6B, 382},
-{0x275A08DDD0D49DD7, 43806},
-{0x275E1A9E1A196535, 213},
-{0x275E3A7B3D984781, 214},
-{0x2760D2E64954782C, 1371},
-{0x27686BBD446BC140, 484},
-{0x276DDDC2713137AB, 304},
-{0x2770F86DC5E8BB30, 543},
-{0x2773A8C47199E33C, 2514},
-{0x27764DE8E1B76F91, 376},
-{0x277AC478DBDA22CC, 2417},
-{0x27824FD1AA8FF4C5, 3604},
-{0x2783809987E17181, 2579},
-{0x27842979B0F2BD20, 238},
-{0x278523B398DA9B52, 318},
-{0x27857317E2BA7C00, 617},
-{0x2785B83D39E2CD02, 223},
-{0x278628F2769370D1, 827},
-{0x2786D437DA615CC4, 293},
-{0x27879CD30A403F41, 395},
-{0x279315AEF0F9F6B3, 211},
-{0x27945C4F15E6F020, 687},
-{0x2795427F6BF559C7, 268},
-{0x2798E80121E3F7BF, 261},
-{0x279A8BF4D7E3079C, 200},
-{0x279D6EF4E27E8F40, 516},
-{0x27A0A39D09988E10, 664},
-{0x27A7233F3EFA7028, 353},
-{0x27A745CB63C6F367, 300},
-{0x27A8C10430FF7446, 248},
-{0x27ACAEAF162E1F8D, 205},
-{0x27AD8DC74694AA24, 342},
-{0x27B8D77DB82E766F, 625},
-{0x27BBEE72C99F976C, 4082},
-{0x27C0A3EE8C021190, 224},
-{0x27C227A823C2D915, 289},
-{0x27C40E909852860E, 3102},
-{0x27C430F3E9B7A0DB, 1292},
-{0x27C54783DB63D81B, 279},
-{0x27C6FF89F88EA0F2, 412},
-{0x27C83D5207A92BCD, 621},
-{0x27CC683B58646520, 1086},
-{0x27D395088C1B2C34, 354},
-{0x27D5AC02597144A5, 1787},
-{0x27D68BF29459E51B, 479},
-{0x27D703C0C5E2FD6E, 333},
-{0x27D9B2FDB4692CEF, 350},
-{0x27DCA3B7AE96986D, 780},
-{0x27E44BB645795A5F, 440},
-{0x27E5091719FBA598, 248},
-{0x27E8AD28922B9E2A, 249},
-{0x27EB03F9C0484483, 332},
-{0x27EBDE12CED76328, 2069},
-{0x27EC53E96A315D85, 817},
-{0x27EDCA0786DB423F, 333},
-{0x27EEBEB575994FFA, 426},
-{0x27F2E556363056DE, 496},
-{0x27F596E19981B586, 217},
-{0x27FAE5A3552B536C, 231},
-{0x28049D416B8D05FF, 298},
-{0x28082CC8D3A4F9F1, 591},
-{0x28090B1ED1C44C7B, 260},
-{0x280BB75E854B0D78, 427},
-{0x280C11CD5DBFBF0B, 909},
-{0x280EBD7284BE6130, 367},
-{0x280FC224C27E05F7, 542},
-{0x2810646163FFF8A6, 327},
-{0x2811196039C8BE28, 326},
-{0x28113C25A0DF7756, 658},
-{0x28146DC65547FBC0, 349},
-{0x2814A89790348C0A, 352},
-{0x2816A4CAF4DF04B3, 290},
-{0x28170882C4847D5E, 1455},
-{0x2817284A5ED901FF, 466},
-{0x281752685FABEB06, 221},
-{0x2819037A7779B420, 7991},
-{0x281903C8332961EA, 227},
-{0x281ADB90CEBA8CF9, 324},
-{0x281C1E32B7AB1B7A, 1311},
-{0x281C705A35D2F13C, 444},
-{0x281DE819EA5B7B5F, 250},
-{0x282040981363C7F4, 309},
-{0x28224861D8DB9A77, 252},
-{0x2826E344ADB65A48, 272},
-{0x28299FEE39129580, 254},
-{0x282E4E64F8BCFE13, 232},
-{0x282ED9641FEEAF9C, 541},
-{0x28341ADAC9BFD58B, 267},
-{0x2835D9E33EF42D12, 660},
-{0x2835E3E456B12875, 511},
-{0x283731A84F9E9E4A, 278},
-{0x28395EBC49F45F4F, 235},
-{0x283BF6230242E0BF, 795},
-{0x283F2E9195C4BCA9, 882},
-{0x283FDD3A9A116505, 256},
-{0x2842C296B58C619A, 439},
-{0x28449A096265692D, 274},
-{0x2846CE00B94B3DEF, 765},
-{0x284D367E5290C86C, 291},
-{0x284EDE65A27CA4E2, 522},
-{0x285079732FD85A0C, 234},
-{0x285230BDBEE2FC5E, 231},
-{0x2852ED3295834068, 544},
-{0x28565615F5F84FFD, 223},
-{0x28579CFB5AE92765, 866},
-{0x2858B360709D3B5A, 377},
-{0x285921B8CA3BE660, 108697},
-{0x285B027FA14968F4, 296},
-{0x285C9297235588F1, 242},
-{0x286192A58AEFA64A, 335},
-{0x28621F8E55469AB0, 599},
-{0x2863882D20C73D2F, 206},
-{0x2863DEF63909F5CA, 406},
-{0x286415000B76581C, 273},
-{0x2864B8EADE65790B, 419},
-{0x2868F00CF1F58A4E, 268},
-{0x286CC7A1FD7CC376, 591},
-{0x287424F667900235, 412},
-{0x28750EF1BA39ACFB, 1384},
-{0x287786F0391B871E, 7787},
-{0x2878AB3B437EF353, 595},
-{0x2879963589F8AA18, 307},
-{0x287A853CC2742032, 319},
-{0x287B7DCE58004BA1, 259},
-{0x288562CDB97B7DC1, 479},
-{0x28893055A1D586F2, 1474},
-{0x288984C3EB9BC375, 657},
-{0x288AD0AC54356BA1, 285},
-{0x288E109BCF298685, 234},
-{0x288EB93BCD2898A8, 495},
-{0x2893E55918F43D0D, 10267},
-{0x28963512A090471A, 490},
-{0x2896ED88EAB93390, 489},
-{0x289CF81EB6FB5B7C, 307},
-{0x28A19314B15573BA, 5306},
-{0x28A1DB180C3883EB, 380},
-{0x28A4E77FC9D3917B, 336},
-{0x28A6972FAD1DC2E2, 209},
-{0x28A89AD354442354, 361},
-{0x28A97BC0E78BF317, 444},
-{0x28AAA32B943724F5, 816},
-{0x28AEBD2C425CD7BC, 210},
-{0x28B17C1FC085721A, 1367},
-{0x28B1D15F2895BA7C, 200},
-{0x28B6E48B747B3BD2, 624},
-{0x28B7C519418968EB, 407},
-{0x28B959C5AFDA8C78, 215},
-{0x28B9A9C749E6A875, 227},
-{0x28BA261F0C08F3E9, 258},
-{0x28BAA51C414D2D95, 326},
-{0x28BD22DA6CB11DF3, 516},
-{0x28BD3CB2C98D5D1D, 245},
-{0x28BE15B0C723E382, 536},
-{0x28BE27472883CEB6, 578},
-{0x28BE459B73F2423B, 407},
-{0x28BE9551ED15DED5, 231},
-{0x28C04D524D441C5A, 717},
-{0x28C503F0BD0650DF, 222},
-{0x28CAE85DC349C425, 438},
-{0x28CD9B862B6C0372, 307},
-{0x28CDBE79DF1A5485, 545},
-{0x28D04EDC1A3D1384, 730},
-{0x28D1C815741385A1, 208},
-{0x28D41F600FBBEDEC, 236},
-{0x28D501F00D2C2EC2, 203},
-{0x28D88ECE7F020D0F, 557},
-{0x28DDA2BA0D05F9DC, 366},
-{0x28DF56EB0D577802, 810},
-{0x28E4F838BCA4B6BA, 221},
-{0x28E77B722B44E30B, 453},
-{0x28E900F63C25242C, 229},
-{0x28EA5C5138A41A4C, 244},
-{0x28EC3168373DFDD6, 233},
-{0x28ECA8E8291E02B1, 2597},
-{0x28ECD4DCAD04CC49, 222},
-{0x28ED64DAA7E1AD1A, 1318},
-{0x28F62D8BE097A6E8, 1082},
-{0x28F821CDDDEBBC4F, 1280},
-{0x28FE3353C10AB691, 211},
-{0x29013E0C0E2D10F1, 708},
-{0x29029FBFCB830F03, 341},
-{0x2903846BAD5AC08C, 1209},
-{0x2906BD18B548AC78, 689},
-{0x29077794627D925D, 265},
-{0x290799A47B37FF85, 1075},
-{0x29086F743AED8619, 222},
-{0x2908E403AAA212F5, 7913},
-{0x290D1D27BF3437B9, 2955},
-{0x290DA7FC67B35E53, 219},
-{0x290FCFEE8912E3F1, 202},
-{0x29152C8CC1665515, 388},
-{0x291D5F3FAD6CD9BC, 1106},
-{0x2922CA3CE4F01E96, 251},
-{0x2923821C25E940E2, 233},
-{0x29247FF1D83D1CD2, 399},
-{0x292D5D5B9F471EF5, 559},
-{0x292DBD019E22DAC9, 321},
-{0x292ED66456668146, 5359},
-{0x2930A5A7A3D253CC, 216},
-{0x29351A49C1490E13, 233},
-{0x29355C9C938DDEA2, 570},
-{0x2937C72F1FA5B831, 212},
-{0x293BCE85A76AD57D, 279},
-{0x2942202DDA80F95B, 400},
-{0x2945089AE347B9E7, 1315},
-{0x2948062345F1F226, 338},
-{0x2949A7921860B162, 375},
-{0x294B0EAEC278B4BE, 345},
-{0x294C09F03A4C1F36, 785},
-{0x294C36C4EDB88539, 549},
-{0x294CEB6EDC094C02, 2092},
-{0x294DCFA43C695174, 287},
-{0x294FB92D2D9BFC08, 323},
-{0x2951736FFA3A0FEA, 873},
-{0x295184D7ADA9C5AF, 321},
-{0x2952EB4A76A2B1A3, 597},
-{0x2953E235D7F82E8A, 270},
-{0x2953EC272E4C385F, 2385},
-{0x2954C2BE9734C44A, 572},
-{0x29565A5C045DA362, 661},
-{0x2956B5B10C0DD714, 337},
-{0x2958A021576DF64E, 1097},
-{0x2959384423CFBDEC, 440},
-{0x29598581C5B96A35, 275},
-{0x295A267E7E4BAF03, 244},
-{0x295DA5C1903D7E16, 227},
-{0x295FB2935DCDB070, 953},
-{0x2961878FC7C1B1E7, 280},
-{0x29621CF770C0CC4D, 348},
-{0x29645B9C37EACF88, 318},
-{0x29687194E4575AF3, 201},
-{0x29694EDE2E587C3E, 1535},
-{0x296BB69396AA1AE3, 6021},
-{0x296C0304CFFD3E7A, 608},
-{0x2970CB688508C388, 779},
-{0x2974D3E8FAA6D3F9, 281},
-{0x29762D90967421EC, 343},
-{0x297FF0A128E957C0, 284},
-{0x2980A90EFADDD869, 758},
-{0x29861255200DE5A8, 326},
-{0x29888218E25B6C5C, 4940},
-{0x298A5230C6B4E6BC, 215},
-{0x298E1D5849112A97, 341},
-{0x298F669669EB46FE, 206},
-{0x2993012D34ECAA3D, 294},
-{0x2994D7069A05001A, 225},
-{0x29979C3DBF9FFA6B, 1017},
-{0x299AC12F5FE705D7, 281},
-{0x299C0520969A8CF6, 2378},
-{0x29A073B627E3DC0B, 329},
-{0x29A0BEBA27822465, 624},
-{0x29A142298817F10B, 2253},
-{0x29A1D03D825E207D, 3249},
-{0x29A2F0DE4C0C651C, 532},
-{0x29A2F6AE3C7CEC47, 624},
-{0x29A48C70F9D160CE, 1842},
-{0x29A48FF4DA67C8AC, 482},
-{0x29A501468C13FD08, 421},
-{0x29A7AB08C3058D25, 275},
-{0x29A97F62F348F1B5, 512},
-{0x29AC35AFA7051283, 393},
-{0x29B02D2779F67934, 244},
-{0x29B077059B7C1627, 226},
-{0x29B2D29B53C62A4E, 298},
-{0x29B8D21F226672F5, 1632},
-{0x29BD6C90E4E11802, 10159},
-{0x29C15704EF9AA641, 236},
-{0x29C4116843F0E112, 338},
-{0x29CF6E0FAB3E26A1, 213},
-{0x29D424E8DDD5EE73, 252},
-{0x29D4D752201F7840, 14173},
-{0x29D67461B316B861, 233},
-{0x29DA90936E6AAD41, 863},
-{0x29DB14A2B708C7E5, 510},
-{0x29DBF6B4FBD24FBB, 1109},
-{0x29DC10CF89F33178, 518},
-{0x29E10EC94BB62F17, 2279},
-{0x29E42B5C21BBFE2B, 232},
-{0x29E60F486D6C0E06, 867},
-{0x29E7F8166FAE6540, 228},
-{0x29E9B9DF49A13DB0, 341},
-{0x29E9EEF57E4BBADB, 427},
-{0x29F74901F1019485, 420},
-{0x29F85C6A80C60F2C, 315},
-{0x29F994FA6DD4FED0, 246},
-{0x29FACC165F40E7D0, 210},
-{0x29FD8E478255EAED, 345},
-{0x29FDBA17CBD0B4CC, 240},
-{0x29FE35C86B2824C3, 335},
-{0x2A0137DCC3D4B7C1, 643},
-{0x2A021269D380BDAC, 2528},
-{0x2A05A0D6902AF42F, 280},
-{0x2A0639B7A955BE75, 2931},
-{0x2A084D855F133050, 395},
-{0x2A08B7DEB5528225, 235},
-{0x2A09A7670B497FD7, 431},
-{0x2A0B0A18E7B3899E, 232},
-{0x2A0B798AB89908A7, 274},
-{0x2A0E2209202E55F9, 495},
-{0x2A0F540F52A8A9FB, 639},
-{0x2A10EABDBEE4EB21, 283},
-{0x2A1166EB215C6268, 5946},
-{0x2A167E09146A4F25, 2289},
-{0x2A1726C3208CC55F, 263},
-{0x2A1860237EDA19F9, 217},
-{0x2A1B238B36C17AB5, 213},
-{0x2A1F869A2F12C6FC, 1931},
-{0x2A20CF1A60728D84, 448},
-{0x2A2131217562A894, 221},
-{0x2A21626792844F96, 754},
-{0x2A21BA9812116D31, 256},
-{0x2A2382551B847424, 751},
-{0x2A259C99793DA657, 1136},
-{0x2A261A73595C0E4C, 1698},
-{0x2A26284DA46AB07B, 573},
-{0x2A26F759F8A4ABA3, 626},
-{0x2A270F9DA304F8F2, 574},
-{0x2A2965E21D4EB4BE, 2239},
-{0x2A2A16454365B6FB, 298},
-{0x2A2B9E0B73FD3F74, 334},
-{0x2A2E9622240F20E8, 286},
-{0x2A32D2585BD90358, 239},
-{0x2A35F02D11277357, 501},
-{0x2A382F2DA3F2819F, 275},
-{0x2A391BFE83C4C3F0, 610},
-{0x2A3C2422FB0FB48E, 272},
-{0x2A3E3E3AF774DF58, 517},
-{0x2A3ED9FAE2FBA7E1, 1492},
-{0x2A405DB68C8E1555, 214},
-{0x2A4171257AEAA16E, 203},
-{0x2A4252C89CE5DB1B, 410},
-{0x2A43406C005A6BB5, 872},
-{0x2A43F897B9B628FC, 3090},
-{0x2A44C48EBCC9DB90, 474},
-{0x2A49B2F3AA6E22B9, 1793},
-{0x2A4BFA5002BFC607, 902},
-{0x2A4EDA480884FBD3, 246},
-{0x2A502A566CB07478, 219},
-{0x2A55238B612652B9, 634},
-{0x2A5809C923E1655D, 502},
-{0x2A5853F56DD00720, 788},
-{0x2A5D81466D0865D7, 420},
-{0x2A5F327F5A261292, 625},
-{0x2A60075F4B1897BD, 5076},
-{0x2A60CE19A01D1FFA, 244},
-{0x2A6332C974084DA6, 219},
-{0x2A64050C302AF8ED, 2075},
-{0x2A640F0B53B91C07, 19580},
-{0x2A65E416EC4094FC, 447},
-{0x2A676A9D3BA926E6, 487},
-{0x2A6BA09F02C45A5C, 684},
-{0x2A6E8BAE0238518A, 388},
-{0x2A70600E43FF2AA1, 790},
-{0x2A707275013F9B72, 321},
-{0x2A719B8C5DF097F5, 210},
-{0x2A738640385AEC0D, 702},
-{0x2A74FD8327C2249E, 1216},
-{0x2A77358B46DA52D4, 457},
-{0x2A77A16E6A0B58E2, 743},
-{0x2A7B741C2E709ED2, 1288},
-{0x2A7C7D2D0CFF4259, 773},
-{0x2A7CD1D1F796073F, 1033},
-{0x2A7F70EBDF45287A, 206},
-{0x2A8397478F5C3074, 302},
-{0x2A85259F9F23ACB8, 218},
-{0x2A8549379FCDEF15, 367},
-{0x2A88E08B6988F62F, 211},
-{0x2A88F0CD78B03200, 235},
-{0x2A8E95755924205D, 308},
-{0x2A8FD414B6DFCE09, 340},
-{0x2A91427C37FED42C, 482},
-{0x2A971BE0FBCA6ED4, 396},
-{0x2A9EA14113B904F8, 6731},
-{0x2A9FF4CC669DFF54, 288},
-{0x2AA96B0ED494D33B, 213},
-{0x2AAACB7AB2F4B57E, 315},
-{0x2AABC19B943CF202, 207},
-{0x2AACC3EC9090269B, 238},
-{0x2AAF20300263E3C2, 535},
-{0x2AB35D6632C29856, 1745},
-{0x2AB39CFD77AB3135, 379},
-{0x2AB55DB079C09D74, 405},
-{0x2AB779A37AC6641C, 293},
-{0x2AB807A10B8BF36E, 1695},
-{0x2ABD0A85B0251165, 332},
-{0x2ABEE7FCFF5B07C8, 86312},
-{0x2AC48AC3BA2F6245, 1708},
-{0x2ACAFF789B0C421C, 238},
-{0x2ACEC37ABF862AD1, 235},
-{0x2AD5661C3B667D26, 362},
-{0x2ADB197ACAACFFE2, 327},
-{0x2ADB84853E965FA3, 261},
-{0x2ADC2DC850065E01, 1008},
-{0x2ADCF72D61DFF172, 258},
-{0x2ADCFCC0BD9A6BD5, 283},
-{0x2ADD282B36797601, 784},
-{0x2ADE60B126522B5A, 228},
-{0x2ADFB61409A2B08F, 2329},
-{0x2AE0FBBFC4006F60, 392},
-{0x2AE41F7479A9DF6A, 536},
-{0x2AE48ED5A45CD963, 772},
-{0x2AEA076A3F1789F5, 210},
-{0x2AEEC09940267AB5, 451},
-{0x2AF2FC4152C25E6F, 4603},
-{0x2AF63B5FD8B8D1E5, 23248},
-{0x2AF653A9D7DC3741, 454},
-{0x2AF73C285809792A, 246},
-{0x2AF7CF1FD22EE905, 326},
-{0x2AFAEFB899529FD2, 1853},
-{0x2AFBB62C8CD8D4C1, 1018},
-{0x2AFD286DF85B9BB6, 254},
-{0x2AFD9061C6264703, 223},
-{0x2AFF6731D732C1AA, 262},
-{0x2B006A652B2E700A, 669},
-{0x2B03172FC41A8F99, 246},
-{0x2B06838E485991B6, 575},
-{0x2B08FF29456290CE, 353},
-{0x2B0959A0705AC619, 214},
-{0x2B0BA5D862FC400F, 491},
-{0x2B10D3004EED7E4B, 220},
-{0x2B1700363D54767F, 617},
-{0x2B1C15F797C381A4, 532},
-{0x2B1C2A39D68FF311, 805},
-{0x2B1D101A07A52818, 668},
-{0x2B1F2C6FEFFD50AD, 421},
-{0x2B22C91F4A93B370, 231},
-{0x2B235E08C57F4D95, 244},
-{0x2B27C9CBE2AA32DA, 259},
-{0x2B2A63D30E7C2B34, 233},
-{0x2B30E7C1E2557989, 407},
-{0x2B34D7A67FE4727E, 539},
-{0x2B354F08066CCE6E, 214},
-{0x2B37A50A399BCFE7, 240},
-{0x2B3A5A251ED5E886, 308},
-{0x2B3D2BCC172ED8B3, 50770},
-{0x2B3FC9EC1C8487A0, 994},
-{0x2B416C3395632FB1, 560},
-{0x2B42CEFB38BA6149, 203},
-{0x2B4451138D16862D, 739},
-{0x2B4C3C4CF94D361E, 585},
-{0x2B4CF99725D053A7, 720},
-{0x2B515A9A291E1FD8, 232},
-{0x2B52C354DF4C7977, 731},
-{0x2B53A115C3A5EABA, 496},
-{0x2B5645BE7B32A245, 445},
-{0x2B594E26FABADE26, 419},
-{0x2B5A0843370DBEBE, 223},
-{0x2B5A99890E803BAC, 314},
-{0x2B5CFFB35AE55B28, 1203},
-{0x2B5FC3A5304F40D4, 6477},
-{0x2B61339B09FF55A1, 641},
-{0x2B635A2FA6013D94, 223},
-{0x2B68D0F3D1E26929, 309},
-{0x2B6AC50A20B529F3, 216},
-{0x2B6C643E3AD6D3E1, 38320},
-{0x2B6D6AD389B1C38E, 872},
-{0x2B71CECDE158D8E0, 425},
-{0x2B71E67E15E1EA48, 7864},
-{0x2B72D1D43DE5C6D1, 200},
-{0x2B79AEC9D651600B, 225},
-{0x2B7A21D133E0286A, 410},
-{0x2B7AF7BDC251BCF7, 1087},
-{0x2B7B2669ADB97319, 567},
-{0x2B7B8B8EBB60E80E, 591},
-{0x2B7F94F1609C350F, 412},
-{0x2B812EEDDC29F631, 405},
-{0x2B83A2F80D431BFE, 229},
-{0x2B85E37FAE003A3D, 263},
-{0x2B869686CC8DDEE2, 3847},
-{0x2B8856484D1A850C, 289},
-{0x2B88E45810A6C8EE, 1134},
-{0x2B895EB424C60C3D, 286},
-{0x2B8CF778280B754B, 313},
-{0x2B92C8DE111A5E95, 918},
-{0x2B92E5F4538AEEDC, 242},
-{0x2B931BB3C1B35E0D, 281},
-{0x2B962997F21291E7, 350},
-{0x2B981913BDC5D888, 260},
-{0x2B9BC087C1AF7E3D, 529},
-{0x2B9C60F7A4EECF1D, 385},
-{0x2B9DB93B6359A8BE, 2523},
-{0x2B9E8115DE94D9BF, 1048},
-{0x2BA61DC106235B44, 537},
-{0x2BA9CBDE9D9BC2DB, 488},
-{0x2BB345A9A92CD60A, 515},
-{0x2BBB0343568913F9, 201},
-{0x2BBE25BAE403CF63, 210},
-{0x2BC2109DB6D23F83, 680},
-{0x2BC4000C89D078B4, 2308},
-{0x2BC44A4488287656, 246},
-{0x2BC49AFB89478B35, 4940},
-{0x2BCB823C4EBEC198, 271},
-{0x2BCBCE06E6F132F6, 331},
-{0x2BCF32158659DA41, 771},
-{0x2BD1875382B1B2B2, 396},
-{0x2BD2059E70D1680D, 221},
-{0x2BD24F227880BCE0, 377},
-{0x2BDAAF59CC25813B, 218},
-{0x2BDDC661CE553DAD, 264},
-{0x2BDE285F328CC7D0, 520},
-{0x2BDE722914D53368, 303},
-{0x2BDFD53AD4D6D0F4, 255},
-{0x2BE0A4F4675C5A74, 359},
-{0x2BE1C73FCB3B7D39, 864},
-{0x2BE8C49155D91BDA, 993},
-{0x2BE9135BD3C2EBB4, 317},
-{0x2BE9717A81F9A2FB, 278},
-{0x2BED348E38D73D7B, 416},
-{0x2BF19CA86F84D481, 236},
-{0x2BF2644503EAE7D7, 331},
-{0x2BF70D7A168FE30F, 2166},
-{0x2BF7EFE1463315FE, 1147},
-{0x2BF9A628D8DDF48F, 472},
-{0x2BFA9E3965519A55, 2331},
-{0x2C01601AFC6EB394, 308},
-{0x2C01829AF9555EF9, 279},
-{0x2C036E9746F92E68, 269},
-{0x2C03A7073575BE4C, 846},
-{0x2C04D5C8ED9BE4FA, 357},
-{0x2C05551C0C490669, 4464},
-{0x2C081B4D62484D8B, 213},
-{0x2C0E6FFF701F4A0B, 359},
-{0x2C0E7F033CC8B009, 269},
-{0x2C10903330ABB7C9, 415},
-{0x2C118FD952E5C743, 340},
-{0x2C1759C5B5D4BAF4, 346},
-{0x2C18BA97DF03A8A5, 2002},
-{0x2C1B2E7164FDE165, 259},
-{0x2C1F3C348924AED0, 419},
-{0x2C21B70B28A555C4, 473},
-{0x2C21E175034C8A3D, 310},
-{0x2C258D26573F23D1, 516},
-{0x2C286877E4B565A8, 995},
-{0x2C2E26B9164FEB83, 290},
-{0x2C315383AB3F00FE, 215},
-{0x2C325828065BACBC, 218},
-{0x2C360E2ABC619676, 281},
-{0x2C3783A9685AFF0C, 351},
-{0x2C3849D6065FA6D8, 238},
-{0x2C3BC60C173FAD2F, 336},
-{0x2C3F5D2A43198F2B, 550},
-{0x2C401D7FA8446DAF, 212},
-{0x2C41F5C63D79C16A, 539},
-{0x2C43E49AFF0BCB00, 244},
-{0x2C4B39D019A4558C, 212},
-{0x2C4B9C9683DD5E06, 287},
-{0x2C4FF6739CE3A48E, 370},
-{0x2C526BBD5DF3F65A, 231},
-{0x2C53EE8FA3C444F0, 233},
-{0x2C544FE0D4D9BB1D, 265},
-{0x2C566DD422B42490, 300},
-{0x2C5A1D9F78ADBC86, 1358},
-{0x2C6154CFBE64BEC0, 583},
-{0x2C630105A03935C0, 245},
-{0x2C66CE76F9240646, 250},
-{0x2C68C77876C4B0D3, 398},
-{0x2C6A91553480CA53, 276},
-{0x2C6BB8BB669F9C95, 1961},
-{0x2C6C5B3A000152C9, 3450},
-{0x2C72118587733353, 317},
-{0x2C759FC8B18778C4, 414},
-{0x2C76E115E7B4ECC0, 287},
-{0x2C76E1D6AA1953DB, 838},
-{0x2C7835C60108FDE8, 3463},
-{0x2C7A75DF59C5B7AF, 4733},
-{0x2C7D678286B6C0F2, 386},
-{0x2C8048101966F39E, 261},
-{0x2C81D0F206512B67, 246},
-{0x2C958A0974DB41AA, 203},
-{0x2C9B5DFB147E3B76, 257},
-{0x2C9D77AB00D674BC, 617},
-{0x2CA1948A8806AD09, 390},
-{0x2CA1AE3D09472C46, 236},
-{0x2CA23D9ED6A8E2D5, 9500},
-{0x2CA2E4DCF411B114, 479},
-{0x2CA8106EC2867738, 994},
-{0x2CA966295EE30DA1, 289},
-{0x2CA9FC66DAF225F4, 215},
-{0x2CAD42C03C87B2AD, 229},
-{0x2CB5623BB76986C2, 620},
-{0x2CB7FB9894C318B8, 493},
-{0x2CBED03ADEE411FB, 1331},
-{0x2CBF213616F23AF6, 201},
-{0x2CC59183879A6D91, 229},
-{0x2CCD9D1DF053DD1D, 295},
-{0x2CCF879B138775DD, 300},
-{0x2CD1DEC1E285C9FA, 212},
-{0x2CD43338F8B837B0, 309},
-{0x2CDA0212FD3C1504, 202},
-{0x2CE2B7462197A4E5, 328},
-{0x2CE3AE65A084F634, 704},
-{0x2CE780229F56EB4F, 537},
-{0x2CE8CDDC86EC0EEF, 655},
-{0x2CEA508F79497F8B, 652},
-{0x2CEDC448B72FFF20, 389},
-{0x2CEED563A0AF86E2, 230},
-{0x2CF01ADDD5A2FDDF, 445},
-{0x2CF4CF49EC25F53D, 384},
-{0x2CF5401847B88854, 879},
-{0x2D0286D6CE190C45, 213},
-{0x2D03D0FE6E747094, 380},
-{0x2D0410EA22CB4D00, 15913},
-{0x2D0A1A54353D9B68, 2136},
-{0x2D0A7C306760F0CE, 256},
-{0x2D0CD1F95911EF00, 247},
-{0x2D0F825F3590FADF, 210},
-{0x2D102EF08FE5C4FC, 1858},
-{0x2D139D8DD958D58D, 371},
-{0x2D175E9800E9A0B6, 1010},
-{0x2D1854C8409A6074, 428},
-{0x2D1B5FFD3632D8AD, 346},
-{0x2D1BAAD60DFF603B, 420},
-{0x2D1C06B101D86BF2, 631},
-{0x2D1C57E81BAC1626, 719},
-{0x2D234BDE40DFBAD4, 375},
-{0x2D257FA28D831DA4, 282},
-{0x2D25E1367A76E315, 681},
-{0x2D278742AECA7697, 206},
-{0x2D299F78D71BBFAF, 1889},
-{0x2D2C0CA2FD4DA16E, 262},
-{0x2D316D8A5C5B43FF, 279},
-{0x2D3435A79F21CF77, 204},
-{0x2D38EBD9A665443C, 703},
-{0x2D392465951A87BF, 401},
-{0x2D3CB705B7EDF76D, 248},
-{0x2D4015759B0E5D91, 548},
-{0x2D4034E4588B3503, 351},
-{0x2D40864DF54E1A54, 322},
-{0x2D43A4A19B05C3EF, 458},
-{0x2D48F17040905B2A, 261},
-{0x2D4D31317F6A7705, 1302},
-{0x2D4D8AFE412C3C19, 414},
-{0x2D4E8DC0906B1671, 318},
-{0x2D4ED72D4CDD395B, 623},
-{0x2D4F62157E3D7EA4, 264},
-{0x2D503CD66976A65A, 552},
-{0x2D5224E56B92A454, 738},
-{0x2D5864A75A06953D, 210},
-{0x2D5CFE695E2BBC4C, 925},
-{0x2D5EDCF696DF3064, 250},
-{0x2D6AA78C5F7BE088, 626},
-{0x2D6AB67FD6E57CC2, 536},
-{0x2D6AB8E49D65C30F, 314},
-{0x2D6D44B814D86642, 256},
-{0x2D6D4AC69DCF91C3, 26189},
-{0x2D6FC49E11E37CF6, 235},
-{0x2D713A09D1704282, 434},
-{0x2D73F965CB962D59, 328},
-{0x2D7443CD60AA5F8D, 493},
-{0x2D76EFEDC166672D, 1675},
-{0x2D7776AD08B3471B, 215},
-{0x2D7B9663F1076709, 259},
-{0x2D7C6C4AB7124144, 340},
-{0x2D7D8C409047E3DF, 478},
-{0x2D7F65A4B685B14E, 19986},
-{0x2D8537117B36BFAB, 281},
-{0x2D877EFBD5DF4F4F, 271},
-{0x2D8C9D2F7A8C06AB, 9993},
-{0x2D906597BCE90D72, 227},
-{0x2D94E5CD7F506F5A, 307},
-{0x2D97C2C31F3EFB7D, 260},
-{0x2D9A3108DB8D8CB3, 1812},
-{0x2DA30B06736D3143, 318},
-{0x2DA85B9E1D98C52F, 935},
-{0x2DAAA69C34B53EEE, 354},
-{0x2DAB4CA81443D71D, 568},
-{0x2DAD701AA3C27306, 365},
-{0x2DAF33AD28EA09CB, 1383},
-{0x2DB2C5C8AA89E6B5, 298},
-{0x2DB4EB83810D6BE2, 425},
-{0x2DB5768BD95C7237, 656},
-{0x2DB6EDAAFDDFFBAB, 231},
-{0x2DB7B7495693A4CB, 214},
-{0x2DBF6A0A10917237, 224},
-{0x2DC0954C9C3B9B53, 230},
-{0x2DC2F85F9DE53521, 278},
-{0x2DC36165D96960A8, 14436},
-{0x2DC3BBF8AA54A116, 1936},
-{0x2DC826D9FEAEC18A, 319},
-{0x2DCDE37F95F34FA5, 463},
-{0x2DCE9A0292BD30E1, 228},
-{0x2DD2D163364DB55D, 308},
-{0x2DD71A33226082F1, 332},
-{0x2DDAF8FEA1FB09F1, 278},
-{0x2DDF8C99501FBCFA, 242},
-{0x2DE15245FD6E50B0, 269},
-{0x2DE178A47FF6915F, 1561},
-{0x2DE32D4339A7C7D4, 325},
-{0x2DE436E46AEFB2CA, 313},
-{0x2DE8A73B5DA185A5, 774},
-{0x2DEB74698F5826F4, 5812},
-{0x2DF0893DA629BF97, 369},
-{0x2DF2D2DA91DEF925, 460},
-{0x2DF9F8252B9317F6, 427},
-{0x2DFCF9A41ED26F7C, 1257},
-{0x2DFE330BCCBFBDFE, 1242},
-{0x2DFEB5311A8877C7, 562},
-{0x2E01FD0F40B3A099, 201},
-{0x2E0251402DD390C7, 801},
-{0x2E0816DA283D5C77, 416},
-{0x2E10FFC51630569A, 205},
-{0x2E12FC20438B1288, 252},
-{0x2E159AF600AA8308, 213},
-{0x2E1BFCC9D1FA3198, 418},
-{0x2E1D6FE5BF45A6C4, 15025},
-{0x2E1DDBC7E1A7F888, 270},
-{0x2E1FAFAAF416B877, 375},
-{0x2E21AA7BECB77017, 863},
-{0x2E290588DD813D6A, 235},
-{0x2E2BD7C861604CB5, 11021},
-{0x2E2CF683C3786FB2, 267},
-{0x2E2D81825A85F0ED, 946},
-{0x2E2F54B83F6A195D, 261},
-{0x2E35E0156682A10B, 6750},
-{0x2E35FD14A2229586, 251},
-{0x2E36C7E5ABAA00B5, 319},
-{0x2E39DD3F8189E98F, 420},
-{0x2E3EE602E7AE2CFA, 256},
-{0x2E43608BB48BDC8A, 269},
-{0x2E45CF70C19AFDD4, 467},
-{0x2E45FE14E5AF53DF, 255},
-{0x2E474C15DCE48D5F, 416},
-{0x2E4B0EEFD4D3853D, 257},
-{0x2E507263B49786C1, 228},
-{0x2E50F143951CBCC3, 260},
-{0x2E51301B7ACD49B2, 704},
-{0x2E5194733B42406F, 366},
-{0x2E54743D886F7A69, 925},
-{0x2E552FB877B689DC, 519},
-{0x2E56C729D389C1A7, 765},
-{0x2E589763CB95D6D5, 359},
-{0x2E593E6637E28432, 306},
-{0x2E5F9FAC96E3C23C, 856},
-{0x2E5FF3F058213845, 981},
-{0x2E656DC995BEDCA9, 2970},
-{0x2E69CD06E72E99F0, 362},
-{0x2E73B53BD32EDA89, 448},
-{0x2E77E0DDF6192F77, 279},
-{0x2E798B714E83E090, 361},
-{0x2E7A27C4A310630F, 1357},
-{0x2E7C7C86126B7BAC, 220},
-{0x2E80A0BBB656A784, 293},
-{0x2E83D8A4F9CDDCDB, 1444},
-{0x2E85E12F0FCC933F, 231},
-{0x2E86CD6556025491, 526},
-{0x2E8950DA67B4B2B0, 618},
-{0x2E8AEC0C69EAD0CC, 451},
-{0x2E90D98D6CF62E09, 4772},
-{0x2E94656033F9E6B1, 1174},
-{0x2E95E597F959FE50, 570},
-{0x2E9701BD4506527E, 7847},
-{0x2E9ACF8B5D127373, 363},
-{0x2EA1870935D9FE3A, 457},
-{0x2EA52F217CA1FF75, 4231},
-{0x2EA58749505CBDD0, 236},
-{0x2EA697A02C1565C8, 336},
-{0x2EA83A2C0961B048, 226},
-{0x2EA9294393D03148, 241},
-{0x2EAB1A2A71CC317A, 239},
-{0x2EABF460B0887614, 744},
-{0x2EAD31E7F3C1E647, 267},
-{0x2EB0C43FFD5AB21E, 204},
-{0x2EB1872E784AB216, 473},
-{0x2EB437C4CC3B8C30, 210},
-{0x2EB9C8C044C460A9, 1011},
-{0x2EBA35D36897D9D3, 356},
-{0x2EBA7AD112F87A41, 652},
-{0x2EBD2BD267B08B2A, 314},
-{0x2EC06A1066E63D95, 200},
-{0x2EC359CE6D069EB7, 3094},
-{0x2EC841353E2E302C, 286},
-{0x2ECFA3F4F8F340AE, 234},
-{0x2ED2D688DE0AA5B7, 276},
-{0x2ED54079758B5092, 853},
-{0x2ED74A2904B16F90, 336},
-{0x2EDC653BBEE54B1F, 1522},
-{0x2EDDFEEE80CFCBB1, 1709},
-{0x2EE17DC8E5706B7A, 461},
-{0x2EE25D200C5B396E, 418},
-{0x2EE4FEA927C47700, 353},
-{0x2EE53E1794C37039, 281},
-{0x2EE63D3DC74FA4DF, 986},
-{0x2EE9E32CAC6AE012, 220},
-{0x2EEA048C0A03924D, 843},
-{0x2EEC992F7D2F4948, 347},
-{0x2EF0E6C354A47A24, 253},
-{0x2EF2212ED2CD6F4D, 236},
-{0x2EF732E3BC334A68, 240},
-{0x2EF9CDE16EE654CE, 753},
-{0x2EF9D388A84522B9, 224},
-{0x2EFE49162533D313, 234},
-{0x2F040C90A773310F, 950},
-{0x2F04622F3E78B416, 219},
-{0x2F05AFDB002D6425, 318},
-{0x2F1287B10E1035E5, 610},
-{0x2F144F5550214BEF, 604},
-{0x2F17B5E3D554653C, 596},
-{0x2F17C600E75786F0, 2851},
-{0x2F2236E369009187, 888},
-{0x2F2346511175C4C2, 215},
-{0x2F28835260BCB4D8, 203},
-{0x2F2C18A15D01F82F, 438},
-{0x2F2DAF19CBCB5F4E, 1142},
-{0x2F37E8A14F1580DE, 657},
-{0x2F3B19F0054E00B7, 1134},
-{0x2F41944E22CF6FE9, 201},
-{0x2F42FA409F7F4945, 416},
-{0x2F475C371E25113B, 13662},
-{0x2F48402D39057F15, 666},
-{0x2F4A1DFB97F130DC, 287},
-{0x2F4AC81EA48D8B88, 399},
-{0x2F4FBF7693ABD40C, 347},
-{0x2F50075759A3DCFF, 2053},
-{0x2F51AFD9415D8841, 1810},
-{0x2F5742E1380E063A, 247},
-{0x2F5C59BD99093DD6, 217},
-{0x2F5E4B4D8059171B, 444},
-{0x2F61CF4E5573C2AA, 245},
-{0x2F61E14AFED609C5, 670},
-{0x2F621D6F371E7013, 304},
-{0x2F63976DD30E9B31, 207},
-{0x2F63E26C6C7E6FB8, 241},
-{0x2F679A26DA5ABA69, 208},
-{0x2F693610B9BD1E8C, 684},
-{0x2F6B2A5E5C0138B7, 361},
-{0x2F6D58C308B1A3C4, 263},
-{0x2F6F3C475026CE5A, 252},
-{0x2F7209B04AA43415, 1868},
-{0x2F7676B005554C4F, 219},
-{0x2F7A44251C7CC605, 284},
-{0x2F7E8F91A934F2C6, 690},
-{0x2F7EC6024730BF6F, 811},
-{0x2F8506E0AEC8CD33, 446},
-{0x2F86293263648FCD, 245},
-{0x2F8F6B8547F1A94E, 1003},
-{0x2F910186229F0877, 1652},
-{0x2F91CC27A5BB9B17, 230},
-{0x2FA06E6052F2BCBC, 252},
-{0x2FA193945F165050, 283},
-{0x2FA86D837C86D577, 363},
-{0x2FAA702D95EA0639, 386},
-{0x2FAE94CAEF34FCAD, 1847},
-{0x2FAE9F46D28BDD2C, 411},
-{0x2FB8122B9B815DE3, 3094},
-{0x2FB88E3A1F8BC977, 828},
-{0x2FB8ED6E0BD04FB8, 1259},
-{0x2FBA649AEDF75098, 211},
-{0x2FBAAFE34A3E3CED, 6048},
-{0x2FBE4B359175AE59, 266},
-{0x2FC031F475DE9162, 217},
-{0x2FC10FA43041108E, 265},
-{0x2FC28C610D7B1E95, 458},
-{0x2FC2AD26D99A92A6, 697},
-{0x2FC8042E2E902F81, 272},
-{0x2FC82004D731B57E, 731},
-{0x2FCD03C47C7D738C, 931},
-{0x2FCD0CD8EF357256, 3249},
-{0x2FCEB07FB1F88895, 614},
-{0x2FD101081077CFA0, 222},
-{0x2FD430AE6AE26AC3, 480},
-{0x2FD47D94ADCF30C0, 440},
-{0x2FD92B817880BB43, 3584},
-{0x2FDA396B992C0FAE, 200},
-{0x2FE2CAC8A16824C1, 283},
-{0x2FE3F17D076B325B, 700},
-{0x2FE481ED039F92E8, 246},
-{0x2FF17FB5CC3DBC64, 280},
-{0x2FF55F6F8D5C77BB, 444},
-{0x2FFB01E3C7BB7C84, 248},
-{0x2FFC6D80BED09F58, 424},
-{0x3006013F3F7ED43B, 8402},
-{0x30060B132C0A8A09, 1089},
-{0x3008B08E551775A8, 412},
-{0x3008C2C0D21842C1, 337},
-{0x3009BC80812A9F74, 259},
-{0x300E4238DF4A9A61, 578},
-{0x300EA403CC407C4A, 303},
-{0x30101B099273265F, 335},
-{0x301996D723D937C5, 347},
-{0x301B7212408C83B5, 3190},
-{0x301BC9B2B0F9823F, 376},
-{0x3020F3C5A8A239C5, 265},
-{0x302483316480677C, 1265},
-{0x3035001A1CDBAEB8, 12424},
-{0x303608E93F7208EE, 215},
-{0x303871FA26F77713, 726},
-{0x303A10373FA87DB8, 354},
-{0x303A7288F7CECC5C, 236},
-{0x303D6A279549915C, 2665},
-{0x303DE520D6D72308, 329},
-{0x303F11303A943FDE, 396},
-{0x303FAD15E7678728, 655},
-{0x3040DEDA5EFD693E, 215},
-{0x30437702F5741757, 209},
-{0x30463B6BC30ABD21, 214},
-{0x3047990B1987E5CE, 315},
-{0x304DF498E73D4F15, 437},
-{0x304FC57D9313885E, 219},
-{0x304FDDBD8B73AF1A, 4299},
-{0x30506D3950547380, 783},
-{0x3056C4F382386BAE, 744},
-{0x3056D11EC882F1CF, 200},
-{0x3057154675AC8510, 265},
-{0x30574EA87F70016B, 1234},
-{0x305759D6021A7444, 258},
-{0x305C34279876885D, 5864},
-{0x306191FBD7DC89B0, 596},
-{0x30623D07DF0269DC, 947},
-{0x30638873690747A2, 265},
-{0x30710C5237254D11, 407},
-{0x3072E6A0BC49E745, 299},
-{0x30778968536368B9, 262},
-{0x3077CEFD89E72FD8, 355},
-{0x3077E7F150AFC4AA, 209},
-{0x307BBD00863BC03D, 37375},
-{0x3085111335E44C52, 430},
-{0x30876C9D141E1CDD, 621},
-{0x3088F9E9D0ECF5A3, 229},
-{0x308921DF1AAF9447, 379},
-{0x30916C9751E4F74E, 412},
-{0x3095B66429A70602, 552},
-{0x3099B79127C9BD1A, 272},
-{0x30AE96911E7A5CA2, 234},
-{0x30AEFE613D7D7B03, 374},
-{0x30AFD64C6C6D2140, 258},
-{0x30B69E97B8EB1E8F, 362},
-{0x30B933EA670BB659, 536},
-{0x30BCA3C6CAB2839B, 232},
-{0x30BDB6EC3D1A3FF7, 284},
-{0x30C13348A7680B37, 283},
-{0x30C444C38145C3D2, 210},
-{0x30C6FAAA133F8716, 439},
-{0x30C7DBC661DF9DE5, 418},
-{0x30CD8BCC411B69EB, 773},
-{0x30D3A05EAA896F58, 699},
-{0x30D4E06F9D13F983, 1933},
-{0x30D83A188E51644E, 524},
-{0x30D983DB45E7F805, 215},
-{0x30DAA311CAD9B2F2, 312},
-{0x30DC4F906BF8E91B, 322},
-{0x30DEC00F70336F13, 315},
-{0x30E1668DA595213E, 421},
-{0x30E1DB685615CDF5, 1806},
-{0x30E20DA44909E848, 1290},
-{0x30E69896423CB6A3, 308},
-{0x30E795C46EB25B85, 2568},
-{0x30EA4CF9C3D9912B, 805},
-{0x30F249ED5AE78DB5, 429},
-{0x30F60DC442E254C7, 200},
-{0x30F68409BC21A495, 203},
-{0x30F7D9033ED25920, 218},
-{0x30FE589643E1E71B, 233},
-{0x30FEB4CC4E7E6938, 2180},
-{0x310054A444CFF0FF, 236},
-{0x310309F661413140, 291},
-{0x31072BD37472CB61, 274},
-{0x3107F3DA2128FFA1, 247},
-{0x31083EC1F0777EC0, 224},
-{0x3108FADD79F7881B, 686},
-{0x310B3D57868FFDC4, 381},
-{0x310CC0DDA37DBE6A, 4559},
-{0x310D64FA9318A8CF, 380},
-{0x310EB935310F15FB, 264},
-{0x310FC98B23FDCDDF, 248},
-{0x311064EC815B5212, 225},
-{0x3118A2F29503AE16, 244},
-{0x3119DBB4E1C29EFC, 980},
-{0x311B179C8E8E1CEA, 736},
-{0x311BEF86C841983E, 6044},
-{0x311CD5D7B343C35D, 218},
-{0x311E31A502DF322F, 487},
-{0x311EA242ED07BC27, 6852},
-{0x311F919D5F84845B, 844},
-{0x3122FD757347D0C0, 8778},
-{0x31240488D208FBCF, 300},
-{0x312771D825243041, 435},
-{0x312FB2D48EF8B07F, 271},
-{0x3136FB67F8D67648, 6317},
-{0x313959FB7501C7B8, 207492},
-{0x313CA5484E86AB58, 328},
-{0x31434D78A7C756B7, 1466},
-{0x31456E0BFE8942CC, 351},
-{0x31456EF178B1810B, 205},
-{0x3149FBDA90463855, 448},
-{0x314DCEFAAA47A43C, 263},
-{0x314EC14FDD833128, 285},
-{0x314F4CBC25129BEA, 1319},
-{0x3150C459BDB72233, 201},
-{0x3154FFA4053C8BFD, 270},
-{0x315973742A2CEE55, 2108},
-{0x315C43934340A627, 262},
-{0x315F5D30A63160C5, 817},
-{0x315FE106037FF188, 1170},
-{0x316074A853D3F2A0, 1426},
-{0x31637DDBD9DC9BCC, 258},
-{0x31684CAFBC78F42E, 268},
-{0x316C51C2AACAD184, 683},
-{0x316DADB01B94E662, 333},
-{0x317360DD41C6141C, 771},
-{0x3181CFACCA90EAE0, 492},
-{0x318438525314F4CC, 293},
-{0x318A41CB2342E9F9, 832},
-{0x318B00E4D1139252, 324},
-{0x318E41AF50AC6026, 287},
-{0x318EC3CD2E4950A5, 4008},
-{0x318F3914D94260E3, 263},
-{0x31916CF4A696ECEF, 294},
-{0x31922870A34AF07C, 205},
-{0x3192742F8AD78560, 22610},
-{0x31A08FD0D6375594, 711},
-{0x31A1DADE1F40DB86, 702},
-{0x31A718C629DCB071, 2620},
-{0x31A7B3F3C0D0D6CD, 699},
-{0x31AD70573D202E0F, 461},
-{0x31AE82738A9E5E60, 9961},
-{0x31B21349F0A055DE, 429},
-{0x31B4A0D1C664CAAE, 400},
-{0x31C220903BF6A700, 204},
-{0x31C394BC7A2B5E0E, 2378},
-{0x31C4367A3718A5FD, 810},
-{0x31C630A17BA1F9B0, 283},
-{0x31C9675AE56C5DB2, 1915},
-{0x31CA0C2C17F1A31E, 281},
-{0x31CB9C78E5CD3A60, 703},
-{0x31CC1A1FB2D897C1, 492},
-{0x31D41658437A11E4, 229},
-{0x31D711A311A1B59D, 233},
-{0x31D8894EEF3AD3BE, 257},
-{0x31DA3993989E1B4A, 237},
-{0x31DB2691228E9299, 381},
-{0x31DB876D893030BD, 310},
-{0x31DC7B7307833499, 245},
-{0x31DDE573CD3A19DD, 3695},
-{0x31DF6F643E9C1275, 200},
-{0x31E11092CD872E7C, 318},
-{0x31E5820BF497E520, 575},
-{0x31E8436EE0ED5201, 259},
-{0x31E871A6FE8A8315, 225},
-{0x31FC001EBF2CB587, 253},
-{0x31FFE5B97576C825, 308},
-{0x3202227835E90488, 1059},
-{0x32028287B73DCEC8, 1768},
-{0x3205A0F9ADEF94E2, 269},
-{0x32075FDE801676EF, 2805},
-{0x320AD6FFA2FE139B, 212},
-{0x320D5BF0CB16A304, 733},
-{0x320DF45A2D6B601C, 2107},
-{0x320FBB6368F19822, 1177},
-{0x321B3C35DE872C30, 263},
-{0x321E4DD8958CF964, 255},
-{0x32213E5ACD7DD83F, 983},
-{0x3221A7E4FB3CADE0, 4228},
-{0x322C3AAD8AA30954, 201},
-{0x32308C7B671755B1, 280},
-{0x323115C25E1587D1, 391},
-{0x323445F06E63E82A, 1204},
-{0x323615D202E7A01C, 284},
-{0x323B78FD73E95ACA, 67685},
-{0x323F2C05D6CE8C55, 290},
-{0x3243863E2B2CDB76, 331},
-{0x3247D3DA539380BA, 642},
-{0x324B28D2E80AA077, 275},
-{0x324CBE5588D19FE0, 9363},
-{0x3250613D73929B0F, 230},
-{0x3251204BEE194F37, 496},
-{0x3252E5063BBF6659, 817},
-{0x3252FD0635E34351, 478},
-{0x32556EFB03C8C010, 346},
-{0x3259F71EFB181811, 628},
-{0x325BB381B04A2C80, 218},
-{0x325EFF780180FF58, 497},
-{0x325F11CCD4F999C3, 264},
-{0x32667A9E97CDAF66, 207},
-{0x326913DC2BC99F36, 425},
-{0x326C0E2A38EE7713, 324},
-{0x326C1F524A6CC904, 241},
-{0x326D8AF78E92661B, 753},
-{0x326E0CB94CF81EFD, 339},
-{0x326F5230D8422E83, 324},
-{0x327334EFB47CBB60, 523},
-{0x3273FF22704AD5F0, 202},
-{0x3276226A57AC5DE4, 271},
-{0x32789D03D9C75843, 373},
-{0x327BC92882997291, 755},
-{0x327DD2580691DCFD, 594},
-{0x3286092DA01F78F4, 8964},
-{0x3287478A1325B8AD, 2218},
-{0x32885085F64DAE6B, 6044},
-{0x32896BFE55C2096F, 609},
-{0x328BB44E41ECA621, 1073},
-{0x328D00B8F39BB975, 683},
-{0x3290092BE815B070, 384},
-{0x329132688307E649, 264},
-{0x3292F66FA9F712C2, 1694},
-{0x3294D2733DD2920C, 256},
-{0x32981434837C3A49, 596},
-{0x32985E3CFE3D58E6, 463},
-{0x329BE27A2B80B8DE, 358},
-{0x32A404B0659C4106, 346},
-{0x32A5C96C37F6305C, 605},
-{0x32A73CA98045634A, 287},
-{0x32A8DCF2651888BE, 2269},
-{0x32AC187B35096AA1, 530},
-{0x32ACD53D8989FD24, 599},
-{0x32BADFDBAD57B8E5, 1818},
-{0x32BE8A255EFC36BC, 977},
-{0x32C1F164DA2CD228, 241},
-{0x32C65245543ECD7C, 859},
-{0x32C6F26825E13F06, 284},
-{0x32CBFD85016157F0, 233},
-{0x32D56E3F5C6A26C4, 451},
-{0x32D88AA32491AB58, 216},
-{0x32D9589B93DC3434, 2063},
-{0x32D9F8DDEB202F21, 1590},
-{0x32DC877ABDBC6905, 560},
-{0x32E52A32632F9A00, 420},
-{0x32E753A974DBAB2F, 341},
-{0x32E7DBEBC0A3D98B, 202},
-{0x32EB55E286B3311A, 554},
-{0x32ED41F15A7E0794, 301},
-{0x32EDEB8A41EBBE52, 201},
-{0x32EE80547323A885, 213},
-{0x32EFA70840160447, 202},
-{0x32F0F2A68DC098FD, 234},
-{0x32F1133799EFFE91, 364},
-{0x32F35DB0E1881CE3, 516},
-{0x32F75B36E25415A9, 363},
-{0x32FEEB0A3013E250, 529},
-{0x3303869579E54883, 203},
-{0x3304E0DEF47BC9E3, 205},
-{0x330A2AC034A76044, 231},
-{0x3312408A73B9D5A8, 1474},
-{0x3316CD15E6ECA2A3, 265},
-{0x33180CC1603B6D1B, 645},
-{0x3318514E4154EFDF, 275},
-{0x331ABA1E3434CF32, 1344},
-{0x331FD1CD8F28419A, 243},
-{0x33224229236558B4, 267},
-{0x33281C367A3B9CB0, 201},
-{0x3329D28D825EB280, 1778},
-{0x332AEE4789CC0F6D, 211},
-{0x332D2D96BB80F19D, 273},
-{0x332EA19C7550C444, 390},
-{0x33337955DDCABC0E, 1239},
-{0x33386A76495D2569, 238},
-{0x333C04CB108AD894, 272},
-{0x333D07A6EB6CF89F, 598},
-{0x333DDC3B652819CA, 725},
-{0x3340C8506B90C8B0, 1144},
-{0x33433414C3E1D28E, 218},
-{0x3345EF46013C2209, 395},
-{0x335270A4D89C0335, 236},
-{0x3357F1C8906C64AF, 983},
-{0x3359486E95C436DB, 326},
-{0x335F89C6EB81263E, 337},
-{0x336349DBD02A784D, 367},
-{0x3368E1442407D2DA, 2228},
-{0x3368E21BD39E49EB, 330},
-{0x336A9EF377ABD41A, 301},
-{0x336AAFB7ACBF1739, 1902},
-{0x336BEC8AF421E5A5, 3262},
-{0x3373E79FE8BC89A7, 590},
-{0x33765772FACA541B, 276},
-{0x337A8216DB57DFD3, 210},
-{0x337D8186FAC6FF68, 462},
-{0x337D8D9EEB8CEF5C, 238},
-{0x337F253787BF090E, 350},
-{0x338006019F62CC8A, 325},
-{0x338234AAEC387CD5, 2948},
-{0x3385738BB3A75D40, 229},
-{0x3388746061C46C02, 363},
-{0x338CC53550C29097, 436},
-{0x338F26930FCA8A26, 5346},
-{0x33952D4D9CA3985E, 2817},
-{0x339B130563FCE401, 246},
-{0x339CE1A583015BD3, 719},
-{0x339D982034C4EFCD, 620},
-{0x33A0F17419C9997F, 3568},
-{0x33AC0172288FB81D, 397},
-{0x33AD40E746076BE4, 301},
-{0x33B1AC56C05B0849, 802},
-{0x33BBFAD8A11E762A, 265},
-{0x33C0585DEFBCDD7C, 6576},
-{0x33C279405458EF57, 319},
-{0x33C35228DA3643EA, 243},
-{0x33C37E22E4E152F1, 406},
-{0x33C65BD5BFB9EE0F, 473},
-{0x33CD3FE42EAF405B, 783},
-{0x33D161FA926C261A, 247},
-{0x33D48F89F0F47FAD, 219},
-{0x33D682C3A8E1BE14, 221},
-{0x33DEBA5E8AF38E32, 1221},
-{0x33E04FCFAEE65D29, 472},
-{0x33E70A11F1FA63BD, 303},
-{0x33E72EA0E2526CBD, 322},
-{0x33EAA309906D41B9, 201},
-{0x33ECDC2B850A3AF3, 275},
-{0x33F0E5C751532EEB, 307},
-{0x33F5C892F1CDDF9C, 246},
-{0x33F6D4F02EC254FB, 233},
-{0x33F80793807B9C6F, 462},
-{0x33FE324C25E56225, 294},
-{0x33FF4F5F0221C6D0, 203},
-{0x3407EA1BA283D3A5, 2279},
-{0x340D01B65AA8E7B1, 585},
-{0x3413B53350387C48, 396},
-{0x3414E46295B25454, 447},
-{0x3420613661748274, 765},
-{0x3420A78D6033270D, 708},
-{0x34217FAA294EE505, 3868},
-{0x3421BF77CF371BF6, 315},
-{0x34278C35454E74A3, 232},
-{0x34296471F6C3F964, 428},
-{0x3430E6B67C5D277E, 201},
-{0x3431E51345001E57, 217},
-{0x34332348FE9EACCB, 373},
-{0x34354937C48C895C, 686},
-{0x3435C94020339CD0, 726},
-{0x343785F5924FB956, 3891},
-{0x343C8DBF82B2360A, 556},
-{0x343D372B8AB679AA, 1304},
-{0x343D3C5BA77C028F, 268},
-{0x343DA1F694EA9C11, 637},
-{0x343E214009730EE6, 334},
-{0x3445D41B0EFBC647, 274},
-{0x3446F5C6CE7B97C7, 413},
-{0x3447D513F22118A7, 323},
-{0x344856CDB40BE79A, 586},
-{0x344E5C98082389C2, 5608},
-{0x3463A4E42285E1F1, 258},
-{0x3464257C3C9E9705, 604},
-{0x34645F8ABCAC4D4E, 226},
-{0x34685C790B8D6DC7, 408},
-{0x346ED15F97468C67, 4286},
-{0x3471A2AA0BA75FD7, 1024},
-{0x347458705089F0E4, 8419},
-{0x347B84099F21DC15, 408},
-{0x347DE816A98B153D, 434},
-{0x3485164D0B8DFDF8, 270},
-{0x3489910E628093B2, 412},
-{0x348E635EAF42FE3E, 386},
-{0x348F1B3E5CBB400B, 281},
-{0x3491BAE247475BDA, 299},
-{0x349C09FB15B3452D, 917},
-{0x349F5C2A5BCE8C7D, 259},
-{0x34A05138CAEAE294, 404},
-{0x34A0E6682A6444D5, 661},
-{0x34A34A1FC3B15729, 324},
-{0x34A49D62F8728D04, 500},
-{0x34A70F03930335C7, 245},
-{0x34AB90228C15EAB1, 313},
-{0x34AD31F2D079087E, 413},
-{0x34B2D1053B02BAF6, 560},
-{0x34B56611ED03F038, 334},
-{0x34BC87047CE8C3E8, 4342},
-{0x34CADDEDD4DC1CB4, 331},
-{0x34CD39987C899365, 3474},
-{0x34CDD7FEB334CA8F, 397},
-{0x34CEA29A7C12B97E, 344},
-{0x34CF5E97800C2C71, 216},
-{0x34D1A043AB3FA2D7, 2893},
-{0x34D2D338B7524BFC, 238},
-{0x34D45C3093DB3A86, 125975},
-{0x34DA2644D7873556, 243},
-{0x34DB3BBA09E9962D, 232},
-{0x34DC6D799B1C603E, 2512},
-{0x34DD209CCF5BF6E3, 1206},
-{0x34DE4BB6515ED261, 355},
-{0x34E56B277316B8BE, 3474},
-{0x34EFDA574224F9B6, 430},
-{0x34FCB954C9028B28, 227},
-{0x3502C33F64AB11C9, 396},
-{0x3504219EC66A57F6, 1074},
-{0x350665BB743AA88D, 261},
-{0x350F1B377E276595, 3498},
-{0x351558DBDEA4E1DA, 704},
-{0x35185A84AB47B160, 275},
-{0x3518757BABC97341, 348},
-{0x351BF6B40506783C, 268},
-{0x351D8EB0E02C7525, 249},
-{0x3520146D0B1BEE66, 5890},
-{0x35251B65EFD93FFC, 873},
-{0x3525C3A3100954A4, 227},
-{0x35265C5CED3451FA, 214},
-{0x352A64119629DCED, 248},
-{0x352BD33370C901B7, 563},
-{0x353A627AD186411A, 314},
-{0x353C08D6C86CBCCB, 480},
-{0x35474393D1CB63F4, 390},
-{0x3549F5BFB8C58947, 219},
-{0x35536A7D96E889A8, 393},
-{0x355C4EA39EBC79B6, 2076},
-{0x3560BFC2664A661F, 296},
-{0x35676C177EEF4F18, 289},
-{0x3567AB1F8B7C1692, 305},
-{0x3568C9BC9CDA5A8E, 1549},
-{0x356C104D5703884B, 256},
-{0x356D1DDE1C20FDFC, 335},
-{0x357831FEBA6E2F01, 212},
-{0x357F95A51C3544F0, 2555},
-{0x3582E16E2F531EC2, 330},
-{0x3583C157F06C59D8, 494},
-{0x35854DC05791DA76, 657},
-{0x35899A0F3857CACB, 705},
-{0x358B97A5C9A13C54, 441},
-{0x358F528CE953F229, 700},
-{0x35938CAD858FC833, 294},
-{0x3595C00917B64EBA, 841},
-{0x3596ACADDC98575D, 767},
-{0x359FF6DC1BB09A47, 292},
-{0x35A75227C85DAB9B, 4941},
-{0x35A974D10A5D1862, 487},
-{0x35A9B9B06EA49E6C, 253},
-{0x35AA1ED07FC45445, 284},
-{0x35AC8BC615A16AE1, 19021},
-{0x35B3998915F4EDDC, 52796},
-{0x35BB1CD6BC16A968, 249},
-{0x35C3C3DE428B68F8, 400},
-{0x35C73994283E833E, 2128},
-{0x35C7C9BE4F4C6500, 1052},
-{0x35C7F6B94A533579, 226},
-{0x35C9A2662DF58C01, 2349},
-{0x35CC0ED1DC00DCB1, 313},
-{0x35CC3445C6A14E7A, 231},
-{0x35CCB4DD3B0C70A0, 284},
-{0x35CD8362CEDC41DC, 252},
-{0x35CE9387717B4089, 338},
-{0x35CE9F4CC2A58DEA, 480},
-{0x35DA6339D3485082, 351},
-{0x35DAD0E2616FB342, 222},
-{0x35DCC5FFAF742FB0, 204},
-{0x35E6A936B1393C1A, 476},
-{0x35E7333600CEFD1C, 1048},
-{0x35EF8CB30C7A621B, 391},
-{0x35F344576D5E909E, 256},
-{0x35FC97B1AEC7B4EC, 228},
-{0x3613092851041C47, 404},
-{0x3615129E4F4FFD83, 247},
-{0x3616D709E493F921, 215},
-{0x3617BF45753AFB66, 229},
-{0x3617F6FFA9F8A4C8, 340},
-{0x362219F18A0616E1, 1152},
-{0x362459E68AB856B8, 340},
-{0x3624691680DC1CF3, 1332},
-{0x36270085D8DB69E8, 2380},
-{0x3630DFC3D117F602, 374},
-{0x3631FC63A8A25184, 2358},
-{0x36334327657D3D57, 390},
-{0x3633F79D1FA15BEE, 412},
-{0x36358E4D138DE7D7, 689},
-{0x3636B492E3C1FD98, 489},
-{0x363720EB52BCC0B0, 222},
-{0x3638390C2AC7206B, 364},
-{0x363EC208CDDEED67, 319},
-{0x363FAF00314A2046, 1273},
-{0x36432E918DB8B3D5, 537},
-{0x3645BED7FE7D3A86, 696},
-{0x3647C3605191F8D1, 208},
-{0x3649D39214203BA7, 378},
-{0x364CFC066C48C314, 372},
-{0x3653A34E638ACF1B, 362},
-{0x36555DF6C556D305, 503},
-{0x36588DAC41FD596F, 236},
-{0x365B908B46F2C41D, 639},
-{0x365F974704AFB546, 261},
-{0x366092BB54B78F05, 925},
-{0x36666E573BCC0292, 280},
-{0x3668FBDD20F4C2CB, 234},
-{0x366DD13DC9577BC7, 765},
-{0x3679A2112680EC56, 416},
-{0x367A64141047B7B9, 368},
-{0x368700A8D5AC4142, 387},
-{0x368C515D1657ED25, 302},
-{0x368E2386760E713F, 385},
-{0x369A17FDDBCAC24F, 213},
-{0x36A12E1A6AD37DFF, 15944},
-{0x36A3137B51165E38, 314},
-{0x36A3EBC0715E9A02, 460},
-{0x36A87C9D0E4C3249, 297},
-{0x36AAB4DDBE3A6AC5, 617},
-{0x36AB303DA3FF8584, 295},
-{0x36B15F43D91BEDDE, 606},
-{0x36B3EE522753B37E, 233},
-{0x36B91B60A7C0902A, 300},
-{0x36C57DDEACC8C00F, 275},
-{0x36C818B0FFCC39CB, 415},
-{0x36CCA9D60EE2C959, 452},
-{0x36D039C4CDB0BFDE, 256},
-{0x36D0D73DFB232A98, 440},
-{0x36D19A4FAA961083, 1221},
-{0x36D5E70C819B2E38, 284},
-{0x36E3CCD6EB835BA4, 340},
-{0x36E523CA75F96754, 201},
-{0x36EA4DD59E963578, 210},
-{0x36EB829599BA00AC, 499},
-{0x36F37C6BA3CD605A, 255},
-{0x36F3B920F671A1AC, 299},
-{0x36FD2EC4F361D63C, 713},
-{0x3702DA6AD9D3E23D, 3788},
-{0x3708C4EEC5DE426D, 556},
-{0x3709E97C84EAC556, 345},
-{0x371478F330C8B91D, 1094},
-{0x371514FAC4748B81, 1174},
-{0x371533067EB8DB20, 321},
-{0x371C6467EF2B2034, 375},
-{0x371D1364102182B4, 296},
-{0x3720D8C0F0681808, 1356},
-{0x37218B5D270DA98B, 815},
-{0x3721BF8C13BEAF8F, 278491},
-{0x37224F660C6669E5, 544},
-{0x3722A033CA8CB042, 476},
-{0x3723AC423825925D, 1134},
-{0x372682586660D9AC, 793},
-{0x3726A5ABC0C1B2B9, 242},
-{0x3726EB569D7B90D3, 427},
-{0x3728E2AE2DD668F0, 503},
-{0x372C9C9B7B1BBFFB, 1036},
-{0x372CFC5AF866B3A0, 463},
-{0x373D03FA304FFB29, 248},
-{0x373E0D2846873724, 220},
-{0x37462CB2CB7F7AFE, 857},
-{0x374CABB728E92D6A, 643},
-{0x374CDB7869465028, 239},
-{0x375233D9F7257092, 566},
-{0x375C30524BB5DAF7, 275},
-{0x3762CEF81E561EDE, 603},
-{0x3763E79649347667, 940},
-{0x376844B6D267E190, 415},
-{0x377125F74F777C45, 265},
-{0x37770BA62FC2BD49, 376},
-{0x377BB84A86BEBCAE, 638},
-{0x377EDA70561C5BFE, 501},
-{0x378143968586C4E2, 224},
-{0x3784A2A3185338A3, 425},
-{0x37875E6AC608211F, 2026},
-{0x3787769DC3DECA21, 500},
-{0x3788FE1957AEC7DD, 248},
-{0x3790C2F2D4129471, 352},
-{0x37950C4DA151C5A2, 611},
-{0x3795381BD9B4310D, 1077},
-{0x3795DF096E64E584, 438},
-{0x37975442EC3EDECA, 1971},
-{0x37A3ACF47B4B8A3D, 201},
-{0x37A730F5D1039AC2, 281},
-{0x37A9359B8313EBDB, 246},
-{0x37AA16750DA90C15, 257},
-{0x37AC63FE5F6C87D5, 863},
-{0x37B9ACEC063CA8AE, 264},
-{0x37BB7FEB4133ABA3, 383},
-{0x37C078263F901653, 895},
-{0x37C25E8786AAFD8B, 18274},
-{0x37C35BFC318D29C0, 286},
-{0x37C5165FF820921C, 300},
-{0x37C686E0A990A861, 466},
-{0x37C7870A87B5B372, 1173},
-{0x37CCAC1622150EDF, 221},
-{0x37D0653897D169F4, 322},
-{0x37D21D4DEFFA75C3, 535},
-{0x37D3CEB11C064032, 2716},
-{0x37D552C8F2245674, 1755},
-{0x37D7798A34B8CB8B, 407},
-{0x37D791CAF32B3196, 3610},
-{0x37D8958F14039DA0, 249},
-{0x37D9611C3C27BF7A, 612},
-{0x37DC779B4B6190A5, 399},
-{0x37DF59F88668B2D4, 478},
-{0x37E16A9650012AA9, 517},
-{0x37E46875C64F993A, 240},
-{0x37E63390777E29D5, 219},
-{0x37ED64D14F565D9E, 425},
-{0x37F1249ECE21BB03, 1181},
-{0x37FF68FC48C2B784, 288},
-{0x380010B733424556, 214},
-{0x3801070A0B78E3CA, 344},
-{0x3805F558E9C0E8C3, 345},
-{0x381118C007ED8589, 338},
-{0x38146F1951C9BE46, 382},
-{0x3814CF9E2B77DB3A, 1611},
-{0x38193A3459A41A42, 890},
-{0x381955E30EDBF6E6, 686},
-{0x381A371B67CA181E, 6578},
-{0x381C3AD3DDB4DA61, 337},
-{0x381E977398153593, 534},
-{0x382098EF63F5FD39, 2548},
-{0x382478FC1417274C, 376},
-{0x3828D943AEC03F67, 458},
-{0x382C2805957A6EA0, 2363},
-{0x382D2C0B6D88AC1C, 232},
-{0x382DF3237B7CE311, 203},
-{0x3834A196D209F90C, 242},
-{0x383556620A730EF2, 971},
-{0x3836D947931AAFB3, 269},
-{0x3837025A55420801, 2235},
-{0x3839B3320C5942D0, 516},
-{0x383BB9C56C649B79, 661},
-{0x3841CB49224CF592, 278},
-{0x3848A5FD17BE56EE, 614},
-{0x38497697FE6AE2D2, 457},
-{0x384AD6F5257A9ABE, 472},
-{0x3851F53A1B03FDFD, 224},
-{0x3857ADA08C9626B4, 201},
-{0x3857AE8AD3754CF8, 213},
-{0x3857CED1AE2897E2, 981},
-{0x385880FB2665BA79, 826},
-{0x3858B3981C85F892, 226},
-{0x385BABD2860FC845, 222},
-{0x385F6A0180EFC666, 298},
-{0x3860C73A8F40C97B, 220},
-{0x38677C173F1A7825, 203},
-{0x386AEB021C65E0C7, 441},
-{0x386E6E6DE0A3E912, 205},
-{0x386FFF65238A60F6, 262},
-{0x38702F870A920908, 2290},
-{0x387419C164B3DA52, 783},
-{0x3874210BA95078AA, 409},
-{0x3875080B4450D5C4, 277},
-{0x387DDCA2AADA5916, 269},
-{0x388183B323E7F093, 305},
-{0x38819BEE3E35798C, 269},
-{0x38819CC9DB08CA54, 742},
-{0x38824442AD2D29D1, 256},
-{0x388A2C58CA7CCA23, 440},
-{0x388BF08E700A1FEB, 1435},
-{0x388C3CBE1D353D8E, 318},
-{0x388E7590F275EAFE, 393},
-{0x388FA12041CCE5DB, 212},
-{0x3890AC514789A9BC, 261},
-{0x38994BB850B2749B, 1945},
-{0x389D96B3022939D5, 361},
-{0x389F0B143767F3B1, 227},
-{0x389F8FDE2FE58041, 306},
-{0x38A995B55D5B2881, 352},
-{0x38B29F72C2616686, 629},
-{0x38B36757462DC467, 279},
-{0x38BCAC09DB8254E7, 560},
-{0x38C0F58EE394E77A, 734},
-{0x38DA8008C6F7FECF, 4409},
-{0x38DD61580AA9F2B2, 310},
-{0x38E8E27753F3F792, 228},
-{0x38E9415443BDD1E2, 1999},
-{0x38EA2B6DA6B64FE5, 243},
-{0x38EACF659BE08415, 292},
-{0x38EED27555688D7E, 2630},
-{0x38F32053AA10812A, 472},
-{0x38F3335075BEBF52, 204},
-{0x38F568CFDACB180F, 203},
-{0x38F85199C38FDDBC, 367},
-{0x38FBBBE3199698CD, 341},
-{0x38FD10029B291C79, 6102},
-{0x390580C3451F1FD7, 288},
-{0x39066D70665DAFA5, 502},
-{0x3911BC67F64EE977, 1987},
-{0x39153C649823300A, 354},
-{0x391ACADC0C49C371, 379},
-{0x391E593EAD55C553, 241},
-{0x391E70CA5437CF36, 651},
-{0x391F845C5A56FA84, 1078},
-{0x391FD81D22301280, 299},
-{0x3921F7EE0335DE2E, 680},
-{0x39242EE1AD331550, 1801},
-{0x392CD3A6D66A635B, 441},
-{0x392E9C7EBB57CD2A, 243},
-{0x392F62FA5913CCEB, 698},
-{0x392FA589C2D7D7BA, 1016},
-{0x3931D8B82362AB4E, 669},
-{0x3936CE5273F916A2, 1065},
-{0x393C030BF39E7E90, 1560},
-{0x393D6D38BC4F0DEC, 333},
-{0x394546856D04041D, 1578},
-{0x394FACD49C4A7B7C, 529},
-{0x395A57B16EA6253C, 234},
-{0x396097627D826534, 322},
-{0x3961382A17675574, 412},
-{0x396153F250B356F8, 253},
-{0x396EA3508A7399F1, 235},
-{0x3971424C05D5A298, 2341},
-{0x397EA85BFB1C3318, 341},
-{0x39813047074E4E23, 481},
-{0x3982F93BCD99A06D, 339},
-{0x3984062DDD4A57E7, 3147},
-{0x3987E5F3EC96FAAD, 614},
-{0x39889B6D38FA7709, 259},
-{0x3989AB358A0E8FB6, 2310},
-{0x3990F9A951124771, 599},
-{0x3991EDEF1A1DFBA3, 250},
-{0x399547033D024309, 456},
-{0x39995F90D9A0FF6E, 986},
-{0x399A0BDA51505799, 218},
-{0x39A00B3448BE88DD, 499},
-{0x39A3117111261F8D, 839},
-{0x39A64F429B76F50C, 204},
-{0x39A857029B7C5047, 653},
-{0x39A9211825C5D4C6, 470},
-{0x39B0E4AC1C84604B, 233},
-{0x39B126B61786D93A, 1473},
-{0x39B240C27EB05AAF, 222},
-{0x39BB5C3FCBA71637, 747},
-{0x39BD73E5B98F047D, 387},
-{0x39C6C19DBA23091A, 262},
-{0x39CECC36C7B63324, 1482},
-{0x39D7E778EECCCCB4, 469},
-{0x39D8DC6E525DEE2E, 1479},
-{0x39E79B808C8F5692, 3347},
-{0x39EE0E61E7058748, 501},
-{0x39EEBB802C3945F6, 625},
-{0x39EEE11724F56703, 381},
-{0x39F7AE9481887567, 362},
-{0x39F965B75EE86E80, 1422},
-{0x39FF07DEE80C65FD, 329},
-{0x3A05C80050E761AC, 213},
-{0x3A0744628497C472, 235},
-{0x3A08AE139CC30037, 665},
-{0x3A0AC155210170F9, 283},
-{0x3A0B33CA8AF068D4, 275},
-{0x3A0BED7F7BCE91BD, 358},
-{0x3A0CF7977F3D9F69, 361},
-{0x3A0DB4417E964523, 236},
-{0x3A160DC6498618E0, 225},
-{0x3A18B0D079BA2EB1, 416},
-{0x3A1B93B184F687C7, 393},
-{0x3A1C23856AF87B13, 579},
-{0x3A216C498B770EA3, 367},
-{0x3A23547F0679FB00, 258},
-{0x3A2DF9FCF08B6917, 495},
-{0x3A3B3BB66700E125, 209},
-{0x3A47548032EC3FBE, 217},
-{0x3A490B498FE6D918, 262},
-{0x3A4C2DB0710011ED, 1364},
-{0x3A5154EA7A93CF34, 659},
-{0x3A5E8FE1698CDE43, 242},
-{0x3A6628DE6DAE56AC, 3449},
-{0x3A6652FD687E1DA2, 535},
-{0x3A6A2CE87CBD59C4, 267},
-{0x3A725D46F286865B, 668},
-{0x3A7A5041C2C6FEEA, 384},
-{0x3A7AD02FE2083A33, 733},
-{0x3A846B366F9DF9B2, 1858},
-{0x3A9373373871E324, 212},
-{0x3A98A6514C6273F5, 212},
-{0x3A99D55F99725622, 276},
-{0x3AA2C9AF94741E38, 11698},
-{0x3AA4DCD6B2541ABC, 2972},
-{0x3AA8FDE4C6449408, 735},
-{0x3AAEA47603974138, 309},
-{0x3AB329E28A1D06DD, 270},
-{0x3AB39711AA2210F5, 274},
-{0x3AB96354D8591744, 888},
-{0x3AC5CA8724DD4C90, 525},
-{0x3AC9771FD708CE76, 232},
-{0x3AC9DC8EA44BE5CD, 31623},
-{0x3ACE133F2AF577D1, 201},
-{0x3ACE8BBA11E46927, 734},
-{0x3ACF10E988284F1A, 726},
-{0x3ACF840D46C31591, 448},
-{0x3AD23A7FAB53DC4B, 340},
-{0x3ADEF4AFB92A2BF7, 658},
-{0x3AE3B91C5965728E, 1684},
-{0x3AE7932D487B1D76, 223},
-{0x3AE97D506EE84DC6, 420},
-{0x3AF66C73D28CD517, 492},
-{0x3AF9D21A780D85C0, 776},
-{0x3AFBB5CFC2417E94, 1441},
-{0x3AFC35424CE97A19, 202},
-{0x3AFDA07B50DB04DE, 578},
-{0x3B019D2445E4EEC1, 1637},
-{0x3B01FC33D5508B5C, 317},
-{0x3B039B8DBC1B3B16, 5246},
-{0x3B14F8002EE4A818, 3656},
-{0x3B1A8EBD852E3048, 1608},
-{0x3B1DED3A86EFCA78, 548},
-{0x3B1DF4E3965830D5, 990},
-{0x3B20E21431758CB1, 251},
-{0x3B21DA79D40C52EB, 406},
-{0x3B23C0B3B4A3FCF6, 479},
-{0x3B2A6E5CF22611F6, 815},
-{0x3B332A4C8635E7BD, 1537},
-{0x3B381292B0B03B58, 1709},
-{0x3B3E3BC4FD5ECE7A, 418},
-{0x3B4334081C0E6E2B, 669},
-{0x3B434AAC2E281619, 363},
-{0x3B54476252DA3C00, 258},
-{0x3B54E150ED855147, 243},
-{0x3B56C3565C929C59, 292},
-{0x3B65FCEA3766517B, 245},
-{0x3B6929A4B522D372, 266},
-{0x3B6C68A5EE201948, 275},
-{0x3B76F24EAFAAE627, 3608},
-{0x3B7CCA9BD247ADD3, 206},
-{0x3B84AD9D51512E4E, 221},
-{0x3B87AE71CA6AD3F7, 260},
-{0x3B87B694F693DE6F, 386},
-{0x3B8A322E670AAAA1, 503},
-{0x3B9369186EC76FE9, 235},
-{0x3B97B6030425BC85, 305},
-{0x3B98A21BBE55F6EE, 215},
-{0x3B9B988F56DE9366, 305},
-{0x3BA7DBBCA618E154, 370},
-{0x3BA868F928597D38, 425},
-{0x3BAA7AE27AA050CD, 230},
-{0x3BAB8363E793B1FB, 606},
-{0x3BABB96E71FA9003, 223},
-{0x3BB0E92F7DC38289, 692},
-{0x3BB5FD10DDC9819A, 253},
-{0x3BB6ABACF68E03FE, 439},
-{0x3BCC71EA52BBCC7F, 910},
-{0x3BCCDAAE1675AEBD, 418},
-{0x3BD1EC7B726D1B54, 581},
-{0x3BD1F8F1FEC37FE7, 205},
-{0x3BD873BFFBF87C71, 276},
-{0x3BDF31BDD0C8FF25, 1612},
-{0x3BF15D6069FB74D0, 341},
-{0x3BF3E9AB105B991F, 446},
-{0x3BFD80C2352D9ED3, 402},
-{0x3BFDED3AA4E67DFF, 508},
-{0x3BFED67C63C4EB99, 1598},
-{0x3BFF2589F48E29D5, 555},
-{0x3C00CAB4F451A679, 280},
-{0x3C03FE7F9924EB51, 201},
-{0x3C0AA793D66534C2, 333},
-{0x3C0D626B0ACC1DA8, 570},
-{0x3C0E8CA6642342E1, 414},
-{0x3C133962F9D69099, 203},
-{0x3C1BEDDCCB71FECE, 585},
-{0x3C24D66875AE4B58, 290},
-{0x3C2AC494774350D1, 1227},
-{0x3C303FCA7900A08D, 1955},
-{0x3C326C31118E4909, 540},
-{0x3C33B713D3FCD657, 714},
-{0x3C359A6FC34D0E89, 215},
-{0x3C38164FFA389444, 236},
-{0x3C387E6F18C556AD, 1884},
-{0x3C433E4B0E9A21EA, 435},
-{0x3C437D71874CA35D, 269},
-{0x3C480B43C0F546DE, 834},
-{0x3C48288630222C8D, 203},
-{0x3C56ADEA114D5375, 584},
-{0x3C5B659C0AF8F3C3, 340},
-{0x3C5EF5C568679C40, 465},
-{0x3C6261371990D745, 250},
-{0x3C66C488032DF2C5, 591},
-{0x3C6B7DC6271649F8, 597},
-{0x3C6BDADEA5D7503B, 1676},
-{0x3C6CD52C7018B2F5, 221},
-{0x3C70E5A390838A98, 476},
-{0x3C722194957426C3, 283},
-{0x3C7C0C0A080EAF1E, 499},
-{0x3C7CB269672E5C09, 213},
-{0x3C7CC916E28EF1EA, 676},
-{0x3C7CEF8D0E245EBA, 3992},
-{0x3C7E482E1CCF39FD, 399},
-{0x3C82AE0EA824F2EE, 952},
-{0x3C85D5F04C24EC8B, 4502},
-{0x3C85F5CBBB712A17, 272},
-{0x3C88D583EEB9A627, 361},
-{0x3C96B118BC52C5F0, 225},
-{0x3C99904585DA2B5D, 493},
-{0x3C9D2859FDE73406, 408},
-{0x3CAA34CB9C2C051D, 360},
-{0x3CAF8A8920EFE23A, 200},
-{0x3CB36CFE29848939, 405},
-{0x3CB8040B19DFB1B4, 617},
-{0x3CC0986A33329B38, 254},
-{0x3CC12F873CB57071, 1560},
-{0x3CD0B0D17CAD313C, 911},
-{0x3CD25EC5AB5771B2, 687},
-{0x3CD4123796E83C4A, 1835},
-{0x3CD5363C4A911A8D, 244},
-{0x3CD8EB75E0C341F0, 1281},
-{0x3CDC19F0429843EB, 502},
-{0x3CDD18EF62072796, 777},
-{0x3CDF19C6B76F2247, 719},
-{0x3CE242341E67100B, 684},
-{0x3CE3914169754B48, 243},
-{0x3CEE7A9CC773A8D0, 2376},
-{0x3CEE964330304FCE, 2385},
-{0x3CF87E2D146EF61F, 251},
-{0x3CFC4E85A506CCED, 3231},
-{0x3CFE92D182840892, 361},
-{0x3D05FBFB33E98EB4, 204},
-{0x3D0730F687016188, 333},
-{0x3D12545E99449DEA, 206},
-{0x3D1C7A4AFF8CC395, 266},
-{0x3D1C972EFD14DCE0, 288},
-{0x3D2072658103DB24, 1017},
-{0x3D25BCC0CDBBF6E4, 238},
-{0x3D28181FEB8730F2, 354},
-{0x3D2B4CA60C6FF7DD, 789},
-{0x3D2B687F5E1C4F21, 419},
-{0x3D2B957FD7483428, 204},
-{0x3D2D4A56AF1DDE88, 204},
-{0x3D31EE0E64EA4F49, 232},
-{0x3D321D9BE6FCF3B2, 266},
-{0x3D40813DAF170DBE, 790},
-{0x3D432EA040AF06D8, 273},
-{0x3D47A5DCBE1E5E26, 205},
-{0x3D4C119DB2D216D2, 281},
-{0x3D4E5CC07A22BD69, 236},
-{0x3D520207F7847D76, 239},
-{0x3D520E3FF923F40F, 1383},
-{0x3D5B2156ECB09A00, 390},
-{0x3D6ACAC153A998FA, 547},
-{0x3D6E69ABAC81CA0E, 210},
-{0x3D7081BEA6FA1A5A, 209},
-{0x3D711B2A4AAFAE58, 205},
-{0x3D75FF077B689E1D, 3547},
-{0x3D80E1C5358EBAFE, 202},
-{0x3D84DE522BA0F5A1, 1059},
-{0x3D8B9BCB441CB9F1, 268},
-{0x3D8C64F2C8D41ABB, 1021},
-{0x3D8CBFA237B2A7F7, 376},
-{0x3D95681237AF21AF, 509},
-{0x3D9608A086C29118, 296},
-{0x3D9A015AD3FFB7D8, 406},
-{0x3D9D251A20AF0CDC, 5945},
-{0x3D9D41E127EA32CA, 236},
-{0x3DA59A9282D60A94, 421},
-{0x3DA7C5D8B4E8EF9F, 676},
-{0x3DA9F071EE87A3F6, 672},
-{0x3DB52EBB82836F08, 217},
-{0x3DBBA8EFA8A84480, 350},
-{0x3DC08BE5D8BFCDA4, 456},
-{0x3DC09763FEF9C2B3, 502},
-{0x3DC0EB5786B5C975, 324},
-{0x3DC521A2C4ADE409, 236},
-{0x3DC8238B6FB72817, 265},
-{0x3DCB11E30CE03A5C, 227},
-{0x3DCC4BCD7D7A31AB, 233},
-{0x3DCD6815B570D518, 12806},
-{0x3DD197C4AE6AED01, 362},
-{0x3DE76C08641F5DB1, 607},
-{0x3DE91E3545A078D1, 201},
-{0x3DEA44C687396E7A, 1368},
-{0x3DEC8E302D39800C, 769},
-{0x3DEC93081C3B01A6, 735},
-{0x3DEDD22C488CA499, 252},
-{0x3E08DAE1F52F4F5A, 207},
-{0x3E0B71485C8C9B00, 382},
-{0x3E10056B704DF675, 363},
-{0x3E1B7996D49BCCDE, 291},
-{0x3E231D52D354A303, 215},
-{0x3E28977F21A3E9A1, 314},
-{0x3E2D2A54D59CDEF7, 216},
-{0x3E3230083CC746F1, 640},
-{0x3E3419D50E9892CF, 324},
-{0x3E3A60CEAA83D54E, 211},
-{0x3E3B69ECCA25E099, 492},
-{0x3E3D4F86C6C0F864, 369},
-{0x3E3E4E67C98881F5, 658},
-{0x3E3EE12D3607A658, 393},
-{0x3E3F2CC43ADD2838, 588},
-{0x3E44D0C3378B8491, 326},
-{0x3E4785406F9A180C, 450},
-{0x3E47B27E801AAA82, 202},
-{0x3E4B6773D5AE08AD, 254},
-{0x3E4BA51112EF703C, 1924},
-{0x3E67C70E09EAA16E, 218},
-{0x3E68AFFA303AB6BB, 258},
-{0x3E6A7526D0455295, 484},
-{0x3E6CF998674C2385, 528},
-{0x3E702E31D6DC8666, 346},
-{0x3E704C72CE47C802, 344},
-{0x3E7293FC91AD8D33, 627},
-{0x3E78153996D735E2, 552},
-{0x3E82C27ADEB2D404, 2533},
-{0x3E8479819C47592C, 331},
-{0x3E8A914A22465728, 306},
-{0x3E8DAB8198DBC58C, 305},
-{0x3E904AD9B23F7F3B, 398},
-{0x3E94A02CA912BC36, 346},
-{0x3E96BAB43B493C93, 262},
-{0x3E99417DDE8CE010, 311},
-{0x3E998BA9227888E3, 245},
-{0x3EA41DF67FB60565, 268},
-{0x3EA4A59AFA584F94, 339},
-{0x3EA84B262460D535, 840},
-{0x3EAD370D75FF49AE, 498},
-{0x3EAF611A2496A513, 4485},
-{0x3EAF64DED1B4C59C, 255},
-{0x3EB3071CBFB012B0, 790},
-{0x3EB8EDB08CDB7DAB, 3021},
-{0x3EBAB170A9A2E65D, 514},
-{0x3EBB2988B3406463, 212},
-{0x3EBB44B5BE657B5E, 2136},
-{0x3EC5C7B45A2D58D6, 316},
-{0x3ECA199F51CF2A56, 325},
-{0x3EDED97E9F6E69DF, 371},
-{0x3EDEF27C996C2E1E, 1147},
-{0x3EE0802088B6F718, 307},
-{0x3EE1F8E17A1ADE23, 1965},
-{0x3EE2DF7D265B1FD0, 321},
-{0x3EE55FCF1832715E, 253},
-{0x3EE5824D510441DE, 285},
-{0x3EF14C257FE8D329, 262},
-{0x3EF8F0DA41F037D2, 232},
-{0x3F02BD306FFF0259, 328},
-{0x3F046C639AA49B19, 800},
-{0x3F04E891EA45C84B, 510},
-{0x3F066D4D6702DD93, 506},
-{0x3F16EE0BF3D36390, 352},
-{0x3F1AB653052BD941, 307},
-{0x3F20C9E286367955, 621},
-{0x3F24278BCF6E9D71, 682},
-{0x3F28506C99E9CCCA, 1865},
-{0x3F2E0CA6550267DA, 515},
-{0x3F2FB47FDAEFF0BE, 303},
-{0x3F31266A8C933E83, 254},
-{0x3F3F23D494E410DD, 439},
-{0x3F41DF3FBC9BDD48, 406},
-{0x3F453B72B2B2F178, 277},
-{0x3F47285B670D3BE8, 269},
-{0x3F4A35AF751E6375, 405},
-{0x3F5118667C2C4B8E, 212},
-{0x3F536EC1ACEF5D5E, 1358},
-{0x3F55A4840D2132FE, 327},
-{0x3F589B7D2189A1F2, 340},
-{0x3F5A93B26C21A354, 592},
-{0x3F5D8DF4A10E1554, 499},
-{0x3F637B62F73F4BEC, 290},
-{0x3F63FE63196A30CE, 217},
-{0x3F6464C68EC8A19E, 221},
-{0x3F69C70F86C635C4, 255},
-{0x3F6DD54FAC5091C7, 909},
-{0x3F7A943B5C411DEB, 328},
-{0x3F8392DFF1C080A6, 271},
-{0x3F8B86EB4A03BC54, 865},
-{0x3F8FCB769D7639A4, 229},
-{0x3F9BD066A2FE60D9, 270},
-{0x3F9C87CC65CE647F, 360},
-{0x3FAE4829AEBAE5DB, 418},
-{0x3FB598106AF7B721, 282},
-{0x3FC13ACE8E497622, 649},
-{0x3FC5ACC92A2E5539, 723},
-{0x3FC735AB8E3EE4D8, 203},
-{0x3FC9B006F99A0FE1, 217},
-{0x3FCAC643CAD9ADBB, 558},
-{0x3FCC14F2889C6EF7, 391},
-{0x3FCF48EF5097BF3D, 1102},
-{0x3FDC0F6CB7BAE5B5, 204},
-{0x3FE526EAEA246ADC, 871},
-{0x3FE9B56BA9B2E304, 376},
-{0x3FEB8B04A4CC5CAB, 1231},
-{0x3FEDAA2C098BD6AE, 252},
-{0x3FF6110EB87C97CD, 316},
-{0x3FFC7430423C12F1, 4262},
-{0x3FFCEEBEAE95A06C, 1024},
-{0x4000FAC31ECED226, 436},
-{0x40090AF0493AAB94, 350},
-{0x400A2A31361D456C, 772},
-{0x400BA4AAA499E77E, 201},
-{0x4013B5B2857023EB, 2886},
-{0x401580A06D550C0B, 1638},
-{0x402FE8EF12CE66C6, 228},
-{0x4037D26ED28F7F25, 223},
-{0x403E490479936C8A, 254},
-{0x40406E95BE0A3416, 8635},
-{0x4040A3FF94BD386A, 385},
-{0x40422B4ED17288E8, 1778},
-{0x404BDA24822776CC, 300},
-{0x40539ABC5D15218E, 3028},
-{0x405FC43F1ED2057B, 2102},
-{0x4062EF4A0A718406, 308},
-{0x40658CE822E12514, 522},
-{0x406F3D8394F9D090, 255},
-{0x406F3E9DEB25E39A, 271},
-{0x4077600E40B73113, 218},
-{0x407DCD05068CDF69, 1129},
-{0x408451ADF9C4A66F, 353},
-{0x40873125CDE34C5D, 773},
-{0x408B1A62F33382A1, 279},
-{0x408B437572D37E0B, 229},
-{0x408CD3F8A571A1E5, 439},
-{0x408E9098CC34A6C5, 374},
-{0x4097E7193915D19F, 611},
-{0x409D27F566DAB4DB, 218},
-{0x40B712865B1ACB4E, 341},
-{0x40BCE729E7FBADA1, 2301},
-{0x40BDD4AA2277E018, 13334},
-{0x40C1CEBD9E747256, 361},
-{0x40C520BF7243BDB7, 310},
-{0x40C88DF783912475, 529},
-{0x40D50CB3E1ECD0A5, 622},
-{0x40DAA3C12050B190, 285},
-{0x40DC2FEC9B3080F0, 216},
-{0x40E159C98CC1DB52, 405},
-{0x40E3CFFE6B47755A, 676},
-{0x40E570551484EDDA, 7005},
-{0x40E7177EBC203376, 599},
-{0x40E77C7794B62798, 447},
-{0x40EC1B3DD1B27B17, 1029},
-{0x40F44D931018BB4E, 298},
-{0x40F4EED3D350154D, 921},
-{0x41008D7B989CB91A, 372},
-{0x41024B09F341EE46, 484},
-{0x4111FE73FED20473, 259},
-{0x41144D888EFE76FB, 495},
-{0x41165A8C632D266C, 623},
-{0x411800EBABF15C6F, 448},
-{0x41188188BA86A9BE, 1663},
-{0x4123404B76625A37, 466},
-{0x4128110071EE97B6, 324},
-{0x41311905FA5E2C29, 1227},
-{0x413130A8DAFE0195, 403},
-{0x41391B2AFCC3DE88, 1028},
-{0x413995948CE64D61, 526},
-{0x413D931F3F30BF17, 230},
-{0x4141F3DE148DF463, 402},
-{0x4145AA6320EF6BC9, 531},
-{0x414BCC5C08DEE0B2, 271},
-{0x414E3F0EF03CE4D5, 2051},
-{0x414E784A595E6621, 348},
-{0x414FA9F020911BA4, 1050},
-{0x4151C4A66F2B6B5E, 2583},
-{0x41571FBA9821599D, 909},
-{0x415C1F927EE8DA5A, 433},
-{0x415DD74D03204EAA, 1451},
-{0x4161F2C10ECCE27F, 279},
-{0x416377D7DBBFDAED, 705},
-{0x4163E998DE08D884, 471},
-{0x416AB11285FF524F, 359},
-{0x416AD04BEE9A5CEB, 704},
-{0x4172DB141B396527, 1700},
-{0x417353058E320251, 275},
-{0x417629E654246C43, 210},
-{0x417C745E703F5E70, 222},
-{0x417E6E312844ECBD, 388},
-{0x4180A02BD199335B, 227},
-{0x4186E5CD7364F8C7, 263},
-{0x418832D196588608, 624},
-{0x418F48FCCEF7DD3E, 1094},
-{0x41964FE53AF52478, 443},
-{0x4197A7CF5A09B021, 283},
-{0x41999B7769DCE17F, 301},
-{0x419CCBBBD9E012DB, 286},
-{0x419DB629FA057D20, 811},
-{0x41AFB79D29CA0F7B, 253},
-{0x41B283E9ABADCB24, 917},
-{0x41B32CEA79C35941, 250},
-{0x41C09B5C828E581A, 510},
-{0x41C1343A589AA908, 414},
-{0x41D5EA8C8E792652, 346},
-{0x41DE0174CB15749D, 441},
-{0x41EAEBB26618893C, 554},
-{0x41EC34F454007FE6, 444},
-{0x41F0EA05CF9BE181, 606},
-{0x41F64D15F1CE5287, 775},
-{0x41FB2505AF8BF1E8, 2634},
-{0x41FCDF8FC2BA45CF, 896},
-{0x41FF5A5E06EA2CAE, 4075},
-{0x4204E9C67828DDE5, 764},
-{0x420F3AA7EFAB7806, 887},
-{0x421274A18781EB4B, 255},
-{0x4213FBFB057BE421, 419},
-{0x4221096974BD7FB7, 4584},
-{0x42256FA60C9DA2C0, 1082},
-{0x423088D639D24D5B, 246},
-{0x423784FD7438E853, 437},
-{0x423823148A5E4009, 693},
-{0x423A464AD80AC617, 286},
-{0x42480279F84CA364, 244},
-{0x424C0AFF7267D331, 247},
-{0x42547C745E989903, 203},
-{0x42570A50BC73790D, 470},
-{0x425949EBCF0F1CEE, 200},
-{0x425E3EB1820EB3EC, 5906},
-{0x42602820EABA98DF, 275},
-{0x426042655069B098, 310},
-{0x4264C38A1487C6F8, 1697},
-{0x426544233839F984, 239},
-{0x42709F048160C98E, 225},
-{0x42717FB60547DC8E, 336},
-{0x427406AC114F972D, 224},
-{0x427A7631AD3B33A8, 1049},
-{0x4280BB4FD9CD14C2, 863},
-{0x42899FB199F8C1F6, 240},
-{0x4290574401C012FF, 866},
-{0x4295B217E2C9A9BB, 325},
-{0x42996511E0F56B95, 6687},
-{0x42AB73EE75BE2D7E, 228},
-{0x42AE59FA8211F0F4, 205},
-{0x42AEA306E8106F97, 439},
-{0x42BB6C75D6449941, 243},
-{0x42BC36D981B0F32A, 699},
-{0x42C2279EA4E25260, 1828},
-{0x42C4A77693AB0662, 4301},
-{0x42C5731D034A17EB, 409},
-{0x42C8040A11CFEB6E, 281},
-{0x42CCBCBC9D1E29F3, 1227},
-{0x42D6FE035F678AF5, 243},
-{0x42D750DB63998FE0, 219},
-{0x42D8F96510B58E3B, 1030},
-{0x42D909D72D1C48BB, 14675},
-{0x42DACE34C821F257, 261},
-{0x42DCC94B44BE82A5, 325},
-{0x42E15D5C75D877FA, 345},
-{0x42F4C8BF1556102E, 372},
-{0x42FB335DA93A5EB8, 238},
-{0x42FCCA4AE7C3BD4E, 502},
-{0x43057F4CCF139DF7, 348},
-{0x43080B195D736C4C, 611},
-{0x431D6B6985926F4A, 1029},
-{0x4323577AFB530727, 1971},
-{0x4324C0339A0C2355, 403},
-{0x432532738BAB217C, 779},
-{0x432645994E68CE66, 1612},
-{0x43311D14BB318CD1, 242},
-{0x4340F2978AFFF724, 205},
-{0x434D80ACA4BD3039, 265},
-{0x4352FD290D24379F, 3653},
-{0x43530CF2F2EEEC69, 312},
-{0x4357D73D802CF015, 266},
-{0x435ABC7E1D589D5F, 790},
-{0x435AE78FDE1E916A, 223},
-{0x435C3601D64097EE, 418},
-{0x4364A481843A684C, 1829},
-{0x436A6D899C27C74E, 337},
-{0x437529CF059FC5BD, 2261},
-{0x437F85EA7EB34876, 9992},
-{0x438106CF6B9596E0, 218},
-{0x438538C257F6C820, 207},
-{0x43859F33B4B84378, 893},
-{0x4386179BBAAEA858, 5687},
-{0x4387EFE54122B76C, 208},
-{0x4388AEB07FDFFE3A, 256},
-{0x438C59719FCA6EBA, 867},
-{0x438E5A5A82E948AE, 212},
-{0x4393A48460158D0E, 355},
-{0x4396A1A4C6CA0695, 270},
-{0x439912C5A1D376E6, 541},
-{0x43A35CF8C2FEBBF6, 266},
-{0x43BEB82B798F1B6B, 593},
-{0x43BECB77B8EB1FAF, 501},
-{0x43C15414676C7813, 401},
-{0x43C8978C12651DE7, 601},
-{0x43D174D953E4D279, 249},
-{0x43D6CD2CFA61039F, 2367},
-{0x43D88FA239538132, 541},
-{0x43E41DD7126E5EE7, 620},
-{0x43F6B33B593D2F8A, 215},
-{0x44078EDA108E58E0, 250},
-{0x440C6DD9E609088E, 244},
-{0x441120A4CFEC22E3, 232},
-{0x44126DA3F448C241, 681},
-{0x4414D0481AE4C901, 222},
-{0x4426227FDBB38B7E, 835},
-{0x442BD636D50B163D, 579},
-{0x442BE88842BB47B3, 228},
-{0x442D3EC3E09D910B, 332},
-{0x443C27C94F0075E8, 202},
-{0x443D9152048F8A20, 1837},
-{0x443FFD7A02AFDA4C, 2602},
-{0x4445A606CCFBCFC9, 395},
-{0x4449A0B3C26DA3F8, 792},
-{0x444A63D44A288FB7, 2264},
-{0x444C8F506CD45E61, 815},
-{0x445CE68910927F22, 854},
-{0x446788904F0A3446, 561},
-{0x4471D9B9D2D88E24, 248},
-{0x44743BA72090E6D2, 423},
-{0x447A872F4642E2FB, 1215},
-{0x4482A51C324164D9, 673},
-{0x4498DCE38DC2B210, 1325},
-{0x449F41AA20A15B96, 247},
-{0x44A29854248832AC, 347},
-{0x44A7A7E69F44E55E, 5625},
-{0x44AFD0B82B810432, 1475},
-{0x44B46388177AAC9F, 358},
-{0x44B6A087FEBE6E33, 258},
-{0x44BE3DCBAB727DC0, 407},
-{0x44BE89863234EC71, 567},
-{0x44C19A376C854DD7, 388},
-{0x44C6A6C8613CB555, 1794},
-{0x44DF9023DFC079BB, 311},
-{0x44E20AED27CC169D, 959},
-{0x44EB6E1CC2599626, 312},
-{0x44EE88647358F82C, 428},
-{0x44F3024494414212, 402},
-{0x450B6AC8719B2AA7, 256},
-{0x4515E45D98D669B2, 283},
-{0x45196806766ED595, 2202},
-{0x451B1BF98186841C, 472},
-{0x45388488F5E29F4A, 393},
-{0x453CB0B82789B9AD, 1017},
-{0x453FD0558047A01A, 26400},
-{0x454A824547035762, 290},
-{0x454A9F9CE5E0B169, 425},
-{0x454B44912AB5A444, 220},
-{0x45562A6D613501C6, 1980},
-{0x455E9B3123455857, 250},
-{0x45607B2C5ADF344D, 1070},
-{0x4568EEEB3B51B9DB, 322},
-{0x456FCFCA5B73213F, 382},
-{0x4574560A3AE1F498, 220},
-{0x4579DE411F2C85E0, 2548},
-{0x458111E89DB1211B, 1415},
-{0x4582C4C939916325, 359},
-{0x4583DA3AF780AA0B, 350},
-{0x4597C5FC77FC63F8, 233},
-{0x45ABABDD8DC2116A, 238},
-{0x45B73907A8728182, 1227},
-{0x45BD15996DF8D7D0, 2761},
-{0x45BD8DEC13F89401, 638},
-{0x45C744DA08F2AA9C, 318},
-{0x45C75E96CFAE46FA, 324},
-{0x45CBA83FC8457AE3, 212},
-{0x45DAA0772F63513B, 230},
-{0x45DFC40C368C1FA6, 473},
-{0x45E9397F4BC8CE08, 223},
-{0x45F1EC4B23EAD109, 233},
-{0x45F9DBF5DBFB335D, 4569},
-{0x45FC6943280FD774, 252},
-{0x45FE24523D7CF759, 450},
-{0x4603C99443C3FB7D, 307},
-{0x46068715608B808E, 425},
-{0x4607B0CE32F4F59E, 306},
-{0x460B7CF6D17A45DB, 223},
-{0x460DC0C9ED5FBB77, 1543},
-{0x46199BD5A3B55ABB, 436},
-{0x461B2E43C0854CB8, 934},
-{0x461C5C3D51863BF8, 900},
-{0x4621935BCEDAB020, 645},
-{0x4625826F115163C3, 496},
-{0x46265DE7114FCB56, 1085},
-{0x46320645F9F21E63, 870},
-{0x4635BA6B3BF651D3, 231},
-{0x463E6A96E10FF713, 302},
-{0x4641D938D5A93454, 3320},
-{0x4655547E45C95BB0, 571},
-{0x46560FC09C59CE94, 962},
-{0x46670FB0F9250E4B, 852},
-{0x4667C325D48070B9, 203},
-{0x46760BCB3F157772, 250},
-{0x467B83A09E59713A, 256},
-{0x467D2B8FD41E5776, 2768},
-{0x4684B5E426EC4BD5, 457},
-{0x4691989B593CA18B, 411},
-{0x4694129338F45C88, 390},
-{0x4694624BD6534102, 625},
-{0x4697DFD60C35C9D7, 433},
-{0x469D856B94DDDE73, 310},
-{0x46A1A79EFF9DDA64, 242},
-{0x46AA8AE0CFAB3945, 275},
-{0x46B28EC00377B195, 426},
-{0x46B7256206685FBE, 282},
-{0x46BF90E40303F896, 5432},
-{0x46CCCA77024B1B6D, 159748},
-{0x46D11E063B9FF983, 1824},
-{0x46D296017D14EF2B, 1752},
-{0x46DE10D2191D657D, 8731},
-{0x46E3E66287329FFF, 1350},
-{0x46E4A01658164B2B, 75066},
-{0x46E62F7D9D549BE2, 315},
-{0x46EAE96933AE24EB, 463},
-{0x46F095F80FABF6F2, 480},
-{0x46FF5E4C5C2442E5, 543},
-{0x470297237EE576C6, 242},
-{0x470509287B2A3499, 1258},
-{0x471026E40C66A628, 974},
-{0x4718E0AE0B707351, 219},
-{0x471AE4E8C3EF7395, 243},
-{0x471C26A0D20F130B, 575},
-{0x47222C91F02AE6F3, 543},
-{0x472C03E5D22F62D8, 1877},
-{0x472DACD2D10A3A8F, 242324},
-{0x4731EC8E2CABB994, 465},
-{0x4732F8B27B3ECBF9, 303},
-{0x47336CAB401C0025, 225},
-{0x4734DB533121D97A, 507},
-{0x4738F6D533F4FF7C, 362},
-{0x4740F985F2181D12, 311},
-{0x474A078338F50540, 3341},
-{0x474E941024396941, 567},
-{0x475307096CF51CD7, 69858},
-{0x47559B3989D293EE, 4396},
-{0x4757130C76C60016, 582},
-{0x47588BF21539332B, 1755},
-{0x475BA761BDDB1B86, 250},
-{0x475FAC4C8B14409F, 317},
-{0x4762F6ECE90582D6, 308},
-{0x476B2FF0FF3EEF2C, 233},
-{0x476F501E3BBCCB63, 1025},
-{0x476F7B6948201A87, 225},
-{0x4774623727784651, 257},
-{0x477BB188F72EE52E, 313},
-{0x477C56C46366F531, 601},
-{0x477DD5810BC63503, 1825},
-{0x478E4C7D41688BD8, 362},
-{0x47925E76CD24C0F6, 462},
-{0x47A800271D532BE3, 219},
-{0x47ABD9F71D3BBF52, 246},
-{0x47ACC320F063D973, 738},
-{0x47AD7C720D06DC7F, 1478},
-{0x47B78354C5DC5E3B, 1647},
-{0x47BEC34128087044, 680},
-{0x47C5BEB1116354F4, 396},
-{0x47CB6DC560B57194, 601},
-{0x47D0C0F01D488D75, 459},
-{0x47D941D468607FDF, 309},
-{0x47E04F73D53D6C01, 214},
-{0x47E5AAA89E879804, 1019},
-{0x47ECB15DB80F4351, 233},
-{0x47F06896B53F9A96, 200},
-{0x47F146607CEF3376, 449},
-{0x47F30EFD139F88B8, 331},
-{0x48039F74B1C25821, 2185},
-{0x4809B471E21865A4, 224},
-{0x48142632CA88E831, 372},
-{0x48211400EBB01F23, 679},
-{0x48221CD86BABD4EA, 403},
-{0x48265CA79EF7053D, 366},
-{0x4830F5FCB65469AC, 682},
-{0x4831F7EE3C861E8C, 208},
-{0x483F66779CAA9D50, 328},
-{0x485D9D244F246BED, 434},
-{0x4866232BD1737B22, 823},
-{0x4869CB8B028D9E41, 615},
-{0x487AFCEABE7E2ABD, 510},
-{0x48811D175ECDC203, 480},
-{0x488C7B7DA5DED5CF, 319},
-{0x488CDB5DAB860183, 296},
-{0x4891F80A87609E76, 19001},
-{0x4894F958AB2ABBCC, 241},
-{0x4897F04082D37E0C, 211},
-{0x48AED5FA5455D7CA, 205},
-{0x48B0A4B8E332F64D, 381},
-{0x48B15B209AF86D5E, 373},
-{0x48B8BFA57C2439BF, 236},
-{0x48BCB058E2C5A970, 200},
-{0x48C5265CDC361A54, 531},
-{0x48D904D51966FE29, 1073},
-{0x48DB1DE1FAC01949, 569},
-{0x48DBEA4E8B6F21F5, 260},
-{0x48ECE6E12B66F386, 219},
-{0x48EDB93912F8BDC8, 581},
-{0x48EEFFC2AAC4F8EA, 435},
-{0x48FA3049519D0F38, 361},
-{0x490654D90E809CA5, 2075},
-{0x4908768F7544F76C, 247},
-{0x490D444BBE44EC12, 408},
-{0x49120AEA84DA3D46, 870},
-{0x49162931C3670E24, 655},
-{0x491A21D29625D2F2, 213},
-{0x49227EC669371A4A, 712},
-{0x49299219AFCBAF58, 1116},
-{0x49320066A814B955, 475},
-{0x49361F86488B501C, 1491},
-{0x493853E51C08F304, 281},
-{0x493F70F3E8D3E693, 1056},
-{0x493F82CA893350B7, 344},
-{0x494A55381300880E, 224},
-{0x494D0CA3CFBF5F3B, 908},
-{0x4953B2A2CA0E3A77, 410},
-{0x49601402AA60DBA1, 344},
-{0x496055D718E837E1, 3550},
-{0x49679F8B7A7B8AB1, 346},
-{0x49713311E7538407, 227},
-{0x497C772B002CBE4B, 3543},
-{0x498678486CCBE044, 316},
-{0x4987C31F8B87D0AA, 430},
-{0x49948E7272CEE70C, 317},
-{0x4995C03A82C100F6, 233},
-{0x49A0A36FA7C229CD, 561},
-{0x49B555CEF9AF7AFF, 1256},
-{0x49B9CB81CB0A40E9, 394},
-{0x49C382393BB88514, 644},
-{0x49CA69C1EBB90477, 203},
-{0x49CB7F9DDAFD7EB5, 371},
-{0x49CE47F595963090, 273},
-{0x49F2F961CA9DE0EB, 217},
-{0x4A008FC8177C1C87, 631},
-{0x4A109AE9567AA7CD, 21993},
-{0x4A12D66D6150EF53, 420},
-{0x4A1A3794EF903116, 1757},
-{0x4A21307D9FBC5EBD, 216},
-{0x4A258164D85D4AC6, 498},
-{0x4A2736537F3F77AF, 229},
-{0x4A36B7CEE8D7C8F1, 216},
-{0x4A441F3E25540B7B, 816},
-{0x4A48FCC366861706, 289},
-{0x4A59518175D02DD4, 263},
-{0x4A6195B2CFE0F5FA, 17907},
-{0x4A62EEFFC0006CB7, 1051},
-{0x4A642CAA53F763BC, 257},
-{0x4A648402B3F9F37C, 265},
-{0x4A6ACB95F70D40BC, 605},
-{0x4A6CCCF1EEDF6CC2, 667},
-{0x4A70C808BE731809, 483},
-{0x4A73DFF547045350, 337},
-{0x4A74402BB61823E4, 578},
-{0x4A80FDC60DFEFCC4, 250},
-{0x4A93F7504D6929EE, 213},
-{0x4AAE4A01F8AA8960, 308},
-{0x4AC7CD1566BBA518, 332},
-{0x4AD765964074BF33, 342},
-{0x4ADE3347CD22C92D, 273},
-{0x4AE02A1D522E2670, 469},
-{0x4AE07BFE4F92154A, 674},
-{0x4AE8B1B73CAB50D5, 1577},
-{0x4AE922831BA16B08, 905},
-{0x4AEA48C5A815710C, 478},
-{0x4AF28C9A07600C15, 202},
-{0x4AFC608142F126C5, 592},
-{0x4B054A4E00201D1A, 718},
-{0x4B068E8075CEE7CD, 210},
-{0x4B0F423C3CFA0088, 1044},
-{0x4B127CDCEEB434A7, 311},
-{0x4B12A5F95B0AE56B, 256},
-{0x4B1573152200E4FB, 281},
-{0x4B160A4402257927, 490},
-{0x4B1702C65416CC2F, 270},
-{0x4B20C4F1CAED87EB, 1113},
-{0x4B20C97D084CC825, 385},
-{0x4B27FCCF46CFFBDE, 445},
-{0x4B30D2FD8E3D7252, 601},
-{0x4B3228547AF5CCDF, 219},
-{0x4B3EF6E304D46F09, 207},
-{0x4B41837E05100415, 313},
-{0x4B4B6A00645888CB, 259},
-{0x4B4F3592C8E91DB0, 352},
-{0x4B516CC79FCFA07D, 204},
-{0x4B64FDAE21190242, 585},
-{0x4B671E7371B2610C, 422},
-{0x4B68359493007F05, 2534},
-{0x4B7703E257133F6B, 277},
-{0x4B7A48043A08CB13, 773},
-{0x4B8F4052AFE7716C, 235},
-{0x4B9052FC8F474AE4, 837},
-{0x4B9FED1119C6EFEA, 234},
-{0x4BA120C98316B3D0, 635},
-{0x4BA22D4D0BF1EA4A, 200},
-{0x4BA32C36FF190DE8, 1156},
-{0x4BB019BCADC680E3, 468},
-{0x4BC73D215FF44F0F, 313},
-{0x4BCC4264DE715B98, 212},
-{0x4BD7F82B9AEB13C0, 206},
-{0x4BDD7CCB1D807EA3, 363},
-{0x4BEAE211A545150B, 2741},
-{0x4BF7AA7E23E03DEB, 775},
-{0x4C035B7D965CA4DD, 225},
-{0x4C09D604BE1DA123, 1227},
-{0x4C1205B4404E2FD3, 1993},
-{0x4C1B6A522B3955AF, 825},
-{0x4C2ACF0843357287, 863},
-{0x4C381F3E1542ADAC, 260},
-{0x4C3EA20DEA2A13F1, 322},
-{0x4C44121E25A33A1F, 255},
-{0x4C47518F56F5D891, 1189},
-{0x4C4F24DFDF80D152, 430},
-{0x4C52715CE6B0C946, 231},
-{0x4C5323BAE1118E8F, 1071},
-{0x4C5DCAA02BF7CBB8, 396},
-{0x4C5E123C9D0F001C, 228},
-{0x4C6426006F32D448, 341},
-{0x4C6B49B4CCA3E1C7, 1061},
-{0x4C6FD3F720BDB4BE, 368},
-{0x4C8C327E2A60EEEC, 1675},
-{0x4C983D3CC0DB8779, 1130},
-{0x4C9AB4F2380E8725, 722},
-{0x4C9C234541B84634, 204},
-{0x4C9F919D240A50BA, 518},
-{0x4CBA00125A356946, 699},
-{0x4CC0BD4D70D91253, 932},
-{0x4CC4EB7CC7C34D5C, 1813},
-{0x4CE2CF54BB0D40D8, 319},
-{0x4D16957D0AD3E935, 425},
-{0x4D186B899862EEA7, 233},
-{0x4D2184B766AFCA2C, 211},
-{0x4D2C7B068AEAE071, 210},
-{0x4D34114D4279A4D1, 566},
-{0x4D4312556D43ADEB, 1215},
-{0x4D45813B0D7330BF, 610},
-{0x4D5D14AB19889C7D, 813},
-{0x4D5E8827AEEB16CC, 375},
-{0x4D5FB3BCAD451FB3, 259},
-{0x4D6C03651E5320F6, 228},
-{0x4D6C68E188D49FBD, 3034},
-{0x4D7798371DBDF1ED, 474},
-{0x4D8BFE94C65D594F, 278},
-{0x4D94D3E20626853B, 284},
-{0x4DAD1BE6C5E618DB, 1759},
-{0x4DC1182610CB17D7, 576},
-{0x4DD147FCEF5F4819, 515},
-{0x4DF423B84825887E, 409},
-{0x4DF8236552D52FB6, 201},
-{0x4E0443FE4C1D066D, 727},
-{0x4E0EF81C6B1F5FDD, 208},
-{0x4E1527D255310831, 270},
-{0x4E34BF3C9776C1EB, 294},
-{0x4E3C2C14BA6D3530, 333},
-{0x4E4350AD2BCA84A1, 2933},
-{0x4E496C501135D09E, 629},
-{0x4E4D6022CCD6ACD4, 292},
-{0x4E4EFC93561A0401, 695},
-{0x4E501984147B8A94, 777},
-{0x4E58DFA3E24E2C0A, 4303},
-{0x4E77A00A915E787D, 271},
-{0x4E8650024F481D92, 618},
-{0x4E8C3073F9789E94, 667},
-{0x4E973CD47D173A9C, 242},
-{0x4EA13B0E4117B6B2, 818},
-{0x4EA58FE97485BE62, 416},
-{0x4EAFB1E7689D050D, 261},
-{0x4EB322D8854BAC7D, 483},
-{0x4EB5ED6BD2EF3EC5, 640},
-{0x4EBA48BEEFA04C62, 244},
-{0x4EBD954B0E8E5D7C, 248},
-{0x4ECE2726A9FDEF2B, 443},
-{0x4ED3FF31B9AECDBB, 610},
-{0x4ED5CBE3FB5711A8, 390},
-{0x4EE0737516CBE036, 423},
-{0x4EE80BAC4F09ED59, 207},
-{0x4EF285D29173432C, 404},
-{0x4EFC9FDDB6F80822, 453},
-{0x4F03688ACBBEB9E6, 570},
-{0x4F087843EFBF3E66, 370},
-{0x4F08D96B7AB23067, 217},
-{0x4F0FF733FCCB5D0B, 564},
-{0x4F12FE1F50148A49, 956},
-{0x4F13AE0A50FB7094, 218},
-{0x4F17E5F52E65AD0E, 771},
-{0x4F1ED6FB1AC10A40, 303},
-{0x4F3C24626642BD50, 413},
-{0x4F53E05F3EB93DD6, 263},
-{0x4F54B62E086EF0D7, 329},
-{0x4F7133DF7C29AD82, 523},
-{0x4F81C2F61012FF30, 204},
-{0x4F88661F492288AF, 222},
-{0x4F8AC43F0AF52B11, 373},
-{0x4F98237AF17F11ED, 1318},
-{0x4F9EA19203A01053, 353},
-{0x4FA0172C3B042B59, 485},
-{0x4FAB1A2814BFFB8D, 330},
-{0x4FB5962A6E89ABFD, 218},
-{0x4FBD3CB31AC67573, 1681},
-{0x4FBFB9BD5DDE2D95, 449},
-{0x4FC2D1738C7D60FF, 346},
-{0x4FC3B3BA33AE0767, 465},
-{0x4FC87DCF635AEBD1, 268},
-{0x4FCA2A253A67C5B5, 393},
-{0x4FD06AD4473150E4, 374},
-{0x4FD26D1A92A092FD, 328},
-{0x4FD4762811421377, 591},
-{0x4FD618D251EB0C6A, 279},
-{0x4FDC2B51E80EC45F, 276},
-{0x4FEE0A654EC15BC1, 208},
-{0x4FF1E6C5B7656475, 373},
-{0x5002A2DA945B1AC2, 207},
-{0x50176F8729E70B65, 895},
-{0x501D3970997A2A3D, 368},
-{0x5039794471DEBC36, 2355},
-{0x503C1ED5C5303A1F, 382},
-{0x503FC50982884AC1, 991},
-{0x50401EC7A176018B, 1035},
-{0x504B01FD8FB4D54D, 5734},
-{0x504C4A7516AECE8A, 284},
-{0x506D457C407CF31D, 666},
-{0x50761CDE9DDDDB8E, 2804},
-{0x50792ECC260A5B27, 414},
-{0x509AABB5C95D9F1E, 443},
-{0x50A87AD3BCC402B2, 420},
-{0x50AE70BBCB1EEDAA, 295},
-{0x50BC0D1644EB31FD, 453},
-{0x50C2218AA738EF55, 406},
-{0x50C64F4D8E77B082, 201},
-{0x50D90D58EA5701E0, 541},
-{0x50DA354F96607D74, 1689},
-{0x50E2F8E7B4F3BA7B, 369},
-{0x50E481E741299853, 753},
-{0x50EB5CB6E9C26F70, 237},
-{0x50F9AC8BB97BAA69, 211},
-{0x5106D76E18F47BF9, 464},
-{0x510C859C1EE5C910, 228},
-{0x510E1D3A7CD6D395, 266},
-{0x51375A11071E1FA1, 782},
-{0x51395D739895315A, 492},
-{0x513D6C142C9A09B8, 224},
-{0x514D5484A9894CBB, 934},
-{0x5151698FD8D5176E, 308},
-{0x5154DA15F984309B, 1033},
-{0x51558558582A9B34, 1285},
-{0x5167902C6113E166, 2581},
-{0x5168F1CB03232968, 748},
-{0x517A33E6B87C3F28, 247},
-{0x517A9E4E4F591913, 15945},
-{0x51842E21310821A4, 261},
-{0x518DEEE3148E9148, 221},
-{0x51902FEFDE77D0BD, 559},
-{0x51A19C2CC6D61BAF, 1620},
-{0x51A5C6456D2A7E9C, 253},
-{0x51AAECE2938827C0, 227},
-{0x51AFE443A26E0BEB, 533},
-{0x51C9A006F975925E, 699},
-{0x51D58452B6BD8C65, 1082},
-{0x51DC9484DEE219C0, 200},
-{0x51E51D004FAFABCB, 278},
-{0x51F7CF439E1538AE, 200},
-{0x51FD92D8643180B9, 308},
-{0x520581A301C319E4, 330},
-{0x521ACCE75F7BB00D, 839},
-{0x521BE80DD71201F5, 610},
-{0x521EF881B1E35AD3, 2425},
-{0x5225FE617A6742A7, 279},
-{0x522BFD8E45744D0C, 262},
-{0x52385F5D36EA0A01, 447},
-{0x523BE939A84A4CE4, 276},
-{0x526442CF59100854, 359},
-{0x528EED855F48F178, 2348},
-{0x5299ADA43D397A40, 340},
-{0x529D27453F2F9770, 247},
-{0x52ABA8469C45F379, 221},
-{0x52C60F7903E6E62D, 227},
-{0x52D24B384067D8E7, 271},
-{0x52E8FA51DE3A664A, 372},
-{0x52FED97ABEF32E8A, 944},
-{0x530A607FE3DC4B96, 1146},
-{0x531A536D86A2029D, 439},
-{0x531F3239CBB21433, 1660},
-{0x531F664752530927, 455},
-{0x532432504A4BBBF8, 208},
-{0x532BF529D33FC33A, 3605},
-{0x533303E3E18392AC, 1337},
-{0x5338CF4A97733E17, 355},
-{0x5343397912EED61A, 464},
-{0x53435CE817FCF162, 231},
-{0x5347B6C4E20C61CD, 448},
-{0x535062445111E144, 212},
-{0x5350CB8AC3F85E8E, 393},
-{0x5352FD89F0BA8272, 16045},
-{0x535B1049E6954EFB, 228},
-{0x535C17A5141CE978, 340},
-{0x535C7F8489D4C524, 1716},
-{0x53740FDA79403022, 635},
-{0x538C3D360FDDDB1A, 250},
-{0x538F634BBB0A5DD4, 290},
-{0x53AA49D64C8D97F4, 244},
-{0x53B8A9874D3A1B33, 542},
-{0x53D1FD5161BEC23B, 648},
-{0x53DE4C4CBA5DBD6F, 765},
-{0x53E66614B58C917C, 6787},
-{0x53F01A00B2F700CA, 1264},
-{0x53F4A2E5B390D575, 226},
-{0x540004F5E9C949B2, 1737},
-{0x54079141E8751BF4, 280},
-{0x542879E20E1CD40E, 213},
-{0x542F785B042E390A, 839},
-{0x544B023411E6BD5F, 484},
-{0x544FB8416C75C2FA, 25659},
-{0x545BCC5E76DF2F1C, 1576},
-{0x5462A7A821B6CC31, 395},
-{0x5474F64B03A02096, 283},
-{0x547BD9B14776F61E, 390},
-{0x548B7A8549786659, 277},
-{0x5499216610C426C5, 411},
-{0x5499B6395BD2EE04, 256},
-{0x549D6E6804CC56CE, 432},
-{0x549E9965EEEE1920, 262},
-{0x549ECAE253DF0117, 286},
-{0x54A422EBB30F97DC, 16795},
-{0x54E075ACA2A48126, 225},
-{0x54F08755B7BB5B67, 209},
-{0x54F3D273DEF7C92E, 305},
-{0x5514080EADCC7216, 1509},
-{0x552C40DA31A83476, 19521},
-{0x552C9559EFB1C413, 1077},
-{0x553A1EC16C0C6F0C, 1922},
-{0x553AC892B838927C, 879},
-{0x553C32908F6A080E, 567},
-{0x5545614BFDD27664, 242},
-{0x554EEA232CBC3836, 392},
-{0x5551646D4F87C0B4, 553},
-{0x5560AA3CB0F2FC73, 349},
-{0x556EF54A57455CFE, 333},
-{0x55C24D5F1D26D699, 878},
-{0x55D4078366CCE784, 341},
-{0x55D892B59023A7C5, 225},
-{0x55E14684E441DE16, 20994},
-{0x560887C562E14615, 1276},
-{0x56154E545F8DAACD, 249},
-{0x561601BA54059449, 301},
-{0x561FD8C5D657FC00, 436},
-{0x56246446AA01B772, 5086},
-{0x563D20D00A2292ED, 296},
-{0x564BB6CCF956C4E6, 1287},
-{0x568249E3D077CA48, 497},
-{0x56986E57D31AC37B, 226},
-{0x5698FCE72BBB6759, 780},
-{0x56999174D9089266, 830},
-{0x56A6EB6B7811CF7C, 216},
-{0x56B8FDDDB6B26290, 853},
-{0x56BCFC33388670FB, 1986},
-{0x56C85EF395234E7D, 631},
-{0x56FA5E3A8EC12EC8, 1813},
-{0x5705C971F3078019, 228},
-{0x5707373ED952362F, 453},
-{0x571363AEC49AFBDC, 1225},
-{0x57152E5CAA552720, 1334},
-{0x57188E262632380F, 209},
-{0x57296A6E29BCEAD8, 421},
-{0x5735E283CFFB4260, 1091},
-{0x5739B79091884265, 244},
-{0x5739E18C3E1D0666, 2544},
-{0x5757E130139485D4, 468},
-{0x57669086EB224E48, 218},
-{0x576BAF622A5D6160, 487},
-{0x5776E1C6DFB92808, 542},
-{0x578E72D614FE2381, 320},
-{0x5795AE3C73EC2737, 1227},
-{0x5799732A35167CEA, 1781},
-{0x57A355AEA74B450A, 368},
-{0x57A83B3D350CC9BC, 283},
-{0x57A989FF901A87B3, 985},
-{0x57ACC5E30AF9C2FB, 246},
-{0x57C107894F444ED8, 673},
-{0x57C2806DC265CC65, 210},
-{0x57C569DE22A339EA, 4766},
-{0x57CDCF0B841AE395, 101453},
-{0x57D2FDCF5B503C0B, 1070},
-{0x57E1FAA9B1AA085D, 238},
-{0x57E6CCBA8A991A22, 261},
-{0x57F7F7F63861A09A, 231},
-{0x583A7BC19E13E07A, 250},
-{0x5849264F2E64AB41, 242},
-{0x584C2D40406E6D7D, 502},
-{0x58618915264F6952, 318},
-{0x5867A01FE80E6F4F, 302},
-{0x58752CAC27ED40B8, 608},
-{0x58873E40563E7AEF, 212},
-{0x5887D7BA7A20E4C9, 244},
-{0x588D326851F46781, 1547},
-{0x589CA8371F3F876F, 215},
-{0x58A19369BB11D321, 227},
-{0x58AA7ED26BBE2C8E, 288},
-{0x58B689FF1DEACAC5, 783},
-{0x58C0EEE6860CB353, 521},
-{0x58C3AD1E579EA3CB, 764},
-{0x58EB0C7F985740DC, 247},
-{0x590234AC778DF5D9, 395},
-{0x5903F55BC1413B5A, 218},
-{0x5918E408CB04F629, 1429},
-{0x5928769F2479013F, 251},
-{0x592EF8C41E72B07F, 360},
-{0x59468B8342502CE3, 468},
-{0x594D42D5E9DDB794, 520},
-{0x5957F990BA34A4EC, 1290},
-{0x59731327596448AB, 274},
-{0x5989B6EC9DED90AC, 249},
-{0x599DDDBE9BBC34B4, 282},
-{0x599F022881EDF252, 579},
-{0x59A13E3BFF2C9A3F, 531},
-{0x59BFB95FC43013F7, 252},
-{0x59CF143DB829271A, 437},
-{0x59D13DF276A85548, 259},
-{0x59D4C029A5B42512, 705},
-{0x59D8120E2DCF2C38, 1172},
-{0x59DBD1B8978D659A, 537},
-{0x59E18427CC7E1718, 237},
-{0x59E3254CD6A08BAD, 297},
-{0x59FB5A7162277969, 427},
-{0x5A199476E448F40F, 244},
-{0x5A20F0582BB47D3C, 816},
-{0x5A4CB5EEE0834AA9, 3295},
-{0x5A4DA494C54DD79F, 2034},
-{0x5A4DF433D1774DFE, 236},
-{0x5A53044C7EEFE2CF, 402},
-{0x5A56B8D4D4C73793, 211},
-{0x5A56D898413644F4, 2320},
-{0x5A634646203D3622, 1278},
-{0x5A6E2602353CC3F0, 307},
-{0x5A7599DC0C80495A, 271},
-{0x5A79AF528B06E02B, 265},
-{0x5A7B275DBDA4979B, 438},
-{0x5A95B82F2A75E0A2, 417},
-{0x5A9B934DB58C6CE8, 573},
-{0x5AAE95DF1444D62D, 6538},
-{0x5AB554CDA4761ED0, 3550},
-{0x5AB7403A4E79AA44, 898},
-{0x5ACC329DDAC9FA22, 451},
-{0x5ACF87E84BE5F3EE, 5175},
-{0x5AFA92C9542A4150, 209},
-{0x5B0DD929BECC3E93, 3978},
-{0x5B1BA2D87371FF73, 348},
-{0x5B20EEB1D4C11912, 327},
-{0x5B3854E376430216, 344},
-{0x5B3DA92A53FFECD2, 736},
-{0x5B435E21BCA2C3AE, 552},
-{0x5B467209A11810FB, 696},
-{0x5B6D60433E89E9EE, 704},
-{0x5B6F854EE4A9C7C3, 3337},
-{0x5B9FF44A3894DDBF, 263},
-{0x5BCC162692A4059D, 249},
-{0x5C1993D1A8D9E2C5, 485},
-{0x5C237CA3CB02AF4C, 244},
-{0x5C3F452A1071539C, 2340},
-{0x5C4AB5FB9C6A51BB, 1023},
-{0x5C4FD5D478CD6CA8, 803},
-{0x5C4FD7167789706D, 841},
-{0x5C66B8FE5F40F07B, 549},
-{0x5C68B62BC2E918D5, 209},
-{0x5C783B564554B9F4, 245},
-{0x5C87FF067194C3C8, 536},
-{0x5C91F89ACAD1CDBF, 355},
-{0x5C9F560468B16C26, 350},
-{0x5CA380101AAAF77F, 236},
-{0x5CB337E6DBBA664D, 1326},
-{0x5CF83F01E5DF941E, 4117},
-{0x5CFD2E9190AEE88B, 242},
-{0x5D062CEB2A476B7E, 16617},
-{0x5D0C418BFB0F8C2C, 212},
-{0x5D17128971C9E4B6, 606},
-{0x5D1AA18EB2C44327, 221},
-{0x5D1AB6B323F21FE8, 285},
-{0x5D29162C46F33697, 308},
-{0x5D40B3D83189049A, 541},
-{0x5D5681F8ACCCFD63, 253},
-{0x5D5CCE0B1F078557, 318},
-{0x5D665795AF9F72C0, 567},
-{0x5D77E1803489490C, 264},
-{0x5D7DC016C40D56CC, 411},
-{0x5D9239A4B975018B, 724},
-{0x5DAFEDF088F725AD, 254},
-{0x5DC0C560484A0C5C, 446},
-{0x5DCD3E2E24E19CA5, 239},
-{0x5DF96D521A022FF1, 1330},
-{0x5DFB7129461C671B, 422},
-{0x5E0034C575C37CF9, 225},
-{0x5E04EF9015234FF4, 212},
-{0x5E06186322D16AA5, 2650},
-{0x5E072E511744D40B, 704},
-{0x5E0F6EAD362D22DC, 224},
-{0x5E16ED696E90A671, 211},
-{0x5E62604AC881AE65, 223},
-{0x5E69F0FEC7C9009E, 1484},
-{0x5E882225BF61B429, 317},
-{0x5E9C138C4DAE993D, 731},
-{0x5EB910F3B4D2A533, 295},
-{0x5EC5CCD83307C911, 309},
-{0x5ED617C58B2C6694, 631},
-{0x5EE064205E7EBD55, 417},
-{0x5EF4DEDCFBBF110D, 209},
-{0x5EFAACD48B0B5BA9, 1135},
-{0x5F01FD3933313309, 453},
-{0x5F1CC301C7A58238, 589},
-{0x5F1F013099A79CA4, 469},
-{0x5F25EA11813932DE, 269},
-{0x5F275A0BC7574C94, 107507},
-{0x5F48E9B2E249D829, 297},
-{0x5F774D32FA91E5BA, 322},
-{0x5F78A943ED3329EE, 300},
-{0x5F875CB31CDC1A1A, 328},
-{0x5F9B508D4230AD95, 329},
-{0x5FA58D3218F96C7E, 471},
-{0x5FAD76C1344B912E, 409},
-{0x5FAF32225C79C982, 633},
-{0x5FB601798C18D11A, 255},
-{0x5FC2B24C52D9BF2B, 248},
-{0x5FD07C5A40875FAF, 3402},
-{0x5FD626F5CC6A4619, 200},
-{0x5FE37E842C499739, 278},
-{0x5FFD15D5F5BEF86F, 217},
-{0x602A2078FBA0BAE8, 255},
-{0x6044309D2CFF69C2, 250},
-{0x6046CE7D40016CFC, 414},
-{0x6075DF94FD22CFA0, 491},
-{0x60A61BF9F3CC2AAB, 294},
-{0x60BA3BA3570EF7D6, 268},
-{0x611155F3648E6D2D, 368},
-{0x6112A699D677D07D, 15537},
-{0x613044D6C8986FB1, 234},
-{0x6140A1410B1095CF, 359},
-{0x6170F548CFE07741, 201},
-{0x618A6186AA82D7A1, 298},
-{0x618A646E704590DA, 305},
-{0x618E229833426CA7, 444},
-{0x61924F74B4A79E47, 214},
-{0x619CDD997725E140, 2880},
-{0x61B0E496743E9E15, 330},
-{0x61BD464126C98655, 1772},
-{0x61D5D716218B5228, 430},
-{0x61D831F3ABCDEDC3, 823},
-{0x61F510B4FE38C10B, 244},
-{0x61FB2724B89EEF6B, 412},
-{0x6200E357F34C147E, 395},
-{0x62014D36676C0BD1, 562},
-{0x6225FEA226BB6277, 888},
-{0x62571DB4705B2725, 275},
-{0x6277313BEB78E4BC, 1220},
-{0x629130788173570F, 218},
-{0x629E638F4F2ECF75, 434},
-{0x62AE98993C1BB462, 235},
-{0x62B9CBE91187517A, 211},
-{0x630E6E17F4DE47CE, 325},
-{0x6310CD49FF41198C, 550},
-{0x6312AD012253E17E, 1015},
-{0x631C5114065A256C, 1294},
-{0x6340DFCEB88B77CB, 358},
-{0x635EDA7361FE361F, 221},
-{0x63AAF1C594DEBDB0, 654},
-{0x63C0964010C2B58A, 443},
-{0x63C2FCD04BAD256E, 863},
-{0x63CD9452CB2E15D5, 908},
-{0x63D2C7E268CF4DF8, 247},
-{0x63EEF0701CFF723E, 345},
-{0x63FA5AE16D8EC8BF, 962},
-{0x6403681DECA71935, 269},
-{0x64119B20BA9DAA47, 207},
-{0x641C77D2F01116B5, 224},
-{0x641F3ADCE074D965, 268},
-{0x643D86B2A666015C, 493},
-{0x644237E722645975, 238},
-{0x64534C0F94BE4AB4, 303},
-{0x647E984AB03BBC45, 254},
-{0x64D0124DDAD2A99A, 327},
-{0x64D5E91D24C2FEEA, 349},
-{0x64DCA393304153FD, 227},
-{0x64DDFF9A6415D837, 210},
-{0x64E2B9647A1D14BC, 206},
-{0x64E49E0E6A79830F, 1129},
-{0x64E797330673F734, 1472},
-{0x652F03B78B65A852, 354},
-{0x6537EB0867F1D55A, 1380},
-{0x656A17FE51C2B9A6, 660},
-{0x6573EC06043CE279, 528},
-{0x657647401BD40B4E, 329},
-{0x659635A4E1EE6769, 754},
-{0x65A12992A9079F13, 244},
-{0x65AEC107F5E96DF3, 343},
-{0x65D93EEC94E24CBE, 313},
-{0x65EB6C7C95F41072, 4634},
-{0x664267E56D518EC8, 1104},
-{0x6660F3E955745772, 269},
-{0x66872C842589ECFA, 286},
-{0x668ADB38DA99FE46, 245},
-{0x66B9358DA1C2A5CD, 435},
-{0x66BF609AED9F273C, 501},
-{0x66D675F9B6A359E4, 424},
-{0x66D7B8F363696AC1, 328},
-{0x66DEC247D1B9252F, 4878},
-{0x66E6F32CDC9E50A3, 1052},
-{0x66F0AB8F2E55969C, 3258},
-{0x66F563E0A55E316B, 299},
-{0x66FCFFBDD88D455E, 1836},
-{0x670DB931ECC51626, 242},
-{0x671E97C9D9F1451F, 348},
-{0x673056D734187503, 341},
-{0x6732C0E6FEEA4C49, 4672},
-{0x674A35EBE8511BE1, 2100},
-{0x6751D96EC280E150, 713},
-{0x67649C835C04195D, 236},
-{0x67965A2650DD5F38, 210},
-{0x67B8AFD94401C529, 271},
-{0x67BB050C8132384C, 229},
-{0x67C747A7D4C6D298, 217},
-{0x67D14F2CE3C37D08, 300},
-{0x67F7DA638F6C2949, 226},
-{0x6815D5DD9C4B0871, 680},
-{0x681FC16908530B75, 224},
-{0x6825C78A0F9D9466, 1327},
-{0x685BDA41A07187E1, 750},
-{0x68949FAB5A82115F, 201},
-{0x68ACA16D33042EA5, 819},
-{0x68B22CBEF3DF6F84, 289},
-{0x68E2208AA50FDD1D, 1449},
-{0x691BD4A829A4A514, 527},
-{0x6922754D175B2F4B, 306},
-{0x693714EBF9929F0F, 806},
-{0x6942CB685BBD8F82, 1422},
-{0x6953197CA3466220, 326},
-{0x69625F0D488C34BC, 1734},
-{0x698A7A5E334ABB07, 1039},
-{0x699B164501C51CBF, 256},
-{0x69AF3F894EEC6681, 280},
-{0x69EDE77D45B4CCE5, 381},
-{0x69F46E66320BC4D0, 228},
-{0x69F56C036611F6F1, 684},
-{0x6A20C9E86EB2180D, 823},
-{0x6A3815B05E9C875A, 989},
-{0x6A55285DFD960FCC, 367},
-{0x6A664ECA176A89FD, 2553},
-{0x6A9798C780EA609F, 318},
-{0x6B14066ADE0F57C6, 515},
-{0x6B1E3F92F4401675, 5987},
-{0x6B3B5E3A677D83CC, 451},
-{0x6B55D9E451A8D2AF, 278},
-{0x6B5C29167E5A219F, 262},
-{0x6B67BF7852CC5334, 497},
-{0x6B842E2DD32A841D, 259},
-{0x6B92C1F1F53C98C9, 316},
-{0x6BA4C40A16C4610A, 203},
-{0x6BCC0904562EDE36, 302},
-{0x6BEDF64BFEEB8BD5, 372},
-{0x6C038ACB6F32F0D9, 341},
-{0x6C0BCEEDBBEB90BF, 2388},
-{0x6C3E453DECCEE8CE, 403},
-{0x6C48320E3B86BEA3, 328},
-{0x6C5E65FBDC56A242, 217},
-{0x6C5F6363E30FF82B, 633},
-{0x6C7BD90C4AC63846, 483},
-{0x6C7C46A0ECA9EEB0, 227},
-{0x6CC3AA4BEBB1489D, 202},
-{0x6CD57271909929F1, 387},
-{0x6CF6969BFCB44741, 435},
-{0x6CFCEF1E7A887F7C, 3230},
-{0x6D5D0D266E9BECFE, 1129958},
-{0x6D8A3CFB062C999C, 1619},
-{0x6DC55B67874CA0D0, 2062},
-{0x6DDE5A8861C012B6, 209},
-{0x6E0A0D5DE9D271D1, 234},
-{0x6E0AE873FFBFA947, 208},
-{0x6E1BDCEE6B577D0A, 216},
-{0x6E4C93DDC39D59F2, 753},
-{0x6E5AB60A7FEAE6A9, 245},
-{0x6E75643F6E8D72FE, 220},
-{0x6E9C3BC02ED54CF6, 286},
-{0x6EB310DF84567397, 1274},
-{0x6EB84F58C4FA5BD1, 1270},
-{0x6EC37E23A2D052BB, 333},
-{0x6ECCEDB63F3538EA, 259},
-{0x6F02A2118DE60268, 204},
-{0x6F0C6C9F133B3FD3, 244},
-{0x6F3C6D9ED43D5769, 408},
-{0x6F43BD41AC907026, 473},
-{0x6F4844B569759BD8, 759},
-{0x6F4FAC2AD4496004, 7740},
-{0x6F8FE3ECDD5A134C, 245},
-{0x6F91E9294DE986BF, 441},
-{0x6FA6DA0A318ED9CF, 270},
-{0x6FACD09011F3443C, 229},
-{0x700BAF154D0D2E1D, 627},
-{0x7014114EE1CD5C16, 719},
-{0x7016C92EE11213B7, 245},
-{0x705B3A118125CAE3, 201},
-{0x709C57735CC3E88E, 264},
-{0x70BAA2B9E783888F, 689},
-{0x70C4B82F5E8ED13E, 211},
-{0x70C5544EDCFCA93E, 2290},
-{0x70C81008F22715C1, 298},
-{0x70D27A29A1C60812, 348},
-{0x70DEDBF772E18EAE, 272},
-{0x70E035B99FD9A628, 493},
-{0x713618D850316CAB, 264},
-{0x7178978C615B75F1, 3892},
-{0x718DED12868C2179, 546},
-{0x71911EC9E3F8AFBF, 283},
-{0x719861B02394D293, 348},
-{0x71BAF5AAD0C9E9C9, 15168},
-{0x71BCF2567F1FBA71, 325},
-{0x721129CE55DCC74B, 1989},
-{0x7233E2C84339DFD9, 266},
-{0x72621F43AA278929, 231},
-{0x727BC219A7BDB728, 350},
-{0x72B96B5EBC561953, 566},
-{0x72C9E0773312BB06, 395},
-{0x731E16C40EF56291, 813},
-{0x73219AF3F7736CEC, 338},
-{0x73590C06EB182A44, 247},
-{0x73A15C62A6ADB398, 672},
-{0x73CC09F9B85193B0, 340},
-{0x73D1412DCFE1E395, 852},
-{0x747644C7212FC905, 20297},
-{0x7530453D72956538, 456},
-{0x759049708FDA6FBF, 659},
-{0x75AD1929B507D35D, 303},
-{0x75B9DC57D2C21B89, 361},
-{0x75C2CB701E2D06B6, 1474},
-{0x760ACFE1780334FD, 463},
-{0x761A46B455604ABD, 218},
-{0x76AECAFCC240EED8, 324},
-{0x76E6D85778154C60, 648},
-{0x76F05E1C52A7E302, 336},
-{0x7720A5DD2429A619, 220},
-{0x7766D5FB57E722EC, 805},
-{0x776A2101DEC6268F, 207},
-{0x78040EBB0A093181, 438},
-{0x7820C6577780107B, 799},
-{0x783B6CA381F76BB2, 600},
-{0x7865D399FD78990D, 672},
-{0x78C6E600F40E9D4B, 379},
-{0x78E65556CFDCC0F8, 1825},
-{0x78FF3C1CF3E3875C, 251},
-{0x7904950D7941003A, 204},
-{0x790680C90DFD3D05, 1021},
-{0x791A6C63602AA92D, 489},
-{0x79793335EBE0501F, 214},
-{0x79E67E03F12EEB4A, 227},
-{0x7B11809F4101C59B, 214},
-{0x7B1AE2B89F0564B1, 961},
-{0x7B1E908CD90B3908, 511},
-{0x7C26AD5BDC1E3E93, 248},
-{0x7C526086B21B344E, 1027},
-{0x7CBE13B094EE35F8, 329},
-{0x7CD40CBBFB6CCD36, 1135},
-{0x7D4EA3D03F386F2D, 616},
-{0x7E031D51B28FDB3C, 1082},
-{0x7E8204A3B2FED10E, 320},
-{0x7E84F878FD07BAD7, 246},
-{0x7F26F760ECADA10A, 203},
-{0x7F62A4819EBF5F45, 461},
-{0x7F86335FAF805A38, 1192},
-{0x7F9B8622A73CE738, 1078},
-{0x7FB00EAE171492F8, 319},
-{0x800A1DFFBF33C765, 1209},
-{0x80137D81670E0669, 355},
-{0x80468EA494FC64F9, 247},
-{0x8073BA4C8C76C23E, 746},
-{0x8145DEFA38FFB1DD, 837},
-{0x81687D2F1404A4FE, 419},
-{0x817409254896A996, 264},
-{0x81B6D00A6489FBE4, 200},
-{0x825A112CEF2B3C10, 298},
-{0x82899768DF76E827, 2601},
-{0x82AFFFFDB4312955, 487},
-{0x82CDE593AB44A9E1, 449},
-{0x82E5895BC4F68A87, 4237},
-{0x83DB1B2C6B54BAAD, 255},
-{0x8551C06493B1F2EC, 1001},
-{0x8561DCEEF972443D, 674},
-{0x856ACBF8F6C8F9D5, 226},
-{0x85B44CD3329F2069, 272},
-{0x85CA3CF3CB84ABD4, 254},
-{0x85DD833326589832, 1280},
-{0x85FAF95AC1AE226E, 525},
-{0x86936EC2BC1037A1, 5092},
-{0x8768525F24E8C4CF, 1952},
-{0x87778A29F5BC0BC9, 464},
-{0x87A9F8B9E840CD5A, 622},
-{0x87C74F0B8E1DA199, 217},
-{0x883A75CC0D9C1FCE, 351},
-{0x88E0879B78AE28C8, 5153},
-{0x894FF0224DC5248A, 250},
-{0x89E44A50CB30F1A5, 971},
-{0x8AA94AE3B897EFA8, 474},
-{0x8C2BE244E2191AD0, 201},
-{0x8D0878531353D86F, 4891},
-{0x8D913DE2D7C20628, 336},
-{0x8EED9FF8ACBA8E03, 362},
-{0x8F0AD66D57B659A8, 425},
-{0x8FED8955E0AFC482, 1084},
-{0x8FEE2519B5B18F52, 2403},
-{0x90BF6DE62B028D9B, 222},
-{0x90DE9A874E1DA590, 225},
-{0x9174ECE59857CF4D, 478},
-{0x918259223047F80D, 1988},
-{0x93028EA64E3B7790, 275},
-{0x945B3D2A3030B960, 291},
-{0x96926F12DB9CE6D9, 1059},
-{0x9703CF52404E7732, 430},
-{0x980CFD366A0459CA, 870},
-{0x9919CFB08C7C89C4, 742},
-{0x998D7350ACAFD74B, 268},
-{0x9A55B8224ECAAEBA, 262},
-{0x9BABC2D7BBFB22A7, 1880},
-{0x9DF0DF4F0FAA1B3C, 233},
-{0x9EBBDF067E0FEE48, 250},
-{0xA3BF52266BF196DF, 1319},
-{0xA3FFC6ED88A65B96, 349},
-{0xA4E9B81743B8D768, 1509},
-{0xA6DCA3062EA2C3CB, 653},
-{0xA9693D909404D242, 5141},
-{0xBA79AAB0B09DE0A0, 11830},
-{0xC202318288485CA8, 546},
-{0xD3D4AF73792A4C5C, 1862776},
-{0xD5197F8CB2B2BA02, 7690},
-{0xF09B1CA9407B94C0, 915}};
@@ -121,12 +121,37 @@ int FastState::walk_empty_list(int color) {
     return FastBoard::PASS;
 }
 
+void FastState::flag_moves(FastBoard::movelist_t::iterator first, int color,
+                           const Matcher * matcher, bool traced) {
+    auto last = moves.end();
+    // The pattern of the next move is hashed and its slot requested
+    // while we work on the current one
+    int next_pattern = 0;
+    if (first != last && first->get_sq() != FastBoard::PASS) {
+        next_pattern = board.get_pattern_fast_augment(first->get_sq());
+    }
+    for (auto mwf = first; mwf != last; ++mwf) {
+        int pattern = next_pattern;
+        auto ahead = mwf + 1;
+        if (ahead != last && ahead->get_sq() != FastBoard::PASS) {
+            next_pattern = board.get_pattern_fast_augment(ahead->get_sq());
+            matcher->prefetch(color, next_pattern);
+        }
+        int sq = mwf->get_sq();
+        if (sq != FastBoard::PASS) {
+            flag_move(*mwf, sq, color, matcher->gamma(color, pattern));
+            if (traced) {
+                mwf->set_pattern(matcher->matches(color, pattern));
+            }
+        }
+        mwf->update_score();
+    }
+}
+
 void FastState::flag_move(MovewFeatures & mwf, int sq, int color,
-                          const Matcher * matcher) {
+                          float gamma) {
     assert(sq > 0);
-    int full_pattern = board.get_pattern_fast_augment(sq);
-    auto pattern = matcher->matches(color, full_pattern);
-    mwf.set_pattern(pattern);
+    mwf.set_gamma(gamma);
 
     //bool invert_board = false;
     //if (color == FastBoard::WHITE) {
@@ -190,10 +215,10 @@ int FastState::play_random_move(int color, PolicyTrace * trace) {
 
     float cumul = 0.0f;
     scoredmoves.clear();
+    flag_moves(moves.begin(), color, matcher, trace != nullptr);
     for (auto & mwf : moves) {
         int sq = mwf.get_sq();
         assert(sq != FastBoard::PASS);
-        flag_move(mwf, sq, color, matcher);
         cumul += mwf.get_score();
         scoredmoves.emplace_back(sq, cumul);
     }
@@ -225,11 +250,10 @@ int FastState::play_random_move(int color, PolicyTrace * trace) {
         assert(moves.size());
 
         // Score remainder now
+        flag_moves(moves.begin() + scoredmoves.size(), color, matcher,
+                   trace != nullptr);
         for (auto mwf = moves.begin() + scoredmoves.size(); mwf != moves.end(); ++mwf) {
             int sq = mwf->get_sq();
-            if (sq != FastBoard::PASS) {
-                flag_move(*mwf, sq, color, matcher);
-            }
             cumul += mwf->get_score();
             scoredmoves.emplace_back(sq, cumul);
         }
@@ -307,12 +331,7 @@ void FastState::generate_trace(int color, PolicyTrace & trace, int move) {
 
     assert(moves[move_index].get_sq() == move);
 
-    for (auto & mwf : moves) {
-        int sq = mwf.get_sq();
-        if (sq != FastBoard::PASS) {
-            flag_move(mwf, sq, color, matcher);
-        }
-    }
+    flag_moves(moves.begin(), color, matcher, true);
 
     trace.add_to_trace(color == FastBoard::BLACK, moves, move_index);
 }
@@ -448,47 +467,108 @@ std::string FastState::move_to_text(int move) {
 
 std::vector<bool> FastState::mark_dead(float *winrate) {
     static const int MARKING_RUNS = 256;
+    // Games per round before checking whether we can stop
+    static const int ROUND_RUNS = 32;
+    static const int MIN_RUNS = 64;
+    // Standard deviations away from a coin flip before a
+    // stone counts as settled
+    static const float SETTLED_Z = 3.0f;
+
+    const int slots = std::max(1, std::min(cfg_num_threads, ROUND_RUNS));
+
+    // Every slot counts on its own and they are summed after
+    // each round, so the playouts never touch shared counters.
+    std::vector<std::vector<int>> slot_survive(
+        slots, std::vector<int>(FastBoard::MAXSQ, 0));
+    std::vector<float> slot_wins(slots, 0.0f);
 
     std::vector<int> survive_count(FastBoard::MAXSQ);
     std::vector<bool> dead_group(FastBoard::MAXSQ);
 
-    fill(survive_count.begin(), survive_count.end(), 0);
     fill(dead_group.begin(), dead_group.end(), false);
 
-    float wins = 0.0;
-    for (int i = 0; i < MARKING_RUNS; i++) {
-        FastState workstate(*this);
-        Playout p;
+    const int boardsize = board.get_boardsize();
+    int runs = 0;
+    float wins = 0.0f;
+
+    while (runs < MARKING_RUNS) {
+        // Same rounds whatever the thread count, the last one
+        // only makes up what is left of MARKING_RUNS
+        const int round_runs = std::min(ROUND_RUNS, MARKING_RUNS - runs);
+        thread_pool.parallel_for(0, slots, [this, &slot_survive, &slot_wins,
+                                            round_runs, slots,
+                                            boardsize](int slot) {
+            auto & survive = slot_survive[slot];
+            const int slot_runs = round_runs / slots
+                                  + (slot < round_runs % slots ? 1 : 0);
+            for (int run = 0; run < slot_runs; run++) {
+                FastState workstate(*this);
+                Playout p;
+
+                p.run(workstate, true, false);
+
+                float score = p.get_score();
+                if (score > 0.0f) {
+                    slot_wins[slot] += 1.0f;
+                } else if (score == 0.0f) {
+                    slot_wins[slot] += 0.5f;
+                }
 
-        p.run(workstate, true, false);
+                for (int i = 0; i < boardsize; i++) {
+                    for (int j = 0; j < boardsize; j++) {
+                        int vertex = board.get_vertex(i, j);
+                        int sq    =           board.get_square(vertex);
+                        int mc_sq = workstate.board.get_square(vertex);
 
-        float score = p.get_score();
-        if (score > 0.0f) {
-            wins += 1.0f;
-        } else if (score == 0.0f) {
-            wins += 0.5f;
+                        if (sq == mc_sq) {
+                            survive[vertex]++;
+                        }
+                    }
+                }
+            }
+        });
+        runs += round_runs;
+
+        fill(survive_count.begin(), survive_count.end(), 0);
+        wins = 0.0f;
+        for (int slot = 0; slot < slots; slot++) {
+            for (int vertex = 0; vertex < FastBoard::MAXSQ; vertex++) {
+                survive_count[vertex] += slot_survive[slot][vertex];
+            }
+            wins += slot_wins[slot];
         }
 
-        for (int i = 0; i < board.get_boardsize(); i++) {
-            for (int j = 0; j < board.get_boardsize(); j++) {
-                int vertex = board.get_vertex(i, j);
-                int sq    =           board.get_square(vertex);
-                int mc_sq = workstate.board.get_square(vertex);
+        if (runs < MIN_RUNS) {
+            continue;
+        }
 
-                if (sq == mc_sq) {
-                    survive_count[vertex]++;
+        // Stop once no stone is close to the live/dead boundary
+        const float margin = SETTLED_Z * std::sqrt((float)runs) / 2.0f;
+        bool settled = true;
+        for (int i = 0; i < boardsize && settled; i++) {
+            for (int j = 0; j < boardsize; j++) {
+                int vertex = board.get_vertex(i, j);
+                if (board.get_square(vertex) == FastBoard::EMPTY) {
+                    continue;
+                }
+                if (std::fabs(survive_count[vertex] - runs / 2.0f) <= margin) {
+                    settled = false;
+                    break;
                 }
             }
         }
+        if (settled) {
+            break;
+        }
     }
 
-    const int LIVE_TRESHOLD = MARKING_RUNS / 2;
+    const int LIVE_TRESHOLD = runs / 2;
     if (winrate) {
-        *winrate = wins / (float)MARKING_RUNS;
+        *winrate = wins / (float)runs;
     }
 
-    for (int i = 0; i < board.get_boardsize(); i++) {
-        for (int j = 0; j < board.get_boardsize(); j++) {
+    for (int i = 0; i < boardsize; i++) {
+        for (int j = 0; j < boardsize; j++) {
             int vertex = board.get_vertex(i, j);
 
             if (survive_count[vertex] < LIVE_TRESHOLD) {
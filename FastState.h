@@ -63,8 +63,13 @@ protected:
 
     int walk_empty_list(int color);
     void play_move(int color, int vertex);
-    void flag_move(MovewFeatures & mwf, int sq, int color,
-                   const Matcher * matcher);
+    void flag_move(MovewFeatures & mwf, int sq, int color, float gamma);
+    /*
+        Flag and score every move from first on. Pattern indexes
+        cost an extra lookup, they are only filled in for traces.
+    */
+    void flag_moves(FastBoard::movelist_t::iterator first, int color,
+                    const Matcher * matcher, bool traced = false);
 };
 
 #endif
@@ -9,6 +9,19 @@
 
 using namespace Utils;
 
+std::array<std::array<std::array<short, FastBoard::MAXSQ>, 8>,
+           FastBoard::MAXBOARDSIZE + 1> FullBoard::s_sym_vertex;
+std::array<std::once_flag, FastBoard::MAXBOARDSIZE + 1> FullBoard::s_sym_once;
+
+void FullBoard::update_sym_hashes(int vertex, int oldsq, int newsq) {
+    auto & sym_vertex = s_sym_vertex[m_boardsize];
+    for (int sym = 0; sym < 8; sym++) {
+        int newi = sym_vertex[sym][vertex];
+        m_sym_hash[sym] ^= Zobrist::zobrist[oldsq][newi]
+                         ^ Zobrist::zobrist[newsq][newi];
+    }
+}
+
 int FullBoard::remove_string(int i) {
     int pos = i;
     int removed = 0;
@@ -17,7 +30,8 @@ int FullBoard::remove_string(int i) {
     do {                    
         hash    ^= Zobrist::zobrist[m_square[pos]][pos];
         ko_hash ^= Zobrist::zobrist[m_square[pos]][pos];                                                          
-                        
+        update_sym_hashes(pos, color, EMPTY);
+
         m_square[pos] = EMPTY;                   
         m_parent[pos] = MAXSQ;    
         m_totalstones[color]--;   
@@ -55,6 +69,8 @@ uint64 FullBoard::calc_ko_hash(void) {
     }
     
     ko_hash = res;
+
+    calc_sym_hashes();
     
     /* Tromp-Taylor has positional superko */        
     return res;
@@ -91,32 +107,34 @@ uint64 FullBoard::calc_hash(void) {
     return res;
 }
 
-std::array<uint64, 8> FullBoard::get_rotated_hashes(void) {
-    std::array<uint64, 8> result;
+void FullBoard::calc_sym_hashes(void) {
+    auto & sym_vertex = s_sym_vertex[m_boardsize];
 
     for (int sym = 0; sym < 8; sym++) {
         uint64 res = 0x1234567887654321ULL;
 
         for (int i = 0; i < m_maxsq; i++) {
             if (m_square[i] != INVAL) {
-                int newi = rotate_vertex(i, sym);
-                res ^= Zobrist::zobrist[m_square[i]][newi];
+                res ^= Zobrist::zobrist[m_square[i]][sym_vertex[sym][i]];
             }
         }
-        /* prisoner hashing is rule set dependent */
-        res ^= Zobrist::zobrist_pris[0][m_prisoners[0]];
-        res ^= Zobrist::zobrist_pris[1][m_prisoners[1]];
-        if (m_tomove == BLACK)
-           res ^= 0xABCDABCDABCDABCDULL;
-        result[sym] = res;
+        m_sym_hash[sym] = res;
     }
-
-    return result;
 }
 
 uint64 FullBoard::get_canonical_hash(void) {
-    auto hashes = get_rotated_hashes();
-    return *std::min_element(hashes.cbegin(), hashes.cend());
+    /* prisoner hashing is rule set dependent */
+    uint64 common = Zobrist::zobrist_pris[0][m_prisoners[0]]
+                  ^ Zobrist::zobrist_pris[1][m_prisoners[1]];
+    if (m_tomove == BLACK) {
+        common ^= 0xABCDABCDABCDABCDULL;
+    }
+
+    uint64 res = m_sym_hash[0] ^ common;
+    for (int sym = 1; sym < 8; sym++) {
+        res = std::min(res, m_sym_hash[sym] ^ common);
+    }
+    return res;
 }
 
 uint64 FullBoard::get_hash(void) {
@@ -142,6 +160,7 @@ int FullBoard::update_board(const int color, const int i, bool & capture) {
     
     hash    ^= Zobrist::zobrist[m_square[i]][i];
     ko_hash ^= Zobrist::zobrist[m_square[i]][i];               
+    update_sym_hashes(i, EMPTY, color);
     
     /* update neighbor liberties (they all lose 1) */        
     add_neighbour(i, color);    
@@ -187,6 +206,11 @@ int FullBoard::update_board(const int color, const int i, bool & capture) {
     /* check whether we still live (i.e. detect suicide) */    
     if (m_libs[m_parent[i]] == 0) {                                
         assert(captured_stones == 0);        
+        int pos = i;
+        do {
+            update_sym_hashes(pos, color, EMPTY);
+            pos = m_next[pos];
+        } while (pos != i);
         remove_string_fast(i);                
     }
 
@@ -209,7 +233,17 @@ void FullBoard::display_board(int lastmove) {
 
 void FullBoard::reset_board(int size) {
     FastBoard::reset_board(size);
-    
+
+    std::call_once(s_sym_once[size], [this]() {
+        for (int sym = 0; sym < 8; sym++) {
+            for (int i = 0; i < m_maxsq; i++) {
+                if (m_square[i] != INVAL) {
+                    s_sym_vertex[m_boardsize][sym][i] = rotate_vertex(i, sym);
+                }
+            }
+        }
+    });
+
     calc_hash();
     calc_ko_hash();    
 }
@@ -2,6 +2,10 @@
 #define FULLBOARD_H_INCLUDED
 
 #include "config.h"
+
+#include <array>
+#include <mutex>
+
 #include "FastBoard.h"
 
 class FullBoard : public FastBoard {
@@ -26,7 +30,21 @@ public:
     uint64 ko_hash;
 
 private:
-    std::array<uint64, 8> get_rotated_hashes(void);
+    void calc_sym_hashes(void);
+    void update_sym_hashes(int vertex, int oldsq, int newsq);
+
+    /*
+        board hash as seen through each of the 8 symmetries,
+        without prisoners and side to move
+    */
+    std::array<uint64, 8> m_sym_hash;
+
+    /*
+        vertex each symmetry maps to, per board size
+    */
+    static std::array<std::array<std::array<short, MAXSQ>, 8>,
+                      MAXBOARDSIZE + 1> s_sym_vertex;
+    static std::array<std::once_flag, MAXBOARDSIZE + 1> s_sym_once;
 };
 
 #endif
@@ -16,10 +16,13 @@
 #include "Playout.h"
 #include "UCTSearch.h"
 #include "UCTNode.h"
+#include "SearchProfiler.h"
+#include "SearchTrace.h"
 #include "SGFTree.h"
 #include "AttribScores.h"
 #include "PNSearch.h"
 #include "Network.h"
+#include "Benchmark.h"
 #include "Book.h"
 #include "TTable.h"
 #include "MCPolicy.h"
@@ -57,7 +60,16 @@ float cfg_patternbonus;
 int cfg_rave_moves;
 int cfg_extra_symmetry;
 int cfg_random_loops;
+int cfg_leaf_playouts;
+int cfg_leaf_threads;
+int cfg_max_memory;
+bool cfg_deterministic;
+bool cfg_pin_threads;
+bool cfg_numa;
+uint32 cfg_rng_seed;
 std::string cfg_logfile;
+std::string cfg_cache_dir;
+std::string cfg_data_file;
 FILE* cfg_logfile_handle;
 bool cfg_quiet;
 AnalyzeTags cfg_analyze_tags;
@@ -147,7 +159,32 @@ void GTP::setup_default_parameters() {
     cfg_rave_moves = 10;
     cfg_mc_softmax = 1.0f;
     cfg_random_loops = 4;
+    cfg_leaf_playouts = 1;
+    cfg_leaf_threads = 0;
+    cfg_max_memory = 1024;
+    cfg_deterministic = false;
+    cfg_pin_threads = false;
+    cfg_numa = false;
+    // 0 means seeding from the clock
+    cfg_rng_seed = 0;
     cfg_logfile_handle = nullptr;
+    // Tables that are slow to build are kept here between runs
+#ifdef WIN32
+    const char * local_appdata = getenv("LOCALAPPDATA");
+    cfg_cache_dir = local_appdata ? std::string(local_appdata) + "/Leela" : "";
+#else
+    const char * xdg_cache = getenv("XDG_CACHE_HOME");
+    const char * home = getenv("HOME");
+    if (xdg_cache && *xdg_cache) {
+        cfg_cache_dir = std::string(xdg_cache) + "/leela";
+    } else if (home && *home) {
+        cfg_cache_dir = std::string(home) + "/.cache/leela";
+    } else {
+        cfg_cache_dir = "";
+    }
+#endif
+    // main makes this relative to the executable
+    cfg_data_file = "leela.dat";
     cfg_quiet = false;
 
     cfg_analyze_tags = AnalyzeTags{};
@@ -690,6 +727,21 @@ bool GTP::execute(GameState & game, std::string xinput) {
         } while (game.get_passes() < 2
                  && game.get_last_move() != FastBoard::RESIGN);
 
+        return true;
+    } else if (command.find("benchmark") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp;
+        int playouts = Benchmark::DEFAULT_PLAYOUTS;
+
+        cmdstream >> tmp;
+        if (!cmdstream.eof()) {
+            cmdstream >> playouts;
+            if (cmdstream.fail() || playouts < 1) {
+                gtp_fail_printf(id, "syntax not understood");
+                return true;
+            }
+        }
+        gtp_printf(id, "%s", Benchmark::run(playouts).c_str());
         return true;
     } else if (command.find("bench") == 0) {
         Playout::do_playout_benchmark(game);
@@ -879,6 +931,30 @@ bool GTP::execute(GameState & game, std::string xinput) {
         network->autotune_from_file(filename);
         gtp_printf(id, "");
         return true;
+    } else if (command.find("trace_search") == 0) {
+        std::istringstream cmdstream(command);
+        std::string tmp, filename;
+
+        cmdstream >> tmp >> filename;
+        if (filename.empty()) {
+            gtp_fail_printf(id, "syntax not understood");
+            return true;
+        }
+        // Written when the next search finishes
+        SearchTrace::arm(filename);
+        gtp_printf(id, "");
+        return true;
+    } else if (command.find("search_profile") == 0) {
+#ifdef SEARCH_PROFILE
+        gtp_printf(id, "%s", SearchProfiler::report().c_str());
+#else
+        gtp_fail_printf(id, "not compiled with SEARCH_PROFILE");
+#endif
+        return true;
+    } else if (command.find("selectbench") == 0) {
+        UCTNode::select_benchmark(game);
+        gtp_printf(id, "");
+        return true;
     } else if (command.find("netbench") == 0) {
         Network::get_Network()->benchmark(&game);
         gtp_printf(id, "");
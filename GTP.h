@@ -52,7 +52,16 @@ extern int cfg_eval_thresh;
 extern int cfg_rave_moves;
 extern int cfg_extra_symmetry;
 extern int cfg_random_loops;
+extern int cfg_leaf_playouts;
+extern int cfg_leaf_threads;
+extern int cfg_max_memory;
+extern bool cfg_deterministic;
+extern bool cfg_pin_threads;
+extern bool cfg_numa;
+extern uint32 cfg_rng_seed;
 extern std::string cfg_logfile;
+extern std::string cfg_cache_dir;
+extern std::string cfg_data_file;
 extern FILE* cfg_logfile_handle;
 extern bool cfg_quiet;
 extern AnalyzeTags cfg_analyze_tags;
@@ -1,7 +1,10 @@
 #include "config.h"
 
+#include <chrono>
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #ifdef USE_OPTIONS
@@ -22,11 +25,13 @@
 #include "AttribScores.h"
 #include "ThreadPool.h"
 #include "MCPolicy.h"
+#include "Benchmark.h"
 
 using namespace Utils;
 
 #ifdef USE_OPTIONS
-void parse_commandline(int argc, char *argv[], bool & gtp_mode) {
+void parse_commandline(int argc, char *argv[], bool & gtp_mode,
+                       bool & benchmark_mode) {
     namespace po = boost::program_options;
     // Declare the supported options.
     po::options_description v_desc("Allowed options");
@@ -47,6 +52,28 @@ void parse_commandline(int argc, char *argv[], bool & gtp_mode) {
         ("noponder", "Disable thinking on opponent's time.")
         ("nonets", "Disable use of neural networks.")
         ("nobook", "Disable use of the fuseki library.")
+        ("leafplayouts", po::value<int>()->default_value(cfg_leaf_playouts),
+                         "Playouts to run from every leaf reached "
+                         "(Monte Carlo only search).")
+        ("leafthreads", po::value<int>()->default_value(cfg_leaf_threads),
+                        "Threads that only help running leaf playouts.")
+        ("maxmemory", po::value<int>()->default_value(cfg_max_memory),
+                      "Memory budget for the search tree and tables in MiB.")
+        ("cachedir", po::value<std::string>()->default_value(cfg_cache_dir),
+                     "Directory to keep precomputed tables in.")
+        ("nocache", "Don't read or write precomputed tables.")
+        ("datafile", po::value<std::string>()->default_value(cfg_data_file),
+                     "File with the patterns, weights and opening book.")
+        ("benchmark", "Run the benchmark, print its JSON and exit.")
+        ("pinthreads", "Pin each thread to a core (Linux).")
+        ("numa", "Pin threads, keep tree nodes on the NUMA node of the "
+                 "thread that made them and interleave the hash table "
+                 "over all nodes (Linux).")
+        ("seed", po::value<uint32>(),
+                 "Random number generator seed.")
+        ("deterministic", "Identical inputs give identical searches: "
+                          "one thread, no pondering, only the playout "
+                          "limit ends a search. Requires --playouts.")
 #ifdef USE_OPENCL
         ("gpu",  po::value<std::vector<int> >(),
                 "ID of the OpenCL device(s) to use (disables autodetection).")
@@ -185,6 +212,20 @@ void parse_commandline(int argc, char *argv[], bool & gtp_mode) {
         gtp_mode = true;
     }
 
+    if (vm.count("benchmark")) {
+        benchmark_mode = true;
+    }
+
+    if (vm.count("nocache")) {
+        cfg_cache_dir = "";
+    } else if (vm.count("cachedir")) {
+        cfg_cache_dir = vm["cachedir"].as<std::string>();
+    }
+
+    if (vm.count("datafile")) {
+        cfg_data_file = vm["datafile"].as<std::string>();
+    }
+
     if (vm.count("threads")) {
         int num_threads = vm["threads"].as<int>();
         if (num_threads > cfg_num_threads) {
@@ -195,13 +236,14 @@ void parse_commandline(int argc, char *argv[], bool & gtp_mode) {
         }
     }
 
-    if (vm.count("noponder")) {
+    if (vm.count("noponder") || vm.count("deterministic")) {
         cfg_allow_pondering = false;
     }
 
     if (vm.count("playouts")) {
         cfg_max_playouts = vm["playouts"].as<int>();
-        if (!vm.count("noponder")) {
+        if (!vm.count("noponder") && !vm.count("deterministic")
+            && !vm.count("benchmark")) {
             myprintf("Nonsensical options: Playouts are restricted but "
                      "thinking on the opponent's time is still allowed. "
                      "Add --noponder if you want a weakened engine.\n");
@@ -217,6 +259,58 @@ void parse_commandline(int argc, char *argv[], bool & gtp_mode) {
         cfg_allow_book = false;
     }
 
+    if (vm.count("leafplayouts")) {
+        int leaf_playouts = vm["leafplayouts"].as<int>();
+        leaf_playouts = std::max(1, leaf_playouts);
+        if (leaf_playouts != cfg_leaf_playouts) {
+            myprintf("Running %d playouts per leaf.\n", leaf_playouts);
+            cfg_leaf_playouts = leaf_playouts;
+        }
+    }
+
+    if (vm.count("maxmemory")) {
+        cfg_max_memory = std::max(64, vm["maxmemory"].as<int>());
+    }
+
+    if (vm.count("leafthreads")) {
+        int leaf_threads = vm["leafthreads"].as<int>();
+        // Keep at least one thread searching the tree
+        leaf_threads = std::min(cfg_num_threads - 1, leaf_threads);
+        leaf_threads = std::max(0, leaf_threads);
+        if (leaf_threads != cfg_leaf_threads) {
+            myprintf("Using %d thread(s) for leaf playouts.\n", leaf_threads);
+            cfg_leaf_threads = leaf_threads;
+        }
+    }
+
+    if (vm.count("seed")) {
+        cfg_rng_seed = vm["seed"].as<uint32>();
+        myprintf("RNG seed: %u\n", (unsigned int)cfg_rng_seed);
+    }
+
+    if (vm.count("deterministic")) {
+        if (!vm.count("playouts")) {
+            myprintf("Nonsensical options: A deterministic search can "
+                     "only be stopped by a playout limit. "
+                     "Add --playouts.\n");
+            exit(EXIT_FAILURE);
+        }
+        myprintf("Deterministic search, using 1 thread.\n");
+        cfg_deterministic = true;
+        cfg_num_threads = 1;
+        cfg_leaf_threads = 0;
+        if (!cfg_rng_seed) {
+            cfg_rng_seed = 5489;
+        }
+    }
+
+    if (vm.count("pinthreads") || vm.count("numa")) {
+        cfg_pin_threads = true;
+        cfg_numa = vm.count("numa") > 0;
+        myprintf("Pinning threads to cores, %d NUMA node(s).\n",
+                 SMP::get_numa_nodes());
+    }
+
     if (vm.count("komiadjust")) {
         myprintf("Adjusting komi for territory scoring rules.\n");
         cfg_komi_adjust = true;
@@ -250,7 +344,9 @@ void parse_commandline(int argc, char *argv[], bool & gtp_mode) {
 
 #ifdef _CONSOLE
 int main (int argc, char *argv[]) {
+    auto start = std::chrono::steady_clock::now();
     bool gtp_mode = false;
+    bool benchmark_mode = false;
     std::string input;
 
 #ifdef USE_CAFFE
@@ -258,8 +354,19 @@ int main (int argc, char *argv[]) {
 #endif
     // Set up engine parameters
     GTP::setup_default_parameters();
+    // The data file is shipped next to the executable, or installed
+    // by make install in the share directory next to its bin
+    auto program_dir = get_executable_dir(argv[0]);
+    if (!program_dir.empty()) {
+        for (auto dir : {program_dir, program_dir + "../share/leela/"}) {
+            if (std::ifstream(dir + cfg_data_file)) {
+                cfg_data_file = dir + cfg_data_file;
+                break;
+            }
+        }
+    }
 #ifdef USE_OPTIONS
-    parse_commandline(argc, argv, gtp_mode);
+    parse_commandline(argc, argv, gtp_mode, benchmark_mode);
 #endif
 
     // Disable IO buffering as much as possible
@@ -273,7 +380,21 @@ int main (int argc, char *argv[]) {
     setbuf(stdin, NULL);
 #endif
 
-    thread_pool.initialize(cfg_num_threads);
+    // Deterministic searches do all the work on the calling thread
+    size_t pool_threads = cfg_deterministic ? 0 : cfg_num_threads - 1;
+    if (cfg_pin_threads) {
+        // We are thread 0, the pool threads come after us. We take
+        // part in all the pool's work, so it has one thread less.
+        SMP::pin_thread(0);
+        thread_pool.initialize(pool_threads, [](size_t i) {
+            SMP::pin_thread(i + 1);
+        });
+    } else {
+        thread_pool.initialize(pool_threads);
+    }
+    if (cfg_rng_seed) {
+        Random::seed_all(cfg_rng_seed);
+    }
 
     // Use deterministic random numbers for hashing
     std::unique_ptr<Random> rng(new Random(5489));
@@ -294,6 +415,19 @@ int main (int argc, char *argv[]) {
         exit(EXIT_FAILURE);
     }
 
+    auto ready = std::chrono::steady_clock::now();
+    Benchmark::set_startup_time(
+        std::chrono::duration<double, std::milli>(ready - start).count());
+
+    if (benchmark_mode) {
+        int playouts = Benchmark::DEFAULT_PLAYOUTS;
+        if (cfg_max_playouts != INT_MAX) {
+            playouts = cfg_max_playouts;
+        }
+        std::cout << Benchmark::run(playouts) << std::endl;
+        return 0;
+    }
+
     for(;;) {
         if (!gtp_mode) {
             maingame->display_state();
@@ -15,7 +15,8 @@
 #endif
 #include "GTP.h"
 #include "MCPolicy.h"
-#include "SGFParser.h"
+#include "Matcher.h"
+#include "SGFIndex.h"
 #include "SGFTree.h"
 #include "Utils.h"
 #include "Random.h"
@@ -24,13 +25,30 @@
 
 using namespace Utils;
 
-#include "PolicyWeights.h"
-#include "PolicyWeightsSL.h"
-#include "PatternsLive.h"
+alignas(64) std::array<float, NUM_PATTERNS> PolicyWeights::pattern_weights;
+alignas(64) std::array<float, NUM_FEATURES> PolicyWeights::feature_weights;
+alignas(64) std::array<float, 1 << PolicyWeights::COMBO_BITS> PolicyWeights::combo_low;
+alignas(64) std::array<float, 1 << PolicyWeights::COMBO_BITS> PolicyWeights::combo_high;
 alignas(64) std::array<float, NUM_PATTERNS> PolicyWeights::pattern_gradients;
 alignas(64) std::array<float, NUM_FEATURES> PolicyWeights::feature_gradients;
-// Filled by Matcher.cpp from PolicyWeights::live_patterns
-// alignas(64) const std::array<float, NUM_PATTERNS> PolicyWeights::pattern_weights_sl;
+
+constexpr int PolicyWeights::COMBO_BITS;
+
+void PolicyWeights::update_combos() {
+    for (int half = 0; half < 2; half++) {
+        auto & combos = half ? combo_high : combo_low;
+        for (size_t flags = 0; flags < combos.size(); flags++) {
+            float gamma = 1.0f;
+            for (int i = 0; i < COMBO_BITS; i++) {
+                int flag = half * COMBO_BITS + i;
+                if ((flags & (1 << i)) && flag < NUM_FEATURES) {
+                    gamma *= feature_weights[flag];
+                }
+            }
+            combos[flags] = gamma;
+        }
+    }
+}
 
 // Adam
 alignas(64) std::array<std::pair<float, float>, NUM_PATTERNS> pattern_adam{};
@@ -39,9 +57,12 @@ int t{0};
 
 
 void MCPolicy::mse_from_file(std::string filename) {
-    std::vector<std::string> games = SGFParser::chop_all(filename);
+    SGFIndex games(filename);
     size_t gametotal = games.size();
     myprintf("Total games in file: %d\n", gametotal);
+    if (gametotal == 0) {
+        return;
+    }
 
 #if defined(_OPENMP)
     omp_set_num_threads(cfg_num_threads);
@@ -53,6 +74,8 @@ void MCPolicy::mse_from_file(std::string filename) {
 
     PolicyWeights::feature_weights.fill(1.0f);
     PolicyWeights::pattern_weights.fill(1.0f);
+    PolicyWeights::update_combos();
+    Matcher::get_Matcher()->update_weights();
     Time start;
 
     while (1) {
@@ -60,8 +83,10 @@ void MCPolicy::mse_from_file(std::string filename) {
 
         std::unique_ptr<SGFTree> sgftree(new SGFTree);
         try {
-            sgftree->load_from_string(games[pick]);
+            sgftree->load_from_string(games.get_game(pick));
         } catch (...) {
+            // Only part of the tree could be set up
+            continue;
         };
 
         int who_won = sgftree->get_winner();
@@ -181,9 +206,12 @@ void MCPolicy::mse_from_file(std::string filename) {
 }
 
 void MCPolicy::mse_from_file2(std::string filename) {
-    std::vector<std::string> games = SGFParser::chop_all(filename);
+    SGFIndex games(filename);
     size_t gametotal = games.size();
     myprintf("Total games in file: %d\n", gametotal);
+    if (gametotal == 0) {
+        return;
+    }
 
 #if defined(_OPENMP)
     omp_set_num_threads(cfg_num_threads);
@@ -195,6 +223,8 @@ void MCPolicy::mse_from_file2(std::string filename) {
 
     PolicyWeights::feature_weights.fill(1.0f);
     PolicyWeights::pattern_weights.fill(1.0f);
+    PolicyWeights::update_combos();
+    Matcher::get_Matcher()->update_weights();
 
     PolicyWeights::feature_gradients.fill(0.0f);
     PolicyWeights::pattern_gradients.fill(0.0f);
@@ -206,7 +236,7 @@ void MCPolicy::mse_from_file2(std::string filename) {
         for (int gameid = 0; gameid < 128; gameid++) {
             std::unique_ptr<SGFTree> sgftree(new SGFTree);
             try {
-                sgftree->load_from_string(games[Random::get_Rng()->randuint32(gametotal)]);
+                sgftree->load_from_string(games.get_game(Random::get_Rng()->randuint32(gametotal)));
             } catch (...) {
                 #pragma omp atomic
                 count++;
@@ -562,4 +592,6 @@ void MCPolicy::adjust_weights(float black_eval, float black_winrate) {
         assert(!std::isnan(gamma));
         PolicyWeights::pattern_weights[i] = gamma;
     }
+    PolicyWeights::update_combos();
+    Matcher::get_Matcher()->update_weights();
 }
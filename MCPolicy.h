@@ -37,14 +37,29 @@ constexpr int MWF_FLAG_SEMEAI_3     = 21;
 
 class PolicyWeights {
 public:
-    static const std::array<int, NUM_PATTERNS> live_patterns;
     alignas(64) static std::array<float, NUM_PATTERNS> pattern_gradients;
     alignas(64) static std::array<float, NUM_FEATURES> feature_gradients;
+    // Loaded from the data file by the Matcher
     alignas(64) static std::array<float, NUM_PATTERNS> pattern_weights;
     alignas(64) static std::array<float, NUM_FEATURES> feature_weights;
-    alignas(64) static const std::array<float, NUM_PATTERNS> pattern_weights_sl;
-    alignas(64) static const std::array<float, NUM_FEATURES> feature_weights_sl;
+
+    /*
+        Product of feature_weights over every set of flags. The flags
+        are split in two halves, so the tables stay small enough for
+        the L1 cache. update_combos must be called whenever
+        feature_weights change.
+    */
+    static constexpr int COMBO_BITS = 11;
+    alignas(64) static std::array<float, 1 << COMBO_BITS> combo_low;
+    alignas(64) static std::array<float, 1 << COMBO_BITS> combo_high;
+    static void update_combos();
+    static float combo_gamma(int flags) {
+        return combo_low[flags & ((1 << COMBO_BITS) - 1)]
+               * combo_high[flags >> COMBO_BITS];
+    }
 };
+static_assert(2 * PolicyWeights::COMBO_BITS >= NUM_FEATURES,
+              "Every feature needs a bit in the combination tables");
 
 class MovewFeatures {
 public:
@@ -109,14 +124,18 @@ public:
         assert(flag < std::numeric_limits<decltype(flag)>::digits);
         assert(flag < NUM_FEATURES);
         m_flags |= 1 << flag;
-        m_score *= PolicyWeights::feature_weights[flag];
-        //m_score *= PolicyWeights::feature_weights_sl[flag];
+    }
+    // PolicyWeights::pattern_weights of the pattern, looked up by the Matcher
+    void set_gamma(float gamma) {
+        m_gamma = gamma;
     }
     void set_pattern(int pattern) {
         assert(pattern < NUM_PATTERNS);
         m_pattern = pattern;
-        m_score *= PolicyWeights::pattern_weights[m_pattern];
-        //m_score *= PolicyWeights::pattern_weights_sl[m_pattern];
+    }
+    // Once all flags are known
+    void update_score() {
+        m_score = m_gamma * PolicyWeights::combo_gamma(m_flags);
     }
     int get_pattern() const {
         assert(m_pattern > 0);
@@ -138,7 +157,9 @@ private:
     // Attributes/Features
     int m_flags{0};
     int m_pattern;
-    // Score so far
+    // Weight of the pattern
+    float m_gamma{1.0f};
+    // Times the weights of all flags, by update_score
     float m_score{1.0f};
 };
 
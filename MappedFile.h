@@ -0,0 +1,36 @@
+#ifndef MAPPEDFILE_H_INCLUDED
+#define MAPPEDFILE_H_INCLUDED
+
+#include "config.h"
+
+#include <cstddef>
+#include <string>
+
+/*
+    A whole file mapped read-only into memory. Pages are read in
+    when they are first touched, so opening a large file is cheap.
+*/
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    // false if the file can't be opened or is empty
+    bool open(const std::string & filename);
+    void close();
+
+    const char * data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    const char * m_data{nullptr};
+    size_t m_size{0};
+#ifdef WIN32
+    void * m_file{nullptr};
+    void * m_mapping{nullptr};
+#endif
+};
+
+#endif
@@ -1,15 +1,28 @@
 #include "config.h"
 
+#include <algorithm>
+#include <cassert>
 #include <limits>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <boost/format.hpp>
+#ifdef _MSC_VER
+#include <xmmintrin.h>
+#endif
+
 #include "Matcher.h"
 #include "FastBoard.h"
 #include "Utils.h"
 #include "GTP.h"
 #include "MCPolicy.h"
-#include "Patterns.h"
-#include "PatternHash.h"
+#include "Resources.h"
 
 Matcher* Matcher::get_Matcher(void) {
     static Matcher s_matcher;
@@ -26,21 +39,159 @@ int Matcher::PatHashV(uint32 d, uint32 p) const {
 }
 
 int Matcher::PatIndex(uint32 pattern) const {
-    auto g_v = G[PatHashG(pattern)];
+    auto g_v = m_g[PatHashG(pattern)];
     return PatHashV(g_v, pattern);
 }
 
+float Matcher::gamma(int color, int pattern) const {
+    int slot = PatIndex(pattern);
+    // Unused slots are marked invalid in debug builds
+    assert(m_patterns[color][slot] < NUM_PATTERNS);
+    return m_gammas[color][slot];
+}
+
 int Matcher::matches(int color, int pattern) const {
-    auto idx = PatIndex(pattern);
-    return m_patterns[color][idx];
+    int index = m_patterns[color][PatIndex(pattern)];
+    assert(index < NUM_PATTERNS);
+    return index;
+}
+
+void Matcher::prefetch(int color, int pattern) const {
+    const float * slot = &m_gammas[color][PatIndex(pattern)];
+#ifdef _MSC_VER
+    _mm_prefetch(reinterpret_cast<const char *>(slot), _MM_HINT_T0);
+#else
+    __builtin_prefetch(slot);
+#endif
+}
+
+namespace {
+    struct CacheHeader {
+        char m_magic[4];
+        uint32 m_version;
+        uint64 m_fingerprint;
+        uint64 m_checksum;
+    };
+    const char CACHE_MAGIC[4] = {'L', 'Z', 'M', 'T'};
+    constexpr uint32 CACHE_VERSION = 1;
 }
 
 // initialize matcher data
 Matcher::Matcher() {
+    auto start = std::chrono::steady_clock::now();
+
+    m_g = Resources::get<int>("pattern_hash", G_SIZE);
     rescale_policy_weights();
 
-    m_patterns[FastBoard::BLACK].resize(V_SIZE);
-    m_patterns[FastBoard::WHITE].resize(V_SIZE);
+    uint64 fingerprint = get_fingerprint();
+    std::string filename = Utils::get_cache_path(
+        boost::str(boost::format("matcher-%016llx.bin")
+                   % (unsigned long long)fingerprint));
+    if (filename.empty() || !load_tables(filename, fingerprint)) {
+        build_tables();
+        if (!filename.empty()) {
+            save_tables(filename, fingerprint);
+        }
+    }
+    m_cached = m_cache.data() != nullptr;
+
+    for (auto & gammas : m_gammas) {
+        gammas.resize(V_SIZE);
+    }
+    update_weights();
+
+    auto end = std::chrono::steady_clock::now();
+    m_init_ms = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+double Matcher::get_init_time() const {
+    return m_init_ms;
+}
+
+bool Matcher::is_cached() const {
+    return m_cached;
+}
+
+void Matcher::update_weights() {
+    for (int color = 0; color < 2; color++) {
+        for (size_t i = 0; i < V_SIZE; i++) {
+            auto index = m_patterns[color][i];
+            m_gammas[color][i] = index < NUM_PATTERNS
+                ? PolicyWeights::pattern_weights[index] : 0.0f;
+        }
+    }
+}
+
+uint64 Matcher::get_fingerprint() const {
+    uint64 hash = Utils::fnv1a(&CACHE_VERSION, sizeof(CACHE_VERSION));
+    for (auto name : {"patterns", "pattern_hash", "live_patterns"}) {
+        uint64 checksum = Resources::checksum(name);
+        hash = Utils::fnv1a(&checksum, sizeof(checksum), hash);
+    }
+    return hash;
+}
+
+bool Matcher::load_tables(const std::string & filename, uint64 fingerprint) {
+    constexpr size_t table_size = 2 * V_SIZE * sizeof(unsigned short);
+    if (!m_cache.open(filename)) {
+        return false;
+    }
+    CacheHeader header;
+    if (m_cache.size() != sizeof(header) + table_size) {
+        m_cache.close();
+        return false;
+    }
+    std::memcpy(&header, m_cache.data(), sizeof(header));
+    const char * tables = m_cache.data() + sizeof(header);
+    if (std::memcmp(header.m_magic, CACHE_MAGIC, sizeof(CACHE_MAGIC))
+        || header.m_version != CACHE_VERSION
+        || header.m_fingerprint != fingerprint
+        || header.m_checksum != Utils::fnv1a(tables, table_size)) {
+        Utils::myprintf("Ignoring damaged pattern cache %s\n",
+                        filename.c_str());
+        m_cache.close();
+        return false;
+    }
+    auto patterns = reinterpret_cast<const unsigned short *>(tables);
+    m_patterns[FastBoard::BLACK] = patterns;
+    m_patterns[FastBoard::WHITE] = patterns + V_SIZE;
+    return true;
+}
+
+void Matcher::save_tables(const std::string & filename,
+                          uint64 fingerprint) const {
+    constexpr size_t table_size = 2 * V_SIZE * sizeof(unsigned short);
+    CacheHeader header;
+    std::memcpy(header.m_magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.m_version = CACHE_VERSION;
+    header.m_fingerprint = fingerprint;
+    header.m_checksum = Utils::fnv1a(m_built.data(), table_size);
+
+    // Other processes may be starting up at the same time, only
+    // a complete file gets the final name
+    auto unique = std::chrono::high_resolution_clock::now().time_since_epoch().count()
+                  ^ std::hash<std::thread::id>()(std::this_thread::get_id());
+    std::string tmpname = filename + ".tmp" + std::to_string(unique);
+    std::ofstream out(tmpname, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(m_built.data()), table_size);
+    out.close();
+    if (!out) {
+        std::remove(tmpname.c_str());
+        return;
+    }
+    std::remove(filename.c_str());
+    if (std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+        std::remove(tmpname.c_str());
+    }
+}
+
+void Matcher::build_tables() {
+    m_built.resize(2 * V_SIZE);
+    unsigned short * black = &m_built[0];
+    unsigned short * white = &m_built[V_SIZE];
+    m_patterns[FastBoard::BLACK] = black;
+    m_patterns[FastBoard::WHITE] = white;
 
 #ifdef DEBUG
     // Crash
@@ -49,16 +200,16 @@ Matcher::Matcher() {
     // Don't crash
     unsigned short fill = 0;
 #endif
-    std::fill(begin(m_patterns[0]), end(m_patterns[0]), fill);
-    std::fill(begin(m_patterns[1]), end(m_patterns[1]), fill);
+    std::fill(begin(m_built), end(m_built), fill);
 
     std::unordered_map<int, size_t> pattern_indexes;
 
     // Convert the list of valid patterns into a list
     // of indexes of the exact minimal size
-    for (auto const& pat : PolicyWeights::live_patterns) {
+    auto live_patterns = Resources::get<int>("live_patterns", NUM_PATTERNS);
+    for (size_t i = 0; i < NUM_PATTERNS; i++) {
         size_t pat_idx = pattern_indexes.size();
-        pattern_indexes.emplace(pat, pat_idx);
+        pattern_indexes.emplace(live_patterns[i], pat_idx);
     }
 
     // minimal board we need is 3x3
@@ -68,7 +219,9 @@ Matcher::Matcher() {
     // center square
     int startvtx = board.get_vertex(1, 1);
 
-    for (auto i : Matcher::Patterns) {
+    auto patterns = Resources::get<int>("patterns", VALID_PATTERNS);
+    for (size_t j = 0; j < VALID_PATTERNS; j++) {
+        int i = patterns[j];
         int w = i;
         // fill board
         for (int k = 7; k >= 0; k--) {
@@ -84,29 +237,44 @@ Matcher::Matcher() {
 
         auto it1 = pattern_indexes.find(reducpat1);
         if (it1 != pattern_indexes.cend()) {
-            m_patterns[FastBoard::BLACK][pathash] = it1->second;
+            black[pathash] = it1->second;
         }
 
         auto it2 = pattern_indexes.find(reducpat2);
         if (it2 != pattern_indexes.cend()) {
-            m_patterns[FastBoard::WHITE][pathash] = it2->second;
+            white[pathash] = it2->second;
         }
     }
 }
 
 
 void Matcher::rescale_policy_weights() {
+    std::copy_n(Resources::get<float>("feature_weights", NUM_FEATURES),
+                NUM_FEATURES, PolicyWeights::feature_weights.begin());
+    std::copy_n(Resources::get<float>("pattern_weights", NUM_PATTERNS),
+                NUM_PATTERNS, PolicyWeights::pattern_weights.begin());
 #if 1
-    // e^(x/t) = e^x^(1/t)
+    auto feature_weights_sl =
+        Resources::get<float>("feature_weights_sl", NUM_FEATURES);
+    auto pattern_weights_sl =
+        Resources::get<float>("pattern_weights_sl", NUM_PATTERNS);
     for (size_t i = 0; i < NUM_FEATURES; i++) {
-        PolicyWeights::feature_weights[i] *= PolicyWeights::feature_weights_sl[i];
-        PolicyWeights::feature_weights[i] =
-            std::pow(PolicyWeights::feature_weights[i], 1.0f / cfg_mc_softmax);
+        PolicyWeights::feature_weights[i] *= feature_weights_sl[i];
     }
     for (size_t i = 0; i < NUM_PATTERNS; i++) {
-        PolicyWeights::pattern_weights[i] *= PolicyWeights::pattern_weights_sl[i];
-        PolicyWeights::pattern_weights[i] =
-            std::pow(PolicyWeights::pattern_weights[i], 1.0f / cfg_mc_softmax);
+        PolicyWeights::pattern_weights[i] *= pattern_weights_sl[i];
+    }
+    // e^(x/t) = e^x^(1/t), nothing to do at the default t = 1
+    if (cfg_mc_softmax != 1.0f) {
+        for (size_t i = 0; i < NUM_FEATURES; i++) {
+            PolicyWeights::feature_weights[i] =
+                std::pow(PolicyWeights::feature_weights[i], 1.0f / cfg_mc_softmax);
+        }
+        for (size_t i = 0; i < NUM_PATTERNS; i++) {
+            PolicyWeights::pattern_weights[i] =
+                std::pow(PolicyWeights::pattern_weights[i], 1.0f / cfg_mc_softmax);
+        }
     }
 #endif
+    PolicyWeights::update_combos();
 }
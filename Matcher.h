@@ -2,29 +2,64 @@
 #define MATCHER_H_INCLUDED
 
 #include <array>
+#include <string>
 #include <vector>
 
+#include "MappedFile.h"
+
 class Matcher {
 public:
+    /*
+        What a pattern is worth to the playout policy. Stored by hash
+        slot, so scoring a move is a single load after the hashing.
+    */
+    float gamma(int color, int pattern) const;
+    // Index of a pattern, for traces and the tuners
     int matches(int color, int pattern) const;
+    // Start loading the weight of a pattern into the cache
+    void prefetch(int color, int pattern) const;
+    // Copy PolicyWeights::pattern_weights into the slots, after they changed
+    void update_weights();
 
     static Matcher* get_Matcher(void);
 
+    // How long setting up took, in milliseconds
+    double get_init_time() const;
+    // Whether the tables came from the cache
+    bool is_cached() const;
+
 private:
     Matcher();
     int PatHashG(uint32 pattern) const;
     int PatHashV(uint32 d, uint32 pattern) const;
     int PatIndex(uint32 pattern) const;
     void rescale_policy_weights();
+    /*
+        The tables only depend on the pattern lists in the data file,
+        so they are built once and kept in a file in the cache
+        directory. The file name holds a fingerprint of those lists.
+    */
+    uint64 get_fingerprint() const;
+    bool load_tables(const std::string & filename, uint64 fingerprint);
+    void build_tables();
+    void save_tables(const std::string & filename, uint64 fingerprint) const;
 
     // List of patterns we need to process
     static constexpr size_t VALID_PATTERNS = 181203;
-    static const std::array<int, VALID_PATTERNS> Patterns;
     // Perfect Hash
     static constexpr size_t G_SIZE = 8192;
     static constexpr size_t V_SIZE = 1 << 18;
-    static const std::array<int, G_SIZE> G;
-    std::array<std::vector<unsigned short>, 2> m_patterns;
+    // Displacements, in the data file
+    const int * m_g;
+    // Per color, indexed by the perfect hash. Point into the
+    // cache file, which processes share, or m_built.
+    std::array<const unsigned short *, 2> m_patterns;
+    std::vector<unsigned short> m_built;
+    MappedFile m_cache;
+    // Per color, indexed by the perfect hash like m_patterns
+    std::array<std::vector<float>, 2> m_gammas;
+    bool m_cached{false};
+    double m_init_ms;
 };
 
 #endif
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <array>
 #include <thread>
+#include <iterator>
 #include <boost/utility.hpp>
 #include <boost/format.hpp>
 
@@ -36,17 +37,21 @@ using namespace caffe;
 #endif
 
 #include "SGFTree.h"
-#include "SGFParser.h"
+#include "SGFStream.h"
 #include "Utils.h"
 #include "FastBoard.h"
 #include "Random.h"
 #include "Network.h"
 #include "GTP.h"
 #include "Utils.h"
+#include "SearchTrace.h"
+#include "Timing.h"
+#include "TrainData.h"
 
 using namespace Utils;
 
 Network* Network::s_Net = nullptr;
+std::atomic<uint64> Network::s_evals{0};
 #ifdef USE_CAFFE
 std::unique_ptr<caffe::Net> Network::s_net;
 #endif
@@ -153,16 +158,12 @@ void Network::benchmark(FastState * state) {
 
         Time start;
 
-        ThreadGroup tg(thread_pool);
-        for (int i = 0; i < cpus; i++) {
-            tg.add_task([iters_per_thread, state]() {
-                FastState mystate = *state;
-                for (int loop = 0; loop < iters_per_thread; loop++) {
-                    auto vec = get_scored_moves(&mystate, Ensemble::RANDOM_ROTATION);
-                }
-            });
-        };
-        tg.wait_all();
+        thread_pool.parallel_for(0, cpus, [iters_per_thread, state](int) {
+            FastState mystate = *state;
+            for (int loop = 0; loop < iters_per_thread; loop++) {
+                auto vec = get_scored_moves(&mystate, Ensemble::RANDOM_ROTATION);
+            }
+        });
 
         Time end;
 
@@ -178,16 +179,12 @@ void Network::benchmark(FastState * state) {
         int iters_per_thread = (BENCH_AMOUNT + (cpus - 1)) / cpus;
 
         Time start;
-        ThreadGroup tg(thread_pool);
-        for (int i = 0; i < cpus; i++) {
-            tg.add_task([iters_per_thread, state]() {
-                FastState mystate = *state;
-                for (int loop = 0; loop < iters_per_thread; loop++) {
-                    auto vec = get_value(&mystate, Ensemble::RANDOM_ROTATION);
-                }
-            });
-        };
-        tg.wait_all();
+        thread_pool.parallel_for(0, cpus, [iters_per_thread, state](int) {
+            FastState mystate = *state;
+            for (int loop = 0; loop < iters_per_thread; loop++) {
+                auto vec = get_value(&mystate, Ensemble::RANDOM_ROTATION);
+            }
+        });
 
         Time end;
 
@@ -472,6 +469,8 @@ void Network::softmax(std::vector<float>& input,
 class CallbackData {
 public:
     std::atomic<int> * m_nodecount;
+    // Held up while the callback can still write into the tree
+    std::atomic<int> * m_pending;
     FastState m_state;
     UCTNode * m_node;
     int m_rotation;
@@ -484,6 +483,8 @@ public:
 extern "C" void CL_CALLBACK forward_cb(cl_event event, cl_int status,
                                        void* data) {
     CallbackData * cb_data = static_cast<CallbackData*>(data);
+    SearchTrace::async_end("policy_net", (uint64)(uintptr_t)cb_data);
+    TRACE_SCOPE("forward_cb");
 
     // Mark the kernels as available
     cb_data->m_thread_results_outstanding->fetch_sub(1, std::memory_order_release);
@@ -524,6 +525,9 @@ extern "C" void CL_CALLBACK forward_cb(cl_event event, cl_int status,
 
     cb_data->m_node->scoring_cb(cb_data->m_nodecount, cb_data->m_state,
                                 result, false);
+    if (cb_data->m_pending) {
+        cb_data->m_pending->fetch_sub(1);
+    }
 
     delete cb_data;
 
@@ -534,6 +538,7 @@ extern "C" void CL_CALLBACK forward_cb(cl_event event, cl_int status,
 }
 
 void Network::async_scored_moves(std::atomic<int> * nodecount,
+                                 std::atomic<int> * pending,
                                  FastState * state,
                                  UCTNode * node,
                                  Ensemble ensemble,
@@ -551,6 +556,7 @@ void Network::async_scored_moves(std::atomic<int> * nodecount,
     }
 
     CallbackData * cb_data = new CallbackData();
+    s_evals++;
 
     NNPlanes planes;
     BoardPlane *ladder;
@@ -560,6 +566,11 @@ void Network::async_scored_moves(std::atomic<int> * nodecount,
     constexpr int height = 19;
 
     cb_data->m_nodecount = nodecount;
+    cb_data->m_pending = pending;
+    if (pending) {
+        // Before the simulation that queues this can leave its epoch
+        pending->fetch_add(1);
+    }
     cb_data->m_state = *state;
     cb_data->m_node = node;
     cb_data->m_input_data.resize(Network::MAX_CHANNELS * 19 * 19);
@@ -581,6 +592,7 @@ void Network::async_scored_moves(std::atomic<int> * nodecount,
 
     void * data = static_cast<void*>(cb_data);
 
+    SearchTrace::async_begin("policy_net", (uint64)(uintptr_t)cb_data);
     opencl_policy_net.forward(cb_data->m_input_data,
                                     cb_data->m_output_data,
                                     forward_cb, data);
@@ -592,6 +604,7 @@ float Network::get_value(FastState * state, Ensemble ensemble) {
         assert(false);
         return 0.5f;
     }
+    TRACE_SCOPE("value_net");
 
     NNPlanes planes;
     gather_features_value(state, planes);
@@ -627,6 +640,7 @@ Network::Netresult Network::get_scored_moves(
     if (state->board.get_boardsize() != 19) {
         return result;
     }
+    TRACE_SCOPE("policy_net");
 
     NNPlanes planes;
     BoardPlane* ladder;
@@ -677,6 +691,7 @@ float Network::get_value_internal(
     FastState * state, NNPlanes & planes, int rotation) {
     assert(rotation >= 0 && rotation <= 7);
     float result;
+    s_evals++;
 
     constexpr int channels = VALUE_CHANNELS;
     constexpr int width = 19;
@@ -743,6 +758,7 @@ Network::Netresult Network::get_scored_moves_internal(
     FastState * state, NNPlanes & planes, int rotation) {
     Netresult result;
     assert(rotation >= 0 && rotation <= 7);
+    s_evals++;
 #ifdef USE_CAFFE
     Blob* input_layer = s_net->input_blobs()[0];
     int channels = input_layer->channels();
@@ -1200,140 +1216,169 @@ void Network::gather_features_value(FastState * state, NNPlanes & planes) {
     }
 }
 
-void Network::gather_traindata(std::string filename, TrainVector& data) {
-    std::vector<std::string> games = SGFParser::chop_all(filename);
-    int gametotal = games.size();
-    int gamecount = 0;
+void Network::gather_game_traindata(const std::string & gamebuff,
+                                    TrainVector & data) {
+    std::unique_ptr<SGFTree> sgftree(new SGFTree);
 
-    size_t train_pos = 0;
-    size_t test_pos = 0;
+    try {
+        sgftree->load_from_string(gamebuff);
+    } catch (...) {
+        // Only part of the tree could be set up
+        return;
+    };
 
-    myprintf("Total games in file: %d\n", gametotal);
-    myprintf("Shuffling...\n");
-    std::random_shuffle(games.begin(), games.end());
+    SGFTree * treewalk = &(*sgftree);
+    size_t counter = 0;
 
-    while (gamecount < gametotal) {
-        std::unique_ptr<SGFTree> sgftree(new SGFTree);
+    size_t movecount = sgftree->count_mainline_moves();
+    std::vector<int> tree_moves = sgftree->get_mainline();
+    int who_won = sgftree->get_winner();
+    int handicap = sgftree->get_state()->get_handicap();
+    //float komi = sgftree->get_state()->get_komi();
+    if (handicap) {
+        return;
+    }
+    // 5.5, 6.5, 7.5
+    //if (std::abs(komi) > 0.75f && (std::abs(komi) < 5.25f || std::abs(komi) > 7.75f)) {
+    //    return;
+    //}
+    if (who_won != FastBoard::BLACK && who_won != FastBoard::WHITE) {
+        return;
+    }
 
-        try {
-            sgftree->load_from_string(games[gamecount]);
-        } catch (...) {
-        };
+    while (counter < movecount) {
+        assert(treewalk != NULL);
+        assert(treewalk->get_state() != NULL);
+        if (treewalk->get_state()->board.get_boardsize() != 19)
+            break;
 
-        SGFTree * treewalk = &(*sgftree);
-        size_t counter = 0;
+        KoState * state = treewalk->get_state();
+        int tomove = state->get_to_move();
+        int move;
 
-        size_t movecount = sgftree->count_mainline_moves();
-        std::vector<int> tree_moves = sgftree->get_mainline();
-        int who_won = sgftree->get_winner();
-        int handicap = sgftree->get_state()->get_handicap();
-        //float komi = sgftree->get_state()->get_komi();
-        if (handicap) {
-            goto skipnext;
+        if (treewalk->get_child(0) != NULL) {
+            move = treewalk->get_child(0)->get_move(tomove);
+            if (move == SGFTree::EOT) {
+                break;
+            }
+        } else {
+            break;
         }
-        // 5.5, 6.5, 7.5
-        //if (std::abs(komi) > 0.75f && (std::abs(komi) < 5.25f || std::abs(komi) > 7.75f)) {
-        //    goto skipnext;
-        //}
-        if (who_won != FastBoard::BLACK && who_won != FastBoard::WHITE) {
-            goto skipnext;
+
+        assert(move == tree_moves[counter]);
+        int this_move = -1;
+
+        std::vector<int> moves = state->generate_moves(tomove);
+        bool moveseen = false;
+        for(auto it = moves.begin(); it != moves.end(); ++it) {
+            if (*it == move) {
+                if (move != FastBoard::PASS) {
+                    // get x y coords for actual move
+                    std::pair<int, int> xy = state->board.get_xy(move);
+                    this_move = (xy.second * 19) + xy.first;
+                }
+                moveseen = true;
+            }
         }
 
-        while (counter < movecount) {
-            assert(treewalk != NULL);
-            assert(treewalk->get_state() != NULL);
-            if (treewalk->get_state()->board.get_boardsize() != 19)
-                break;
+        bool has_next_moves = counter + 2 < tree_moves.size();
+        if (!has_next_moves) {
+            return;
+        }
 
-            KoState * state = treewalk->get_state();
-            int tomove = state->get_to_move();
-            int move;
+        has_next_moves  = tree_moves[counter + 1] != FastBoard::PASS;
+        has_next_moves &= tree_moves[counter + 2] != FastBoard::PASS;
 
-            if (treewalk->get_child(0) != NULL) {
-                move = treewalk->get_child(0)->get_move(tomove);
-                if (move == SGFTree::EOT) {
-                    break;
-                }
-            } else {
-                break;
-            }
+        if (!has_next_moves) {
+            return;
+        }
 
-            assert(move == tree_moves[counter]);
-            int this_move = -1;
-
-            std::vector<int> moves = state->generate_moves(tomove);
-            bool moveseen = false;
-            for(auto it = moves.begin(); it != moves.end(); ++it) {
-                if (*it == move) {
-                    if (move != FastBoard::PASS) {
-                        // get x y coords for actual move
-                        std::pair<int, int> xy = state->board.get_xy(move);
-                        this_move = (xy.second * 19) + xy.first;
-                    }
-                    moveseen = true;
-                }
+        //int skip = Random::get_Rng()->randfix<8>();
+        if (/*skip == 0*/ 1) {
+            if (moveseen && move != FastBoard::PASS && has_next_moves) {
+                TrainPosition position;
+                position.stm_won = (tomove == who_won ? 1.0f : 0.0f);
+                //position.stm_won_tanh = (tomove == who_won ? 1.0f : -1.0f);
+                //float frac = (float)counter / (float)movecount;
+                //position.stm_score = (frac * position.stm_won)
+                    //+ ((1.0f - frac) * 0.5f);
+                //position.stm_score_tanh = (frac * position.stm_won_tanh)
+                    //+ ((1.0f - frac) * 0.0f);
+                //gather_features_value(state, position.planes);
+                position.moves[0] = this_move;
+                // add next 2 moves to position
+                // we do not check them for legality
+                int next_move = tree_moves[counter + 1];
+                int next_next_move = tree_moves[counter + 2];
+                std::pair<int, int> xy = state->board.get_xy(next_move);
+                position.moves[1] = (xy.second * 19) + xy.first;
+                xy = state->board.get_xy(next_next_move);
+                position.moves[2] = (xy.second * 19) + xy.first;
+                gather_features_policy(state, position.planes);
+                data.push_back(position);
+            } else if (move != FastBoard::PASS) {
+                myprintf("Mainline move not found: %d\n", move);
+                return;
             }
+        }
 
-            bool has_next_moves = counter + 2 < tree_moves.size();
-            if (!has_next_moves) {
-                goto skipnext;
-            }
+        counter++;
+        treewalk = treewalk->get_child(0);
+    }
+}
 
-            has_next_moves  = tree_moves[counter + 1] != FastBoard::PASS;
-            has_next_moves &= tree_moves[counter + 2] != FastBoard::PASS;
+void Network::gather_traindata(std::string filename, TrainVector& data) {
+    // Shuffle through a window of games instead of loading them all
+    SGFStream games(filename);
+    games.set_shuffle(20000);
+    std::vector<std::string> batch;
+    int gamecount = 0;
+    Time start;
 
-            if (!has_next_moves) {
-                goto skipnext;
-            }
+    size_t train_pos = 0;
+    size_t test_pos = 0;
 
-            //int skip = Random::get_Rng()->randfix<8>();
-            if (/*skip == 0*/ 1) {
-                if (moveseen && move != FastBoard::PASS && has_next_moves) {
-                    TrainPosition position;
-                    //position.stm_won = (tomove == who_won ? 1.0f : 0.0f);
-                    //position.stm_won_tanh = (tomove == who_won ? 1.0f : -1.0f);
-                    //float frac = (float)counter / (float)movecount;
-                    //position.stm_score = (frac * position.stm_won)
-                        //+ ((1.0f - frac) * 0.5f);
-                    //position.stm_score_tanh = (frac * position.stm_won_tanh)
-                        //+ ((1.0f - frac) * 0.0f);
-                    //gather_features_value(state, position.planes);
-                    position.moves[0] = this_move;
-                    // add next 2 moves to position
-                    // we do not check them for legality
-                    int next_move = tree_moves[counter + 1];
-                    int next_next_move = tree_moves[counter + 2];
-                    std::pair<int, int> xy = state->board.get_xy(next_move);
-                    position.moves[1] = (xy.second * 19) + xy.first;
-                    xy = state->board.get_xy(next_next_move);
-                    position.moves[2] = (xy.second * 19) + xy.first;
-                    gather_features_policy(state, position.planes);
-                    data.push_back(position);
-                } else if (move != FastBoard::PASS) {
-                    myprintf("Mainline move not found: %d\n", move);
-                    goto skipnext;
-                }
+    // Every 50th game goes to the test set
+    TrainDataWriter train_out("leela_train.bin");
+    TrainDataWriter test_out("leela_test.bin");
+
+    myprintf("Reading games from %d file(s)\n", games.get_file_count());
+
+    // The Caffe databases are written every 50000 games, a whole
+    // number of batches
+    while (games.next_batch(batch, 250)) {
+        // Games are independent, append them in stream order afterwards
+        std::vector<TrainVector> found(batch.size());
+        thread_pool.parallel_for(0, batch.size(), [&batch, &found](int i) {
+            gather_game_traindata(batch[i], found[i]);
+        });
+        for (auto & game : found) {
+            auto & out = (gamecount % 50 == 0) ? test_out : train_out;
+            for (auto & position : game) {
+                out.add(position);
             }
-
-            counter++;
-            treewalk = treewalk->get_child(0);
+#ifdef USE_CAFFE
+            // Only the Caffe databases need them all in memory
+            std::move(game.begin(), game.end(), std::back_inserter(data));
+#endif
+            gamecount++;
         }
 
-skipnext:
-        gamecount++;
-        if (gamecount % 100 == 0) {
-            myprintf("Game %d, %d new positions, %d total\n",
-                     gamecount, data.size(), train_pos + data.size());
-        }
+        int elapsed = std::max(1, Time::timediff(start, Time()));
+        myprintf("Game %d, %d positions, %d games/s\n",
+                 gamecount, train_out.get_positions() + test_out.get_positions(),
+                 gamecount * 100 / elapsed);
         if (gamecount % (50000) == 0) {
             train_network(data, train_pos, test_pos);
         }
     }
 
     train_network(data, train_pos, test_pos);
+    train_out.close();
+    test_out.close();
 
-    std::cout << train_pos << " training positions." << std::endl;
-    std::cout << test_pos << " testing positions." << std::endl;
+    std::cout << train_out.get_positions() << " training positions." << std::endl;
+    std::cout << test_out.get_positions() << " testing positions." << std::endl;
 
     myprintf("Gathering pass done.\n");
 }
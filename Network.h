@@ -8,9 +8,9 @@
 #include <bitset>
 #include <memory>
 #include <array>
+#include <atomic>
 
 #ifdef USE_OPENCL
-#include <atomic>
 class UCTNode;
 #endif
 #ifdef USE_CAFFE
@@ -32,7 +32,7 @@ public:
         NNPlanes planes;
         PredMoves moves;
         //float stm_score;
-        //float stm_won;
+        float stm_won;
         //float stm_score_tanh;
         //float stm_won_tanh;
     };
@@ -56,6 +56,7 @@ public:
 
 #ifdef USE_OPENCL
     void async_scored_moves(std::atomic<int> * nodecount,
+                            std::atomic<int> * pending,
                             FastState * state, UCTNode * node,
                             Ensemble ensemble, int rotation = -1);
 #endif
@@ -69,6 +70,10 @@ public:
     static int rev_rotate_nn_idx(const int vertex, int symmetry);
     static void softmax(std::vector<float>& input, std::vector<float>& output,
                         float temperature = 1.0f);
+    // Network evaluations since the program started
+    static uint64 get_eval_count() {
+        return s_evals.load(std::memory_order_relaxed);
+    }
 
 private:
 #ifdef USE_CAFFE
@@ -80,11 +85,14 @@ private:
     static float get_value_internal(
       FastState * state, NNPlanes & planes, int rotation);
     void gather_traindata(std::string filename, TrainVector& tv);
+    static void gather_game_traindata(const std::string & gamebuff,
+                                      TrainVector & tv);
     void train_network(TrainVector& tv, size_t&, size_t&);
     static void gather_features_policy(FastState * state, NNPlanes & planes,
                                        BoardPlane** ladder = nullptr);
     static void gather_features_value(FastState * state, NNPlanes & planes);
     static Network* s_Net;
+    static std::atomic<uint64> s_evals;
 };
 
 #endif
@@ -1,23520 +0,0 @@
-constexpr std::array<int, NUM_PATTERNS> PolicyWeights::live_patterns{
-    0,
-    1,
-    4,
-    5,
-    17,
-    21,
-    68,
-    69,
-    80,
-    81,
-    84,
-    85,
-    320,
-    321,
-    324,
-    325,
-    337,
-    341,
-    1040,
-    1041,
-    1044,
-    1045,
-    1108,
-    1109,
-    1281,
-    1284,
-    1285,
-    1297,
-    1300,
-    1301,
-    1345,
-    1348,
-    1349,
-    1360,
-    1361,
-    1364,
-    1365,
-    4420,
-    4421,
-    4433,
-    4437,
-    5393,
-    5397,
-    5460,
-    5461,
-    17425,
-    17429,
-    17493,
-    17745,
-    17749,
-    21845,
-    65540,
-    65541,
-    65553,
-    65557,
-    65604,
-    65616,
-    65617,
-    65620,
-    65856,
-    65857,
-    65860,
-    65873,
-    66564,
-    66565,
-    66577,
-    66580,
-    66581,
-    66628,
-    66640,
-    66641,
-    66644,
-    66817,
-    66820,
-    66821,
-    66833,
-    66880,
-    66881,
-    66884,
-    66896,
-    66897,
-    69636,
-    69637,
-    69649,
-    69653,
-    69700,
-    69712,
-    69713,
-    69716,
-    69952,
-    69953,
-    69956,
-    69969,
-    70660,
-    70661,
-    70673,
-    70676,
-    70677,
-    70724,
-    70736,
-    70737,
-    70740,
-    70913,
-    70916,
-    70917,
-    70929,
-    70976,
-    70977,
-    70980,
-    70992,
-    70993,
-    82948,
-    82949,
-    82961,
-    82965,
-    83012,
-    83024,
-    83025,
-    83028,
-    83264,
-    83265,
-    83268,
-    83281,
-    87044,
-    87045,
-    87057,
-    87061,
-    87108,
-    87120,
-    87121,
-    87124,
-    87360,
-    87361,
-    87364,
-    87377,
-    131076,
-    131077,
-    131089,
-    131093,
-    131140,
-    131152,
-    131153,
-    131156,
-    131392,
-    131393,
-    131396,
-    131409,
-    132100,
-    132101,
-    132113,
-    132116,
-    132117,
-    132164,
-    132176,
-    132177,
-    132180,
-    132353,
-    132356,
-    132357,
-    132369,
-    132416,
-    132417,
-    132420,
-    132432,
-    132433,
-    135172,
-    135173,
-    135185,
-    135189,
-    135236,
-    135248,
-    135249,
-    135252,
-    135488,
-    135489,
-    135492,
-    135505,
-    136196,
-    136197,
-    136209,
-    136212,
-    136213,
-    136260,
-    136272,
-    136273,
-    136276,
-    136449,
-    136452,
-    136453,
-    136465,
-    136512,
-    136513,
-    136516,
-    136528,
-    136529,
-    148484,
-    148485,
-    148497,
-    148501,
-    148548,
-    148560,
-    148561,
-    148564,
-    148800,
-    148801,
-    148804,
-    148817,
-    152580,
-    152581,
-    152593,
-    152597,
-    152644,
-    152656,
-    152657,
-    152660,
-    152896,
-    152897,
-    152900,
-    152913,
-    196612,
-    196613,
-    196625,
-    196629,
-    196633,
-    196671,
-    196676,
-    196688,
-    196689,
-    196692,
-    196696,
-    196735,
-    196928,
-    196929,
-    196932,
-    196936,
-    196945,
-    196991,
-    197636,
-    197637,
-    197649,
-    197652,
-    197653,
-    197657,
-    197695,
-    197700,
-    197712,
-    197713,
-    197716,
-    197720,
-    197759,
-    197889,
-    197892,
-    197893,
-    197897,
-    197905,
-    197951,
-    197952,
-    197953,
-    197956,
-    197960,
-    197968,
-    197969,
-    198015,
-    200708,
-    200709,
-    200721,
-    200725,
-    200729,
-    200767,
-    200772,
-    200784,
-    200785,
-    200788,
-    200792,
-    200831,
-    201024,
-    201025,
-    201028,
-    201032,
-    201041,
-    201087,
-    201732,
-    201733,
-    201745,
-    201748,
-    201749,
-    201753,
-    201791,
-    201796,
-    201808,
-    201809,
-    201812,
-    201816,
-    201855,
-    201985,
-    201988,
-    201989,
-    201993,
-    202001,
-    202047,
-    202048,
-    202049,
-    202052,
-    202056,
-    202064,
-    202065,
-    202111,
-    214020,
-    214021,
-    214033,
-    214037,
-    214041,
-    214079,
-    214084,
-    214096,
-    214097,
-    214100,
-    214104,
-    214143,
-    214336,
-    214337,
-    214340,
-    214344,
-    214353,
-    214399,
-    218116,
-    218117,
-    218129,
-    218133,
-    218137,
-    218175,
-    218180,
-    218192,
-    218193,
-    218196,
-    218200,
-    218239,
-    218432,
-    218433,
-    218436,
-    218440,
-    218449,
-    218495,
-    327748,
-    327749,
-    327750,
-    327760,
-    327761,
-    327762,
-    327764,
-    327765,
-    327766,
-    328000,
-    328001,
-    328002,
-    328004,
-    328005,
-    328006,
-    328016,
-    328017,
-    328018,
-    328720,
-    328721,
-    328722,
-    328724,
-    328725,
-    328726,
-    328788,
-    328789,
-    328790,
-    328960,
-    328961,
-    328962,
-    328964,
-    328965,
-    328966,
-    328976,
-    328977,
-    328978,
-    329024,
-    329025,
-    329026,
-    329028,
-    329029,
-    329030,
-    329040,
-    329041,
-    329042,
-    332032,
-    332033,
-    332034,
-    332036,
-    332037,
-    332038,
-    332048,
-    332049,
-    332050,
-    332100,
-    332101,
-    332102,
-    332112,
-    332113,
-    332114,
-    333072,
-    333073,
-    333074,
-    344132,
-    344133,
-    344134,
-    344144,
-    344145,
-    344146,
-    344148,
-    344149,
-    344150,
-    344384,
-    344385,
-    344386,
-    344388,
-    344389,
-    344390,
-    344400,
-    344401,
-    344402,
-    345104,
-    345105,
-    345106,
-    345108,
-    345109,
-    345110,
-    345172,
-    345173,
-    345174,
-    345344,
-    345345,
-    345346,
-    345348,
-    345349,
-    345350,
-    345360,
-    345361,
-    345362,
-    345408,
-    345409,
-    345410,
-    345412,
-    345413,
-    345414,
-    345424,
-    345425,
-    345426,
-    348416,
-    348417,
-    348418,
-    348420,
-    348421,
-    348422,
-    348432,
-    348433,
-    348434,
-    348484,
-    348485,
-    348486,
-    348496,
-    348497,
-    348498,
-    349456,
-    349457,
-    349458,
-    393284,
-    393286,
-    393296,
-    393297,
-    393298,
-    393300,
-    393302,
-    393536,
-    393537,
-    393538,
-    393540,
-    393542,
-    393552,
-    393553,
-    393554,
-    394244,
-    394245,
-    394246,
-    394257,
-    394258,
-    394260,
-    394261,
-    394262,
-    394308,
-    394310,
-    394320,
-    394321,
-    394322,
-    394324,
-    394326,
-    394497,
-    394498,
-    394500,
-    394501,
-    394502,
-    394513,
-    394514,
-    394560,
-    394561,
-    394562,
-    394564,
-    394566,
-    394576,
-    394577,
-    394578,
-    397316,
-    397317,
-    397318,
-    397329,
-    397330,
-    397332,
-    397333,
-    397334,
-    397380,
-    397382,
-    397392,
-    397393,
-    397394,
-    397396,
-    397398,
-    397569,
-    397570,
-    397572,
-    397573,
-    397574,
-    397585,
-    397586,
-    397632,
-    397633,
-    397634,
-    397636,
-    397638,
-    397648,
-    397649,
-    397650,
-    398340,
-    398341,
-    398342,
-    398353,
-    398354,
-    398356,
-    398357,
-    398358,
-    398593,
-    398594,
-    398596,
-    398597,
-    398598,
-    398609,
-    398610,
-    409668,
-    409670,
-    409680,
-    409681,
-    409682,
-    409684,
-    409686,
-    409920,
-    409921,
-    409922,
-    409924,
-    409926,
-    409936,
-    409937,
-    409938,
-    410628,
-    410629,
-    410630,
-    410641,
-    410642,
-    410644,
-    410645,
-    410646,
-    410692,
-    410694,
-    410704,
-    410705,
-    410706,
-    410708,
-    410710,
-    410881,
-    410882,
-    410884,
-    410885,
-    410886,
-    410897,
-    410898,
-    410944,
-    410945,
-    410946,
-    410948,
-    410950,
-    410960,
-    410961,
-    410962,
-    413700,
-    413701,
-    413702,
-    413713,
-    413714,
-    413716,
-    413717,
-    413718,
-    413764,
-    413766,
-    413776,
-    413777,
-    413778,
-    413780,
-    413782,
-    413953,
-    413954,
-    413956,
-    413957,
-    413958,
-    413969,
-    413970,
-    414016,
-    414017,
-    414018,
-    414020,
-    414022,
-    414032,
-    414033,
-    414034,
-    414724,
-    414725,
-    414726,
-    414737,
-    414738,
-    414740,
-    414741,
-    414742,
-    414977,
-    414978,
-    414980,
-    414981,
-    414982,
-    414993,
-    414994,
-    458820,
-    458822,
-    458832,
-    458833,
-    458834,
-    458836,
-    458838,
-    458840,
-    458841,
-    458842,
-    458879,
-    459072,
-    459073,
-    459074,
-    459076,
-    459078,
-    459080,
-    459081,
-    459082,
-    459088,
-    459089,
-    459090,
-    459135,
-    459780,
-    459781,
-    459782,
-    459793,
-    459794,
-    459796,
-    459797,
-    459798,
-    459800,
-    459801,
-    459802,
-    459839,
-    459844,
-    459846,
-    459856,
-    459857,
-    459858,
-    459860,
-    459862,
-    459864,
-    459865,
-    459866,
-    459903,
-    460033,
-    460034,
-    460036,
-    460037,
-    460038,
-    460040,
-    460041,
-    460042,
-    460049,
-    460050,
-    460095,
-    460096,
-    460097,
-    460098,
-    460100,
-    460102,
-    460104,
-    460105,
-    460106,
-    460112,
-    460113,
-    460114,
-    460159,
-    462852,
-    462853,
-    462854,
-    462865,
-    462866,
-    462868,
-    462869,
-    462870,
-    462872,
-    462873,
-    462874,
-    462911,
-    462916,
-    462918,
-    462928,
-    462929,
-    462930,
-    462932,
-    462934,
-    462936,
-    462937,
-    462938,
-    462975,
-    463105,
-    463106,
-    463108,
-    463109,
-    463110,
-    463112,
-    463113,
-    463114,
-    463121,
-    463122,
-    463167,
-    463168,
-    463169,
-    463170,
-    463172,
-    463174,
-    463176,
-    463177,
-    463178,
-    463184,
-    463185,
-    463186,
-    463231,
-    463876,
-    463877,
-    463878,
-    463889,
-    463890,
-    463892,
-    463893,
-    463894,
-    463896,
-    463897,
-    463898,
-    463935,
-    464129,
-    464130,
-    464132,
-    464133,
-    464134,
-    464136,
-    464137,
-    464138,
-    464145,
-    464146,
-    464191,
-    475204,
-    475206,
-    475216,
-    475217,
-    475218,
-    475220,
-    475222,
-    475224,
-    475225,
-    475226,
-    475263,
-    475456,
-    475457,
-    475458,
-    475460,
-    475462,
-    475464,
-    475465,
-    475466,
-    475472,
-    475473,
-    475474,
-    475519,
-    476164,
-    476165,
-    476166,
-    476177,
-    476178,
-    476180,
-    476181,
-    476182,
-    476184,
-    476185,
-    476186,
-    476223,
-    476228,
-    476230,
-    476240,
-    476241,
-    476242,
-    476244,
-    476246,
-    476248,
-    476249,
-    476250,
-    476287,
-    476417,
-    476418,
-    476420,
-    476421,
-    476422,
-    476424,
-    476425,
-    476426,
-    476433,
-    476434,
-    476479,
-    476480,
-    476481,
-    476482,
-    476484,
-    476486,
-    476488,
-    476489,
-    476490,
-    476496,
-    476497,
-    476498,
-    476543,
-    479236,
-    479237,
-    479238,
-    479249,
-    479250,
-    479252,
-    479253,
-    479254,
-    479256,
-    479257,
-    479258,
-    479295,
-    479300,
-    479302,
-    479312,
-    479313,
-    479314,
-    479316,
-    479318,
-    479320,
-    479321,
-    479322,
-    479359,
-    479489,
-    479490,
-    479492,
-    479493,
-    479494,
-    479496,
-    479497,
-    479498,
-    479505,
-    479506,
-    479551,
-    479552,
-    479553,
-    479554,
-    479556,
-    479558,
-    479560,
-    479561,
-    479562,
-    479568,
-    479569,
-    479570,
-    479615,
-    480260,
-    480261,
-    480262,
-    480273,
-    480274,
-    480276,
-    480277,
-    480278,
-    480280,
-    480281,
-    480282,
-    480319,
-    480513,
-    480514,
-    480516,
-    480517,
-    480518,
-    480520,
-    480521,
-    480522,
-    480529,
-    480530,
-    480575,
-    655428,
-    655429,
-    655430,
-    655440,
-    655441,
-    655442,
-    655444,
-    655445,
-    655446,
-    655680,
-    655681,
-    655682,
-    655684,
-    655685,
-    655686,
-    655696,
-    655697,
-    655698,
-    656400,
-    656401,
-    656402,
-    656404,
-    656405,
-    656406,
-    656468,
-    656469,
-    656470,
-    656640,
-    656641,
-    656642,
-    656644,
-    656645,
-    656646,
-    656656,
-    656657,
-    656658,
-    656704,
-    656705,
-    656706,
-    656708,
-    656709,
-    656710,
-    656720,
-    656721,
-    656722,
-    659712,
-    659713,
-    659714,
-    659716,
-    659717,
-    659718,
-    659728,
-    659729,
-    659730,
-    659780,
-    659781,
-    659782,
-    659792,
-    659793,
-    659794,
-    660752,
-    660753,
-    660754,
-    671812,
-    671813,
-    671814,
-    671824,
-    671825,
-    671826,
-    671828,
-    671829,
-    671830,
-    672064,
-    672065,
-    672066,
-    672068,
-    672069,
-    672070,
-    672080,
-    672081,
-    672082,
-    672784,
-    672785,
-    672786,
-    672788,
-    672789,
-    672790,
-    672852,
-    672853,
-    672854,
-    673024,
-    673025,
-    673026,
-    673028,
-    673029,
-    673030,
-    673040,
-    673041,
-    673042,
-    673088,
-    673089,
-    673090,
-    673092,
-    673093,
-    673094,
-    673104,
-    673105,
-    673106,
-    676096,
-    676097,
-    676098,
-    676100,
-    676101,
-    676102,
-    676112,
-    676113,
-    676114,
-    676164,
-    676165,
-    676166,
-    676176,
-    676177,
-    676178,
-    677136,
-    677137,
-    677138,
-    720964,
-    720966,
-    720976,
-    720977,
-    720978,
-    720980,
-    720982,
-    720984,
-    720985,
-    720986,
-    721023,
-    721216,
-    721217,
-    721218,
-    721220,
-    721222,
-    721224,
-    721225,
-    721226,
-    721232,
-    721233,
-    721234,
-    721279,
-    721924,
-    721925,
-    721926,
-    721937,
-    721938,
-    721940,
-    721941,
-    721942,
-    721944,
-    721945,
-    721946,
-    721983,
-    721988,
-    721990,
-    722000,
-    722001,
-    722002,
-    722004,
-    722006,
-    722008,
-    722009,
-    722010,
-    722047,
-    722177,
-    722178,
-    722180,
-    722181,
-    722182,
-    722184,
-    722185,
-    722186,
-    722193,
-    722194,
-    722239,
-    722240,
-    722241,
-    722242,
-    722244,
-    722246,
-    722248,
-    722249,
-    722250,
-    722256,
-    722257,
-    722258,
-    722303,
-    724996,
-    724997,
-    724998,
-    725009,
-    725010,
-    725012,
-    725013,
-    725014,
-    725016,
-    725017,
-    725018,
-    725055,
-    725060,
-    725062,
-    725072,
-    725073,
-    725074,
-    725076,
-    725078,
-    725080,
-    725081,
-    725082,
-    725119,
-    725249,
-    725250,
-    725252,
-    725253,
-    725254,
-    725256,
-    725257,
-    725258,
-    725265,
-    725266,
-    725311,
-    725312,
-    725313,
-    725314,
-    725316,
-    725318,
-    725320,
-    725321,
-    725322,
-    725328,
-    725329,
-    725330,
-    725375,
-    726020,
-    726021,
-    726022,
-    726033,
-    726034,
-    726036,
-    726037,
-    726038,
-    726040,
-    726041,
-    726042,
-    726079,
-    726273,
-    726274,
-    726276,
-    726277,
-    726278,
-    726280,
-    726281,
-    726282,
-    726289,
-    726290,
-    726335,
-    737348,
-    737350,
-    737360,
-    737361,
-    737362,
-    737364,
-    737366,
-    737368,
-    737369,
-    737370,
-    737407,
-    737600,
-    737601,
-    737602,
-    737604,
-    737606,
-    737608,
-    737609,
-    737610,
-    737616,
-    737617,
-    737618,
-    737663,
-    738308,
-    738309,
-    738310,
-    738321,
-    738322,
-    738324,
-    738325,
-    738326,
-    738328,
-    738329,
-    738330,
-    738367,
-    738372,
-    738374,
-    738384,
-    738385,
-    738386,
-    738388,
-    738390,
-    738392,
-    738393,
-    738394,
-    738431,
-    738561,
-    738562,
-    738564,
-    738565,
-    738566,
-    738568,
-    738569,
-    738570,
-    738577,
-    738578,
-    738623,
-    738624,
-    738625,
-    738626,
-    738628,
-    738630,
-    738632,
-    738633,
-    738634,
-    738640,
-    738641,
-    738642,
-    738687,
-    741380,
-    741381,
-    741382,
-    741393,
-    741394,
-    741396,
-    741397,
-    741398,
-    741400,
-    741401,
-    741402,
-    741439,
-    741444,
-    741446,
-    741456,
-    741457,
-    741458,
-    741460,
-    741462,
-    741464,
-    741465,
-    741466,
-    741503,
-    741633,
-    741634,
-    741636,
-    741637,
-    741638,
-    741640,
-    741641,
-    741642,
-    741649,
-    741650,
-    741695,
-    741696,
-    741697,
-    741698,
-    741700,
-    741702,
-    741704,
-    741705,
-    741706,
-    741712,
-    741713,
-    741714,
-    741759,
-    742404,
-    742405,
-    742406,
-    742417,
-    742418,
-    742420,
-    742421,
-    742422,
-    742424,
-    742425,
-    742426,
-    742463,
-    742657,
-    742658,
-    742660,
-    742661,
-    742662,
-    742664,
-    742665,
-    742666,
-    742673,
-    742674,
-    742719,
-    983108,
-    983109,
-    983110,
-    983120,
-    983121,
-    983122,
-    983124,
-    983125,
-    983126,
-    983128,
-    983129,
-    983130,
-    983167,
-    983360,
-    983361,
-    983362,
-    983364,
-    983365,
-    983366,
-    983368,
-    983369,
-    983370,
-    983376,
-    983377,
-    983378,
-    983423,
-    984080,
-    984081,
-    984082,
-    984084,
-    984085,
-    984086,
-    984088,
-    984089,
-    984090,
-    984127,
-    984148,
-    984149,
-    984150,
-    984152,
-    984153,
-    984154,
-    984191,
-    984216,
-    984217,
-    984218,
-    984255,
-    984320,
-    984321,
-    984322,
-    984324,
-    984325,
-    984326,
-    984328,
-    984329,
-    984330,
-    984336,
-    984337,
-    984338,
-    984383,
-    984384,
-    984385,
-    984386,
-    984388,
-    984389,
-    984390,
-    984392,
-    984393,
-    984394,
-    984400,
-    984401,
-    984402,
-    984447,
-    984448,
-    984449,
-    984450,
-    984452,
-    984453,
-    984454,
-    984456,
-    984457,
-    984458,
-    984464,
-    984465,
-    984466,
-    984511,
-    986367,
-    986563,
-    986567,
-    986571,
-    986579,
-    986623,
-    987392,
-    987393,
-    987394,
-    987396,
-    987397,
-    987398,
-    987400,
-    987401,
-    987402,
-    987408,
-    987409,
-    987410,
-    987455,
-    987460,
-    987461,
-    987462,
-    987464,
-    987465,
-    987466,
-    987472,
-    987473,
-    987474,
-    987519,
-    987528,
-    987529,
-    987530,
-    987536,
-    987537,
-    987538,
-    987583,
-    988432,
-    988433,
-    988434,
-    988479,
-    990719,
-    999492,
-    999493,
-    999494,
-    999504,
-    999505,
-    999506,
-    999508,
-    999509,
-    999510,
-    999512,
-    999513,
-    999514,
-    999551,
-    999744,
-    999745,
-    999746,
-    999748,
-    999749,
-    999750,
-    999752,
-    999753,
-    999754,
-    999760,
-    999761,
-    999762,
-    999807,
-    1000464,
-    1000465,
-    1000466,
-    1000468,
-    1000469,
-    1000470,
-    1000472,
-    1000473,
-    1000474,
-    1000511,
-    1000532,
-    1000533,
-    1000534,
-    1000536,
-    1000537,
-    1000538,
-    1000575,
-    1000600,
-    1000601,
-    1000602,
-    1000639,
-    1000704,
-    1000705,
-    1000706,
-    1000708,
-    1000709,
-    1000710,
-    1000712,
-    1000713,
-    1000714,
-    1000720,
-    1000721,
-    1000722,
-    1000767,
-    1000768,
-    1000769,
-    1000770,
-    1000772,
-    1000773,
-    1000774,
-    1000776,
-    1000777,
-    1000778,
-    1000784,
-    1000785,
-    1000786,
-    1000831,
-    1000832,
-    1000833,
-    1000834,
-    1000836,
-    1000837,
-    1000838,
-    1000840,
-    1000841,
-    1000842,
-    1000848,
-    1000849,
-    1000850,
-    1000895,
-    1002751,
-    1002947,
-    1002951,
-    1002955,
-    1002963,
-    1003007,
-    1003776,
-    1003777,
-    1003778,
-    1003780,
-    1003781,
-    1003782,
-    1003784,
-    1003785,
-    1003786,
-    1003792,
-    1003793,
-    1003794,
-    1003839,
-    1003844,
-    1003845,
-    1003846,
-    1003848,
-    1003849,
-    1003850,
-    1003856,
-    1003857,
-    1003858,
-    1003903,
-    1003912,
-    1003913,
-    1003914,
-    1003920,
-    1003921,
-    1003922,
-    1003967,
-    1004816,
-    1004817,
-    1004818,
-    1004863,
-    1007103,
-    1311040,
-    1311041,
-    1311044,
-    1311057,
-    1312001,
-    1312004,
-    1312005,
-    1312017,
-    1312065,
-    1312068,
-    1312080,
-    1312081,
-    1314820,
-    1314821,
-    1314833,
-    1314837,
-    1314884,
-    1314897,
-    1314900,
-    1315140,
-    1315153,
-    1315845,
-    1315857,
-    1315860,
-    1315861,
-    1316101,
-    1316113,
-    1328145,
-    1328149,
-    1328209,
-    1328465,
-    1332245,
-    1376576,
-    1376577,
-    1376578,
-    1376580,
-    1376581,
-    1376582,
-    1376593,
-    1376594,
-    1376597,
-    1376598,
-    1377536,
-    1377537,
-    1377538,
-    1377540,
-    1377541,
-    1377542,
-    1377552,
-    1377553,
-    1377554,
-    1377556,
-    1377557,
-    1377558,
-    1377568,
-    1377569,
-    1377572,
-    1377573,
-    1377600,
-    1377601,
-    1377602,
-    1377604,
-    1377605,
-    1377606,
-    1377616,
-    1377617,
-    1377618,
-    1377620,
-    1377621,
-    1377622,
-    1377632,
-    1377633,
-    1377636,
-    1377637,
-    1380352,
-    1380353,
-    1380354,
-    1380356,
-    1380357,
-    1380358,
-    1380369,
-    1380370,
-    1380373,
-    1380374,
-    1380416,
-    1380417,
-    1380418,
-    1380420,
-    1380421,
-    1380422,
-    1380432,
-    1380433,
-    1380434,
-    1380436,
-    1380437,
-    1380438,
-    1380448,
-    1380449,
-    1380452,
-    1380453,
-    1380672,
-    1380673,
-    1380674,
-    1380676,
-    1380677,
-    1380678,
-    1380689,
-    1380690,
-    1380693,
-    1380694,
-    1381376,
-    1381377,
-    1381378,
-    1381380,
-    1381381,
-    1381382,
-    1381392,
-    1381393,
-    1381394,
-    1381396,
-    1381397,
-    1381398,
-    1381408,
-    1381409,
-    1381412,
-    1381413,
-    1381632,
-    1381633,
-    1381634,
-    1381636,
-    1381637,
-    1381638,
-    1381648,
-    1381649,
-    1381650,
-    1381652,
-    1381653,
-    1381654,
-    1381664,
-    1381665,
-    1381668,
-    1381669,
-    1393664,
-    1393665,
-    1393666,
-    1393668,
-    1393669,
-    1393670,
-    1393681,
-    1393682,
-    1393685,
-    1393686,
-    1393728,
-    1393729,
-    1393730,
-    1393732,
-    1393733,
-    1393734,
-    1393744,
-    1393745,
-    1393746,
-    1393748,
-    1393749,
-    1393750,
-    1393760,
-    1393761,
-    1393764,
-    1393765,
-    1393984,
-    1393985,
-    1393986,
-    1393988,
-    1393989,
-    1393990,
-    1394001,
-    1394002,
-    1394005,
-    1394006,
-    1397760,
-    1397761,
-    1397762,
-    1397764,
-    1397765,
-    1397766,
-    1397777,
-    1397778,
-    1397781,
-    1397782,
-    1442112,
-    1442113,
-    1442114,
-    1442116,
-    1442118,
-    1442129,
-    1442130,
-    1442146,
-    1442150,
-    1443073,
-    1443074,
-    1443076,
-    1443077,
-    1443078,
-    1443089,
-    1443090,
-    1443105,
-    1443106,
-    1443108,
-    1443109,
-    1443110,
-    1443136,
-    1443137,
-    1443138,
-    1443140,
-    1443142,
-    1443152,
-    1443153,
-    1443154,
-    1443168,
-    1443169,
-    1443170,
-    1443172,
-    1443174,
-    1445892,
-    1445893,
-    1445894,
-    1445905,
-    1445906,
-    1445909,
-    1445910,
-    1445922,
-    1445926,
-    1445956,
-    1445958,
-    1445968,
-    1445969,
-    1445970,
-    1445972,
-    1445974,
-    1445984,
-    1445985,
-    1445986,
-    1445988,
-    1445990,
-    1446208,
-    1446209,
-    1446210,
-    1446212,
-    1446214,
-    1446225,
-    1446226,
-    1446242,
-    1446246,
-    1446916,
-    1446917,
-    1446918,
-    1446929,
-    1446930,
-    1446932,
-    1446933,
-    1446934,
-    1446945,
-    1446946,
-    1446948,
-    1446949,
-    1446950,
-    1447169,
-    1447170,
-    1447172,
-    1447173,
-    1447174,
-    1447185,
-    1447186,
-    1447201,
-    1447202,
-    1447204,
-    1447205,
-    1447206,
-    1459204,
-    1459205,
-    1459206,
-    1459217,
-    1459218,
-    1459221,
-    1459222,
-    1459234,
-    1459238,
-    1459268,
-    1459270,
-    1459280,
-    1459281,
-    1459282,
-    1459284,
-    1459286,
-    1459296,
-    1459297,
-    1459298,
-    1459300,
-    1459302,
-    1459520,
-    1459521,
-    1459522,
-    1459524,
-    1459526,
-    1459537,
-    1459538,
-    1459554,
-    1459558,
-    1463300,
-    1463301,
-    1463302,
-    1463313,
-    1463314,
-    1463317,
-    1463318,
-    1463330,
-    1463334,
-    1507648,
-    1507649,
-    1507650,
-    1507652,
-    1507654,
-    1507656,
-    1507657,
-    1507658,
-    1507665,
-    1507666,
-    1507673,
-    1507674,
-    1507682,
-    1507686,
-    1507690,
-    1507711,
-    1508609,
-    1508610,
-    1508612,
-    1508613,
-    1508614,
-    1508616,
-    1508617,
-    1508618,
-    1508625,
-    1508626,
-    1508632,
-    1508633,
-    1508634,
-    1508641,
-    1508642,
-    1508644,
-    1508645,
-    1508646,
-    1508648,
-    1508649,
-    1508650,
-    1508671,
-    1508672,
-    1508673,
-    1508674,
-    1508676,
-    1508678,
-    1508680,
-    1508681,
-    1508682,
-    1508688,
-    1508689,
-    1508690,
-    1508696,
-    1508697,
-    1508698,
-    1508704,
-    1508705,
-    1508706,
-    1508708,
-    1508710,
-    1508712,
-    1508713,
-    1508714,
-    1508735,
-    1511428,
-    1511429,
-    1511430,
-    1511432,
-    1511433,
-    1511434,
-    1511441,
-    1511442,
-    1511445,
-    1511446,
-    1511449,
-    1511450,
-    1511458,
-    1511462,
-    1511466,
-    1511487,
-    1511492,
-    1511494,
-    1511496,
-    1511497,
-    1511498,
-    1511504,
-    1511505,
-    1511506,
-    1511508,
-    1511510,
-    1511512,
-    1511513,
-    1511514,
-    1511520,
-    1511521,
-    1511522,
-    1511524,
-    1511526,
-    1511528,
-    1511529,
-    1511530,
-    1511551,
-    1511744,
-    1511745,
-    1511746,
-    1511748,
-    1511750,
-    1511752,
-    1511753,
-    1511754,
-    1511761,
-    1511762,
-    1511769,
-    1511770,
-    1511778,
-    1511782,
-    1511786,
-    1511807,
-    1512452,
-    1512453,
-    1512454,
-    1512456,
-    1512457,
-    1512458,
-    1512465,
-    1512466,
-    1512468,
-    1512469,
-    1512470,
-    1512472,
-    1512473,
-    1512474,
-    1512481,
-    1512482,
-    1512484,
-    1512485,
-    1512486,
-    1512488,
-    1512489,
-    1512490,
-    1512511,
-    1512705,
-    1512706,
-    1512708,
-    1512709,
-    1512710,
-    1512712,
-    1512713,
-    1512714,
-    1512721,
-    1512722,
-    1512728,
-    1512729,
-    1512730,
-    1512737,
-    1512738,
-    1512740,
-    1512741,
-    1512742,
-    1512744,
-    1512745,
-    1512746,
-    1512767,
-    1524740,
-    1524741,
-    1524742,
-    1524744,
-    1524745,
-    1524746,
-    1524753,
-    1524754,
-    1524757,
-    1524758,
-    1524761,
-    1524762,
-    1524770,
-    1524774,
-    1524778,
-    1524799,
-    1524804,
-    1524806,
-    1524808,
-    1524809,
-    1524810,
-    1524816,
-    1524817,
-    1524818,
-    1524820,
-    1524822,
-    1524824,
-    1524825,
-    1524826,
-    1524832,
-    1524833,
-    1524834,
-    1524836,
-    1524838,
-    1524840,
-    1524841,
-    1524842,
-    1524863,
-    1525056,
-    1525057,
-    1525058,
-    1525060,
-    1525062,
-    1525064,
-    1525065,
-    1525066,
-    1525073,
-    1525074,
-    1525081,
-    1525082,
-    1525090,
-    1525094,
-    1525098,
-    1525119,
-    1528836,
-    1528837,
-    1528838,
-    1528840,
-    1528841,
-    1528842,
-    1528849,
-    1528850,
-    1528853,
-    1528854,
-    1528857,
-    1528858,
-    1528866,
-    1528870,
-    1528874,
-    1528895,
-    1573184,
-    1573185,
-    1573188,
-    1573200,
-    1573201,
-    1574145,
-    1574148,
-    1574149,
-    1574161,
-    1574209,
-    1574212,
-    1574224,
-    1574225,
-    1576964,
-    1576965,
-    1576977,
-    1576980,
-    1576981,
-    1577028,
-    1577040,
-    1577041,
-    1577044,
-    1577220,
-    1577221,
-    1577233,
-    1577284,
-    1577296,
-    1577297,
-    1577989,
-    1578001,
-    1578004,
-    1578005,
-    1578245,
-    1578257,
-    1589328,
-    1589329,
-    1589332,
-    1589584,
-    1589585,
-    1590289,
-    1590292,
-    1590293,
-    1590353,
-    1590356,
-    1590545,
-    1590609,
-    1593364,
-    1593365,
-    1593428,
-    1594389,
-    1638720,
-    1638721,
-    1638722,
-    1638724,
-    1638726,
-    1638736,
-    1638737,
-    1638738,
-    1638740,
-    1638742,
-    1638752,
-    1638753,
-    1638756,
-    1639681,
-    1639682,
-    1639684,
-    1639685,
-    1639686,
-    1639697,
-    1639698,
-    1639700,
-    1639701,
-    1639702,
-    1639713,
-    1639716,
-    1639717,
-    1639744,
-    1639745,
-    1639746,
-    1639748,
-    1639750,
-    1639760,
-    1639761,
-    1639762,
-    1639764,
-    1639766,
-    1639776,
-    1639777,
-    1639780,
-    1642497,
-    1642498,
-    1642500,
-    1642501,
-    1642502,
-    1642513,
-    1642514,
-    1642516,
-    1642517,
-    1642518,
-    1642529,
-    1642532,
-    1642533,
-    1642560,
-    1642561,
-    1642562,
-    1642564,
-    1642566,
-    1642576,
-    1642577,
-    1642578,
-    1642580,
-    1642582,
-    1642592,
-    1642593,
-    1642596,
-    1642753,
-    1642754,
-    1642756,
-    1642757,
-    1642758,
-    1642769,
-    1642770,
-    1642772,
-    1642773,
-    1642774,
-    1642785,
-    1642788,
-    1642789,
-    1642816,
-    1642817,
-    1642818,
-    1642820,
-    1642822,
-    1642832,
-    1642833,
-    1642834,
-    1642836,
-    1642838,
-    1642848,
-    1642849,
-    1642852,
-    1643521,
-    1643522,
-    1643524,
-    1643525,
-    1643526,
-    1643537,
-    1643538,
-    1643540,
-    1643541,
-    1643542,
-    1643553,
-    1643556,
-    1643557,
-    1643777,
-    1643778,
-    1643780,
-    1643781,
-    1643782,
-    1643793,
-    1643794,
-    1643796,
-    1643797,
-    1643798,
-    1643809,
-    1643812,
-    1643813,
-    1654848,
-    1654849,
-    1654850,
-    1654852,
-    1654854,
-    1654864,
-    1654865,
-    1654866,
-    1654868,
-    1654870,
-    1654880,
-    1654881,
-    1654884,
-    1655104,
-    1655105,
-    1655106,
-    1655108,
-    1655110,
-    1655120,
-    1655121,
-    1655122,
-    1655124,
-    1655126,
-    1655136,
-    1655137,
-    1655140,
-    1655809,
-    1655810,
-    1655812,
-    1655813,
-    1655814,
-    1655825,
-    1655826,
-    1655828,
-    1655829,
-    1655830,
-    1655841,
-    1655844,
-    1655845,
-    1655872,
-    1655873,
-    1655874,
-    1655876,
-    1655878,
-    1655888,
-    1655889,
-    1655890,
-    1655892,
-    1655894,
-    1655904,
-    1655905,
-    1655908,
-    1656065,
-    1656066,
-    1656068,
-    1656069,
-    1656070,
-    1656081,
-    1656082,
-    1656084,
-    1656085,
-    1656086,
-    1656097,
-    1656100,
-    1656101,
-    1656128,
-    1656129,
-    1656130,
-    1656132,
-    1656134,
-    1656144,
-    1656145,
-    1656146,
-    1656148,
-    1656150,
-    1656160,
-    1656161,
-    1656164,
-    1658881,
-    1658882,
-    1658884,
-    1658885,
-    1658886,
-    1658897,
-    1658898,
-    1658900,
-    1658901,
-    1658902,
-    1658913,
-    1658916,
-    1658917,
-    1658944,
-    1658945,
-    1658946,
-    1658948,
-    1658950,
-    1658960,
-    1658961,
-    1658962,
-    1658964,
-    1658966,
-    1658976,
-    1658977,
-    1658980,
-    1659905,
-    1659906,
-    1659908,
-    1659909,
-    1659910,
-    1659921,
-    1659922,
-    1659924,
-    1659925,
-    1659926,
-    1659937,
-    1659940,
-    1659941,
-    1704256,
-    1704257,
-    1704258,
-    1704260,
-    1704261,
-    1704262,
-    1704272,
-    1704273,
-    1704274,
-    1704288,
-    1704289,
-    1704290,
-    1704292,
-    1704293,
-    1704294,
-    1705216,
-    1705217,
-    1705218,
-    1705220,
-    1705221,
-    1705222,
-    1705232,
-    1705233,
-    1705234,
-    1705248,
-    1705249,
-    1705250,
-    1705252,
-    1705253,
-    1705254,
-    1705280,
-    1705281,
-    1705282,
-    1705284,
-    1705285,
-    1705286,
-    1705296,
-    1705297,
-    1705298,
-    1705312,
-    1705313,
-    1705314,
-    1705316,
-    1705317,
-    1705318,
-    1708036,
-    1708037,
-    1708038,
-    1708048,
-    1708049,
-    1708050,
-    1708052,
-    1708053,
-    1708054,
-    1708064,
-    1708065,
-    1708066,
-    1708068,
-    1708069,
-    1708070,
-    1708100,
-    1708101,
-    1708102,
-    1708112,
-    1708113,
-    1708114,
-    1708116,
-    1708117,
-    1708118,
-    1708128,
-    1708129,
-    1708130,
-    1708132,
-    1708133,
-    1708134,
-    1708288,
-    1708289,
-    1708290,
-    1708292,
-    1708293,
-    1708294,
-    1708304,
-    1708305,
-    1708306,
-    1708320,
-    1708321,
-    1708322,
-    1708324,
-    1708325,
-    1708326,
-    1708352,
-    1708353,
-    1708354,
-    1708356,
-    1708357,
-    1708358,
-    1708368,
-    1708369,
-    1708370,
-    1708384,
-    1708385,
-    1708386,
-    1708388,
-    1708389,
-    1708390,
-    1709060,
-    1709061,
-    1709062,
-    1709072,
-    1709073,
-    1709074,
-    1709076,
-    1709077,
-    1709078,
-    1709088,
-    1709089,
-    1709090,
-    1709092,
-    1709093,
-    1709094,
-    1709312,
-    1709313,
-    1709314,
-    1709316,
-    1709317,
-    1709318,
-    1709328,
-    1709329,
-    1709330,
-    1709344,
-    1709345,
-    1709346,
-    1709348,
-    1709349,
-    1709350,
-    1720388,
-    1720389,
-    1720390,
-    1720400,
-    1720401,
-    1720402,
-    1720404,
-    1720405,
-    1720406,
-    1720416,
-    1720417,
-    1720418,
-    1720420,
-    1720421,
-    1720422,
-    1720640,
-    1720641,
-    1720642,
-    1720644,
-    1720645,
-    1720646,
-    1720656,
-    1720657,
-    1720658,
-    1720672,
-    1720673,
-    1720674,
-    1720676,
-    1720677,
-    1720678,
-    1721348,
-    1721349,
-    1721350,
-    1721360,
-    1721361,
-    1721362,
-    1721364,
-    1721365,
-    1721366,
-    1721376,
-    1721377,
-    1721378,
-    1721380,
-    1721381,
-    1721382,
-    1721412,
-    1721413,
-    1721414,
-    1721424,
-    1721425,
-    1721426,
-    1721428,
-    1721429,
-    1721430,
-    1721440,
-    1721441,
-    1721442,
-    1721444,
-    1721445,
-    1721446,
-    1721600,
-    1721601,
-    1721602,
-    1721604,
-    1721605,
-    1721606,
-    1721616,
-    1721617,
-    1721618,
-    1721632,
-    1721633,
-    1721634,
-    1721636,
-    1721637,
-    1721638,
-    1721664,
-    1721665,
-    1721666,
-    1721668,
-    1721669,
-    1721670,
-    1721680,
-    1721681,
-    1721682,
-    1721696,
-    1721697,
-    1721698,
-    1721700,
-    1721701,
-    1721702,
-    1724420,
-    1724421,
-    1724422,
-    1724432,
-    1724433,
-    1724434,
-    1724436,
-    1724437,
-    1724438,
-    1724448,
-    1724449,
-    1724450,
-    1724452,
-    1724453,
-    1724454,
-    1724484,
-    1724485,
-    1724486,
-    1724496,
-    1724497,
-    1724498,
-    1724500,
-    1724501,
-    1724502,
-    1724512,
-    1724513,
-    1724514,
-    1724516,
-    1724517,
-    1724518,
-    1725444,
-    1725445,
-    1725446,
-    1725456,
-    1725457,
-    1725458,
-    1725460,
-    1725461,
-    1725462,
-    1725472,
-    1725473,
-    1725474,
-    1725476,
-    1725477,
-    1725478,
-    1769792,
-    1769793,
-    1769794,
-    1769796,
-    1769798,
-    1769800,
-    1769801,
-    1769802,
-    1769808,
-    1769809,
-    1769810,
-    1769816,
-    1769817,
-    1769818,
-    1769824,
-    1769825,
-    1769826,
-    1769828,
-    1769830,
-    1769832,
-    1769833,
-    1769834,
-    1769855,
-    1770753,
-    1770754,
-    1770756,
-    1770757,
-    1770758,
-    1770760,
-    1770761,
-    1770762,
-    1770769,
-    1770770,
-    1770776,
-    1770777,
-    1770778,
-    1770785,
-    1770786,
-    1770788,
-    1770789,
-    1770790,
-    1770792,
-    1770793,
-    1770794,
-    1770815,
-    1770816,
-    1770817,
-    1770818,
-    1770820,
-    1770822,
-    1770824,
-    1770825,
-    1770826,
-    1770832,
-    1770833,
-    1770834,
-    1770840,
-    1770841,
-    1770842,
-    1770848,
-    1770849,
-    1770850,
-    1770852,
-    1770854,
-    1770856,
-    1770857,
-    1770858,
-    1770879,
-    1773572,
-    1773573,
-    1773574,
-    1773576,
-    1773577,
-    1773578,
-    1773585,
-    1773586,
-    1773588,
-    1773589,
-    1773590,
-    1773592,
-    1773593,
-    1773594,
-    1773601,
-    1773602,
-    1773604,
-    1773605,
-    1773606,
-    1773608,
-    1773609,
-    1773610,
-    1773631,
-    1773636,
-    1773638,
-    1773640,
-    1773641,
-    1773642,
-    1773648,
-    1773649,
-    1773650,
-    1773652,
-    1773654,
-    1773656,
-    1773657,
-    1773658,
-    1773664,
-    1773665,
-    1773666,
-    1773668,
-    1773670,
-    1773672,
-    1773673,
-    1773674,
-    1773695,
-    1773825,
-    1773826,
-    1773828,
-    1773829,
-    1773830,
-    1773832,
-    1773833,
-    1773834,
-    1773841,
-    1773842,
-    1773848,
-    1773849,
-    1773850,
-    1773857,
-    1773858,
-    1773860,
-    1773861,
-    1773862,
-    1773864,
-    1773865,
-    1773866,
-    1773887,
-    1773888,
-    1773889,
-    1773890,
-    1773892,
-    1773894,
-    1773896,
-    1773897,
-    1773898,
-    1773904,
-    1773905,
-    1773906,
-    1773912,
-    1773913,
-    1773914,
-    1773920,
-    1773921,
-    1773922,
-    1773924,
-    1773926,
-    1773928,
-    1773929,
-    1773930,
-    1773951,
-    1774596,
-    1774597,
-    1774598,
-    1774600,
-    1774601,
-    1774602,
-    1774609,
-    1774610,
-    1774612,
-    1774613,
-    1774614,
-    1774616,
-    1774617,
-    1774618,
-    1774625,
-    1774626,
-    1774628,
-    1774629,
-    1774630,
-    1774632,
-    1774633,
-    1774634,
-    1774655,
-    1774849,
-    1774850,
-    1774852,
-    1774853,
-    1774854,
-    1774856,
-    1774857,
-    1774858,
-    1774865,
-    1774866,
-    1774872,
-    1774873,
-    1774874,
-    1774881,
-    1774882,
-    1774884,
-    1774885,
-    1774886,
-    1774888,
-    1774889,
-    1774890,
-    1774911,
-    1785924,
-    1785926,
-    1785928,
-    1785929,
-    1785930,
-    1785936,
-    1785937,
-    1785938,
-    1785940,
-    1785942,
-    1785944,
-    1785945,
-    1785946,
-    1785952,
-    1785953,
-    1785954,
-    1785956,
-    1785958,
-    1785960,
-    1785961,
-    1785962,
-    1785983,
-    1786176,
-    1786177,
-    1786178,
-    1786180,
-    1786182,
-    1786184,
-    1786185,
-    1786186,
-    1786192,
-    1786193,
-    1786194,
-    1786200,
-    1786201,
-    1786202,
-    1786208,
-    1786209,
-    1786210,
-    1786212,
-    1786214,
-    1786216,
-    1786217,
-    1786218,
-    1786239,
-    1786884,
-    1786885,
-    1786886,
-    1786888,
-    1786889,
-    1786890,
-    1786897,
-    1786898,
-    1786900,
-    1786901,
-    1786902,
-    1786904,
-    1786905,
-    1786906,
-    1786913,
-    1786914,
-    1786916,
-    1786917,
-    1786918,
-    1786920,
-    1786921,
-    1786922,
-    1786943,
-    1786948,
-    1786950,
-    1786952,
-    1786953,
-    1786954,
-    1786960,
-    1786961,
-    1786962,
-    1786964,
-    1786966,
-    1786968,
-    1786969,
-    1786970,
-    1786976,
-    1786977,
-    1786978,
-    1786980,
-    1786982,
-    1786984,
-    1786985,
-    1786986,
-    1787007,
-    1787137,
-    1787138,
-    1787140,
-    1787141,
-    1787142,
-    1787144,
-    1787145,
-    1787146,
-    1787153,
-    1787154,
-    1787160,
-    1787161,
-    1787162,
-    1787169,
-    1787170,
-    1787172,
-    1787173,
-    1787174,
-    1787176,
-    1787177,
-    1787178,
-    1787199,
-    1787200,
-    1787201,
-    1787202,
-    1787204,
-    1787206,
-    1787208,
-    1787209,
-    1787210,
-    1787216,
-    1787217,
-    1787218,
-    1787224,
-    1787225,
-    1787226,
-    1787232,
-    1787233,
-    1787234,
-    1787236,
-    1787238,
-    1787240,
-    1787241,
-    1787242,
-    1787263,
-    1789956,
-    1789957,
-    1789958,
-    1789960,
-    1789961,
-    1789962,
-    1789969,
-    1789970,
-    1789972,
-    1789973,
-    1789974,
-    1789976,
-    1789977,
-    1789978,
-    1789985,
-    1789986,
-    1789988,
-    1789989,
-    1789990,
-    1789992,
-    1789993,
-    1789994,
-    1790015,
-    1790020,
-    1790022,
-    1790024,
-    1790025,
-    1790026,
-    1790032,
-    1790033,
-    1790034,
-    1790036,
-    1790038,
-    1790040,
-    1790041,
-    1790042,
-    1790048,
-    1790049,
-    1790050,
-    1790052,
-    1790054,
-    1790056,
-    1790057,
-    1790058,
-    1790079,
-    1790980,
-    1790981,
-    1790982,
-    1790984,
-    1790985,
-    1790986,
-    1790993,
-    1790994,
-    1790996,
-    1790997,
-    1790998,
-    1791000,
-    1791001,
-    1791002,
-    1791009,
-    1791010,
-    1791012,
-    1791013,
-    1791014,
-    1791016,
-    1791017,
-    1791018,
-    1791039,
-    1835328,
-    1835329,
-    1835332,
-    1835344,
-    1835345,
-    1836289,
-    1836292,
-    1836293,
-    1836305,
-    1836353,
-    1836356,
-    1836368,
-    1836369,
-    1836417,
-    1836420,
-    1836433,
-    1838531,
-    1838535,
-    1838547,
-    1839108,
-    1839109,
-    1839121,
-    1839124,
-    1839125,
-    1839172,
-    1839184,
-    1839185,
-    1839188,
-    1839236,
-    1839249,
-    1839252,
-    1839364,
-    1839365,
-    1839377,
-    1839428,
-    1839440,
-    1839441,
-    1839492,
-    1839505,
-    1840133,
-    1840145,
-    1840148,
-    1840149,
-    1840389,
-    1840401,
-    1842375,
-    1842387,
-    1842391,
-    1842631,
-    1842643,
-    1851472,
-    1851473,
-    1851476,
-    1851728,
-    1851729,
-    1852433,
-    1852436,
-    1852437,
-    1852497,
-    1852500,
-    1852561,
-    1852564,
-    1852689,
-    1852753,
-    1852817,
-    1854675,
-    1854679,
-    1854931,
-    1855508,
-    1855509,
-    1855572,
-    1855636,
-    1856533,
-    1858775,
-    1900864,
-    1900865,
-    1900866,
-    1900868,
-    1900870,
-    1900880,
-    1900881,
-    1900882,
-    1900884,
-    1900886,
-    1900896,
-    1900897,
-    1900900,
-    1901825,
-    1901826,
-    1901828,
-    1901829,
-    1901830,
-    1901841,
-    1901842,
-    1901844,
-    1901845,
-    1901846,
-    1901857,
-    1901860,
-    1901861,
-    1901888,
-    1901889,
-    1901890,
-    1901892,
-    1901894,
-    1901904,
-    1901905,
-    1901906,
-    1901908,
-    1901910,
-    1901920,
-    1901921,
-    1901924,
-    1901952,
-    1901953,
-    1901954,
-    1901956,
-    1901957,
-    1901958,
-    1901968,
-    1901969,
-    1901970,
-    1901972,
-    1901973,
-    1901974,
-    1901985,
-    1901988,
-    1904067,
-    1904071,
-    1904083,
-    1904087,
-    1904099,
-    1904103,
-    1904641,
-    1904642,
-    1904644,
-    1904645,
-    1904646,
-    1904657,
-    1904658,
-    1904660,
-    1904661,
-    1904662,
-    1904673,
-    1904676,
-    1904677,
-    1904704,
-    1904705,
-    1904706,
-    1904708,
-    1904710,
-    1904720,
-    1904721,
-    1904722,
-    1904724,
-    1904726,
-    1904736,
-    1904737,
-    1904740,
-    1904768,
-    1904769,
-    1904770,
-    1904772,
-    1904773,
-    1904774,
-    1904784,
-    1904785,
-    1904786,
-    1904788,
-    1904789,
-    1904790,
-    1904801,
-    1904804,
-    1904897,
-    1904898,
-    1904900,
-    1904901,
-    1904902,
-    1904913,
-    1904914,
-    1904916,
-    1904917,
-    1904918,
-    1904929,
-    1904932,
-    1904933,
-    1904960,
-    1904961,
-    1904962,
-    1904964,
-    1904966,
-    1904976,
-    1904977,
-    1904978,
-    1904980,
-    1904982,
-    1904992,
-    1904993,
-    1904996,
-    1905024,
-    1905025,
-    1905026,
-    1905028,
-    1905029,
-    1905030,
-    1905040,
-    1905041,
-    1905042,
-    1905044,
-    1905045,
-    1905046,
-    1905057,
-    1905060,
-    1905665,
-    1905666,
-    1905668,
-    1905669,
-    1905670,
-    1905681,
-    1905682,
-    1905684,
-    1905685,
-    1905686,
-    1905697,
-    1905700,
-    1905701,
-    1905921,
-    1905922,
-    1905924,
-    1905925,
-    1905926,
-    1905937,
-    1905938,
-    1905940,
-    1905941,
-    1905942,
-    1905953,
-    1905956,
-    1905957,
-    1907907,
-    1907911,
-    1907923,
-    1907927,
-    1907939,
-    1907943,
-    1908163,
-    1908167,
-    1908179,
-    1908183,
-    1908195,
-    1908199,
-    1916992,
-    1916993,
-    1916994,
-    1916996,
-    1916998,
-    1917008,
-    1917009,
-    1917010,
-    1917012,
-    1917014,
-    1917024,
-    1917025,
-    1917028,
-    1917248,
-    1917249,
-    1917250,
-    1917252,
-    1917254,
-    1917264,
-    1917265,
-    1917266,
-    1917268,
-    1917270,
-    1917280,
-    1917281,
-    1917284,
-    1917953,
-    1917954,
-    1917956,
-    1917957,
-    1917958,
-    1917969,
-    1917970,
-    1917972,
-    1917973,
-    1917974,
-    1917985,
-    1917988,
-    1917989,
-    1918016,
-    1918017,
-    1918018,
-    1918020,
-    1918022,
-    1918032,
-    1918033,
-    1918034,
-    1918036,
-    1918038,
-    1918048,
-    1918049,
-    1918052,
-    1918080,
-    1918081,
-    1918082,
-    1918084,
-    1918085,
-    1918086,
-    1918096,
-    1918097,
-    1918098,
-    1918100,
-    1918101,
-    1918102,
-    1918113,
-    1918116,
-    1918209,
-    1918210,
-    1918212,
-    1918213,
-    1918214,
-    1918225,
-    1918226,
-    1918228,
-    1918229,
-    1918230,
-    1918241,
-    1918244,
-    1918245,
-    1918272,
-    1918273,
-    1918274,
-    1918276,
-    1918278,
-    1918288,
-    1918289,
-    1918290,
-    1918292,
-    1918294,
-    1918304,
-    1918305,
-    1918308,
-    1918336,
-    1918337,
-    1918338,
-    1918340,
-    1918341,
-    1918342,
-    1918352,
-    1918353,
-    1918354,
-    1918356,
-    1918357,
-    1918358,
-    1918369,
-    1918372,
-    1920195,
-    1920199,
-    1920211,
-    1920215,
-    1920227,
-    1920231,
-    1920451,
-    1920455,
-    1920467,
-    1920471,
-    1920483,
-    1920487,
-    1921025,
-    1921026,
-    1921028,
-    1921029,
-    1921030,
-    1921041,
-    1921042,
-    1921044,
-    1921045,
-    1921046,
-    1921057,
-    1921060,
-    1921061,
-    1921088,
-    1921089,
-    1921090,
-    1921092,
-    1921094,
-    1921104,
-    1921105,
-    1921106,
-    1921108,
-    1921110,
-    1921120,
-    1921121,
-    1921124,
-    1921152,
-    1921153,
-    1921154,
-    1921156,
-    1921157,
-    1921158,
-    1921168,
-    1921169,
-    1921170,
-    1921172,
-    1921173,
-    1921174,
-    1921185,
-    1921188,
-    1922049,
-    1922050,
-    1922052,
-    1922053,
-    1922054,
-    1922065,
-    1922066,
-    1922068,
-    1922069,
-    1922070,
-    1922081,
-    1922084,
-    1922085,
-    1924291,
-    1924295,
-    1924307,
-    1924311,
-    1924323,
-    1924327,
-    1966400,
-    1966401,
-    1966402,
-    1966404,
-    1966406,
-    1966416,
-    1966417,
-    1966418,
-    1966432,
-    1966433,
-    1966434,
-    1966436,
-    1966438,
-    1967361,
-    1967362,
-    1967364,
-    1967365,
-    1967366,
-    1967377,
-    1967378,
-    1967393,
-    1967394,
-    1967396,
-    1967397,
-    1967398,
-    1967424,
-    1967425,
-    1967426,
-    1967428,
-    1967430,
-    1967440,
-    1967441,
-    1967442,
-    1967456,
-    1967457,
-    1967458,
-    1967460,
-    1967462,
-    1967488,
-    1967489,
-    1967490,
-    1967492,
-    1967493,
-    1967494,
-    1967504,
-    1967505,
-    1967506,
-    1967520,
-    1967521,
-    1967522,
-    1967524,
-    1967525,
-    1967526,
-    1969603,
-    1969607,
-    1969619,
-    1969635,
-    1969639,
-    1970180,
-    1970181,
-    1970182,
-    1970193,
-    1970194,
-    1970196,
-    1970197,
-    1970198,
-    1970209,
-    1970210,
-    1970212,
-    1970213,
-    1970214,
-    1970244,
-    1970246,
-    1970256,
-    1970257,
-    1970258,
-    1970260,
-    1970262,
-    1970272,
-    1970273,
-    1970274,
-    1970276,
-    1970278,
-    1970308,
-    1970309,
-    1970310,
-    1970320,
-    1970321,
-    1970322,
-    1970324,
-    1970325,
-    1970326,
-    1970336,
-    1970337,
-    1970338,
-    1970340,
-    1970341,
-    1970342,
-    1970433,
-    1970434,
-    1970436,
-    1970437,
-    1970438,
-    1970449,
-    1970450,
-    1970465,
-    1970466,
-    1970468,
-    1970469,
-    1970470,
-    1970496,
-    1970497,
-    1970498,
-    1970500,
-    1970502,
-    1970512,
-    1970513,
-    1970514,
-    1970528,
-    1970529,
-    1970530,
-    1970532,
-    1970534,
-    1970560,
-    1970561,
-    1970562,
-    1970564,
-    1970565,
-    1970566,
-    1970576,
-    1970577,
-    1970578,
-    1970592,
-    1970593,
-    1970594,
-    1970596,
-    1970597,
-    1970598,
-    1971204,
-    1971205,
-    1971206,
-    1971217,
-    1971218,
-    1971220,
-    1971221,
-    1971222,
-    1971233,
-    1971234,
-    1971236,
-    1971237,
-    1971238,
-    1971457,
-    1971458,
-    1971460,
-    1971461,
-    1971462,
-    1971473,
-    1971474,
-    1971489,
-    1971490,
-    1971492,
-    1971493,
-    1971494,
-    1973447,
-    1973459,
-    1973463,
-    1973475,
-    1973479,
-    1973699,
-    1973703,
-    1973715,
-    1973731,
-    1973735,
-    1982532,
-    1982534,
-    1982544,
-    1982545,
-    1982546,
-    1982548,
-    1982550,
-    1982560,
-    1982561,
-    1982562,
-    1982564,
-    1982566,
-    1982784,
-    1982785,
-    1982786,
-    1982788,
-    1982790,
-    1982800,
-    1982801,
-    1982802,
-    1982816,
-    1982817,
-    1982818,
-    1982820,
-    1982822,
-    1983492,
-    1983493,
-    1983494,
-    1983505,
-    1983506,
-    1983508,
-    1983509,
-    1983510,
-    1983521,
-    1983522,
-    1983524,
-    1983525,
-    1983526,
-    1983556,
-    1983558,
-    1983568,
-    1983569,
-    1983570,
-    1983572,
-    1983574,
-    1983584,
-    1983585,
-    1983586,
-    1983588,
-    1983590,
-    1983620,
-    1983621,
-    1983622,
-    1983632,
-    1983633,
-    1983634,
-    1983636,
-    1983637,
-    1983638,
-    1983648,
-    1983649,
-    1983650,
-    1983652,
-    1983653,
-    1983654,
-    1983745,
-    1983746,
-    1983748,
-    1983749,
-    1983750,
-    1983761,
-    1983762,
-    1983777,
-    1983778,
-    1983780,
-    1983781,
-    1983782,
-    1983808,
-    1983809,
-    1983810,
-    1983812,
-    1983814,
-    1983824,
-    1983825,
-    1983826,
-    1983840,
-    1983841,
-    1983842,
-    1983844,
-    1983846,
-    1983872,
-    1983873,
-    1983874,
-    1983876,
-    1983877,
-    1983878,
-    1983888,
-    1983889,
-    1983890,
-    1983904,
-    1983905,
-    1983906,
-    1983908,
-    1983909,
-    1983910,
-    1985735,
-    1985747,
-    1985751,
-    1985763,
-    1985767,
-    1985987,
-    1985991,
-    1986003,
-    1986019,
-    1986023,
-    1986564,
-    1986565,
-    1986566,
-    1986577,
-    1986578,
-    1986580,
-    1986581,
-    1986582,
-    1986593,
-    1986594,
-    1986596,
-    1986597,
-    1986598,
-    1986628,
-    1986630,
-    1986640,
-    1986641,
-    1986642,
-    1986644,
-    1986646,
-    1986656,
-    1986657,
-    1986658,
-    1986660,
-    1986662,
-    1986692,
-    1986693,
-    1986694,
-    1986704,
-    1986705,
-    1986706,
-    1986708,
-    1986709,
-    1986710,
-    1986720,
-    1986721,
-    1986722,
-    1986724,
-    1986725,
-    1986726,
-    1987588,
-    1987589,
-    1987590,
-    1987601,
-    1987602,
-    1987604,
-    1987605,
-    1987606,
-    1987617,
-    1987618,
-    1987620,
-    1987621,
-    1987622,
-    1989831,
-    1989843,
-    1989847,
-    1989859,
-    1989863,
-    2031936,
-    2031937,
-    2031938,
-    2031940,
-    2031941,
-    2031942,
-    2031944,
-    2031945,
-    2031946,
-    2031952,
-    2031953,
-    2031954,
-    2031960,
-    2031961,
-    2031962,
-    2031968,
-    2031969,
-    2031970,
-    2031972,
-    2031973,
-    2031974,
-    2031976,
-    2031977,
-    2031978,
-    2031999,
-    2032896,
-    2032897,
-    2032898,
-    2032900,
-    2032901,
-    2032902,
-    2032904,
-    2032905,
-    2032906,
-    2032912,
-    2032913,
-    2032914,
-    2032920,
-    2032921,
-    2032922,
-    2032928,
-    2032929,
-    2032930,
-    2032932,
-    2032933,
-    2032934,
-    2032936,
-    2032937,
-    2032938,
-    2032959,
-    2032960,
-    2032961,
-    2032962,
-    2032964,
-    2032965,
-    2032966,
-    2032968,
-    2032969,
-    2032970,
-    2032976,
-    2032977,
-    2032978,
-    2032984,
-    2032985,
-    2032986,
-    2032992,
-    2032993,
-    2032994,
-    2032996,
-    2032997,
-    2032998,
-    2033000,
-    2033001,
-    2033002,
-    2033023,
-    2033024,
-    2033025,
-    2033026,
-    2033028,
-    2033029,
-    2033030,
-    2033032,
-    2033033,
-    2033034,
-    2033040,
-    2033041,
-    2033042,
-    2033048,
-    2033049,
-    2033050,
-    2033056,
-    2033057,
-    2033058,
-    2033060,
-    2033061,
-    2033062,
-    2033064,
-    2033065,
-    2033066,
-    2033087,
-    2035139,
-    2035143,
-    2035147,
-    2035155,
-    2035163,
-    2035171,
-    2035175,
-    2035179,
-    2035199,
-    2035716,
-    2035717,
-    2035718,
-    2035720,
-    2035721,
-    2035722,
-    2035728,
-    2035729,
-    2035730,
-    2035732,
-    2035733,
-    2035734,
-    2035736,
-    2035737,
-    2035738,
-    2035744,
-    2035745,
-    2035746,
-    2035748,
-    2035749,
-    2035750,
-    2035752,
-    2035753,
-    2035754,
-    2035775,
-    2035780,
-    2035781,
-    2035782,
-    2035784,
-    2035785,
-    2035786,
-    2035792,
-    2035793,
-    2035794,
-    2035796,
-    2035797,
-    2035798,
-    2035800,
-    2035801,
-    2035802,
-    2035808,
-    2035809,
-    2035810,
-    2035812,
-    2035813,
-    2035814,
-    2035816,
-    2035817,
-    2035818,
-    2035839,
-    2035844,
-    2035845,
-    2035846,
-    2035848,
-    2035849,
-    2035850,
-    2035856,
-    2035857,
-    2035858,
-    2035860,
-    2035861,
-    2035862,
-    2035864,
-    2035865,
-    2035866,
-    2035872,
-    2035873,
-    2035874,
-    2035876,
-    2035877,
-    2035878,
-    2035880,
-    2035881,
-    2035882,
-    2035903,
-    2035968,
-    2035969,
-    2035970,
-    2035972,
-    2035973,
-    2035974,
-    2035976,
-    2035977,
-    2035978,
-    2035984,
-    2035985,
-    2035986,
-    2035992,
-    2035993,
-    2035994,
-    2036000,
-    2036001,
-    2036002,
-    2036004,
-    2036005,
-    2036006,
-    2036008,
-    2036009,
-    2036010,
-    2036031,
-    2036032,
-    2036033,
-    2036034,
-    2036036,
-    2036037,
-    2036038,
-    2036040,
-    2036041,
-    2036042,
-    2036048,
-    2036049,
-    2036050,
-    2036056,
-    2036057,
-    2036058,
-    2036064,
-    2036065,
-    2036066,
-    2036068,
-    2036069,
-    2036070,
-    2036072,
-    2036073,
-    2036074,
-    2036095,
-    2036096,
-    2036097,
-    2036098,
-    2036100,
-    2036101,
-    2036102,
-    2036104,
-    2036105,
-    2036106,
-    2036112,
-    2036113,
-    2036114,
-    2036120,
-    2036121,
-    2036122,
-    2036128,
-    2036129,
-    2036130,
-    2036132,
-    2036133,
-    2036134,
-    2036136,
-    2036137,
-    2036138,
-    2036159,
-    2036740,
-    2036741,
-    2036742,
-    2036744,
-    2036745,
-    2036746,
-    2036752,
-    2036753,
-    2036754,
-    2036756,
-    2036757,
-    2036758,
-    2036760,
-    2036761,
-    2036762,
-    2036768,
-    2036769,
-    2036770,
-    2036772,
-    2036773,
-    2036774,
-    2036776,
-    2036777,
-    2036778,
-    2036799,
-    2036992,
-    2036993,
-    2036994,
-    2036996,
-    2036997,
-    2036998,
-    2037000,
-    2037001,
-    2037002,
-    2037008,
-    2037009,
-    2037010,
-    2037016,
-    2037017,
-    2037018,
-    2037024,
-    2037025,
-    2037026,
-    2037028,
-    2037029,
-    2037030,
-    2037032,
-    2037033,
-    2037034,
-    2037055,
-    2038983,
-    2038987,
-    2038995,
-    2038999,
-    2039003,
-    2039011,
-    2039015,
-    2039019,
-    2039039,
-    2039235,
-    2039239,
-    2039243,
-    2039251,
-    2039259,
-    2039267,
-    2039271,
-    2039275,
-    2039295,
-    2048068,
-    2048069,
-    2048070,
-    2048072,
-    2048073,
-    2048074,
-    2048080,
-    2048081,
-    2048082,
-    2048084,
-    2048085,
-    2048086,
-    2048088,
-    2048089,
-    2048090,
-    2048096,
-    2048097,
-    2048098,
-    2048100,
-    2048101,
-    2048102,
-    2048104,
-    2048105,
-    2048106,
-    2048127,
-    2048320,
-    2048321,
-    2048322,
-    2048324,
-    2048325,
-    2048326,
-    2048328,
-    2048329,
-    2048330,
-    2048336,
-    2048337,
-    2048338,
-    2048344,
-    2048345,
-    2048346,
-    2048352,
-    2048353,
-    2048354,
-    2048356,
-    2048357,
-    2048358,
-    2048360,
-    2048361,
-    2048362,
-    2048383,
-    2049028,
-    2049029,
-    2049030,
-    2049032,
-    2049033,
-    2049034,
-    2049040,
-    2049041,
-    2049042,
-    2049044,
-    2049045,
-    2049046,
-    2049048,
-    2049049,
-    2049050,
-    2049056,
-    2049057,
-    2049058,
-    2049060,
-    2049061,
-    2049062,
-    2049064,
-    2049065,
-    2049066,
-    2049087,
-    2049092,
-    2049093,
-    2049094,
-    2049096,
-    2049097,
-    2049098,
-    2049104,
-    2049105,
-    2049106,
-    2049108,
-    2049109,
-    2049110,
-    2049112,
-    2049113,
-    2049114,
-    2049120,
-    2049121,
-    2049122,
-    2049124,
-    2049125,
-    2049126,
-    2049128,
-    2049129,
-    2049130,
-    2049151,
-    2049156,
-    2049157,
-    2049158,
-    2049160,
-    2049161,
-    2049162,
-    2049168,
-    2049169,
-    2049170,
-    2049172,
-    2049173,
-    2049174,
-    2049176,
-    2049177,
-    2049178,
-    2049184,
-    2049185,
-    2049186,
-    2049188,
-    2049189,
-    2049190,
-    2049192,
-    2049193,
-    2049194,
-    2049215,
-    2049280,
-    2049281,
-    2049282,
-    2049284,
-    2049285,
-    2049286,
-    2049288,
-    2049289,
-    2049290,
-    2049296,
-    2049297,
-    2049298,
-    2049304,
-    2049305,
-    2049306,
-    2049312,
-    2049313,
-    2049314,
-    2049316,
-    2049317,
-    2049318,
-    2049320,
-    2049321,
-    2049322,
-    2049343,
-    2049344,
-    2049345,
-    2049346,
-    2049348,
-    2049349,
-    2049350,
-    2049352,
-    2049353,
-    2049354,
-    2049360,
-    2049361,
-    2049362,
-    2049368,
-    2049369,
-    2049370,
-    2049376,
-    2049377,
-    2049378,
-    2049380,
-    2049381,
-    2049382,
-    2049384,
-    2049385,
-    2049386,
-    2049407,
-    2049408,
-    2049409,
-    2049410,
-    2049412,
-    2049413,
-    2049414,
-    2049416,
-    2049417,
-    2049418,
-    2049424,
-    2049425,
-    2049426,
-    2049432,
-    2049433,
-    2049434,
-    2049440,
-    2049441,
-    2049442,
-    2049444,
-    2049445,
-    2049446,
-    2049448,
-    2049449,
-    2049450,
-    2049471,
-    2051271,
-    2051275,
-    2051283,
-    2051287,
-    2051291,
-    2051299,
-    2051303,
-    2051307,
-    2051327,
-    2051523,
-    2051527,
-    2051531,
-    2051539,
-    2051547,
-    2051555,
-    2051559,
-    2051563,
-    2051583,
-    2052100,
-    2052101,
-    2052102,
-    2052104,
-    2052105,
-    2052106,
-    2052112,
-    2052113,
-    2052114,
-    2052116,
-    2052117,
-    2052118,
-    2052120,
-    2052121,
-    2052122,
-    2052128,
-    2052129,
-    2052130,
-    2052132,
-    2052133,
-    2052134,
-    2052136,
-    2052137,
-    2052138,
-    2052159,
-    2052164,
-    2052165,
-    2052166,
-    2052168,
-    2052169,
-    2052170,
-    2052176,
-    2052177,
-    2052178,
-    2052180,
-    2052181,
-    2052182,
-    2052184,
-    2052185,
-    2052186,
-    2052192,
-    2052193,
-    2052194,
-    2052196,
-    2052197,
-    2052198,
-    2052200,
-    2052201,
-    2052202,
-    2052223,
-    2052228,
-    2052229,
-    2052230,
-    2052232,
-    2052233,
-    2052234,
-    2052240,
-    2052241,
-    2052242,
-    2052244,
-    2052245,
-    2052246,
-    2052248,
-    2052249,
-    2052250,
-    2052256,
-    2052257,
-    2052258,
-    2052260,
-    2052261,
-    2052262,
-    2052264,
-    2052265,
-    2052266,
-    2052287,
-    2053124,
-    2053125,
-    2053126,
-    2053128,
-    2053129,
-    2053130,
-    2053136,
-    2053137,
-    2053138,
-    2053140,
-    2053141,
-    2053142,
-    2053144,
-    2053145,
-    2053146,
-    2053152,
-    2053153,
-    2053154,
-    2053156,
-    2053157,
-    2053158,
-    2053160,
-    2053161,
-    2053162,
-    2053183,
-    2055367,
-    2055371,
-    2055379,
-    2055383,
-    2055387,
-    2055395,
-    2055399,
-    2055403,
-    2055423,
-    2621760,
-    2621761,
-    2621764,
-    2621777,
-    2622721,
-    2622724,
-    2622725,
-    2622737,
-    2622785,
-    2622788,
-    2622800,
-    2622801,
-    2625540,
-    2625541,
-    2625553,
-    2625557,
-    2625604,
-    2625617,
-    2625620,
-    2625860,
-    2625873,
-    2626565,
-    2626577,
-    2626580,
-    2626581,
-    2626821,
-    2626833,
-    2638865,
-    2638869,
-    2638929,
-    2639185,
-    2642965,
-    2687296,
-    2687297,
-    2687298,
-    2687300,
-    2687302,
-    2687313,
-    2687314,
-    2688257,
-    2688258,
-    2688260,
-    2688261,
-    2688262,
-    2688273,
-    2688274,
-    2688289,
-    2688292,
-    2688293,
-    2688320,
-    2688321,
-    2688322,
-    2688324,
-    2688326,
-    2688336,
-    2688337,
-    2688338,
-    2688352,
-    2688353,
-    2688356,
-    2691076,
-    2691077,
-    2691078,
-    2691089,
-    2691090,
-    2691093,
-    2691094,
-    2691140,
-    2691142,
-    2691152,
-    2691153,
-    2691154,
-    2691156,
-    2691158,
-    2691168,
-    2691169,
-    2691172,
-    2691392,
-    2691393,
-    2691394,
-    2691396,
-    2691398,
-    2691409,
-    2691410,
-    2692100,
-    2692101,
-    2692102,
-    2692113,
-    2692114,
-    2692116,
-    2692117,
-    2692118,
-    2692129,
-    2692132,
-    2692133,
-    2692353,
-    2692354,
-    2692356,
-    2692357,
-    2692358,
-    2692369,
-    2692370,
-    2692385,
-    2692388,
-    2692389,
-    2704388,
-    2704389,
-    2704390,
-    2704401,
-    2704402,
-    2704405,
-    2704406,
-    2704452,
-    2704454,
-    2704464,
-    2704465,
-    2704466,
-    2704468,
-    2704470,
-    2704480,
-    2704481,
-    2704484,
-    2704704,
-    2704705,
-    2704706,
-    2704708,
-    2704710,
-    2704721,
-    2704722,
-    2708484,
-    2708485,
-    2708486,
-    2708497,
-    2708498,
-    2708501,
-    2708502,
-    2752832,
-    2752833,
-    2752834,
-    2752836,
-    2752837,
-    2752838,
-    2752849,
-    2752850,
-    2752853,
-    2752854,
-    2752866,
-    2752870,
-    2753792,
-    2753793,
-    2753794,
-    2753796,
-    2753797,
-    2753798,
-    2753808,
-    2753809,
-    2753810,
-    2753812,
-    2753813,
-    2753814,
-    2753824,
-    2753825,
-    2753826,
-    2753828,
-    2753829,
-    2753830,
-    2753856,
-    2753857,
-    2753858,
-    2753860,
-    2753861,
-    2753862,
-    2753872,
-    2753873,
-    2753874,
-    2753876,
-    2753877,
-    2753878,
-    2753888,
-    2753889,
-    2753890,
-    2753892,
-    2753893,
-    2753894,
-    2756608,
-    2756609,
-    2756610,
-    2756612,
-    2756613,
-    2756614,
-    2756625,
-    2756626,
-    2756629,
-    2756630,
-    2756642,
-    2756646,
-    2756672,
-    2756673,
-    2756674,
-    2756676,
-    2756677,
-    2756678,
-    2756688,
-    2756689,
-    2756690,
-    2756692,
-    2756693,
-    2756694,
-    2756704,
-    2756705,
-    2756706,
-    2756708,
-    2756709,
-    2756710,
-    2756928,
-    2756929,
-    2756930,
-    2756932,
-    2756933,
-    2756934,
-    2756945,
-    2756946,
-    2756949,
-    2756950,
-    2756962,
-    2756966,
-    2757632,
-    2757633,
-    2757634,
-    2757636,
-    2757637,
-    2757638,
-    2757648,
-    2757649,
-    2757650,
-    2757652,
-    2757653,
-    2757654,
-    2757664,
-    2757665,
-    2757666,
-    2757668,
-    2757669,
-    2757670,
-    2757888,
-    2757889,
-    2757890,
-    2757892,
-    2757893,
-    2757894,
-    2757904,
-    2757905,
-    2757906,
-    2757908,
-    2757909,
-    2757910,
-    2757920,
-    2757921,
-    2757922,
-    2757924,
-    2757925,
-    2757926,
-    2769920,
-    2769921,
-    2769922,
-    2769924,
-    2769925,
-    2769926,
-    2769937,
-    2769938,
-    2769941,
-    2769942,
-    2769954,
-    2769958,
-    2769984,
-    2769985,
-    2769986,
-    2769988,
-    2769989,
-    2769990,
-    2770000,
-    2770001,
-    2770002,
-    2770004,
-    2770005,
-    2770006,
-    2770016,
-    2770017,
-    2770018,
-    2770020,
-    2770021,
-    2770022,
-    2770240,
-    2770241,
-    2770242,
-    2770244,
-    2770245,
-    2770246,
-    2770257,
-    2770258,
-    2770261,
-    2770262,
-    2770274,
-    2770278,
-    2774016,
-    2774017,
-    2774018,
-    2774020,
-    2774021,
-    2774022,
-    2774033,
-    2774034,
-    2774037,
-    2774038,
-    2774050,
-    2774054,
-    2818368,
-    2818369,
-    2818370,
-    2818372,
-    2818374,
-    2818376,
-    2818377,
-    2818378,
-    2818385,
-    2818386,
-    2818393,
-    2818394,
-    2818402,
-    2818406,
-    2818410,
-    2818431,
-    2819329,
-    2819330,
-    2819332,
-    2819333,
-    2819334,
-    2819336,
-    2819337,
-    2819338,
-    2819345,
-    2819346,
-    2819352,
-    2819353,
-    2819354,
-    2819361,
-    2819362,
-    2819364,
-    2819365,
-    2819366,
-    2819368,
-    2819369,
-    2819370,
-    2819391,
-    2819392,
-    2819393,
-    2819394,
-    2819396,
-    2819398,
-    2819400,
-    2819401,
-    2819402,
-    2819408,
-    2819409,
-    2819410,
-    2819416,
-    2819417,
-    2819418,
-    2819424,
-    2819425,
-    2819426,
-    2819428,
-    2819430,
-    2819432,
-    2819433,
-    2819434,
-    2819455,
-    2822148,
-    2822149,
-    2822150,
-    2822152,
-    2822153,
-    2822154,
-    2822161,
-    2822162,
-    2822165,
-    2822166,
-    2822169,
-    2822170,
-    2822178,
-    2822182,
-    2822186,
-    2822207,
-    2822212,
-    2822214,
-    2822216,
-    2822217,
-    2822218,
-    2822224,
-    2822225,
-    2822226,
-    2822228,
-    2822230,
-    2822232,
-    2822233,
-    2822234,
-    2822240,
-    2822241,
-    2822242,
-    2822244,
-    2822246,
-    2822248,
-    2822249,
-    2822250,
-    2822271,
-    2822464,
-    2822465,
-    2822466,
-    2822468,
-    2822470,
-    2822472,
-    2822473,
-    2822474,
-    2822481,
-    2822482,
-    2822489,
-    2822490,
-    2822498,
-    2822502,
-    2822506,
-    2822527,
-    2823172,
-    2823173,
-    2823174,
-    2823176,
-    2823177,
-    2823178,
-    2823185,
-    2823186,
-    2823188,
-    2823189,
-    2823190,
-    2823192,
-    2823193,
-    2823194,
-    2823201,
-    2823202,
-    2823204,
-    2823205,
-    2823206,
-    2823208,
-    2823209,
-    2823210,
-    2823231,
-    2823425,
-    2823426,
-    2823428,
-    2823429,
-    2823430,
-    2823432,
-    2823433,
-    2823434,
-    2823441,
-    2823442,
-    2823448,
-    2823449,
-    2823450,
-    2823457,
-    2823458,
-    2823460,
-    2823461,
-    2823462,
-    2823464,
-    2823465,
-    2823466,
-    2823487,
-    2835460,
-    2835461,
-    2835462,
-    2835464,
-    2835465,
-    2835466,
-    2835473,
-    2835474,
-    2835477,
-    2835478,
-    2835481,
-    2835482,
-    2835490,
-    2835494,
-    2835498,
-    2835519,
-    2835524,
-    2835526,
-    2835528,
-    2835529,
-    2835530,
-    2835536,
-    2835537,
-    2835538,
-    2835540,
-    2835542,
-    2835544,
-    2835545,
-    2835546,
-    2835552,
-    2835553,
-    2835554,
-    2835556,
-    2835558,
-    2835560,
-    2835561,
-    2835562,
-    2835583,
-    2835776,
-    2835777,
-    2835778,
-    2835780,
-    2835782,
-    2835784,
-    2835785,
-    2835786,
-    2835793,
-    2835794,
-    2835801,
-    2835802,
-    2835810,
-    2835814,
-    2835818,
-    2835839,
-    2839556,
-    2839557,
-    2839558,
-    2839560,
-    2839561,
-    2839562,
-    2839569,
-    2839570,
-    2839573,
-    2839574,
-    2839577,
-    2839578,
-    2839586,
-    2839590,
-    2839594,
-    2839615,
-    2883904,
-    2883905,
-    2883908,
-    2883920,
-    2883921,
-    2884865,
-    2884868,
-    2884869,
-    2884881,
-    2884929,
-    2884932,
-    2884944,
-    2884945,
-    2884993,
-    2884996,
-    2885009,
-    2887107,
-    2887111,
-    2887123,
-    2887684,
-    2887685,
-    2887697,
-    2887700,
-    2887701,
-    2887748,
-    2887760,
-    2887761,
-    2887764,
-    2887812,
-    2887825,
-    2887828,
-    2887940,
-    2887941,
-    2887953,
-    2888004,
-    2888016,
-    2888017,
-    2888068,
-    2888081,
-    2888709,
-    2888721,
-    2888724,
-    2888725,
-    2888965,
-    2888977,
-    2890951,
-    2890963,
-    2890967,
-    2891207,
-    2891219,
-    2900048,
-    2900049,
-    2900052,
-    2900304,
-    2900305,
-    2901009,
-    2901012,
-    2901013,
-    2901073,
-    2901076,
-    2901137,
-    2901140,
-    2901265,
-    2901329,
-    2901393,
-    2903251,
-    2903255,
-    2903507,
-    2904084,
-    2904085,
-    2904148,
-    2904212,
-    2905109,
-    2907351,
-    2949440,
-    2949441,
-    2949442,
-    2949444,
-    2949446,
-    2949456,
-    2949457,
-    2949458,
-    2949472,
-    2949473,
-    2949476,
-    2950401,
-    2950402,
-    2950404,
-    2950405,
-    2950406,
-    2950417,
-    2950418,
-    2950433,
-    2950436,
-    2950437,
-    2950464,
-    2950465,
-    2950466,
-    2950468,
-    2950470,
-    2950480,
-    2950481,
-    2950482,
-    2950496,
-    2950497,
-    2950500,
-    2950528,
-    2950529,
-    2950530,
-    2950532,
-    2950533,
-    2950534,
-    2950544,
-    2950545,
-    2950546,
-    2950561,
-    2950564,
-    2952643,
-    2952647,
-    2952659,
-    2952675,
-    2952679,
-    2953220,
-    2953221,
-    2953222,
-    2953233,
-    2953234,
-    2953236,
-    2953237,
-    2953238,
-    2953249,
-    2953252,
-    2953253,
-    2953284,
-    2953286,
-    2953296,
-    2953297,
-    2953298,
-    2953300,
-    2953302,
-    2953312,
-    2953313,
-    2953316,
-    2953348,
-    2953349,
-    2953350,
-    2953360,
-    2953361,
-    2953362,
-    2953364,
-    2953365,
-    2953366,
-    2953377,
-    2953380,
-    2953473,
-    2953474,
-    2953476,
-    2953477,
-    2953478,
-    2953489,
-    2953490,
-    2953505,
-    2953508,
-    2953509,
-    2953536,
-    2953537,
-    2953538,
-    2953540,
-    2953542,
-    2953552,
-    2953553,
-    2953554,
-    2953568,
-    2953569,
-    2953572,
-    2953600,
-    2953601,
-    2953602,
-    2953604,
-    2953605,
-    2953606,
-    2953616,
-    2953617,
-    2953618,
-    2953633,
-    2953636,
-    2954244,
-    2954245,
-    2954246,
-    2954257,
-    2954258,
-    2954260,
-    2954261,
-    2954262,
-    2954273,
-    2954276,
-    2954277,
-    2954497,
-    2954498,
-    2954500,
-    2954501,
-    2954502,
-    2954513,
-    2954514,
-    2954529,
-    2954532,
-    2954533,
-    2956487,
-    2956499,
-    2956503,
-    2956515,
-    2956519,
-    2956739,
-    2956743,
-    2956755,
-    2956771,
-    2956775,
-    2965572,
-    2965574,
-    2965584,
-    2965585,
-    2965586,
-    2965588,
-    2965590,
-    2965600,
-    2965601,
-    2965604,
-    2965824,
-    2965825,
-    2965826,
-    2965828,
-    2965830,
-    2965840,
-    2965841,
-    2965842,
-    2965856,
-    2965857,
-    2965860,
-    2966532,
-    2966533,
-    2966534,
-    2966545,
-    2966546,
-    2966548,
-    2966549,
-    2966550,
-    2966561,
-    2966564,
-    2966565,
-    2966596,
-    2966598,
-    2966608,
-    2966609,
-    2966610,
-    2966612,
-    2966614,
-    2966624,
-    2966625,
-    2966628,
-    2966660,
-    2966661,
-    2966662,
-    2966672,
-    2966673,
-    2966674,
-    2966676,
-    2966677,
-    2966678,
-    2966689,
-    2966692,
-    2966785,
-    2966786,
-    2966788,
-    2966789,
-    2966790,
-    2966801,
-    2966802,
-    2966817,
-    2966820,
-    2966821,
-    2966848,
-    2966849,
-    2966850,
-    2966852,
-    2966854,
-    2966864,
-    2966865,
-    2966866,
-    2966880,
-    2966881,
-    2966884,
-    2966912,
-    2966913,
-    2966914,
-    2966916,
-    2966917,
-    2966918,
-    2966928,
-    2966929,
-    2966930,
-    2966945,
-    2966948,
-    2968775,
-    2968787,
-    2968791,
-    2968803,
-    2968807,
-    2969027,
-    2969031,
-    2969043,
-    2969059,
-    2969063,
-    2969604,
-    2969605,
-    2969606,
-    2969617,
-    2969618,
-    2969620,
-    2969621,
-    2969622,
-    2969633,
-    2969636,
-    2969637,
-    2969668,
-    2969670,
-    2969680,
-    2969681,
-    2969682,
-    2969684,
-    2969686,
-    2969696,
-    2969697,
-    2969700,
-    2969732,
-    2969733,
-    2969734,
-    2969744,
-    2969745,
-    2969746,
-    2969748,
-    2969749,
-    2969750,
-    2969761,
-    2969764,
-    2970628,
-    2970629,
-    2970630,
-    2970641,
-    2970642,
-    2970644,
-    2970645,
-    2970646,
-    2970657,
-    2970660,
-    2970661,
-    2972871,
-    2972883,
-    2972887,
-    2972899,
-    2972903,
-    3014976,
-    3014977,
-    3014978,
-    3014980,
-    3014982,
-    3014992,
-    3014993,
-    3014994,
-    3014996,
-    3014998,
-    3015008,
-    3015009,
-    3015010,
-    3015012,
-    3015014,
-    3015937,
-    3015938,
-    3015940,
-    3015941,
-    3015942,
-    3015953,
-    3015954,
-    3015956,
-    3015957,
-    3015958,
-    3015969,
-    3015970,
-    3015972,
-    3015973,
-    3015974,
-    3016000,
-    3016001,
-    3016002,
-    3016004,
-    3016006,
-    3016016,
-    3016017,
-    3016018,
-    3016020,
-    3016022,
-    3016032,
-    3016033,
-    3016034,
-    3016036,
-    3016038,
-    3016064,
-    3016065,
-    3016066,
-    3016068,
-    3016069,
-    3016070,
-    3016080,
-    3016081,
-    3016082,
-    3016084,
-    3016085,
-    3016086,
-    3016096,
-    3016097,
-    3016098,
-    3016100,
-    3016101,
-    3016102,
-    3018179,
-    3018183,
-    3018195,
-    3018199,
-    3018211,
-    3018215,
-    3018753,
-    3018754,
-    3018756,
-    3018757,
-    3018758,
-    3018769,
-    3018770,
-    3018772,
-    3018773,
-    3018774,
-    3018785,
-    3018786,
-    3018788,
-    3018789,
-    3018790,
-    3018816,
-    3018817,
-    3018818,
-    3018820,
-    3018822,
-    3018832,
-    3018833,
-    3018834,
-    3018836,
-    3018838,
-    3018848,
-    3018849,
-    3018850,
-    3018852,
-    3018854,
-    3018880,
-    3018881,
-    3018882,
-    3018884,
-    3018885,
-    3018886,
-    3018896,
-    3018897,
-    3018898,
-    3018900,
-    3018901,
-    3018902,
-    3018912,
-    3018913,
-    3018914,
-    3018916,
-    3018917,
-    3018918,
-    3019009,
-    3019010,
-    3019012,
-    3019013,
-    3019014,
-    3019025,
-    3019026,
-    3019028,
-    3019029,
-    3019030,
-    3019041,
-    3019042,
-    3019044,
-    3019045,
-    3019046,
-    3019072,
-    3019073,
-    3019074,
-    3019076,
-    3019078,
-    3019088,
-    3019089,
-    3019090,
-    3019092,
-    3019094,
-    3019104,
-    3019105,
-    3019106,
-    3019108,
-    3019110,
-    3019136,
-    3019137,
-    3019138,
-    3019140,
-    3019141,
-    3019142,
-    3019152,
-    3019153,
-    3019154,
-    3019156,
-    3019157,
-    3019158,
-    3019168,
-    3019169,
-    3019170,
-    3019172,
-    3019173,
-    3019174,
-    3019777,
-    3019778,
-    3019780,
-    3019781,
-    3019782,
-    3019793,
-    3019794,
-    3019796,
-    3019797,
-    3019798,
-    3019809,
-    3019810,
-    3019812,
-    3019813,
-    3019814,
-    3020033,
-    3020034,
-    3020036,
-    3020037,
-    3020038,
-    3020049,
-    3020050,
-    3020052,
-    3020053,
-    3020054,
-    3020065,
-    3020066,
-    3020068,
-    3020069,
-    3020070,
-    3022019,
-    3022023,
-    3022035,
-    3022039,
-    3022051,
-    3022055,
-    3022275,
-    3022279,
-    3022291,
-    3022295,
-    3022307,
-    3022311,
-    3031104,
-    3031105,
-    3031106,
-    3031108,
-    3031110,
-    3031120,
-    3031121,
-    3031122,
-    3031124,
-    3031126,
-    3031136,
-    3031137,
-    3031138,
-    3031140,
-    3031142,
-    3031360,
-    3031361,
-    3031362,
-    3031364,
-    3031366,
-    3031376,
-    3031377,
-    3031378,
-    3031380,
-    3031382,
-    3031392,
-    3031393,
-    3031394,
-    3031396,
-    3031398,
-    3032065,
-    3032066,
-    3032068,
-    3032069,
-    3032070,
-    3032081,
-    3032082,
-    3032084,
-    3032085,
-    3032086,
-    3032097,
-    3032098,
-    3032100,
-    3032101,
-    3032102,
-    3032128,
-    3032129,
-    3032130,
-    3032132,
-    3032134,
-    3032144,
-    3032145,
-    3032146,
-    3032148,
-    3032150,
-    3032160,
-    3032161,
-    3032162,
-    3032164,
-    3032166,
-    3032192,
-    3032193,
-    3032194,
-    3032196,
-    3032197,
-    3032198,
-    3032208,
-    3032209,
-    3032210,
-    3032212,
-    3032213,
-    3032214,
-    3032224,
-    3032225,
-    3032226,
-    3032228,
-    3032229,
-    3032230,
-    3032321,
-    3032322,
-    3032324,
-    3032325,
-    3032326,
-    3032337,
-    3032338,
-    3032340,
-    3032341,
-    3032342,
-    3032353,
-    3032354,
-    3032356,
-    3032357,
-    3032358,
-    3032384,
-    3032385,
-    3032386,
-    3032388,
-    3032390,
-    3032400,
-    3032401,
-    3032402,
-    3032404,
-    3032406,
-    3032416,
-    3032417,
-    3032418,
-    3032420,
-    3032422,
-    3032448,
-    3032449,
-    3032450,
-    3032452,
-    3032453,
-    3032454,
-    3032464,
-    3032465,
-    3032466,
-    3032468,
-    3032469,
-    3032470,
-    3032480,
-    3032481,
-    3032482,
-    3032484,
-    3032485,
-    3032486,
-    3034307,
-    3034311,
-    3034323,
-    3034327,
-    3034339,
-    3034343,
-    3034563,
-    3034567,
-    3034579,
-    3034583,
-    3034595,
-    3034599,
-    3035137,
-    3035138,
-    3035140,
-    3035141,
-    3035142,
-    3035153,
-    3035154,
-    3035156,
-    3035157,
-    3035158,
-    3035169,
-    3035170,
-    3035172,
-    3035173,
-    3035174,
-    3035200,
-    3035201,
-    3035202,
-    3035204,
-    3035206,
-    3035216,
-    3035217,
-    3035218,
-    3035220,
-    3035222,
-    3035232,
-    3035233,
-    3035234,
-    3035236,
-    3035238,
-    3035264,
-    3035265,
-    3035266,
-    3035268,
-    3035269,
-    3035270,
-    3035280,
-    3035281,
-    3035282,
-    3035284,
-    3035285,
-    3035286,
-    3035296,
-    3035297,
-    3035298,
-    3035300,
-    3035301,
-    3035302,
-    3036161,
-    3036162,
-    3036164,
-    3036165,
-    3036166,
-    3036177,
-    3036178,
-    3036180,
-    3036181,
-    3036182,
-    3036193,
-    3036194,
-    3036196,
-    3036197,
-    3036198,
-    3038403,
-    3038407,
-    3038419,
-    3038423,
-    3038435,
-    3038439,
-    3080512,
-    3080513,
-    3080514,
-    3080516,
-    3080517,
-    3080518,
-    3080520,
-    3080521,
-    3080522,
-    3080528,
-    3080529,
-    3080530,
-    3080536,
-    3080537,
-    3080538,
-    3080544,
-    3080545,
-    3080546,
-    3080548,
-    3080549,
-    3080550,
-    3080552,
-    3080553,
-    3080554,
-    3080575,
-    3081472,
-    3081473,
-    3081474,
-    3081476,
-    3081477,
-    3081478,
-    3081480,
-    3081481,
-    3081482,
-    3081488,
-    3081489,
-    3081490,
-    3081496,
-    3081497,
-    3081498,
-    3081504,
-    3081505,
-    3081506,
-    3081508,
-    3081509,
-    3081510,
-    3081512,
-    3081513,
-    3081514,
-    3081535,
-    3081536,
-    3081537,
-    3081538,
-    3081540,
-    3081541,
-    3081542,
-    3081544,
-    3081545,
-    3081546,
-    3081552,
-    3081553,
-    3081554,
-    3081560,
-    3081561,
-    3081562,
-    3081568,
-    3081569,
-    3081570,
-    3081572,
-    3081573,
-    3081574,
-    3081576,
-    3081577,
-    3081578,
-    3081599,
-    3081600,
-    3081601,
-    3081602,
-    3081604,
-    3081605,
-    3081606,
-    3081608,
-    3081609,
-    3081610,
-    3081616,
-    3081617,
-    3081618,
-    3081624,
-    3081625,
-    3081626,
-    3081632,
-    3081633,
-    3081634,
-    3081636,
-    3081637,
-    3081638,
-    3081640,
-    3081641,
-    3081642,
-    3081663,
-    3083715,
-    3083719,
-    3083723,
-    3083731,
-    3083739,
-    3083747,
-    3083751,
-    3083755,
-    3083775,
-    3084292,
-    3084293,
-    3084294,
-    3084296,
-    3084297,
-    3084298,
-    3084304,
-    3084305,
-    3084306,
-    3084308,
-    3084309,
-    3084310,
-    3084312,
-    3084313,
-    3084314,
-    3084320,
-    3084321,
-    3084322,
-    3084324,
-    3084325,
-    3084326,
-    3084328,
-    3084329,
-    3084330,
-    3084351,
-    3084356,
-    3084357,
-    3084358,
-    3084360,
-    3084361,
-    3084362,
-    3084368,
-    3084369,
-    3084370,
-    3084372,
-    3084373,
-    3084374,
-    3084376,
-    3084377,
-    3084378,
-    3084384,
-    3084385,
-    3084386,
-    3084388,
-    3084389,
-    3084390,
-    3084392,
-    3084393,
-    3084394,
-    3084415,
-    3084420,
-    3084421,
-    3084422,
-    3084424,
-    3084425,
-    3084426,
-    3084432,
-    3084433,
-    3084434,
-    3084436,
-    3084437,
-    3084438,
-    3084440,
-    3084441,
-    3084442,
-    3084448,
-    3084449,
-    3084450,
-    3084452,
-    3084453,
-    3084454,
-    3084456,
-    3084457,
-    3084458,
-    3084479,
-    3084544,
-    3084545,
-    3084546,
-    3084548,
-    3084549,
-    3084550,
-    3084552,
-    3084553,
-    3084554,
-    3084560,
-    3084561,
-    3084562,
-    3084568,
-    3084569,
-    3084570,
-    3084576,
-    3084577,
-    3084578,
-    3084580,
-    3084581,
-    3084582,
-    3084584,
-    3084585,
-    3084586,
-    3084607,
-    3084608,
-    3084609,
-    3084610,
-    3084612,
-    3084613,
-    3084614,
-    3084616,
-    3084617,
-    3084618,
-    3084624,
-    3084625,
-    3084626,
-    3084632,
-    3084633,
-    3084634,
-    3084640,
-    3084641,
-    3084642,
-    3084644,
-    3084645,
-    3084646,
-    3084648,
-    3084649,
-    3084650,
-    3084671,
-    3084672,
-    3084673,
-    3084674,
-    3084676,
-    3084677,
-    3084678,
-    3084680,
-    3084681,
-    3084682,
-    3084688,
-    3084689,
-    3084690,
-    3084696,
-    3084697,
-    3084698,
-    3084704,
-    3084705,
-    3084706,
-    3084708,
-    3084709,
-    3084710,
-    3084712,
-    3084713,
-    3084714,
-    3084735,
-    3085316,
-    3085317,
-    3085318,
-    3085320,
-    3085321,
-    3085322,
-    3085328,
-    3085329,
-    3085330,
-    3085332,
-    3085333,
-    3085334,
-    3085336,
-    3085337,
-    3085338,
-    3085344,
-    3085345,
-    3085346,
-    3085348,
-    3085349,
-    3085350,
-    3085352,
-    3085353,
-    3085354,
-    3085375,
-    3085568,
-    3085569,
-    3085570,
-    3085572,
-    3085573,
-    3085574,
-    3085576,
-    3085577,
-    3085578,
-    3085584,
-    3085585,
-    3085586,
-    3085592,
-    3085593,
-    3085594,
-    3085600,
-    3085601,
-    3085602,
-    3085604,
-    3085605,
-    3085606,
-    3085608,
-    3085609,
-    3085610,
-    3085631,
-    3087559,
-    3087563,
-    3087571,
-    3087575,
-    3087579,
-    3087587,
-    3087591,
-    3087595,
-    3087615,
-    3087811,
-    3087815,
-    3087819,
-    3087827,
-    3087835,
-    3087843,
-    3087847,
-    3087851,
-    3087871,
-    3096644,
-    3096645,
-    3096646,
-    3096648,
-    3096649,
-    3096650,
-    3096656,
-    3096657,
-    3096658,
-    3096660,
-    3096661,
-    3096662,
-    3096664,
-    3096665,
-    3096666,
-    3096672,
-    3096673,
-    3096674,
-    3096676,
-    3096677,
-    3096678,
-    3096680,
-    3096681,
-    3096682,
-    3096703,
-    3096896,
-    3096897,
-    3096898,
-    3096900,
-    3096901,
-    3096902,
-    3096904,
-    3096905,
-    3096906,
-    3096912,
-    3096913,
-    3096914,
-    3096920,
-    3096921,
-    3096922,
-    3096928,
-    3096929,
-    3096930,
-    3096932,
-    3096933,
-    3096934,
-    3096936,
-    3096937,
-    3096938,
-    3096959,
-    3097604,
-    3097605,
-    3097606,
-    3097608,
-    3097609,
-    3097610,
-    3097616,
-    3097617,
-    3097618,
-    3097620,
-    3097621,
-    3097622,
-    3097624,
-    3097625,
-    3097626,
-    3097632,
-    3097633,
-    3097634,
-    3097636,
-    3097637,
-    3097638,
-    3097640,
-    3097641,
-    3097642,
-    3097663,
-    3097668,
-    3097669,
-    3097670,
-    3097672,
-    3097673,
-    3097674,
-    3097680,
-    3097681,
-    3097682,
-    3097684,
-    3097685,
-    3097686,
-    3097688,
-    3097689,
-    3097690,
-    3097696,
-    3097697,
-    3097698,
-    3097700,
-    3097701,
-    3097702,
-    3097704,
-    3097705,
-    3097706,
-    3097727,
-    3097732,
-    3097733,
-    3097734,
-    3097736,
-    3097737,
-    3097738,
-    3097744,
-    3097745,
-    3097746,
-    3097748,
-    3097749,
-    3097750,
-    3097752,
-    3097753,
-    3097754,
-    3097760,
-    3097761,
-    3097762,
-    3097764,
-    3097765,
-    3097766,
-    3097768,
-    3097769,
-    3097770,
-    3097791,
-    3097856,
-    3097857,
-    3097858,
-    3097860,
-    3097861,
-    3097862,
-    3097864,
-    3097865,
-    3097866,
-    3097872,
-    3097873,
-    3097874,
-    3097880,
-    3097881,
-    3097882,
-    3097888,
-    3097889,
-    3097890,
-    3097892,
-    3097893,
-    3097894,
-    3097896,
-    3097897,
-    3097898,
-    3097919,
-    3097920,
-    3097921,
-    3097922,
-    3097924,
-    3097925,
-    3097926,
-    3097928,
-    3097929,
-    3097930,
-    3097936,
-    3097937,
-    3097938,
-    3097944,
-    3097945,
-    3097946,
-    3097952,
-    3097953,
-    3097954,
-    3097956,
-    3097957,
-    3097958,
-    3097960,
-    3097961,
-    3097962,
-    3097983,
-    3097984,
-    3097985,
-    3097986,
-    3097988,
-    3097989,
-    3097990,
-    3097992,
-    3097993,
-    3097994,
-    3098000,
-    3098001,
-    3098002,
-    3098008,
-    3098009,
-    3098010,
-    3098016,
-    3098017,
-    3098018,
-    3098020,
-    3098021,
-    3098022,
-    3098024,
-    3098025,
-    3098026,
-    3098047,
-    3099847,
-    3099851,
-    3099859,
-    3099863,
-    3099867,
-    3099875,
-    3099879,
-    3099883,
-    3099903,
-    3100099,
-    3100103,
-    3100107,
-    3100115,
-    3100123,
-    3100131,
-    3100135,
-    3100139,
-    3100159,
-    3100676,
-    3100677,
-    3100678,
-    3100680,
-    3100681,
-    3100682,
-    3100688,
-    3100689,
-    3100690,
-    3100692,
-    3100693,
-    3100694,
-    3100696,
-    3100697,
-    3100698,
-    3100704,
-    3100705,
-    3100706,
-    3100708,
-    3100709,
-    3100710,
-    3100712,
-    3100713,
-    3100714,
-    3100735,
-    3100740,
-    3100741,
-    3100742,
-    3100744,
-    3100745,
-    3100746,
-    3100752,
-    3100753,
-    3100754,
-    3100756,
-    3100757,
-    3100758,
-    3100760,
-    3100761,
-    3100762,
-    3100768,
-    3100769,
-    3100770,
-    3100772,
-    3100773,
-    3100774,
-    3100776,
-    3100777,
-    3100778,
-    3100799,
-    3100804,
-    3100805,
-    3100806,
-    3100808,
-    3100809,
-    3100810,
-    3100816,
-    3100817,
-    3100818,
-    3100820,
-    3100821,
-    3100822,
-    3100824,
-    3100825,
-    3100826,
-    3100832,
-    3100833,
-    3100834,
-    3100836,
-    3100837,
-    3100838,
-    3100840,
-    3100841,
-    3100842,
-    3100863,
-    3101700,
-    3101701,
-    3101702,
-    3101704,
-    3101705,
-    3101706,
-    3101712,
-    3101713,
-    3101714,
-    3101716,
-    3101717,
-    3101718,
-    3101720,
-    3101721,
-    3101722,
-    3101728,
-    3101729,
-    3101730,
-    3101732,
-    3101733,
-    3101734,
-    3101736,
-    3101737,
-    3101738,
-    3101759,
-    3103943,
-    3103947,
-    3103955,
-    3103959,
-    3103963,
-    3103971,
-    3103975,
-    3103979,
-    3103999,
-    3932480,
-    3932481,
-    3932484,
-    3932497,
-    3933441,
-    3933444,
-    3933445,
-    3933457,
-    3933505,
-    3933508,
-    3933520,
-    3933521,
-    3933569,
-    3933572,
-    3933585,
-    3935683,
-    3935687,
-    3935699,
-    3936260,
-    3936261,
-    3936273,
-    3936277,
-    3936324,
-    3936337,
-    3936340,
-    3936388,
-    3936401,
-    3936404,
-    3936580,
-    3936593,
-    3936644,
-    3936657,
-    3936900,
-    3936913,
-    3937285,
-    3937297,
-    3937300,
-    3937301,
-    3937541,
-    3937553,
-    3937797,
-    3937809,
-    3939527,
-    3939539,
-    3939543,
-    3939783,
-    3939795,
-    3940039,
-    3940051,
-    3949585,
-    3949589,
-    3949649,
-    3949713,
-    3949905,
-    3949969,
-    3950225,
-    3951827,
-    3951831,
-    3952083,
-    3952339,
-    3953685,
-    3955927,
-    3998016,
-    3998017,
-    3998018,
-    3998020,
-    3998022,
-    3998033,
-    3998034,
-    3998977,
-    3998978,
-    3998980,
-    3998981,
-    3998982,
-    3998993,
-    3998994,
-    3999009,
-    3999012,
-    3999013,
-    3999040,
-    3999041,
-    3999042,
-    3999044,
-    3999046,
-    3999056,
-    3999057,
-    3999058,
-    3999072,
-    3999073,
-    3999076,
-    3999104,
-    3999105,
-    3999106,
-    3999108,
-    3999109,
-    3999110,
-    3999120,
-    3999121,
-    3999122,
-    3999137,
-    3999140,
-    4001219,
-    4001223,
-    4001235,
-    4001251,
-    4001255,
-    4001796,
-    4001797,
-    4001798,
-    4001809,
-    4001810,
-    4001813,
-    4001814,
-    4001860,
-    4001862,
-    4001872,
-    4001873,
-    4001874,
-    4001876,
-    4001878,
-    4001888,
-    4001889,
-    4001892,
-    4001924,
-    4001925,
-    4001926,
-    4001936,
-    4001937,
-    4001938,
-    4001940,
-    4001941,
-    4001942,
-    4001953,
-    4001956,
-    4002112,
-    4002113,
-    4002114,
-    4002116,
-    4002118,
-    4002129,
-    4002130,
-    4002176,
-    4002177,
-    4002178,
-    4002180,
-    4002181,
-    4002182,
-    4002192,
-    4002193,
-    4002194,
-    4002209,
-    4002212,
-    4002433,
-    4002436,
-    4002437,
-    4002438,
-    4002449,
-    4002450,
-    4002820,
-    4002821,
-    4002822,
-    4002833,
-    4002834,
-    4002836,
-    4002837,
-    4002838,
-    4002849,
-    4002852,
-    4002853,
-    4003073,
-    4003074,
-    4003076,
-    4003077,
-    4003078,
-    4003089,
-    4003090,
-    4003105,
-    4003108,
-    4003109,
-    4003329,
-    4003332,
-    4003333,
-    4003334,
-    4003345,
-    4003346,
-    4003348,
-    4003349,
-    4003361,
-    4003364,
-    4003365,
-    4005063,
-    4005075,
-    4005079,
-    4005091,
-    4005095,
-    4005315,
-    4005319,
-    4005331,
-    4005347,
-    4005351,
-    4005571,
-    4005575,
-    4005587,
-    4005591,
-    4005603,
-    4005607,
-    4015108,
-    4015109,
-    4015110,
-    4015121,
-    4015122,
-    4015125,
-    4015126,
-    4015172,
-    4015174,
-    4015184,
-    4015185,
-    4015186,
-    4015188,
-    4015190,
-    4015200,
-    4015201,
-    4015204,
-    4015236,
-    4015237,
-    4015238,
-    4015248,
-    4015249,
-    4015250,
-    4015252,
-    4015253,
-    4015254,
-    4015265,
-    4015268,
-    4015424,
-    4015425,
-    4015426,
-    4015428,
-    4015430,
-    4015441,
-    4015442,
-    4015488,
-    4015489,
-    4015490,
-    4015492,
-    4015493,
-    4015494,
-    4015504,
-    4015505,
-    4015506,
-    4015521,
-    4015524,
-    4015745,
-    4015748,
-    4015749,
-    4015750,
-    4015761,
-    4015762,
-    4017351,
-    4017363,
-    4017367,
-    4017379,
-    4017383,
-    4017603,
-    4017607,
-    4017619,
-    4017635,
-    4017639,
-    4017859,
-    4017863,
-    4017875,
-    4017879,
-    4017891,
-    4017895,
-    4019204,
-    4019205,
-    4019206,
-    4019217,
-    4019218,
-    4019221,
-    4019222,
-    4021447,
-    4021459,
-    4021463,
-    4021475,
-    4021479,
-    4063552,
-    4063553,
-    4063554,
-    4063556,
-    4063558,
-    4063569,
-    4063570,
-    4063586,
-    4063590,
-    4064513,
-    4064514,
-    4064516,
-    4064517,
-    4064518,
-    4064529,
-    4064530,
-    4064545,
-    4064546,
-    4064548,
-    4064549,
-    4064550,
-    4064576,
-    4064577,
-    4064578,
-    4064580,
-    4064582,
-    4064592,
-    4064593,
-    4064594,
-    4064608,
-    4064609,
-    4064610,
-    4064612,
-    4064614,
-    4064640,
-    4064641,
-    4064642,
-    4064644,
-    4064645,
-    4064646,
-    4064656,
-    4064657,
-    4064658,
-    4064672,
-    4064673,
-    4064674,
-    4064676,
-    4064677,
-    4064678,
-    4066755,
-    4066759,
-    4066771,
-    4066787,
-    4066791,
-    4067332,
-    4067333,
-    4067334,
-    4067345,
-    4067346,
-    4067349,
-    4067350,
-    4067362,
-    4067366,
-    4067396,
-    4067398,
-    4067408,
-    4067409,
-    4067410,
-    4067412,
-    4067414,
-    4067424,
-    4067425,
-    4067426,
-    4067428,
-    4067430,
-    4067460,
-    4067461,
-    4067462,
-    4067472,
-    4067473,
-    4067474,
-    4067476,
-    4067477,
-    4067478,
-    4067488,
-    4067489,
-    4067490,
-    4067492,
-    4067493,
-    4067494,
-    4067648,
-    4067649,
-    4067650,
-    4067652,
-    4067654,
-    4067665,
-    4067666,
-    4067682,
-    4067686,
-    4067712,
-    4067713,
-    4067714,
-    4067716,
-    4067717,
-    4067718,
-    4067728,
-    4067729,
-    4067730,
-    4067744,
-    4067745,
-    4067746,
-    4067748,
-    4067749,
-    4067750,
-    4067968,
-    4067969,
-    4067970,
-    4067972,
-    4067973,
-    4067974,
-    4067985,
-    4067986,
-    4067989,
-    4067990,
-    4068002,
-    4068006,
-    4068356,
-    4068357,
-    4068358,
-    4068369,
-    4068370,
-    4068372,
-    4068373,
-    4068374,
-    4068385,
-    4068386,
-    4068388,
-    4068389,
-    4068390,
-    4068609,
-    4068610,
-    4068612,
-    4068613,
-    4068614,
-    4068625,
-    4068626,
-    4068641,
-    4068642,
-    4068644,
-    4068645,
-    4068646,
-    4068865,
-    4068866,
-    4068868,
-    4068869,
-    4068870,
-    4068881,
-    4068882,
-    4068884,
-    4068885,
-    4068886,
-    4068897,
-    4068898,
-    4068900,
-    4068901,
-    4068902,
-    4070599,
-    4070611,
-    4070615,
-    4070627,
-    4070631,
-    4070851,
-    4070855,
-    4070867,
-    4070883,
-    4070887,
-    4071107,
-    4071111,
-    4071123,
-    4071127,
-    4071139,
-    4071143,
-    4080644,
-    4080645,
-    4080646,
-    4080657,
-    4080658,
-    4080661,
-    4080662,
-    4080674,
-    4080678,
-    4080708,
-    4080710,
-    4080720,
-    4080721,
-    4080722,
-    4080724,
-    4080726,
-    4080736,
-    4080737,
-    4080738,
-    4080740,
-    4080742,
-    4080772,
-    4080773,
-    4080774,
-    4080784,
-    4080785,
-    4080786,
-    4080788,
-    4080789,
-    4080790,
-    4080800,
-    4080801,
-    4080802,
-    4080804,
-    4080805,
-    4080806,
-    4080960,
-    4080961,
-    4080962,
-    4080964,
-    4080966,
-    4080977,
-    4080978,
-    4080994,
-    4080998,
-    4081024,
-    4081025,
-    4081026,
-    4081028,
-    4081029,
-    4081030,
-    4081040,
-    4081041,
-    4081042,
-    4081056,
-    4081057,
-    4081058,
-    4081060,
-    4081061,
-    4081062,
-    4081280,
-    4081281,
-    4081282,
-    4081284,
-    4081285,
-    4081286,
-    4081297,
-    4081298,
-    4081301,
-    4081302,
-    4081314,
-    4081318,
-    4082887,
-    4082899,
-    4082903,
-    4082915,
-    4082919,
-    4083139,
-    4083143,
-    4083155,
-    4083171,
-    4083175,
-    4083395,
-    4083399,
-    4083411,
-    4083415,
-    4083427,
-    4083431,
-    4084740,
-    4084741,
-    4084742,
-    4084753,
-    4084754,
-    4084757,
-    4084758,
-    4084770,
-    4084774,
-    4086983,
-    4086995,
-    4086999,
-    4087011,
-    4087015,
-    4129088,
-    4129089,
-    4129090,
-    4129092,
-    4129093,
-    4129094,
-    4129096,
-    4129097,
-    4129098,
-    4129105,
-    4129106,
-    4129109,
-    4129110,
-    4129113,
-    4129114,
-    4129122,
-    4129126,
-    4129130,
-    4129151,
-    4130048,
-    4130049,
-    4130050,
-    4130052,
-    4130053,
-    4130054,
-    4130056,
-    4130057,
-    4130058,
-    4130064,
-    4130065,
-    4130066,
-    4130068,
-    4130069,
-    4130070,
-    4130072,
-    4130073,
-    4130074,
-    4130080,
-    4130081,
-    4130082,
-    4130084,
-    4130085,
-    4130086,
-    4130088,
-    4130089,
-    4130090,
-    4130111,
-    4130112,
-    4130113,
-    4130114,
-    4130116,
-    4130117,
-    4130118,
-    4130120,
-    4130121,
-    4130122,
-    4130128,
-    4130129,
-    4130130,
-    4130132,
-    4130133,
-    4130134,
-    4130136,
-    4130137,
-    4130138,
-    4130144,
-    4130145,
-    4130146,
-    4130148,
-    4130149,
-    4130150,
-    4130152,
-    4130153,
-    4130154,
-    4130175,
-    4130176,
-    4130177,
-    4130178,
-    4130180,
-    4130181,
-    4130182,
-    4130184,
-    4130185,
-    4130186,
-    4130192,
-    4130193,
-    4130194,
-    4130196,
-    4130197,
-    4130198,
-    4130200,
-    4130201,
-    4130202,
-    4130208,
-    4130209,
-    4130210,
-    4130212,
-    4130213,
-    4130214,
-    4130216,
-    4130217,
-    4130218,
-    4130239,
-    4132291,
-    4132295,
-    4132299,
-    4132307,
-    4132311,
-    4132315,
-    4132323,
-    4132327,
-    4132331,
-    4132351,
-    4132864,
-    4132865,
-    4132866,
-    4132868,
-    4132869,
-    4132870,
-    4132872,
-    4132873,
-    4132874,
-    4132881,
-    4132882,
-    4132885,
-    4132886,
-    4132889,
-    4132890,
-    4132898,
-    4132902,
-    4132906,
-    4132927,
-    4132928,
-    4132929,
-    4132930,
-    4132932,
-    4132933,
-    4132934,
-    4132936,
-    4132937,
-    4132938,
-    4132944,
-    4132945,
-    4132946,
-    4132948,
-    4132949,
-    4132950,
-    4132952,
-    4132953,
-    4132954,
-    4132960,
-    4132961,
-    4132962,
-    4132964,
-    4132965,
-    4132966,
-    4132968,
-    4132969,
-    4132970,
-    4132991,
-    4132992,
-    4132993,
-    4132994,
-    4132996,
-    4132997,
-    4132998,
-    4133000,
-    4133001,
-    4133002,
-    4133008,
-    4133009,
-    4133010,
-    4133012,
-    4133013,
-    4133014,
-    4133016,
-    4133017,
-    4133018,
-    4133024,
-    4133025,
-    4133026,
-    4133028,
-    4133029,
-    4133030,
-    4133032,
-    4133033,
-    4133034,
-    4133055,
-    4133184,
-    4133185,
-    4133186,
-    4133188,
-    4133189,
-    4133190,
-    4133192,
-    4133193,
-    4133194,
-    4133201,
-    4133202,
-    4133205,
-    4133206,
-    4133209,
-    4133210,
-    4133218,
-    4133222,
-    4133226,
-    4133247,
-    4133248,
-    4133249,
-    4133250,
-    4133252,
-    4133253,
-    4133254,
-    4133256,
-    4133257,
-    4133258,
-    4133264,
-    4133265,
-    4133266,
-    4133268,
-    4133269,
-    4133270,
-    4133272,
-    4133273,
-    4133274,
-    4133280,
-    4133281,
-    4133282,
-    4133284,
-    4133285,
-    4133286,
-    4133288,
-    4133289,
-    4133290,
-    4133311,
-    4133504,
-    4133505,
-    4133506,
-    4133508,
-    4133509,
-    4133510,
-    4133512,
-    4133513,
-    4133514,
-    4133521,
-    4133522,
-    4133525,
-    4133526,
-    4133529,
-    4133530,
-    4133538,
-    4133542,
-    4133546,
-    4133567,
-    4133888,
-    4133889,
-    4133890,
-    4133892,
-    4133893,
-    4133894,
-    4133896,
-    4133897,
-    4133898,
-    4133904,
-    4133905,
-    4133906,
-    4133908,
-    4133909,
-    4133910,
-    4133912,
-    4133913,
-    4133914,
-    4133920,
-    4133921,
-    4133922,
-    4133924,
-    4133925,
-    4133926,
-    4133928,
-    4133929,
-    4133930,
-    4133951,
-    4134144,
-    4134145,
-    4134146,
-    4134148,
-    4134149,
-    4134150,
-    4134152,
-    4134153,
-    4134154,
-    4134160,
-    4134161,
-    4134162,
-    4134164,
-    4134165,
-    4134166,
-    4134168,
-    4134169,
-    4134170,
-    4134176,
-    4134177,
-    4134178,
-    4134180,
-    4134181,
-    4134182,
-    4134184,
-    4134185,
-    4134186,
-    4134207,
-    4134400,
-    4134401,
-    4134402,
-    4134404,
-    4134405,
-    4134406,
-    4134408,
-    4134409,
-    4134410,
-    4134416,
-    4134417,
-    4134418,
-    4134420,
-    4134421,
-    4134422,
-    4134424,
-    4134425,
-    4134426,
-    4134432,
-    4134433,
-    4134434,
-    4134436,
-    4134437,
-    4134438,
-    4134440,
-    4134441,
-    4134442,
-    4134463,
-    4136131,
-    4136135,
-    4136139,
-    4136147,
-    4136151,
-    4136155,
-    4136163,
-    4136167,
-    4136171,
-    4136191,
-    4136387,
-    4136391,
-    4136395,
-    4136403,
-    4136407,
-    4136411,
-    4136419,
-    4136423,
-    4136427,
-    4136447,
-    4136643,
-    4136647,
-    4136651,
-    4136659,
-    4136663,
-    4136667,
-    4136675,
-    4136679,
-    4136683,
-    4136703,
-    4146176,
-    4146177,
-    4146178,
-    4146180,
-    4146181,
-    4146182,
-    4146184,
-    4146185,
-    4146186,
-    4146193,
-    4146194,
-    4146197,
-    4146198,
-    4146201,
-    4146202,
-    4146210,
-    4146214,
-    4146218,
-    4146239,
-    4146240,
-    4146241,
-    4146242,
-    4146244,
-    4146245,
-    4146246,
-    4146248,
-    4146249,
-    4146250,
-    4146256,
-    4146257,
-    4146258,
-    4146260,
-    4146261,
-    4146262,
-    4146264,
-    4146265,
-    4146266,
-    4146272,
-    4146273,
-    4146274,
-    4146276,
-    4146277,
-    4146278,
-    4146280,
-    4146281,
-    4146282,
-    4146303,
-    4146304,
-    4146305,
-    4146306,
-    4146308,
-    4146309,
-    4146310,
-    4146312,
-    4146313,
-    4146314,
-    4146320,
-    4146321,
-    4146322,
-    4146324,
-    4146325,
-    4146326,
-    4146328,
-    4146329,
-    4146330,
-    4146336,
-    4146337,
-    4146338,
-    4146340,
-    4146341,
-    4146342,
-    4146344,
-    4146345,
-    4146346,
-    4146367,
-    4146496,
-    4146497,
-    4146498,
-    4146500,
-    4146501,
-    4146502,
-    4146504,
-    4146505,
-    4146506,
-    4146513,
-    4146514,
-    4146517,
-    4146518,
-    4146521,
-    4146522,
-    4146530,
-    4146534,
-    4146538,
-    4146559,
-    4146560,
-    4146561,
-    4146562,
-    4146564,
-    4146565,
-    4146566,
-    4146568,
-    4146569,
-    4146570,
-    4146576,
-    4146577,
-    4146578,
-    4146580,
-    4146581,
-    4146582,
-    4146584,
-    4146585,
-    4146586,
-    4146592,
-    4146593,
-    4146594,
-    4146596,
-    4146597,
-    4146598,
-    4146600,
-    4146601,
-    4146602,
-    4146623,
-    4146816,
-    4146817,
-    4146818,
-    4146820,
-    4146821,
-    4146822,
-    4146824,
-    4146825,
-    4146826,
-    4146833,
-    4146834,
-    4146837,
-    4146838,
-    4146841,
-    4146842,
-    4146850,
-    4146854,
-    4146858,
-    4146879,
-    4148419,
-    4148423,
-    4148427,
-    4148435,
-    4148439,
-    4148443,
-    4148451,
-    4148455,
-    4148459,
-    4148479,
-    4148675,
-    4148679,
-    4148683,
-    4148691,
-    4148695,
-    4148699,
-    4148707,
-    4148711,
-    4148715,
-    4148735,
-    4148931,
-    4148935,
-    4148939,
-    4148947,
-    4148951,
-    4148955,
-    4148963,
-    4148967,
-    4148971,
-    4148991,
-    4150272,
-    4150273,
-    4150274,
-    4150276,
-    4150277,
-    4150278,
-    4150280,
-    4150281,
-    4150282,
-    4150289,
-    4150290,
-    4150293,
-    4150294,
-    4150297,
-    4150298,
-    4150306,
-    4150310,
-    4150314,
-    4150335,
-    4152515,
-    4152519,
-    4152523,
-    4152531,
-    4152535,
-    4152539,
-    4152547,
-    4152551,
-    4152555,
-    4152575,
-    5570561,
-    5570564,
-    5570565,
-    5570566,
-    5570577,
-    5570578,
-    5570581,
-    5570582,
-    5570628,
-    5570629,
-    5570630,
-    5570640,
-    5570641,
-    5570642,
-    5570644,
-    5570645,
-    5570646,
-    5570656,
-    5570657,
-    5570660,
-    5570661,
-    5570880,
-    5570881,
-    5570882,
-    5570884,
-    5570885,
-    5570886,
-    5570897,
-    5570898,
-    5570901,
-    5570902,
-    5571600,
-    5571601,
-    5571602,
-    5571604,
-    5571605,
-    5571606,
-    5571616,
-    5571617,
-    5571620,
-    5571621,
-    5571668,
-    5571669,
-    5571670,
-    5571680,
-    5571681,
-    5571684,
-    5571685,
-    5571841,
-    5571842,
-    5571844,
-    5571845,
-    5571846,
-    5571857,
-    5571858,
-    5571860,
-    5571861,
-    5571862,
-    5571873,
-    5571876,
-    5571877,
-    5571905,
-    5571906,
-    5571908,
-    5571909,
-    5571910,
-    5571920,
-    5571921,
-    5571922,
-    5571924,
-    5571925,
-    5571926,
-    5571936,
-    5571937,
-    5571940,
-    5571941,
-    5572868,
-    5572869,
-    5572881,
-    5572884,
-    5572885,
-    5572897,
-    5572900,
-    5572901,
-    5572932,
-    5572933,
-    5572945,
-    5572948,
-    5572949,
-    5572960,
-    5572961,
-    5572964,
-    5574993,
-    5574994,
-    5575953,
-    5575954,
-    5575957,
-    5575958,
-    5575969,
-    5575973,
-    5576033,
-    5576993,
-    5576997,
-    5587985,
-    5587986,
-    5587989,
-    5587990,
-    5588053,
-    5588054,
-    5588065,
-    5588069,
-    5588305,
-    5588306,
-    5588309,
-    5588310,
-    5589025,
-    5589029,
-    5589269,
-    5589285,
-    5589333,
-    5589345,
-    5636100,
-    5636101,
-    5636102,
-    5636113,
-    5636114,
-    5636117,
-    5636118,
-    5636164,
-    5636166,
-    5636176,
-    5636177,
-    5636178,
-    5636180,
-    5636182,
-    5636192,
-    5636193,
-    5636194,
-    5636196,
-    5636198,
-    5636416,
-    5636417,
-    5636418,
-    5636420,
-    5636422,
-    5636433,
-    5636434,
-    5636450,
-    5636454,
-    5637124,
-    5637125,
-    5637126,
-    5637137,
-    5637138,
-    5637140,
-    5637141,
-    5637142,
-    5637153,
-    5637154,
-    5637156,
-    5637157,
-    5637158,
-    5637188,
-    5637190,
-    5637200,
-    5637201,
-    5637202,
-    5637204,
-    5637206,
-    5637216,
-    5637217,
-    5637218,
-    5637220,
-    5637222,
-    5637377,
-    5637378,
-    5637380,
-    5637381,
-    5637382,
-    5637393,
-    5637394,
-    5637409,
-    5637410,
-    5637412,
-    5637413,
-    5637414,
-    5637440,
-    5637441,
-    5637442,
-    5637444,
-    5637446,
-    5637456,
-    5637457,
-    5637458,
-    5637472,
-    5637473,
-    5637474,
-    5637476,
-    5637478,
-    5638148,
-    5638149,
-    5638161,
-    5638164,
-    5638165,
-    5638212,
-    5638224,
-    5638225,
-    5638228,
-    5638401,
-    5638404,
-    5638405,
-    5638417,
-    5638433,
-    5638436,
-    5638437,
-    5638464,
-    5638465,
-    5638468,
-    5638480,
-    5638481,
-    5638496,
-    5638497,
-    5638500,
-    5640196,
-    5640197,
-    5640198,
-    5640209,
-    5640210,
-    5640213,
-    5640214,
-    5640226,
-    5640230,
-    5640260,
-    5640262,
-    5640272,
-    5640273,
-    5640274,
-    5640276,
-    5640278,
-    5640288,
-    5640289,
-    5640290,
-    5640292,
-    5640294,
-    5640512,
-    5640513,
-    5640514,
-    5640529,
-    5640530,
-    5640546,
-    5641220,
-    5641221,
-    5641222,
-    5641233,
-    5641234,
-    5641236,
-    5641237,
-    5641238,
-    5641249,
-    5641250,
-    5641252,
-    5641253,
-    5641254,
-    5641284,
-    5641286,
-    5641296,
-    5641297,
-    5641298,
-    5641300,
-    5641302,
-    5641312,
-    5641313,
-    5641314,
-    5641316,
-    5641318,
-    5641473,
-    5641474,
-    5641476,
-    5641477,
-    5641478,
-    5641489,
-    5641490,
-    5641505,
-    5641506,
-    5641508,
-    5641509,
-    5641510,
-    5641536,
-    5641537,
-    5641538,
-    5641552,
-    5641553,
-    5641554,
-    5641568,
-    5641569,
-    5641570,
-    5642244,
-    5642245,
-    5642257,
-    5642260,
-    5642261,
-    5642273,
-    5642276,
-    5642277,
-    5642308,
-    5642320,
-    5642321,
-    5642324,
-    5642336,
-    5642337,
-    5642340,
-    5642497,
-    5642500,
-    5642501,
-    5642513,
-    5642529,
-    5642532,
-    5642533,
-    5642560,
-    5642561,
-    5642576,
-    5642577,
-    5642592,
-    5642593,
-    5653508,
-    5653509,
-    5653510,
-    5653521,
-    5653522,
-    5653525,
-    5653526,
-    5653538,
-    5653542,
-    5653572,
-    5653574,
-    5653584,
-    5653585,
-    5653586,
-    5653588,
-    5653590,
-    5653600,
-    5653601,
-    5653602,
-    5653604,
-    5653606,
-    5653824,
-    5653825,
-    5653826,
-    5653828,
-    5653830,
-    5653841,
-    5653842,
-    5653858,
-    5653862,
-    5654532,
-    5654533,
-    5654545,
-    5654548,
-    5654549,
-    5654561,
-    5654564,
-    5654565,
-    5654596,
-    5654608,
-    5654609,
-    5654612,
-    5654624,
-    5654625,
-    5654628,
-    5654785,
-    5654788,
-    5654789,
-    5654801,
-    5654817,
-    5654820,
-    5654821,
-    5654848,
-    5654849,
-    5654852,
-    5654864,
-    5654865,
-    5654880,
-    5654881,
-    5654884,
-    5657604,
-    5657605,
-    5657606,
-    5657617,
-    5657618,
-    5657621,
-    5657622,
-    5657634,
-    5657638,
-    5657668,
-    5657670,
-    5657680,
-    5657681,
-    5657682,
-    5657684,
-    5657686,
-    5657696,
-    5657697,
-    5657698,
-    5657700,
-    5657702,
-    5657920,
-    5657921,
-    5657922,
-    5657937,
-    5657938,
-    5658628,
-    5658629,
-    5658641,
-    5658644,
-    5658645,
-    5658657,
-    5658660,
-    5658661,
-    5658692,
-    5658704,
-    5658705,
-    5658708,
-    5658720,
-    5658721,
-    5658724,
-    5658881,
-    5658884,
-    5658885,
-    5658897,
-    5658944,
-    5658945,
-    5658960,
-    5658961,
-    5701636,
-    5701637,
-    5701638,
-    5701640,
-    5701641,
-    5701649,
-    5701650,
-    5701653,
-    5701654,
-    5701657,
-    5701658,
-    5701700,
-    5701702,
-    5701704,
-    5701705,
-    5701706,
-    5701712,
-    5701713,
-    5701714,
-    5701716,
-    5701718,
-    5701720,
-    5701721,
-    5701722,
-    5701728,
-    5701729,
-    5701730,
-    5701732,
-    5701734,
-    5701736,
-    5701737,
-    5701738,
-    5701759,
-    5701952,
-    5701953,
-    5701954,
-    5701956,
-    5701958,
-    5701960,
-    5701961,
-    5701962,
-    5701969,
-    5701970,
-    5701977,
-    5701978,
-    5701986,
-    5701990,
-    5701994,
-    5702015,
-    5702660,
-    5702661,
-    5702662,
-    5702664,
-    5702665,
-    5702666,
-    5702673,
-    5702674,
-    5702676,
-    5702677,
-    5702678,
-    5702680,
-    5702681,
-    5702682,
-    5702689,
-    5702690,
-    5702692,
-    5702693,
-    5702694,
-    5702696,
-    5702697,
-    5702698,
-    5702719,
-    5702724,
-    5702726,
-    5702728,
-    5702729,
-    5702730,
-    5702736,
-    5702737,
-    5702738,
-    5702740,
-    5702742,
-    5702744,
-    5702745,
-    5702746,
-    5702752,
-    5702753,
-    5702754,
-    5702756,
-    5702758,
-    5702760,
-    5702761,
-    5702762,
-    5702783,
-    5702913,
-    5702914,
-    5702916,
-    5702917,
-    5702918,
-    5702920,
-    5702921,
-    5702922,
-    5702929,
-    5702930,
-    5702936,
-    5702937,
-    5702938,
-    5702945,
-    5702946,
-    5702948,
-    5702949,
-    5702950,
-    5702952,
-    5702953,
-    5702954,
-    5702975,
-    5702976,
-    5702977,
-    5702978,
-    5702980,
-    5702982,
-    5702984,
-    5702985,
-    5702986,
-    5702992,
-    5702993,
-    5702994,
-    5703000,
-    5703001,
-    5703002,
-    5703008,
-    5703009,
-    5703010,
-    5703012,
-    5703014,
-    5703016,
-    5703017,
-    5703018,
-    5703039,
-    5703684,
-    5703685,
-    5703697,
-    5703700,
-    5703701,
-    5703705,
-    5703748,
-    5703760,
-    5703761,
-    5703764,
-    5703768,
-    5703807,
-    5703937,
-    5703940,
-    5703941,
-    5703945,
-    5703953,
-    5703961,
-    5703969,
-    5703972,
-    5703973,
-    5703977,
-    5703999,
-    5704000,
-    5704001,
-    5704004,
-    5704008,
-    5704016,
-    5704017,
-    5704024,
-    5704032,
-    5704033,
-    5704036,
-    5704040,
-    5704063,
-    5705732,
-    5705733,
-    5705734,
-    5705736,
-    5705737,
-    5705738,
-    5705745,
-    5705746,
-    5705749,
-    5705750,
-    5705753,
-    5705754,
-    5705762,
-    5705766,
-    5705770,
-    5705791,
-    5705796,
-    5705798,
-    5705800,
-    5705801,
-    5705802,
-    5705808,
-    5705809,
-    5705810,
-    5705812,
-    5705814,
-    5705816,
-    5705817,
-    5705818,
-    5705824,
-    5705825,
-    5705826,
-    5705828,
-    5705830,
-    5705832,
-    5705833,
-    5705834,
-    5705855,
-    5706048,
-    5706049,
-    5706050,
-    5706056,
-    5706057,
-    5706058,
-    5706065,
-    5706066,
-    5706073,
-    5706074,
-    5706082,
-    5706090,
-    5706756,
-    5706757,
-    5706758,
-    5706760,
-    5706761,
-    5706762,
-    5706769,
-    5706770,
-    5706772,
-    5706773,
-    5706774,
-    5706776,
-    5706777,
-    5706778,
-    5706785,
-    5706786,
-    5706788,
-    5706789,
-    5706790,
-    5706792,
-    5706793,
-    5706794,
-    5706815,
-    5706820,
-    5706822,
-    5706824,
-    5706825,
-    5706826,
-    5706832,
-    5706833,
-    5706834,
-    5706836,
-    5706838,
-    5706840,
-    5706841,
-    5706842,
-    5706848,
-    5706849,
-    5706850,
-    5706852,
-    5706854,
-    5706856,
-    5706857,
-    5706858,
-    5706879,
-    5707009,
-    5707010,
-    5707012,
-    5707013,
-    5707014,
-    5707016,
-    5707017,
-    5707018,
-    5707025,
-    5707026,
-    5707032,
-    5707033,
-    5707034,
-    5707041,
-    5707042,
-    5707044,
-    5707045,
-    5707046,
-    5707048,
-    5707049,
-    5707050,
-    5707071,
-    5707072,
-    5707073,
-    5707074,
-    5707080,
-    5707081,
-    5707082,
-    5707088,
-    5707089,
-    5707090,
-    5707096,
-    5707097,
-    5707098,
-    5707104,
-    5707105,
-    5707106,
-    5707112,
-    5707113,
-    5707114,
-    5707780,
-    5707781,
-    5707785,
-    5707793,
-    5707796,
-    5707797,
-    5707801,
-    5707809,
-    5707812,
-    5707813,
-    5707817,
-    5707839,
-    5707844,
-    5707848,
-    5707856,
-    5707857,
-    5707860,
-    5707864,
-    5707872,
-    5707873,
-    5707876,
-    5707880,
-    5707903,
-    5708033,
-    5708036,
-    5708037,
-    5708041,
-    5708049,
-    5708057,
-    5708065,
-    5708068,
-    5708069,
-    5708073,
-    5708095,
-    5708096,
-    5708097,
-    5708104,
-    5708112,
-    5708113,
-    5708120,
-    5708128,
-    5708129,
-    5708136,
-    5719044,
-    5719045,
-    5719046,
-    5719048,
-    5719049,
-    5719050,
-    5719057,
-    5719058,
-    5719061,
-    5719062,
-    5719065,
-    5719066,
-    5719074,
-    5719078,
-    5719082,
-    5719103,
-    5719108,
-    5719110,
-    5719112,
-    5719113,
-    5719114,
-    5719120,
-    5719121,
-    5719122,
-    5719124,
-    5719126,
-    5719128,
-    5719129,
-    5719130,
-    5719136,
-    5719137,
-    5719138,
-    5719140,
-    5719142,
-    5719144,
-    5719145,
-    5719146,
-    5719167,
-    5719360,
-    5719361,
-    5719362,
-    5719364,
-    5719366,
-    5719368,
-    5719369,
-    5719370,
-    5719377,
-    5719378,
-    5719385,
-    5719386,
-    5719394,
-    5719398,
-    5719402,
-    5719423,
-    5720068,
-    5720069,
-    5720073,
-    5720081,
-    5720084,
-    5720085,
-    5720089,
-    5720097,
-    5720100,
-    5720101,
-    5720105,
-    5720127,
-    5720132,
-    5720136,
-    5720144,
-    5720145,
-    5720148,
-    5720152,
-    5720160,
-    5720161,
-    5720164,
-    5720168,
-    5720191,
-    5720321,
-    5720324,
-    5720325,
-    5720329,
-    5720337,
-    5720345,
-    5720353,
-    5720356,
-    5720357,
-    5720361,
-    5720383,
-    5720384,
-    5720385,
-    5720388,
-    5720392,
-    5720400,
-    5720401,
-    5720408,
-    5720416,
-    5720417,
-    5720420,
-    5720424,
-    5720447,
-    5723140,
-    5723141,
-    5723142,
-    5723144,
-    5723145,
-    5723146,
-    5723153,
-    5723154,
-    5723157,
-    5723158,
-    5723161,
-    5723162,
-    5723170,
-    5723174,
-    5723178,
-    5723199,
-    5723204,
-    5723206,
-    5723208,
-    5723209,
-    5723210,
-    5723216,
-    5723217,
-    5723218,
-    5723220,
-    5723222,
-    5723224,
-    5723225,
-    5723226,
-    5723232,
-    5723233,
-    5723234,
-    5723236,
-    5723238,
-    5723240,
-    5723241,
-    5723242,
-    5723263,
-    5723456,
-    5723457,
-    5723458,
-    5723464,
-    5723465,
-    5723466,
-    5723473,
-    5723474,
-    5723481,
-    5724164,
-    5724165,
-    5724169,
-    5724177,
-    5724180,
-    5724181,
-    5724185,
-    5724193,
-    5724196,
-    5724197,
-    5724201,
-    5724223,
-    5724228,
-    5724232,
-    5724240,
-    5724241,
-    5724244,
-    5724248,
-    5724256,
-    5724257,
-    5724260,
-    5724264,
-    5724287,
-    5724417,
-    5724420,
-    5724421,
-    5724425,
-    5724433,
-    5724479,
-    5724480,
-    5724481,
-    5724488,
-    5724496,
-    5724497,
-    5898308,
-    5898309,
-    5898310,
-    5898320,
-    5898321,
-    5898322,
-    5898324,
-    5898325,
-    5898326,
-    5898336,
-    5898337,
-    5898338,
-    5898340,
-    5898341,
-    5898342,
-    5898560,
-    5898561,
-    5898562,
-    5898564,
-    5898565,
-    5898566,
-    5898576,
-    5898577,
-    5898578,
-    5898592,
-    5898593,
-    5898594,
-    5898596,
-    5898597,
-    5898598,
-    5899280,
-    5899281,
-    5899282,
-    5899284,
-    5899285,
-    5899286,
-    5899296,
-    5899297,
-    5899298,
-    5899300,
-    5899301,
-    5899302,
-    5899348,
-    5899349,
-    5899350,
-    5899360,
-    5899361,
-    5899362,
-    5899364,
-    5899365,
-    5899366,
-    5899520,
-    5899521,
-    5899522,
-    5899524,
-    5899525,
-    5899526,
-    5899536,
-    5899537,
-    5899538,
-    5899552,
-    5899553,
-    5899554,
-    5899556,
-    5899557,
-    5899558,
-    5899584,
-    5899585,
-    5899586,
-    5899588,
-    5899589,
-    5899590,
-    5899600,
-    5899601,
-    5899602,
-    5899616,
-    5899617,
-    5899618,
-    5899620,
-    5899621,
-    5899622,
-    5900544,
-    5900545,
-    5900546,
-    5900548,
-    5900549,
-    5900550,
-    5900560,
-    5900561,
-    5900562,
-    5900576,
-    5900577,
-    5900578,
-    5900580,
-    5900581,
-    5900582,
-    5900608,
-    5900609,
-    5900610,
-    5900612,
-    5900613,
-    5900614,
-    5900624,
-    5900625,
-    5900626,
-    5900640,
-    5900641,
-    5900642,
-    5900644,
-    5900645,
-    5900646,
-    5902592,
-    5902593,
-    5902594,
-    5902596,
-    5902597,
-    5902598,
-    5902608,
-    5902609,
-    5902610,
-    5902624,
-    5902625,
-    5902626,
-    5902628,
-    5902629,
-    5902630,
-    5902672,
-    5902673,
-    5902674,
-    5902688,
-    5902689,
-    5902690,
-    5903632,
-    5903633,
-    5903634,
-    5903648,
-    5903649,
-    5903650,
-    5903652,
-    5903653,
-    5903654,
-    5904672,
-    5904673,
-    5904674,
-    5904676,
-    5904677,
-    5904678,
-    5914692,
-    5914693,
-    5914694,
-    5914704,
-    5914705,
-    5914706,
-    5914708,
-    5914709,
-    5914710,
-    5914720,
-    5914721,
-    5914722,
-    5914724,
-    5914725,
-    5914726,
-    5914944,
-    5914945,
-    5914946,
-    5914948,
-    5914949,
-    5914950,
-    5914960,
-    5914961,
-    5914962,
-    5914976,
-    5914977,
-    5914978,
-    5914980,
-    5914981,
-    5914982,
-    5915664,
-    5915665,
-    5915666,
-    5915668,
-    5915669,
-    5915670,
-    5915680,
-    5915681,
-    5915682,
-    5915684,
-    5915685,
-    5915686,
-    5915732,
-    5915733,
-    5915734,
-    5915744,
-    5915745,
-    5915746,
-    5915748,
-    5915749,
-    5915750,
-    5915904,
-    5915905,
-    5915906,
-    5915908,
-    5915909,
-    5915910,
-    5915920,
-    5915921,
-    5915922,
-    5915936,
-    5915937,
-    5915938,
-    5915940,
-    5915941,
-    5915942,
-    5915968,
-    5915969,
-    5915970,
-    5915972,
-    5915973,
-    5915974,
-    5915984,
-    5915985,
-    5915986,
-    5916000,
-    5916001,
-    5916002,
-    5916004,
-    5916005,
-    5916006,
-    5916704,
-    5916705,
-    5916706,
-    5916708,
-    5916709,
-    5916710,
-    5916772,
-    5916773,
-    5916774,
-    5916928,
-    5916929,
-    5916930,
-    5916932,
-    5916933,
-    5916934,
-    5916944,
-    5916945,
-    5916946,
-    5916960,
-    5916961,
-    5916962,
-    5916964,
-    5916965,
-    5916966,
-    5916992,
-    5916993,
-    5916994,
-    5916996,
-    5916997,
-    5916998,
-    5917008,
-    5917009,
-    5917010,
-    5917024,
-    5917025,
-    5917026,
-    5917028,
-    5917029,
-    5917030,
-    5918976,
-    5918977,
-    5918978,
-    5918980,
-    5918981,
-    5918982,
-    5918992,
-    5918993,
-    5918994,
-    5919008,
-    5919009,
-    5919010,
-    5919012,
-    5919013,
-    5919014,
-    5919056,
-    5919057,
-    5919058,
-    5919072,
-    5919073,
-    5919074,
-    5920016,
-    5920017,
-    5920018,
-    5920032,
-    5920033,
-    5920034,
-    5920036,
-    5920037,
-    5920038,
-    5931076,
-    5931077,
-    5931078,
-    5931088,
-    5931089,
-    5931090,
-    5931092,
-    5931093,
-    5931094,
-    5931328,
-    5931329,
-    5931330,
-    5931332,
-    5931333,
-    5931334,
-    5931344,
-    5931345,
-    5931346,
-    5932048,
-    5932049,
-    5932050,
-    5932052,
-    5932053,
-    5932054,
-    5932116,
-    5932117,
-    5932118,
-    5932288,
-    5932289,
-    5932290,
-    5932292,
-    5932293,
-    5932294,
-    5932304,
-    5932305,
-    5932306,
-    5932352,
-    5932353,
-    5932354,
-    5932356,
-    5932357,
-    5932358,
-    5932368,
-    5932369,
-    5932370,
-    5935360,
-    5935361,
-    5935362,
-    5935364,
-    5935365,
-    5935366,
-    5935376,
-    5935377,
-    5935378,
-    5935440,
-    5935441,
-    5935442,
-    5936400,
-    5936401,
-    5936402,
-    5963844,
-    5963846,
-    5963848,
-    5963849,
-    5963850,
-    5963856,
-    5963857,
-    5963858,
-    5963860,
-    5963862,
-    5963864,
-    5963865,
-    5963866,
-    5963872,
-    5963873,
-    5963874,
-    5963876,
-    5963878,
-    5963880,
-    5963881,
-    5963882,
-    5963903,
-    5964096,
-    5964097,
-    5964098,
-    5964100,
-    5964102,
-    5964104,
-    5964105,
-    5964106,
-    5964112,
-    5964113,
-    5964114,
-    5964120,
-    5964121,
-    5964122,
-    5964128,
-    5964129,
-    5964130,
-    5964132,
-    5964134,
-    5964136,
-    5964137,
-    5964138,
-    5964159,
-    5964804,
-    5964805,
-    5964806,
-    5964808,
-    5964809,
-    5964810,
-    5964817,
-    5964818,
-    5964820,
-    5964821,
-    5964822,
-    5964824,
-    5964825,
-    5964826,
-    5964833,
-    5964834,
-    5964836,
-    5964837,
-    5964838,
-    5964840,
-    5964841,
-    5964842,
-    5964863,
-    5964868,
-    5964870,
-    5964872,
-    5964873,
-    5964874,
-    5964880,
-    5964881,
-    5964882,
-    5964884,
-    5964886,
-    5964888,
-    5964889,
-    5964890,
-    5964896,
-    5964897,
-    5964898,
-    5964900,
-    5964902,
-    5964904,
-    5964905,
-    5964906,
-    5964927,
-    5965057,
-    5965058,
-    5965060,
-    5965061,
-    5965062,
-    5965064,
-    5965065,
-    5965066,
-    5965073,
-    5965074,
-    5965080,
-    5965081,
-    5965082,
-    5965089,
-    5965090,
-    5965092,
-    5965093,
-    5965094,
-    5965096,
-    5965097,
-    5965098,
-    5965119,
-    5965120,
-    5965121,
-    5965122,
-    5965124,
-    5965126,
-    5965128,
-    5965129,
-    5965130,
-    5965136,
-    5965137,
-    5965138,
-    5965144,
-    5965145,
-    5965146,
-    5965152,
-    5965153,
-    5965154,
-    5965156,
-    5965158,
-    5965160,
-    5965161,
-    5965162,
-    5965183,
-    5965828,
-    5965829,
-    5965830,
-    5965841,
-    5965842,
-    5965844,
-    5965845,
-    5965846,
-    5965848,
-    5965849,
-    5965850,
-    5965892,
-    5965894,
-    5965904,
-    5965905,
-    5965906,
-    5965908,
-    5965910,
-    5965912,
-    5965913,
-    5965914,
-    5965951,
-    5966081,
-    5966082,
-    5966084,
-    5966085,
-    5966086,
-    5966088,
-    5966089,
-    5966090,
-    5966097,
-    5966098,
-    5966104,
-    5966105,
-    5966106,
-    5966113,
-    5966114,
-    5966116,
-    5966117,
-    5966118,
-    5966120,
-    5966121,
-    5966122,
-    5966143,
-    5966144,
-    5966145,
-    5966146,
-    5966148,
-    5966150,
-    5966152,
-    5966153,
-    5966154,
-    5966160,
-    5966161,
-    5966162,
-    5966168,
-    5966169,
-    5966170,
-    5966176,
-    5966177,
-    5966178,
-    5966180,
-    5966182,
-    5966184,
-    5966185,
-    5966186,
-    5966207,
-    5967876,
-    5967877,
-    5967878,
-    5967880,
-    5967881,
-    5967882,
-    5967889,
-    5967890,
-    5967892,
-    5967893,
-    5967894,
-    5967896,
-    5967897,
-    5967898,
-    5967905,
-    5967906,
-    5967908,
-    5967909,
-    5967910,
-    5967912,
-    5967913,
-    5967914,
-    5967935,
-    5967940,
-    5967942,
-    5967944,
-    5967945,
-    5967946,
-    5967952,
-    5967953,
-    5967954,
-    5967956,
-    5967958,
-    5967960,
-    5967961,
-    5967962,
-    5967968,
-    5967969,
-    5967970,
-    5967972,
-    5967974,
-    5967976,
-    5967977,
-    5967978,
-    5967999,
-    5968129,
-    5968130,
-    5968132,
-    5968133,
-    5968134,
-    5968136,
-    5968137,
-    5968138,
-    5968145,
-    5968146,
-    5968152,
-    5968153,
-    5968154,
-    5968161,
-    5968162,
-    5968164,
-    5968165,
-    5968166,
-    5968168,
-    5968169,
-    5968170,
-    5968191,
-    5968192,
-    5968193,
-    5968194,
-    5968200,
-    5968201,
-    5968202,
-    5968208,
-    5968209,
-    5968210,
-    5968216,
-    5968217,
-    5968218,
-    5968224,
-    5968225,
-    5968226,
-    5968232,
-    5968233,
-    5968234,
-    5968900,
-    5968901,
-    5968902,
-    5968904,
-    5968905,
-    5968906,
-    5968913,
-    5968914,
-    5968916,
-    5968917,
-    5968918,
-    5968920,
-    5968921,
-    5968922,
-    5968929,
-    5968930,
-    5968932,
-    5968933,
-    5968934,
-    5968936,
-    5968937,
-    5968938,
-    5968959,
-    5969153,
-    5969154,
-    5969156,
-    5969157,
-    5969158,
-    5969160,
-    5969161,
-    5969162,
-    5969169,
-    5969170,
-    5969176,
-    5969177,
-    5969178,
-    5969185,
-    5969186,
-    5969188,
-    5969189,
-    5969190,
-    5969192,
-    5969193,
-    5969194,
-    5969215,
-    5969924,
-    5969925,
-    5969926,
-    5969928,
-    5969929,
-    5969930,
-    5969937,
-    5969938,
-    5969940,
-    5969941,
-    5969942,
-    5969944,
-    5969945,
-    5969946,
-    5969953,
-    5969954,
-    5969956,
-    5969957,
-    5969958,
-    5969960,
-    5969961,
-    5969962,
-    5969983,
-    5969988,
-    5969990,
-    5969992,
-    5969993,
-    5969994,
-    5970000,
-    5970001,
-    5970002,
-    5970004,
-    5970006,
-    5970008,
-    5970009,
-    5970010,
-    5970016,
-    5970017,
-    5970018,
-    5970020,
-    5970022,
-    5970024,
-    5970025,
-    5970026,
-    5970047,
-    5970177,
-    5970178,
-    5970180,
-    5970181,
-    5970182,
-    5970184,
-    5970185,
-    5970186,
-    5970193,
-    5970194,
-    5970200,
-    5970201,
-    5970202,
-    5970209,
-    5970210,
-    5970212,
-    5970213,
-    5970214,
-    5970216,
-    5970217,
-    5970218,
-    5970239,
-    5970240,
-    5970241,
-    5970242,
-    5970248,
-    5970249,
-    5970250,
-    5970256,
-    5970257,
-    5970258,
-    5970264,
-    5970265,
-    5970266,
-    5970272,
-    5970273,
-    5970274,
-    5970280,
-    5970281,
-    5970282,
-    5980228,
-    5980230,
-    5980232,
-    5980233,
-    5980234,
-    5980240,
-    5980241,
-    5980242,
-    5980244,
-    5980246,
-    5980248,
-    5980249,
-    5980250,
-    5980256,
-    5980257,
-    5980258,
-    5980260,
-    5980262,
-    5980264,
-    5980265,
-    5980266,
-    5980287,
-    5980480,
-    5980481,
-    5980482,
-    5980484,
-    5980486,
-    5980488,
-    5980489,
-    5980490,
-    5980496,
-    5980497,
-    5980498,
-    5980504,
-    5980505,
-    5980506,
-    5980512,
-    5980513,
-    5980514,
-    5980516,
-    5980518,
-    5980520,
-    5980521,
-    5980522,
-    5980543,
-    5981188,
-    5981189,
-    5981190,
-    5981192,
-    5981193,
-    5981194,
-    5981201,
-    5981202,
-    5981204,
-    5981205,
-    5981206,
-    5981208,
-    5981209,
-    5981210,
-    5981217,
-    5981218,
-    5981220,
-    5981221,
-    5981222,
-    5981224,
-    5981225,
-    5981226,
-    5981247,
-    5981252,
-    5981254,
-    5981256,
-    5981257,
-    5981258,
-    5981264,
-    5981265,
-    5981266,
-    5981268,
-    5981270,
-    5981272,
-    5981273,
-    5981274,
-    5981280,
-    5981281,
-    5981282,
-    5981284,
-    5981286,
-    5981288,
-    5981289,
-    5981290,
-    5981311,
-    5981441,
-    5981442,
-    5981444,
-    5981445,
-    5981446,
-    5981448,
-    5981449,
-    5981450,
-    5981457,
-    5981458,
-    5981464,
-    5981465,
-    5981466,
-    5981473,
-    5981474,
-    5981476,
-    5981477,
-    5981478,
-    5981480,
-    5981481,
-    5981482,
-    5981503,
-    5981504,
-    5981505,
-    5981506,
-    5981508,
-    5981510,
-    5981512,
-    5981513,
-    5981514,
-    5981520,
-    5981521,
-    5981522,
-    5981528,
-    5981529,
-    5981530,
-    5981536,
-    5981537,
-    5981538,
-    5981540,
-    5981542,
-    5981544,
-    5981545,
-    5981546,
-    5981567,
-    5982212,
-    5982213,
-    5982214,
-    5982216,
-    5982217,
-    5982218,
-    5982225,
-    5982226,
-    5982228,
-    5982229,
-    5982230,
-    5982232,
-    5982233,
-    5982234,
-    5982241,
-    5982242,
-    5982244,
-    5982245,
-    5982246,
-    5982248,
-    5982249,
-    5982250,
-    5982271,
-    5982276,
-    5982278,
-    5982280,
-    5982281,
-    5982282,
-    5982288,
-    5982289,
-    5982290,
-    5982292,
-    5982294,
-    5982296,
-    5982297,
-    5982298,
-    5982304,
-    5982305,
-    5982306,
-    5982308,
-    5982310,
-    5982312,
-    5982313,
-    5982314,
-    5982335,
-    5982465,
-    5982466,
-    5982468,
-    5982469,
-    5982470,
-    5982472,
-    5982473,
-    5982474,
-    5982481,
-    5982482,
-    5982488,
-    5982489,
-    5982490,
-    5982497,
-    5982498,
-    5982500,
-    5982501,
-    5982502,
-    5982504,
-    5982505,
-    5982506,
-    5982527,
-    5982528,
-    5982529,
-    5982530,
-    5982532,
-    5982534,
-    5982536,
-    5982537,
-    5982538,
-    5982544,
-    5982545,
-    5982546,
-    5982552,
-    5982553,
-    5982554,
-    5982560,
-    5982561,
-    5982562,
-    5982564,
-    5982566,
-    5982568,
-    5982569,
-    5982570,
-    5982591,
-    5984260,
-    5984261,
-    5984262,
-    5984264,
-    5984265,
-    5984266,
-    5984273,
-    5984274,
-    5984276,
-    5984277,
-    5984278,
-    5984280,
-    5984281,
-    5984282,
-    5984289,
-    5984290,
-    5984292,
-    5984293,
-    5984294,
-    5984296,
-    5984297,
-    5984298,
-    5984319,
-    5984324,
-    5984326,
-    5984328,
-    5984329,
-    5984330,
-    5984336,
-    5984337,
-    5984338,
-    5984340,
-    5984342,
-    5984344,
-    5984345,
-    5984346,
-    5984352,
-    5984353,
-    5984354,
-    5984356,
-    5984358,
-    5984360,
-    5984361,
-    5984362,
-    5984383,
-    5984513,
-    5984514,
-    5984516,
-    5984517,
-    5984518,
-    5984520,
-    5984521,
-    5984522,
-    5984529,
-    5984530,
-    5984536,
-    5984537,
-    5984538,
-    5984545,
-    5984546,
-    5984548,
-    5984549,
-    5984550,
-    5984552,
-    5984553,
-    5984554,
-    5984575,
-    5984576,
-    5984577,
-    5984578,
-    5984584,
-    5984585,
-    5984586,
-    5984592,
-    5984593,
-    5984594,
-    5984600,
-    5984601,
-    5984602,
-    5984608,
-    5984609,
-    5984610,
-    5984616,
-    5984617,
-    5984618,
-    5985284,
-    5985285,
-    5985286,
-    5985288,
-    5985289,
-    5985290,
-    5985297,
-    5985298,
-    5985300,
-    5985301,
-    5985302,
-    5985304,
-    5985305,
-    5985306,
-    5985313,
-    5985314,
-    5985316,
-    5985317,
-    5985318,
-    5985320,
-    5985321,
-    5985322,
-    5985343,
-    5985537,
-    5985538,
-    5985540,
-    5985541,
-    5985542,
-    5985544,
-    5985545,
-    5985546,
-    5985553,
-    5985554,
-    5985560,
-    5985561,
-    5985562,
-    5985569,
-    5985570,
-    5985572,
-    5985573,
-    5985574,
-    5985576,
-    5985577,
-    5985578,
-    5985599,
-    5986308,
-    5986309,
-    5986310,
-    5986312,
-    5986313,
-    5986314,
-    5986321,
-    5986322,
-    5986324,
-    5986325,
-    5986326,
-    5986328,
-    5986329,
-    5986330,
-    5986337,
-    5986338,
-    5986340,
-    5986341,
-    5986342,
-    5986344,
-    5986345,
-    5986346,
-    5986367,
-    5986372,
-    5986374,
-    5986376,
-    5986377,
-    5986378,
-    5986384,
-    5986385,
-    5986386,
-    5986388,
-    5986390,
-    5986392,
-    5986393,
-    5986394,
-    5986400,
-    5986401,
-    5986402,
-    5986404,
-    5986406,
-    5986408,
-    5986409,
-    5986410,
-    5986431,
-    5986561,
-    5986562,
-    5986564,
-    5986565,
-    5986566,
-    5986568,
-    5986569,
-    5986570,
-    5986577,
-    5986578,
-    5986623,
-    5986624,
-    5986625,
-    5986626,
-    5986632,
-    5986633,
-    5986634,
-    5986640,
-    5986641,
-    5986642,
-    5996612,
-    5996614,
-    5996624,
-    5996625,
-    5996626,
-    5996628,
-    5996630,
-    5996632,
-    5996633,
-    5996634,
-    5996671,
-    5996864,
-    5996865,
-    5996866,
-    5996868,
-    5996870,
-    5996872,
-    5996873,
-    5996874,
-    5996880,
-    5996881,
-    5996882,
-    5996927,
-    5997572,
-    5997573,
-    5997574,
-    5997585,
-    5997586,
-    5997588,
-    5997589,
-    5997590,
-    5997592,
-    5997593,
-    5997594,
-    5997631,
-    5997636,
-    5997638,
-    5997648,
-    5997649,
-    5997650,
-    5997652,
-    5997654,
-    5997656,
-    5997657,
-    5997658,
-    5997695,
-    5997825,
-    5997826,
-    5997828,
-    5997829,
-    5997830,
-    5997832,
-    5997833,
-    5997834,
-    5997841,
-    5997842,
-    5997887,
-    5997888,
-    5997889,
-    5997890,
-    5997892,
-    5997894,
-    5997896,
-    5997897,
-    5997898,
-    5997904,
-    5997905,
-    5997906,
-    5997951,
-    6000644,
-    6000645,
-    6000646,
-    6000657,
-    6000658,
-    6000660,
-    6000661,
-    6000662,
-    6000664,
-    6000665,
-    6000666,
-    6000703,
-    6000708,
-    6000710,
-    6000720,
-    6000721,
-    6000722,
-    6000724,
-    6000726,
-    6000728,
-    6000729,
-    6000730,
-    6000767,
-    6000897,
-    6000898,
-    6000900,
-    6000901,
-    6000902,
-    6000904,
-    6000905,
-    6000906,
-    6000913,
-    6000914,
-    6000959,
-    6000960,
-    6000961,
-    6000962,
-    6000968,
-    6000969,
-    6000970,
-    6000976,
-    6000977,
-    6000978,
-    6001668,
-    6001669,
-    6001670,
-    6001681,
-    6001682,
-    6001684,
-    6001685,
-    6001686,
-    6001688,
-    6001689,
-    6001690,
-    6001727,
-    6001921,
-    6001922,
-    6001924,
-    6001925,
-    6001926,
-    6001928,
-    6001929,
-    6001930,
-    6001937,
-    6001938,
-    6001983,
-    6225988,
-    6225989,
-    6225990,
-    6225992,
-    6225993,
-    6225994,
-    6226000,
-    6226001,
-    6226002,
-    6226004,
-    6226005,
-    6226006,
-    6226008,
-    6226009,
-    6226010,
-    6226016,
-    6226017,
-    6226018,
-    6226020,
-    6226021,
-    6226022,
-    6226024,
-    6226025,
-    6226026,
-    6226047,
-    6226064,
-    6226065,
-    6226066,
-    6226068,
-    6226069,
-    6226070,
-    6226072,
-    6226073,
-    6226074,
-    6226111,
-    6226240,
-    6226241,
-    6226242,
-    6226244,
-    6226245,
-    6226246,
-    6226248,
-    6226249,
-    6226250,
-    6226256,
-    6226257,
-    6226258,
-    6226264,
-    6226265,
-    6226266,
-    6226272,
-    6226273,
-    6226274,
-    6226276,
-    6226277,
-    6226278,
-    6226280,
-    6226281,
-    6226282,
-    6226303,
-    6226304,
-    6226305,
-    6226306,
-    6226308,
-    6226309,
-    6226310,
-    6226312,
-    6226313,
-    6226314,
-    6226320,
-    6226321,
-    6226322,
-    6226328,
-    6226329,
-    6226330,
-    6226336,
-    6226337,
-    6226338,
-    6226340,
-    6226341,
-    6226342,
-    6226344,
-    6226345,
-    6226346,
-    6226367,
-    6226960,
-    6226961,
-    6226962,
-    6226964,
-    6226965,
-    6226966,
-    6226968,
-    6226969,
-    6226970,
-    6226976,
-    6226977,
-    6226978,
-    6226980,
-    6226981,
-    6226982,
-    6226984,
-    6226985,
-    6226986,
-    6227007,
-    6227028,
-    6227029,
-    6227030,
-    6227032,
-    6227033,
-    6227034,
-    6227040,
-    6227041,
-    6227042,
-    6227044,
-    6227045,
-    6227046,
-    6227048,
-    6227049,
-    6227050,
-    6227071,
-    6227096,
-    6227097,
-    6227098,
-    6227104,
-    6227105,
-    6227106,
-    6227108,
-    6227109,
-    6227110,
-    6227112,
-    6227113,
-    6227114,
-    6227135,
-    6227200,
-    6227201,
-    6227202,
-    6227204,
-    6227205,
-    6227206,
-    6227208,
-    6227209,
-    6227210,
-    6227216,
-    6227217,
-    6227218,
-    6227224,
-    6227225,
-    6227226,
-    6227232,
-    6227233,
-    6227234,
-    6227236,
-    6227237,
-    6227238,
-    6227240,
-    6227241,
-    6227242,
-    6227263,
-    6227264,
-    6227265,
-    6227266,
-    6227268,
-    6227269,
-    6227270,
-    6227272,
-    6227273,
-    6227274,
-    6227280,
-    6227281,
-    6227282,
-    6227288,
-    6227289,
-    6227290,
-    6227296,
-    6227297,
-    6227298,
-    6227300,
-    6227301,
-    6227302,
-    6227304,
-    6227305,
-    6227306,
-    6227327,
-    6227328,
-    6227329,
-    6227330,
-    6227332,
-    6227333,
-    6227334,
-    6227336,
-    6227337,
-    6227338,
-    6227344,
-    6227345,
-    6227346,
-    6227352,
-    6227353,
-    6227354,
-    6227360,
-    6227361,
-    6227362,
-    6227364,
-    6227365,
-    6227366,
-    6227368,
-    6227369,
-    6227370,
-    6227391,
-    6228095,
-    6228159,
-    6228224,
-    6228225,
-    6228226,
-    6228228,
-    6228229,
-    6228230,
-    6228232,
-    6228233,
-    6228234,
-    6228240,
-    6228241,
-    6228242,
-    6228248,
-    6228249,
-    6228250,
-    6228256,
-    6228257,
-    6228258,
-    6228260,
-    6228261,
-    6228262,
-    6228264,
-    6228265,
-    6228266,
-    6228287,
-    6228288,
-    6228289,
-    6228290,
-    6228292,
-    6228293,
-    6228294,
-    6228296,
-    6228297,
-    6228298,
-    6228304,
-    6228305,
-    6228306,
-    6228312,
-    6228313,
-    6228314,
-    6228320,
-    6228321,
-    6228322,
-    6228324,
-    6228325,
-    6228326,
-    6228328,
-    6228329,
-    6228330,
-    6228351,
-    6228352,
-    6228353,
-    6228354,
-    6228356,
-    6228357,
-    6228358,
-    6228360,
-    6228361,
-    6228362,
-    6228368,
-    6228369,
-    6228370,
-    6228376,
-    6228377,
-    6228378,
-    6228384,
-    6228385,
-    6228386,
-    6228388,
-    6228389,
-    6228390,
-    6228392,
-    6228393,
-    6228394,
-    6228415,
-    6229443,
-    6229447,
-    6229451,
-    6229459,
-    6229467,
-    6229475,
-    6229479,
-    6229483,
-    6229503,
-    6230272,
-    6230273,
-    6230274,
-    6230276,
-    6230277,
-    6230278,
-    6230280,
-    6230281,
-    6230282,
-    6230288,
-    6230289,
-    6230290,
-    6230296,
-    6230297,
-    6230298,
-    6230304,
-    6230305,
-    6230306,
-    6230308,
-    6230309,
-    6230310,
-    6230312,
-    6230313,
-    6230314,
-    6230335,
-    6230344,
-    6230345,
-    6230346,
-    6230352,
-    6230353,
-    6230354,
-    6230360,
-    6230361,
-    6230362,
-    6230368,
-    6230369,
-    6230370,
-    6230376,
-    6230377,
-    6230378,
-    6230408,
-    6230409,
-    6230410,
-    6230416,
-    6230417,
-    6230418,
-    6230424,
-    6230425,
-    6230426,
-    6230432,
-    6230433,
-    6230434,
-    6230436,
-    6230437,
-    6230438,
-    6230440,
-    6230441,
-    6230442,
-    6230463,
-    6231312,
-    6231313,
-    6231314,
-    6231320,
-    6231321,
-    6231322,
-    6231328,
-    6231329,
-    6231330,
-    6231332,
-    6231333,
-    6231334,
-    6231336,
-    6231337,
-    6231338,
-    6231359,
-    6231448,
-    6231449,
-    6231450,
-    6231456,
-    6231457,
-    6231458,
-    6231460,
-    6231461,
-    6231462,
-    6231464,
-    6231465,
-    6231466,
-    6231487,
-    6232352,
-    6232353,
-    6232354,
-    6232356,
-    6232357,
-    6232358,
-    6232360,
-    6232361,
-    6232362,
-    6232383,
-    6232424,
-    6232425,
-    6232426,
-    6232488,
-    6232489,
-    6232490,
-    6232511,
-    6242372,
-    6242373,
-    6242374,
-    6242376,
-    6242377,
-    6242378,
-    6242384,
-    6242385,
-    6242386,
-    6242388,
-    6242389,
-    6242390,
-    6242392,
-    6242393,
-    6242394,
-    6242400,
-    6242401,
-    6242402,
-    6242404,
-    6242405,
-    6242406,
-    6242408,
-    6242409,
-    6242410,
-    6242431,
-    6242440,
-    6242441,
-    6242442,
-    6242448,
-    6242449,
-    6242450,
-    6242452,
-    6242453,
-    6242454,
-    6242456,
-    6242457,
-    6242458,
-    6242464,
-    6242465,
-    6242466,
-    6242468,
-    6242469,
-    6242470,
-    6242472,
-    6242473,
-    6242474,
-    6242495,
-    6242624,
-    6242625,
-    6242626,
-    6242628,
-    6242629,
-    6242630,
-    6242632,
-    6242633,
-    6242634,
-    6242640,
-    6242641,
-    6242642,
-    6242648,
-    6242649,
-    6242650,
-    6242656,
-    6242657,
-    6242658,
-    6242660,
-    6242661,
-    6242662,
-    6242664,
-    6242665,
-    6242666,
-    6242687,
-    6242688,
-    6242689,
-    6242690,
-    6242692,
-    6242693,
-    6242694,
-    6242696,
-    6242697,
-    6242698,
-    6242704,
-    6242705,
-    6242706,
-    6242712,
-    6242713,
-    6242714,
-    6242720,
-    6242721,
-    6242722,
-    6242724,
-    6242725,
-    6242726,
-    6242728,
-    6242729,
-    6242730,
-    6242751,
-    6243344,
-    6243345,
-    6243346,
-    6243348,
-    6243349,
-    6243350,
-    6243352,
-    6243353,
-    6243354,
-    6243360,
-    6243361,
-    6243362,
-    6243364,
-    6243365,
-    6243366,
-    6243368,
-    6243369,
-    6243370,
-    6243391,
-    6243412,
-    6243413,
-    6243414,
-    6243416,
-    6243417,
-    6243418,
-    6243424,
-    6243425,
-    6243426,
-    6243428,
-    6243429,
-    6243430,
-    6243432,
-    6243433,
-    6243434,
-    6243455,
-    6243480,
-    6243481,
-    6243482,
-    6243488,
-    6243489,
-    6243490,
-    6243492,
-    6243493,
-    6243494,
-    6243496,
-    6243497,
-    6243498,
-    6243519,
-    6243584,
-    6243585,
-    6243586,
-    6243588,
-    6243589,
-    6243590,
-    6243592,
-    6243593,
-    6243594,
-    6243600,
-    6243601,
-    6243602,
-    6243608,
-    6243609,
-    6243610,
-    6243616,
-    6243617,
-    6243618,
-    6243620,
-    6243621,
-    6243622,
-    6243624,
-    6243625,
-    6243626,
-    6243647,
-    6243648,
-    6243649,
-    6243650,
-    6243652,
-    6243653,
-    6243654,
-    6243656,
-    6243657,
-    6243658,
-    6243664,
-    6243665,
-    6243666,
-    6243672,
-    6243673,
-    6243674,
-    6243680,
-    6243681,
-    6243682,
-    6243684,
-    6243685,
-    6243686,
-    6243688,
-    6243689,
-    6243690,
-    6243711,
-    6243712,
-    6243713,
-    6243714,
-    6243716,
-    6243717,
-    6243718,
-    6243720,
-    6243721,
-    6243722,
-    6243728,
-    6243729,
-    6243730,
-    6243736,
-    6243737,
-    6243738,
-    6243744,
-    6243745,
-    6243746,
-    6243748,
-    6243749,
-    6243750,
-    6243752,
-    6243753,
-    6243754,
-    6243775,
-    6244384,
-    6244385,
-    6244386,
-    6244388,
-    6244389,
-    6244390,
-    6244392,
-    6244393,
-    6244394,
-    6244415,
-    6244452,
-    6244453,
-    6244454,
-    6244456,
-    6244457,
-    6244458,
-    6244479,
-    6244520,
-    6244521,
-    6244522,
-    6244543,
-    6244608,
-    6244609,
-    6244610,
-    6244612,
-    6244613,
-    6244614,
-    6244616,
-    6244617,
-    6244618,
-    6244624,
-    6244625,
-    6244626,
-    6244632,
-    6244633,
-    6244634,
-    6244640,
-    6244641,
-    6244642,
-    6244644,
-    6244645,
-    6244646,
-    6244648,
-    6244649,
-    6244650,
-    6244671,
-    6244672,
-    6244673,
-    6244674,
-    6244676,
-    6244677,
-    6244678,
-    6244680,
-    6244681,
-    6244682,
-    6244688,
-    6244689,
-    6244690,
-    6244696,
-    6244697,
-    6244698,
-    6244704,
-    6244705,
-    6244706,
-    6244708,
-    6244709,
-    6244710,
-    6244712,
-    6244713,
-    6244714,
-    6244735,
-    6244736,
-    6244737,
-    6244738,
-    6244740,
-    6244741,
-    6244742,
-    6244744,
-    6244745,
-    6244746,
-    6244752,
-    6244753,
-    6244754,
-    6244760,
-    6244761,
-    6244762,
-    6244768,
-    6244769,
-    6244770,
-    6244772,
-    6244773,
-    6244774,
-    6244776,
-    6244777,
-    6244778,
-    6244799,
-    6245631,
-    6245827,
-    6245831,
-    6245835,
-    6245843,
-    6245851,
-    6245859,
-    6245863,
-    6245867,
-    6245887,
-    6246656,
-    6246657,
-    6246658,
-    6246660,
-    6246661,
-    6246662,
-    6246664,
-    6246665,
-    6246666,
-    6246672,
-    6246673,
-    6246674,
-    6246680,
-    6246681,
-    6246682,
-    6246688,
-    6246689,
-    6246690,
-    6246692,
-    6246693,
-    6246694,
-    6246696,
-    6246697,
-    6246698,
-    6246719,
-    6246728,
-    6246729,
-    6246730,
-    6246736,
-    6246737,
-    6246738,
-    6246744,
-    6246745,
-    6246746,
-    6246752,
-    6246753,
-    6246754,
-    6246760,
-    6246761,
-    6246762,
-    6246792,
-    6246793,
-    6246794,
-    6246800,
-    6246801,
-    6246802,
-    6246808,
-    6246809,
-    6246810,
-    6246816,
-    6246817,
-    6246818,
-    6246820,
-    6246821,
-    6246822,
-    6246824,
-    6246825,
-    6246826,
-    6246847,
-    6247696,
-    6247697,
-    6247698,
-    6247704,
-    6247705,
-    6247706,
-    6247712,
-    6247713,
-    6247714,
-    6247716,
-    6247717,
-    6247718,
-    6247720,
-    6247721,
-    6247722,
-    6247743,
-    6247871,
-    6248767,
-    6248895,
-    6258756,
-    6258757,
-    6258758,
-    6258768,
-    6258769,
-    6258770,
-    6258772,
-    6258773,
-    6258774,
-    6258776,
-    6258777,
-    6258778,
-    6258815,
-    6259008,
-    6259009,
-    6259010,
-    6259012,
-    6259013,
-    6259014,
-    6259016,
-    6259017,
-    6259018,
-    6259024,
-    6259025,
-    6259026,
-    6259071,
-    6259728,
-    6259729,
-    6259730,
-    6259732,
-    6259733,
-    6259734,
-    6259736,
-    6259737,
-    6259738,
-    6259775,
-    6259796,
-    6259797,
-    6259798,
-    6259800,
-    6259801,
-    6259802,
-    6259839,
-    6259864,
-    6259865,
-    6259866,
-    6259903,
-    6259968,
-    6259969,
-    6259970,
-    6259972,
-    6259973,
-    6259974,
-    6259976,
-    6259977,
-    6259978,
-    6259984,
-    6259985,
-    6259986,
-    6260031,
-    6260032,
-    6260033,
-    6260034,
-    6260036,
-    6260037,
-    6260038,
-    6260040,
-    6260041,
-    6260042,
-    6260048,
-    6260049,
-    6260050,
-    6260095,
-    6260096,
-    6260097,
-    6260098,
-    6260100,
-    6260101,
-    6260102,
-    6260104,
-    6260105,
-    6260106,
-    6260112,
-    6260113,
-    6260114,
-    6260159,
-    6262211,
-    6262215,
-    6262219,
-    6262227,
-    6262271,
-    6263040,
-    6263041,
-    6263042,
-    6263044,
-    6263045,
-    6263046,
-    6263048,
-    6263049,
-    6263050,
-    6263056,
-    6263057,
-    6263058,
-    6263103,
-    6263112,
-    6263113,
-    6263114,
-    6263120,
-    6263121,
-    6263122,
-    6263176,
-    6263177,
-    6263178,
-    6263184,
-    6263185,
-    6263186,
-    6263231,
-    6264080,
-    6264081,
-    6264082,
-    6264127,
-    6881600,
-    6881601,
-    6881602,
-    6881604,
-    6881606,
-    6881617,
-    6881618,
-    6882561,
-    6882562,
-    6882564,
-    6882565,
-    6882566,
-    6882577,
-    6882578,
-    6882593,
-    6882596,
-    6882597,
-    6882625,
-    6882626,
-    6882628,
-    6882630,
-    6882640,
-    6882641,
-    6882642,
-    6882656,
-    6882657,
-    6882660,
-    6883586,
-    6883588,
-    6883589,
-    6883590,
-    6883601,
-    6883602,
-    6883617,
-    6883620,
-    6883621,
-    6883650,
-    6883652,
-    6883654,
-    6883665,
-    6883666,
-    6883680,
-    6883681,
-    6883684,
-    6885380,
-    6885381,
-    6885382,
-    6885393,
-    6885394,
-    6885397,
-    6885398,
-    6885444,
-    6885446,
-    6885457,
-    6885458,
-    6885460,
-    6885462,
-    6885473,
-    6885476,
-    6885713,
-    6885714,
-    6886405,
-    6886406,
-    6886417,
-    6886418,
-    6886420,
-    6886421,
-    6886422,
-    6886433,
-    6886436,
-    6886437,
-    6886661,
-    6886662,
-    6886673,
-    6886674,
-    6886689,
-    6886692,
-    6886693,
-    6887430,
-    6887441,
-    6887442,
-    6887445,
-    6887446,
-    6887457,
-    6887460,
-    6887461,
-    6887494,
-    6887505,
-    6887506,
-    6887510,
-    6887521,
-    6887524,
-    6887686,
-    6887697,
-    6887698,
-    6887713,
-    6887717,
-    6887761,
-    6887762,
-    6887777,
-    6898705,
-    6898706,
-    6898709,
-    6898710,
-    6898769,
-    6898770,
-    6898774,
-    6898785,
-    6899025,
-    6899026,
-    6899730,
-    6899733,
-    6899734,
-    6899745,
-    6899749,
-    6899794,
-    6899798,
-    6899809,
-    6899986,
-    6900005,
-    6900050,
-    6900065,
-    6902805,
-    6902806,
-    6903830,
-    6903845,
-    6903894,
-    6947136,
-    6947137,
-    6947138,
-    6947140,
-    6947141,
-    6947142,
-    6947153,
-    6947154,
-    6947157,
-    6947158,
-    6947170,
-    6947174,
-    6948096,
-    6948097,
-    6948098,
-    6948100,
-    6948101,
-    6948102,
-    6948112,
-    6948113,
-    6948114,
-    6948116,
-    6948117,
-    6948118,
-    6948128,
-    6948129,
-    6948130,
-    6948132,
-    6948133,
-    6948134,
-    6948160,
-    6948161,
-    6948162,
-    6948164,
-    6948165,
-    6948166,
-    6948176,
-    6948177,
-    6948178,
-    6948180,
-    6948181,
-    6948182,
-    6948192,
-    6948193,
-    6948194,
-    6948196,
-    6948197,
-    6948198,
-    6949120,
-    6949121,
-    6949122,
-    6949124,
-    6949125,
-    6949126,
-    6949136,
-    6949137,
-    6949138,
-    6949140,
-    6949141,
-    6949142,
-    6949152,
-    6949153,
-    6949154,
-    6949156,
-    6949157,
-    6949158,
-    6949184,
-    6949185,
-    6949186,
-    6949188,
-    6949189,
-    6949190,
-    6949200,
-    6949201,
-    6949202,
-    6949204,
-    6949205,
-    6949206,
-    6949216,
-    6949217,
-    6949218,
-    6949220,
-    6949221,
-    6949222,
-    6950912,
-    6950913,
-    6950914,
-    6950916,
-    6950917,
-    6950918,
-    6950929,
-    6950930,
-    6950933,
-    6950934,
-    6950946,
-    6950950,
-    6950976,
-    6950977,
-    6950978,
-    6950980,
-    6950981,
-    6950982,
-    6950992,
-    6950993,
-    6950994,
-    6950996,
-    6950997,
-    6950998,
-    6951008,
-    6951009,
-    6951010,
-    6951012,
-    6951013,
-    6951014,
-    6951232,
-    6951233,
-    6951234,
-    6951249,
-    6951250,
-    6951266,
-    6951936,
-    6951937,
-    6951938,
-    6951940,
-    6951941,
-    6951942,
-    6951952,
-    6951953,
-    6951954,
-    6951956,
-    6951957,
-    6951958,
-    6951968,
-    6951969,
-    6951970,
-    6951972,
-    6951973,
-    6951974,
-    6952192,
-    6952193,
-    6952194,
-    6952196,
-    6952197,
-    6952198,
-    6952208,
-    6952209,
-    6952210,
-    6952212,
-    6952213,
-    6952214,
-    6952224,
-    6952225,
-    6952226,
-    6952228,
-    6952229,
-    6952230,
-    6952960,
-    6952961,
-    6952962,
-    6952964,
-    6952965,
-    6952966,
-    6952976,
-    6952977,
-    6952978,
-    6952980,
-    6952981,
-    6952982,
-    6952992,
-    6952993,
-    6952994,
-    6952996,
-    6952997,
-    6952998,
-    6953024,
-    6953025,
-    6953026,
-    6953028,
-    6953029,
-    6953030,
-    6953040,
-    6953041,
-    6953042,
-    6953044,
-    6953045,
-    6953046,
-    6953056,
-    6953057,
-    6953058,
-    6953060,
-    6953061,
-    6953062,
-    6953216,
-    6953217,
-    6953218,
-    6953220,
-    6953221,
-    6953222,
-    6953232,
-    6953233,
-    6953234,
-    6953236,
-    6953237,
-    6953238,
-    6953248,
-    6953249,
-    6953250,
-    6953252,
-    6953253,
-    6953254,
-    6953280,
-    6953281,
-    6953282,
-    6953296,
-    6953297,
-    6953298,
-    6953312,
-    6953313,
-    6953314,
-    6964224,
-    6964225,
-    6964226,
-    6964228,
-    6964229,
-    6964230,
-    6964241,
-    6964242,
-    6964245,
-    6964246,
-    6964258,
-    6964262,
-    6964288,
-    6964289,
-    6964290,
-    6964292,
-    6964293,
-    6964294,
-    6964304,
-    6964305,
-    6964306,
-    6964308,
-    6964309,
-    6964310,
-    6964320,
-    6964321,
-    6964322,
-    6964324,
-    6964325,
-    6964326,
-    6964544,
-    6964545,
-    6964546,
-    6964548,
-    6964549,
-    6964550,
-    6964561,
-    6964562,
-    6964565,
-    6964566,
-    6964578,
-    6964582,
-    6965248,
-    6965249,
-    6965250,
-    6965252,
-    6965253,
-    6965254,
-    6965264,
-    6965265,
-    6965266,
-    6965268,
-    6965269,
-    6965270,
-    6965280,
-    6965281,
-    6965282,
-    6965284,
-    6965285,
-    6965286,
-    6965312,
-    6965313,
-    6965314,
-    6965316,
-    6965317,
-    6965318,
-    6965328,
-    6965329,
-    6965330,
-    6965332,
-    6965333,
-    6965334,
-    6965344,
-    6965345,
-    6965346,
-    6965348,
-    6965349,
-    6965350,
-    6965504,
-    6965505,
-    6965506,
-    6965508,
-    6965509,
-    6965510,
-    6965520,
-    6965521,
-    6965522,
-    6965524,
-    6965525,
-    6965526,
-    6965536,
-    6965537,
-    6965538,
-    6965540,
-    6965541,
-    6965542,
-    6965568,
-    6965569,
-    6965570,
-    6965572,
-    6965573,
-    6965574,
-    6965584,
-    6965585,
-    6965586,
-    6965588,
-    6965589,
-    6965590,
-    6965600,
-    6965601,
-    6965602,
-    6965604,
-    6965605,
-    6965606,
-    6968320,
-    6968321,
-    6968322,
-    6968324,
-    6968325,
-    6968326,
-    6968337,
-    6968338,
-    6968341,
-    6968342,
-    6968354,
-    6968358,
-    6969344,
-    6969345,
-    6969346,
-    6969348,
-    6969349,
-    6969350,
-    6969360,
-    6969361,
-    6969362,
-    6969364,
-    6969365,
-    6969366,
-    6969376,
-    6969377,
-    6969378,
-    6969380,
-    6969381,
-    6969382,
-    6969408,
-    6969409,
-    6969410,
-    6969412,
-    6969413,
-    6969414,
-    6969424,
-    6969425,
-    6969426,
-    6969428,
-    6969429,
-    6969430,
-    6969440,
-    6969441,
-    6969442,
-    6969444,
-    6969445,
-    6969446,
-    7012672,
-    7012673,
-    7012674,
-    7012676,
-    7012678,
-    7012680,
-    7012681,
-    7012682,
-    7012689,
-    7012690,
-    7012697,
-    7012698,
-    7012706,
-    7012710,
-    7012714,
-    7012735,
-    7013633,
-    7013634,
-    7013636,
-    7013637,
-    7013638,
-    7013640,
-    7013641,
-    7013642,
-    7013649,
-    7013650,
-    7013656,
-    7013657,
-    7013658,
-    7013665,
-    7013666,
-    7013668,
-    7013669,
-    7013670,
-    7013672,
-    7013673,
-    7013674,
-    7013695,
-    7013696,
-    7013697,
-    7013698,
-    7013700,
-    7013702,
-    7013704,
-    7013705,
-    7013706,
-    7013712,
-    7013713,
-    7013714,
-    7013720,
-    7013721,
-    7013722,
-    7013728,
-    7013729,
-    7013730,
-    7013732,
-    7013734,
-    7013736,
-    7013737,
-    7013738,
-    7013759,
-    7014657,
-    7014658,
-    7014660,
-    7014661,
-    7014662,
-    7014664,
-    7014665,
-    7014666,
-    7014673,
-    7014674,
-    7014680,
-    7014681,
-    7014682,
-    7014689,
-    7014690,
-    7014692,
-    7014693,
-    7014694,
-    7014696,
-    7014697,
-    7014698,
-    7014719,
-    7014720,
-    7014721,
-    7014722,
-    7014724,
-    7014726,
-    7014728,
-    7014729,
-    7014730,
-    7014736,
-    7014737,
-    7014738,
-    7014744,
-    7014745,
-    7014746,
-    7014752,
-    7014753,
-    7014754,
-    7014756,
-    7014758,
-    7014760,
-    7014761,
-    7014762,
-    7014783,
-    7016452,
-    7016453,
-    7016454,
-    7016456,
-    7016457,
-    7016458,
-    7016465,
-    7016466,
-    7016469,
-    7016470,
-    7016473,
-    7016474,
-    7016482,
-    7016486,
-    7016490,
-    7016511,
-    7016516,
-    7016518,
-    7016520,
-    7016521,
-    7016522,
-    7016528,
-    7016529,
-    7016530,
-    7016532,
-    7016534,
-    7016536,
-    7016537,
-    7016538,
-    7016544,
-    7016545,
-    7016546,
-    7016548,
-    7016550,
-    7016552,
-    7016553,
-    7016554,
-    7016575,
-    7016768,
-    7016769,
-    7016770,
-    7016776,
-    7016777,
-    7016778,
-    7016785,
-    7016786,
-    7016793,
-    7016794,
-    7016802,
-    7016810,
-    7017476,
-    7017477,
-    7017478,
-    7017480,
-    7017481,
-    7017482,
-    7017489,
-    7017490,
-    7017492,
-    7017493,
-    7017494,
-    7017496,
-    7017497,
-    7017498,
-    7017505,
-    7017506,
-    7017508,
-    7017509,
-    7017510,
-    7017512,
-    7017513,
-    7017514,
-    7017535,
-    7017729,
-    7017730,
-    7017732,
-    7017733,
-    7017734,
-    7017736,
-    7017737,
-    7017738,
-    7017745,
-    7017746,
-    7017752,
-    7017753,
-    7017754,
-    7017761,
-    7017762,
-    7017764,
-    7017765,
-    7017766,
-    7017768,
-    7017769,
-    7017770,
-    7017791,
-    7018500,
-    7018501,
-    7018502,
-    7018504,
-    7018505,
-    7018506,
-    7018513,
-    7018514,
-    7018516,
-    7018517,
-    7018518,
-    7018520,
-    7018521,
-    7018522,
-    7018529,
-    7018530,
-    7018532,
-    7018533,
-    7018534,
-    7018536,
-    7018537,
-    7018538,
-    7018559,
-    7018564,
-    7018566,
-    7018568,
-    7018569,
-    7018570,
-    7018576,
-    7018577,
-    7018578,
-    7018580,
-    7018582,
-    7018584,
-    7018585,
-    7018586,
-    7018592,
-    7018593,
-    7018594,
-    7018596,
-    7018598,
-    7018600,
-    7018601,
-    7018602,
-    7018623,
-    7018753,
-    7018754,
-    7018756,
-    7018757,
-    7018758,
-    7018760,
-    7018761,
-    7018762,
-    7018769,
-    7018770,
-    7018776,
-    7018777,
-    7018778,
-    7018785,
-    7018786,
-    7018788,
-    7018789,
-    7018790,
-    7018792,
-    7018793,
-    7018794,
-    7018815,
-    7018816,
-    7018817,
-    7018818,
-    7018824,
-    7018825,
-    7018826,
-    7018832,
-    7018833,
-    7018834,
-    7018840,
-    7018841,
-    7018842,
-    7018848,
-    7018849,
-    7018850,
-    7018856,
-    7018857,
-    7018858,
-    7029764,
-    7029765,
-    7029766,
-    7029768,
-    7029769,
-    7029770,
-    7029777,
-    7029778,
-    7029781,
-    7029782,
-    7029785,
-    7029786,
-    7029794,
-    7029798,
-    7029802,
-    7029823,
-    7029828,
-    7029830,
-    7029832,
-    7029833,
-    7029834,
-    7029840,
-    7029841,
-    7029842,
-    7029844,
-    7029846,
-    7029848,
-    7029849,
-    7029850,
-    7029856,
-    7029857,
-    7029858,
-    7029860,
-    7029862,
-    7029864,
-    7029865,
-    7029866,
-    7029887,
-    7030080,
-    7030081,
-    7030082,
-    7030084,
-    7030086,
-    7030088,
-    7030089,
-    7030090,
-    7030097,
-    7030098,
-    7030105,
-    7030106,
-    7030114,
-    7030118,
-    7030122,
-    7030143,
-    7030788,
-    7030789,
-    7030790,
-    7030792,
-    7030793,
-    7030794,
-    7030801,
-    7030802,
-    7030804,
-    7030805,
-    7030806,
-    7030808,
-    7030809,
-    7030810,
-    7030817,
-    7030818,
-    7030820,
-    7030821,
-    7030822,
-    7030824,
-    7030825,
-    7030826,
-    7030847,
-    7030852,
-    7030854,
-    7030856,
-    7030857,
-    7030858,
-    7030864,
-    7030865,
-    7030866,
-    7030868,
-    7030870,
-    7030872,
-    7030873,
-    7030874,
-    7030880,
-    7030881,
-    7030882,
-    7030884,
-    7030886,
-    7030888,
-    7030889,
-    7030890,
-    7030911,
-    7031041,
-    7031042,
-    7031044,
-    7031045,
-    7031046,
-    7031048,
-    7031049,
-    7031050,
-    7031057,
-    7031058,
-    7031064,
-    7031065,
-    7031066,
-    7031073,
-    7031074,
-    7031076,
-    7031077,
-    7031078,
-    7031080,
-    7031081,
-    7031082,
-    7031103,
-    7031104,
-    7031105,
-    7031106,
-    7031108,
-    7031110,
-    7031112,
-    7031113,
-    7031114,
-    7031120,
-    7031121,
-    7031122,
-    7031128,
-    7031129,
-    7031130,
-    7031136,
-    7031137,
-    7031138,
-    7031140,
-    7031142,
-    7031144,
-    7031145,
-    7031146,
-    7031167,
-    7033860,
-    7033861,
-    7033862,
-    7033864,
-    7033865,
-    7033866,
-    7033873,
-    7033874,
-    7033877,
-    7033878,
-    7033881,
-    7033882,
-    7033890,
-    7033894,
-    7033898,
-    7033919,
-    7034884,
-    7034885,
-    7034886,
-    7034888,
-    7034889,
-    7034890,
-    7034897,
-    7034898,
-    7034900,
-    7034901,
-    7034902,
-    7034904,
-    7034905,
-    7034906,
-    7034913,
-    7034914,
-    7034916,
-    7034917,
-    7034918,
-    7034920,
-    7034921,
-    7034922,
-    7034943,
-    7034948,
-    7034950,
-    7034952,
-    7034953,
-    7034954,
-    7034960,
-    7034961,
-    7034962,
-    7034964,
-    7034966,
-    7034968,
-    7034969,
-    7034970,
-    7034976,
-    7034977,
-    7034978,
-    7034980,
-    7034982,
-    7034984,
-    7034985,
-    7034986,
-    7035007,
-    7143744,
-    7143745,
-    7143746,
-    7143748,
-    7143750,
-    7143760,
-    7143761,
-    7143762,
-    7143776,
-    7143777,
-    7143780,
-    7143808,
-    7143809,
-    7143810,
-    7143812,
-    7143813,
-    7143814,
-    7143824,
-    7143825,
-    7143826,
-    7143841,
-    7143844,
-    7144705,
-    7144706,
-    7144708,
-    7144709,
-    7144710,
-    7144721,
-    7144722,
-    7144737,
-    7144740,
-    7144741,
-    7144769,
-    7144770,
-    7144772,
-    7144774,
-    7144784,
-    7144785,
-    7144786,
-    7144800,
-    7144801,
-    7144804,
-    7144833,
-    7144834,
-    7144836,
-    7144837,
-    7144838,
-    7144848,
-    7144849,
-    7144850,
-    7144865,
-    7144868,
-    7145730,
-    7145732,
-    7145733,
-    7145734,
-    7145745,
-    7145746,
-    7145761,
-    7145764,
-    7145765,
-    7145794,
-    7145796,
-    7145798,
-    7145808,
-    7145809,
-    7145810,
-    7145824,
-    7145825,
-    7145828,
-    7145858,
-    7145860,
-    7145861,
-    7145862,
-    7145872,
-    7145873,
-    7145874,
-    7145889,
-    7145892,
-    7146947,
-    7146951,
-    7146963,
-    7146979,
-    7146983,
-    7147524,
-    7147525,
-    7147526,
-    7147537,
-    7147538,
-    7147540,
-    7147541,
-    7147542,
-    7147553,
-    7147556,
-    7147557,
-    7147588,
-    7147590,
-    7147600,
-    7147601,
-    7147602,
-    7147604,
-    7147606,
-    7147616,
-    7147617,
-    7147620,
-    7147652,
-    7147653,
-    7147654,
-    7147664,
-    7147665,
-    7147666,
-    7147668,
-    7147669,
-    7147670,
-    7147681,
-    7147684,
-    7147780,
-    7147781,
-    7147782,
-    7147793,
-    7147794,
-    7147809,
-    7147812,
-    7147813,
-    7147856,
-    7147857,
-    7147858,
-    7147872,
-    7147873,
-    7147908,
-    7147909,
-    7147910,
-    7147920,
-    7147921,
-    7147922,
-    7147937,
-    7147940,
-    7148549,
-    7148550,
-    7148561,
-    7148562,
-    7148564,
-    7148565,
-    7148566,
-    7148577,
-    7148580,
-    7148581,
-    7148677,
-    7148678,
-    7148688,
-    7148689,
-    7148690,
-    7148692,
-    7148693,
-    7148694,
-    7148705,
-    7148708,
-    7148805,
-    7148806,
-    7148817,
-    7148818,
-    7148833,
-    7148836,
-    7148837,
-    7148933,
-    7148934,
-    7148944,
-    7148945,
-    7148946,
-    7148961,
-    7148964,
-    7149574,
-    7149585,
-    7149586,
-    7149588,
-    7149589,
-    7149590,
-    7149601,
-    7149604,
-    7149605,
-    7149638,
-    7149648,
-    7149649,
-    7149650,
-    7149652,
-    7149654,
-    7149664,
-    7149665,
-    7149668,
-    7149702,
-    7149712,
-    7149713,
-    7149714,
-    7149716,
-    7149717,
-    7149718,
-    7149729,
-    7149732,
-    7149830,
-    7149841,
-    7149842,
-    7149857,
-    7149860,
-    7149861,
-    7149904,
-    7149905,
-    7149906,
-    7149920,
-    7149921,
-    7149958,
-    7149968,
-    7149969,
-    7149970,
-    7149985,
-    7149988,
-    7150791,
-    7150803,
-    7150807,
-    7150819,
-    7150823,
-    7151059,
-    7151075,
-    7159888,
-    7159889,
-    7159890,
-    7159892,
-    7159894,
-    7159904,
-    7159905,
-    7159908,
-    7159952,
-    7159953,
-    7159954,
-    7159956,
-    7159957,
-    7159958,
-    7159969,
-    7159972,
-    7160144,
-    7160145,
-    7160146,
-    7160160,
-    7160161,
-    7160164,
-    7160208,
-    7160209,
-    7160210,
-    7160225,
-    7160228,
-    7160849,
-    7160850,
-    7160852,
-    7160853,
-    7160854,
-    7160865,
-    7160868,
-    7160869,
-    7160913,
-    7160914,
-    7160916,
-    7160918,
-    7160928,
-    7160929,
-    7160932,
-    7160977,
-    7160978,
-    7160980,
-    7160981,
-    7160982,
-    7160993,
-    7160996,
-    7161105,
-    7161106,
-    7161121,
-    7161124,
-    7161125,
-    7161169,
-    7161170,
-    7161184,
-    7161185,
-    7161188,
-    7161233,
-    7161234,
-    7161249,
-    7161252,
-    7161874,
-    7161876,
-    7161877,
-    7161878,
-    7161889,
-    7161892,
-    7161893,
-    7161938,
-    7161940,
-    7161942,
-    7161952,
-    7161953,
-    7161956,
-    7162002,
-    7162004,
-    7162005,
-    7162006,
-    7162017,
-    7162020,
-    7162130,
-    7162145,
-    7162148,
-    7162149,
-    7162194,
-    7162208,
-    7162209,
-    7162212,
-    7162258,
-    7162273,
-    7162276,
-    7163091,
-    7163095,
-    7163107,
-    7163111,
-    7163347,
-    7163363,
-    7163367,
-    7163924,
-    7163925,
-    7163926,
-    7163937,
-    7163940,
-    7163941,
-    7163988,
-    7163990,
-    7164000,
-    7164001,
-    7164004,
-    7164052,
-    7164053,
-    7164054,
-    7164065,
-    7164068,
-    7164949,
-    7164950,
-    7164961,
-    7164964,
-    7164965,
-    7165077,
-    7165078,
-    7165089,
-    7165092,
-    7165974,
-    7165985,
-    7165988,
-    7165989,
-    7166038,
-    7166048,
-    7166049,
-    7166052,
-    7166102,
-    7166113,
-    7166116,
-    7167191,
-    7167203,
-    7167207,
-    7176288,
-    7176289,
-    7176292,
-    7176544,
-    7176545,
-    7176548,
-    7177249,
-    7177252,
-    7177253,
-    7177313,
-    7177316,
-    7177377,
-    7177380,
-    7177505,
-    7177508,
-    7177509,
-    7177569,
-    7177572,
-    7177633,
-    7177636,
-    7179495,
-    7179747,
-    7179751,
-    7180324,
-    7180325,
-    7180388,
-    7180452,
-    7180580,
-    7180581,
-    7180708,
-    7181349,
-    7181605,
-    7183591,
-    7209280,
-    7209281,
-    7209282,
-    7209284,
-    7209286,
-    7209296,
-    7209297,
-    7209298,
-    7209300,
-    7209302,
-    7209312,
-    7209313,
-    7209314,
-    7209316,
-    7209318,
-    7209344,
-    7209345,
-    7209346,
-    7209348,
-    7209349,
-    7209350,
-    7209360,
-    7209361,
-    7209362,
-    7209364,
-    7209365,
-    7209366,
-    7209376,
-    7209377,
-    7209378,
-    7209380,
-    7209381,
-    7209382,
-    7210241,
-    7210242,
-    7210244,
-    7210245,
-    7210246,
-    7210257,
-    7210258,
-    7210260,
-    7210261,
-    7210262,
-    7210273,
-    7210274,
-    7210276,
-    7210277,
-    7210278,
-    7210304,
-    7210305,
-    7210306,
-    7210308,
-    7210310,
-    7210320,
-    7210321,
-    7210322,
-    7210324,
-    7210326,
-    7210336,
-    7210337,
-    7210338,
-    7210340,
-    7210342,
-    7210368,
-    7210369,
-    7210370,
-    7210372,
-    7210373,
-    7210374,
-    7210384,
-    7210385,
-    7210386,
-    7210388,
-    7210389,
-    7210390,
-    7210400,
-    7210401,
-    7210402,
-    7210404,
-    7210405,
-    7210406,
-    7211265,
-    7211266,
-    7211268,
-    7211269,
-    7211270,
-    7211281,
-    7211282,
-    7211284,
-    7211285,
-    7211286,
-    7211297,
-    7211298,
-    7211300,
-    7211301,
-    7211302,
-    7211328,
-    7211329,
-    7211330,
-    7211332,
-    7211334,
-    7211344,
-    7211345,
-    7211346,
-    7211348,
-    7211350,
-    7211360,
-    7211361,
-    7211362,
-    7211364,
-    7211366,
-    7211392,
-    7211393,
-    7211394,
-    7211396,
-    7211397,
-    7211398,
-    7211408,
-    7211409,
-    7211410,
-    7211412,
-    7211413,
-    7211414,
-    7211424,
-    7211425,
-    7211426,
-    7211428,
-    7211429,
-    7211430,
-    7212483,
-    7212487,
-    7212499,
-    7212503,
-    7212515,
-    7212519,
-    7213057,
-    7213058,
-    7213060,
-    7213061,
-    7213062,
-    7213073,
-    7213074,
-    7213076,
-    7213077,
-    7213078,
-    7213089,
-    7213090,
-    7213092,
-    7213093,
-    7213094,
-    7213120,
-    7213121,
-    7213122,
-    7213124,
-    7213126,
-    7213136,
-    7213137,
-    7213138,
-    7213140,
-    7213142,
-    7213152,
-    7213153,
-    7213154,
-    7213156,
-    7213158,
-    7213184,
-    7213185,
-    7213186,
-    7213188,
-    7213189,
-    7213190,
-    7213200,
-    7213201,
-    7213202,
-    7213204,
-    7213205,
-    7213206,
-    7213216,
-    7213217,
-    7213218,
-    7213220,
-    7213221,
-    7213222,
-    7213313,
-    7213314,
-    7213316,
-    7213317,
-    7213318,
-    7213329,
-    7213330,
-    7213332,
-    7213333,
-    7213334,
-    7213345,
-    7213346,
-    7213348,
-    7213349,
-    7213350,
-    7213376,
-    7213377,
-    7213378,
-    7213392,
-    7213393,
-    7213394,
-    7213408,
-    7213409,
-    7213410,
-    7213440,
-    7213441,
-    7213442,
-    7213444,
-    7213445,
-    7213446,
-    7213456,
-    7213457,
-    7213458,
-    7213460,
-    7213461,
-    7213462,
-    7213472,
-    7213473,
-    7213474,
-    7213476,
-    7213477,
-    7213478,
-    7214081,
-    7214082,
-    7214084,
-    7214085,
-    7214086,
-    7214097,
-    7214098,
-    7214100,
-    7214101,
-    7214102,
-    7214113,
-    7214114,
-    7214116,
-    7214117,
-    7214118,
-    7214208,
-    7214209,
-    7214210,
-    7214212,
-    7214213,
-    7214214,
-    7214224,
-    7214225,
-    7214226,
-    7214228,
-    7214229,
-    7214230,
-    7214240,
-    7214241,
-    7214242,
-    7214244,
-    7214245,
-    7214246,
-    7214337,
-    7214338,
-    7214340,
-    7214341,
-    7214342,
-    7214353,
-    7214354,
-    7214356,
-    7214357,
-    7214358,
-    7214369,
-    7214370,
-    7214372,
-    7214373,
-    7214374,
-    7214464,
-    7214465,
-    7214466,
-    7214468,
-    7214469,
-    7214470,
-    7214480,
-    7214481,
-    7214482,
-    7214484,
-    7214485,
-    7214486,
-    7214496,
-    7214497,
-    7214498,
-    7214500,
-    7214501,
-    7214502,
-    7215105,
-    7215106,
-    7215108,
-    7215109,
-    7215110,
-    7215121,
-    7215122,
-    7215124,
-    7215125,
-    7215126,
-    7215137,
-    7215138,
-    7215140,
-    7215141,
-    7215142,
-    7215168,
-    7215169,
-    7215170,
-    7215172,
-    7215174,
-    7215184,
-    7215185,
-    7215186,
-    7215188,
-    7215190,
-    7215200,
-    7215201,
-    7215202,
-    7215204,
-    7215206,
-    7215232,
-    7215233,
-    7215234,
-    7215236,
-    7215237,
-    7215238,
-    7215248,
-    7215249,
-    7215250,
-    7215252,
-    7215253,
-    7215254,
-    7215264,
-    7215265,
-    7215266,
-    7215268,
-    7215269,
-    7215270,
-    7215361,
-    7215362,
-    7215364,
-    7215365,
-    7215366,
-    7215377,
-    7215378,
-    7215380,
-    7215381,
-    7215382,
-    7215393,
-    7215394,
-    7215396,
-    7215397,
-    7215398,
-    7215424,
-    7215425,
-    7215426,
-    7215440,
-    7215441,
-    7215442,
-    7215456,
-    7215457,
-    7215458,
-    7215488,
-    7215489,
-    7215490,
-    7215492,
-    7215493,
-    7215494,
-    7215504,
-    7215505,
-    7215506,
-    7215508,
-    7215509,
-    7215510,
-    7215520,
-    7215521,
-    7215522,
-    7215524,
-    7215525,
-    7215526,
-    7216323,
-    7216327,
-    7216339,
-    7216343,
-    7216355,
-    7216359,
-    7216579,
-    7216595,
-    7216611,
-    7225408,
-    7225409,
-    7225410,
-    7225412,
-    7225414,
-    7225424,
-    7225425,
-    7225426,
-    7225428,
-    7225430,
-    7225440,
-    7225441,
-    7225442,
-    7225444,
-    7225446,
-    7225472,
-    7225473,
-    7225474,
-    7225476,
-    7225477,
-    7225478,
-    7225488,
-    7225489,
-    7225490,
-    7225492,
-    7225493,
-    7225494,
-    7225504,
-    7225505,
-    7225506,
-    7225508,
-    7225509,
-    7225510,
-    7225664,
-    7225665,
-    7225666,
-    7225668,
-    7225670,
-    7225680,
-    7225681,
-    7225682,
-    7225684,
-    7225686,
-    7225696,
-    7225697,
-    7225698,
-    7225700,
-    7225702,
-    7225728,
-    7225729,
-    7225730,
-    7225732,
-    7225733,
-    7225734,
-    7225744,
-    7225745,
-    7225746,
-    7225748,
-    7225749,
-    7225750,
-    7225760,
-    7225761,
-    7225762,
-    7225764,
-    7225765,
-    7225766,
-    7226369,
-    7226370,
-    7226372,
-    7226373,
-    7226374,
-    7226385,
-    7226386,
-    7226388,
-    7226389,
-    7226390,
-    7226401,
-    7226402,
-    7226404,
-    7226405,
-    7226406,
-    7226432,
-    7226433,
-    7226434,
-    7226436,
-    7226438,
-    7226448,
-    7226449,
-    7226450,
-    7226452,
-    7226454,
-    7226464,
-    7226465,
-    7226466,
-    7226468,
-    7226470,
-    7226496,
-    7226497,
-    7226498,
-    7226500,
-    7226501,
-    7226502,
-    7226512,
-    7226513,
-    7226514,
-    7226516,
-    7226517,
-    7226518,
-    7226528,
-    7226529,
-    7226530,
-    7226532,
-    7226533,
-    7226534,
-    7226625,
-    7226626,
-    7226628,
-    7226629,
-    7226630,
-    7226641,
-    7226642,
-    7226644,
-    7226645,
-    7226646,
-    7226657,
-    7226658,
-    7226660,
-    7226661,
-    7226662,
-    7226688,
-    7226689,
-    7226690,
-    7226692,
-    7226694,
-    7226704,
-    7226705,
-    7226706,
-    7226708,
-    7226710,
-    7226720,
-    7226721,
-    7226722,
-    7226724,
-    7226726,
-    7226752,
-    7226753,
-    7226754,
-    7226756,
-    7226757,
-    7226758,
-    7226768,
-    7226769,
-    7226770,
-    7226772,
-    7226773,
-    7226774,
-    7226784,
-    7226785,
-    7226786,
-    7226788,
-    7226789,
-    7226790,
-    7227393,
-    7227394,
-    7227396,
-    7227397,
-    7227398,
-    7227409,
-    7227410,
-    7227412,
-    7227413,
-    7227414,
-    7227425,
-    7227426,
-    7227428,
-    7227429,
-    7227430,
-    7227456,
-    7227457,
-    7227458,
-    7227460,
-    7227462,
-    7227472,
-    7227473,
-    7227474,
-    7227476,
-    7227478,
-    7227488,
-    7227489,
-    7227490,
-    7227492,
-    7227494,
-    7227520,
-    7227521,
-    7227522,
-    7227524,
-    7227525,
-    7227526,
-    7227536,
-    7227537,
-    7227538,
-    7227540,
-    7227541,
-    7227542,
-    7227552,
-    7227553,
-    7227554,
-    7227556,
-    7227557,
-    7227558,
-    7227649,
-    7227650,
-    7227652,
-    7227653,
-    7227654,
-    7227665,
-    7227666,
-    7227668,
-    7227669,
-    7227670,
-    7227681,
-    7227682,
-    7227684,
-    7227685,
-    7227686,
-    7227712,
-    7227713,
-    7227714,
-    7227716,
-    7227718,
-    7227728,
-    7227729,
-    7227730,
-    7227732,
-    7227734,
-    7227744,
-    7227745,
-    7227746,
-    7227748,
-    7227750,
-    7227776,
-    7227777,
-    7227778,
-    7227780,
-    7227781,
-    7227782,
-    7227792,
-    7227793,
-    7227794,
-    7227796,
-    7227797,
-    7227798,
-    7227808,
-    7227809,
-    7227810,
-    7227812,
-    7227813,
-    7227814,
-    7228611,
-    7228615,
-    7228627,
-    7228631,
-    7228643,
-    7228647,
-    7228867,
-    7228871,
-    7228883,
-    7228887,
-    7228899,
-    7228903,
-    7229441,
-    7229442,
-    7229444,
-    7229445,
-    7229446,
-    7229457,
-    7229458,
-    7229460,
-    7229461,
-    7229462,
-    7229473,
-    7229474,
-    7229476,
-    7229477,
-    7229478,
-    7229504,
-    7229505,
-    7229506,
-    7229508,
-    7229510,
-    7229520,
-    7229521,
-    7229522,
-    7229524,
-    7229526,
-    7229536,
-    7229537,
-    7229538,
-    7229540,
-    7229542,
-    7229568,
-    7229569,
-    7229570,
-    7229572,
-    7229573,
-    7229574,
-    7229584,
-    7229585,
-    7229586,
-    7229588,
-    7229589,
-    7229590,
-    7229600,
-    7229601,
-    7229602,
-    7229604,
-    7229605,
-    7229606,
-    7230465,
-    7230466,
-    7230468,
-    7230469,
-    7230470,
-    7230481,
-    7230482,
-    7230484,
-    7230485,
-    7230486,
-    7230497,
-    7230498,
-    7230500,
-    7230501,
-    7230502,
-    7230592,
-    7230593,
-    7230594,
-    7230596,
-    7230597,
-    7230598,
-    7230608,
-    7230609,
-    7230610,
-    7230612,
-    7230613,
-    7230614,
-    7230624,
-    7230625,
-    7230626,
-    7230628,
-    7230629,
-    7230630,
-    7231489,
-    7231490,
-    7231492,
-    7231493,
-    7231494,
-    7231505,
-    7231506,
-    7231508,
-    7231509,
-    7231510,
-    7231521,
-    7231522,
-    7231524,
-    7231525,
-    7231526,
-    7231552,
-    7231553,
-    7231554,
-    7231556,
-    7231558,
-    7231568,
-    7231569,
-    7231570,
-    7231572,
-    7231574,
-    7231584,
-    7231585,
-    7231586,
-    7231588,
-    7231590,
-    7231616,
-    7231617,
-    7231618,
-    7231620,
-    7231621,
-    7231622,
-    7231632,
-    7231633,
-    7231634,
-    7231636,
-    7231637,
-    7231638,
-    7231648,
-    7231649,
-    7231650,
-    7231652,
-    7231653,
-    7231654,
-    7232707,
-    7232711,
-    7232723,
-    7232727,
-    7232739,
-    7232743,
-    7241792,
-    7241793,
-    7241794,
-    7241796,
-    7241798,
-    7241808,
-    7241809,
-    7241810,
-    7241812,
-    7241814,
-    7241824,
-    7241825,
-    7241826,
-    7241828,
-    7241830,
-    7242048,
-    7242049,
-    7242050,
-    7242052,
-    7242054,
-    7242064,
-    7242065,
-    7242066,
-    7242068,
-    7242070,
-    7242080,
-    7242081,
-    7242082,
-    7242084,
-    7242086,
-    7242753,
-    7242754,
-    7242756,
-    7242757,
-    7242758,
-    7242769,
-    7242770,
-    7242772,
-    7242773,
-    7242774,
-    7242785,
-    7242786,
-    7242788,
-    7242789,
-    7242790,
-    7242816,
-    7242817,
-    7242818,
-    7242820,
-    7242822,
-    7242832,
-    7242833,
-    7242834,
-    7242836,
-    7242838,
-    7242848,
-    7242849,
-    7242850,
-    7242852,
-    7242854,
-    7242880,
-    7242881,
-    7242882,
-    7242884,
-    7242885,
-    7242886,
-    7242896,
-    7242897,
-    7242898,
-    7242900,
-    7242901,
-    7242902,
-    7242912,
-    7242913,
-    7242914,
-    7242916,
-    7242917,
-    7242918,
-    7243009,
-    7243010,
-    7243012,
-    7243013,
-    7243014,
-    7243025,
-    7243026,
-    7243028,
-    7243029,
-    7243030,
-    7243041,
-    7243042,
-    7243044,
-    7243045,
-    7243046,
-    7243072,
-    7243073,
-    7243074,
-    7243076,
-    7243078,
-    7243088,
-    7243089,
-    7243090,
-    7243092,
-    7243094,
-    7243104,
-    7243105,
-    7243106,
-    7243108,
-    7243110,
-    7243136,
-    7243137,
-    7243138,
-    7243140,
-    7243141,
-    7243142,
-    7243152,
-    7243153,
-    7243154,
-    7243156,
-    7243157,
-    7243158,
-    7243168,
-    7243169,
-    7243170,
-    7243172,
-    7243173,
-    7243174,
-    7244999,
-    7245011,
-    7245015,
-    7245031,
-    7245251,
-    7245255,
-    7245267,
-    7245271,
-    7245283,
-    7245287,
-    7245825,
-    7245826,
-    7245828,
-    7245829,
-    7245830,
-    7245841,
-    7245842,
-    7245844,
-    7245845,
-    7245846,
-    7245857,
-    7245858,
-    7245860,
-    7245861,
-    7245862,
-    7245888,
-    7245889,
-    7245890,
-    7245892,
-    7245894,
-    7245904,
-    7245905,
-    7245906,
-    7245908,
-    7245910,
-    7245920,
-    7245921,
-    7245922,
-    7245924,
-    7245926,
-    7245952,
-    7245953,
-    7245954,
-    7245956,
-    7245957,
-    7245958,
-    7245968,
-    7245969,
-    7245970,
-    7245972,
-    7245973,
-    7245974,
-    7245984,
-    7245985,
-    7245986,
-    7245988,
-    7245989,
-    7245990,
-    7246081,
-    7246082,
-    7246084,
-    7246085,
-    7246086,
-    7246097,
-    7246098,
-    7246100,
-    7246101,
-    7246102,
-    7246113,
-    7246114,
-    7246116,
-    7246117,
-    7246118,
-    7246144,
-    7246145,
-    7246146,
-    7246160,
-    7246161,
-    7246162,
-    7246176,
-    7246177,
-    7246178,
-    7246208,
-    7246209,
-    7246210,
-    7246212,
-    7246213,
-    7246214,
-    7246224,
-    7246225,
-    7246226,
-    7246228,
-    7246229,
-    7246230,
-    7246240,
-    7246241,
-    7246242,
-    7246244,
-    7246245,
-    7246246,
-    7246849,
-    7246850,
-    7246852,
-    7246853,
-    7246854,
-    7246865,
-    7246866,
-    7246868,
-    7246869,
-    7246870,
-    7246881,
-    7246882,
-    7246884,
-    7246885,
-    7246886,
-    7247105,
-    7247106,
-    7247108,
-    7247109,
-    7247110,
-    7247121,
-    7247122,
-    7247124,
-    7247125,
-    7247126,
-    7247137,
-    7247138,
-    7247140,
-    7247141,
-    7247142,
-    7249091,
-    7249095,
-    7249107,
-    7249111,
-    7249123,
-    7249127,
-    7249347,
-    7249363,
-    7249379,
-    7274816,
-    7274817,
-    7274818,
-    7274820,
-    7274821,
-    7274822,
-    7274824,
-    7274825,
-    7274826,
-    7274832,
-    7274833,
-    7274834,
-    7274840,
-    7274841,
-    7274842,
-    7274848,
-    7274849,
-    7274850,
-    7274852,
-    7274853,
-    7274854,
-    7274856,
-    7274857,
-    7274858,
-    7274879,
-    7274880,
-    7274881,
-    7274882,
-    7274884,
-    7274885,
-    7274886,
-    7274888,
-    7274889,
-    7274890,
-    7274896,
-    7274897,
-    7274898,
-    7274904,
-    7274905,
-    7274906,
-    7274912,
-    7274913,
-    7274914,
-    7274916,
-    7274917,
-    7274918,
-    7274920,
-    7274921,
-    7274922,
-    7274943,
-    7275776,
-    7275777,
-    7275778,
-    7275780,
-    7275781,
-    7275782,
-    7275784,
-    7275785,
-    7275786,
-    7275792,
-    7275793,
-    7275794,
-    7275800,
-    7275801,
-    7275802,
-    7275808,
-    7275809,
-    7275810,
-    7275812,
-    7275813,
-    7275814,
-    7275816,
-    7275817,
-    7275818,
-    7275839,
-    7275840,
-    7275841,
-    7275842,
-    7275844,
-    7275845,
-    7275846,
-    7275848,
-    7275849,
-    7275850,
-    7275856,
-    7275857,
-    7275858,
-    7275864,
-    7275865,
-    7275866,
-    7275872,
-    7275873,
-    7275874,
-    7275876,
-    7275877,
-    7275878,
-    7275880,
-    7275881,
-    7275882,
-    7275903,
-    7275904,
-    7275905,
-    7275906,
-    7275908,
-    7275909,
-    7275910,
-    7275912,
-    7275913,
-    7275914,
-    7275920,
-    7275921,
-    7275922,
-    7275928,
-    7275929,
-    7275930,
-    7275936,
-    7275937,
-    7275938,
-    7275940,
-    7275941,
-    7275942,
-    7275944,
-    7275945,
-    7275946,
-    7275967,
-    7276800,
-    7276801,
-    7276802,
-    7276804,
-    7276805,
-    7276806,
-    7276808,
-    7276809,
-    7276810,
-    7276816,
-    7276817,
-    7276818,
-    7276824,
-    7276825,
-    7276826,
-    7276832,
-    7276833,
-    7276834,
-    7276836,
-    7276837,
-    7276838,
-    7276840,
-    7276841,
-    7276842,
-    7276863,
-    7276864,
-    7276865,
-    7276866,
-    7276868,
-    7276869,
-    7276870,
-    7276872,
-    7276873,
-    7276874,
-    7276880,
-    7276881,
-    7276882,
-    7276888,
-    7276889,
-    7276890,
-    7276896,
-    7276897,
-    7276898,
-    7276900,
-    7276901,
-    7276902,
-    7276904,
-    7276905,
-    7276906,
-    7276927,
-    7276928,
-    7276929,
-    7276930,
-    7276932,
-    7276933,
-    7276934,
-    7276936,
-    7276937,
-    7276938,
-    7276944,
-    7276945,
-    7276946,
-    7276952,
-    7276953,
-    7276954,
-    7276960,
-    7276961,
-    7276962,
-    7276964,
-    7276965,
-    7276966,
-    7276968,
-    7276969,
-    7276970,
-    7276991,
-    7278019,
-    7278023,
-    7278027,
-    7278035,
-    7278043,
-    7278051,
-    7278055,
-    7278059,
-    7278079,
-    7278596,
-    7278597,
-    7278598,
-    7278600,
-    7278601,
-    7278602,
-    7278608,
-    7278609,
-    7278610,
-    7278612,
-    7278613,
-    7278614,
-    7278616,
-    7278617,
-    7278618,
-    7278624,
-    7278625,
-    7278626,
-    7278628,
-    7278629,
-    7278630,
-    7278632,
-    7278633,
-    7278634,
-    7278655,
-    7278660,
-    7278661,
-    7278662,
-    7278664,
-    7278665,
-    7278666,
-    7278672,
-    7278673,
-    7278674,
-    7278676,
-    7278677,
-    7278678,
-    7278680,
-    7278681,
-    7278682,
-    7278688,
-    7278689,
-    7278690,
-    7278692,
-    7278693,
-    7278694,
-    7278696,
-    7278697,
-    7278698,
-    7278719,
-    7278724,
-    7278725,
-    7278726,
-    7278728,
-    7278729,
-    7278730,
-    7278736,
-    7278737,
-    7278738,
-    7278740,
-    7278741,
-    7278742,
-    7278744,
-    7278745,
-    7278746,
-    7278752,
-    7278753,
-    7278754,
-    7278756,
-    7278757,
-    7278758,
-    7278760,
-    7278761,
-    7278762,
-    7278783,
-    7278848,
-    7278849,
-    7278850,
-    7278852,
-    7278853,
-    7278854,
-    7278856,
-    7278857,
-    7278858,
-    7278864,
-    7278865,
-    7278866,
-    7278872,
-    7278873,
-    7278874,
-    7278880,
-    7278881,
-    7278882,
-    7278884,
-    7278885,
-    7278886,
-    7278888,
-    7278889,
-    7278890,
-    7278911,
-    7278912,
-    7278913,
-    7278914,
-    7278920,
-    7278921,
-    7278922,
-    7278928,
-    7278929,
-    7278930,
-    7278936,
-    7278937,
-    7278938,
-    7278944,
-    7278945,
-    7278946,
-    7278952,
-    7278953,
-    7278954,
-    7278976,
-    7278977,
-    7278978,
-    7278980,
-    7278981,
-    7278982,
-    7278984,
-    7278985,
-    7278986,
-    7278992,
-    7278993,
-    7278994,
-    7279000,
-    7279001,
-    7279002,
-    7279008,
-    7279009,
-    7279010,
-    7279012,
-    7279013,
-    7279014,
-    7279016,
-    7279017,
-    7279018,
-    7279039,
-    7279620,
-    7279621,
-    7279622,
-    7279624,
-    7279625,
-    7279626,
-    7279632,
-    7279633,
-    7279634,
-    7279636,
-    7279637,
-    7279638,
-    7279640,
-    7279641,
-    7279642,
-    7279648,
-    7279649,
-    7279650,
-    7279652,
-    7279653,
-    7279654,
-    7279656,
-    7279657,
-    7279658,
-    7279679,
-    7279748,
-    7279749,
-    7279750,
-    7279752,
-    7279753,
-    7279754,
-    7279760,
-    7279761,
-    7279762,
-    7279764,
-    7279765,
-    7279766,
-    7279768,
-    7279769,
-    7279770,
-    7279776,
-    7279777,
-    7279778,
-    7279780,
-    7279781,
-    7279782,
-    7279784,
-    7279785,
-    7279786,
-    7279807,
-    7279872,
-    7279873,
-    7279874,
-    7279876,
-    7279877,
-    7279878,
-    7279880,
-    7279881,
-    7279882,
-    7279888,
-    7279889,
-    7279890,
-    7279896,
-    7279897,
-    7279898,
-    7279904,
-    7279905,
-    7279906,
-    7279908,
-    7279909,
-    7279910,
-    7279912,
-    7279913,
-    7279914,
-    7279935,
-    7280000,
-    7280001,
-    7280002,
-    7280004,
-    7280005,
-    7280006,
-    7280008,
-    7280009,
-    7280010,
-    7280016,
-    7280017,
-    7280018,
-    7280024,
-    7280025,
-    7280026,
-    7280032,
-    7280033,
-    7280034,
-    7280036,
-    7280037,
-    7280038,
-    7280040,
-    7280041,
-    7280042,
-    7280063,
-    7280644,
-    7280645,
-    7280646,
-    7280648,
-    7280649,
-    7280650,
-    7280656,
-    7280657,
-    7280658,
-    7280660,
-    7280661,
-    7280662,
-    7280664,
-    7280665,
-    7280666,
-    7280672,
-    7280673,
-    7280674,
-    7280676,
-    7280677,
-    7280678,
-    7280680,
-    7280681,
-    7280682,
-    7280703,
-    7280708,
-    7280709,
-    7280710,
-    7280712,
-    7280713,
-    7280714,
-    7280720,
-    7280721,
-    7280722,
-    7280724,
-    7280725,
-    7280726,
-    7280728,
-    7280729,
-    7280730,
-    7280736,
-    7280737,
-    7280738,
-    7280740,
-    7280741,
-    7280742,
-    7280744,
-    7280745,
-    7280746,
-    7280767,
-    7280772,
-    7280773,
-    7280774,
-    7280776,
-    7280777,
-    7280778,
-    7280784,
-    7280785,
-    7280786,
-    7280788,
-    7280789,
-    7280790,
-    7280792,
-    7280793,
-    7280794,
-    7280800,
-    7280801,
-    7280802,
-    7280804,
-    7280805,
-    7280806,
-    7280808,
-    7280809,
-    7280810,
-    7280831,
-    7280896,
-    7280897,
-    7280898,
-    7280900,
-    7280901,
-    7280902,
-    7280904,
-    7280905,
-    7280906,
-    7280912,
-    7280913,
-    7280914,
-    7280920,
-    7280921,
-    7280922,
-    7280928,
-    7280929,
-    7280930,
-    7280932,
-    7280933,
-    7280934,
-    7280936,
-    7280937,
-    7280938,
-    7280959,
-    7280960,
-    7280961,
-    7280962,
-    7280968,
-    7280969,
-    7280970,
-    7280976,
-    7280977,
-    7280978,
-    7280984,
-    7280985,
-    7280986,
-    7280992,
-    7280993,
-    7280994,
-    7281000,
-    7281001,
-    7281002,
-    7281024,
-    7281025,
-    7281026,
-    7281028,
-    7281029,
-    7281030,
-    7281032,
-    7281033,
-    7281034,
-    7281040,
-    7281041,
-    7281042,
-    7281048,
-    7281049,
-    7281050,
-    7281056,
-    7281057,
-    7281058,
-    7281060,
-    7281061,
-    7281062,
-    7281064,
-    7281065,
-    7281066,
-    7281087,
-    7281863,
-    7281867,
-    7281875,
-    7281879,
-    7281883,
-    7281891,
-    7281895,
-    7281899,
-    7281919,
-    7282115,
-    7282123,
-    7282131,
-    7282139,
-    7282147,
-    7282155,
-    7290948,
-    7290949,
-    7290950,
-    7290952,
-    7290953,
-    7290954,
-    7290960,
-    7290961,
-    7290962,
-    7290964,
-    7290965,
-    7290966,
-    7290968,
-    7290969,
-    7290970,
-    7290976,
-    7290977,
-    7290978,
-    7290980,
-    7290981,
-    7290982,
-    7290984,
-    7290985,
-    7290986,
-    7291007,
-    7291012,
-    7291013,
-    7291014,
-    7291016,
-    7291017,
-    7291018,
-    7291024,
-    7291025,
-    7291026,
-    7291028,
-    7291029,
-    7291030,
-    7291032,
-    7291033,
-    7291034,
-    7291040,
-    7291041,
-    7291042,
-    7291044,
-    7291045,
-    7291046,
-    7291048,
-    7291049,
-    7291050,
-    7291071,
-    7291200,
-    7291201,
-    7291202,
-    7291204,
-    7291205,
-    7291206,
-    7291208,
-    7291209,
-    7291210,
-    7291216,
-    7291217,
-    7291218,
-    7291224,
-    7291225,
-    7291226,
-    7291232,
-    7291233,
-    7291234,
-    7291236,
-    7291237,
-    7291238,
-    7291240,
-    7291241,
-    7291242,
-    7291263,
-    7291264,
-    7291265,
-    7291266,
-    7291268,
-    7291269,
-    7291270,
-    7291272,
-    7291273,
-    7291274,
-    7291280,
-    7291281,
-    7291282,
-    7291288,
-    7291289,
-    7291290,
-    7291296,
-    7291297,
-    7291298,
-    7291300,
-    7291301,
-    7291302,
-    7291304,
-    7291305,
-    7291306,
-    7291327,
-    7291908,
-    7291909,
-    7291910,
-    7291912,
-    7291913,
-    7291914,
-    7291920,
-    7291921,
-    7291922,
-    7291924,
-    7291925,
-    7291926,
-    7291928,
-    7291929,
-    7291930,
-    7291936,
-    7291937,
-    7291938,
-    7291940,
-    7291941,
-    7291942,
-    7291944,
-    7291945,
-    7291946,
-    7291967,
-    7291972,
-    7291973,
-    7291974,
-    7291976,
-    7291977,
-    7291978,
-    7291984,
-    7291985,
-    7291986,
-    7291988,
-    7291989,
-    7291990,
-    7291992,
-    7291993,
-    7291994,
-    7292000,
-    7292001,
-    7292002,
-    7292004,
-    7292005,
-    7292006,
-    7292008,
-    7292009,
-    7292010,
-    7292031,
-    7292036,
-    7292037,
-    7292038,
-    7292040,
-    7292041,
-    7292042,
-    7292048,
-    7292049,
-    7292050,
-    7292052,
-    7292053,
-    7292054,
-    7292056,
-    7292057,
-    7292058,
-    7292064,
-    7292065,
-    7292066,
-    7292068,
-    7292069,
-    7292070,
-    7292072,
-    7292073,
-    7292074,
-    7292095,
-    7292160,
-    7292161,
-    7292162,
-    7292164,
-    7292165,
-    7292166,
-    7292168,
-    7292169,
-    7292170,
-    7292176,
-    7292177,
-    7292178,
-    7292184,
-    7292185,
-    7292186,
-    7292192,
-    7292193,
-    7292194,
-    7292196,
-    7292197,
-    7292198,
-    7292200,
-    7292201,
-    7292202,
-    7292223,
-    7292224,
-    7292225,
-    7292226,
-    7292228,
-    7292229,
-    7292230,
-    7292232,
-    7292233,
-    7292234,
-    7292240,
-    7292241,
-    7292242,
-    7292248,
-    7292249,
-    7292250,
-    7292256,
-    7292257,
-    7292258,
-    7292260,
-    7292261,
-    7292262,
-    7292264,
-    7292265,
-    7292266,
-    7292287,
-    7292288,
-    7292289,
-    7292290,
-    7292292,
-    7292293,
-    7292294,
-    7292296,
-    7292297,
-    7292298,
-    7292304,
-    7292305,
-    7292306,
-    7292312,
-    7292313,
-    7292314,
-    7292320,
-    7292321,
-    7292322,
-    7292324,
-    7292325,
-    7292326,
-    7292328,
-    7292329,
-    7292330,
-    7292351,
-    7292932,
-    7292933,
-    7292934,
-    7292936,
-    7292937,
-    7292938,
-    7292944,
-    7292945,
-    7292946,
-    7292948,
-    7292949,
-    7292950,
-    7292952,
-    7292953,
-    7292954,
-    7292960,
-    7292961,
-    7292962,
-    7292964,
-    7292965,
-    7292966,
-    7292968,
-    7292969,
-    7292970,
-    7292991,
-    7292996,
-    7292997,
-    7292998,
-    7293000,
-    7293001,
-    7293002,
-    7293008,
-    7293009,
-    7293010,
-    7293012,
-    7293013,
-    7293014,
-    7293016,
-    7293017,
-    7293018,
-    7293024,
-    7293025,
-    7293026,
-    7293028,
-    7293029,
-    7293030,
-    7293032,
-    7293033,
-    7293034,
-    7293055,
-    7293060,
-    7293061,
-    7293062,
-    7293064,
-    7293065,
-    7293066,
-    7293072,
-    7293073,
-    7293074,
-    7293076,
-    7293077,
-    7293078,
-    7293080,
-    7293081,
-    7293082,
-    7293088,
-    7293089,
-    7293090,
-    7293092,
-    7293093,
-    7293094,
-    7293096,
-    7293097,
-    7293098,
-    7293119,
-    7293184,
-    7293185,
-    7293186,
-    7293188,
-    7293189,
-    7293190,
-    7293192,
-    7293193,
-    7293194,
-    7293200,
-    7293201,
-    7293202,
-    7293208,
-    7293209,
-    7293210,
-    7293216,
-    7293217,
-    7293218,
-    7293220,
-    7293221,
-    7293222,
-    7293224,
-    7293225,
-    7293226,
-    7293247,
-    7293248,
-    7293249,
-    7293250,
-    7293252,
-    7293253,
-    7293254,
-    7293256,
-    7293257,
-    7293258,
-    7293264,
-    7293265,
-    7293266,
-    7293272,
-    7293273,
-    7293274,
-    7293280,
-    7293281,
-    7293282,
-    7293284,
-    7293285,
-    7293286,
-    7293288,
-    7293289,
-    7293290,
-    7293311,
-    7293312,
-    7293313,
-    7293314,
-    7293316,
-    7293317,
-    7293318,
-    7293320,
-    7293321,
-    7293322,
-    7293328,
-    7293329,
-    7293330,
-    7293336,
-    7293337,
-    7293338,
-    7293344,
-    7293345,
-    7293346,
-    7293348,
-    7293349,
-    7293350,
-    7293352,
-    7293353,
-    7293354,
-    7293375,
-    7294151,
-    7294155,
-    7294163,
-    7294167,
-    7294171,
-    7294179,
-    7294183,
-    7294187,
-    7294207,
-    7294403,
-    7294407,
-    7294411,
-    7294419,
-    7294427,
-    7294435,
-    7294439,
-    7294443,
-    7294463,
-    7294980,
-    7294981,
-    7294982,
-    7294984,
-    7294985,
-    7294986,
-    7294992,
-    7294993,
-    7294994,
-    7294996,
-    7294997,
-    7294998,
-    7295000,
-    7295001,
-    7295002,
-    7295008,
-    7295009,
-    7295010,
-    7295012,
-    7295013,
-    7295014,
-    7295016,
-    7295017,
-    7295018,
-    7295039,
-    7295044,
-    7295045,
-    7295046,
-    7295048,
-    7295049,
-    7295050,
-    7295056,
-    7295057,
-    7295058,
-    7295060,
-    7295061,
-    7295062,
-    7295064,
-    7295065,
-    7295066,
-    7295072,
-    7295073,
-    7295074,
-    7295076,
-    7295077,
-    7295078,
-    7295080,
-    7295081,
-    7295082,
-    7295103,
-    7295108,
-    7295109,
-    7295110,
-    7295112,
-    7295113,
-    7295114,
-    7295120,
-    7295121,
-    7295122,
-    7295124,
-    7295125,
-    7295126,
-    7295128,
-    7295129,
-    7295130,
-    7295136,
-    7295137,
-    7295138,
-    7295140,
-    7295141,
-    7295142,
-    7295144,
-    7295145,
-    7295146,
-    7295167,
-    7296004,
-    7296005,
-    7296006,
-    7296008,
-    7296009,
-    7296010,
-    7296016,
-    7296017,
-    7296018,
-    7296020,
-    7296021,
-    7296022,
-    7296024,
-    7296025,
-    7296026,
-    7296032,
-    7296033,
-    7296034,
-    7296036,
-    7296037,
-    7296038,
-    7296040,
-    7296041,
-    7296042,
-    7296063,
-    7296132,
-    7296133,
-    7296134,
-    7296136,
-    7296137,
-    7296138,
-    7296144,
-    7296145,
-    7296146,
-    7296148,
-    7296149,
-    7296150,
-    7296152,
-    7296153,
-    7296154,
-    7296160,
-    7296161,
-    7296162,
-    7296164,
-    7296165,
-    7296166,
-    7296168,
-    7296169,
-    7296170,
-    7296191,
-    7297028,
-    7297029,
-    7297030,
-    7297032,
-    7297033,
-    7297034,
-    7297040,
-    7297041,
-    7297042,
-    7297044,
-    7297045,
-    7297046,
-    7297048,
-    7297049,
-    7297050,
-    7297056,
-    7297057,
-    7297058,
-    7297060,
-    7297061,
-    7297062,
-    7297064,
-    7297065,
-    7297066,
-    7297087,
-    7297092,
-    7297093,
-    7297094,
-    7297096,
-    7297097,
-    7297098,
-    7297104,
-    7297105,
-    7297106,
-    7297108,
-    7297109,
-    7297110,
-    7297112,
-    7297113,
-    7297114,
-    7297120,
-    7297121,
-    7297122,
-    7297124,
-    7297125,
-    7297126,
-    7297128,
-    7297129,
-    7297130,
-    7297151,
-    7297156,
-    7297157,
-    7297158,
-    7297160,
-    7297161,
-    7297162,
-    7297168,
-    7297169,
-    7297170,
-    7297172,
-    7297173,
-    7297174,
-    7297176,
-    7297177,
-    7297178,
-    7297184,
-    7297185,
-    7297186,
-    7297188,
-    7297189,
-    7297190,
-    7297192,
-    7297193,
-    7297194,
-    7297215,
-    7298247,
-    7298251,
-    7298259,
-    7298263,
-    7298267,
-    7298275,
-    7298279,
-    7298283,
-    7298303,
-    7307332,
-    7307333,
-    7307334,
-    7307336,
-    7307337,
-    7307338,
-    7307344,
-    7307345,
-    7307346,
-    7307348,
-    7307349,
-    7307350,
-    7307352,
-    7307353,
-    7307354,
-    7307360,
-    7307361,
-    7307362,
-    7307364,
-    7307365,
-    7307366,
-    7307368,
-    7307369,
-    7307370,
-    7307391,
-    7307584,
-    7307585,
-    7307586,
-    7307588,
-    7307589,
-    7307590,
-    7307592,
-    7307593,
-    7307594,
-    7307600,
-    7307601,
-    7307602,
-    7307608,
-    7307609,
-    7307610,
-    7307616,
-    7307617,
-    7307618,
-    7307620,
-    7307621,
-    7307622,
-    7307624,
-    7307625,
-    7307626,
-    7307647,
-    7308292,
-    7308293,
-    7308294,
-    7308296,
-    7308297,
-    7308298,
-    7308304,
-    7308305,
-    7308306,
-    7308308,
-    7308309,
-    7308310,
-    7308312,
-    7308313,
-    7308314,
-    7308320,
-    7308321,
-    7308322,
-    7308324,
-    7308325,
-    7308326,
-    7308328,
-    7308329,
-    7308330,
-    7308351,
-    7308356,
-    7308357,
-    7308358,
-    7308360,
-    7308361,
-    7308362,
-    7308368,
-    7308369,
-    7308370,
-    7308372,
-    7308373,
-    7308374,
-    7308376,
-    7308377,
-    7308378,
-    7308384,
-    7308385,
-    7308386,
-    7308388,
-    7308389,
-    7308390,
-    7308392,
-    7308393,
-    7308394,
-    7308415,
-    7308420,
-    7308421,
-    7308422,
-    7308424,
-    7308425,
-    7308426,
-    7308432,
-    7308433,
-    7308434,
-    7308436,
-    7308437,
-    7308438,
-    7308440,
-    7308441,
-    7308442,
-    7308448,
-    7308449,
-    7308450,
-    7308452,
-    7308453,
-    7308454,
-    7308456,
-    7308457,
-    7308458,
-    7308479,
-    7308544,
-    7308545,
-    7308546,
-    7308548,
-    7308549,
-    7308550,
-    7308552,
-    7308553,
-    7308554,
-    7308560,
-    7308561,
-    7308562,
-    7308568,
-    7308569,
-    7308570,
-    7308576,
-    7308577,
-    7308578,
-    7308580,
-    7308581,
-    7308582,
-    7308584,
-    7308585,
-    7308586,
-    7308607,
-    7308608,
-    7308609,
-    7308610,
-    7308612,
-    7308613,
-    7308614,
-    7308616,
-    7308617,
-    7308618,
-    7308624,
-    7308625,
-    7308626,
-    7308632,
-    7308633,
-    7308634,
-    7308640,
-    7308641,
-    7308642,
-    7308644,
-    7308645,
-    7308646,
-    7308648,
-    7308649,
-    7308650,
-    7308671,
-    7308672,
-    7308673,
-    7308674,
-    7308676,
-    7308677,
-    7308678,
-    7308680,
-    7308681,
-    7308682,
-    7308688,
-    7308689,
-    7308690,
-    7308696,
-    7308697,
-    7308698,
-    7308704,
-    7308705,
-    7308706,
-    7308708,
-    7308709,
-    7308710,
-    7308712,
-    7308713,
-    7308714,
-    7308735,
-    7310535,
-    7310539,
-    7310547,
-    7310551,
-    7310555,
-    7310567,
-    7310571,
-    7310787,
-    7310791,
-    7310795,
-    7310803,
-    7310811,
-    7310819,
-    7310823,
-    7310827,
-    7310847,
-    7311364,
-    7311365,
-    7311366,
-    7311368,
-    7311369,
-    7311370,
-    7311376,
-    7311377,
-    7311378,
-    7311380,
-    7311381,
-    7311382,
-    7311384,
-    7311385,
-    7311386,
-    7311392,
-    7311393,
-    7311394,
-    7311396,
-    7311397,
-    7311398,
-    7311400,
-    7311401,
-    7311402,
-    7311423,
-    7311428,
-    7311429,
-    7311430,
-    7311432,
-    7311433,
-    7311434,
-    7311440,
-    7311441,
-    7311442,
-    7311444,
-    7311445,
-    7311446,
-    7311448,
-    7311449,
-    7311450,
-    7311456,
-    7311457,
-    7311458,
-    7311460,
-    7311461,
-    7311462,
-    7311464,
-    7311465,
-    7311466,
-    7311487,
-    7311492,
-    7311493,
-    7311494,
-    7311496,
-    7311497,
-    7311498,
-    7311504,
-    7311505,
-    7311506,
-    7311508,
-    7311509,
-    7311510,
-    7311512,
-    7311513,
-    7311514,
-    7311520,
-    7311521,
-    7311522,
-    7311524,
-    7311525,
-    7311526,
-    7311528,
-    7311529,
-    7311530,
-    7311551,
-    7311616,
-    7311617,
-    7311618,
-    7311620,
-    7311621,
-    7311622,
-    7311624,
-    7311625,
-    7311626,
-    7311632,
-    7311633,
-    7311634,
-    7311640,
-    7311641,
-    7311642,
-    7311648,
-    7311649,
-    7311650,
-    7311652,
-    7311653,
-    7311654,
-    7311656,
-    7311657,
-    7311658,
-    7311679,
-    7311680,
-    7311681,
-    7311682,
-    7311688,
-    7311689,
-    7311690,
-    7311696,
-    7311697,
-    7311698,
-    7311704,
-    7311705,
-    7311706,
-    7311712,
-    7311713,
-    7311714,
-    7311720,
-    7311721,
-    7311722,
-    7311744,
-    7311745,
-    7311746,
-    7311748,
-    7311749,
-    7311750,
-    7311752,
-    7311753,
-    7311754,
-    7311760,
-    7311761,
-    7311762,
-    7311768,
-    7311769,
-    7311770,
-    7311776,
-    7311777,
-    7311778,
-    7311780,
-    7311781,
-    7311782,
-    7311784,
-    7311785,
-    7311786,
-    7311807,
-    7312388,
-    7312389,
-    7312390,
-    7312392,
-    7312393,
-    7312394,
-    7312400,
-    7312401,
-    7312402,
-    7312404,
-    7312405,
-    7312406,
-    7312408,
-    7312409,
-    7312410,
-    7312416,
-    7312417,
-    7312418,
-    7312420,
-    7312421,
-    7312422,
-    7312424,
-    7312425,
-    7312426,
-    7312447,
-    7312640,
-    7312641,
-    7312642,
-    7312644,
-    7312645,
-    7312646,
-    7312648,
-    7312649,
-    7312650,
-    7312656,
-    7312657,
-    7312658,
-    7312664,
-    7312665,
-    7312666,
-    7312672,
-    7312673,
-    7312674,
-    7312676,
-    7312677,
-    7312678,
-    7312680,
-    7312681,
-    7312682,
-    7312703,
-    7314631,
-    7314635,
-    7314643,
-    7314647,
-    7314651,
-    7314659,
-    7314663,
-    7314667,
-    7314687,
-    7314883,
-    7314891,
-    7314899,
-    7314907,
-    7314915,
-    7314923,
-    8192320,
-    8192321,
-    8192322,
-    8192324,
-    8192326,
-    8192337,
-    8192338,
-    8192384,
-    8192385,
-    8192386,
-    8192388,
-    8192389,
-    8192390,
-    8192400,
-    8192401,
-    8192402,
-    8192417,
-    8192420,
-    8193281,
-    8193282,
-    8193284,
-    8193285,
-    8193286,
-    8193297,
-    8193298,
-    8193313,
-    8193316,
-    8193317,
-    8193345,
-    8193346,
-    8193348,
-    8193350,
-    8193360,
-    8193361,
-    8193362,
-    8193376,
-    8193377,
-    8193380,
-    8193409,
-    8193410,
-    8193412,
-    8193413,
-    8193414,
-    8193424,
-    8193425,
-    8193426,
-    8193441,
-    8193444,
-    8193537,
-    8193540,
-    8193541,
-    8193542,
-    8193553,
-    8193554,
-    8193556,
-    8193557,
-    8193569,
-    8193572,
-    8193573,
-    8193601,
-    8193604,
-    8193606,
-    8193617,
-    8193618,
-    8193620,
-    8193632,
-    8193633,
-    8193636,
-    8193665,
-    8193668,
-    8193669,
-    8193670,
-    8193680,
-    8193681,
-    8193682,
-    8193684,
-    8193697,
-    8193700,
-    8194306,
-    8194308,
-    8194309,
-    8194310,
-    8194321,
-    8194322,
-    8194337,
-    8194340,
-    8194341,
-    8194370,
-    8194372,
-    8194374,
-    8194385,
-    8194386,
-    8194400,
-    8194401,
-    8194404,
-    8194434,
-    8194436,
-    8194437,
-    8194438,
-    8194449,
-    8194450,
-    8194465,
-    8194468,
-    8195523,
-    8195527,
-    8195539,
-    8195555,
-    8195559,
-    8195779,
-    8195783,
-    8195795,
-    8195799,
-    8195811,
-    8195815,
-    8196100,
-    8196101,
-    8196102,
-    8196113,
-    8196114,
-    8196117,
-    8196118,
-    8196164,
-    8196166,
-    8196177,
-    8196178,
-    8196180,
-    8196182,
-    8196193,
-    8196196,
-    8196228,
-    8196229,
-    8196230,
-    8196241,
-    8196242,
-    8196244,
-    8196245,
-    8196246,
-    8196257,
-    8196260,
-    8196433,
-    8196434,
-    8196484,
-    8196485,
-    8196486,
-    8196497,
-    8196498,
-    8196513,
-    8196516,
-    8196740,
-    8196741,
-    8196742,
-    8196753,
-    8196754,
-    8197125,
-    8197126,
-    8197137,
-    8197138,
-    8197140,
-    8197141,
-    8197142,
-    8197153,
-    8197156,
-    8197157,
-    8197253,
-    8197254,
-    8197265,
-    8197266,
-    8197268,
-    8197269,
-    8197270,
-    8197281,
-    8197284,
-    8197381,
-    8197382,
-    8197393,
-    8197394,
-    8197409,
-    8197412,
-    8197413,
-    8197509,
-    8197510,
-    8197521,
-    8197522,
-    8197537,
-    8197540,
-    8197637,
-    8197638,
-    8197649,
-    8197650,
-    8197653,
-    8197665,
-    8197668,
-    8197669,
-    8197765,
-    8197766,
-    8197777,
-    8197778,
-    8197780,
-    8197793,
-    8197796,
-    8198150,
-    8198161,
-    8198162,
-    8198165,
-    8198166,
-    8198177,
-    8198180,
-    8198181,
-    8198214,
-    8198225,
-    8198226,
-    8198230,
-    8198241,
-    8198244,
-    8198278,
-    8198289,
-    8198290,
-    8198293,
-    8198294,
-    8198305,
-    8198308,
-    8198406,
-    8198417,
-    8198418,
-    8198433,
-    8198437,
-    8198481,
-    8198482,
-    8198497,
-    8198534,
-    8198545,
-    8198546,
-    8198561,
-    8198564,
-    8198662,
-    8198673,
-    8198674,
-    8198677,
-    8198689,
-    8198693,
-    8198726,
-    8198737,
-    8198738,
-    8198753,
-    8198790,
-    8198801,
-    8198802,
-    8198817,
-    8198820,
-    8199367,
-    8199379,
-    8199383,
-    8199395,
-    8199399,
-    8199635,
-    8199651,
-    8199879,
-    8199891,
-    8199895,
-    8199907,
-    8199911,
-    8209425,
-    8209426,
-    8209429,
-    8209430,
-    8209489,
-    8209490,
-    8209494,
-    8209505,
-    8209553,
-    8209554,
-    8209557,
-    8209558,
-    8209569,
-    8209745,
-    8209746,
-    8209809,
-    8209810,
-    8209825,
-    8210065,
-    8210066,
-    8210450,
-    8210453,
-    8210454,
-    8210465,
-    8210469,
-    8210514,
-    8210518,
-    8210529,
-    8210578,
-    8210581,
-    8210582,
-    8210593,
-    8210706,
-    8210725,
-    8210770,
-    8210785,
-    8210834,
-    8210849,
-    8210962,
-    8210965,
-    8210981,
-    8211026,
-    8211090,
-    8211105,
-    8211667,
-    8211671,
-    8211683,
-    8211687,
-    8211923,
-    8211939,
-    8211943,
-    8212179,
-    8212183,
-    8212195,
-    8212199,
-    8213525,
-    8213526,
-    8213653,
-    8213654,
-    8214550,
-    8214565,
-    8214614,
-    8214678,
-    8215767,
-    8215779,
-    8215783,
-    8216279,
-    8216291,
-    8216295,
-    8228071,
-    8228323,
-    8228327,
-    8228579,
-    8228583,
-    8232167,
-    8232679,
-    8257856,
-    8257857,
-    8257858,
-    8257860,
-    8257862,
-    8257873,
-    8257874,
-    8257890,
-    8257894,
-    8257920,
-    8257921,
-    8257922,
-    8257924,
-    8257925,
-    8257926,
-    8257936,
-    8257937,
-    8257938,
-    8257952,
-    8257953,
-    8257954,
-    8257956,
-    8257957,
-    8257958,
-    8258817,
-    8258818,
-    8258820,
-    8258821,
-    8258822,
-    8258833,
-    8258834,
-    8258849,
-    8258850,
-    8258852,
-    8258853,
-    8258854,
-    8258880,
-    8258881,
-    8258882,
-    8258884,
-    8258886,
-    8258896,
-    8258897,
-    8258898,
-    8258912,
-    8258913,
-    8258914,
-    8258916,
-    8258918,
-    8258944,
-    8258945,
-    8258946,
-    8258948,
-    8258949,
-    8258950,
-    8258960,
-    8258961,
-    8258962,
-    8258976,
-    8258977,
-    8258978,
-    8258980,
-    8258981,
-    8258982,
-    8259073,
-    8259074,
-    8259076,
-    8259077,
-    8259078,
-    8259089,
-    8259090,
-    8259092,
-    8259093,
-    8259094,
-    8259105,
-    8259106,
-    8259108,
-    8259109,
-    8259110,
-    8259136,
-    8259137,
-    8259138,
-    8259140,
-    8259142,
-    8259152,
-    8259153,
-    8259154,
-    8259156,
-    8259158,
-    8259168,
-    8259169,
-    8259170,
-    8259172,
-    8259174,
-    8259200,
-    8259201,
-    8259202,
-    8259204,
-    8259205,
-    8259206,
-    8259216,
-    8259217,
-    8259218,
-    8259220,
-    8259221,
-    8259222,
-    8259232,
-    8259233,
-    8259234,
-    8259236,
-    8259237,
-    8259238,
-    8259841,
-    8259842,
-    8259844,
-    8259845,
-    8259846,
-    8259857,
-    8259858,
-    8259873,
-    8259874,
-    8259876,
-    8259877,
-    8259878,
-    8259904,
-    8259905,
-    8259906,
-    8259908,
-    8259910,
-    8259920,
-    8259921,
-    8259922,
-    8259936,
-    8259937,
-    8259938,
-    8259940,
-    8259942,
-    8259968,
-    8259969,
-    8259970,
-    8259972,
-    8259973,
-    8259974,
-    8259984,
-    8259985,
-    8259986,
-    8260000,
-    8260001,
-    8260002,
-    8260004,
-    8260005,
-    8260006,
-    8261059,
-    8261063,
-    8261075,
-    8261091,
-    8261095,
-    8261315,
-    8261319,
-    8261331,
-    8261335,
-    8261347,
-    8261351,
-    8261636,
-    8261637,
-    8261638,
-    8261649,
-    8261650,
-    8261653,
-    8261654,
-    8261666,
-    8261670,
-    8261700,
-    8261702,
-    8261712,
-    8261713,
-    8261714,
-    8261716,
-    8261718,
-    8261728,
-    8261729,
-    8261730,
-    8261732,
-    8261734,
-    8261764,
-    8261765,
-    8261766,
-    8261776,
-    8261777,
-    8261778,
-    8261780,
-    8261781,
-    8261782,
-    8261792,
-    8261793,
-    8261794,
-    8261796,
-    8261797,
-    8261798,
-    8261952,
-    8261953,
-    8261954,
-    8261969,
-    8261970,
-    8261986,
-    8262016,
-    8262017,
-    8262018,
-    8262020,
-    8262021,
-    8262022,
-    8262032,
-    8262033,
-    8262034,
-    8262048,
-    8262049,
-    8262050,
-    8262052,
-    8262053,
-    8262054,
-    8262272,
-    8262273,
-    8262274,
-    8262276,
-    8262277,
-    8262278,
-    8262289,
-    8262290,
-    8262293,
-    8262294,
-    8262306,
-    8262310,
-    8262660,
-    8262661,
-    8262662,
-    8262673,
-    8262674,
-    8262676,
-    8262677,
-    8262678,
-    8262689,
-    8262690,
-    8262692,
-    8262693,
-    8262694,
-    8262788,
-    8262789,
-    8262790,
-    8262800,
-    8262801,
-    8262802,
-    8262804,
-    8262805,
-    8262806,
-    8262816,
-    8262817,
-    8262818,
-    8262820,
-    8262821,
-    8262822,
-    8262913,
-    8262914,
-    8262916,
-    8262917,
-    8262918,
-    8262929,
-    8262930,
-    8262945,
-    8262946,
-    8262948,
-    8262949,
-    8262950,
-    8263040,
-    8263041,
-    8263042,
-    8263044,
-    8263045,
-    8263046,
-    8263056,
-    8263057,
-    8263058,
-    8263072,
-    8263073,
-    8263074,
-    8263076,
-    8263077,
-    8263078,
-    8263169,
-    8263170,
-    8263172,
-    8263173,
-    8263174,
-    8263185,
-    8263186,
-    8263188,
-    8263189,
-    8263190,
-    8263201,
-    8263202,
-    8263204,
-    8263205,
-    8263206,
-    8263296,
-    8263297,
-    8263298,
-    8263300,
-    8263301,
-    8263302,
-    8263312,
-    8263313,
-    8263314,
-    8263316,
-    8263317,
-    8263318,
-    8263328,
-    8263329,
-    8263330,
-    8263332,
-    8263333,
-    8263334,
-    8263684,
-    8263685,
-    8263686,
-    8263697,
-    8263698,
-    8263700,
-    8263701,
-    8263702,
-    8263713,
-    8263714,
-    8263716,
-    8263717,
-    8263718,
-    8263748,
-    8263750,
-    8263760,
-    8263761,
-    8263762,
-    8263764,
-    8263766,
-    8263776,
-    8263777,
-    8263778,
-    8263780,
-    8263782,
-    8263812,
-    8263813,
-    8263814,
-    8263824,
-    8263825,
-    8263826,
-    8263828,
-    8263829,
-    8263830,
-    8263840,
-    8263841,
-    8263842,
-    8263844,
-    8263845,
-    8263846,
-    8263937,
-    8263938,
-    8263940,
-    8263941,
-    8263942,
-    8263953,
-    8263954,
-    8263969,
-    8263970,
-    8263972,
-    8263973,
-    8263974,
-    8264000,
-    8264001,
-    8264002,
-    8264016,
-    8264017,
-    8264018,
-    8264032,
-    8264033,
-    8264034,
-    8264064,
-    8264065,
-    8264066,
-    8264068,
-    8264069,
-    8264070,
-    8264080,
-    8264081,
-    8264082,
-    8264096,
-    8264097,
-    8264098,
-    8264100,
-    8264101,
-    8264102,
-    8264193,
-    8264194,
-    8264196,
-    8264197,
-    8264198,
-    8264209,
-    8264210,
-    8264212,
-    8264213,
-    8264214,
-    8264225,
-    8264226,
-    8264228,
-    8264229,
-    8264230,
-    8264256,
-    8264257,
-    8264258,
-    8264260,
-    8264262,
-    8264272,
-    8264273,
-    8264274,
-    8264276,
-    8264278,
-    8264288,
-    8264289,
-    8264290,
-    8264292,
-    8264294,
-    8264320,
-    8264321,
-    8264322,
-    8264324,
-    8264325,
-    8264326,
-    8264336,
-    8264337,
-    8264338,
-    8264340,
-    8264341,
-    8264342,
-    8264352,
-    8264353,
-    8264354,
-    8264356,
-    8264357,
-    8264358,
-    8264903,
-    8264915,
-    8264919,
-    8264931,
-    8264935,
-    8265155,
-    8265171,
-    8265187,
-    8265411,
-    8265415,
-    8265427,
-    8265431,
-    8265443,
-    8265447,
-    8274948,
-    8274949,
-    8274950,
-    8274961,
-    8274962,
-    8274965,
-    8274966,
-    8274978,
-    8274982,
-    8275012,
-    8275014,
-    8275024,
-    8275025,
-    8275026,
-    8275028,
-    8275030,
-    8275040,
-    8275041,
-    8275042,
-    8275044,
-    8275046,
-    8275076,
-    8275077,
-    8275078,
-    8275088,
-    8275089,
-    8275090,
-    8275092,
-    8275093,
-    8275094,
-    8275104,
-    8275105,
-    8275106,
-    8275108,
-    8275109,
-    8275110,
-    8275264,
-    8275265,
-    8275266,
-    8275268,
-    8275270,
-    8275281,
-    8275282,
-    8275298,
-    8275302,
-    8275328,
-    8275329,
-    8275330,
-    8275332,
-    8275333,
-    8275334,
-    8275344,
-    8275345,
-    8275346,
-    8275360,
-    8275361,
-    8275362,
-    8275364,
-    8275365,
-    8275366,
-    8275584,
-    8275585,
-    8275586,
-    8275588,
-    8275589,
-    8275590,
-    8275601,
-    8275602,
-    8275605,
-    8275606,
-    8275618,
-    8275622,
-    8275972,
-    8275973,
-    8275974,
-    8275985,
-    8275986,
-    8275988,
-    8275989,
-    8275990,
-    8276001,
-    8276002,
-    8276004,
-    8276005,
-    8276006,
-    8276036,
-    8276038,
-    8276048,
-    8276049,
-    8276050,
-    8276052,
-    8276054,
-    8276064,
-    8276065,
-    8276066,
-    8276068,
-    8276070,
-    8276100,
-    8276101,
-    8276102,
-    8276112,
-    8276113,
-    8276114,
-    8276116,
-    8276117,
-    8276118,
-    8276128,
-    8276129,
-    8276130,
-    8276132,
-    8276133,
-    8276134,
-    8276225,
-    8276226,
-    8276228,
-    8276229,
-    8276230,
-    8276241,
-    8276242,
-    8276257,
-    8276258,
-    8276260,
-    8276261,
-    8276262,
-    8276288,
-    8276289,
-    8276290,
-    8276292,
-    8276294,
-    8276304,
-    8276305,
-    8276306,
-    8276320,
-    8276321,
-    8276322,
-    8276324,
-    8276326,
-    8276352,
-    8276353,
-    8276354,
-    8276356,
-    8276357,
-    8276358,
-    8276368,
-    8276369,
-    8276370,
-    8276384,
-    8276385,
-    8276386,
-    8276388,
-    8276389,
-    8276390,
-    8276481,
-    8276482,
-    8276484,
-    8276485,
-    8276486,
-    8276497,
-    8276498,
-    8276500,
-    8276501,
-    8276502,
-    8276513,
-    8276514,
-    8276516,
-    8276517,
-    8276518,
-    8276544,
-    8276545,
-    8276546,
-    8276548,
-    8276550,
-    8276560,
-    8276561,
-    8276562,
-    8276564,
-    8276566,
-    8276576,
-    8276577,
-    8276578,
-    8276580,
-    8276582,
-    8276608,
-    8276609,
-    8276610,
-    8276612,
-    8276613,
-    8276614,
-    8276624,
-    8276625,
-    8276626,
-    8276628,
-    8276629,
-    8276630,
-    8276640,
-    8276641,
-    8276642,
-    8276644,
-    8276645,
-    8276646,
-    8277191,
-    8277203,
-    8277207,
-    8277219,
-    8277223,
-    8277443,
-    8277447,
-    8277459,
-    8277475,
-    8277479,
-    8277699,
-    8277703,
-    8277715,
-    8277719,
-    8277731,
-    8277735,
-    8279044,
-    8279045,
-    8279046,
-    8279057,
-    8279058,
-    8279061,
-    8279062,
-    8279074,
-    8279078,
-    8279172,
-    8279173,
-    8279174,
-    8279184,
-    8279185,
-    8279186,
-    8279188,
-    8279189,
-    8279190,
-    8279200,
-    8279201,
-    8279202,
-    8279204,
-    8279205,
-    8279206,
-    8280068,
-    8280069,
-    8280070,
-    8280081,
-    8280082,
-    8280084,
-    8280085,
-    8280086,
-    8280097,
-    8280098,
-    8280100,
-    8280101,
-    8280102,
-    8280132,
-    8280134,
-    8280144,
-    8280145,
-    8280146,
-    8280148,
-    8280150,
-    8280160,
-    8280161,
-    8280162,
-    8280164,
-    8280166,
-    8280196,
-    8280197,
-    8280198,
-    8280208,
-    8280209,
-    8280210,
-    8280212,
-    8280213,
-    8280214,
-    8280224,
-    8280225,
-    8280226,
-    8280228,
-    8280229,
-    8280230,
-    8281287,
-    8281299,
-    8281303,
-    8281315,
-    8281319,
-    8281795,
-    8281799,
-    8281811,
-    8281815,
-    8281827,
-    8281831,
-    8293575,
-    8293587,
-    8293591,
-    8293607,
-    8293827,
-    8293831,
-    8293843,
-    8293859,
-    8293863,
-    8294083,
-    8294087,
-    8294099,
-    8294103,
-    8294115,
-    8294119,
-    8297671,
-    8297683,
-    8297687,
-    8297699,
-    8297703,
-    8297923,
-    8297939,
-    8297955,
-    8298179,
-    8298183,
-    8298195,
-    8298199,
-    8298211,
-    8298215,
-    8323392,
-    8323393,
-    8323394,
-    8323396,
-    8323397,
-    8323398,
-    8323400,
-    8323401,
-    8323402,
-    8323409,
-    8323410,
-    8323413,
-    8323414,
-    8323417,
-    8323418,
-    8323426,
-    8323430,
-    8323434,
-    8323455,
-    8323456,
-    8323457,
-    8323458,
-    8323460,
-    8323461,
-    8323462,
-    8323464,
-    8323465,
-    8323466,
-    8323472,
-    8323473,
-    8323474,
-    8323476,
-    8323477,
-    8323478,
-    8323480,
-    8323481,
-    8323482,
-    8323488,
-    8323489,
-    8323490,
-    8323492,
-    8323493,
-    8323494,
-    8323496,
-    8323497,
-    8323498,
-    8323519,
-    8324352,
-    8324353,
-    8324354,
-    8324356,
-    8324357,
-    8324358,
-    8324360,
-    8324361,
-    8324362,
-    8324368,
-    8324369,
-    8324370,
-    8324372,
-    8324373,
-    8324374,
-    8324376,
-    8324377,
-    8324378,
-    8324384,
-    8324385,
-    8324386,
-    8324388,
-    8324389,
-    8324390,
-    8324392,
-    8324393,
-    8324394,
-    8324415,
-    8324416,
-    8324417,
-    8324418,
-    8324420,
-    8324421,
-    8324422,
-    8324424,
-    8324425,
-    8324426,
-    8324432,
-    8324433,
-    8324434,
-    8324436,
-    8324437,
-    8324438,
-    8324440,
-    8324441,
-    8324442,
-    8324448,
-    8324449,
-    8324450,
-    8324452,
-    8324453,
-    8324454,
-    8324456,
-    8324457,
-    8324458,
-    8324479,
-    8324480,
-    8324481,
-    8324482,
-    8324484,
-    8324485,
-    8324486,
-    8324488,
-    8324489,
-    8324490,
-    8324496,
-    8324497,
-    8324498,
-    8324500,
-    8324501,
-    8324502,
-    8324504,
-    8324505,
-    8324506,
-    8324512,
-    8324513,
-    8324514,
-    8324516,
-    8324517,
-    8324518,
-    8324520,
-    8324521,
-    8324522,
-    8324543,
-    8324608,
-    8324609,
-    8324610,
-    8324612,
-    8324613,
-    8324614,
-    8324616,
-    8324617,
-    8324618,
-    8324624,
-    8324625,
-    8324626,
-    8324628,
-    8324629,
-    8324630,
-    8324632,
-    8324633,
-    8324634,
-    8324640,
-    8324641,
-    8324642,
-    8324644,
-    8324645,
-    8324646,
-    8324648,
-    8324649,
-    8324650,
-    8324671,
-    8324672,
-    8324673,
-    8324674,
-    8324676,
-    8324677,
-    8324678,
-    8324680,
-    8324681,
-    8324682,
-    8324688,
-    8324689,
-    8324690,
-    8324692,
-    8324693,
-    8324694,
-    8324696,
-    8324697,
-    8324698,
-    8324704,
-    8324705,
-    8324706,
-    8324708,
-    8324709,
-    8324710,
-    8324712,
-    8324713,
-    8324714,
-    8324735,
-    8324736,
-    8324737,
-    8324738,
-    8324740,
-    8324741,
-    8324742,
-    8324744,
-    8324745,
-    8324746,
-    8324752,
-    8324753,
-    8324754,
-    8324756,
-    8324757,
-    8324758,
-    8324760,
-    8324761,
-    8324762,
-    8324768,
-    8324769,
-    8324770,
-    8324772,
-    8324773,
-    8324774,
-    8324776,
-    8324777,
-    8324778,
-    8324799,
-    8325376,
-    8325377,
-    8325378,
-    8325380,
-    8325381,
-    8325382,
-    8325384,
-    8325385,
-    8325386,
-    8325392,
-    8325393,
-    8325394,
-    8325396,
-    8325397,
-    8325398,
-    8325400,
-    8325401,
-    8325402,
-    8325408,
-    8325409,
-    8325410,
-    8325412,
-    8325413,
-    8325414,
-    8325416,
-    8325417,
-    8325418,
-    8325439,
-    8325440,
-    8325441,
-    8325442,
-    8325444,
-    8325445,
-    8325446,
-    8325448,
-    8325449,
-    8325450,
-    8325456,
-    8325457,
-    8325458,
-    8325460,
-    8325461,
-    8325462,
-    8325464,
-    8325465,
-    8325466,
-    8325472,
-    8325473,
-    8325474,
-    8325476,
-    8325477,
-    8325478,
-    8325480,
-    8325481,
-    8325482,
-    8325503,
-    8325504,
-    8325505,
-    8325506,
-    8325508,
-    8325509,
-    8325510,
-    8325512,
-    8325513,
-    8325514,
-    8325520,
-    8325521,
-    8325522,
-    8325524,
-    8325525,
-    8325526,
-    8325528,
-    8325529,
-    8325530,
-    8325536,
-    8325537,
-    8325538,
-    8325540,
-    8325541,
-    8325542,
-    8325544,
-    8325545,
-    8325546,
-    8325567,
-    8326595,
-    8326599,
-    8326603,
-    8326611,
-    8326615,
-    8326619,
-    8326627,
-    8326631,
-    8326635,
-    8326655,
-    8326851,
-    8326855,
-    8326859,
-    8326867,
-    8326871,
-    8326875,
-    8326883,
-    8326887,
-    8326891,
-    8326911,
-    8327168,
-    8327169,
-    8327170,
-    8327172,
-    8327173,
-    8327174,
-    8327176,
-    8327177,
-    8327178,
-    8327185,
-    8327186,
-    8327189,
-    8327190,
-    8327193,
-    8327194,
-    8327202,
-    8327206,
-    8327210,
-    8327231,
-    8327232,
-    8327233,
-    8327234,
-    8327236,
-    8327237,
-    8327238,
-    8327240,
-    8327241,
-    8327242,
-    8327248,
-    8327249,
-    8327250,
-    8327252,
-    8327253,
-    8327254,
-    8327256,
-    8327257,
-    8327258,
-    8327264,
-    8327265,
-    8327266,
-    8327268,
-    8327269,
-    8327270,
-    8327272,
-    8327273,
-    8327274,
-    8327295,
-    8327296,
-    8327297,
-    8327298,
-    8327300,
-    8327301,
-    8327302,
-    8327304,
-    8327305,
-    8327306,
-    8327312,
-    8327313,
-    8327314,
-    8327316,
-    8327317,
-    8327318,
-    8327320,
-    8327321,
-    8327322,
-    8327328,
-    8327329,
-    8327330,
-    8327332,
-    8327333,
-    8327334,
-    8327336,
-    8327337,
-    8327338,
-    8327359,
-    8327488,
-    8327489,
-    8327490,
-    8327496,
-    8327497,
-    8327498,
-    8327505,
-    8327506,
-    8327513,
-    8327514,
-    8327522,
-    8327530,
-    8327552,
-    8327553,
-    8327554,
-    8327556,
-    8327557,
-    8327558,
-    8327560,
-    8327561,
-    8327562,
-    8327568,
-    8327569,
-    8327570,
-    8327572,
-    8327573,
-    8327574,
-    8327576,
-    8327577,
-    8327578,
-    8327584,
-    8327585,
-    8327586,
-    8327588,
-    8327589,
-    8327590,
-    8327592,
-    8327593,
-    8327594,
-    8327615,
-    8327808,
-    8327809,
-    8327810,
-    8327812,
-    8327813,
-    8327814,
-    8327816,
-    8327817,
-    8327818,
-    8327825,
-    8327826,
-    8327829,
-    8327830,
-    8327833,
-    8327834,
-    8327842,
-    8327846,
-    8327850,
-    8327871,
-    8328192,
-    8328193,
-    8328194,
-    8328196,
-    8328197,
-    8328198,
-    8328200,
-    8328201,
-    8328202,
-    8328208,
-    8328209,
-    8328210,
-    8328212,
-    8328213,
-    8328214,
-    8328216,
-    8328217,
-    8328218,
-    8328224,
-    8328225,
-    8328226,
-    8328228,
-    8328229,
-    8328230,
-    8328232,
-    8328233,
-    8328234,
-    8328255,
-    8328320,
-    8328321,
-    8328322,
-    8328324,
-    8328325,
-    8328326,
-    8328328,
-    8328329,
-    8328330,
-    8328336,
-    8328337,
-    8328338,
-    8328340,
-    8328341,
-    8328342,
-    8328344,
-    8328345,
-    8328346,
-    8328352,
-    8328353,
-    8328354,
-    8328356,
-    8328357,
-    8328358,
-    8328360,
-    8328361,
-    8328362,
-    8328383,
-    8328448,
-    8328449,
-    8328450,
-    8328452,
-    8328453,
-    8328454,
-    8328456,
-    8328457,
-    8328458,
-    8328464,
-    8328465,
-    8328466,
-    8328468,
-    8328469,
-    8328470,
-    8328472,
-    8328473,
-    8328474,
-    8328480,
-    8328481,
-    8328482,
-    8328484,
-    8328485,
-    8328486,
-    8328488,
-    8328489,
-    8328490,
-    8328511,
-    8328576,
-    8328577,
-    8328578,
-    8328580,
-    8328581,
-    8328582,
-    8328584,
-    8328585,
-    8328586,
-    8328592,
-    8328593,
-    8328594,
-    8328596,
-    8328597,
-    8328598,
-    8328600,
-    8328601,
-    8328602,
-    8328608,
-    8328609,
-    8328610,
-    8328612,
-    8328613,
-    8328614,
-    8328616,
-    8328617,
-    8328618,
-    8328639,
-    8328704,
-    8328705,
-    8328706,
-    8328708,
-    8328709,
-    8328710,
-    8328712,
-    8328713,
-    8328714,
-    8328720,
-    8328721,
-    8328722,
-    8328724,
-    8328725,
-    8328726,
-    8328728,
-    8328729,
-    8328730,
-    8328736,
-    8328737,
-    8328738,
-    8328740,
-    8328741,
-    8328742,
-    8328744,
-    8328745,
-    8328746,
-    8328767,
-    8328832,
-    8328833,
-    8328834,
-    8328836,
-    8328837,
-    8328838,
-    8328840,
-    8328841,
-    8328842,
-    8328848,
-    8328849,
-    8328850,
-    8328852,
-    8328853,
-    8328854,
-    8328856,
-    8328857,
-    8328858,
-    8328864,
-    8328865,
-    8328866,
-    8328868,
-    8328869,
-    8328870,
-    8328872,
-    8328873,
-    8328874,
-    8328895,
-    8329216,
-    8329217,
-    8329218,
-    8329220,
-    8329221,
-    8329222,
-    8329224,
-    8329225,
-    8329226,
-    8329232,
-    8329233,
-    8329234,
-    8329236,
-    8329237,
-    8329238,
-    8329240,
-    8329241,
-    8329242,
-    8329248,
-    8329249,
-    8329250,
-    8329252,
-    8329253,
-    8329254,
-    8329256,
-    8329257,
-    8329258,
-    8329279,
-    8329280,
-    8329281,
-    8329282,
-    8329284,
-    8329285,
-    8329286,
-    8329288,
-    8329289,
-    8329290,
-    8329296,
-    8329297,
-    8329298,
-    8329300,
-    8329301,
-    8329302,
-    8329304,
-    8329305,
-    8329306,
-    8329312,
-    8329313,
-    8329314,
-    8329316,
-    8329317,
-    8329318,
-    8329320,
-    8329321,
-    8329322,
-    8329343,
-    8329344,
-    8329345,
-    8329346,
-    8329348,
-    8329349,
-    8329350,
-    8329352,
-    8329353,
-    8329354,
-    8329360,
-    8329361,
-    8329362,
-    8329364,
-    8329365,
-    8329366,
-    8329368,
-    8329369,
-    8329370,
-    8329376,
-    8329377,
-    8329378,
-    8329380,
-    8329381,
-    8329382,
-    8329384,
-    8329385,
-    8329386,
-    8329407,
-    8329472,
-    8329473,
-    8329474,
-    8329476,
-    8329477,
-    8329478,
-    8329480,
-    8329481,
-    8329482,
-    8329488,
-    8329489,
-    8329490,
-    8329492,
-    8329493,
-    8329494,
-    8329496,
-    8329497,
-    8329498,
-    8329504,
-    8329505,
-    8329506,
-    8329508,
-    8329509,
-    8329510,
-    8329512,
-    8329513,
-    8329514,
-    8329535,
-    8329536,
-    8329537,
-    8329538,
-    8329544,
-    8329545,
-    8329546,
-    8329552,
-    8329553,
-    8329554,
-    8329560,
-    8329561,
-    8329562,
-    8329568,
-    8329569,
-    8329570,
-    8329576,
-    8329577,
-    8329578,
-    8329600,
-    8329601,
-    8329602,
-    8329604,
-    8329605,
-    8329606,
-    8329608,
-    8329609,
-    8329610,
-    8329616,
-    8329617,
-    8329618,
-    8329620,
-    8329621,
-    8329622,
-    8329624,
-    8329625,
-    8329626,
-    8329632,
-    8329633,
-    8329634,
-    8329636,
-    8329637,
-    8329638,
-    8329640,
-    8329641,
-    8329642,
-    8329663,
-    8329728,
-    8329729,
-    8329730,
-    8329732,
-    8329733,
-    8329734,
-    8329736,
-    8329737,
-    8329738,
-    8329744,
-    8329745,
-    8329746,
-    8329748,
-    8329749,
-    8329750,
-    8329752,
-    8329753,
-    8329754,
-    8329760,
-    8329761,
-    8329762,
-    8329764,
-    8329765,
-    8329766,
-    8329768,
-    8329769,
-    8329770,
-    8329791,
-    8329792,
-    8329793,
-    8329794,
-    8329796,
-    8329797,
-    8329798,
-    8329800,
-    8329801,
-    8329802,
-    8329808,
-    8329809,
-    8329810,
-    8329812,
-    8329813,
-    8329814,
-    8329816,
-    8329817,
-    8329818,
-    8329824,
-    8329825,
-    8329826,
-    8329828,
-    8329829,
-    8329830,
-    8329832,
-    8329833,
-    8329834,
-    8329855,
-    8329856,
-    8329857,
-    8329858,
-    8329860,
-    8329861,
-    8329862,
-    8329864,
-    8329865,
-    8329866,
-    8329872,
-    8329873,
-    8329874,
-    8329876,
-    8329877,
-    8329878,
-    8329880,
-    8329881,
-    8329882,
-    8329888,
-    8329889,
-    8329890,
-    8329892,
-    8329893,
-    8329894,
-    8329896,
-    8329897,
-    8329898,
-    8329919,
-    8330435,
-    8330439,
-    8330443,
-    8330451,
-    8330455,
-    8330459,
-    8330467,
-    8330471,
-    8330475,
-    8330495,
-    8330691,
-    8330699,
-    8330707,
-    8330715,
-    8330723,
-    8330731,
-    8330947,
-    8330951,
-    8330955,
-    8330963,
-    8330967,
-    8330971,
-    8330979,
-    8330983,
-    8330987,
-    8331007,
-    8340480,
-    8340481,
-    8340482,
-    8340484,
-    8340485,
-    8340486,
-    8340488,
-    8340489,
-    8340490,
-    8340497,
-    8340498,
-    8340501,
-    8340502,
-    8340505,
-    8340506,
-    8340514,
-    8340518,
-    8340522,
-    8340543,
-    8340544,
-    8340545,
-    8340546,
-    8340548,
-    8340549,
-    8340550,
-    8340552,
-    8340553,
-    8340554,
-    8340560,
-    8340561,
-    8340562,
-    8340564,
-    8340565,
-    8340566,
-    8340568,
-    8340569,
-    8340570,
-    8340576,
-    8340577,
-    8340578,
-    8340580,
-    8340581,
-    8340582,
-    8340584,
-    8340585,
-    8340586,
-    8340607,
-    8340608,
-    8340609,
-    8340610,
-    8340612,
-    8340613,
-    8340614,
-    8340616,
-    8340617,
-    8340618,
-    8340624,
-    8340625,
-    8340626,
-    8340628,
-    8340629,
-    8340630,
-    8340632,
-    8340633,
-    8340634,
-    8340640,
-    8340641,
-    8340642,
-    8340644,
-    8340645,
-    8340646,
-    8340648,
-    8340649,
-    8340650,
-    8340671,
-    8340800,
-    8340801,
-    8340802,
-    8340804,
-    8340805,
-    8340806,
-    8340808,
-    8340809,
-    8340810,
-    8340817,
-    8340818,
-    8340821,
-    8340822,
-    8340825,
-    8340826,
-    8340834,
-    8340838,
-    8340842,
-    8340863,
-    8340864,
-    8340865,
-    8340866,
-    8340868,
-    8340869,
-    8340870,
-    8340872,
-    8340873,
-    8340874,
-    8340880,
-    8340881,
-    8340882,
-    8340884,
-    8340885,
-    8340886,
-    8340888,
-    8340889,
-    8340890,
-    8340896,
-    8340897,
-    8340898,
-    8340900,
-    8340901,
-    8340902,
-    8340904,
-    8340905,
-    8340906,
-    8340927,
-    8341120,
-    8341121,
-    8341122,
-    8341124,
-    8341125,
-    8341126,
-    8341128,
-    8341129,
-    8341130,
-    8341137,
-    8341138,
-    8341141,
-    8341142,
-    8341145,
-    8341146,
-    8341154,
-    8341158,
-    8341162,
-    8341183,
-    8341504,
-    8341505,
-    8341506,
-    8341508,
-    8341509,
-    8341510,
-    8341512,
-    8341513,
-    8341514,
-    8341520,
-    8341521,
-    8341522,
-    8341524,
-    8341525,
-    8341526,
-    8341528,
-    8341529,
-    8341530,
-    8341536,
-    8341537,
-    8341538,
-    8341540,
-    8341541,
-    8341542,
-    8341544,
-    8341545,
-    8341546,
-    8341567,
-    8341568,
-    8341569,
-    8341570,
-    8341572,
-    8341573,
-    8341574,
-    8341576,
-    8341577,
-    8341578,
-    8341584,
-    8341585,
-    8341586,
-    8341588,
-    8341589,
-    8341590,
-    8341592,
-    8341593,
-    8341594,
-    8341600,
-    8341601,
-    8341602,
-    8341604,
-    8341605,
-    8341606,
-    8341608,
-    8341609,
-    8341610,
-    8341631,
-    8341632,
-    8341633,
-    8341634,
-    8341636,
-    8341637,
-    8341638,
-    8341640,
-    8341641,
-    8341642,
-    8341648,
-    8341649,
-    8341650,
-    8341652,
-    8341653,
-    8341654,
-    8341656,
-    8341657,
-    8341658,
-    8341664,
-    8341665,
-    8341666,
-    8341668,
-    8341669,
-    8341670,
-    8341672,
-    8341673,
-    8341674,
-    8341695,
-    8341760,
-    8341761,
-    8341762,
-    8341764,
-    8341765,
-    8341766,
-    8341768,
-    8341769,
-    8341770,
-    8341776,
-    8341777,
-    8341778,
-    8341780,
-    8341781,
-    8341782,
-    8341784,
-    8341785,
-    8341786,
-    8341792,
-    8341793,
-    8341794,
-    8341796,
-    8341797,
-    8341798,
-    8341800,
-    8341801,
-    8341802,
-    8341823,
-    8341824,
-    8341825,
-    8341826,
-    8341828,
-    8341829,
-    8341830,
-    8341832,
-    8341833,
-    8341834,
-    8341840,
-    8341841,
-    8341842,
-    8341844,
-    8341845,
-    8341846,
-    8341848,
-    8341849,
-    8341850,
-    8341856,
-    8341857,
-    8341858,
-    8341860,
-    8341861,
-    8341862,
-    8341864,
-    8341865,
-    8341866,
-    8341887,
-    8341888,
-    8341889,
-    8341890,
-    8341892,
-    8341893,
-    8341894,
-    8341896,
-    8341897,
-    8341898,
-    8341904,
-    8341905,
-    8341906,
-    8341908,
-    8341909,
-    8341910,
-    8341912,
-    8341913,
-    8341914,
-    8341920,
-    8341921,
-    8341922,
-    8341924,
-    8341925,
-    8341926,
-    8341928,
-    8341929,
-    8341930,
-    8341951,
-    8342016,
-    8342017,
-    8342018,
-    8342020,
-    8342021,
-    8342022,
-    8342024,
-    8342025,
-    8342026,
-    8342032,
-    8342033,
-    8342034,
-    8342036,
-    8342037,
-    8342038,
-    8342040,
-    8342041,
-    8342042,
-    8342048,
-    8342049,
-    8342050,
-    8342052,
-    8342053,
-    8342054,
-    8342056,
-    8342057,
-    8342058,
-    8342079,
-    8342080,
-    8342081,
-    8342082,
-    8342084,
-    8342085,
-    8342086,
-    8342088,
-    8342089,
-    8342090,
-    8342096,
-    8342097,
-    8342098,
-    8342100,
-    8342101,
-    8342102,
-    8342104,
-    8342105,
-    8342106,
-    8342112,
-    8342113,
-    8342114,
-    8342116,
-    8342117,
-    8342118,
-    8342120,
-    8342121,
-    8342122,
-    8342143,
-    8342144,
-    8342145,
-    8342146,
-    8342148,
-    8342149,
-    8342150,
-    8342152,
-    8342153,
-    8342154,
-    8342160,
-    8342161,
-    8342162,
-    8342164,
-    8342165,
-    8342166,
-    8342168,
-    8342169,
-    8342170,
-    8342176,
-    8342177,
-    8342178,
-    8342180,
-    8342181,
-    8342182,
-    8342184,
-    8342185,
-    8342186,
-    8342207,
-    8342723,
-    8342727,
-    8342731,
-    8342739,
-    8342743,
-    8342747,
-    8342755,
-    8342759,
-    8342763,
-    8342783,
-    8342979,
-    8342983,
-    8342987,
-    8342995,
-    8342999,
-    8343003,
-    8343011,
-    8343015,
-    8343019,
-    8343039,
-    8343235,
-    8343239,
-    8343243,
-    8343251,
-    8343255,
-    8343259,
-    8343267,
-    8343271,
-    8343275,
-    8343295,
-    8344576,
-    8344577,
-    8344578,
-    8344580,
-    8344581,
-    8344582,
-    8344584,
-    8344585,
-    8344586,
-    8344593,
-    8344594,
-    8344597,
-    8344598,
-    8344601,
-    8344602,
-    8344610,
-    8344614,
-    8344618,
-    8344639,
-    8344704,
-    8344705,
-    8344706,
-    8344708,
-    8344709,
-    8344710,
-    8344712,
-    8344713,
-    8344714,
-    8344720,
-    8344721,
-    8344722,
-    8344724,
-    8344725,
-    8344726,
-    8344728,
-    8344729,
-    8344730,
-    8344736,
-    8344737,
-    8344738,
-    8344740,
-    8344741,
-    8344742,
-    8344744,
-    8344745,
-    8344746,
-    8344767,
-    8345600,
-    8345601,
-    8345602,
-    8345604,
-    8345605,
-    8345606,
-    8345608,
-    8345609,
-    8345610,
-    8345616,
-    8345617,
-    8345618,
-    8345620,
-    8345621,
-    8345622,
-    8345624,
-    8345625,
-    8345626,
-    8345632,
-    8345633,
-    8345634,
-    8345636,
-    8345637,
-    8345638,
-    8345640,
-    8345641,
-    8345642,
-    8345663,
-    8345664,
-    8345665,
-    8345666,
-    8345668,
-    8345669,
-    8345670,
-    8345672,
-    8345673,
-    8345674,
-    8345680,
-    8345681,
-    8345682,
-    8345684,
-    8345685,
-    8345686,
-    8345688,
-    8345689,
-    8345690,
-    8345696,
-    8345697,
-    8345698,
-    8345700,
-    8345701,
-    8345702,
-    8345704,
-    8345705,
-    8345706,
-    8345727,
-    8345728,
-    8345729,
-    8345730,
-    8345732,
-    8345733,
-    8345734,
-    8345736,
-    8345737,
-    8345738,
-    8345744,
-    8345745,
-    8345746,
-    8345748,
-    8345749,
-    8345750,
-    8345752,
-    8345753,
-    8345754,
-    8345760,
-    8345761,
-    8345762,
-    8345764,
-    8345765,
-    8345766,
-    8345768,
-    8345769,
-    8345770,
-    8345791,
-    8346819,
-    8346823,
-    8346827,
-    8346835,
-    8346839,
-    8346843,
-    8346851,
-    8346855,
-    8346859,
-    8346879,
-    8347331,
-    8347335,
-    8347339,
-    8347347,
-    8347351,
-    8347355,
-    8347363,
-    8347367,
-    8347371,
-    8347391,
-    8359111,
-    8359115,
-    8359123,
-    8359127,
-    8359131,
-    8359143,
-    8359147,
-    8359363,
-    8359367,
-    8359371,
-    8359379,
-    8359383,
-    8359387,
-    8359395,
-    8359399,
-    8359403,
-    8359423,
-    8359619,
-    8359623,
-    8359627,
-    8359635,
-    8359639,
-    8359643,
-    8359651,
-    8359655,
-    8359659,
-    8359679,
-    8363203,
-    8363207,
-    8363211,
-    8363219,
-    8363223,
-    8363227,
-    8363235,
-    8363239,
-    8363243,
-    8363263,
-    8363459,
-    8363467,
-    8363475,
-    8363483,
-    8363491,
-    8363499,
-    8363715,
-    8363719,
-    8363723,
-    8363731,
-    8363735,
-    8363739,
-    8363747,
-    8363751,
-    8363755,
-    8363775,
-    11141121,
-    11141124,
-    11141125,
-    11141126,
-    11141137,
-    11141138,
-    11141141,
-    11141142,
-    11141158,
-    11141188,
-    11141189,
-    11141190,
-    11141200,
-    11141201,
-    11141202,
-    11141204,
-    11141205,
-    11141206,
-    11141216,
-    11141217,
-    11141218,
-    11141220,
-    11141221,
-    11141222,
-    11141440,
-    11141441,
-    11141442,
-    11141444,
-    11141445,
-    11141446,
-    11141457,
-    11141458,
-    11141461,
-    11141462,
-    11141474,
-    11141478,
-    11142160,
-    11142161,
-    11142162,
-    11142164,
-    11142165,
-    11142166,
-    11142176,
-    11142177,
-    11142178,
-    11142180,
-    11142181,
-    11142182,
-    11142228,
-    11142229,
-    11142230,
-    11142240,
-    11142241,
-    11142242,
-    11142244,
-    11142245,
-    11142246,
-    11142401,
-    11142402,
-    11142404,
-    11142405,
-    11142406,
-    11142417,
-    11142418,
-    11142420,
-    11142421,
-    11142422,
-    11142433,
-    11142434,
-    11142436,
-    11142437,
-    11142438,
-    11142465,
-    11142466,
-    11142468,
-    11142469,
-    11142470,
-    11142480,
-    11142481,
-    11142482,
-    11142484,
-    11142485,
-    11142486,
-    11142496,
-    11142497,
-    11142498,
-    11142500,
-    11142501,
-    11142502,
-    11143201,
-    11143204,
-    11143205,
-    11143206,
-    11143268,
-    11143269,
-    11143270,
-    11143426,
-    11143428,
-    11143429,
-    11143430,
-    11143441,
-    11143442,
-    11143444,
-    11143445,
-    11143446,
-    11143457,
-    11143458,
-    11143460,
-    11143461,
-    11143462,
-    11143490,
-    11143492,
-    11143493,
-    11143494,
-    11143505,
-    11143506,
-    11143508,
-    11143509,
-    11143510,
-    11143520,
-    11143521,
-    11143522,
-    11143524,
-    11143525,
-    11143526,
-    11145553,
-    11145554,
-    11145570,
-    11146513,
-    11146514,
-    11146517,
-    11146518,
-    11146529,
-    11146530,
-    11146533,
-    11146534,
-    11146593,
-    11146594,
-    11147553,
-    11147554,
-    11147557,
-    11147558,
-    11158545,
-    11158546,
-    11158549,
-    11158550,
-    11158562,
-    11158566,
-    11158613,
-    11158614,
-    11158625,
-    11158626,
-    11158629,
-    11158630,
-    11158865,
-    11158866,
-    11158869,
-    11158870,
-    11158882,
-    11158886,
-    11159585,
-    11159586,
-    11159589,
-    11159590,
-    11159653,
-    11159654,
-    11159826,
-    11159829,
-    11159830,
-    11159842,
-    11159845,
-    11159846,
-    11159890,
-    11159893,
-    11159894,
-    11159905,
-    11159906,
-    11159909,
-    11159910,
-    11162978,
-    11163938,
-    11163942,
-    11175974,
-    11176038,
-    11176290,
-    11176294,
-    11206660,
-    11206661,
-    11206662,
-    11206664,
-    11206665,
-    11206666,
-    11206673,
-    11206674,
-    11206677,
-    11206678,
-    11206681,
-    11206682,
-    11206694,
-    11206698,
-    11206724,
-    11206726,
-    11206728,
-    11206729,
-    11206730,
-    11206736,
-    11206737,
-    11206738,
-    11206740,
-    11206742,
-    11206744,
-    11206745,
-    11206746,
-    11206752,
-    11206753,
-    11206754,
-    11206756,
-    11206758,
-    11206760,
-    11206761,
-    11206762,
-    11206783,
-    11206976,
-    11206977,
-    11206978,
-    11206980,
-    11206982,
-    11206984,
-    11206985,
-    11206986,
-    11206993,
-    11206994,
-    11207001,
-    11207002,
-    11207010,
-    11207014,
-    11207018,
-    11207039,
-    11207684,
-    11207685,
-    11207686,
-    11207688,
-    11207689,
-    11207690,
-    11207697,
-    11207698,
-    11207700,
-    11207701,
-    11207702,
-    11207704,
-    11207705,
-    11207706,
-    11207713,
-    11207714,
-    11207716,
-    11207717,
-    11207718,
-    11207720,
-    11207721,
-    11207722,
-    11207743,
-    11207748,
-    11207750,
-    11207752,
-    11207753,
-    11207754,
-    11207760,
-    11207761,
-    11207762,
-    11207764,
-    11207766,
-    11207768,
-    11207769,
-    11207770,
-    11207776,
-    11207777,
-    11207778,
-    11207780,
-    11207782,
-    11207784,
-    11207785,
-    11207786,
-    11207807,
-    11207937,
-    11207938,
-    11207940,
-    11207941,
-    11207942,
-    11207944,
-    11207945,
-    11207946,
-    11207953,
-    11207954,
-    11207960,
-    11207961,
-    11207962,
-    11207969,
-    11207970,
-    11207972,
-    11207973,
-    11207974,
-    11207976,
-    11207977,
-    11207978,
-    11207999,
-    11208000,
-    11208001,
-    11208002,
-    11208004,
-    11208006,
-    11208008,
-    11208009,
-    11208010,
-    11208016,
-    11208017,
-    11208018,
-    11208024,
-    11208025,
-    11208026,
-    11208032,
-    11208033,
-    11208034,
-    11208036,
-    11208038,
-    11208040,
-    11208041,
-    11208042,
-    11208063,
-    11208708,
-    11208709,
-    11208710,
-    11208712,
-    11208713,
-    11208714,
-    11208721,
-    11208722,
-    11208724,
-    11208725,
-    11208726,
-    11208728,
-    11208729,
-    11208730,
-    11208737,
-    11208740,
-    11208741,
-    11208742,
-    11208744,
-    11208745,
-    11208746,
-    11208772,
-    11208774,
-    11208776,
-    11208777,
-    11208778,
-    11208784,
-    11208785,
-    11208786,
-    11208788,
-    11208790,
-    11208792,
-    11208793,
-    11208794,
-    11208800,
-    11208801,
-    11208802,
-    11208804,
-    11208806,
-    11208808,
-    11208809,
-    11208810,
-    11208831,
-    11208961,
-    11208962,
-    11208964,
-    11208965,
-    11208966,
-    11208968,
-    11208969,
-    11208970,
-    11208977,
-    11208978,
-    11208984,
-    11208985,
-    11208986,
-    11208993,
-    11208994,
-    11208996,
-    11208997,
-    11208998,
-    11209000,
-    11209001,
-    11209002,
-    11209023,
-    11209024,
-    11209025,
-    11209026,
-    11209028,
-    11209030,
-    11209032,
-    11209033,
-    11209034,
-    11209040,
-    11209041,
-    11209042,
-    11209048,
-    11209049,
-    11209050,
-    11209056,
-    11209057,
-    11209058,
-    11209060,
-    11209062,
-    11209064,
-    11209065,
-    11209066,
-    11209087,
-    11210756,
-    11210757,
-    11210758,
-    11210760,
-    11210761,
-    11210762,
-    11210769,
-    11210770,
-    11210773,
-    11210774,
-    11210777,
-    11210778,
-    11210786,
-    11210790,
-    11210794,
-    11210815,
-    11210820,
-    11210822,
-    11210824,
-    11210825,
-    11210826,
-    11210832,
-    11210833,
-    11210834,
-    11210836,
-    11210838,
-    11210840,
-    11210841,
-    11210842,
-    11210848,
-    11210849,
-    11210850,
-    11210852,
-    11210854,
-    11210856,
-    11210857,
-    11210858,
-    11210879,
-    11211072,
-    11211073,
-    11211074,
-    11211080,
-    11211081,
-    11211082,
-    11211089,
-    11211090,
-    11211097,
-    11211098,
-    11211106,
-    11211114,
-    11211780,
-    11211781,
-    11211782,
-    11211784,
-    11211785,
-    11211786,
-    11211793,
-    11211794,
-    11211796,
-    11211797,
-    11211798,
-    11211800,
-    11211801,
-    11211802,
-    11211809,
-    11211810,
-    11211812,
-    11211813,
-    11211814,
-    11211816,
-    11211817,
-    11211818,
-    11211839,
-    11211844,
-    11211846,
-    11211848,
-    11211849,
-    11211850,
-    11211856,
-    11211857,
-    11211858,
-    11211860,
-    11211862,
-    11211864,
-    11211865,
-    11211866,
-    11211872,
-    11211873,
-    11211874,
-    11211876,
-    11211878,
-    11211880,
-    11211881,
-    11211882,
-    11211903,
-    11212033,
-    11212034,
-    11212036,
-    11212037,
-    11212038,
-    11212040,
-    11212041,
-    11212042,
-    11212049,
-    11212050,
-    11212056,
-    11212057,
-    11212058,
-    11212065,
-    11212066,
-    11212068,
-    11212069,
-    11212070,
-    11212072,
-    11212073,
-    11212074,
-    11212095,
-    11212096,
-    11212097,
-    11212098,
-    11212104,
-    11212105,
-    11212106,
-    11212112,
-    11212113,
-    11212114,
-    11212120,
-    11212121,
-    11212122,
-    11212128,
-    11212129,
-    11212130,
-    11212136,
-    11212137,
-    11212138,
-    11212804,
-    11212805,
-    11212806,
-    11212808,
-    11212809,
-    11212810,
-    11212817,
-    11212818,
-    11212820,
-    11212821,
-    11212822,
-    11212824,
-    11212825,
-    11212826,
-    11212833,
-    11212834,
-    11212836,
-    11212837,
-    11212838,
-    11212840,
-    11212841,
-    11212842,
-    11212863,
-    11212868,
-    11212870,
-    11212872,
-    11212873,
-    11212874,
-    11212880,
-    11212881,
-    11212882,
-    11212884,
-    11212886,
-    11212888,
-    11212889,
-    11212890,
-    11212896,
-    11212897,
-    11212898,
-    11212900,
-    11212902,
-    11212904,
-    11212905,
-    11212906,
-    11212927,
-    11213057,
-    11213058,
-    11213060,
-    11213061,
-    11213062,
-    11213064,
-    11213065,
-    11213066,
-    11213073,
-    11213074,
-    11213080,
-    11213081,
-    11213082,
-    11213089,
-    11213090,
-    11213092,
-    11213093,
-    11213094,
-    11213096,
-    11213097,
-    11213098,
-    11213119,
-    11213120,
-    11213121,
-    11213122,
-    11213128,
-    11213129,
-    11213130,
-    11213136,
-    11213137,
-    11213138,
-    11213144,
-    11213145,
-    11213146,
-    11213152,
-    11213153,
-    11213154,
-    11213160,
-    11213161,
-    11213162,
-    11224068,
-    11224069,
-    11224070,
-    11224072,
-    11224073,
-    11224074,
-    11224081,
-    11224082,
-    11224085,
-    11224086,
-    11224089,
-    11224090,
-    11224098,
-    11224102,
-    11224106,
-    11224127,
-    11224132,
-    11224134,
-    11224136,
-    11224137,
-    11224138,
-    11224144,
-    11224145,
-    11224146,
-    11224148,
-    11224150,
-    11224152,
-    11224153,
-    11224154,
-    11224160,
-    11224161,
-    11224162,
-    11224164,
-    11224166,
-    11224168,
-    11224169,
-    11224170,
-    11224191,
-    11224384,
-    11224385,
-    11224386,
-    11224388,
-    11224390,
-    11224392,
-    11224393,
-    11224394,
-    11224401,
-    11224402,
-    11224409,
-    11224410,
-    11224418,
-    11224422,
-    11224426,
-    11224447,
-    11225092,
-    11225093,
-    11225094,
-    11225096,
-    11225097,
-    11225098,
-    11225105,
-    11225106,
-    11225108,
-    11225109,
-    11225110,
-    11225112,
-    11225113,
-    11225114,
-    11225121,
-    11225122,
-    11225124,
-    11225125,
-    11225126,
-    11225128,
-    11225129,
-    11225130,
-    11225151,
-    11225156,
-    11225158,
-    11225160,
-    11225161,
-    11225162,
-    11225168,
-    11225169,
-    11225170,
-    11225172,
-    11225174,
-    11225176,
-    11225177,
-    11225178,
-    11225184,
-    11225185,
-    11225186,
-    11225188,
-    11225190,
-    11225192,
-    11225193,
-    11225194,
-    11225215,
-    11225345,
-    11225346,
-    11225348,
-    11225349,
-    11225350,
-    11225352,
-    11225353,
-    11225354,
-    11225361,
-    11225362,
-    11225368,
-    11225369,
-    11225370,
-    11225377,
-    11225378,
-    11225380,
-    11225381,
-    11225382,
-    11225384,
-    11225385,
-    11225386,
-    11225407,
-    11225408,
-    11225409,
-    11225410,
-    11225412,
-    11225414,
-    11225416,
-    11225417,
-    11225418,
-    11225424,
-    11225425,
-    11225426,
-    11225432,
-    11225433,
-    11225434,
-    11225440,
-    11225441,
-    11225442,
-    11225444,
-    11225446,
-    11225448,
-    11225449,
-    11225450,
-    11225471,
-    11228164,
-    11228165,
-    11228166,
-    11228168,
-    11228169,
-    11228170,
-    11228177,
-    11228178,
-    11228181,
-    11228182,
-    11228185,
-    11228186,
-    11228194,
-    11228198,
-    11228202,
-    11228223,
-    11228228,
-    11228230,
-    11228232,
-    11228233,
-    11228234,
-    11228240,
-    11228241,
-    11228242,
-    11228244,
-    11228246,
-    11228248,
-    11228249,
-    11228250,
-    11228256,
-    11228257,
-    11228258,
-    11228260,
-    11228262,
-    11228264,
-    11228265,
-    11228266,
-    11228287,
-    11228480,
-    11228481,
-    11228482,
-    11228488,
-    11228489,
-    11228490,
-    11228497,
-    11228498,
-    11228505,
-    11228506,
-    11228514,
-    11228522,
-    11229188,
-    11229189,
-    11229190,
-    11229192,
-    11229193,
-    11229194,
-    11229201,
-    11229202,
-    11229204,
-    11229205,
-    11229206,
-    11229208,
-    11229209,
-    11229210,
-    11229217,
-    11229218,
-    11229220,
-    11229221,
-    11229222,
-    11229224,
-    11229225,
-    11229226,
-    11229247,
-    11229252,
-    11229254,
-    11229256,
-    11229257,
-    11229258,
-    11229264,
-    11229265,
-    11229266,
-    11229268,
-    11229270,
-    11229272,
-    11229273,
-    11229274,
-    11229280,
-    11229281,
-    11229282,
-    11229284,
-    11229286,
-    11229288,
-    11229289,
-    11229290,
-    11229311,
-    11229441,
-    11229442,
-    11229444,
-    11229445,
-    11229446,
-    11229448,
-    11229449,
-    11229450,
-    11229457,
-    11229458,
-    11229464,
-    11229465,
-    11229466,
-    11229473,
-    11229474,
-    11229476,
-    11229477,
-    11229478,
-    11229480,
-    11229481,
-    11229482,
-    11229503,
-    11229504,
-    11229505,
-    11229506,
-    11229512,
-    11229513,
-    11229514,
-    11229520,
-    11229521,
-    11229522,
-    11229528,
-    11229529,
-    11229530,
-    11229536,
-    11229537,
-    11229538,
-    11229544,
-    11229545,
-    11229546,
-    11241476,
-    11241477,
-    11241478,
-    11241480,
-    11241481,
-    11241482,
-    11241489,
-    11241490,
-    11241493,
-    11241494,
-    11241497,
-    11241498,
-    11241510,
-    11241514,
-    11241540,
-    11241542,
-    11241544,
-    11241545,
-    11241546,
-    11241552,
-    11241553,
-    11241554,
-    11241556,
-    11241558,
-    11241560,
-    11241561,
-    11241562,
-    11241568,
-    11241569,
-    11241570,
-    11241572,
-    11241574,
-    11241576,
-    11241577,
-    11241578,
-    11241599,
-    11241792,
-    11241793,
-    11241794,
-    11241796,
-    11241798,
-    11241800,
-    11241801,
-    11241802,
-    11241809,
-    11241810,
-    11241817,
-    11241818,
-    11241826,
-    11241830,
-    11241834,
-    11241855,
-    11245572,
-    11245573,
-    11245574,
-    11245576,
-    11245577,
-    11245578,
-    11245585,
-    11245586,
-    11245589,
-    11245590,
-    11245593,
-    11245594,
-    11245602,
-    11245606,
-    11245610,
-    11245631,
-    11245636,
-    11245638,
-    11245640,
-    11245641,
-    11245642,
-    11245648,
-    11245649,
-    11245650,
-    11245652,
-    11245654,
-    11245656,
-    11245657,
-    11245658,
-    11245664,
-    11245665,
-    11245666,
-    11245668,
-    11245670,
-    11245672,
-    11245673,
-    11245674,
-    11245695,
-    11245888,
-    11245889,
-    11245890,
-    11245896,
-    11245897,
-    11245898,
-    11245905,
-    11245906,
-    11245913,
-    11245914,
-    11245922,
-    11245930,
-    11468868,
-    11468869,
-    11468870,
-    11468872,
-    11468873,
-    11468874,
-    11468880,
-    11468881,
-    11468882,
-    11468884,
-    11468885,
-    11468886,
-    11468888,
-    11468889,
-    11468890,
-    11468896,
-    11468897,
-    11468898,
-    11468900,
-    11468901,
-    11468902,
-    11468904,
-    11468905,
-    11468906,
-    11468927,
-    11468936,
-    11468937,
-    11468938,
-    11468944,
-    11468945,
-    11468946,
-    11468948,
-    11468949,
-    11468950,
-    11468952,
-    11468953,
-    11468954,
-    11468960,
-    11468961,
-    11468962,
-    11468964,
-    11468965,
-    11468966,
-    11468968,
-    11468969,
-    11468970,
-    11468991,
-    11469120,
-    11469121,
-    11469122,
-    11469124,
-    11469125,
-    11469126,
-    11469128,
-    11469129,
-    11469130,
-    11469136,
-    11469137,
-    11469138,
-    11469144,
-    11469145,
-    11469146,
-    11469152,
-    11469153,
-    11469154,
-    11469156,
-    11469157,
-    11469158,
-    11469160,
-    11469161,
-    11469162,
-    11469183,
-    11469184,
-    11469185,
-    11469186,
-    11469188,
-    11469189,
-    11469190,
-    11469192,
-    11469193,
-    11469194,
-    11469200,
-    11469201,
-    11469202,
-    11469208,
-    11469209,
-    11469210,
-    11469216,
-    11469217,
-    11469218,
-    11469220,
-    11469221,
-    11469222,
-    11469224,
-    11469225,
-    11469226,
-    11469247,
-    11469840,
-    11469841,
-    11469842,
-    11469844,
-    11469845,
-    11469846,
-    11469848,
-    11469849,
-    11469850,
-    11469856,
-    11469857,
-    11469858,
-    11469860,
-    11469861,
-    11469862,
-    11469864,
-    11469865,
-    11469866,
-    11469887,
-    11469908,
-    11469909,
-    11469910,
-    11469912,
-    11469913,
-    11469914,
-    11469920,
-    11469921,
-    11469922,
-    11469924,
-    11469925,
-    11469926,
-    11469928,
-    11469929,
-    11469930,
-    11469951,
-    11469976,
-    11469977,
-    11469978,
-    11469984,
-    11469985,
-    11469986,
-    11469988,
-    11469989,
-    11469990,
-    11469992,
-    11469993,
-    11469994,
-    11470015,
-    11470080,
-    11470081,
-    11470082,
-    11470084,
-    11470085,
-    11470086,
-    11470088,
-    11470089,
-    11470090,
-    11470096,
-    11470097,
-    11470098,
-    11470104,
-    11470105,
-    11470106,
-    11470112,
-    11470113,
-    11470114,
-    11470116,
-    11470117,
-    11470118,
-    11470120,
-    11470121,
-    11470122,
-    11470143,
-    11470144,
-    11470145,
-    11470146,
-    11470148,
-    11470149,
-    11470150,
-    11470152,
-    11470153,
-    11470154,
-    11470160,
-    11470161,
-    11470162,
-    11470168,
-    11470169,
-    11470170,
-    11470176,
-    11470177,
-    11470178,
-    11470180,
-    11470181,
-    11470182,
-    11470184,
-    11470185,
-    11470186,
-    11470207,
-    11470208,
-    11470209,
-    11470210,
-    11470212,
-    11470213,
-    11470214,
-    11470216,
-    11470217,
-    11470218,
-    11470224,
-    11470225,
-    11470226,
-    11470232,
-    11470233,
-    11470234,
-    11470240,
-    11470241,
-    11470242,
-    11470244,
-    11470245,
-    11470246,
-    11470248,
-    11470249,
-    11470250,
-    11470271,
-    11470881,
-    11470884,
-    11470885,
-    11470886,
-    11470888,
-    11470889,
-    11470890,
-    11470948,
-    11470949,
-    11470950,
-    11470952,
-    11470953,
-    11470954,
-    11470975,
-    11471016,
-    11471017,
-    11471018,
-    11471039,
-    11471104,
-    11471105,
-    11471106,
-    11471108,
-    11471109,
-    11471110,
-    11471112,
-    11471113,
-    11471114,
-    11471120,
-    11471121,
-    11471122,
-    11471128,
-    11471129,
-    11471130,
-    11471136,
-    11471137,
-    11471138,
-    11471140,
-    11471141,
-    11471142,
-    11471144,
-    11471145,
-    11471146,
-    11471167,
-    11471168,
-    11471169,
-    11471170,
-    11471172,
-    11471173,
-    11471174,
-    11471176,
-    11471177,
-    11471178,
-    11471184,
-    11471185,
-    11471186,
-    11471192,
-    11471193,
-    11471194,
-    11471200,
-    11471201,
-    11471202,
-    11471204,
-    11471205,
-    11471206,
-    11471208,
-    11471209,
-    11471210,
-    11471231,
-    11471232,
-    11471233,
-    11471234,
-    11471236,
-    11471237,
-    11471238,
-    11471240,
-    11471241,
-    11471242,
-    11471248,
-    11471249,
-    11471250,
-    11471256,
-    11471257,
-    11471258,
-    11471264,
-    11471265,
-    11471266,
-    11471268,
-    11471269,
-    11471270,
-    11471272,
-    11471273,
-    11471274,
-    11471295,
-    11472323,
-    11472327,
-    11472331,
-    11472339,
-    11472347,
-    11472355,
-    11472359,
-    11472363,
-    11472383,
-    11473152,
-    11473153,
-    11473154,
-    11473156,
-    11473157,
-    11473158,
-    11473160,
-    11473161,
-    11473162,
-    11473168,
-    11473169,
-    11473170,
-    11473176,
-    11473177,
-    11473178,
-    11473184,
-    11473185,
-    11473186,
-    11473188,
-    11473189,
-    11473190,
-    11473192,
-    11473193,
-    11473194,
-    11473215,
-    11473224,
-    11473225,
-    11473226,
-    11473232,
-    11473233,
-    11473234,
-    11473240,
-    11473241,
-    11473242,
-    11473248,
-    11473249,
-    11473250,
-    11473256,
-    11473257,
-    11473258,
-    11473288,
-    11473289,
-    11473290,
-    11473296,
-    11473297,
-    11473298,
-    11473304,
-    11473305,
-    11473306,
-    11473312,
-    11473313,
-    11473314,
-    11473316,
-    11473317,
-    11473318,
-    11473320,
-    11473321,
-    11473322,
-    11473343,
-    11474192,
-    11474193,
-    11474194,
-    11474200,
-    11474201,
-    11474202,
-    11474208,
-    11474209,
-    11474210,
-    11474212,
-    11474213,
-    11474214,
-    11474216,
-    11474217,
-    11474218,
-    11474239,
-    11474328,
-    11474329,
-    11474330,
-    11474336,
-    11474337,
-    11474338,
-    11474340,
-    11474341,
-    11474342,
-    11474344,
-    11474345,
-    11474346,
-    11474367,
-    11475232,
-    11475233,
-    11475234,
-    11475236,
-    11475237,
-    11475238,
-    11475240,
-    11475241,
-    11475242,
-    11475263,
-    11475304,
-    11475305,
-    11475306,
-    11475368,
-    11475369,
-    11475370,
-    11475391,
-    11485252,
-    11485253,
-    11485254,
-    11485256,
-    11485257,
-    11485258,
-    11485264,
-    11485265,
-    11485266,
-    11485268,
-    11485269,
-    11485270,
-    11485272,
-    11485273,
-    11485274,
-    11485280,
-    11485281,
-    11485282,
-    11485284,
-    11485285,
-    11485286,
-    11485288,
-    11485289,
-    11485290,
-    11485311,
-    11485320,
-    11485321,
-    11485322,
-    11485328,
-    11485329,
-    11485330,
-    11485332,
-    11485333,
-    11485334,
-    11485336,
-    11485337,
-    11485338,
-    11485344,
-    11485345,
-    11485346,
-    11485348,
-    11485349,
-    11485350,
-    11485352,
-    11485353,
-    11485354,
-    11485375,
-    11485504,
-    11485505,
-    11485506,
-    11485508,
-    11485509,
-    11485510,
-    11485512,
-    11485513,
-    11485514,
-    11485520,
-    11485521,
-    11485522,
-    11485528,
-    11485529,
-    11485530,
-    11485536,
-    11485537,
-    11485538,
-    11485540,
-    11485541,
-    11485542,
-    11485544,
-    11485545,
-    11485546,
-    11485567,
-    11485568,
-    11485569,
-    11485570,
-    11485572,
-    11485573,
-    11485574,
-    11485576,
-    11485577,
-    11485578,
-    11485584,
-    11485585,
-    11485586,
-    11485592,
-    11485593,
-    11485594,
-    11485600,
-    11485601,
-    11485602,
-    11485604,
-    11485605,
-    11485606,
-    11485608,
-    11485609,
-    11485610,
-    11485631,
-    11486224,
-    11486225,
-    11486226,
-    11486228,
-    11486229,
-    11486230,
-    11486232,
-    11486233,
-    11486234,
-    11486240,
-    11486241,
-    11486242,
-    11486244,
-    11486245,
-    11486246,
-    11486248,
-    11486249,
-    11486250,
-    11486271,
-    11486292,
-    11486293,
-    11486294,
-    11486296,
-    11486297,
-    11486298,
-    11486304,
-    11486305,
-    11486306,
-    11486308,
-    11486309,
-    11486310,
-    11486312,
-    11486313,
-    11486314,
-    11486335,
-    11486360,
-    11486361,
-    11486362,
-    11486368,
-    11486369,
-    11486370,
-    11486372,
-    11486373,
-    11486374,
-    11486376,
-    11486377,
-    11486378,
-    11486399,
-    11486464,
-    11486465,
-    11486466,
-    11486468,
-    11486469,
-    11486470,
-    11486472,
-    11486473,
-    11486474,
-    11486480,
-    11486481,
-    11486482,
-    11486488,
-    11486489,
-    11486490,
-    11486496,
-    11486497,
-    11486498,
-    11486500,
-    11486501,
-    11486502,
-    11486504,
-    11486505,
-    11486506,
-    11486527,
-    11486528,
-    11486529,
-    11486530,
-    11486532,
-    11486533,
-    11486534,
-    11486536,
-    11486537,
-    11486538,
-    11486544,
-    11486545,
-    11486546,
-    11486552,
-    11486553,
-    11486554,
-    11486560,
-    11486561,
-    11486562,
-    11486564,
-    11486565,
-    11486566,
-    11486568,
-    11486569,
-    11486570,
-    11486591,
-    11486592,
-    11486593,
-    11486594,
-    11486596,
-    11486597,
-    11486598,
-    11486600,
-    11486601,
-    11486602,
-    11486608,
-    11486609,
-    11486610,
-    11486616,
-    11486617,
-    11486618,
-    11486624,
-    11486625,
-    11486626,
-    11486628,
-    11486629,
-    11486630,
-    11486632,
-    11486633,
-    11486634,
-    11486655,
-    11487264,
-    11487265,
-    11487266,
-    11487268,
-    11487269,
-    11487270,
-    11487272,
-    11487273,
-    11487274,
-    11487295,
-    11487332,
-    11487333,
-    11487334,
-    11487336,
-    11487337,
-    11487338,
-    11487359,
-    11487400,
-    11487401,
-    11487402,
-    11487423,
-    11487488,
-    11487489,
-    11487490,
-    11487492,
-    11487493,
-    11487494,
-    11487496,
-    11487497,
-    11487498,
-    11487504,
-    11487505,
-    11487506,
-    11487512,
-    11487513,
-    11487514,
-    11487520,
-    11487521,
-    11487522,
-    11487524,
-    11487525,
-    11487526,
-    11487528,
-    11487529,
-    11487530,
-    11487551,
-    11487552,
-    11487553,
-    11487554,
-    11487556,
-    11487557,
-    11487558,
-    11487560,
-    11487561,
-    11487562,
-    11487568,
-    11487569,
-    11487570,
-    11487576,
-    11487577,
-    11487578,
-    11487584,
-    11487585,
-    11487586,
-    11487588,
-    11487589,
-    11487590,
-    11487592,
-    11487593,
-    11487594,
-    11487615,
-    11487616,
-    11487617,
-    11487618,
-    11487620,
-    11487621,
-    11487622,
-    11487624,
-    11487625,
-    11487626,
-    11487632,
-    11487633,
-    11487634,
-    11487640,
-    11487641,
-    11487642,
-    11487648,
-    11487649,
-    11487650,
-    11487652,
-    11487653,
-    11487654,
-    11487656,
-    11487657,
-    11487658,
-    11487679,
-    11488511,
-    11488707,
-    11488711,
-    11488715,
-    11488723,
-    11488731,
-    11488739,
-    11488743,
-    11488747,
-    11488767,
-    11489536,
-    11489537,
-    11489538,
-    11489540,
-    11489541,
-    11489542,
-    11489544,
-    11489545,
-    11489546,
-    11489552,
-    11489553,
-    11489554,
-    11489560,
-    11489561,
-    11489562,
-    11489568,
-    11489569,
-    11489570,
-    11489572,
-    11489573,
-    11489574,
-    11489576,
-    11489577,
-    11489578,
-    11489599,
-    11489608,
-    11489609,
-    11489610,
-    11489616,
-    11489617,
-    11489618,
-    11489624,
-    11489625,
-    11489626,
-    11489632,
-    11489633,
-    11489634,
-    11489640,
-    11489641,
-    11489642,
-    11489672,
-    11489673,
-    11489674,
-    11489680,
-    11489681,
-    11489682,
-    11489688,
-    11489689,
-    11489690,
-    11489696,
-    11489697,
-    11489698,
-    11489700,
-    11489701,
-    11489702,
-    11489704,
-    11489705,
-    11489706,
-    11489727,
-    11490576,
-    11490577,
-    11490578,
-    11490584,
-    11490585,
-    11490586,
-    11490592,
-    11490593,
-    11490594,
-    11490596,
-    11490597,
-    11490598,
-    11490600,
-    11490601,
-    11490602,
-    11490623,
-    11490712,
-    11490713,
-    11490714,
-    11490720,
-    11490721,
-    11490722,
-    11490724,
-    11490725,
-    11490726,
-    11490728,
-    11490729,
-    11490730,
-    11490751,
-    11491616,
-    11491617,
-    11491618,
-    11491620,
-    11491621,
-    11491622,
-    11491624,
-    11491625,
-    11491626,
-    11491647,
-    11491688,
-    11491689,
-    11491690,
-    11491752,
-    11491753,
-    11491754,
-    11491775,
-    11501636,
-    11501637,
-    11501638,
-    11501640,
-    11501641,
-    11501642,
-    11501648,
-    11501649,
-    11501650,
-    11501652,
-    11501653,
-    11501654,
-    11501656,
-    11501657,
-    11501658,
-    11501664,
-    11501665,
-    11501666,
-    11501668,
-    11501669,
-    11501670,
-    11501672,
-    11501673,
-    11501674,
-    11501695,
-    11501704,
-    11501705,
-    11501706,
-    11501712,
-    11501713,
-    11501714,
-    11501716,
-    11501717,
-    11501718,
-    11501720,
-    11501721,
-    11501722,
-    11501728,
-    11501729,
-    11501730,
-    11501732,
-    11501733,
-    11501734,
-    11501736,
-    11501737,
-    11501738,
-    11501759,
-    11501888,
-    11501889,
-    11501890,
-    11501892,
-    11501893,
-    11501894,
-    11501896,
-    11501897,
-    11501898,
-    11501904,
-    11501905,
-    11501906,
-    11501912,
-    11501913,
-    11501914,
-    11501920,
-    11501921,
-    11501922,
-    11501924,
-    11501925,
-    11501926,
-    11501928,
-    11501929,
-    11501930,
-    11501951,
-    11501952,
-    11501953,
-    11501954,
-    11501956,
-    11501957,
-    11501958,
-    11501960,
-    11501961,
-    11501962,
-    11501968,
-    11501969,
-    11501970,
-    11501976,
-    11501977,
-    11501978,
-    11501984,
-    11501985,
-    11501986,
-    11501988,
-    11501989,
-    11501990,
-    11501992,
-    11501993,
-    11501994,
-    11502015,
-    11502608,
-    11502609,
-    11502610,
-    11502612,
-    11502613,
-    11502614,
-    11502616,
-    11502617,
-    11502618,
-    11502624,
-    11502625,
-    11502626,
-    11502628,
-    11502629,
-    11502630,
-    11502632,
-    11502633,
-    11502634,
-    11502655,
-    11502676,
-    11502677,
-    11502678,
-    11502680,
-    11502681,
-    11502682,
-    11502688,
-    11502689,
-    11502690,
-    11502692,
-    11502693,
-    11502694,
-    11502696,
-    11502697,
-    11502698,
-    11502719,
-    11502744,
-    11502745,
-    11502746,
-    11502752,
-    11502753,
-    11502754,
-    11502756,
-    11502757,
-    11502758,
-    11502760,
-    11502761,
-    11502762,
-    11502783,
-    11502848,
-    11502849,
-    11502850,
-    11502852,
-    11502853,
-    11502854,
-    11502856,
-    11502857,
-    11502858,
-    11502864,
-    11502865,
-    11502866,
-    11502872,
-    11502873,
-    11502874,
-    11502880,
-    11502881,
-    11502882,
-    11502884,
-    11502885,
-    11502886,
-    11502888,
-    11502889,
-    11502890,
-    11502911,
-    11502912,
-    11502913,
-    11502914,
-    11502916,
-    11502917,
-    11502918,
-    11502920,
-    11502921,
-    11502922,
-    11502928,
-    11502929,
-    11502930,
-    11502936,
-    11502937,
-    11502938,
-    11502944,
-    11502945,
-    11502946,
-    11502948,
-    11502949,
-    11502950,
-    11502952,
-    11502953,
-    11502954,
-    11502975,
-    11502976,
-    11502977,
-    11502978,
-    11502980,
-    11502981,
-    11502982,
-    11502984,
-    11502985,
-    11502986,
-    11502992,
-    11502993,
-    11502994,
-    11503000,
-    11503001,
-    11503002,
-    11503008,
-    11503009,
-    11503010,
-    11503012,
-    11503013,
-    11503014,
-    11503016,
-    11503017,
-    11503018,
-    11503039,
-    11503649,
-    11503652,
-    11503653,
-    11503654,
-    11503656,
-    11503657,
-    11503658,
-    11503716,
-    11503717,
-    11503718,
-    11503720,
-    11503721,
-    11503722,
-    11503743,
-    11503784,
-    11503785,
-    11503786,
-    11503807,
-    11503872,
-    11503873,
-    11503874,
-    11503876,
-    11503877,
-    11503878,
-    11503880,
-    11503881,
-    11503882,
-    11503888,
-    11503889,
-    11503890,
-    11503896,
-    11503897,
-    11503898,
-    11503904,
-    11503905,
-    11503906,
-    11503908,
-    11503909,
-    11503910,
-    11503912,
-    11503913,
-    11503914,
-    11503935,
-    11503936,
-    11503937,
-    11503938,
-    11503940,
-    11503941,
-    11503942,
-    11503944,
-    11503945,
-    11503946,
-    11503952,
-    11503953,
-    11503954,
-    11503960,
-    11503961,
-    11503962,
-    11503968,
-    11503969,
-    11503970,
-    11503972,
-    11503973,
-    11503974,
-    11503976,
-    11503977,
-    11503978,
-    11503999,
-    11504000,
-    11504001,
-    11504002,
-    11504004,
-    11504005,
-    11504006,
-    11504008,
-    11504009,
-    11504010,
-    11504016,
-    11504017,
-    11504018,
-    11504024,
-    11504025,
-    11504026,
-    11504032,
-    11504033,
-    11504034,
-    11504036,
-    11504037,
-    11504038,
-    11504040,
-    11504041,
-    11504042,
-    11504063,
-    11505091,
-    11505095,
-    11505099,
-    11505107,
-    11505115,
-    11505123,
-    11505127,
-    11505131,
-    11505151,
-    11505920,
-    11505921,
-    11505922,
-    11505924,
-    11505925,
-    11505926,
-    11505928,
-    11505929,
-    11505930,
-    11505936,
-    11505937,
-    11505938,
-    11505944,
-    11505945,
-    11505946,
-    11505952,
-    11505953,
-    11505954,
-    11505956,
-    11505957,
-    11505958,
-    11505960,
-    11505961,
-    11505962,
-    11505983,
-    11505992,
-    11505993,
-    11505994,
-    11506000,
-    11506001,
-    11506002,
-    11506008,
-    11506009,
-    11506010,
-    11506016,
-    11506017,
-    11506018,
-    11506024,
-    11506025,
-    11506026,
-    11506056,
-    11506057,
-    11506058,
-    11506064,
-    11506065,
-    11506066,
-    11506072,
-    11506073,
-    11506074,
-    11506080,
-    11506081,
-    11506082,
-    11506084,
-    11506085,
-    11506086,
-    11506088,
-    11506089,
-    11506090,
-    11506111,
-    11506960,
-    11506961,
-    11506962,
-    11506968,
-    11506969,
-    11506970,
-    11506976,
-    11506977,
-    11506978,
-    11506980,
-    11506981,
-    11506982,
-    11506984,
-    11506985,
-    11506986,
-    11507007,
-    11507096,
-    11507097,
-    11507098,
-    11507104,
-    11507105,
-    11507106,
-    11507108,
-    11507109,
-    11507110,
-    11507112,
-    11507113,
-    11507114,
-    11507135,
-    11508000,
-    11508001,
-    11508002,
-    11508004,
-    11508005,
-    11508006,
-    11508008,
-    11508009,
-    11508010,
-    11508031,
-    11508072,
-    11508073,
-    11508074,
-    11508136,
-    11508137,
-    11508138,
-    11508159,
-    12452160,
-    12452161,
-    12452162,
-    12452164,
-    12452166,
-    12452177,
-    12452178,
-    12452194,
-    12452198,
-    12452224,
-    12452225,
-    12452226,
-    12452228,
-    12452229,
-    12452230,
-    12452240,
-    12452241,
-    12452242,
-    12452256,
-    12452257,
-    12452258,
-    12452260,
-    12452261,
-    12452262,
-    12452480,
-    12452481,
-    12452482,
-    12452484,
-    12452485,
-    12452486,
-    12452497,
-    12452498,
-    12452501,
-    12452502,
-    12452514,
-    12452518,
-    12453121,
-    12453122,
-    12453124,
-    12453125,
-    12453126,
-    12453137,
-    12453138,
-    12453153,
-    12453154,
-    12453156,
-    12453157,
-    12453158,
-    12453185,
-    12453186,
-    12453188,
-    12453190,
-    12453200,
-    12453201,
-    12453202,
-    12453216,
-    12453217,
-    12453218,
-    12453220,
-    12453222,
-    12453249,
-    12453250,
-    12453252,
-    12453253,
-    12453254,
-    12453264,
-    12453265,
-    12453266,
-    12453280,
-    12453281,
-    12453282,
-    12453284,
-    12453285,
-    12453286,
-    12453377,
-    12453378,
-    12453380,
-    12453381,
-    12453382,
-    12453393,
-    12453394,
-    12453396,
-    12453397,
-    12453398,
-    12453409,
-    12453410,
-    12453412,
-    12453413,
-    12453414,
-    12453441,
-    12453442,
-    12453444,
-    12453446,
-    12453457,
-    12453458,
-    12453460,
-    12453462,
-    12453472,
-    12453473,
-    12453474,
-    12453476,
-    12453478,
-    12453505,
-    12453506,
-    12453508,
-    12453509,
-    12453510,
-    12453520,
-    12453521,
-    12453522,
-    12453524,
-    12453525,
-    12453526,
-    12453536,
-    12453537,
-    12453538,
-    12453540,
-    12453541,
-    12453542,
-    12454146,
-    12454148,
-    12454149,
-    12454150,
-    12454161,
-    12454162,
-    12454177,
-    12454178,
-    12454180,
-    12454181,
-    12454182,
-    12454210,
-    12454212,
-    12454214,
-    12454225,
-    12454226,
-    12454240,
-    12454241,
-    12454242,
-    12454244,
-    12454246,
-    12454274,
-    12454276,
-    12454277,
-    12454278,
-    12454289,
-    12454290,
-    12454304,
-    12454305,
-    12454306,
-    12454308,
-    12454309,
-    12454310,
-    12454402,
-    12454404,
-    12454405,
-    12454406,
-    12454417,
-    12454418,
-    12454420,
-    12454421,
-    12454422,
-    12454433,
-    12454434,
-    12454436,
-    12454437,
-    12454438,
-    12454466,
-    12454468,
-    12454470,
-    12454481,
-    12454482,
-    12454484,
-    12454486,
-    12454497,
-    12454498,
-    12454500,
-    12454502,
-    12454530,
-    12454532,
-    12454533,
-    12454534,
-    12454545,
-    12454546,
-    12454548,
-    12454549,
-    12454550,
-    12454560,
-    12454561,
-    12454562,
-    12454564,
-    12454565,
-    12454566,
-    12455363,
-    12455367,
-    12455379,
-    12455395,
-    12455399,
-    12455619,
-    12455623,
-    12455635,
-    12455639,
-    12455651,
-    12455655,
-    12455940,
-    12455941,
-    12455942,
-    12455953,
-    12455954,
-    12455957,
-    12455958,
-    12455970,
-    12455974,
-    12456004,
-    12456006,
-    12456017,
-    12456018,
-    12456020,
-    12456022,
-    12456033,
-    12456034,
-    12456036,
-    12456038,
-    12456068,
-    12456069,
-    12456070,
-    12456081,
-    12456082,
-    12456084,
-    12456085,
-    12456086,
-    12456097,
-    12456098,
-    12456100,
-    12456101,
-    12456102,
-    12456273,
-    12456274,
-    12456290,
-    12456324,
-    12456325,
-    12456326,
-    12456337,
-    12456338,
-    12456353,
-    12456354,
-    12456356,
-    12456357,
-    12456358,
-    12456580,
-    12456581,
-    12456582,
-    12456593,
-    12456594,
-    12456597,
-    12456598,
-    12456610,
-    12456614,
-    12456965,
-    12456966,
-    12456977,
-    12456978,
-    12456980,
-    12456981,
-    12456982,
-    12456993,
-    12456994,
-    12456996,
-    12456997,
-    12456998,
-    12457093,
-    12457094,
-    12457105,
-    12457106,
-    12457108,
-    12457109,
-    12457110,
-    12457121,
-    12457122,
-    12457124,
-    12457125,
-    12457126,
-    12457221,
-    12457222,
-    12457233,
-    12457234,
-    12457249,
-    12457250,
-    12457252,
-    12457253,
-    12457254,
-    12457349,
-    12457350,
-    12457361,
-    12457362,
-    12457377,
-    12457378,
-    12457380,
-    12457381,
-    12457382,
-    12457477,
-    12457478,
-    12457489,
-    12457490,
-    12457493,
-    12457494,
-    12457505,
-    12457506,
-    12457508,
-    12457509,
-    12457510,
-    12457605,
-    12457606,
-    12457617,
-    12457618,
-    12457620,
-    12457621,
-    12457622,
-    12457633,
-    12457634,
-    12457636,
-    12457637,
-    12457638,
-    12457990,
-    12458001,
-    12458002,
-    12458005,
-    12458006,
-    12458017,
-    12458018,
-    12458020,
-    12458021,
-    12458022,
-    12458054,
-    12458065,
-    12458066,
-    12458070,
-    12458081,
-    12458082,
-    12458084,
-    12458086,
-    12458118,
-    12458129,
-    12458130,
-    12458133,
-    12458134,
-    12458145,
-    12458146,
-    12458148,
-    12458149,
-    12458150,
-    12458246,
-    12458257,
-    12458258,
-    12458273,
-    12458274,
-    12458277,
-    12458278,
-    12458321,
-    12458322,
-    12458337,
-    12458338,
-    12458374,
-    12458385,
-    12458386,
-    12458401,
-    12458402,
-    12458404,
-    12458405,
-    12458406,
-    12458502,
-    12458513,
-    12458514,
-    12458517,
-    12458518,
-    12458529,
-    12458530,
-    12458533,
-    12458534,
-    12458566,
-    12458577,
-    12458578,
-    12458582,
-    12458593,
-    12458594,
-    12458598,
-    12458630,
-    12458641,
-    12458642,
-    12458645,
-    12458646,
-    12458657,
-    12458658,
-    12458660,
-    12458661,
-    12458662,
-    12459207,
-    12459219,
-    12459223,
-    12459235,
-    12459239,
-    12459475,
-    12459491,
-    12459719,
-    12459731,
-    12459735,
-    12459747,
-    12459751,
-    12469265,
-    12469266,
-    12469269,
-    12469270,
-    12469282,
-    12469286,
-    12469329,
-    12469330,
-    12469334,
-    12469345,
-    12469346,
-    12469350,
-    12469393,
-    12469394,
-    12469397,
-    12469398,
-    12469409,
-    12469410,
-    12469413,
-    12469414,
-    12469585,
-    12469586,
-    12469602,
-    12469606,
-    12469649,
-    12469650,
-    12469665,
-    12469666,
-    12469669,
-    12469670,
-    12469905,
-    12469906,
-    12469909,
-    12469910,
-    12469922,
-    12469926,
-    12470290,
-    12470293,
-    12470294,
-    12470305,
-    12470306,
-    12470309,
-    12470310,
-    12470354,
-    12470358,
-    12470369,
-    12470370,
-    12470374,
-    12470418,
-    12470421,
-    12470422,
-    12470433,
-    12470434,
-    12470437,
-    12470438,
-    12470546,
-    12470562,
-    12470565,
-    12470566,
-    12470610,
-    12470625,
-    12470626,
-    12470630,
-    12470674,
-    12470689,
-    12470690,
-    12470693,
-    12470694,
-    12470802,
-    12470805,
-    12470806,
-    12470818,
-    12470821,
-    12470822,
-    12470866,
-    12470870,
-    12470882,
-    12470886,
-    12470930,
-    12470933,
-    12470934,
-    12470945,
-    12470946,
-    12470949,
-    12470950,
-    12471507,
-    12471511,
-    12471523,
-    12471527,
-    12471763,
-    12471779,
-    12471783,
-    12472019,
-    12472023,
-    12472035,
-    12472039,
-    12473365,
-    12473366,
-    12473378,
-    12473382,
-    12473493,
-    12473494,
-    12473506,
-    12473509,
-    12473510,
-    12474005,
-    12474006,
-    12474018,
-    12474022,
-    12474390,
-    12474402,
-    12474405,
-    12474406,
-    12474454,
-    12474466,
-    12474470,
-    12474518,
-    12474530,
-    12474533,
-    12474534,
-    12474902,
-    12474914,
-    12474918,
-    12474966,
-    12474978,
-    12474982,
-    12475030,
-    12475042,
-    12475045,
-    12475046,
-    12475607,
-    12475619,
-    12475623,
-    12476119,
-    12476131,
-    12476135,
-    12486694,
-    12486754,
-    12486758,
-    12486818,
-    12486822,
-    12487010,
-    12487014,
-    12487074,
-    12487078,
-    12487330,
-    12487334,
-    12487911,
-    12488163,
-    12488167,
-    12488419,
-    12488423,
-    12490790,
-    12490854,
-    12490918,
-    12491174,
-    12491430,
-    12492007,
-    12492519,
-    12517696,
-    12517697,
-    12517698,
-    12517700,
-    12517701,
-    12517702,
-    12517704,
-    12517705,
-    12517706,
-    12517713,
-    12517714,
-    12517717,
-    12517718,
-    12517721,
-    12517722,
-    12517730,
-    12517734,
-    12517738,
-    12517759,
-    12517760,
-    12517761,
-    12517762,
-    12517764,
-    12517765,
-    12517766,
-    12517768,
-    12517769,
-    12517770,
-    12517776,
-    12517777,
-    12517778,
-    12517780,
-    12517781,
-    12517782,
-    12517784,
-    12517785,
-    12517786,
-    12517792,
-    12517793,
-    12517794,
-    12517796,
-    12517797,
-    12517798,
-    12517800,
-    12517801,
-    12517802,
-    12517823,
-    12518016,
-    12518017,
-    12518018,
-    12518020,
-    12518021,
-    12518022,
-    12518024,
-    12518025,
-    12518026,
-    12518033,
-    12518034,
-    12518037,
-    12518038,
-    12518041,
-    12518042,
-    12518050,
-    12518054,
-    12518058,
-    12518079,
-    12518656,
-    12518657,
-    12518658,
-    12518660,
-    12518661,
-    12518662,
-    12518664,
-    12518665,
-    12518666,
-    12518672,
-    12518673,
-    12518674,
-    12518676,
-    12518677,
-    12518678,
-    12518680,
-    12518681,
-    12518682,
-    12518688,
-    12518689,
-    12518690,
-    12518692,
-    12518693,
-    12518694,
-    12518696,
-    12518697,
-    12518698,
-    12518719,
-    12518720,
-    12518721,
-    12518722,
-    12518724,
-    12518725,
-    12518726,
-    12518728,
-    12518729,
-    12518730,
-    12518736,
-    12518737,
-    12518738,
-    12518740,
-    12518741,
-    12518742,
-    12518744,
-    12518745,
-    12518746,
-    12518752,
-    12518753,
-    12518754,
-    12518756,
-    12518757,
-    12518758,
-    12518760,
-    12518761,
-    12518762,
-    12518783,
-    12518784,
-    12518785,
-    12518786,
-    12518788,
-    12518789,
-    12518790,
-    12518792,
-    12518793,
-    12518794,
-    12518800,
-    12518801,
-    12518802,
-    12518804,
-    12518805,
-    12518806,
-    12518808,
-    12518809,
-    12518810,
-    12518816,
-    12518817,
-    12518818,
-    12518820,
-    12518821,
-    12518822,
-    12518824,
-    12518825,
-    12518826,
-    12518847,
-    12518912,
-    12518913,
-    12518914,
-    12518916,
-    12518917,
-    12518918,
-    12518920,
-    12518921,
-    12518922,
-    12518928,
-    12518929,
-    12518930,
-    12518932,
-    12518933,
-    12518934,
-    12518936,
-    12518937,
-    12518938,
-    12518944,
-    12518945,
-    12518946,
-    12518948,
-    12518949,
-    12518950,
-    12518952,
-    12518953,
-    12518954,
-    12518975,
-    12518976,
-    12518977,
-    12518978,
-    12518980,
-    12518981,
-    12518982,
-    12518984,
-    12518985,
-    12518986,
-    12518992,
-    12518993,
-    12518994,
-    12518996,
-    12518997,
-    12518998,
-    12519000,
-    12519001,
-    12519002,
-    12519008,
-    12519009,
-    12519010,
-    12519012,
-    12519013,
-    12519014,
-    12519016,
-    12519017,
-    12519018,
-    12519039,
-    12519040,
-    12519041,
-    12519042,
-    12519044,
-    12519045,
-    12519046,
-    12519048,
-    12519049,
-    12519050,
-    12519056,
-    12519057,
-    12519058,
-    12519060,
-    12519061,
-    12519062,
-    12519064,
-    12519065,
-    12519066,
-    12519072,
-    12519073,
-    12519074,
-    12519076,
-    12519077,
-    12519078,
-    12519080,
-    12519081,
-    12519082,
-    12519103,
-    12519680,
-    12519681,
-    12519682,
-    12519684,
-    12519685,
-    12519686,
-    12519688,
-    12519689,
-    12519690,
-    12519696,
-    12519697,
-    12519698,
-    12519700,
-    12519701,
-    12519702,
-    12519704,
-    12519705,
-    12519706,
-    12519712,
-    12519713,
-    12519714,
-    12519716,
-    12519717,
-    12519718,
-    12519720,
-    12519721,
-    12519722,
-    12519743,
-    12519744,
-    12519745,
-    12519746,
-    12519748,
-    12519749,
-    12519750,
-    12519752,
-    12519753,
-    12519754,
-    12519760,
-    12519761,
-    12519762,
-    12519764,
-    12519765,
-    12519766,
-    12519768,
-    12519769,
-    12519770,
-    12519776,
-    12519777,
-    12519778,
-    12519780,
-    12519781,
-    12519782,
-    12519784,
-    12519785,
-    12519786,
-    12519807,
-    12519808,
-    12519809,
-    12519810,
-    12519812,
-    12519813,
-    12519814,
-    12519816,
-    12519817,
-    12519818,
-    12519824,
-    12519825,
-    12519826,
-    12519828,
-    12519829,
-    12519830,
-    12519832,
-    12519833,
-    12519834,
-    12519840,
-    12519841,
-    12519842,
-    12519844,
-    12519845,
-    12519846,
-    12519848,
-    12519849,
-    12519850,
-    12519871,
-    12519936,
-    12519937,
-    12519938,
-    12519940,
-    12519941,
-    12519942,
-    12519944,
-    12519945,
-    12519946,
-    12519952,
-    12519953,
-    12519954,
-    12519956,
-    12519957,
-    12519958,
-    12519960,
-    12519961,
-    12519962,
-    12519968,
-    12519969,
-    12519970,
-    12519972,
-    12519973,
-    12519974,
-    12519976,
-    12519977,
-    12519978,
-    12519999,
-    12520000,
-    12520001,
-    12520002,
-    12520004,
-    12520005,
-    12520006,
-    12520008,
-    12520009,
-    12520010,
-    12520016,
-    12520017,
-    12520018,
-    12520020,
-    12520021,
-    12520022,
-    12520024,
-    12520025,
-    12520026,
-    12520032,
-    12520033,
-    12520034,
-    12520036,
-    12520037,
-    12520038,
-    12520040,
-    12520041,
-    12520042,
-    12520063,
-    12520064,
-    12520065,
-    12520066,
-    12520068,
-    12520069,
-    12520070,
-    12520072,
-    12520073,
-    12520074,
-    12520080,
-    12520081,
-    12520082,
-    12520084,
-    12520085,
-    12520086,
-    12520088,
-    12520089,
-    12520090,
-    12520096,
-    12520097,
-    12520098,
-    12520100,
-    12520101,
-    12520102,
-    12520104,
-    12520105,
-    12520106,
-    12520127,
-    12520899,
-    12520903,
-    12520907,
-    12520915,
-    12520919,
-    12520923,
-    12520931,
-    12520935,
-    12520939,
-    12520959,
-    12521155,
-    12521159,
-    12521163,
-    12521171,
-    12521175,
-    12521179,
-    12521187,
-    12521191,
-    12521195,
-    12521215,
-    12521472,
-    12521473,
-    12521474,
-    12521476,
-    12521477,
-    12521478,
-    12521480,
-    12521481,
-    12521482,
-    12521489,
-    12521490,
-    12521493,
-    12521494,
-    12521497,
-    12521498,
-    12521506,
-    12521510,
-    12521514,
-    12521535,
-    12521536,
-    12521537,
-    12521538,
-    12521540,
-    12521541,
-    12521542,
-    12521544,
-    12521545,
-    12521546,
-    12521552,
-    12521553,
-    12521554,
-    12521556,
-    12521557,
-    12521558,
-    12521560,
-    12521561,
-    12521562,
-    12521568,
-    12521569,
-    12521570,
-    12521572,
-    12521573,
-    12521574,
-    12521576,
-    12521577,
-    12521578,
-    12521599,
-    12521600,
-    12521601,
-    12521602,
-    12521604,
-    12521605,
-    12521606,
-    12521608,
-    12521609,
-    12521610,
-    12521616,
-    12521617,
-    12521618,
-    12521620,
-    12521621,
-    12521622,
-    12521624,
-    12521625,
-    12521626,
-    12521632,
-    12521633,
-    12521634,
-    12521636,
-    12521637,
-    12521638,
-    12521640,
-    12521641,
-    12521642,
-    12521663,
-    12521792,
-    12521793,
-    12521794,
-    12521800,
-    12521801,
-    12521802,
-    12521809,
-    12521810,
-    12521817,
-    12521818,
-    12521826,
-    12521834,
-    12521856,
-    12521857,
-    12521858,
-    12521860,
-    12521861,
-    12521862,
-    12521864,
-    12521865,
-    12521866,
-    12521872,
-    12521873,
-    12521874,
-    12521876,
-    12521877,
-    12521878,
-    12521880,
-    12521881,
-    12521882,
-    12521888,
-    12521889,
-    12521890,
-    12521892,
-    12521893,
-    12521894,
-    12521896,
-    12521897,
-    12521898,
-    12521919,
-    12522112,
-    12522113,
-    12522114,
-    12522116,
-    12522117,
-    12522118,
-    12522120,
-    12522121,
-    12522122,
-    12522129,
-    12522130,
-    12522133,
-    12522134,
-    12522137,
-    12522138,
-    12522146,
-    12522150,
-    12522154,
-    12522175,
-    12522496,
-    12522497,
-    12522498,
-    12522500,
-    12522501,
-    12522502,
-    12522504,
-    12522505,
-    12522506,
-    12522512,
-    12522513,
-    12522514,
-    12522516,
-    12522517,
-    12522518,
-    12522520,
-    12522521,
-    12522522,
-    12522528,
-    12522529,
-    12522530,
-    12522532,
-    12522533,
-    12522534,
-    12522536,
-    12522537,
-    12522538,
-    12522559,
-    12522624,
-    12522625,
-    12522626,
-    12522628,
-    12522629,
-    12522630,
-    12522632,
-    12522633,
-    12522634,
-    12522640,
-    12522641,
-    12522642,
-    12522644,
-    12522645,
-    12522646,
-    12522648,
-    12522649,
-    12522650,
-    12522656,
-    12522657,
-    12522658,
-    12522660,
-    12522661,
-    12522662,
-    12522664,
-    12522665,
-    12522666,
-    12522687,
-    12522752,
-    12522753,
-    12522754,
-    12522756,
-    12522757,
-    12522758,
-    12522760,
-    12522761,
-    12522762,
-    12522768,
-    12522769,
-    12522770,
-    12522772,
-    12522773,
-    12522774,
-    12522776,
-    12522777,
-    12522778,
-    12522784,
-    12522785,
-    12522786,
-    12522788,
-    12522789,
-    12522790,
-    12522792,
-    12522793,
-    12522794,
-    12522815,
-    12522880,
-    12522881,
-    12522882,
-    12522884,
-    12522885,
-    12522886,
-    12522888,
-    12522889,
-    12522890,
-    12522896,
-    12522897,
-    12522898,
-    12522900,
-    12522901,
-    12522902,
-    12522904,
-    12522905,
-    12522906,
-    12522912,
-    12522913,
-    12522914,
-    12522916,
-    12522917,
-    12522918,
-    12522920,
-    12522921,
-    12522922,
-    12522943,
-    12523008,
-    12523009,
-    12523010,
-    12523012,
-    12523013,
-    12523014,
-    12523016,
-    12523017,
-    12523018,
-    12523024,
-    12523025,
-    12523026,
-    12523028,
-    12523029,
-    12523030,
-    12523032,
-    12523033,
-    12523034,
-    12523040,
-    12523041,
-    12523042,
-    12523044,
-    12523045,
-    12523046,
-    12523048,
-    12523049,
-    12523050,
-    12523071,
-    12523136,
-    12523137,
-    12523138,
-    12523140,
-    12523141,
-    12523142,
-    12523144,
-    12523145,
-    12523146,
-    12523152,
-    12523153,
-    12523154,
-    12523156,
-    12523157,
-    12523158,
-    12523160,
-    12523161,
-    12523162,
-    12523168,
-    12523169,
-    12523170,
-    12523172,
-    12523173,
-    12523174,
-    12523176,
-    12523177,
-    12523178,
-    12523199,
-    12523520,
-    12523521,
-    12523522,
-    12523524,
-    12523525,
-    12523526,
-    12523528,
-    12523529,
-    12523530,
-    12523536,
-    12523537,
-    12523538,
-    12523540,
-    12523541,
-    12523542,
-    12523544,
-    12523545,
-    12523546,
-    12523552,
-    12523553,
-    12523554,
-    12523556,
-    12523557,
-    12523558,
-    12523560,
-    12523561,
-    12523562,
-    12523583,
-    12523584,
-    12523585,
-    12523586,
-    12523588,
-    12523589,
-    12523590,
-    12523592,
-    12523593,
-    12523594,
-    12523600,
-    12523601,
-    12523602,
-    12523604,
-    12523605,
-    12523606,
-    12523608,
-    12523609,
-    12523610,
-    12523616,
-    12523617,
-    12523618,
-    12523620,
-    12523621,
-    12523622,
-    12523624,
-    12523625,
-    12523626,
-    12523647,
-    12523648,
-    12523649,
-    12523650,
-    12523652,
-    12523653,
-    12523654,
-    12523656,
-    12523657,
-    12523658,
-    12523664,
-    12523665,
-    12523666,
-    12523668,
-    12523669,
-    12523670,
-    12523672,
-    12523673,
-    12523674,
-    12523680,
-    12523681,
-    12523682,
-    12523684,
-    12523685,
-    12523686,
-    12523688,
-    12523689,
-    12523690,
-    12523711,
-    12523776,
-    12523777,
-    12523778,
-    12523780,
-    12523781,
-    12523782,
-    12523784,
-    12523785,
-    12523786,
-    12523792,
-    12523793,
-    12523794,
-    12523796,
-    12523797,
-    12523798,
-    12523800,
-    12523801,
-    12523802,
-    12523808,
-    12523809,
-    12523810,
-    12523812,
-    12523813,
-    12523814,
-    12523816,
-    12523817,
-    12523818,
-    12523839,
-    12523840,
-    12523841,
-    12523842,
-    12523848,
-    12523849,
-    12523850,
-    12523856,
-    12523857,
-    12523858,
-    12523864,
-    12523865,
-    12523866,
-    12523872,
-    12523873,
-    12523874,
-    12523880,
-    12523881,
-    12523882,
-    12523904,
-    12523905,
-    12523906,
-    12523908,
-    12523909,
-    12523910,
-    12523912,
-    12523913,
-    12523914,
-    12523920,
-    12523921,
-    12523922,
-    12523924,
-    12523925,
-    12523926,
-    12523928,
-    12523929,
-    12523930,
-    12523936,
-    12523937,
-    12523938,
-    12523940,
-    12523941,
-    12523942,
-    12523944,
-    12523945,
-    12523946,
-    12523967,
-    12524032,
-    12524033,
-    12524034,
-    12524036,
-    12524037,
-    12524038,
-    12524040,
-    12524041,
-    12524042,
-    12524048,
-    12524049,
-    12524050,
-    12524052,
-    12524053,
-    12524054,
-    12524056,
-    12524057,
-    12524058,
-    12524064,
-    12524065,
-    12524066,
-    12524068,
-    12524069,
-    12524070,
-    12524072,
-    12524073,
-    12524074,
-    12524095,
-    12524096,
-    12524097,
-    12524098,
-    12524100,
-    12524101,
-    12524102,
-    12524104,
-    12524105,
-    12524106,
-    12524112,
-    12524113,
-    12524114,
-    12524116,
-    12524117,
-    12524118,
-    12524120,
-    12524121,
-    12524122,
-    12524128,
-    12524129,
-    12524130,
-    12524132,
-    12524133,
-    12524134,
-    12524136,
-    12524137,
-    12524138,
-    12524159,
-    12524160,
-    12524161,
-    12524162,
-    12524164,
-    12524165,
-    12524166,
-    12524168,
-    12524169,
-    12524170,
-    12524176,
-    12524177,
-    12524178,
-    12524180,
-    12524181,
-    12524182,
-    12524184,
-    12524185,
-    12524186,
-    12524192,
-    12524193,
-    12524194,
-    12524196,
-    12524197,
-    12524198,
-    12524200,
-    12524201,
-    12524202,
-    12524223,
-    12524739,
-    12524743,
-    12524747,
-    12524755,
-    12524759,
-    12524763,
-    12524771,
-    12524775,
-    12524779,
-    12524799,
-    12524995,
-    12525003,
-    12525011,
-    12525019,
-    12525027,
-    12525035,
-    12525251,
-    12525255,
-    12525259,
-    12525267,
-    12525271,
-    12525275,
-    12525283,
-    12525287,
-    12525291,
-    12525311,
-    12534784,
-    12534785,
-    12534786,
-    12534788,
-    12534789,
-    12534790,
-    12534792,
-    12534793,
-    12534794,
-    12534801,
-    12534802,
-    12534805,
-    12534806,
-    12534809,
-    12534810,
-    12534818,
-    12534822,
-    12534826,
-    12534847,
-    12534848,
-    12534849,
-    12534850,
-    12534852,
-    12534853,
-    12534854,
-    12534856,
-    12534857,
-    12534858,
-    12534864,
-    12534865,
-    12534866,
-    12534868,
-    12534869,
-    12534870,
-    12534872,
-    12534873,
-    12534874,
-    12534880,
-    12534881,
-    12534882,
-    12534884,
-    12534885,
-    12534886,
-    12534888,
-    12534889,
-    12534890,
-    12534911,
-    12534912,
-    12534913,
-    12534914,
-    12534916,
-    12534917,
-    12534918,
-    12534920,
-    12534921,
-    12534922,
-    12534928,
-    12534929,
-    12534930,
-    12534932,
-    12534933,
-    12534934,
-    12534936,
-    12534937,
-    12534938,
-    12534944,
-    12534945,
-    12534946,
-    12534948,
-    12534949,
-    12534950,
-    12534952,
-    12534953,
-    12534954,
-    12534975,
-    12535104,
-    12535105,
-    12535106,
-    12535108,
-    12535109,
-    12535110,
-    12535112,
-    12535113,
-    12535114,
-    12535121,
-    12535122,
-    12535125,
-    12535126,
-    12535129,
-    12535130,
-    12535138,
-    12535142,
-    12535146,
-    12535167,
-    12535168,
-    12535169,
-    12535170,
-    12535172,
-    12535173,
-    12535174,
-    12535176,
-    12535177,
-    12535178,
-    12535184,
-    12535185,
-    12535186,
-    12535188,
-    12535189,
-    12535190,
-    12535192,
-    12535193,
-    12535194,
-    12535200,
-    12535201,
-    12535202,
-    12535204,
-    12535205,
-    12535206,
-    12535208,
-    12535209,
-    12535210,
-    12535231,
-    12535424,
-    12535425,
-    12535426,
-    12535428,
-    12535429,
-    12535430,
-    12535432,
-    12535433,
-    12535434,
-    12535441,
-    12535442,
-    12535445,
-    12535446,
-    12535449,
-    12535450,
-    12535458,
-    12535462,
-    12535466,
-    12535487,
-    12535808,
-    12535809,
-    12535810,
-    12535812,
-    12535813,
-    12535814,
-    12535816,
-    12535817,
-    12535818,
-    12535824,
-    12535825,
-    12535826,
-    12535828,
-    12535829,
-    12535830,
-    12535832,
-    12535833,
-    12535834,
-    12535840,
-    12535841,
-    12535842,
-    12535844,
-    12535845,
-    12535846,
-    12535848,
-    12535849,
-    12535850,
-    12535871,
-    12535872,
-    12535873,
-    12535874,
-    12535876,
-    12535877,
-    12535878,
-    12535880,
-    12535881,
-    12535882,
-    12535888,
-    12535889,
-    12535890,
-    12535892,
-    12535893,
-    12535894,
-    12535896,
-    12535897,
-    12535898,
-    12535904,
-    12535905,
-    12535906,
-    12535908,
-    12535909,
-    12535910,
-    12535912,
-    12535913,
-    12535914,
-    12535935,
-    12535936,
-    12535937,
-    12535938,
-    12535940,
-    12535941,
-    12535942,
-    12535944,
-    12535945,
-    12535946,
-    12535952,
-    12535953,
-    12535954,
-    12535956,
-    12535957,
-    12535958,
-    12535960,
-    12535961,
-    12535962,
-    12535968,
-    12535969,
-    12535970,
-    12535972,
-    12535973,
-    12535974,
-    12535976,
-    12535977,
-    12535978,
-    12535999,
-    12536064,
-    12536065,
-    12536066,
-    12536068,
-    12536069,
-    12536070,
-    12536072,
-    12536073,
-    12536074,
-    12536080,
-    12536081,
-    12536082,
-    12536084,
-    12536085,
-    12536086,
-    12536088,
-    12536089,
-    12536090,
-    12536096,
-    12536097,
-    12536098,
-    12536100,
-    12536101,
-    12536102,
-    12536104,
-    12536105,
-    12536106,
-    12536127,
-    12536128,
-    12536129,
-    12536130,
-    12536132,
-    12536133,
-    12536134,
-    12536136,
-    12536137,
-    12536138,
-    12536144,
-    12536145,
-    12536146,
-    12536148,
-    12536149,
-    12536150,
-    12536152,
-    12536153,
-    12536154,
-    12536160,
-    12536161,
-    12536162,
-    12536164,
-    12536165,
-    12536166,
-    12536168,
-    12536169,
-    12536170,
-    12536191,
-    12536192,
-    12536193,
-    12536194,
-    12536196,
-    12536197,
-    12536198,
-    12536200,
-    12536201,
-    12536202,
-    12536208,
-    12536209,
-    12536210,
-    12536212,
-    12536213,
-    12536214,
-    12536216,
-    12536217,
-    12536218,
-    12536224,
-    12536225,
-    12536226,
-    12536228,
-    12536229,
-    12536230,
-    12536232,
-    12536233,
-    12536234,
-    12536255,
-    12536320,
-    12536321,
-    12536322,
-    12536324,
-    12536325,
-    12536326,
-    12536328,
-    12536329,
-    12536330,
-    12536336,
-    12536337,
-    12536338,
-    12536340,
-    12536341,
-    12536342,
-    12536344,
-    12536345,
-    12536346,
-    12536352,
-    12536353,
-    12536354,
-    12536356,
-    12536357,
-    12536358,
-    12536360,
-    12536361,
-    12536362,
-    12536383,
-    12536384,
-    12536385,
-    12536386,
-    12536388,
-    12536389,
-    12536390,
-    12536392,
-    12536393,
-    12536394,
-    12536400,
-    12536401,
-    12536402,
-    12536404,
-    12536405,
-    12536406,
-    12536408,
-    12536409,
-    12536410,
-    12536416,
-    12536417,
-    12536418,
-    12536420,
-    12536421,
-    12536422,
-    12536424,
-    12536425,
-    12536426,
-    12536447,
-    12536448,
-    12536449,
-    12536450,
-    12536452,
-    12536453,
-    12536454,
-    12536456,
-    12536457,
-    12536458,
-    12536464,
-    12536465,
-    12536466,
-    12536468,
-    12536469,
-    12536470,
-    12536472,
-    12536473,
-    12536474,
-    12536480,
-    12536481,
-    12536482,
-    12536484,
-    12536485,
-    12536486,
-    12536488,
-    12536489,
-    12536490,
-    12536511,
-    12537027,
-    12537031,
-    12537035,
-    12537043,
-    12537047,
-    12537051,
-    12537059,
-    12537063,
-    12537067,
-    12537087,
-    12537283,
-    12537287,
-    12537291,
-    12537299,
-    12537303,
-    12537307,
-    12537315,
-    12537319,
-    12537323,
-    12537343,
-    12537539,
-    12537543,
-    12537547,
-    12537555,
-    12537559,
-    12537563,
-    12537571,
-    12537575,
-    12537579,
-    12537599,
-    12538880,
-    12538881,
-    12538882,
-    12538884,
-    12538885,
-    12538886,
-    12538888,
-    12538889,
-    12538890,
-    12538897,
-    12538898,
-    12538901,
-    12538902,
-    12538905,
-    12538906,
-    12538914,
-    12538918,
-    12538922,
-    12538943,
-    12539008,
-    12539009,
-    12539010,
-    12539012,
-    12539013,
-    12539014,
-    12539016,
-    12539017,
-    12539018,
-    12539024,
-    12539025,
-    12539026,
-    12539028,
-    12539029,
-    12539030,
-    12539032,
-    12539033,
-    12539034,
-    12539040,
-    12539041,
-    12539042,
-    12539044,
-    12539045,
-    12539046,
-    12539048,
-    12539049,
-    12539050,
-    12539071,
-    12539520,
-    12539521,
-    12539522,
-    12539524,
-    12539525,
-    12539526,
-    12539528,
-    12539529,
-    12539530,
-    12539537,
-    12539538,
-    12539541,
-    12539542,
-    12539545,
-    12539546,
-    12539554,
-    12539558,
-    12539562,
-    12539583,
-    12539904,
-    12539905,
-    12539906,
-    12539908,
-    12539909,
-    12539910,
-    12539912,
-    12539913,
-    12539914,
-    12539920,
-    12539921,
-    12539922,
-    12539924,
-    12539925,
-    12539926,
-    12539928,
-    12539929,
-    12539930,
-    12539936,
-    12539937,
-    12539938,
-    12539940,
-    12539941,
-    12539942,
-    12539944,
-    12539945,
-    12539946,
-    12539967,
-    12539968,
-    12539969,
-    12539970,
-    12539972,
-    12539973,
-    12539974,
-    12539976,
-    12539977,
-    12539978,
-    12539984,
-    12539985,
-    12539986,
-    12539988,
-    12539989,
-    12539990,
-    12539992,
-    12539993,
-    12539994,
-    12540000,
-    12540001,
-    12540002,
-    12540004,
-    12540005,
-    12540006,
-    12540008,
-    12540009,
-    12540010,
-    12540031,
-    12540032,
-    12540033,
-    12540034,
-    12540036,
-    12540037,
-    12540038,
-    12540040,
-    12540041,
-    12540042,
-    12540048,
-    12540049,
-    12540050,
-    12540052,
-    12540053,
-    12540054,
-    12540056,
-    12540057,
-    12540058,
-    12540064,
-    12540065,
-    12540066,
-    12540068,
-    12540069,
-    12540070,
-    12540072,
-    12540073,
-    12540074,
-    12540095,
-    12540416,
-    12540417,
-    12540418,
-    12540420,
-    12540421,
-    12540422,
-    12540424,
-    12540425,
-    12540426,
-    12540432,
-    12540433,
-    12540434,
-    12540436,
-    12540437,
-    12540438,
-    12540440,
-    12540441,
-    12540442,
-    12540448,
-    12540449,
-    12540450,
-    12540452,
-    12540453,
-    12540454,
-    12540456,
-    12540457,
-    12540458,
-    12540479,
-    12540480,
-    12540481,
-    12540482,
-    12540484,
-    12540485,
-    12540486,
-    12540488,
-    12540489,
-    12540490,
-    12540496,
-    12540497,
-    12540498,
-    12540500,
-    12540501,
-    12540502,
-    12540504,
-    12540505,
-    12540506,
-    12540512,
-    12540513,
-    12540514,
-    12540516,
-    12540517,
-    12540518,
-    12540520,
-    12540521,
-    12540522,
-    12540543,
-    12540544,
-    12540545,
-    12540546,
-    12540548,
-    12540549,
-    12540550,
-    12540552,
-    12540553,
-    12540554,
-    12540560,
-    12540561,
-    12540562,
-    12540564,
-    12540565,
-    12540566,
-    12540568,
-    12540569,
-    12540570,
-    12540576,
-    12540577,
-    12540578,
-    12540580,
-    12540581,
-    12540582,
-    12540584,
-    12540585,
-    12540586,
-    12540607,
-    12541123,
-    12541127,
-    12541131,
-    12541139,
-    12541143,
-    12541147,
-    12541155,
-    12541159,
-    12541163,
-    12541183,
-    12541635,
-    12541639,
-    12541643,
-    12541651,
-    12541655,
-    12541659,
-    12541667,
-    12541671,
-    12541675,
-    12541695,
-    12552193,
-    12552196,
-    12552197,
-    12552198,
-    12552200,
-    12552201,
-    12552202,
-    12552209,
-    12552210,
-    12552213,
-    12552214,
-    12552217,
-    12552218,
-    12552230,
-    12552234,
-    12552256,
-    12552257,
-    12552258,
-    12552260,
-    12552261,
-    12552262,
-    12552264,
-    12552265,
-    12552266,
-    12552272,
-    12552273,
-    12552274,
-    12552276,
-    12552277,
-    12552278,
-    12552280,
-    12552281,
-    12552282,
-    12552288,
-    12552289,
-    12552290,
-    12552292,
-    12552293,
-    12552294,
-    12552296,
-    12552297,
-    12552298,
-    12552319,
-    12552320,
-    12552321,
-    12552322,
-    12552324,
-    12552325,
-    12552326,
-    12552328,
-    12552329,
-    12552330,
-    12552336,
-    12552337,
-    12552338,
-    12552340,
-    12552341,
-    12552342,
-    12552344,
-    12552345,
-    12552346,
-    12552352,
-    12552353,
-    12552354,
-    12552356,
-    12552357,
-    12552358,
-    12552360,
-    12552361,
-    12552362,
-    12552383,
-    12552512,
-    12552513,
-    12552514,
-    12552516,
-    12552517,
-    12552518,
-    12552520,
-    12552521,
-    12552522,
-    12552529,
-    12552530,
-    12552533,
-    12552534,
-    12552537,
-    12552538,
-    12552546,
-    12552550,
-    12552554,
-    12552575,
-    12552576,
-    12552577,
-    12552578,
-    12552580,
-    12552581,
-    12552582,
-    12552584,
-    12552585,
-    12552586,
-    12552592,
-    12552593,
-    12552594,
-    12552596,
-    12552597,
-    12552598,
-    12552600,
-    12552601,
-    12552602,
-    12552608,
-    12552609,
-    12552610,
-    12552612,
-    12552613,
-    12552614,
-    12552616,
-    12552617,
-    12552618,
-    12552639,
-    12552832,
-    12552833,
-    12552834,
-    12552836,
-    12552837,
-    12552838,
-    12552840,
-    12552841,
-    12552842,
-    12552849,
-    12552850,
-    12552853,
-    12552854,
-    12552857,
-    12552858,
-    12552866,
-    12552870,
-    12552874,
-    12552895,
-    12553415,
-    12553419,
-    12553427,
-    12553431,
-    12553435,
-    12553447,
-    12553451,
-    12553667,
-    12553671,
-    12553675,
-    12553683,
-    12553687,
-    12553691,
-    12553699,
-    12553703,
-    12553707,
-    12553727,
-    12553923,
-    12553927,
-    12553931,
-    12553939,
-    12553943,
-    12553947,
-    12553955,
-    12553959,
-    12553963,
-    12553983,
-    12556288,
-    12556289,
-    12556290,
-    12556292,
-    12556293,
-    12556294,
-    12556296,
-    12556297,
-    12556298,
-    12556305,
-    12556306,
-    12556309,
-    12556310,
-    12556313,
-    12556314,
-    12556322,
-    12556326,
-    12556330,
-    12556351,
-    12556352,
-    12556353,
-    12556354,
-    12556356,
-    12556357,
-    12556358,
-    12556360,
-    12556361,
-    12556362,
-    12556368,
-    12556369,
-    12556370,
-    12556372,
-    12556373,
-    12556374,
-    12556376,
-    12556377,
-    12556378,
-    12556384,
-    12556385,
-    12556386,
-    12556388,
-    12556389,
-    12556390,
-    12556392,
-    12556393,
-    12556394,
-    12556415,
-    12556416,
-    12556417,
-    12556418,
-    12556420,
-    12556421,
-    12556422,
-    12556424,
-    12556425,
-    12556426,
-    12556432,
-    12556433,
-    12556434,
-    12556436,
-    12556437,
-    12556438,
-    12556440,
-    12556441,
-    12556442,
-    12556448,
-    12556449,
-    12556450,
-    12556452,
-    12556453,
-    12556454,
-    12556456,
-    12556457,
-    12556458,
-    12556479,
-    12556608,
-    12556609,
-    12556610,
-    12556616,
-    12556617,
-    12556618,
-    12556625,
-    12556626,
-    12556633,
-    12556634,
-    12556642,
-    12556650,
-    12556672,
-    12556673,
-    12556674,
-    12556676,
-    12556677,
-    12556678,
-    12556680,
-    12556681,
-    12556682,
-    12556688,
-    12556689,
-    12556690,
-    12556692,
-    12556693,
-    12556694,
-    12556696,
-    12556697,
-    12556698,
-    12556704,
-    12556705,
-    12556706,
-    12556708,
-    12556709,
-    12556710,
-    12556712,
-    12556713,
-    12556714,
-    12556735,
-    12556928,
-    12556929,
-    12556930,
-    12556932,
-    12556933,
-    12556934,
-    12556936,
-    12556937,
-    12556938,
-    12556945,
-    12556946,
-    12556949,
-    12556950,
-    12556953,
-    12556954,
-    12556962,
-    12556966,
-    12556970,
-    12556991,
-    12557507,
-    12557511,
-    12557515,
-    12557523,
-    12557527,
-    12557531,
-    12557539,
-    12557543,
-    12557547,
-    12557567,
-    12557763,
-    12557771,
-    12557779,
-    12557787,
-    12557795,
-    12557803,
-    12558019,
-    12558023,
-    12558027,
-    12558035,
-    12558039,
-    12558043,
-    12558051,
-    12558055,
-    12558059,
-    12558079,
-    16711681,
-    16711684,
-    16711685,
-    16711686,
-    16711688,
-    16711689,
-    16711690,
-    16711697,
-    16711698,
-    16711701,
-    16711702,
-    16711705,
-    16711706,
-    16711718,
-    16711722,
-    16711748,
-    16711749,
-    16711750,
-    16711752,
-    16711753,
-    16711754,
-    16711760,
-    16711761,
-    16711762,
-    16711764,
-    16711765,
-    16711766,
-    16711768,
-    16711769,
-    16711770,
-    16711776,
-    16711777,
-    16711778,
-    16711780,
-    16711781,
-    16711782,
-    16711784,
-    16711785,
-    16711786,
-    16711807,
-    16711816,
-    16711817,
-    16711818,
-    16711824,
-    16711825,
-    16711826,
-    16711828,
-    16711829,
-    16711830,
-    16711832,
-    16711833,
-    16711834,
-    16711840,
-    16711841,
-    16711842,
-    16711844,
-    16711845,
-    16711846,
-    16711848,
-    16711849,
-    16711850,
-    16711871,
-    16712000,
-    16712001,
-    16712002,
-    16712004,
-    16712005,
-    16712006,
-    16712008,
-    16712009,
-    16712010,
-    16712017,
-    16712018,
-    16712021,
-    16712022,
-    16712025,
-    16712026,
-    16712034,
-    16712038,
-    16712042,
-    16712063,
-    16712064,
-    16712065,
-    16712066,
-    16712068,
-    16712069,
-    16712070,
-    16712072,
-    16712073,
-    16712074,
-    16712080,
-    16712081,
-    16712082,
-    16712084,
-    16712085,
-    16712086,
-    16712088,
-    16712089,
-    16712090,
-    16712096,
-    16712097,
-    16712098,
-    16712100,
-    16712101,
-    16712102,
-    16712104,
-    16712105,
-    16712106,
-    16712127,
-    16712320,
-    16712321,
-    16712322,
-    16712324,
-    16712325,
-    16712326,
-    16712328,
-    16712329,
-    16712330,
-    16712337,
-    16712338,
-    16712341,
-    16712342,
-    16712345,
-    16712346,
-    16712354,
-    16712358,
-    16712362,
-    16712383,
-    16712720,
-    16712721,
-    16712722,
-    16712724,
-    16712725,
-    16712726,
-    16712728,
-    16712729,
-    16712730,
-    16712736,
-    16712737,
-    16712738,
-    16712740,
-    16712741,
-    16712742,
-    16712744,
-    16712745,
-    16712746,
-    16712767,
-    16712788,
-    16712789,
-    16712790,
-    16712792,
-    16712793,
-    16712794,
-    16712800,
-    16712801,
-    16712802,
-    16712804,
-    16712805,
-    16712806,
-    16712808,
-    16712809,
-    16712810,
-    16712831,
-    16712856,
-    16712857,
-    16712858,
-    16712864,
-    16712865,
-    16712866,
-    16712868,
-    16712869,
-    16712870,
-    16712872,
-    16712873,
-    16712874,
-    16712895,
-    16712961,
-    16712962,
-    16712964,
-    16712965,
-    16712966,
-    16712968,
-    16712969,
-    16712970,
-    16712977,
-    16712978,
-    16712980,
-    16712981,
-    16712982,
-    16712984,
-    16712985,
-    16712986,
-    16712993,
-    16712994,
-    16712996,
-    16712997,
-    16712998,
-    16713000,
-    16713001,
-    16713002,
-    16713023,
-    16713025,
-    16713026,
-    16713028,
-    16713029,
-    16713030,
-    16713032,
-    16713033,
-    16713034,
-    16713040,
-    16713041,
-    16713042,
-    16713044,
-    16713045,
-    16713046,
-    16713048,
-    16713049,
-    16713050,
-    16713056,
-    16713057,
-    16713058,
-    16713060,
-    16713061,
-    16713062,
-    16713064,
-    16713065,
-    16713066,
-    16713087,
-    16713089,
-    16713090,
-    16713092,
-    16713093,
-    16713094,
-    16713096,
-    16713097,
-    16713098,
-    16713104,
-    16713105,
-    16713106,
-    16713108,
-    16713109,
-    16713110,
-    16713112,
-    16713113,
-    16713114,
-    16713120,
-    16713121,
-    16713122,
-    16713124,
-    16713125,
-    16713126,
-    16713128,
-    16713129,
-    16713130,
-    16713151,
-    16713217,
-    16713218,
-    16713221,
-    16713222,
-    16713224,
-    16713225,
-    16713226,
-    16713233,
-    16713234,
-    16713237,
-    16713238,
-    16713240,
-    16713241,
-    16713242,
-    16713249,
-    16713250,
-    16713253,
-    16713254,
-    16713256,
-    16713257,
-    16713258,
-    16713279,
-    16713281,
-    16713282,
-    16713284,
-    16713285,
-    16713286,
-    16713288,
-    16713289,
-    16713290,
-    16713297,
-    16713298,
-    16713300,
-    16713301,
-    16713302,
-    16713304,
-    16713305,
-    16713306,
-    16713312,
-    16713313,
-    16713314,
-    16713316,
-    16713317,
-    16713318,
-    16713320,
-    16713321,
-    16713322,
-    16713343,
-    16713345,
-    16713346,
-    16713348,
-    16713349,
-    16713350,
-    16713352,
-    16713353,
-    16713354,
-    16713360,
-    16713361,
-    16713362,
-    16713364,
-    16713365,
-    16713366,
-    16713368,
-    16713369,
-    16713370,
-    16713376,
-    16713377,
-    16713378,
-    16713380,
-    16713381,
-    16713382,
-    16713384,
-    16713385,
-    16713386,
-    16713407,
-    16713761,
-    16713764,
-    16713765,
-    16713766,
-    16713768,
-    16713769,
-    16713770,
-    16713828,
-    16713829,
-    16713830,
-    16713832,
-    16713833,
-    16713834,
-    16713855,
-    16713896,
-    16713897,
-    16713898,
-    16713919,
-    16713986,
-    16713988,
-    16713989,
-    16713990,
-    16713992,
-    16713993,
-    16713994,
-    16714001,
-    16714002,
-    16714004,
-    16714005,
-    16714006,
-    16714008,
-    16714009,
-    16714010,
-    16714017,
-    16714018,
-    16714020,
-    16714021,
-    16714022,
-    16714024,
-    16714025,
-    16714026,
-    16714047,
-    16714050,
-    16714052,
-    16714053,
-    16714054,
-    16714056,
-    16714057,
-    16714058,
-    16714065,
-    16714066,
-    16714068,
-    16714069,
-    16714070,
-    16714072,
-    16714073,
-    16714074,
-    16714080,
-    16714081,
-    16714082,
-    16714084,
-    16714085,
-    16714086,
-    16714088,
-    16714089,
-    16714090,
-    16714111,
-    16714114,
-    16714116,
-    16714117,
-    16714118,
-    16714120,
-    16714121,
-    16714122,
-    16714129,
-    16714130,
-    16714132,
-    16714133,
-    16714134,
-    16714136,
-    16714137,
-    16714138,
-    16714144,
-    16714145,
-    16714146,
-    16714148,
-    16714149,
-    16714150,
-    16714152,
-    16714153,
-    16714154,
-    16714175,
-    16714242,
-    16714245,
-    16714246,
-    16714248,
-    16714249,
-    16714250,
-    16714257,
-    16714258,
-    16714261,
-    16714262,
-    16714264,
-    16714265,
-    16714266,
-    16714273,
-    16714274,
-    16714277,
-    16714278,
-    16714280,
-    16714281,
-    16714282,
-    16714303,
-    16714306,
-    16714308,
-    16714309,
-    16714310,
-    16714312,
-    16714313,
-    16714314,
-    16714321,
-    16714322,
-    16714324,
-    16714325,
-    16714326,
-    16714328,
-    16714329,
-    16714330,
-    16714337,
-    16714338,
-    16714340,
-    16714341,
-    16714342,
-    16714344,
-    16714345,
-    16714346,
-    16714367,
-    16714370,
-    16714372,
-    16714373,
-    16714374,
-    16714376,
-    16714377,
-    16714378,
-    16714385,
-    16714386,
-    16714388,
-    16714389,
-    16714390,
-    16714392,
-    16714393,
-    16714394,
-    16714400,
-    16714401,
-    16714402,
-    16714404,
-    16714405,
-    16714406,
-    16714408,
-    16714409,
-    16714410,
-    16714431,
-    16715203,
-    16715207,
-    16715211,
-    16715219,
-    16715223,
-    16715227,
-    16715235,
-    16715239,
-    16715243,
-    16715263,
-    16715459,
-    16715463,
-    16715467,
-    16715475,
-    16715479,
-    16715483,
-    16715491,
-    16715495,
-    16715499,
-    16715519,
-    16716104,
-    16716105,
-    16716106,
-    16716113,
-    16716114,
-    16716121,
-    16716122,
-    16716130,
-    16716138,
-    16716168,
-    16716169,
-    16716170,
-    16716177,
-    16716178,
-    16716180,
-    16716181,
-    16716182,
-    16716184,
-    16716185,
-    16716186,
-    16716193,
-    16716194,
-    16716196,
-    16716197,
-    16716198,
-    16716200,
-    16716201,
-    16716202,
-    16716223,
-    16716420,
-    16716421,
-    16716422,
-    16716424,
-    16716425,
-    16716426,
-    16716433,
-    16716434,
-    16716437,
-    16716438,
-    16716441,
-    16716442,
-    16716450,
-    16716454,
-    16716458,
-    16716479,
-    16717073,
-    16717074,
-    16717077,
-    16717078,
-    16717081,
-    16717082,
-    16717089,
-    16717090,
-    16717093,
-    16717094,
-    16717097,
-    16717098,
-    16717119,
-    16717144,
-    16717145,
-    16717146,
-    16717153,
-    16717154,
-    16717160,
-    16717161,
-    16717162,
-    16717208,
-    16717209,
-    16717210,
-    16717217,
-    16717218,
-    16717220,
-    16717221,
-    16717222,
-    16717224,
-    16717225,
-    16717226,
-    16717247,
-    16717317,
-    16717318,
-    16717321,
-    16717322,
-    16717329,
-    16717330,
-    16717333,
-    16717334,
-    16717337,
-    16717338,
-    16717345,
-    16717346,
-    16717349,
-    16717350,
-    16717353,
-    16717354,
-    16717375,
-    16717381,
-    16717382,
-    16717384,
-    16717385,
-    16717386,
-    16717393,
-    16717394,
-    16717397,
-    16717398,
-    16717400,
-    16717401,
-    16717402,
-    16717409,
-    16717410,
-    16717413,
-    16717414,
-    16717416,
-    16717417,
-    16717418,
-    16717439,
-    16717445,
-    16717446,
-    16717448,
-    16717449,
-    16717450,
-    16717457,
-    16717458,
-    16717460,
-    16717461,
-    16717462,
-    16717464,
-    16717465,
-    16717466,
-    16717473,
-    16717474,
-    16717476,
-    16717477,
-    16717478,
-    16717480,
-    16717481,
-    16717482,
-    16717503,
-    16718113,
-    16718114,
-    16718117,
-    16718118,
-    16718121,
-    16718122,
-    16718143,
-    16718184,
-    16718185,
-    16718186,
-    16718248,
-    16718249,
-    16718250,
-    16718271,
-    16718342,
-    16718345,
-    16718346,
-    16718353,
-    16718354,
-    16718357,
-    16718358,
-    16718361,
-    16718362,
-    16718369,
-    16718370,
-    16718373,
-    16718374,
-    16718377,
-    16718378,
-    16718399,
-    16718406,
-    16718408,
-    16718409,
-    16718410,
-    16718417,
-    16718418,
-    16718421,
-    16718422,
-    16718424,
-    16718425,
-    16718426,
-    16718433,
-    16718434,
-    16718437,
-    16718438,
-    16718440,
-    16718441,
-    16718442,
-    16718463,
-    16718470,
-    16718472,
-    16718473,
-    16718474,
-    16718481,
-    16718482,
-    16718485,
-    16718486,
-    16718488,
-    16718489,
-    16718490,
-    16718497,
-    16718498,
-    16718500,
-    16718501,
-    16718502,
-    16718504,
-    16718505,
-    16718506,
-    16718527,
-    16719559,
-    16719563,
-    16719571,
-    16719575,
-    16719579,
-    16719587,
-    16719591,
-    16719595,
-    16719615,
-    16720520,
-    16720521,
-    16720522,
-    16720529,
-    16720530,
-    16720533,
-    16720534,
-    16720537,
-    16720538,
-    16720546,
-    16720550,
-    16720554,
-    16720575,
-    16721425,
-    16721426,
-    16721429,
-    16721430,
-    16721433,
-    16721434,
-    16721441,
-    16721442,
-    16721445,
-    16721446,
-    16721449,
-    16721450,
-    16721471,
-    16721493,
-    16721494,
-    16721497,
-    16721498,
-    16721505,
-    16721506,
-    16721509,
-    16721510,
-    16721513,
-    16721514,
-    16721535,
-    16721560,
-    16721561,
-    16721562,
-    16721569,
-    16721570,
-    16721573,
-    16721574,
-    16721576,
-    16721577,
-    16721578,
-    16721599,
-    16722465,
-    16722466,
-    16722469,
-    16722470,
-    16722473,
-    16722474,
-    16722495,
-    16722533,
-    16722534,
-    16722537,
-    16722538,
-    16722559,
-    16722600,
-    16722601,
-    16722602,
-    16722623,
-    16723711,
-    16729105,
-    16729106,
-    16729109,
-    16729110,
-    16729113,
-    16729114,
-    16729122,
-    16729126,
-    16729130,
-    16729151,
-    16729173,
-    16729174,
-    16729177,
-    16729178,
-    16729185,
-    16729186,
-    16729189,
-    16729190,
-    16729193,
-    16729194,
-    16729215,
-    16729241,
-    16729242,
-    16729249,
-    16729250,
-    16729253,
-    16729254,
-    16729257,
-    16729258,
-    16729279,
-    16729425,
-    16729426,
-    16729429,
-    16729430,
-    16729433,
-    16729434,
-    16729442,
-    16729446,
-    16729450,
-    16729471,
-    16729489,
-    16729490,
-    16729493,
-    16729494,
-    16729497,
-    16729498,
-    16729505,
-    16729506,
-    16729509,
-    16729510,
-    16729513,
-    16729514,
-    16729535,
-    16729745,
-    16729746,
-    16729749,
-    16729750,
-    16729753,
-    16729754,
-    16729762,
-    16729766,
-    16729770,
-    16729791,
-    16730145,
-    16730146,
-    16730149,
-    16730150,
-    16730153,
-    16730154,
-    16730175,
-    16730213,
-    16730214,
-    16730217,
-    16730218,
-    16730239,
-    16730281,
-    16730282,
-    16730303,
-    16730386,
-    16730389,
-    16730390,
-    16730393,
-    16730394,
-    16730402,
-    16730405,
-    16730406,
-    16730409,
-    16730410,
-    16730431,
-    16730450,
-    16730453,
-    16730454,
-    16730457,
-    16730458,
-    16730465,
-    16730466,
-    16730469,
-    16730470,
-    16730473,
-    16730474,
-    16730495,
-    16730514,
-    16730517,
-    16730518,
-    16730521,
-    16730522,
-    16730529,
-    16730530,
-    16730533,
-    16730534,
-    16730537,
-    16730538,
-    16730559,
-    16730642,
-    16730646,
-    16730649,
-    16730650,
-    16730658,
-    16730662,
-    16730665,
-    16730666,
-    16730687,
-    16730706,
-    16730709,
-    16730710,
-    16730713,
-    16730714,
-    16730722,
-    16730725,
-    16730726,
-    16730729,
-    16730730,
-    16730751,
-    16730770,
-    16730773,
-    16730774,
-    16730777,
-    16730778,
-    16730785,
-    16730786,
-    16730789,
-    16730790,
-    16730793,
-    16730794,
-    16730815,
-    16731391,
-    16731603,
-    16731607,
-    16731611,
-    16731619,
-    16731623,
-    16731627,
-    16731647,
-    16731859,
-    16731863,
-    16731867,
-    16731875,
-    16731879,
-    16731883,
-    16731903,
-    16733529,
-    16733530,
-    16733538,
-    16733546,
-    16733593,
-    16733594,
-    16733602,
-    16733605,
-    16733606,
-    16733609,
-    16733610,
-    16733631,
-    16733845,
-    16733846,
-    16733849,
-    16733850,
-    16733858,
-    16733862,
-    16733866,
-    16733887,
-    16734498,
-    16734502,
-    16734506,
-    16734527,
-    16734569,
-    16734570,
-    16734633,
-    16734634,
-    16734655,
-    16734742,
-    16734746,
-    16734754,
-    16734758,
-    16734762,
-    16734783,
-    16734806,
-    16734809,
-    16734810,
-    16734818,
-    16734822,
-    16734825,
-    16734826,
-    16734847,
-    16734870,
-    16734873,
-    16734874,
-    16734882,
-    16734885,
-    16734886,
-    16734889,
-    16734890,
-    16734911,
-    16735959,
-    16735963,
-    16735971,
-    16735975,
-    16735979,
-    16735999,
-    16737945,
-    16737946,
-    16737954,
-    16737958,
-    16737962,
-    16737983,
-    16738850,
-    16738854,
-    16738858,
-    16738879,
-    16738918,
-    16738922,
-    16738943,
-    16738985,
-    16738986,
-    16739007,
-    16740095,
-    16746534,
-    16746538,
-    16746598,
-    16746602,
-    16746623,
-    16746666,
-    16746687,
-    16746850,
-    16746854,
-    16746858,
-    16746879,
-    16746914,
-    16746918,
-    16746922,
-    16746943,
-    16747170,
-    16747174,
-    16747178,
-    16747199,
-    16748003,
-    16748007,
-    16748011,
-    16748031,
-    16748259,
-    16748263,
-    16748267,
-    16748287,
-    16750954,
-    16751018,
-    16751039,
-    16751270,
-    16751274,
-    16751295,
-    16752359,
-    16752363,
-    16752383,
-    16755370,
-    16755391,
-    16756479
-};
@@ -18,17 +18,34 @@ using namespace Utils;
 
 Playout::Playout() :
     m_run(false), m_eval_valid(false) {
-    m_sq[0].reset();
-    m_sq[1].reset();
+    m_amaf.m_count = {0, 0};
 }
 
-float Playout::get_score() const {
+float Playout::get_score(int run) const {
     assert(m_run);
+    assert(run >= 0 && run < get_runs());
+
+    if (run > 0) {
+        return m_merged[run - 1].first;
+    }
+
     assert(m_score > -2.00f && m_score < 2.00f);
 
     return m_score;
 }
 
+int Playout::get_runs() const {
+    return 1 + m_merged.size();
+}
+
+void Playout::merge(const Playout & other) {
+    assert(m_run && other.m_run);
+
+    m_merged.emplace_back(other.m_score, other.m_amaf);
+    m_merged.insert(m_merged.end(),
+                    other.m_merged.cbegin(), other.m_merged.cend());
+}
+
 float Playout::get_territory() const {
     assert(m_run);
     return m_territory;
@@ -61,6 +78,7 @@ void Playout::run(FastState & state, bool postpassout, bool resigning,
     const int maxpasses = postpassout ? 4 : 2;
 
     int counter = 0;
+    bitboard_t played;
 
     // do the main loop
     while (state.get_passes() < maxpasses
@@ -68,11 +86,12 @@ void Playout::run(FastState & state, bool postpassout, bool resigning,
         && (!resigning || abs(state.estimate_mc_score()) < resign)) {
         int vtx = state.play_random_move(state.get_to_move(), trace);
 
-        if (counter < 30 && vtx != FastBoard::PASS) {
+        if (counter < AMAF_MOVES && vtx != FastBoard::PASS) {
             int color = !state.get_to_move();
 
-            if (!m_sq[!color][vtx]) {
-                m_sq[color][vtx] = true;
+            if (!played[vtx]) {
+                played[vtx] = true;
+                m_amaf.m_moves[color][m_amaf.m_count[color]++] = vtx;
             }
         }
 
@@ -112,14 +131,15 @@ void Playout::run(FastState & state, bool postpassout, bool resigning,
     m_score = board_score / (boardsize * boardsize);
 }
 
-bool Playout::passthrough(int color, int vertex) {
+const Playout::amaf_t & Playout::get_amaf(int run) const {
     assert(m_run);
-    
-    if (vertex == FastBoard::PASS) {
-        return false;
+    assert(run >= 0 && run < get_runs());
+
+    if (run > 0) {
+        return m_merged[run - 1].second;
     }
-    
-    return m_sq[color][vertex];
+
+    return m_amaf;
 }
 
 void Playout::do_playout_benchmark(GameState & game) {
@@ -135,30 +155,26 @@ void Playout::do_playout_benchmark(GameState & game) {
 
     Time start;
 
-    ThreadGroup tg(thread_pool);
-    for (int i = 0; i < cpus; i++) {
-        tg.add_task([iters_per_thread, &game, &len, &board_score,
-                              playoutlen, resign]() {
-            GameState mygame = game;
-            float thread_len = 0.0f;
-            float thread_board_score = 0.0f;
-            for (int i = 0; i < iters_per_thread; i++) {
-                do {
-                    mygame.play_random_move(mygame.get_to_move());
-                } while (mygame.get_passes() < 2
-                        && mygame.get_movenum() < playoutlen
-                        && abs(mygame.estimate_mc_score()) < resign);
-
-                thread_len += mygame.get_movenum();
-                thread_board_score += mygame.calculate_mc_score();
-
-                mygame.reset_game();
-            }
-            atomic_add(board_score, thread_board_score);
-            atomic_add(len, thread_len);
-        });
-    };
-    tg.wait_all();
+    thread_pool.parallel_for(0, cpus, [iters_per_thread, &game, &len,
+                                       &board_score, playoutlen, resign](int) {
+        GameState mygame = game;
+        float thread_len = 0.0f;
+        float thread_board_score = 0.0f;
+        for (int i = 0; i < iters_per_thread; i++) {
+            do {
+                mygame.play_random_move(mygame.get_to_move());
+            } while (mygame.get_passes() < 2
+                    && mygame.get_movenum() < playoutlen
+                    && abs(mygame.estimate_mc_score()) < resign);
+
+            thread_len += mygame.get_movenum();
+            thread_board_score += mygame.calculate_mc_score();
+
+            mygame.reset_game();
+        }
+        atomic_add(board_score, thread_board_score);
+        atomic_add(len, thread_len);
+    });
 
     Time end;
 
@@ -172,37 +188,23 @@ void Playout::do_playout_benchmark(GameState & game) {
 }
 
 float Playout::mc_owner(FastState & state, const int iterations, float* points) {
-    int cpus = cfg_num_threads;
-    int iters_per_thread = (iterations + (cpus - 1)) / cpus;
-
     std::atomic<float> bwins{0.0f};
     std::atomic<float> board_score{0.0f};
 
-    ThreadGroup tg(thread_pool);
-    for (int i = 0; i < cpus; i++) {
-        tg.add_task([iters_per_thread, &state,
-                     &bwins, &board_score]() {
-            float thread_bwins = 0.0f;
-            float thread_board_score = 0.0f;
-            for (int i = 0; i < iters_per_thread; i++) {
-                FastState tmp = state;
-
-                Playout p;
-                p.run(tmp, true, false);
-
-                float score = p.get_score();
-                if (score == 0.0f) {
-                    thread_bwins += 0.5f;
-                } else if (score > 0.0f) {
-                    thread_bwins += 1.0f;
-                }
-                thread_board_score += p.get_territory();
-            }
-            atomic_add(bwins, thread_bwins);
-            atomic_add(board_score, thread_board_score);
-        });
-    }
-    tg.wait_all();
+    thread_pool.parallel_for(0, iterations, [&state, &bwins, &board_score](int) {
+        FastState tmp = state;
+
+        Playout p;
+        p.run(tmp, true, false);
+
+        float score = p.get_score();
+        if (score == 0.0f) {
+            atomic_add(bwins, 0.5f);
+        } else if (score > 0.0f) {
+            atomic_add(bwins, 1.0f);
+        }
+        atomic_add(board_score, p.get_territory());
+    });
 
     float score = bwins / (float)iterations;
     if (state.get_to_move() != FastBoard::BLACK) {
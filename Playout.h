@@ -1,6 +1,7 @@
 #ifndef PLAYOUT_H_INCLUDED
 #define PLAYOUT_H_INCLUDED
 
+#include <array>
 #include <bitset>
 #include <vector>
 
@@ -11,7 +12,16 @@
 class Playout {
 public:
     using bitboard_t = std::bitset<FastBoard::MAXSQ>;
-    using color_bitboard_t = std::array<bitboard_t, 2>;
+
+    // Only this many moves into the game count for AMAF
+    static constexpr int AMAF_MOVES = 30;
+    /*
+        Vertices each color played first, in game order.
+    */
+    struct amaf_t {
+        std::array<std::array<int16, AMAF_MOVES>, 2> m_moves;
+        std::array<int, 2> m_count;
+    };
 
     static const int AUTOGAMES = 200000;
     static void do_playout_benchmark(GameState & game);
@@ -22,19 +32,27 @@ public:
     Playout();
     void run(FastState & state, bool postpassout, bool resigning,
              PolicyTrace * trace = nullptr);
-    float get_score() const;
+    /*
+        Fold another finished game from the same position into this
+        result, so a batch backs up through the tree as one update.
+    */
+    void merge(const Playout & other);
+    int get_runs() const;
+    float get_score(int run = 0) const;
     float get_territory() const;
     void set_eval(float eval);
     float get_eval() const;
     bool has_eval() const;
-    bool passthrough(int color, int vertex);
+    const amaf_t & get_amaf(int run = 0) const;
 private:
     bool m_run;
     float m_score;
     float m_territory;
     bool m_eval_valid;
     float m_blackeval;
-    color_bitboard_t m_sq;
+    amaf_t m_amaf;
+    // score and first moves of the games merged in
+    std::vector<std::pair<float, amaf_t>> m_merged;
 };
 
 #endif
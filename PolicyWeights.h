@@ -1,23545 +0,0 @@
-alignas(64) std::array<float, NUM_FEATURES> PolicyWeights::feature_weights{
-    0.226326466f, /* = 0 */
-    2.25456834f, /* = 1 */
-    2.14151955f, /* = 2 */
-    0.531394064f, /* = 3 */
-    0.660877407f, /* = 4 */
-    0.219764933f, /* = 5 */
-    0.673469424f, /* = 6 */
-    0.43629548f, /* = 7 */
-    0.69621259f, /* = 8 */
-    0.667903841f, /* = 9 */
-    0.649358332f, /* = 10 */
-    0.961654603f, /* = 11 */
-    1.16569388f, /* = 12 */
-    0.2672005f, /* = 13 */
-    0.289963305f, /* = 14 */
-    1.28901887f, /* = 15 */
-    0.746987998f, /* = 16 */
-    1.8737731f, /* = 17 */
-    0.888311088f, /* = 18 */
-    0.751757741f, /* = 19 */
-    2.69915652f, /* = 20 */
-    5.63231659f /* = 21 */
-};
-
-alignas(64) std::array<float, NUM_PATTERNS> PolicyWeights::pattern_weights{
-    9.980484247e-01f,
-    1.186583400e+00f,
-    4.997554123e-01f,
-    1.760769844e+00f,
-    1.000961304e+00f,
-    1.047115803e+00f,
-    8.419564962e-01f,
-    9.202950001e-01f,
-    4.774415493e-01f,
-    2.550170422e+00f,
-    1.603602052e+00f,
-    1.054514289e+00f,
-    1.408728242e+00f,
-    6.155263782e-01f,
-    1.199489951e+00f,
-    7.867816091e-01f,
-    7.312851548e-01f,
-    7.879606485e-01f,
-    1.540435791e+00f,
-    1.019956112e+00f,
-    1.077095628e+00f,
-    7.247465253e-01f,
-    1.318653226e+00f,
-    6.206698418e-01f,
-    8.225234151e-01f,
-    1.469264150e+00f,
-    9.658135176e-01f,
-    1.059157729e+00f,
-    7.149875760e-01f,
-    6.909123659e-01f,
-    1.222405910e+00f,
-    9.273881912e-01f,
-    8.648558259e-01f,
-    1.131335735e+00f,
-    9.116705656e-01f,
-    1.030065894e+00f,
-    7.037677169e-01f,
-    9.463238120e-01f,
-    1.134500265e+00f,
-    9.541422129e-01f,
-    6.469337344e-01f,
-    7.836557627e-01f,
-    1.425680399e+00f,
-    8.568561673e-01f,
-    1.199880481e+00f,
-    7.145212293e-01f,
-    9.770981073e-01f,
-    7.226791382e-01f,
-    8.135305643e-01f,
-    4.763436019e-01f,
-    8.331652880e-01f,
-    1.868874550e+00f,
-    6.804316640e-01f,
-    1.393440723e+00f,
-    8.114244938e-01f,
-    7.810938954e-01f,
-    2.710862637e+00f,
-    6.900147796e-01f,
-    5.970267057e-01f,
-    1.891294956e+00f,
-    1.415023327e+00f,
-    6.555659175e-01f,
-    9.691213965e-01f,
-    1.039492726e+00f,
-    7.711050510e-01f,
-    1.947894931e+00f,
-    8.754302263e-01f,
-    8.709570765e-01f,
-    4.548065960e-01f,
-    6.279315352e-01f,
-    6.771016121e-01f,
-    8.048543930e-01f,
-    6.784884334e-01f,
-    8.598971963e-01f,
-    1.143438816e+00f,
-    6.552945971e-01f,
-    8.257334828e-01f,
-    9.052109718e-01f,
-    1.291625381e+00f,
-    8.251358271e-01f,
-    1.155678272e+00f,
-    1.005902410e+00f,
-    6.362106204e-01f,
-    1.435684919e+00f,
-    6.061431766e-01f,
-    9.573132396e-01f,
-    1.205325961e+00f,
-    1.009106636e+00f,
-    1.131807923e+00f,
-    1.372723341e+00f,
-    1.563436508e+00f,
-    9.029765725e-01f,
-    1.087205172e+00f,
-    1.416125536e+00f,
-    9.711207151e-01f,
-    8.738620877e-01f,
-    1.134468794e+00f,
-    9.290923476e-01f,
-    8.081034422e-01f,
-    6.573302746e-01f,
-    6.091241241e-01f,
-    1.233882904e+00f,
-    1.177836180e+00f,
-    1.199908257e+00f,
-    6.577566862e-01f,
-    7.235897779e-01f,
-    9.232673049e-01f,
-    1.237622261e+00f,
-    1.089146018e+00f,
-    9.316225648e-01f,
-    1.468248367e+00f,
-    1.659466028e+00f,
-    1.141498446e+00f,
-    1.215121984e+00f,
-    1.124145031e+00f,
-    9.625924230e-01f,
-    1.170073509e+00f,
-    7.243496776e-01f,
-    1.316888213e+00f,
-    7.248588800e-01f,
-    1.025003433e+00f,
-    1.167176843e+00f,
-    8.863750696e-01f,
-    9.871304631e-01f,
-    9.274001718e-01f,
-    8.731507659e-01f,
-    7.093915343e-01f,
-    9.334852099e-01f,
-    6.362171173e-01f,
-    1.026814222e+00f,
-    8.284331560e-01f,
-    1.561613679e+00f,
-    7.500908971e-01f,
-    8.529986739e-01f,
-    1.079493642e+00f,
-    1.777100682e+00f,
-    2.171046734e+00f,
-    6.983060837e-01f,
-    7.508898973e-01f,
-    1.042249799e+00f,
-    1.054995418e+00f,
-    1.228718400e+00f,
-    7.645794153e-01f,
-    6.335247755e-01f,
-    1.277209163e+00f,
-    1.086484313e+00f,
-    1.222105384e+00f,
-    8.361089826e-01f,
-    7.139875889e-01f,
-    1.572002411e+00f,
-    9.952132106e-01f,
-    1.141872168e+00f,
-    1.214173913e+00f,
-    9.780255556e-01f,
-    1.420261741e+00f,
-    7.365772724e-01f,
-    1.366474867e+00f,
-    8.781498671e-01f,
-    7.133378386e-01f,
-    1.162079573e+00f,
-    7.667392492e-01f,
-    1.937891841e+00f,
-    9.200014472e-01f,
-    9.739899635e-01f,
-    5.260040760e-01f,
-    6.780902147e-01f,
-    5.793796182e-01f,
-    1.444824457e+00f,
-    1.549906492e+00f,
-    6.378641129e-01f,
-    1.038778305e+00f,
-    1.330706716e+00f,
-    1.437008381e+00f,
-    1.630738497e+00f,
-    8.091549873e-01f,
-    6.834080219e-01f,
-    1.353369832e+00f,
-    5.652899146e-01f,
-    7.464489937e-01f,
-    1.092952728e+00f,
-    1.066567421e+00f,
-    1.266057134e+00f,
-    7.762284875e-01f,
-    1.172914386e+00f,
-    1.256590843e+00f,
-    9.025064111e-01f,
-    7.856560349e-01f,
-    1.437303901e+00f,
-    9.656124115e-01f,
-    2.090035439e+00f,
-    8.484034538e-01f,
-    8.605599999e-01f,
-    1.457212329e+00f,
-    8.363856673e-01f,
-    9.448243380e-01f,
-    1.151147962e+00f,
-    1.038151741e+00f,
-    9.815541506e-01f,
-    1.099050760e+00f,
-    8.667729497e-01f,
-    1.466108918e+00f,
-    1.087560415e+00f,
-    9.695399404e-01f,
-    1.013624549e+00f,
-    1.149995446e+00f,
-    1.309550643e+00f,
-    9.219728708e-01f,
-    7.399281859e-01f,
-    7.448697686e-01f,
-    8.908419013e-01f,
-    1.254284263e+00f,
-    7.634311318e-01f,
-    7.517530918e-01f,
-    1.294543028e+00f,
-    6.116189957e-01f,
-    1.216177464e+00f,
-    7.642943263e-01f,
-    8.628414273e-01f,
-    7.443169951e-01f,
-    1.294620752e+00f,
-    1.374105692e+00f,
-    1.085465312e+00f,
-    9.350601435e-01f,
-    5.766596198e-01f,
-    7.815696001e-01f,
-    7.661675811e-01f,
-    1.646001339e+00f,
-    5.060338974e-01f,
-    6.614024043e-01f,
-    6.539370418e-01f,
-    4.042847157e-01f,
-    6.846325994e-01f,
-    1.338291764e+00f,
-    1.090789437e+00f,
-    9.352439046e-01f,
-    1.284865141e+00f,
-    9.726074338e-01f,
-    7.227289677e-01f,
-    1.185134053e+00f,
-    1.149983406e+00f,
-    1.041079402e+00f,
-    6.360991001e-01f,
-    5.332060456e-01f,
-    1.123668551e+00f,
-    9.883416295e-01f,
-    6.855537891e-01f,
-    7.140182853e-01f,
-    1.096759796e+00f,
-    8.668726087e-01f,
-    8.331987262e-01f,
-    8.039598465e-01f,
-    8.578642011e-01f,
-    7.346172333e-01f,
-    8.199126124e-01f,
-    1.186553836e+00f,
-    8.955406547e-01f,
-    8.694316745e-01f,
-    1.143280745e+00f,
-    8.762069345e-01f,
-    9.067487121e-01f,
-    8.542453647e-01f,
-    8.705043197e-01f,
-    1.177838683e+00f,
-    9.051314592e-01f,
-    6.278101206e-01f,
-    1.422335148e+00f,
-    5.916312933e-01f,
-    1.124184608e+00f,
-    4.090816975e-01f,
-    9.439602494e-01f,
-    2.129338264e+00f,
-    7.999900579e-01f,
-    6.740015149e-01f,
-    3.756527603e-01f,
-    1.100072503e+00f,
-    8.702189922e-01f,
-    1.439041734e+00f,
-    1.739795208e+00f,
-    1.111159086e+00f,
-    1.128451586e+00f,
-    6.366415024e-01f,
-    7.647470236e-01f,
-    8.537842631e-01f,
-    7.492545843e-01f,
-    8.473794460e-01f,
-    7.455034852e-01f,
-    1.545097232e+00f,
-    7.849236727e-01f,
-    1.268060446e+00f,
-    9.015282989e-01f,
-    1.058270454e+00f,
-    1.473572373e+00f,
-    1.119598746e+00f,
-    5.107576251e-01f,
-    8.283530474e-01f,
-    6.965497136e-01f,
-    9.651855826e-01f,
-    9.625123143e-01f,
-    7.214186192e-01f,
-    7.957142591e-01f,
-    9.156665206e-01f,
-    6.215036511e-01f,
-    9.151771665e-01f,
-    9.329277873e-01f,
-    1.271576405e+00f,
-    9.360807538e-01f,
-    8.845102191e-01f,
-    2.270783663e+00f,
-    1.396763802e+00f,
-    6.566288471e-01f,
-    1.157316089e+00f,
-    1.075417519e+00f,
-    8.661375046e-01f,
-    1.005399227e+00f,
-    1.099267840e+00f,
-    1.060966015e+00f,
-    1.057404399e+00f,
-    8.992921710e-01f,
-    1.451612353e+00f,
-    7.829821110e-01f,
-    1.411861420e+00f,
-    8.006702065e-01f,
-    7.143970728e-01f,
-    9.165216088e-01f,
-    8.274731636e-01f,
-    6.392446160e-01f,
-    8.700486422e-01f,
-    1.257226348e+00f,
-    9.031295776e-01f,
-    7.810651064e-01f,
-    9.636506438e-01f,
-    8.373948336e-01f,
-    5.480073690e-01f,
-    1.185353994e+00f,
-    4.430643916e-01f,
-    1.579306722e+00f,
-    7.897377610e-01f,
-    6.901011467e-01f,
-    1.439732432e+00f,
-    9.877526760e-01f,
-    7.967091799e-01f,
-    1.578205347e+00f,
-    1.360077620e+00f,
-    1.061608195e+00f,
-    1.230737567e+00f,
-    5.252783298e-01f,
-    8.412973285e-01f,
-    1.512943745e+00f,
-    1.233877659e+00f,
-    1.652760863e+00f,
-    9.289454818e-01f,
-    8.988897204e-01f,
-    5.515637398e-01f,
-    1.103170753e+00f,
-    1.284126401e+00f,
-    4.594576359e-01f,
-    8.692197204e-01f,
-    1.160857677e+00f,
-    1.154299378e+00f,
-    1.485344887e+00f,
-    9.191462398e-01f,
-    1.116109967e+00f,
-    7.584363222e-01f,
-    8.965261579e-01f,
-    8.269097805e-01f,
-    9.433102012e-01f,
-    1.153708100e+00f,
-    8.441711068e-01f,
-    8.683028817e-01f,
-    1.543746352e+00f,
-    8.823901415e-01f,
-    1.232685328e+00f,
-    1.467123628e+00f,
-    1.312425613e+00f,
-    1.353951454e+00f,
-    8.882446289e-01f,
-    1.312944174e+00f,
-    2.299131632e+00f,
-    1.291131616e+00f,
-    6.881644130e-01f,
-    1.072268248e+00f,
-    9.967585206e-01f,
-    8.753120899e-01f,
-    7.048439384e-01f,
-    4.835897684e-01f,
-    1.080967903e+00f,
-    7.390625477e-01f,
-    7.638496161e-01f,
-    1.052855611e+00f,
-    1.059845805e+00f,
-    1.163025856e+00f,
-    1.354777932e+00f,
-    1.088197589e+00f,
-    1.218496323e+00f,
-    3.695093691e-01f,
-    9.251276851e-01f,
-    1.149531245e+00f,
-    1.255693316e+00f,
-    7.075407505e-01f,
-    1.717783332e+00f,
-    1.188880086e+00f,
-    1.447045565e+00f,
-    1.324327588e+00f,
-    1.235245466e+00f,
-    4.021100104e-01f,
-    9.671139717e-01f,
-    8.769378066e-01f,
-    1.044263005e+00f,
-    1.186125636e+00f,
-    2.351701498e+00f,
-    1.457819223e+00f,
-    9.157063365e-01f,
-    6.864690781e-01f,
-    1.063333154e+00f,
-    9.059007168e-01f,
-    6.503868103e-01f,
-    8.944508433e-01f,
-    1.268180728e+00f,
-    1.181534410e+00f,
-    1.531872630e+00f,
-    1.417019725e+00f,
-    9.802564979e-01f,
-    1.333605051e+00f,
-    9.013080001e-01f,
-    6.907035112e-01f,
-    8.315693140e-01f,
-    1.365764260e+00f,
-    1.484548688e+00f,
-    1.720575333e+00f,
-    1.240538836e+00f,
-    1.419292927e+00f,
-    2.079858065e+00f,
-    1.241982698e+00f,
-    6.903048754e-01f,
-    8.377505541e-01f,
-    9.413513541e-01f,
-    8.217157125e-01f,
-    8.742408752e-01f,
-    9.144150019e-01f,
-    8.830698133e-01f,
-    6.443079114e-01f,
-    7.894470692e-01f,
-    7.208527923e-01f,
-    1.716474295e+00f,
-    6.984326243e-01f,
-    8.480442762e-01f,
-    1.256095886e+00f,
-    6.293547153e-01f,
-    7.418794036e-01f,
-    5.145490170e-01f,
-    1.023136854e+00f,
-    1.007367253e+00f,
-    1.219360828e+00f,
-    1.061061740e+00f,
-    8.112245202e-01f,
-    1.669905782e+00f,
-    6.729041934e-01f,
-    7.558591366e-01f,
-    1.217401028e+00f,
-    9.378467202e-01f,
-    7.055441737e-01f,
-    5.113173723e-01f,
-    7.349056602e-01f,
-    8.414765596e-01f,
-    9.263813496e-01f,
-    5.631318092e-01f,
-    1.269044995e+00f,
-    6.756892800e-01f,
-    1.531996965e+00f,
-    1.866506934e+00f,
-    6.900085807e-01f,
-    2.072056055e+00f,
-    1.769772530e+00f,
-    1.737914562e+00f,
-    1.220742464e+00f,
-    7.672615647e-01f,
-    1.010515571e+00f,
-    7.912173867e-01f,
-    5.379059315e-01f,
-    9.674835801e-01f,
-    5.648285747e-01f,
-    7.017380595e-01f,
-    9.258434772e-01f,
-    8.468809128e-01f,
-    1.721603274e+00f,
-    1.802127719e+00f,
-    9.406608343e-01f,
-    1.353696704e+00f,
-    4.834574163e-01f,
-    1.174428344e+00f,
-    1.205066085e+00f,
-    6.361370683e-01f,
-    1.681344151e+00f,
-    1.165663004e+00f,
-    1.020804763e+00f,
-    7.768352628e-01f,
-    1.039722204e+00f,
-    7.361953855e-01f,
-    1.836794257e+00f,
-    8.271489739e-01f,
-    1.907319784e+00f,
-    4.503364861e-01f,
-    1.498876691e+00f,
-    1.700313330e+00f,
-    1.733663201e+00f,
-    1.302540064e+00f,
-    1.060676813e+00f,
-    5.850371122e-01f,
-    1.020276546e+00f,
-    1.340451121e+00f,
-    5.810853243e-01f,
-    6.569781303e-01f,
-    7.684987187e-01f,
-    1.476107597e+00f,
-    9.489246011e-01f,
-    6.772753596e-01f,
-    6.952605247e-01f,
-    1.150516748e+00f,
-    2.201730490e+00f,
-    9.810072780e-01f,
-    9.200348258e-01f,
-    1.076273322e+00f,
-    1.162395954e+00f,
-    8.097140193e-01f,
-    8.868736625e-01f,
-    9.116079211e-01f,
-    1.100250602e+00f,
-    1.255735993e+00f,
-    7.779100537e-01f,
-    1.138529539e+00f,
-    9.067285657e-01f,
-    6.862515807e-01f,
-    1.221356511e+00f,
-    8.454767466e-01f,
-    1.355681539e+00f,
-    1.601479650e+00f,
-    1.354468226e+00f,
-    5.215818882e-01f,
-    9.153084159e-01f,
-    1.060286880e+00f,
-    1.286638856e+00f,
-    6.576932669e-01f,
-    1.086431861e+00f,
-    1.142746091e+00f,
-    7.413695455e-01f,
-    1.288109183e+00f,
-    1.169771910e+00f,
-    9.305647016e-01f,
-    9.128341675e-01f,
-    9.267268181e-01f,
-    1.222509027e+00f,
-    8.627130985e-01f,
-    8.418862820e-01f,
-    1.080519319e+00f,
-    8.569917083e-01f,
-    8.374403715e-01f,
-    1.080566883e+00f,
-    7.214444876e-01f,
-    5.568955541e-01f,
-    1.980714917e+00f,
-    7.051165700e-01f,
-    1.523730874e+00f,
-    1.272120714e+00f,
-    7.700203061e-01f,
-    1.723221540e+00f,
-    8.383730650e-01f,
-    6.729571223e-01f,
-    7.362908125e-01f,
-    9.721788764e-01f,
-    1.068940043e+00f,
-    9.963064194e-01f,
-    1.069692969e+00f,
-    7.064051032e-01f,
-    1.286325812e+00f,
-    6.012426615e-01f,
-    1.081824422e+00f,
-    1.738838315e+00f,
-    1.013466477e+00f,
-    9.208505154e-01f,
-    1.302007079e+00f,
-    1.446076512e+00f,
-    1.005673885e+00f,
-    1.845651627e+00f,
-    8.997358084e-01f,
-    9.872003198e-01f,
-    7.359409332e-01f,
-    6.305701733e-01f,
-    1.126556396e+00f,
-    8.339836597e-01f,
-    1.385841727e+00f,
-    1.883402467e+00f,
-    1.250710607e+00f,
-    2.172329903e+00f,
-    1.162657142e+00f,
-    1.227243781e+00f,
-    1.010106921e+00f,
-    1.307915926e+00f,
-    1.129909992e+00f,
-    8.158146739e-01f,
-    6.970822215e-01f,
-    1.103644371e+00f,
-    1.374021530e+00f,
-    6.627988219e-01f,
-    8.596324921e-01f,
-    6.538422704e-01f,
-    8.241603374e-01f,
-    1.232257128e+00f,
-    1.012174249e+00f,
-    1.248110890e+00f,
-    8.141113520e-01f,
-    7.645180821e-01f,
-    9.987539649e-01f,
-    1.082055807e+00f,
-    6.794306040e-01f,
-    1.242470145e+00f,
-    7.364594936e-01f,
-    1.367841363e+00f,
-    1.303455710e+00f,
-    8.504342437e-01f,
-    1.089612365e+00f,
-    8.693193793e-01f,
-    9.770041108e-01f,
-    7.478232980e-01f,
-    1.151919246e+00f,
-    7.889493108e-01f,
-    1.841973782e+00f,
-    1.214042664e+00f,
-    1.053612351e+00f,
-    9.926736951e-01f,
-    7.797949314e-01f,
-    1.097672462e+00f,
-    2.070441008e+00f,
-    8.521350026e-01f,
-    7.261842489e-01f,
-    9.812265635e-01f,
-    6.845049858e-01f,
-    8.968569636e-01f,
-    6.599528193e-01f,
-    1.603432298e+00f,
-    7.463839054e-01f,
-    7.329797745e-01f,
-    8.675345778e-01f,
-    5.974051356e-01f,
-    1.045601606e+00f,
-    6.727754474e-01f,
-    7.234475017e-01f,
-    1.501359463e+00f,
-    8.680248857e-01f,
-    8.604654074e-01f,
-    1.030605078e+00f,
-    7.590096593e-01f,
-    1.747719646e+00f,
-    1.493222952e+00f,
-    6.881054640e-01f,
-    1.154976010e+00f,
-    1.166681767e+00f,
-    8.081434965e-01f,
-    1.342242360e+00f,
-    1.282096148e+00f,
-    7.420277596e-01f,
-    9.993391037e-01f,
-    1.044725657e+00f,
-    6.003755331e-01f,
-    1.747569919e+00f,
-    8.719018102e-01f,
-    1.745209575e+00f,
-    1.727924824e+00f,
-    1.040497541e+00f,
-    1.304870605e+00f,
-    8.037018776e-01f,
-    5.028333664e-01f,
-    7.568126321e-01f,
-    2.028215408e+00f,
-    7.993714213e-01f,
-    1.035947800e+00f,
-    1.280345082e+00f,
-    1.068747044e+00f,
-    1.421170592e+00f,
-    1.040452003e+00f,
-    8.337981105e-01f,
-    1.142935991e+00f,
-    1.144874454e+00f,
-    8.634805679e-01f,
-    8.738121390e-01f,
-    8.481709957e-01f,
-    7.369629145e-01f,
-    1.537302375e+00f,
-    1.143772125e+00f,
-    6.094655991e-01f,
-    1.232557058e+00f,
-    6.620955467e-01f,
-    1.275807381e+00f,
-    8.180803061e-01f,
-    7.826563716e-01f,
-    1.102243662e+00f,
-    9.656067491e-01f,
-    1.023633003e+00f,
-    1.022443175e+00f,
-    6.732479930e-01f,
-    4.093468785e-01f,
-    1.357183576e+00f,
-    1.143967628e+00f,
-    6.382101178e-01f,
-    4.769785106e-01f,
-    1.290067792e+00f,
-    5.739777684e-01f,
-    7.384839654e-01f,
-    9.516614079e-01f,
-    1.013327360e+00f,
-    8.214265108e-01f,
-    8.119457364e-01f,
-    8.014358878e-01f,
-    8.201370239e-01f,
-    1.036842704e+00f,
-    1.160827160e+00f,
-    1.185112596e+00f,
-    9.630757570e-01f,
-    5.090777278e-01f,
-    1.251143575e+00f,
-    9.532507062e-01f,
-    1.409717679e+00f,
-    1.183757305e+00f,
-    1.264912963e+00f,
-    1.259397745e+00f,
-    8.585260510e-01f,
-    9.821081758e-01f,
-    9.774823785e-01f,
-    1.339854121e+00f,
-    7.952944636e-01f,
-    1.198887467e+00f,
-    5.601668954e-01f,
-    1.072432041e+00f,
-    1.228527427e+00f,
-    1.667955041e+00f,
-    1.146450639e+00f,
-    4.709936380e-01f,
-    1.022929907e+00f,
-    5.702577829e-01f,
-    6.084069610e-01f,
-    1.029205084e+00f,
-    6.382476687e-01f,
-    9.930454493e-01f,
-    1.605493426e+00f,
-    1.362881780e+00f,
-    1.057160020e+00f,
-    1.126824379e+00f,
-    1.031333327e+00f,
-    7.929084301e-01f,
-    1.271973252e+00f,
-    1.308437467e+00f,
-    1.427333474e+00f,
-    1.254355669e+00f,
-    1.414636254e+00f,
-    8.252712488e-01f,
-    7.414119244e-01f,
-    1.223147154e+00f,
-    9.343219399e-01f,
-    6.915358901e-01f,
-    1.481858134e+00f,
-    1.173262358e+00f,
-    9.551594257e-01f,
-    1.053828955e+00f,
-    1.044902802e+00f,
-    1.828909039e+00f,
-    1.216707230e+00f,
-    1.537500858e+00f,
-    5.063076019e-01f,
-    5.981366634e-01f,
-    8.554509282e-01f,
-    8.553035259e-01f,
-    7.571609020e-01f,
-    1.098331094e+00f,
-    8.680195808e-01f,
-    1.724559426e+00f,
-    8.655169606e-01f,
-    1.642261267e+00f,
-    1.056534410e+00f,
-    9.183727503e-01f,
-    8.486633301e-01f,
-    6.539767385e-01f,
-    1.020190239e+00f,
-    7.970445156e-01f,
-    1.301060915e+00f,
-    1.665614367e+00f,
-    7.321520448e-01f,
-    1.525204062e+00f,
-    8.085400462e-01f,
-    1.119802594e+00f,
-    1.015757084e+00f,
-    8.202186823e-01f,
-    1.062606692e+00f,
-    6.488122940e-01f,
-    7.171432376e-01f,
-    1.529100537e+00f,
-    1.275097847e+00f,
-    1.506187797e+00f,
-    8.403640985e-01f,
-    2.171225309e+00f,
-    1.101960063e+00f,
-    8.857042193e-01f,
-    1.283460021e+00f,
-    8.262706399e-01f,
-    1.717635870e+00f,
-    8.322418332e-01f,
-    1.472034216e+00f,
-    8.203301430e-01f,
-    1.113543510e+00f,
-    9.419831634e-01f,
-    9.059147835e-01f,
-    8.453702331e-01f,
-    8.771462440e-01f,
-    1.128969669e+00f,
-    1.033442140e+00f,
-    7.852219343e-01f,
-    1.062216282e+00f,
-    1.636590242e+00f,
-    1.194623351e+00f,
-    9.527407885e-01f,
-    1.022034168e+00f,
-    1.039936304e+00f,
-    1.114551187e+00f,
-    1.369525790e+00f,
-    6.785994172e-01f,
-    1.516203761e+00f,
-    8.684880137e-01f,
-    7.423846722e-01f,
-    8.955313563e-01f,
-    1.005939245e+00f,
-    1.092897415e+00f,
-    7.288750410e-01f,
-    1.048476219e+00f,
-    1.387697458e+00f,
-    6.537658572e-01f,
-    1.616971135e+00f,
-    1.038022161e+00f,
-    6.237698793e-01f,
-    1.349241495e+00f,
-    1.496366501e+00f,
-    1.580467343e+00f,
-    8.812779188e-01f,
-    7.800055146e-01f,
-    7.476223707e-01f,
-    1.151779771e+00f,
-    9.305948615e-01f,
-    9.929186702e-01f,
-    1.086017609e+00f,
-    1.248587966e+00f,
-    9.631260037e-01f,
-    9.313982725e-01f,
-    1.192544937e+00f,
-    1.080911279e+00f,
-    7.944012880e-01f,
-    1.105942845e+00f,
-    9.069988728e-01f,
-    8.019945025e-01f,
-    1.352178574e+00f,
-    1.580104828e+00f,
-    1.423254132e+00f,
-    1.378165483e+00f,
-    5.680744052e-01f,
-    1.042141557e+00f,
-    6.332217455e-01f,
-    1.462732792e+00f,
-    7.076488733e-01f,
-    6.001793146e-01f,
-    1.033717275e+00f,
-    8.552540541e-01f,
-    6.095699072e-01f,
-    1.015917778e+00f,
-    8.752682209e-01f,
-    7.174840569e-01f,
-    1.803593755e+00f,
-    1.411745191e+00f,
-    1.088110566e+00f,
-    9.378203154e-01f,
-    1.119250894e+00f,
-    8.477439880e-01f,
-    7.124838233e-01f,
-    5.455384851e-01f,
-    7.171084881e-01f,
-    7.738170624e-01f,
-    1.945506454e+00f,
-    6.542495489e-01f,
-    9.021374583e-01f,
-    7.988089919e-01f,
-    1.114320397e+00f,
-    4.882916510e-01f,
-    7.297196388e-01f,
-    1.580922723e+00f,
-    1.544513345e+00f,
-    7.558599114e-01f,
-    1.127934575e+00f,
-    1.020847082e+00f,
-    1.027417898e+00f,
-    1.123774529e+00f,
-    1.181565762e+00f,
-    1.143080235e+00f,
-    1.288248301e+00f,
-    8.944618106e-01f,
-    5.944659114e-01f,
-    1.520375252e+00f,
-    3.466159403e-01f,
-    9.181467891e-01f,
-    1.478312731e+00f,
-    1.125199199e+00f,
-    7.285727859e-01f,
-    8.540083766e-01f,
-    6.387577057e-01f,
-    6.996841431e-01f,
-    7.688814998e-01f,
-    6.930932403e-01f,
-    9.386289716e-01f,
-    8.274046779e-01f,
-    6.045200229e-01f,
-    1.487327218e+00f,
-    1.068694353e+00f,
-    3.477794826e-01f,
-    5.520358086e-01f,
-    1.194805145e+00f,
-    8.995664120e-01f,
-    8.954291344e-01f,
-    1.549905419e+00f,
-    1.038518548e+00f,
-    4.345708787e-01f,
-    1.305822492e+00f,
-    1.456699967e+00f,
-    7.116495967e-01f,
-    1.185049295e+00f,
-    6.553980708e-01f,
-    9.551988244e-01f,
-    2.753314257e+00f,
-    7.878193259e-01f,
-    8.662242889e-01f,
-    1.827156782e+00f,
-    6.606844068e-01f,
-    1.649802446e+00f,
-    9.342972636e-01f,
-    8.389068842e-01f,
-    5.594924688e-01f,
-    8.700890541e-01f,
-    7.529643178e-01f,
-    6.202876568e-01f,
-    1.127700090e+00f,
-    8.272905946e-01f,
-    1.462370992e+00f,
-    6.579623818e-01f,
-    1.622084260e+00f,
-    4.691498280e-01f,
-    7.297711968e-01f,
-    1.303416729e+00f,
-    7.435061336e-01f,
-    1.296521306e+00f,
-    1.407159448e+00f,
-    1.149690151e+00f,
-    7.140954733e-01f,
-    9.401530623e-01f,
-    8.235986829e-01f,
-    1.793579698e+00f,
-    6.573718786e-01f,
-    6.565397382e-01f,
-    1.208649755e+00f,
-    1.133565068e+00f,
-    1.032442093e+00f,
-    7.918752432e-01f,
-    1.062762856e+00f,
-    1.182639599e+00f,
-    1.295934796e+00f,
-    1.399297833e+00f,
-    7.289106846e-01f,
-    1.002437234e+00f,
-    1.324944735e+00f,
-    1.054181218e+00f,
-    1.521810889e+00f,
-    1.004681110e+00f,
-    8.591774702e-01f,
-    1.385252953e+00f,
-    8.389610648e-01f,
-    1.007675052e+00f,
-    7.727159262e-01f,
-    6.571357250e-01f,
-    2.014447212e+00f,
-    1.225530624e+00f,
-    1.058773875e+00f,
-    1.601353168e+00f,
-    1.113122940e+00f,
-    1.165067077e+00f,
-    1.074643016e+00f,
-    1.211891055e+00f,
-    8.415113688e-01f,
-    1.409566998e+00f,
-    1.226771593e+00f,
-    7.622478604e-01f,
-    9.166239500e-01f,
-    8.573462963e-01f,
-    1.471465945e+00f,
-    1.251188278e+00f,
-    8.509883285e-01f,
-    9.220653176e-01f,
-    1.334398270e+00f,
-    9.334703684e-01f,
-    9.882111549e-01f,
-    1.083290339e+00f,
-    9.926633239e-01f,
-    1.845179319e+00f,
-    9.154884219e-01f,
-    1.039944410e+00f,
-    6.691338420e-01f,
-    1.753244519e+00f,
-    1.181217670e+00f,
-    7.618621588e-01f,
-    6.840466857e-01f,
-    9.472712278e-01f,
-    1.515067577e+00f,
-    7.783659697e-01f,
-    8.085792065e-01f,
-    1.059297562e+00f,
-    5.624281168e-01f,
-    1.079599857e+00f,
-    9.089866281e-01f,
-    9.200723171e-01f,
-    6.571484804e-01f,
-    8.679744005e-01f,
-    8.039593697e-01f,
-    1.137062430e+00f,
-    6.164095998e-01f,
-    1.013323545e+00f,
-    1.173926830e+00f,
-    9.665616155e-01f,
-    4.986045659e-01f,
-    9.546858072e-01f,
-    8.509011865e-01f,
-    7.168025374e-01f,
-    8.872247338e-01f,
-    1.210208058e+00f,
-    8.598126769e-01f,
-    1.247070551e+00f,
-    1.512195468e+00f,
-    1.029122353e+00f,
-    7.476444840e-01f,
-    1.651959538e+00f,
-    8.777751327e-01f,
-    1.476738572e+00f,
-    1.249710202e+00f,
-    6.952295899e-01f,
-    1.151949048e+00f,
-    1.328666925e+00f,
-    6.496095657e-01f,
-    2.165619373e+00f,
-    8.728415370e-01f,
-    9.088938832e-01f,
-    4.461349249e-01f,
-    1.098227143e+00f,
-    1.464116454e+00f,
-    9.101083875e-01f,
-    1.755693674e+00f,
-    4.985474646e-01f,
-    1.191497445e+00f,
-    5.561721921e-01f,
-    8.178160787e-01f,
-    1.413442135e+00f,
-    1.169603467e+00f,
-    9.706723690e-01f,
-    9.115206003e-01f,
-    1.979312897e+00f,
-    1.065430880e+00f,
-    1.137149096e+00f,
-    7.940759063e-01f,
-    1.243278146e+00f,
-    6.964988112e-01f,
-    1.041287065e+00f,
-    6.603466272e-01f,
-    1.294765830e+00f,
-    5.895332694e-01f,
-    9.351584315e-01f,
-    8.876544237e-01f,
-    7.321290970e-01f,
-    1.160114169e+00f,
-    7.467857003e-01f,
-    8.570995331e-01f,
-    1.544921517e+00f,
-    6.082918644e-01f,
-    7.009639740e-01f,
-    1.345574617e+00f,
-    8.076762557e-01f,
-    7.680867910e-01f,
-    6.213122010e-01f,
-    1.096536636e+00f,
-    1.379465461e+00f,
-    8.925850391e-01f,
-    8.460544944e-01f,
-    1.139546514e+00f,
-    8.322029710e-01f,
-    1.338225722e+00f,
-    6.901067495e-01f,
-    9.855504036e-01f,
-    9.251059890e-01f,
-    1.292404175e+00f,
-    1.871634960e+00f,
-    6.680349708e-01f,
-    1.205561638e+00f,
-    1.443410158e+00f,
-    1.353828073e+00f,
-    1.562051058e+00f,
-    2.023006678e+00f,
-    9.643681645e-01f,
-    7.422438264e-01f,
-    7.989906073e-01f,
-    1.070643544e+00f,
-    2.147374392e+00f,
-    1.021678567e+00f,
-    7.337488532e-01f,
-    1.150964499e+00f,
-    6.187186837e-01f,
-    1.085862517e+00f,
-    1.014577150e+00f,
-    1.183379292e+00f,
-    7.948621511e-01f,
-    6.856991649e-01f,
-    6.926958561e-01f,
-    1.280116677e+00f,
-    1.030672312e+00f,
-    7.640827298e-01f,
-    7.247055769e-01f,
-    1.999778748e+00f,
-    7.551864982e-01f,
-    5.156547427e-01f,
-    1.135914207e+00f,
-    1.286178350e+00f,
-    2.305111647e+00f,
-    7.814524174e-01f,
-    1.132474542e+00f,
-    7.074195147e-01f,
-    9.480384588e-01f,
-    9.243662357e-01f,
-    1.190943599e+00f,
-    6.302772760e-01f,
-    9.801290631e-01f,
-    7.922133803e-01f,
-    6.087750793e-01f,
-    1.005768061e+00f,
-    1.680691600e+00f,
-    5.869139433e-01f,
-    1.324452639e+00f,
-    7.384362221e-01f,
-    1.331482172e+00f,
-    1.263498545e+00f,
-    1.046354413e+00f,
-    5.261465907e-01f,
-    6.360278726e-01f,
-    5.045426488e-01f,
-    8.399968147e-01f,
-    7.634714246e-01f,
-    2.782490492e+00f,
-    7.679365277e-01f,
-    1.201604843e+00f,
-    2.200041294e+00f,
-    1.741131186e+00f,
-    1.509455085e+00f,
-    1.957062006e+00f,
-    7.738495469e-01f,
-    1.126115680e+00f,
-    8.827587366e-01f,
-    7.629888058e-01f,
-    1.678366780e+00f,
-    9.977700114e-01f,
-    9.756985903e-01f,
-    6.407079101e-01f,
-    1.318261504e+00f,
-    1.062582970e+00f,
-    8.410651684e-01f,
-    1.211438060e+00f,
-    1.253974199e+00f,
-    7.471236587e-01f,
-    1.079400182e+00f,
-    8.199046254e-01f,
-    1.158685088e+00f,
-    1.045430422e+00f,
-    4.991703928e-01f,
-    6.753207445e-01f,
-    1.262541056e+00f,
-    1.194114447e+00f,
-    9.117606878e-01f,
-    6.764649153e-01f,
-    1.273763061e+00f,
-    7.749071717e-01f,
-    8.812108636e-01f,
-    8.326259255e-01f,
-    6.525143385e-01f,
-    1.041528702e+00f,
-    1.514975667e+00f,
-    4.936751127e-01f,
-    4.308212996e-01f,
-    7.078533173e-01f,
-    7.002520561e-01f,
-    1.577708602e+00f,
-    1.024138808e+00f,
-    9.402872324e-01f,
-    1.176889896e+00f,
-    1.489598513e+00f,
-    1.162290573e+00f,
-    9.812742472e-01f,
-    1.639870882e+00f,
-    8.953915834e-01f,
-    7.759351730e-01f,
-    6.465969682e-01f,
-    9.018744826e-01f,
-    1.499333739e+00f,
-    6.619009376e-01f,
-    2.070512772e+00f,
-    8.058963418e-01f,
-    6.666353941e-01f,
-    5.408616066e-01f,
-    1.107606649e+00f,
-    9.786463380e-01f,
-    8.052822948e-01f,
-    1.483815193e+00f,
-    6.059584022e-01f,
-    1.241428494e+00f,
-    1.076473355e+00f,
-    1.069548249e+00f,
-    7.806978822e-01f,
-    6.699074507e-01f,
-    1.094139338e+00f,
-    6.567711830e-01f,
-    1.712193370e+00f,
-    8.920438886e-01f,
-    1.262410283e+00f,
-    7.505646944e-01f,
-    1.117626548e+00f,
-    1.185907006e+00f,
-    9.266575575e-01f,
-    1.527543902e+00f,
-    8.947299719e-01f,
-    1.502080917e+00f,
-    8.357924223e-01f,
-    1.223537564e+00f,
-    1.129432440e+00f,
-    7.785111070e-01f,
-    7.367872596e-01f,
-    5.752537251e-01f,
-    1.373587012e+00f,
-    6.950607896e-01f,
-    8.844289780e-01f,
-    8.696777821e-01f,
-    6.100355983e-01f,
-    1.382945538e+00f,
-    1.014269352e+00f,
-    8.796841502e-01f,
-    1.313908219e+00f,
-    1.052839518e+00f,
-    9.387223721e-01f,
-    1.663521290e+00f,
-    7.704656720e-01f,
-    1.027190924e+00f,
-    8.184639215e-01f,
-    7.877733707e-01f,
-    1.130390048e+00f,
-    8.715881109e-01f,
-    1.266480923e+00f,
-    1.524456739e+00f,
-    1.482444644e+00f,
-    1.303315878e+00f,
-    5.651447773e-01f,
-    5.520001650e-01f,
-    2.508782148e+00f,
-    1.269644499e+00f,
-    6.379920244e-01f,
-    1.108233690e+00f,
-    1.230048895e+00f,
-    8.411962390e-01f,
-    1.439259291e+00f,
-    7.781776190e-01f,
-    8.666949272e-01f,
-    9.405554533e-01f,
-    1.373057842e+00f,
-    8.757138252e-01f,
-    9.377416968e-01f,
-    1.156188250e+00f,
-    2.242855310e+00f,
-    1.467275023e+00f,
-    8.865919709e-01f,
-    1.670357227e+00f,
-    8.996595144e-01f,
-    2.056769371e+00f,
-    1.417564273e+00f,
-    1.616273999e+00f,
-    8.242688179e-01f,
-    5.686151981e-01f,
-    8.339749575e-01f,
-    1.063195229e+00f,
-    7.071053386e-01f,
-    1.064817429e+00f,
-    2.020438194e+00f,
-    1.209927917e+00f,
-    1.316315770e+00f,
-    4.781187773e-01f,
-    1.185084105e+00f,
-    1.119516730e+00f,
-    1.010225654e+00f,
-    2.165700912e+00f,
-    6.997308135e-01f,
-    8.333390951e-01f,
-    1.074101567e+00f,
-    5.034914017e-01f,
-    1.284793258e+00f,
-    6.929712296e-01f,
-    1.297794580e+00f,
-    1.006102562e+00f,
-    1.300918937e+00f,
-    9.090377688e-01f,
-    9.511857629e-01f,
-    1.134636283e+00f,
-    9.534689188e-01f,
-    7.050277591e-01f,
-    7.573905587e-01f,
-    7.356806993e-01f,
-    1.329783320e+00f,
-    1.256400704e+00f,
-    1.288854241e+00f,
-    1.096790552e+00f,
-    1.127454042e+00f,
-    1.064802647e+00f,
-    1.823344231e+00f,
-    6.831233501e-01f,
-    5.346460342e-01f,
-    1.546434045e+00f,
-    1.656386495e+00f,
-    1.051814079e+00f,
-    4.989103973e-01f,
-    2.207098722e+00f,
-    1.407188773e+00f,
-    7.005822659e-01f,
-    1.184891582e+00f,
-    1.326848984e+00f,
-    4.243934155e-01f,
-    6.515154839e-01f,
-    8.048343062e-01f,
-    6.425896883e-01f,
-    1.203250885e+00f,
-    6.774805188e-01f,
-    8.791597486e-01f,
-    9.487451315e-01f,
-    9.730667472e-01f,
-    5.524685979e-01f,
-    5.322296023e-01f,
-    5.921413898e-01f,
-    1.656349540e+00f,
-    1.627815962e+00f,
-    9.856390953e-01f,
-    1.273712993e+00f,
-    1.318876863e+00f,
-    1.243612170e+00f,
-    1.086814523e+00f,
-    6.784495711e-01f,
-    1.786948442e+00f,
-    2.025310278e+00f,
-    6.445037723e-01f,
-    7.722703815e-01f,
-    6.683772206e-01f,
-    8.694027066e-01f,
-    9.292867184e-01f,
-    9.275868535e-01f,
-    9.503419399e-01f,
-    1.879732609e+00f,
-    7.478685379e-01f,
-    1.590312839e+00f,
-    1.111932039e+00f,
-    8.584803939e-01f,
-    1.866023660e+00f,
-    1.553569794e+00f,
-    1.413870931e+00f,
-    6.812821031e-01f,
-    1.199123263e+00f,
-    5.132413507e-01f,
-    1.539673567e+00f,
-    5.851397514e-01f,
-    9.616657495e-01f,
-    8.900812268e-01f,
-    1.040179968e+00f,
-    1.241576433e+00f,
-    1.193172216e+00f,
-    1.049793005e+00f,
-    5.721585751e-01f,
-    1.462772727e+00f,
-    8.327213526e-01f,
-    4.630914330e-01f,
-    1.448206782e+00f,
-    3.527832031e-01f,
-    6.826105714e-01f,
-    1.124309421e+00f,
-    1.159151316e+00f,
-    5.009620786e-01f,
-    8.978417516e-01f,
-    8.162381649e-01f,
-    7.616220713e-01f,
-    1.245041490e+00f,
-    9.051611423e-01f,
-    9.297937751e-01f,
-    1.241725206e+00f,
-    8.348987699e-01f,
-    7.418982983e-01f,
-    8.284089565e-01f,
-    1.281366467e+00f,
-    5.312644243e-01f,
-    8.502498269e-01f,
-    7.591973543e-01f,
-    1.411048412e+00f,
-    9.732949138e-01f,
-    2.188895464e+00f,
-    1.396542668e+00f,
-    1.107115746e+00f,
-    6.509698629e-01f,
-    1.367269158e+00f,
-    8.648216128e-01f,
-    1.663263440e+00f,
-    5.642139316e-01f,
-    5.976275206e-01f,
-    2.003410101e+00f,
-    6.833616495e-01f,
-    1.765752554e+00f,
-    1.183962703e+00f,
-    1.675504923e+00f,
-    7.313073874e-01f,
-    9.253666401e-01f,
-    8.955797553e-01f,
-    1.323859215e+00f,
-    4.105101228e-01f,
-    1.007837653e+00f,
-    1.137614489e+00f,
-    6.505501866e-01f,
-    5.707632303e-01f,
-    1.818316221e+00f,
-    1.065694928e+00f,
-    1.123489499e+00f,
-    1.252292991e+00f,
-    1.044922352e+00f,
-    1.040926456e+00f,
-    6.348289251e-01f,
-    7.786795497e-01f,
-    1.031024456e+00f,
-    6.089630723e-01f,
-    2.422307253e+00f,
-    9.201738238e-01f,
-    1.569548607e+00f,
-    1.057337523e+00f,
-    1.338240504e+00f,
-    1.856787801e+00f,
-    1.640491843e+00f,
-    1.643520236e+00f,
-    8.807811141e-01f,
-    1.505465031e+00f,
-    1.130404592e+00f,
-    7.708677649e-01f,
-    6.440494657e-01f,
-    7.831829786e-01f,
-    1.937138796e+00f,
-    1.514985919e+00f,
-    7.446192503e-01f,
-    5.752635598e-01f,
-    3.773308694e-01f,
-    5.957908630e-01f,
-    1.503778219e+00f,
-    8.833748698e-01f,
-    7.601189017e-01f,
-    1.719188333e+00f,
-    1.453395009e+00f,
-    1.534957528e+00f,
-    1.012338400e+00f,
-    7.444517612e-01f,
-    1.156579971e+00f,
-    8.266952634e-01f,
-    1.337905884e+00f,
-    8.768619895e-01f,
-    9.842253923e-01f,
-    1.167669773e+00f,
-    8.130050302e-01f,
-    8.041388392e-01f,
-    5.433372259e-01f,
-    1.086618304e+00f,
-    9.626404047e-01f,
-    1.076999903e+00f,
-    1.111239433e+00f,
-    1.403520584e+00f,
-    8.608974814e-01f,
-    5.705356002e-01f,
-    2.118860722e+00f,
-    1.296694398e+00f,
-    1.345213890e+00f,
-    8.221310377e-01f,
-    4.142252803e-01f,
-    7.535963058e-01f,
-    7.785983682e-01f,
-    4.685575366e-01f,
-    1.874626875e+00f,
-    8.420581818e-01f,
-    1.367615223e+00f,
-    4.093890488e-01f,
-    7.903404236e-01f,
-    5.784415007e-01f,
-    6.751545072e-01f,
-    1.436065435e+00f,
-    8.537573814e-01f,
-    5.363561511e-01f,
-    1.106386900e+00f,
-    1.060623646e+00f,
-    8.046864271e-01f,
-    6.499778628e-01f,
-    6.503947973e-01f,
-    9.965368509e-01f,
-    6.362960339e-01f,
-    7.190567255e-01f,
-    1.532316804e+00f,
-    1.570087790e+00f,
-    1.174270749e+00f,
-    1.037259459e+00f,
-    1.288507223e+00f,
-    1.255338192e+00f,
-    5.824148059e-01f,
-    6.431433558e-01f,
-    5.248008370e-01f,
-    1.101895332e+00f,
-    7.596229315e-01f,
-    1.057276845e+00f,
-    6.074501872e-01f,
-    5.368696451e-01f,
-    9.888201356e-01f,
-    4.325597584e-01f,
-    1.286259413e+00f,
-    1.066665053e+00f,
-    1.914998412e+00f,
-    1.100537300e+00f,
-    1.337494373e+00f,
-    1.028744578e+00f,
-    7.903459072e-01f,
-    1.096432328e+00f,
-    1.539492488e+00f,
-    1.426832914e+00f,
-    9.262263179e-01f,
-    8.054893017e-01f,
-    1.139371872e+00f,
-    4.346420765e-01f,
-    7.765455842e-01f,
-    8.742280006e-01f,
-    8.746877313e-01f,
-    1.061506510e+00f,
-    9.554933310e-01f,
-    5.777189732e-01f,
-    8.754175305e-01f,
-    2.147906542e+00f,
-    1.045162797e+00f,
-    5.048563480e-01f,
-    7.233784795e-01f,
-    9.009293318e-01f,
-    1.058266163e+00f,
-    1.026199341e+00f,
-    1.381640434e+00f,
-    1.291017890e+00f,
-    8.763483167e-01f,
-    6.544676423e-01f,
-    8.611348271e-01f,
-    5.117093921e-01f,
-    1.010703802e+00f,
-    1.072748542e+00f,
-    1.534742832e+00f,
-    1.128400564e+00f,
-    4.224337637e-01f,
-    6.439707875e-01f,
-    2.353327990e+00f,
-    6.080065370e-01f,
-    1.202488899e+00f,
-    7.647299170e-01f,
-    4.499383867e-01f,
-    1.191698790e+00f,
-    1.915400505e+00f,
-    1.246760249e+00f,
-    1.480493188e+00f,
-    8.522659540e-01f,
-    8.316564560e-01f,
-    6.227734685e-01f,
-    1.482178688e+00f,
-    1.925566196e+00f,
-    1.216068149e+00f,
-    1.384957194e+00f,
-    7.116765976e-01f,
-    1.093487382e+00f,
-    1.034461975e+00f,
-    8.528843522e-01f,
-    6.404865384e-01f,
-    8.326875567e-01f,
-    8.520513773e-01f,
-    6.831136942e-01f,
-    1.541182160e+00f,
-    1.376729012e+00f,
-    9.260346889e-01f,
-    5.950249434e-01f,
-    1.407474041e+00f,
-    7.562109232e-01f,
-    7.969625592e-01f,
-    6.805872321e-01f,
-    1.795443177e+00f,
-    1.076290369e+00f,
-    1.363155961e+00f,
-    6.446560621e-01f,
-    1.997131348e+00f,
-    5.839595199e-01f,
-    6.605390906e-01f,
-    9.707169533e-01f,
-    9.657936692e-01f,
-    9.993805289e-01f,
-    9.073149562e-01f,
-    1.751047730e+00f,
-    1.582656264e+00f,
-    7.257622480e-01f,
-    1.387689233e+00f,
-    6.914412975e-01f,
-    1.723491907e+00f,
-    7.997449040e-01f,
-    1.376374483e+00f,
-    9.638543725e-01f,
-    8.700298071e-01f,
-    5.128974319e-01f,
-    1.355524540e+00f,
-    1.477237940e+00f,
-    8.395926952e-01f,
-    2.053584099e+00f,
-    7.201656699e-01f,
-    1.099958420e+00f,
-    5.070463419e-01f,
-    1.578372002e+00f,
-    1.064876556e+00f,
-    1.068985581e+00f,
-    1.439138412e+00f,
-    2.212873936e+00f,
-    3.454009593e-01f,
-    1.574929833e+00f,
-    7.984710932e-01f,
-    8.503584266e-01f,
-    6.518879533e-01f,
-    8.489227891e-01f,
-    9.390327334e-01f,
-    1.077700973e+00f,
-    1.098601460e+00f,
-    1.536760688e+00f,
-    1.209802270e+00f,
-    1.159046531e+00f,
-    1.580067396e+00f,
-    6.936788559e-01f,
-    2.595833302e+00f,
-    2.208431005e+00f,
-    2.761449337e+00f,
-    6.606729627e-01f,
-    9.032176733e-01f,
-    7.312755585e-01f,
-    1.927756429e+00f,
-    9.045806527e-01f,
-    1.593502879e+00f,
-    9.821875095e-01f,
-    1.548082948e+00f,
-    1.011292458e+00f,
-    7.895162106e-01f,
-    1.014752865e+00f,
-    9.738849998e-01f,
-    5.823568106e-01f,
-    9.690968990e-01f,
-    1.463587165e+00f,
-    1.260959506e+00f,
-    1.449980378e+00f,
-    9.649983644e-01f,
-    1.809498429e+00f,
-    9.829517603e-01f,
-    2.994083166e+00f,
-    1.256143093e+00f,
-    5.748994946e-01f,
-    1.117173314e+00f,
-    1.038896084e+00f,
-    1.279308677e+00f,
-    1.692825437e+00f,
-    1.467533588e+00f,
-    6.578279138e-01f,
-    1.391546369e+00f,
-    1.906697512e+00f,
-    1.086994886e+00f,
-    1.331547856e+00f,
-    1.383535862e+00f,
-    1.037886739e+00f,
-    1.434214711e+00f,
-    1.068764925e+00f,
-    8.391678929e-01f,
-    1.539056420e+00f,
-    8.524155617e-01f,
-    6.176816225e-01f,
-    1.297174931e+00f,
-    9.091830850e-01f,
-    8.302272558e-01f,
-    1.207596302e+00f,
-    1.207781792e+00f,
-    9.675377011e-01f,
-    1.727768779e+00f,
-    1.402191997e+00f,
-    6.295426488e-01f,
-    8.705105186e-01f,
-    1.793741584e+00f,
-    5.453590155e-01f,
-    1.631769419e+00f,
-    7.401781082e-01f,
-    1.250123858e+00f,
-    1.075507760e+00f,
-    1.246389270e+00f,
-    1.145303845e+00f,
-    1.030043960e+00f,
-    7.604125142e-01f,
-    9.253248572e-01f,
-    9.718964696e-01f,
-    1.046425819e+00f,
-    6.056527495e-01f,
-    1.719017148e+00f,
-    8.379324675e-01f,
-    3.658604026e-01f,
-    8.355860710e-01f,
-    7.434995174e-01f,
-    1.734562755e+00f,
-    9.425212145e-01f,
-    5.947515965e-01f,
-    1.453743100e+00f,
-    1.562747240e+00f,
-    5.974130630e-01f,
-    1.086706161e+00f,
-    9.739740491e-01f,
-    1.220896959e+00f,
-    1.153313637e+00f,
-    8.352459073e-01f,
-    8.906710744e-01f,
-    1.026167393e+00f,
-    7.417662740e-01f,
-    8.534781337e-01f,
-    7.550085187e-01f,
-    1.291415572e+00f,
-    1.252497196e+00f,
-    1.499741673e+00f,
-    8.378916383e-01f,
-    9.096332192e-01f,
-    1.106423140e+00f,
-    8.858480453e-01f,
-    1.134129286e+00f,
-    5.147355795e-01f,
-    1.116712689e+00f,
-    1.283634663e+00f,
-    9.476429820e-01f,
-    1.755933523e+00f,
-    2.158787012e+00f,
-    1.373771548e+00f,
-    1.968664646e+00f,
-    1.365401626e+00f,
-    1.666893363e+00f,
-    8.122403622e-01f,
-    1.050099134e+00f,
-    5.103469491e-01f,
-    1.332300305e+00f,
-    1.158505321e+00f,
-    6.381009817e-01f,
-    1.510528684e+00f,
-    9.557839036e-01f,
-    1.872239947e+00f,
-    5.763892531e-01f,
-    1.436190963e+00f,
-    7.403222919e-01f,
-    1.154088855e+00f,
-    6.447019577e-01f,
-    1.099802017e+00f,
-    1.486262083e+00f,
-    1.149560571e+00f,
-    1.238922954e+00f,
-    1.318140268e+00f,
-    9.683650732e-01f,
-    7.866499424e-01f,
-    6.754837632e-01f,
-    8.653296232e-01f,
-    9.153480530e-01f,
-    6.591627598e-01f,
-    8.634253740e-01f,
-    1.593747497e+00f,
-    8.325417042e-01f,
-    1.401558518e+00f,
-    9.666696191e-01f,
-    8.187797070e-01f,
-    1.460315824e+00f,
-    1.455433369e+00f,
-    1.445294142e+00f,
-    1.036956668e+00f,
-    6.439867020e-01f,
-    7.788594365e-01f,
-    5.256307125e-01f,
-    7.150834203e-01f,
-    1.654544473e+00f,
-    1.011252999e+00f,
-    1.423720360e+00f,
-    1.073331714e+00f,
-    5.088879466e-01f,
-    9.705894589e-01f,
-    1.266577840e+00f,
-    1.089293838e+00f,
-    6.301680803e-01f,
-    2.309697151e+00f,
-    8.413743377e-01f,
-    1.584902525e+00f,
-    8.075664043e-01f,
-    1.040004969e+00f,
-    8.372136354e-01f,
-    1.676231384e+00f,
-    7.379729152e-01f,
-    1.081160903e+00f,
-    1.783832669e+00f,
-    1.166264176e+00f,
-    9.452863336e-01f,
-    9.656216502e-01f,
-    1.354755402e+00f,
-    7.013173699e-01f,
-    6.366744041e-01f,
-    1.599772692e+00f,
-    1.065964937e+00f,
-    1.002050161e+00f,
-    9.349372983e-01f,
-    7.851242423e-01f,
-    7.067385912e-01f,
-    1.466418505e+00f,
-    1.107118845e+00f,
-    7.843813300e-01f,
-    1.231909990e+00f,
-    1.123064995e+00f,
-    8.488377333e-01f,
-    1.010124683e+00f,
-    1.046857238e+00f,
-    1.539482117e+00f,
-    1.502376795e+00f,
-    7.537893057e-01f,
-    1.499780178e+00f,
-    7.910904884e-01f,
-    5.602080226e-01f,
-    1.083420277e+00f,
-    9.462612271e-01f,
-    8.773018718e-01f,
-    1.315123081e+00f,
-    1.396242499e+00f,
-    1.117533326e+00f,
-    1.304768443e+00f,
-    1.337002754e+00f,
-    1.003053308e+00f,
-    6.795074344e-01f,
-    9.351817369e-01f,
-    1.471137285e+00f,
-    1.567612410e+00f,
-    8.048695922e-01f,
-    6.112235785e-01f,
-    1.177515030e+00f,
-    1.006032705e+00f,
-    1.120880485e+00f,
-    9.833720326e-01f,
-    6.275616288e-01f,
-    8.165348768e-01f,
-    1.088262320e+00f,
-    7.303459048e-01f,
-    6.813793182e-01f,
-    1.400330305e+00f,
-    1.155479908e+00f,
-    1.070095062e+00f,
-    7.849640250e-01f,
-    8.984038234e-01f,
-    1.263051271e+00f,
-    9.530456066e-01f,
-    8.666602373e-01f,
-    1.119410872e+00f,
-    6.914436817e-01f,
-    1.374301672e+00f,
-    5.657404661e-01f,
-    1.058126211e+00f,
-    8.137752414e-01f,
-    9.215962887e-01f,
-    2.857363224e+00f,
-    1.172687888e+00f,
-    1.057683587e+00f,
-    9.318329692e-01f,
-    8.572583199e-01f,
-    8.652737737e-01f,
-    6.115387678e-01f,
-    7.783977985e-01f,
-    7.440469861e-01f,
-    9.519817829e-01f,
-    8.162947893e-01f,
-    1.054702759e+00f,
-    9.693710208e-01f,
-    1.062600732e+00f,
-    7.631663680e-01f,
-    1.104606152e+00f,
-    7.063886523e-01f,
-    1.794169784e+00f,
-    1.452337742e+00f,
-    1.314845204e+00f,
-    1.277854800e+00f,
-    1.347914219e+00f,
-    1.875203729e+00f,
-    8.765742779e-01f,
-    1.088546038e+00f,
-    5.836142302e-01f,
-    1.646827221e+00f,
-    7.039128542e-01f,
-    6.048878431e-01f,
-    5.610494018e-01f,
-    1.003473401e+00f,
-    1.170403242e+00f,
-    7.055888176e-01f,
-    6.685870886e-01f,
-    7.295376062e-01f,
-    1.431462765e+00f,
-    9.102075100e-01f,
-    1.056762457e+00f,
-    9.457427859e-01f,
-    6.961282492e-01f,
-    1.764358044e+00f,
-    9.595922828e-01f,
-    7.069723606e-01f,
-    1.408486724e+00f,
-    6.210473776e-01f,
-    7.767913938e-01f,
-    7.965365648e-01f,
-    1.063962698e+00f,
-    1.103468776e+00f,
-    1.217122793e+00f,
-    7.763962746e-01f,
-    1.057530999e+00f,
-    1.101182342e+00f,
-    1.229341030e+00f,
-    1.283118010e+00f,
-    8.941041827e-01f,
-    1.338747740e+00f,
-    8.491132855e-01f,
-    1.185037136e+00f,
-    1.313830972e+00f,
-    1.037724376e+00f,
-    1.140156627e+00f,
-    7.531491518e-01f,
-    7.563826442e-01f,
-    5.215264559e-01f,
-    1.129139185e+00f,
-    1.040644646e+00f,
-    5.167267919e-01f,
-    9.708125591e-01f,
-    9.962254167e-01f,
-    3.559468091e-01f,
-    8.228424788e-01f,
-    2.520857573e+00f,
-    8.165189624e-01f,
-    7.026311159e-01f,
-    1.026634812e+00f,
-    6.515538692e-01f,
-    9.575385451e-01f,
-    6.680628061e-01f,
-    7.866817117e-01f,
-    1.534323692e+00f,
-    1.932284594e+00f,
-    1.929760098e+00f,
-    1.271667123e+00f,
-    1.104184389e+00f,
-    9.608166218e-01f,
-    1.270669222e+00f,
-    2.491521358e+00f,
-    9.311302900e-01f,
-    7.656638622e-01f,
-    8.477354646e-01f,
-    1.798384190e+00f,
-    8.574047685e-01f,
-    6.937802434e-01f,
-    1.688645363e+00f,
-    9.946630597e-01f,
-    9.057235122e-01f,
-    8.317735791e-01f,
-    1.546048045e+00f,
-    1.908092380e+00f,
-    1.142795563e+00f,
-    1.353275895e+00f,
-    1.588976026e+00f,
-    2.072882891e+00f,
-    8.104988337e-01f,
-    9.962384105e-01f,
-    9.425787330e-01f,
-    6.875724196e-01f,
-    8.159682155e-01f,
-    1.941336870e+00f,
-    7.935899496e-01f,
-    1.094377995e+00f,
-    7.262142897e-01f,
-    8.549915552e-01f,
-    5.188740492e-01f,
-    8.666222095e-01f,
-    9.515934587e-01f,
-    5.050388575e-01f,
-    8.634376526e-01f,
-    1.240973949e+00f,
-    1.447674274e+00f,
-    1.796992064e+00f,
-    8.979448080e-01f,
-    1.233608842e+00f,
-    6.965789795e-01f,
-    9.290775061e-01f,
-    9.898007512e-01f,
-    1.148185134e+00f,
-    1.127847075e+00f,
-    1.101954103e+00f,
-    7.061703205e-01f,
-    7.921009660e-01f,
-    1.595940590e+00f,
-    1.192221403e+00f,
-    2.441495419e+00f,
-    2.021900892e+00f,
-    1.001517892e+00f,
-    9.745858312e-01f,
-    1.160464883e+00f,
-    8.706882000e-01f,
-    1.185778022e+00f,
-    1.334626317e+00f,
-    5.384092927e-01f,
-    1.699046254e+00f,
-    1.543237329e+00f,
-    6.523982286e-01f,
-    1.087090492e+00f,
-    7.259209156e-01f,
-    1.177658916e+00f,
-    1.290930152e+00f,
-    7.006383538e-01f,
-    7.972003222e-01f,
-    1.203817010e+00f,
-    8.159451485e-01f,
-    1.169596434e+00f,
-    7.704734802e-01f,
-    1.064330101e+00f,
-    8.745511770e-01f,
-    6.988998652e-01f,
-    9.328324795e-01f,
-    9.539505243e-01f,
-    8.224090338e-01f,
-    9.228903651e-01f,
-    1.206265211e+00f,
-    1.036806822e+00f,
-    1.062947750e+00f,
-    1.646022201e+00f,
-    6.442435980e-01f,
-    1.139093161e+00f,
-    1.177042127e+00f,
-    1.020385027e+00f,
-    1.184182286e+00f,
-    7.905332446e-01f,
-    1.829209805e+00f,
-    1.128950715e+00f,
-    9.953924417e-01f,
-    8.330356479e-01f,
-    1.068809032e+00f,
-    1.492767215e+00f,
-    7.146465182e-01f,
-    9.842947721e-01f,
-    7.014756799e-01f,
-    1.237842321e+00f,
-    1.069648623e+00f,
-    7.015141845e-01f,
-    9.240978360e-01f,
-    1.071412444e+00f,
-    9.586625099e-01f,
-    1.177849412e+00f,
-    7.805943489e-01f,
-    1.548689842e+00f,
-    1.311755061e+00f,
-    5.547918081e-01f,
-    1.463088632e+00f,
-    1.076592207e+00f,
-    2.631381750e-01f,
-    2.038672447e+00f,
-    1.084801674e+00f,
-    1.565676689e+00f,
-    1.194509745e+00f,
-    1.842623591e+00f,
-    2.039170742e+00f,
-    1.238667369e+00f,
-    1.745832562e+00f,
-    1.325904489e+00f,
-    1.686056852e+00f,
-    4.698905349e-01f,
-    1.343602061e+00f,
-    8.166800141e-01f,
-    7.393328547e-01f,
-    1.151740551e+00f,
-    1.496253729e+00f,
-    4.601678252e-01f,
-    2.900551796e+00f,
-    5.032539368e-01f,
-    7.176284194e-01f,
-    7.099004388e-01f,
-    1.423379183e+00f,
-    6.913700104e-01f,
-    4.340638220e-01f,
-    1.271223903e+00f,
-    1.548555732e+00f,
-    6.419125795e-01f,
-    8.384974599e-01f,
-    9.295013547e-01f,
-    5.967439413e-01f,
-    6.935113668e-01f,
-    7.459712029e-01f,
-    1.117266536e+00f,
-    5.736019015e-01f,
-    1.461563945e+00f,
-    1.527480245e+00f,
-    8.810290694e-01f,
-    9.014574885e-01f,
-    9.801565409e-01f,
-    1.785431385e+00f,
-    8.229598999e-01f,
-    1.255979061e+00f,
-    9.214500189e-01f,
-    1.095366001e+00f,
-    1.164149880e+00f,
-    8.073299527e-01f,
-    1.098796844e+00f,
-    7.901211381e-01f,
-    9.061148167e-01f,
-    1.103873849e+00f,
-    1.192782760e+00f,
-    1.736979485e+00f,
-    7.936553359e-01f,
-    6.741300821e-01f,
-    1.504909754e+00f,
-    1.146723628e+00f,
-    1.059171677e+00f,
-    6.908611059e-01f,
-    1.035747647e+00f,
-    8.499783874e-01f,
-    1.982801318e+00f,
-    1.187202096e+00f,
-    7.455433011e-01f,
-    8.701319695e-01f,
-    1.340022564e+00f,
-    7.292528749e-01f,
-    1.398447514e+00f,
-    1.364595532e+00f,
-    1.179634929e+00f,
-    7.560189366e-01f,
-    1.284898043e+00f,
-    7.711554766e-01f,
-    1.177424788e+00f,
-    1.244872451e+00f,
-    9.288268089e-01f,
-    8.377193809e-01f,
-    1.018092513e+00f,
-    1.010648370e+00f,
-    1.064069748e+00f,
-    8.467575312e-01f,
-    8.944792151e-01f,
-    1.207843423e+00f,
-    8.624574542e-01f,
-    7.453706861e-01f,
-    8.158561587e-01f,
-    8.790509701e-01f,
-    1.031250000e+00f,
-    8.540215492e-01f,
-    2.160726309e+00f,
-    1.162434816e+00f,
-    1.046872139e+00f,
-    1.206034184e+00f,
-    1.062656999e+00f,
-    1.342888236e+00f,
-    1.128606796e+00f,
-    1.183527231e+00f,
-    1.228589416e+00f,
-    6.555176377e-01f,
-    8.566362858e-01f,
-    1.076979399e+00f,
-    1.035943389e+00f,
-    9.083900452e-01f,
-    1.210807443e+00f,
-    1.145880580e+00f,
-    1.003272295e+00f,
-    1.152452111e+00f,
-    1.768916249e+00f,
-    6.757712960e-01f,
-    1.375412822e+00f,
-    1.115314603e+00f,
-    1.332937479e+00f,
-    1.403601527e+00f,
-    1.059729695e+00f,
-    1.112784743e+00f,
-    1.098960161e+00f,
-    8.406866789e-01f,
-    7.103444934e-01f,
-    9.930818677e-01f,
-    8.611975312e-01f,
-    1.690853357e+00f,
-    1.200989962e+00f,
-    5.858406425e-01f,
-    7.638393641e-01f,
-    6.729065776e-01f,
-    7.523552775e-01f,
-    9.091050029e-01f,
-    6.193588376e-01f,
-    2.166154623e+00f,
-    1.048025846e+00f,
-    7.653078437e-01f,
-    1.087741613e+00f,
-    1.092194080e+00f,
-    1.062059522e+00f,
-    6.854456663e-01f,
-    7.011631131e-01f,
-    1.180765986e+00f,
-    1.430491567e+00f,
-    1.032697558e+00f,
-    2.032713175e+00f,
-    6.178216934e-01f,
-    1.029496431e+00f,
-    7.489118576e-01f,
-    6.068221331e-01f,
-    9.897575974e-01f,
-    1.116733193e+00f,
-    1.610312223e+00f,
-    1.341460109e+00f,
-    5.555521250e-01f,
-    7.799559236e-01f,
-    1.031760216e+00f,
-    1.212186337e+00f,
-    7.153033614e-01f,
-    7.470206022e-01f,
-    1.710512757e+00f,
-    9.943537712e-01f,
-    8.397839069e-01f,
-    1.280973911e+00f,
-    1.902043581e+00f,
-    1.688468218e+00f,
-    6.613341570e-01f,
-    1.228819251e+00f,
-    9.937334061e-01f,
-    1.393043637e+00f,
-    1.038222909e+00f,
-    1.209808588e+00f,
-    1.156980872e+00f,
-    1.889463544e+00f,
-    1.377684712e+00f,
-    6.275693774e-01f,
-    1.292764664e+00f,
-    2.068272114e+00f,
-    9.052290320e-01f,
-    7.604636550e-01f,
-    1.220438838e+00f,
-    1.238328695e+00f,
-    1.043728709e+00f,
-    1.397576451e+00f,
-    1.207769752e+00f,
-    1.132058859e+00f,
-    1.110016584e+00f,
-    1.643880963e+00f,
-    7.796959281e-01f,
-    1.418534398e+00f,
-    1.673574805e+00f,
-    1.097449899e+00f,
-    1.441507816e+00f,
-    2.076517820e+00f,
-    8.080949187e-01f,
-    1.507934570e+00f,
-    1.278906584e+00f,
-    1.010645628e+00f,
-    7.833063006e-01f,
-    2.098282576e+00f,
-    8.427761793e-01f,
-    1.465104699e+00f,
-    9.019733071e-01f,
-    1.161519527e+00f,
-    1.479293466e+00f,
-    1.221015692e+00f,
-    1.266504288e+00f,
-    1.325744987e+00f,
-    1.578887820e+00f,
-    7.461686730e-01f,
-    6.363659501e-01f,
-    1.032256126e+00f,
-    1.028700709e+00f,
-    9.416297674e-01f,
-    8.895591497e-01f,
-    8.790730834e-01f,
-    7.265765071e-01f,
-    1.313054562e+00f,
-    7.835758924e-01f,
-    8.628966212e-01f,
-    1.138137341e+00f,
-    1.021864772e+00f,
-    6.965509653e-01f,
-    1.506628752e+00f,
-    9.452483654e-01f,
-    7.490513325e-01f,
-    1.734532118e+00f,
-    9.039057493e-01f,
-    7.817504406e-01f,
-    8.504595757e-01f,
-    7.879846096e-01f,
-    1.094426036e+00f,
-    7.831543088e-01f,
-    1.204296827e+00f,
-    1.846583366e+00f,
-    1.852472901e+00f,
-    9.363771081e-01f,
-    6.620919704e-01f,
-    1.864169598e+00f,
-    7.548735142e-01f,
-    2.159919024e+00f,
-    1.686646581e+00f,
-    1.200670242e+00f,
-    8.119156361e-01f,
-    1.098038197e+00f,
-    1.249685407e+00f,
-    1.341919303e+00f,
-    1.038311124e+00f,
-    1.410830736e+00f,
-    7.111451626e-01f,
-    1.194641113e+00f,
-    8.172202110e-01f,
-    4.524084628e-01f,
-    1.229289293e+00f,
-    4.670471847e-01f,
-    7.718759179e-01f,
-    7.155568004e-01f,
-    5.107983947e-01f,
-    9.969537258e-01f,
-    9.531113505e-01f,
-    1.193849564e+00f,
-    1.382875323e+00f,
-    1.321105957e+00f,
-    8.746469021e-01f,
-    6.188065410e-01f,
-    7.085247040e-01f,
-    6.307730079e-01f,
-    1.055231214e+00f,
-    1.032061577e+00f,
-    2.527023077e+00f,
-    8.234474063e-01f,
-    1.054998517e+00f,
-    1.182789803e+00f,
-    7.287669182e-01f,
-    1.106740236e+00f,
-    9.283269644e-01f,
-    4.610008001e-01f,
-    7.714209557e-01f,
-    1.211898565e+00f,
-    9.816218615e-01f,
-    1.072126269e+00f,
-    4.979419112e-01f,
-    1.172410727e+00f,
-    1.197344661e+00f,
-    9.800566435e-01f,
-    9.558288455e-01f,
-    9.163097143e-01f,
-    6.130982637e-01f,
-    4.084782898e-01f,
-    7.570561767e-01f,
-    1.179798126e+00f,
-    8.933347464e-01f,
-    9.904727936e-01f,
-    6.162149906e-01f,
-    1.702155471e+00f,
-    1.098727465e+00f,
-    1.525253415e+00f,
-    1.019362688e+00f,
-    6.849238873e-01f,
-    1.464670777e+00f,
-    1.707389832e+00f,
-    1.314933777e+00f,
-    5.295006037e-01f,
-    2.379373789e+00f,
-    1.000428081e+00f,
-    1.028645873e+00f,
-    1.737001896e+00f,
-    1.118928909e+00f,
-    7.150071859e-01f,
-    8.868354559e-01f,
-    1.012019873e+00f,
-    9.751156569e-01f,
-    1.341361284e+00f,
-    4.124055505e-01f,
-    9.144474864e-01f,
-    7.465165257e-01f,
-    8.013464212e-01f,
-    1.493704915e+00f,
-    9.730694890e-01f,
-    1.337313294e+00f,
-    8.606173992e-01f,
-    1.248038173e+00f,
-    1.470880389e+00f,
-    7.502561808e-01f,
-    9.922031164e-01f,
-    1.460693717e+00f,
-    1.458661914e+00f,
-    9.010762572e-01f,
-    5.044918656e-01f,
-    1.122151256e+00f,
-    1.098277211e+00f,
-    1.321997166e+00f,
-    1.455733657e+00f,
-    1.174477458e+00f,
-    1.147513866e+00f,
-    7.351021767e-01f,
-    8.626074791e-01f,
-    7.375676632e-01f,
-    1.376240611e+00f,
-    1.027858138e+00f,
-    5.051874518e-01f,
-    1.345011353e+00f,
-    9.033777118e-01f,
-    6.498843431e-01f,
-    1.059890628e+00f,
-    1.019514799e+00f,
-    1.586533785e+00f,
-    8.391331434e-01f,
-    1.161283612e+00f,
-    1.005915642e+00f,
-    1.210683942e+00f,
-    1.258460522e+00f,
-    1.377584577e+00f,
-    6.674544811e-01f,
-    9.977270961e-01f,
-    7.895396352e-01f,
-    7.025392652e-01f,
-    8.079270124e-01f,
-    9.102112651e-01f,
-    1.430593491e+00f,
-    8.672018647e-01f,
-    1.397978902e+00f,
-    2.234415770e+00f,
-    9.332041740e-01f,
-    9.795339108e-01f,
-    9.774158597e-01f,
-    1.027820468e+00f,
-    1.172485828e+00f,
-    1.053691387e+00f,
-    5.926538110e-01f,
-    6.243733168e-01f,
-    7.512460351e-01f,
-    2.302768469e+00f,
-    8.551335931e-01f,
-    1.625641465e+00f,
-    1.505995274e+00f,
-    5.393456221e-01f,
-    1.134948969e+00f,
-    8.903711438e-01f,
-    1.290447712e+00f,
-    7.282593250e-01f,
-    8.030236959e-01f,
-    6.219177842e-01f,
-    1.598289967e+00f,
-    9.678648710e-01f,
-    9.971397519e-01f,
-    8.333446980e-01f,
-    1.304588795e+00f,
-    6.090750098e-01f,
-    7.316746712e-01f,
-    2.102524281e+00f,
-    9.372342229e-01f,
-    1.389138222e+00f,
-    1.582054973e+00f,
-    9.502186179e-01f,
-    1.184083462e+00f,
-    1.110991001e+00f,
-    8.067076802e-01f,
-    9.751865268e-01f,
-    6.702275872e-01f,
-    1.591148973e+00f,
-    1.122720599e+00f,
-    1.409248352e+00f,
-    2.171538591e+00f,
-    1.169569850e+00f,
-    1.324708462e+00f,
-    3.999057710e-01f,
-    1.304524183e+00f,
-    7.697128654e-01f,
-    6.991246939e-01f,
-    1.840452433e+00f,
-    8.550788760e-01f,
-    5.229256749e-01f,
-    1.455919623e+00f,
-    1.352779746e+00f,
-    7.801053524e-01f,
-    1.155695558e+00f,
-    6.558402181e-01f,
-    1.345300555e+00f,
-    8.531190157e-01f,
-    1.662800789e+00f,
-    4.930457473e-01f,
-    8.421626091e-01f,
-    1.044597507e+00f,
-    1.221143961e+00f,
-    8.212417364e-01f,
-    1.371789455e+00f,
-    1.044265032e+00f,
-    2.328536272e+00f,
-    1.322138071e+00f,
-    9.477929473e-01f,
-    1.031286359e+00f,
-    5.935974121e-01f,
-    1.233268023e+00f,
-    1.627591252e+00f,
-    1.185262918e+00f,
-    9.926719069e-01f,
-    1.271109581e+00f,
-    2.068927050e+00f,
-    1.187765837e+00f,
-    2.345197916e+00f,
-    7.724845409e-01f,
-    7.037478685e-01f,
-    9.586863518e-01f,
-    8.645153642e-01f,
-    6.700689793e-01f,
-    8.362159729e-01f,
-    1.251140952e+00f,
-    1.614075184e+00f,
-    1.889600277e+00f,
-    1.124370694e+00f,
-    8.046650887e-01f,
-    8.909064531e-01f,
-    4.627099633e-01f,
-    1.456149101e+00f,
-    1.510107279e+00f,
-    1.019189239e+00f,
-    9.247053266e-01f,
-    1.138039827e+00f,
-    1.023044229e+00f,
-    1.379890323e+00f,
-    1.656241059e+00f,
-    1.083453417e+00f,
-    1.831595540e+00f,
-    1.586163044e+00f,
-    1.272168994e+00f,
-    1.385965943e+00f,
-    1.587131858e+00f,
-    8.081453443e-01f,
-    1.235064983e+00f,
-    1.270730495e+00f,
-    1.141431093e+00f,
-    1.013902426e+00f,
-    9.442062378e-01f,
-    1.083502650e+00f,
-    6.130892038e-01f,
-    9.577375650e-01f,
-    1.157167673e+00f,
-    1.564433932e+00f,
-    9.225096703e-01f,
-    1.163920283e+00f,
-    1.910420179e+00f,
-    1.999234676e+00f,
-    8.821097016e-01f,
-    6.082977057e-01f,
-    1.019868374e+00f,
-    8.175769448e-01f,
-    9.563884139e-01f,
-    7.469707131e-01f,
-    9.020915031e-01f,
-    1.151590824e+00f,
-    1.005691171e+00f,
-    1.789872050e+00f,
-    1.107276559e+00f,
-    1.174946189e+00f,
-    6.071591377e-01f,
-    1.646150231e+00f,
-    1.201111436e+00f,
-    1.935664177e+00f,
-    1.242557883e+00f,
-    1.630526423e+00f,
-    9.943181872e-01f,
-    9.113109708e-01f,
-    1.211287141e+00f,
-    7.559776306e-01f,
-    8.747304678e-01f,
-    8.746389747e-01f,
-    1.054752946e+00f,
-    9.311538339e-01f,
-    8.008714914e-01f,
-    4.627479911e-01f,
-    8.078317046e-01f,
-    6.712811589e-01f,
-    1.426723719e+00f,
-    7.612255812e-01f,
-    1.072061539e+00f,
-    7.776189446e-01f,
-    9.377968907e-01f,
-    7.853470445e-01f,
-    3.949617445e-01f,
-    8.302996159e-01f,
-    1.110445857e+00f,
-    6.630925536e-01f,
-    1.340853691e+00f,
-    7.541224360e-01f,
-    1.197451472e+00f,
-    1.345565319e+00f,
-    1.150801897e+00f,
-    1.173914909e+00f,
-    5.549490452e-01f,
-    1.080489635e+00f,
-    1.099483728e+00f,
-    8.358650208e-01f,
-    1.410415411e+00f,
-    7.148671150e-01f,
-    9.312294722e-01f,
-    6.884673238e-01f,
-    1.162693262e+00f,
-    1.843676329e+00f,
-    8.764805794e-01f,
-    1.285586238e+00f,
-    1.240079403e+00f,
-    1.174726486e+00f,
-    6.076671481e-01f,
-    1.026787400e+00f,
-    9.165909290e-01f,
-    9.328579307e-01f,
-    1.083717465e+00f,
-    1.046923995e+00f,
-    2.311211586e+00f,
-    6.110469699e-01f,
-    9.810377359e-01f,
-    7.024541497e-01f,
-    8.161536455e-01f,
-    7.048688531e-01f,
-    6.278997064e-01f,
-    5.465696454e-01f,
-    6.703571677e-01f,
-    1.411701322e+00f,
-    9.575873017e-01f,
-    1.099948406e+00f,
-    7.868012190e-01f,
-    6.676607132e-01f,
-    5.573958158e-01f,
-    1.111110210e+00f,
-    1.097480416e+00f,
-    7.090856433e-01f,
-    1.041783929e+00f,
-    6.813986301e-01f,
-    1.267817497e+00f,
-    6.371757984e-01f,
-    9.797321558e-01f,
-    9.019062519e-01f,
-    1.534993887e+00f,
-    7.568367720e-01f,
-    7.131310701e-01f,
-    1.561219335e+00f,
-    8.474593759e-01f,
-    1.279219151e+00f,
-    6.517956257e-01f,
-    1.469137192e+00f,
-    1.183364391e+00f,
-    9.647614956e-01f,
-    9.716672301e-01f,
-    6.815573573e-01f,
-    6.885195971e-01f,
-    8.284893036e-01f,
-    8.420692086e-01f,
-    1.271798134e+00f,
-    1.066302538e+00f,
-    8.449040055e-01f,
-    9.371901751e-01f,
-    6.652452350e-01f,
-    1.571739912e+00f,
-    7.219423056e-01f,
-    1.062108994e+00f,
-    6.050171852e-01f,
-    9.713659883e-01f,
-    1.298765302e+00f,
-    9.362568855e-01f,
-    9.544762969e-01f,
-    1.907565117e+00f,
-    8.954477310e-01f,
-    4.383358061e-01f,
-    1.383402824e+00f,
-    1.485023737e+00f,
-    1.316943645e+00f,
-    7.472452521e-01f,
-    1.738114357e+00f,
-    1.014165759e+00f,
-    9.506712556e-01f,
-    8.271592259e-01f,
-    1.115664124e+00f,
-    1.167261958e+00f,
-    1.484094739e+00f,
-    8.282178044e-01f,
-    1.170444250e+00f,
-    2.373059273e+00f,
-    1.395796418e+00f,
-    1.326220036e+00f,
-    1.889858365e+00f,
-    7.767469883e-01f,
-    6.287682652e-01f,
-    9.902322292e-01f,
-    6.690743566e-01f,
-    1.422150373e+00f,
-    1.070858717e+00f,
-    1.211189151e+00f,
-    7.987964153e-01f,
-    6.902975440e-01f,
-    1.122279048e+00f,
-    5.712966919e-01f,
-    1.616087317e+00f,
-    8.945210576e-01f,
-    8.759676218e-01f,
-    8.717256188e-01f,
-    5.310481787e-01f,
-    8.655874133e-01f,
-    1.984718561e+00f,
-    1.049520850e+00f,
-    8.904941678e-01f,
-    1.228609800e+00f,
-    5.456423759e-01f,
-    6.113462448e-01f,
-    8.541857600e-01f,
-    6.742014289e-01f,
-    1.584440231e+00f,
-    9.140158892e-01f,
-    1.013923168e+00f,
-    8.477854133e-01f,
-    1.238606453e+00f,
-    1.009459257e+00f,
-    1.120393634e+00f,
-    6.185898781e-01f,
-    8.009991050e-01f,
-    6.283712387e-01f,
-    9.090490937e-01f,
-    1.441577077e+00f,
-    1.193748593e+00f,
-    1.062891245e+00f,
-    7.877503037e-01f,
-    1.400288224e+00f,
-    1.697219253e+00f,
-    6.958907843e-01f,
-    1.122354865e+00f,
-    1.589527965e+00f,
-    1.251545310e+00f,
-    1.690499425e+00f,
-    1.952302456e+00f,
-    9.861870408e-01f,
-    9.577890038e-01f,
-    1.301616192e+00f,
-    7.409737706e-01f,
-    9.948311448e-01f,
-    7.349945307e-01f,
-    1.075693369e+00f,
-    9.935739636e-01f,
-    1.369565845e+00f,
-    7.549795508e-01f,
-    8.974823952e-01f,
-    1.008033514e+00f,
-    2.847291708e+00f,
-    1.266427875e+00f,
-    1.985380173e+00f,
-    8.609817028e-01f,
-    1.790185809e+00f,
-    6.450436115e-01f,
-    9.968111515e-01f,
-    8.370029926e-01f,
-    5.957667232e-01f,
-    1.082913876e+00f,
-    8.967201710e-01f,
-    1.049925208e+00f,
-    1.001016617e+00f,
-    1.336045504e+00f,
-    9.635470510e-01f,
-    6.430435777e-01f,
-    1.237563968e+00f,
-    1.610801220e+00f,
-    1.109868646e+00f,
-    7.366856933e-01f,
-    7.808092833e-01f,
-    1.734307408e+00f,
-    8.490879536e-01f,
-    1.365439534e+00f,
-    9.362143874e-01f,
-    6.677286029e-01f,
-    1.178156257e+00f,
-    1.419328809e+00f,
-    7.189593911e-01f,
-    1.627456903e+00f,
-    1.036044359e+00f,
-    1.336187601e+00f,
-    2.460306883e+00f,
-    1.453314185e+00f,
-    8.409947157e-01f,
-    1.384186983e+00f,
-    1.850811601e+00f,
-    1.431322813e+00f,
-    1.411222935e+00f,
-    9.603595138e-01f,
-    1.208065391e+00f,
-    8.503790498e-01f,
-    1.126926780e+00f,
-    1.063822508e+00f,
-    1.725190043e+00f,
-    1.210530162e+00f,
-    1.028333426e+00f,
-    8.836548924e-01f,
-    1.355920434e+00f,
-    8.560730219e-01f,
-    9.809991121e-01f,
-    1.128212333e+00f,
-    9.219868183e-01f,
-    1.557906866e+00f,
-    6.306833029e-01f,
-    7.961692214e-01f,
-    1.306553960e+00f,
-    1.606500149e+00f,
-    1.068724632e+00f,
-    1.653554797e+00f,
-    1.045346737e+00f,
-    9.531410336e-01f,
-    1.230784416e+00f,
-    1.049241662e+00f,
-    9.621472359e-01f,
-    8.476486802e-01f,
-    1.111112237e+00f,
-    1.163008571e+00f,
-    5.974410176e-01f,
-    1.436678410e+00f,
-    1.309613466e+00f,
-    1.279284954e+00f,
-    8.842726350e-01f,
-    1.010640383e+00f,
-    1.086846471e+00f,
-    1.667123318e+00f,
-    6.545721292e-01f,
-    1.231552482e+00f,
-    9.060307145e-01f,
-    8.285326958e-01f,
-    1.004633069e+00f,
-    1.059331417e+00f,
-    1.503286958e+00f,
-    1.273541808e+00f,
-    1.075555444e+00f,
-    8.735921383e-01f,
-    4.899785519e-01f,
-    1.659231782e+00f,
-    1.575408101e+00f,
-    1.174756169e+00f,
-    1.036800146e+00f,
-    1.113361955e+00f,
-    1.190745354e+00f,
-    9.488254189e-01f,
-    8.042495251e-01f,
-    1.102509022e+00f,
-    1.159673810e+00f,
-    9.569605589e-01f,
-    1.536991477e+00f,
-    1.426633954e+00f,
-    2.985425472e+00f,
-    1.426773667e+00f,
-    1.390921116e+00f,
-    9.277130961e-01f,
-    1.200391054e+00f,
-    1.257204175e+00f,
-    4.683069885e-01f,
-    1.314830422e+00f,
-    1.185546637e+00f,
-    1.301572323e+00f,
-    1.411959887e+00f,
-    8.970150352e-01f,
-    1.156179667e+00f,
-    9.534100890e-01f,
-    8.445091248e-01f,
-    1.274313331e+00f,
-    2.259616375e+00f,
-    1.079691768e+00f,
-    1.324595571e+00f,
-    1.444667220e+00f,
-    1.169697523e+00f,
-    8.401376605e-01f,
-    9.843706489e-01f,
-    7.663171291e-01f,
-    1.260706306e+00f,
-    7.244801521e-01f,
-    7.425512671e-01f,
-    1.370591044e+00f,
-    9.970915318e-01f,
-    8.857812881e-01f,
-    1.738192797e+00f,
-    1.495483041e+00f,
-    1.183104634e+00f,
-    2.046041727e+00f,
-    1.902449131e+00f,
-    9.585446119e-01f,
-    1.131737232e+00f,
-    1.036028862e+00f,
-    1.112831354e+00f,
-    6.951030493e-01f,
-    7.361183763e-01f,
-    8.840620518e-01f,
-    1.412174582e+00f,
-    8.676480651e-01f,
-    8.627893329e-01f,
-    1.391596556e+00f,
-    1.502978802e+00f,
-    1.041883469e+00f,
-    8.589227796e-01f,
-    1.102348208e+00f,
-    9.585891366e-01f,
-    6.255924702e-01f,
-    1.482745886e+00f,
-    1.272329807e+00f,
-    9.483782053e-01f,
-    1.131632447e+00f,
-    6.907171011e-01f,
-    1.216315031e+00f,
-    1.613467097e+00f,
-    6.454887390e-01f,
-    1.242085099e+00f,
-    1.613506794e+00f,
-    1.541678905e+00f,
-    1.050414681e+00f,
-    9.822129011e-01f,
-    6.319745183e-01f,
-    1.238097906e+00f,
-    1.125884414e+00f,
-    6.190738082e-01f,
-    5.738590360e-01f,
-    5.025085807e-01f,
-    8.268058300e-01f,
-    1.494682789e+00f,
-    9.337519407e-01f,
-    1.607595682e+00f,
-    1.083068728e+00f,
-    8.526365757e-01f,
-    9.003759027e-01f,
-    1.675286889e+00f,
-    1.224439025e+00f,
-    1.183257937e+00f,
-    9.244244099e-01f,
-    1.767504811e+00f,
-    1.269335508e+00f,
-    8.428407311e-01f,
-    1.343201041e+00f,
-    6.868640184e-01f,
-    5.615000129e-01f,
-    6.839043498e-01f,
-    8.208789229e-01f,
-    6.104660034e-01f,
-    7.552473545e-01f,
-    9.990592003e-01f,
-    8.788058162e-01f,
-    1.881925106e+00f,
-    6.828388572e-01f,
-    1.699329495e+00f,
-    1.190241694e+00f,
-    1.351522565e+00f,
-    9.710165262e-01f,
-    7.102596164e-01f,
-    6.038863659e-01f,
-    7.884405255e-01f,
-    8.470152020e-01f,
-    8.161107302e-01f,
-    7.642909884e-01f,
-    1.682987928e+00f,
-    1.095263243e+00f,
-    8.518802524e-01f,
-    1.594793081e+00f,
-    1.036314368e+00f,
-    5.486137271e-01f,
-    9.497541189e-01f,
-    1.923118591e+00f,
-    1.037113667e+00f,
-    7.757817507e-01f,
-    7.325657010e-01f,
-    6.862126589e-01f,
-    1.043677092e+00f,
-    7.541391850e-01f,
-    8.348448873e-01f,
-    1.273779035e+00f,
-    7.924343944e-01f,
-    1.001459599e+00f,
-    1.027241468e+00f,
-    7.389071584e-01f,
-    1.201986432e+00f,
-    9.512472153e-01f,
-    5.650215149e-01f,
-    1.011356711e+00f,
-    1.393295527e+00f,
-    1.984374046e+00f,
-    1.149049759e+00f,
-    1.376112103e+00f,
-    1.111779928e+00f,
-    7.585572004e-01f,
-    7.245685458e-01f,
-    5.058395863e-01f,
-    1.356296897e+00f,
-    1.576524377e+00f,
-    1.088762999e+00f,
-    1.451461196e+00f,
-    1.220056772e+00f,
-    1.213631988e+00f,
-    6.718971729e-01f,
-    8.935508132e-01f,
-    1.106068373e+00f,
-    1.106368542e+00f,
-    7.580091357e-01f,
-    1.324835420e+00f,
-    7.214654684e-01f,
-    7.872236967e-01f,
-    1.029308796e+00f,
-    1.125407338e+00f,
-    7.806406617e-01f,
-    7.366810441e-01f,
-    1.277178288e+00f,
-    5.735457540e-01f,
-    1.111774087e+00f,
-    7.741523981e-01f,
-    1.108117104e+00f,
-    9.794908762e-01f,
-    8.448459506e-01f,
-    1.065197587e+00f,
-    1.526270270e+00f,
-    1.610604882e+00f,
-    3.402519464e+00f,
-    9.448797703e-01f,
-    1.261971951e+00f,
-    2.231899023e+00f,
-    1.526019335e+00f,
-    1.060888410e+00f,
-    1.409762740e+00f,
-    9.889426231e-01f,
-    9.105625153e-01f,
-    8.037505746e-01f,
-    1.155232787e+00f,
-    6.858093143e-01f,
-    4.588798583e-01f,
-    1.297897220e+00f,
-    8.179536462e-01f,
-    8.317924142e-01f,
-    1.289018631e+00f,
-    7.676683068e-01f,
-    1.525615096e+00f,
-    1.180515409e+00f,
-    1.267319918e+00f,
-    1.348123789e+00f,
-    9.695808291e-01f,
-    1.035853267e+00f,
-    9.940422177e-01f,
-    1.173929095e+00f,
-    9.195759892e-01f,
-    8.339248896e-01f,
-    1.856766343e+00f,
-    1.063683867e+00f,
-    9.710709453e-01f,
-    1.365473151e+00f,
-    8.024244905e-01f,
-    1.645747066e+00f,
-    1.441068053e+00f,
-    8.922718763e-01f,
-    1.155381560e+00f,
-    1.080076218e+00f,
-    9.524257183e-01f,
-    1.329134703e+00f,
-    1.407586813e+00f,
-    8.750865459e-01f,
-    1.132722974e+00f,
-    9.127586484e-01f,
-    1.074489832e+00f,
-    1.123681307e+00f,
-    1.028492808e+00f,
-    6.279201508e-01f,
-    1.012526870e+00f,
-    1.811020732e+00f,
-    7.998743653e-01f,
-    7.735915780e-01f,
-    1.567161441e+00f,
-    1.067523599e+00f,
-    1.037757397e+00f,
-    1.351926565e+00f,
-    8.424006104e-01f,
-    1.143500447e+00f,
-    1.222174883e+00f,
-    7.995209098e-01f,
-    8.996160626e-01f,
-    9.566212893e-01f,
-    1.227993727e+00f,
-    8.052538633e-01f,
-    9.444486499e-01f,
-    7.654594183e-01f,
-    6.266213059e-01f,
-    2.024708748e+00f,
-    6.784495115e-01f,
-    1.475834727e+00f,
-    9.950198531e-01f,
-    1.138068795e+00f,
-    1.538596392e+00f,
-    8.285179138e-01f,
-    1.734076262e+00f,
-    9.644176364e-01f,
-    1.294928551e+00f,
-    1.078740954e+00f,
-    1.524945378e+00f,
-    1.145106554e+00f,
-    1.092084050e+00f,
-    9.465008974e-01f,
-    9.008102417e-01f,
-    1.295195103e+00f,
-    1.213874698e+00f,
-    7.874235511e-01f,
-    1.042824507e+00f,
-    1.921494603e+00f,
-    1.139830351e+00f,
-    9.677556753e-01f,
-    5.813973546e-01f,
-    1.321302176e+00f,
-    7.768822908e-01f,
-    8.301430345e-01f,
-    9.213445187e-01f,
-    1.262320161e+00f,
-    6.609734893e-01f,
-    7.443568707e-01f,
-    8.035617471e-01f,
-    8.743033409e-01f,
-    8.351911902e-01f,
-    1.025994897e+00f,
-    1.078433037e+00f,
-    1.142272592e+00f,
-    1.552744269e+00f,
-    9.163218737e-01f,
-    1.204505324e+00f,
-    9.458259344e-01f,
-    1.047105193e+00f,
-    1.207073569e+00f,
-    9.506666064e-01f,
-    1.194047570e+00f,
-    4.416868389e-01f,
-    1.430502057e+00f,
-    6.215819716e-01f,
-    1.576541901e+00f,
-    6.287986040e-01f,
-    1.237817645e+00f,
-    1.490370870e+00f,
-    9.412642121e-01f,
-    7.334788442e-01f,
-    1.486884952e+00f,
-    1.422736526e+00f,
-    1.431685090e+00f,
-    7.955715060e-01f,
-    8.670665622e-01f,
-    8.462530971e-01f,
-    1.774515986e+00f,
-    1.202759862e+00f,
-    5.773277879e-01f,
-    1.205861568e+00f,
-    1.750031948e+00f,
-    8.322608471e-01f,
-    6.324542761e-01f,
-    7.027678490e-01f,
-    1.260510087e+00f,
-    1.130299091e+00f,
-    6.641247869e-01f,
-    8.008182645e-01f,
-    1.012118220e+00f,
-    1.325401902e+00f,
-    1.940047026e+00f,
-    1.848895192e+00f,
-    1.754715562e+00f,
-    9.246990085e-01f,
-    7.542722225e-01f,
-    1.065830588e+00f,
-    1.081407666e+00f,
-    1.389960170e+00f,
-    1.031190276e+00f,
-    9.760187864e-01f,
-    1.164701581e+00f,
-    7.680425048e-01f,
-    7.877348065e-01f,
-    1.681806326e+00f,
-    9.834714532e-01f,
-    1.087246776e+00f,
-    8.932271600e-01f,
-    1.743292332e+00f,
-    2.025928497e+00f,
-    1.166759610e+00f,
-    7.546336651e-01f,
-    2.427078485e+00f,
-    8.610180616e-01f,
-    5.527805090e-01f,
-    1.113395095e+00f,
-    2.068626642e+00f,
-    3.055182695e+00f,
-    1.094927311e+00f,
-    1.040340543e+00f,
-    1.126866698e+00f,
-    1.432268977e+00f,
-    1.055575132e+00f,
-    1.115689516e+00f,
-    6.596966386e-01f,
-    1.038385391e+00f,
-    6.900713444e-01f,
-    6.794405580e-01f,
-    1.513316154e+00f,
-    1.053967237e+00f,
-    2.213930130e+00f,
-    1.097108126e+00f,
-    1.007594705e+00f,
-    8.581230640e-01f,
-    8.907736540e-01f,
-    1.212788343e+00f,
-    2.129933596e+00f,
-    8.039463162e-01f,
-    1.074688554e+00f,
-    1.102897167e+00f,
-    1.235226631e+00f,
-    7.074765563e-01f,
-    7.403088212e-01f,
-    1.347871065e+00f,
-    1.009973764e+00f,
-    8.436827660e-01f,
-    5.495080352e-01f,
-    3.384389877e-01f,
-    9.043893218e-01f,
-    8.470349312e-01f,
-    1.372452378e+00f,
-    1.831464410e+00f,
-    1.537097096e+00f,
-    1.100089908e+00f,
-    1.825321198e+00f,
-    1.122217894e+00f,
-    1.068856597e+00f,
-    1.156355739e+00f,
-    9.716835022e-01f,
-    6.092685461e-01f,
-    1.961045861e+00f,
-    1.397517562e+00f,
-    9.091646075e-01f,
-    1.052861691e+00f,
-    1.835847259e+00f,
-    1.221381307e+00f,
-    1.704064488e+00f,
-    1.233986259e+00f,
-    8.737610579e-01f,
-    1.080482602e+00f,
-    9.245162606e-01f,
-    1.234125376e+00f,
-    1.051203609e+00f,
-    9.850602746e-01f,
-    1.784051180e+00f,
-    1.734982848e+00f,
-    6.599267721e-01f,
-    7.300572991e-01f,
-    8.774078488e-01f,
-    8.867319822e-01f,
-    1.206115961e+00f,
-    2.126975536e+00f,
-    6.771486402e-01f,
-    9.293126464e-01f,
-    1.041268229e+00f,
-    1.249297976e+00f,
-    1.115473151e+00f,
-    6.987424493e-01f,
-    8.372864127e-01f,
-    1.080675244e+00f,
-    2.255043745e+00f,
-    1.291051745e+00f,
-    1.970952868e+00f,
-    6.603573561e-01f,
-    7.984290719e-01f,
-    1.002774000e+00f,
-    1.194038510e+00f,
-    9.686976075e-01f,
-    1.343660474e+00f,
-    6.606329679e-01f,
-    1.162395000e+00f,
-    1.266856432e+00f,
-    8.096210957e-01f,
-    9.458799362e-01f,
-    1.459738612e+00f,
-    4.233739674e-01f,
-    1.009151578e+00f,
-    6.308801770e-01f,
-    7.471186519e-01f,
-    1.000201821e+00f,
-    1.266929030e+00f,
-    7.310822010e-01f,
-    8.479653001e-01f,
-    2.081445694e+00f,
-    1.004885912e+00f,
-    1.232085586e+00f,
-    6.842319965e-01f,
-    8.064446449e-01f,
-    1.207858086e+00f,
-    1.016192079e+00f,
-    1.415164351e+00f,
-    6.672045588e-01f,
-    1.386579871e+00f,
-    1.590836883e+00f,
-    1.438619137e+00f,
-    9.680714607e-01f,
-    1.184477210e+00f,
-    1.619410634e+00f,
-    9.117658734e-01f,
-    7.673184872e-01f,
-    1.238487959e+00f,
-    1.139078736e+00f,
-    1.053442001e+00f,
-    1.189914703e+00f,
-    1.766190052e+00f,
-    5.349057913e-01f,
-    7.408409119e-01f,
-    1.130681753e+00f,
-    1.101565003e+00f,
-    7.602770925e-01f,
-    7.702695727e-01f,
-    7.168419361e-01f,
-    6.014335155e-01f,
-    1.047743678e+00f,
-    9.366563559e-01f,
-    1.416926980e+00f,
-    8.698492646e-01f,
-    7.932851315e-01f,
-    1.031794071e+00f,
-    1.920395017e+00f,
-    5.785441399e-01f,
-    1.205217361e+00f,
-    1.354798913e+00f,
-    8.268508315e-01f,
-    9.269707203e-01f,
-    1.188840151e+00f,
-    6.158302426e-01f,
-    8.885204792e-01f,
-    1.663427949e+00f,
-    8.151962161e-01f,
-    1.090955853e+00f,
-    5.674909353e-01f,
-    1.085453868e+00f,
-    1.410650492e+00f,
-    1.314285278e+00f,
-    1.275184512e+00f,
-    1.567061663e+00f,
-    7.503640056e-01f,
-    7.741146088e-01f,
-    1.470707178e+00f,
-    1.338621378e+00f,
-    1.485210538e+00f,
-    4.195668697e-01f,
-    1.454895020e+00f,
-    8.291363120e-01f,
-    5.531822443e-01f,
-    1.535783410e+00f,
-    1.481731176e+00f,
-    7.359892726e-01f,
-    1.779363155e+00f,
-    7.773228288e-01f,
-    1.133620620e+00f,
-    1.113406658e+00f,
-    8.356639147e-01f,
-    9.206095338e-01f,
-    1.242423177e+00f,
-    8.633271456e-01f,
-    1.209614396e+00f,
-    8.546258211e-01f,
-    1.120662808e+00f,
-    1.224465966e+00f,
-    6.394362450e-01f,
-    6.645483375e-01f,
-    1.113610864e+00f,
-    8.603796959e-01f,
-    1.055986643e+00f,
-    7.100921869e-01f,
-    1.151508570e+00f,
-    1.086589694e+00f,
-    7.948983908e-01f,
-    1.030598998e+00f,
-    7.936536670e-01f,
-    1.534440637e+00f,
-    9.385517240e-01f,
-    1.185086131e+00f,
-    1.328119397e+00f,
-    1.123292685e+00f,
-    8.371530175e-01f,
-    1.046203017e+00f,
-    1.605629921e+00f,
-    1.045205832e+00f,
-    9.692174792e-01f,
-    1.621393204e+00f,
-    8.866433501e-01f,
-    6.384701133e-01f,
-    8.034182787e-01f,
-    9.222769141e-01f,
-    8.445760012e-01f,
-    8.131704330e-01f,
-    1.241447568e+00f,
-    9.202280641e-01f,
-    9.967401624e-01f,
-    1.164520979e+00f,
-    1.161258817e+00f,
-    8.728123307e-01f,
-    1.535538316e+00f,
-    8.185005784e-01f,
-    9.753600955e-01f,
-    1.027837157e+00f,
-    7.380856276e-01f,
-    4.666187465e-01f,
-    3.868592381e-01f,
-    9.337581396e-01f,
-    7.717440128e-01f,
-    8.106386065e-01f,
-    7.704102397e-01f,
-    6.127843857e-01f,
-    1.644169688e+00f,
-    1.698054433e+00f,
-    4.845318198e-01f,
-    9.257622957e-01f,
-    1.846295238e+00f,
-    1.185902834e+00f,
-    8.825215101e-01f,
-    8.745253086e-01f,
-    7.150475383e-01f,
-    1.387898088e+00f,
-    9.290665984e-01f,
-    9.684281349e-01f,
-    1.237031579e+00f,
-    6.977811456e-01f,
-    1.061918855e+00f,
-    8.421370387e-01f,
-    8.063393235e-01f,
-    8.923414946e-01f,
-    9.674530029e-01f,
-    1.023929358e+00f,
-    5.409749150e-01f,
-    1.104797006e+00f,
-    1.265177965e+00f,
-    1.072243333e+00f,
-    7.798976898e-01f,
-    9.725328684e-01f,
-    1.113169432e+00f,
-    1.069528341e+00f,
-    7.568902373e-01f,
-    2.210580349e+00f,
-    1.306120753e+00f,
-    9.222394824e-01f,
-    5.601939559e-01f,
-    9.885516763e-01f,
-    9.003756046e-01f,
-    1.516939640e+00f,
-    9.561264515e-01f,
-    5.806767941e-01f,
-    8.368440270e-01f,
-    1.958497643e+00f,
-    2.190073013e+00f,
-    1.148152113e+00f,
-    9.532359838e-01f,
-    9.987126589e-01f,
-    7.218933702e-01f,
-    9.783309102e-01f,
-    6.726701260e-01f,
-    1.344549179e+00f,
-    1.141360641e+00f,
-    1.113037229e+00f,
-    6.048303246e-01f,
-    1.228700280e+00f,
-    3.294334114e-01f,
-    8.488903046e-01f,
-    5.143122077e-01f,
-    7.482981682e-01f,
-    7.948541641e-01f,
-    9.734662175e-01f,
-    9.471038580e-01f,
-    6.915735006e-01f,
-    1.249748707e+00f,
-    1.102089286e+00f,
-    5.276673436e-01f,
-    6.600447893e-01f,
-    7.650923133e-01f,
-    8.185656071e-01f,
-    1.560601234e+00f,
-    1.190424323e+00f,
-    6.720548272e-01f,
-    6.910819411e-01f,
-    6.492507458e-01f,
-    2.343413115e+00f,
-    9.904111624e-01f,
-    5.897511840e-01f,
-    6.701500416e-01f,
-    1.326878428e+00f,
-    1.175243497e+00f,
-    8.583829999e-01f,
-    3.958775997e-01f,
-    1.344192386e+00f,
-    7.980453968e-01f,
-    5.873811245e-01f,
-    6.671658158e-01f,
-    7.498946190e-01f,
-    1.146512985e+00f,
-    1.421421885e+00f,
-    9.710944891e-01f,
-    1.313590169e+00f,
-    7.417620420e-01f,
-    1.122964263e+00f,
-    1.548408270e+00f,
-    9.104878902e-01f,
-    2.030598402e+00f,
-    1.447402835e+00f,
-    7.925430536e-01f,
-    8.633908033e-01f,
-    5.243563056e-01f,
-    1.221321464e+00f,
-    7.744619846e-01f,
-    5.250834227e-01f,
-    1.561170578e+00f,
-    1.053823590e+00f,
-    1.414676428e+00f,
-    1.009795547e+00f,
-    8.077578545e-01f,
-    6.302563548e-01f,
-    6.118517518e-01f,
-    7.541460991e-01f,
-    9.144812822e-01f,
-    6.695514321e-01f,
-    1.739807248e+00f,
-    5.896722078e-01f,
-    5.615630746e-01f,
-    1.054159880e+00f,
-    8.286108971e-01f,
-    1.464609742e+00f,
-    6.760589480e-01f,
-    1.295377254e+00f,
-    1.240761757e+00f,
-    1.148733258e+00f,
-    1.057941675e+00f,
-    1.358220100e+00f,
-    7.137410641e-01f,
-    1.220961571e+00f,
-    1.137542963e+00f,
-    5.950159431e-01f,
-    1.171442389e+00f,
-    1.679576278e+00f,
-    1.067872047e+00f,
-    9.492179751e-01f,
-    6.502776742e-01f,
-    6.048888564e-01f,
-    4.961725473e-01f,
-    4.484314919e-01f,
-    5.627045631e-01f,
-    7.731763721e-01f,
-    8.456813693e-01f,
-    1.244922996e+00f,
-    1.109615207e+00f,
-    1.004432559e+00f,
-    1.162783146e+00f,
-    1.171647906e+00f,
-    6.127271652e-01f,
-    8.998683095e-01f,
-    1.350596666e+00f,
-    9.489284158e-01f,
-    1.534305215e+00f,
-    9.605072141e-01f,
-    4.749908149e-01f,
-    6.291809082e-01f,
-    1.293402314e+00f,
-    5.802097321e-01f,
-    5.938817859e-01f,
-    1.172004819e+00f,
-    1.718002915e+00f,
-    1.710251808e+00f,
-    1.033769011e+00f,
-    1.576153874e+00f,
-    6.068938971e-01f,
-    8.732048273e-01f,
-    1.094762564e+00f,
-    6.761605144e-01f,
-    4.975137413e-01f,
-    8.711680770e-01f,
-    1.033053637e+00f,
-    8.384428024e-01f,
-    1.759669900e+00f,
-    9.986178875e-01f,
-    8.111213446e-01f,
-    1.158545613e+00f,
-    8.173011541e-01f,
-    1.619251490e+00f,
-    1.096063375e+00f,
-    1.442018867e+00f,
-    1.168162227e+00f,
-    1.256657481e+00f,
-    9.384430647e-01f,
-    8.869118690e-01f,
-    1.167994738e+00f,
-    1.552918315e+00f,
-    4.430298209e-01f,
-    9.434884787e-01f,
-    6.318821311e-01f,
-    6.224315763e-01f,
-    1.460340738e+00f,
-    9.707080126e-01f,
-    8.359789848e-01f,
-    5.858181715e-01f,
-    1.482866406e+00f,
-    1.258457303e+00f,
-    9.970052838e-01f,
-    1.200704932e+00f,
-    7.310847044e-01f,
-    1.374463677e+00f,
-    1.815087199e+00f,
-    6.363287568e-01f,
-    6.974461675e-01f,
-    7.183921933e-01f,
-    9.742717743e-01f,
-    9.196749926e-01f,
-    1.764833927e+00f,
-    1.366823196e+00f,
-    9.530721903e-01f,
-    1.008428693e+00f,
-    2.092072010e+00f,
-    6.521077156e-01f,
-    2.101656199e+00f,
-    1.582628489e+00f,
-    1.188682318e+00f,
-    7.327669859e-01f,
-    1.574931145e+00f,
-    1.028170705e+00f,
-    2.201407433e+00f,
-    8.714807034e-01f,
-    1.213433981e+00f,
-    9.194000959e-01f,
-    1.527506232e+00f,
-    1.640903354e+00f,
-    2.072584391e+00f,
-    1.090947151e+00f,
-    8.729006648e-01f,
-    6.343633533e-01f,
-    1.261193871e+00f,
-    1.118880272e+00f,
-    1.183775663e+00f,
-    1.395592332e+00f,
-    6.259027123e-01f,
-    5.339846611e-01f,
-    7.517206669e-01f,
-    1.772147417e+00f,
-    6.268792748e-01f,
-    7.012498975e-01f,
-    1.175867438e+00f,
-    1.221588373e+00f,
-    8.613589406e-01f,
-    1.632949829e+00f,
-    1.030842423e+00f,
-    1.422677398e+00f,
-    1.444008470e+00f,
-    7.563567162e-01f,
-    9.948684573e-01f,
-    6.472527385e-01f,
-    2.044008255e+00f,
-    9.989562035e-01f,
-    9.926953316e-01f,
-    1.300662875e+00f,
-    5.689366460e-01f,
-    7.216818929e-01f,
-    7.979248762e-01f,
-    1.103424191e+00f,
-    1.074176669e+00f,
-    9.618231058e-01f,
-    1.420666695e+00f,
-    1.020555973e+00f,
-    1.248214960e+00f,
-    7.573760152e-01f,
-    8.618682027e-01f,
-    9.819666743e-01f,
-    1.207530975e+00f,
-    1.288379073e+00f,
-    1.431030393e+00f,
-    1.731844783e+00f,
-    1.411526322e+00f,
-    1.136801362e+00f,
-    8.410251141e-01f,
-    1.175620914e+00f,
-    1.501747131e+00f,
-    1.279379249e+00f,
-    1.047591329e+00f,
-    1.042335868e+00f,
-    9.650755525e-01f,
-    2.007290602e+00f,
-    5.772566199e-01f,
-    2.359871864e+00f,
-    9.127942920e-01f,
-    1.162076712e+00f,
-    1.180915594e+00f,
-    1.101409316e+00f,
-    6.315296292e-01f,
-    9.877684116e-01f,
-    1.113366485e+00f,
-    1.375352502e+00f,
-    4.649135768e-01f,
-    7.253516912e-01f,
-    1.400467038e+00f,
-    7.209874988e-01f,
-    1.051153064e+00f,
-    2.190335274e+00f,
-    1.460317016e+00f,
-    8.095146418e-01f,
-    9.902445078e-01f,
-    9.296926856e-01f,
-    7.914201617e-01f,
-    9.411551952e-01f,
-    1.241558671e+00f,
-    9.058150053e-01f,
-    7.746191025e-01f,
-    7.979350090e-01f,
-    1.073642612e+00f,
-    1.543336987e+00f,
-    9.354205132e-01f,
-    1.381328106e+00f,
-    1.234390855e+00f,
-    9.874666333e-01f,
-    1.117314339e+00f,
-    5.902907252e-01f,
-    6.469588280e-01f,
-    9.954143763e-01f,
-    8.266113400e-01f,
-    6.472327709e-01f,
-    1.586109519e+00f,
-    9.883038998e-01f,
-    9.290127158e-01f,
-    8.971472979e-01f,
-    1.369615674e+00f,
-    1.026881218e+00f,
-    1.322976232e+00f,
-    8.408651352e-01f,
-    7.146121264e-01f,
-    7.590198517e-01f,
-    1.169410586e+00f,
-    8.146540523e-01f,
-    7.278228998e-01f,
-    5.384104252e-01f,
-    7.387546301e-01f,
-    1.001736760e+00f,
-    8.327522278e-01f,
-    7.785552740e-01f,
-    5.385662317e-01f,
-    6.756780148e-01f,
-    1.679203510e+00f,
-    1.760494590e+00f,
-    1.160532832e+00f,
-    1.678152323e+00f,
-    8.357977271e-01f,
-    9.521526694e-01f,
-    1.328459144e+00f,
-    8.174293637e-01f,
-    7.744073272e-01f,
-    7.168983221e-01f,
-    1.219704390e+00f,
-    5.407621861e-01f,
-    1.622112036e+00f,
-    1.109193325e+00f,
-    2.165985823e+00f,
-    5.225992203e-01f,
-    1.654095531e+00f,
-    8.908938766e-01f,
-    8.291192055e-01f,
-    8.377029896e-01f,
-    8.387465477e-01f,
-    1.920661807e+00f,
-    6.426199079e-01f,
-    1.751448035e+00f,
-    1.093146682e+00f,
-    1.377233744e+00f,
-    9.067145586e-01f,
-    1.031267524e+00f,
-    1.278496861e+00f,
-    1.433033466e+00f,
-    1.265934110e+00f,
-    1.768631697e+00f,
-    1.126454949e+00f,
-    7.598466873e-01f,
-    6.709955335e-01f,
-    9.585508704e-01f,
-    7.455998659e-01f,
-    1.153146148e+00f,
-    1.368985772e+00f,
-    7.721267343e-01f,
-    9.508788586e-01f,
-    9.391214252e-01f,
-    3.875072598e-01f,
-    6.456900239e-01f,
-    6.636441946e-01f,
-    4.068313837e-01f,
-    8.474841118e-01f,
-    1.489760518e+00f,
-    2.624463797e+00f,
-    1.591682196e+00f,
-    9.856023192e-01f,
-    1.539627910e+00f,
-    1.118548036e+00f,
-    1.623907924e+00f,
-    1.158518195e+00f,
-    8.670312762e-01f,
-    8.011501431e-01f,
-    7.524147034e-01f,
-    1.205580354e+00f,
-    1.184016943e+00f,
-    9.896177649e-01f,
-    1.059168458e+00f,
-    1.305782437e+00f,
-    1.420927048e+00f,
-    9.407190681e-01f,
-    8.841129541e-01f,
-    1.194298506e+00f,
-    1.898855329e+00f,
-    9.664174318e-01f,
-    2.118643761e+00f,
-    1.804184794e+00f,
-    7.500924468e-01f,
-    8.458237052e-01f,
-    1.024732471e+00f,
-    8.625686169e-01f,
-    1.207215667e+00f,
-    1.082361937e+00f,
-    1.074813008e+00f,
-    1.032910705e+00f,
-    1.663192987e+00f,
-    1.291835666e+00f,
-    9.031273127e-01f,
-    9.569042325e-01f,
-    1.534812331e+00f,
-    8.184812665e-01f,
-    1.300387859e+00f,
-    1.066029549e+00f,
-    8.101044893e-01f,
-    1.551883578e+00f,
-    9.494375587e-01f,
-    7.141700983e-01f,
-    8.191518188e-01f,
-    6.101810336e-01f,
-    1.426343322e+00f,
-    9.093897343e-01f,
-    1.196410418e+00f,
-    5.976351500e-01f,
-    1.326127529e+00f,
-    8.802145123e-01f,
-    1.462243438e+00f,
-    2.544838428e+00f,
-    1.568528891e+00f,
-    1.014965534e+00f,
-    1.047755122e+00f,
-    1.534205556e+00f,
-    9.735935330e-01f,
-    1.024138331e+00f,
-    1.217062712e+00f,
-    8.031237721e-01f,
-    1.323065877e+00f,
-    1.028842330e+00f,
-    8.594614863e-01f,
-    8.170795441e-01f,
-    1.916472912e+00f,
-    1.187936664e+00f,
-    2.008060217e+00f,
-    2.082790375e+00f,
-    7.839794159e-01f,
-    6.437872648e-01f,
-    1.038735032e+00f,
-    7.169843912e-01f,
-    1.339862943e+00f,
-    1.122599125e+00f,
-    2.660587549e+00f,
-    6.811604500e-01f,
-    1.002476811e+00f,
-    1.019475818e+00f,
-    9.598655105e-01f,
-    8.958272338e-01f,
-    1.550043464e+00f,
-    1.712926865e+00f,
-    1.351889253e+00f,
-    1.931757212e+00f,
-    1.323831320e+00f,
-    1.002774835e+00f,
-    1.477238178e+00f,
-    1.312252164e+00f,
-    6.746119857e-01f,
-    1.216430306e+00f,
-    9.519555569e-01f,
-    8.474652767e-01f,
-    1.338407159e+00f,
-    1.223530769e+00f,
-    1.144957304e+00f,
-    6.283188462e-01f,
-    1.550324917e+00f,
-    1.466613770e+00f,
-    5.284190178e-01f,
-    1.830964923e+00f,
-    1.212389112e+00f,
-    2.078931570e+00f,
-    6.450927854e-01f,
-    1.137793422e+00f,
-    1.105130076e+00f,
-    8.574298024e-01f,
-    9.809587002e-01f,
-    3.460180759e+00f,
-    9.859350920e-01f,
-    1.082000136e+00f,
-    2.062701225e+00f,
-    1.027634740e+00f,
-    1.515703917e+00f,
-    5.875208378e-01f,
-    8.752056956e-01f,
-    1.199538827e+00f,
-    4.594468474e-01f,
-    9.676277637e-01f,
-    1.027052760e+00f,
-    1.040201783e+00f,
-    1.511902928e+00f,
-    1.169879556e+00f,
-    5.436673164e-01f,
-    5.558484197e-01f,
-    1.354465604e+00f,
-    8.400188684e-01f,
-    1.516692281e+00f,
-    1.233702302e+00f,
-    1.141669393e+00f,
-    1.058324456e+00f,
-    1.439579129e+00f,
-    1.215145826e+00f,
-    7.363610268e-01f,
-    1.053742051e+00f,
-    6.997981071e-01f,
-    6.208449006e-01f,
-    5.655483603e-01f,
-    1.228406906e+00f,
-    5.642593503e-01f,
-    6.047990918e-01f,
-    1.865136027e+00f,
-    5.748355985e-01f,
-    7.729039192e-01f,
-    6.814381480e-01f,
-    7.935290933e-01f,
-    1.087636113e+00f,
-    8.177787662e-01f,
-    6.106675863e-01f,
-    7.694088817e-01f,
-    7.175801992e-01f,
-    1.747517347e+00f,
-    6.644557118e-01f,
-    1.859334946e+00f,
-    1.450401783e+00f,
-    1.904948711e+00f,
-    1.175669312e+00f,
-    1.113473535e+00f,
-    1.090533733e+00f,
-    8.179485202e-01f,
-    2.229902506e+00f,
-    1.722889543e+00f,
-    2.192991018e+00f,
-    9.956369996e-01f,
-    6.530220509e-01f,
-    1.861722469e+00f,
-    9.150283337e-01f,
-    6.846640110e-01f,
-    8.683929443e-01f,
-    1.196628332e+00f,
-    7.826787233e-01f,
-    9.423617721e-01f,
-    6.942112446e-01f,
-    1.234348774e+00f,
-    8.415368795e-01f,
-    9.606466293e-01f,
-    1.932335973e+00f,
-    1.213060737e+00f,
-    9.727922678e-01f,
-    1.640922546e+00f,
-    6.180070043e-01f,
-    1.126125216e+00f,
-    7.894410491e-01f,
-    1.484148622e+00f,
-    1.269947171e+00f,
-    7.363212109e-01f,
-    1.026098490e+00f,
-    5.542339087e-01f,
-    7.162641883e-01f,
-    1.256770134e+00f,
-    9.349307418e-01f,
-    1.689621568e+00f,
-    9.503488541e-01f,
-    1.471363783e+00f,
-    1.383399725e+00f,
-    1.195671797e+00f,
-    1.208750248e+00f,
-    9.119883180e-01f,
-    1.140225530e+00f,
-    1.528474450e+00f,
-    1.026110649e+00f,
-    1.365336537e+00f,
-    1.175372481e+00f,
-    2.322025299e+00f,
-    1.649688840e+00f,
-    1.286916614e+00f,
-    8.360444307e-01f,
-    2.482056618e+00f,
-    1.264922023e+00f,
-    9.446297884e-01f,
-    1.616582274e+00f,
-    9.936398864e-01f,
-    1.213606596e+00f,
-    2.156927824e+00f,
-    6.869087815e-01f,
-    1.346793771e+00f,
-    9.038940668e-01f,
-    8.813844919e-01f,
-    1.145041943e+00f,
-    9.927636385e-01f,
-    1.408354402e+00f,
-    1.308621645e+00f,
-    1.314285994e+00f,
-    9.704963565e-01f,
-    1.012270093e+00f,
-    1.293747544e+00f,
-    7.772895694e-01f,
-    1.186701894e+00f,
-    5.909539461e-01f,
-    1.597335815e+00f,
-    7.222455740e-01f,
-    1.069416404e+00f,
-    1.925095677e+00f,
-    1.050060153e+00f,
-    9.720696807e-01f,
-    9.836523533e-01f,
-    9.739441276e-01f,
-    7.860316038e-01f,
-    9.268878102e-01f,
-    7.396730185e-01f,
-    8.802337050e-01f,
-    8.995355368e-01f,
-    1.727000833e+00f,
-    1.641965151e+00f,
-    1.325966597e+00f,
-    1.383960128e+00f,
-    1.468352914e+00f,
-    1.854454756e+00f,
-    1.035289884e+00f,
-    1.156171679e+00f,
-    1.462339878e+00f,
-    1.293933392e+00f,
-    1.022232771e+00f,
-    1.346083879e+00f,
-    7.686012387e-01f,
-    1.370785475e+00f,
-    1.138564825e+00f,
-    6.910216808e-01f,
-    1.192614198e+00f,
-    1.702489376e+00f,
-    2.168778896e+00f,
-    8.922768831e-01f,
-    1.345177412e+00f,
-    7.726590037e-01f,
-    9.365066886e-01f,
-    2.612796068e+00f,
-    7.670863867e-01f,
-    9.331603646e-01f,
-    1.006720781e+00f,
-    1.525259256e+00f,
-    1.135049820e+00f,
-    1.861160517e+00f,
-    6.602429152e-01f,
-    1.292866588e+00f,
-    1.125163674e+00f,
-    2.876626015e+00f,
-    7.965458632e-01f,
-    1.419877291e+00f,
-    6.910383701e-01f,
-    7.221930623e-01f,
-    9.892967939e-01f,
-    9.463597536e-01f,
-    7.238682508e-01f,
-    1.408549070e+00f,
-    8.184934258e-01f,
-    9.946740866e-01f,
-    2.045753717e+00f,
-    9.597158432e-01f,
-    1.370066404e+00f,
-    9.116936922e-01f,
-    1.236642241e+00f,
-    1.420472860e+00f,
-    1.489302397e+00f,
-    1.588353753e+00f,
-    1.094952226e+00f,
-    9.845241904e-01f,
-    1.823703766e+00f,
-    1.095362663e+00f,
-    1.276463032e+00f,
-    8.518273830e-01f,
-    1.168077111e+00f,
-    1.818589449e+00f,
-    8.634440899e-01f,
-    2.046385527e+00f,
-    1.647352815e+00f,
-    1.273640752e+00f,
-    8.069893122e-01f,
-    1.501324773e+00f,
-    9.115139246e-01f,
-    1.207272530e+00f,
-    8.347447515e-01f,
-    9.055228233e-01f,
-    1.934263945e+00f,
-    8.765133023e-01f,
-    1.397580028e+00f,
-    1.553430080e+00f,
-    1.372104406e+00f,
-    1.931333184e+00f,
-    1.404864073e+00f,
-    1.901906252e+00f,
-    1.229677677e+00f,
-    1.826073885e+00f,
-    1.157991290e+00f,
-    1.799775839e+00f,
-    1.299747229e+00f,
-    1.568591237e+00f,
-    1.214692235e+00f,
-    1.469870567e+00f,
-    7.836202979e-01f,
-    9.675045609e-01f,
-    1.567287326e+00f,
-    5.986025333e-01f,
-    9.721498489e-01f,
-    1.287852049e+00f,
-    9.177259207e-01f,
-    1.373064637e+00f,
-    8.518060446e-01f,
-    5.613549352e-01f,
-    1.212566376e+00f,
-    7.569407821e-01f,
-    5.782691836e-01f,
-    1.147325873e+00f,
-    1.070818305e+00f,
-    1.433759212e+00f,
-    1.104300380e+00f,
-    1.260550261e+00f,
-    1.004115582e+00f,
-    5.900844336e-01f,
-    9.157553315e-01f,
-    9.310353398e-01f,
-    9.034282565e-01f,
-    1.550898075e+00f,
-    9.558839202e-01f,
-    6.478725672e-01f,
-    1.481370091e+00f,
-    1.518987179e+00f,
-    1.631536365e+00f,
-    4.379263520e-01f,
-    1.025330901e+00f,
-    1.519747376e+00f,
-    6.534004807e-01f,
-    6.744566560e-01f,
-    1.046095848e+00f,
-    4.503504634e-01f,
-    7.208855152e-01f,
-    7.565786242e-01f,
-    6.946535707e-01f,
-    1.039246321e+00f,
-    7.815400958e-01f,
-    1.111045837e+00f,
-    1.188652992e+00f,
-    1.376563907e+00f,
-    1.717380643e+00f,
-    7.071437836e-01f,
-    1.029012203e+00f,
-    1.501755834e+00f,
-    1.685976624e+00f,
-    8.889365792e-01f,
-    8.359826803e-01f,
-    1.689461946e+00f,
-    1.222080827e+00f,
-    1.133951664e+00f,
-    1.043135643e+00f,
-    8.226074576e-01f,
-    6.946105957e-01f,
-    1.232047200e+00f,
-    6.195432544e-01f,
-    1.490692258e+00f,
-    6.249340773e-01f,
-    1.351843238e+00f,
-    1.658973932e+00f,
-    9.507947564e-01f,
-    1.277207971e+00f,
-    6.463745236e-01f,
-    1.022549272e+00f,
-    5.173292756e-01f,
-    5.018129349e-01f,
-    8.361805081e-01f,
-    4.542734921e-01f,
-    1.087226629e+00f,
-    1.054124951e+00f,
-    1.066116571e+00f,
-    6.855991483e-01f,
-    1.645780444e+00f,
-    1.619264126e+00f,
-    6.453946233e-01f,
-    1.144830108e+00f,
-    9.499060512e-01f,
-    7.110262513e-01f,
-    1.209535718e+00f,
-    1.151292086e+00f,
-    7.535866499e-01f,
-    1.054285288e+00f,
-    7.265384793e-01f,
-    2.238621950e+00f,
-    7.719105482e-01f,
-    1.522734404e+00f,
-    1.165773869e+00f,
-    1.041867018e+00f,
-    1.035508275e+00f,
-    1.249023676e+00f,
-    1.016827226e+00f,
-    8.375446200e-01f,
-    4.604190588e-01f,
-    8.480536938e-01f,
-    9.573684931e-01f,
-    1.378056645e+00f,
-    1.903649092e+00f,
-    1.015350580e+00f,
-    2.326325417e+00f,
-    8.731567860e-01f,
-    1.128588319e+00f,
-    1.280793667e+00f,
-    9.119434953e-01f,
-    1.216121912e+00f,
-    7.200191617e-01f,
-    7.432647943e-01f,
-    2.752558708e+00f,
-    6.205046177e-01f,
-    1.191329956e+00f,
-    1.489876509e+00f,
-    1.628043890e+00f,
-    8.311556578e-01f,
-    9.190329313e-01f,
-    1.700959206e+00f,
-    8.216506243e-01f,
-    1.395975113e+00f,
-    9.564002156e-01f,
-    1.120672584e+00f,
-    6.003237963e-01f,
-    8.340578675e-01f,
-    1.398236871e+00f,
-    9.442388415e-01f,
-    1.304148555e+00f,
-    2.387398720e+00f,
-    1.011155605e+00f,
-    1.264264941e+00f,
-    1.445486069e+00f,
-    1.232588172e+00f,
-    1.168596387e+00f,
-    1.051004648e+00f,
-    1.013416171e+00f,
-    4.874978960e-01f,
-    8.891683817e-01f,
-    9.224374890e-01f,
-    9.933586121e-01f,
-    1.386998415e+00f,
-    7.343064547e-01f,
-    5.586429238e-01f,
-    6.259527206e-01f,
-    8.626490235e-01f,
-    1.692788363e+00f,
-    1.297127008e+00f,
-    9.662905335e-01f,
-    1.128320456e+00f,
-    7.658498287e-01f,
-    6.702337265e-01f,
-    5.854539275e-01f,
-    5.704967976e-01f,
-    8.137140870e-01f,
-    1.285697460e+00f,
-    1.983915925e+00f,
-    6.655888557e-01f,
-    1.050494909e+00f,
-    1.070778012e+00f,
-    2.451186419e+00f,
-    7.314448953e-01f,
-    9.966369867e-01f,
-    1.488334656e+00f,
-    1.082452536e+00f,
-    8.088179231e-01f,
-    1.176460624e+00f,
-    8.018836975e-01f,
-    7.931721210e-01f,
-    8.465773463e-01f,
-    1.155133128e+00f,
-    2.237261295e+00f,
-    1.850683928e+00f,
-    3.497602344e-01f,
-    6.922434568e-01f,
-    5.898850560e-01f,
-    6.653187275e-01f,
-    1.238171220e+00f,
-    1.114261031e+00f,
-    1.114256859e+00f,
-    1.078982949e+00f,
-    1.055918574e+00f,
-    5.009525418e-01f,
-    9.598782659e-01f,
-    1.971912861e+00f,
-    8.055128455e-01f,
-    8.087508082e-01f,
-    4.504636824e-01f,
-    8.026834130e-01f,
-    8.321406841e-01f,
-    5.128473639e-01f,
-    9.864519835e-01f,
-    1.562259912e+00f,
-    2.516412735e+00f,
-    1.299237490e+00f,
-    4.808735847e-01f,
-    5.989117026e-01f,
-    4.787996113e-01f,
-    5.982067585e-01f,
-    1.036324263e+00f,
-    2.038558006e+00f,
-    1.108896494e+00f,
-    1.597043872e+00f,
-    7.915892601e-01f,
-    8.051605821e-01f,
-    1.141517997e+00f,
-    1.533724189e+00f,
-    1.019148946e+00f,
-    6.441318393e-01f,
-    7.087188959e-01f,
-    8.129702210e-01f,
-    1.301964998e+00f,
-    8.598303795e-01f,
-    9.161834717e-01f,
-    5.032836199e-01f,
-    5.689368844e-01f,
-    9.525069594e-01f,
-    3.899186552e-01f,
-    1.391167760e+00f,
-    7.238976359e-01f,
-    1.094926476e+00f,
-    1.084727645e+00f,
-    6.497905850e-01f,
-    1.002822042e+00f,
-    1.161640167e+00f,
-    1.744393587e+00f,
-    7.405994534e-01f,
-    2.082295895e+00f,
-    1.042573810e+00f,
-    7.017912865e-01f,
-    1.112470508e+00f,
-    1.471844912e+00f,
-    1.364570141e+00f,
-    5.447910428e-01f,
-    9.417288899e-01f,
-    8.637661934e-01f,
-    5.539221764e-01f,
-    8.950812221e-01f,
-    8.505948186e-01f,
-    8.837146163e-01f,
-    2.551109552e+00f,
-    7.233440280e-01f,
-    1.410736918e+00f,
-    7.410442233e-01f,
-    1.265115976e+00f,
-    9.498410225e-01f,
-    6.787593365e-01f,
-    9.135487080e-01f,
-    6.803774238e-01f,
-    1.074246287e+00f,
-    7.856020331e-01f,
-    1.096426606e+00f,
-    6.509287953e-01f,
-    9.787194729e-01f,
-    1.009811401e+00f,
-    1.587487817e+00f,
-    2.484557629e+00f,
-    4.716492295e-01f,
-    1.313773751e+00f,
-    6.528310776e-01f,
-    1.128900647e+00f,
-    8.203831911e-01f,
-    1.986154795e+00f,
-    1.158359051e+00f,
-    6.517270207e-01f,
-    1.151075482e+00f,
-    1.100921154e+00f,
-    5.950813293e-01f,
-    1.893991232e+00f,
-    1.092342496e+00f,
-    1.374118209e+00f,
-    7.855749726e-01f,
-    5.174699426e-01f,
-    3.366183341e-01f,
-    4.840863347e-01f,
-    1.795482278e+00f,
-    6.932699680e-01f,
-    1.489058971e+00f,
-    9.227733016e-01f,
-    1.015594840e+00f,
-    5.835995674e-01f,
-    8.300743103e-01f,
-    1.316921234e+00f,
-    1.069192290e+00f,
-    5.048481941e+00f,
-    1.380533814e+00f,
-    8.527865410e-01f,
-    7.852837443e-01f,
-    1.414077640e+00f,
-    9.007814527e-01f,
-    2.147408009e+00f,
-    7.564533353e-01f,
-    3.553901911e+00f,
-    5.522056222e-01f,
-    7.684170604e-01f,
-    7.355514169e-01f,
-    1.570553184e+00f,
-    9.023217559e-01f,
-    1.122259140e+00f,
-    7.575678229e-01f,
-    1.006050587e+00f,
-    2.311933994e+00f,
-    8.400552869e-01f,
-    1.060971498e+00f,
-    1.417904258e+00f,
-    1.506888390e+00f,
-    1.202211499e+00f,
-    1.213953853e+00f,
-    1.524100065e+00f,
-    6.369346976e-01f,
-    1.457697630e+00f,
-    8.820471764e-01f,
-    2.215296984e+00f,
-    9.863288403e-01f,
-    2.117703676e+00f,
-    7.725283504e-01f,
-    6.038581133e-01f,
-    7.873880863e-01f,
-    1.233911037e+00f,
-    1.459737659e+00f,
-    1.074684978e+00f,
-    5.262255669e-01f,
-    7.353285551e-01f,
-    1.143723488e+00f,
-    7.425540090e-01f,
-    9.084729552e-01f,
-    6.453762650e-01f,
-    9.724442959e-01f,
-    1.103133321e+00f,
-    8.749210238e-01f,
-    1.026365280e+00f,
-    8.665329814e-01f,
-    1.457841635e+00f,
-    1.398345351e+00f,
-    9.798305631e-01f,
-    1.013081908e+00f,
-    6.211743951e-01f,
-    6.575344205e-01f,
-    7.737435699e-01f,
-    1.020638227e+00f,
-    1.048194647e+00f,
-    1.078864336e+00f,
-    8.950281143e-01f,
-    1.037986279e+00f,
-    1.113928676e+00f,
-    1.137570381e+00f,
-    7.660536170e-01f,
-    1.515165329e+00f,
-    1.335024476e+00f,
-    5.856174827e-01f,
-    6.792988181e-01f,
-    6.764500737e-01f,
-    1.008829355e+00f,
-    1.320174575e+00f,
-    9.134542942e-01f,
-    1.522882819e+00f,
-    1.528736115e+00f,
-    1.229093075e+00f,
-    1.371018648e+00f,
-    1.590520501e+00f,
-    1.276383281e+00f,
-    1.782365561e+00f,
-    2.302763462e+00f,
-    1.123125315e+00f,
-    1.828747392e+00f,
-    1.158770084e+00f,
-    1.065245867e+00f,
-    2.954719543e+00f,
-    7.667824030e-01f,
-    1.016426802e+00f,
-    1.034459710e+00f,
-    1.145490289e+00f,
-    2.671386003e+00f,
-    1.965155959e+00f,
-    1.036161304e+00f,
-    1.093516588e+00f,
-    1.467729330e+00f,
-    1.120228410e+00f,
-    1.676898360e+00f,
-    1.153914452e+00f,
-    6.048110127e-01f,
-    1.638503194e+00f,
-    1.209992170e+00f,
-    2.095958948e+00f,
-    7.669284940e-01f,
-    1.029350281e+00f,
-    1.101251721e+00f,
-    1.075378060e+00f,
-    6.112598181e-01f,
-    9.138965011e-01f,
-    8.713303804e-01f,
-    1.003059387e+00f,
-    9.726622105e-01f,
-    1.541911244e+00f,
-    1.293145418e+00f,
-    9.717431068e-01f,
-    1.594681978e+00f,
-    4.363595545e-01f,
-    1.307227492e+00f,
-    8.011556864e-01f,
-    1.124704361e+00f,
-    9.580285549e-01f,
-    5.705552101e-01f,
-    1.120188117e+00f,
-    7.756496072e-01f,
-    9.846743345e-01f,
-    6.992670298e-01f,
-    6.362524033e-01f,
-    1.424792767e+00f,
-    9.689553976e-01f,
-    1.062520385e+00f,
-    1.676985621e+00f,
-    1.248016715e+00f,
-    9.089504480e-01f,
-    1.014284611e+00f,
-    9.671516418e-01f,
-    1.113974214e+00f,
-    1.329539895e+00f,
-    1.047836065e+00f,
-    1.128216386e+00f,
-    5.591082573e-01f,
-    9.500563145e-01f,
-    9.282950163e-01f,
-    8.564307690e-01f,
-    1.168549776e+00f,
-    6.119227409e-01f,
-    1.326305747e+00f,
-    8.712056875e-01f,
-    7.138810754e-01f,
-    1.134589076e+00f,
-    1.675582409e+00f,
-    6.331922412e-01f,
-    9.435521364e-01f,
-    8.214624524e-01f,
-    9.549215436e-01f,
-    1.484013081e+00f,
-    1.051878095e+00f,
-    1.004018664e+00f,
-    6.215148568e-01f,
-    7.628759742e-01f,
-    1.011994839e+00f,
-    1.196786404e+00f,
-    9.448662400e-01f,
-    1.032145977e+00f,
-    1.452349544e+00f,
-    6.933685541e-01f,
-    1.094576955e+00f,
-    1.292339087e+00f,
-    9.833687544e-01f,
-    9.736312032e-01f,
-    1.448868752e+00f,
-    1.070620179e+00f,
-    7.179602385e-01f,
-    9.207339287e-01f,
-    7.989355922e-01f,
-    7.710029483e-01f,
-    7.330889106e-01f,
-    6.565557718e-01f,
-    8.015606403e-01f,
-    1.004233360e+00f,
-    1.073657990e+00f,
-    1.057808042e+00f,
-    1.270422339e+00f,
-    7.254269123e-01f,
-    8.645781279e-01f,
-    1.484657764e+00f,
-    9.955101609e-01f,
-    9.387910962e-01f,
-    1.220330715e+00f,
-    7.455356121e-01f,
-    1.867155790e+00f,
-    7.668166757e-01f,
-    9.433991909e-01f,
-    8.013384342e-01f,
-    6.694674492e-01f,
-    1.624025464e+00f,
-    1.536407948e+00f,
-    7.518038154e-01f,
-    1.398278236e+00f,
-    1.421365857e+00f,
-    9.364429116e-01f,
-    1.022373557e+00f,
-    6.930550933e-01f,
-    1.234475017e+00f,
-    8.745384812e-01f,
-    8.449722528e-01f,
-    9.268410802e-01f,
-    1.152418137e+00f,
-    1.250249147e+00f,
-    1.168050647e+00f,
-    6.696938872e-01f,
-    8.734704256e-01f,
-    8.263882399e-01f,
-    9.911872745e-01f,
-    1.210691810e+00f,
-    1.402799964e+00f,
-    1.010241032e+00f,
-    6.601920128e-01f,
-    9.441987276e-01f,
-    7.727485895e-01f,
-    1.293950319e+00f,
-    4.411317110e-01f,
-    7.383402586e-01f,
-    9.442330599e-01f,
-    1.010763764e+00f,
-    9.741103649e-01f,
-    1.200883269e+00f,
-    1.542238355e+00f,
-    1.270567179e+00f,
-    1.068677545e+00f,
-    9.643734694e-01f,
-    1.455144286e+00f,
-    9.381449819e-01f,
-    7.690987587e-01f,
-    1.262392521e+00f,
-    1.523291826e+00f,
-    7.913057804e-01f,
-    1.357813597e+00f,
-    6.465216875e-01f,
-    1.102999091e+00f,
-    1.322626948e+00f,
-    9.725309014e-01f,
-    9.303835630e-01f,
-    1.115645409e+00f,
-    1.473122954e+00f,
-    1.201501727e+00f,
-    7.394570708e-01f,
-    8.885850906e-01f,
-    1.173454523e+00f,
-    7.374423742e-01f,
-    1.188928604e+00f,
-    2.111168861e+00f,
-    4.395956695e-01f,
-    9.319931269e-01f,
-    1.772481441e+00f,
-    1.022956967e+00f,
-    1.237057090e+00f,
-    1.333067894e+00f,
-    9.433022738e-01f,
-    1.177116632e+00f,
-    1.066040516e+00f,
-    7.199767828e-01f,
-    1.707152009e+00f,
-    6.098595858e-01f,
-    8.685271740e-01f,
-    4.889157414e-01f,
-    1.039561272e+00f,
-    1.551188707e+00f,
-    9.659060240e-01f,
-    1.379825830e+00f,
-    1.465877414e+00f,
-    9.619114399e-01f,
-    1.309917927e+00f,
-    1.202252984e+00f,
-    8.222955465e-01f,
-    4.967237413e-01f,
-    1.348694444e+00f,
-    1.109330535e+00f,
-    8.539484143e-01f,
-    1.550635099e+00f,
-    7.618145943e-01f,
-    8.369377851e-01f,
-    1.433463812e+00f,
-    7.991408110e-01f,
-    8.372493386e-01f,
-    1.010132909e+00f,
-    6.677477360e-01f,
-    6.270577908e-01f,
-    1.516480088e+00f,
-    5.143488646e-01f,
-    7.011606097e-01f,
-    6.200654507e-01f,
-    1.185327291e+00f,
-    9.160989523e-01f,
-    1.244114757e+00f,
-    8.843443990e-01f,
-    8.534947038e-01f,
-    9.927378297e-01f,
-    9.824032187e-01f,
-    1.326756001e+00f,
-    6.616118550e-01f,
-    1.439757347e+00f,
-    1.533281684e+00f,
-    9.642038941e-01f,
-    8.171024323e-01f,
-    1.234381318e+00f,
-    1.083628058e+00f,
-    9.860675931e-01f,
-    1.084583402e+00f,
-    1.358335853e+00f,
-    7.652211785e-01f,
-    1.139063239e+00f,
-    6.178010702e-01f,
-    1.556493998e+00f,
-    1.118277311e+00f,
-    2.510557890e+00f,
-    1.488098741e+00f,
-    1.014054060e+00f,
-    1.831970572e+00f,
-    1.621185303e+00f,
-    1.180430770e+00f,
-    9.038851857e-01f,
-    7.779874206e-01f,
-    1.198867559e+00f,
-    7.540432215e-01f,
-    9.953552485e-01f,
-    7.753798962e-01f,
-    1.774261236e+00f,
-    1.579112768e+00f,
-    1.502040744e+00f,
-    1.241480708e+00f,
-    1.926666856e+00f,
-    1.364497542e+00f,
-    1.405539036e+00f,
-    1.211929560e+00f,
-    1.415957928e+00f,
-    1.245990038e+00f,
-    7.152982354e-01f,
-    1.124138832e+00f,
-    1.496946931e+00f,
-    1.445876956e+00f,
-    7.588728070e-01f,
-    1.445455194e+00f,
-    8.770428896e-01f,
-    6.479168534e-01f,
-    2.516894579e+00f,
-    1.168988228e+00f,
-    9.128366709e-01f,
-    8.804316521e-01f,
-    9.940996766e-01f,
-    8.729043603e-01f,
-    5.445535183e-01f,
-    1.420241237e+00f,
-    1.091727018e+00f,
-    3.328022063e-01f,
-    9.534103274e-01f,
-    1.534336448e+00f,
-    1.425712705e+00f,
-    1.729946733e+00f,
-    1.912626982e+00f,
-    8.409206271e-01f,
-    7.721126676e-01f,
-    8.654971719e-01f,
-    1.803052425e+00f,
-    8.595215082e-01f,
-    9.462379217e-01f,
-    1.401442051e+00f,
-    1.460102916e+00f,
-    1.361390352e+00f,
-    9.957792759e-01f,
-    1.292801857e+00f,
-    1.376373768e+00f,
-    1.079726696e+00f,
-    9.497541785e-01f,
-    9.436507225e-01f,
-    1.086564183e+00f,
-    1.470648766e+00f,
-    1.344133854e+00f,
-    1.113725901e+00f,
-    9.557473063e-01f,
-    7.950380445e-01f,
-    7.141445875e-01f,
-    9.918709397e-01f,
-    1.387660146e+00f,
-    1.727492929e+00f,
-    1.105640769e+00f,
-    8.892474174e-01f,
-    1.790943384e+00f,
-    1.589963317e+00f,
-    6.689343452e-01f,
-    1.019161582e+00f,
-    1.770614982e+00f,
-    1.309524894e+00f,
-    9.684156179e-01f,
-    1.181133389e+00f,
-    1.204077601e+00f,
-    2.509117603e+00f,
-    5.764068365e-01f,
-    1.062835097e+00f,
-    7.372871041e-01f,
-    8.812127709e-01f,
-    1.537856102e+00f,
-    6.863459945e-01f,
-    6.537113786e-01f,
-    1.100692868e+00f,
-    7.401031256e-01f,
-    7.276935577e-01f,
-    1.304291368e+00f,
-    7.947946787e-01f,
-    8.553488255e-01f,
-    1.582517505e+00f,
-    4.724026322e-01f,
-    1.831722140e+00f,
-    8.066624403e-01f,
-    1.257731318e+00f,
-    9.837808013e-01f,
-    1.207451463e+00f,
-    9.396086335e-01f,
-    1.128053308e+00f,
-    1.046975851e+00f,
-    1.103225350e+00f,
-    1.606271267e+00f,
-    9.808402061e-01f,
-    1.387789488e+00f,
-    6.570186615e-01f,
-    7.154530883e-01f,
-    1.134575129e+00f,
-    1.128870606e+00f,
-    9.181283712e-01f,
-    1.432144403e+00f,
-    1.062769771e+00f,
-    1.073429346e+00f,
-    8.846060038e-01f,
-    1.571258307e+00f,
-    6.944619417e-01f,
-    1.009529233e+00f,
-    8.839353323e-01f,
-    8.603641987e-01f,
-    1.286343336e+00f,
-    7.756935358e-01f,
-    9.074658751e-01f,
-    1.111358643e+00f,
-    7.622988224e-01f,
-    1.047983646e+00f,
-    7.153390646e-01f,
-    1.075266600e+00f,
-    8.630036116e-01f,
-    1.424283981e+00f,
-    1.201863408e+00f,
-    8.393617868e-01f,
-    6.721464992e-01f,
-    8.645848036e-01f,
-    2.160472155e+00f,
-    1.089316368e+00f,
-    1.579222798e+00f,
-    8.689352870e-01f,
-    1.112308025e+00f,
-    6.052296162e-01f,
-    8.827640414e-01f,
-    2.200390816e+00f,
-    1.838495135e+00f,
-    6.402716637e-01f,
-    7.773374915e-01f,
-    1.862086296e+00f,
-    7.604482174e-01f,
-    1.037777424e+00f,
-    8.113507032e-01f,
-    7.466863990e-01f,
-    6.115472913e-01f,
-    1.740272880e+00f,
-    7.359346747e-01f,
-    1.213735938e+00f,
-    7.092397809e-01f,
-    5.582537055e-01f,
-    8.456880450e-01f,
-    1.074198008e+00f,
-    1.206463099e+00f,
-    1.408200383e+00f,
-    9.691296816e-01f,
-    9.863132238e-01f,
-    1.311004996e+00f,
-    4.972946644e-01f,
-    1.102475643e+00f,
-    5.644191504e-01f,
-    1.091824293e+00f,
-    1.077912569e+00f,
-    6.972554326e-01f,
-    9.971523285e-01f,
-    1.563117504e+00f,
-    1.106897593e+00f,
-    8.757525682e-01f,
-    6.845878959e-01f,
-    1.159871817e+00f,
-    8.242110014e-01f,
-    1.147294283e+00f,
-    7.836819887e-01f,
-    7.002105117e-01f,
-    1.448295832e+00f,
-    6.963124871e-01f,
-    1.624433279e+00f,
-    7.495490909e-01f,
-    1.039183736e+00f,
-    5.169160962e-01f,
-    1.192170739e+00f,
-    1.816867828e+00f,
-    1.157583594e+00f,
-    8.695598841e-01f,
-    1.608468771e+00f,
-    1.164872885e+00f,
-    1.492376924e+00f,
-    1.227641582e+00f,
-    1.286688209e+00f,
-    2.293190241e+00f,
-    6.830425262e-01f,
-    1.295525074e+00f,
-    1.197639227e+00f,
-    5.876080990e-01f,
-    7.033047080e-01f,
-    1.625156879e+00f,
-    1.312326908e+00f,
-    1.021620750e+00f,
-    1.000299573e+00f,
-    8.813123107e-01f,
-    1.107890964e+00f,
-    1.214329481e+00f,
-    8.622913957e-01f,
-    6.489419937e-01f,
-    1.480366945e+00f,
-    1.816034317e+00f,
-    1.537459731e+00f,
-    1.415474415e+00f,
-    1.793376565e+00f,
-    1.179702520e+00f,
-    8.254484534e-01f,
-    1.187517405e+00f,
-    1.009190559e+00f,
-    8.505367041e-01f,
-    1.380048633e+00f,
-    6.976842880e-01f,
-    6.237999797e-01f,
-    2.337159395e+00f,
-    8.911516666e-01f,
-    7.687879801e-01f,
-    7.964259982e-01f,
-    2.017841339e+00f,
-    9.236528873e-01f,
-    1.227500916e+00f,
-    1.264635921e+00f,
-    8.511581421e-01f,
-    1.441554666e+00f,
-    1.329330921e+00f,
-    1.014727354e+00f,
-    9.018331766e-01f,
-    6.582280397e-01f,
-    7.638655305e-01f,
-    1.323631525e+00f,
-    1.030284643e+00f,
-    1.371979713e+00f,
-    8.018817306e-01f,
-    5.808154941e-01f,
-    9.777414203e-01f,
-    7.994955182e-01f,
-    9.593864083e-01f,
-    1.135574222e+00f,
-    1.057605505e+00f,
-    1.679787755e+00f,
-    1.320652485e+00f,
-    8.569087386e-01f,
-    2.198814869e+00f,
-    1.098688364e+00f,
-    5.904631615e-01f,
-    1.061221480e+00f,
-    9.578188658e-01f,
-    6.233950853e-01f,
-    1.101939917e+00f,
-    8.770064116e-01f,
-    1.070948720e+00f,
-    8.408468962e-01f,
-    2.430518150e+00f,
-    2.100256920e+00f,
-    1.978403211e+00f,
-    1.077830672e+00f,
-    9.958079457e-01f,
-    1.188655615e+00f,
-    8.489664197e-01f,
-    1.644806027e+00f,
-    9.994379282e-01f,
-    6.081659198e-01f,
-    9.562901258e-01f,
-    9.005156159e-01f,
-    8.550519943e-01f,
-    2.127084970e+00f,
-    9.118823409e-01f,
-    9.771682024e-01f,
-    9.857426286e-01f,
-    1.131668925e+00f,
-    1.100653887e+00f,
-    9.820205569e-01f,
-    1.057209730e+00f,
-    1.525966883e+00f,
-    1.122297525e+00f,
-    9.487793446e-01f,
-    1.005748987e+00f,
-    7.646604180e-01f,
-    1.895833373e+00f,
-    7.414901257e-01f,
-    1.634566069e+00f,
-    1.080656528e+00f,
-    1.076167464e+00f,
-    1.031400442e+00f,
-    8.273098469e-01f,
-    1.552317381e+00f,
-    1.090620041e+00f,
-    7.634846568e-01f,
-    9.467169046e-01f,
-    1.002713919e+00f,
-    7.316669822e-01f,
-    8.268003464e-01f,
-    5.967545509e-01f,
-    7.177045345e-01f,
-    1.672417283e+00f,
-    7.661644220e-01f,
-    7.326795459e-01f,
-    8.561773300e-01f,
-    5.797296762e-01f,
-    9.878214002e-01f,
-    9.002739191e-01f,
-    7.712321281e-01f,
-    7.945173383e-01f,
-    1.080227256e+00f,
-    9.134282470e-01f,
-    9.873554111e-01f,
-    1.355111003e+00f,
-    8.062554002e-01f,
-    1.626562476e+00f,
-    9.633380175e-01f,
-    6.690301895e-01f,
-    5.357825756e-01f,
-    1.856158614e+00f,
-    7.861431837e-01f,
-    1.670619726e+00f,
-    8.839622140e-01f,
-    5.468129516e-01f,
-    3.345530033e-01f,
-    5.478543043e-01f,
-    6.624597311e-01f,
-    5.009364486e-01f,
-    1.207543731e+00f,
-    7.044675946e-01f,
-    6.931148171e-01f,
-    1.318395853e+00f,
-    7.249139547e-01f,
-    8.352656960e-01f,
-    9.870463014e-01f,
-    9.114820361e-01f,
-    1.589947224e+00f,
-    3.067519367e-01f,
-    1.609979272e+00f,
-    9.680508971e-01f,
-    1.041696191e+00f,
-    1.206886411e+00f,
-    2.109986067e+00f,
-    1.118261933e+00f,
-    1.202027202e+00f,
-    9.825937748e-01f,
-    1.310774565e+00f,
-    1.780189872e+00f,
-    1.622202992e+00f,
-    1.096926332e+00f,
-    5.593249798e-01f,
-    7.237079144e-01f,
-    8.167284727e-01f,
-    1.268945575e+00f,
-    7.966766357e-01f,
-    1.488901496e+00f,
-    7.228314281e-01f,
-    1.303889751e+00f,
-    9.362323880e-01f,
-    1.206524611e+00f,
-    1.164477944e+00f,
-    1.093017697e+00f,
-    1.028940320e+00f,
-    1.109159470e+00f,
-    1.464398384e+00f,
-    1.141739011e+00f,
-    1.529776454e+00f,
-    1.042009354e+00f,
-    1.946170568e+00f,
-    1.365662098e+00f,
-    1.601727486e+00f,
-    1.227569342e+00f,
-    9.582631588e-01f,
-    9.176046252e-01f,
-    1.181964397e+00f,
-    9.711618423e-01f,
-    1.295995951e+00f,
-    9.967305064e-01f,
-    8.481454253e-01f,
-    8.566418290e-01f,
-    1.465746045e+00f,
-    9.339543581e-01f,
-    1.057118177e+00f,
-    8.452288508e-01f,
-    1.573592305e+00f,
-    6.504465342e-01f,
-    9.555170536e-01f,
-    1.038223386e+00f,
-    1.123340368e+00f,
-    1.172875285e+00f,
-    6.488108039e-01f,
-    8.219948411e-01f,
-    1.701052785e+00f,
-    1.437568188e+00f,
-    1.168715358e+00f,
-    1.145083547e+00f,
-    1.152026653e+00f,
-    8.804140091e-01f,
-    6.721233726e-01f,
-    8.732139468e-01f,
-    8.194968700e-01f,
-    6.639510989e-01f,
-    1.117260575e+00f,
-    8.695778251e-01f,
-    7.642731667e-01f,
-    8.983511925e-01f,
-    1.004794836e+00f,
-    1.752888083e+00f,
-    6.477756500e-01f,
-    1.284334064e+00f,
-    6.556008458e-01f,
-    8.835585713e-01f,
-    1.664388776e+00f,
-    1.018656611e+00f,
-    1.185480952e+00f,
-    1.515679240e+00f,
-    9.436312318e-01f,
-    1.023092389e+00f,
-    1.065471530e+00f,
-    8.220366240e-01f,
-    8.284674883e-01f,
-    5.964179039e-01f,
-    7.474663258e-01f,
-    1.261903167e+00f,
-    6.027646065e-01f,
-    1.194111705e+00f,
-    1.039524555e+00f,
-    1.256361127e+00f,
-    1.088030219e+00f,
-    1.171936750e+00f,
-    6.168959141e-01f,
-    2.301890612e+00f,
-    7.203692794e-01f,
-    9.580269456e-01f,
-    1.662980437e+00f,
-    1.098062158e+00f,
-    1.631987095e+00f,
-    2.478356123e+00f,
-    1.395316124e+00f,
-    6.932903528e-01f,
-    1.191927195e+00f,
-    2.546353340e+00f,
-    1.213990092e+00f,
-    9.665186405e-01f,
-    1.016512513e+00f,
-    1.113736153e+00f,
-    8.780897856e-01f,
-    1.259471297e+00f,
-    7.979862690e-01f,
-    1.024135947e+00f,
-    7.100879550e-01f,
-    7.882295847e-01f,
-    1.216184616e+00f,
-    8.310080767e-01f,
-    1.722517014e+00f,
-    1.309406519e+00f,
-    1.603609800e+00f,
-    1.393177986e+00f,
-    9.547496438e-01f,
-    5.788387656e-01f,
-    7.346550226e-01f,
-    7.237840295e-01f,
-    1.071815372e+00f,
-    1.144843459e+00f,
-    1.071495891e+00f,
-    2.227147818e+00f,
-    1.694362640e+00f,
-    6.171590686e-01f,
-    8.205550909e-01f,
-    1.127248764e+00f,
-    9.391498566e-01f,
-    2.279245377e+00f,
-    1.301460862e+00f,
-    5.505949259e-01f,
-    7.706961036e-01f,
-    1.702977061e+00f,
-    8.698681593e-01f,
-    1.193377256e+00f,
-    1.033771873e+00f,
-    9.984202385e-01f,
-    1.738031864e+00f,
-    1.313847542e+00f,
-    1.256419897e+00f,
-    1.112628222e+00f,
-    7.410564423e-01f,
-    1.810861230e+00f,
-    9.063841701e-01f,
-    1.506443262e+00f,
-    1.604800940e+00f,
-    1.312981009e+00f,
-    1.595384598e+00f,
-    1.353488684e+00f,
-    1.102641940e+00f,
-    1.032416701e+00f,
-    1.637751341e+00f,
-    8.845162988e-01f,
-    9.453933835e-01f,
-    1.094238758e+00f,
-    1.237709403e+00f,
-    1.469230056e+00f,
-    9.857752919e-01f,
-    6.720588207e-01f,
-    9.735382199e-01f,
-    5.395769477e-01f,
-    7.299184203e-01f,
-    1.080667496e+00f,
-    6.964608431e-01f,
-    1.184078932e+00f,
-    7.969007492e-01f,
-    1.101889133e+00f,
-    1.173120975e+00f,
-    1.030232906e+00f,
-    1.611171603e+00f,
-    1.153361917e+00f,
-    9.043052793e-01f,
-    9.182401299e-01f,
-    1.207140803e+00f,
-    1.560559273e+00f,
-    1.500944495e+00f,
-    1.432032824e+00f,
-    1.221314192e+00f,
-    1.251036763e+00f,
-    1.674261689e+00f,
-    1.454231739e+00f,
-    7.628481984e-01f,
-    8.563015461e-01f,
-    1.039633632e+00f,
-    1.092959046e+00f,
-    1.211203218e+00f,
-    7.539195418e-01f,
-    9.162573814e-01f,
-    7.498657107e-01f,
-    1.485238433e+00f,
-    1.316805601e+00f,
-    1.565153480e+00f,
-    1.376294136e+00f,
-    7.250006795e-01f,
-    8.489196897e-01f,
-    1.436775446e+00f,
-    9.252759814e-01f,
-    8.039588928e-01f,
-    6.131409407e-01f,
-    7.006232738e-01f,
-    1.628385067e+00f,
-    1.763650537e+00f,
-    1.124743819e+00f,
-    1.280189276e+00f,
-    1.164608598e+00f,
-    3.325790882e+00f,
-    6.781688929e-01f,
-    1.083824396e+00f,
-    8.353883028e-01f,
-    8.674530983e-01f,
-    1.788854718e+00f,
-    8.349257112e-01f,
-    1.427120328e+00f,
-    1.106421113e+00f,
-    7.661100626e-01f,
-    8.544356823e-01f,
-    8.943281770e-01f,
-    1.285867572e+00f,
-    8.291889429e-01f,
-    9.759733677e-01f,
-    7.654172182e-01f,
-    1.053792715e+00f,
-    1.658156395e+00f,
-    1.256912708e+00f,
-    9.293381572e-01f,
-    1.101291895e+00f,
-    1.431856751e+00f,
-    1.298681378e+00f,
-    1.083062768e+00f,
-    1.566204906e+00f,
-    1.329881549e+00f,
-    1.259835124e+00f,
-    1.311259151e+00f,
-    7.027595639e-01f,
-    7.456405759e-01f,
-    7.620569468e-01f,
-    7.372799516e-01f,
-    1.103659987e+00f,
-    8.848408461e-01f,
-    1.489208102e+00f,
-    1.184058666e+00f,
-    1.149028063e+00f,
-    1.615104437e+00f,
-    1.272771358e+00f,
-    1.233814240e+00f,
-    2.170522928e+00f,
-    1.574833035e+00f,
-    7.007219195e-01f,
-    1.118461251e+00f,
-    1.024718404e+00f,
-    1.214512587e+00f,
-    1.150225997e+00f,
-    8.516917229e-01f,
-    9.369635582e-01f,
-    1.217276931e+00f,
-    1.447559595e+00f,
-    1.763513207e+00f,
-    8.719739318e-01f,
-    1.004517555e+00f,
-    1.403569698e+00f,
-    1.192281365e+00f,
-    6.469679475e-01f,
-    1.374290466e+00f,
-    1.245765567e+00f,
-    5.679170489e-01f,
-    1.001211762e+00f,
-    1.295469642e+00f,
-    7.121184468e-01f,
-    1.020032287e+00f,
-    1.115753770e+00f,
-    5.276360512e-01f,
-    1.182943702e+00f,
-    9.964059591e-01f,
-    3.668472767e-01f,
-    5.089322329e-01f,
-    1.389929771e+00f,
-    5.873025060e-01f,
-    2.072912455e+00f,
-    1.882360339e+00f,
-    6.593108773e-01f,
-    1.198590398e+00f,
-    1.075560808e+00f,
-    9.281895757e-01f,
-    1.768924236e+00f,
-    1.049164653e+00f,
-    1.080226183e+00f,
-    1.876894593e+00f,
-    1.372395992e+00f,
-    7.973948121e-01f,
-    9.065961242e-01f,
-    1.320113301e+00f,
-    5.905120969e-01f,
-    8.160415292e-01f,
-    2.081265211e+00f,
-    6.601339579e-01f,
-    2.229694843e+00f,
-    1.625686765e+00f,
-    2.240889788e+00f,
-    8.595858216e-01f,
-    1.681116581e+00f,
-    1.586533904e+00f,
-    9.078447819e-01f,
-    5.118912458e-01f,
-    1.665885568e+00f,
-    1.343598127e+00f,
-    6.875813603e-01f,
-    4.084693789e-01f,
-    7.557789683e-01f,
-    1.023554802e+00f,
-    1.031653285e+00f,
-    1.206792235e+00f,
-    6.519435644e-01f,
-    9.050832987e-01f,
-    1.088430643e+00f,
-    7.391049862e-01f,
-    7.548205853e-01f,
-    8.134466410e-01f,
-    1.456248879e+00f,
-    6.790087819e-01f,
-    2.193139553e+00f,
-    1.154464722e+00f,
-    2.011810303e+00f,
-    4.571029246e-01f,
-    1.778169394e+00f,
-    1.129111409e+00f,
-    7.326179147e-01f,
-    8.536432385e-01f,
-    1.287581325e+00f,
-    8.499145508e-01f,
-    9.972245097e-01f,
-    1.020732641e+00f,
-    9.798022509e-01f,
-    8.125153184e-01f,
-    1.175002933e+00f,
-    5.593988299e-01f,
-    1.190916777e+00f,
-    1.705119967e+00f,
-    7.913679481e-01f,
-    1.681962848e+00f,
-    9.316692352e-01f,
-    5.122823715e-01f,
-    9.958659410e-01f,
-    6.484551430e-01f,
-    6.403080821e-01f,
-    1.635472655e+00f,
-    9.651586413e-01f,
-    1.366287470e+00f,
-    1.741400123e+00f,
-    1.058179379e+00f,
-    1.749509811e+00f,
-    8.683022261e-01f,
-    8.492492437e-01f,
-    1.572568774e+00f,
-    1.345724702e+00f,
-    1.085840344e+00f,
-    1.767881751e+00f,
-    1.496902347e+00f,
-    1.046345472e+00f,
-    1.028439164e+00f,
-    1.308279991e+00f,
-    8.894466162e-01f,
-    6.461821795e-01f,
-    1.173298478e+00f,
-    1.480623484e+00f,
-    1.191450357e+00f,
-    1.049013019e+00f,
-    8.947650194e-01f,
-    5.328033566e-01f,
-    1.090347290e+00f,
-    8.237041831e-01f,
-    1.008970618e+00f,
-    7.362480164e-01f,
-    1.744219899e+00f,
-    8.629054427e-01f,
-    1.016422629e+00f,
-    1.628924012e+00f,
-    6.129172444e-01f,
-    1.153186798e+00f,
-    9.298663735e-01f,
-    2.041563988e+00f,
-    8.551843166e-01f,
-    1.027845860e+00f,
-    8.541320562e-01f,
-    1.350547791e+00f,
-    1.481600881e+00f,
-    9.934151173e-01f,
-    8.619353175e-01f,
-    1.543779731e+00f,
-    1.052332640e+00f,
-    1.561186671e+00f,
-    1.242976427e+00f,
-    8.505307436e-01f,
-    9.808889031e-01f,
-    1.314283252e+00f,
-    1.030980587e+00f,
-    1.000925660e+00f,
-    8.841734529e-01f,
-    1.124431968e+00f,
-    6.900044084e-01f,
-    8.403484225e-01f,
-    8.017206192e-01f,
-    4.623498023e-01f,
-    1.256608367e+00f,
-    1.274041772e+00f,
-    8.320543766e-01f,
-    1.216106296e+00f,
-    8.771634102e-01f,
-    7.993959188e-01f,
-    1.161879301e+00f,
-    7.711181641e-01f,
-    1.176911116e+00f,
-    6.566501260e-01f,
-    6.774678826e-01f,
-    7.735642195e-01f,
-    1.259918451e+00f,
-    2.413059235e+00f,
-    7.686139941e-01f,
-    7.992377877e-01f,
-    1.404216051e+00f,
-    5.201512575e-01f,
-    8.582000136e-01f,
-    7.431305647e-01f,
-    1.845466375e+00f,
-    8.860034347e-01f,
-    1.182698369e+00f,
-    1.244931459e+00f,
-    1.121590734e+00f,
-    1.042713284e+00f,
-    8.642222881e-01f,
-    9.932292104e-01f,
-    9.779016972e-01f,
-    9.006551504e-01f,
-    8.071258664e-01f,
-    1.429880261e+00f,
-    6.961023808e-01f,
-    2.240217447e+00f,
-    1.463216662e+00f,
-    1.376335502e+00f,
-    1.326514959e+00f,
-    7.270141840e-01f,
-    8.188636899e-01f,
-    4.858519137e-01f,
-    1.178312659e+00f,
-    6.481001377e-01f,
-    9.267664552e-01f,
-    1.383139372e+00f,
-    7.996562123e-01f,
-    8.528388143e-01f,
-    1.205736637e+00f,
-    9.191271067e-01f,
-    1.533522844e+00f,
-    9.632627964e-01f,
-    1.381033778e+00f,
-    1.112030149e+00f,
-    1.509127378e+00f,
-    9.977483153e-01f,
-    1.686592817e+00f,
-    1.150094509e+00f,
-    9.747937322e-01f,
-    8.358494639e-01f,
-    1.386562705e+00f,
-    2.069392204e+00f,
-    1.025886297e+00f,
-    7.322966456e-01f,
-    1.230789661e+00f,
-    1.110944390e+00f,
-    7.197070122e-01f,
-    7.847635150e-01f,
-    1.087014318e+00f,
-    1.055313706e+00f,
-    1.068431139e+00f,
-    1.950640440e+00f,
-    8.773609996e-01f,
-    1.127013326e+00f,
-    7.031984925e-01f,
-    1.108332634e+00f,
-    4.623461366e-01f,
-    1.731050849e+00f,
-    1.393253803e+00f,
-    1.341284990e+00f,
-    1.320778489e+00f,
-    1.724444509e+00f,
-    1.026156902e+00f,
-    8.779514432e-01f,
-    1.270236611e+00f,
-    8.388916254e-01f,
-    1.003296614e+00f,
-    2.791213274e+00f,
-    5.029959083e-01f,
-    1.892613530e+00f,
-    1.131733060e+00f,
-    7.337889075e-01f,
-    1.105786800e+00f,
-    1.497993231e+00f,
-    1.101159811e+00f,
-    5.030040741e-01f,
-    8.172240257e-01f,
-    7.766136527e-01f,
-    1.434559226e+00f,
-    1.179217815e+00f,
-    1.724824071e+00f,
-    1.022652030e+00f,
-    8.051009774e-01f,
-    1.194153190e+00f,
-    9.014799595e-01f,
-    1.056646347e+00f,
-    1.517351866e+00f,
-    9.590551853e-01f,
-    8.822023869e-01f,
-    1.173911810e+00f,
-    1.444680691e+00f,
-    1.172645807e+00f,
-    1.257074952e+00f,
-    9.189572930e-01f,
-    2.275691509e+00f,
-    1.257501841e+00f,
-    1.467789888e+00f,
-    1.226231813e+00f,
-    1.055645227e+00f,
-    1.048848271e+00f,
-    1.216554523e+00f,
-    1.355977178e+00f,
-    1.473007321e+00f,
-    5.497668386e-01f,
-    7.997562289e-01f,
-    1.355976343e+00f,
-    1.271316051e+00f,
-    6.130627990e-01f,
-    1.625123978e+00f,
-    8.401995301e-01f,
-    1.401561856e+00f,
-    9.003563523e-01f,
-    1.520773292e+00f,
-    8.378561139e-01f,
-    1.028436065e+00f,
-    1.898577094e+00f,
-    1.029871583e+00f,
-    3.749752522e+00f,
-    6.992155313e-01f,
-    1.026767015e+00f,
-    2.557650328e+00f,
-    1.251595855e+00f,
-    8.872782588e-01f,
-    1.099368453e+00f,
-    7.781208158e-01f,
-    8.504294753e-01f,
-    4.557948411e-01f,
-    7.660557628e-01f,
-    1.181756735e+00f,
-    1.026530504e+00f,
-    1.364537835e+00f,
-    1.101571083e+00f,
-    9.354363084e-01f,
-    2.097554684e+00f,
-    8.133383989e-01f,
-    1.467940211e+00f,
-    6.793476939e-01f,
-    1.468555570e+00f,
-    1.043180943e+00f,
-    8.223367929e-01f,
-    1.030042410e+00f,
-    1.308633089e+00f,
-    1.848418355e+00f,
-    7.537735701e-01f,
-    1.122442126e+00f,
-    1.618040442e+00f,
-    1.814576507e+00f,
-    6.280802488e-01f,
-    6.670455933e-01f,
-    7.293744087e-01f,
-    1.234274983e+00f,
-    1.769916177e+00f,
-    1.466339231e+00f,
-    5.525006056e-01f,
-    1.065162301e+00f,
-    8.373740315e-01f,
-    1.205959320e+00f,
-    1.284149885e+00f,
-    1.389645100e+00f,
-    2.354198217e+00f,
-    7.652969956e-01f,
-    1.480956912e+00f,
-    8.285836577e-01f,
-    1.250043750e+00f,
-    7.416868806e-01f,
-    2.196385384e+00f,
-    1.012383223e+00f,
-    1.216605186e+00f,
-    2.043149471e+00f,
-    6.038135886e-01f,
-    1.100977898e+00f,
-    1.522399306e+00f,
-    1.049929380e+00f,
-    1.186764240e+00f,
-    8.989475965e-01f,
-    9.537348747e-01f,
-    2.040375948e+00f,
-    7.305302024e-01f,
-    8.963683248e-01f,
-    5.823889375e-01f,
-    1.002577543e+00f,
-    1.320304513e+00f,
-    8.181385994e-01f,
-    7.570196986e-01f,
-    6.882484555e-01f,
-    5.877881050e-01f,
-    1.807742000e+00f,
-    9.076288939e-01f,
-    1.039149284e+00f,
-    1.114997745e+00f,
-    7.242938280e-01f,
-    1.580939531e+00f,
-    7.485951185e-01f,
-    9.032822251e-01f,
-    9.116081595e-01f,
-    1.388257980e+00f,
-    1.468523383e+00f,
-    7.094362974e-01f,
-    1.292258859e+00f,
-    9.272863269e-01f,
-    9.367635250e-01f,
-    8.407594562e-01f,
-    9.382162690e-01f,
-    1.370787621e+00f,
-    9.930265546e-01f,
-    7.546870112e-01f,
-    5.776333809e-01f,
-    6.752998829e-01f,
-    8.310424685e-01f,
-    7.085610628e-01f,
-    6.950238943e-01f,
-    5.863609314e-01f,
-    1.137934089e+00f,
-    8.323377371e-01f,
-    8.882608414e-01f,
-    1.729581833e+00f,
-    8.036730886e-01f,
-    3.973803520e-01f,
-    7.982746959e-01f,
-    5.176122189e-01f,
-    9.920569062e-01f,
-    9.343632460e-01f,
-    5.583372712e-01f,
-    1.557097793e+00f,
-    8.991121054e-01f,
-    9.928177595e-01f,
-    8.550283909e-01f,
-    1.044950008e+00f,
-    5.147750378e-01f,
-    2.045772552e+00f,
-    8.924754262e-01f,
-    1.116863728e+00f,
-    1.000995874e+00f,
-    6.192839146e-01f,
-    7.902269959e-01f,
-    1.075716376e+00f,
-    6.631653309e-01f,
-    6.747975349e-01f,
-    6.313380599e-01f,
-    1.046386719e+00f,
-    5.877617598e-01f,
-    1.496098995e+00f,
-    6.424900293e-01f,
-    6.248546839e-01f,
-    1.224913478e+00f,
-    1.255090475e+00f,
-    8.904661536e-01f,
-    4.807704389e-01f,
-    6.677646041e-01f,
-    4.911874533e-01f,
-    9.220751524e-01f,
-    8.147249222e-01f,
-    7.957276106e-01f,
-    1.271333337e+00f,
-    1.040649772e+00f,
-    8.482222557e-01f,
-    5.177752972e-01f,
-    9.482824802e-01f,
-    6.569893956e-01f,
-    1.354528427e+00f,
-    1.355284929e+00f,
-    5.997238755e-01f,
-    6.373574138e-01f,
-    3.374874294e-01f,
-    1.301185727e+00f,
-    8.016730547e-01f,
-    1.107007384e+00f,
-    6.789290309e-01f,
-    1.633794785e+00f,
-    8.633393645e-01f,
-    6.454534531e-01f,
-    9.925090075e-01f,
-    7.170152068e-01f,
-    5.008391738e-01f,
-    7.293413281e-01f,
-    7.666670084e-01f,
-    1.347369075e+00f,
-    1.872967124e+00f,
-    1.428330421e+00f,
-    1.209103107e+00f,
-    9.648211598e-01f,
-    4.995595217e-01f,
-    9.467367530e-01f,
-    8.348972797e-01f,
-    8.101341128e-01f,
-    1.070137858e+00f,
-    9.331005812e-01f,
-    1.214787126e+00f,
-    1.320656300e+00f,
-    9.936733842e-01f,
-    1.021407485e+00f,
-    1.273295164e+00f,
-    7.427462935e-01f,
-    1.910969019e+00f,
-    7.325350046e-01f,
-    1.359176993e+00f,
-    1.841725945e+00f,
-    8.240463138e-01f,
-    3.598757386e-01f,
-    6.595531702e-01f,
-    6.068555117e-01f,
-    1.195795298e+00f,
-    9.486650825e-01f,
-    1.035403848e+00f,
-    7.445566058e-01f,
-    1.701023102e+00f,
-    3.935728073e-01f,
-    1.013736606e+00f,
-    1.303382397e+00f,
-    1.033909082e+00f,
-    1.137486935e+00f,
-    7.272353768e-01f,
-    9.115006328e-01f,
-    1.015464306e+00f,
-    1.011639595e+00f,
-    1.180759430e+00f,
-    1.383152246e+00f,
-    1.246265411e+00f,
-    1.113811970e+00f,
-    6.678498387e-01f,
-    1.097527742e+00f,
-    1.051450610e+00f,
-    2.377728701e+00f,
-    1.053703070e+00f,
-    1.125542879e+00f,
-    1.629351258e+00f,
-    6.469844580e-01f,
-    1.546741962e+00f,
-    1.352662921e+00f,
-    1.433930039e+00f,
-    8.179591298e-01f,
-    1.523748279e+00f,
-    8.232278824e-01f,
-    9.158370495e-01f,
-    1.878595233e+00f,
-    1.247959137e+00f,
-    1.054602265e+00f,
-    1.135512829e+00f,
-    8.053612709e-01f,
-    6.955926418e-01f,
-    6.506998539e-01f,
-    8.509577513e-01f,
-    6.037171483e-01f,
-    1.003539801e+00f,
-    7.270177603e-01f,
-    1.467449307e+00f,
-    1.115313411e+00f,
-    1.006151438e+00f,
-    1.205127716e+00f,
-    4.902011454e-01f,
-    6.799792647e-01f,
-    8.846588135e-01f,
-    9.689288139e-01f,
-    7.848926187e-01f,
-    8.358035684e-01f,
-    8.386132717e-01f,
-    1.446737528e+00f,
-    7.527863979e-01f,
-    8.342345357e-01f,
-    1.492806792e+00f,
-    8.506860733e-01f,
-    5.511378646e-01f,
-    1.189318538e+00f,
-    9.141055942e-01f,
-    8.730013371e-01f,
-    5.321239829e-01f,
-    1.035337210e+00f,
-    1.230630040e+00f,
-    1.470397115e+00f,
-    8.580878973e-01f,
-    1.029642701e+00f,
-    1.356959343e+00f,
-    8.052060008e-01f,
-    1.191014886e+00f,
-    7.821483016e-01f,
-    1.098746300e+00f,
-    1.111242652e+00f,
-    2.115413666e+00f,
-    1.120331526e+00f,
-    9.920072556e-01f,
-    1.091495752e+00f,
-    1.202752829e+00f,
-    9.914618731e-01f,
-    1.300559402e+00f,
-    1.245620012e+00f,
-    5.946988463e-01f,
-    9.746927023e-01f,
-    8.315091729e-01f,
-    6.657819152e-01f,
-    2.083680630e+00f,
-    3.969187140e-01f,
-    1.625086188e+00f,
-    1.008775115e+00f,
-    8.392245173e-01f,
-    1.402977467e+00f,
-    1.334935904e+00f,
-    9.983698726e-01f,
-    6.883871555e-01f,
-    1.041910291e+00f,
-    8.289917707e-01f,
-    1.143594742e+00f,
-    1.386357307e+00f,
-    1.319769144e+00f,
-    8.974838257e-01f,
-    1.561037064e+00f,
-    9.770575762e-01f,
-    9.575332999e-01f,
-    1.082523704e+00f,
-    1.298921227e+00f,
-    1.047488928e+00f,
-    1.077806115e+00f,
-    9.782459736e-01f,
-    8.494653702e-01f,
-    9.904997349e-01f,
-    1.096438169e+00f,
-    9.260802269e-01f,
-    8.444934487e-01f,
-    8.798800707e-01f,
-    1.016529679e+00f,
-    1.015098453e+00f,
-    1.472082496e+00f,
-    6.634716392e-01f,
-    1.310700655e+00f,
-    6.957566738e-01f,
-    7.190911770e-01f,
-    1.151771307e+00f,
-    1.259816051e+00f,
-    1.032828093e+00f,
-    1.227761984e+00f,
-    8.461022377e-01f,
-    6.817552447e-01f,
-    7.331160903e-01f,
-    7.860385180e-01f,
-    1.559783101e+00f,
-    9.363337159e-01f,
-    7.732557654e-01f,
-    5.313300490e-01f,
-    1.038178086e+00f,
-    1.902802110e+00f,
-    8.113145828e-01f,
-    1.798678160e+00f,
-    1.152930021e+00f,
-    6.180698872e-01f,
-    8.926464915e-01f,
-    1.001369357e+00f,
-    5.180128217e-01f,
-    6.063764691e-01f,
-    1.553268075e+00f,
-    1.369131804e+00f,
-    8.966547847e-01f,
-    1.469927907e+00f,
-    1.448195577e+00f,
-    1.085189819e+00f,
-    1.794282913e+00f,
-    9.289225340e-01f,
-    9.059315324e-01f,
-    1.280963778e+00f,
-    5.573332310e-01f,
-    1.196800113e+00f,
-    4.161389470e-01f,
-    5.007461905e-01f,
-    1.085680366e+00f,
-    1.257465005e+00f,
-    9.269834161e-01f,
-    9.256874919e-01f,
-    1.166696548e+00f,
-    9.028920531e-01f,
-    5.953265429e-01f,
-    5.545032024e-01f,
-    1.120169520e+00f,
-    1.650795102e+00f,
-    9.237922430e-01f,
-    1.170604944e+00f,
-    7.422936559e-01f,
-    1.300916076e+00f,
-    9.428038597e-01f,
-    9.654473662e-01f,
-    9.121818542e-01f,
-    9.305910468e-01f,
-    1.108080745e+00f,
-    1.170063734e+00f,
-    1.020536184e+00f,
-    7.510565519e-01f,
-    1.363698602e+00f,
-    1.467616677e+00f,
-    5.848629475e-01f,
-    1.207408547e+00f,
-    1.359843969e+00f,
-    9.983627200e-01f,
-    1.169851899e+00f,
-    1.824812889e+00f,
-    9.791809320e-01f,
-    1.217732549e+00f,
-    7.729762197e-01f,
-    9.858633280e-01f,
-    1.268651485e+00f,
-    2.177985668e+00f,
-    8.652083278e-01f,
-    9.515538812e-01f,
-    1.182033420e+00f,
-    9.801575541e-01f,
-    1.049782634e+00f,
-    9.266533852e-01f,
-    7.747927904e-01f,
-    1.237777591e+00f,
-    1.517953992e+00f,
-    1.718270659e+00f,
-    1.214361906e+00f,
-    9.831039906e-01f,
-    8.667664528e-01f,
-    1.441831946e+00f,
-    1.228910685e+00f,
-    1.198593140e+00f,
-    8.019370437e-01f,
-    1.870430827e+00f,
-    1.153764009e+00f,
-    1.098952055e+00f,
-    6.901340485e-01f,
-    8.222714067e-01f,
-    2.056210518e+00f,
-    1.028170705e+00f,
-    1.517171025e+00f,
-    6.529611945e-01f,
-    8.823017478e-01f,
-    9.069920182e-01f,
-    6.928448677e-01f,
-    1.378572226e+00f,
-    1.319238901e+00f,
-    2.225013018e+00f,
-    1.708566666e+00f,
-    1.192867041e+00f,
-    1.032408595e+00f,
-    2.227129221e+00f,
-    1.196091294e+00f,
-    1.688333511e+00f,
-    1.416711926e+00f,
-    1.195230603e+00f,
-    1.702949405e+00f,
-    1.322106838e+00f,
-    1.078171730e+00f,
-    7.117055655e-01f,
-    1.645607948e+00f,
-    1.029247284e+00f,
-    7.579684854e-01f,
-    1.009831667e+00f,
-    1.158724904e+00f,
-    8.765997887e-01f,
-    7.715262175e-01f,
-    9.823002219e-01f,
-    1.551505089e+00f,
-    1.102266788e+00f,
-    8.845582604e-01f,
-    1.412868023e+00f,
-    9.073390365e-01f,
-    1.776489377e+00f,
-    1.389859319e+00f,
-    1.902522087e+00f,
-    1.256401420e+00f,
-    1.744652152e+00f,
-    1.145425320e+00f,
-    1.558664083e+00f,
-    1.141206980e+00f,
-    8.201422095e-01f,
-    7.021356821e-01f,
-    8.990836740e-01f,
-    1.865795493e+00f,
-    1.547839046e+00f,
-    1.161578178e+00f,
-    1.388058901e+00f,
-    1.082531214e+00f,
-    1.007227540e+00f,
-    1.857967973e+00f,
-    1.785092473e+00f,
-    1.438097596e+00f,
-    1.425232768e+00f,
-    2.611738682e+00f,
-    8.787021637e-01f,
-    2.378920317e+00f,
-    8.697097301e-01f,
-    1.387012720e+00f,
-    8.241845369e-01f,
-    2.073868752e+00f,
-    1.180989027e+00f,
-    5.910286903e-01f,
-    6.331489086e-01f,
-    1.143881917e+00f,
-    8.287823200e-01f,
-    1.003807783e+00f,
-    9.842281938e-01f,
-    9.622916579e-01f,
-    1.446639776e+00f,
-    1.506646395e+00f,
-    1.119983196e+00f,
-    1.585357308e+00f,
-    6.111995578e-01f,
-    7.582661510e-01f,
-    1.510951757e+00f,
-    9.891843796e-01f,
-    5.356150866e-01f,
-    1.065020800e+00f,
-    1.582955956e+00f,
-    7.858291268e-01f,
-    1.176592946e+00f,
-    1.132461905e+00f,
-    2.056597948e+00f,
-    1.252476096e+00f,
-    1.787370920e+00f,
-    1.087988853e+00f,
-    9.770817757e-01f,
-    9.643900394e-01f,
-    1.505434036e+00f,
-    6.794521213e-01f,
-    9.034959078e-01f,
-    1.690364361e+00f,
-    8.242405653e-01f,
-    1.187285542e+00f,
-    9.751372933e-01f,
-    7.932745814e-01f,
-    1.316148281e+00f,
-    8.739988804e-01f,
-    9.690408111e-01f,
-    1.580660105e+00f,
-    8.550358415e-01f,
-    1.001682997e+00f,
-    1.722893953e+00f,
-    1.202710271e+00f,
-    1.107102752e+00f,
-    1.102484465e+00f,
-    1.196851730e+00f,
-    1.295674562e+00f,
-    8.691433072e-01f,
-    8.783276081e-01f,
-    1.046040297e+00f,
-    9.647898674e-01f,
-    9.552055001e-01f,
-    1.172835231e+00f,
-    8.203482032e-01f,
-    1.260493517e+00f,
-    9.152540565e-01f,
-    1.179219842e+00f,
-    1.941323876e+00f,
-    6.618829966e-01f,
-    1.253786802e+00f,
-    7.872223854e-01f,
-    7.201403379e-01f,
-    1.135963917e+00f,
-    9.800972342e-01f,
-    1.778423786e+00f,
-    1.139541626e+00f,
-    1.129596472e+00f,
-    5.576442480e-01f,
-    8.776305318e-01f,
-    7.550022006e-01f,
-    6.977189779e-01f,
-    9.674894214e-01f,
-    1.548827767e+00f,
-    6.813912988e-01f,
-    9.919613004e-01f,
-    9.747395515e-01f,
-    1.047144532e+00f,
-    1.057024121e+00f,
-    1.277836561e+00f,
-    9.874738455e-01f,
-    1.100282073e+00f,
-    5.618124008e-01f,
-    1.292285681e+00f,
-    1.282574415e+00f,
-    5.575487018e-01f,
-    5.239408612e-01f,
-    1.527992845e+00f,
-    1.173682332e+00f,
-    1.194268107e+00f,
-    1.731283784e+00f,
-    1.274374843e+00f,
-    1.370491147e+00f,
-    1.738977194e+00f,
-    2.720520020e+00f,
-    1.731123209e+00f,
-    1.453563571e+00f,
-    1.106396914e+00f,
-    1.814094543e+00f,
-    1.235020995e+00f,
-    5.668190718e-01f,
-    9.125962257e-01f,
-    8.799052835e-01f,
-    5.540217161e-01f,
-    1.739494920e+00f,
-    9.342130423e-01f,
-    7.992197275e-01f,
-    9.368388653e-01f,
-    7.873229980e-01f,
-    8.549305201e-01f,
-    9.435548186e-01f,
-    1.249425650e+00f,
-    8.429255486e-01f,
-    8.002055287e-01f,
-    5.765994191e-01f,
-    1.182148695e+00f,
-    5.761637688e-01f,
-    9.176236391e-01f,
-    7.135732174e-01f,
-    1.164272666e+00f,
-    5.133507848e-01f,
-    9.633730650e-01f,
-    5.810097456e-01f,
-    1.274389148e+00f,
-    8.231318593e-01f,
-    6.765248775e-01f,
-    7.872592807e-01f,
-    1.068517089e+00f,
-    6.532167792e-01f,
-    6.285774112e-01f,
-    1.288501978e+00f,
-    1.152699828e+00f,
-    5.394549370e-01f,
-    6.258776784e-01f,
-    9.969463944e-01f,
-    6.784623265e-01f,
-    7.930795550e-01f,
-    3.973553777e-01f,
-    4.461865127e-01f,
-    9.693460464e-01f,
-    1.163438559e+00f,
-    8.926467299e-01f,
-    8.632343411e-01f,
-    6.993963718e-01f,
-    1.321104884e+00f,
-    9.800836444e-01f,
-    1.823148489e+00f,
-    1.513893843e+00f,
-    9.532982707e-01f,
-    9.956557155e-01f,
-    1.148681760e+00f,
-    9.180313349e-01f,
-    9.849718809e-01f,
-    1.010962129e+00f,
-    7.323869467e-01f,
-    7.567951679e-01f,
-    1.382957458e+00f,
-    1.092260361e+00f,
-    1.134119153e+00f,
-    1.453087687e+00f,
-    1.612420678e+00f,
-    1.357346654e+00f,
-    1.114257932e+00f,
-    1.252043843e+00f,
-    9.832071662e-01f,
-    2.382795811e+00f,
-    9.379081726e-01f,
-    1.050273538e+00f,
-    1.290517926e+00f,
-    5.624837279e-01f,
-    1.176854849e+00f,
-    1.053680182e+00f,
-    1.609462976e+00f,
-    1.308729529e+00f,
-    1.611344218e+00f,
-    1.184866190e+00f,
-    1.274128437e+00f,
-    7.198030949e-01f,
-    9.387154579e-01f,
-    7.592687011e-01f,
-    1.247053981e+00f,
-    1.266808987e+00f,
-    1.928240538e+00f,
-    1.368340373e+00f,
-    1.166929603e+00f,
-    7.875673175e-01f,
-    1.539858103e+00f,
-    2.578027010e+00f,
-    9.888083935e-01f,
-    1.214620352e+00f,
-    1.052007437e+00f,
-    5.533108115e-01f,
-    9.454610348e-01f,
-    6.722260714e-01f,
-    1.376308084e+00f,
-    7.989563346e-01f,
-    1.350889206e+00f,
-    1.503433466e+00f,
-    5.263727903e-01f,
-    6.227201819e-01f,
-    4.419783950e-01f,
-    8.006060719e-01f,
-    9.888957739e-01f,
-    6.553278565e-01f,
-    5.785967112e-01f,
-    6.058472991e-01f,
-    6.167197227e-01f,
-    1.130765676e+00f,
-    1.046296597e+00f,
-    6.517030001e-01f,
-    5.604947209e-01f,
-    6.198100448e-01f,
-    3.858806789e-01f,
-    4.572511017e-01f,
-    6.958002448e-01f,
-    1.276780605e+00f,
-    1.368156791e+00f,
-    7.462849021e-01f,
-    1.148782253e+00f,
-    6.012374163e-01f,
-    2.991977334e-01f,
-    1.256462574e+00f,
-    2.255844355e+00f,
-    1.979166865e+00f,
-    1.152340531e+00f,
-    9.618924856e-01f,
-    1.000286698e+00f,
-    6.865001321e-01f,
-    1.157154918e+00f,
-    4.309237897e-01f,
-    8.182066083e-01f,
-    1.015817046e+00f,
-    1.012565851e+00f,
-    7.964841723e-01f,
-    8.333482146e-01f,
-    1.105306625e+00f,
-    1.209316134e+00f,
-    1.346391797e+00f,
-    4.733959138e-01f,
-    8.802481890e-01f,
-    6.191334128e-01f,
-    1.952931643e+00f,
-    1.191445947e+00f,
-    1.605549932e+00f,
-    1.064003587e+00f,
-    9.648464918e-01f,
-    1.000149727e+00f,
-    1.124552011e+00f,
-    6.200191379e-01f,
-    5.151681900e-01f,
-    9.789005518e-01f,
-    1.430387616e+00f,
-    4.175310731e-01f,
-    1.384780645e+00f,
-    8.464890718e-01f,
-    8.471928835e-01f,
-    8.246436715e-01f,
-    1.255697012e+00f,
-    5.979183912e-01f,
-    6.400130987e-01f,
-    5.812208652e-01f,
-    6.382421255e-01f,
-    6.345530748e-01f,
-    1.065279603e+00f,
-    5.498989224e-01f,
-    7.347596884e-01f,
-    8.018603325e-01f,
-    7.244687676e-01f,
-    1.019703150e+00f,
-    1.180456161e+00f,
-    1.420130610e+00f,
-    1.529479504e+00f,
-    6.149971485e-01f,
-    1.170484662e+00f,
-    6.598529220e-01f,
-    5.949036479e-01f,
-    1.145388484e+00f,
-    5.560336113e-01f,
-    1.208506584e+00f,
-    1.192947268e+00f,
-    6.776106954e-01f,
-    5.775665045e-01f,
-    9.106083512e-01f,
-    8.439801335e-01f,
-    9.245927930e-01f,
-    7.298148274e-01f,
-    1.101751566e+00f,
-    6.277186275e-01f,
-    7.472933531e-01f,
-    1.086366534e+00f,
-    9.227517247e-01f,
-    7.534047961e-01f,
-    6.268544793e-01f,
-    1.154058695e+00f,
-    9.423469305e-01f,
-    6.672707200e-01f,
-    7.089995146e-01f,
-    7.989140153e-01f,
-    8.608133197e-01f,
-    8.930344582e-01f,
-    6.496022344e-01f,
-    5.782438517e-01f,
-    7.547507882e-01f,
-    4.485155642e-01f,
-    4.107877910e-01f,
-    9.740483165e-01f,
-    1.323444247e+00f,
-    5.657743216e-01f,
-    1.331698895e+00f,
-    9.404534698e-01f,
-    1.272220254e+00f,
-    6.548790336e-01f,
-    1.003718734e+00f,
-    3.852993846e-01f,
-    7.239630818e-01f,
-    5.981165767e-01f,
-    5.121150017e-01f,
-    1.000210404e+00f,
-    6.614637971e-01f,
-    9.044125080e-01f,
-    8.333881497e-01f,
-    1.712807298e+00f,
-    1.429701924e+00f,
-    1.057935953e+00f,
-    8.003559113e-01f,
-    1.049194694e+00f,
-    2.498667955e+00f,
-    4.643568993e-01f,
-    1.055567503e+00f,
-    2.681223392e+00f,
-    1.170409560e+00f,
-    1.077789664e+00f,
-    1.566941619e+00f,
-    9.484873414e-01f,
-    8.247926831e-01f,
-    1.207805276e+00f,
-    1.291152596e+00f,
-    1.211706042e+00f,
-    1.801481009e+00f,
-    9.864732623e-01f,
-    7.763942480e-01f,
-    7.397160530e-01f,
-    1.253951311e+00f,
-    1.323736429e+00f,
-    1.849707127e+00f,
-    9.885774851e-01f,
-    6.216877699e-01f,
-    7.692557573e-01f,
-    1.574736595e+00f,
-    9.802671075e-01f,
-    5.694225430e-01f,
-    1.167577147e+00f,
-    1.405854464e+00f,
-    9.488924146e-01f,
-    1.242421746e+00f,
-    9.629408121e-01f,
-    8.473577499e-01f,
-    1.457639933e+00f,
-    1.409574389e+00f,
-    7.588509917e-01f,
-    1.647429228e+00f,
-    1.495624065e+00f,
-    1.362430334e+00f,
-    1.892333865e+00f,
-    1.294311404e+00f,
-    1.287139773e+00f,
-    6.928975582e-01f,
-    4.736331701e-01f,
-    8.140072823e-01f,
-    1.451779604e+00f,
-    1.595048785e+00f,
-    7.038396001e-01f,
-    7.982036471e-01f,
-    1.259351492e+00f,
-    1.096614838e+00f,
-    7.529988289e-01f,
-    1.333981156e+00f,
-    1.114182711e+00f,
-    1.436062217e+00f,
-    1.225744605e+00f,
-    7.289355397e-01f,
-    1.337436199e+00f,
-    7.491288185e-01f,
-    1.309593201e+00f,
-    7.301942110e-01f,
-    1.488694429e+00f,
-    7.046185136e-01f,
-    9.610459805e-01f,
-    7.032831907e-01f,
-    1.059134483e+00f,
-    1.274682760e+00f,
-    1.529363513e+00f,
-    1.467943311e+00f,
-    1.204629540e+00f,
-    1.612150550e+00f,
-    2.615189075e+00f,
-    1.376597166e+00f,
-    1.583288074e+00f,
-    1.325137019e+00f,
-    9.248513579e-01f,
-    7.088919878e-01f,
-    1.323035121e+00f,
-    2.314683437e+00f,
-    2.436577797e+00f,
-    1.165066361e+00f,
-    3.441169024e+00f,
-    1.572366953e+00f,
-    1.133351922e+00f,
-    1.776569247e+00f,
-    1.771741271e+00f,
-    1.224869490e+00f,
-    6.827139258e-01f,
-    1.403191447e+00f,
-    1.149685383e+00f,
-    1.361787677e+00f,
-    4.541583955e-01f,
-    9.932976365e-01f,
-    1.427334666e+00f,
-    8.706221581e-01f,
-    1.008459568e+00f,
-    1.486475587e+00f,
-    9.877079129e-01f,
-    1.190873146e+00f,
-    9.302559495e-01f,
-    6.931478977e-01f,
-    1.007396102e+00f,
-    9.113826752e-01f,
-    1.220743656e+00f,
-    2.459914684e+00f,
-    1.563485980e+00f,
-    1.003879905e+00f,
-    5.225849152e-01f,
-    1.297196627e+00f,
-    1.026230097e+00f,
-    1.201117158e+00f,
-    1.086670160e+00f,
-    1.255643010e+00f,
-    1.383252144e+00f,
-    1.105103970e+00f,
-    8.371216059e-01f,
-    2.082974911e+00f,
-    1.265789628e+00f,
-    1.724870920e+00f,
-    1.766193151e+00f,
-    1.226523995e+00f,
-    9.081218243e-01f,
-    2.026980162e+00f,
-    8.151557446e-01f,
-    7.169495821e-01f,
-    1.652411103e+00f,
-    1.995183587e+00f,
-    8.338710070e-01f,
-    1.026110291e+00f,
-    1.106384277e+00f,
-    7.156320214e-01f,
-    1.281610966e+00f,
-    7.072004676e-01f,
-    1.058682203e+00f,
-    7.542913556e-01f,
-    1.138900399e+00f,
-    7.421995997e-01f,
-    1.090718389e+00f,
-    1.605564952e+00f,
-    1.038883328e+00f,
-    1.083564520e+00f,
-    9.332318902e-01f,
-    1.234291077e+00f,
-    1.053034306e+00f,
-    1.458777666e+00f,
-    1.041809082e+00f,
-    1.183575153e+00f,
-    1.112755537e+00f,
-    1.305835366e+00f,
-    6.517760754e-01f,
-    8.177672029e-01f,
-    1.346471190e+00f,
-    5.668903589e-01f,
-    1.034086108e+00f,
-    1.565429330e+00f,
-    1.690929294e+00f,
-    7.389646173e-01f,
-    7.942267060e-01f,
-    6.185314059e-01f,
-    1.210788727e+00f,
-    9.631687999e-01f,
-    1.207147241e+00f,
-    9.741583467e-01f,
-    1.267825007e+00f,
-    1.012484789e+00f,
-    6.826793551e-01f,
-    1.145941019e+00f,
-    8.703509569e-01f,
-    7.598351240e-01f,
-    8.610165715e-01f,
-    9.051999450e-01f,
-    1.405329347e+00f,
-    1.471781611e+00f,
-    1.023633003e+00f,
-    6.663970947e-01f,
-    8.516752124e-01f,
-    1.490487337e+00f,
-    9.809383750e-01f,
-    1.062988877e+00f,
-    5.022027493e-01f,
-    1.070583463e+00f,
-    1.235191107e+00f,
-    8.874408007e-01f,
-    1.045508027e+00f,
-    8.827809691e-01f,
-    1.091719270e+00f,
-    7.574043870e-01f,
-    9.628484845e-01f,
-    1.394984484e+00f,
-    1.064781785e+00f,
-    6.826312542e-01f,
-    1.216505766e+00f,
-    8.913718462e-01f,
-    1.125234842e+00f,
-    7.979931831e-01f,
-    8.918316364e-01f,
-    5.408020616e-01f,
-    2.080396414e+00f,
-    6.896038055e-01f,
-    1.037683368e+00f,
-    1.742977977e+00f,
-    1.122194529e+00f,
-    2.036427736e+00f,
-    9.382500648e-01f,
-    6.741530299e-01f,
-    1.480276585e+00f,
-    1.751385570e+00f,
-    1.586943030e+00f,
-    1.862224460e+00f,
-    1.108900547e+00f,
-    1.001543045e+00f,
-    1.195536971e+00f,
-    1.089662790e+00f,
-    8.690573573e-01f,
-    8.500697017e-01f,
-    5.442566872e-01f,
-    1.106889725e+00f,
-    1.098273873e+00f,
-    7.919709086e-01f,
-    9.811785221e-01f,
-    8.495346904e-01f,
-    1.730954766e+00f,
-    2.412961960e+00f,
-    9.278193116e-01f,
-    3.725593090e+00f,
-    1.009272695e+00f,
-    8.868928552e-01f,
-    1.310587525e+00f,
-    5.998038054e-01f,
-    7.090957761e-01f,
-    1.131998777e+00f,
-    4.743728936e-01f,
-    1.367300034e+00f,
-    1.753836393e+00f,
-    8.451827168e-01f,
-    7.315691710e-01f,
-    5.742323399e-01f,
-    9.364294410e-01f,
-    7.332249284e-01f,
-    1.285981059e+00f,
-    1.137746096e+00f,
-    8.469631672e-01f,
-    8.776466250e-01f,
-    9.065284729e-01f,
-    1.327866554e+00f,
-    9.042251706e-01f,
-    1.243545175e+00f,
-    1.111968040e+00f,
-    1.002768278e+00f,
-    5.275369883e-01f,
-    1.184201717e+00f,
-    8.436858058e-01f,
-    1.054090381e+00f,
-    9.889698625e-01f,
-    1.022571921e+00f,
-    8.456817269e-01f,
-    1.069433212e+00f,
-    1.293607354e+00f,
-    7.594909668e-01f,
-    1.319142103e+00f,
-    5.485296249e-01f,
-    1.676607847e+00f,
-    1.002368808e+00f,
-    1.653047323e+00f,
-    1.211494684e+00f,
-    7.389245033e-01f,
-    8.451659083e-01f,
-    1.420441508e+00f,
-    1.658815622e+00f,
-    7.917450070e-01f,
-    7.798551321e-01f,
-    1.047332525e+00f,
-    1.389201045e+00f,
-    9.434744716e-01f,
-    1.521517873e+00f,
-    8.941761255e-01f,
-    1.227124810e+00f,
-    1.284434319e+00f,
-    1.294574261e+00f,
-    6.318643093e-01f,
-    1.433005333e+00f,
-    9.167490602e-01f,
-    1.167085409e+00f,
-    4.686631858e-01f,
-    5.627762079e-01f,
-    7.825801373e-01f,
-    9.386059642e-01f,
-    9.447456002e-01f,
-    1.784299493e+00f,
-    7.526580691e-01f,
-    8.428259492e-01f,
-    7.414843440e-01f,
-    9.071669579e-01f,
-    1.033205032e+00f,
-    9.350876212e-01f,
-    1.807550192e+00f,
-    6.444958448e-01f,
-    1.279028058e+00f,
-    1.072715044e+00f,
-    1.232666492e+00f,
-    5.589000583e-01f,
-    1.757879615e+00f,
-    7.872873545e-01f,
-    8.867009282e-01f,
-    1.573321223e+00f,
-    1.453496933e+00f,
-    7.282778621e-01f,
-    8.955417275e-01f,
-    2.105990410e+00f,
-    9.488653541e-01f,
-    1.124266028e+00f,
-    7.373865843e-01f,
-    9.551680684e-01f,
-    7.646803856e-01f,
-    1.349475861e+00f,
-    1.431208253e+00f,
-    1.786199808e+00f,
-    1.160431504e+00f,
-    1.419229627e+00f,
-    1.256577492e+00f,
-    9.945529103e-01f,
-    1.172806144e+00f,
-    7.203158140e-01f,
-    1.177686810e+00f,
-    8.194050193e-01f,
-    1.325494289e+00f,
-    1.214386582e+00f,
-    1.100893140e+00f,
-    1.173483610e+00f,
-    1.528346539e+00f,
-    1.580568314e+00f,
-    8.761305809e-01f,
-    7.391762733e-01f,
-    1.559832454e+00f,
-    1.517727375e+00f,
-    6.332575083e-01f,
-    7.849810719e-01f,
-    8.187411427e-01f,
-    9.909199476e-01f,
-    7.955276966e-01f,
-    1.048844814e+00f,
-    1.357897162e+00f,
-    8.443842530e-01f,
-    1.180829644e+00f,
-    8.898831606e-01f,
-    1.264336824e+00f,
-    1.286051750e+00f,
-    1.162223458e+00f,
-    7.624185681e-01f,
-    1.035341859e+00f,
-    1.612709165e+00f,
-    1.134503245e+00f,
-    9.712199569e-01f,
-    1.413556933e+00f,
-    2.198208332e+00f,
-    8.055099249e-01f,
-    8.717654347e-01f,
-    2.095668077e+00f,
-    7.588774562e-01f,
-    1.100757957e+00f,
-    8.861991763e-01f,
-    9.288626909e-01f,
-    1.115870833e+00f,
-    9.593344927e-01f,
-    1.933985114e+00f,
-    7.353683710e-01f,
-    4.877767265e-01f,
-    1.057599068e+00f,
-    1.289852738e+00f,
-    1.603410125e+00f,
-    6.241266131e-01f,
-    1.131014824e+00f,
-    2.087832212e+00f,
-    9.832345247e-01f,
-    4.564511776e-01f,
-    9.903203249e-01f,
-    1.004149914e+00f,
-    1.049557567e+00f,
-    1.326413512e+00f,
-    1.122768044e+00f,
-    1.867750406e+00f,
-    8.797484040e-01f,
-    1.053040862e+00f,
-    4.841686785e-01f,
-    1.584139824e+00f,
-    1.011534572e+00f,
-    8.264157772e-01f,
-    1.249360681e+00f,
-    9.298564792e-01f,
-    2.206527233e+00f,
-    1.119161010e+00f,
-    8.133029938e-01f,
-    1.646596789e+00f,
-    7.221030593e-01f,
-    5.302103162e-01f,
-    6.546220183e-01f,
-    8.596116900e-01f,
-    1.444441438e+00f,
-    1.325467348e+00f,
-    5.840200186e-01f,
-    1.482686639e+00f,
-    1.212410569e+00f,
-    1.326369643e+00f,
-    1.456264853e+00f,
-    1.471797466e+00f,
-    1.005996823e+00f,
-    5.419583321e-01f,
-    1.168858528e+00f,
-    8.978577256e-01f,
-    2.639817953e+00f,
-    1.100023508e+00f,
-    1.204460025e+00f,
-    1.869312406e+00f,
-    1.375920415e+00f,
-    1.486846209e+00f,
-    1.279971838e+00f,
-    2.130717516e+00f,
-    1.183931589e+00f,
-    6.750690341e-01f,
-    1.135266304e+00f,
-    9.678711891e-01f,
-    7.454382181e-01f,
-    1.307619572e+00f,
-    6.289820075e-01f,
-    9.073549509e-01f,
-    1.234653592e+00f,
-    7.075740695e-01f,
-    8.918631077e-01f,
-    1.005329609e+00f,
-    1.345431685e+00f,
-    6.509954333e-01f,
-    6.916797161e-01f,
-    4.807817340e-01f,
-    6.603706479e-01f,
-    1.106034994e+00f,
-    6.970713139e-01f,
-    8.610216975e-01f,
-    1.262433887e+00f,
-    8.049271107e-01f,
-    7.359002829e-01f,
-    1.150413275e+00f,
-    1.013069630e+00f,
-    1.536068320e+00f,
-    1.069748998e+00f,
-    8.638120890e-01f,
-    1.128525734e+00f,
-    4.877284169e-01f,
-    6.552610993e-01f,
-    7.442415357e-01f,
-    1.163021445e+00f,
-    7.568006516e-01f,
-    1.165474772e+00f,
-    1.037750959e+00f,
-    8.149783611e-01f,
-    1.485166192e+00f,
-    8.178795576e-01f,
-    1.652969003e+00f,
-    8.776105642e-01f,
-    1.353580952e+00f,
-    8.903474808e-01f,
-    1.350678921e+00f,
-    1.266549468e+00f,
-    8.458118439e-01f,
-    1.062971830e+00f,
-    9.957820773e-01f,
-    9.854536057e-01f,
-    7.586609721e-01f,
-    1.240749955e+00f,
-    7.855187058e-01f,
-    1.203732371e+00f,
-    1.420075297e+00f,
-    1.163811922e+00f,
-    8.680220842e-01f,
-    9.974089265e-01f,
-    1.368754148e+00f,
-    1.476554394e+00f,
-    1.906194687e+00f,
-    1.633580804e+00f,
-    8.687894344e-01f,
-    1.472308278e+00f,
-    1.149501324e+00f,
-    1.109560490e+00f,
-    7.632501721e-01f,
-    1.172800541e+00f,
-    1.629451513e+00f,
-    6.240375638e-01f,
-    1.405404329e+00f,
-    1.380809188e+00f,
-    1.660751343e+00f,
-    4.543131292e-01f,
-    1.414891243e+00f,
-    1.126981497e+00f,
-    9.536305666e-01f,
-    1.107898474e+00f,
-    1.565810323e+00f,
-    7.105503678e-01f,
-    9.782540798e-01f,
-    1.139511585e+00f,
-    1.074704885e+00f,
-    8.535150290e-01f,
-    2.331259012e+00f,
-    7.896323800e-01f,
-    5.013583899e-01f,
-    1.723945856e+00f,
-    1.252502918e+00f,
-    1.250629425e+00f,
-    8.607754707e-01f,
-    7.047997117e-01f,
-    1.186685324e+00f,
-    1.687516570e+00f,
-    1.384494543e+00f,
-    1.159378886e+00f,
-    6.796423793e-01f,
-    7.658904195e-01f,
-    1.032498360e+00f,
-    9.264901280e-01f,
-    6.891470551e-01f,
-    1.292923927e+00f,
-    1.801943898e+00f,
-    1.225486636e+00f,
-    2.046324968e+00f,
-    1.210543990e+00f,
-    1.490392208e+00f,
-    1.432037234e+00f,
-    7.229727507e-01f,
-    8.708069921e-01f,
-    1.144881248e+00f,
-    9.161061049e-01f,
-    1.048582196e+00f,
-    1.725803971e+00f,
-    1.686779857e+00f,
-    9.571551681e-01f,
-    1.576242447e+00f,
-    1.140032887e+00f,
-    9.156232476e-01f,
-    7.514352202e-01f,
-    4.376712143e-01f,
-    2.348301172e+00f,
-    9.144652486e-01f,
-    1.068357587e+00f,
-    1.467729449e+00f,
-    9.546498656e-01f,
-    9.558358192e-01f,
-    1.358781695e+00f,
-    8.795999289e-01f,
-    1.480870128e+00f,
-    8.821958899e-01f,
-    1.320760727e+00f,
-    9.919956326e-01f,
-    8.584246635e-01f,
-    1.038570046e+00f,
-    1.242454052e+00f,
-    1.828424454e+00f,
-    7.584141493e-01f,
-    1.083729148e+00f,
-    8.679271936e-01f,
-    1.028689861e+00f,
-    1.102556348e+00f,
-    6.323055029e-01f,
-    2.024466038e+00f,
-    1.292336822e+00f,
-    1.233027220e+00f,
-    9.568192363e-01f,
-    1.054466367e+00f,
-    1.079617262e+00f,
-    1.427856326e+00f,
-    1.568357706e+00f,
-    7.536600828e-01f,
-    7.666059136e-01f,
-    9.134566188e-01f,
-    1.973482609e+00f,
-    9.673504829e-01f,
-    9.648447037e-01f,
-    1.386122346e+00f,
-    1.410014510e+00f,
-    1.072364807e+00f,
-    1.215749025e+00f,
-    7.080158591e-01f,
-    8.526193500e-01f,
-    7.359578013e-01f,
-    8.387210965e-01f,
-    8.136058450e-01f,
-    6.982919574e-01f,
-    8.582846522e-01f,
-    1.305920005e+00f,
-    7.489217520e-01f,
-    4.636830688e-01f,
-    5.633550882e-01f,
-    9.317429662e-01f,
-    1.030110955e+00f,
-    2.587819815e+00f,
-    1.229394197e+00f,
-    8.670430779e-01f,
-    9.312406182e-01f,
-    9.261819720e-01f,
-    6.695691347e-01f,
-    1.022516251e+00f,
-    1.363645792e+00f,
-    1.270262003e+00f,
-    6.628704071e-01f,
-    5.511927009e-01f,
-    6.993687153e-01f,
-    6.937156916e-01f,
-    9.550622702e-01f,
-    7.324930429e-01f,
-    8.942577839e-01f,
-    5.765693188e-01f,
-    9.725552201e-01f,
-    1.166833043e+00f,
-    1.710054874e+00f,
-    1.114282489e+00f,
-    1.058907390e+00f,
-    6.086451411e-01f,
-    1.258229375e+00f,
-    1.005971789e+00f,
-    1.138232231e+00f,
-    1.087956309e+00f,
-    1.535623312e+00f,
-    9.320662022e-01f,
-    8.973083496e-01f,
-    7.655173540e-01f,
-    9.638075829e-01f,
-    7.956186533e-01f,
-    4.706761241e-01f,
-    1.034945130e+00f,
-    1.231210828e+00f,
-    9.818125367e-01f,
-    4.211733937e-01f,
-    5.496380329e-01f,
-    8.657671213e-01f,
-    1.295178533e+00f,
-    1.483803749e+00f,
-    2.233897448e+00f,
-    7.523242831e-01f,
-    1.273191690e+00f,
-    9.824800491e-01f,
-    1.440290093e+00f,
-    4.784587324e-01f,
-    9.780070186e-01f,
-    4.664619267e-01f,
-    7.894551754e-01f,
-    7.935266495e-01f,
-    1.174995780e+00f,
-    9.424363971e-01f,
-    6.223719716e-01f,
-    6.334186792e-01f,
-    1.058941960e+00f,
-    6.048295498e-01f,
-    7.337431908e-01f,
-    1.083337545e+00f,
-    8.708641529e-01f,
-    7.205876112e-01f,
-    1.535124540e+00f,
-    6.607753634e-01f,
-    1.217935562e+00f,
-    8.140013218e-01f,
-    6.161101460e-01f,
-    3.643310964e-01f,
-    9.543561935e-01f,
-    7.165069580e-01f,
-    7.472803593e-01f,
-    9.145718217e-01f,
-    6.131269336e-01f,
-    6.462463140e-01f,
-    9.774826169e-01f,
-    9.240190387e-01f,
-    7.617682815e-01f,
-    9.202200174e-01f,
-    1.918951035e+00f,
-    1.641608834e+00f,
-    1.314618707e+00f,
-    1.326165676e+00f,
-    1.919744968e+00f,
-    8.807345629e-01f,
-    1.644849658e+00f,
-    6.750847697e-01f,
-    1.410333514e+00f,
-    5.862331986e-01f,
-    1.077347755e+00f,
-    1.267699480e+00f,
-    1.388569832e+00f,
-    8.278383017e-01f,
-    1.228008628e+00f,
-    1.050921679e+00f,
-    8.122376800e-01f,
-    7.760546207e-01f,
-    6.208762527e-01f,
-    1.125115395e+00f,
-    1.295489192e+00f,
-    1.086133599e+00f,
-    1.597013593e+00f,
-    6.406648755e-01f,
-    1.071716547e+00f,
-    1.071514130e+00f,
-    1.149252772e+00f,
-    1.331001163e+00f,
-    1.002709150e+00f,
-    1.118120193e+00f,
-    1.114644527e+00f,
-    1.016502976e+00f,
-    7.419151068e-01f,
-    1.015321493e+00f,
-    6.260966659e-01f,
-    1.397941232e+00f,
-    1.761241198e+00f,
-    1.540671945e+00f,
-    8.553935885e-01f,
-    1.297214508e+00f,
-    1.154897451e+00f,
-    1.051360488e+00f,
-    1.225609899e+00f,
-    1.467730045e+00f,
-    6.856513023e-01f,
-    1.487549305e+00f,
-    7.375828028e-01f,
-    1.461847544e+00f,
-    1.036690474e+00f,
-    6.771619916e-01f,
-    7.612982988e-01f,
-    9.820886850e-01f,
-    1.670299530e+00f,
-    1.651854753e+00f,
-    5.593162179e-01f,
-    1.083614945e+00f,
-    1.058673739e+00f,
-    9.786785245e-01f,
-    1.083496332e+00f,
-    8.341631889e-01f,
-    6.237306595e-01f,
-    4.688957334e-01f,
-    7.866517305e-01f,
-    1.414277077e+00f,
-    1.215967655e+00f,
-    1.097055554e+00f,
-    4.868272841e-01f,
-    1.313487411e+00f,
-    1.001396537e+00f,
-    1.598147988e+00f,
-    1.342307925e+00f,
-    9.191067219e-01f,
-    1.530168295e+00f,
-    1.176619053e+00f,
-    9.238716364e-01f,
-    1.008332849e+00f,
-    5.286486149e-01f,
-    8.504182100e-01f,
-    8.586473465e-01f,
-    8.851086497e-01f,
-    1.823230624e+00f,
-    1.229148269e+00f,
-    1.301726580e+00f,
-    5.912848711e-01f,
-    1.021248698e+00f,
-    1.143658638e+00f,
-    1.801653981e+00f,
-    1.047054291e+00f,
-    7.650550008e-01f,
-    1.034391522e+00f,
-    6.049090028e-01f,
-    8.670820594e-01f,
-    1.387180567e+00f,
-    7.138252854e-01f,
-    1.093336821e+00f,
-    2.033306360e+00f,
-    1.239498377e+00f,
-    3.097520351e+00f,
-    1.123570323e+00f,
-    1.002099752e+00f,
-    1.417003512e+00f,
-    1.550887108e+00f,
-    8.437221050e-01f,
-    5.643795729e-01f,
-    1.031783104e+00f,
-    1.014088273e+00f,
-    7.961847782e-01f,
-    1.024233460e+00f,
-    9.351760149e-01f,
-    1.154544353e+00f,
-    4.494900405e-01f,
-    4.231291413e-01f,
-    3.436557949e-01f,
-    9.442084432e-01f,
-    1.126636386e+00f,
-    5.983553529e-01f,
-    2.545943022e+00f,
-    8.102667332e-01f,
-    1.106719732e+00f,
-    1.519710779e+00f,
-    4.758823514e-01f,
-    4.813335836e-01f,
-    7.299357653e-01f,
-    7.188845873e-01f,
-    7.781183124e-01f,
-    2.339227200e+00f,
-    1.787412167e+00f,
-    1.133404613e+00f,
-    1.509985328e+00f,
-    1.523486495e+00f,
-    7.092547417e-01f,
-    6.893669963e-01f,
-    1.445119977e+00f,
-    6.495809555e-01f,
-    1.443143725e+00f,
-    9.127869606e-01f,
-    1.884113789e+00f,
-    2.102850199e+00f,
-    1.443450928e+00f,
-    1.210561275e+00f,
-    8.875846863e-01f,
-    1.805922866e+00f,
-    1.117877364e+00f,
-    1.289971113e+00f,
-    1.888460398e+00f,
-    1.040328026e+00f,
-    9.559316635e-01f,
-    1.019039869e+00f,
-    8.965069056e-01f,
-    1.220721841e+00f,
-    1.162188411e+00f,
-    1.055787563e+00f,
-    1.803631663e+00f,
-    1.815917015e+00f,
-    1.454773784e+00f,
-    5.853667259e-01f,
-    1.891711354e+00f,
-    7.258599401e-01f,
-    1.334976196e+00f,
-    2.252453804e+00f,
-    1.162382603e+00f,
-    2.414053917e+00f,
-    1.163775086e+00f,
-    1.316771150e+00f,
-    1.356640339e+00f,
-    5.990558267e-01f,
-    6.590405703e-01f,
-    1.284339666e+00f,
-    1.374913096e+00f,
-    1.624305248e+00f,
-    8.052610159e-01f,
-    1.708682656e+00f,
-    2.662922144e+00f,
-    8.812524080e-01f,
-    1.198331952e+00f,
-    2.037784815e+00f,
-    1.640965581e+00f,
-    1.096734643e+00f,
-    1.361392975e+00f,
-    1.128166556e+00f,
-    6.284765005e-01f,
-    8.643139601e-01f,
-    9.090541005e-01f,
-    1.778671384e+00f,
-    2.516501904e+00f,
-    1.213225245e+00f,
-    4.856952727e-01f,
-    8.042815328e-01f,
-    7.560939193e-01f,
-    1.249305844e+00f,
-    1.296802878e+00f,
-    9.578793049e-01f,
-    1.356330752e+00f,
-    8.976335526e-01f,
-    6.863876581e-01f,
-    1.485526085e+00f,
-    9.607040882e-01f,
-    1.446497083e+00f,
-    1.432995915e+00f,
-    1.004644632e+00f,
-    7.676487565e-01f,
-    1.133428931e+00f,
-    1.315353870e+00f,
-    1.375596285e+00f,
-    7.197682858e-01f,
-    2.119753838e+00f,
-    1.247715235e+00f,
-    1.442044616e+00f,
-    9.544531703e-01f,
-    7.564984560e-01f,
-    8.489696980e-01f,
-    1.277222037e+00f,
-    1.040623069e+00f,
-    7.116556764e-01f,
-    6.241041422e-01f,
-    8.171590567e-01f,
-    6.277374029e-01f,
-    1.142011642e+00f,
-    9.256703258e-01f,
-    4.255108237e-01f,
-    7.472461462e-01f,
-    1.217480183e+00f,
-    1.090168118e+00f,
-    1.390402555e+00f,
-    5.851532221e-01f,
-    9.308419228e-01f,
-    9.249738455e-01f,
-    1.261897802e+00f,
-    1.346175313e+00f,
-    1.259452224e+00f,
-    1.255370378e+00f,
-    1.119541645e+00f,
-    9.856151342e-01f,
-    9.072293639e-01f,
-    7.243515253e-01f,
-    1.525718808e+00f,
-    1.348926306e+00f,
-    8.156315684e-01f,
-    1.464797497e+00f,
-    8.015174270e-01f,
-    6.775652170e-01f,
-    1.621107936e+00f,
-    2.031133890e+00f,
-    1.617372036e+00f,
-    1.562190652e+00f,
-    8.330491781e-01f,
-    8.531454206e-01f,
-    1.379002690e+00f,
-    9.776074886e-01f,
-    1.061738133e+00f,
-    8.170472383e-01f,
-    1.738716006e+00f,
-    1.266639233e+00f,
-    9.499720335e-01f,
-    1.166576624e+00f,
-    1.250862598e+00f,
-    1.863528490e+00f,
-    1.084066033e+00f,
-    2.486241817e+00f,
-    1.047156692e+00f,
-    1.137986064e+00f,
-    1.063413501e+00f,
-    1.338863134e+00f,
-    1.776266575e+00f,
-    7.075081468e-01f,
-    1.299076557e+00f,
-    1.298284411e+00f,
-    8.101466298e-01f,
-    1.429804444e+00f,
-    1.007392764e+00f,
-    5.752536654e-01f,
-    1.267254829e+00f,
-    1.268395901e+00f,
-    2.548931837e+00f,
-    1.611736894e+00f,
-    1.018629193e+00f,
-    1.610072374e+00f,
-    2.230666637e+00f,
-    7.075238228e-01f,
-    1.826283813e+00f,
-    9.162456989e-01f,
-    6.222851872e-01f,
-    6.052019596e-01f,
-    5.607279539e-01f,
-    1.649352789e+00f,
-    8.600504398e-01f,
-    7.664130926e-01f,
-    8.456356525e-01f,
-    1.263315201e+00f,
-    9.424014688e-01f,
-    7.773876190e-01f,
-    9.128421545e-01f,
-    6.869230866e-01f,
-    5.553300381e-01f,
-    1.696404934e+00f,
-    7.299784422e-01f,
-    2.667842627e+00f,
-    7.135995030e-01f,
-    8.437218070e-01f,
-    1.062580228e+00f,
-    1.076287985e+00f,
-    1.437582612e+00f,
-    8.462852836e-01f,
-    7.935677171e-01f,
-    1.083186984e+00f,
-    1.000998378e+00f,
-    5.234855413e-01f,
-    1.178205252e+00f,
-    8.093215227e-01f,
-    1.148220778e+00f,
-    1.104628205e+00f,
-    1.297866225e+00f,
-    9.837881923e-01f,
-    8.100841641e-01f,
-    8.393502831e-01f,
-    8.592597842e-01f,
-    6.371093392e-01f,
-    1.648114204e+00f,
-    9.368965030e-01f,
-    1.171964765e+00f,
-    1.302274942e+00f,
-    7.491275668e-01f,
-    7.552193403e-01f,
-    1.250268340e+00f,
-    1.279679894e+00f,
-    1.082969666e+00f,
-    1.731561422e+00f,
-    1.098507166e+00f,
-    1.566517711e+00f,
-    1.122095466e+00f,
-    1.474804997e+00f,
-    9.217670560e-01f,
-    1.096244097e+00f,
-    1.417668104e+00f,
-    9.917115569e-01f,
-    1.511250615e+00f,
-    6.954655051e-01f,
-    1.247145534e+00f,
-    1.032321215e+00f,
-    7.875183821e-01f,
-    1.302185178e+00f,
-    1.171362758e+00f,
-    4.849953353e-01f,
-    6.260759830e-01f,
-    1.289223671e+00f,
-    1.123573542e+00f,
-    1.638992190e+00f,
-    1.298391104e+00f,
-    5.907036066e-01f,
-    1.019697905e+00f,
-    1.140567422e+00f,
-    9.103475809e-01f,
-    1.636663795e+00f,
-    1.155159235e+00f,
-    1.117639661e+00f,
-    1.395060778e+00f,
-    1.166950703e+00f,
-    1.025018692e+00f,
-    1.080070138e+00f,
-    1.057532907e+00f,
-    1.160620451e+00f,
-    1.594220042e+00f,
-    1.347610593e+00f,
-    9.083916545e-01f,
-    1.116957068e+00f,
-    6.541931033e-01f,
-    6.418055892e-01f,
-    1.035856366e+00f,
-    1.652048588e+00f,
-    1.170033336e+00f,
-    1.270256281e+00f,
-    1.038240194e+00f,
-    6.508470774e-01f,
-    1.857354045e+00f,
-    1.329121828e+00f,
-    5.621125102e-01f,
-    8.201927543e-01f,
-    1.425002575e+00f,
-    1.461758018e+00f,
-    1.010587454e+00f,
-    8.453935385e-01f,
-    1.015748501e+00f,
-    1.762174964e+00f,
-    7.813056707e-01f,
-    4.667349160e-01f,
-    7.564837933e-01f,
-    9.165188074e-01f,
-    9.830781817e-01f,
-    9.182379842e-01f,
-    8.715800643e-01f,
-    1.154896855e+00f,
-    8.470448852e-01f,
-    9.286326766e-01f,
-    1.061964750e+00f,
-    1.007737398e+00f,
-    1.309911370e+00f,
-    7.856189609e-01f,
-    8.889310956e-01f,
-    8.755218983e-01f,
-    9.046270847e-01f,
-    4.110617042e-01f,
-    1.102426052e+00f,
-    1.804182649e+00f,
-    1.122832417e+00f,
-    9.949718118e-01f,
-    1.469588995e+00f,
-    1.188265800e+00f,
-    5.865743756e-01f,
-    5.882135630e-01f,
-    9.520642757e-01f,
-    9.286732078e-01f,
-    8.104584217e-01f,
-    1.135956049e+00f,
-    8.310410976e-01f,
-    4.702632725e-01f,
-    9.232634306e-01f,
-    1.227417588e+00f,
-    1.157759547e+00f,
-    8.044328690e-01f,
-    5.480468273e-01f,
-    9.941764474e-01f,
-    1.763833404e+00f,
-    1.197349310e+00f,
-    5.136775970e-01f,
-    6.080754399e-01f,
-    9.488272071e-01f,
-    6.947188377e-01f,
-    4.763044715e-01f,
-    7.244730592e-01f,
-    6.821675897e-01f,
-    8.918564916e-01f,
-    9.632588625e-01f,
-    4.382854700e-01f,
-    9.597663283e-01f,
-    8.153436780e-01f,
-    2.157161951e+00f,
-    9.231346846e-01f,
-    2.739141703e+00f,
-    1.057061076e+00f,
-    4.683304429e-01f,
-    1.058677554e+00f,
-    8.066082001e-01f,
-    1.313933611e+00f,
-    1.816193700e+00f,
-    1.583312511e+00f,
-    9.580751061e-01f,
-    1.100782037e+00f,
-    5.846261382e-01f,
-    1.381125569e+00f,
-    1.485303283e+00f,
-    1.344286919e+00f,
-    1.682602048e+00f,
-    1.006847143e+00f,
-    1.272189736e+00f,
-    7.852345109e-01f,
-    8.983818293e-01f,
-    9.110671282e-01f,
-    1.330512285e+00f,
-    1.070399642e+00f,
-    1.450704455e+00f,
-    1.273081064e+00f,
-    1.265125275e+00f,
-    1.339127064e+00f,
-    1.254390955e+00f,
-    5.718620420e-01f,
-    4.509847164e-01f,
-    8.980056047e-01f,
-    1.281495094e+00f,
-    6.264666915e-01f,
-    9.100369215e-01f,
-    1.280410886e+00f,
-    4.969018400e-01f,
-    4.653280377e-01f,
-    5.050218701e-01f,
-    1.026883006e+00f,
-    9.029986262e-01f,
-    7.725002766e-01f,
-    8.875238895e-01f,
-    9.863523841e-01f,
-    7.420130372e-01f,
-    7.120982409e-01f,
-    6.458228230e-01f,
-    5.493996143e-01f,
-    6.753993034e-01f,
-    4.356723726e-01f,
-    1.199877024e+00f,
-    1.742839217e+00f,
-    1.203103304e+00f,
-    5.318680406e-01f,
-    8.556026220e-01f,
-    6.218299866e-01f,
-    5.291877389e-01f,
-    7.240597606e-01f,
-    1.144282699e+00f,
-    9.578565359e-01f,
-    5.253832340e-01f,
-    1.064368606e+00f,
-    3.893379569e-01f,
-    4.617531002e-01f,
-    3.235763013e-01f,
-    5.593802929e-01f,
-    1.057835221e+00f,
-    4.170404673e-01f,
-    1.298735380e+00f,
-    6.861803532e-01f,
-    8.091159463e-01f,
-    4.119528234e-01f,
-    5.169730783e-01f,
-    3.055461943e-01f,
-    1.335359931e+00f,
-    1.355968714e+00f,
-    1.329397202e+00f,
-    1.472640872e+00f,
-    7.510151267e-01f,
-    5.495502353e-01f,
-    1.273295760e+00f,
-    5.595763326e-01f,
-    6.968497038e-01f,
-    9.869181514e-01f,
-    1.096187592e+00f,
-    5.526715517e-01f,
-    1.046550870e+00f,
-    7.129569650e-01f,
-    1.226219893e+00f,
-    5.300893784e-01f,
-    4.116720855e-01f,
-    4.785278141e-01f,
-    1.914621592e-01f,
-    1.851848841e+00f,
-    9.965399504e-01f,
-    8.864659071e-01f,
-    1.745274544e+00f,
-    1.710016489e+00f,
-    7.222665548e-01f,
-    1.610096097e+00f,
-    1.529488921e+00f,
-    1.056340456e+00f,
-    2.254026413e+00f,
-    6.954568624e-01f,
-    1.258068562e+00f,
-    5.153310895e-01f,
-    6.846279502e-01f,
-    6.185010076e-01f,
-    5.655893683e-01f,
-    5.798949003e-01f,
-    1.094659805e+00f,
-    1.401060939e+00f,
-    6.268866658e-01f,
-    1.007400632e+00f,
-    1.776922822e+00f,
-    8.342092633e-01f,
-    1.441335440e+00f,
-    7.553945184e-01f,
-    1.085670233e+00f,
-    1.062434673e+00f,
-    8.502015471e-01f,
-    1.212899804e+00f,
-    7.595709562e-01f,
-    1.351849556e+00f,
-    8.681024313e-01f,
-    1.373834252e+00f,
-    1.568008661e+00f,
-    6.334877014e-01f,
-    1.091805458e+00f,
-    1.014307857e+00f,
-    6.104565263e-01f,
-    8.617701530e-01f,
-    1.373969555e+00f,
-    1.072058678e+00f,
-    6.860543489e-01f,
-    8.157399297e-01f,
-    1.369314790e+00f,
-    9.408784509e-01f,
-    8.191351891e-01f,
-    1.071265101e+00f,
-    6.064705253e-01f,
-    1.012245178e+00f,
-    1.549887061e+00f,
-    1.051545978e+00f,
-    5.549432635e-01f,
-    1.144317865e+00f,
-    7.567830086e-01f,
-    1.156174541e+00f,
-    1.032323003e+00f,
-    1.107054234e+00f,
-    9.269034863e-01f,
-    1.291620612e+00f,
-    9.331773520e-01f,
-    1.010173321e+00f,
-    6.200278401e-01f,
-    8.701148629e-01f,
-    1.640798807e+00f,
-    8.554793596e-01f,
-    6.976661682e-01f,
-    1.116000414e+00f,
-    9.835218191e-01f,
-    1.146691442e+00f,
-    8.702884912e-01f,
-    9.484561682e-01f,
-    1.273350358e+00f,
-    7.751160860e-01f,
-    2.472804070e+00f,
-    7.958037853e-01f,
-    5.668219328e-01f,
-    8.753775358e-01f,
-    5.077438354e-01f,
-    1.062559366e+00f,
-    9.553746581e-01f,
-    8.017928004e-01f,
-    1.026972175e+00f,
-    1.146556139e+00f,
-    1.287975907e+00f,
-    1.301977754e+00f,
-    8.181297779e-01f,
-    1.217931986e+00f,
-    6.820176244e-01f,
-    1.144125819e+00f,
-    6.759842634e-01f,
-    9.228714705e-01f,
-    8.325284719e-01f,
-    1.140000582e+00f,
-    1.924212813e+00f,
-    8.480831385e-01f,
-    1.204314113e+00f,
-    1.011109948e+00f,
-    9.965991378e-01f,
-    1.469690919e+00f,
-    1.435178161e+00f,
-    1.191053629e+00f,
-    1.181884289e+00f,
-    8.810135722e-01f,
-    6.491478682e-01f,
-    9.504225850e-01f,
-    8.566278219e-01f,
-    8.877629042e-01f,
-    9.222170711e-01f,
-    1.152359486e+00f,
-    1.547138453e+00f,
-    9.764087796e-01f,
-    9.523344636e-01f,
-    8.595349789e-01f,
-    1.038380504e+00f,
-    1.103282332e+00f,
-    1.151254177e+00f,
-    1.497079730e+00f,
-    7.518893480e-01f,
-    9.977361560e-01f,
-    1.621066570e+00f,
-    9.705227017e-01f,
-    8.115245700e-01f,
-    9.689240456e-01f,
-    1.012213230e+00f,
-    9.651539326e-01f,
-    1.362299323e+00f,
-    1.125752687e+00f,
-    1.177227378e+00f,
-    9.177029729e-01f,
-    7.209056616e-01f,
-    6.156718731e-01f,
-    8.348609805e-01f,
-    1.144347548e+00f,
-    5.709934831e-01f,
-    8.589208126e-01f,
-    8.884515166e-01f,
-    9.456316829e-01f,
-    9.485892653e-01f,
-    1.663744330e+00f,
-    1.545420527e+00f,
-    2.476906300e+00f,
-    2.555462837e+00f,
-    5.793733597e-01f,
-    7.286037803e-01f,
-    1.510443807e+00f,
-    8.305106759e-01f,
-    9.895848036e-01f,
-    1.436401963e+00f,
-    7.591542006e-01f,
-    4.981223643e-01f,
-    6.714375019e-01f,
-    7.624673843e-01f,
-    6.931782961e-01f,
-    1.506000996e+00f,
-    1.141478539e+00f,
-    8.346676826e-01f,
-    1.506131530e+00f,
-    6.849800348e-01f,
-    1.397776365e+00f,
-    1.181117415e+00f,
-    1.037464976e+00f,
-    3.519302905e-01f,
-    7.732061744e-01f,
-    8.556960225e-01f,
-    1.263975501e+00f,
-    9.710111022e-01f,
-    6.941578984e-01f,
-    8.009846210e-01f,
-    1.090140224e+00f,
-    8.665013909e-01f,
-    1.350623488e+00f,
-    9.187742472e-01f,
-    1.773637056e+00f,
-    6.185356975e-01f,
-    8.297922015e-01f,
-    2.698801279e+00f,
-    6.426379681e-01f,
-    6.609361768e-01f,
-    2.086111069e+00f,
-    2.408674717e+00f,
-    1.151220798e+00f,
-    9.745928645e-01f,
-    1.408573151e+00f,
-    1.371204615e+00f,
-    8.238829374e-01f,
-    2.987178862e-01f,
-    1.476276398e+00f,
-    6.382372379e-01f,
-    1.438340664e+00f,
-    8.347033858e-01f,
-    7.203645706e-01f,
-    1.031835794e+00f,
-    9.483140111e-01f,
-    6.282984018e-01f,
-    6.660236716e-01f,
-    1.043820262e+00f,
-    1.456289053e+00f,
-    1.317860723e+00f,
-    9.049239755e-01f,
-    9.435438514e-01f,
-    1.146981597e+00f,
-    8.596554399e-01f,
-    1.518024325e+00f,
-    1.387609601e+00f,
-    9.179281592e-01f,
-    1.590561152e+00f,
-    8.499642611e-01f,
-    1.235256910e+00f,
-    1.512903333e+00f,
-    9.985688329e-01f,
-    1.197980523e+00f,
-    2.061739445e+00f,
-    2.266573191e+00f,
-    1.830189109e+00f,
-    8.711085916e-01f,
-    7.063397169e-01f,
-    1.124993920e+00f,
-    5.352346301e-01f,
-    6.639133692e-01f,
-    9.086871147e-01f,
-    1.046952248e+00f,
-    1.420833468e+00f,
-    6.339715719e-01f,
-    6.834092140e-01f,
-    1.336523771e+00f,
-    2.356909990e+00f,
-    1.269606352e+00f,
-    1.056934476e+00f,
-    8.590034246e-01f,
-    1.367166519e+00f,
-    7.257912755e-01f,
-    7.596350312e-01f,
-    1.173980355e+00f,
-    7.213151455e-01f,
-    7.725456953e-01f,
-    1.452094197e+00f,
-    1.087129354e+00f,
-    9.982941747e-01f,
-    9.109780192e-01f,
-    8.783966303e-01f,
-    1.291779876e+00f,
-    1.543787360e+00f,
-    1.252829432e+00f,
-    1.196256161e+00f,
-    1.687203288e+00f,
-    1.511911631e+00f,
-    7.662129402e-01f,
-    9.648828506e-01f,
-    1.922091842e+00f,
-    1.351562381e+00f,
-    9.702142477e-01f,
-    1.627169728e+00f,
-    5.812346935e-01f,
-    1.392514467e+00f,
-    1.285506010e+00f,
-    1.311380982e+00f,
-    7.309372425e-01f,
-    1.287338257e+00f,
-    8.433956504e-01f,
-    8.052002192e-01f,
-    5.856887102e-01f,
-    1.338384032e+00f,
-    7.809321880e-01f,
-    1.293554068e+00f,
-    1.844502449e+00f,
-    1.101585388e+00f,
-    1.077326655e+00f,
-    1.085619688e+00f,
-    1.685564160e+00f,
-    1.792200446e+00f,
-    1.038918138e+00f,
-    5.744268894e-01f,
-    1.357229829e+00f,
-    1.229771733e+00f,
-    8.831559420e-01f,
-    9.408147335e-01f,
-    1.085502148e+00f,
-    1.057530761e+00f,
-    9.676653147e-01f,
-    7.916642427e-01f,
-    1.336533427e+00f,
-    1.135926962e+00f,
-    1.776829243e+00f,
-    7.591035962e-01f,
-    2.042833805e+00f,
-    1.126824260e+00f,
-    5.846468210e-01f,
-    1.104642510e+00f,
-    5.310786963e-01f,
-    7.127585411e-01f,
-    1.041542053e+00f,
-    9.253583550e-01f,
-    7.190340161e-01f,
-    1.342522502e+00f,
-    1.337735057e+00f,
-    1.162062407e+00f,
-    1.063753963e+00f,
-    1.006244659e+00f,
-    1.020375729e+00f,
-    6.509519815e-01f,
-    1.367645741e+00f,
-    1.013579488e+00f,
-    1.064366102e+00f,
-    1.621902108e+00f,
-    1.125862598e+00f,
-    9.290319681e-01f,
-    9.569022655e-01f,
-    1.649682403e+00f,
-    9.093262553e-01f,
-    7.459782958e-01f,
-    1.035795689e+00f,
-    1.040538311e+00f,
-    5.653167367e-01f,
-    1.553509355e+00f,
-    2.377083063e+00f,
-    7.965158820e-01f,
-    9.561744928e-01f,
-    9.606144428e-01f,
-    1.210034966e+00f,
-    1.096865296e+00f,
-    1.187411666e+00f,
-    9.411960840e-01f,
-    7.881307006e-01f,
-    6.902536154e-01f,
-    1.330840230e+00f,
-    1.236575603e+00f,
-    1.490743399e+00f,
-    1.582541585e+00f,
-    1.004505992e+00f,
-    6.846263409e-01f,
-    1.212969184e+00f,
-    1.215783000e+00f,
-    1.147520185e+00f,
-    1.164159536e+00f,
-    9.840896726e-01f,
-    1.946471214e+00f,
-    6.984426379e-01f,
-    1.286229253e+00f,
-    7.154982686e-01f,
-    1.403838873e+00f,
-    7.565878034e-01f,
-    1.061249733e+00f,
-    5.847779512e-01f,
-    1.028782606e+00f,
-    1.061610818e+00f,
-    1.267514586e+00f,
-    1.017354369e+00f,
-    1.181530595e+00f,
-    6.379511952e-01f,
-    1.425381780e+00f,
-    6.970398426e-01f,
-    6.751360297e-01f,
-    7.730578184e-01f,
-    1.218508244e+00f,
-    8.136979342e-01f,
-    1.913904428e+00f,
-    3.869403899e-01f,
-    1.000879169e+00f,
-    5.965439677e-01f,
-    6.826115847e-01f,
-    9.562079310e-01f,
-    7.987816334e-01f,
-    8.597611189e-01f,
-    1.227012157e+00f,
-    1.401962042e+00f,
-    1.527769327e+00f,
-    5.822215676e-01f,
-    1.223627210e+00f,
-    9.965019226e-01f,
-    9.681610465e-01f,
-    7.704413533e-01f,
-    2.510258198e+00f,
-    5.748501420e-01f,
-    8.750318885e-01f,
-    1.155627251e+00f,
-    1.878468752e+00f,
-    4.416204095e-01f,
-    6.609488130e-01f,
-    1.030139089e+00f,
-    5.964573622e-01f,
-    9.546303153e-01f,
-    1.075984597e+00f,
-    1.625882149e+00f,
-    8.008669615e-01f,
-    1.279421926e+00f,
-    9.468094110e-01f,
-    1.484883070e+00f,
-    1.050906301e+00f,
-    4.901630878e-01f,
-    1.706667066e+00f,
-    1.584808946e+00f,
-    1.752798915e+00f,
-    1.585266113e+00f,
-    1.269092679e+00f,
-    1.023682237e+00f,
-    9.877537489e-01f,
-    1.008649230e+00f,
-    1.247163415e+00f,
-    7.032320499e-01f,
-    8.975030184e-01f,
-    1.384547472e+00f,
-    1.624719381e+00f,
-    1.509248734e+00f,
-    5.569102764e-01f,
-    8.605481982e-01f,
-    1.118209958e+00f,
-    6.783788800e-01f,
-    8.072868586e-01f,
-    9.749879837e-01f,
-    8.297352195e-01f,
-    1.343881607e+00f,
-    1.258410335e+00f,
-    9.811474681e-01f,
-    1.345477343e+00f,
-    1.185260534e+00f,
-    1.260214448e+00f,
-    9.783522487e-01f,
-    7.903353572e-01f,
-    1.194991946e+00f,
-    1.360932469e+00f,
-    6.102923751e-01f,
-    2.243982792e+00f,
-    6.236711144e-01f,
-    1.741788745e+00f,
-    6.951487064e-01f,
-    9.379047155e-01f,
-    1.150025249e+00f,
-    1.273470521e+00f,
-    1.069583416e+00f,
-    1.068736792e+00f,
-    1.388078094e+00f,
-    8.125616312e-01f,
-    9.936847091e-01f,
-    1.264169574e+00f,
-    9.471305609e-01f,
-    1.776426911e+00f,
-    7.737940550e-01f,
-    9.531390071e-01f,
-    1.269337296e+00f,
-    1.008545280e+00f,
-    1.371607780e+00f,
-    1.116178274e+00f,
-    1.415596962e+00f,
-    1.050865293e+00f,
-    7.347581983e-01f,
-    1.154458404e+00f,
-    1.121868134e+00f,
-    8.814180493e-01f,
-    1.520016670e+00f,
-    6.585208774e-01f,
-    6.960003376e-01f,
-    7.712349892e-01f,
-    7.623770237e-01f,
-    1.130199075e+00f,
-    1.474946499e+00f,
-    1.592034578e+00f,
-    6.594637036e-01f,
-    1.168251991e+00f,
-    2.609770775e+00f,
-    5.984462500e-01f,
-    1.241199851e+00f,
-    9.261049628e-01f,
-    7.188438773e-01f,
-    1.054649591e+00f,
-    1.458857775e+00f,
-    1.121170759e+00f,
-    2.359771878e-01f,
-    1.298421144e+00f,
-    1.820453167e+00f,
-    2.813372135e+00f,
-    1.314859629e+00f,
-    8.884804249e-01f,
-    6.380535960e-01f,
-    7.370231152e-01f,
-    5.083357692e-01f,
-    1.180221200e+00f,
-    1.522986531e+00f,
-    1.032141209e+00f,
-    1.138757110e+00f,
-    1.527696729e+00f,
-    1.091109991e+00f,
-    7.951911092e-01f,
-    9.401285648e-01f,
-    7.971156836e-01f,
-    9.374030828e-01f,
-    1.236540675e+00f,
-    1.234244466e+00f,
-    1.387478948e+00f,
-    6.968681812e-01f,
-    9.529809356e-01f,
-    1.457657814e+00f,
-    2.783379555e-01f,
-    1.003320694e+00f,
-    6.941964626e-01f,
-    1.214437246e+00f,
-    7.869974375e-01f,
-    1.419554591e+00f,
-    7.711872458e-01f,
-    7.002261281e-01f,
-    2.533337176e-01f,
-    1.161035061e+00f,
-    1.053692818e+00f,
-    6.180832982e-01f,
-    1.168271542e+00f,
-    1.314647675e+00f,
-    6.156299114e-01f,
-    1.159608960e+00f,
-    6.271705031e-01f,
-    1.425803900e+00f,
-    6.888695955e-01f,
-    1.088942885e+00f,
-    1.027164340e+00f,
-    7.657576203e-01f,
-    6.474165320e-01f,
-    9.305552840e-01f,
-    1.399906397e+00f,
-    8.910630941e-01f,
-    1.871105433e+00f,
-    8.603211641e-01f,
-    2.198723555e+00f,
-    6.529671550e-01f,
-    8.195446730e-01f,
-    1.154831052e+00f,
-    1.583059430e+00f,
-    1.035193920e+00f,
-    6.749431491e-01f,
-    6.286138892e-01f,
-    1.062636971e+00f,
-    8.243520856e-01f,
-    5.327857137e-01f,
-    1.417322755e+00f,
-    1.009378910e+00f,
-    1.427612782e+00f,
-    7.441608310e-01f,
-    8.616633415e-01f,
-    1.556404233e+00f,
-    9.358899593e-01f,
-    1.028805137e+00f,
-    1.472192645e+00f,
-    6.220194697e-01f,
-    1.111880779e+00f,
-    9.414668679e-01f,
-    1.355871201e+00f,
-    1.438709259e+00f,
-    7.870912552e-01f,
-    1.715241671e+00f,
-    1.158385992e+00f,
-    3.177545547e+00f,
-    6.072155237e-01f,
-    8.229134679e-01f,
-    1.649632931e+00f,
-    1.408561945e+00f,
-    1.171069503e+00f,
-    1.087943673e+00f,
-    1.348128080e+00f,
-    8.568503857e-01f,
-    5.074222684e-01f,
-    6.614980698e-01f,
-    6.761938930e-01f,
-    9.645267129e-01f,
-    6.864005327e-01f,
-    1.924017429e+00f,
-    1.234854698e+00f,
-    3.600132704e+00f,
-    8.828898668e-01f,
-    1.359402418e+00f,
-    6.996818185e-01f,
-    6.305304766e-01f,
-    7.186282873e-01f,
-    8.815430999e-01f,
-    1.048820138e+00f,
-    1.401843190e+00f,
-    1.227756143e+00f,
-    6.988686323e-01f,
-    7.580331564e-01f,
-    7.811690569e-01f,
-    1.065491915e+00f,
-    6.918137670e-01f,
-    1.249745727e+00f,
-    1.158628821e+00f,
-    1.453506589e+00f,
-    6.560963988e-01f,
-    1.297375441e+00f,
-    1.232964754e+00f,
-    9.194040895e-01f,
-    1.612032533e+00f,
-    7.210205197e-01f,
-    9.016713500e-01f,
-    1.029930234e+00f,
-    1.194870591e+00f,
-    5.239039063e-01f,
-    1.071823239e+00f,
-    1.237172723e+00f,
-    1.057435751e+00f,
-    9.325432777e-01f,
-    1.215385556e+00f,
-    1.839478731e+00f,
-    9.203557372e-01f,
-    1.239416003e+00f,
-    1.035987735e+00f,
-    9.703708291e-01f,
-    7.585279942e-01f,
-    1.125600457e+00f,
-    1.451859355e+00f,
-    7.591935992e-01f,
-    1.519475222e+00f,
-    8.201479316e-01f,
-    1.894650698e+00f,
-    2.557282448e+00f,
-    7.610643506e-01f,
-    1.375331759e+00f,
-    9.739885330e-01f,
-    7.529399395e-01f,
-    8.614582419e-01f,
-    1.659564257e+00f,
-    9.123917818e-01f,
-    1.231581569e+00f,
-    1.286783338e+00f,
-    4.907045960e-01f,
-    1.110539913e+00f,
-    1.909306288e+00f,
-    5.573570132e-01f,
-    6.229295731e-01f,
-    2.748293161e+00f,
-    1.359797716e+00f,
-    6.762373447e-01f,
-    2.252594948e+00f,
-    1.027072787e+00f,
-    1.035333276e+00f,
-    1.964217544e+00f,
-    8.179530501e-01f,
-    1.139701486e+00f,
-    7.594624758e-01f,
-    1.276251554e+00f,
-    5.753064752e-01f,
-    6.409541965e-01f,
-    1.101219773e+00f,
-    6.987607479e-01f,
-    1.000353336e+00f,
-    1.302174926e+00f,
-    6.528288722e-01f,
-    9.250773191e-01f,
-    1.026280403e+00f,
-    4.445053935e-01f,
-    1.586347580e+00f,
-    1.338328362e+00f,
-    8.918355107e-01f,
-    8.012160659e-01f,
-    1.069507718e+00f,
-    8.922763467e-01f,
-    1.633215189e+00f,
-    8.684281111e-01f,
-    5.636724830e-01f,
-    9.987784028e-01f,
-    7.420849204e-01f,
-    1.288598061e+00f,
-    1.048627615e+00f,
-    1.327491164e+00f,
-    1.104794741e+00f,
-    9.140899777e-01f,
-    6.603496075e-01f,
-    9.943571687e-01f,
-    8.432531953e-01f,
-    1.514901042e+00f,
-    1.587311149e+00f,
-    1.314661503e+00f,
-    6.078669429e-01f,
-    1.869632959e+00f,
-    1.143308282e+00f,
-    6.687046289e-01f,
-    9.946060181e-01f,
-    2.387537479e+00f,
-    1.533338308e+00f,
-    1.449217558e+00f,
-    1.404749393e+00f,
-    8.797999024e-01f,
-    8.082434535e-01f,
-    1.542733669e+00f,
-    1.038873076e+00f,
-    1.686606050e+00f,
-    8.214231133e-01f,
-    9.375060797e-01f,
-    1.678146601e+00f,
-    1.910744309e+00f,
-    8.240458369e-01f,
-    1.523513675e+00f,
-    1.360650063e+00f,
-    1.854993105e+00f,
-    2.357737780e+00f,
-    7.915942669e-01f,
-    5.170067549e-01f,
-    1.140137434e+00f,
-    9.040184617e-01f,
-    7.000815272e-01f,
-    9.206734896e-01f,
-    9.803866148e-01f,
-    1.134556890e+00f,
-    8.839085102e-01f,
-    7.400641441e-01f,
-    5.813642144e-01f,
-    9.859045744e-01f,
-    1.490038633e+00f,
-    1.173076391e+00f,
-    8.243404627e-01f,
-    7.020755410e-01f,
-    1.028111696e+00f,
-    1.093405604e+00f,
-    1.287873626e+00f,
-    1.411349297e+00f,
-    7.519957423e-01f,
-    1.233107805e+00f,
-    6.294420958e-01f,
-    1.330314517e+00f,
-    6.772496104e-01f,
-    7.742245793e-01f,
-    2.065190792e+00f,
-    2.125979900e+00f,
-    7.482729554e-01f,
-    1.087090969e+00f,
-    8.592189550e-01f,
-    1.274483442e+00f,
-    1.139397860e+00f,
-    1.313866735e+00f,
-    7.260184288e-01f,
-    1.220145464e+00f,
-    6.262328625e-01f,
-    6.027365327e-01f,
-    1.654107213e+00f,
-    9.493170977e-01f,
-    8.493934274e-01f,
-    9.377387166e-01f,
-    9.939042926e-01f,
-    8.868370056e-01f,
-    1.938117385e+00f,
-    7.721954584e-01f,
-    9.040003419e-01f,
-    1.298619390e+00f,
-    6.692410111e-01f,
-    1.685887456e+00f,
-    9.968674779e-01f,
-    6.482999325e-01f,
-    1.421164155e+00f,
-    6.457579732e-01f,
-    8.420212865e-01f,
-    1.061674118e+00f,
-    1.193875790e+00f,
-    1.153571010e+00f,
-    1.070395708e+00f,
-    6.241591573e-01f,
-    7.392382622e-01f,
-    9.965246916e-01f,
-    2.642535925e+00f,
-    9.589191079e-01f,
-    1.293804288e+00f,
-    7.528359294e-01f,
-    1.559599519e+00f,
-    8.243253231e-01f,
-    1.182724237e+00f,
-    1.572325706e+00f,
-    5.486621857e-01f,
-    1.058828354e+00f,
-    1.802062631e+00f,
-    6.523683071e-01f,
-    7.179260850e-01f,
-    8.163788319e-01f,
-    7.103822827e-01f,
-    5.679309368e-01f,
-    5.083365440e-01f,
-    9.296311736e-01f,
-    7.902874351e-01f,
-    1.298420787e+00f,
-    1.467983961e+00f,
-    1.115635753e+00f,
-    1.000400662e+00f,
-    1.655918717e+00f,
-    1.397949100e+00f,
-    1.763144135e+00f,
-    8.597292900e-01f,
-    8.291487098e-01f,
-    7.693163753e-01f,
-    1.247856140e+00f,
-    6.235538721e-01f,
-    9.029302001e-01f,
-    7.464888692e-01f,
-    1.373843074e+00f,
-    6.213659644e-01f,
-    1.052023172e+00f,
-    8.979930282e-01f,
-    6.450055242e-01f,
-    7.368204594e-01f,
-    1.245050311e+00f,
-    6.866989136e-01f,
-    1.277541399e+00f,
-    6.678607464e-01f,
-    1.929057121e+00f,
-    8.471233249e-01f,
-    1.565396905e+00f,
-    4.811120331e-01f,
-    8.100178242e-01f,
-    1.246811628e+00f,
-    8.507977724e-01f,
-    5.880047083e-01f,
-    1.268509150e+00f,
-    1.151214719e+00f,
-    1.270682335e+00f,
-    8.231258988e-01f,
-    1.342240572e+00f,
-    1.449742436e+00f,
-    5.079828501e-01f,
-    4.675890207e-01f,
-    3.267097175e-01f,
-    6.911078691e-01f,
-    1.054502249e+00f,
-    9.157026410e-01f,
-    1.181554079e+00f,
-    9.009183645e-01f,
-    1.091781020e+00f,
-    1.106086016e+00f,
-    1.546468854e+00f,
-    8.459357619e-01f,
-    1.764494658e+00f,
-    7.117714286e-01f,
-    1.272450089e+00f,
-    1.067817569e+00f,
-    2.351243019e+00f,
-    2.389683723e+00f,
-    9.669687748e-01f,
-    5.981477499e-01f,
-    9.597508907e-01f,
-    1.099264622e+00f,
-    8.839656711e-01f,
-    1.752201915e+00f,
-    1.080196261e+00f,
-    8.999754190e-01f,
-    9.751841426e-01f,
-    7.904240489e-01f,
-    1.473992109e+00f,
-    6.640552878e-01f,
-    7.243241072e-01f,
-    1.305529833e+00f,
-    6.974034309e-01f,
-    1.179931641e+00f,
-    2.499408960e+00f,
-    1.023481846e+00f,
-    1.116513252e+00f,
-    1.268050551e+00f,
-    8.488953114e-01f,
-    8.264681697e-01f,
-    1.297163725e+00f,
-    1.150847077e+00f,
-    1.540648103e+00f,
-    6.471108198e-01f,
-    7.834497094e-01f,
-    3.492935598e-01f,
-    7.071681619e-01f,
-    1.029841304e+00f,
-    6.289787889e-01f,
-    9.928025603e-01f,
-    9.577557445e-01f,
-    1.847408772e+00f,
-    7.647355795e-01f,
-    8.281359076e-01f,
-    1.840331197e+00f,
-    8.211548328e-01f,
-    8.622011542e-01f,
-    1.306343079e+00f,
-    1.070468187e+00f,
-    6.256738305e-01f,
-    1.646029115e+00f,
-    9.183477163e-01f,
-    8.081784248e-01f,
-    1.247012854e+00f,
-    1.185950875e+00f,
-    1.559246421e+00f,
-    1.261390924e+00f,
-    1.673623323e+00f,
-    1.536513925e+00f,
-    6.990865469e-01f,
-    6.707538962e-01f,
-    4.971992373e-01f,
-    9.359654188e-01f,
-    1.107077360e+00f,
-    1.176893115e+00f,
-    7.977295518e-01f,
-    6.191077828e-01f,
-    9.766330123e-01f,
-    1.088145971e+00f,
-    9.844239950e-01f,
-    9.425175190e-01f,
-    6.872191429e-01f,
-    7.490034103e-01f,
-    6.943546534e-01f,
-    9.170514941e-01f,
-    1.105517268e+00f,
-    5.467174649e-01f,
-    1.109917998e+00f,
-    2.314774513e+00f,
-    1.154186964e+00f,
-    1.529161096e+00f,
-    9.531142116e-01f,
-    9.583175182e-01f,
-    1.809097052e+00f,
-    7.263715863e-01f,
-    9.116017818e-01f,
-    1.239940166e+00f,
-    8.144553304e-01f,
-    8.510079384e-01f,
-    1.642322540e+00f,
-    1.167602301e+00f,
-    7.565596104e-01f,
-    1.350063205e+00f,
-    6.273122430e-01f,
-    9.262465835e-01f,
-    1.059505820e+00f,
-    9.260917902e-01f,
-    9.928394556e-01f,
-    7.753380537e-01f,
-    7.747285962e-01f,
-    9.823594689e-01f,
-    1.241933227e+00f,
-    1.220522881e+00f,
-    9.486052990e-01f,
-    1.153927684e+00f,
-    9.167640805e-01f,
-    4.989755452e-01f,
-    1.142753482e+00f,
-    1.612078190e+00f,
-    1.671111703e+00f,
-    8.562477827e-01f,
-    1.072736740e+00f,
-    8.410104513e-01f,
-    9.034318924e-01f,
-    1.271432161e+00f,
-    1.707836747e+00f,
-    7.698125243e-01f,
-    5.971168280e-01f,
-    1.048605204e+00f,
-    1.322113752e+00f,
-    9.134821296e-01f,
-    8.046660423e-01f,
-    1.275786757e+00f,
-    1.663691998e+00f,
-    7.462995052e-01f,
-    1.321526766e+00f,
-    8.911015391e-01f,
-    8.187782764e-01f,
-    1.250954151e+00f,
-    6.170665622e-01f,
-    1.370248914e+00f,
-    1.197796702e+00f,
-    8.328103423e-01f,
-    1.095532417e+00f,
-    2.268966913e+00f,
-    6.286129355e-01f,
-    8.650832772e-01f,
-    1.133174181e+00f,
-    9.803193808e-01f,
-    8.435192108e-01f,
-    7.292435765e-01f,
-    9.664924145e-01f,
-    9.661810398e-01f,
-    1.495934606e+00f,
-    8.655582070e-01f,
-    1.070115447e+00f,
-    6.813623905e-01f,
-    9.876981974e-01f,
-    6.387853622e-01f,
-    5.533031225e-01f,
-    1.145351887e+00f,
-    1.142625093e+00f,
-    7.903015018e-01f,
-    1.245870113e+00f,
-    1.415982604e+00f,
-    2.009793520e+00f,
-    1.144389868e+00f,
-    1.034118652e+00f,
-    8.706770539e-01f,
-    2.068080664e+00f,
-    6.685057282e-01f,
-    1.786844730e+00f,
-    5.257788897e-01f,
-    9.705504775e-01f,
-    1.024295568e+00f,
-    6.895235777e-01f,
-    4.367126226e-01f,
-    6.991290450e-01f,
-    1.078121066e+00f,
-    6.516761184e-01f,
-    5.915201306e-01f,
-    8.414553404e-01f,
-    1.226647735e+00f,
-    1.262368917e+00f,
-    1.307756305e+00f,
-    4.791107178e-01f,
-    1.057887077e+00f,
-    5.881692171e-01f,
-    5.300207734e-01f,
-    1.188455343e+00f,
-    1.098119497e+00f,
-    1.622759342e+00f,
-    8.092088103e-01f,
-    4.695843458e-01f,
-    8.070753813e-01f,
-    1.650823832e+00f,
-    1.109713316e+00f,
-    8.416086435e-01f,
-    1.419889808e+00f,
-    4.977822006e-01f,
-    1.272186399e+00f,
-    1.153614521e+00f,
-    9.994972944e-01f,
-    9.779302478e-01f,
-    1.517599463e+00f,
-    9.149238467e-01f,
-    6.864854097e-01f,
-    1.270761847e+00f,
-    1.069443345e+00f,
-    1.076828480e+00f,
-    1.217475414e+00f,
-    1.056443930e+00f,
-    4.927418232e-01f,
-    9.248232245e-01f,
-    1.295076013e+00f,
-    5.725166202e-01f,
-    6.422412395e-01f,
-    8.450964689e-01f,
-    1.018345594e+00f,
-    1.283568501e+00f,
-    9.510429502e-01f,
-    1.004026890e+00f,
-    1.008621693e+00f,
-    1.295712590e+00f,
-    8.778395653e-01f,
-    9.053834081e-01f,
-    1.604584098e+00f,
-    1.602332711e+00f,
-    1.118237853e+00f,
-    5.504393578e-01f,
-    8.958757520e-01f,
-    1.131128669e+00f,
-    8.645973206e-01f,
-    1.127825022e+00f,
-    1.464990258e+00f,
-    1.413942456e+00f,
-    5.624839664e-01f,
-    2.706756115e+00f,
-    9.013105035e-01f,
-    1.381479979e+00f,
-    1.113129497e+00f,
-    1.403770685e+00f,
-    1.299811959e+00f,
-    1.065620303e+00f,
-    1.292395949e+00f,
-    1.319906712e+00f,
-    7.165231109e-01f,
-    7.467497587e-01f,
-    3.286435306e-01f,
-    1.480674624e+00f,
-    1.128201962e+00f,
-    9.831624031e-01f,
-    8.790656924e-01f,
-    8.915514946e-01f,
-    1.850443929e-01f,
-    5.590333343e-01f,
-    2.736729085e-01f,
-    6.201933622e-01f,
-    1.126557827e+00f,
-    7.746785283e-01f,
-    1.365557671e+00f,
-    8.424000144e-01f,
-    1.031872272e+00f,
-    1.458281636e+00f,
-    1.545017838e+00f,
-    8.001292944e-01f,
-    8.442440033e-01f,
-    8.502723575e-01f,
-    1.034921050e+00f,
-    1.093097687e+00f,
-    1.381604433e+00f,
-    1.384675980e+00f,
-    9.654182792e-01f,
-    2.280961037e+00f,
-    7.865259647e-01f,
-    9.056367278e-01f,
-    1.015132308e+00f,
-    6.293209791e-01f,
-    4.476924837e-01f,
-    1.411973953e+00f,
-    1.061754823e+00f,
-    9.860450029e-01f,
-    7.688024044e-01f,
-    1.110208392e+00f,
-    1.898461819e+00f,
-    1.298388600e+00f,
-    1.250686884e+00f,
-    1.477903247e+00f,
-    1.075463057e+00f,
-    1.745311260e+00f,
-    9.338338375e-01f,
-    1.358303547e+00f,
-    1.367984891e+00f,
-    1.345044017e+00f,
-    9.651220441e-01f,
-    8.700600266e-01f,
-    1.233360052e+00f,
-    1.012731194e+00f,
-    9.024482369e-01f,
-    1.606609702e+00f,
-    1.394169211e+00f,
-    1.663588405e+00f,
-    1.288143516e+00f,
-    7.243798971e-01f,
-    1.902876139e+00f,
-    9.693470597e-01f,
-    1.438262939e+00f,
-    1.468971491e+00f,
-    4.959917367e-01f,
-    1.357925773e+00f,
-    7.517833710e-01f,
-    9.861948490e-01f,
-    1.032739997e+00f,
-    1.313945174e+00f,
-    1.059146881e+00f,
-    1.656611919e+00f,
-    9.059541225e-01f,
-    1.043074727e+00f,
-    8.728269339e-01f,
-    1.139343858e+00f,
-    1.659956217e+00f,
-    8.943043947e-01f,
-    5.528258085e-01f,
-    9.498249888e-01f,
-    6.778996587e-01f,
-    1.372244716e+00f,
-    1.275019407e+00f,
-    1.209390163e+00f,
-    2.329580545e+00f,
-    1.232027173e+00f,
-    1.507230282e+00f,
-    1.037285089e+00f,
-    1.525364637e+00f,
-    1.047944069e+00f,
-    7.376252413e-01f,
-    9.014919400e-01f,
-    1.382133603e+00f,
-    8.238783479e-01f,
-    8.098484278e-01f,
-    7.517125010e-01f,
-    8.998655081e-01f,
-    1.059217572e+00f,
-    8.796117306e-01f,
-    1.118463635e+00f,
-    9.123226404e-01f,
-    6.327067614e-01f,
-    1.985864282e+00f,
-    1.157323003e+00f,
-    1.050294042e+00f,
-    1.447189331e+00f,
-    1.294969082e+00f,
-    1.431519866e+00f,
-    7.169103026e-01f,
-    7.384339571e-01f,
-    8.293241262e-01f,
-    1.210868001e+00f,
-    1.254899979e+00f,
-    8.663468957e-01f,
-    1.223346472e+00f,
-    1.326547027e+00f,
-    8.530491590e-01f,
-    1.398949027e+00f,
-    1.855692625e+00f,
-    1.262797594e+00f,
-    1.352996588e+00f,
-    1.428534865e+00f,
-    7.920152545e-01f,
-    5.998538733e-01f,
-    8.698627949e-01f,
-    8.420261741e-01f,
-    1.229774475e+00f,
-    6.497035027e-01f,
-    5.883139372e-01f,
-    1.230038643e+00f,
-    1.133147836e+00f,
-    1.278069973e+00f,
-    1.083856702e+00f,
-    1.046372533e+00f,
-    7.539968491e-01f,
-    8.936050534e-01f,
-    8.911970258e-01f,
-    9.675508738e-01f,
-    1.222621679e+00f,
-    1.203793764e+00f,
-    1.189910293e+00f,
-    9.940813780e-01f,
-    7.640594840e-01f,
-    7.664367557e-01f,
-    1.038028002e+00f,
-    1.319641709e+00f,
-    9.156048298e-01f,
-    8.961247206e-01f,
-    7.353445888e-01f,
-    7.632621527e-01f,
-    1.199331999e+00f,
-    1.129900098e+00f,
-    1.110154152e+00f,
-    8.757577538e-01f,
-    1.398278952e+00f,
-    2.567674875e+00f,
-    9.110047817e-01f,
-    1.364492536e+00f,
-    1.191398740e+00f,
-    5.688182116e-01f,
-    8.921986818e-01f,
-    1.391516447e+00f,
-    8.155287504e-01f,
-    7.474897504e-01f,
-    8.424439430e-01f,
-    1.050309539e+00f,
-    1.353437543e+00f,
-    9.934201241e-01f,
-    1.106384039e+00f,
-    1.411743045e+00f,
-    1.307247162e+00f,
-    8.087592721e-01f,
-    9.663052559e-01f,
-    1.076533198e+00f,
-    1.239801288e+00f,
-    1.121650577e+00f,
-    1.023020744e+00f,
-    8.088759780e-01f,
-    1.500710487e+00f,
-    9.818606377e-01f,
-    1.084756374e+00f,
-    1.410446167e+00f,
-    1.280804873e+00f,
-    8.709372878e-01f,
-    1.110919356e+00f,
-    7.770761847e-01f,
-    1.224060655e+00f,
-    1.082158327e+00f,
-    5.272015929e-01f,
-    8.115307689e-01f,
-    8.692203760e-01f,
-    1.372602463e+00f,
-    1.002689362e+00f,
-    1.249797463e+00f,
-    6.911383867e-01f,
-    9.089813828e-01f,
-    1.133222699e+00f,
-    7.154135704e-01f,
-    9.365472794e-01f,
-    1.365068793e+00f,
-    1.729427695e+00f,
-    1.415526032e+00f,
-    2.646835744e-01f,
-    1.544066072e+00f,
-    1.071702003e+00f,
-    1.018980742e+00f,
-    3.903689086e-01f,
-    1.810880780e+00f,
-    5.664692521e-01f,
-    1.177694201e+00f,
-    1.730004668e+00f,
-    1.754781961e+00f,
-    1.554466605e+00f,
-    8.436574936e-01f,
-    1.030815125e+00f,
-    1.679188251e+00f,
-    1.498179317e+00f,
-    9.902613163e-01f,
-    1.588501453e+00f,
-    7.686122656e-01f,
-    1.180811763e+00f,
-    1.980198503e+00f,
-    6.900491714e-01f,
-    1.101799130e+00f,
-    5.654184222e-01f,
-    8.833837509e-01f,
-    1.015584469e+00f,
-    1.141084313e+00f,
-    8.339561224e-01f,
-    7.336059213e-01f,
-    1.905449748e+00f,
-    6.152315140e-01f,
-    8.805531263e-01f,
-    8.615542650e-01f,
-    6.644173861e-01f,
-    8.159430623e-01f,
-    1.439518452e+00f,
-    1.213166118e+00f,
-    1.139876604e+00f,
-    2.495604038e+00f,
-    7.877324224e-01f,
-    1.269164562e+00f,
-    7.053192258e-01f,
-    8.282372355e-01f,
-    8.648138046e-01f,
-    1.207762837e+00f,
-    5.622650981e-01f,
-    1.002372026e+00f,
-    7.761902809e-01f,
-    1.142078996e+00f,
-    5.711681843e-01f,
-    2.508882523e+00f,
-    1.158890605e+00f,
-    6.914127469e-01f,
-    9.007547498e-01f,
-    6.374924779e-01f,
-    7.356175184e-01f,
-    9.627259970e-01f,
-    2.048948765e+00f,
-    2.013672352e+00f,
-    9.791958332e-01f,
-    2.140929937e+00f,
-    1.186812401e+00f,
-    7.619380355e-01f,
-    1.117384791e+00f,
-    7.594551444e-01f,
-    8.808125854e-01f,
-    1.314535499e+00f,
-    6.437362432e-01f,
-    7.095753551e-01f,
-    1.141201019e+00f,
-    1.395944834e+00f,
-    8.682173491e-01f,
-    8.131785989e-01f,
-    1.122650266e+00f,
-    9.823507667e-01f,
-    1.083973646e+00f,
-    8.976105452e-01f,
-    7.487235665e-01f,
-    7.405710220e-01f,
-    1.324054599e+00f,
-    1.493724823e+00f,
-    8.964331746e-01f,
-    5.731928945e-01f,
-    7.109137774e-01f,
-    1.354015231e+00f,
-    1.165256143e+00f,
-    1.369908452e+00f,
-    5.834793448e-01f,
-    1.812122107e+00f,
-    1.082073450e+00f,
-    9.505572319e-01f,
-    8.017979264e-01f,
-    1.342459202e+00f,
-    1.285510302e+00f,
-    1.369106412e+00f,
-    1.163297772e+00f,
-    8.028596044e-01f,
-    1.983971119e+00f,
-    6.949586868e-01f,
-    1.099054337e+00f,
-    8.795027137e-01f,
-    1.268142700e+00f,
-    1.160190344e+00f,
-    8.580485582e-01f,
-    6.364225745e-01f,
-    8.746010065e-01f,
-    1.396995306e+00f,
-    1.999554753e+00f,
-    1.098896027e+00f,
-    1.236283302e+00f,
-    1.613946676e+00f,
-    1.426915050e+00f,
-    5.327469110e-01f,
-    9.876060486e-01f,
-    1.943694472e+00f,
-    1.094264865e+00f,
-    2.200170040e+00f,
-    5.941866040e-01f,
-    1.370375752e+00f,
-    8.823758364e-01f,
-    1.158547282e+00f,
-    1.484705687e+00f,
-    7.772979736e-01f,
-    1.402394652e+00f,
-    9.521036148e-01f,
-    1.884672880e+00f,
-    1.128391147e+00f,
-    1.134077668e+00f,
-    7.668108940e-01f,
-    1.496584654e+00f,
-    1.377524495e+00f,
-    1.047626734e+00f,
-    6.827926040e-01f,
-    8.159699440e-01f,
-    1.424359441e+00f,
-    1.127760172e+00f,
-    1.110243797e+00f,
-    1.357410312e+00f,
-    7.867962122e-01f,
-    1.571876407e+00f,
-    6.364234090e-01f,
-    7.135248184e-01f,
-    7.563208342e-01f,
-    4.511546493e-01f,
-    6.758227348e-01f,
-    8.948715925e-01f,
-    8.884674311e-01f,
-    1.489692688e+00f,
-    6.470126510e-01f,
-    9.745076299e-01f,
-    1.884712696e+00f,
-    1.821311474e+00f,
-    1.696935058e+00f,
-    1.160449028e+00f,
-    1.479223132e+00f,
-    1.456041932e+00f,
-    8.742974997e-01f,
-    1.298103452e+00f,
-    1.174876332e+00f,
-    7.600463033e-01f,
-    5.238197446e-01f,
-    1.735717893e+00f,
-    1.654365659e+00f,
-    1.277598500e+00f,
-    6.488621831e-01f,
-    1.007971168e+00f,
-    1.165015340e+00f,
-    6.711397767e-01f,
-    8.064934015e-01f,
-    9.805065393e-01f,
-    9.000933170e-01f,
-    7.405571938e-01f,
-    1.364112020e+00f,
-    1.020583272e+00f,
-    1.065566421e+00f,
-    8.181886077e-01f,
-    6.472817659e-01f,
-    9.806939363e-01f,
-    6.919984221e-01f,
-    1.475318193e+00f,
-    7.531540394e-01f,
-    3.632165492e-01f,
-    8.200230598e-01f,
-    1.154464245e+00f,
-    8.582549095e-01f,
-    1.772806764e+00f,
-    1.654485464e+00f,
-    9.403526783e-01f,
-    8.178790808e-01f,
-    1.034604549e+00f,
-    7.165821195e-01f,
-    1.416986942e+00f,
-    1.944225430e+00f,
-    7.874273062e-01f,
-    8.261924982e-01f,
-    1.093042850e+00f,
-    2.444384575e+00f,
-    4.678969085e-01f,
-    8.601891994e-01f,
-    1.641653061e+00f,
-    1.075372338e+00f,
-    1.588980317e+00f,
-    9.383288026e-01f,
-    1.371195793e+00f,
-    8.676599264e-01f,
-    7.584616542e-01f,
-    1.483773947e+00f,
-    8.187059164e-01f,
-    1.065906525e+00f,
-    7.642507553e-01f,
-    2.640514851e+00f,
-    5.437009335e-01f,
-    1.042376876e+00f,
-    6.690794826e-01f,
-    7.909287214e-01f,
-    1.614050746e+00f,
-    8.029571772e-01f,
-    9.338220954e-01f,
-    1.793465853e+00f,
-    1.006624818e+00f,
-    8.608096242e-01f,
-    4.519462883e-01f,
-    1.973749280e+00f,
-    1.526500821e+00f,
-    1.234235883e+00f,
-    2.069692850e+00f,
-    6.888206005e-01f,
-    9.031861424e-01f,
-    1.074855089e+00f,
-    2.471638203e+00f,
-    9.600678086e-01f,
-    1.479990602e+00f,
-    1.930725098e+00f,
-    9.363959432e-01f,
-    9.368400574e-01f,
-    9.722715616e-01f,
-    9.321725965e-01f,
-    8.666227460e-01f,
-    7.182958126e-01f,
-    1.248582959e+00f,
-    1.974463105e+00f,
-    1.549253464e+00f,
-    1.889719725e+00f,
-    1.006168604e+00f,
-    1.047242284e+00f,
-    1.118437648e+00f,
-    7.290207744e-01f,
-    6.891043186e-01f,
-    1.534085870e+00f,
-    8.709328771e-01f,
-    1.349895716e+00f,
-    1.416715622e+00f,
-    1.403696775e+00f,
-    6.188777089e-01f,
-    3.795612156e-01f,
-    8.432444334e-01f,
-    9.068440795e-01f,
-    1.398107052e+00f,
-    1.145351887e+00f,
-    9.350534678e-01f,
-    1.282436490e+00f,
-    1.052881122e+00f,
-    1.659212351e+00f,
-    8.263067007e-01f,
-    1.841403365e+00f,
-    1.848719478e+00f,
-    1.031305909e+00f,
-    7.849286199e-01f,
-    1.103097200e+00f,
-    7.044587731e-01f,
-    9.654544592e-01f,
-    1.949118853e+00f,
-    1.223191142e+00f,
-    1.568512082e+00f,
-    9.054900408e-01f,
-    8.262752295e-01f,
-    1.282818913e+00f,
-    1.182205439e+00f,
-    1.259901881e+00f,
-    1.090634227e+00f,
-    6.381958723e-01f,
-    1.186461568e+00f,
-    1.403579712e+00f,
-    1.990966558e+00f,
-    1.273289561e+00f,
-    8.040876389e-01f,
-    9.001376033e-01f,
-    1.186396480e+00f,
-    6.556486487e-01f,
-    7.071855068e-01f,
-    7.899953127e-01f,
-    1.107884288e+00f,
-    4.743191302e-01f,
-    1.217168927e+00f,
-    8.736069798e-01f,
-    1.022396088e+00f,
-    1.320170522e+00f,
-    1.535608530e+00f,
-    8.407738805e-01f,
-    8.974784613e-01f,
-    2.303383589e+00f,
-    7.781754732e-01f,
-    9.844220281e-01f,
-    1.597523093e+00f,
-    5.537531376e-01f,
-    1.123334646e+00f,
-    1.137971520e+00f,
-    1.947724223e+00f,
-    1.963310838e+00f,
-    8.578906059e-01f,
-    9.738900065e-01f,
-    1.044396758e+00f,
-    1.030137062e+00f,
-    1.386978626e+00f,
-    1.047946811e+00f,
-    9.296087027e-01f,
-    1.114077330e+00f,
-    1.412970901e+00f,
-    1.397425890e+00f,
-    9.575672150e-01f,
-    1.519788384e+00f,
-    8.375507593e-01f,
-    1.579361439e+00f,
-    6.934403777e-01f,
-    1.147140145e+00f,
-    9.810141325e-01f,
-    1.150335431e+00f,
-    8.020570874e-01f,
-    1.106150627e+00f,
-    8.430316448e-01f,
-    8.427259326e-01f,
-    1.370898485e+00f,
-    1.220077395e+00f,
-    1.167450428e+00f,
-    1.215826511e+00f,
-    1.401992917e+00f,
-    5.655261278e-01f,
-    3.180543482e-01f,
-    8.403601646e-01f,
-    1.201608658e+00f,
-    2.034907579e+00f,
-    1.220535755e+00f,
-    4.339003563e-01f,
-    1.102653265e+00f,
-    1.469715714e+00f,
-    8.377693892e-01f,
-    1.051963687e+00f,
-    1.551125646e+00f,
-    1.198006153e+00f,
-    8.189038634e-01f,
-    2.086367369e+00f,
-    1.229236245e+00f,
-    8.569735885e-01f,
-    8.627144694e-01f,
-    6.630330086e-01f,
-    6.694545150e-01f,
-    1.468206525e+00f,
-    9.262710214e-01f,
-    1.169779658e+00f,
-    1.217457056e+00f,
-    1.431023836e+00f,
-    1.464896917e+00f,
-    1.091113210e+00f,
-    1.585451007e+00f,
-    1.324025035e+00f,
-    5.944384336e-01f,
-    1.348959804e+00f,
-    5.280292630e-01f,
-    2.441770077e+00f,
-    2.124083042e+00f,
-    1.895732522e+00f,
-    7.641249895e-01f,
-    9.784842134e-01f,
-    8.229457140e-01f,
-    7.654897571e-01f,
-    1.101237297e+00f,
-    6.037699580e-01f,
-    1.278523564e+00f,
-    1.107155800e+00f,
-    9.143724442e-01f,
-    4.897139966e-01f,
-    8.903650641e-01f,
-    1.080265999e+00f,
-    1.419951677e+00f,
-    1.702934623e+00f,
-    1.305223703e+00f,
-    9.753899574e-01f,
-    3.248375058e-01f,
-    5.479720831e-01f,
-    8.404035568e-01f,
-    1.779844522e+00f,
-    1.483516693e+00f,
-    5.307956338e-01f,
-    1.122249603e+00f,
-    1.525002837e+00f,
-    9.259587526e-01f,
-    2.510091543e+00f,
-    1.465458751e+00f,
-    1.686954021e+00f,
-    1.007153988e+00f,
-    1.178148627e+00f,
-    7.500840425e-01f,
-    1.569723129e+00f,
-    1.439864874e+00f,
-    7.641377449e-01f,
-    7.168570161e-01f,
-    1.969252825e+00f,
-    1.935182571e+00f,
-    1.450538635e+00f,
-    1.641940117e+00f,
-    7.502872944e-01f,
-    1.185557842e+00f,
-    7.553511858e-01f,
-    8.733851314e-01f,
-    1.234470844e+00f,
-    6.892418265e-01f,
-    6.582478881e-01f,
-    1.312845349e+00f,
-    8.942642212e-01f,
-    8.550901413e-01f,
-    6.237476468e-01f,
-    1.144439697e+00f,
-    1.494281411e+00f,
-    1.142472148e+00f,
-    8.687120080e-01f,
-    9.194006920e-01f,
-    9.285976887e-01f,
-    1.339813709e+00f,
-    1.510960937e+00f,
-    8.411539197e-01f,
-    8.267296553e-01f,
-    1.076634169e+00f,
-    1.374543905e+00f,
-    1.102734327e+00f,
-    7.861850858e-01f,
-    6.496347189e-01f,
-    8.462340832e-01f,
-    1.288917065e+00f,
-    1.902032852e+00f,
-    1.015246868e+00f,
-    6.738744974e-01f,
-    1.165537357e+00f,
-    7.562488914e-01f,
-    1.485880017e+00f,
-    9.230242372e-01f,
-    1.710313559e+00f,
-    1.039438963e+00f,
-    1.519556880e+00f,
-    7.980009317e-01f,
-    1.310294509e+00f,
-    1.236371398e+00f,
-    1.025661230e+00f,
-    2.491555214e+00f,
-    5.052565336e-01f,
-    1.069877028e+00f,
-    9.941369295e-01f,
-    7.029458284e-01f,
-    1.148974776e+00f,
-    8.763778806e-01f,
-    4.777194560e-01f,
-    8.339645863e-01f,
-    1.076209068e+00f,
-    1.173873425e+00f,
-    1.328768849e+00f,
-    4.653300047e-01f,
-    1.450856924e+00f,
-    9.801008701e-01f,
-    9.422836900e-01f,
-    7.321448326e-01f,
-    7.206033468e-01f,
-    2.086877584e+00f,
-    1.486881971e+00f,
-    6.863377094e-01f,
-    9.467988014e-01f,
-    9.679160714e-01f,
-    1.506444335e+00f,
-    5.885778666e-01f,
-    1.454165339e+00f,
-    1.551863551e+00f,
-    5.551472902e-01f,
-    9.303075671e-01f,
-    7.876875997e-01f,
-    6.357380748e-01f,
-    2.220974684e+00f,
-    1.826041102e+00f,
-    1.257753372e+00f,
-    1.847395539e+00f,
-    1.165911078e+00f,
-    6.983219385e-01f,
-    1.029110312e+00f,
-    1.124502659e+00f,
-    5.835367441e-01f,
-    5.813828707e-01f,
-    7.749374509e-01f,
-    9.173789024e-01f,
-    2.195682764e+00f,
-    6.116189361e-01f,
-    1.576878548e+00f,
-    1.012589097e+00f,
-    9.479225874e-01f,
-    6.171362400e-01f,
-    8.203485012e-01f,
-    9.699153900e-01f,
-    1.235023260e+00f,
-    8.774388433e-01f,
-    8.247745037e-01f,
-    4.741348624e-01f,
-    1.133954167e+00f,
-    1.022435427e+00f,
-    9.104440212e-01f,
-    1.221951723e+00f,
-    5.386042595e-01f,
-    9.294593930e-01f,
-    9.016261697e-01f,
-    1.314219594e+00f,
-    8.466340303e-01f,
-    1.442219377e+00f,
-    2.018095970e+00f,
-    9.180709124e-01f,
-    1.294684887e+00f,
-    1.308082581e+00f,
-    1.409129024e+00f,
-    5.075704455e-01f,
-    1.248056293e+00f,
-    1.670350432e+00f,
-    2.620852947e+00f,
-    9.610818624e-01f,
-    1.394804120e+00f,
-    1.358610392e+00f,
-    1.472952008e+00f,
-    1.264940500e+00f,
-    1.691342115e+00f,
-    1.359724879e+00f,
-    9.915695190e-01f,
-    1.143445134e+00f,
-    6.984985471e-01f,
-    5.468733311e-01f,
-    9.736921787e-01f,
-    1.451526523e+00f,
-    1.412084699e+00f,
-    7.527372837e-01f,
-    6.553667784e-01f,
-    7.868127227e-01f,
-    9.515507817e-01f,
-    1.204700947e+00f,
-    9.867079258e-01f,
-    1.202914119e+00f,
-    1.299934983e+00f,
-    8.368443251e-01f,
-    8.313174844e-01f,
-    7.749044895e-01f,
-    7.892013788e-01f,
-    1.155243397e+00f,
-    1.859658003e+00f,
-    7.311905622e-01f,
-    9.154797792e-01f,
-    5.411980152e-01f,
-    7.589419484e-01f,
-    5.268918276e-01f,
-    7.821061611e-01f,
-    9.865506291e-01f,
-    8.902959824e-01f,
-    1.367782712e+00f,
-    1.072052956e+00f,
-    6.964737177e-01f,
-    1.016047359e+00f,
-    1.031073451e+00f,
-    8.316146135e-01f,
-    6.960029006e-01f,
-    1.198224664e+00f,
-    9.396852851e-01f,
-    1.128233433e+00f,
-    1.048472404e+00f,
-    1.162454009e+00f,
-    7.898388505e-01f,
-    7.359435558e-01f,
-    9.604197741e-01f,
-    8.126692772e-01f,
-    5.047041178e-01f,
-    6.393696666e-01f,
-    1.280901313e+00f,
-    6.040627360e-01f,
-    6.640865803e-01f,
-    5.602763295e-01f,
-    7.452670336e-01f,
-    5.135957003e-01f,
-    1.026100039e+00f,
-    1.061064482e+00f,
-    7.498141527e-01f,
-    1.857192755e+00f,
-    9.192916751e-01f,
-    6.915282607e-01f,
-    8.773245215e-01f,
-    1.072537661e+00f,
-    1.494402051e+00f,
-    1.102289557e+00f,
-    1.694271207e+00f,
-    1.024956584e+00f,
-    1.002506375e+00f,
-    1.456673622e+00f,
-    1.034229636e+00f,
-    9.542722106e-01f,
-    7.786232233e-01f,
-    1.001096487e+00f,
-    1.811359406e+00f,
-    1.016228080e+00f,
-    7.915216684e-01f,
-    9.062839150e-01f,
-    1.256018758e+00f,
-    9.397585392e-01f,
-    1.100582957e+00f,
-    9.207193851e-01f,
-    1.006532907e+00f,
-    1.299347401e+00f,
-    6.458615661e-01f,
-    8.541120887e-01f,
-    1.274674654e+00f,
-    1.271670699e+00f,
-    7.933424711e-01f,
-    4.174179733e-01f,
-    6.687299609e-01f,
-    5.539788604e-01f,
-    1.056600571e+00f,
-    6.263217926e-01f,
-    1.028558969e+00f,
-    7.772627473e-01f,
-    8.640807271e-01f,
-    1.287714243e+00f,
-    9.694073200e-01f,
-    1.026063561e+00f,
-    7.503285408e-01f,
-    6.745203733e-01f,
-    2.910569310e-01f,
-    7.400598526e-01f,
-    1.140774250e+00f,
-    8.106194139e-01f,
-    8.807187080e-01f,
-    1.418643117e+00f,
-    9.212628007e-01f,
-    1.041998744e+00f,
-    1.272053719e+00f,
-    4.181312025e-01f,
-    1.006426454e+00f,
-    8.007189035e-01f,
-    8.918335438e-01f,
-    1.148902774e+00f,
-    7.779110074e-01f,
-    1.014041424e+00f,
-    1.242790580e+00f,
-    1.150707483e+00f,
-    1.164271355e+00f,
-    1.764944911e+00f,
-    8.232017756e-01f,
-    1.825007796e+00f,
-    9.782002568e-01f,
-    2.846602678e+00f,
-    1.285718322e+00f,
-    1.071985483e+00f,
-    1.306182861e+00f,
-    9.869630933e-01f,
-    1.024744987e+00f,
-    5.489779711e-01f,
-    1.050990224e+00f,
-    1.275541067e+00f,
-    7.870560884e-01f,
-    4.790740609e-01f,
-    9.073398709e-01f,
-    1.313524723e+00f,
-    1.498041511e+00f,
-    8.322961926e-01f,
-    8.798177242e-01f,
-    5.110964179e-01f,
-    3.644090891e-01f,
-    5.621458292e-01f,
-    9.785904288e-01f,
-    1.081700325e+00f,
-    1.112213969e+00f,
-    7.728695273e-01f,
-    6.328170300e-01f,
-    1.076936364e+00f,
-    1.983470917e+00f,
-    9.541527629e-01f,
-    1.506590724e+00f,
-    8.307276368e-01f,
-    9.847474098e-01f,
-    2.331745625e+00f,
-    1.480104804e+00f,
-    1.249543786e+00f,
-    1.186806917e+00f,
-    1.123023868e+00f,
-    9.651311636e-01f,
-    5.062377453e-01f,
-    1.378285170e+00f,
-    9.478747249e-01f,
-    8.610806465e-01f,
-    1.644572854e+00f,
-    1.003738165e+00f,
-    7.421349883e-01f,
-    7.516106367e-01f,
-    2.409686804e+00f,
-    1.359298348e+00f,
-    1.113465548e+00f,
-    1.057266474e+00f,
-    2.124252796e+00f,
-    2.307307005e+00f,
-    1.148682714e+00f,
-    1.559779406e+00f,
-    8.558559418e-01f,
-    1.057846904e+00f,
-    1.413257599e+00f,
-    1.041138649e+00f,
-    1.656268001e+00f,
-    1.056392312e+00f,
-    9.153984189e-01f,
-    8.200277686e-01f,
-    8.176629543e-01f,
-    8.328679204e-01f,
-    1.850252390e+00f,
-    9.230521321e-01f,
-    8.975934386e-01f,
-    1.444732308e+00f,
-    5.180699825e-01f,
-    1.345656753e+00f,
-    1.195467472e+00f,
-    8.767658472e-01f,
-    1.538855195e+00f,
-    8.599798679e-01f,
-    2.849210262e+00f,
-    1.328711510e+00f,
-    6.685099006e-01f,
-    5.126461387e-01f,
-    9.526977539e-01f,
-    1.055158496e+00f,
-    1.926342607e+00f,
-    6.353405118e-01f,
-    1.546463013e+00f,
-    1.112838507e+00f,
-    1.193122983e+00f,
-    1.360678196e+00f,
-    2.770229340e+00f,
-    1.212420583e+00f,
-    1.020678163e+00f,
-    5.128442049e-01f,
-    7.283232808e-01f,
-    4.598918557e-01f,
-    7.880403399e-01f,
-    9.580997825e-01f,
-    7.013679147e-01f,
-    1.547255278e+00f,
-    7.041949630e-01f,
-    1.383955717e+00f,
-    1.969710827e+00f,
-    9.562470913e-01f,
-    5.975106359e-01f,
-    7.012021542e-01f,
-    1.094248176e+00f,
-    6.634694934e-01f,
-    9.258620143e-01f,
-    7.062344551e-01f,
-    1.876383781e+00f,
-    9.962166548e-01f,
-    8.896803260e-01f,
-    6.426993012e-01f,
-    6.484107971e-01f,
-    5.688715577e-01f,
-    5.888205171e-01f,
-    1.038394928e+00f,
-    4.118438363e-01f,
-    5.181357265e-01f,
-    1.814339757e+00f,
-    7.882937193e-01f,
-    7.316989899e-01f,
-    8.150403500e-01f,
-    1.416627884e+00f,
-    9.947625995e-01f,
-    2.404831648e+00f,
-    6.410530806e-01f,
-    1.399786830e+00f,
-    1.687458992e+00f,
-    1.096555948e+00f,
-    9.659820199e-01f,
-    7.488702536e-01f,
-    1.304780602e+00f,
-    1.282194376e+00f,
-    7.453220487e-01f,
-    7.357832193e-01f,
-    1.848645926e+00f,
-    1.551598787e+00f,
-    8.266036510e-01f,
-    5.713565946e-01f,
-    1.787275434e+00f,
-    1.099326134e+00f,
-    1.551306129e+00f,
-    1.619722009e+00f,
-    1.003832817e+00f,
-    1.086865902e+00f,
-    1.331898212e+00f,
-    1.096543312e+00f,
-    1.034673333e+00f,
-    1.275972128e+00f,
-    2.030287266e+00f,
-    6.327720881e-01f,
-    1.550949931e+00f,
-    1.294976830e+00f,
-    1.201548815e+00f,
-    1.413696289e+00f,
-    7.057128549e-01f,
-    6.341139078e-01f,
-    1.028030038e+00f,
-    1.195009828e+00f,
-    9.387368560e-01f,
-    1.736162782e+00f,
-    1.237579703e+00f,
-    1.007585049e+00f,
-    1.064997554e+00f,
-    1.427520394e+00f,
-    9.925200343e-01f,
-    9.027630687e-01f,
-    1.166098237e+00f,
-    6.485072374e-01f,
-    1.072096586e+00f,
-    7.485604286e-01f,
-    1.020262122e+00f,
-    9.821127057e-01f,
-    1.348380923e+00f,
-    6.619771123e-01f,
-    1.421503544e+00f,
-    1.392399669e+00f,
-    1.945559502e+00f,
-    1.211153030e+00f,
-    1.089655757e+00f,
-    8.629525304e-01f,
-    9.786986113e-01f,
-    4.497416317e-01f,
-    1.694311142e+00f,
-    9.914351106e-01f,
-    8.408646584e-01f,
-    2.116038322e+00f,
-    1.886138439e+00f,
-    1.692127347e+00f,
-    8.140475154e-01f,
-    1.164309382e+00f,
-    1.038682580e+00f,
-    6.763497591e-01f,
-    1.733397126e+00f,
-    7.433689833e-01f,
-    4.503903389e-01f,
-    1.671960831e+00f,
-    5.834892988e-01f,
-    1.341951370e+00f,
-    8.827295899e-01f,
-    7.288815379e-01f,
-    9.638726115e-01f,
-    8.372656107e-01f,
-    1.156459212e+00f,
-    7.990369797e-01f,
-    1.352137923e+00f,
-    7.637536526e-01f,
-    1.858917832e+00f,
-    8.270746469e-01f,
-    1.258855104e+00f,
-    1.684133768e+00f,
-    1.146395445e+00f,
-    1.202019453e+00f,
-    4.938224256e-01f,
-    9.078254104e-01f,
-    1.154363632e+00f,
-    1.162112117e+00f,
-    1.245232344e+00f,
-    8.807009459e-01f,
-    8.466392756e-01f,
-    1.675069928e+00f,
-    1.335136175e+00f,
-    9.317947030e-01f,
-    9.221291542e-01f,
-    1.018427014e+00f,
-    9.757180810e-01f,
-    1.231717587e+00f,
-    1.273284197e+00f,
-    1.017916441e+00f,
-    1.697866082e+00f,
-    8.271056414e-01f,
-    3.712300360e-01f,
-    5.772644281e-01f,
-    7.464755774e-01f,
-    9.231307507e-01f,
-    1.022309303e+00f,
-    6.493290067e-01f,
-    1.479135990e+00f,
-    7.873309255e-01f,
-    9.626020789e-01f,
-    1.959263206e+00f,
-    1.666380644e+00f,
-    1.274006009e+00f,
-    1.187169194e+00f,
-    9.869307876e-01f,
-    5.638097525e-01f,
-    1.108054399e+00f,
-    9.883048534e-01f,
-    5.869062543e-01f,
-    9.426454306e-01f,
-    1.497875929e+00f,
-    1.371262431e+00f,
-    7.874451280e-01f,
-    1.755849600e+00f,
-    1.117706776e+00f,
-    5.516155958e-01f,
-    6.070557237e-01f,
-    1.320573568e+00f,
-    1.106351137e+00f,
-    6.486223936e-01f,
-    1.110661864e+00f,
-    1.308466315e+00f,
-    1.112295508e+00f,
-    9.458527565e-01f,
-    1.005368710e+00f,
-    1.015692592e+00f,
-    1.598688722e+00f,
-    1.272686839e+00f,
-    9.904852509e-01f,
-    6.416532993e-01f,
-    5.649125576e-01f,
-    9.258462787e-01f,
-    1.599915266e+00f,
-    1.552606225e+00f,
-    1.410283327e+00f,
-    1.120875955e+00f,
-    6.900813580e-01f,
-    1.225730181e+00f,
-    8.054392934e-01f,
-    1.467353106e+00f,
-    1.008348107e+00f,
-    9.587144256e-01f,
-    1.722497582e+00f,
-    2.417501450e+00f,
-    1.022763848e+00f,
-    8.936239481e-01f,
-    1.544574618e+00f,
-    1.021837592e+00f,
-    8.934181333e-01f,
-    9.583066106e-01f,
-    8.202461600e-01f,
-    9.229480028e-01f,
-    1.891047120e+00f,
-    9.423074126e-01f,
-    6.154550314e-01f,
-    1.110699177e+00f,
-    1.320534825e+00f,
-    8.961992860e-01f,
-    1.181890488e+00f,
-    7.981199622e-01f,
-    7.196168303e-01f,
-    8.270880580e-01f,
-    9.396759868e-01f,
-    6.658965945e-01f,
-    9.587762356e-01f,
-    1.124811649e+00f,
-    5.669009089e-01f,
-    5.911672115e-01f,
-    8.466352820e-01f,
-    1.157391906e+00f,
-    8.905524015e-01f,
-    1.327127337e+00f,
-    1.659971118e+00f,
-    9.836032391e-01f,
-    6.845165491e-01f,
-    1.812294841e+00f,
-    1.218740702e+00f,
-    1.401934505e+00f,
-    1.466112018e+00f,
-    2.172555685e+00f,
-    9.329438210e-01f,
-    1.132386088e+00f,
-    8.316646218e-01f,
-    1.349536777e+00f,
-    8.764581084e-01f,
-    1.333055735e+00f,
-    1.076814651e+00f,
-    1.132107615e+00f,
-    6.009610295e-01f,
-    8.666193485e-01f,
-    7.008927464e-01f,
-    1.019512296e+00f,
-    6.166037321e-01f,
-    6.279430985e-01f,
-    9.741033316e-01f,
-    7.476522326e-01f,
-    6.351585388e-01f,
-    8.294859529e-01f,
-    8.739272952e-01f,
-    2.191609383e+00f,
-    1.005130649e+00f,
-    8.296956420e-01f,
-    7.090969682e-01f,
-    1.481877089e+00f,
-    1.330778241e+00f,
-    1.567023396e+00f,
-    1.053214312e+00f,
-    6.617152095e-01f,
-    4.129240513e-01f,
-    1.257976174e+00f,
-    1.885007024e+00f,
-    1.058550715e+00f,
-    1.155106664e+00f,
-    1.434947014e+00f,
-    1.425840259e+00f,
-    8.290942907e-01f,
-    6.967415214e-01f,
-    1.664722562e+00f,
-    1.219759226e+00f,
-    1.820309162e+00f,
-    1.044260502e+00f,
-    1.524376512e+00f,
-    1.436854601e+00f,
-    1.274710894e+00f,
-    6.961299181e-01f,
-    6.938672066e-01f,
-    1.504903674e+00f,
-    1.445347309e+00f,
-    1.249866486e+00f,
-    1.481862307e+00f,
-    1.164566994e+00f,
-    1.210496664e+00f,
-    2.149287462e+00f,
-    6.887156963e-01f,
-    1.132651210e+00f,
-    8.836742640e-01f,
-    1.212445259e+00f,
-    2.498267889e+00f,
-    1.004303217e+00f,
-    6.246724725e-01f,
-    8.328290582e-01f,
-    1.349360347e+00f,
-    1.208851814e+00f,
-    6.796926856e-01f,
-    8.970155120e-01f,
-    6.498330235e-01f,
-    1.135174513e+00f,
-    9.433397055e-01f,
-    9.275522232e-01f,
-    1.670541167e+00f,
-    8.242849708e-01f,
-    8.082615137e-01f,
-    9.373777509e-01f,
-    1.243360400e+00f,
-    1.706520200e+00f,
-    7.760719061e-01f,
-    1.581919432e+00f,
-    8.074758053e-01f,
-    8.251593113e-01f,
-    8.085505366e-01f,
-    9.605142474e-01f,
-    4.348361492e-01f,
-    1.039702415e+00f,
-    1.427370548e+00f,
-    7.282237411e-01f,
-    9.886668921e-01f,
-    1.337046862e+00f,
-    1.283842444e+00f,
-    8.475002646e-01f,
-    1.184967518e+00f,
-    8.554069400e-01f,
-    6.904966831e-01f,
-    8.587798476e-01f,
-    1.795757771e+00f,
-    1.794594049e+00f,
-    1.135502815e+00f,
-    1.068586469e+00f,
-    1.333909512e+00f,
-    9.450958371e-01f,
-    1.865051150e+00f,
-    1.033810735e+00f,
-    1.032206059e+00f,
-    9.152378440e-01f,
-    7.165611982e-01f,
-    1.140494108e+00f,
-    6.873022914e-01f,
-    9.508475661e-01f,
-    7.669758201e-01f,
-    6.540765166e-01f,
-    1.233236313e+00f,
-    1.104648471e+00f,
-    6.412355900e-01f,
-    1.292953134e+00f,
-    9.620301127e-01f,
-    9.895879626e-01f,
-    1.356150627e+00f,
-    1.379770160e+00f,
-    1.477038383e+00f,
-    1.230924249e+00f,
-    1.016254425e+00f,
-    1.553034306e+00f,
-    1.399547100e+00f,
-    1.268120408e+00f,
-    1.159096360e+00f,
-    1.109865427e+00f,
-    1.038424730e+00f,
-    6.574120522e-01f,
-    1.107801437e+00f,
-    8.472296596e-01f,
-    5.859177709e-01f,
-    7.122941017e-01f,
-    8.513591290e-01f,
-    1.380464911e+00f,
-    1.516708851e+00f,
-    8.268424869e-01f,
-    1.452039242e+00f,
-    5.043094158e-01f,
-    1.825021982e+00f,
-    1.009502888e+00f,
-    1.516582847e+00f,
-    1.074818730e+00f,
-    1.060145497e+00f,
-    1.202237964e+00f,
-    7.259768844e-01f,
-    1.141553402e+00f,
-    4.469566047e-01f,
-    5.285673141e-01f,
-    9.439848661e-01f,
-    7.348302603e-01f,
-    9.126746058e-01f,
-    7.834870815e-01f,
-    1.369255424e+00f,
-    9.441059828e-01f,
-    6.072117686e-01f,
-    1.093600273e+00f,
-    8.499441147e-01f,
-    1.058684349e+00f,
-    1.276713848e+00f,
-    1.452757120e+00f,
-    3.947580457e-01f,
-    9.808480144e-01f,
-    8.805425763e-01f,
-    1.203428984e+00f,
-    9.227529168e-01f,
-    4.778987467e-01f,
-    5.515166521e-01f,
-    1.609591246e+00f,
-    1.532548904e+00f,
-    1.385236979e+00f,
-    1.308558106e+00f,
-    7.087904215e-01f,
-    8.020551801e-01f,
-    1.088800907e+00f,
-    1.001121402e+00f,
-    1.606940150e+00f,
-    1.171781898e+00f,
-    1.372712970e+00f,
-    6.572759151e-01f,
-    9.394097924e-01f,
-    1.013156772e+00f,
-    8.101215363e-01f,
-    1.462261319e+00f,
-    1.525436521e+00f,
-    1.123284817e+00f,
-    7.827848792e-01f,
-    1.116780400e+00f,
-    1.933993578e+00f,
-    1.128564835e+00f,
-    1.249379277e+00f,
-    9.745586514e-01f,
-    1.170220375e+00f,
-    1.975202918e+00f,
-    1.378556967e+00f,
-    1.627139688e+00f,
-    6.597151160e-01f,
-    1.826139569e+00f,
-    2.710860729e+00f,
-    2.220265627e+00f,
-    8.266980648e-01f,
-    3.369963646e+00f,
-    1.160028815e+00f,
-    1.349453568e+00f,
-    1.012038827e+00f,
-    1.720575333e+00f,
-    1.074167132e+00f,
-    8.490095139e-01f,
-    1.113581181e+00f,
-    9.014947414e-01f,
-    1.010937810e+00f,
-    1.125663877e+00f,
-    1.320234537e+00f,
-    8.781281710e-01f,
-    1.270192027e+00f,
-    1.306131840e+00f,
-    2.219461203e+00f,
-    1.124709249e+00f,
-    7.226468921e-01f,
-    1.568372965e+00f,
-    7.747694254e-01f,
-    1.531825066e+00f,
-    1.410030365e+00f,
-    8.795211911e-01f,
-    1.502252221e+00f,
-    1.168120980e+00f,
-    3.770711720e-01f,
-    2.146495730e-01f,
-    1.800123572e+00f,
-    8.175473809e-01f,
-    7.659045458e-01f,
-    1.501019478e+00f,
-    1.278196812e+00f,
-    1.037633061e+00f,
-    9.861362576e-01f,
-    1.380342603e+00f,
-    7.994856834e-01f,
-    7.013081312e-01f,
-    5.642791986e-01f,
-    1.128522873e+00f,
-    1.004428983e+00f,
-    9.129494429e-01f,
-    8.171923161e-01f,
-    1.241162181e+00f,
-    1.313319087e+00f,
-    1.757812858e+00f,
-    6.578359008e-01f,
-    7.671255469e-01f,
-    9.086493254e-01f,
-    8.093813658e-01f,
-    5.898708105e-01f,
-    8.484072089e-01f,
-    6.991119385e-01f,
-    8.132441640e-01f,
-    9.657633901e-01f,
-    1.299778819e+00f,
-    9.379597902e-01f,
-    1.453272462e+00f,
-    1.517644048e+00f,
-    1.310477495e+00f,
-    1.011563420e+00f,
-    5.948989391e-01f,
-    1.585788608e+00f,
-    8.457589746e-01f,
-    1.258104324e+00f,
-    7.529819012e-01f,
-    1.387755871e+00f,
-    1.571162820e+00f,
-    1.209846616e+00f,
-    1.148111343e+00f,
-    7.859858274e-01f,
-    1.207369566e+00f,
-    8.738372326e-01f,
-    6.449147463e-01f,
-    1.300608039e+00f,
-    1.945360065e+00f,
-    1.047753096e+00f,
-    4.453632236e-01f,
-    1.412941933e+00f,
-    9.829273224e-01f,
-    1.460147977e+00f,
-    1.066645741e+00f,
-    8.643924594e-01f,
-    1.216469884e+00f,
-    1.219978452e+00f,
-    1.467858315e+00f,
-    1.408830047e+00f,
-    1.137315392e+00f,
-    7.004621029e-01f,
-    1.131990790e+00f,
-    9.054709077e-01f,
-    9.896389842e-01f,
-    1.660952687e+00f,
-    1.087904215e+00f,
-    1.439697981e+00f,
-    1.171344757e+00f,
-    7.820819020e-01f,
-    7.856801152e-01f,
-    6.271442771e-01f,
-    1.427522302e+00f,
-    1.049101591e+00f,
-    1.656332254e+00f,
-    7.143635154e-01f,
-    1.314202309e+00f,
-    9.347456098e-01f,
-    3.480677307e-01f,
-    1.117117167e+00f,
-    9.055825472e-01f,
-    5.080809593e-01f,
-    1.261632919e+00f,
-    1.130852818e+00f,
-    1.337002993e+00f,
-    1.336617351e+00f,
-    4.771269262e-01f,
-    7.708270550e-01f,
-    9.803617001e-01f,
-    2.245405912e+00f,
-    8.089405298e-01f,
-    1.913241744e+00f,
-    8.930215240e-01f,
-    6.800631285e-01f,
-    1.119786143e+00f,
-    7.843759656e-01f,
-    9.630191326e-01f,
-    8.134997487e-01f,
-    7.662189007e-01f,
-    8.823894858e-01f,
-    1.599143267e+00f,
-    1.633358002e+00f,
-    8.889094591e-01f,
-    1.277123690e+00f,
-    1.788319945e+00f,
-    6.607492566e-01f,
-    8.813524842e-01f,
-    8.737580776e-01f,
-    5.844044685e-01f,
-    8.984062076e-01f,
-    1.518243909e+00f,
-    1.772921205e+00f,
-    9.106489420e-01f,
-    6.285824776e-01f,
-    1.095355511e+00f,
-    3.121498585e+00f,
-    1.533476114e+00f,
-    9.626737833e-01f,
-    1.159378529e+00f,
-    1.160475373e+00f,
-    8.563470244e-01f,
-    9.936965704e-01f,
-    1.180441856e+00f,
-    9.440811872e-01f,
-    1.186942577e+00f,
-    1.378247380e+00f,
-    1.134831309e+00f,
-    1.169345617e+00f,
-    1.698299050e+00f,
-    1.028512836e+00f,
-    1.662727594e+00f,
-    1.486024261e+00f,
-    1.297523618e+00f,
-    9.588531852e-01f,
-    1.069523811e+00f,
-    6.541349888e-01f,
-    1.192216992e+00f,
-    1.521057010e+00f,
-    1.445397496e+00f,
-    1.624809146e+00f,
-    1.325674415e+00f,
-    1.181136131e+00f,
-    2.042073965e+00f,
-    1.727662086e+00f,
-    9.833589792e-01f,
-    1.612038255e+00f,
-    8.569079041e-01f,
-    1.174568057e+00f,
-    1.531221986e+00f,
-    9.625971913e-01f,
-    5.686520934e-01f,
-    1.227459550e+00f,
-    9.271578789e-01f,
-    1.169068098e+00f,
-    5.122008920e-01f,
-    1.503745198e+00f,
-    1.219895005e+00f,
-    8.467494845e-01f,
-    5.962461233e-01f,
-    1.130636811e+00f,
-    2.343347311e+00f,
-    9.921558499e-01f,
-    1.084131479e+00f,
-    6.272919774e-01f,
-    1.132872224e+00f,
-    9.130998850e-01f,
-    1.905483842e+00f,
-    1.001523614e+00f,
-    6.237025261e-01f,
-    9.265602827e-01f,
-    5.582873225e-01f,
-    7.795419693e-01f,
-    6.775190830e-01f,
-    1.185418606e+00f,
-    1.002985954e+00f,
-    8.221840858e-01f,
-    7.031362057e-01f,
-    7.957007289e-01f,
-    8.960606456e-01f,
-    8.176610470e-01f,
-    1.228493810e+00f,
-    1.553751469e+00f,
-    6.604943871e-01f,
-    2.304293156e+00f,
-    6.097090840e-01f,
-    1.482142329e+00f,
-    1.118184805e+00f,
-    9.868468642e-01f,
-    8.369500637e-01f,
-    9.540323615e-01f,
-    4.325587153e-01f,
-    1.541826248e+00f,
-    1.255992532e+00f,
-    2.218958378e+00f,
-    1.238163471e+00f,
-    1.680678606e+00f,
-    1.081896663e+00f,
-    9.697460532e-01f,
-    1.842491746e+00f,
-    4.102505147e-01f,
-    1.009190559e+00f,
-    1.060665250e+00f,
-    1.839698911e+00f,
-    1.317001820e+00f,
-    8.166193366e-01f,
-    8.311128020e-01f,
-    6.462290287e-01f,
-    9.128211737e-01f,
-    2.171285868e+00f,
-    9.756592512e-01f,
-    1.099506497e+00f,
-    2.128610849e+00f,
-    1.012416482e+00f,
-    1.137345672e+00f,
-    1.303958058e+00f,
-    1.453538060e+00f,
-    1.290293574e+00f,
-    2.477753162e+00f,
-    7.073317766e-01f,
-    8.412438631e-01f,
-    1.255956531e+00f,
-    1.013014555e+00f,
-    1.110047102e+00f,
-    1.114492178e+00f,
-    1.769165158e+00f,
-    9.432871938e-01f,
-    5.332479477e-01f,
-    1.187253356e+00f,
-    1.337137222e+00f,
-    1.027053356e+00f,
-    9.311664701e-01f,
-    1.479420900e+00f,
-    3.651938438e-01f,
-    1.065986872e+00f,
-    4.651990235e-01f,
-    6.469200253e-01f,
-    1.438184619e+00f,
-    7.687553167e-01f,
-    8.923998475e-01f,
-    1.016827703e+00f,
-    8.911163211e-01f,
-    1.718240380e+00f,
-    1.154445887e+00f,
-    2.209010839e+00f,
-    7.853808403e-01f,
-    9.773347378e-01f,
-    1.060264945e+00f,
-    8.573525548e-01f,
-    9.142068624e-01f,
-    8.864607215e-01f,
-    1.151655078e+00f,
-    7.188251019e-01f,
-    6.040168405e-01f,
-    1.238398314e+00f,
-    8.668671250e-01f,
-    1.101199865e+00f,
-    7.995499969e-01f,
-    1.034305215e+00f,
-    6.043567657e-01f,
-    5.422070026e-01f,
-    1.929984212e+00f,
-    8.040891886e-01f,
-    1.834171176e+00f,
-    1.500991106e+00f,
-    1.061815381e+00f,
-    6.832357049e-01f,
-    1.377026439e+00f,
-    9.666313529e-01f,
-    1.450531483e+00f,
-    5.436653495e-01f,
-    9.717025757e-01f,
-    8.153451681e-01f,
-    1.093569398e+00f,
-    6.091656685e-01f,
-    6.146054864e-01f,
-    1.164831042e+00f,
-    5.989376307e-01f,
-    6.753214002e-01f,
-    1.273793697e+00f,
-    1.025650382e+00f,
-    1.272734404e+00f,
-    2.294883132e-01f,
-    9.647894502e-01f,
-    4.650819302e-01f,
-    1.343404412e+00f,
-    8.475798965e-01f,
-    1.215381026e+00f,
-    7.349715233e-01f,
-    1.030162096e+00f,
-    1.400275588e+00f,
-    8.848206997e-01f,
-    1.188870668e+00f,
-    1.190464616e+00f,
-    8.882183433e-01f,
-    9.301464558e-01f,
-    7.880526185e-01f,
-    9.945460558e-01f,
-    1.466373563e+00f,
-    9.202094078e-01f,
-    8.203334212e-01f,
-    9.308795333e-01f,
-    1.136832356e+00f,
-    6.446469426e-01f,
-    1.366722941e+00f,
-    1.092616677e+00f,
-    1.180107117e+00f,
-    7.746160626e-01f,
-    1.054633498e+00f,
-    1.274267793e+00f,
-    1.251083493e+00f,
-    8.641005754e-01f,
-    1.092231154e+00f,
-    1.710264802e+00f,
-    7.221024036e-01f,
-    5.333019495e-01f,
-    5.729709268e-01f,
-    9.114198685e-01f,
-    1.547643065e+00f,
-    7.063557506e-01f,
-    9.946315289e-01f,
-    1.557500720e+00f,
-    8.045495749e-01f,
-    2.014380932e+00f,
-    1.028895378e+00f,
-    1.178510547e+00f,
-    7.923256755e-01f,
-    9.966758490e-01f,
-    5.935882926e-01f,
-    8.848162293e-01f,
-    1.097465515e+00f,
-    2.320337534e+00f,
-    8.495140672e-01f,
-    1.468576431e+00f,
-    1.443144202e+00f,
-    1.089006424e+00f,
-    1.018521309e+00f,
-    2.197238207e+00f,
-    8.545463681e-01f,
-    1.051564336e+00f,
-    1.619125962e+00f,
-    8.851737976e-01f,
-    6.713585854e-01f,
-    1.517816663e+00f,
-    1.483283758e+00f,
-    8.294275999e-01f,
-    7.701274157e-01f,
-    9.251735210e-01f,
-    1.030542254e+00f,
-    2.227472067e+00f,
-    7.782663107e-01f,
-    8.970857263e-01f,
-    8.816497922e-01f,
-    1.547535539e+00f,
-    7.332273126e-01f,
-    9.385211468e-01f,
-    5.555821657e-01f,
-    1.941296220e+00f,
-    7.869598269e-01f,
-    6.278753281e-01f,
-    5.319141150e-01f,
-    6.003794074e-01f,
-    8.396392465e-01f,
-    7.624513507e-01f,
-    1.210927844e+00f,
-    2.914040387e-01f,
-    8.805555105e-01f,
-    9.948233962e-01f,
-    7.092031240e-01f,
-    1.598882794e+00f,
-    7.704064250e-01f,
-    1.260276079e+00f,
-    1.133587122e+00f,
-    8.680514693e-01f,
-    1.051468611e+00f,
-    8.641772866e-01f,
-    5.121024251e-01f,
-    1.029371619e+00f,
-    9.257799983e-01f,
-    8.910322189e-01f,
-    1.419467688e+00f,
-    1.629785538e+00f,
-    8.356430531e-01f,
-    1.281975508e+00f,
-    1.701391935e+00f,
-    1.053426147e+00f,
-    2.168855906e+00f,
-    1.223222375e+00f,
-    1.966693163e+00f,
-    8.231588602e-01f,
-    8.214639425e-01f,
-    7.022962570e-01f,
-    8.543174863e-01f,
-    1.855212927e+00f,
-    6.228118539e-01f,
-    9.825823903e-01f,
-    1.579412341e+00f,
-    8.991214037e-01f,
-    1.119795084e+00f,
-    1.274982572e+00f,
-    7.578628063e-01f,
-    6.589966416e-01f,
-    7.965459228e-01f,
-    9.931194186e-01f,
-    7.907619476e-01f,
-    8.173285723e-01f,
-    1.501787901e+00f,
-    6.225112081e-01f,
-    7.359436750e-01f,
-    1.021706223e+00f,
-    7.336563468e-01f,
-    4.903649092e-01f,
-    6.485643387e-01f,
-    1.195071578e+00f,
-    1.089577556e+00f,
-    8.281039596e-01f,
-    1.244960427e+00f,
-    1.016033649e+00f,
-    1.333544970e+00f,
-    7.170103788e-01f,
-    1.371790528e+00f,
-    7.721849084e-01f,
-    8.319116235e-01f,
-    8.905010223e-01f,
-    1.122150660e+00f,
-    8.699895740e-01f,
-    7.394352555e-01f,
-    6.280822158e-01f,
-    8.473426700e-01f,
-    1.066246867e+00f,
-    4.400951862e-01f,
-    5.153993964e-01f,
-    8.768265843e-01f,
-    6.784695983e-01f,
-    1.135103226e+00f,
-    6.683164835e-01f,
-    3.753547966e-01f,
-    1.328322530e+00f,
-    1.144557714e+00f,
-    7.195203304e-01f,
-    1.617358446e+00f,
-    6.968925595e-01f,
-    6.360040307e-01f,
-    8.387312293e-01f,
-    9.077906609e-01f,
-    8.650214672e-01f,
-    8.053204417e-01f,
-    6.483481526e-01f,
-    1.290852427e+00f,
-    1.826308250e+00f,
-    9.463490844e-01f,
-    1.935450554e+00f,
-    1.673729897e+00f,
-    1.164938569e+00f,
-    1.228896976e+00f,
-    1.613346338e+00f,
-    8.117377162e-01f,
-    4.036588371e-01f,
-    1.032901645e+00f,
-    1.087797165e+00f,
-    1.449402213e+00f,
-    1.296957493e+00f,
-    7.164767385e-01f,
-    1.150652051e+00f,
-    8.252209425e-01f,
-    9.033908844e-01f,
-    1.114578962e+00f,
-    8.526760340e-01f,
-    1.391901731e+00f,
-    5.267937779e-01f,
-    6.739237905e-01f,
-    8.836178780e-01f,
-    1.055917263e+00f,
-    1.233006597e+00f,
-    6.532936692e-01f,
-    1.087318897e+00f,
-    1.653411508e+00f,
-    6.457950473e-01f,
-    6.209522486e-01f,
-    9.282690287e-01f,
-    2.180334091e+00f,
-    6.427275538e-01f,
-    5.096613765e-01f,
-    6.986808181e-01f,
-    7.226288915e-01f,
-    5.938718915e-01f,
-    5.104494691e-01f,
-    8.457168341e-01f,
-    9.585246444e-01f,
-    7.471587062e-01f,
-    1.001386404e+00f,
-    4.813346565e-01f,
-    4.817984104e-01f,
-    7.634054422e-01f,
-    2.029011726e+00f,
-    8.597295284e-01f,
-    1.282523274e+00f,
-    8.057062030e-01f,
-    3.545836508e-01f,
-    1.204697490e+00f,
-    7.190531492e-01f,
-    7.433696389e-01f,
-    1.396299005e+00f,
-    1.011890054e+00f,
-    9.160587192e-01f,
-    8.863703609e-01f,
-    8.816661835e-01f,
-    7.151098251e-01f,
-    8.625743985e-01f,
-    1.677728534e+00f,
-    9.399697781e-01f,
-    6.813591123e-01f,
-    1.321951509e+00f,
-    1.491925716e+00f,
-    5.870247483e-01f,
-    7.627401948e-01f,
-    2.152783155e+00f,
-    2.128804922e+00f,
-    1.312793016e+00f,
-    8.988830447e-01f,
-    3.577695489e-01f,
-    6.448814869e-01f,
-    7.139631510e-01f,
-    9.709284306e-01f,
-    8.774982691e-01f,
-    7.661406398e-01f,
-    5.583162308e-01f,
-    8.077898622e-01f,
-    6.214194894e-01f,
-    1.557170510e+00f,
-    8.170488477e-01f,
-    1.081830740e+00f,
-    1.026437044e+00f,
-    1.142180562e+00f,
-    8.421336412e-01f,
-    1.407124162e+00f,
-    1.089521170e+00f,
-    1.216344476e+00f,
-    6.117910743e-01f,
-    4.282060564e-01f,
-    1.405214310e+00f,
-    7.857744694e-01f,
-    1.225963116e+00f,
-    1.599896669e+00f,
-    1.346282125e+00f,
-    9.852387309e-01f,
-    1.402655244e+00f,
-    2.894964218e+00f,
-    2.039771795e+00f,
-    1.304040551e+00f,
-    9.031458497e-01f,
-    6.753335595e-01f,
-    1.110451698e+00f,
-    9.330840707e-01f,
-    1.300328493e+00f,
-    1.019467711e+00f,
-    1.589017153e+00f,
-    1.836322904e+00f,
-    1.075838804e+00f,
-    9.153000116e-01f,
-    9.497205615e-01f,
-    7.894947529e-01f,
-    8.053888083e-01f,
-    9.583626986e-01f,
-    1.087379456e+00f,
-    8.125987053e-01f,
-    1.153997183e+00f,
-    6.966025233e-01f,
-    2.043598652e+00f,
-    1.239615679e+00f,
-    1.175121427e+00f,
-    7.410184145e-01f,
-    1.401992083e+00f,
-    9.131746292e-01f,
-    1.087635159e+00f,
-    7.666240335e-01f,
-    9.704117775e-01f,
-    7.956965566e-01f,
-    1.313185096e+00f,
-    7.926700711e-01f,
-    4.068828523e-01f,
-    7.958459854e-01f,
-    9.151603580e-01f,
-    1.031832218e+00f,
-    6.669998169e-01f,
-    4.694288373e-01f,
-    4.000262916e-01f,
-    1.043231845e+00f,
-    7.684179544e-01f,
-    1.106148243e+00f,
-    8.607412577e-01f,
-    5.207379460e-01f,
-    6.619110703e-01f,
-    7.586752176e-01f,
-    5.377398133e-01f,
-    6.767044663e-01f,
-    5.091284513e-01f,
-    1.290721178e+00f,
-    1.216977119e+00f,
-    1.354139686e+00f,
-    9.084238410e-01f,
-    3.852813542e-01f,
-    9.883577824e-01f,
-    1.313799739e+00f,
-    1.555700302e+00f,
-    1.409605503e+00f,
-    1.572635770e+00f,
-    8.807598948e-01f,
-    8.074455261e-01f,
-    9.219966531e-01f,
-    7.385023236e-01f,
-    1.166199446e+00f,
-    3.333274603e+00f,
-    9.453886151e-01f,
-    9.973173141e-01f,
-    1.122701764e+00f,
-    6.301652193e-01f,
-    8.025743365e-01f,
-    1.601612091e+00f,
-    1.151230216e+00f,
-    1.281280994e+00f,
-    9.456731081e-01f,
-    7.911835313e-01f,
-    1.226628065e+00f,
-    1.261556149e+00f,
-    6.891965270e-01f,
-    1.270015121e+00f,
-    2.937869787e+00f,
-    1.610401869e+00f,
-    1.133729577e+00f,
-    1.371555805e+00f,
-    9.433369637e-01f,
-    1.938645363e+00f,
-    1.922399282e+00f,
-    2.215979338e+00f,
-    8.605589867e-01f,
-    5.562700629e-01f,
-    7.845093012e-01f,
-    9.895333052e-01f,
-    6.230626702e-01f,
-    1.366803646e+00f,
-    1.814959049e+00f,
-    1.130611777e+00f,
-    8.413279653e-01f,
-    6.416618228e-01f,
-    5.518776894e+00f,
-    1.896720529e+00f,
-    1.203982115e+00f,
-    9.833410382e-01f,
-    1.227504492e+00f,
-    1.004357338e+00f,
-    9.467166066e-01f,
-    9.060430527e-01f,
-    9.327684641e-01f,
-    1.080920100e+00f,
-    1.351323724e+00f,
-    1.156069875e+00f,
-    6.995494962e-01f,
-    8.630822301e-01f,
-    8.281024098e-01f,
-    6.477774978e-01f,
-    4.301496744e-01f,
-    1.253964067e+00f,
-    4.846248031e-01f,
-    7.458628416e-01f,
-    2.035863161e+00f,
-    9.778651595e-01f,
-    1.100199223e+00f,
-    5.497661829e-01f,
-    6.853795648e-01f,
-    8.772715330e-01f,
-    1.965382695e+00f,
-    7.241420746e-01f,
-    1.517386436e+00f,
-    4.758568704e-01f,
-    1.187994838e+00f,
-    5.272043347e-01f,
-    1.089761972e+00f,
-    1.558978796e+00f,
-    1.058747172e+00f,
-    2.792424679e+00f,
-    1.220025897e+00f,
-    1.505183697e+00f,
-    1.024663925e+00f,
-    1.313963771e+00f,
-    1.208946466e+00f,
-    1.262334228e+00f,
-    1.463930726e+00f,
-    7.466338277e-01f,
-    6.348354816e-01f,
-    7.925397158e-01f,
-    1.031451941e+00f,
-    9.344598651e-01f,
-    1.069617510e+00f,
-    1.036975980e+00f,
-    2.268898010e+00f,
-    1.052975178e+00f,
-    9.964558482e-01f,
-    1.421004176e+00f,
-    1.306772709e+00f,
-    1.037847996e+00f,
-    1.509715676e+00f,
-    6.689145565e-01f,
-    1.945526719e+00f,
-    1.513353109e+00f,
-    1.199513912e+00f,
-    2.968929052e+00f,
-    2.123445749e+00f,
-    1.282077432e+00f,
-    4.604168832e-01f,
-    1.406275272e+00f,
-    6.859666705e-01f,
-    1.033541083e+00f,
-    1.534974456e+00f,
-    8.278990984e-01f,
-    8.525062203e-01f,
-    5.490216017e-01f,
-    7.952660322e-01f,
-    7.433316708e-01f,
-    1.900621057e+00f,
-    6.473869681e-01f,
-    9.902266860e-01f,
-    1.582281947e+00f,
-    1.269709706e+00f,
-    1.142770886e+00f,
-    1.016262174e+00f,
-    2.333657980e+00f,
-    1.341598749e+00f,
-    1.452144384e+00f,
-    1.716059923e+00f,
-    7.743179202e-01f,
-    1.480939746e+00f,
-    1.190439463e+00f,
-    8.215696216e-01f,
-    9.081322551e-01f,
-    1.066628575e+00f,
-    1.702104807e+00f,
-    6.197291613e-01f,
-    1.110974431e+00f,
-    1.806421995e+00f,
-    1.626770735e+00f,
-    1.135036230e+00f,
-    1.391128182e+00f,
-    1.307728410e+00f,
-    1.159924030e+00f,
-    6.696906686e-01f,
-    1.141553044e+00f,
-    1.005082846e+00f,
-    8.540744185e-01f,
-    8.341571093e-01f,
-    8.983696699e-01f,
-    8.583533764e-01f,
-    9.063873291e-01f,
-    1.471652627e+00f,
-    8.533313274e-01f,
-    1.684004068e+00f,
-    1.478711367e+00f,
-    1.399956465e+00f,
-    1.916237473e+00f,
-    8.038381338e-01f,
-    1.151539803e+00f,
-    1.256362557e+00f,
-    1.461320639e+00f,
-    7.548601627e-01f,
-    8.074126244e-01f,
-    8.654939532e-01f,
-    7.994940281e-01f,
-    1.114479899e+00f,
-    8.433183432e-01f,
-    1.390106797e+00f,
-    9.391919971e-01f,
-    1.649340391e+00f,
-    1.887860775e+00f,
-    6.329067945e-01f,
-    1.473782778e+00f,
-    1.070498943e+00f,
-    6.290061474e-01f,
-    3.475760221e-01f,
-    1.983362556e+00f,
-    2.371152639e+00f,
-    1.793206930e+00f,
-    1.313252687e+00f,
-    6.955428123e-01f,
-    1.474666119e+00f,
-    6.833570004e-01f,
-    8.889795542e-01f,
-    6.390358210e-01f,
-    8.591368198e-01f,
-    1.144429326e+00f,
-    2.376051903e+00f,
-    5.585527420e-01f,
-    1.027713537e+00f,
-    1.251970887e+00f,
-    9.734257460e-01f,
-    1.113570333e+00f,
-    7.809714079e-01f,
-    6.587500572e-01f,
-    7.870177627e-01f,
-    1.260695577e+00f,
-    1.024544001e+00f,
-    5.171492696e-01f,
-    9.221579432e-01f,
-    9.184848070e-01f,
-    1.190097451e+00f,
-    8.192133904e-01f,
-    8.017494678e-01f,
-    1.063580990e+00f,
-    2.665689468e+00f,
-    1.436162233e+00f,
-    2.012186050e+00f,
-    1.002116680e+00f,
-    8.002638221e-01f,
-    7.644488215e-01f,
-    1.346259356e+00f,
-    8.518656492e-01f,
-    1.153706074e+00f,
-    9.005748630e-01f,
-    2.275709063e-01f,
-    1.195780039e+00f,
-    1.119928479e+00f,
-    1.114875674e+00f,
-    8.536966443e-01f,
-    6.709247231e-01f,
-    1.095816255e+00f,
-    2.322233677e+00f,
-    1.525982738e+00f,
-    1.594746828e+00f,
-    1.093508720e+00f,
-    7.366814017e-01f,
-    4.583429992e-01f,
-    2.281599760e+00f,
-    8.516528606e-01f,
-    1.220812321e+00f,
-    2.085768700e+00f,
-    8.699205518e-01f,
-    1.586171985e+00f,
-    1.923925638e+00f,
-    9.758617878e-01f,
-    8.986071944e-01f,
-    6.998459697e-01f,
-    7.733725309e-01f,
-    1.295388579e+00f,
-    5.413104892e-01f,
-    7.360856533e-01f,
-    7.716942430e-01f,
-    9.401326180e-01f,
-    1.149018526e+00f,
-    4.035123289e-01f,
-    1.074158072e+00f,
-    1.168650150e+00f,
-    1.191641212e+00f,
-    9.143595099e-01f,
-    1.228382468e+00f,
-    1.277729034e+00f,
-    4.295817018e-01f,
-    6.122011542e-01f,
-    6.703758240e-01f,
-    8.242043853e-01f,
-    8.301609755e-01f,
-    1.234021068e+00f,
-    7.799730301e-01f,
-    7.330006361e-01f,
-    1.128565550e+00f,
-    1.077214479e+00f,
-    7.768470645e-01f,
-    1.662925363e+00f,
-    1.095556021e+00f,
-    1.150827408e+00f,
-    9.856964946e-01f,
-    7.496995330e-01f,
-    7.245348096e-01f,
-    1.455322385e+00f,
-    8.229811192e-01f,
-    5.901562572e-01f,
-    1.253504872e+00f,
-    8.231584430e-01f,
-    1.202715278e+00f,
-    1.393440723e+00f,
-    1.610014439e+00f,
-    1.096550345e+00f,
-    1.008679628e+00f,
-    8.053594232e-01f,
-    1.676230192e+00f,
-    7.838892937e-01f,
-    1.797974229e+00f,
-    1.507631779e+00f,
-    1.187997222e+00f,
-    1.755647779e+00f,
-    6.162793636e-01f,
-    1.365563750e+00f,
-    1.432127714e+00f,
-    7.905225158e-01f,
-    7.289541364e-01f,
-    1.971997261e+00f,
-    1.246307969e+00f,
-    1.139554262e+00f,
-    8.534908295e-01f,
-    7.875103354e-01f,
-    4.796704054e-01f,
-    9.202184677e-01f,
-    1.088716745e+00f,
-    1.212127328e+00f,
-    6.431415677e-01f,
-    5.625960231e-01f,
-    1.897454262e+00f,
-    5.772248507e-01f,
-    1.431770921e+00f,
-    1.547097921e+00f,
-    1.057944894e+00f,
-    8.791228533e-01f,
-    1.108912110e+00f,
-    3.937074542e-01f,
-    8.277129531e-01f,
-    7.550849319e-01f,
-    1.495661259e+00f,
-    1.208953261e+00f,
-    8.433829546e-01f,
-    1.188711643e+00f,
-    7.029110193e-01f,
-    9.331272244e-01f,
-    5.542128682e-01f,
-    1.201739430e+00f,
-    6.067208648e-01f,
-    1.039685249e+00f,
-    7.868614197e-01f,
-    8.050902486e-01f,
-    1.356335402e+00f,
-    1.027984858e+00f,
-    1.223492861e+00f,
-    1.295295954e+00f,
-    8.790603876e-01f,
-    7.751746774e-01f,
-    1.187057018e+00f,
-    8.042774796e-01f,
-    1.153805256e+00f,
-    1.026650190e+00f,
-    9.882506728e-01f,
-    8.044725657e-01f,
-    1.039699435e+00f,
-    8.887920380e-01f,
-    1.591121554e+00f,
-    1.209427118e+00f,
-    1.026657462e+00f,
-    1.294760466e+00f,
-    8.407316208e-01f,
-    9.125586152e-01f,
-    1.030503750e+00f,
-    1.222032428e+00f,
-    8.033389449e-01f,
-    1.071583986e+00f,
-    1.233090162e+00f,
-    1.128831863e+00f,
-    1.247643232e+00f,
-    1.198307037e+00f,
-    9.336185455e-01f,
-    1.166246176e+00f,
-    1.053330064e+00f,
-    5.113244057e-01f,
-    1.041212320e+00f,
-    1.137305140e+00f,
-    1.043050170e+00f,
-    8.500004411e-01f,
-    1.482015014e+00f,
-    1.415293813e+00f,
-    1.307211280e+00f,
-    1.337664127e+00f,
-    9.942278266e-01f,
-    1.705170393e+00f,
-    1.078756213e+00f,
-    1.933607936e+00f,
-    1.764350772e+00f,
-    2.196435213e+00f,
-    1.504997373e+00f,
-    6.146106720e-01f,
-    9.966245294e-01f,
-    1.334659100e+00f,
-    9.508641362e-01f,
-    6.314499974e-01f,
-    1.532675028e+00f,
-    1.384258151e+00f,
-    1.078009248e+00f,
-    1.422850728e+00f,
-    1.201814890e+00f,
-    1.377175212e+00f,
-    1.213433146e+00f,
-    8.000497818e-01f,
-    1.534517884e+00f,
-    6.749782562e-01f,
-    9.334467649e-01f,
-    8.608226776e-01f,
-    1.400587797e+00f,
-    7.586000562e-01f,
-    1.101593733e+00f,
-    1.673895121e+00f,
-    1.013280630e+00f,
-    5.697934031e-01f,
-    7.617986798e-01f,
-    1.033749819e+00f,
-    7.192936540e-01f,
-    1.226805687e+00f,
-    6.692144275e-01f,
-    6.165186763e-01f,
-    1.142344475e+00f,
-    1.149891853e+00f,
-    7.549282908e-01f,
-    8.535820246e-01f,
-    9.280421138e-01f,
-    1.607513785e+00f,
-    2.028192520e+00f,
-    1.107272267e+00f,
-    1.319297671e+00f,
-    1.006978989e+00f,
-    7.542840838e-01f,
-    1.072577238e+00f,
-    1.244941235e+00f,
-    7.234308720e-01f,
-    1.186622500e+00f,
-    1.511593103e+00f,
-    9.670983553e-01f,
-    6.990672350e-01f,
-    1.366392851e+00f,
-    6.992415786e-01f,
-    1.022316337e+00f,
-    7.001932263e-01f,
-    9.054192305e-01f,
-    8.879597783e-01f,
-    9.669607282e-01f,
-    9.846683741e-01f,
-    1.818952918e+00f,
-    1.198207855e+00f,
-    1.192387342e+00f,
-    1.013812184e+00f,
-    1.687096477e+00f,
-    9.507076740e-01f,
-    9.589365125e-01f,
-    8.286328912e-01f,
-    8.779316545e-01f,
-    1.394559264e+00f,
-    1.017671108e+00f,
-    9.905159473e-01f,
-    1.543927312e+00f,
-    1.502254963e+00f,
-    4.474962652e-01f,
-    1.437803984e+00f,
-    1.060387611e+00f,
-    5.228918195e-01f,
-    7.439202666e-01f,
-    1.312586427e+00f,
-    8.700509667e-01f,
-    1.116283894e+00f,
-    6.231279373e-01f,
-    8.320149779e-01f,
-    1.285816073e+00f,
-    1.257770658e+00f,
-    7.134112120e-01f,
-    1.316592574e+00f,
-    1.129544020e+00f,
-    8.811567426e-01f,
-    1.105529547e+00f,
-    1.707194924e+00f,
-    9.285810590e-01f,
-    2.278114796e+00f,
-    5.844132900e-01f,
-    6.163537502e-01f,
-    1.548291206e+00f,
-    9.004087448e-01f,
-    1.416429162e+00f,
-    9.409107566e-01f,
-    7.077109814e-01f,
-    7.431681752e-01f,
-    9.029810429e-01f,
-    1.244224668e+00f,
-    6.273619533e-01f,
-    8.498246074e-01f,
-    2.376180887e+00f,
-    1.781134009e+00f,
-    8.133978844e-01f,
-    7.038433552e-01f,
-    5.911500454e-01f,
-    9.732012749e-01f,
-    1.165929794e+00f,
-    1.802445054e+00f,
-    1.768511176e+00f,
-    1.138266206e+00f,
-    1.295148849e+00f,
-    7.578153014e-01f,
-    1.102120757e+00f,
-    1.284596205e+00f,
-    1.513148427e+00f,
-    8.241531253e-01f,
-    5.910387039e-01f,
-    1.007405996e+00f,
-    1.183829427e+00f,
-    8.248195648e-01f,
-    2.021764040e+00f,
-    1.228264332e+00f,
-    1.207689166e+00f,
-    7.584284544e-01f,
-    1.196793199e+00f,
-    8.201302886e-01f,
-    9.266290665e-01f,
-    6.891111135e-01f,
-    1.352719903e+00f,
-    1.048444271e+00f,
-    1.346692443e+00f,
-    1.347293496e+00f,
-    6.866772771e-01f,
-    3.687143922e-01f,
-    1.749657631e+00f,
-    5.760395527e-01f,
-    1.320827603e+00f,
-    6.817091107e-01f,
-    1.888058424e+00f,
-    8.961288929e-01f,
-    1.918503165e+00f,
-    1.337125778e+00f,
-    1.068303108e+00f,
-    9.091259837e-01f,
-    1.565550327e+00f,
-    1.822906017e+00f,
-    8.278023005e-01f,
-    1.511748433e+00f,
-    8.153334260e-01f,
-    8.866584301e-01f,
-    1.278740644e+00f,
-    4.670264423e-01f,
-    9.812050462e-01f,
-    8.314806819e-01f,
-    9.551612139e-01f,
-    9.851878881e-01f,
-    6.365653276e-01f,
-    1.305982113e+00f,
-    5.976858139e-01f,
-    4.322287738e-01f,
-    1.073977709e+00f,
-    1.597776651e+00f,
-    9.734184146e-01f,
-    7.851170301e-01f,
-    1.680556178e+00f,
-    8.172634840e-01f,
-    6.641681790e-01f,
-    7.215895057e-01f,
-    7.555106282e-01f,
-    1.427874804e+00f,
-    1.422465920e+00f,
-    1.425782442e+00f,
-    7.811752558e-01f,
-    1.260336041e+00f,
-    5.683777928e-01f,
-    1.020885944e+00f,
-    1.588430524e+00f,
-    1.125490308e+00f,
-    1.287729859e+00f,
-    1.290551543e+00f,
-    7.212607265e-01f,
-    1.222551703e+00f,
-    1.268128872e+00f,
-    6.848877072e-01f,
-    2.281388521e+00f,
-    9.160143137e-01f,
-    5.415181518e-01f,
-    1.072272062e+00f,
-    1.053334594e+00f,
-    1.267179132e+00f,
-    1.445623398e+00f,
-    9.587179422e-01f,
-    1.602663040e+00f,
-    1.407250047e+00f,
-    1.179702282e+00f,
-    1.287359476e+00f,
-    1.129998565e+00f,
-    6.540374756e-01f,
-    1.379065752e+00f,
-    1.061560273e+00f,
-    7.393936515e-01f,
-    5.232805014e-01f,
-    6.202207208e-01f,
-    5.146366954e-01f,
-    7.141650319e-01f,
-    7.926658392e-01f,
-    1.096516728e+00f,
-    1.086528301e+00f,
-    1.097442985e+00f,
-    1.551177740e+00f,
-    9.763965607e-01f,
-    1.068831086e+00f,
-    9.418632388e-01f,
-    8.520152569e-01f,
-    1.258730173e+00f,
-    1.196024299e+00f,
-    8.536269069e-01f,
-    6.180946827e-01f,
-    1.022925019e+00f,
-    1.679698110e+00f,
-    1.018053889e+00f,
-    1.259346366e+00f,
-    1.563249111e+00f,
-    1.209599972e+00f,
-    1.051722646e+00f,
-    5.616391301e-01f,
-    1.260152221e+00f,
-    1.269085407e+00f,
-    2.034330130e+00f,
-    1.020593643e+00f,
-    6.369979382e-01f,
-    1.450059175e+00f,
-    7.831006646e-01f,
-    6.683430672e-01f,
-    8.766893148e-01f,
-    8.487462997e-01f,
-    1.185560346e+00f,
-    1.198629498e+00f,
-    9.440251589e-01f,
-    1.044054627e+00f,
-    9.650388360e-01f,
-    1.643289685e+00f,
-    1.145206690e+00f,
-    1.564670086e+00f,
-    1.006007195e+00f,
-    3.149286807e-01f,
-    1.436133504e+00f,
-    9.012090564e-01f,
-    6.578821540e-01f,
-    9.686129689e-01f,
-    1.379431486e+00f,
-    9.214982390e-01f,
-    2.221522808e+00f,
-    1.179650426e+00f,
-    8.380419612e-01f,
-    1.105164170e+00f,
-    1.301260471e+00f,
-    6.298115849e-01f,
-    1.664737582e+00f,
-    1.053699017e+00f,
-    1.422752261e+00f,
-    7.487174273e-01f,
-    1.074953079e+00f,
-    1.457672834e+00f,
-    1.112070560e+00f,
-    5.754252672e-01f,
-    1.282266736e+00f,
-    5.646981001e-01f,
-    5.793405175e-01f,
-    8.916605115e-01f,
-    1.294412136e+00f,
-    3.404390812e-01f,
-    9.176242948e-01f,
-    5.100367069e-01f,
-    7.383226156e-01f,
-    1.142405391e+00f,
-    1.682802439e+00f,
-    1.285249472e+00f,
-    1.305478215e+00f,
-    6.538034678e-01f,
-    1.056176186e+00f,
-    8.111993670e-01f,
-    8.312943578e-01f,
-    1.080710053e+00f,
-    8.364388943e-01f,
-    1.173544884e+00f,
-    1.808178544e+00f,
-    6.268792748e-01f,
-    7.022305727e-01f,
-    1.365187049e+00f,
-    7.303472161e-01f,
-    1.019964099e+00f,
-    1.293205976e+00f,
-    9.099003077e-01f,
-    8.560485840e-01f,
-    1.288525939e+00f,
-    7.027561069e-01f,
-    8.037160635e-01f,
-    1.130853295e+00f,
-    6.668644547e-01f,
-    7.081751823e-01f,
-    5.371531844e-01f,
-    1.195063472e+00f,
-    6.777240038e-01f,
-    1.112098932e+00f,
-    8.054437041e-01f,
-    6.518501043e-01f,
-    9.115709066e-01f,
-    1.304230928e+00f,
-    6.469845772e-01f,
-    9.093543291e-01f,
-    9.784125090e-01f,
-    1.279464960e+00f,
-    1.070451736e+00f,
-    6.541061997e-01f,
-    1.355085015e+00f,
-    1.344792485e+00f,
-    1.068424225e+00f,
-    1.150539398e+00f,
-    1.917549729e+00f,
-    8.296018243e-01f,
-    7.569459081e-01f,
-    9.061241746e-01f,
-    8.773244619e-01f,
-    9.943584800e-01f,
-    5.225396156e-01f,
-    8.694449663e-01f,
-    1.233375192e+00f,
-    8.280231953e-01f,
-    1.690828800e+00f,
-    9.882909656e-01f,
-    9.072595835e-01f,
-    1.185811639e+00f,
-    9.722690582e-01f,
-    8.343016505e-01f,
-    6.382269263e-01f,
-    8.886550665e-01f,
-    1.508135557e+00f,
-    7.615683079e-01f,
-    3.621816933e-01f,
-    5.684909821e-01f,
-    1.176567078e+00f,
-    1.156599402e+00f,
-    1.495280981e+00f,
-    7.528790236e-01f,
-    2.375553608e+00f,
-    1.565729618e+00f,
-    9.425934553e-01f,
-    1.019148111e+00f,
-    1.356865644e+00f,
-    9.201092124e-01f,
-    7.981593609e-01f,
-    1.020711303e+00f,
-    6.697825789e-01f,
-    6.452483535e-01f,
-    1.855487823e+00f,
-    1.073378563e+00f,
-    9.794989824e-01f,
-    6.039132476e-01f,
-    7.946485877e-01f,
-    1.016183376e+00f,
-    1.257444024e+00f,
-    6.939747930e-01f,
-    8.608034253e-01f,
-    1.252513170e+00f,
-    7.443841696e-01f,
-    1.154560685e+00f,
-    8.665277362e-01f,
-    1.049542785e+00f,
-    1.048356533e+00f,
-    1.488867402e+00f,
-    8.573208451e-01f,
-    9.051980972e-01f,
-    7.882665396e-01f,
-    1.146362424e+00f,
-    7.868344784e-01f,
-    1.349403381e+00f,
-    7.889233828e-01f,
-    8.620051146e-01f,
-    1.721832037e+00f,
-    5.799564123e-01f,
-    9.191731811e-01f,
-    1.355942130e+00f,
-    6.465379596e-01f,
-    1.084771633e+00f,
-    2.016339302e+00f,
-    1.173465610e+00f,
-    1.417637825e+00f,
-    1.745282292e+00f,
-    7.839896679e-01f,
-    1.020422339e+00f,
-    1.340510011e+00f,
-    1.327157378e+00f,
-    1.075661182e+00f,
-    6.389051676e-01f,
-    1.168539047e+00f,
-    1.302007437e+00f,
-    2.689913511e+00f,
-    1.345164180e+00f,
-    9.490813017e-01f,
-    8.514110446e-01f,
-    1.328193665e+00f,
-    8.638727069e-01f,
-    7.207905650e-01f,
-    1.146775007e+00f,
-    1.321932316e+00f,
-    1.643811464e+00f,
-    1.242672443e+00f,
-    8.466176391e-01f,
-    1.761065960e+00f,
-    1.166017532e+00f,
-    1.280347824e+00f,
-    1.235804319e+00f,
-    2.130432606e+00f,
-    2.003162146e+00f,
-    8.154502511e-01f,
-    1.004182458e+00f,
-    1.261250377e+00f,
-    1.276779294e+00f,
-    9.120386243e-01f,
-    1.093038559e+00f,
-    6.058210135e-01f,
-    1.272731781e+00f,
-    7.921689153e-01f,
-    6.970578432e-01f,
-    1.532099128e+00f,
-    1.556883931e+00f,
-    7.925158143e-01f,
-    9.102772474e-01f,
-    8.142064214e-01f,
-    1.165482879e+00f,
-    4.982910156e-01f,
-    8.507458568e-01f,
-    1.466638446e+00f,
-    9.350030422e-01f,
-    1.013481975e+00f,
-    7.630761266e-01f,
-    1.065346479e+00f,
-    1.049877167e+00f,
-    1.528445482e+00f,
-    1.066846132e+00f,
-    1.266464472e+00f,
-    9.381886125e-01f,
-    1.385890722e+00f,
-    2.120850086e+00f,
-    4.630473554e-01f,
-    7.989556193e-01f,
-    1.135955334e+00f,
-    5.591842532e-01f,
-    1.020744920e+00f,
-    8.321118355e-01f,
-    6.705681086e-01f,
-    1.151233792e+00f,
-    1.689921498e+00f,
-    1.820314527e+00f,
-    5.869194865e-01f,
-    1.123905897e+00f,
-    8.413161635e-01f,
-    7.089978456e-01f,
-    8.152062893e-01f,
-    9.724996090e-01f,
-    7.392654419e-01f,
-    5.534870625e-01f,
-    8.990856409e-01f,
-    5.825482011e-01f,
-    1.094842196e+00f,
-    2.735791445e+00f,
-    8.587825894e-01f,
-    1.814364910e+00f,
-    9.176952839e-01f,
-    1.027052522e+00f,
-    7.052389979e-01f,
-    1.184553146e+00f,
-    8.498949409e-01f,
-    2.609018326e+00f,
-    2.033538818e+00f,
-    8.176897168e-01f,
-    9.462236762e-01f,
-    9.517644048e-01f,
-    1.142623425e+00f,
-    1.393453360e+00f,
-    1.552322388e+00f,
-    1.004922986e+00f,
-    7.637656927e-01f,
-    1.594550490e+00f,
-    1.228272676e+00f,
-    6.357442141e-01f,
-    8.369686007e-01f,
-    8.483710289e-01f,
-    1.520334244e+00f,
-    9.451586008e-01f,
-    9.977755547e-01f,
-    1.231215000e+00f,
-    8.002682328e-01f,
-    1.162942052e+00f,
-    7.828987241e-01f,
-    7.172555327e-01f,
-    9.290392399e-01f,
-    8.175916076e-01f,
-    1.701946020e+00f,
-    7.748942375e-01f,
-    9.212883711e-01f,
-    1.011036992e+00f,
-    1.104244471e+00f,
-    7.439612746e-01f,
-    6.603644490e-01f,
-    1.208218813e+00f,
-    3.184406281e+00f,
-    1.215160608e+00f,
-    1.476551533e+00f,
-    1.032423615e+00f,
-    1.224522233e+00f,
-    7.820019126e-01f,
-    1.574931622e+00f,
-    1.137573600e+00f,
-    7.346614003e-01f,
-    6.782429814e-01f,
-    1.290825009e+00f,
-    1.668661594e+00f,
-    1.353240371e+00f,
-    1.905406475e+00f,
-    1.009563565e+00f,
-    8.905174732e-01f,
-    8.616443872e-01f,
-    2.957399368e+00f,
-    1.232037544e+00f,
-    8.738020062e-01f,
-    1.274337411e+00f,
-    1.029582620e+00f,
-    1.322162271e+00f,
-    6.806622148e-01f,
-    9.335575700e-01f,
-    1.770932794e+00f,
-    1.097954869e+00f,
-    1.170974255e+00f,
-    1.215614438e+00f,
-    5.709744096e-01f,
-    1.134584665e+00f,
-    7.561367750e-01f,
-    1.063519359e+00f,
-    8.364847898e-01f,
-    7.822536826e-01f,
-    1.295928359e+00f,
-    1.006093144e+00f,
-    8.305190802e-01f,
-    1.148333073e+00f,
-    6.160151958e-01f,
-    7.863538861e-01f,
-    1.235950589e+00f,
-    7.365010381e-01f,
-    8.170748353e-01f,
-    9.749034047e-01f,
-    9.170008898e-01f,
-    9.447928071e-01f,
-    1.303368449e+00f,
-    1.312700868e+00f,
-    1.988335490e+00f,
-    1.148974776e+00f,
-    9.450199008e-01f,
-    1.105925798e+00f,
-    1.287362218e+00f,
-    5.638233423e-01f,
-    1.134996772e+00f,
-    1.217755556e+00f,
-    1.206725955e+00f,
-    1.114544511e+00f,
-    5.331853032e-01f,
-    9.058493972e-01f,
-    1.657469511e+00f,
-    1.348314047e+00f,
-    1.517150998e+00f,
-    8.045153022e-01f,
-    5.017773509e-01f,
-    3.069094896e+00f,
-    1.568226933e+00f,
-    1.461624384e+00f,
-    9.654781818e-01f,
-    1.466822863e+00f,
-    1.142531037e+00f,
-    1.052393556e+00f,
-    1.040140390e+00f,
-    7.573191524e-01f,
-    8.073820472e-01f,
-    1.066906929e+00f,
-    1.068673372e+00f,
-    1.388913035e+00f,
-    9.252595901e-01f,
-    1.810347676e+00f,
-    8.060268760e-01f,
-    1.054555416e+00f,
-    8.623348475e-01f,
-    1.380194783e+00f,
-    1.212172866e+00f,
-    6.674112082e-01f,
-    1.029491305e+00f,
-    1.500457883e+00f,
-    8.918220997e-01f,
-    5.702417493e-01f,
-    7.494170666e-01f,
-    1.006249309e+00f,
-    1.396259069e+00f,
-    4.863902330e-01f,
-    5.985698104e-01f,
-    8.915723562e-01f,
-    1.023187280e+00f,
-    8.241854906e-01f,
-    1.107383609e+00f,
-    5.009087920e-01f,
-    7.109878659e-01f,
-    1.459354162e+00f,
-    1.159650683e+00f,
-    1.549435139e+00f,
-    9.093333483e-01f,
-    7.112110853e-01f,
-    4.827531278e-01f,
-    1.005706787e+00f,
-    8.334309459e-01f,
-    1.160531878e+00f,
-    1.193981171e+00f,
-    1.047493339e+00f,
-    1.988793015e+00f,
-    5.376500487e-01f,
-    1.533144474e+00f,
-    1.200906754e+00f,
-    3.538532555e-01f,
-    1.611488104e+00f,
-    1.779807925e+00f,
-    1.155882955e+00f,
-    1.140516043e+00f,
-    1.138162851e+00f,
-    6.189054251e-01f,
-    6.432653666e-01f,
-    9.252120256e-01f,
-    1.256468654e+00f,
-    7.435833812e-01f,
-    1.131425738e+00f,
-    1.157888412e+00f,
-    1.783886075e+00f,
-    1.772024632e+00f,
-    1.091123939e+00f,
-    4.354715049e-01f,
-    7.316598892e-01f,
-    1.252485633e+00f,
-    1.096038938e+00f,
-    1.554731727e+00f,
-    9.348554015e-01f,
-    7.313698530e-01f,
-    7.535958290e-01f,
-    1.235613823e+00f,
-    1.033330560e+00f,
-    5.389261842e-01f,
-    9.697868228e-01f,
-    9.934964776e-01f,
-    7.414032817e-01f,
-    9.089816809e-01f,
-    1.371960521e+00f,
-    1.266825080e+00f,
-    8.205275536e-01f,
-    1.219908595e+00f,
-    9.191488028e-01f,
-    8.590912223e-01f,
-    8.561134934e-01f,
-    1.082790017e+00f,
-    1.108857751e+00f,
-    9.946371913e-01f,
-    8.036187887e-01f,
-    8.045863509e-01f,
-    1.749571681e+00f,
-    9.190284014e-01f,
-    1.686080694e+00f,
-    6.921736002e-01f,
-    1.155951500e+00f,
-    7.584292293e-01f,
-    7.414094806e-01f,
-    1.735520959e+00f,
-    7.871545553e-01f,
-    9.044499397e-01f,
-    1.006191134e+00f,
-    1.416548371e+00f,
-    8.233259320e-01f,
-    7.768613100e-01f,
-    1.282144785e+00f,
-    1.052906036e+00f,
-    2.871723175e-01f,
-    6.655640006e-01f,
-    1.108006477e+00f,
-    1.152290106e+00f,
-    8.876947165e-01f,
-    1.368903637e+00f,
-    8.353149295e-01f,
-    6.877071261e-01f,
-    7.242057323e-01f,
-    1.000684381e+00f,
-    1.091047406e+00f,
-    5.043137074e-01f,
-    8.419550061e-01f,
-    1.129548192e+00f,
-    1.072748661e+00f,
-    8.597623706e-01f,
-    7.635258436e-01f,
-    1.108305931e+00f,
-    6.821261644e-01f,
-    9.878377914e-01f,
-    8.568560481e-01f,
-    9.803276658e-01f,
-    2.466737032e+00f,
-    9.627850652e-01f,
-    1.291487336e+00f,
-    1.055798292e+00f,
-    9.983273745e-01f,
-    1.501941562e+00f,
-    9.019112587e-01f,
-    1.334952474e+00f,
-    5.530412793e-01f,
-    1.358683467e+00f,
-    7.875339389e-01f,
-    1.073014736e+00f,
-    5.989962816e-01f,
-    7.248181105e-01f,
-    1.610661626e+00f,
-    1.297779799e+00f,
-    7.615644932e-01f,
-    7.258039713e-01f,
-    4.385938346e-01f,
-    1.476054192e+00f,
-    1.230709434e+00f,
-    1.080485106e+00f,
-    6.744928360e-01f,
-    1.020882845e+00f,
-    1.089782119e+00f,
-    8.787517548e-01f,
-    6.971062422e-01f,
-    1.022977233e+00f,
-    1.371660948e+00f,
-    1.035492063e+00f,
-    7.455269694e-01f,
-    1.642241001e+00f,
-    9.756290317e-01f,
-    1.157397509e+00f,
-    8.748027086e-01f,
-    9.216380119e-01f,
-    1.413056135e+00f,
-    9.260025024e-01f,
-    2.160619974e+00f,
-    7.603143454e-01f,
-    1.250539303e+00f,
-    1.157760262e+00f,
-    1.226016402e+00f,
-    1.159045815e+00f,
-    9.579145908e-01f,
-    2.034975529e+00f,
-    1.822682858e+00f,
-    5.388144851e-01f,
-    1.246316314e+00f,
-    1.338643074e+00f,
-    9.695598483e-01f,
-    8.784748912e-01f,
-    2.031878948e+00f,
-    8.830581903e-01f,
-    7.760881782e-01f,
-    8.058359027e-01f,
-    1.104655623e+00f,
-    7.864115834e-01f,
-    2.809870243e+00f,
-    1.508345008e+00f,
-    1.796271205e+00f,
-    1.402384400e+00f,
-    1.099502802e+00f,
-    2.388319969e+00f,
-    5.298286080e-01f,
-    1.573814750e+00f,
-    6.118271947e-01f,
-    9.239578247e-01f,
-    7.901765108e-01f,
-    1.437637925e+00f,
-    2.311058760e+00f,
-    1.109657407e+00f,
-    1.367144227e+00f,
-    6.049596667e-01f,
-    1.590143442e+00f,
-    1.345756173e+00f,
-    1.074959278e+00f,
-    1.075032592e+00f,
-    4.498351216e-01f,
-    4.338766336e-01f,
-    6.234097481e-01f,
-    1.258569360e+00f,
-    1.010164261e+00f,
-    1.594592214e+00f,
-    1.025559783e+00f,
-    1.383218646e+00f,
-    9.579421878e-01f,
-    7.493668795e-01f,
-    6.640903354e-01f,
-    9.497300386e-01f,
-    7.009186149e-01f,
-    7.878270149e-01f,
-    1.437952280e+00f,
-    1.448375225e+00f,
-    1.131089449e+00f,
-    8.124695420e-01f,
-    6.128709912e-01f,
-    9.213069081e-01f,
-    1.014116406e+00f,
-    5.179504752e-01f,
-    1.065173626e+00f,
-    1.372530460e+00f,
-    4.722208381e-01f,
-    1.331634998e+00f,
-    7.340471745e-01f,
-    1.310747504e+00f,
-    8.993324041e-01f,
-    8.758172989e-01f,
-    1.330079436e+00f,
-    1.245174289e+00f,
-    7.101945877e-01f,
-    1.286456347e+00f,
-    7.773087025e-01f,
-    1.722643971e+00f,
-    1.262921810e+00f,
-    1.099669695e+00f,
-    8.529878259e-01f,
-    6.914054751e-01f,
-    9.918308258e-01f,
-    9.818098545e-01f,
-    1.076265931e+00f,
-    1.581745148e+00f,
-    1.043355346e+00f,
-    6.434278488e-01f,
-    6.034823656e-01f,
-    7.993062735e-01f,
-    1.028849721e+00f,
-    1.167183280e+00f,
-    1.292823911e+00f,
-    8.616459370e-01f,
-    9.266032577e-01f,
-    1.245000482e+00f,
-    9.594742656e-01f,
-    2.708084822e+00f,
-    1.283432007e+00f,
-    1.350493193e+00f,
-    1.302514791e+00f,
-    1.276471972e+00f,
-    6.278852820e-01f,
-    1.089233041e+00f,
-    8.064811826e-01f,
-    8.207979798e-01f,
-    1.225891113e+00f,
-    9.619861245e-01f,
-    9.773288369e-01f,
-    5.396810770e-01f,
-    6.311068535e-01f,
-    1.141072035e+00f,
-    6.930447221e-01f,
-    8.900924921e-01f,
-    7.938604951e-01f,
-    1.025771976e+00f,
-    1.120275617e+00f,
-    6.110339165e-01f,
-    1.376807094e+00f,
-    1.580334544e+00f,
-    6.775420308e-01f,
-    1.794259191e+00f,
-    1.193448782e+00f,
-    9.910995364e-01f,
-    8.581386805e-01f,
-    9.149597883e-01f,
-    8.599451780e-01f,
-    1.360124111e+00f,
-    8.133116364e-01f,
-    8.279585242e-01f,
-    8.507571816e-01f,
-    1.166441560e+00f,
-    1.016898632e+00f,
-    5.498704910e-01f,
-    9.069197774e-01f,
-    9.988328815e-01f,
-    1.611295819e+00f,
-    7.358351350e-01f,
-    1.222747445e+00f,
-    8.712050915e-01f,
-    1.643937469e+00f,
-    5.888649821e-01f,
-    1.251726985e+00f,
-    1.360565662e+00f,
-    1.604438305e+00f,
-    9.647888541e-01f,
-    1.020882487e+00f,
-    5.003948212e-01f,
-    8.864210844e-01f,
-    1.211670756e+00f,
-    1.164330244e+00f,
-    8.472948670e-01f,
-    6.674531102e-01f,
-    7.769654989e-01f,
-    1.352708340e+00f,
-    7.995357513e-01f,
-    1.351773620e+00f,
-    8.821733594e-01f,
-    8.476200104e-01f,
-    9.266208410e-01f,
-    9.576134086e-01f,
-    1.217379332e+00f,
-    5.064499378e-01f,
-    1.145645142e+00f,
-    1.138553262e+00f,
-    1.303682446e+00f,
-    6.946870685e-01f,
-    1.201538920e+00f,
-    1.308637500e+00f,
-    7.682055831e-01f,
-    1.360922694e+00f,
-    8.123225570e-01f,
-    1.414971709e+00f,
-    7.832053900e-01f,
-    6.328620315e-01f,
-    8.232675791e-01f,
-    8.162415028e-01f,
-    1.624024272e+00f,
-    1.523956895e+00f,
-    1.233940363e+00f,
-    9.896267056e-01f,
-    1.868658304e+00f,
-    9.564359188e-01f,
-    7.820489407e-01f,
-    1.640236259e+00f,
-    1.666982174e+00f,
-    7.612432241e-01f,
-    7.536431551e-01f,
-    1.018333554e+00f,
-    1.172872543e+00f,
-    6.858912706e-01f,
-    5.932893753e-01f,
-    9.307681918e-01f,
-    1.011400342e+00f,
-    5.518670082e-01f,
-    1.303478718e+00f,
-    1.022792220e+00f,
-    1.239673615e+00f,
-    8.761632442e-01f,
-    1.642037511e+00f,
-    1.292257905e+00f,
-    7.940880060e-01f,
-    8.085120320e-01f,
-    6.910041571e-01f,
-    5.985904932e-01f,
-    1.846528888e+00f,
-    1.569126129e+00f,
-    1.183311820e+00f,
-    1.382116556e+00f,
-    8.437279463e-01f,
-    7.676379681e-01f,
-    1.088756204e+00f,
-    5.884596705e-01f,
-    7.771413922e-01f,
-    1.395998240e+00f,
-    5.033043623e-01f,
-    1.245609164e+00f,
-    1.295444369e+00f,
-    9.736219645e-01f,
-    1.614549279e+00f,
-    1.426744342e+00f,
-    7.925783992e-01f,
-    1.021230102e+00f,
-    2.134799004e+00f,
-    9.311010242e-01f,
-    1.401433229e+00f,
-    1.270288825e+00f,
-    5.339915752e-01f,
-    1.844898582e+00f,
-    9.177339673e-01f,
-    7.791799307e-01f,
-    6.052156687e-01f,
-    1.607043028e+00f,
-    1.836848974e+00f,
-    1.279120564e+00f,
-    6.422849298e-01f,
-    1.030218244e+00f,
-    1.030497193e+00f,
-    1.295472622e+00f,
-    8.789973855e-01f,
-    1.328525782e+00f,
-    1.215299368e+00f,
-    8.424754143e-01f,
-    7.701811194e-01f,
-    1.258467913e+00f,
-    1.286983609e+00f,
-    6.896321177e-01f,
-    1.552608371e+00f,
-    7.867445946e-01f,
-    4.385012090e-01f,
-    5.465689898e-01f,
-    7.306598425e-01f,
-    8.530785441e-01f,
-    1.823001623e+00f,
-    1.405448437e+00f,
-    1.371773124e+00f,
-    7.592485547e-01f,
-    9.371922016e-01f,
-    1.505330205e+00f,
-    6.733569503e-01f,
-    1.233411670e+00f,
-    1.158363700e+00f,
-    1.327624559e+00f,
-    9.132432938e-01f,
-    1.762553573e+00f,
-    8.936992884e-01f,
-    7.137739658e-01f,
-    1.550556779e+00f,
-    5.867800117e-01f,
-    9.321731925e-01f,
-    1.252008557e+00f,
-    9.521248341e-01f,
-    5.836725235e-01f,
-    8.753284216e-01f,
-    1.124901056e+00f,
-    8.362069726e-01f,
-    2.364984035e+00f,
-    1.751879930e+00f,
-    5.708642006e-01f,
-    5.744083524e-01f,
-    8.598250151e-01f,
-    6.862177849e-01f,
-    1.354924321e+00f,
-    1.252736330e+00f,
-    1.203774333e+00f,
-    8.666676283e-01f,
-    5.015995502e-01f,
-    1.176947832e+00f,
-    9.581466317e-01f,
-    1.489947557e+00f,
-    7.907297611e-01f,
-    9.739301205e-01f,
-    9.100038409e-01f,
-    6.375263333e-01f,
-    1.353691578e+00f,
-    9.550419450e-01f,
-    1.175502419e+00f,
-    1.679427981e+00f,
-    9.129419327e-01f,
-    1.308092117e+00f,
-    1.295178890e+00f,
-    1.026511669e+00f,
-    1.082574606e+00f,
-    9.312894940e-01f,
-    9.293152094e-01f,
-    1.853778481e+00f,
-    1.185637474e+00f,
-    1.294501781e+00f,
-    1.376669407e+00f,
-    6.689012647e-01f,
-    8.945915699e-01f,
-    1.042891264e+00f,
-    1.358718395e+00f,
-    1.075269222e+00f,
-    1.061271548e+00f,
-    1.216392875e+00f,
-    9.751508832e-01f,
-    7.706054449e-01f,
-    1.117398262e+00f,
-    8.303440213e-01f,
-    8.869051933e-01f,
-    1.699057460e+00f,
-    1.488996506e+00f,
-    8.952957392e-01f,
-    1.064529896e+00f,
-    1.074422359e+00f,
-    1.457279086e+00f,
-    1.043793082e+00f,
-    1.086463213e+00f,
-    9.009433389e-01f,
-    1.681568146e+00f,
-    1.496150255e+00f,
-    1.277528048e+00f,
-    2.306580782e+00f,
-    1.622880459e+00f,
-    8.419468403e-01f,
-    9.483599067e-01f,
-    1.693822265e+00f,
-    1.339070559e+00f,
-    1.492761254e+00f,
-    9.247512221e-01f,
-    1.283975601e+00f,
-    1.339512825e+00f,
-    1.104807854e+00f,
-    8.160309196e-01f,
-    1.743428588e+00f,
-    9.013889432e-01f,
-    9.530541301e-01f,
-    9.262998104e-01f,
-    1.374388814e+00f,
-    1.222033858e+00f,
-    1.962347388e+00f,
-    4.796042740e-01f,
-    1.116494536e+00f,
-    8.384582400e-01f,
-    1.031611204e+00f,
-    1.657158375e+00f,
-    7.555269003e-01f,
-    6.643730998e-01f,
-    1.031112671e+00f,
-    1.359683871e+00f,
-    1.110737443e+00f,
-    8.383664489e-01f,
-    8.438677788e-01f,
-    6.261368394e-01f,
-    1.225625634e+00f,
-    6.877177954e-01f,
-    7.703379393e-01f,
-    1.151324034e+00f,
-    9.113600850e-01f,
-    7.816517949e-01f,
-    1.070347190e+00f,
-    1.170436382e+00f,
-    7.446938753e-01f,
-    5.820187330e-01f,
-    6.173954010e-01f,
-    5.895471573e-01f,
-    6.722163558e-01f,
-    5.210171342e-01f,
-    1.211062312e+00f,
-    6.228359938e-01f,
-    1.253822923e+00f,
-    7.201720476e-01f,
-    1.145707607e+00f,
-    7.341019511e-01f,
-    1.018954873e+00f,
-    9.489226937e-01f,
-    1.038424492e+00f,
-    1.112174153e+00f,
-    1.080104828e+00f,
-    1.436228037e+00f,
-    7.593980432e-01f,
-    5.553557873e-01f,
-    1.280152917e+00f,
-    8.333544135e-01f,
-    8.941273689e-01f,
-    1.240264416e+00f,
-    1.106786728e+00f,
-    6.838805079e-01f,
-    6.552609205e-01f,
-    3.873710632e-01f,
-    6.702378392e-01f,
-    6.312229633e-01f,
-    8.402081132e-01f,
-    7.861209512e-01f,
-    1.403430223e+00f,
-    1.044433951e+00f,
-    1.421451688e+00f,
-    7.979373336e-01f,
-    7.599450350e-01f,
-    1.162081599e+00f,
-    1.929832220e+00f,
-    1.333436370e+00f,
-    1.324686170e+00f,
-    9.177885652e-01f,
-    1.007278562e+00f,
-    9.620625377e-01f,
-    9.120331407e-01f,
-    1.402575254e+00f,
-    6.974331141e-01f,
-    1.381205559e+00f,
-    1.208760738e+00f,
-    1.068565845e+00f,
-    5.796086788e-01f,
-    7.807956934e-01f,
-    8.711926937e-01f,
-    1.378262162e+00f,
-    5.842105150e-01f,
-    8.019587398e-01f,
-    1.167028785e+00f,
-    1.201169491e+00f,
-    1.027213335e+00f,
-    1.260938048e+00f,
-    1.250312448e+00f,
-    9.618173838e-01f,
-    8.572219610e-01f,
-    8.162563443e-01f,
-    1.458764911e+00f,
-    6.953989267e-01f,
-    1.252606511e+00f,
-    7.359975576e-01f,
-    1.479950428e+00f,
-    8.920084238e-01f,
-    1.232989311e+00f,
-    6.103498936e-01f,
-    8.413097262e-01f,
-    9.186733365e-01f,
-    6.116489172e-01f,
-    4.390131533e-01f,
-    1.136779666e+00f,
-    6.680911779e-01f,
-    1.427380800e+00f,
-    9.709879756e-01f,
-    7.839242816e-01f,
-    1.468686223e+00f,
-    8.954123259e-01f,
-    8.795772791e-01f,
-    1.557811618e+00f,
-    6.928198934e-01f,
-    1.027705908e+00f,
-    1.001067758e+00f,
-    7.646940947e-01f,
-    1.067831755e+00f,
-    8.217509985e-01f,
-    5.137757063e-01f,
-    6.803593040e-01f,
-    9.693341851e-01f,
-    1.088370681e+00f,
-    1.599887490e+00f,
-    1.414117098e+00f,
-    8.217442036e-01f,
-    8.547414541e-01f,
-    8.804669380e-01f,
-    8.365499973e-01f,
-    1.103769422e+00f,
-    7.531518936e-01f,
-    1.039497375e+00f,
-    1.679212213e+00f,
-    1.022965550e+00f,
-    1.322101831e+00f,
-    8.973685503e-01f,
-    1.070729136e+00f,
-    9.402260184e-01f,
-    1.903532147e+00f,
-    1.129235387e+00f,
-    1.402380228e+00f,
-    9.136167765e-01f,
-    1.103463531e+00f,
-    1.538862348e+00f,
-    1.465855122e+00f,
-    1.105630040e+00f,
-    1.321839690e+00f,
-    7.557305694e-01f,
-    9.174939990e-01f,
-    1.013977885e+00f,
-    1.031262994e+00f,
-    7.942823172e-01f,
-    1.393363357e+00f,
-    7.411257625e-01f,
-    8.833153248e-01f,
-    1.110145569e+00f,
-    8.132911325e-01f,
-    7.136568427e-01f,
-    7.715925574e-01f,
-    8.705366254e-01f,
-    6.768351197e-01f,
-    1.930806160e+00f,
-    1.195593119e+00f,
-    1.151936054e+00f,
-    1.226097345e+00f,
-    8.014186025e-01f,
-    8.908040524e-01f,
-    7.988927364e-01f,
-    1.373203516e+00f,
-    8.981115222e-01f,
-    1.235186100e+00f,
-    1.155301690e+00f,
-    1.379980922e+00f,
-    9.064733386e-01f,
-    1.679343939e+00f,
-    5.266138315e-01f,
-    1.538432479e+00f,
-    1.432262778e+00f,
-    1.087476611e+00f,
-    1.610715747e+00f,
-    7.526135445e-01f,
-    6.493605375e-01f,
-    1.117486238e+00f,
-    1.140299797e+00f,
-    6.537295580e-01f,
-    1.289150834e+00f,
-    1.888959646e+00f,
-    8.210496306e-01f,
-    7.099686265e-01f,
-    1.506118774e+00f,
-    1.017302513e+00f,
-    2.086910963e+00f,
-    5.896475911e-01f,
-    8.881484270e-01f,
-    1.097245455e+00f,
-    1.126024604e+00f,
-    6.988129020e-01f,
-    1.025406837e+00f,
-    1.165961862e+00f,
-    1.066971540e+00f,
-    9.454140067e-01f,
-    7.451516986e-01f,
-    4.352485538e-01f,
-    1.140809894e+00f,
-    8.886294961e-01f,
-    6.543745399e-01f,
-    8.859033585e-01f,
-    1.179924488e+00f,
-    1.400123119e+00f,
-    1.239835382e+00f,
-    6.812000275e-01f,
-    8.589764237e-01f,
-    9.841319323e-01f,
-    1.839481711e+00f,
-    1.273408055e+00f,
-    1.962900162e+00f,
-    7.689742446e-01f,
-    1.185108304e+00f,
-    1.486879587e+00f,
-    8.190018535e-01f,
-    1.681366444e+00f,
-    1.069822192e+00f,
-    1.796050310e+00f,
-    1.159885168e+00f,
-    4.773866236e-01f,
-    1.575417280e+00f,
-    1.109544754e+00f,
-    1.835000277e+00f,
-    8.531984091e-01f,
-    8.492454290e-01f,
-    1.319729924e+00f,
-    1.223679781e+00f,
-    6.687138677e-01f,
-    1.283171535e+00f,
-    1.075856686e+00f,
-    8.502537608e-01f,
-    1.246223569e+00f,
-    1.787342191e+00f,
-    1.264202952e+00f,
-    9.796910882e-01f,
-    1.054126143e+00f,
-    8.765302896e-01f,
-    1.340096474e+00f,
-    9.196677208e-01f,
-    7.179793119e-01f,
-    1.154560447e+00f,
-    1.211367846e+00f,
-    4.602930248e-01f,
-    8.907359242e-01f,
-    1.026895642e+00f,
-    1.037877560e+00f,
-    1.543601990e+00f,
-    6.175560951e-01f,
-    4.742121398e-01f,
-    8.391974568e-01f,
-    1.086351633e+00f,
-    1.947438240e+00f,
-    8.277904987e-01f,
-    9.589979649e-01f,
-    1.157057762e+00f,
-    8.920751214e-01f,
-    9.161155820e-01f,
-    1.102947235e+00f,
-    1.063469768e+00f,
-    9.640147686e-01f,
-    9.658744335e-01f,
-    1.092433095e+00f,
-    7.780944705e-01f,
-    9.424336553e-01f,
-    1.064188719e+00f,
-    1.596107960e+00f,
-    8.276460171e-01f,
-    6.410211325e-01f,
-    8.071742058e-01f,
-    1.205731750e+00f,
-    9.394158721e-01f,
-    8.223274350e-01f,
-    1.093815446e+00f,
-    1.351743460e+00f,
-    1.169044256e+00f,
-    1.404977918e+00f,
-    5.939877033e-01f,
-    9.453400970e-01f,
-    1.055692315e+00f,
-    8.220366240e-01f,
-    1.704584241e+00f,
-    8.301988840e-01f,
-    1.063488126e+00f,
-    6.581032872e-01f,
-    1.526293397e+00f,
-    1.259391546e+00f,
-    5.370689631e-01f,
-    8.556857705e-01f,
-    2.244291544e+00f,
-    1.372848153e+00f,
-    1.795772552e+00f,
-    1.439960837e+00f,
-    6.744740605e-01f,
-    6.031816602e-01f,
-    2.001999855e+00f,
-    1.571876884e+00f,
-    9.671241045e-01f,
-    1.022753716e+00f,
-    2.278481483e+00f,
-    1.183914661e+00f,
-    8.660867810e-01f,
-    1.867363811e+00f,
-    9.496411085e-01f,
-    1.114360929e+00f,
-    2.522436619e+00f,
-    5.578219295e-01f,
-    2.758165836e+00f,
-    1.761192083e+00f,
-    1.209951282e+00f,
-    8.569052219e-01f,
-    7.517253160e-01f,
-    7.559750080e-01f,
-    9.888361692e-01f,
-    9.511571527e-01f,
-    1.298099518e+00f,
-    1.030760527e+00f,
-    7.739863396e-01f,
-    1.240596890e+00f,
-    7.029181719e-01f,
-    1.019547582e+00f,
-    1.121906877e+00f,
-    8.978995085e-01f,
-    6.484150290e-01f,
-    1.597120643e+00f,
-    1.745173931e+00f,
-    7.957456112e-01f,
-    9.004729986e-01f,
-    9.149429202e-01f,
-    1.229065657e+00f,
-    1.493043542e+00f,
-    6.414077878e-01f,
-    1.501319885e+00f,
-    7.667479515e-01f,
-    6.122624278e-01f,
-    7.460896969e-01f,
-    1.012870669e+00f,
-    1.666294575e+00f,
-    1.078505039e+00f,
-    1.112042665e+00f,
-    1.833432913e+00f,
-    1.129396558e+00f,
-    1.498841882e+00f,
-    9.223972559e-01f,
-    9.807888865e-01f,
-    1.549892187e+00f,
-    1.048863173e+00f,
-    5.282453895e-01f,
-    6.897591949e-01f,
-    1.477252245e+00f,
-    8.246132731e-01f,
-    9.667387009e-01f,
-    1.233721375e+00f,
-    2.137990952e+00f,
-    1.086259723e+00f,
-    1.114873052e+00f,
-    9.844222665e-01f,
-    1.032818317e+00f,
-    1.408734798e+00f,
-    1.140939116e+00f,
-    8.705339432e-01f,
-    5.663656592e-01f,
-    1.644446015e+00f,
-    1.738855839e+00f,
-    7.232049108e-01f,
-    5.047116876e-01f,
-    9.304755926e-01f,
-    1.015664101e+00f,
-    1.157122254e+00f,
-    1.360012770e+00f,
-    1.717086077e+00f,
-    1.408795357e+00f,
-    9.639532566e-01f,
-    1.321349025e+00f,
-    7.198195457e-01f,
-    5.617258549e-01f,
-    8.504802585e-01f,
-    2.020408869e+00f,
-    1.370565295e+00f,
-    9.235089421e-01f,
-    1.177635312e+00f,
-    9.787315726e-01f,
-    9.375979900e-01f,
-    9.019611478e-01f,
-    1.036338687e+00f,
-    1.096805215e+00f,
-    1.046991467e+00f,
-    1.500619292e+00f,
-    1.018068075e+00f,
-    1.031573892e+00f,
-    1.360605359e+00f,
-    1.365350008e+00f,
-    1.869718075e+00f,
-    1.458854437e+00f,
-    1.510680556e+00f,
-    9.419141412e-01f,
-    1.141503692e+00f,
-    1.735981703e+00f,
-    8.036760688e-01f,
-    1.141072154e+00f,
-    1.767539024e+00f,
-    1.827623010e+00f,
-    1.129763365e+00f,
-    9.099833965e-01f,
-    8.471767902e-01f,
-    6.279017329e-01f,
-    7.060462832e-01f,
-    7.431357503e-01f,
-    8.074904084e-01f,
-    9.587472677e-01f,
-    7.997207642e-01f,
-    1.022079945e+00f,
-    1.378426909e+00f,
-    1.614292622e+00f,
-    2.309297323e+00f,
-    8.164394498e-01f,
-    7.357475162e-01f,
-    1.047103405e+00f,
-    1.318864346e+00f,
-    1.272839069e+00f,
-    7.523906231e-01f,
-    1.131385207e+00f,
-    1.193896294e+00f,
-    5.193242431e-01f,
-    1.436225891e+00f,
-    1.172900081e+00f,
-    2.787491977e-01f,
-    2.005553007e+00f,
-    1.316320896e+00f,
-    1.604827642e+00f,
-    1.925969481e+00f,
-    9.089952111e-01f,
-    9.735128880e-01f,
-    1.042794228e+00f,
-    1.561742425e+00f,
-    9.386290312e-01f,
-    5.335123539e-01f,
-    6.072376966e-01f,
-    2.296935797e+00f,
-    4.364453256e-01f,
-    8.010966778e-01f,
-    7.008846998e-01f,
-    4.794455469e-01f,
-    9.181920886e-01f,
-    2.081608295e+00f,
-    9.423512220e-01f,
-    5.421096087e-01f,
-    1.056479812e+00f,
-    2.998908460e-01f,
-    1.488930345e+00f,
-    1.140494466e+00f,
-    1.389925361e+00f,
-    1.530927181e+00f,
-    1.281674743e+00f,
-    1.440141559e+00f,
-    1.161890149e+00f,
-    1.100303054e+00f,
-    1.300497890e+00f,
-    6.914535761e-01f,
-    1.437134385e+00f,
-    1.061224818e+00f,
-    9.135250449e-01f,
-    1.236062288e+00f,
-    1.428488612e+00f,
-    5.590246916e-01f,
-    1.363852739e+00f,
-    1.014727473e+00f,
-    8.942690492e-01f,
-    6.178872585e-01f,
-    1.111665010e+00f,
-    1.115270615e+00f,
-    7.096952796e-01f,
-    7.943413854e-01f,
-    1.185458899e+00f,
-    1.071883202e+00f,
-    1.515080333e+00f,
-    1.314477444e+00f,
-    1.531261683e+00f,
-    1.186240673e+00f,
-    1.300640345e+00f,
-    6.693714857e-01f,
-    5.850559473e-01f,
-    8.859769702e-01f,
-    1.328077555e+00f,
-    8.094519973e-01f,
-    1.259540558e+00f,
-    1.394378066e+00f,
-    1.551205635e+00f,
-    8.576350808e-01f,
-    1.914590597e+00f,
-    9.939098954e-01f,
-    4.614396989e-01f,
-    1.268977761e+00f,
-    9.113152623e-01f,
-    6.284937263e-01f,
-    2.196927309e+00f,
-    1.010767460e+00f,
-    1.418563604e+00f,
-    9.423832297e-01f,
-    5.706788898e-01f,
-    1.184332252e+00f,
-    4.803054929e-01f,
-    1.092198014e+00f,
-    1.806761503e+00f,
-    7.791408300e-01f,
-    1.040201902e+00f,
-    6.623420715e-01f,
-    1.354048610e+00f,
-    7.164667249e-01f,
-    9.118816257e-01f,
-    1.098369360e+00f,
-    1.106673121e+00f,
-    6.476979256e-01f,
-    7.785412669e-01f,
-    6.066874266e-01f,
-    5.666731596e-01f,
-    1.050104380e+00f,
-    1.059811115e+00f,
-    8.895475268e-01f,
-    7.324475646e-01f,
-    3.890568018e-01f,
-    5.698904991e-01f,
-    9.156042933e-01f,
-    1.024784088e+00f,
-    8.148815632e-01f,
-    3.801443338e+00f,
-    6.625545621e-01f,
-    1.050366521e+00f,
-    7.605398297e-01f,
-    7.341254950e-01f,
-    9.297179580e-01f,
-    1.075581908e+00f,
-    1.743075252e+00f,
-    6.852467060e-01f,
-    2.244280815e+00f,
-    9.924444556e-01f,
-    4.221780896e-01f,
-    5.026001334e-01f,
-    1.021374226e+00f,
-    1.354212165e+00f,
-    1.249016762e+00f,
-    6.683664918e-01f,
-    9.901351333e-01f,
-    8.799269199e-01f,
-    8.341655135e-01f,
-    1.381108761e+00f,
-    7.230009437e-01f,
-    1.415384173e+00f,
-    1.134021163e+00f,
-    1.901407242e+00f,
-    1.131828427e+00f,
-    1.190549970e+00f,
-    1.314424992e+00f,
-    1.080846310e+00f,
-    9.232635498e-01f,
-    8.685337901e-01f,
-    9.269202352e-01f,
-    1.453416109e+00f,
-    5.727602839e-01f,
-    1.227097154e+00f,
-    8.747336268e-01f,
-    1.303816557e+00f,
-    1.155853748e+00f,
-    8.804885745e-01f,
-    2.149483442e+00f,
-    1.212230086e+00f,
-    1.188939691e+00f,
-    3.893723786e-01f,
-    1.327962041e+00f,
-    1.661579013e+00f,
-    9.796250463e-01f,
-    1.034018874e+00f,
-    1.620577812e+00f,
-    1.533414125e+00f,
-    1.412362099e+00f,
-    1.010477901e+00f,
-    8.522081375e-01f,
-    1.361564279e+00f,
-    2.053561687e+00f,
-    8.458182812e-01f,
-    1.008615017e+00f,
-    9.562436938e-01f,
-    6.795153618e-01f,
-    1.937383056e+00f,
-    1.280770302e+00f,
-    1.549680829e+00f,
-    1.105001092e+00f,
-    1.191737771e+00f,
-    7.146866322e-01f,
-    8.622666001e-01f,
-    6.638104320e-01f,
-    1.842677712e+00f,
-    1.080090880e+00f,
-    1.186703920e+00f,
-    6.439626813e-01f,
-    8.309686184e-01f,
-    9.702519178e-01f,
-    9.016833901e-01f,
-    1.514429569e+00f,
-    1.327716589e+00f,
-    1.798308611e+00f,
-    1.160807848e+00f,
-    1.182537556e+00f,
-    2.708472013e+00f,
-    5.410833359e-01f,
-    8.189752102e-01f,
-    1.203584075e+00f,
-    1.232054472e+00f,
-    7.909994125e-01f,
-    1.094961524e+00f,
-    9.889757037e-01f,
-    1.403797746e+00f,
-    1.077807784e+00f,
-    6.637658477e-01f,
-    1.400020838e+00f,
-    9.904910326e-01f,
-    1.037570238e+00f,
-    7.170657516e-01f,
-    1.177073479e+00f,
-    1.277448297e+00f,
-    1.226815939e+00f,
-    1.188046336e+00f,
-    6.819966435e-01f,
-    8.092190027e-01f,
-    1.246282935e+00f,
-    8.514617682e-01f,
-    1.569584370e+00f,
-    8.153815269e-01f,
-    6.768491268e-01f,
-    1.104767919e+00f,
-    4.582729936e-01f,
-    1.032907009e+00f,
-    8.687235713e-01f,
-    1.154165864e+00f,
-    6.464129090e-01f,
-    8.642498851e-01f,
-    1.111913681e+00f,
-    1.588582754e+00f,
-    8.502912521e-01f,
-    9.856902361e-01f,
-    7.899908423e-01f,
-    8.552837968e-01f,
-    1.001532674e+00f,
-    1.180125833e+00f,
-    6.893251538e-01f,
-    8.770803809e-01f,
-    1.370834351e+00f,
-    9.208943844e-01f,
-    6.867902875e-01f,
-    6.858903170e-01f,
-    1.044077158e+00f,
-    1.498964787e+00f,
-    6.304026246e-01f,
-    4.988062978e-01f,
-    9.362304211e-01f,
-    1.217035055e+00f,
-    7.148977518e-01f,
-    1.636160016e+00f,
-    1.234150410e+00f,
-    9.632003307e-01f,
-    1.063730359e+00f,
-    8.831266761e-01f,
-    1.165070295e+00f,
-    1.108463883e+00f,
-    1.826970339e+00f,
-    2.229601622e+00f,
-    1.340195894e+00f,
-    1.388859034e+00f,
-    1.095789313e+00f,
-    1.540160656e+00f,
-    1.471229076e+00f,
-    5.149608254e-01f,
-    6.397314072e-01f,
-    1.264185071e+00f,
-    1.046580315e+00f,
-    1.785827875e+00f,
-    1.153916717e+00f,
-    9.429129362e-01f,
-    1.275612354e+00f,
-    4.243041873e-01f,
-    6.329289079e-01f,
-    9.084449410e-01f,
-    1.209849715e+00f,
-    1.649444222e+00f,
-    1.084319711e+00f,
-    8.838239312e-01f,
-    9.831776023e-01f,
-    7.874286771e-01f,
-    9.599654078e-01f,
-    5.825396776e-01f,
-    1.611306429e+00f,
-    9.700558782e-01f,
-    1.101316094e+00f,
-    6.816465855e-01f,
-    1.208733916e+00f,
-    1.148157358e+00f,
-    2.229672909e+00f,
-    1.192973495e+00f,
-    1.523403049e+00f,
-    1.235073566e+00f,
-    5.803523660e-01f,
-    8.317255974e-01f,
-    8.584700227e-01f,
-    7.142251134e-01f,
-    8.482595086e-01f,
-    7.909129858e-01f,
-    7.749882340e-01f,
-    7.013936639e-01f,
-    8.827056289e-01f,
-    7.754030228e-01f,
-    7.906585336e-01f,
-    4.798590839e-01f,
-    5.756161809e-01f,
-    3.524525464e-01f,
-    1.362611055e+00f,
-    1.550954819e+00f,
-    1.403443217e+00f,
-    9.081059694e-01f,
-    8.405405283e-01f,
-    7.754843235e-01f,
-    1.026639223e+00f,
-    1.327626228e+00f,
-    8.925520182e-01f,
-    9.927903414e-01f,
-    1.145244956e+00f,
-    9.482986331e-01f,
-    1.863641739e+00f,
-    9.096370339e-01f,
-    8.546040058e-01f,
-    1.672761917e+00f,
-    1.081326485e+00f,
-    9.396620989e-01f,
-    9.819585681e-01f,
-    9.794214964e-01f,
-    9.680505395e-01f,
-    9.893855453e-01f,
-    1.813152075e+00f,
-    1.503829837e+00f,
-    1.737916350e+00f,
-    6.630928516e-01f,
-    8.416877389e-01f,
-    8.936286569e-01f,
-    2.250298023e+00f,
-    1.343605518e+00f,
-    2.340123653e+00f,
-    9.737057090e-01f,
-    7.126861811e-01f,
-    1.177803278e+00f,
-    1.036507368e+00f,
-    1.291440368e+00f,
-    1.256291389e+00f,
-    1.232118368e+00f,
-    1.379026771e+00f,
-    9.072272778e-01f,
-    1.134443879e+00f,
-    1.322497249e+00f,
-    1.003821731e+00f,
-    6.303952336e-01f,
-    8.879778385e-01f,
-    8.951349854e-01f,
-    1.281148672e+00f,
-    1.050191283e+00f,
-    5.187709928e-01f,
-    8.953219652e-01f,
-    4.156656861e-01f,
-    1.458608866e+00f,
-    1.172703385e+00f,
-    5.136843324e-01f,
-    8.439601064e-01f,
-    1.112695813e+00f,
-    1.103033900e+00f,
-    1.062396526e+00f,
-    1.031193018e+00f,
-    9.812384248e-01f,
-    6.933267117e-01f,
-    1.301029205e+00f,
-    1.018761158e+00f,
-    1.093619704e+00f,
-    1.171675086e+00f,
-    7.667039037e-01f,
-    3.861866891e-01f,
-    1.250100613e+00f,
-    8.582977653e-01f,
-    9.700713754e-01f,
-    9.117843509e-01f,
-    8.138956428e-01f,
-    5.765039325e-01f,
-    8.744975924e-01f,
-    1.187046051e+00f,
-    8.103293777e-01f,
-    8.469526172e-01f,
-    7.442818284e-01f,
-    1.423742175e+00f,
-    2.040964842e+00f,
-    9.066815972e-01f,
-    4.952514768e-01f,
-    1.029389024e+00f,
-    1.085241914e+00f,
-    3.718701601e-01f,
-    5.306418538e-01f,
-    2.361884832e+00f,
-    1.179530621e+00f,
-    1.191866755e+00f,
-    1.549947262e+00f,
-    9.809594154e-01f,
-    7.580622435e-01f,
-    1.422739983e+00f,
-    9.608510137e-01f,
-    4.290739894e-01f,
-    1.212399840e+00f,
-    7.780194283e-01f,
-    1.066309690e+00f,
-    6.247283220e-01f,
-    1.364069343e+00f,
-    1.157919049e+00f,
-    1.481989980e+00f,
-    1.005105138e+00f,
-    1.278027296e+00f,
-    9.230441451e-01f,
-    7.600221634e-01f,
-    1.343530774e+00f,
-    7.035423517e-01f,
-    7.060575485e-01f,
-    1.031434894e+00f,
-    1.263439775e+00f,
-    8.589876294e-01f,
-    1.712270975e+00f,
-    3.764191270e-01f,
-    9.379834533e-01f,
-    9.704592824e-01f,
-    8.037288189e-01f,
-    8.788948655e-01f,
-    1.496697664e+00f,
-    7.117941976e-01f,
-    2.362815619e+00f,
-    1.392333508e+00f,
-    6.468752623e-01f,
-    7.255593538e-01f,
-    1.437055230e+00f,
-    4.582439959e-01f,
-    9.524251819e-01f,
-    8.207999468e-01f,
-    9.166690111e-01f,
-    8.328670859e-01f,
-    8.317656517e-01f,
-    6.954132318e-01f,
-    7.962327003e-01f,
-    5.268102288e-01f,
-    5.153132081e-01f,
-    6.814998388e-01f,
-    1.938964486e+00f,
-    1.395801544e+00f,
-    8.516430855e-01f,
-    1.095475316e+00f,
-    1.248491049e+00f,
-    1.423896909e+00f,
-    6.768268347e-01f,
-    6.894088387e-01f,
-    8.914881945e-01f,
-    2.488533258e+00f,
-    6.157741547e-01f,
-    1.094581008e+00f,
-    1.316117048e+00f,
-    1.044394851e+00f,
-    2.780802488e+00f,
-    1.290422797e+00f,
-    7.113232017e-01f,
-    8.903529048e-01f,
-    1.244950294e+00f,
-    6.863739491e-01f,
-    8.049820065e-01f,
-    1.401190639e+00f,
-    1.880926371e+00f,
-    9.274709225e-01f,
-    1.042506695e+00f,
-    7.037853599e-01f,
-    1.013306618e+00f,
-    1.035493016e+00f,
-    1.579202652e+00f,
-    9.494019151e-01f,
-    1.427658796e+00f,
-    9.601438642e-01f,
-    5.789263844e-01f,
-    9.426931143e-01f,
-    2.635239124e+00f,
-    1.645022392e+00f,
-    6.091802716e-01f,
-    1.013243437e+00f,
-    9.119321108e-01f,
-    7.025379539e-01f,
-    6.508232951e-01f,
-    1.505394816e+00f,
-    7.591043115e-01f,
-    5.781694651e-01f,
-    4.718809724e-01f,
-    1.504825592e+00f,
-    9.427943826e-01f,
-    1.318405986e+00f,
-    8.576770425e-01f,
-    7.197390199e-01f,
-    1.143664002e+00f,
-    1.660224676e+00f,
-    7.915473580e-01f,
-    1.693659186e+00f,
-    1.542322636e+00f,
-    9.899214506e-01f,
-    9.986701608e-01f,
-    1.381407022e+00f,
-    1.457472324e+00f,
-    6.947521567e-01f,
-    1.217784524e+00f,
-    5.607664585e-01f,
-    3.041315556e+00f,
-    1.161297321e+00f,
-    9.971308708e-01f,
-    1.827853441e+00f,
-    5.935616493e-01f,
-    1.154579043e+00f,
-    4.766757190e-01f,
-    6.822331548e-01f,
-    7.426925898e-01f,
-    6.878521442e-01f,
-    1.077185988e+00f,
-    1.300090432e+00f,
-    9.368874431e-01f,
-    5.151743293e-01f,
-    1.609164476e+00f,
-    1.150593281e+00f,
-    9.137182832e-01f,
-    1.241888404e+00f,
-    7.844668627e-01f,
-    1.499797940e+00f,
-    8.032322526e-01f,
-    2.180560112e+00f,
-    1.154405832e+00f,
-    8.779390454e-01f,
-    7.714161277e-01f,
-    2.227856398e+00f,
-    1.432214499e+00f,
-    7.237433195e-01f,
-    1.153300643e+00f,
-    1.256990075e+00f,
-    9.224629998e-01f,
-    1.286539793e+00f,
-    8.531243801e-01f,
-    1.326779127e+00f,
-    1.108533144e+00f,
-    2.171941280e+00f,
-    8.657767177e-01f,
-    1.691682816e+00f,
-    1.191665769e+00f,
-    8.812496066e-01f,
-    1.108640313e+00f,
-    9.808872938e-01f,
-    8.454859257e-01f,
-    1.386812806e+00f,
-    1.328739882e+00f,
-    7.037692666e-01f,
-    6.702989936e-01f,
-    6.226112247e-01f,
-    1.040082812e+00f,
-    1.246746063e+00f,
-    1.280163765e+00f,
-    9.041420817e-01f,
-    1.359505296e+00f,
-    1.574950695e+00f,
-    8.849675059e-01f,
-    4.595320821e-01f,
-    1.017754316e+00f,
-    7.749205828e-01f,
-    9.458408356e-01f,
-    5.968909264e-01f,
-    4.629551470e-01f,
-    1.032622695e+00f,
-    1.523141265e+00f,
-    4.381982088e-01f,
-    4.494257271e-01f,
-    9.059573412e-01f,
-    9.343705177e-01f,
-    1.228237033e+00f,
-    8.255544305e-01f,
-    7.839658856e-01f,
-    6.933357120e-01f,
-    7.363580465e-01f,
-    9.557303190e-01f,
-    1.614031076e+00f,
-    8.517620564e-01f,
-    2.119502544e+00f,
-    1.418300390e+00f,
-    9.594480991e-01f,
-    9.293244481e-01f,
-    1.720769763e+00f,
-    5.125372410e-01f,
-    1.173111916e+00f,
-    6.076236367e-01f,
-    1.123057365e+00f,
-    5.896140933e-01f,
-    1.358598828e+00f,
-    1.408242226e+00f,
-    1.088715196e+00f,
-    8.177029490e-01f,
-    2.532970428e+00f,
-    1.113157988e+00f,
-    1.134492040e+00f,
-    1.089459658e+00f,
-    1.810807705e+00f,
-    1.635436416e+00f,
-    1.031045794e+00f,
-    4.666770399e-01f,
-    1.625767231e+00f,
-    1.011276722e+00f,
-    1.130141854e+00f,
-    1.168010116e+00f,
-    1.266176343e+00f,
-    1.721655130e+00f,
-    8.834720254e-01f,
-    1.048171163e+00f,
-    9.725573063e-01f,
-    7.059795260e-01f,
-    6.660731435e-01f,
-    6.754145026e-01f,
-    9.607970715e-01f,
-    7.518981099e-01f,
-    1.204236865e+00f,
-    1.609430909e+00f,
-    1.773469448e+00f,
-    1.086658716e+00f,
-    1.397106409e+00f,
-    1.266439557e+00f,
-    1.131783843e+00f,
-    1.030519128e+00f,
-    8.220950961e-01f,
-    1.199126601e+00f,
-    1.329939842e+00f,
-    7.781592607e-01f,
-    8.254474401e-01f,
-    1.584563732e+00f,
-    8.256848454e-01f,
-    8.279256225e-01f,
-    1.006868958e+00f,
-    1.147257566e+00f,
-    6.808447242e-01f,
-    3.122002363e+00f,
-    1.458954096e+00f,
-    9.448055029e-01f,
-    6.790877581e-01f,
-    2.491474152e+00f,
-    9.293578863e-01f,
-    6.431251168e-01f,
-    8.698528409e-01f,
-    1.189522147e+00f,
-    7.433108687e-01f,
-    1.217059016e+00f,
-    7.348414660e-01f,
-    1.369884133e+00f,
-    1.109591007e+00f,
-    6.134970784e-01f,
-    7.735772729e-01f,
-    5.805299282e-01f,
-    9.172081947e-01f,
-    8.546139598e-01f,
-    1.181673169e+00f,
-    4.626491070e-01f,
-    9.884759784e-01f,
-    9.886562228e-01f,
-    1.152239680e+00f,
-    1.406513929e+00f,
-    1.096104622e+00f,
-    1.106520891e+00f,
-    1.468772888e+00f,
-    1.753303409e+00f,
-    1.268610716e+00f,
-    1.083917737e+00f,
-    8.288999200e-01f,
-    1.150507212e+00f,
-    1.404374003e+00f,
-    1.077634454e+00f,
-    1.301571965e+00f,
-    1.140600443e+00f,
-    1.349972367e+00f,
-    8.871637583e-01f,
-    2.086320400e+00f,
-    6.752380729e-01f,
-    1.238713264e+00f,
-    8.057357669e-01f,
-    2.077931166e+00f,
-    1.373060822e+00f,
-    8.649966717e-01f,
-    7.712069750e-01f,
-    7.005745769e-01f,
-    5.123150349e-01f,
-    1.070872545e+00f,
-    8.563274145e-01f,
-    9.937027097e-01f,
-    1.583192229e+00f,
-    1.403707504e+00f,
-    6.252068877e-01f,
-    8.973332047e-01f,
-    2.310341120e+00f,
-    1.023058534e+00f,
-    1.605171561e+00f,
-    6.763409376e-01f,
-    8.681531549e-01f,
-    2.041829586e+00f,
-    1.464717984e+00f,
-    7.355278730e-01f,
-    1.372043729e+00f,
-    1.073379636e+00f,
-    1.092285872e+00f,
-    9.613974690e-01f,
-    7.400264144e-01f,
-    1.236224651e+00f,
-    8.564355969e-01f,
-    5.880204439e-01f,
-    6.068129539e-01f,
-    9.807090163e-01f,
-    1.216570735e+00f,
-    1.632553577e+00f,
-    6.987255216e-01f,
-    4.726073444e-01f,
-    9.993764758e-01f,
-    1.257825851e+00f,
-    9.721525311e-01f,
-    8.514180183e-01f,
-    1.241867542e+00f,
-    5.416457057e-01f,
-    2.292833567e+00f,
-    8.673632145e-01f,
-    1.208811283e+00f,
-    8.649193645e-01f,
-    1.668841362e+00f,
-    2.216873407e+00f,
-    1.281217813e+00f,
-    8.237938285e-01f,
-    6.437438726e-01f,
-    1.085265279e+00f,
-    1.178629637e+00f,
-    1.234667659e+00f,
-    9.992163181e-01f,
-    1.300851941e+00f,
-    9.306195974e-01f,
-    1.196471930e+00f,
-    8.092439771e-01f,
-    8.234139085e-01f,
-    1.004783392e+00f,
-    8.009285927e-01f,
-    1.194411874e+00f,
-    6.399751902e-01f,
-    8.727301359e-01f,
-    6.415065527e-01f,
-    1.202302337e+00f,
-    1.294861794e+00f,
-    6.540883183e-01f,
-    1.812293291e+00f,
-    4.852412641e-01f,
-    1.487956643e+00f,
-    7.901381850e-01f,
-    5.981606245e-01f,
-    9.075903296e-01f,
-    1.058169246e+00f,
-    1.340926528e+00f,
-    4.584631026e-01f,
-    8.449594378e-01f,
-    2.017137527e+00f,
-    1.044023037e+00f,
-    6.418667436e-01f,
-    1.283697367e+00f,
-    6.461735368e-01f,
-    5.971671343e-01f,
-    1.184513688e+00f,
-    1.414911866e+00f,
-    1.075583339e+00f,
-    1.335699677e+00f,
-    9.078332186e-01f,
-    1.060552120e+00f,
-    1.404777408e+00f,
-    1.255288124e+00f,
-    2.123929501e+00f,
-    8.825305700e-01f,
-    5.680913925e-01f,
-    1.092521906e+00f,
-    5.265728235e-01f,
-    7.282320261e-01f,
-    1.965901375e+00f,
-    1.144560099e+00f,
-    9.105897546e-01f,
-    1.867354631e+00f,
-    1.278272271e+00f,
-    1.390816450e+00f,
-    7.834220529e-01f,
-    1.239085674e+00f,
-    8.970810771e-01f,
-    7.378717661e-01f,
-    6.800776720e-01f,
-    8.562617898e-01f,
-    1.158289790e+00f,
-    8.559824228e-01f,
-    4.798041880e-01f,
-    1.032490253e+00f,
-    1.795181394e+00f,
-    6.257980466e-01f,
-    6.789457798e-01f,
-    8.352478743e-01f,
-    1.498250127e+00f,
-    8.376818895e-01f,
-    1.471587777e+00f,
-    7.895647883e-01f,
-    1.423838377e+00f,
-    6.169071198e-01f,
-    7.142471671e-01f,
-    1.809116364e+00f,
-    1.040727258e+00f,
-    9.465632439e-01f,
-    1.332690716e+00f,
-    5.171127915e-01f,
-    1.230715752e+00f,
-    1.472318649e+00f,
-    1.138439417e+00f,
-    7.026643753e-01f,
-    1.986775637e+00f,
-    1.218070626e+00f,
-    9.481171966e-01f,
-    9.593561292e-01f,
-    7.193215489e-01f,
-    1.514149547e+00f,
-    7.123727798e-01f,
-    9.079684615e-01f,
-    7.285020351e-01f,
-    9.990916848e-01f,
-    1.461276293e+00f,
-    7.498111129e-01f,
-    1.346478820e+00f,
-    1.718138814e+00f,
-    1.262637138e+00f,
-    1.395988345e+00f,
-    8.136120439e-01f,
-    1.396253586e+00f,
-    7.608855963e-01f,
-    1.337080002e+00f,
-    8.806912303e-01f,
-    9.443818331e-01f,
-    8.176103830e-01f,
-    3.308109939e-01f,
-    8.117073178e-01f,
-    6.965388656e-01f,
-    1.121637821e+00f,
-    1.743420124e+00f,
-    1.102384925e+00f,
-    8.194776177e-01f,
-    1.541333675e+00f,
-    8.820307255e-01f,
-    1.448529363e+00f,
-    1.001438975e+00f,
-    1.083663821e+00f,
-    7.079541683e-01f,
-    1.426353455e+00f,
-    1.079615474e+00f,
-    1.281715751e+00f,
-    1.263523698e+00f,
-    1.487447500e+00f,
-    1.335386157e+00f,
-    1.132478952e+00f,
-    8.210977316e-01f,
-    9.571172595e-01f,
-    1.275285125e+00f,
-    9.572494030e-01f,
-    1.102061510e+00f,
-    8.715875745e-01f,
-    1.326843262e+00f,
-    1.993844509e+00f,
-    1.288030744e+00f,
-    7.912579179e-01f,
-    1.339962721e+00f,
-    1.065764785e+00f,
-    8.550660610e-01f,
-    1.036973238e+00f,
-    1.122975588e+00f,
-    2.061161995e+00f,
-    1.226577520e+00f,
-    9.603271484e-01f,
-    1.602469206e+00f,
-    1.152033210e+00f,
-    1.366619349e+00f,
-    1.588096976e+00f,
-    1.439055800e+00f,
-    1.806942105e+00f,
-    1.311551452e+00f,
-    8.201051950e-01f,
-    1.372329712e+00f,
-    9.579526186e-01f,
-    6.669546962e-01f,
-    2.098190546e+00f,
-    8.861054182e-01f,
-    1.956566572e+00f,
-    1.057296276e+00f,
-    1.188241839e+00f,
-    9.527162910e-01f,
-    1.204580903e+00f,
-    1.346976757e+00f,
-    1.075990200e+00f,
-    1.022339821e+00f,
-    8.202137351e-01f,
-    7.864258289e-01f,
-    6.237524152e-01f,
-    8.418281078e-01f,
-    9.537840486e-01f,
-    1.120672822e+00f,
-    6.613694429e-01f,
-    8.208293915e-01f,
-    3.899968863e-01f,
-    7.070502043e-01f,
-    2.041975021e+00f,
-    8.856466413e-01f,
-    1.897622943e+00f,
-    4.804723263e-01f,
-    1.387696505e+00f,
-    1.181640983e+00f,
-    1.094512701e+00f,
-    1.313145876e+00f,
-    1.745227695e+00f,
-    1.098106742e+00f,
-    1.733552694e+00f,
-    1.048388839e+00f,
-    7.927696109e-01f,
-    7.179147601e-01f,
-    1.007677913e+00f,
-    6.025695801e-01f,
-    1.059287190e+00f,
-    9.758880734e-01f,
-    1.444977164e+00f,
-    1.974685311e+00f,
-    1.012131333e+00f,
-    4.783361554e-01f,
-    5.121907592e-01f,
-    1.020945668e+00f,
-    1.090882421e+00f,
-    1.226465821e+00f,
-    1.642996073e+00f,
-    1.122797012e+00f,
-    7.308027148e-01f,
-    9.291707277e-01f,
-    1.347224236e+00f,
-    1.069721818e+00f,
-    1.074633598e+00f,
-    8.734297752e-01f,
-    5.368880033e-01f,
-    1.232124448e+00f,
-    8.731203675e-01f,
-    7.258877754e-01f,
-    1.126187801e+00f,
-    5.961389542e-01f,
-    1.069364667e+00f,
-    7.478335500e-01f,
-    8.593116403e-01f,
-    9.003192186e-01f,
-    1.109519601e+00f,
-    4.643501043e-01f,
-    5.648737550e-01f,
-    9.933438897e-01f,
-    1.657000065e+00f,
-    7.889467478e-01f,
-    1.132036090e+00f,
-    1.146673799e+00f,
-    1.291409731e+00f,
-    1.081223249e+00f,
-    1.008569002e+00f,
-    1.168392420e+00f,
-    1.237018704e+00f,
-    1.680458903e+00f,
-    1.258724213e+00f,
-    7.439834476e-01f,
-    2.329478741e+00f,
-    1.326929450e+00f,
-    1.508336306e+00f,
-    1.205134630e+00f,
-    1.302426100e+00f,
-    6.258893609e-01f,
-    1.149800301e+00f,
-    8.202222586e-01f,
-    5.857886672e-01f,
-    6.305841208e-01f,
-    1.162429810e+00f,
-    1.158115387e+00f,
-    6.189188361e-01f,
-    1.147807837e+00f,
-    8.765887022e-01f,
-    9.735060930e-01f,
-    8.702405095e-01f,
-    6.883045435e-01f,
-    2.057786703e+00f,
-    3.257500231e-01f,
-    9.136654139e-01f,
-    1.115682244e+00f,
-    1.924679399e+00f,
-    1.444654107e+00f,
-    1.985919833e+00f,
-    1.711993575e+00f,
-    1.097600579e+00f,
-    8.629279733e-01f,
-    6.163122058e-01f,
-    2.383814096e+00f,
-    7.336565256e-01f,
-    1.667456508e+00f,
-    1.247357130e+00f,
-    9.630045295e-01f,
-    7.727984190e-01f,
-    8.995416760e-01f,
-    1.222561955e+00f,
-    1.143039465e+00f,
-    4.389064014e-01f,
-    9.516921043e-01f,
-    9.570541978e-01f,
-    1.228037000e+00f,
-    1.213925481e+00f,
-    1.573776126e+00f,
-    4.692939222e-01f,
-    1.183313370e+00f,
-    1.173506975e+00f,
-    9.644443989e-01f,
-    1.028128982e+00f,
-    1.753542304e+00f,
-    7.500295639e-01f,
-    1.074955463e+00f,
-    1.220469832e+00f,
-    3.873539567e-01f,
-    1.367033005e+00f,
-    6.249467134e-01f,
-    6.055567861e-01f,
-    1.043830633e+00f,
-    1.139817357e+00f,
-    1.128409743e+00f,
-    1.106356382e+00f,
-    2.385216475e+00f,
-    1.469992518e+00f,
-    1.664354324e+00f,
-    1.435262084e+00f,
-    1.195010066e+00f,
-    1.795450568e+00f,
-    8.982541561e-01f,
-    1.618398666e+00f,
-    1.708721042e+00f,
-    1.447859883e+00f,
-    1.154102325e+00f,
-    1.416501522e+00f,
-    2.005426884e+00f,
-    9.893627167e-01f,
-    1.489336848e+00f,
-    1.220300913e+00f,
-    1.759735465e+00f,
-    2.056303978e+00f,
-    1.373847485e+00f,
-    1.084941983e+00f,
-    2.033327103e+00f,
-    2.830954790e+00f,
-    8.799528480e-01f,
-    1.119930029e+00f,
-    1.502862334e+00f,
-    7.713822722e-01f,
-    9.908576012e-01f,
-    8.519003987e-01f,
-    7.667536736e-01f,
-    1.067107439e+00f,
-    1.199666739e+00f,
-    6.879647374e-01f,
-    7.824309468e-01f,
-    6.397453547e-01f,
-    1.190611959e+00f,
-    9.140669703e-01f,
-    1.045491338e+00f,
-    6.939502954e-01f,
-    1.018177509e+00f,
-    1.530628324e+00f,
-    5.962610245e-01f,
-    9.154416919e-01f,
-    8.244414330e-01f,
-    4.443886280e-01f,
-    1.412810206e+00f,
-    1.033649564e+00f,
-    8.649212718e-01f,
-    1.230778337e+00f,
-    9.959340096e-01f,
-    1.358792186e+00f,
-    2.601754665e+00f,
-    1.303175569e+00f,
-    1.160253167e+00f,
-    8.093804717e-01f,
-    1.289340019e+00f,
-    7.092205882e-01f,
-    1.230533361e+00f,
-    1.027287602e+00f,
-    8.243972063e-01f,
-    4.351556778e+00f,
-    1.384703875e+00f,
-    2.249795198e+00f,
-    1.735324144e+00f,
-    1.591884017e+00f,
-    9.061770439e-01f,
-    6.002308130e-01f,
-    8.660622835e-01f,
-    1.604269862e+00f,
-    7.346550822e-01f,
-    1.265858054e+00f,
-    9.757710695e-01f,
-    1.581516862e+00f,
-    8.077005744e-01f,
-    1.057580948e+00f,
-    1.175609946e+00f,
-    1.081938744e+00f,
-    1.018880367e+00f,
-    1.784047842e+00f,
-    7.285009623e-01f,
-    5.482809544e-01f,
-    1.255826235e+00f,
-    9.709092975e-01f,
-    1.388347030e+00f,
-    9.146454334e-01f,
-    1.364657283e+00f,
-    1.207072020e+00f,
-    2.312888145e+00f,
-    1.180409193e+00f,
-    1.190516233e+00f,
-    1.263347745e+00f,
-    1.148708224e+00f,
-    1.105391502e+00f,
-    1.374225497e+00f,
-    1.860316277e+00f,
-    1.524281025e+00f,
-    1.571251273e+00f,
-    9.272084236e-01f,
-    1.317961454e+00f,
-    7.363093495e-01f,
-    8.153530359e-01f,
-    1.034267902e+00f,
-    1.506239057e+00f,
-    1.330541372e+00f,
-    9.258140922e-01f,
-    9.310345054e-01f,
-    6.238005757e-01f,
-    6.270387173e-01f,
-    8.407714963e-01f,
-    1.833737969e+00f,
-    9.421648383e-01f,
-    4.656662345e-01f,
-    8.878971338e-01f,
-    7.841977477e-01f,
-    2.645537853e+00f,
-    1.074737549e+00f,
-    9.673084021e-01f,
-    1.259638906e+00f,
-    9.228734374e-01f,
-    1.342001915e+00f,
-    5.154773593e-01f,
-    1.131632447e+00f,
-    5.814362764e-01f,
-    4.538505077e-01f,
-    8.927060366e-01f,
-    8.923577666e-01f,
-    9.859603047e-01f,
-    1.548979640e+00f,
-    1.347348094e+00f,
-    1.013733387e+00f,
-    1.834681153e+00f,
-    1.737259150e+00f,
-    1.336040378e+00f,
-    1.387091756e+00f,
-    1.047398806e+00f,
-    7.744015455e-01f,
-    6.113520861e-01f,
-    1.905484319e+00f,
-    7.183517814e-01f,
-    5.390732288e-01f,
-    7.246236801e-01f,
-    1.067636609e+00f,
-    1.687117815e+00f,
-    7.215190530e-01f,
-    1.280131459e+00f,
-    1.067551017e+00f,
-    1.015649557e+00f,
-    1.941000104e+00f,
-    5.688478947e-01f,
-    1.181443453e+00f,
-    1.835975885e+00f,
-    9.372808933e-01f,
-    1.436761498e+00f,
-    1.243992686e+00f,
-    1.174863815e+00f,
-    8.400426507e-01f,
-    1.517723799e+00f,
-    1.050694108e+00f,
-    7.210215330e-01f,
-    1.175969720e+00f,
-    1.277304411e+00f,
-    1.655024290e+00f,
-    1.571513534e+00f,
-    9.799340367e-01f,
-    1.817831397e+00f,
-    1.906311989e+00f,
-    5.672121644e-01f,
-    5.523830652e-01f,
-    6.826081276e-01f,
-    9.306590557e-01f,
-    7.446735501e-01f,
-    1.226505637e+00f,
-    4.996905923e-01f,
-    7.152702212e-01f,
-    2.115383625e+00f,
-    8.370569944e-01f,
-    6.739388704e-01f,
-    8.363901973e-01f,
-    7.255413532e-01f,
-    1.118796349e+00f,
-    1.157275319e+00f,
-    1.828727961e+00f,
-    1.357939839e+00f,
-    1.109533072e+00f,
-    1.370139956e+00f,
-    7.232425213e-01f,
-    1.086205840e+00f,
-    1.239023447e+00f,
-    1.490905881e+00f,
-    1.054933429e+00f,
-    2.587346792e+00f,
-    1.449055672e+00f,
-    9.798030257e-01f,
-    1.234584808e+00f,
-    8.169162273e-01f,
-    9.389650822e-01f,
-    1.318465829e+00f,
-    1.323599815e+00f,
-    1.064553022e+00f,
-    1.495971441e+00f,
-    1.533456326e+00f,
-    5.874614120e-01f,
-    1.113336325e+00f,
-    1.339003801e+00f,
-    9.314311743e-01f,
-    9.422268271e-01f,
-    1.569058657e+00f,
-    7.833636999e-01f,
-    9.630308151e-01f,
-    5.781778693e-01f,
-    7.090289593e-01f,
-    1.134659410e+00f,
-    1.085444331e+00f,
-    1.057547450e+00f,
-    8.539408445e-01f,
-    6.454341412e-01f,
-    1.139282942e+00f,
-    7.196763754e-01f,
-    1.470509410e+00f,
-    8.337564468e-01f,
-    1.061937809e+00f,
-    2.166647911e+00f,
-    1.489861727e+00f,
-    1.308599591e+00f,
-    6.582242846e-01f,
-    7.349748611e-01f,
-    1.720420361e+00f,
-    6.459966898e-01f,
-    8.894326091e-01f,
-    6.982042193e-01f,
-    1.214065671e+00f,
-    1.382859826e+00f,
-    1.008557677e+00f,
-    8.466776609e-01f,
-    4.227158725e-01f,
-    8.050773740e-01f,
-    1.059783697e+00f,
-    1.232166409e+00f,
-    6.987468600e-01f,
-    1.072461009e-01f,
-    1.257205963e+00f,
-    1.045982003e+00f,
-    4.610117972e-01f,
-    8.324391842e-01f,
-    1.539749861e+00f,
-    1.189619422e+00f,
-    1.578299999e+00f,
-    8.147603273e-01f,
-    9.107443094e-01f,
-    5.918334723e-01f,
-    8.066326380e-01f,
-    8.318228126e-01f,
-    7.128747106e-01f,
-    1.986331701e+00f,
-    8.417522311e-01f,
-    1.093762755e+00f,
-    2.273175001e+00f,
-    9.049500227e-01f,
-    9.843320251e-01f,
-    7.777979374e-01f,
-    9.892976284e-01f,
-    8.311872482e-01f,
-    1.060405493e+00f,
-    1.250079989e+00f,
-    2.180876017e+00f,
-    9.032565951e-01f,
-    1.481001854e+00f,
-    5.678343773e-01f,
-    1.149292946e+00f,
-    1.792524338e+00f,
-    8.160892129e-01f,
-    1.534275651e+00f,
-    9.485679865e-01f,
-    1.527749896e+00f,
-    6.878855824e-01f,
-    6.112393141e-01f,
-    4.596747756e-01f,
-    2.874884903e-01f,
-    9.980027080e-01f,
-    6.450008750e-01f,
-    1.319066763e+00f,
-    8.564269543e-01f,
-    1.729372978e+00f,
-    6.819630861e-01f,
-    6.161684990e-01f,
-    1.482276201e+00f,
-    6.233685017e-01f,
-    6.573143601e-01f,
-    8.121829033e-01f,
-    1.113844633e+00f,
-    6.207280159e-01f,
-    1.251194119e+00f,
-    1.311106205e+00f,
-    1.462020040e+00f,
-    7.367705107e-01f,
-    9.321517348e-01f,
-    2.101797819e+00f,
-    1.546155810e+00f,
-    1.004851222e+00f,
-    1.160605669e+00f,
-    6.925575733e-01f,
-    8.048867583e-01f,
-    1.374145746e+00f,
-    1.541727066e+00f,
-    1.419192076e+00f,
-    9.592652321e-01f,
-    1.000026107e+00f,
-    1.353287458e+00f,
-    5.829262733e-01f,
-    5.285526514e-01f,
-    1.093602061e+00f,
-    6.311889887e-01f,
-    1.202395439e+00f,
-    1.494975805e+00f,
-    2.585295439e+00f,
-    2.435726643e+00f,
-    1.148063898e+00f,
-    1.056356549e+00f,
-    6.768495440e-01f,
-    5.835926533e-01f,
-    1.093939066e+00f,
-    1.299616933e+00f,
-    1.041993260e+00f,
-    7.159180045e-01f,
-    6.288868785e-01f,
-    1.494353414e+00f,
-    9.663039446e-01f,
-    1.387507081e+00f,
-    1.080957890e+00f,
-    8.061228991e-01f,
-    1.078580856e+00f,
-    8.119084835e-01f,
-    1.578783035e+00f,
-    2.066561222e+00f,
-    1.208512068e+00f,
-    8.333790302e-01f,
-    9.105594754e-01f,
-    1.661606073e+00f,
-    7.968381047e-01f,
-    1.893036842e+00f,
-    1.299171090e+00f,
-    6.845015883e-01f,
-    7.443206906e-01f,
-    1.121733785e+00f,
-    1.108044624e+00f,
-    1.329000473e+00f,
-    1.035220027e+00f,
-    1.000760198e+00f,
-    4.732273519e-01f,
-    1.528033137e+00f,
-    1.058060884e+00f,
-    8.156739473e-01f,
-    8.244026899e-01f,
-    1.207064867e+00f,
-    1.013956189e+00f,
-    3.836806715e-01f,
-    5.452839136e-01f,
-    1.594137788e+00f,
-    8.415432572e-01f,
-    6.056611538e-01f,
-    1.113582015e+00f,
-    6.940661073e-01f,
-    1.217351437e+00f,
-    3.904461861e-01f,
-    1.552493215e+00f,
-    1.868024945e+00f,
-    1.070172548e+00f,
-    1.067262292e+00f,
-    1.307391763e+00f,
-    5.162279606e-01f,
-    9.188047647e-01f,
-    1.518996239e+00f,
-    3.738122880e-01f,
-    1.087079406e+00f,
-    1.059081197e+00f,
-    7.249079943e-01f,
-    7.588301301e-01f,
-    1.717266560e+00f,
-    1.373446703e+00f,
-    1.207671046e+00f,
-    2.291736603e+00f,
-    5.081778169e-01f,
-    2.902035713e-01f,
-    6.994842887e-01f,
-    5.887892842e-01f,
-    2.105631351e+00f,
-    1.182401061e+00f,
-    7.397413850e-01f,
-    7.990644574e-01f,
-    9.111359119e-01f,
-    1.153798938e+00f,
-    6.779727340e-01f,
-    9.127285480e-01f,
-    1.143962979e+00f,
-    8.665809035e-01f,
-    6.679822206e-01f,
-    2.641185045e+00f,
-    1.627606750e+00f,
-    8.797217607e-01f,
-    9.051213264e-01f,
-    9.740158916e-01f,
-    5.896038413e-01f,
-    1.585179210e+00f,
-    1.413301826e+00f,
-    1.362733364e+00f,
-    1.123327851e+00f,
-    1.258820295e+00f,
-    1.640082002e+00f,
-    9.346426129e-01f,
-    1.972026706e+00f,
-    7.486898899e-01f,
-    1.203537345e+00f,
-    1.257335544e+00f,
-    8.768684268e-01f,
-    9.834520221e-01f,
-    9.532943964e-01f,
-    5.188925266e-01f,
-    1.471409440e+00f,
-    7.125009894e-01f,
-    5.481298566e-01f,
-    7.927902341e-01f,
-    8.740850687e-01f,
-    8.990398049e-01f,
-    6.245132685e-01f,
-    1.249493837e+00f,
-    8.366581798e-01f,
-    1.307837248e+00f,
-    2.310335159e+00f,
-    6.662810445e-01f,
-    1.595742464e+00f,
-    1.018339276e+00f,
-    9.780069590e-01f,
-    1.350794315e+00f,
-    1.059283733e+00f,
-    7.953705192e-01f,
-    1.136142731e+00f,
-    2.404782534e+00f,
-    1.114530683e+00f,
-    9.256721735e-01f,
-    5.566299558e-01f,
-    2.099835873e+00f,
-    5.143372416e-01f,
-    1.384659290e+00f,
-    7.050685883e-01f,
-    9.287662506e-01f,
-    3.044273853e+00f,
-    1.849808931e+00f,
-    1.593672395e+00f,
-    7.569650412e-01f,
-    7.421004176e-01f,
-    3.013657331e+00f,
-    6.045287848e-01f,
-    2.003545761e+00f,
-    7.260176539e-01f,
-    1.470076680e+00f,
-    8.832388520e-01f,
-    7.161920667e-01f,
-    1.115588784e+00f,
-    8.144621253e-01f,
-    6.751906872e-01f,
-    8.414792418e-01f,
-    5.968710184e-01f,
-    5.539262891e-01f,
-    1.158660412e+00f,
-    1.065101504e+00f,
-    1.072698951e+00f,
-    9.629611373e-01f,
-    1.119238496e+00f,
-    7.717276812e-01f,
-    5.432715416e-01f,
-    9.340554476e-01f,
-    6.598578095e-01f,
-    5.394937992e-01f,
-    1.718972683e+00f,
-    1.089529753e+00f,
-    3.644152284e-01f,
-    8.016925454e-01f,
-    1.153631449e+00f,
-    9.255351424e-01f,
-    9.061467648e-01f,
-    1.340182662e+00f,
-    1.059479117e+00f,
-    8.404834867e-01f,
-    1.078913093e+00f,
-    1.351019502e+00f,
-    1.153174758e+00f,
-    1.071034312e+00f,
-    1.026626229e+00f,
-    1.143339276e+00f,
-    9.892057776e-01f,
-    9.912469387e-01f,
-    9.018322229e-01f,
-    8.477794528e-01f,
-    1.453680038e+00f,
-    2.193445921e+00f,
-    1.395447612e+00f,
-    9.499091506e-01f,
-    1.144513130e+00f,
-    6.593517661e-01f,
-    1.378322601e+00f,
-    2.230637074e+00f,
-    1.107397318e+00f,
-    7.162862420e-01f,
-    1.102051139e+00f,
-    1.500992894e+00f,
-    1.314507008e+00f,
-    1.246197939e+00f,
-    1.113277674e+00f,
-    1.051120996e+00f,
-    1.308615327e+00f,
-    6.253608465e-01f,
-    8.318213224e-01f,
-    9.920058846e-01f,
-    1.149865150e+00f,
-    5.715303421e-01f,
-    1.256897449e+00f,
-    1.541792035e+00f,
-    1.370046020e+00f,
-    9.139359593e-01f,
-    6.253406405e-01f,
-    8.327386379e-01f,
-    8.878685236e-01f,
-    6.764377952e-01f,
-    1.347438931e+00f,
-    1.365496039e+00f,
-    9.725847840e-01f,
-    1.002261758e+00f,
-    2.083648205e+00f,
-    7.129376531e-01f,
-    1.221816540e+00f,
-    1.948152304e+00f,
-    8.369942307e-01f,
-    1.185782790e+00f,
-    9.327411056e-01f,
-    7.353160977e-01f,
-    1.198273420e+00f,
-    1.170139074e+00f,
-    6.834427118e-01f,
-    5.196594000e-01f,
-    7.829297185e-01f,
-    6.657938957e-01f,
-    1.013446093e+00f,
-    1.161749482e+00f,
-    9.123308063e-01f,
-    1.482527494e+00f,
-    2.054673195e+00f,
-    5.479984283e-01f,
-    6.962200403e-01f,
-    3.088743448e+00f,
-    8.434946537e-01f,
-    7.776901126e-01f,
-    1.214607954e+00f,
-    8.095728159e-01f,
-    8.020742536e-01f,
-    1.222556591e+00f,
-    9.218531251e-01f,
-    9.236973524e-01f,
-    1.133450389e+00f,
-    9.585887790e-01f,
-    9.353300929e-01f,
-    1.749503136e+00f,
-    1.895894051e+00f,
-    1.209869623e+00f,
-    1.054308176e+00f,
-    6.467748880e-01f,
-    6.973550916e-01f,
-    4.628367126e-01f,
-    1.117106676e+00f,
-    5.650824308e-01f,
-    1.163466334e+00f,
-    1.784287453e+00f,
-    2.046758652e+00f,
-    2.110644341e+00f,
-    9.665447474e-01f,
-    1.094978213e+00f,
-    1.286273003e+00f,
-    1.086152911e+00f,
-    1.045029640e+00f,
-    8.107718229e-01f,
-    6.472665071e-01f,
-    1.341323376e+00f,
-    9.731361270e-01f,
-    1.416707754e+00f,
-    1.254754663e+00f,
-    1.395765781e+00f,
-    2.488565922e+00f,
-    1.268384933e+00f,
-    1.670036077e+00f,
-    5.111817718e-01f,
-    1.242436886e+00f,
-    2.351132870e+00f,
-    8.767113686e-01f,
-    7.854064107e-01f,
-    1.381643295e+00f,
-    1.236454248e+00f,
-    1.057262897e+00f,
-    7.535232306e-01f,
-    1.199552059e+00f,
-    1.136409283e+00f,
-    6.158178449e-01f,
-    9.755854011e-01f,
-    7.822514772e-01f,
-    1.153151393e+00f,
-    7.395042181e-01f,
-    8.751246333e-01f,
-    7.942311168e-01f,
-    8.504384756e-01f,
-    5.545348525e-01f,
-    5.424346924e-01f,
-    6.901112199e-01f,
-    7.321705222e-01f,
-    9.502907395e-01f,
-    5.649702549e-01f,
-    7.870356441e-01f,
-    7.067090273e-01f,
-    1.076967955e+00f,
-    8.234538436e-01f,
-    7.495767474e-01f,
-    6.846764684e-01f,
-    1.131447315e+00f,
-    1.360593200e+00f,
-    5.905278921e-01f,
-    4.882928729e-01f,
-    5.257565379e-01f,
-    2.069981575e+00f,
-    9.431070089e-01f,
-    8.857374191e-01f,
-    7.091309428e-01f,
-    7.194115520e-01f,
-    8.725288510e-01f,
-    1.369586110e+00f,
-    9.220639467e-01f,
-    9.507696629e-01f,
-    4.512524903e-01f,
-    3.798228204e-01f,
-    1.232992768e+00f,
-    6.184176803e-01f,
-    7.961046100e-01f,
-    8.930085301e-01f,
-    8.167887330e-01f,
-    1.516198039e+00f,
-    9.789343476e-01f,
-    8.414466381e-01f,
-    1.030815840e+00f,
-    8.583449721e-01f,
-    1.397667408e+00f,
-    9.008817673e-01f,
-    1.801940322e+00f,
-    1.122324586e+00f,
-    1.691259027e+00f,
-    1.372138262e+00f,
-    1.337269783e+00f,
-    9.114102721e-01f,
-    1.358214974e+00f,
-    1.112429142e+00f,
-    5.234049559e-01f,
-    9.512725472e-01f,
-    9.767252803e-01f,
-    1.474498868e+00f,
-    7.545577288e-01f,
-    2.004170418e+00f,
-    9.877256751e-01f,
-    2.043605089e+00f,
-    8.250014186e-01f,
-    3.373028934e-01f,
-    1.643520594e+00f,
-    6.259467602e-01f,
-    2.207271576e+00f,
-    7.127544284e-01f,
-    1.331136584e+00f,
-    1.086294651e+00f,
-    8.461138606e-01f,
-    1.229173899e+00f,
-    7.181854844e-01f,
-    1.447912574e+00f,
-    8.072108030e-01f,
-    9.410744905e-01f,
-    9.920179248e-01f,
-    8.625190258e-01f,
-    8.973567486e-01f,
-    1.972976446e+00f,
-    1.315503240e+00f,
-    1.042060733e+00f,
-    8.163475394e-01f,
-    1.121971846e+00f,
-    1.324967742e+00f,
-    9.448642135e-01f,
-    1.277262330e+00f,
-    1.911651731e+00f,
-    1.004870415e+00f,
-    8.539460897e-01f,
-    9.055960178e-01f,
-    1.513737440e+00f,
-    8.135579824e-01f,
-    1.138946533e+00f,
-    1.040952444e+00f,
-    7.482516766e-01f,
-    1.043779850e+00f,
-    8.277307153e-01f,
-    1.162099361e+00f,
-    2.151553392e+00f,
-    1.127954960e+00f,
-    2.335729361e+00f,
-    1.102232933e+00f,
-    8.409639001e-01f,
-    9.917104840e-01f,
-    4.865261912e-01f,
-    1.140495062e+00f,
-    6.618098021e-01f,
-    1.118175626e+00f,
-    1.146488786e+00f,
-    1.206862330e+00f,
-    1.708518863e+00f,
-    1.120748997e+00f,
-    1.205992937e+00f,
-    1.359805584e+00f,
-    1.360902190e+00f,
-    8.654325008e-01f,
-    8.946303129e-01f,
-    6.296105981e-01f,
-    9.868171215e-01f,
-    7.627637982e-01f,
-    2.245918274e+00f,
-    1.147792816e+00f,
-    8.587576151e-01f,
-    2.207276344e+00f,
-    6.170186996e-01f,
-    5.226802230e-01f,
-    4.409510493e-01f,
-    1.323671699e+00f,
-    1.323592544e+00f,
-    1.949355245e+00f,
-    5.977561474e-01f,
-    9.477286339e-01f,
-    1.428296208e+00f,
-    9.719144106e-01f,
-    1.145627141e+00f,
-    7.179019451e-01f,
-    5.202093720e-01f,
-    1.066529512e+00f,
-    1.003001451e+00f,
-    1.556358814e+00f,
-    7.875678539e-01f,
-    7.917496562e-01f,
-    9.610300660e-01f,
-    1.890491843e+00f,
-    1.070164442e+00f,
-    1.817347646e+00f,
-    1.215996146e+00f,
-    1.242862225e+00f,
-    9.156062603e-01f,
-    1.278960705e+00f,
-    1.338181138e+00f,
-    9.358128905e-01f,
-    1.206116199e+00f,
-    8.523867130e-01f,
-    1.228475809e+00f,
-    1.005387425e+00f,
-    4.108577073e-01f,
-    8.083308339e-01f,
-    1.222139239e+00f,
-    5.323408842e-01f,
-    6.170014143e-01f,
-    5.310288668e-01f,
-    8.316618800e-01f,
-    9.209858775e-01f,
-    1.036465406e+00f,
-    1.153227568e+00f,
-    1.010346293e+00f,
-    8.028118610e-01f,
-    8.831812143e-01f,
-    1.449440360e+00f,
-    5.810862780e-01f,
-    1.468837023e+00f,
-    1.212527275e+00f,
-    1.010254502e+00f,
-    7.433653474e-01f,
-    1.182536006e+00f,
-    4.434017539e-01f,
-    7.491552830e-01f,
-    4.899382889e-01f,
-    1.173890352e+00f,
-    8.206921220e-01f,
-    7.526988387e-01f,
-    1.180335879e+00f,
-    7.339014411e-01f,
-    1.071917772e+00f,
-    5.718222260e-01f,
-    4.460892677e-01f,
-    1.153134346e+00f,
-    8.081902862e-01f,
-    6.050904989e-01f,
-    8.363425732e-01f,
-    1.342401981e+00f,
-    8.513869047e-01f,
-    1.522965193e+00f,
-    3.272613585e-01f,
-    3.802145720e-01f,
-    1.013718724e+00f,
-    7.919565439e-01f,
-    5.280029178e-01f,
-    7.170114517e-01f,
-    7.524238229e-01f,
-    6.285806894e-01f,
-    7.927338481e-01f,
-    8.011751175e-01f,
-    8.189781308e-01f,
-    4.116322398e-01f,
-    1.718903184e+00f,
-    1.133497953e+00f,
-    1.602692485e+00f,
-    5.482392907e-01f,
-    7.292438149e-01f,
-    1.272610188e+00f,
-    8.607735634e-01f,
-    8.993546963e-01f,
-    4.721039236e-01f,
-    9.701184630e-01f,
-    6.844813824e-01f,
-    9.922164083e-01f,
-    2.422278404e+00f,
-    1.456702948e+00f,
-    1.382135868e+00f,
-    1.132519484e+00f,
-    1.777401686e+00f,
-    8.175897002e-01f,
-    5.158874393e-01f,
-    9.082852006e-01f,
-    9.126270413e-01f,
-    1.165519476e+00f,
-    9.426513314e-01f,
-    2.042013645e+00f,
-    1.515407920e+00f,
-    9.135577083e-01f,
-    6.185261607e-01f,
-    8.316381574e-01f,
-    2.400013924e+00f,
-    7.691608667e-01f,
-    1.391169310e+00f,
-    2.029740572e+00f,
-    1.483917594e+00f,
-    8.107178211e-01f,
-    1.068489790e+00f,
-    8.778616190e-01f,
-    9.212015867e-01f,
-    6.521709561e-01f,
-    5.133988261e-01f,
-    1.295077085e+00f,
-    8.202410340e-01f,
-    6.689848900e-01f,
-    1.660077095e+00f,
-    1.358192325e+00f,
-    4.185639024e-01f,
-    1.256952405e+00f,
-    4.078179300e-01f,
-    2.157747984e+00f,
-    1.042621374e+00f,
-    9.555218220e-01f,
-    7.303473353e-01f,
-    9.250726700e-01f,
-    9.373179078e-01f,
-    9.117842317e-01f,
-    6.664444804e-01f,
-    7.411342859e-01f,
-    4.687090516e-01f,
-    9.014980793e-01f,
-    7.454958558e-01f,
-    9.522119761e-01f,
-    1.078089833e+00f,
-    1.653759480e+00f,
-    1.404823661e+00f,
-    1.091057658e+00f,
-    6.412903666e-01f,
-    7.700506449e-01f,
-    4.667426050e-01f,
-    1.343507171e+00f,
-    1.054237008e+00f,
-    1.283855081e+00f,
-    1.235307455e+00f,
-    1.088983536e+00f,
-    7.130409479e-01f,
-    1.118828297e+00f,
-    9.834474325e-01f,
-    8.414621949e-01f,
-    1.074183226e+00f,
-    1.253281355e+00f,
-    6.266286373e-01f,
-    1.116473556e+00f,
-    3.296168804e+00f,
-    9.075421691e-01f,
-    2.514718294e+00f,
-    1.389569759e+00f,
-    1.555382013e+00f,
-    5.979399681e-01f,
-    9.569823146e-01f,
-    9.697117209e-01f,
-    7.786659002e-01f,
-    8.991371989e-01f,
-    1.331297636e+00f,
-    8.282934427e-01f,
-    8.142948151e-01f,
-    1.495873094e+00f,
-    9.774466753e-01f,
-    1.625653148e+00f,
-    1.001923680e+00f,
-    1.030492187e+00f,
-    1.191321731e+00f,
-    6.550119519e-01f,
-    1.542164207e+00f,
-    1.363008380e+00f,
-    1.235340714e+00f,
-    1.074697495e+00f,
-    1.225207210e+00f,
-    1.047103882e+00f,
-    1.206995010e+00f,
-    2.419432878e+00f,
-    7.701982856e-01f,
-    7.732740641e-01f,
-    9.011902809e-01f,
-    1.509325981e+00f,
-    9.755747914e-01f,
-    1.220505238e+00f,
-    5.250795484e-01f,
-    1.673447609e+00f,
-    1.311380744e+00f,
-    1.299778581e+00f,
-    1.118566394e+00f,
-    1.343419909e+00f,
-    4.911848009e-01f,
-    9.671203494e-01f,
-    1.010646701e+00f,
-    9.847476482e-01f,
-    1.732562780e+00f,
-    1.432454467e+00f,
-    2.137237072e+00f,
-    8.024898171e-01f,
-    5.627511740e-01f,
-    7.607702017e-01f,
-    1.140506625e+00f,
-    1.078621745e+00f,
-    1.243397713e+00f,
-    1.135995388e+00f,
-    8.313924670e-01f,
-    8.569078445e-01f,
-    9.809551835e-01f,
-    9.306743145e-01f,
-    1.224065900e+00f,
-    1.086429358e+00f,
-    1.185561538e+00f,
-    6.546966434e-01f,
-    6.967518330e-01f,
-    7.360763550e-01f,
-    6.998485327e-01f,
-    8.075953722e-01f,
-    9.064226747e-01f,
-    1.869433761e+00f,
-    1.108750820e+00f,
-    1.992180109e+00f,
-    6.553214788e-01f,
-    1.218806267e+00f,
-    1.033789396e+00f,
-    1.603422642e+00f,
-    1.695846558e+00f,
-    1.371165395e+00f,
-    1.277003884e+00f,
-    1.204188585e+00f,
-    7.534508705e-01f,
-    9.514415860e-01f,
-    8.371115923e-01f,
-    5.037203431e-01f,
-    6.562747955e-01f,
-    1.100340962e+00f,
-    7.189338803e-01f,
-    1.093610287e+00f,
-    5.200446248e-01f,
-    1.017737985e+00f,
-    7.666032314e-01f,
-    6.753006577e-01f,
-    4.993142486e-01f,
-    8.600474596e-01f,
-    5.514585972e-01f,
-    1.333274961e+00f,
-    1.174904943e+00f,
-    7.940568924e-01f,
-    6.867653728e-01f,
-    4.141743481e-01f,
-    8.867126703e-01f,
-    5.273959637e-01f,
-    1.359664440e+00f,
-    6.545858383e-01f,
-    1.310230970e+00f,
-    8.712298870e-01f,
-    9.224652648e-01f,
-    1.518536687e+00f,
-    7.133769393e-01f,
-    1.254641175e+00f,
-    1.071714997e+00f,
-    9.813593626e-01f,
-    6.615540385e-01f,
-    1.374863982e+00f,
-    1.190962076e+00f,
-    1.269132495e+00f,
-    5.849694014e-01f,
-    1.614573836e+00f,
-    1.778196096e+00f,
-    8.205191493e-01f,
-    1.355896592e+00f,
-    1.692043543e+00f,
-    8.543767333e-01f,
-    1.182763219e+00f,
-    7.718060017e-01f,
-    5.052962899e-01f,
-    5.353155732e-01f,
-    1.522977352e+00f,
-    8.742327690e-01f,
-    2.807216883e+00f,
-    7.651594281e-01f,
-    1.086310506e+00f,
-    7.939307094e-01f,
-    4.725914001e-01f,
-    6.611869931e-01f,
-    5.962453485e-01f,
-    7.644776106e-01f,
-    8.044468164e-01f,
-    1.417927265e+00f,
-    1.651240587e+00f,
-    6.331785321e-01f,
-    1.569544911e+00f,
-    1.562589169e+00f,
-    1.560596824e+00f,
-    8.417986035e-01f,
-    1.480119705e+00f,
-    1.023491979e+00f,
-    1.471417904e+00f,
-    1.089427590e+00f,
-    8.878198862e-01f,
-    8.355510831e-01f,
-    1.163089752e+00f,
-    6.756535172e-01f,
-    7.329335213e-01f,
-    7.619737983e-01f,
-    1.233476639e+00f,
-    1.245275855e+00f,
-    1.590209603e+00f,
-    8.201525807e-01f,
-    1.587862492e+00f,
-    1.566985726e+00f,
-    1.066675305e+00f,
-    9.351098537e-01f,
-    6.361305714e-01f,
-    2.057246447e+00f,
-    1.627429605e+00f,
-    5.262958407e-01f,
-    8.718213439e-01f,
-    8.126863241e-01f,
-    9.750088453e-01f,
-    1.626332283e+00f,
-    1.058333516e+00f,
-    9.387379885e-01f,
-    6.191275716e-01f,
-    9.356208444e-01f,
-    9.814657569e-01f,
-    1.376773596e+00f,
-    8.223140836e-01f,
-    9.971358180e-01f,
-    9.390276074e-01f,
-    1.157515049e+00f,
-    1.255318999e+00f,
-    4.951696992e-01f,
-    7.743406296e-01f,
-    1.095734239e+00f,
-    7.797631025e-01f,
-    8.855088949e-01f,
-    5.737379193e-01f,
-    7.340393662e-01f,
-    8.684633970e-01f,
-    1.401744246e+00f,
-    8.993668556e-01f,
-    9.475539327e-01f,
-    8.610782027e-01f,
-    1.372362852e+00f,
-    1.452510118e+00f,
-    1.860006094e+00f,
-    1.701970458e+00f,
-    1.021363378e+00f,
-    2.172904968e+00f,
-    1.035191655e+00f,
-    6.361619830e-01f,
-    1.290292263e+00f,
-    4.199989438e-01f,
-    1.058702588e+00f,
-    3.587284386e-01f,
-    6.809238791e-01f,
-    1.485211730e+00f,
-    2.590569973e+00f,
-    1.210718513e+00f,
-    1.802994728e+00f,
-    7.586681843e-01f,
-    7.597699761e-01f,
-    9.672613144e-01f,
-    4.768958390e-01f,
-    9.782716036e-01f,
-    5.459401608e-01f,
-    8.809594512e-01f,
-    9.652490616e-01f,
-    5.510822535e-01f,
-    5.846644640e-01f,
-    1.888343334e+00f,
-    8.555696607e-01f,
-    1.179729700e+00f,
-    7.558950782e-01f,
-    5.608232617e-01f,
-    3.763661087e-01f,
-    4.885469377e-01f,
-    2.087435484e+00f,
-    1.087645292e+00f,
-    9.607435465e-01f,
-    2.813707829e+00f,
-    1.196836472e+00f,
-    9.778558612e-01f,
-    1.368066549e+00f,
-    7.912044525e-01f,
-    1.165389180e+00f,
-    8.016508222e-01f,
-    6.868782640e-01f,
-    3.963052332e-01f,
-    1.032890916e+00f,
-    4.941692054e-01f,
-    7.786360979e-01f,
-    1.181368113e+00f,
-    8.197251558e-01f,
-    9.290466905e-01f,
-    8.454145789e-01f,
-    1.148433566e+00f,
-    5.528175831e-01f,
-    2.105671167e+00f,
-    1.979265571e+00f,
-    6.312367916e-01f,
-    1.079730034e+00f,
-    7.437931299e-01f,
-    1.323395371e+00f,
-    5.950113535e-01f,
-    1.172607422e+00f,
-    7.822772861e-01f,
-    1.092155457e+00f,
-    1.036594987e+00f,
-    1.035853505e+00f,
-    1.033821106e+00f,
-    1.066030264e+00f,
-    7.093203068e-01f,
-    1.417058706e+00f,
-    1.568780303e+00f,
-    6.168883443e-01f,
-    1.297265649e+00f,
-    2.171607971e+00f,
-    1.357879877e+00f,
-    7.594054937e-01f,
-    8.569708467e-01f,
-    1.618075013e+00f,
-    1.383655667e+00f,
-    1.797172666e+00f,
-    6.569542885e-01f,
-    1.981858730e+00f,
-    8.214567304e-01f,
-    8.925837278e-01f,
-    9.721559286e-01f,
-    7.481286526e-01f,
-    8.573780656e-01f,
-    6.919493675e-01f,
-    1.125280857e+00f,
-    6.561968327e-01f,
-    1.272564530e+00f,
-    1.101321220e+00f,
-    8.418880105e-01f,
-    8.874102235e-01f,
-    1.083761811e+00f,
-    8.140100241e-01f,
-    1.312432647e+00f,
-    5.582274199e-01f,
-    2.084211588e+00f,
-    8.090273738e-01f,
-    1.252929211e+00f,
-    4.084546864e-01f,
-    1.159349203e+00f,
-    9.418170452e-01f,
-    6.943109632e-01f,
-    1.415522814e+00f,
-    1.519289494e+00f,
-    7.438665628e-01f,
-    5.194196105e-01f,
-    6.605398059e-01f,
-    9.255182743e-01f,
-    9.551857114e-01f,
-    5.300282240e-01f,
-    1.075194478e+00f,
-    5.564683080e-01f,
-    1.589534163e+00f,
-    9.998757243e-01f,
-    4.167698622e-01f,
-    1.468440890e+00f,
-    6.670331955e-01f,
-    1.175562263e+00f,
-    7.585846782e-01f,
-    1.587159038e+00f,
-    1.222987294e+00f,
-    9.772149920e-01f,
-    1.515592694e+00f,
-    2.532278061e+00f,
-    9.795122147e-01f,
-    1.101242781e+00f,
-    1.408113956e+00f,
-    1.234496117e+00f,
-    1.409243941e+00f,
-    4.325890839e-01f,
-    1.483389497e+00f,
-    1.198583007e+00f,
-    1.082823396e+00f,
-    7.470767498e-01f,
-    1.354786038e+00f,
-    6.341882348e-01f,
-    1.070489168e+00f,
-    6.612865329e-01f,
-    9.324458838e-01f,
-    9.590850472e-01f,
-    6.365997791e-01f,
-    2.094083071e+00f,
-    1.689711571e+00f,
-    9.675250649e-01f,
-    7.047542930e-01f,
-    7.267825603e-01f,
-    1.913652301e+00f,
-    7.781443000e-01f,
-    9.624561667e-01f,
-    9.579493403e-01f,
-    4.926395416e-01f,
-    9.723160863e-01f,
-    6.968459487e-01f,
-    1.368368030e+00f,
-    2.018358707e+00f,
-    6.152554154e-01f,
-    6.398462057e-01f,
-    1.243884325e+00f,
-    1.169706702e+00f,
-    2.121149778e+00f,
-    1.038541317e+00f,
-    1.207207680e+00f,
-    6.134941578e-01f,
-    5.337553620e-01f,
-    8.223643899e-01f,
-    1.163421869e+00f,
-    6.424113512e-01f,
-    8.898594379e-01f,
-    1.806813002e+00f,
-    1.048977017e+00f,
-    2.644490957e+00f,
-    4.731938243e-01f,
-    8.718670011e-01f,
-    1.308728337e+00f,
-    1.284610033e+00f,
-    1.182714224e+00f,
-    1.365156293e+00f,
-    1.441309810e+00f,
-    7.823264599e-01f,
-    1.355758786e+00f,
-    1.935001612e+00f,
-    1.244760394e+00f,
-    8.043581843e-01f,
-    8.724633455e-01f,
-    1.305609941e+00f,
-    9.483807087e-01f,
-    6.714470387e-01f,
-    8.261110783e-01f,
-    1.122259259e+00f,
-    1.410409808e+00f,
-    5.947592258e-01f,
-    1.480263710e+00f,
-    9.006376266e-01f,
-    6.552134156e-01f,
-    6.699683070e-01f,
-    1.790215254e+00f,
-    1.258884311e+00f,
-    7.563454509e-01f,
-    1.007382393e+00f,
-    1.228120089e+00f,
-    1.693340659e+00f,
-    9.420316815e-01f,
-    7.916644812e-01f,
-    7.565917969e-01f,
-    1.054693341e+00f,
-    8.625447154e-01f,
-    1.238883018e+00f,
-    6.787993908e-01f,
-    8.620916605e-01f,
-    7.376409173e-01f,
-    1.113425732e+00f,
-    1.371729851e+00f,
-    1.558146834e+00f,
-    1.605370760e+00f,
-    1.362499118e+00f,
-    1.688199639e+00f,
-    1.200666547e+00f,
-    1.211291671e+00f,
-    8.621055484e-01f,
-    4.484830797e-01f,
-    6.395259500e-01f,
-    6.440629959e-01f,
-    1.483486414e+00f,
-    8.823156357e-01f,
-    1.190958977e+00f,
-    1.075297475e+00f,
-    7.069565058e-01f,
-    9.199379086e-01f,
-    1.125579596e+00f,
-    1.336657882e+00f,
-    1.275792956e+00f,
-    1.338145614e+00f,
-    1.766027093e+00f,
-    1.172521353e+00f,
-    1.056675076e+00f,
-    1.004774928e+00f,
-    1.867925644e+00f,
-    5.552316308e-01f,
-    1.350564837e+00f,
-    2.345736504e+00f,
-    1.869737506e+00f,
-    1.449405074e+00f,
-    5.479997993e-01f,
-    1.197973490e+00f,
-    1.301282883e+00f,
-    1.621726394e+00f,
-    1.308324933e+00f,
-    1.574266672e+00f,
-    6.853716373e-01f,
-    8.454372287e-01f,
-    5.788607001e-01f,
-    2.449992180e+00f,
-    1.206779480e+00f,
-    7.550793886e-01f,
-    1.295873284e+00f,
-    1.133053541e+00f,
-    1.127654433e+00f,
-    1.394950271e+00f,
-    1.241579890e+00f,
-    6.865463853e-01f,
-    8.218312263e-01f,
-    8.225718737e-01f,
-    1.747057676e+00f,
-    1.339923263e+00f,
-    8.655681610e-01f,
-    1.001991272e+00f,
-    1.048858047e+00f,
-    8.236280680e-01f,
-    5.153916478e-01f,
-    6.980750561e-01f,
-    8.468989134e-01f,
-    1.417942643e+00f,
-    1.378211737e+00f,
-    1.173738360e+00f,
-    1.677238345e+00f,
-    1.137730718e+00f,
-    7.880908251e-01f,
-    1.355173588e+00f,
-    8.809342384e-01f,
-    1.275750518e+00f,
-    8.572950959e-01f,
-    1.338767767e+00f,
-    9.474668503e-01f,
-    7.437423468e-01f,
-    1.231149077e+00f,
-    1.047757983e+00f,
-    8.838974237e-01f,
-    2.107194424e+00f,
-    1.214850664e+00f,
-    1.130198359e+00f,
-    1.102381229e+00f,
-    1.371036053e+00f,
-    1.060270667e+00f,
-    1.687480569e+00f,
-    7.848036885e-01f,
-    1.856828451e+00f,
-    8.190891147e-01f,
-    1.236373544e+00f,
-    2.152552843e+00f,
-    1.008493185e+00f,
-    6.890017390e-01f,
-    1.233609080e+00f,
-    1.198339581e+00f,
-    5.760024190e-01f,
-    7.506065369e-01f,
-    1.875824094e+00f,
-    1.047850966e+00f,
-    1.945887446e+00f,
-    1.193932533e+00f,
-    6.942505240e-01f,
-    7.081956863e-01f,
-    8.108614087e-01f,
-    2.270688534e+00f,
-    7.006382942e-01f,
-    6.806092262e-01f,
-    1.415106535e+00f,
-    8.182570338e-01f,
-    1.351590633e+00f,
-    7.912296057e-01f,
-    8.826451898e-01f,
-    6.199905276e-01f,
-    8.329516053e-01f,
-    1.067077398e+00f,
-    6.019415855e-01f,
-    2.009314299e+00f,
-    1.020303607e+00f,
-    9.616858363e-01f,
-    4.783994853e-01f,
-    7.000582814e-01f,
-    1.546552420e+00f,
-    1.205168247e+00f,
-    1.045065522e+00f,
-    1.364467144e+00f,
-    1.094247580e+00f,
-    7.781580091e-01f,
-    3.538949490e-01f,
-    9.417642355e-01f,
-    7.030430436e-01f,
-    1.499983668e+00f,
-    8.028706312e-01f,
-    1.629413247e+00f,
-    1.076527476e+00f,
-    1.226242304e+00f,
-    5.966343284e-01f,
-    5.417801738e-01f,
-    5.611007214e-01f,
-    1.251395702e+00f,
-    1.689504623e+00f,
-    2.050769329e+00f,
-    1.372924685e+00f,
-    5.398922563e-01f,
-    1.414167881e+00f,
-    1.461277485e+00f,
-    1.279679537e+00f,
-    8.239648342e-01f,
-    9.182530046e-01f,
-    1.422176242e+00f,
-    1.568116188e+00f,
-    1.602059722e+00f,
-    6.126474738e-01f,
-    1.056809783e+00f,
-    3.969758451e-01f,
-    6.805610657e-01f,
-    1.202504873e+00f,
-    2.230208158e+00f,
-    1.095255971e+00f,
-    1.284476638e+00f,
-    1.168122292e+00f,
-    6.966258287e-01f,
-    1.560197949e+00f,
-    1.138519764e+00f,
-    1.210532069e+00f,
-    1.336891770e+00f,
-    1.155429244e+00f,
-    1.456006408e+00f,
-    1.387749553e+00f,
-    6.418716908e-01f,
-    1.132829309e+00f,
-    1.668733120e+00f,
-    7.785876989e-01f,
-    9.249321818e-01f,
-    1.417818785e+00f,
-    1.039297938e+00f,
-    6.106297970e-01f,
-    1.909264445e+00f,
-    1.313328385e+00f,
-    1.067580462e+00f,
-    6.437532306e-01f,
-    8.990262151e-01f,
-    9.904696941e-01f,
-    1.358562112e+00f,
-    1.298120975e+00f,
-    1.080641866e+00f,
-    1.351819515e+00f,
-    1.849390507e+00f,
-    6.903867722e-01f,
-    7.992684841e-01f,
-    1.356734872e+00f,
-    6.727657318e-01f,
-    5.637924075e-01f,
-    6.072758436e-01f,
-    8.191161752e-01f,
-    9.368929863e-01f,
-    1.118766308e+00f,
-    1.005158424e+00f,
-    7.277536988e-01f,
-    1.375745177e+00f,
-    1.033082962e+00f,
-    1.340865493e+00f,
-    9.550666213e-01f,
-    7.281398773e-01f,
-    8.151675463e-01f,
-    9.526249170e-01f,
-    1.033269644e+00f,
-    2.784710646e+00f,
-    1.207770228e+00f,
-    6.277827621e-01f,
-    1.194772959e+00f,
-    1.225964904e+00f,
-    4.160727978e+00f,
-    3.344950676e-01f,
-    1.191308856e+00f,
-    1.129908800e+00f,
-    9.349315166e-01f,
-    1.565833449e+00f,
-    1.121997356e+00f,
-    1.283497453e+00f,
-    1.163625002e+00f,
-    7.959492803e-01f,
-    7.756436467e-01f,
-    8.798099160e-01f,
-    1.048049688e+00f,
-    1.122548580e+00f,
-    8.895469308e-01f,
-    2.228467703e+00f,
-    6.953976750e-01f,
-    5.000833273e-01f,
-    7.665578127e-01f,
-    1.175025702e+00f,
-    1.255251050e+00f,
-    1.058446646e+00f,
-    1.762425184e+00f,
-    7.730171680e-01f,
-    1.772117853e+00f,
-    2.393891096e+00f,
-    1.244018912e+00f,
-    9.319685102e-01f,
-    8.170755506e-01f,
-    9.981608391e-01f,
-    1.305164933e+00f,
-    1.864345193e+00f,
-    9.540651441e-01f,
-    1.625066638e+00f,
-    7.096058726e-01f,
-    1.516796827e+00f,
-    1.937447667e+00f,
-    8.152980804e-01f,
-    1.338958859e+00f,
-    6.878519058e-01f,
-    9.557906389e-01f,
-    8.819141984e-01f,
-    7.946743965e-01f,
-    1.519930124e+00f,
-    7.133836746e-01f,
-    7.513296008e-01f,
-    6.648933291e-01f,
-    5.901485085e-01f,
-    1.874410987e+00f,
-    8.147789240e-01f,
-    1.050608277e+00f,
-    9.401773810e-01f,
-    1.368899584e+00f,
-    1.122227907e+00f,
-    7.038348913e-01f,
-    1.075561285e+00f,
-    6.579153538e-01f,
-    6.251255274e-01f,
-    2.285529613e+00f,
-    1.299437046e+00f,
-    9.419457316e-01f,
-    1.243424416e+00f,
-    1.217623830e+00f,
-    1.216081262e+00f,
-    1.219650984e+00f,
-    1.553464293e+00f,
-    6.228166819e-01f,
-    9.314764142e-01f,
-    9.852110744e-01f,
-    1.010352731e+00f,
-    1.194546103e+00f,
-    1.246738315e+00f,
-    6.888915896e-01f,
-    9.054015279e-01f,
-    1.186691880e+00f,
-    7.545855045e-01f,
-    1.603272080e+00f,
-    1.225327730e+00f,
-    1.735835791e+00f,
-    7.824838758e-01f,
-    1.528008342e+00f,
-    9.468338490e-01f,
-    6.771850586e-01f,
-    3.938340187e+00f,
-    2.269387960e+00f,
-    2.252109766e+00f,
-    7.123203874e-01f,
-    1.011592269e+00f,
-    1.209616184e+00f,
-    6.420938969e-01f,
-    1.104887962e+00f,
-    7.009848356e-01f,
-    4.487767220e-01f,
-    5.390143991e-01f,
-    1.097417355e+00f,
-    7.753287554e-01f,
-    8.183556795e-01f,
-    1.568885446e+00f,
-    8.662261963e-01f,
-    1.018139958e+00f,
-    8.971161246e-01f,
-    1.525718689e+00f,
-    1.081485271e+00f,
-    1.664558649e+00f,
-    1.825463891e+00f,
-    8.298122287e-01f,
-    8.638951778e-01f,
-    1.025984168e+00f,
-    1.167025328e+00f,
-    1.169276714e+00f,
-    1.437469721e+00f,
-    8.749814630e-01f,
-    1.242939830e+00f,
-    1.473785520e+00f,
-    1.252181888e+00f,
-    9.647042751e-01f,
-    1.009617805e+00f,
-    1.289636612e+00f,
-    6.728780270e-01f,
-    7.489963770e-01f,
-    1.289647579e+00f,
-    7.826300859e-01f,
-    4.961712956e-01f,
-    9.407078624e-01f,
-    1.516626239e+00f,
-    4.675292373e-01f,
-    2.588596344e-01f,
-    1.017576933e+00f,
-    7.203325033e-01f,
-    1.501861334e+00f,
-    9.823932052e-01f,
-    3.601296246e-01f,
-    9.595850706e-01f,
-    1.384385943e+00f,
-    8.685787320e-01f,
-    1.465736270e+00f,
-    5.807987452e-01f,
-    7.671038508e-01f,
-    1.585675836e+00f,
-    4.747425616e-01f,
-    7.608938217e-01f,
-    8.239242435e-01f,
-    1.288744092e+00f,
-    8.216118217e-01f,
-    1.121840954e+00f,
-    5.318487287e-01f,
-    1.186113000e+00f,
-    8.400288224e-01f,
-    7.619585991e-01f,
-    8.279210925e-01f,
-    1.278002024e+00f,
-    1.479513407e+00f,
-    1.189921856e+00f,
-    1.210290313e+00f,
-    1.838546395e+00f,
-    6.776104569e-01f,
-    8.994175196e-01f,
-    8.821155429e-01f,
-    7.380519509e-01f,
-    7.958113551e-01f,
-    4.840782583e-01f,
-    7.671500444e-01f,
-    1.148476958e+00f,
-    1.379073501e+00f,
-    8.677311540e-01f,
-    1.624227881e+00f,
-    1.053349853e+00f,
-    1.545351028e+00f,
-    9.547772408e-01f,
-    4.029679894e-01f,
-    9.210271239e-01f,
-    1.206197500e+00f,
-    6.162503958e-01f,
-    1.042940855e+00f,
-    7.885825634e-01f,
-    1.511399746e+00f,
-    7.654234171e-01f,
-    8.679367900e-01f,
-    7.004441619e-01f,
-    8.146377206e-01f,
-    1.058647275e+00f,
-    1.743366361e+00f,
-    1.664707184e+00f,
-    1.370082140e+00f,
-    8.597217798e-01f,
-    1.604636312e+00f,
-    1.010697126e+00f,
-    1.007448673e+00f,
-    3.701592088e-01f,
-    7.246840596e-01f,
-    7.507709861e-01f,
-    1.416178226e+00f,
-    7.186895013e-01f,
-    1.433341861e+00f,
-    9.355922341e-01f,
-    6.277118325e-01f,
-    9.859769940e-01f,
-    1.578935385e+00f,
-    9.422909617e-01f,
-    7.507891059e-01f,
-    1.029273748e+00f,
-    6.471862793e-01f,
-    1.061856747e+00f,
-    1.856886506e+00f,
-    7.453632951e-01f,
-    7.757601142e-01f,
-    8.412793875e-01f,
-    8.413265347e-01f,
-    1.145735383e+00f,
-    1.121540427e+00f,
-    1.154615879e+00f,
-    1.114636064e+00f,
-    1.000254869e+00f,
-    1.117574215e+00f,
-    1.897982478e+00f,
-    1.374936223e+00f,
-    7.193670273e-01f,
-    6.981869936e-01f,
-    3.968720436e-01f,
-    1.457153797e+00f,
-    9.105799198e-01f,
-    9.829846621e-01f,
-    6.387611628e-01f,
-    1.146914482e+00f,
-    6.617838144e-01f,
-    1.266824722e+00f,
-    1.446376443e+00f,
-    8.495238423e-01f,
-    9.839532375e-01f,
-    9.504954219e-01f,
-    7.200331688e-01f,
-    1.096264482e+00f,
-    8.232322931e-01f,
-    1.294190764e+00f,
-    1.282917500e+00f,
-    9.304552674e-01f,
-    2.111371279e+00f,
-    1.233848095e+00f,
-    8.371241093e-01f,
-    7.403358221e-01f,
-    1.519891262e+00f,
-    9.588807225e-01f,
-    7.336385250e-01f,
-    6.451048255e-01f,
-    1.213940382e+00f,
-    7.812404633e-01f,
-    8.982428312e-01f,
-    1.060490251e+00f,
-    1.101448655e+00f,
-    4.802427888e-01f,
-    8.521956801e-01f,
-    1.211956978e+00f,
-    7.969531417e-01f,
-    8.174327612e-01f,
-    9.131577611e-01f,
-    2.197921991e+00f,
-    6.549193859e-01f,
-    5.244779587e-01f,
-    1.155647755e+00f,
-    1.401774168e+00f,
-    8.931566477e-01f,
-    5.304769278e-01f,
-    1.207641006e+00f,
-    8.093369007e-01f,
-    1.052512288e+00f,
-    1.386337996e+00f,
-    5.954252481e-01f,
-    6.334744692e-01f,
-    8.811017871e-01f,
-    1.378758192e+00f,
-    1.004412174e+00f,
-    1.913490295e+00f,
-    1.193553686e+00f,
-    1.348098874e+00f,
-    1.169519544e+00f,
-    1.350306392e+00f,
-    9.700976014e-01f,
-    5.901634097e-01f,
-    8.182275295e-01f,
-    6.555619836e-01f,
-    7.950555086e-01f,
-    8.118909597e-01f,
-    1.023446798e+00f,
-    1.204018116e+00f,
-    9.615991712e-01f,
-    1.097155213e+00f,
-    8.714387417e-01f,
-    1.104874611e+00f,
-    7.338024974e-01f,
-    8.418227434e-01f,
-    6.059218645e-01f,
-    7.232958674e-01f,
-    2.095834017e+00f,
-    1.349001408e+00f,
-    1.339958668e+00f,
-    1.161315680e+00f,
-    6.966078877e-01f,
-    9.218150973e-01f,
-    7.125012279e-01f,
-    1.358576179e+00f,
-    7.540203333e-01f,
-    2.599365234e+00f,
-    5.696045160e-01f,
-    9.114710689e-01f,
-    1.458178759e+00f,
-    1.632536292e+00f,
-    1.404653072e+00f,
-    1.136042476e+00f,
-    1.027786613e+00f,
-    1.466079116e+00f,
-    1.681208849e+00f,
-    1.777169228e+00f,
-    1.343114376e+00f,
-    9.061377048e-01f,
-    7.276259065e-01f,
-    9.507839680e-01f,
-    6.627113819e-01f,
-    1.469217539e+00f,
-    6.836408377e-01f,
-    6.102892756e-01f,
-    1.997477889e+00f,
-    1.111431003e+00f,
-    1.542836428e+00f,
-    1.297051668e+00f,
-    1.111660123e+00f,
-    5.627800822e-01f,
-    1.358812332e+00f,
-    4.463874400e-01f,
-    1.453405261e+00f,
-    1.263859987e+00f,
-    1.400657773e+00f,
-    7.922258973e-01f,
-    1.013177514e+00f,
-    3.725824952e-01f,
-    1.280782819e+00f,
-    9.161711335e-01f,
-    5.771256089e-01f,
-    4.999860227e-01f,
-    9.074823856e-01f,
-    1.438376069e+00f,
-    1.626743913e+00f,
-    3.373834789e-01f,
-    5.520794392e-01f,
-    1.042155981e+00f,
-    9.250521660e-01f,
-    1.373689055e+00f,
-    1.185340405e+00f,
-    5.689588785e-01f,
-    1.362613559e+00f,
-    7.485043406e-01f,
-    1.620791316e+00f,
-    1.253077388e+00f,
-    2.236211777e+00f,
-    8.401606083e-01f,
-    9.571416378e-01f,
-    2.767327309e+00f,
-    1.269432187e+00f,
-    1.168608427e+00f,
-    8.347819448e-01f,
-    7.397872210e-01f,
-    1.318364501e+00f,
-    1.069251060e+00f,
-    9.188880324e-01f,
-    1.338103175e+00f,
-    7.269019485e-01f,
-    1.907506347e+00f,
-    1.484161139e+00f,
-    8.067684174e-01f,
-    7.228270769e-01f,
-    7.482690215e-01f,
-    9.410734177e-01f,
-    1.127603173e+00f,
-    1.094525576e+00f,
-    1.024946451e+00f,
-    1.154568791e+00f,
-    1.592262268e+00f,
-    1.856533170e+00f,
-    8.573565483e-01f,
-    1.827239871e+00f,
-    1.165069461e+00f,
-    1.125278592e+00f,
-    1.646265984e+00f,
-    9.841638803e-01f,
-    1.142295003e+00f,
-    6.100252867e-01f,
-    1.394342065e+00f,
-    1.238596797e+00f,
-    1.814166784e+00f,
-    1.215003133e+00f,
-    1.074144840e+00f,
-    5.741115212e-01f,
-    8.531405926e-01f,
-    1.233717799e+00f,
-    6.299941540e-01f,
-    6.618339419e-01f,
-    9.935705662e-01f,
-    1.266347766e+00f,
-    8.476898074e-01f,
-    8.952954412e-01f,
-    6.480401754e-01f,
-    7.613902092e-01f,
-    1.589155674e+00f,
-    1.272570133e+00f,
-    1.170200944e+00f,
-    1.511193037e+00f,
-    1.202122569e+00f,
-    1.203269839e+00f,
-    9.965766072e-01f,
-    1.133511782e+00f,
-    1.168873429e+00f,
-    1.376150608e+00f,
-    2.103615999e+00f,
-    7.473446727e-01f,
-    1.569358587e+00f,
-    1.795922279e+00f,
-    1.421941280e+00f,
-    8.419042826e-01f,
-    1.116362810e+00f,
-    1.108479023e+00f,
-    1.557168484e+00f,
-    9.774956107e-01f,
-    7.813975215e-01f,
-    9.108313918e-01f,
-    8.912750483e-01f,
-    1.835000992e+00f,
-    9.087110758e-01f,
-    5.326193571e-01f,
-    8.872514367e-01f,
-    4.842840433e-01f,
-    8.493844271e-01f,
-    1.079614639e+00f,
-    1.052867889e+00f,
-    1.271583200e+00f,
-    8.606383801e-01f,
-    1.896487236e+00f,
-    1.398251176e+00f,
-    1.507428288e+00f,
-    9.373326302e-01f,
-    1.458549500e+00f,
-    6.107612252e-01f,
-    1.283845425e+00f,
-    7.615027428e-01f,
-    8.534520268e-01f,
-    9.325828552e-01f,
-    9.904502630e-01f,
-    1.684684157e+00f,
-    1.134482503e+00f,
-    1.442104340e+00f,
-    1.377302527e+00f,
-    1.024850011e+00f,
-    9.426991343e-01f,
-    1.126248479e+00f,
-    9.553248286e-01f,
-    1.125389338e+00f,
-    9.383510351e-01f,
-    1.655036092e+00f,
-    5.620648861e-01f,
-    1.364916086e+00f,
-    1.107258916e+00f,
-    9.562628865e-01f,
-    6.775326133e-01f,
-    7.321485281e-01f,
-    8.458472490e-01f,
-    1.208133459e+00f,
-    1.339555860e+00f,
-    1.239261985e+00f,
-    5.599241853e-01f,
-    5.401968956e-01f,
-    1.720334053e+00f,
-    1.439108968e+00f,
-    1.701733828e+00f,
-    1.883462429e+00f,
-    7.724180222e-01f,
-    1.169784188e+00f,
-    1.028243303e+00f,
-    9.438233972e-01f,
-    1.026669502e+00f,
-    2.402114868e+00f,
-    9.088295698e-01f,
-    8.357196450e-01f,
-    1.256780386e+00f,
-    1.088629365e+00f,
-    1.322756529e+00f,
-    4.277387261e-01f,
-    1.062424660e+00f,
-    8.941679001e-01f,
-    1.363305807e+00f,
-    9.226641655e-01f,
-    1.108081698e+00f,
-    1.015883327e+00f,
-    1.961907744e+00f,
-    1.356931090e+00f,
-    8.027359247e-01f,
-    6.571236849e-01f,
-    1.723955154e+00f,
-    1.242934942e+00f,
-    9.192430377e-01f,
-    9.324256778e-01f,
-    7.988305688e-01f,
-    1.094325900e+00f,
-    1.345882773e+00f,
-    1.163081527e+00f,
-    1.339895964e+00f,
-    1.038242102e+00f,
-    2.100560188e+00f,
-    1.374907255e+00f,
-    6.582523584e-01f,
-    5.672994852e-01f,
-    1.018522978e+00f,
-    1.493680835e+00f,
-    7.871992588e-01f,
-    1.158961058e+00f,
-    1.081369996e+00f,
-    9.732515812e-01f,
-    1.107842803e+00f,
-    1.504975080e+00f,
-    1.093153000e+00f,
-    1.406637430e+00f,
-    1.546478748e+00f,
-    7.746745348e-01f,
-    8.698947430e-01f,
-    1.250862360e+00f,
-    9.969198704e-01f,
-    8.803554177e-01f,
-    6.457644105e-01f,
-    9.552726746e-01f,
-    1.181540608e+00f,
-    7.437639236e-01f,
-    1.806395888e+00f,
-    8.784475327e-01f,
-    1.090415359e+00f,
-    1.246781707e+00f,
-    9.312933683e-01f,
-    9.301583767e-01f,
-    1.980479240e+00f,
-    2.014852762e+00f,
-    9.143905640e-01f,
-    1.631021261e+00f,
-    7.936490178e-01f,
-    1.529082775e+00f,
-    1.035680890e+00f,
-    2.135278940e+00f,
-    1.233114600e+00f,
-    1.414941907e+00f,
-    5.714046359e-01f,
-    7.775076032e-01f,
-    7.362738848e-01f,
-    6.423182487e-01f,
-    8.439382315e-01f,
-    1.389734387e+00f,
-    8.111495972e-01f,
-    1.270601630e+00f,
-    9.958561063e-01f,
-    7.414035201e-01f,
-    8.276291490e-01f,
-    7.230315208e-01f,
-    9.936863184e-01f,
-    1.085605502e+00f,
-    8.828363419e-01f,
-    8.407203555e-01f,
-    6.865785718e-01f,
-    1.383075595e+00f,
-    7.675536275e-01f,
-    2.193213940e+00f,
-    9.103565216e-01f,
-    1.245133519e+00f,
-    1.068319917e+00f,
-    1.065714478e+00f,
-    1.254931837e-01f,
-    6.854079962e-01f,
-    7.717335820e-01f,
-    1.554316401e+00f,
-    1.378108859e+00f,
-    1.116340160e+00f,
-    1.200387478e+00f,
-    1.210389495e+00f,
-    1.175063133e+00f,
-    3.408093750e-01f,
-    1.076627493e+00f,
-    9.582005143e-01f,
-    9.610280395e-01f,
-    1.093401551e+00f,
-    1.439031124e+00f,
-    9.792110920e-01f,
-    9.961318970e-01f,
-    1.439124346e+00f,
-    8.870943785e-01f,
-    8.498959541e-01f,
-    8.215919137e-01f,
-    1.277580738e+00f,
-    4.522253573e-01f,
-    7.613897324e-01f,
-    7.063426375e-01f,
-    1.083462715e+00f,
-    7.447587252e-01f,
-    1.319190860e+00f,
-    1.074989557e+00f,
-    7.818421721e-01f,
-    1.105337143e+00f,
-    1.949658871e+00f,
-    1.102061391e+00f,
-    5.977742076e-01f,
-    1.472647548e+00f,
-    1.161181331e+00f,
-    1.105193973e+00f,
-    1.410026073e+00f,
-    1.228502035e+00f,
-    1.145955682e+00f,
-    6.931500435e-01f,
-    1.110972166e+00f,
-    9.981901646e-01f,
-    6.902521253e-01f,
-    1.644929528e+00f,
-    7.439803481e-01f,
-    2.557513714e+00f,
-    9.622707367e-01f,
-    9.287505746e-01f,
-    7.018473148e-01f,
-    8.892666101e-01f,
-    1.683553219e+00f,
-    1.095345974e+00f,
-    1.815188646e+00f,
-    1.165944099e+00f,
-    8.233821988e-01f,
-    1.320099711e+00f,
-    1.626623988e+00f,
-    9.664012194e-01f,
-    5.930981040e-01f,
-    6.883296967e-01f,
-    9.053882360e-01f,
-    2.297112942e+00f,
-    1.201768756e+00f,
-    1.451987147e+00f,
-    1.399909854e+00f,
-    9.394909739e-01f,
-    2.262084723e+00f,
-    1.326897740e+00f,
-    1.106589437e+00f,
-    8.885518312e-01f,
-    7.627536654e-01f,
-    9.685500860e-01f,
-    1.340681076e+00f,
-    8.274905682e-01f,
-    1.308434129e+00f,
-    7.715787292e-01f,
-    1.145498514e+00f,
-    6.095512509e-01f,
-    1.651856780e+00f,
-    7.072578669e-01f,
-    1.073203206e+00f,
-    7.196797132e-01f,
-    1.198933482e+00f,
-    1.350418329e+00f,
-    1.131270170e+00f,
-    7.733291388e-01f,
-    7.801300287e-01f,
-    9.639562368e-01f,
-    1.381254554e+00f,
-    5.347432494e-01f,
-    7.943566442e-01f,
-    4.875842631e-01f,
-    1.095860720e+00f,
-    1.111437321e+00f,
-    6.344518661e-01f,
-    3.839686215e-01f,
-    1.731046796e+00f,
-    1.034531832e+00f,
-    8.494277000e-01f,
-    1.863444805e+00f,
-    1.069068551e+00f,
-    9.124547839e-01f,
-    1.326731801e+00f,
-    1.082941175e+00f,
-    8.793620467e-01f,
-    6.642563939e-01f,
-    1.389260054e+00f,
-    1.537982106e+00f,
-    5.727895498e-01f,
-    1.068902612e+00f,
-    1.569344640e+00f,
-    1.352032304e+00f,
-    8.813654184e-01f,
-    1.621526003e+00f,
-    5.585253239e-01f,
-    7.978975177e-01f,
-    7.039147019e-01f,
-    8.325577974e-01f,
-    1.124167204e+00f,
-    1.204661608e+00f,
-    9.548220038e-01f,
-    9.998084307e-01f,
-    2.297176600e+00f,
-    1.029616475e+00f,
-    9.937292337e-01f,
-    9.491428733e-01f,
-    5.768943429e-01f,
-    9.024434090e-01f,
-    1.195096374e+00f,
-    1.005022168e+00f,
-    1.130313635e+00f,
-    9.768960476e-01f,
-    5.836768150e-01f,
-    7.867486477e-01f,
-    1.774311662e+00f,
-    1.479881406e+00f,
-    1.012505412e+00f,
-    1.146030664e+00f,
-    7.336753607e-01f,
-    1.509020448e+00f,
-    1.571704149e+00f,
-    1.557366729e+00f,
-    1.206427693e+00f,
-    1.560106993e+00f,
-    1.412022352e+00f,
-    7.478014827e-01f,
-    1.069695711e+00f,
-    6.547404528e-01f,
-    9.072299600e-01f,
-    1.057222605e+00f,
-    1.438129544e+00f,
-    8.644067049e-01f,
-    1.036112547e+00f,
-    5.215078592e-01f,
-    1.258919477e+00f,
-    1.524334788e+00f,
-    6.350989342e-01f,
-    8.624428511e-01f,
-    7.902880907e-01f,
-    1.274770021e+00f,
-    1.947298527e+00f,
-    1.737284184e+00f,
-    1.699048996e+00f,
-    1.992066979e+00f,
-    1.302406430e+00f,
-    6.805663109e-01f,
-    1.380672574e+00f,
-    1.023502469e+00f,
-    9.223845601e-01f,
-    8.170731664e-01f,
-    1.348982573e+00f,
-    2.145760775e+00f,
-    1.301866055e+00f,
-    1.187733531e+00f,
-    1.215543866e+00f,
-    1.066770911e+00f,
-    1.033463240e+00f,
-    8.888654709e-01f,
-    1.204806328e+00f,
-    1.492904425e+00f,
-    1.803413868e+00f,
-    7.581067085e-01f,
-    5.149236917e-01f,
-    1.258610249e+00f,
-    9.787022471e-01f,
-    1.161265254e+00f,
-    7.133054733e-01f,
-    7.231414914e-01f,
-    8.392491937e-01f,
-    2.204125166e+00f,
-    8.114130497e-01f,
-    8.963444233e-01f,
-    1.096125484e+00f,
-    2.022782803e+00f,
-    6.679670811e-01f,
-    9.234739542e-01f,
-    9.203392863e-01f,
-    6.439796090e-01f,
-    1.283623934e+00f,
-    6.046263576e-01f,
-    6.924716234e-01f,
-    1.592587113e+00f,
-    7.110734582e-01f,
-    5.731878281e-01f,
-    1.849838138e+00f,
-    1.838575602e+00f,
-    1.988038063e+00f,
-    2.452478170e+00f,
-    1.447525859e+00f,
-    9.328578711e-01f,
-    8.425776958e-01f,
-    9.710769653e-01f,
-    1.396584034e+00f,
-    1.438867331e+00f,
-    9.934441447e-01f,
-    4.921083450e-01f,
-    1.415807128e+00f,
-    1.003903270e+00f,
-    9.493709207e-01f,
-    9.425110817e-01f,
-    8.545586467e-01f,
-    9.860576987e-01f,
-    1.105921984e+00f,
-    7.118216753e-01f,
-    1.854413748e+00f,
-    9.852167964e-01f,
-    6.918742657e-01f,
-    7.751396298e-01f,
-    8.657560945e-01f,
-    7.476865649e-01f,
-    1.471883774e+00f,
-    6.255001426e-01f,
-    6.059750319e-01f,
-    1.348151326e+00f,
-    1.104849339e+00f,
-    1.432317376e+00f,
-    8.257462382e-01f,
-    1.092116952e+00f,
-    8.103288412e-01f,
-    7.455940843e-01f,
-    1.405090928e+00f,
-    1.040770054e+00f,
-    8.884962201e-01f,
-    1.000774622e+00f,
-    1.604726672e+00f,
-    1.074885607e+00f,
-    1.709235549e+00f,
-    1.605382442e+00f,
-    1.048180342e+00f,
-    2.348465919e+00f,
-    1.084565997e+00f,
-    2.029529810e+00f,
-    8.289424777e-01f,
-    1.212445855e+00f,
-    1.204455972e+00f,
-    1.345032692e+00f,
-    5.859608054e-01f,
-    7.026333213e-01f,
-    6.009500027e-01f,
-    1.096037865e+00f,
-    1.314311504e+00f,
-    9.075658321e-01f,
-    9.034058452e-01f,
-    1.094941974e+00f,
-    1.021880150e+00f,
-    5.073435307e-01f,
-    1.388747811e+00f,
-    1.227742672e+00f,
-    8.390238881e-01f,
-    9.702474475e-01f,
-    1.048684955e+00f,
-    1.038694501e+00f,
-    1.085620165e+00f,
-    8.943364620e-01f,
-    7.976808548e-01f,
-    1.843780875e+00f,
-    1.428791761e+00f,
-    9.450029731e-01f,
-    5.278740525e-01f,
-    9.300365448e-01f,
-    1.622126222e+00f,
-    1.161401272e+00f,
-    1.940191746e+00f,
-    5.736521482e-01f,
-    7.656159401e-01f,
-    1.703964829e+00f,
-    1.497894526e+00f,
-    1.093397379e+00f,
-    1.252522826e+00f,
-    8.051105738e-01f,
-    1.003249407e+00f,
-    1.727847457e+00f,
-    1.211745143e+00f,
-    1.693668842e+00f,
-    7.215030789e-01f,
-    6.617505550e-01f,
-    5.182271600e-01f,
-    7.403191328e-01f,
-    9.372871518e-01f,
-    7.351053953e-01f,
-    8.615813255e-01f,
-    7.890980840e-01f,
-    9.474991560e-01f,
-    7.931565046e-01f,
-    6.749415994e-01f,
-    6.284142733e-01f,
-    5.921393037e-01f,
-    8.252582550e-01f,
-    1.558300138e+00f,
-    1.330389023e+00f,
-    1.357762456e+00f,
-    1.015499473e+00f,
-    1.355912209e+00f,
-    9.373958111e-01f,
-    6.228467226e-01f,
-    7.707778215e-01f,
-    1.001981139e+00f,
-    4.898058772e-01f,
-    5.177650452e-01f,
-    1.315026283e+00f,
-    1.266400337e+00f,
-    1.245448589e+00f,
-    1.237518430e+00f,
-    9.103865027e-01f,
-    8.042837977e-01f,
-    2.768749475e+00f,
-    8.555729985e-01f,
-    1.044755220e+00f,
-    1.494197369e+00f,
-    1.345984817e+00f,
-    2.278246880e+00f,
-    1.034294724e+00f,
-    1.414208055e+00f,
-    1.459701777e+00f,
-    1.404766798e+00f,
-    2.171397686e+00f,
-    9.261128902e-01f,
-    2.451368093e+00f,
-    1.461768031e+00f,
-    5.514991879e-01f,
-    1.628869057e+00f,
-    8.708031178e-01f,
-    1.885365367e+00f,
-    1.075130105e+00f,
-    1.045641065e+00f,
-    1.555217266e+00f,
-    1.194799185e+00f,
-    1.395057440e+00f,
-    7.260691524e-01f,
-    7.696372271e-01f,
-    6.455134153e-01f,
-    9.837905169e-01f,
-    1.348924518e+00f,
-    8.406083584e-01f,
-    1.321859121e+00f,
-    1.271428227e+00f,
-    6.506635547e-01f,
-    1.441006780e+00f,
-    1.123451114e+00f,
-    7.781138420e-01f,
-    1.320782900e+00f,
-    7.326710820e-01f,
-    7.402890921e-01f,
-    2.363664389e+00f,
-    1.381488681e+00f,
-    2.029810905e+00f,
-    1.008057594e+00f,
-    1.577979445e+00f,
-    1.366496563e+00f,
-    7.366452217e-01f,
-    1.105731368e+00f,
-    7.978467941e-01f,
-    4.289641678e-01f,
-    1.057387948e+00f,
-    9.570052624e-01f,
-    7.168101072e-01f,
-    3.723229170e-01f,
-    1.039446354e+00f,
-    1.456653714e+00f,
-    6.846342683e-01f,
-    6.883205771e-01f,
-    1.661111236e+00f,
-    8.227265477e-01f,
-    1.290370345e+00f,
-    1.058521152e+00f,
-    8.847290277e-01f,
-    1.243014693e+00f,
-    1.109258533e+00f,
-    1.527197361e+00f,
-    2.537646055e+00f,
-    8.875982165e-01f,
-    9.983673692e-01f,
-    1.128931046e+00f,
-    1.066417456e+00f,
-    9.225162864e-01f,
-    1.374486208e+00f,
-    7.655087113e-01f,
-    1.743182421e+00f,
-    1.298739552e+00f,
-    7.574490905e-01f,
-    1.322836399e+00f,
-    1.879927158e+00f,
-    2.098183632e+00f,
-    6.970728040e-01f,
-    1.115401268e+00f,
-    6.979765296e-01f,
-    9.195475578e-01f,
-    1.022893786e+00f,
-    1.757051826e+00f,
-    6.730021834e-01f,
-    9.130808711e-01f,
-    1.105286121e+00f,
-    1.883544207e+00f,
-    8.602760434e-01f,
-    1.007688880e+00f,
-    2.117024660e+00f,
-    1.422703028e+00f,
-    7.852241993e-01f,
-    1.243351221e+00f,
-    7.096164823e-01f,
-    1.245391011e+00f,
-    1.415692568e+00f,
-    2.220844269e+00f,
-    1.467302799e+00f,
-    1.194032550e+00f,
-    8.494682908e-01f,
-    1.110391855e+00f,
-    6.989094615e-01f,
-    1.723655939e+00f,
-    1.097133517e+00f,
-    6.158358455e-01f,
-    8.952753544e-01f,
-    8.635323048e-01f,
-    5.008190870e-01f,
-    1.156425118e+00f,
-    7.212211490e-01f,
-    7.590017319e-01f,
-    1.197272182e+00f,
-    1.029626608e+00f,
-    5.154011846e-01f,
-    1.831763744e+00f,
-    4.945825636e-01f,
-    6.433396935e-01f,
-    1.223109007e+00f,
-    1.345620990e+00f,
-    8.935407400e-01f,
-    1.252991796e+00f,
-    1.522400260e+00f,
-    8.886191249e-01f,
-    2.114935637e+00f,
-    1.089207292e+00f,
-    9.122576714e-01f,
-    1.090423346e+00f,
-    1.638921380e+00f,
-    1.150811672e+00f,
-    1.317094684e+00f,
-    1.266145229e+00f,
-    9.220893979e-01f,
-    1.950141668e+00f,
-    1.077701211e+00f,
-    1.358296275e+00f,
-    9.558508992e-01f,
-    8.635558486e-01f,
-    9.588730335e-01f,
-    1.323644638e+00f,
-    1.528664231e+00f,
-    8.266915083e-01f,
-    1.087047696e+00f,
-    9.071285129e-01f,
-    9.438515902e-01f,
-    9.682348967e-01f,
-    1.879672766e+00f,
-    1.068467259e+00f,
-    8.391266465e-01f,
-    9.158138633e-01f,
-    1.079416275e+00f,
-    9.532967806e-01f,
-    1.214863777e+00f,
-    6.821007729e-01f,
-    1.866701961e+00f,
-    8.942348957e-01f,
-    8.319864869e-01f,
-    7.620611787e-01f,
-    1.274488211e+00f,
-    9.452635646e-01f,
-    1.398775220e+00f,
-    4.920201004e-01f,
-    9.669235349e-01f,
-    1.669443250e+00f,
-    1.252892494e+00f,
-    6.616973281e-01f,
-    1.357461452e+00f,
-    8.099691272e-01f,
-    1.306303382e+00f,
-    1.293656349e+00f,
-    9.120658040e-01f,
-    1.041206479e+00f,
-    8.816625476e-01f,
-    1.099667072e+00f,
-    8.864448667e-01f,
-    6.898100376e-01f,
-    7.202495933e-01f,
-    5.940494537e-01f,
-    9.483916759e-01f,
-    7.475124598e-01f,
-    1.164270997e+00f,
-    1.412207007e+00f,
-    7.277663946e-01f,
-    1.377053022e+00f,
-    8.449866772e-01f,
-    1.526521325e+00f,
-    1.183090925e+00f,
-    6.815553308e-01f,
-    8.781458735e-01f,
-    1.263439298e+00f,
-    1.028318644e+00f,
-    9.717961550e-01f,
-    1.553327799e+00f,
-    9.401547313e-01f,
-    9.262047410e-01f,
-    1.670790315e+00f,
-    1.163786292e+00f,
-    1.054381251e+00f,
-    7.993520498e-01f,
-    8.719708920e-01f,
-    1.524357915e+00f,
-    8.975342512e-01f,
-    1.339686513e+00f,
-    6.611813307e-01f,
-    1.097672582e+00f,
-    2.000897884e+00f,
-    1.292606592e+00f,
-    1.348428130e+00f,
-    9.669623375e-01f,
-    1.341213942e+00f,
-    7.394232750e-01f,
-    1.235204816e+00f,
-    1.126080632e+00f,
-    1.711442232e+00f,
-    5.322216153e-01f,
-    1.887485266e+00f,
-    1.362022161e+00f,
-    1.059272051e+00f,
-    1.187725663e+00f,
-    7.115255594e-01f,
-    1.087916017e+00f,
-    1.838219285e+00f,
-    1.584328651e+00f,
-    1.140570164e+00f,
-    1.491004467e+00f,
-    9.868288040e-01f,
-    1.595344067e+00f,
-    5.929090381e-01f,
-    9.218280315e-01f,
-    8.327884078e-01f,
-    1.032800078e+00f,
-    1.994296312e+00f,
-    6.599317789e-01f,
-    2.433806896e+00f,
-    1.267211556e+00f,
-    1.010379314e+00f,
-    1.045393944e+00f,
-    5.593858957e-01f,
-    9.685500264e-01f,
-    1.574863434e+00f,
-    1.014669180e+00f,
-    7.361683249e-01f,
-    1.031771660e+00f,
-    1.001115799e+00f,
-    1.058733225e+00f,
-    9.763016105e-01f,
-    1.455134869e+00f,
-    7.109190822e-01f,
-    1.153437257e+00f,
-    9.365910292e-01f,
-    1.187417507e+00f,
-    7.773785591e-01f,
-    7.145494223e-01f,
-    4.917522967e-01f,
-    1.063279629e+00f,
-    7.449529171e-01f,
-    8.598635793e-01f,
-    1.287817955e+00f,
-    1.592035651e+00f,
-    5.347194076e-01f,
-    4.064339399e-01f,
-    7.858514786e-01f,
-    7.770667076e-01f,
-    9.375411272e-01f,
-    1.205545306e+00f,
-    1.777221680e+00f,
-    1.149578691e+00f,
-    6.701731682e-01f,
-    5.596074462e-01f,
-    6.573966146e-01f,
-    1.859514356e+00f,
-    1.910271883e+00f,
-    9.117256999e-01f,
-    1.235607982e+00f,
-    5.202206969e-01f,
-    7.864700556e-01f,
-    6.679952145e-01f,
-    1.127404571e+00f,
-    7.804856300e-01f,
-    1.168863416e+00f,
-    7.174004912e-01f,
-    1.163743138e+00f,
-    1.020639181e+00f,
-    5.102162957e-01f,
-    1.060864091e+00f,
-    1.670784235e+00f,
-    9.559114575e-01f,
-    1.350969315e+00f,
-    1.391927719e+00f,
-    1.114970446e+00f,
-    7.615892291e-01f,
-    7.017006874e-01f,
-    1.348216057e+00f,
-    7.044875026e-01f,
-    5.727087259e-01f,
-    9.462855458e-01f,
-    5.541273952e-01f,
-    3.928499520e-01f,
-    9.644097090e-01f,
-    1.274163008e+00f,
-    1.359079123e+00f,
-    1.423660994e+00f,
-    1.828688622e+00f,
-    1.750791311e+00f,
-    2.088607550e+00f,
-    2.628551722e+00f,
-    1.008347988e+00f,
-    2.307047844e+00f,
-    2.022920609e+00f,
-    9.384044409e-01f,
-    2.142274857e+00f,
-    1.010746837e+00f,
-    1.229662180e+00f,
-    1.819188356e+00f,
-    1.234349251e+00f,
-    2.246056318e+00f,
-    7.292774916e-01f,
-    1.290878534e+00f,
-    1.083091974e+00f,
-    1.650235534e+00f,
-    1.403045893e+00f,
-    1.256113291e+00f,
-    8.840630651e-01f,
-    3.380615473e+00f,
-    9.499781132e-01f,
-    2.243739128e+00f,
-    1.724084258e+00f,
-    8.921037316e-01f,
-    1.007324815e+00f,
-    1.266869783e+00f,
-    1.278211713e+00f,
-    5.190382600e-01f,
-    1.044216990e+00f,
-    6.817696691e-01f,
-    6.293265224e-01f,
-    7.834765911e-01f,
-    1.051076174e+00f,
-    9.159251451e-01f,
-    1.125812531e+00f,
-    1.216136932e+00f,
-    6.294668317e-01f,
-    6.706419587e-01f,
-    8.014138937e-01f,
-    1.361054540e+00f,
-    6.069283485e-01f,
-    1.155804038e+00f,
-    1.074659705e+00f,
-    9.247889519e-01f,
-    6.639401913e-01f,
-    1.287141204e+00f,
-    6.974943280e-01f,
-    1.096703887e+00f,
-    9.760078192e-01f,
-    1.926378489e+00f,
-    9.836658239e-01f,
-    1.987572432e+00f,
-    5.678812861e-01f,
-    5.622403026e-01f,
-    1.512892008e+00f,
-    7.486547232e-01f,
-    5.107580423e-01f,
-    2.618518591e+00f,
-    9.769691825e-01f,
-    2.233459234e+00f,
-    8.932260275e-01f,
-    5.985329151e-01f,
-    9.842293859e-01f,
-    9.280394316e-01f,
-    8.493780494e-01f,
-    1.130676746e+00f,
-    1.086653948e+00f,
-    6.187288165e-01f,
-    1.422802925e+00f,
-    2.075124502e+00f,
-    2.007237196e+00f,
-    1.345617056e+00f,
-    6.964418292e-01f,
-    1.170306206e+00f,
-    1.037243128e+00f,
-    1.188675165e+00f,
-    9.074231982e-01f,
-    1.287420034e+00f,
-    9.366395473e-01f,
-    1.012372494e+00f,
-    1.814273357e+00f,
-    2.118335009e+00f,
-    8.620998263e-01f,
-    1.071282387e+00f,
-    1.815792561e+00f,
-    1.884913445e+00f,
-    1.603929996e+00f,
-    7.488493323e-01f,
-    8.317224383e-01f,
-    1.394337654e+00f,
-    6.752488017e-01f,
-    1.010009050e+00f,
-    6.364047527e-01f,
-    1.484519124e+00f,
-    6.236922741e-01f,
-    6.487100124e-01f,
-    1.606199384e+00f,
-    8.715650439e-01f,
-    2.102773190e+00f,
-    5.759182572e-01f,
-    2.134575367e+00f,
-    8.723872900e-01f,
-    1.431474805e+00f,
-    3.859123588e-01f,
-    1.066856980e+00f,
-    1.415251493e+00f,
-    1.272171855e+00f,
-    7.557591200e-01f,
-    1.988382816e+00f,
-    4.268452525e-01f,
-    8.754892349e-01f,
-    8.453665376e-01f,
-    1.330193877e+00f,
-    4.850662649e-01f,
-    1.155297160e+00f,
-    1.261636615e+00f,
-    1.339593768e+00f,
-    7.170677781e-01f,
-    1.065872788e+00f,
-    2.054446936e+00f,
-    9.590446353e-01f,
-    1.729358196e+00f,
-    5.068090558e-01f,
-    1.000328183e+00f,
-    6.707357168e-01f,
-    1.600494623e+00f,
-    7.205755115e-01f,
-    1.372743011e+00f,
-    1.059100986e+00f,
-    9.501101971e-01f,
-    1.159171104e+00f,
-    5.269571543e-01f,
-    1.043412089e+00f,
-    1.004642248e+00f,
-    7.109071612e-01f,
-    1.779110193e+00f,
-    2.115548611e+00f,
-    2.184903860e+00f,
-    6.968920827e-01f,
-    6.724671125e-01f,
-    9.250451922e-01f,
-    1.220651269e+00f,
-    1.242905498e+00f,
-    7.686681151e-01f,
-    1.085943818e+00f,
-    1.211264253e+00f,
-    1.099465013e+00f,
-    1.266108155e+00f,
-    6.493470073e-01f,
-    9.902170300e-01f,
-    6.383672953e-01f,
-    1.147884607e+00f,
-    8.020836711e-01f,
-    1.205513120e+00f,
-    8.200004697e-01f,
-    9.311639667e-01f,
-    1.108075619e+00f,
-    6.775268316e-01f,
-    1.451581359e+00f,
-    1.638496757e+00f,
-    1.866969585e+00f,
-    8.301752806e-01f,
-    8.695854545e-01f,
-    1.200669169e+00f,
-    1.211283922e+00f,
-    1.594496012e+00f,
-    1.172283769e+00f,
-    1.117045164e+00f,
-    3.775081396e+00f,
-    8.248159885e-01f,
-    5.976992249e-01f,
-    1.034049749e+00f,
-    1.078215003e+00f,
-    1.283991456e+00f,
-    1.174711585e+00f,
-    1.719931126e+00f,
-    9.339632392e-01f,
-    2.166579723e+00f,
-    1.092834711e+00f,
-    9.156937599e-01f,
-    1.037809134e+00f,
-    4.490727901e+00f,
-    1.272231579e+00f,
-    1.240392447e+00f,
-    1.494006753e+00f,
-    4.628933370e-01f,
-    2.031608582e+00f,
-    1.488001943e+00f,
-    7.095788121e-01f,
-    1.461630821e+00f,
-    1.407251358e+00f,
-    6.702167988e-01f,
-    1.455376625e+00f,
-    1.011512995e+00f,
-    1.939031243e+00f,
-    2.496920347e+00f,
-    7.821737528e-01f,
-    5.447424054e-01f,
-    8.310198784e-01f,
-    1.232838631e+00f,
-    6.498672962e-01f,
-    1.398345947e+00f,
-    6.077482700e-01f,
-    1.764403939e+00f,
-    7.547202706e-01f,
-    4.733339846e-01f,
-    1.246745467e+00f,
-    8.423510790e-01f,
-    9.128693342e-01f,
-    9.489749670e-01f,
-    1.018623352e+00f,
-    9.566926956e-01f,
-    8.626535535e-01f,
-    1.344074130e+00f,
-    8.000649214e-01f,
-    5.874043703e-01f,
-    6.411098242e-01f,
-    6.274025440e-01f,
-    7.302266955e-01f,
-    1.074937582e+00f,
-    9.541523457e-01f,
-    8.768649101e-01f,
-    1.029592752e+00f,
-    1.227577806e+00f,
-    1.024956107e+00f,
-    8.915100098e-01f,
-    1.651283860e+00f,
-    1.935649037e+00f,
-    1.649132967e+00f,
-    7.096153498e-01f,
-    1.860598683e+00f,
-    2.562145710e+00f,
-    1.871112466e+00f,
-    1.600412250e+00f,
-    1.066050053e+00f,
-    1.470045328e+00f,
-    9.635258913e-01f,
-    1.031444907e+00f,
-    3.606458187e+00f,
-    1.300722957e+00f,
-    7.446172237e-01f,
-    7.752382159e-01f,
-    9.985537529e-01f,
-    1.057829142e+00f,
-    1.493409276e+00f,
-    8.387536407e-01f,
-    8.553269506e-01f,
-    1.624157071e+00f,
-    1.089524508e+00f,
-    1.285897017e+00f,
-    1.164450049e+00f,
-    7.170979381e-01f,
-    1.530354381e+00f,
-    1.757808566e+00f,
-    1.310291767e+00f,
-    1.473291278e+00f,
-    1.828645349e+00f,
-    7.868696451e-01f,
-    1.011851549e+00f,
-    1.692621827e+00f,
-    7.557134032e-01f,
-    1.004360557e+00f,
-    1.199832082e+00f,
-    1.392162204e+00f,
-    1.089638352e+00f,
-    1.743316889e+00f,
-    8.510990143e-01f,
-    2.222756624e+00f,
-    7.121367455e-01f,
-    5.239607096e-01f,
-    1.143032908e+00f,
-    1.459276438e+00f,
-    5.699009299e-01f,
-    1.611369729e+00f,
-    8.556161523e-01f,
-    1.186303020e+00f,
-    6.710399985e-01f,
-    8.246915340e-01f,
-    4.848452508e-01f,
-    1.221446395e+00f,
-    8.369516730e-01f,
-    9.204023480e-01f,
-    5.538944006e-01f,
-    1.249811649e+00f,
-    1.307724953e+00f,
-    7.300835252e-01f,
-    6.279159784e-01f,
-    6.125047207e-01f,
-    9.492899776e-01f,
-    9.040791988e-01f,
-    7.151120305e-01f,
-    7.951775789e-01f,
-    9.113847613e-01f,
-    1.580394149e+00f,
-    1.256893992e+00f,
-    4.856379330e-01f,
-    6.689665318e-01f,
-    6.914911866e-01f,
-    3.048721313e+00f,
-    9.064557552e-01f,
-    2.070546389e+00f,
-    1.214229703e+00f,
-    1.159197569e+00f,
-    1.487230659e+00f,
-    1.383400202e+00f,
-    2.774008989e+00f,
-    6.503635883e+00f,
-    1.275810599e+00f,
-    1.275646806e+00f,
-    3.282676637e-01f,
-    8.802844286e-01f,
-    7.804132104e-01f,
-    1.050273180e+00f,
-    1.932849050e+00f,
-    7.343505025e-01f,
-    3.045120955e+00f,
-    3.090731621e+00f,
-    7.735599279e-01f,
-    1.888888001e+00f,
-    8.697682023e-01f,
-    9.794505239e-01f,
-    2.100137472e+00f,
-    8.955436945e-01f,
-    1.449039459e+00f,
-    9.192236066e-01f,
-    1.317955375e+00f,
-    2.226058006e+00f,
-    9.740228057e-01f,
-    1.230445981e+00f,
-    7.822676301e-01f,
-    6.268203855e-01f,
-    1.306637764e+00f,
-    8.523647189e-01f,
-    6.556397676e-01f,
-    1.651546001e+00f,
-    1.106221795e+00f,
-    2.256876707e+00f,
-    1.001893163e+00f,
-    1.020566225e+00f,
-    1.323958993e+00f,
-    1.599123716e+00f,
-    2.122660160e+00f,
-    1.331913590e+00f,
-    1.706644177e+00f,
-    1.913359046e+00f,
-    9.662987590e-01f,
-    2.571352243e+00f,
-    1.280536652e+00f,
-    1.387105823e+00f,
-    1.200427771e+00f,
-    1.104790330e+00f,
-    2.603674173e+00f,
-    6.389880180e-01f,
-    1.216515899e+00f,
-    2.551156044e+00f,
-    1.161828756e+00f,
-    7.737116218e-01f,
-    8.432913423e-01f,
-    8.138688803e-01f,
-    7.074948549e-01f,
-    1.183711410e+00f,
-    1.096323252e+00f,
-    6.408141851e-01f,
-    7.266638875e-01f,
-    7.403227687e-01f,
-    1.447098494e+00f,
-    9.976769090e-01f,
-    8.231113553e-01f,
-    6.928837299e-01f,
-    2.098518610e+00f,
-    1.569294333e+00f,
-    1.498788595e+00f,
-    1.426286578e+00f,
-    8.538632393e-01f,
-    9.303666949e-01f,
-    8.207072020e-01f,
-    8.385173678e-01f,
-    6.499029398e-01f,
-    7.771982551e-01f,
-    4.865819514e-01f,
-    9.142056108e-01f,
-    5.733786821e-01f,
-    9.018989801e-01f,
-    1.807882309e+00f,
-    8.238246441e-01f,
-    3.327912390e-01f,
-    3.684583604e-01f,
-    1.415093422e+00f,
-    1.237246871e+00f,
-    5.954700708e-01f,
-    9.888899922e-01f,
-    7.587284446e-01f,
-    6.283357739e-01f,
-    6.042036414e-01f,
-    1.555738688e+00f,
-    6.468537450e-01f,
-    7.406637669e-01f,
-    2.156393051e+00f,
-    1.064303637e+00f,
-    9.442161322e-01f,
-    1.037005305e+00f,
-    8.184576035e-01f,
-    1.042235494e+00f,
-    6.121939421e-01f,
-    6.216508746e-01f,
-    1.836823702e+00f,
-    8.266324997e-01f,
-    1.319155812e+00f,
-    6.350097656e-01f,
-    6.229208708e-01f,
-    8.229096532e-01f,
-    1.067054510e+00f,
-    1.097546458e+00f,
-    1.642057747e-01f,
-    1.111067891e+00f,
-    1.766247034e+00f,
-    6.086345911e-01f,
-    4.355703294e-01f,
-    1.244638190e-01f,
-    1.326715112e+00f,
-    4.734789729e-01f,
-    8.953313231e-01f,
-    1.842219383e-01f,
-    5.583844185e-01f,
-    1.160143614e+00f,
-    7.517423630e-01f,
-    2.365743071e-01f,
-    3.517198563e-01f,
-    7.116119266e-01f,
-    1.223562360e+00f,
-    1.757271528e+00f,
-    1.276537299e+00f,
-    1.230548620e+00f,
-    5.717235208e-01f,
-    1.026577711e+00f,
-    1.572335362e+00f,
-    2.767143488e+00f,
-    1.288561106e+00f,
-    1.573377132e+00f,
-    1.604795337e+00f,
-    8.949878812e-01f,
-    9.397076964e-01f,
-    1.270277858e+00f,
-    9.070127606e-01f,
-    2.854550362e+00f,
-    1.222622871e+00f,
-    1.332674026e+00f,
-    9.448063374e-01f,
-    1.145901203e+00f,
-    1.673647404e+00f,
-    1.094732642e+00f,
-    1.518448949e+00f,
-    1.368072391e+00f,
-    9.559875131e-01f,
-    9.033007026e-01f,
-    2.857448578e+00f,
-    9.856652021e-01f,
-    9.542028904e-01f,
-    8.630703688e-01f,
-    1.322232485e+00f,
-    1.401010633e+00f,
-    8.415607810e-01f,
-    1.197952867e+00f,
-    1.049030662e+00f,
-    6.764326692e-01f,
-    7.789617777e-01f,
-    1.123221636e+00f,
-    9.332250357e-01f,
-    7.625628114e-01f,
-    7.613774538e-01f,
-    4.690105617e-01f,
-    3.511227071e-01f,
-    5.487446189e-01f,
-    1.162997365e+00f,
-    1.252188563e+00f,
-    2.675470114e+00f,
-    1.041091919e+00f,
-    1.416592360e+00f,
-    1.691510320e+00f,
-    1.327261686e+00f,
-    1.062480807e+00f,
-    1.226850748e+00f,
-    6.160135865e-01f,
-    1.127289057e+00f,
-    7.789558172e-01f,
-    1.543010592e+00f,
-    6.613001823e-01f,
-    9.945272803e-01f,
-    8.671780229e-01f,
-    1.871094465e+00f,
-    1.558502913e+00f,
-    1.690299988e+00f,
-    1.821840286e+00f,
-    1.412802458e+00f,
-    1.164929032e+00f,
-    1.153697491e+00f,
-    9.223424792e-01f,
-    1.794566154e+00f,
-    1.352727532e+00f,
-    1.434559464e+00f,
-    9.563500285e-01f,
-    1.052857757e+00f,
-    1.179062366e+00f,
-    5.951988101e-01f,
-    8.303242326e-01f,
-    1.398422241e+00f,
-    1.229603291e+00f,
-    1.542786002e+00f,
-    2.986271143e+00f,
-    4.687855840e-01f,
-    6.206029654e-01f,
-    6.033458710e-01f,
-    7.869692445e-01f,
-    7.244687676e-01f,
-    6.819571257e-01f,
-    8.068898320e-01f,
-    8.866733909e-01f,
-    1.652262211e+00f,
-    1.001194239e+00f,
-    5.958914161e-01f,
-    6.289629936e-01f,
-    5.703745484e-01f,
-    1.918426275e+00f,
-    1.417237639e+00f,
-    1.114811063e+00f,
-    6.776106358e-01f,
-    1.197000504e+00f,
-    5.873348713e-01f,
-    1.317275405e+00f,
-    6.516985893e-01f,
-    4.882963598e-01f,
-    6.758536696e-01f,
-    1.405508280e+00f,
-    1.579179287e+00f,
-    5.642777085e-01f,
-    5.830379128e-01f,
-    2.113560677e+00f,
-    6.684538126e-01f,
-    4.327023625e-01f,
-    1.526300669e+00f,
-    2.709367514e+00f,
-    9.053094983e-01f,
-    1.109012365e+00f,
-    1.406121612e+00f,
-    1.373907447e+00f,
-    8.269150853e-01f,
-    1.325981855e+00f,
-    2.003343821e+00f,
-    1.067523122e+00f,
-    2.741394520e+00f,
-    1.287435293e+00f,
-    1.424820662e+00f,
-    7.140401006e-01f,
-    1.421298862e+00f,
-    5.052060485e-01f,
-    8.001475930e-01f,
-    1.363968611e+00f,
-    6.060961485e-01f,
-    1.375668883e+00f,
-    9.604386687e-01f,
-    1.034771085e+00f,
-    1.639856339e+00f,
-    1.155462623e+00f,
-    7.895652056e-01f,
-    1.853124261e+00f,
-    1.039219618e+00f,
-    7.833787799e-01f,
-    1.548977137e+00f,
-    1.537243843e+00f,
-    1.296504259e+00f,
-    8.232010007e-01f,
-    1.238692164e+00f,
-    6.323022246e-01f,
-    6.492922902e-01f,
-    8.843764663e-01f,
-    7.652999163e-01f,
-    9.011172056e-01f,
-    6.551631093e-01f,
-    8.306531906e-01f,
-    7.702413201e-01f,
-    1.598202705e+00f,
-    8.498801589e-01f,
-    1.004932284e+00f,
-    1.820413470e+00f,
-    9.549641013e-01f,
-    7.587532401e-01f,
-    9.804204106e-01f,
-    8.292344213e-01f,
-    7.844827771e-01f,
-    5.445886254e-01f,
-    1.049173594e+00f,
-    7.395693064e-01f,
-    1.274817348e+00f,
-    9.915356636e-01f,
-    1.475687385e+00f,
-    5.291535854e-01f,
-    9.144657254e-01f,
-    1.037056923e+00f,
-    1.020421624e+00f,
-    5.102390647e-01f,
-    8.568861485e-01f,
-    8.927888274e-01f,
-    1.076208949e+00f,
-    4.644165635e-01f,
-    5.369125605e-01f,
-    4.399315715e-01f,
-    1.117980003e+00f,
-    9.208129048e-01f,
-    1.183488607e+00f,
-    1.042365789e+00f,
-    5.405613780e-01f,
-    1.054340601e+00f,
-    1.061639905e+00f,
-    6.565570831e-01f,
-    8.078864813e-01f,
-    8.036289811e-01f,
-    1.337630749e+00f,
-    9.201146364e-01f,
-    1.806736588e+00f,
-    6.455450058e-01f,
-    1.369445920e+00f,
-    5.828680992e-01f,
-    7.791498303e-01f,
-    4.010013938e-01f,
-    9.603052139e-01f,
-    5.415872335e-01f,
-    6.111406684e-01f,
-    6.235074997e-01f,
-    1.332256556e+00f,
-    1.085005760e+00f,
-    6.844272017e-01f,
-    2.395071089e-01f,
-    1.100847200e-01f,
-    1.237985492e+00f,
-    1.628709078e+00f,
-    1.225313783e+00f,
-    3.795874715e-01f,
-    1.433779836e+00f,
-    5.431552529e-01f,
-    1.193400502e+00f,
-    4.922916889e-01f,
-    4.757245779e-01f,
-    1.768609762e+00f,
-    6.674836874e-01f,
-    8.241571784e-01f,
-    1.472090721e+00f,
-    1.212578893e+00f,
-    6.247935295e-01f,
-    1.017343044e+00f,
-    8.465362191e-01f,
-    1.468660951e+00f,
-    1.458412886e+00f,
-    7.290859818e-01f,
-    1.470305324e+00f,
-    8.119015694e-01f,
-    6.748719811e-01f,
-    3.128695250e+00f,
-    9.287447333e-01f,
-    1.932268381e+00f,
-    1.002323031e+00f,
-    1.010569096e+00f,
-    9.957441688e-01f,
-    1.106871367e+00f,
-    2.137059212e+00f,
-    5.512767434e-01f,
-    1.155707955e+00f,
-    1.248878717e+00f,
-    1.307564378e+00f,
-    6.287404299e-01f,
-    8.795742989e-01f,
-    1.390220761e+00f,
-    8.087922931e-01f,
-    7.055448890e-01f,
-    6.427517533e-01f,
-    1.151078463e+00f,
-    5.898891091e-01f,
-    1.140863180e+00f,
-    9.476754665e-01f,
-    7.583308220e-01f,
-    1.301655173e+00f,
-    1.006167769e+00f,
-    1.406736016e+00f,
-    1.334066629e+00f,
-    5.805367231e-01f,
-    1.576591730e+00f,
-    9.776169658e-01f,
-    5.189311504e-01f,
-    5.307587981e-01f,
-    5.392889380e-01f,
-    1.146507740e+00f,
-    9.848410487e-01f,
-    8.862997890e-01f,
-    1.407214522e+00f,
-    8.037511110e-01f,
-    9.384561181e-01f,
-    5.228379369e-01f,
-    5.001286268e-01f,
-    8.666608930e-01f,
-    6.261371374e-01f,
-    2.484988928e+00f,
-    1.163155437e+00f,
-    2.963713884e+00f,
-    8.149418235e-01f,
-    1.124472976e+00f,
-    1.001059771e+00f,
-    8.088064194e-01f,
-    1.518442631e+00f,
-    1.473717213e+00f,
-    1.224524975e+00f,
-    1.800653338e+00f,
-    1.170385480e+00f,
-    1.320238590e+00f,
-    2.984370887e-01f,
-    2.336369753e-01f,
-    1.668737769e+00f,
-    4.906534553e-01f,
-    8.395588994e-01f,
-    8.398113251e-01f,
-    1.007359266e+00f,
-    1.564057827e+00f,
-    1.486843348e+00f,
-    5.656076670e-01f,
-    8.347240686e-01f,
-    1.207208395e+00f,
-    1.496665239e+00f,
-    1.239452004e+00f,
-    2.028264761e+00f,
-    1.326038718e+00f,
-    2.304580927e+00f,
-    1.840910435e+00f,
-    1.001951933e+00f,
-    9.919895530e-01f,
-    1.269888639e+00f,
-    9.096297026e-01f,
-    6.888107657e-01f,
-    1.299998045e+00f,
-    1.264809728e+00f,
-    1.598719597e+00f,
-    8.691859245e-01f,
-    1.450080991e+00f,
-    1.245144010e+00f,
-    7.488341331e-01f,
-    8.325061202e-01f,
-    1.090557337e+00f,
-    1.978382230e+00f,
-    1.480550528e+00f,
-    7.950642705e-01f,
-    7.105357647e-01f,
-    7.451319098e-01f,
-    1.460690498e+00f,
-    1.119813681e+00f,
-    7.422693968e-01f,
-    7.528769374e-01f,
-    3.854791820e-01f,
-    7.134789228e-01f,
-    7.112935781e-01f,
-    1.474894524e+00f,
-    8.135555983e-01f,
-    1.208750486e+00f,
-    1.005416036e+00f,
-    1.014143586e+00f,
-    1.518766761e+00f,
-    2.032489538e+00f,
-    1.174922824e+00f,
-    7.372984290e-01f,
-    1.157866240e+00f,
-    1.559178472e+00f,
-    6.932431459e-01f,
-    1.152166605e+00f,
-    1.742357135e+00f,
-    1.154184937e+00f,
-    8.585417867e-01f,
-    8.910623193e-01f,
-    1.273260713e+00f,
-    1.101177335e+00f,
-    1.056429863e+00f,
-    6.346440315e-01f,
-    1.375528097e+00f,
-    6.691811681e-01f,
-    5.380141139e-01f,
-    1.091116428e+00f,
-    8.925123215e-01f,
-    6.862757206e-01f,
-    1.146267176e+00f,
-    7.062247396e-01f,
-    1.351661325e+00f,
-    1.094243288e+00f,
-    1.159968495e+00f,
-    5.680994987e-01f,
-    1.187145472e+00f,
-    2.791584253e+00f,
-    7.451192141e-01f,
-    6.680200100e-01f,
-    6.636713147e-01f,
-    1.231401563e+00f,
-    6.618638635e-01f,
-    5.431812406e-01f,
-    1.001785040e+00f,
-    2.432838917e+00f,
-    7.227229476e-01f,
-    9.501446486e-01f,
-    1.123184919e+00f,
-    1.062711954e+00f,
-    7.020242214e-01f,
-    1.185600877e+00f,
-    1.544341683e+00f,
-    1.566526175e+00f,
-    2.489023685e+00f,
-    1.286990643e+00f,
-    9.019975662e-01f,
-    5.775338411e-01f,
-    1.422452331e+00f,
-    1.687186956e+00f,
-    7.276486754e-01f,
-    5.131329298e-01f,
-    1.185700417e+00f,
-    1.001867056e+00f,
-    9.289638996e-01f,
-    1.084835052e+00f,
-    9.585695267e-01f,
-    9.000696540e-01f,
-    1.053211927e+00f,
-    9.273280501e-01f,
-    1.051616192e+00f,
-    9.439803362e-01f,
-    5.925107598e-01f,
-    1.269999504e+00f,
-    6.937665939e-01f,
-    1.247657895e+00f,
-    9.439989328e-01f,
-    5.504994392e-01f,
-    1.068795800e+00f,
-    1.167661309e+00f,
-    1.257927299e+00f,
-    5.187010765e-01f,
-    2.790947258e-01f,
-    8.177595735e-01f,
-    3.583836257e-01f,
-    7.988653183e-01f,
-    8.009541035e-01f,
-    1.055156469e+00f,
-    8.685911894e-01f,
-    6.328941584e-01f,
-    3.221870959e-01f,
-    1.147497535e+00f,
-    3.977589905e-01f,
-    2.652532816e+00f,
-    9.248104095e-01f,
-    1.329950094e+00f,
-    2.148369074e+00f,
-    7.529194951e-01f,
-    4.003130496e-01f,
-    5.517205596e-01f,
-    8.811863661e-01f,
-    1.206928015e+00f,
-    8.755539656e-01f,
-    1.049033284e+00f,
-    5.372810364e-01f,
-    4.121773839e-01f,
-    5.017406940e-01f,
-    5.641536713e-01f,
-    1.452149749e+00f,
-    3.833001554e-01f,
-    6.241021752e-01f,
-    4.909263253e-01f,
-    7.331607342e-01f,
-    6.694472432e-01f,
-    4.016755819e-01f,
-    4.893980324e-01f,
-    4.350251555e-01f,
-    9.201169014e-01f,
-    3.007169366e-01f,
-    7.071430683e-01f,
-    1.286868334e+00f,
-    4.171777368e-01f,
-    1.390668511e+00f,
-    2.106405258e+00f,
-    1.132708430e+00f,
-    1.309681296e+00f,
-    8.341218829e-01f,
-    6.591505408e-01f,
-    7.194542289e-01f,
-    8.452587724e-01f,
-    7.772181630e-01f,
-    6.141542196e-01f,
-    9.011176229e-01f,
-    1.359413981e+00f,
-    1.220250249e+00f,
-    8.076051474e-01f,
-    5.629969835e-01f,
-    1.414045334e+00f,
-    9.040935636e-01f,
-    4.434459805e-01f,
-    3.167378008e-01f,
-    3.972361088e-01f,
-    1.709949970e+00f,
-    9.248303771e-01f,
-    1.593964219e+00f,
-    1.933897376e+00f,
-    1.921318412e+00f,
-    1.796800375e+00f,
-    1.326583982e+00f,
-    1.631973028e+00f,
-    1.084296107e+00f,
-    1.344729781e+00f,
-    8.251965642e-01f,
-    8.927147985e-01f,
-    1.174961805e+00f,
-    1.779515982e+00f,
-    2.301085472e+00f,
-    1.719725609e+00f,
-    7.753257751e-01f,
-    1.112909317e+00f,
-    1.876219749e+00f,
-    1.291871071e+00f,
-    1.607253671e+00f,
-    1.761280775e+00f,
-    1.783904672e+00f,
-    5.984367728e-01f,
-    1.175703049e+00f,
-    8.802290559e-01f,
-    5.982841849e-01f,
-    7.962694168e-01f,
-    1.349433422e+00f,
-    1.829785347e+00f,
-    1.661141515e+00f,
-    7.871884108e-01f,
-    5.981948972e-01f,
-    7.810598612e-01f,
-    1.967683434e+00f,
-    6.478208899e-01f,
-    1.078622699e+00f,
-    7.121990919e-01f,
-    1.187588692e+00f,
-    1.522877097e+00f,
-    1.430569649e+00f,
-    8.787001967e-01f,
-    2.228744268e+00f,
-    8.171853423e-01f,
-    1.906016350e+00f,
-    1.322602272e+00f,
-    1.356783032e+00f,
-    1.573288679e+00f,
-    1.086365938e+00f,
-    1.275345445e+00f,
-    1.019056559e+00f,
-    1.076563120e+00f,
-    1.315702081e+00f,
-    8.507908583e-01f,
-    6.710555553e-01f,
-    1.365989566e+00f,
-    8.179656863e-01f,
-    1.063270450e+00f,
-    1.184154630e+00f,
-    1.459043145e+00f,
-    1.579793572e+00f,
-    2.787827492e+00f,
-    1.051445961e+00f,
-    4.205068111e+00f,
-    5.915865898e-01f,
-    1.351923108e+00f,
-    7.858522534e-01f,
-    7.894451022e-01f,
-    7.889360785e-01f,
-    1.064245343e+00f,
-    1.109755158e+00f,
-    1.326428890e+00f,
-    1.973817348e+00f,
-    1.105202794e+00f,
-    8.963144422e-01f,
-    9.794238806e-01f,
-    8.195875883e-01f,
-    7.121060491e-01f,
-    1.736206651e+00f,
-    1.081529021e+00f,
-    8.368789554e-01f,
-    1.512644053e+00f,
-    2.517259121e+00f,
-    1.070760965e+00f,
-    1.688726902e+00f,
-    1.696998835e+00f,
-    9.304246306e-01f,
-    5.497676134e-01f,
-    1.136701584e+00f,
-    1.390057564e+00f,
-    1.156784415e+00f,
-    9.783310890e-01f,
-    7.974956036e-01f,
-    1.215307951e+00f,
-    9.697525501e-01f,
-    2.926786542e-01f,
-    4.591972232e-01f,
-    8.306623101e-01f,
-    1.162395358e+00f,
-    1.019296050e+00f,
-    1.217792273e+00f,
-    1.025952935e+00f,
-    7.916010022e-01f,
-    1.084474921e+00f,
-    7.011108398e-01f,
-    8.088325262e-01f,
-    7.259163260e-01f,
-    8.593293428e-01f,
-    1.531877637e+00f,
-    1.149191141e+00f,
-    7.876302004e-01f,
-    1.305030704e+00f,
-    7.631323338e-01f,
-    4.355169535e-01f,
-    1.393201113e+00f,
-    8.962246776e-01f,
-    1.504355669e+00f,
-    4.211062491e-01f,
-    7.393474579e-01f,
-    5.785450935e-01f,
-    7.760328650e-01f,
-    8.116809726e-01f,
-    8.361452818e-01f,
-    1.319871068e+00f,
-    7.124774456e-01f,
-    1.063367486e+00f,
-    4.770438373e-01f,
-    6.632755995e-01f,
-    6.089586616e-01f,
-    7.598280311e-01f,
-    9.478255510e-01f,
-    1.005122423e+00f,
-    8.117467165e-01f,
-    8.907814026e-01f,
-    1.509904385e+00f,
-    8.298833966e-01f,
-    5.281020999e-01f,
-    1.306706071e+00f,
-    8.876516819e-01f,
-    1.700148821e+00f,
-    1.618113279e+00f,
-    1.008934736e+00f,
-    7.635710835e-01f,
-    4.326146841e-01f,
-    1.061573148e+00f,
-    1.027715325e+00f,
-    4.065242112e-01f,
-    7.847142816e-01f,
-    1.280719280e+00f,
-    1.017215371e+00f,
-    1.282815337e+00f,
-    6.707574129e-01f,
-    1.523943663e+00f,
-    1.057860732e+00f,
-    7.921815515e-01f,
-    9.210577607e-01f,
-    3.393942416e-01f,
-    1.295098543e+00f,
-    4.689759314e-01f,
-    8.022665977e-01f,
-    8.718416691e-01f,
-    7.389008999e-01f,
-    6.633073092e-01f,
-    1.168875337e+00f,
-    6.116209626e-01f,
-    1.414834559e-01f,
-    1.556378126e+00f,
-    9.449232221e-01f,
-    1.303831816e+00f,
-    9.900986552e-01f,
-    7.975554466e-01f,
-    1.328458905e+00f,
-    5.435746908e-01f,
-    9.612567425e-01f,
-    1.032720327e+00f,
-    8.096842170e-01f,
-    7.671039104e-01f,
-    9.471787214e-01f,
-    1.269394875e+00f,
-    1.145982027e+00f,
-    7.786026597e-01f,
-    1.187978506e+00f,
-    8.468974233e-01f,
-    7.089933753e-01f,
-    2.075167894e+00f,
-    1.179076076e+00f,
-    1.749667764e+00f,
-    1.716793060e+00f,
-    1.575740218e+00f,
-    1.528446317e+00f,
-    5.704101324e-01f,
-    1.291972399e+00f,
-    1.534211278e+00f,
-    2.085853815e+00f,
-    1.820493221e+00f,
-    6.087261438e-01f,
-    1.181707025e+00f,
-    1.377253294e+00f,
-    1.352005363e+00f,
-    7.872675061e-01f,
-    1.063773632e+00f,
-    6.418880224e-01f,
-    1.061127663e+00f,
-    5.950270295e-01f,
-    1.769734025e+00f,
-    1.023094654e+00f,
-    1.112852812e+00f,
-    5.977629423e-01f,
-    1.612651944e+00f,
-    7.419215441e-01f,
-    1.145139098e+00f,
-    7.295345068e-01f,
-    8.019401431e-01f,
-    6.624056697e-01f,
-    1.495806098e+00f,
-    7.562660575e-01f,
-    1.132588029e+00f,
-    2.066994429e+00f,
-    1.486111522e+00f,
-    1.335272074e+00f,
-    5.402595997e-01f,
-    4.062917531e-01f,
-    5.254358649e-01f,
-    1.140343904e+00f,
-    1.084462404e+00f,
-    2.139068127e+00f,
-    9.600995779e-01f,
-    9.131845236e-01f,
-    1.030455351e+00f,
-    1.193324566e+00f,
-    7.080329657e-01f,
-    6.289099216e+00f,
-    1.740174174e+00f,
-    1.810624838e+00f,
-    1.045671940e+00f,
-    5.890948176e-01f,
-    7.577961683e-01f,
-    6.574224234e-01f,
-    1.256404161e+00f,
-    1.737327933e+00f,
-    1.084056616e+00f,
-    1.260108471e+00f,
-    7.355167866e-01f,
-    2.293723583e+00f,
-    5.367907882e-01f,
-    1.263453841e+00f,
-    1.203826189e+00f,
-    2.852990866e+00f,
-    1.582510948e+00f,
-    8.101147652e+00f,
-    1.102184176e+00f,
-    5.913950205e-01f,
-    1.270894051e+00f,
-    9.286359549e-01f,
-    1.630851150e+00f,
-    9.420046806e-01f,
-    9.361891150e-01f,
-    7.710869312e-01f,
-    1.427360654e+00f,
-    1.704534650e+00f,
-    5.309570432e-01f,
-    2.225757122e+00f,
-    1.735437751e+00f,
-    6.475390196e-01f,
-    1.399801731e+00f,
-    1.085970759e+00f,
-    3.876265585e-01f,
-    9.472696781e-01f,
-    8.222766519e-01f,
-    6.288166642e-01f,
-    8.738363385e-01f,
-    8.307753205e-01f,
-    6.129838824e-01f,
-    9.690220952e-01f,
-    1.227048159e+00f,
-    4.923652709e-01f,
-    1.154772758e+00f,
-    8.540759683e-01f,
-    1.138345361e+00f,
-    7.082403898e-01f,
-    1.809877515e+00f,
-    7.912259102e-01f,
-    1.402029037e+00f,
-    6.327750087e-01f,
-    1.429416060e+00f,
-    1.632694483e+00f,
-    5.647435784e-01f,
-    1.612389445e+00f,
-    9.317595363e-01f,
-    1.078182697e+00f,
-    6.306701303e-01f,
-    1.196445704e+00f,
-    6.977347732e-01f,
-    8.533566594e-01f,
-    9.181352854e-01f,
-    1.853740215e+00f,
-    8.850966692e-01f,
-    8.765596747e-01f,
-    1.276046991e+00f,
-    1.249052286e+00f,
-    1.617704868e+00f,
-    3.652920485e+00f,
-    3.059496641e+00f,
-    1.000506401e+00f,
-    7.841694355e-01f,
-    1.593172431e+00f,
-    1.251730204e+00f,
-    1.263602972e+00f,
-    1.343167782e+00f,
-    9.733338952e-01f,
-    8.437748551e-01f,
-    9.105762839e-01f,
-    1.565640211e+00f,
-    7.745856643e-01f,
-    1.534371853e+00f,
-    1.157914996e+00f,
-    9.034926891e-01f,
-    9.962051511e-01f,
-    1.237748146e+00f,
-    1.028099298e+00f,
-    9.001474977e-01f,
-    8.694326282e-01f,
-    1.589995384e+00f,
-    1.147063613e+00f,
-    1.159462333e+00f,
-    9.679012895e-01f,
-    1.237773895e+00f,
-    1.155229092e+00f,
-    1.195693612e+00f,
-    4.241707325e-01f,
-    1.166141391e+00f,
-    8.990364075e-01f,
-    1.271819949e+00f,
-    1.858245730e+00f,
-    7.025533915e-01f,
-    1.832576275e+00f,
-    6.963253617e-01f,
-    1.061515808e+00f,
-    4.004712403e-01f,
-    1.430096865e+00f,
-    9.324943423e-01f,
-    9.879053831e-01f,
-    8.556579351e-01f,
-    8.606046438e-01f,
-    1.559301019e+00f,
-    8.718754053e-01f,
-    1.023639560e+00f,
-    1.402602434e+00f,
-    9.931961298e-01f,
-    1.120533824e+00f,
-    7.254836559e-01f,
-    1.512953043e+00f,
-    6.151627898e-01f,
-    1.202508330e+00f,
-    7.965431809e-01f,
-    1.353505850e+00f,
-    1.102401137e+00f,
-    8.616526723e-01f,
-    7.064670324e-01f,
-    7.633345723e-01f,
-    8.069831729e-01f,
-    4.958530068e-01f,
-    9.982558489e-01f,
-    9.435397983e-01f,
-    1.028662324e+00f,
-    7.582300305e-01f,
-    1.033749700e+00f,
-    1.512492895e+00f,
-    6.365094781e-01f,
-    8.612225056e-01f,
-    6.521273255e-01f,
-    1.324263215e+00f,
-    6.541690230e-01f,
-    1.733477473e+00f,
-    1.110471129e+00f,
-    4.866534472e-01f,
-    9.134212732e-01f,
-    8.107865453e-01f,
-    1.179889679e+00f,
-    1.434652328e+00f,
-    2.372207165e+00f,
-    1.032886863e+00f,
-    1.320742846e+00f,
-    8.188055158e-01f,
-    8.184855580e-01f,
-    1.039535642e+00f,
-    1.047674656e+00f,
-    9.205471277e-01f,
-    1.219707489e+00f,
-    1.585771084e+00f,
-    6.948690414e-01f,
-    1.268399954e+00f,
-    3.416221380e+00f,
-    1.126203179e+00f,
-    8.099174500e-01f,
-    1.770915985e+00f,
-    1.286067724e+00f,
-    9.329380393e-01f,
-    9.596177340e-01f,
-    1.089230061e+00f,
-    9.286391139e-01f,
-    1.043404460e+00f,
-    5.685538054e-01f,
-    1.399253488e+00f,
-    9.081939459e-01f,
-    1.815764308e+00f,
-    1.544948101e+00f,
-    1.235812426e+00f,
-    8.344638944e-01f,
-    1.668025732e+00f,
-    2.127787590e+00f,
-    7.533189058e-01f,
-    1.219627500e+00f,
-    6.511237025e-01f,
-    2.093659163e+00f,
-    1.281050801e+00f,
-    9.902962446e-01f,
-    8.673728704e-01f,
-    8.079292774e-01f,
-    9.150694013e-01f,
-    1.654456258e+00f,
-    1.035621166e+00f,
-    1.390484691e+00f,
-    9.183197021e-01f,
-    1.042312145e+00f,
-    1.264487743e+00f,
-    8.935536742e-01f,
-    2.288302898e+00f,
-    8.357023597e-01f,
-    5.409055352e-01f,
-    1.462293386e+00f,
-    2.251233578e+00f,
-    2.536714792e+00f,
-    9.758464098e-01f,
-    9.872329831e-01f,
-    1.189685106e+00f,
-    9.528973103e-01f,
-    7.594603896e-01f,
-    1.687021852e+00f,
-    1.773581266e+00f,
-    1.084313750e+00f,
-    1.072754025e+00f,
-    8.411140442e-01f,
-    7.696631551e-01f,
-    1.023253679e+00f,
-    1.710927010e+00f,
-    1.591969252e+00f,
-    1.652529001e+00f,
-    1.296342969e+00f,
-    1.577351451e+00f,
-    2.840603590e+00f,
-    2.010063648e+00f,
-    8.754267097e-01f,
-    1.085703373e+00f,
-    1.330613494e+00f,
-    9.412230253e-01f,
-    1.060962796e+00f,
-    2.873063564e+00f,
-    2.004184723e+00f,
-    7.921627164e-01f,
-    1.306079507e+00f,
-    1.261337876e+00f,
-    7.000689507e-01f,
-    5.707244873e-01f,
-    8.606314659e-01f,
-    8.922699690e-01f,
-    9.086981416e-01f,
-    1.231097698e+00f,
-    1.288368225e+00f,
-    9.116665721e-01f,
-    4.851731360e-01f,
-    7.929491997e-01f,
-    7.037671208e-01f,
-    1.348300219e+00f,
-    9.321942329e-01f,
-    7.300386429e-01f,
-    1.387848258e+00f,
-    9.101862311e-01f,
-    1.412213326e+00f,
-    1.563631415e+00f,
-    6.439806223e-01f,
-    9.701418877e-01f,
-    1.169233680e+00f,
-    8.813846111e-01f,
-    1.197897553e+00f,
-    1.440128237e-01f,
-    9.392691255e-01f,
-    5.047647357e-01f,
-    6.372855306e-01f,
-    4.267134368e-01f,
-    4.501462877e-01f,
-    7.783702016e-01f,
-    6.318444014e-01f,
-    1.236473322e+00f,
-    8.857549429e-01f,
-    6.341044903e-01f,
-    6.155275702e-01f,
-    1.307147145e+00f,
-    9.108488560e-01f,
-    1.119521260e+00f,
-    6.024121046e-01f,
-    5.429117084e-01f,
-    5.702472925e-01f,
-    1.024310231e+00f,
-    1.401264668e+00f,
-    1.213558435e+00f,
-    7.114299536e-01f,
-    3.758406043e-01f,
-    1.125665784e+00f,
-    1.245153069e+00f,
-    1.058935642e+00f,
-    7.433316112e-01f,
-    1.099541664e+00f,
-    1.053621650e+00f,
-    1.181350231e+00f,
-    9.622215629e-01f,
-    1.222043395e+00f,
-    5.356482267e-01f,
-    5.734877586e-01f,
-    7.638090253e-01f,
-    1.636684895e+00f,
-    3.263888359e-01f,
-    9.553102851e-01f,
-    1.133333087e+00f,
-    1.483041048e+00f,
-    8.801140189e-01f,
-    7.321318388e-01f,
-    4.183620811e-01f,
-    1.027404785e+00f,
-    8.842932582e-01f,
-    9.907919765e-01f,
-    1.457041502e+00f,
-    7.674049139e-01f,
-    9.145979285e-01f,
-    6.815251112e-01f,
-    1.077152252e+00f,
-    5.816367865e-01f,
-    7.210987806e-01f,
-    1.074680448e+00f,
-    1.161897659e+00f,
-    1.081471920e+00f,
-    8.794284463e-01f,
-    1.336085677e+00f,
-    1.212072492e+00f,
-    5.113882422e-01f,
-    1.203075171e+00f,
-    1.001844287e+00f,
-    1.185828924e+00f,
-    1.567009568e+00f,
-    7.553454041e-01f,
-    5.902481079e-01f,
-    6.565168500e-01f,
-    8.276906013e-01f,
-    2.686559200e+00f,
-    7.125467062e-01f,
-    7.608906031e-01f,
-    1.475134611e+00f,
-    9.403128028e-01f,
-    1.544137955e+00f,
-    1.217114091e+00f,
-    4.479282200e-01f,
-    5.859420896e-01f,
-    8.943907619e-01f,
-    6.846038699e-01f,
-    1.891333699e+00f,
-    6.482024789e-01f,
-    5.014376640e-01f,
-    8.192031980e-01f,
-    1.077331305e+00f,
-    1.644269228e+00f,
-    7.643571496e-01f,
-    5.924127698e-01f,
-    8.183897734e-01f,
-    6.510565281e-01f,
-    1.199305296e+00f,
-    6.206141710e-01f,
-    1.747568727e+00f,
-    9.335503578e-01f,
-    1.109427094e+00f,
-    1.373687506e+00f,
-    9.481213093e-01f,
-    1.319172978e+00f,
-    1.729071617e+00f,
-    7.264606357e-01f,
-    1.473921299e+00f,
-    5.096837878e-01f,
-    9.015973806e-01f,
-    1.263534546e+00f,
-    6.971863508e-01f,
-    7.780426741e-01f,
-    1.220877886e+00f,
-    1.401065350e+00f,
-    7.698153853e-01f,
-    9.325352311e-01f,
-    1.115997910e+00f,
-    8.572863936e-01f,
-    1.071825147e+00f,
-    7.258731723e-01f,
-    6.021887660e-01f,
-    1.293478370e+00f,
-    2.320136070e+00f,
-    7.775121331e-01f,
-    9.855039120e-01f,
-    8.944162130e-01f,
-    1.205429316e+00f,
-    9.070758820e-01f,
-    9.300923944e-01f,
-    8.285263181e-01f,
-    1.473219275e+00f,
-    5.171340704e-01f,
-    1.261186242e+00f,
-    1.246542096e+00f,
-    6.182597280e-01f,
-    5.786122680e-01f,
-    9.570620656e-01f,
-    7.785078883e-01f,
-    7.941232324e-01f,
-    6.986806393e-01f,
-    1.224915028e+00f,
-    1.258443713e+00f,
-    1.329095960e+00f,
-    6.198036671e-01f,
-    1.319744349e+00f,
-    9.778153300e-01f,
-    2.053367376e+00f,
-    8.793950081e-01f,
-    1.503134131e+00f,
-    1.082798600e+00f,
-    1.428971887e+00f,
-    8.653953075e-01f,
-    1.070069075e+00f,
-    9.041010737e-01f,
-    1.445598722e+00f,
-    7.684119344e-01f,
-    1.253873110e+00f,
-    5.529829860e-01f,
-    8.173915744e-01f,
-    8.057457209e-01f,
-    2.169446230e+00f,
-    1.272981286e+00f,
-    1.074617863e+00f,
-    5.908046961e-01f,
-    6.577087045e-01f,
-    1.418826461e+00f,
-    5.526286960e-01f,
-    7.146219015e-01f,
-    8.701221943e-01f,
-    1.005134583e+00f,
-    8.535310626e-01f,
-    7.421917319e-01f,
-    1.378979206e+00f,
-    5.637724400e-01f,
-    6.233974695e-01f,
-    1.937406540e+00f,
-    1.566987395e+00f,
-    9.993528724e-01f,
-    6.349006295e-01f,
-    1.216024399e+00f,
-    7.452153563e-01f,
-    9.066373706e-01f,
-    1.492729425e+00f,
-    1.108216286e+00f,
-    6.457900405e-01f,
-    1.049899936e+00f,
-    6.673603058e-01f,
-    1.061043143e+00f,
-    5.439369082e-01f,
-    1.813198566e+00f,
-    1.152772903e+00f,
-    1.193929553e+00f,
-    1.490210056e+00f,
-    6.537412405e-01f,
-    2.823978364e-01f,
-    8.790834546e-01f,
-    1.219912529e+00f,
-    5.276970863e-01f,
-    1.382656217e+00f,
-    1.099370599e+00f,
-    5.315533876e-01f,
-    5.587390065e-01f,
-    5.985753536e-01f,
-    4.509218633e-01f,
-    7.496480346e-01f,
-    1.046369314e+00f,
-    8.786435127e-01f,
-    8.992590308e-01f,
-    5.156142712e-01f,
-    2.825090408e+00f,
-    7.259500623e-01f,
-    1.114080310e+00f,
-    1.548073173e+00f,
-    1.405601740e+00f,
-    1.069463968e+00f,
-    7.250958681e-01f,
-    5.043287873e-01f,
-    8.064150810e-01f,
-    3.915643990e-01f,
-    7.745854855e-01f,
-    1.131780982e+00f,
-    5.513194203e-01f,
-    1.213662148e+00f,
-    6.440369487e-01f,
-    1.291591167e+00f,
-    1.979152441e+00f,
-    8.398517370e-01f,
-    1.187584400e+00f,
-    1.102887273e+00f,
-    1.204750657e+00f,
-    1.008614182e+00f,
-    9.289733768e-01f,
-    7.285086513e-01f,
-    8.944624662e-01f,
-    9.848679304e-01f,
-    1.458672523e+00f,
-    1.161972404e+00f,
-    9.189016819e-01f,
-    1.047176123e+00f,
-    1.180603027e+00f,
-    1.033357143e+00f,
-    1.757042289e+00f,
-    1.023873329e+00f,
-    6.572564840e-01f,
-    1.529390574e+00f,
-    1.275768876e+00f,
-    1.134999514e+00f,
-    1.111268520e+00f,
-    7.414668798e-01f,
-    1.019492626e+00f,
-    7.583031654e-01f,
-    7.701246142e-01f,
-    1.033806205e+00f,
-    1.410783291e+00f,
-    1.535043716e+00f,
-    2.131986380e+00f,
-    7.825591564e-01f,
-    9.987705350e-01f,
-    1.281069636e+00f,
-    1.207931757e+00f,
-    8.419662714e-01f,
-    7.697055936e-01f,
-    7.702814937e-01f,
-    1.226328611e+00f,
-    4.401129782e-01f,
-    5.034359097e-01f,
-    1.704160929e+00f,
-    5.564502478e-01f,
-    5.411659479e-01f,
-    8.363872766e-01f,
-    1.737993240e+00f,
-    3.400757313e-01f,
-    8.752409816e-01f,
-    9.392976761e-01f,
-    9.298105240e-01f,
-    1.819157720e+00f,
-    4.659669995e-01f,
-    5.565611720e-01f,
-    4.014385641e-01f,
-    1.856330872e+00f,
-    8.875958323e-01f,
-    9.712355137e-01f,
-    1.166178107e+00f,
-    2.087750912e+00f,
-    5.553321838e-01f,
-    1.153485775e+00f,
-    1.456242681e+00f,
-    5.993840098e-01f,
-    9.301749468e-01f,
-    7.732685208e-01f,
-    1.029120088e+00f,
-    9.633221030e-01f,
-    1.313308477e+00f,
-    9.315475821e-01f,
-    1.005530357e+00f,
-    7.502657175e-01f,
-    1.645339489e+00f,
-    1.699349046e+00f,
-    9.164506793e-01f,
-    1.148049235e+00f,
-    1.000346899e+00f,
-    1.837385535e+00f,
-    2.022299051e+00f,
-    1.153775096e+00f,
-    1.285451651e+00f,
-    1.139326453e+00f,
-    1.083136797e+00f,
-    1.024863601e+00f,
-    7.958616614e-01f,
-    8.655039668e-01f,
-    1.358344316e+00f,
-    8.980665207e-01f,
-    1.431688666e+00f,
-    1.327115774e+00f,
-    6.794789433e-01f,
-    1.654314518e+00f,
-    7.003713846e-01f,
-    1.502250671e+00f,
-    1.008654118e+00f,
-    8.427690864e-01f,
-    1.475100994e+00f,
-    9.555699229e-01f,
-    9.690696597e-01f,
-    8.407369852e-01f,
-    8.731101751e-01f,
-    6.490103006e-01f,
-    1.869288683e+00f,
-    6.220464110e-01f,
-    1.351634741e+00f,
-    4.453299940e-01f,
-    4.801962674e-01f,
-    9.267882705e-01f,
-    1.153576255e+00f,
-    1.246190071e+00f,
-    4.792625904e-01f,
-    8.255625963e-01f,
-    1.658496380e+00f,
-    1.092626095e+00f,
-    9.394495487e-01f,
-    8.726000786e-01f,
-    1.114629149e+00f,
-    1.584219337e+00f,
-    5.628204942e-01f,
-    1.565486670e+00f,
-    9.331423044e-01f,
-    6.291918755e-01f,
-    7.196115255e-01f,
-    8.202398419e-01f,
-    2.465373278e+00f,
-    5.979113579e-01f,
-    1.690781116e+00f,
-    1.015124202e+00f,
-    6.084395051e-01f,
-    1.217133045e+00f,
-    4.748354852e-01f,
-    5.713187456e-01f,
-    6.443337798e-01f,
-    4.679213762e-01f,
-    4.882475734e-01f,
-    1.639040947e+00f,
-    7.547340393e-01f,
-    1.214431047e+00f,
-    1.242785335e+00f,
-    8.647303581e-01f,
-    7.356945872e-01f,
-    6.342946887e-01f,
-    5.414327383e-01f,
-    7.785583138e-01f,
-    1.044481635e+00f,
-    1.195065498e+00f,
-    1.097634196e+00f,
-    6.766896248e-01f,
-    1.355141640e+00f,
-    7.367080450e-01f,
-    1.174944520e+00f,
-    1.545614004e+00f,
-    7.746934295e-01f,
-    1.052082181e+00f,
-    1.300405502e+00f,
-    1.340816140e+00f,
-    1.077016830e+00f,
-    6.589463949e-01f,
-    9.793980122e-01f,
-    1.723959565e+00f,
-    1.172019720e+00f,
-    8.492180705e-01f,
-    1.544654608e+00f,
-    5.152168870e-01f,
-    1.231973052e+00f,
-    7.295113206e-01f,
-    1.187821269e+00f,
-    8.562915921e-01f,
-    1.221991420e+00f,
-    9.547526836e-01f,
-    8.220787048e-01f,
-    1.557405233e+00f,
-    7.756254673e-01f,
-    2.017053127e+00f,
-    1.078831315e+00f,
-    1.621590734e+00f,
-    8.981777430e-01f,
-    8.361143470e-01f,
-    8.747990131e-01f,
-    7.158248425e-01f,
-    1.963272452e+00f,
-    1.323054075e+00f,
-    1.357909560e+00f,
-    5.585394502e-01f,
-    7.202052474e-01f,
-    1.016670346e+00f,
-    1.504521608e+00f,
-    7.412878275e-01f,
-    1.072917104e+00f,
-    1.539845943e+00f,
-    9.116030931e-01f,
-    1.361994028e+00f,
-    6.622158885e-01f,
-    6.613224149e-01f,
-    8.582306504e-01f,
-    4.395994544e-01f,
-    7.746200562e-01f,
-    4.639107883e-01f,
-    8.768218756e-01f,
-    1.124431372e+00f,
-    8.432706594e-01f,
-    6.239528656e-01f,
-    1.619302630e+00f,
-    6.553361416e-01f,
-    1.158243537e+00f,
-    1.071025491e+00f,
-    1.027266145e+00f,
-    1.504354835e+00f,
-    1.266157866e+00f,
-    1.038776636e+00f,
-    1.401393056e+00f,
-    7.606677413e-01f,
-    1.233082414e+00f,
-    1.288898706e+00f,
-    1.762310624e+00f,
-    1.191284537e+00f,
-    1.375985265e+00f,
-    1.689474106e+00f,
-    1.020911455e+00f,
-    1.106239557e+00f,
-    1.602178454e+00f,
-    8.868855834e-01f,
-    1.425436139e+00f,
-    1.586827040e+00f,
-    5.139040947e-01f,
-    8.995768428e-01f,
-    1.388407826e+00f,
-    5.469377637e-01f,
-    7.153416872e-01f,
-    1.178689718e+00f,
-    7.388730645e-01f,
-    1.083729386e+00f,
-    1.263101935e+00f,
-    1.578973293e+00f,
-    1.348819971e+00f,
-    8.030816913e-01f,
-    1.346865416e+00f,
-    8.293029666e-01f,
-    1.629048467e+00f,
-    1.010549068e+00f,
-    8.151708245e-01f,
-    1.384778023e+00f,
-    1.177610636e+00f,
-    8.973402977e-01f,
-    1.077421308e+00f,
-    6.538401842e-01f,
-    1.384922028e+00f,
-    9.243373275e-01f,
-    4.845207930e-01f,
-    8.661784530e-01f,
-    1.001505971e+00f,
-    6.484160423e-01f,
-    9.613064528e-01f,
-    1.165331721e+00f,
-    9.647086263e-01f,
-    1.346908927e+00f,
-    1.405685782e+00f,
-    9.476574659e-01f,
-    5.494658351e-01f,
-    6.575716138e-01f,
-    9.842953682e-01f,
-    1.333955050e+00f,
-    6.951931715e-01f,
-    1.127863765e+00f,
-    1.182141066e+00f,
-    1.185965061e+00f,
-    4.759310186e-01f,
-    1.015114546e+00f,
-    1.262857318e+00f,
-    8.636325598e-01f,
-    1.501895547e+00f,
-    1.622500420e+00f,
-    6.569764018e-01f,
-    1.578226089e+00f,
-    1.110578775e+00f,
-    7.852557302e-01f,
-    1.902849317e+00f,
-    1.213038325e+00f,
-    1.046830654e+00f,
-    1.030242562e+00f,
-    5.908342004e-01f,
-    9.782944322e-01f,
-    7.271024585e-01f,
-    1.030403018e+00f,
-    4.962089658e-01f,
-    6.945088506e-01f,
-    1.437054634e+00f,
-    1.368883491e+00f,
-    6.712917686e-01f,
-    7.344759703e-01f,
-    1.623850942e+00f,
-    7.018486857e-01f,
-    4.657785892e-01f,
-    8.443001509e-01f,
-    5.774012804e-01f,
-    5.782572627e-01f,
-    1.397247672e+00f,
-    5.110953450e-01f,
-    1.666590333e+00f,
-    1.067320108e+00f,
-    1.165165544e+00f,
-    5.209040642e-01f,
-    8.716292381e-01f,
-    1.253980279e+00f,
-    6.762326360e-01f,
-    1.026301384e+00f,
-    4.593136907e-01f,
-    6.165570617e-01f,
-    6.165047288e-01f,
-    8.376049995e-01f,
-    8.461192250e-01f,
-    7.505733967e-01f,
-    6.863918900e-01f,
-    9.104942679e-01f,
-    6.455441117e-01f,
-    6.854757071e-01f,
-    8.411813378e-01f,
-    7.200539112e-01f,
-    1.170729637e+00f,
-    7.815445662e-01f,
-    1.857753634e+00f,
-    1.354625821e+00f,
-    7.130119205e-01f,
-    3.536153138e-01f,
-    1.350098252e+00f,
-    7.153270841e-01f,
-    1.138618588e+00f,
-    6.991451383e-01f,
-    8.558284044e-01f,
-    4.811153114e-01f,
-    5.892330408e-01f,
-    6.706221104e-01f,
-    1.128851891e+00f,
-    6.919350028e-01f,
-    8.673021793e-01f,
-    9.025959969e-01f,
-    1.204476833e+00f,
-    1.834371805e+00f,
-    9.778689742e-01f,
-    1.027395606e+00f,
-    1.283786178e+00f,
-    1.276773691e+00f,
-    1.924597979e+00f,
-    9.207004309e-01f,
-    1.688073993e+00f,
-    1.155834436e+00f,
-    1.087114811e+00f,
-    8.037621975e-01f,
-    1.188337445e+00f,
-    1.476486444e+00f,
-    9.843697548e-01f,
-    4.243050516e-01f,
-    1.420012593e+00f,
-    6.845344305e-01f,
-    1.339433551e+00f,
-    1.527615309e+00f,
-    2.008589029e+00f,
-    7.044613361e-01f,
-    4.395416677e-01f,
-    8.971908689e-01f,
-    7.048653364e-01f,
-    7.008391619e-01f,
-    2.298158407e+00f,
-    5.448736548e-01f,
-    1.337085247e+00f,
-    7.634600997e-01f,
-    6.957232356e-01f,
-    5.788140893e-01f,
-    7.033131123e-01f,
-    7.035238147e-01f,
-    1.372346520e+00f,
-    1.902820945e+00f,
-    6.782924533e-01f,
-    6.214276552e-01f,
-    6.302173138e-01f,
-    6.211631894e-01f,
-    1.000129461e+00f,
-    6.632784605e-01f,
-    1.283935547e+00f,
-    4.937636256e-01f,
-    1.018001795e+00f,
-    6.459110975e-01f,
-    1.130223870e+00f,
-    6.436774731e-01f,
-    1.012536049e+00f,
-    1.162040114e+00f,
-    1.223741651e+00f,
-    6.084176898e-01f,
-    5.339298844e-01f,
-    9.629355669e-01f,
-    1.121647358e+00f,
-    9.975585341e-01f,
-    6.575717926e-01f,
-    1.433184385e+00f,
-    8.567217588e-01f,
-    6.277241111e-01f,
-    5.587558746e-01f,
-    9.532437325e-01f,
-    2.312347889e+00f,
-    1.431105614e+00f,
-    1.098682523e+00f,
-    9.952260852e-01f,
-    7.725726962e-01f,
-    9.955989122e-01f,
-    1.415099859e+00f,
-    1.977901340e+00f,
-    1.109464526e+00f,
-    6.436335444e-01f,
-    5.353104472e-01f,
-    1.068744898e+00f,
-    7.676223516e-01f,
-    7.503272891e-01f,
-    1.451667190e+00f,
-    9.148346186e-01f,
-    1.049694896e+00f,
-    8.802981377e-01f,
-    1.169770598e+00f,
-    9.587332606e-01f,
-    7.809098363e-01f,
-    9.704012275e-01f,
-    1.033422470e+00f,
-    1.572804332e+00f,
-    1.368514419e+00f,
-    5.061901212e-01f,
-    1.350806713e+00f,
-    9.058349133e-01f,
-    8.425793648e-01f,
-    8.123871088e-01f,
-    1.089820981e+00f,
-    1.134854436e+00f,
-    9.092686176e-01f,
-    6.068103909e-01f,
-    9.252117872e-01f,
-    1.090250492e+00f,
-    4.846812785e-01f,
-    1.152925968e+00f,
-    8.769523501e-01f,
-    8.478742242e-01f,
-    6.791095734e-01f,
-    4.034501016e-01f,
-    7.219478488e-01f,
-    9.319657087e-01f,
-    5.638332963e-01f,
-    9.675415158e-01f,
-    9.899076819e-01f,
-    6.980168819e-01f,
-    8.779823780e-01f,
-    1.381232381e+00f,
-    1.023508906e+00f,
-    1.116558313e+00f,
-    1.269341946e+00f,
-    6.598423719e-01f,
-    1.671329975e+00f,
-    1.280736804e+00f,
-    1.347386122e+00f,
-    1.921182036e+00f,
-    1.409759402e+00f,
-    1.209314823e+00f,
-    8.354782462e-01f,
-    1.304166913e+00f,
-    1.527182817e+00f,
-    5.890365243e-01f,
-    7.492744923e-01f,
-    8.737012148e-01f,
-    9.988870025e-01f,
-    1.171599627e+00f,
-    1.498399496e+00f,
-    8.149412870e-01f,
-    7.677916288e-01f,
-    1.205465198e+00f,
-    7.862617970e-01f,
-    4.624092281e-01f,
-    9.241961837e-01f,
-    5.270692110e-01f,
-    2.064436674e+00f,
-    1.233422041e+00f,
-    8.692410588e-01f,
-    8.191155791e-01f,
-    8.826261759e-01f,
-    7.129274607e-01f,
-    7.544493079e-01f,
-    1.707289696e+00f,
-    1.334597111e+00f,
-    9.397918582e-01f,
-    1.334467530e+00f,
-    8.822373748e-01f,
-    5.248520374e-01f,
-    8.767666221e-01f,
-    1.867869377e+00f,
-    9.935941696e-01f,
-    7.618166208e-01f,
-    1.018624306e+00f,
-    6.325458288e-01f,
-    1.117321134e+00f,
-    1.384238243e+00f,
-    6.257778406e-01f,
-    8.490199447e-01f,
-    1.086367369e+00f,
-    5.639320612e-01f,
-    6.545148492e-01f,
-    1.394258618e+00f,
-    1.175620556e+00f,
-    1.018808365e+00f,
-    4.519780278e-01f,
-    4.367181063e-01f,
-    7.486293316e-01f,
-    4.520239234e-01f,
-    1.215514183e+00f,
-    6.612253785e-01f,
-    1.035475135e+00f,
-    5.275148153e-01f,
-    8.698453903e-01f,
-    1.156230569e+00f,
-    1.264092684e+00f,
-    7.391903996e-01f,
-    1.203273892e+00f,
-    9.029748440e-01f,
-    9.664338827e-01f,
-    8.042961955e-01f,
-    8.315037489e-01f,
-    1.010921359e+00f,
-    1.045717716e+00f,
-    1.352326989e+00f,
-    1.151544094e+00f,
-    7.083296180e-01f,
-    9.264505506e-01f,
-    8.143222928e-01f,
-    1.851580143e+00f,
-    5.137150288e-01f,
-    1.426864982e+00f,
-    1.578297853e+00f,
-    1.113221288e+00f,
-    1.211117744e+00f,
-    7.214108109e-01f,
-    1.068628073e+00f,
-    7.584266067e-01f,
-    1.248163104e+00f,
-    1.152569771e+00f,
-    1.344326854e+00f,
-    1.073353052e+00f,
-    1.017956972e+00f,
-    7.825573683e-01f,
-    1.132092595e+00f,
-    1.341339946e+00f,
-    3.863459527e-01f,
-    1.165269375e+00f,
-    8.267079592e-01f,
-    7.459350228e-01f,
-    1.142768979e+00f,
-    8.272895813e-01f,
-    9.132867455e-01f,
-    9.440810084e-01f,
-    8.596728444e-01f,
-    1.096052051e+00f,
-    8.686132431e-01f,
-    7.165973186e-01f,
-    1.204950452e+00f,
-    1.258871555e+00f,
-    5.862431526e-01f,
-    1.116953731e+00f,
-    8.986461163e-01f,
-    7.807720900e-01f,
-    7.470547557e-01f,
-    1.266215801e+00f,
-    9.950856566e-01f,
-    7.435672879e-01f,
-    1.221658587e+00f,
-    5.443283916e-01f,
-    1.334286690e+00f,
-    8.514650464e-01f,
-    1.258229852e+00f,
-    1.253081322e+00f,
-    1.292861700e+00f,
-    1.130729198e+00f,
-    1.537228584e+00f,
-    1.413349628e+00f,
-    9.201321602e-01f,
-    1.276272297e+00f,
-    1.063854456e+00f,
-    6.437705755e-01f,
-    9.654499888e-01f,
-    9.941334128e-01f,
-    1.051825881e+00f,
-    1.078740239e+00f,
-    1.634873748e+00f,
-    4.735788405e-01f,
-    1.330169559e+00f,
-    7.536752224e-01f,
-    7.456551194e-01f,
-    7.013589144e-01f,
-    6.143621206e-01f,
-    1.540244579e+00f,
-    4.453401864e-01f,
-    4.533728361e-01f,
-    7.252321839e-01f,
-    7.496328354e-01f,
-    5.562915206e-01f,
-    6.296653152e-01f,
-    6.995370984e-01f,
-    3.824772835e-01f,
-    8.166849017e-01f,
-    3.312966526e-01f,
-    3.354047239e-01f,
-    7.806099057e-01f,
-    7.671304345e-01f,
-    9.043372869e-01f,
-    1.414755583e+00f,
-    2.910062075e-01f,
-    9.783267379e-01f,
-    1.210272789e+00f,
-    1.157631874e+00f,
-    1.260520697e+00f,
-    6.810785532e-01f,
-    1.449366093e+00f,
-    6.954929829e-01f,
-    2.559616566e+00f,
-    1.434604168e+00f,
-    1.458685517e+00f,
-    7.713108659e-01f,
-    9.841176867e-01f,
-    1.058053136e+00f,
-    5.471466184e-01f,
-    5.845248699e-01f,
-    7.922455072e-01f,
-    7.816193104e-01f,
-    1.243743658e+00f,
-    7.561510205e-01f,
-    2.381564140e+00f,
-    1.257833123e+00f,
-    7.448081374e-01f,
-    5.776698589e-01f,
-    8.490431905e-01f,
-    1.097552657e+00f,
-    1.157904506e+00f,
-    9.062946439e-01f,
-    1.847637653e+00f,
-    1.056385159e+00f,
-    7.223724127e-01f,
-    9.416756630e-01f,
-    7.613332272e-01f,
-    3.495264053e+00f,
-    9.744512439e-01f,
-    2.147099495e+00f,
-    9.708987474e-01f,
-    6.126551628e-01f,
-    1.103672504e+00f,
-    8.221297860e-01f,
-    4.764472246e-01f,
-    7.031176686e-01f,
-    7.081129551e-01f,
-    1.286777139e+00f,
-    8.361213207e-01f,
-    9.420804977e-01f,
-    1.039979100e+00f,
-    8.492591381e-01f,
-    2.287729502e+00f,
-    7.904411554e-01f,
-    1.329029918e+00f,
-    9.066687822e-01f,
-    9.865663648e-01f,
-    4.140324295e-01f,
-    4.232599437e-01f,
-    9.928211570e-01f,
-    7.656603456e-01f,
-    8.022019863e-01f,
-    9.565424919e-01f,
-    8.233932853e-01f,
-    1.200008392e+00f,
-    6.902185678e-01f,
-    3.175466776e+00f,
-    1.583816528e+00f,
-    1.247817516e+00f,
-    7.734397054e-01f,
-    5.258885026e-01f,
-    6.913046241e-01f,
-    1.123877168e+00f,
-    8.899564147e-01f,
-    7.295593023e-01f,
-    1.054231286e+00f,
-    8.964640498e-01f,
-    5.532435775e-01f,
-    9.031141400e-01f,
-    8.097002506e-01f,
-    8.914033771e-01f,
-    1.031187177e+00f,
-    1.635928750e+00f,
-    8.681678772e-01f,
-    8.967439532e-01f,
-    9.515709281e-01f,
-    1.375945091e+00f,
-    7.763924003e-01f,
-    1.756385088e+00f,
-    8.576006293e-01f,
-    1.202159524e+00f,
-    1.725998044e+00f,
-    1.292098999e+00f,
-    1.372713923e+00f,
-    8.582220674e-01f,
-    2.739329576e+00f,
-    1.413335323e+00f,
-    1.133061647e+00f,
-    8.909101486e-01f,
-    5.885755420e-01f,
-    7.383813262e-01f,
-    1.889493227e+00f,
-    1.088689685e+00f,
-    1.024939775e+00f,
-    7.130565643e-01f,
-    1.032031536e+00f,
-    5.061690211e-01f,
-    1.011712074e+00f,
-    7.976462841e-01f,
-    9.331818819e-01f,
-    8.246971369e-01f,
-    1.026933789e+00f,
-    9.695670605e-01f,
-    2.178061008e+00f,
-    1.782131791e+00f,
-    1.141780972e+00f,
-    2.317495346e+00f,
-    7.059315443e-01f,
-    9.571422935e-01f,
-    1.404888630e+00f,
-    1.124382496e+00f,
-    1.027453899e+00f,
-    1.017756462e+00f,
-    1.108876586e+00f,
-    8.739740849e-01f,
-    1.213063717e+00f,
-    2.426947832e+00f,
-    1.482259274e+00f,
-    1.050555825e+00f,
-    1.274598956e+00f,
-    8.649553061e-01f,
-    1.201062679e+00f,
-    8.638097048e-01f,
-    7.606628537e-01f,
-    5.822149515e-01f,
-    1.049158454e+00f,
-    8.569572568e-01f,
-    7.172756195e-01f,
-    1.218334317e+00f,
-    9.253165722e-01f,
-    1.372952819e+00f,
-    9.848127961e-01f,
-    1.166382194e+00f,
-    1.027934313e+00f,
-    7.361004949e-01f,
-    1.777404666e+00f,
-    7.491087317e-01f,
-    6.137217879e-01f,
-    6.286368370e-01f,
-    1.094588518e+00f,
-    1.406199336e+00f,
-    1.179988265e+00f,
-    7.514486909e-01f,
-    9.552303553e-01f,
-    1.099460721e+00f,
-    6.651378274e-01f,
-    6.562383175e-01f,
-    8.722828031e-01f,
-    1.411662817e+00f,
-    7.171386480e-01f,
-    1.317706466e+00f,
-    2.213701963e+00f,
-    1.033929825e+00f,
-    5.714860559e-01f,
-    9.313538074e-01f,
-    1.069229126e+00f,
-    8.890828490e-01f,
-    1.775079608e+00f,
-    1.091820478e+00f,
-    9.082550406e-01f,
-    1.222904682e+00f,
-    3.793451190e-01f,
-    5.516710281e-01f,
-    6.735524535e-01f,
-    1.076532960e+00f,
-    1.007236600e+00f,
-    1.033181787e+00f,
-    9.561981559e-01f,
-    1.229417920e+00f,
-    8.098291755e-01f,
-    9.284180999e-01f,
-    1.539475203e+00f,
-    1.641710639e+00f,
-    8.268166184e-01f,
-    8.685707450e-01f,
-    1.052372932e+00f,
-    7.980250716e-01f,
-    1.067422986e+00f,
-    1.401350379e+00f,
-    1.170468807e+00f,
-    8.245114684e-01f,
-    1.014527798e+00f,
-    8.025809526e-01f,
-    5.431488156e-01f,
-    6.813168526e-01f,
-    9.388199449e-01f,
-    1.662140489e+00f,
-    7.043385506e-01f,
-    7.108625174e-01f,
-    5.839750171e-01f,
-    1.069214821e+00f,
-    5.818150043e-01f,
-    9.611844420e-01f,
-    2.068493843e+00f,
-    2.221482992e+00f,
-    1.134922385e+00f,
-    1.188154578e+00f,
-    6.056516767e-01f,
-    5.261763930e-01f,
-    7.478393316e-01f,
-    7.492115498e-01f,
-    7.735876441e-01f,
-    3.064394712e+00f,
-    6.334959865e-01f,
-    1.046126008e+00f,
-    7.289751768e-01f,
-    8.029405475e-01f,
-    8.202785254e-01f,
-    1.219526172e+00f,
-    8.574270606e-01f,
-    9.144509435e-01f,
-    1.850894570e+00f,
-    1.406685233e+00f,
-    9.925466776e-01f,
-    4.040850401e-01f,
-    1.866069555e+00f,
-    9.143403769e-01f,
-    4.481942952e-01f,
-    1.257677197e+00f,
-    3.204853237e-01f,
-    5.238662958e-01f,
-    8.860917091e-01f,
-    1.186826348e+00f,
-    1.092800140e+00f,
-    6.573890448e-01f,
-    8.815294504e-01f,
-    7.574086785e-01f,
-    8.033838272e-01f,
-    9.325907230e-01f,
-    1.573599458e+00f,
-    2.082427502e+00f,
-    4.414739907e-01f,
-    1.922911167e+00f,
-    1.986840963e+00f,
-    6.437622905e-01f,
-    1.217934489e+00f,
-    1.723577142e+00f,
-    8.356137276e-01f,
-    7.871723771e-01f,
-    6.658882499e-01f,
-    1.348547220e+00f,
-    1.330448985e+00f,
-    1.058728814e+00f,
-    1.265179515e+00f,
-    1.032146931e+00f,
-    8.084770441e-01f,
-    1.234465718e+00f,
-    6.779525876e-01f,
-    5.837740302e-01f,
-    8.226587176e-01f,
-    9.358096123e-01f,
-    9.230509400e-01f,
-    4.343005419e-01f,
-    9.802251458e-01f,
-    6.697739363e-01f,
-    7.874048948e-01f,
-    7.137485147e-01f,
-    4.979819953e-01f,
-    8.949220181e-01f,
-    1.941435695e+00f,
-    8.074341416e-01f,
-    1.177363515e+00f,
-    1.179614663e+00f,
-    8.243675828e-01f,
-    1.212401748e+00f,
-    1.159170985e+00f,
-    7.792037129e-01f,
-    1.583203316e+00f,
-    1.575285912e+00f,
-    1.584666848e+00f,
-    1.910222650e+00f,
-    9.205396175e-01f,
-    1.391122937e+00f,
-    1.473478675e+00f,
-    6.613531709e-01f,
-    1.479508519e+00f,
-    1.017780185e+00f,
-    1.398853183e+00f,
-    6.981005073e-01f,
-    9.254605174e-01f,
-    1.734111071e+00f,
-    1.290299773e+00f,
-    1.131829500e+00f,
-    7.693143487e-01f,
-    1.829741716e+00f,
-    1.012590885e+00f,
-    1.080197215e+00f,
-    2.605872154e+00f,
-    1.681849957e+00f,
-    1.272771239e+00f,
-    4.429192245e-01f,
-    1.218623519e+00f,
-    7.079373002e-01f,
-    6.002508402e-01f,
-    1.302240968e+00f,
-    2.372429848e+00f,
-    2.429533243e+00f,
-    2.596685171e+00f,
-    2.288957834e+00f,
-    4.193260074e-01f,
-    9.327334762e-01f,
-    1.516426682e+00f,
-    1.091894507e+00f,
-    7.131433487e-01f,
-    6.427115202e-01f,
-    8.838615417e-01f,
-    6.938067675e-01f,
-    5.667112470e-01f,
-    1.021050096e+00f,
-    1.807825923e+00f,
-    1.214895725e+00f,
-    1.094968319e+00f,
-    4.297728539e-01f,
-    6.321343184e-01f,
-    1.463890433e+00f,
-    1.567055583e+00f,
-    1.222927213e+00f,
-    2.011922359e+00f,
-    5.086541176e-01f,
-    1.156778336e+00f,
-    1.106142402e+00f,
-    9.032068849e-01f,
-    8.880131841e-01f,
-    8.980219364e-01f,
-    8.315157890e-01f,
-    7.233104110e-01f,
-    8.417748213e-01f,
-    6.381990910e-01f,
-    2.369889021e+00f,
-    8.211738467e-01f,
-    9.727145433e-01f,
-    1.023247123e+00f,
-    1.131250978e+00f,
-    1.249243379e+00f,
-    9.542392492e-01f,
-    1.267855525e+00f,
-    1.361746311e+00f,
-    1.315368533e+00f,
-    1.317754388e+00f,
-    8.948047161e-01f,
-    2.367785931e+00f,
-    9.147946239e-01f,
-    1.513440847e+00f,
-    1.694470406e+00f,
-    7.656766772e-01f,
-    1.298654199e+00f,
-    1.328796387e+00f,
-    2.121799707e+00f,
-    1.435866833e+00f,
-    1.261399269e+00f,
-    1.212695956e+00f,
-    9.361711740e-01f,
-    2.478657246e+00f,
-    2.147921324e+00f,
-    1.293784976e+00f,
-    1.878652573e+00f,
-    1.170914173e+00f,
-    1.208541036e+00f,
-    1.280137539e+00f,
-    1.321669698e+00f,
-    6.000060439e-01f,
-    5.090489388e-01f,
-    5.976830125e-01f,
-    1.214020252e+00f,
-    5.515241027e-01f,
-    1.936700583e+00f,
-    1.524553657e+00f,
-    6.515181065e-01f,
-    4.768661857e-01f,
-    6.555632949e-01f,
-    1.024242520e+00f,
-    9.584276676e-01f,
-    8.586912155e-01f,
-    1.379667521e+00f,
-    6.664790511e-01f,
-    5.870230794e-01f,
-    5.324919820e-01f,
-    6.788891554e-01f,
-    8.949201703e-01f,
-    4.247433543e-01f,
-    8.815906048e-01f,
-    1.068534017e+00f,
-    1.131255984e+00f,
-    1.246624827e+00f,
-    1.309580684e+00f,
-    9.358374476e-01f,
-    1.364036679e+00f,
-    7.013173103e-01f,
-    8.993475437e-01f,
-    1.238106370e+00f,
-    1.511016369e+00f,
-    1.716153979e+00f,
-    1.314484835e+00f,
-    6.116098166e-01f,
-    9.551630020e-01f,
-    9.377066493e-01f,
-    1.378572702e+00f,
-    1.708639622e+00f,
-    9.074507952e-01f,
-    8.395044804e-01f,
-    1.014233947e+00f,
-    8.337369561e-01f,
-    7.823962569e-01f,
-    1.109146237e+00f,
-    1.264329195e+00f,
-    5.402075648e-01f,
-    8.436740637e-01f,
-    1.217133045e+00f,
-    1.855143309e+00f,
-    1.272610426e+00f,
-    7.029465437e-01f,
-    8.866704702e-01f,
-    9.006652832e-01f,
-    6.803436279e-01f,
-    9.284819365e-01f,
-    1.330627084e+00f,
-    9.515233040e-01f,
-    6.586602926e-01f,
-    1.092641473e+00f,
-    1.166494727e+00f,
-    8.668701053e-01f,
-    7.415566444e-01f,
-    9.662901759e-01f,
-    2.347241402e+00f,
-    1.787676215e+00f,
-    9.422451854e-01f,
-    1.076061130e+00f,
-    1.322371960e+00f,
-    9.100790024e-01f,
-    7.249165177e-01f,
-    6.557508111e-01f,
-    1.368707061e+00f,
-    1.054210901e+00f,
-    1.424466252e+00f,
-    7.219079733e-01f,
-    1.675838709e+00f,
-    1.062190175e+00f,
-    8.550323844e-01f,
-    9.841400981e-01f,
-    1.630875349e+00f,
-    9.340202808e-01f,
-    1.411911130e+00f,
-    9.271596074e-01f,
-    8.257085681e-01f,
-    1.062371135e+00f,
-    8.029563427e-01f,
-    1.286661386e+00f,
-    2.906173706e+00f,
-    9.819453359e-01f,
-    1.407520652e+00f,
-    7.782995701e-01f,
-    1.291665077e+00f,
-    9.414089322e-01f,
-    1.457698584e+00f,
-    6.027814746e-01f,
-    1.987035394e+00f,
-    1.153624892e+00f,
-    5.365554690e-01f,
-    7.549323440e-01f,
-    8.773813844e-01f,
-    1.830436945e+00f,
-    8.269976974e-01f,
-    6.588024497e-01f,
-    6.740735173e-01f,
-    5.961713195e-01f,
-    1.485014200e+00f,
-    1.287077546e+00f,
-    7.722466588e-01f,
-    1.454446912e+00f,
-    5.740659833e-01f,
-    1.133473754e+00f,
-    5.322875977e-01f,
-    8.447061181e-01f,
-    1.139540672e+00f,
-    1.243547201e+00f,
-    7.170310020e-01f,
-    1.907087088e+00f,
-    1.273119569e+00f,
-    1.087476373e+00f,
-    7.835785151e-01f,
-    8.324609995e-01f,
-    1.843732595e+00f,
-    1.508527637e+00f,
-    1.030091047e+00f,
-    9.896765947e-01f,
-    1.480942249e+00f,
-    7.286760211e-01f,
-    8.055360317e-01f,
-    2.568275213e+00f,
-    6.172642112e-01f,
-    6.810176969e-01f,
-    1.372614503e+00f,
-    1.344468832e+00f,
-    7.279009223e-01f,
-    8.914574385e-01f,
-    8.761648536e-01f,
-    2.001160383e+00f,
-    1.125201583e+00f,
-    1.875387192e+00f,
-    1.907593846e+00f,
-    1.732705355e+00f,
-    2.124511719e+00f,
-    1.842992067e+00f,
-    9.415932298e-01f,
-    1.332132459e+00f,
-    1.954775095e+00f,
-    8.554302454e-01f,
-    7.207430601e-01f,
-    8.291890025e-01f,
-    6.671487093e-01f,
-    1.319173336e+00f,
-    6.367883086e-01f,
-    1.304000378e+00f,
-    1.134850979e+00f,
-    9.835152030e-01f,
-    1.783430696e+00f,
-    8.192175031e-01f,
-    6.499994397e-01f,
-    1.029099345e+00f,
-    7.657071948e-01f,
-    1.380413175e+00f,
-    7.639101148e-01f,
-    6.609925628e-01f,
-    9.420117736e-01f,
-    1.116254091e+00f,
-    1.404661298e+00f,
-    7.013958097e-01f,
-    6.407453418e-01f,
-    4.775184989e-01f,
-    8.887396455e-01f,
-    1.219459414e+00f,
-    6.128235459e-01f,
-    1.145698667e+00f,
-    7.666228414e-01f,
-    1.186704040e+00f,
-    1.911074281e+00f,
-    1.423484564e+00f,
-    5.800295472e-01f,
-    7.854555845e-01f,
-    7.793435454e-01f,
-    1.230329752e+00f,
-    8.827787638e-01f,
-    8.544633389e-01f,
-    1.275544167e+00f,
-    5.525282025e-01f,
-    7.913850546e-01f,
-    2.118601322e+00f,
-    5.424463749e-01f,
-    1.023748994e+00f,
-    9.434430003e-01f,
-    9.298721552e-01f,
-    1.441679120e+00f,
-    9.406084418e-01f,
-    1.582753062e+00f,
-    6.690019965e-01f,
-    1.134858370e+00f,
-    7.144876719e-01f,
-    5.194723010e-01f,
-    8.137187362e-01f,
-    8.185904026e-01f,
-    1.083182812e+00f,
-    8.418411613e-01f,
-    1.416829109e+00f,
-    1.776439309e+00f,
-    7.599265575e-01f,
-    1.054071665e+00f,
-    8.546517491e-01f,
-    6.665285826e-01f,
-    6.346458793e-01f,
-    1.228300333e+00f,
-    1.519399285e+00f,
-    4.915955663e-01f,
-    7.131729722e-01f,
-    8.377819061e-01f,
-    1.316235900e+00f,
-    1.681416392e+00f,
-    1.229746580e+00f,
-    8.858689070e-01f,
-    5.235342383e-01f,
-    2.029398441e+00f,
-    2.000899792e+00f,
-    1.100662112e+00f,
-    9.972623587e-01f,
-    6.998914480e-01f,
-    4.932075441e-01f,
-    1.263208628e+00f,
-    9.660863280e-01f,
-    1.637132645e+00f,
-    8.134957552e-01f,
-    6.675060987e-01f,
-    8.417853713e-01f,
-    8.982704878e-01f,
-    1.883781552e+00f,
-    5.331554413e-01f,
-    4.580404460e-01f,
-    1.027365804e+00f,
-    1.320093751e+00f,
-    1.110454440e+00f,
-    1.089488506e+00f,
-    9.734708071e-01f,
-    1.503039956e+00f,
-    9.971995950e-01f,
-    7.653373480e-01f,
-    1.444187760e+00f,
-    1.659582376e+00f,
-    1.028697968e+00f,
-    1.731921434e+00f,
-    6.256740689e-01f,
-    9.123097658e-01f,
-    1.070565462e+00f,
-    4.575761557e-01f,
-    1.185707092e+00f,
-    1.106109470e-01f,
-    1.075077772e+00f,
-    9.907508492e-01f,
-    1.771638274e+00f,
-    1.253473043e+00f,
-    1.152792096e+00f,
-    5.543205738e-01f,
-    1.071376562e+00f,
-    1.635464191e+00f,
-    9.797200561e-01f,
-    1.808193207e+00f,
-    8.992673159e-01f,
-    1.028394103e+00f,
-    1.021862268e+00f,
-    9.500784874e-01f,
-    9.344801307e-01f,
-    9.834359884e-01f,
-    1.999665737e+00f,
-    2.386927605e+00f,
-    1.640961051e+00f,
-    1.095572472e+00f,
-    1.364153862e+00f,
-    5.109016895e-01f,
-    8.922042251e-01f,
-    1.308679581e+00f,
-    1.286480069e+00f,
-    1.199253917e+00f,
-    1.580099463e+00f,
-    2.027621508e+00f,
-    1.639821291e+00f,
-    1.481309056e+00f,
-    1.657368064e+00f,
-    1.179988265e+00f,
-    1.426368594e+00f,
-    1.117849588e+00f,
-    1.042708755e+00f,
-    1.762540579e+00f,
-    1.045646191e+00f,
-    1.043905258e+00f,
-    9.347809553e-01f,
-    1.221502900e+00f,
-    1.168323994e+00f,
-    1.001289725e+00f,
-    1.014605522e+00f,
-    6.743484139e-01f,
-    1.540847659e+00f,
-    9.217947721e-01f,
-    1.518912435e+00f,
-    1.126559854e+00f,
-    1.788792491e+00f,
-    6.774508357e-01f,
-    1.020885348e+00f,
-    8.488970399e-01f,
-    4.601064622e-01f,
-    7.239696980e-01f,
-    1.706988096e+00f,
-    7.097439170e-01f,
-    6.465265751e-01f,
-    9.077622890e-01f,
-    4.025714099e-01f,
-    6.770703197e-01f,
-    4.247393310e-01f,
-    7.725540996e-01f,
-    9.685019851e-01f,
-    1.035464048e+00f,
-    7.966230512e-01f,
-    6.738402247e-01f,
-    1.913049936e+00f,
-    7.462738752e-01f,
-    6.367984414e-01f,
-    8.576455712e-01f,
-    7.064891458e-01f,
-    5.005100965e-01f,
-    6.534451842e-01f,
-    9.089806080e-01f,
-    1.205868006e+00f,
-    7.908974886e-01f,
-    4.518256485e-01f,
-    6.293885708e-01f,
-    7.622449398e-01f,
-    1.254759431e+00f,
-    6.042587757e-01f,
-    1.344037771e+00f,
-    1.118605375e+00f,
-    5.750541687e-01f,
-    9.546130896e-01f,
-    1.003977418e+00f,
-    7.027414441e-01f,
-    1.536675215e+00f,
-    2.084536791e+00f,
-    1.253336668e+00f,
-    7.166689038e-01f,
-    2.463569880e+00f,
-    9.529332519e-01f,
-    5.482146740e-01f,
-    6.378743649e-01f,
-    8.755760789e-01f,
-    8.896112442e-01f,
-    5.639691949e-01f,
-    1.566204429e+00f,
-    1.142329574e+00f,
-    1.514181376e+00f,
-    7.924627066e-01f,
-    1.085433841e+00f,
-    2.247818232e+00f,
-    1.265578866e+00f,
-    1.174383044e+00f,
-    8.986490965e-01f,
-    1.203945875e+00f,
-    1.051418900e+00f,
-    6.361927986e-01f,
-    1.430750489e+00f,
-    8.271180391e-01f,
-    1.230690479e+00f,
-    1.477147102e+00f,
-    8.588464260e-01f,
-    1.677727699e+00f,
-    1.211133718e+00f,
-    1.038831234e+00f,
-    5.960667729e-01f,
-    7.349007130e-01f,
-    1.904277086e+00f,
-    1.140250564e+00f,
-    9.938589334e-01f,
-    1.158435941e+00f,
-    7.024909258e-01f,
-    2.668821335e+00f,
-    1.158134222e+00f,
-    9.769953489e-01f,
-    1.841190577e+00f,
-    9.850448370e-01f,
-    1.021280766e+00f,
-    1.027861595e+00f,
-    1.858601928e+00f,
-    9.303480387e-01f,
-    9.543135762e-01f,
-    1.658740163e+00f,
-    1.057968974e+00f,
-    8.906711936e-01f,
-    1.194739580e+00f,
-    1.226805449e+00f,
-    7.743506432e-01f,
-    1.119556665e+00f,
-    1.224574804e+00f,
-    1.234835148e+00f,
-    9.022110105e-01f,
-    8.469912410e-01f,
-    1.470902324e+00f,
-    1.006799817e+00f,
-    1.162321687e+00f,
-    1.457582712e+00f,
-    7.053910494e-01f,
-    5.174701810e-01f,
-    1.515413046e+00f,
-    8.431807756e-01f,
-    1.085271716e+00f,
-    1.075067639e+00f,
-    3.264543116e-01f,
-    7.097173333e-01f,
-    8.690220118e-01f,
-    5.824787021e-01f,
-    1.359237194e+00f,
-    6.213463545e-01f,
-    4.848891795e-01f,
-    9.941833615e-01f,
-    1.117201090e+00f,
-    7.821696997e-01f,
-    8.615913987e-01f,
-    2.533202887e+00f,
-    1.396939516e+00f,
-    6.941380501e-01f,
-    9.955428839e-01f,
-    6.511799097e-01f,
-    7.676536441e-01f,
-    1.120248079e+00f,
-    6.685814261e-01f,
-    4.566986263e-01f,
-    1.113680124e+00f,
-    9.071267247e-01f,
-    9.277359247e-01f,
-    5.666510463e-01f,
-    1.223589659e+00f,
-    1.406962752e+00f,
-    1.238026619e+00f,
-    7.010671496e-01f,
-    3.315017521e-01f,
-    5.810261369e-01f,
-    8.292187452e-01f,
-    7.315614223e-01f,
-    9.140597582e-01f,
-    9.358038306e-01f,
-    5.956808329e-01f,
-    1.450620055e+00f,
-    5.216653943e-01f,
-    5.787419677e-01f,
-    6.924409866e-01f,
-    1.040601373e+00f,
-    1.050175548e+00f,
-    1.055591941e+00f,
-    1.033034682e+00f,
-    6.911687851e-01f,
-    6.301993132e-01f,
-    8.085299730e-01f,
-    1.199904680e+00f,
-    5.880697966e-01f,
-    1.187644720e+00f,
-    2.289443254e+00f,
-    8.858863711e-01f,
-    1.300294280e+00f,
-    1.059468985e+00f,
-    1.422475576e+00f,
-    1.120117784e+00f,
-    7.923336625e-01f,
-    7.504341006e-01f,
-    7.643541694e-01f,
-    1.064035177e+00f,
-    1.362180948e+00f,
-    7.873107791e-01f,
-    6.858015656e-01f,
-    1.247366548e+00f,
-    9.365102649e-01f,
-    5.809133649e-01f,
-    6.702513099e-01f,
-    1.353914380e+00f,
-    1.046987772e+00f,
-    7.593917847e-01f,
-    1.123234630e+00f,
-    1.104501128e+00f,
-    6.412978768e-01f,
-    1.203516960e+00f,
-    5.506954193e-01f,
-    8.315346241e-01f,
-    1.142067552e+00f,
-    1.485538960e+00f,
-    1.673298836e+00f,
-    7.540796995e-01f,
-    8.298962116e-01f,
-    6.024670601e-01f,
-    8.386479616e-01f,
-    9.158551097e-01f,
-    1.068799853e+00f,
-    2.337284565e+00f,
-    1.008380651e+00f,
-    1.178676724e+00f,
-    3.349978685e+00f,
-    1.019318104e+00f,
-    9.657707810e-01f,
-    9.279792905e-01f,
-    7.961059213e-01f,
-    1.195741773e+00f,
-    9.932984710e-01f,
-    6.541131139e-01f,
-    1.530551314e+00f,
-    1.365794778e+00f,
-    1.029860139e+00f,
-    8.699043393e-01f,
-    1.145003319e+00f,
-    1.203555822e+00f,
-    1.336438894e+00f,
-    8.758063316e-01f,
-    1.594040394e+00f,
-    7.183371186e-01f,
-    1.499872208e+00f,
-    5.213912129e-01f,
-    1.309846878e+00f,
-    1.452713251e+00f,
-    1.362004399e+00f,
-    9.504950643e-01f,
-    9.822400808e-01f,
-    1.507276297e+00f,
-    9.388962388e-01f,
-    9.886009693e-01f,
-    3.822286725e-01f,
-    5.728906989e-01f,
-    4.313116074e-01f,
-    1.821585178e+00f,
-    7.528170943e-01f,
-    1.328034759e+00f,
-    1.229415059e+00f,
-    9.256232381e-01f,
-    7.911799550e-01f,
-    8.200537562e-01f,
-    8.042390347e-01f,
-    9.174031019e-01f,
-    1.521990657e+00f,
-    6.622658372e-01f,
-    1.072288394e+00f,
-    7.925079465e-01f,
-    9.193249941e-01f,
-    9.081869721e-01f,
-    3.168597221e-01f,
-    8.545156121e-01f,
-    6.521447301e-01f,
-    8.805108070e-01f,
-    1.428670645e+00f,
-    8.257770538e-01f,
-    9.864169359e-01f,
-    4.648532569e-01f,
-    5.590955019e-01f,
-    1.394390464e+00f,
-    1.399409771e+00f,
-    1.726137877e+00f,
-    7.277380824e-01f,
-    1.034063458e+00f,
-    9.491797090e-01f,
-    1.328893661e+00f,
-    1.493883848e+00f,
-    1.953574896e+00f,
-    2.399930000e+00f,
-    8.896268010e-01f,
-    1.222958684e+00f,
-    1.039697409e+00f,
-    4.038188457e-01f,
-    8.061455488e-01f,
-    1.538499475e+00f,
-    5.382310748e-01f,
-    1.915018559e+00f,
-    8.312680721e-01f,
-    2.284146994e-01f,
-    1.198730946e+00f,
-    3.814381957e-01f,
-    1.459966898e+00f,
-    5.863440037e-01f,
-    6.467964649e-01f,
-    7.295652628e-01f,
-    1.191279769e+00f,
-    8.119722605e-01f,
-    5.476075411e-01f,
-    3.567855656e-01f,
-    1.792397380e+00f,
-    6.308554411e-01f,
-    4.950233102e-01f,
-    7.457029819e-01f,
-    8.936070800e-01f,
-    9.450011253e-01f,
-    6.177417636e-01f,
-    1.708896637e+00f,
-    2.705003619e-01f,
-    1.151158810e+00f,
-    7.709698081e-01f,
-    4.782368839e-01f,
-    2.268320322e+00f,
-    9.203342199e-01f,
-    5.388944745e-01f,
-    1.644519091e+00f,
-    1.399393678e+00f,
-    4.232201874e-01f,
-    3.541284502e-01f,
-    5.987520218e-01f,
-    1.096893907e+00f,
-    5.255802870e-01f,
-    1.065234780e+00f,
-    1.060022950e+00f,
-    9.496948123e-01f,
-    7.929322124e-01f,
-    1.009423256e+00f,
-    1.133855462e+00f,
-    3.681423962e-01f,
-    1.300881982e+00f,
-    1.719333410e+00f,
-    1.718625069e+00f,
-    1.078713894e+00f,
-    6.695193052e-01f,
-    1.126338482e+00f,
-    6.516663432e-01f,
-    1.586274862e+00f,
-    1.341453671e+00f,
-    8.969209194e-01f,
-    1.366948485e+00f,
-    1.059529066e+00f,
-    1.019689441e+00f,
-    6.345570683e-01f,
-    9.046939611e-01f,
-    7.773928642e-01f,
-    6.490450501e-01f,
-    7.492103577e-01f,
-    9.491927624e-01f,
-    1.038530707e+00f,
-    5.206627250e-01f,
-    1.390364766e+00f,
-    9.318074584e-01f,
-    1.740848899e+00f,
-    1.420304418e+00f,
-    1.068696141e+00f,
-    5.913020968e-01f,
-    4.794477522e-01f,
-    1.644845843e+00f,
-    5.106037855e-01f,
-    8.745355010e-01f,
-    7.510625124e-01f,
-    4.764687121e-01f,
-    2.187166929e+00f,
-    7.992045879e-01f,
-    1.183964252e+00f,
-    1.214151740e+00f,
-    1.222744703e+00f,
-    5.258705616e-01f,
-    7.506243587e-01f,
-    5.980815291e-01f,
-    1.340124369e+00f,
-    8.355598450e-01f,
-    1.204376101e+00f,
-    4.848940670e-01f,
-    5.538375974e-01f,
-    7.348831892e-01f,
-    6.781437993e-01f,
-    1.027801156e+00f,
-    1.044850349e+00f,
-    1.653231502e+00f,
-    1.902927041e+00f,
-    7.337577343e-01f,
-    1.244972587e+00f,
-    1.822437048e+00f,
-    7.461005449e-01f,
-    7.660568953e-01f,
-    1.211874008e+00f,
-    1.291038275e+00f,
-    1.379338145e+00f,
-    1.043353081e+00f,
-    8.749932051e-01f,
-    6.271556020e-01f,
-    9.612959623e-01f,
-    1.477157354e+00f,
-    1.131655455e+00f,
-    2.261923790e+00f,
-    1.203952551e+00f,
-    1.398052216e+00f,
-    6.218881011e-01f,
-    9.148510098e-01f,
-    1.324136376e+00f,
-    7.717671990e-01f,
-    9.072418213e-01f,
-    8.143562675e-01f,
-    8.881362081e-01f,
-    1.387414336e+00f,
-    5.457475185e-01f,
-    5.543762445e-01f,
-    1.266433835e+00f,
-    6.049390435e-01f,
-    2.071746111e+00f,
-    1.153119326e+00f,
-    1.235872865e+00f,
-    7.089203000e-01f,
-    1.018452644e+00f,
-    9.440966845e-01f,
-    9.768960476e-01f,
-    8.806595802e-01f,
-    6.853730083e-01f,
-    1.275966644e+00f,
-    2.113230228e+00f,
-    1.829057932e+00f,
-    6.586126685e-01f,
-    6.062105298e-01f,
-    1.065562248e+00f,
-    9.334746599e-01f,
-    1.270741820e+00f,
-    1.147071004e+00f,
-    2.215889215e+00f,
-    5.377163291e-01f,
-    1.084037662e+00f,
-    8.796938658e-01f,
-    2.029996157e+00f,
-    6.361371279e-01f,
-    1.894459844e+00f,
-    2.402568340e+00f,
-    6.718063354e-01f,
-    7.662630081e-01f,
-    1.603510141e+00f,
-    7.440455556e-01f,
-    1.217745781e+00f,
-    1.501473665e+00f,
-    9.797764421e-01f,
-    9.801820517e-01f,
-    4.765314162e-01f,
-    9.829021096e-01f,
-    1.136737466e+00f,
-    8.986924291e-01f,
-    1.206550598e+00f,
-    1.397423148e+00f,
-    7.413049340e-01f,
-    9.600616693e-01f,
-    7.901193500e-01f,
-    1.259698868e+00f,
-    7.451896667e-01f,
-    8.298009634e-01f,
-    5.491934419e-01f,
-    1.210948467e+00f,
-    4.463083744e-01f,
-    6.594782472e-01f,
-    5.733889341e-01f,
-    9.253016114e-01f,
-    8.201832175e-01f,
-    8.165344000e-01f,
-    6.913155317e-01f,
-    1.051029563e+00f,
-    7.448859215e-01f,
-    8.007574677e-01f,
-    6.517831087e-01f,
-    1.278173685e+00f,
-    6.335554719e-01f,
-    1.068455338e+00f,
-    8.114186525e-01f,
-    9.767384529e-01f,
-    6.073655486e-01f,
-    1.081703663e+00f,
-    2.412011385e+00f,
-    1.442898512e+00f,
-    1.352110028e+00f,
-    7.167118192e-01f,
-    2.327529669e+00f,
-    9.644151330e-01f,
-    1.267837286e+00f,
-    1.267343998e+00f,
-    1.600412726e+00f,
-    2.228406191e+00f,
-    1.544841051e+00f,
-    8.034018278e-01f,
-    1.696441770e+00f,
-    8.056820035e-01f,
-    1.007524490e+00f,
-    1.536659718e+00f,
-    2.148414135e+00f,
-    8.164731860e-01f,
-    9.093717933e-01f,
-    1.560453296e+00f,
-    1.245977044e+00f,
-    1.713197947e+00f,
-    1.116518974e+00f,
-    1.102053523e+00f,
-    1.042443275e+00f,
-    8.859341741e-01f,
-    1.866384149e+00f,
-    7.506043315e-01f,
-    1.005092859e+00f,
-    1.034954548e+00f,
-    1.410924911e+00f,
-    1.485036612e+00f,
-    1.579080224e+00f,
-    1.258835196e+00f,
-    6.514176726e-01f,
-    8.938605785e-01f,
-    6.944116354e-01f,
-    9.493600130e-01f,
-    3.026626587e+00f,
-    1.551815987e+00f,
-    2.179844856e+00f,
-    8.678267598e-01f,
-    7.701101899e-01f,
-    1.642204285e+00f,
-    4.468985498e-01f,
-    1.007567644e+00f,
-    4.386372566e-01f,
-    8.021352887e-01f,
-    7.600979805e-01f,
-    1.584955573e+00f,
-    6.775039434e-01f,
-    1.170000672e+00f,
-    1.367316723e+00f,
-    1.369408131e+00f,
-    7.390154600e-01f,
-    1.020533800e+00f,
-    8.077121377e-01f,
-    1.315288901e+00f,
-    1.184071660e+00f,
-    1.100960135e+00f,
-    1.326723933e+00f,
-    7.739100456e-01f,
-    8.529281020e-01f,
-    1.230836868e+00f,
-    1.577351809e+00f,
-    1.264448881e+00f,
-    1.415927529e+00f,
-    8.384362459e-01f,
-    2.492681146e-01f,
-    1.171347260e+00f,
-    1.097205043e+00f,
-    1.586161613e+00f,
-    1.023276925e+00f,
-    1.315730453e+00f,
-    1.035204649e+00f,
-    1.240557671e+00f,
-    1.139936090e+00f,
-    7.612699866e-01f,
-    1.251408458e+00f,
-    1.658804655e+00f,
-    1.685579181e+00f,
-    1.777968168e+00f,
-    1.582236171e+00f,
-    1.961815238e+00f,
-    8.801847100e-01f,
-    1.047725677e+00f,
-    1.714547396e+00f,
-    1.072450519e+00f,
-    1.173205376e+00f,
-    5.097637773e-01f,
-    8.319088221e-01f,
-    8.194394708e-01f,
-    1.244619131e+00f,
-    1.687753201e+00f,
-    1.511706829e+00f,
-    1.294720292e+00f,
-    1.655575275e+00f,
-    2.096931219e+00f,
-    1.023079276e+00f,
-    9.466988444e-01f,
-    8.856416345e-01f,
-    5.699400306e-01f,
-    5.897875428e-01f,
-    4.974484742e-01f,
-    8.913601637e-01f,
-    6.407741308e-01f,
-    5.667223930e-01f,
-    7.683082223e-01f,
-    9.185533524e-01f,
-    9.785170555e-01f,
-    8.918649554e-01f,
-    8.347468972e-01f,
-    8.526034951e-01f,
-    5.556422472e-01f,
-    3.413586617e-01f,
-    5.193238854e-01f,
-    3.274475932e-01f,
-    1.054644585e+00f,
-    7.539538741e-01f,
-    8.395013213e-01f,
-    7.705441117e-01f,
-    4.444709122e-01f,
-    7.461326122e-01f,
-    1.799140573e+00f,
-    9.285287857e-01f,
-    7.650210857e-01f,
-    6.375569105e-01f,
-    5.737375021e-01f,
-    5.426654220e-01f,
-    1.524329424e+00f,
-    7.155150771e-01f,
-    9.333989620e-01f,
-    8.161906600e-01f,
-    8.930690885e-01f,
-    2.023249388e+00f,
-    1.939439058e+00f,
-    8.194949031e-01f,
-    1.365241766e+00f,
-    3.398782492e+00f,
-    1.361660361e+00f,
-    1.009425998e+00f,
-    8.308207989e-01f,
-    1.004316092e+00f,
-    8.761237264e-01f,
-    4.898432195e-01f,
-    5.763670802e-01f,
-    7.189967036e-01f,
-    1.151958942e+00f,
-    1.085193515e+00f,
-    1.000104785e+00f,
-    1.209625363e+00f,
-    7.352276444e-01f,
-    2.021885395e+00f,
-    7.894913554e-01f,
-    9.302017093e-01f,
-    8.885145783e-01f,
-    8.788156509e-01f,
-    1.700590611e+00f,
-    8.745340109e-01f,
-    1.137431979e+00f,
-    9.289550185e-01f,
-    6.908848882e-01f,
-    1.229533792e+00f,
-    1.654853225e+00f,
-    2.251959801e+00f,
-    5.621535182e-01f,
-    1.238694787e+00f,
-    1.403325438e+00f,
-    5.292518139e-01f,
-    7.121678591e-01f,
-    5.657099485e-01f,
-    1.168002963e+00f,
-    1.339987397e+00f,
-    1.401485205e+00f,
-    1.832468152e+00f,
-    1.183347464e+00f,
-    7.066594958e-01f,
-    1.628628731e+00f,
-    1.011150956e+00f,
-    8.734185100e-01f,
-    1.327526212e+00f,
-    1.103556991e+00f,
-    1.389600277e+00f,
-    5.310465693e-01f,
-    1.066563129e+00f,
-    8.879130483e-01f,
-    1.560753345e+00f,
-    2.308683157e+00f,
-    2.333429813e+00f,
-    8.407301307e-01f,
-    1.434914708e+00f,
-    8.765323162e-01f,
-    6.360076666e-01f,
-    8.937277794e-01f,
-    8.819537163e-01f,
-    7.785468102e-01f,
-    9.572642446e-01f,
-    9.465723634e-01f,
-    6.532240510e-01f,
-    1.012538433e+00f,
-    7.814020514e-01f,
-    9.021663666e-01f,
-    1.117985129e+00f,
-    6.219121814e-01f,
-    1.736166596e+00f,
-    3.777012527e-01f,
-    1.494891882e+00f,
-    8.839313984e-01f,
-    1.368993878e+00f,
-    1.084744692e+00f,
-    6.054929495e-01f,
-    7.022607327e-01f,
-    9.484356642e-01f,
-    1.130965352e+00f,
-    7.976901531e-01f,
-    1.953930378e+00f,
-    2.400662661e+00f,
-    2.883861542e+00f,
-    1.145769477e+00f,
-    1.227587223e+00f,
-    7.733110189e-01f,
-    9.811575413e-01f,
-    2.023264885e+00f,
-    1.337256432e+00f,
-    1.637225747e+00f,
-    2.216557264e+00f,
-    1.208386302e+00f,
-    1.245005369e+00f,
-    1.967282534e+00f,
-    8.089128733e-01f,
-    1.140772343e+00f,
-    1.161452889e+00f,
-    1.053104401e+00f,
-    1.496699691e+00f,
-    8.317527771e-01f,
-    1.007287860e+00f,
-    5.157718062e-01f,
-    1.452715278e+00f,
-    9.753693342e-01f,
-    1.460513949e+00f,
-    2.533165216e+00f,
-    1.331668496e+00f,
-    1.181214929e+00f,
-    1.464397669e+00f,
-    1.257368922e+00f,
-    1.315456867e+00f,
-    9.336102009e-01f,
-    1.208532691e+00f,
-    1.547736049e+00f,
-    4.772652984e-01f,
-    8.486778736e-01f,
-    2.051080942e+00f,
-    1.219299197e+00f,
-    9.304289222e-01f,
-    1.296478868e+00f,
-    8.636526465e-01f,
-    1.811303377e+00f,
-    2.720543385e+00f,
-    1.271899343e+00f,
-    6.939744353e-01f,
-    1.108466864e+00f,
-    1.431529522e+00f,
-    2.336068153e+00f,
-    8.718306422e-01f,
-    8.353673220e-01f,
-    1.312143445e+00f,
-    1.856775403e+00f,
-    1.104760647e+00f,
-    6.016176939e-01f,
-    8.596351147e-01f,
-    8.790192008e-01f,
-    5.141509771e-01f,
-    6.946204305e-01f,
-    9.163212180e-01f,
-    7.037118673e-01f,
-    1.557654738e+00f,
-    1.215406656e+00f,
-    1.521566391e+00f,
-    1.011194944e+00f,
-    9.512689710e-01f,
-    4.435290098e-01f,
-    1.317124367e+00f,
-    1.079074383e+00f,
-    2.128579378e+00f,
-    7.375495434e-01f,
-    1.000356197e+00f,
-    1.244287491e+00f,
-    1.431410789e+00f,
-    8.780036569e-01f,
-    6.716923714e-01f,
-    1.028702497e+00f,
-    1.187995791e+00f,
-    5.782110691e-01f,
-    1.435917020e+00f,
-    1.449503541e+00f,
-    7.196836472e-01f,
-    1.146794438e+00f,
-    6.689255238e-01f,
-    6.349775791e-01f,
-    1.775089741e+00f,
-    6.661395431e-01f,
-    8.826771379e-01f,
-    1.205348492e+00f,
-    6.597352624e-01f,
-    1.267897129e+00f,
-    1.139494658e+00f,
-    1.285834432e+00f,
-    6.597349048e-01f,
-    1.196011186e+00f,
-    5.582711697e-01f,
-    1.659838080e+00f,
-    5.393820405e-01f,
-    1.338666439e+00f,
-    8.172351122e-01f,
-    1.047518253e+00f,
-    9.142765403e-01f,
-    1.146682143e+00f,
-    1.322286248e+00f,
-    1.120519280e+00f,
-    8.928370476e-01f,
-    7.623055577e-01f,
-    4.728651643e-01f,
-    1.518384218e+00f,
-    1.042410612e+00f,
-    9.045581222e-01f,
-    9.015749097e-01f,
-    1.223393798e+00f,
-    1.171246886e+00f,
-    1.056207657e+00f,
-    1.162885547e+00f,
-    1.795156121e+00f,
-    1.379521966e+00f,
-    1.773428559e+00f,
-    8.123396635e-01f,
-    2.265208721e+00f,
-    1.035957575e+00f,
-    7.597215772e-01f,
-    1.479597211e+00f,
-    7.274153829e-01f,
-    8.222546577e-01f,
-    9.238936901e-01f,
-    6.243886352e-01f,
-    6.188852191e-01f,
-    1.322473288e+00f,
-    8.618785739e-01f,
-    1.233038664e+00f,
-    1.439918041e+00f,
-    7.267972827e-01f,
-    1.232521534e+00f,
-    1.726270318e+00f,
-    9.220095873e-01f,
-    7.085356116e-01f,
-    8.647630215e-01f,
-    6.880691648e-01f,
-    9.693578482e-01f,
-    1.417093992e+00f,
-    1.517430425e+00f,
-    8.114020228e-01f,
-    1.270956159e+00f,
-    5.608578324e-01f,
-    6.580328941e-01f,
-    1.023082852e+00f,
-    7.132612467e-01f,
-    5.606921315e-01f,
-    1.015886903e+00f,
-    1.163216829e+00f,
-    1.398035526e+00f,
-    1.396401167e+00f,
-    7.236515880e-01f,
-    6.884413958e-01f,
-    1.556939006e+00f,
-    1.481167078e+00f,
-    1.117279887e+00f,
-    7.784309983e-01f,
-    1.854825616e+00f,
-    7.699812055e-01f,
-    1.704966784e+00f,
-    9.268708229e-01f,
-    1.096034050e+00f,
-    6.891609430e-01f,
-    8.725208640e-01f,
-    1.033406615e+00f,
-    2.815250397e+00f,
-    1.885088205e+00f,
-    1.268245697e+00f,
-    1.938680410e+00f,
-    1.714848042e+00f,
-    9.766609669e-01f,
-    1.197382092e+00f,
-    1.855600119e+00f,
-    7.647148371e-01f,
-    7.016776204e-01f,
-    1.586283803e+00f,
-    1.289616942e+00f,
-    1.123428106e+00f,
-    1.487255216e+00f,
-    7.331719398e-01f,
-    2.122608423e+00f,
-    1.617730379e+00f,
-    6.770694852e-01f,
-    9.722302556e-01f,
-    1.323927641e+00f,
-    1.083907962e+00f,
-    1.377702713e+00f,
-    7.284087539e-01f,
-    9.634587169e-01f,
-    1.067358851e+00f,
-    1.546411395e+00f,
-    4.881570935e-01f,
-    1.341151714e+00f,
-    1.052113533e+00f,
-    7.046202421e-01f,
-    6.538819075e-01f,
-    5.651808977e-01f,
-    2.478120327e-01f,
-    9.847760797e-01f,
-    1.097017765e+00f,
-    1.220185995e+00f,
-    7.863149047e-01f,
-    9.131167531e-01f,
-    1.314209938e+00f,
-    1.210893393e+00f,
-    9.879633188e-01f,
-    6.828315854e-01f,
-    9.608228207e-01f,
-    7.294246554e-01f,
-    1.117364287e+00f,
-    8.684624434e-01f,
-    5.343376994e-01f,
-    1.383433938e+00f,
-    1.379380584e+00f,
-    1.737069249e+00f,
-    7.940250039e-01f,
-    1.372697830e+00f,
-    1.141524553e+00f,
-    3.140130043e+00f,
-    1.667102933e+00f,
-    1.013019562e+00f,
-    1.316253424e+00f,
-    2.024840117e+00f,
-    8.759018183e-01f,
-    1.456768274e+00f,
-    1.176392317e+00f,
-    1.890533447e+00f,
-    8.672251105e-01f,
-    6.167937517e-01f,
-    5.613946915e-01f,
-    9.260102510e-01f,
-    6.654630899e-01f,
-    1.483724952e+00f,
-    7.697479725e-01f,
-    6.769601703e-01f,
-    8.305567503e-01f,
-    1.035737157e+00f,
-    1.212196112e+00f,
-    4.445570409e-01f,
-    1.367692709e+00f,
-    1.224932075e+00f,
-    2.478643894e+00f,
-    8.182986379e-01f,
-    7.856486440e-01f,
-    1.228147149e+00f,
-    1.957330346e+00f,
-    9.460568428e-01f,
-    1.219513774e+00f,
-    1.062075615e+00f,
-    1.343201399e+00f,
-    6.572431922e-01f,
-    1.028114557e+00f,
-    1.301980019e+00f,
-    1.464996696e+00f,
-    1.315973282e+00f,
-    1.123933911e+00f,
-    9.295535684e-01f,
-    1.042714238e+00f,
-    1.509842753e+00f,
-    1.001413941e+00f,
-    2.221698046e+00f,
-    1.156613827e+00f,
-    8.310292363e-01f,
-    7.786901593e-01f,
-    7.645591497e-01f,
-    1.768861651e+00f,
-    1.243711352e+00f,
-    6.051923633e-01f,
-    9.259991050e-01f,
-    1.278626919e+00f,
-    1.315779328e+00f,
-    9.794460535e-01f,
-    5.738396049e-01f,
-    8.430464268e-01f,
-    6.082305908e-01f,
-    1.032921195e+00f,
-    5.925141573e-01f,
-    5.636861920e-01f,
-    8.426346779e-01f,
-    7.257453203e-01f,
-    5.959022045e-01f,
-    8.038308024e-01f,
-    9.988279939e-01f,
-    1.136242986e+00f,
-    1.047753096e+00f,
-    8.623763919e-01f,
-    1.074866414e+00f,
-    9.918166399e-01f,
-    5.706934929e-01f,
-    5.399478674e-01f,
-    8.688337207e-01f,
-    1.041650534e+00f,
-    1.593994737e+00f,
-    9.873913527e-01f,
-    6.715446115e-01f,
-    1.061428547e+00f,
-    1.052206159e+00f,
-    6.592231989e-01f,
-    6.490701437e-01f,
-    2.000538588e+00f,
-    9.990131259e-01f,
-    1.363425136e+00f,
-    8.174952269e-01f,
-    1.075707793e+00f,
-    7.971325517e-01f,
-    1.880032539e+00f,
-    6.274368763e-01f,
-    6.866207123e-01f,
-    7.868951559e-01f,
-    1.759796381e+00f,
-    1.086470604e+00f,
-    1.090776801e+00f,
-    8.289415836e-01f,
-    1.202255249e+00f,
-    9.381995797e-01f,
-    2.099432230e+00f,
-    1.131305814e+00f,
-    6.256830692e-01f,
-    6.748878360e-01f,
-    1.097142220e+00f,
-    1.562543035e+00f,
-    1.013408303e+00f,
-    1.139342904e+00f,
-    8.191384673e-01f,
-    1.004471898e+00f,
-    1.516161084e+00f,
-    1.362428665e+00f,
-    1.516132116e+00f,
-    1.258880615e+00f,
-    1.472542882e+00f,
-    1.141377687e+00f,
-    1.542859077e+00f,
-    1.769767642e+00f,
-    6.883966327e-01f,
-    8.884530663e-01f,
-    1.405727148e+00f,
-    2.725970984e+00f,
-    2.781028450e-01f,
-    1.256634951e+00f,
-    9.843195081e-01f,
-    7.359466553e-01f,
-    1.476809144e+00f,
-    1.424070716e+00f,
-    9.352094531e-01f,
-    1.229272842e+00f,
-    9.021961093e-01f,
-    1.349459291e+00f,
-    7.879449725e-01f,
-    1.551337600e+00f,
-    1.743680000e+00f,
-    5.377484560e-01f,
-    9.269050956e-01f,
-    1.191554070e+00f,
-    1.224673510e+00f,
-    8.339179754e-01f,
-    1.138748050e+00f,
-    5.191717744e-01f,
-    5.667958856e-01f,
-    1.032435417e+00f,
-    9.715839624e-01f,
-    1.113024712e+00f,
-    8.020089865e-01f,
-    2.419592381e+00f,
-    9.231449366e-01f,
-    1.218626738e+00f,
-    7.460641265e-01f,
-    7.473254204e-01f,
-    1.061800957e+00f,
-    9.665453434e-01f,
-    8.110522032e-01f,
-    1.114603877e+00f,
-    1.606832266e+00f,
-    9.560930133e-01f,
-    7.316638827e-01f,
-    1.123777509e+00f,
-    6.648707986e-01f,
-    1.048774600e+00f,
-    9.783372879e-01f,
-    1.293782711e+00f,
-    8.425490260e-01f,
-    1.183735847e+00f,
-    1.287627935e+00f,
-    1.601551175e+00f,
-    1.223155260e+00f,
-    1.318116665e+00f,
-    9.997670650e-01f,
-    6.302054524e-01f,
-    8.521176577e-01f,
-    1.272302032e+00f,
-    8.371815681e-01f,
-    1.315120816e+00f,
-    7.868425250e-01f,
-    6.591926217e-01f,
-    7.974154949e-01f,
-    1.089704633e+00f,
-    1.113671422e+00f,
-    2.200077295e+00f,
-    1.566237807e+00f,
-    1.693858504e+00f,
-    5.992707610e-01f,
-    1.023998141e+00f,
-    1.769399166e+00f,
-    1.588015199e+00f,
-    1.618971229e+00f,
-    8.992010951e-01f,
-    1.105252981e+00f,
-    9.318636656e-01f,
-    6.510490179e-01f,
-    9.999585748e-01f,
-    9.799796939e-01f,
-    1.171836138e+00f,
-    1.220197201e+00f,
-    8.008850217e-01f,
-    1.600098848e+00f,
-    1.371975183e+00f,
-    7.591778636e-01f,
-    1.404694915e+00f,
-    1.149115086e+00f,
-    1.430340171e+00f,
-    7.707867622e-01f,
-    9.923997521e-01f,
-    8.894896507e-01f,
-    2.397457838e+00f,
-    8.218647242e-01f,
-    1.114594340e+00f,
-    1.329838753e+00f,
-    9.942133427e-01f,
-    7.749480605e-01f,
-    1.234911442e+00f,
-    1.081709981e+00f,
-    6.912666559e-01f,
-    1.119313598e+00f,
-    8.978507519e-01f,
-    7.499963641e-01f,
-    1.122170687e+00f,
-    1.203012705e+00f,
-    1.255145669e+00f,
-    1.558870196e+00f,
-    1.907542586e+00f,
-    1.067816257e+00f,
-    7.992069721e-01f,
-    7.547400594e-01f,
-    7.888071537e-01f,
-    2.309702873e+00f,
-    2.211895227e+00f,
-    1.435959458e+00f,
-    7.202125192e-01f,
-    7.929540873e-01f,
-    1.100791812e+00f,
-    8.434224129e-01f,
-    1.451957703e+00f,
-    1.036504030e+00f,
-    1.509807825e+00f,
-    5.396217704e-01f,
-    1.495514989e+00f,
-    2.073125839e+00f,
-    1.738001823e+00f,
-    1.951882124e+00f,
-    4.515668750e-01f,
-    1.328391910e+00f,
-    7.651761174e-01f,
-    1.745778084e+00f,
-    2.650500774e+00f,
-    1.343672633e+00f,
-    9.313576221e-01f,
-    1.833368063e+00f,
-    1.014393091e+00f,
-    1.460679889e+00f,
-    6.914064884e-01f,
-    8.038579226e-01f,
-    9.963661432e-01f,
-    1.126917481e+00f,
-    1.335009813e+00f,
-    1.216039300e+00f,
-    9.436741471e-01f,
-    1.060676813e+00f,
-    1.768279076e+00f,
-    4.048754275e-01f,
-    7.644977570e-01f,
-    1.109097123e+00f,
-    1.676042914e+00f,
-    1.572801828e+00f,
-    8.225879669e-01f,
-    7.329956293e-01f,
-    1.731628060e+00f,
-    1.265130043e+00f,
-    9.099199772e-01f,
-    1.106594563e+00f,
-    1.117377639e+00f,
-    1.240532398e+00f,
-    9.238934517e-01f,
-    4.703314900e-01f,
-    1.774427295e+00f,
-    7.471988797e-01f,
-    4.114200473e-01f,
-    7.733195424e-01f,
-    3.913607895e-01f,
-    8.037277460e-01f,
-    1.254905224e+00f,
-    1.094803452e+00f,
-    1.061873317e+00f,
-    4.298977256e-01f,
-    8.425161839e-01f,
-    8.424434662e-01f,
-    1.447234154e+00f,
-    1.085242629e+00f,
-    1.614510417e+00f,
-    7.735794187e-01f,
-    1.829690814e+00f,
-    1.316423774e+00f,
-    8.038141727e-01f,
-    1.324866414e+00f,
-    9.696038365e-01f,
-    1.054751158e+00f,
-    1.432603478e+00f,
-    8.674724102e-01f,
-    9.243713617e-01f,
-    9.489327073e-01f,
-    1.278701901e+00f,
-    9.765011668e-01f,
-    8.294647336e-01f,
-    1.304088473e+00f,
-    1.640066266e+00f,
-    1.431995630e+00f,
-    9.937238097e-01f,
-    9.819806218e-01f,
-    8.894582987e-01f,
-    1.251282454e+00f,
-    1.270461679e+00f,
-    7.319296598e-01f,
-    7.016794682e-01f,
-    1.503102899e+00f,
-    1.336375237e+00f,
-    8.462983370e-01f,
-    5.002647042e-01f,
-    8.867622018e-01f,
-    1.119430304e+00f,
-    6.880722642e-01f,
-    4.499270916e-01f,
-    1.110942483e+00f,
-    7.425438762e-01f,
-    7.113267779e-01f,
-    1.395773530e+00f,
-    1.048437715e+00f,
-    9.933460951e-01f,
-    6.607928276e-01f,
-    1.616063595e+00f,
-    8.045443296e-01f,
-    8.214616179e-01f,
-    9.322089553e-01f,
-    7.589716315e-01f,
-    7.643625140e-01f,
-    1.004878283e+00f,
-    1.281446218e+00f,
-    1.293694615e+00f,
-    1.187611341e+00f,
-    1.044587851e+00f,
-    1.187680125e+00f,
-    1.491914868e+00f,
-    1.349472761e+00f,
-    7.379614711e-01f,
-    6.841132045e-01f,
-    5.681566000e-01f,
-    1.519564867e+00f,
-    1.241567492e+00f,
-    1.856430292e+00f,
-    4.939989150e-01f,
-    6.754721999e-01f,
-    1.223862529e+00f,
-    6.958372593e-01f,
-    5.896908045e-01f,
-    8.752862811e-01f,
-    1.764892101e+00f,
-    7.886362076e-01f,
-    8.978043199e-01f,
-    1.019557595e+00f,
-    7.689282298e-01f,
-    4.822885394e-01f,
-    8.364492059e-01f,
-    8.254629374e-01f,
-    1.211596489e+00f,
-    9.410710335e-01f,
-    1.893207312e+00f,
-    1.207178354e+00f,
-    1.132546902e+00f,
-    9.759249091e-01f,
-    8.595910668e-01f,
-    9.510750175e-01f,
-    9.881262183e-01f,
-    9.488444924e-01f,
-    7.697842121e-01f,
-    1.101663351e+00f,
-    1.325476646e+00f,
-    1.373412848e+00f,
-    1.307235479e+00f,
-    1.183091402e+00f,
-    1.346193552e+00f,
-    1.251076460e+00f,
-    7.754117250e-01f,
-    9.466217756e-01f,
-    1.699384928e+00f,
-    4.485459626e-01f,
-    1.621202111e+00f,
-    1.379581928e+00f,
-    1.351515174e+00f,
-    6.419385672e-01f,
-    6.963441372e-01f,
-    4.532332122e-01f,
-    7.843693495e-01f,
-    1.084753394e+00f,
-    1.796413660e+00f,
-    6.874082088e-01f,
-    8.481292129e-01f,
-    6.559879780e-01f,
-    1.128918290e+00f,
-    1.029899120e+00f,
-    1.240364552e+00f,
-    6.836715937e-01f,
-    1.119274378e+00f,
-    8.134134412e-01f,
-    6.714701653e-01f,
-    9.951710701e-01f,
-    6.734547615e-01f,
-    9.631972909e-01f,
-    1.008857965e+00f,
-    1.601038814e+00f,
-    1.021132708e+00f,
-    1.896292090e+00f,
-    1.024984479e+00f,
-    1.029564857e+00f,
-    9.126811028e-01f,
-    8.937518001e-01f,
-    6.048314571e-01f,
-    1.681673765e+00f,
-    4.956573546e-01f,
-    8.257380128e-01f,
-    1.028739452e+00f,
-    7.861958742e-01f,
-    5.431281924e-01f,
-    6.377541423e-01f,
-    1.154129505e+00f,
-    1.268863678e+00f,
-    5.964624286e-01f,
-    9.105467200e-01f,
-    1.699685812e+00f,
-    1.384725571e+00f,
-    6.078882217e-01f,
-    4.993014634e-01f,
-    5.351445079e-01f,
-    7.234433889e-01f,
-    1.785422921e+00f,
-    1.037050486e+00f,
-    1.041957259e+00f,
-    7.751131654e-01f,
-    1.670899749e+00f,
-    1.457571745e+00f,
-    8.227028251e-01f,
-    1.199574232e+00f,
-    7.706480622e-01f,
-    1.241003871e+00f,
-    1.500160694e+00f,
-    7.947252989e-01f,
-    1.372991204e+00f,
-    8.818881512e-01f,
-    1.493646502e+00f,
-    1.030570626e+00f,
-    8.239296675e-01f,
-    6.199110150e-01f,
-    1.103316903e+00f,
-    8.951109648e-01f,
-    1.035019994e+00f,
-    1.085116148e+00f,
-    9.004822969e-01f,
-    6.631327868e-01f,
-    7.948626280e-01f,
-    9.912574291e-01f,
-    6.653156877e-01f,
-    9.822413921e-01f,
-    8.265587091e-01f,
-    1.917907596e+00f,
-    1.107889056e+00f,
-    9.300953746e-01f,
-    1.409246445e+00f,
-    2.075943947e+00f,
-    1.447389722e+00f,
-    1.091621876e+00f,
-    6.873023510e-01f,
-    1.055362821e+00f,
-    7.269573808e-01f,
-    7.943280339e-01f,
-    1.638713121e+00f,
-    9.914732575e-01f,
-    7.326362133e-01f,
-    1.754868507e+00f,
-    1.486699939e+00f,
-    7.794820666e-01f,
-    1.021801353e+00f,
-    1.462052941e+00f,
-    9.104706049e-01f,
-    9.947130084e-01f,
-    1.061408162e+00f,
-    6.544536948e-01f,
-    7.425261140e-01f,
-    1.517149448e+00f,
-    1.149795771e+00f,
-    1.295670867e+00f,
-    9.175129533e-01f,
-    1.088756800e+00f,
-    3.861191571e-01f,
-    5.763293505e-01f,
-    9.597003460e-01f,
-    4.921940565e-01f,
-    5.199497342e-01f,
-    5.594098568e-01f,
-    6.719036102e-01f,
-    8.866574764e-01f,
-    4.693256915e-01f,
-    8.361742496e-01f,
-    4.875065982e-01f,
-    8.646238446e-01f,
-    1.498655319e+00f,
-    8.416120410e-01f,
-    7.480234504e-01f,
-    1.024978757e+00f,
-    7.376930714e-01f,
-    1.311121583e+00f,
-    6.226776838e-01f,
-    1.157239199e+00f,
-    9.950374961e-01f,
-    1.982435822e+00f,
-    1.170562506e+00f,
-    4.981037974e-01f,
-    1.296605110e+00f,
-    1.246505022e+00f,
-    2.262132168e+00f,
-    1.047663331e+00f,
-    7.001935840e-01f,
-    1.232861161e+00f,
-    8.862689734e-01f,
-    6.126351357e-01f,
-    6.124925017e-01f,
-    1.367883563e+00f,
-    1.550183296e+00f,
-    1.905951142e+00f,
-    1.259261727e+00f,
-    4.052333832e-01f,
-    1.163331509e+00f,
-    6.080068946e-01f,
-    7.008162141e-01f,
-    8.623425961e-01f,
-    6.063044071e-01f,
-    1.636359930e+00f,
-    1.698883772e+00f,
-    1.101123810e+00f,
-    1.183627605e+00f,
-    9.501300454e-01f,
-    1.137353659e+00f,
-    9.340844154e-01f,
-    6.341862082e-01f,
-    2.017869949e+00f,
-    1.153914094e+00f,
-    8.826593161e-01f,
-    7.435104847e-01f,
-    1.031454921e+00f,
-    1.095435500e+00f,
-    9.893676043e-01f,
-    8.506560326e-01f,
-    1.108960629e+00f,
-    1.739062667e+00f,
-    1.647931635e-01f,
-    2.044768572e+00f,
-    1.914620280e+00f,
-    2.538443804e+00f,
-    8.311876655e-01f,
-    1.375321746e+00f,
-    1.267636180e+00f,
-    1.759011626e+00f,
-    9.436151385e-01f,
-    7.556290627e-01f,
-    1.869498730e+00f,
-    9.619944692e-01f,
-    1.243848562e+00f,
-    1.444072247e+00f,
-    1.597856641e+00f,
-    1.076737285e+00f,
-    2.016608000e+00f,
-    1.295842052e+00f,
-    1.159765959e+00f,
-    1.918249607e+00f,
-    1.451491237e+00f,
-    1.385230780e+00f,
-    9.360280633e-01f,
-    1.495757461e+00f,
-    1.037035108e+00f,
-    8.335070610e-01f,
-    1.974591255e+00f,
-    1.303632617e+00f,
-    8.569972515e-01f,
-    9.996969104e-01f,
-    1.232970715e+00f,
-    1.065664530e+00f,
-    7.115583420e-01f,
-    3.822496831e-01f,
-    3.969278336e-01f,
-    1.127279520e+00f,
-    3.594196439e-01f,
-    9.478405118e-01f,
-    1.601827621e+00f,
-    1.501028419e+00f,
-    1.277886868e+00f,
-    7.751448750e-01f,
-    7.326064110e-01f,
-    7.809224725e-01f,
-    3.996748626e-01f,
-    5.177862644e-01f,
-    5.631262660e-01f,
-    6.053896546e-01f,
-    1.147325754e+00f,
-    1.249773026e+00f,
-    4.521912932e-01f,
-    7.478890419e-01f,
-    7.687731385e-01f,
-    1.045310020e+00f,
-    5.587201118e-01f,
-    4.217544198e-01f,
-    6.578729749e-01f,
-    9.440323710e-01f,
-    8.998073936e-01f,
-    8.553433418e-01f,
-    7.964304686e-01f,
-    1.168983459e+00f,
-    1.796856165e+00f,
-    1.767185688e+00f,
-    1.578463078e+00f,
-    1.085407019e+00f,
-    5.211560130e-01f,
-    1.537926555e+00f,
-    8.215203881e-01f,
-    7.939723730e-01f,
-    1.242011189e+00f,
-    1.096787095e+00f,
-    9.503635764e-01f,
-    4.904747307e-01f,
-    1.257480979e+00f,
-    1.067410588e+00f,
-    1.406663060e+00f,
-    7.969920039e-01f,
-    2.089796066e+00f,
-    8.265146613e-01f,
-    6.771996021e-01f,
-    9.058909416e-01f,
-    6.342887282e-01f,
-    1.474775791e+00f,
-    1.848918676e+00f,
-    8.588996530e-01f,
-    1.144599319e+00f,
-    7.394987941e-01f,
-    2.101698160e+00f,
-    2.056956768e+00f,
-    9.062638879e-01f,
-    1.755125284e+00f,
-    1.755076528e+00f,
-    1.153621674e+00f,
-    2.199676752e+00f,
-    7.934887409e-01f,
-    1.343491912e+00f,
-    1.341908455e+00f,
-    1.174511552e+00f,
-    1.184956074e+00f,
-    2.071126699e+00f,
-    6.874348521e-01f,
-    1.660233617e+00f,
-    8.670246601e-01f,
-    1.056033850e+00f,
-    1.178169489e+00f,
-    1.161603332e+00f,
-    1.733749509e+00f,
-    1.423261523e+00f,
-    2.810864925e+00f,
-    1.745731592e+00f,
-    2.566701412e+00f,
-    2.045803308e+00f,
-    9.299988747e-01f,
-    7.564049959e-01f,
-    1.262885809e+00f,
-    8.652192950e-01f,
-    6.343924999e-01f,
-    8.377011418e-01f,
-    1.104804635e+00f,
-    1.019037843e+00f,
-    1.121197343e+00f,
-    1.529112816e+00f,
-    6.217966080e-01f,
-    9.237624407e-01f,
-    5.254831314e-01f,
-    7.003992200e-01f,
-    4.575816393e-01f,
-    5.720549226e-01f,
-    6.421757936e-01f,
-    8.023661971e-01f,
-    1.273803711e+00f,
-    1.888629675e+00f,
-    1.273936272e+00f,
-    7.310796380e-01f,
-    1.381648898e+00f,
-    3.986202776e-01f,
-    9.026063681e-01f,
-    1.238164067e+00f,
-    4.351036549e-01f,
-    2.595633268e-01f,
-    5.109812617e-01f,
-    8.604800105e-01f,
-    2.014343023e+00f,
-    1.108227372e+00f,
-    6.063264608e-01f,
-    7.473592758e-01f,
-    1.044934034e+00f,
-    1.558348298e+00f,
-    1.438946605e+00f,
-    2.175517321e+00f,
-    1.151212215e+00f,
-    1.458021760e+00f,
-    5.154127479e-01f,
-    6.925129890e-01f,
-    8.304815292e-01f,
-    1.757168889e+00f,
-    7.747732997e-01f,
-    2.321263552e+00f,
-    1.469680190e+00f,
-    1.330696940e+00f,
-    1.268594384e+00f,
-    1.096788526e+00f,
-    4.602774680e-01f,
-    9.002246261e-01f,
-    1.815566540e+00f,
-    7.293612957e-01f,
-    8.300645947e-01f,
-    4.734966159e-01f,
-    1.317103028e+00f,
-    1.823691130e+00f,
-    9.784916043e-01f,
-    4.642309546e-01f,
-    7.662634254e-01f,
-    5.491433144e-01f,
-    9.753193855e-01f,
-    1.284331560e+00f,
-    1.474079013e+00f,
-    1.103048563e+00f,
-    1.844204903e+00f,
-    8.829436302e-01f,
-    1.511342168e+00f,
-    1.411878467e+00f,
-    1.097265244e+00f,
-    9.689759016e-01f,
-    1.304603457e+00f,
-    1.150687456e+00f,
-    9.726147652e-01f,
-    1.354881287e+00f,
-    2.668841362e+00f,
-    1.028781891e+00f,
-    7.881240845e-01f,
-    7.374772429e-01f,
-    9.791814685e-01f,
-    1.399488688e+00f,
-    1.395185590e+00f,
-    1.043271661e+00f,
-    1.843959093e+00f,
-    9.648509622e-01f,
-    1.213203073e+00f,
-    5.794240832e-01f,
-    7.317084670e-01f,
-    7.267890573e-01f,
-    6.616209149e-01f,
-    5.897050500e-01f,
-    5.948091745e-01f,
-    6.760764122e-01f,
-    1.300651431e+00f,
-    1.788183570e+00f,
-    6.428475380e-01f,
-    8.654955029e-01f,
-    7.570126653e-01f,
-    1.148880363e+00f,
-    6.483777761e-01f,
-    9.119706750e-01f,
-    7.143929005e-01f,
-    8.077697754e-01f,
-    1.323988438e+00f,
-    2.201935053e+00f,
-    8.326605558e-01f,
-    6.085047722e-01f,
-    5.755667090e-01f,
-    1.228529811e+00f,
-    7.405598164e-01f,
-    1.710640907e+00f,
-    1.176715493e+00f,
-    8.794370890e-01f,
-    1.515302300e+00f,
-    1.156660199e+00f,
-    6.713997126e-01f,
-    6.545169950e-01f,
-    1.272650003e+00f,
-    1.599910021e+00f,
-    9.064331651e-01f,
-    1.871679783e+00f,
-    1.299234390e+00f,
-    1.013877988e+00f,
-    1.476878166e+00f,
-    1.247178435e+00f,
-    8.702568412e-01f,
-    1.163606644e+00f,
-    1.881348252e+00f,
-    7.213193178e-01f,
-    1.799786210e+00f,
-    1.387428403e+00f,
-    6.657461524e-01f,
-    1.449561238e+00f,
-    1.266425371e+00f,
-    2.644458055e+00f,
-    2.176791191e+00f,
-    8.214998245e-01f,
-    4.018059373e-01f,
-    8.743180037e-01f,
-    4.068487287e-01f,
-    1.032198429e+00f,
-    1.729521751e+00f,
-    1.463534951e+00f,
-    9.539444447e-01f,
-    5.735498667e-01f,
-    5.242467523e-01f,
-    1.360320687e+00f,
-    1.006631613e+00f,
-    7.185249329e-01f,
-    1.024971724e+00f,
-    9.315487742e-01f,
-    9.350271821e-01f,
-    1.331989646e+00f,
-    6.588628888e-01f,
-    1.096066713e+00f,
-    7.730369568e-01f,
-    1.412994742e+00f,
-    5.025934577e-01f,
-    9.664288163e-01f,
-    1.040322065e+00f,
-    1.561226487e+00f,
-    1.082801223e+00f,
-    1.489205718e+00f,
-    6.898918748e-01f,
-    9.408832192e-01f,
-    1.385618329e+00f,
-    1.150974870e+00f,
-    1.151338220e+00f,
-    1.846343160e+00f,
-    1.883305550e+00f,
-    5.183041096e-01f,
-    2.009553194e+00f,
-    7.619744539e-01f,
-    1.473153353e+00f,
-    1.481256127e+00f,
-    8.847103715e-01f,
-    7.260645032e-01f,
-    9.349560738e-01f,
-    5.279106498e-01f,
-    9.573531151e-01f,
-    1.107775927e+00f,
-    1.493458152e+00f,
-    1.094716311e+00f,
-    5.257393718e-01f,
-    7.501761913e-01f,
-    1.495492935e+00f,
-    8.946298957e-01f,
-    1.079571009e+00f,
-    1.291433930e+00f,
-    8.960571289e-01f,
-    1.328720927e+00f,
-    1.156976342e+00f,
-    1.960944295e+00f,
-    7.919601202e-01f,
-    5.727998018e-01f,
-    8.121340871e-01f,
-    8.528971076e-01f,
-    1.942926764e+00f,
-    1.481306434e+00f,
-    1.433907747e+00f,
-    1.348597884e+00f,
-    1.425672174e+00f,
-    9.166662693e-01f,
-    2.411804676e+00f,
-    2.200334311e+00f,
-    1.394976497e+00f,
-    1.474402308e+00f,
-    5.574190021e-01f,
-    1.199831605e+00f,
-    1.723231554e+00f,
-    2.904367208e+00f,
-    1.253052354e+00f,
-    1.062795043e+00f,
-    2.354579926e+00f,
-    1.294244051e+00f,
-    1.343145132e+00f,
-    1.479681730e+00f,
-    1.501723528e+00f,
-    5.707989931e-01f,
-    8.586640954e-01f,
-    1.216566563e+00f,
-    1.404378891e+00f,
-    2.494597912e+00f,
-    1.269108653e+00f,
-    1.147388339e+00f,
-    1.089696646e+00f,
-    1.204109907e+00f,
-    6.450562477e-01f,
-    1.390308976e+00f,
-    1.753179431e+00f,
-    9.096090794e-01f,
-    1.470878959e+00f,
-    5.619471073e-01f,
-    1.093634725e+00f,
-    1.206643343e+00f,
-    8.545962572e-01f,
-    5.625486970e-01f,
-    5.903176069e-01f,
-    1.353788853e+00f,
-    1.116595387e+00f,
-    9.829123616e-01f,
-    8.459614515e-01f,
-    1.202772975e+00f,
-    1.202582955e+00f,
-    1.326018333e+00f,
-    6.170520186e-01f,
-    1.170889020e+00f,
-    1.248816729e+00f,
-    1.074928761e+00f,
-    2.031029940e+00f,
-    2.264570475e+00f,
-    6.356776357e-01f,
-    1.359390855e+00f,
-    1.230110526e+00f,
-    2.017366171e+00f,
-    1.660356998e+00f,
-    1.226434469e+00f,
-    2.890378475e+00f,
-    9.279357195e-01f,
-    7.149407864e-01f,
-    9.573049545e-01f,
-    1.223997831e+00f,
-    7.844852805e-01f,
-    1.011869788e+00f,
-    1.043480635e+00f,
-    9.098405838e-01f,
-    6.033196449e-01f,
-    1.050456166e+00f,
-    1.269938588e+00f,
-    6.030591130e-01f,
-    9.513036609e-01f,
-    8.861032724e-01f,
-    1.819531679e+00f,
-    9.484754801e-01f,
-    1.413788915e+00f,
-    6.740526557e-01f,
-    1.156346083e+00f,
-    8.254889250e-01f,
-    7.200582623e-01f,
-    7.501202822e-01f,
-    8.506062627e-01f,
-    8.803228736e-01f,
-    6.028251052e-01f,
-    8.625565171e-01f,
-    4.884468317e-01f,
-    7.258397341e-01f,
-    1.122039080e+00f,
-    1.025355220e+00f,
-    5.440155268e-01f,
-    1.040113807e+00f,
-    1.190794826e+00f,
-    1.640568852e+00f,
-    8.570865989e-01f,
-    7.083258629e-01f,
-    5.790189505e-01f,
-    6.966935992e-01f,
-    2.187018633e+00f,
-    1.597606182e+00f,
-    1.130327821e+00f,
-    9.076126218e-01f,
-    1.890740395e+00f,
-    1.120655179e+00f,
-    5.527040362e-01f,
-    1.081731200e+00f,
-    1.222197175e+00f,
-    9.992907643e-01f,
-    1.061957836e+00f,
-    8.342223167e-01f,
-    1.131398320e+00f,
-    1.224593401e+00f,
-    1.954100966e+00f,
-    9.762936234e-01f,
-    9.599654675e-01f,
-    2.597688675e+00f,
-    9.613296986e-01f,
-    1.158256292e+00f,
-    1.520710588e+00f,
-    1.977432370e+00f,
-    7.758967876e-01f,
-    1.239374995e+00f,
-    1.076711178e+00f,
-    9.913738966e-01f,
-    1.224171400e+00f,
-    1.026060343e+00f,
-    7.017550468e-01f,
-    7.417898178e-01f,
-    8.866868019e-01f,
-    1.328706026e+00f,
-    8.046035767e-01f,
-    1.330091953e+00f,
-    8.869369626e-01f,
-    7.158107162e-01f,
-    1.192610145e+00f,
-    1.137587667e+00f,
-    1.492907882e+00f,
-    1.429026246e+00f,
-    7.436451316e-01f,
-    9.269958138e-01f,
-    1.200272799e+00f,
-    2.292789072e-01f,
-    1.150430918e+00f,
-    1.995345712e+00f,
-    1.541182280e+00f,
-    7.882479429e-01f,
-    1.405831456e+00f,
-    2.836031020e-01f,
-    1.225914001e+00f,
-    1.376772523e+00f,
-    5.786358714e-01f,
-    8.339613080e-01f,
-    8.576048613e-01f,
-    1.035613179e+00f,
-    7.711631060e-01f,
-    1.939386845e+00f,
-    1.154904246e+00f,
-    1.467072248e+00f,
-    1.043102503e+00f,
-    5.467959046e-01f,
-    9.948526621e-01f,
-    1.283592701e+00f,
-    7.131689191e-01f,
-    9.355012774e-01f,
-    8.513947725e-01f,
-    1.861375332e+00f,
-    2.428668737e+00f,
-    1.310186505e+00f,
-    9.450407624e-01f,
-    1.139655828e+00f,
-    1.182350278e+00f,
-    4.592834711e-01f,
-    2.908439338e-01f,
-    1.536289930e+00f,
-    1.033012271e+00f,
-    1.575243473e+00f,
-    4.638909400e-01f,
-    5.686442852e-01f,
-    1.671128035e+00f,
-    3.276808262e-01f,
-    1.673461676e+00f,
-    8.308774829e-01f,
-    1.014037490e+00f,
-    1.612592459e+00f,
-    8.282069564e-01f,
-    1.151712418e+00f,
-    1.491237164e+00f,
-    1.368252635e+00f,
-    1.002685308e+00f,
-    6.239392757e-01f,
-    1.033969402e+00f,
-    7.290118933e-01f,
-    6.975130439e-01f,
-    7.132413387e-01f,
-    9.634855390e-01f,
-    6.753692627e-01f,
-    1.286385536e+00f,
-    1.329165220e+00f,
-    9.822930694e-01f,
-    1.085502982e+00f,
-    4.700172842e-01f,
-    1.201803088e+00f,
-    5.744690299e-01f,
-    1.547484398e+00f,
-    1.863026381e+00f,
-    1.694555640e+00f,
-    1.062291622e+00f,
-    1.357391357e+00f,
-    1.142994642e+00f,
-    7.014572620e-01f,
-    4.831116796e-01f,
-    1.684463501e+00f,
-    1.146086216e+00f,
-    1.433501363e+00f,
-    1.303518057e+00f,
-    2.210253954e+00f,
-    1.177718759e+00f,
-    1.128182769e+00f,
-    8.244764805e-01f,
-    1.288857937e+00f,
-    9.060695171e-01f,
-    7.874036431e-01f,
-    1.277580261e+00f,
-    8.014311194e-01f,
-    1.022026062e+00f,
-    1.422587872e+00f,
-    6.417030096e-01f,
-    1.059484124e+00f,
-    6.625470519e-01f,
-    7.553732991e-01f,
-    9.002219439e-01f,
-    1.055573583e+00f,
-    5.048703551e-01f,
-    1.759129405e+00f,
-    8.637071252e-01f,
-    1.124012828e+00f,
-    7.006662488e-01f,
-    8.165478110e-01f,
-    1.021295190e+00f,
-    5.539438725e-01f,
-    1.702279687e+00f,
-    7.162965536e-01f,
-    4.545609951e-01f,
-    6.240198612e-01f,
-    7.240019441e-01f,
-    1.032288790e+00f,
-    6.717512012e-01f,
-    9.901292324e-01f,
-    3.079058528e-01f,
-    6.516751051e-01f,
-    4.476672709e-01f,
-    6.316445470e-01f,
-    6.750379801e-01f,
-    6.976740956e-01f,
-    8.046788573e-01f,
-    1.392099500e+00f,
-    9.499171972e-01f,
-    5.435646772e-01f,
-    1.118307829e+00f,
-    6.536739469e-01f,
-    6.327620149e-01f,
-    1.013406873e+00f,
-    1.215886831e+00f,
-    5.007407069e-01f,
-    1.839314103e+00f,
-    8.274245858e-01f,
-    1.520481467e+00f,
-    1.414157748e+00f,
-    7.460950613e-01f,
-    4.991552830e-01f,
-    7.350900769e-01f,
-    8.458572626e-01f,
-    1.089445233e+00f,
-    6.015192866e-01f,
-    5.464203954e-01f,
-    2.263102531e+00f,
-    8.489744663e-01f,
-    1.151727319e+00f,
-    2.684376538e-01f,
-    1.136360526e+00f,
-    1.730308533e+00f,
-    4.798495770e-01f,
-    6.444664598e-01f,
-    1.718492866e+00f,
-    8.473656774e-01f,
-    1.490528822e+00f,
-    7.617829442e-01f,
-    3.802604675e-01f,
-    7.881356478e-01f,
-    4.291628599e-01f,
-    9.207867384e-01f,
-    2.601717472e+00f,
-    1.642000198e+00f,
-    5.753974915e-01f,
-    1.916088104e+00f,
-    8.728587031e-01f,
-    1.027860284e+00f,
-    2.613828659e+00f,
-    1.412073016e+00f,
-    1.927793860e+00f,
-    1.251792908e+00f,
-    6.767061949e-01f,
-    7.436440587e-01f,
-    1.316757798e+00f,
-    6.101961136e-01f,
-    5.839331746e-01f,
-    1.091328144e+00f,
-    5.401840806e-01f,
-    9.770996571e-01f,
-    8.260735869e-01f,
-    1.208099365e+00f,
-    8.674915433e-01f,
-    7.684509754e-01f,
-    7.709825635e-01f,
-    8.130320311e-01f,
-    1.223194003e+00f,
-    6.236002445e-01f,
-    1.325887680e+00f,
-    1.379498005e+00f,
-    1.280715108e+00f,
-    1.380476713e+00f,
-    1.005161762e+00f,
-    1.416504025e+00f,
-    5.867406726e-01f,
-    2.834548950e-01f,
-    1.178857088e+00f,
-    7.309674025e-01f,
-    7.077571750e-01f,
-    1.761884212e+00f,
-    9.384959936e-01f,
-    1.020650148e+00f,
-    4.524667859e-01f,
-    7.857244611e-01f,
-    6.889029741e-01f,
-    8.134374022e-01f,
-    3.879238367e-01f,
-    5.184684992e-01f,
-    1.109932899e+00f,
-    4.873332083e-01f,
-    2.680713654e+00f,
-    7.028172016e-01f,
-    1.092503071e+00f,
-    8.353612423e-01f,
-    1.053521633e+00f,
-    8.933441043e-01f,
-    6.497473717e-01f,
-    9.231566787e-01f,
-    7.690886259e-01f,
-    9.026192427e-01f,
-    1.341065884e+00f,
-    7.840319872e-01f,
-    1.086614370e+00f,
-    9.317788482e-01f,
-    1.243710041e+00f,
-    1.724072695e+00f,
-    1.366650105e+00f,
-    1.568763852e+00f,
-    1.313037753e+00f,
-    5.903276801e-01f,
-    9.331740141e-01f,
-    1.389909863e+00f,
-    2.081784010e+00f,
-    2.553789139e+00f,
-    1.147005796e+00f,
-    1.633973360e+00f,
-    9.200289845e-01f,
-    7.592639327e-01f,
-    8.131454587e-01f,
-    1.208477855e+00f,
-    8.123177290e-01f,
-    1.070356727e+00f,
-    2.855939388e+00f,
-    1.426858187e+00f,
-    1.752464056e+00f,
-    6.660194993e-01f,
-    4.453583956e-01f,
-    6.847429872e-01f,
-    9.264915586e-01f,
-    1.371385455e+00f,
-    5.393525958e-01f,
-    6.714171171e-01f,
-    2.157054663e+00f,
-    5.406805873e-01f,
-    1.180806518e+00f,
-    1.043151379e+00f,
-    1.320475578e+00f,
-    1.624996305e+00f,
-    8.879948854e-01f,
-    7.022513747e-01f,
-    4.697087705e-01f,
-    4.714569747e-01f,
-    1.340206027e+00f,
-    1.041027784e+00f,
-    1.384894848e+00f,
-    6.070685983e-01f,
-    9.595211148e-01f,
-    6.595919132e-01f,
-    7.662062049e-01f,
-    3.776675761e-01f,
-    6.261043549e-01f,
-    6.012626886e-01f,
-    1.270468473e+00f,
-    9.061023593e-01f,
-    9.961661696e-01f,
-    7.283495665e-01f,
-    4.988459945e-01f,
-    9.212886095e-01f,
-    1.081880927e+00f,
-    1.507914066e+00f,
-    1.505827308e+00f,
-    9.949001670e-01f,
-    3.358341455e+00f,
-    2.879292727e+00f,
-    1.332208753e+00f,
-    1.282389045e+00f,
-    1.371127248e+00f,
-    1.083677769e+00f,
-    9.223153591e-01f,
-    1.155384421e+00f,
-    9.672486186e-01f,
-    1.796184778e+00f,
-    1.085704327e+00f,
-    1.611368418e+00f,
-    9.499382973e-01f,
-    1.094379663e+00f,
-    1.064330697e+00f,
-    6.284118295e-01f,
-    1.419035077e+00f,
-    1.717349172e+00f,
-    1.499492645e+00f,
-    1.805977106e+00f,
-    1.498424411e+00f,
-    8.159590364e-01f,
-    6.286599040e-01f,
-    9.267026782e-01f,
-    7.109253407e-01f,
-    8.921986818e-01f,
-    1.135710120e+00f,
-    6.261355877e-01f,
-    1.113751292e+00f,
-    1.027413607e+00f,
-    1.136930466e+00f,
-    1.487040043e+00f,
-    5.971440077e-01f,
-    5.890006423e-01f,
-    1.303492904e+00f,
-    1.314427257e+00f,
-    8.070563078e-01f,
-    5.965898037e-01f,
-    7.991675735e-01f,
-    1.361601591e+00f,
-    7.999769449e-01f,
-    1.183082104e+00f,
-    9.108608365e-01f,
-    3.449292481e-01f,
-    1.184012890e+00f,
-    1.579627395e+00f,
-    1.098898292e+00f,
-    8.841022253e-01f,
-    8.663653135e-01f,
-    5.059494972e-01f,
-    5.248069167e-01f,
-    1.004571438e+00f,
-    8.786974549e-01f,
-    1.351501703e+00f,
-    1.206828356e+00f,
-    4.588153660e-01f,
-    6.306297779e-01f,
-    6.204262376e-01f,
-    6.713562012e-01f,
-    6.765762568e-01f,
-    1.299748421e+00f,
-    7.281454802e-01f,
-    2.082686424e+00f,
-    1.179601669e+00f,
-    1.320683360e+00f,
-    6.230139136e-01f,
-    1.326401234e+00f,
-    1.261217833e+00f,
-    9.411163926e-01f,
-    1.082256913e+00f,
-    9.015932679e-01f,
-    9.607716203e-01f,
-    7.536451817e-01f,
-    5.199037790e-01f,
-    1.090381980e+00f,
-    6.785792112e-01f,
-    1.133143187e+00f,
-    6.270757914e-01f,
-    1.355147243e+00f,
-    6.706461310e-01f,
-    8.968431950e-01f,
-    3.798345923e-01f,
-    7.453609705e-01f,
-    8.693141937e-01f,
-    1.000572205e+00f,
-    3.886600733e-01f,
-    8.128710389e-01f,
-    1.773300290e+00f,
-    8.469189405e-01f,
-    1.134127378e+00f,
-    4.985040724e-01f,
-    8.217768073e-01f,
-    1.202592850e+00f,
-    6.106476784e-01f,
-    1.049274802e+00f,
-    2.311403513e+00f,
-    1.640752912e+00f,
-    2.482168674e+00f,
-    1.137605548e+00f,
-    1.678743958e+00f,
-    1.566771269e+00f,
-    1.003404617e+00f,
-    3.234225512e+00f,
-    1.523826361e+00f,
-    2.251678944e+00f,
-    7.675953507e-01f,
-    9.134416580e-01f,
-    5.949751139e-01f,
-    1.017134905e+00f,
-    1.194224596e+00f,
-    6.625843048e-01f,
-    9.657900333e-01f,
-    6.703826189e-01f,
-    1.939908981e+00f,
-    7.613497972e-01f,
-    9.561687112e-01f,
-    2.130410194e+00f,
-    1.110761881e+00f,
-    1.639239669e+00f,
-    1.392652631e+00f,
-    1.197664499e+00f,
-    1.358832955e+00f,
-    1.426481247e+00f,
-    1.643786550e+00f,
-    2.791980505e+00f,
-    1.341816783e+00f,
-    1.785083413e+00f,
-    1.111825824e+00f,
-    1.247769952e+00f,
-    7.885389924e-01f,
-    7.089604735e-01f,
-    1.031218648e+00f,
-    1.209729314e+00f,
-    8.883157969e-01f,
-    7.539347410e-01f,
-    6.402441263e-01f,
-    1.534647346e+00f,
-    9.828849435e-01f,
-    4.543306828e-01f,
-    8.762212396e-01f,
-    1.310653687e+00f,
-    1.577324748e+00f,
-    1.873482108e+00f,
-    1.227526069e+00f,
-    3.313372731e-01f,
-    1.426269054e+00f,
-    7.840995789e-01f,
-    7.598057389e-01f,
-    9.112853408e-01f,
-    1.343569279e+00f,
-    1.329266787e+00f,
-    1.390498996e+00f,
-    1.271280169e+00f,
-    5.342590213e-01f,
-    8.338431120e-01f,
-    5.641083717e-01f,
-    1.336120725e+00f,
-    1.805475473e+00f,
-    2.328413486e+00f,
-    9.800485969e-01f,
-    1.337215781e+00f,
-    6.314644217e-01f,
-    4.247498512e-01f,
-    7.202563286e-01f,
-    3.222717345e-01f,
-    9.302254319e-01f,
-    1.026451826e+00f,
-    6.176935434e-01f,
-    1.265149593e+00f,
-    1.386984110e+00f,
-    1.548627138e+00f,
-    9.767160416e-01f,
-    4.023066759e-01f,
-    1.078330636e+00f,
-    1.960827947e+00f,
-    1.227623940e+00f,
-    9.478086829e-01f,
-    7.459763288e-01f,
-    8.860189915e-01f,
-    1.468704700e+00f,
-    1.381374478e+00f,
-    1.087797999e+00f,
-    1.458814979e+00f,
-    8.895685077e-01f,
-    7.495136857e-01f,
-    1.229067802e+00f,
-    9.564551711e-01f,
-    8.883166909e-01f,
-    1.042050004e+00f,
-    9.272800684e-01f,
-    6.094848514e-01f,
-    1.224604130e+00f,
-    9.424083829e-01f,
-    4.921693206e-01f,
-    8.987244368e-01f,
-    8.361411095e-01f,
-    5.070073605e-01f,
-    1.266934276e+00f,
-    7.934207320e-01f,
-    6.759456992e-01f,
-    1.213450909e+00f,
-    6.112856269e-01f,
-    8.818671703e-01f,
-    1.438608170e+00f,
-    9.447634220e-01f,
-    1.422641397e+00f,
-    2.533056736e+00f,
-    1.237729073e+00f,
-    1.194553733e+00f,
-    1.022861481e+00f,
-    1.107997298e+00f,
-    1.313483119e+00f,
-    1.025925636e+00f,
-    8.830751181e-01f,
-    1.373492599e+00f,
-    8.667812347e-01f,
-    1.011292577e+00f,
-    8.369528055e-01f,
-    6.671235561e-01f,
-    1.247396946e+00f,
-    1.146697640e+00f,
-    1.155940652e+00f,
-    6.092725992e-01f,
-    8.824545145e-01f,
-    1.362905025e+00f,
-    1.656880260e+00f,
-    8.010439873e-01f,
-    1.356494665e+00f,
-    1.561633825e+00f,
-    1.228556514e+00f,
-    1.523829103e+00f,
-    1.783136725e+00f,
-    7.840419412e-01f,
-    1.476911187e+00f,
-    1.070817232e+00f,
-    7.083318233e-01f,
-    9.777898788e-01f,
-    1.195604086e+00f,
-    9.003223777e-01f,
-    1.437810302e+00f,
-    1.371961832e+00f,
-    2.054280043e+00f,
-    5.742387176e-01f,
-    1.652821422e+00f,
-    8.677011728e-01f,
-    1.318325281e+00f,
-    1.614021301e+00f,
-    2.452555418e+00f,
-    1.131702542e+00f,
-    1.499009490e+00f,
-    8.841890097e-01f,
-    8.073198795e-01f,
-    9.457533956e-01f,
-    1.187623620e+00f,
-    1.134819388e+00f,
-    1.404923081e+00f,
-    1.557023406e+00f,
-    2.220746517e+00f,
-    6.002218127e-01f,
-    9.078015685e-01f,
-    1.033198595e+00f,
-    9.131703973e-01f,
-    6.370265484e-01f,
-    1.352696657e+00f,
-    1.161358237e+00f,
-    1.440959692e+00f,
-    1.261220455e+00f,
-    1.030268073e+00f,
-    1.277060032e+00f,
-    8.624691963e-01f,
-    1.130501390e+00f,
-    1.069257259e+00f,
-    3.794061244e-01f,
-    1.337205172e+00f,
-    8.746227026e-01f,
-    1.179939747e+00f,
-    1.843103051e+00f,
-    7.017259598e-01f,
-    9.050777555e-01f,
-    4.820336401e-01f,
-    4.053386748e-01f,
-    7.970744967e-01f,
-    7.049289942e-01f,
-    4.441066086e-01f,
-    5.287101865e-01f,
-    5.744104385e-01f,
-    4.112709463e-01f,
-    6.955939531e-01f,
-    7.402048707e-01f,
-    8.901213408e-01f,
-    7.566184998e-01f,
-    6.610351205e-01f,
-    8.061060309e-01f,
-    4.518731833e-01f,
-    9.144753218e-01f,
-    1.051640749e+00f,
-    4.312914312e-01f,
-    8.748911619e-01f,
-    1.214042187e+00f,
-    8.051386476e-01f,
-    9.266945124e-01f,
-    7.101601958e-01f,
-    8.993355632e-01f,
-    1.063362598e+00f,
-    6.493202448e-01f,
-    6.837968826e-01f,
-    1.418472648e+00f,
-    7.201981544e-01f,
-    7.108852863e-01f,
-    9.108099341e-01f,
-    8.971607089e-01f,
-    1.690333009e+00f,
-    6.525039673e-01f,
-    9.590635896e-01f,
-    4.541567862e-01f,
-    7.461511493e-01f,
-    8.337553740e-01f,
-    1.553326011e+00f,
-    1.150436282e+00f,
-    1.122406721e+00f,
-    4.553311467e-01f,
-    8.838254213e-01f,
-    1.172137618e+00f,
-    8.590692282e-01f,
-    9.534807801e-01f,
-    3.529896736e-01f,
-    7.716400623e-01f,
-    1.387958050e+00f,
-    1.581050396e+00f,
-    9.612658620e-01f,
-    1.331874967e+00f,
-    8.399626613e-01f,
-    7.125434279e-01f,
-    1.209809422e+00f,
-    1.323520660e+00f,
-    1.223173499e+00f,
-    7.751491666e-01f,
-    1.023596168e+00f,
-    3.676511645e-01f,
-    6.434208155e-01f,
-    1.209689617e+00f,
-    8.799334764e-01f,
-    5.388211012e-01f,
-    1.232491136e+00f,
-    8.365063667e-01f,
-    6.670972109e-01f,
-    1.155972958e+00f,
-    7.678795457e-01f,
-    1.866955876e+00f,
-    8.515548110e-01f,
-    1.788660407e+00f,
-    1.006543756e+00f,
-    1.225778103e+00f,
-    8.007849455e-01f,
-    1.175958157e+00f,
-    2.721358538e+00f,
-    1.451008558e+00f,
-    1.549802065e+00f,
-    1.430575371e+00f,
-    1.629256248e+00f,
-    1.324455976e+00f,
-    1.966431975e+00f,
-    1.666012406e+00f,
-    7.899323702e-01f,
-    8.539993167e-01f,
-    1.101887941e+00f,
-    1.108266473e+00f,
-    1.341730595e+00f,
-    1.950744390e+00f,
-    9.956699014e-01f,
-    1.212267399e+00f,
-    1.023745060e+00f,
-    8.871145248e-01f,
-    1.427353024e+00f,
-    1.074609995e+00f,
-    2.004532576e+00f,
-    8.483932614e-01f,
-    7.938908339e-01f,
-    6.009644866e-01f,
-    2.398226976e+00f,
-    1.435923815e+00f,
-    9.102925658e-01f,
-    1.344419837e+00f,
-    1.225159168e+00f,
-    2.194563866e+00f,
-    6.932035685e-01f,
-    1.310998917e+00f,
-    5.176122785e-01f,
-    1.625258327e+00f,
-    1.296260595e+00f,
-    8.287909627e-01f,
-    1.620053530e+00f,
-    1.257276058e+00f,
-    1.255776882e+00f,
-    6.939028502e-01f,
-    1.215188861e+00f,
-    1.148214579e+00f,
-    1.027841687e+00f,
-    1.333643913e+00f,
-    1.133854985e+00f,
-    9.930393696e-01f,
-    5.349940062e-01f,
-    6.058069468e-01f,
-    6.037555933e-01f,
-    1.230568528e+00f,
-    1.431718826e+00f,
-    1.161621213e+00f,
-    1.023581147e+00f,
-    2.602056980e+00f,
-    5.616595268e+00f,
-    1.800816178e+00f,
-    7.842743993e-01f,
-    2.446043015e+00f,
-    1.357913852e+00f,
-    9.415096045e-01f,
-    1.328290701e+00f,
-    9.060013294e-01f,
-    1.556135297e+00f,
-    8.329816461e-01f,
-    1.588209629e+00f,
-    1.638477564e+00f,
-    2.132012606e+00f,
-    9.115685821e-01f,
-    1.853178263e+00f,
-    8.267939687e-01f,
-    1.463809848e+00f,
-    2.523027182e+00f,
-    2.829798460e+00f,
-    9.952822924e-01f,
-    1.637923598e+00f,
-    1.963501334e+00f,
-    9.712225199e-01f,
-    6.683937311e-01f,
-    6.334966421e-01f,
-    8.768536448e-01f,
-    8.733250499e-01f,
-    7.893097401e-01f,
-    1.242223740e+00f,
-    1.569707990e+00f,
-    1.996406198e+00f,
-    1.391370654e+00f,
-    1.127476335e+00f,
-    2.773447514e+00f,
-    1.077775955e+00f,
-    1.240932226e+00f,
-    9.972804785e-01f,
-    1.920059919e+00f,
-    5.905193090e-01f,
-    2.092605352e+00f,
-    1.203027010e+00f,
-    4.029155374e-01f,
-    1.066043496e+00f,
-    1.067666531e+00f,
-    1.006560326e+00f,
-    1.359885931e+00f,
-    1.303031802e+00f,
-    1.260179400e+00f,
-    1.045904875e+00f,
-    8.086376786e-01f,
-    7.182115316e-01f,
-    9.492612481e-01f,
-    7.172319293e-01f,
-    7.223085761e-01f,
-    5.669208765e-01f,
-    6.310561895e-01f,
-    6.816324592e-01f,
-    4.397675395e-01f,
-    6.314217448e-01f,
-    4.109386504e-01f,
-    3.484822214e-01f,
-    5.129295588e-01f,
-    1.362451911e+00f,
-    3.585486412e-01f,
-    3.265456855e-01f,
-    3.905436993e-01f,
-    9.927762151e-01f,
-    6.873488426e-01f,
-    5.714928508e-01f,
-    5.734027028e-01f,
-    7.140863538e-01f,
-    8.305716515e-01f,
-    2.290241718e-01f,
-    3.173016608e-01f,
-    1.504061371e-01f,
-    1.409476757e+00f,
-    1.553088665e+00f,
-    1.019298553e+00f,
-    1.252891183e+00f,
-    6.001554132e-01f,
-    4.144935012e-01f,
-    4.580805898e-01f,
-    1.102387786e+00f,
-    1.797253340e-01f,
-    7.957138419e-01f,
-    2.614252806e+00f,
-    1.608617425e+00f,
-    2.187947989e+00f,
-    1.367684603e+00f,
-    8.732626438e-01f,
-    7.524989843e-01f,
-    8.780019283e-01f,
-    5.193841457e-01f,
-    9.135422707e-01f,
-    1.985394239e+00f,
-    6.610702872e-01f,
-    9.870946407e-01f,
-    1.366796136e+00f,
-    7.562131882e-01f,
-    1.226949453e+00f,
-    1.619396329e+00f,
-    3.663277626e-01f,
-    2.121738434e+00f,
-    1.158944488e+00f,
-    1.168700218e+00f,
-    8.471367955e-01f,
-    1.661929488e+00f,
-    1.238024354e+00f,
-    8.092462420e-01f,
-    9.255446792e-01f,
-    1.458662510e+00f,
-    1.661201000e+00f,
-    2.082980394e+00f,
-    1.296570897e+00f,
-    1.038219213e+00f,
-    9.102193713e-01f,
-    1.115223765e+00f,
-    1.709100485e+00f,
-    1.019859314e+00f,
-    6.996743083e-01f,
-    8.786248565e-01f,
-    1.453409314e+00f,
-    5.356060266e-01f,
-    8.482397199e-01f,
-    9.551967382e-01f,
-    1.485976696e+00f,
-    1.297077298e+00f,
-    9.913986921e-01f,
-    1.141863704e+00f,
-    1.394546270e+00f,
-    9.342236519e-01f,
-    9.383005500e-01f,
-    1.107876778e+00f,
-    1.068835139e+00f,
-    1.153892398e+00f,
-    1.076018929e+00f,
-    9.837561250e-01f,
-    1.265758157e+00f,
-    7.982288599e-01f,
-    9.273574352e-01f,
-    9.543401599e-01f,
-    2.355067015e+00f,
-    9.366874695e-01f,
-    1.074638724e+00f,
-    3.104862273e-01f,
-    1.195804715e+00f,
-    7.582916021e-01f,
-    7.477769852e-01f,
-    4.334091842e-01f,
-    7.377778888e-01f,
-    8.467322588e-01f,
-    8.466734886e-01f,
-    9.332236052e-01f,
-    6.212794781e-01f,
-    1.323216796e+00f,
-    8.052567244e-01f,
-    1.687687397e+00f,
-    5.585950613e-01f,
-    1.593153715e+00f,
-    7.302291393e-01f,
-    8.439949751e-01f,
-    1.427360296e+00f,
-    3.647479057e+00f,
-    1.060284972e+00f,
-    5.296504498e-01f,
-    8.092187047e-01f,
-    1.951432109e+00f,
-    1.551446557e+00f,
-    3.761575222e+00f,
-    1.447300911e+00f,
-    1.455031753e+00f,
-    1.058293223e+00f,
-    1.196154594e+00f,
-    6.080247164e-01f,
-    5.928633809e-01f,
-    1.453000188e+00f,
-    6.447985172e-01f,
-    7.932770848e-01f,
-    1.591489553e+00f,
-    1.226093650e+00f,
-    1.275252104e+00f,
-    4.718626738e-01f,
-    1.371532321e+00f,
-    1.731405616e+00f,
-    2.167043686e+00f,
-    1.126992583e+00f,
-    4.246484756e+00f,
-    7.457349300e-01f,
-    5.909594297e-01f,
-    1.069709063e+00f,
-    1.481255054e+00f,
-    1.208676457e+00f,
-    1.211797237e+00f,
-    1.879250407e+00f,
-    9.947966933e-01f,
-    7.504588366e-01f,
-    1.084183216e+00f,
-    9.692811966e-01f,
-    1.079319358e+00f,
-    4.957100749e-01f,
-    1.208577394e+00f,
-    1.832472324e+00f,
-    5.370497704e-01f,
-    8.979452848e-01f,
-    1.175725222e+00f,
-    1.592159629e+00f,
-    1.317711830e+00f,
-    6.680034995e-01f,
-    5.380198359e-01f,
-    1.932159185e+00f,
-    7.209396362e-01f,
-    7.647243142e-01f,
-    6.711211801e-01f,
-    1.402644873e+00f,
-    1.602609277e+00f,
-    8.113219142e-01f,
-    6.963858008e-01f,
-    8.492611051e-01f,
-    4.759139419e-01f,
-    1.944025874e+00f,
-    8.492391109e-01f,
-    1.270133853e+00f,
-    8.144217730e-01f,
-    8.472251296e-01f,
-    9.753262401e-01f,
-    1.634056926e+00f,
-    9.449585080e-01f,
-    9.811323881e-01f,
-    9.827318788e-01f,
-    9.380135536e-01f,
-    5.539655089e-01f,
-    1.808568358e+00f,
-    8.590260148e-01f,
-    1.004706502e+00f,
-    1.555396557e+00f,
-    9.650700688e-01f,
-    7.694821954e-01f,
-    6.164858341e-01f,
-    2.184536219e+00f,
-    9.045684338e-01f,
-    1.051733136e+00f,
-    1.004444838e+00f,
-    6.383622289e-01f,
-    1.183250904e+00f,
-    1.155129433e+00f,
-    8.857675791e-01f,
-    1.681975842e+00f,
-    1.487356782e+00f,
-    1.439993739e+00f,
-    9.700156450e-01f,
-    9.116131067e-01f,
-    7.793928385e-01f,
-    1.303935647e+00f,
-    5.464010835e-01f,
-    9.518490434e-01f,
-    1.227373719e+00f,
-    8.230540752e-01f,
-    1.023430109e+00f,
-    1.359670281e+00f,
-    1.335319400e+00f,
-    9.851639867e-01f,
-    1.336285353e+00f,
-    8.089304566e-01f,
-    1.580953717e+00f,
-    3.162128627e-01f,
-    1.566635489e+00f,
-    2.930038214e+00f,
-    1.279388547e+00f,
-    1.572756410e+00f,
-    8.608439565e-01f,
-    1.037400961e+00f,
-    1.576336622e+00f,
-    9.290851355e-01f,
-    8.816723228e-01f,
-    6.660155654e-01f,
-    1.118276000e+00f,
-    4.931289852e-01f,
-    6.669601798e-01f,
-    8.205199838e-01f,
-    1.477685094e+00f,
-    7.454716563e-01f,
-    5.800279975e-01f,
-    9.240825772e-01f,
-    7.891387939e-01f,
-    5.372974873e-01f,
-    7.824527025e-01f,
-    1.153119802e+00f,
-    1.827219844e+00f,
-    6.614893675e-01f,
-    6.902494431e-01f,
-    1.491268039e+00f,
-    2.108482361e+00f,
-    1.133595467e+00f,
-    1.249082923e+00f,
-    1.236636043e+00f,
-    1.439184904e+00f,
-    9.105307460e-01f,
-    4.196244180e-01f,
-    1.094332576e+00f,
-    2.418541193e+00f,
-    1.825810671e+00f,
-    1.093551874e+00f,
-    1.252455473e+00f,
-    6.287938952e-01f,
-    1.151682496e+00f,
-    1.079973698e+00f,
-    1.160445452e+00f,
-    9.312680364e-01f,
-    6.532952189e-01f,
-    9.196334481e-01f,
-    6.622887850e-01f,
-    1.004202604e+00f,
-    7.896814942e-01f,
-    4.822097719e-01f,
-    9.419034719e-01f,
-    4.940561354e-01f,
-    5.909771919e-01f,
-    7.121810913e-01f,
-    1.192148209e+00f,
-    1.043274522e+00f,
-    1.182955861e+00f,
-    7.065454721e-01f,
-    6.601013541e-01f,
-    1.094809294e+00f,
-    8.102117181e-01f,
-    1.077053666e+00f,
-    6.346756816e-01f,
-    7.741317153e-01f,
-    1.013248563e+00f,
-    8.428097367e-01f,
-    1.096582532e+00f,
-    9.386684895e-01f,
-    6.645244360e-01f,
-    8.040048480e-01f,
-    7.654134631e-01f,
-    7.830465436e-01f,
-    1.309111834e+00f,
-    6.955856085e-01f,
-    1.044004798e+00f,
-    1.350906849e+00f,
-    8.076099157e-01f,
-    1.388237357e+00f,
-    1.852701306e+00f,
-    1.619992018e+00f,
-    7.574176788e-01f,
-    7.427402735e-01f,
-    2.021823168e+00f,
-    2.164858580e+00f,
-    1.141531467e+00f,
-    1.705411434e+00f,
-    4.405932128e-01f,
-    1.382807016e+00f,
-    9.758234024e-01f,
-    7.136762738e-01f,
-    6.706784964e-01f,
-    1.017998457e+00f,
-    8.499395251e-01f,
-    8.456535339e-01f,
-    9.969949722e-01f,
-    7.899243832e-01f,
-    1.708029270e+00f,
-    1.038963199e+00f,
-    9.241605401e-01f,
-    7.734372616e-01f,
-    1.024446249e+00f,
-    4.494795203e-01f,
-    1.130059242e+00f,
-    1.445087194e+00f,
-    1.080833077e+00f,
-    9.743762016e-01f,
-    1.697322965e+00f,
-    8.642497063e-01f,
-    1.098147154e+00f,
-    1.371724248e+00f,
-    8.794911504e-01f,
-    1.024710298e+00f,
-    6.700392962e-01f,
-    1.777007580e+00f,
-    1.261905074e+00f,
-    5.730316043e-01f,
-    9.239261746e-01f,
-    8.210487366e-01f,
-    7.665749788e-01f,
-    8.467788696e-01f,
-    1.284475207e+00f,
-    7.392205596e-01f,
-    9.444689155e-01f,
-    8.785999417e-01f,
-    9.225718379e-01f,
-    6.088141799e-01f,
-    8.876917958e-01f,
-    1.274443269e+00f,
-    1.072508216e+00f,
-    1.183613539e+00f,
-    2.281383038e+00f,
-    6.672786474e-01f,
-    1.207833052e+00f,
-    6.825752854e-01f,
-    1.006588459e+00f,
-    5.901528001e-01f,
-    1.002609015e+00f,
-    1.335021257e+00f,
-    8.926987648e-01f,
-    1.190051198e+00f,
-    5.716060996e-01f,
-    8.692739606e-01f,
-    9.262574911e-01f,
-    1.439383388e+00f,
-    8.210290074e-01f,
-    6.279581189e-01f,
-    1.743716478e+00f,
-    1.856471777e+00f,
-    4.256457090e-01f,
-    6.101498604e-01f,
-    1.129299402e+00f,
-    8.431038857e-01f,
-    9.989957213e-01f,
-    1.350356579e+00f,
-    8.228843212e-01f,
-    1.009498000e+00f,
-    1.356857538e+00f,
-    1.265241146e+00f,
-    1.035784721e+00f,
-    1.547990322e+00f,
-    7.661626935e-01f,
-    1.416673779e+00f,
-    1.150633812e+00f,
-    7.513403893e-01f,
-    6.379535794e-01f,
-    3.907055855e-01f,
-    1.294670820e+00f,
-    1.348271370e+00f,
-    1.786758304e+00f,
-    8.147101402e-01f,
-    8.995100260e-01f,
-    1.367617130e+00f,
-    6.055744886e-01f,
-    6.330613494e-01f,
-    7.818252444e-01f,
-    8.967266679e-01f,
-    6.406652331e-01f,
-    7.475366592e-01f,
-    1.212623000e+00f,
-    6.775467992e-01f,
-    1.245560884e+00f,
-    8.588172197e-01f,
-    9.246402979e-01f,
-    9.541206956e-01f,
-    9.704880714e-01f,
-    9.635978937e-01f,
-    1.833468914e+00f,
-    1.074988365e+00f,
-    9.932357073e-01f,
-    6.348664165e-01f,
-    5.465461016e-01f,
-    1.035092831e+00f,
-    6.079253554e-01f,
-    6.637352705e-01f,
-    4.138427079e-01f,
-    7.127056122e-01f,
-    1.152011395e+00f,
-    7.357690930e-01f,
-    8.594255447e-01f,
-    9.310679436e-01f,
-    7.109789252e-01f,
-    1.250094533e+00f,
-    1.644537091e+00f,
-    1.133929610e+00f,
-    1.269375682e+00f,
-    1.107502103e+00f,
-    1.026958227e+00f,
-    6.664481163e-01f,
-    8.149891496e-01f,
-    1.720827103e+00f,
-    1.875172257e+00f,
-    1.095989704e+00f,
-    1.521909833e+00f,
-    6.705572009e-01f,
-    7.048635483e-01f,
-    1.284005880e+00f,
-    1.007594109e+00f,
-    1.132936597e+00f,
-    1.378472447e+00f,
-    1.037432671e+00f,
-    1.051671147e+00f,
-    1.070756912e+00f,
-    1.283812046e+00f,
-    1.600640535e+00f,
-    9.403533340e-01f,
-    5.759211779e-01f,
-    1.366125941e+00f,
-    7.890914083e-01f,
-    8.229632378e-01f,
-    9.603247643e-01f,
-    5.768865943e-01f,
-    1.405517936e+00f,
-    3.035902023e+00f,
-    1.839709044e+00f,
-    1.252342105e+00f,
-    1.015474558e+00f,
-    9.578998685e-01f,
-    8.057804704e-01f,
-    1.554722071e+00f,
-    1.059031606e+00f,
-    6.893443465e-01f,
-    8.365904093e-01f,
-    1.185087562e+00f,
-    1.308611393e+00f,
-    9.987011552e-01f,
-    1.044717312e+00f,
-    5.119348764e-01f,
-    1.190792799e+00f,
-    1.587573290e+00f,
-    7.334828377e-01f,
-    3.781871796e-01f,
-    5.499672294e-01f,
-    1.389361858e+00f,
-    1.320607305e+00f,
-    1.157768726e+00f,
-    1.094236135e+00f,
-    1.077167749e+00f,
-    1.063689709e+00f,
-    1.870744586e+00f,
-    5.006167293e-01f,
-    6.177038550e-01f,
-    7.801686525e-01f,
-    8.533971310e-01f,
-    1.154136062e+00f,
-    7.899693847e-01f,
-    1.057312131e+00f,
-    1.066114306e+00f,
-    7.317740917e-01f,
-    6.998821497e-01f,
-    6.097043157e-01f,
-    1.140740037e+00f,
-    1.284438133e+00f,
-    1.621192813e+00f,
-    1.296569467e+00f,
-    1.443388462e+00f,
-    1.786906123e+00f,
-    1.044323564e+00f,
-    1.202468157e+00f,
-    1.708878875e+00f,
-    1.224700928e+00f,
-    1.230002880e+00f,
-    5.227876902e-01f,
-    6.054235101e-01f,
-    1.221975088e+00f,
-    1.063917279e+00f,
-    8.613988757e-01f,
-    1.460763931e+00f,
-    7.573036551e-01f,
-    1.488397598e+00f,
-    1.528475046e+00f,
-    1.950887799e+00f,
-    7.612808943e-01f,
-    4.181030393e-01f,
-    4.580655396e-01f,
-    1.437770486e+00f,
-    6.172231436e-01f,
-    6.115603447e-01f,
-    6.287859082e-01f,
-    1.013096809e+00f,
-    1.038715839e+00f,
-    8.882828355e-01f,
-    9.245592356e-01f,
-    3.817520142e-01f,
-    1.518530607e+00f,
-    2.323053360e+00f,
-    3.044635653e-01f,
-    1.486872911e+00f,
-    2.000861168e+00f,
-    1.512451291e+00f,
-    9.584560394e-01f,
-    9.951046705e-01f,
-    1.596335530e+00f,
-    1.592606306e+00f,
-    1.433200717e+00f,
-    1.082118392e+00f,
-    5.571871400e-01f,
-    1.477714300e+00f,
-    1.448047042e+00f,
-    3.116247654e+00f,
-    6.339893937e-01f,
-    6.979614496e-01f,
-    1.086034417e+00f,
-    1.671082973e+00f,
-    1.091101170e+00f,
-    9.354142547e-01f,
-    4.819078147e-01f,
-    1.095447183e+00f,
-    1.234321237e+00f,
-    2.863155603e+00f,
-    1.560806513e+00f,
-    6.195918918e-01f,
-    1.373672962e+00f,
-    5.534647107e-01f,
-    7.804896832e-01f,
-    1.670793891e+00f,
-    1.173965096e+00f,
-    9.215652347e-01f,
-    1.113649964e+00f,
-    7.941106558e-01f,
-    1.664238334e+00f,
-    1.239694476e+00f,
-    8.279442787e-01f,
-    2.007919550e+00f,
-    1.812269211e+00f,
-    1.233433604e+00f,
-    1.616916299e+00f,
-    6.060721278e-01f,
-    5.326417089e-01f,
-    9.245728850e-01f,
-    6.202001572e-01f,
-    8.864448071e-01f,
-    1.930132747e+00f,
-    2.077562809e+00f,
-    8.717731833e-01f,
-    3.452860832e+00f,
-    1.492677212e+00f,
-    8.426278830e-01f,
-    1.403730989e+00f,
-    5.432078242e-01f,
-    9.905667305e-01f,
-    1.488660693e+00f,
-    8.148964047e-01f,
-    8.442276120e-01f,
-    7.817041874e-01f,
-    1.285479188e+00f,
-    1.314478040e+00f,
-    1.229646683e+00f,
-    8.533978462e-01f,
-    1.756774545e+00f,
-    1.076376915e+00f,
-    7.711553574e-01f,
-    1.283867598e+00f,
-    6.442490816e-01f,
-    1.071973443e+00f,
-    5.744937062e-01f,
-    9.386490583e-01f,
-    3.991410434e-01f,
-    1.220252037e+00f,
-    1.213420153e+00f,
-    1.097895265e+00f,
-    8.385650516e-01f,
-    8.610120416e-01f,
-    6.085169315e-01f,
-    6.868482232e-01f,
-    6.730721593e-01f,
-    1.222286105e+00f,
-    1.770412564e+00f,
-    9.435859323e-01f,
-    8.917271495e-01f,
-    1.762244582e+00f,
-    8.916910291e-01f,
-    9.593263865e-01f,
-    1.298272491e+00f,
-    5.041912198e-01f,
-    1.059639573e+00f,
-    1.281630635e+00f,
-    3.750961423e-01f,
-    1.355389118e+00f,
-    1.284313083e+00f,
-    1.022834182e+00f,
-    1.330902100e+00f,
-    6.071839333e-01f,
-    8.383564353e-01f,
-    1.108531952e+00f,
-    7.007156014e-01f,
-    9.754373431e-01f,
-    9.906173944e-01f,
-    4.430826306e-01f,
-    1.138399243e+00f,
-    1.088233948e+00f,
-    7.751678824e-01f,
-    1.989018559e+00f,
-    6.194952130e-01f,
-    6.734897494e-01f,
-    7.176095843e-01f,
-    7.990228534e-01f,
-    1.627521515e+00f,
-    1.204746246e+00f,
-    7.905055285e-01f,
-    8.314821124e-01f,
-    6.491671205e-01f,
-    5.994549394e-01f,
-    4.386084676e-01f,
-    1.080857873e+00f,
-    6.863959432e-01f,
-    5.931321979e-01f,
-    2.749884129e+00f,
-    1.302693605e+00f,
-    2.558852911e+00f,
-    1.457491398e+00f,
-    1.437898397e+00f,
-    1.109618545e+00f,
-    8.315630555e-01f,
-    6.793472767e-01f,
-    1.584107041e+00f,
-    9.615310431e-01f,
-    6.296561360e-01f,
-    1.001993775e+00f,
-    1.151232481e+00f,
-    1.232478499e+00f,
-    1.435313582e+00f,
-    1.288904786e+00f,
-    8.732358217e-01f,
-    1.749528170e+00f,
-    1.264527798e+00f,
-    1.583298445e+00f,
-    9.821230173e-01f,
-    1.092870712e+00f,
-    6.511012316e-01f,
-    7.669112682e-01f,
-    8.735373616e-01f,
-    5.915585756e-01f,
-    1.061351418e+00f,
-    1.311312795e+00f,
-    5.319715142e-01f,
-    8.061529398e-01f,
-    1.934632659e+00f,
-    6.769401431e-01f,
-    9.998498559e-01f,
-    1.040337682e+00f,
-    9.233351350e-01f,
-    1.148126841e+00f,
-    1.036193252e+00f,
-    9.334799051e-01f,
-    6.222960949e-01f,
-    1.327234030e+00f,
-    2.754190683e+00f,
-    1.110164285e+00f,
-    6.417844296e-01f,
-    1.137494564e+00f,
-    5.004462600e-01f,
-    9.123925567e-01f,
-    1.113353133e+00f,
-    1.067932606e+00f,
-    8.305760622e-01f,
-    7.049692869e-01f,
-    6.974288225e-01f,
-    8.783708215e-01f,
-    6.451092958e-01f,
-    1.128618956e+00f,
-    2.239188194e+00f,
-    7.169365883e-01f,
-    7.588943243e-01f,
-    7.865930796e-01f,
-    1.074918866e+00f,
-    3.775483072e-01f,
-    1.861376762e+00f,
-    1.239647388e+00f,
-    8.687931895e-01f,
-    1.322702527e+00f,
-    9.294070005e-01f,
-    1.049905062e+00f,
-    4.292882681e-01f,
-    3.023810863e+00f,
-    1.331149578e+00f,
-    2.005934954e+00f,
-    6.874374151e-01f,
-    3.998268843e-01f,
-    1.341737986e+00f,
-    4.566756785e-01f,
-    6.004148126e-01f,
-    5.988489389e-01f,
-    1.247685313e+00f,
-    1.421369672e+00f,
-    9.486554265e-01f,
-    6.089166999e-01f,
-    8.433145881e-01f,
-    2.013025999e+00f,
-    1.361867547e+00f,
-    6.144931912e-01f,
-    1.248198986e+00f,
-    1.033047438e+00f,
-    1.092634916e+00f,
-    7.637115717e-01f,
-    6.222981811e-01f,
-    1.672546387e+00f,
-    1.226130128e+00f,
-    8.815292716e-01f,
-    4.667199552e-01f,
-    1.221148014e+00f,
-    6.979374290e-01f,
-    8.684428930e-01f,
-    7.807393670e-01f,
-    1.327985048e+00f,
-    1.093930960e+00f,
-    7.204497457e-01f,
-    1.379773855e+00f,
-    9.213850498e-01f,
-    9.286202192e-01f,
-    6.050746441e-01f,
-    1.677893758e+00f,
-    8.703075051e-01f,
-    4.613597989e-01f,
-    6.922994256e-01f,
-    2.559191585e-01f,
-    3.611138165e-01f,
-    1.079945326e+00f,
-    7.028937936e-01f,
-    4.893779457e-01f,
-    9.508889914e-01f,
-    6.592827439e-01f,
-    3.964005113e-01f,
-    3.901990056e-01f,
-    6.377136707e-01f,
-    7.975763083e-01f,
-    4.427737594e-01f,
-    7.959371805e-01f,
-    9.102587104e-01f,
-    7.194582820e-01f,
-    7.582979798e-01f,
-    6.384944320e-01f,
-    7.153521776e-01f,
-    6.402925849e-01f,
-    2.213864803e+00f,
-    1.532116413e+00f,
-    1.336630464e+00f,
-    6.955601573e-01f,
-    4.646448195e-01f,
-    2.785326838e-01f,
-    1.022538543e+00f,
-    1.278951526e+00f,
-    2.268826485e+00f,
-    9.664600492e-01f,
-    1.081647754e+00f,
-    9.399045706e-01f,
-    5.830333233e-01f,
-    6.414237618e-01f,
-    8.127932549e-01f,
-    1.238479495e+00f,
-    8.188126087e-01f,
-    9.845665693e-01f,
-    1.174150348e+00f,
-    1.303414106e+00f,
-    6.491758227e-01f,
-    6.205867529e-01f,
-    1.689177871e+00f,
-    8.649472594e-01f,
-    6.346995831e-01f,
-    8.903188705e-01f,
-    2.778839171e-01f,
-    3.315036595e-01f,
-    1.366459489e+00f,
-    1.020745516e+00f,
-    9.118134975e-01f,
-    1.217160225e+00f,
-    1.001732707e+00f,
-    6.994161010e-01f,
-    8.976383805e-01f,
-    6.397411823e-01f,
-    2.701296210e-01f,
-    1.226701498e+00f,
-    1.153667808e+00f,
-    8.209607005e-01f,
-    1.166757464e+00f,
-    1.637527585e+00f,
-    1.433590770e+00f,
-    1.591789246e+00f,
-    1.111264467e+00f,
-    5.188354850e-01f,
-    7.650986314e-01f,
-    8.325935006e-01f,
-    1.008561492e+00f,
-    1.556795239e+00f,
-    6.295850277e-01f,
-    1.183704853e+00f,
-    6.313693523e-01f,
-    8.080512881e-01f,
-    1.270079732e+00f,
-    9.677049518e-01f,
-    8.905255198e-01f,
-    9.653479457e-01f,
-    9.282942414e-01f,
-    8.826084137e-01f,
-    8.262310624e-01f,
-    1.453002691e+00f,
-    1.555384398e+00f,
-    8.980749846e-01f,
-    6.253206730e-01f,
-    9.689391851e-01f,
-    1.955462813e+00f,
-    7.344603539e-01f,
-    1.319303632e+00f,
-    1.431188583e+00f,
-    1.507005692e+00f,
-    1.778706074e+00f,
-    6.488186121e-01f,
-    2.683159411e-01f,
-    8.493898511e-01f,
-    1.076790571e+00f,
-    8.308070898e-01f,
-    1.554216266e+00f,
-    8.597538471e-01f,
-    1.374791622e+00f,
-    2.932783127e+00f,
-    1.142940879e+00f,
-    5.239228010e-01f,
-    6.144198775e-01f,
-    1.546545982e+00f,
-    1.363790154e+00f,
-    1.942372799e+00f,
-    8.077383637e-01f,
-    1.248503685e+00f,
-    1.043787837e+00f,
-    1.008599162e+00f,
-    5.681389570e-01f,
-    1.313419819e+00f,
-    1.414887905e+00f,
-    9.856390953e-01f,
-    1.207505107e+00f,
-    1.219752073e+00f,
-    9.703663588e-01f,
-    6.379253268e-01f,
-    9.294503927e-01f,
-    9.337200522e-01f,
-    7.207556963e-01f,
-    2.568594456e+00f,
-    9.865667820e-01f,
-    1.991506934e+00f,
-    2.426211834e+00f,
-    1.154302716e+00f,
-    7.630912662e-01f,
-    6.180832982e-01f,
-    6.552455425e-01f,
-    1.647040963e+00f,
-    1.089568377e+00f,
-    3.010463953e+00f,
-    1.756256461e+00f,
-    1.347864628e+00f,
-    6.082440615e-01f,
-    6.118500233e-01f,
-    7.457345724e-01f,
-    9.565472603e-01f,
-    1.245032787e+00f,
-    1.997421265e+00f,
-    2.161036968e+00f,
-    6.244745851e-01f,
-    1.132320762e+00f,
-    1.364752293e+00f,
-    7.610460520e-01f,
-    9.818842411e-01f,
-    7.338221669e-01f,
-    4.766707122e-01f,
-    1.260394573e+00f,
-    1.823833108e+00f,
-    1.029678702e+00f,
-    1.271896243e+00f,
-    6.613779068e-01f,
-    6.935495138e-01f,
-    8.211763501e-01f,
-    5.757394433e-01f,
-    6.071854234e-01f,
-    1.342777610e+00f,
-    3.871843219e-01f,
-    1.756381154e+00f,
-    9.058992863e-01f,
-    1.135841012e+00f,
-    1.226763606e+00f,
-    8.102828264e-01f,
-    6.831134558e-01f,
-    1.059236526e+00f,
-    1.139530301e+00f,
-    1.200713515e+00f,
-    8.980374932e-01f,
-    2.957974434e+00f,
-    1.025442600e+00f,
-    8.275277615e-01f,
-    5.798004270e-01f,
-    3.807053268e-01f,
-    1.977585912e+00f,
-    2.217916012e+00f,
-    5.240796208e-01f,
-    7.819983959e-01f,
-    1.282955170e+00f,
-    2.820526600e+00f,
-    1.625715852e+00f,
-    1.655396700e+00f,
-    1.267507434e+00f,
-    1.327225685e+00f,
-    1.352433443e+00f,
-    2.463187456e+00f,
-    1.564322591e+00f,
-    1.680914044e+00f,
-    1.272946835e+00f,
-    1.171491504e+00f,
-    1.407401204e+00f,
-    1.638656020e+00f,
-    1.114328623e+00f,
-    9.403512478e-01f,
-    1.560496330e+00f,
-    2.700057745e+00f,
-    1.006489515e+00f,
-    1.832623005e+00f,
-    1.156541944e+00f,
-    1.605315804e+00f,
-    1.395739913e+00f,
-    5.225540996e-01f,
-    4.826118052e-01f,
-    6.746388674e-01f,
-    1.664184928e+00f,
-    6.156525612e-01f,
-    9.455991387e-01f,
-    1.236151934e+00f,
-    9.900807738e-01f,
-    7.163140178e-01f,
-    4.048247039e-01f,
-    5.332894921e-01f,
-    4.571170807e-01f,
-    6.858478189e-01f,
-    1.061915994e+00f,
-    3.515849113e-01f,
-    1.203549266e+00f,
-    1.036352158e+00f,
-    4.027985036e-01f,
-    1.001551270e+00f,
-    7.537541389e-01f,
-    4.897317290e-01f,
-    8.525123596e-01f,
-    6.869878173e-01f,
-    1.031015515e+00f,
-    1.059935808e+00f,
-    1.691700578e+00f,
-    8.493444920e-01f,
-    1.619804621e+00f,
-    1.665477633e+00f,
-    1.351719379e+00f,
-    2.208724737e+00f,
-    8.624819517e-01f,
-    1.789114594e+00f,
-    2.093058586e+00f,
-    1.622176528e+00f,
-    1.257126808e+00f,
-    1.267902732e+00f,
-    2.082159042e+00f,
-    2.348905802e+00f,
-    1.173986912e+00f,
-    2.168376923e+00f,
-    8.589673042e-01f,
-    1.688398719e+00f,
-    1.069953084e+00f,
-    1.357480526e+00f,
-    1.097866416e+00f,
-    7.437816262e-01f,
-    1.293496609e+00f,
-    2.196795464e+00f,
-    9.529749751e-01f,
-    1.432525516e+00f,
-    7.711330652e-01f,
-    1.478485227e+00f,
-    1.230632901e+00f,
-    2.041500807e+00f,
-    2.576822996e+00f,
-    1.097581267e+00f,
-    2.071882486e+00f,
-    2.025566101e+00f,
-    1.394169927e+00f,
-    1.042694211e+00f,
-    3.695293903e+00f,
-    2.960050344e+00f,
-    1.537139297e+00f,
-    1.622988820e+00f,
-    2.932323933e+00f,
-    8.426212668e-01f,
-    1.165929914e+00f,
-    5.146695137e+00f,
-    1.975834727e+00f,
-    1.207149982e+00f,
-    6.175434589e-01f,
-    1.474415183e+00f,
-    5.929515362e-01f,
-    9.078730941e-01f,
-    1.296537161e+00f,
-    4.040223658e-01f,
-    3.535439372e-01f,
-    9.867677689e-01f,
-    1.771407962e+00f,
-    1.009517431e+00f,
-    1.442962170e+00f,
-    9.681737423e-01f,
-    1.376823545e+00f,
-    3.323522210e-01f,
-    3.054394722e-01f,
-    3.073332012e-01f,
-    3.292710483e-01f,
-    2.551515102e+00f,
-    1.084809661e+00f,
-    2.320834160e+00f,
-    1.534793615e+00f,
-    2.229232073e+00f,
-    4.945008755e-01f,
-    3.775242567e-01f,
-    5.408101678e-01f,
-    7.564634085e-01f,
-    1.498723626e+00f,
-    1.361530900e+00f,
-    5.759645700e-01f,
-    1.046386480e+00f,
-    1.213077784e+00f,
-    1.265394688e+00f,
-    1.065963387e+00f,
-    1.111247897e+00f,
-    1.309515834e+00f,
-    1.427667618e+00f,
-    1.184238315e+00f,
-    2.873964548e+00f,
-    1.194090486e+00f,
-    1.364555717e+00f,
-    1.398604155e+00f,
-    1.035588622e+00f,
-    1.543933272e+00f,
-    2.338452816e+00f,
-    8.191458583e-01f,
-    1.583171844e+00f,
-    1.087757111e+00f,
-    2.622442245e+00f,
-    7.423620224e-01f,
-    8.042716384e-01f,
-    6.816852093e-01f,
-    1.007179379e+00f,
-    1.476135492e+00f,
-    9.662468433e-01f,
-    4.222791195e+00f,
-    6.063218713e-01f,
-    1.023717523e+00f,
-    7.512331009e-01f,
-    4.721063673e-01f,
-    1.317274690e+00f,
-    9.615273476e-01f,
-    1.096670747e+00f,
-    5.874055028e-01f,
-    8.587416410e-01f,
-    1.252402663e+00f,
-    7.692847848e-01f,
-    1.328437328e+00f,
-    8.655179739e-01f,
-    1.042389750e+00f,
-    7.437935472e-01f,
-    1.706466675e+00f,
-    1.596896410e+00f,
-    1.270614147e+00f,
-    1.052428842e+00f,
-    1.846505046e+00f,
-    9.777534008e-01f,
-    9.301750064e-01f,
-    1.109645963e+00f,
-    8.099926710e-01f,
-    1.299347639e+00f,
-    2.748864174e+00f,
-    9.985359311e-01f,
-    1.922239304e+00f,
-    8.724661469e-01f,
-    4.681084156e-01f,
-    9.653656483e-01f,
-    1.172803164e+00f,
-    1.190798283e+00f,
-    1.443502545e+00f,
-    9.767603874e-01f,
-    1.332563162e+00f,
-    1.006818175e+00f,
-    6.355482340e-01f,
-    2.300226212e+00f,
-    1.962659359e+00f,
-    8.494094610e-01f,
-    1.798701882e+00f,
-    1.301472187e+00f,
-    1.534421802e+00f,
-    1.295395494e+00f,
-    6.279149055e-01f,
-    8.869450092e-01f,
-    9.252847433e-01f,
-    5.445653200e-01f,
-    1.034669399e+00f,
-    1.279198527e+00f,
-    1.407257915e+00f,
-    3.820639253e-01f,
-    6.651990414e-01f,
-    6.932576299e-01f,
-    6.659075618e-01f,
-    4.887852371e-01f,
-    5.974906683e-01f,
-    1.030018330e+00f,
-    6.858395934e-01f,
-    8.599655032e-01f,
-    8.001557589e-01f,
-    9.498807788e-01f,
-    8.478442430e-01f,
-    6.315761805e-01f,
-    4.791558683e-01f,
-    8.643289208e-01f,
-    1.113922954e+00f,
-    1.232881069e+00f,
-    1.124016404e+00f,
-    6.294962764e-01f,
-    3.132011890e-01f,
-    1.804484129e+00f,
-    7.475482821e-01f,
-    1.592617869e+00f,
-    1.003853917e+00f,
-    2.172202110e+00f,
-    8.867848516e-01f,
-    3.467211127e-01f,
-    5.239886045e-01f,
-    8.165913820e-01f,
-    1.349721432e+00f,
-    1.702931285e+00f,
-    1.672202826e+00f,
-    9.182255268e-01f,
-    2.056878090e+00f,
-    9.622575045e-01f,
-    4.139949381e-01f,
-    5.251230001e-01f,
-    4.036733627e+00f,
-    1.050507069e+00f,
-    1.118063927e+00f,
-    7.130143046e-01f,
-    9.343760014e-01f,
-    8.827109933e-01f,
-    5.740848780e-01f,
-    7.605790496e-01f,
-    1.845765591e+00f,
-    1.004395008e+00f,
-    5.841482282e-01f,
-    5.411488414e-01f,
-    1.257339478e+00f,
-    6.247975230e-01f,
-    1.301126361e+00f,
-    1.289339423e+00f,
-    8.602463603e-01f,
-    1.243931770e+00f,
-    9.823505282e-01f,
-    8.323813677e-01f,
-    1.452562332e+00f,
-    1.370792150e+00f,
-    1.465636849e+00f,
-    1.246707916e+00f,
-    1.080850601e+00f,
-    1.564104438e+00f,
-    7.442231178e-01f,
-    8.040941954e-01f,
-    5.466365218e-01f,
-    1.957820892e+00f,
-    1.353016138e+00f,
-    1.255520821e+00f,
-    1.203007817e+00f,
-    3.450271130e+00f,
-    3.728874922e-01f,
-    6.899544001e-01f,
-    4.957092702e-01f,
-    6.756245494e-01f,
-    8.975524902e-01f,
-    7.127458453e-01f,
-    1.811451912e+00f,
-    2.374585629e+00f,
-    6.100649238e-01f,
-    8.865803480e-01f,
-    6.501107216e-01f,
-    1.503450632e+00f,
-    9.495509267e-01f,
-    1.375965238e+00f,
-    5.869480371e-01f,
-    1.295505166e+00f,
-    1.273259878e+00f,
-    1.649044275e+00f,
-    1.465459943e+00f,
-    2.533850670e+00f,
-    7.449917197e-01f,
-    1.385093808e+00f,
-    2.215320587e+00f,
-    3.620377064e+00f,
-    1.518479228e+00f,
-    8.440858126e-01f,
-    1.496448159e+00f,
-    2.351243734e+00f,
-    8.414458036e-01f,
-    2.387398005e+00f,
-    1.261610150e+00f,
-    1.397967339e+00f,
-    3.013187170e+00f,
-    9.469660521e-01f,
-    6.169790626e-01f,
-    1.850669026e+00f,
-    2.163454056e+00f,
-    9.325204492e-01f,
-    2.301104784e+00f,
-    2.223470926e+00f,
-    9.803941250e-01f,
-    1.412715435e+00f,
-    1.174037337e+00f,
-    1.534734726e+00f,
-    7.444642186e-01f,
-    1.290662408e+00f,
-    1.050058842e+00f,
-    5.956002474e-01f,
-    1.348979354e+00f,
-    1.074808240e+00f,
-    7.009260058e-01f,
-    1.179368138e+00f,
-    8.957085609e-01f,
-    1.040502429e+00f,
-    6.717432737e-01f,
-    6.465281844e-01f,
-    3.799197078e-01f,
-    1.428405643e+00f,
-    7.024571300e-01f,
-    6.980950236e-01f,
-    1.196847200e+00f,
-    1.784827709e+00f,
-    1.144132614e+00f,
-    1.528691649e+00f,
-    4.646570385e-01f,
-    1.070324779e+00f,
-    7.521142364e-01f,
-    7.323602438e-01f,
-    1.991892695e+00f,
-    4.625285864e-01f,
-    8.868630528e-01f,
-    7.881840467e-01f,
-    9.240500331e-01f,
-    6.207028627e-01f,
-    1.099767089e+00f,
-    1.343143940e+00f,
-    1.209077477e+00f,
-    4.171215892e-01f,
-    5.831247568e-01f,
-    4.969602823e-01f,
-    1.899062634e+00f,
-    9.012621641e-01f,
-    1.103140354e+00f,
-    6.447732449e-01f,
-    1.328291297e+00f,
-    7.389215231e-01f,
-    7.828199267e-01f,
-    3.851053715e-01f,
-    9.100407958e-01f,
-    1.027810931e+00f,
-    3.721297979e-01f,
-    8.448099494e-01f,
-    2.011482477e+00f,
-    1.086451054e+00f,
-    5.197812915e-01f,
-    9.495018721e-01f,
-    1.490745425e+00f,
-    3.425802290e-01f,
-    5.914679766e-01f,
-    8.329120278e-01f,
-    3.009638190e-01f,
-    1.264751077e+00f,
-    4.549944103e-01f,
-    3.034578860e-01f,
-    2.121653080e+00f,
-    1.103118300e+00f,
-    1.144356728e+00f,
-    2.828017473e-01f,
-    2.936672270e-01f,
-    3.369940817e-01f,
-    4.853304625e-01f,
-    1.523801446e+00f,
-    8.171906471e-01f,
-    5.760141015e-01f,
-    9.874513745e-01f,
-    8.016688228e-01f,
-    6.925383210e-01f,
-    5.176187158e-01f,
-    1.073056102e+00f,
-    1.420605302e+00f,
-    6.300015450e-01f,
-    4.293127358e-01f,
-    4.759734571e-01f,
-    1.052122831e+00f,
-    6.818222404e-01f,
-    1.015141845e+00f,
-    1.237638444e-01f,
-    4.446635842e-01f,
-    6.231859922e-01f,
-    4.684261978e-01f,
-    4.595573843e-01f,
-    1.340573668e+00f,
-    5.981795192e-01f,
-    1.177764893e+00f,
-    2.363938838e-01f,
-    1.066023588e+00f,
-    9.349370003e-01f,
-    1.305691600e+00f,
-    5.068465471e-01f,
-    1.170251250e+00f,
-    7.700951099e-01f,
-    1.219717503e+00f,
-    1.930280566e+00f,
-    1.205121636e+00f,
-    4.722416997e-01f,
-    8.567141891e-01f,
-    9.900049567e-01f,
-    9.032528996e-01f,
-    9.340838194e-01f,
-    1.587384105e+00f,
-    7.582654357e-01f,
-    5.303170085e-01f,
-    6.845810413e-01f,
-    1.138619661e+00f,
-    1.359405756e+00f,
-    6.296189427e-01f,
-    6.476964355e-01f,
-    7.581660748e-01f,
-    7.173907757e-01f,
-    7.811137438e-01f,
-    1.033170700e+00f,
-    1.063549280e+00f,
-    7.257239819e-01f,
-    1.610432625e+00f,
-    7.218134403e-01f,
-    5.538452864e-01f,
-    4.618948698e-01f,
-    5.327771902e-01f,
-    1.321195960e+00f,
-    1.279575467e+00f,
-    8.731644154e-01f,
-    8.653187156e-01f,
-    2.921326876e+00f,
-    1.408845305e+00f,
-    7.638754845e-01f,
-    6.025796533e-01f,
-    5.657089949e-01f,
-    1.683422565e+00f,
-    9.725564122e-01f,
-    1.251088500e+00f,
-    1.702159047e+00f,
-    7.264539599e-01f,
-    2.149212062e-01f,
-    9.639350772e-01f,
-    3.171856403e-01f,
-    5.273911357e-01f,
-    3.792750537e-01f,
-    2.627487183e-01f,
-    8.492289186e-01f,
-    1.701300979e+00f,
-    3.447329998e-01f,
-    2.341745645e-01f,
-    4.529497325e-01f,
-    6.945916414e-01f,
-    5.009766817e-01f,
-    4.305050373e-01f,
-    3.679270148e-01f,
-    7.842057347e-01f,
-    4.747973084e-01f,
-    1.160166502e+00f,
-    1.101852417e+00f,
-    9.861316085e-01f,
-    8.123862743e-01f,
-    7.707067132e-01f,
-    1.181635380e+00f,
-    6.949998140e-01f,
-    1.322849035e+00f,
-    7.702047229e-01f,
-    1.758248806e+00f,
-    7.842421532e-01f,
-    1.027583241e+00f,
-    6.860511899e-01f,
-    1.010763884e+00f,
-    2.499130964e+00f,
-    1.203044772e+00f,
-    6.363869905e-01f,
-    5.294280052e-01f,
-    6.955000758e-01f,
-    8.616125584e-01f,
-    8.974197507e-01f,
-    1.600544453e+00f,
-    1.582109451e+00f,
-    1.153105021e+00f,
-    7.412680984e-01f,
-    1.217952371e+00f,
-    1.374871016e+00f,
-    1.166790485e+00f,
-    1.023511171e+00f,
-    1.363175154e+00f,
-    4.825270176e-01f,
-    8.669926524e-01f,
-    7.711598277e-01f,
-    9.399963021e-01f,
-    1.946823716e+00f,
-    8.916058540e-01f,
-    6.096518040e-01f,
-    5.010189414e-01f,
-    5.204055309e-01f,
-    1.276965857e+00f,
-    1.279617071e+00f,
-    1.356321573e+00f,
-    7.972306013e-01f,
-    9.076613188e-01f,
-    9.770334363e-01f,
-    1.209141135e+00f,
-    9.754738808e-01f,
-    8.021197915e-01f,
-    2.307548285e+00f,
-    1.026024222e+00f,
-    6.524477005e-01f,
-    1.693772554e+00f,
-    1.654782295e+00f,
-    3.756898642e-01f,
-    6.336358786e-01f,
-    9.768521190e-01f,
-    4.774090350e-01f,
-    1.281319261e-01f,
-    7.522194982e-01f,
-    2.091218710e+00f,
-    7.069844604e-01f,
-    4.762984812e-01f,
-    4.509574473e-01f,
-    6.466658115e-01f,
-    4.766294360e-01f,
-    9.397331625e-02f,
-    8.967761993e-01f,
-    1.354402661e+00f,
-    1.084225416e+00f,
-    7.509874701e-01f,
-    7.649942636e-01f,
-    9.459785223e-01f,
-    1.077838898e+00f,
-    6.431228518e-01f,
-    1.046782017e+00f,
-    1.170933843e+00f,
-    8.795866370e-01f,
-    1.816246271e+00f,
-    1.475909352e+00f,
-    8.183093667e-01f,
-    8.345492482e-01f,
-    8.264300227e-01f,
-    1.146352053e+00f,
-    1.066296697e+00f,
-    6.743593693e+00f,
-    1.681361079e+00f,
-    9.148865342e-01f,
-    1.523932815e+00f,
-    1.126108766e+00f,
-    1.330931306e+00f,
-    1.203877926e+00f,
-    9.924401641e-01f,
-    1.641395807e+00f,
-    1.328289866e+00f,
-    3.777896881e+00f,
-    1.980613589e+00f,
-    9.143704176e-01f,
-    2.255275249e+00f,
-    1.715160608e+00f,
-    2.396327496e+00f,
-    2.702528477e+00f,
-    8.061638474e-01f,
-    4.245804548e-01f,
-    6.895971894e-01f,
-    6.943783760e-01f,
-    6.768002510e-01f,
-    1.147324324e+00f,
-    2.660764933e+00f,
-    7.704759836e-01f,
-    6.441657543e-01f,
-    5.680355430e-01f,
-    3.331235945e-01f,
-    8.910668492e-01f,
-    1.474120140e+00f,
-    1.380219221e+00f,
-    5.390442014e-01f,
-    1.480335474e+00f,
-    1.741179347e+00f,
-    3.559813499e-01f,
-    1.142081380e+00f,
-    1.459883094e+00f,
-    1.563384533e+00f,
-    2.743021488e+00f,
-    1.480885744e+00f,
-    5.379931331e-01f,
-    1.744870186e+00f,
-    1.916711450e+00f,
-    2.698826313e+00f,
-    1.100206971e+00f,
-    2.044386864e+00f,
-    1.022517085e+00f,
-    1.055989981e+00f,
-    1.105226755e+00f,
-    9.413399100e-01f,
-    3.394025087e+00f,
-    1.924066067e+00f,
-    1.485254169e+00f,
-    2.470151186e+00f,
-    3.131904364e+00f,
-    3.824685812e+00f,
-    9.466335177e-01f,
-    1.062912107e+00f,
-    1.064136267e+00f,
-    1.231271625e+00f,
-    1.397156715e+00f,
-    1.566028714e+00f,
-    9.466179013e-01f,
-    9.169896245e-01f,
-    7.750955820e-01f,
-    6.369585991e-01f,
-    9.943828583e-01f,
-    1.255259156e+00f,
-    1.587960482e+00f,
-    1.089232564e+00f,
-    1.343743801e+00f,
-    1.779186130e+00f,
-    2.091960907e+00f,
-    1.873384356e+00f,
-    1.794065356e+00f,
-    1.945754886e+00f,
-    1.019250274e+00f,
-    2.664643288e+00f,
-    6.609904766e-01f,
-    8.383135796e-01f,
-    2.073103428e+00f,
-    1.340464473e+00f,
-    1.119344473e+00f,
-    8.688371181e-01f,
-    1.401986480e+00f,
-    1.127559543e+00f,
-    1.673888922e+00f,
-    9.656586647e-01f,
-    7.540056705e-01f,
-    6.639119983e-01f,
-    7.158914208e-01f,
-    1.103799462e+00f,
-    4.437083602e-01f,
-    8.090453148e-01f,
-    6.542107463e-01f,
-    3.172337711e-01f,
-    1.078935385e+00f,
-    1.554418325e+00f,
-    1.636364341e+00f,
-    2.081454515e+00f,
-    1.223035455e+00f,
-    5.913637877e-01f,
-    9.210098982e-01f,
-    1.084911108e+00f,
-    1.017607331e+00f,
-    6.445317864e-01f,
-    6.512593627e-01f,
-    3.934598267e-01f,
-    8.930829167e-01f,
-    3.425871730e-01f,
-    1.386225820e+00f,
-    8.827971220e-01f,
-    1.713690400e+00f,
-    2.004684687e+00f,
-    1.238527060e+00f,
-    1.147977591e+00f,
-    1.096577406e+00f,
-    2.125894547e+00f,
-    1.765443444e+00f,
-    4.618932009e-01f,
-    1.620254517e+00f,
-    2.220775843e+00f,
-    1.566139936e+00f,
-    2.006060362e+00f,
-    9.079818726e-01f,
-    7.532787323e-01f,
-    1.050313354e+00f,
-    1.519768476e+00f,
-    1.573069811e+00f,
-    1.698334694e+00f,
-    1.062562227e+00f,
-    9.119759202e-01f,
-    1.108146906e+00f,
-    1.822219968e+00f,
-    8.554912806e-01f,
-    1.688811302e+00f,
-    8.171744943e-01f,
-    7.251146436e-01f,
-    1.338001132e+00f,
-    9.821404219e-01f,
-    6.865552068e-01f,
-    1.254495382e+00f,
-    1.300090313e+00f,
-    1.304229021e+00f,
-    3.148840427e+00f,
-    9.292409420e-01f,
-    1.475296736e+00f,
-    7.391508818e-01f,
-    9.151796103e-01f,
-    5.590773821e-01f,
-    4.266280830e-01f,
-    6.628556848e-01f,
-    1.049722314e+00f,
-    1.127404928e+00f,
-    4.560923278e-01f,
-    4.380505681e-01f,
-    7.107535601e-01f,
-    8.511947393e-01f,
-    1.269317627e+00f,
-    9.321040511e-01f,
-    5.872083902e-01f,
-    7.488164902e-01f,
-    5.602674484e-01f,
-    1.262080073e+00f,
-    4.719993591e+00f,
-    6.368245482e-01f,
-    4.591999948e-01f,
-    5.994434357e-01f,
-    2.232353449e+00f,
-    5.656445622e-01f,
-    1.117427468e+00f,
-    1.002429843e+00f,
-    1.062009335e+00f,
-    1.186488986e+00f,
-    1.514483094e+00f,
-    1.526047468e+00f,
-    1.383325815e+00f,
-    7.679571509e-01f,
-    9.190922976e-01f,
-    2.425940752e+00f,
-    1.445212841e+00f,
-    4.706588984e-01f,
-    3.608370721e-01f,
-    9.112668633e-01f,
-    3.718872070e+00f,
-    8.825794458e-01f,
-    7.130247951e-01f,
-    1.078156352e+00f,
-    6.537113190e-01f,
-    1.228549600e+00f,
-    2.021861792e+00f,
-    5.504661798e-01f,
-    3.702453077e-01f,
-    8.426087499e-01f,
-    1.464011788e+00f,
-    1.303143382e+00f,
-    8.025825620e-01f,
-    7.184265256e-01f,
-    1.229883909e+00f,
-    1.930277586e+00f,
-    4.849034786e+00f,
-    1.165835023e+00f,
-    9.129352570e-01f,
-    1.194937229e+00f,
-    4.029177129e-01f,
-    6.717830896e-01f,
-    9.356106520e-01f,
-    6.709648967e-01f,
-    9.766550064e-01f,
-    4.590176642e-01f,
-    1.235749364e+00f,
-    9.120358825e-01f,
-    9.243535399e-01f,
-    5.178443193e-01f,
-    1.258138537e+00f,
-    1.422166705e+00f,
-    9.076907039e-01f,
-    1.400763154e+00f,
-    1.783920646e+00f,
-    1.030485034e+00f,
-    1.294492245e+00f,
-    1.428781509e+00f,
-    8.952349424e-01f,
-    8.993812203e-01f,
-    1.125615239e+00f,
-    6.147382259e-01f,
-    6.404149532e-01f,
-    1.111592770e+00f,
-    9.255254269e-01f,
-    6.905483603e-01f,
-    6.062405109e-01f,
-    5.024382472e-01f,
-    4.849755168e-01f,
-    1.081282735e+00f,
-    8.526081443e-01f,
-    1.510151148e+00f,
-    1.201521397e+00f,
-    1.239497423e+00f,
-    8.670967221e-01f,
-    9.131840467e-01f,
-    7.904015183e-01f,
-    8.458080292e-01f,
-    1.383764625e+00f,
-    1.136963725e+00f,
-    1.168935537e+00f,
-    1.680120349e+00f,
-    5.297324061e-01f,
-    8.834528923e-01f,
-    2.571137428e+00f,
-    3.899666369e-01f,
-    9.703038931e-01f,
-    9.898961186e-01f,
-    1.384377837e+00f,
-    1.407919765e+00f,
-    8.628072739e-01f,
-    1.077417135e+00f,
-    8.747425079e-01f,
-    1.118355155e+00f,
-    7.766657472e-01f,
-    9.008948803e-01f,
-    8.806481957e-01f,
-    5.104345083e-01f,
-    5.027289987e-01f,
-    1.086261034e+00f,
-    8.294207454e-01f,
-    4.190641642e-01f,
-    6.380931139e-01f,
-    3.355513215e-01f,
-    7.664725184e-01f,
-    8.270285130e-01f,
-    1.194811702e+00f,
-    9.050859809e-01f,
-    6.924149990e-01f,
-    1.129226685e+00f,
-    9.418445826e-01f,
-    9.574372172e-01f,
-    2.972076833e-01f,
-    1.183046699e+00f,
-    5.350042582e-01f,
-    1.238810420e-01f,
-    3.757044673e-01f,
-    1.494885206e+00f,
-    2.756347060e-01f,
-    3.562041998e+00f,
-    8.945389390e-01f,
-    9.904569983e-01f,
-    3.715270460e-01f,
-    1.246026874e+00f,
-    1.727040857e-01f,
-    1.782618463e-01f,
-    2.775089979e+00f,
-    1.036931992e+00f,
-    5.262804627e-01f,
-    8.672245145e-01f,
-    6.901668906e-01f,
-    1.295313716e+00f,
-    9.742524028e-01f,
-    1.245236993e+00f,
-    1.994869471e+00f,
-    1.273574114e+00f,
-    7.825774550e-01f,
-    7.080289721e-01f,
-    5.844250321e-01f,
-    1.518708944e+00f,
-    7.721576095e-01f,
-    2.846653700e+00f,
-    6.430531740e-01f,
-    1.523624897e+00f,
-    2.058844805e+00f,
-    2.016620398e+00f,
-    1.492323637e+00f,
-    5.515736341e-01f,
-    4.379907846e-01f,
-    7.833100557e-01f,
-    1.180108428e+00f,
-    1.217074513e+00f,
-    6.479684114e-01f,
-    1.104360938e+00f,
-    1.068479419e+00f,
-    5.303992629e-01f,
-    7.933582664e-01f,
-    9.451381564e-01f,
-    1.104229808e+00f,
-    2.420859098e+00f,
-    5.146006346e-01f,
-    6.730027199e-01f,
-    1.087976217e+00f,
-    1.341897607e+00f,
-    6.900144219e-01f,
-    9.244176745e-01f,
-    1.165492535e+00f
-};
\ No newline at end of file
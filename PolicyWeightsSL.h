@@ -1,23545 +0,0 @@
-alignas(64) constexpr std::array<float, NUM_FEATURES> PolicyWeights::feature_weights_sl{
-    0.00062685553f, /* = 0 */
-    1.16925573f, /* = 1 */
-    1.65461266f, /* = 2 */
-    0.694553792f, /* = 3 */
-    0.00148894358f, /* = 4 */
-    8.98074995e-06f, /* = 5 */
-    0.0152205881f, /* = 6 */
-    0.0515640154f, /* = 7 */
-    1.28472996f, /* = 8 */
-    0.00378694828f, /* = 9 */
-    236.314545f, /* = 10 */
-    976.73822f, /* = 11 */
-    1974.10352f, /* = 12 */
-    2.33782697f, /* = 13 */
-    40.1325722f, /* = 14 */
-    559.375671f, /* = 15 */
-    0.210792825f, /* = 16 */
-    0.335069597f, /* = 17 */
-    0.480880439f, /* = 18 */
-    6.8125064e-06f, /* = 19 */
-    16.9763088f, /* = 20 */
-    10.570013f /* = 21 */
-};
-
-alignas(64) constexpr std::array<float, NUM_PATTERNS> PolicyWeights::pattern_weights_sl{
-    1.746338308e-01f,
-    1.258233339e-01f,
-    2.276862971e-03f,
-    4.294517636e-01f,
-    9.620421380e-02f,
-    1.339958668e+00f,
-    1.322647572e+00f,
-    5.985370278e-01f,
-    1.825414365e-03f,
-    1.359143972e+00f,
-    1.790721059e+00f,
-    1.583481789e+00f,
-    3.748127460e+00f,
-    6.002061367e+00f,
-    2.723622084e+00f,
-    2.417735815e+00f,
-    1.321057439e+00f,
-    8.283758163e-01f,
-    2.974355519e-01f,
-    7.177864313e-01f,
-    4.225989819e+00f,
-    7.259641290e-01f,
-    1.039766669e+00f,
-    1.881052613e+00f,
-    3.570596501e-02f,
-    3.439182043e+00f,
-    1.214414954e+00f,
-    1.245989203e+00f,
-    4.556763649e+00f,
-    1.872484207e+00f,
-    6.244470119e+00f,
-    1.717370152e+00f,
-    2.243066311e+00f,
-    1.073326588e+00f,
-    1.602784991e+00f,
-    1.366976142e+00f,
-    2.087539673e+00f,
-    8.313463330e-01f,
-    5.853762031e-01f,
-    1.354182959e+00f,
-    1.310378551e+00f,
-    2.032108068e+00f,
-    2.178601980e+00f,
-    4.417273998e-01f,
-    1.580710292e+00f,
-    6.340795755e-01f,
-    1.878690600e+00f,
-    3.730507612e+00f,
-    1.056480289e+00f,
-    1.657162189e+00f,
-    1.157998323e+00f,
-    3.373518586e-01f,
-    1.134698316e-01f,
-    1.754435062e+00f,
-    5.764075518e-01f,
-    2.375561558e-02f,
-    1.068850398e+00f,
-    7.648860216e-01f,
-    1.588687487e-02f,
-    1.285097361e+00f,
-    6.331589222e-01f,
-    2.723411083e+00f,
-    2.301177263e+00f,
-    5.117685795e-01f,
-    2.315269113e-01f,
-    2.366554976e+00f,
-    5.850444436e-01f,
-    3.760522008e-01f,
-    2.766444921e+00f,
-    7.482904792e-01f,
-    1.328737855e+00f,
-    2.227317095e+00f,
-    4.504257679e+00f,
-    1.584629118e-01f,
-    7.985918224e-02f,
-    2.519123554e+00f,
-    1.824351072e+00f,
-    2.654906750e+00f,
-    1.255876660e+00f,
-    2.725558281e+00f,
-    1.578912973e+00f,
-    6.351073831e-02f,
-    3.317169473e-02f,
-    7.207333088e+00f,
-    3.277201205e-02f,
-    2.692361355e+00f,
-    1.507567883e+00f,
-    1.260494828e+00f,
-    1.361752391e+00f,
-    5.602272749e-01f,
-    6.892157197e-01f,
-    7.982709408e-01f,
-    8.579465151e-01f,
-    8.933969498e+00f,
-    2.351369381e+00f,
-    1.213241816e+00f,
-    1.628002524e+00f,
-    2.713485003e+00f,
-    2.146942139e+00f,
-    1.322293520e+00f,
-    1.709046602e+00f,
-    1.340223551e+00f,
-    1.049797297e+00f,
-    2.250086069e+00f,
-    2.108530283e+00f,
-    5.862515569e-01f,
-    1.423856735e+00f,
-    8.996702433e-01f,
-    3.054510832e+00f,
-    6.196733117e-01f,
-    7.962573767e-01f,
-    8.759153485e-01f,
-    1.057245612e+00f,
-    1.475115538e+00f,
-    1.135141492e+00f,
-    2.352851391e+00f,
-    9.741175175e-01f,
-    1.660263658e+00f,
-    2.438097954e+00f,
-    1.478831410e+00f,
-    1.962558270e+00f,
-    1.926972866e+00f,
-    2.040423870e+00f,
-    6.826924324e+00f,
-    2.794059753e+00f,
-    1.555191159e+00f,
-    2.320835114e+00f,
-    2.636997938e+00f,
-    8.836513758e-01f,
-    1.084516048e+00f,
-    8.017587662e+00f,
-    1.349871159e+00f,
-    2.824510813e+00f,
-    2.783294439e+00f,
-    8.623852134e-01f,
-    7.722560167e-01f,
-    7.435792685e-01f,
-    6.738610268e-01f,
-    5.517653823e-01f,
-    3.302680701e-02f,
-    2.417016506e+00f,
-    7.441673875e-01f,
-    2.795829438e-02f,
-    1.451842189e+00f,
-    2.477445364e+00f,
-    8.761135340e-01f,
-    9.893514514e-01f,
-    8.184942007e-01f,
-    1.284527540e+00f,
-    3.117506599e+01f,
-    1.183456421e+00f,
-    6.585139632e-01f,
-    2.853510141e+00f,
-    7.172564864e-01f,
-    8.591520190e-01f,
-    9.331595302e-01f,
-    3.068227530e+00f,
-    1.885404885e-01f,
-    2.534656227e-01f,
-    2.831360102e+00f,
-    7.562024593e-01f,
-    2.692257166e+00f,
-    9.519308805e-01f,
-    9.510286450e-01f,
-    2.259513855e+00f,
-    1.505833119e-01f,
-    2.740465105e-02f,
-    3.606673479e+00f,
-    3.552083671e-02f,
-    2.302099466e+00f,
-    1.567919493e+00f,
-    3.159500360e+00f,
-    1.529083729e+00f,
-    5.678236485e-01f,
-    9.044597149e-01f,
-    2.294616938e+00f,
-    6.582308412e-01f,
-    5.559669971e+00f,
-    1.817232013e+00f,
-    1.214681864e+00f,
-    1.475784063e+00f,
-    1.425269604e+00f,
-    2.949250937e+00f,
-    5.383862853e-01f,
-    1.274633288e+00f,
-    4.809274673e+00f,
-    4.578128159e-01f,
-    1.555669785e+00f,
-    1.981064796e+00f,
-    1.402997136e+00f,
-    3.123261929e-01f,
-    5.898464322e-01f,
-    4.615861416e+00f,
-    9.155376554e-01f,
-    8.905928135e-01f,
-    1.465890527e+00f,
-    7.179645896e-01f,
-    2.333096504e+00f,
-    6.090209484e-01f,
-    1.798888087e+00f,
-    1.463054776e+00f,
-    7.832850218e-01f,
-    6.656746387e+00f,
-    2.127398968e+00f,
-    1.031795502e+00f,
-    1.645134568e+00f,
-    1.746563435e+00f,
-    4.258614540e+00f,
-    2.363768578e+00f,
-    1.180230379e+00f,
-    1.106240153e+00f,
-    6.651108265e+00f,
-    6.724050045e-01f,
-    2.243372917e+00f,
-    1.633483887e+01f,
-    1.072877049e+00f,
-    1.071938157e+00f,
-    8.109248161e+00f,
-    3.095868528e-01f,
-    5.146259069e-01f,
-    1.009487152e+00f,
-    1.278137922e+00f,
-    4.203354716e-01f,
-    2.437352896e+00f,
-    7.087824494e-02f,
-    2.923999727e-02f,
-    1.297582030e+00f,
-    9.663112760e-01f,
-    2.090192586e-02f,
-    1.424708724e+00f,
-    2.335602418e-03f,
-    7.233781815e-01f,
-    1.803519368e+00f,
-    1.132772207e+00f,
-    8.987783194e-01f,
-    8.470255733e-01f,
-    2.851126671e+00f,
-    4.423009157e-01f,
-    7.795624733e-01f,
-    5.150693512e+01f,
-    6.831460595e-01f,
-    4.648184180e-01f,
-    1.746265888e+00f,
-    3.298333287e-01f,
-    4.878757000e+00f,
-    5.429196358e-01f,
-    1.434818387e+00f,
-    1.278261423e+00f,
-    8.857158422e-01f,
-    6.508908272e-01f,
-    4.012753963e+00f,
-    2.140386254e-01f,
-    1.536256075e-01f,
-    4.398237705e+00f,
-    7.332370877e-01f,
-    1.952564530e-02f,
-    1.359628797e+00f,
-    1.170941830e+00f,
-    1.763033509e+00f,
-    1.406209707e+00f,
-    5.451495051e-01f,
-    2.134538889e+00f,
-    1.401585937e+00f,
-    2.743934095e-02f,
-    1.684124582e-02f,
-    4.208882809e+00f,
-    1.403493341e-02f,
-    4.480522633e+00f,
-    1.502054045e-03f,
-    2.076259136e+00f,
-    1.595359564e+00f,
-    1.797332048e+00f,
-    2.501454115e+00f,
-    7.891435027e-01f,
-    9.173280597e-01f,
-    2.437954545e-01f,
-    4.086350203e-01f,
-    1.952119112e+00f,
-    4.849663079e-01f,
-    8.503691554e-01f,
-    6.845960021e-01f,
-    3.454162598e+00f,
-    2.228438616e+00f,
-    8.862484694e-01f,
-    1.379707098e+00f,
-    2.767381430e+00f,
-    1.455371022e+00f,
-    7.433711886e-01f,
-    6.653346062e+00f,
-    9.801700711e-01f,
-    9.246020317e-01f,
-    4.506944180e+00f,
-    6.296600103e-01f,
-    2.952095032e+00f,
-    1.109155774e+00f,
-    1.402731180e+00f,
-    2.591021538e+00f,
-    9.811766148e-01f,
-    9.112594128e-01f,
-    1.416961789e+00f,
-    7.202939987e-01f,
-    3.959528804e-01f,
-    1.271200085e+01f,
-    1.169201612e+00f,
-    1.037230730e+00f,
-    6.058224440e-01f,
-    4.486524165e-01f,
-    1.130390406e+00f,
-    2.232776642e+00f,
-    5.328697205e+00f,
-    5.889831781e-01f,
-    9.116095304e-01f,
-    1.022361875e+00f,
-    1.813544393e+00f,
-    2.805205345e+00f,
-    1.772994280e+00f,
-    3.823341370e+00f,
-    1.423384309e+00f,
-    1.005881190e+00f,
-    1.980211258e+00f,
-    7.916464210e-01f,
-    1.474012494e+00f,
-    1.949948311e+00f,
-    9.987670183e-01f,
-    2.128880501e+00f,
-    3.300865412e+00f,
-    1.826293826e+00f,
-    1.285635948e+00f,
-    2.111651421e+00f,
-    1.186072707e+00f,
-    1.773576379e+00f,
-    5.767322063e+00f,
-    6.977457404e-01f,
-    8.690905571e-01f,
-    1.246506214e+01f,
-    2.181541443e+00f,
-    1.350368738e+00f,
-    4.923072457e-01f,
-    8.607609272e-01f,
-    1.916281891e+01f,
-    8.033335805e-01f,
-    9.258478284e-01f,
-    4.752601981e-01f,
-    1.351829767e+00f,
-    2.262614518e-01f,
-    1.026816219e-01f,
-    2.793159485e-01f,
-    3.088478446e-01f,
-    6.588963270e-01f,
-    1.392121792e+00f,
-    1.082124561e-01f,
-    7.570833564e-01f,
-    1.922459364e+00f,
-    1.621790886e+00f,
-    9.267290831e-01f,
-    7.010174543e-02f,
-    2.373450994e-02f,
-    2.505193278e-02f,
-    1.972040057e+00f,
-    1.578767538e+00f,
-    9.705368280e-01f,
-    3.004000187e-01f,
-    7.353389740e+00f,
-    1.641874164e-01f,
-    3.001984060e-01f,
-    3.274343014e-01f,
-    3.622017205e-01f,
-    1.221197844e+00f,
-    2.771100998e-01f,
-    6.961275339e-01f,
-    1.427532554e+00f,
-    1.585804582e+00f,
-    1.369625092e+00f,
-    2.181026697e+00f,
-    4.317477226e+00f,
-    2.679032326e+00f,
-    1.832192063e+00f,
-    9.556697607e-01f,
-    1.309390068e+00f,
-    2.136385679e+00f,
-    3.604302645e+00f,
-    1.559650660e+00f,
-    7.224928588e-02f,
-    3.295087069e-02f,
-    5.199937150e-02f,
-    1.145847678e+00f,
-    1.243750334e+00f,
-    1.592393637e+00f,
-    7.073421478e-01f,
-    1.415961742e+00f,
-    2.046212196e+00f,
-    6.616273522e-01f,
-    2.027457237e+00f,
-    1.429176569e+00f,
-    1.455502748e+00f,
-    7.958256602e-01f,
-    4.957670271e-01f,
-    1.265045285e+00f,
-    1.031126213e+01f,
-    1.491297722e+00f,
-    2.283543825e+00f,
-    1.552896976e+00f,
-    1.976447821e+00f,
-    4.954043329e-01f,
-    9.805571437e-01f,
-    4.633892477e-01f,
-    1.212640047e+00f,
-    7.536990047e-01f,
-    1.208467841e+00f,
-    2.776758969e-01f,
-    3.639475107e-01f,
-    2.677667737e-01f,
-    8.296419382e-01f,
-    3.072388172e-01f,
-    4.188571870e-01f,
-    1.052658796e+00f,
-    1.912830591e+00f,
-    9.593548179e-01f,
-    2.105664253e+00f,
-    1.846707225e+00f,
-    1.878972411e+00f,
-    2.250387669e+00f,
-    1.076907396e+00f,
-    8.214100599e-01f,
-    5.350463390e-01f,
-    5.787037849e+00f,
-    3.145805597e-01f,
-    2.880560458e-01f,
-    4.658321440e-01f,
-    2.360669672e-01f,
-    9.145619273e-01f,
-    3.197441697e-01f,
-    7.472983599e-01f,
-    3.752067387e-01f,
-    6.174461842e-01f,
-    1.141966462e+00f,
-    5.378557682e+00f,
-    3.255364180e+00f,
-    1.354507804e+00f,
-    3.397562206e-01f,
-    9.897971749e-01f,
-    7.243113518e-01f,
-    2.872094154e+00f,
-    2.844159126e+00f,
-    1.230365872e+00f,
-    2.533753872e+00f,
-    4.588449001e+00f,
-    6.219798326e-01f,
-    1.429650426e+00f,
-    9.886779785e-01f,
-    1.637253523e+00f,
-    1.673847198e+00f,
-    8.701914549e-01f,
-    2.921323538e+00f,
-    1.527216792e+00f,
-    3.134679556e+00f,
-    1.658424497e+00f,
-    1.164317131e+00f,
-    1.583882213e+00f,
-    1.418196797e+00f,
-    6.115823746e+00f,
-    1.138726425e+01f,
-    2.824147224e+00f,
-    3.615400076e+00f,
-    1.982488513e+00f,
-    1.346599221e+00f,
-    5.109016895e-01f,
-    1.112379074e+00f,
-    5.897077918e-01f,
-    7.313500643e-01f,
-    2.694111168e-01f,
-    4.273236752e+00f,
-    1.302296162e+01f,
-    4.945521355e+00f,
-    6.199384928e-01f,
-    7.539638877e-01f,
-    3.307493687e+00f,
-    1.145463228e+00f,
-    8.375719786e-01f,
-    9.591175616e-02f,
-    2.980816737e-02f,
-    1.210011482e+00f,
-    9.756788611e-01f,
-    1.526161075e+00f,
-    1.669013619e+00f,
-    2.489162207e+00f,
-    9.503961205e-01f,
-    6.915973186e+00f,
-    3.634330273e+00f,
-    7.566817403e-01f,
-    1.567364812e+00f,
-    1.283838391e+00f,
-    1.135015368e+00f,
-    8.124560714e-01f,
-    7.339698792e+00f,
-    1.105127144e+01f,
-    4.706542015e+00f,
-    9.001973271e-01f,
-    7.010627985e-01f,
-    8.542064428e-01f,
-    9.479235411e-01f,
-    2.646947384e+00f,
-    4.823406219e+00f,
-    2.413680792e+00f,
-    9.835962653e-01f,
-    1.757854819e+00f,
-    2.288017273e+00f,
-    3.259373426e+00f,
-    9.596520662e-01f,
-    2.729488909e-01f,
-    6.664112210e-02f,
-    1.236022353e+00f,
-    1.410583138e+00f,
-    5.979146957e-01f,
-    3.912517071e+00f,
-    3.411884069e+00f,
-    2.146134377e+00f,
-    8.015033603e-01f,
-    1.607773542e+00f,
-    3.344870567e+00f,
-    4.953421116e+00f,
-    3.626692772e+00f,
-    2.014293373e-01f,
-    5.607273057e-02f,
-    1.968893766e+00f,
-    3.633544683e+00f,
-    3.082051039e+00f,
-    1.932324916e-01f,
-    5.216703191e-02f,
-    4.948778152e-01f,
-    8.713494539e-01f,
-    1.982264280e+00f,
-    1.792789221e+00f,
-    1.720626593e+00f,
-    1.058508515e+00f,
-    4.541174769e-01f,
-    2.281692982e+00f,
-    1.127413988e+00f,
-    1.372922182e+00f,
-    1.824896216e+00f,
-    2.265527725e+00f,
-    1.719290018e+00f,
-    1.003986716e+00f,
-    7.970535755e-01f,
-    2.675582170e+00f,
-    3.917876005e+00f,
-    1.531803370e+00f,
-    2.263285875e+00f,
-    2.324967623e+00f,
-    1.271800041e+00f,
-    1.129522800e+00f,
-    2.677053928e+00f,
-    6.610534191e-01f,
-    1.510651827e+00f,
-    1.475265861e+00f,
-    2.278768063e+00f,
-    9.772207141e-01f,
-    6.950287223e-01f,
-    7.353318930e-01f,
-    1.348162651e+00f,
-    3.556409180e-01f,
-    8.029834747e+00f,
-    5.432527542e+00f,
-    3.261737442e+01f,
-    7.573849559e-01f,
-    6.498733759e-01f,
-    1.149749041e+00f,
-    1.281829357e+00f,
-    4.040559769e+00f,
-    1.489987850e+00f,
-    1.879534841e+00f,
-    2.386615753e+00f,
-    1.126088381e+00f,
-    1.784650683e+00f,
-    2.841734886e+00f,
-    1.676743627e+00f,
-    1.752032399e+00f,
-    1.452259445e+01f,
-    3.476547241e+01f,
-    1.972605824e+00f,
-    1.027471066e+00f,
-    7.920648456e-01f,
-    1.140301228e+00f,
-    7.227025032e-01f,
-    1.250276947e+01f,
-    1.037753868e+01f,
-    1.628553009e+01f,
-    7.904326916e-01f,
-    6.108378768e-01f,
-    6.612557173e-01f,
-    8.730094433e-01f,
-    2.340060711e+00f,
-    1.790369272e+00f,
-    3.249466658e+00f,
-    1.834499478e+00f,
-    4.407078028e-01f,
-    1.903176308e+00f,
-    1.496738195e+00f,
-    5.544709563e-01f,
-    2.046428204e+00f,
-    1.797488570e+00f,
-    4.246480942e+00f,
-    1.944698095e+00f,
-    7.155239582e-01f,
-    2.058433056e+00f,
-    1.627556801e+00f,
-    1.620128393e+00f,
-    2.451090574e+00f,
-    5.605204105e-01f,
-    1.807340384e+00f,
-    1.785646558e+00f,
-    2.096306086e+00f,
-    1.548675776e+00f,
-    2.644650459e+00f,
-    5.455878735e+00f,
-    1.987835288e+00f,
-    1.785106897e+00f,
-    2.621343136e+00f,
-    2.478772879e+00f,
-    2.091186762e+00f,
-    8.284841180e-01f,
-    4.125981331e+00f,
-    2.071917057e+00f,
-    3.672196388e+00f,
-    1.084665775e+00f,
-    6.642318368e-01f,
-    2.237435579e+00f,
-    3.390688419e+00f,
-    6.737008691e-01f,
-    4.764834881e+00f,
-    1.754002571e+01f,
-    2.236675501e+00f,
-    2.575881243e+00f,
-    1.334876776e+00f,
-    4.234916210e+00f,
-    1.349768877e+00f,
-    1.431603312e+00f,
-    1.136296272e+00f,
-    1.518625498e+00f,
-    2.407927990e+00f,
-    2.939957619e+00f,
-    1.014269233e+00f,
-    7.149807811e-01f,
-    4.316066504e-01f,
-    3.883883238e+00f,
-    3.882167816e+00f,
-    4.738856792e+00f,
-    6.434174776e-01f,
-    4.445773363e-01f,
-    9.768778086e-01f,
-    5.737218261e-01f,
-    7.444671154e+00f,
-    7.597127914e+00f,
-    5.968909264e+00f,
-    5.231762528e-01f,
-    2.569830716e-01f,
-    8.492218852e-01f,
-    5.243013501e-01f,
-    1.386382222e+00f,
-    1.295084357e-01f,
-    4.173421860e+00f,
-    1.988987207e+00f,
-    9.568511248e-01f,
-    1.758849770e-01f,
-    4.018925130e-02f,
-    2.496638060e+00f,
-    2.708991766e+00f,
-    3.580219507e+00f,
-    9.586089253e-01f,
-    7.054741383e-01f,
-    1.181964517e+00f,
-    4.165514372e-03f,
-    6.205487251e-01f,
-    9.751253128e-01f,
-    1.210614204e+00f,
-    5.470059872e+00f,
-    2.608502865e+00f,
-    9.821092486e-01f,
-    1.478175879e+00f,
-    6.261157393e-01f,
-    1.020963073e+00f,
-    5.268516064e+00f,
-    6.720435023e-01f,
-    1.524415731e+00f,
-    1.151822209e+00f,
-    7.761390805e-01f,
-    8.982794762e+00f,
-    8.080815315e+00f,
-    4.210176468e+00f,
-    3.807101846e-01f,
-    5.206338167e-01f,
-    7.351989746e-01f,
-    1.046614289e+00f,
-    9.229096174e-01f,
-    1.890484691e-01f,
-    1.324584126e+00f,
-    7.127965093e-01f,
-    1.713822246e+00f,
-    5.524881363e+00f,
-    3.891912937e+00f,
-    2.222012043e+00f,
-    7.272152901e-01f,
-    1.610875130e+00f,
-    5.942229033e-01f,
-    1.120407939e+00f,
-    1.411006570e+00f,
-    2.864317656e+00f,
-    4.735217571e+00f,
-    9.845960736e-01f,
-    1.503328532e-01f,
-    8.167140186e-02f,
-    1.302224874e+00f,
-    4.800373554e+00f,
-    3.857885838e+00f,
-    1.669079304e+00f,
-    4.529401362e-01f,
-    1.611896634e+00f,
-    1.048465818e-02f,
-    2.482536316e+00f,
-    7.355980873e+00f,
-    1.098676443e+00f,
-    1.950100541e+00f,
-    1.282550454e+00f,
-    2.387893200e+00f,
-    4.764830112e+00f,
-    2.816993475e+00f,
-    1.262798429e+00f,
-    1.733662486e+00f,
-    1.171605587e+00f,
-    2.769365788e+00f,
-    1.656272113e-01f,
-    3.905303776e-02f,
-    3.410427332e+00f,
-    2.902464867e+00f,
-    2.861138344e+00f,
-    1.676489264e-01f,
-    3.894662857e-02f,
-    5.509332180e+00f,
-    2.125268936e+00f,
-    6.083866596e+00f,
-    1.764011756e-02f,
-    9.247447252e-01f,
-    6.430283189e-01f,
-    7.001595497e+00f,
-    6.145106316e+00f,
-    3.073909044e+00f,
-    6.349369287e-01f,
-    7.434803247e-01f,
-    4.969111085e-01f,
-    9.423707128e-01f,
-    5.395503640e-01f,
-    8.088303208e-01f,
-    1.181457281e+00f,
-    9.694724083e-01f,
-    7.631189227e-01f,
-    1.799255967e+00f,
-    2.449183464e+00f,
-    5.279601812e-01f,
-    1.098057866e+00f,
-    1.786460280e+00f,
-    1.737208128e+00f,
-    8.152782917e-01f,
-    5.564324856e-01f,
-    2.798047543e+00f,
-    2.044107437e+00f,
-    1.846917391e+00f,
-    2.284552574e+00f,
-    9.817213416e-01f,
-    1.247962713e+00f,
-    2.728015900e+00f,
-    5.650605202e+00f,
-    4.193036079e+00f,
-    1.060593367e+00f,
-    1.113550425e+00f,
-    1.217165351e+00f,
-    7.407424450e-01f,
-    7.452811599e-01f,
-    5.869055986e-01f,
-    4.229732037e+00f,
-    7.107742786e+00f,
-    2.137267590e+00f,
-    1.120809197e+00f,
-    5.821266174e-01f,
-    9.313259721e-01f,
-    8.559276462e-01f,
-    9.191386700e-01f,
-    4.447940290e-01f,
-    5.109027028e-01f,
-    1.289131522e+00f,
-    9.175636292e+00f,
-    1.200104713e+01f,
-    6.724922180e+01f,
-    9.008001089e-01f,
-    6.859270930e-01f,
-    5.864008069e-01f,
-    6.047191024e-01f,
-    3.739026785e-01f,
-    1.254204661e-01f,
-    8.881694674e-01f,
-    1.225485206e+00f,
-    9.215397835e-01f,
-    1.694072723e+00f,
-    1.550651908e+00f,
-    1.477525711e+00f,
-    1.976902962e+00f,
-    1.881910324e+00f,
-    2.699268818e+00f,
-    1.247086644e+00f,
-    1.587600946e+00f,
-    3.148650885e+00f,
-    1.274654031e+00f,
-    1.337508678e+00f,
-    1.144608736e+00f,
-    2.453910637e+01f,
-    4.217292404e+01f,
-    1.337334394e+00f,
-    6.642681956e-01f,
-    8.231014013e-01f,
-    7.811243534e-01f,
-    6.731478214e+00f,
-    6.657272339e+00f,
-    4.452224255e+00f,
-    4.437631369e-01f,
-    1.066825151e+00f,
-    1.727805901e+01f,
-    1.712022400e+01f,
-    1.348255444e+01f,
-    7.649867535e-01f,
-    7.586396337e-01f,
-    8.772084713e-01f,
-    6.758033037e-01f,
-    3.820896149e-01f,
-    5.804464817e-01f,
-    7.109797001e-01f,
-    8.002060652e-01f,
-    2.340334415e+00f,
-    3.432169914e+00f,
-    3.237082481e+00f,
-    2.643788099e+00f,
-    2.303991795e+00f,
-    3.880917072e+00f,
-    1.344557881e+00f,
-    1.166085124e+00f,
-    9.051427841e-01f,
-    1.027549505e+00f,
-    1.473950744e+00f,
-    4.978309572e-01f,
-    3.608943939e+00f,
-    2.174373627e+00f,
-    1.650239706e+00f,
-    1.041962028e+00f,
-    6.642071605e-01f,
-    1.261242867e+00f,
-    7.685007453e-01f,
-    5.049223304e-01f,
-    5.618886948e+00f,
-    3.011005402e+00f,
-    2.481382608e+00f,
-    2.400491476e+00f,
-    1.338706613e+00f,
-    1.096998096e+00f,
-    3.003082991e+00f,
-    2.898567438e+00f,
-    1.944800377e+00f,
-    1.596574068e+00f,
-    2.144456625e+00f,
-    4.179376125e+00f,
-    2.868419647e+00f,
-    1.165122032e+00f,
-    2.684137106e+00f,
-    8.515195847e-01f,
-    1.983582616e+00f,
-    1.942052960e+00f,
-    4.030455112e+00f,
-    7.521224976e+00f,
-    2.729658842e+00f,
-    2.003301144e+00f,
-    2.169371843e+00f,
-    3.026809931e+00f,
-    6.132289767e-01f,
-    7.216069102e-01f,
-    1.137807274e+01f,
-    1.367699909e+01f,
-    1.098974323e+01f,
-    9.855514765e-01f,
-    7.964453101e-01f,
-    6.210920811e-01f,
-    2.403334379e+00f,
-    2.673726678e-01f,
-    1.209839463e+00f,
-    1.783411741e+00f,
-    2.095569372e+00f,
-    9.147746563e-01f,
-    1.879846001e+01f,
-    2.313777161e+01f,
-    1.064171553e+00f,
-    9.214076400e-01f,
-    9.271844625e-01f,
-    1.671091199e+00f,
-    2.287715197e+00f,
-    7.036457658e-01f,
-    2.024266481e+00f,
-    1.626768708e+00f,
-    1.961532593e+00f,
-    3.983669281e+00f,
-    1.462625742e+00f,
-    9.904361963e-01f,
-    2.793050528e+00f,
-    2.414866686e+00f,
-    3.820944309e+00f,
-    4.413384914e+00f,
-    9.663764238e-01f,
-    1.146275520e+01f,
-    1.637985110e+00f,
-    1.016426563e+00f,
-    7.068026662e-01f,
-    3.913769007e+00f,
-    1.494699001e+01f,
-    1.116071701e+01f,
-    1.121334195e+00f,
-    2.087550402e+00f,
-    8.014505506e-01f,
-    4.351409972e-01f,
-    3.694987297e-01f,
-    6.600291729e-01f,
-    1.593990088e+00f,
-    9.981763959e-01f,
-    8.808013797e-01f,
-    4.366859436e+00f,
-    3.273020506e+00f,
-    1.014858913e+01f,
-    6.996605992e-01f,
-    5.305426121e-01f,
-    4.453936815e-01f,
-    1.968770623e+00f,
-    1.945829988e+00f,
-    1.017673731e+00f,
-    4.185995162e-01f,
-    2.724261582e-02f,
-    7.724151760e-02f,
-    1.353011370e+00f,
-    2.743009090e+00f,
-    1.570412278e+00f,
-    1.468226671e+00f,
-    2.859920979e+00f,
-    7.011489391e+00f,
-    5.911765575e+00f,
-    4.991467476e+00f,
-    4.839152813e+00f,
-    9.763417840e-01f,
-    5.224798918e-01f,
-    4.659704268e-01f,
-    1.460004330e+00f,
-    1.245837688e+00f,
-    1.376598120e+00f,
-    2.875211239e+00f,
-    2.715922117e+00f,
-    2.534892797e+00f,
-    1.091621280e+00f,
-    5.184568763e-01f,
-    9.605090022e-01f,
-    2.458779335e+00f,
-    3.949174404e+00f,
-    2.876009464e+00f,
-    2.005075663e-01f,
-    3.879150003e-02f,
-    7.089279592e-02f,
-    1.949094534e+00f,
-    1.419548988e+00f,
-    1.222746730e+00f,
-    5.658321381e-01f,
-    1.600098014e+00f,
-    5.680136085e-01f,
-    2.147954941e+00f,
-    1.624957561e+00f,
-    1.648713350e+00f,
-    4.904142022e-01f,
-    7.739521265e-01f,
-    4.906998575e-01f,
-    1.575875282e+00f,
-    3.472113132e+00f,
-    2.058827639e+00f,
-    1.939934373e+00f,
-    2.396525145e+00f,
-    1.002478123e+00f,
-    7.998247147e-01f,
-    7.967321277e-01f,
-    7.337641716e-01f,
-    1.673520088e+00f,
-    5.807340145e-01f,
-    1.097903967e+00f,
-    5.456903458e+00f,
-    3.214785099e+00f,
-    1.223883247e+01f,
-    6.834765077e-01f,
-    2.982473373e-01f,
-    7.287375927e-01f,
-    8.267272711e-01f,
-    2.025803328e+00f,
-    1.010684252e+00f,
-    1.036836386e+00f,
-    1.731561184e+00f,
-    2.660447121e+00f,
-    2.454510450e+00f,
-    3.229686975e+00f,
-    2.301726341e+00f,
-    1.938076973e+01f,
-    1.217577171e+01f,
-    2.415118790e+01f,
-    5.124676704e+00f,
-    8.132640839e+00f,
-    8.195492744e+00f,
-    1.089488983e+00f,
-    1.163106918e+00f,
-    8.386753201e-01f,
-    5.442750454e-01f,
-    1.512548327e+00f,
-    3.346528709e-01f,
-    2.021129370e+00f,
-    2.490820646e+00f,
-    2.030713797e+00f,
-    8.486470580e-01f,
-    1.039052010e+00f,
-    2.647918165e-01f,
-    2.311681986e+00f,
-    1.622934699e+00f,
-    1.206875920e+00f,
-    1.804524064e+00f,
-    6.172838211e+00f,
-    2.056453228e+00f,
-    2.986164331e+00f,
-    1.726924062e+00f,
-    5.227419138e-01f,
-    4.079152644e-01f,
-    5.266650319e-01f,
-    5.279622078e-01f,
-    2.931510687e+00f,
-    4.804769039e+00f,
-    4.362593174e+00f,
-    1.119804263e+00f,
-    8.239520192e-01f,
-    9.471288323e-01f,
-    4.546339989e+00f,
-    1.590621281e+01f,
-    1.400991154e+01f,
-    4.536745548e+00f,
-    2.546397924e+00f,
-    2.121920347e+00f,
-    6.859618425e-01f,
-    1.095569849e+00f,
-    7.295323610e-01f,
-    1.328001499e+00f,
-    7.700929046e-01f,
-    5.475037575e+00f,
-    5.290838718e+00f,
-    8.500727654e+00f,
-    1.106092811e+00f,
-    4.638738632e-01f,
-    1.950784922e+00f,
-    7.987444997e-01f,
-    1.931287766e+00f,
-    5.289589763e-01f,
-    2.263546705e+00f,
-    2.450751305e+00f,
-    1.929889560e+00f,
-    3.569601476e-01f,
-    1.001523212e-01f,
-    2.325585604e+00f,
-    3.363141775e+00f,
-    6.193010807e+00f,
-    2.401559114e+00f,
-    2.464259863e+00f,
-    1.166191220e+00f,
-    2.337986976e-02f,
-    1.918279052e+00f,
-    4.231988430e+00f,
-    1.435341358e+00f,
-    2.556161880e+00f,
-    5.870979786e+00f,
-    2.701626062e+00f,
-    9.340561867e+00f,
-    3.546575069e+00f,
-    3.818732738e+00f,
-    1.999428749e+00f,
-    9.616995811e+00f,
-    2.016077518e+00f,
-    1.272029281e+00f,
-    7.561280727e-01f,
-    5.600774765e+00f,
-    6.956569195e+00f,
-    6.248531342e+00f,
-    4.537920654e-01f,
-    5.524604917e-01f,
-    1.181565642e+00f,
-    1.104747176e+00f,
-    1.465784669e+00f,
-    2.915068269e-01f,
-    1.691092491e+00f,
-    1.245473504e+00f,
-    1.812643766e+00f,
-    2.580900431e+00f,
-    5.246614933e+00f,
-    2.600940943e+00f,
-    1.675745726e+00f,
-    2.261676311e+00f,
-    1.656112671e+00f,
-    1.054822803e+00f,
-    9.956705570e-01f,
-    3.725543976e+00f,
-    6.280785084e+00f,
-    2.389295578e+00f,
-    2.726784050e-01f,
-    9.830963612e-02f,
-    2.888056993e+00f,
-    7.754289150e+00f,
-    6.267730236e+00f,
-    2.890413761e+00f,
-    1.360777974e+00f,
-    7.419152856e-01f,
-    1.481723692e-02f,
-    2.922871828e+00f,
-    6.781992912e+00f,
-    1.788082838e+00f,
-    1.971175551e+00f,
-    1.585839748e+00f,
-    3.878219843e+00f,
-    4.363456249e+00f,
-    3.107899189e+00f,
-    1.560209155e+00f,
-    3.090103388e+00f,
-    1.841167927e+00f,
-    5.087322712e+00f,
-    2.054263502e-01f,
-    8.642417938e-02f,
-    3.088014364e+00f,
-    2.403946161e+00f,
-    3.175655365e+00f,
-    2.961817980e-01f,
-    9.322115779e-02f,
-    3.067622423e+00f,
-    3.140184641e+00f,
-    5.497846127e+00f,
-    5.033117905e-02f,
-    4.554011822e-01f,
-    2.260177732e-01f,
-    6.381822109e+00f,
-    4.741544247e+00f,
-    3.676801920e+00f,
-    6.336060166e-01f,
-    1.906034946e+00f,
-    9.389105439e-01f,
-    4.172523022e-01f,
-    6.204239130e-01f,
-    3.630574048e-01f,
-    3.321436882e+00f,
-    3.534500360e+00f,
-    1.164352655e+00f,
-    1.716153264e+00f,
-    2.701697588e+00f,
-    2.070760012e+00f,
-    1.343856096e+00f,
-    1.201509714e+00f,
-    5.051900148e-01f,
-    2.571876287e+00f,
-    1.298483491e+00f,
-    6.546730518e+00f,
-    2.208621025e+00f,
-    1.267112017e+00f,
-    1.334882855e+00f,
-    1.084195971e+00f,
-    1.325836897e+00f,
-    1.456576228e+00f,
-    1.146284938e+00f,
-    1.035103798e+00f,
-    1.375672698e+00f,
-    5.689430833e-01f,
-    1.462646246e+00f,
-    4.562088251e-01f,
-    8.623844385e-01f,
-    3.044545650e-01f,
-    1.293310642e+00f,
-    2.226648331e+00f,
-    2.303686142e+00f,
-    5.768094659e-01f,
-    7.509461641e-01f,
-    6.015692949e-01f,
-    8.563852310e-01f,
-    4.187968373e-01f,
-    6.473069787e-01f,
-    1.721008658e+00f,
-    5.517236590e-01f,
-    2.690484524e+00f,
-    3.682984114e+00f,
-    7.607424736e+00f,
-    1.635414839e+00f,
-    6.043921113e-01f,
-    1.051214814e+00f,
-    1.373874307e+00f,
-    1.316608548e+00f,
-    7.963153124e-01f,
-    1.396655440e+00f,
-    2.477404118e+00f,
-    1.395515203e+00f,
-    1.236024261e+00f,
-    1.600077033e+00f,
-    1.701066971e+00f,
-    1.108335376e+00f,
-    2.060812712e+00f,
-    1.876673222e+00f,
-    1.412941337e+00f,
-    1.493529081e+00f,
-    1.009627819e+00f,
-    3.361129522e+00f,
-    4.890303612e+00f,
-    2.592164755e+00f,
-    2.274137115e+01f,
-    4.653169250e+01f,
-    5.900917530e+00f,
-    8.183394432e+00f,
-    2.181456327e+00f,
-    5.227692795e+01f,
-    3.936060667e+00f,
-    1.019278030e+02f,
-    5.225845814e+00f,
-    6.251484752e-01f,
-    1.201270342e+00f,
-    7.576657295e+00f,
-    1.136406231e+01f,
-    6.870836735e+00f,
-    8.776495457e-01f,
-    7.510542274e-01f,
-    1.477583051e+00f,
-    7.452856302e-01f,
-    8.019821644e-01f,
-    8.591921329e-01f,
-    5.447457433e-01f,
-    2.445520759e-01f,
-    2.068588018e+00f,
-    1.204123378e+00f,
-    2.206413746e+00f,
-    1.039205074e+00f,
-    2.337605953e+00f,
-    1.738140345e+00f,
-    8.049671054e-01f,
-    1.043845654e+00f,
-    1.045887232e+00f,
-    3.389461517e+00f,
-    1.367221713e+00f,
-    1.976014733e+00f,
-    1.538230777e+00f,
-    2.471676826e+00f,
-    2.321691036e+00f,
-    1.394266605e+00f,
-    1.568421960e+00f,
-    2.313026190e+00f,
-    3.734137774e+00f,
-    8.520494699e-01f,
-    1.691009331e+01f,
-    1.858232379e+00f,
-    2.327117443e+00f,
-    1.918435574e+00f,
-    1.550931454e+00f,
-    1.348191381e+00f,
-    1.230720520e+00f,
-    1.473008752e+00f,
-    1.133257747e+00f,
-    1.941629052e+00f,
-    1.741244555e+00f,
-    4.047728539e+00f,
-    1.345700383e+00f,
-    1.124305844e+00f,
-    7.578542233e-01f,
-    1.417953968e+00f,
-    1.351091981e+00f,
-    1.481537580e+00f,
-    2.331806660e+00f,
-    4.084161282e+00f,
-    2.430956125e+00f,
-    2.215322733e+00f,
-    4.691764355e+00f,
-    1.557167172e+00f,
-    7.711015344e-01f,
-    9.052952528e-01f,
-    8.098984718e+00f,
-    4.657985210e+00f,
-    8.257281303e+00f,
-    1.053478718e+00f,
-    1.163795114e+00f,
-    7.290130854e-01f,
-    6.765290499e-01f,
-    3.301099837e-01f,
-    5.602560639e-01f,
-    3.062765121e+00f,
-    2.606026173e+00f,
-    1.279445410e+00f,
-    5.218329906e+00f,
-    1.900494194e+01f,
-    2.855095148e+00f,
-    1.985073209e+00f,
-    4.346055508e+00f,
-    4.754203320e+00f,
-    2.916831732e+00f,
-    2.360970259e+00f,
-    8.444894791e+00f,
-    1.300956488e+00f,
-    8.048616409e+00f,
-    1.734132051e+00f,
-    7.205457687e-01f,
-    1.519888163e+00f,
-    2.331127167e+00f,
-    1.004818439e+00f,
-    1.435511470e+00f,
-    2.015916348e+00f,
-    2.291972399e+00f,
-    3.138512135e+00f,
-    1.432394266e+00f,
-    8.254746795e-01f,
-    9.545081258e-01f,
-    1.375473881e+01f,
-    6.848764896e+00f,
-    1.109207058e+01f,
-    9.501202106e-01f,
-    5.763100982e-01f,
-    7.196789384e-01f,
-    1.551733732e+00f,
-    1.230654001e+00f,
-    8.201947808e-01f,
-    8.721016645e-01f,
-    4.229611158e-01f,
-    9.367514849e-01f,
-    9.961700439e+00f,
-    6.348190308e+00f,
-    2.685374022e+00f,
-    4.337386787e-01f,
-    7.312378883e-01f,
-    9.521071911e-01f,
-    9.323560596e-01f,
-    9.578459859e-01f,
-    1.274132729e+00f,
-    7.035157084e-01f,
-    2.457488537e+00f,
-    5.130866528e+00f,
-    2.953192472e+00f,
-    1.331002265e-01f,
-    2.238633111e-02f,
-    7.319598645e-02f,
-    3.159681320e+00f,
-    3.729455471e+00f,
-    2.042106390e+00f,
-    3.520643711e+00f,
-    2.761662245e+00f,
-    2.438053131e+00f,
-    1.764750481e-02f,
-    3.291489840e+00f,
-    1.617465019e+00f,
-    2.056180716e+00f,
-    6.961015701e+00f,
-    1.288979340e+01f,
-    5.659689903e+00f,
-    4.490375519e+00f,
-    5.320124626e+00f,
-    9.463930130e+00f,
-    6.624691010e+00f,
-    5.601566434e-01f,
-    3.358374834e-01f,
-    5.276119709e-01f,
-    1.247074366e+00f,
-    7.370576262e-01f,
-    9.917141199e-01f,
-    2.280838042e-01f,
-    3.297055006e+00f,
-    1.323063493e+00f,
-    4.215736866e+00f,
-    8.836959004e-01f,
-    1.154776454e+00f,
-    1.682346821e+00f,
-    9.181423783e-01f,
-    2.736202002e+00f,
-    2.463750362e+00f,
-    2.135664701e+00f,
-    2.161876202e+00f,
-    8.719499111e-01f,
-    1.904672623e+00f,
-    8.774736524e-01f,
-    2.221230030e+00f,
-    7.972275019e-01f,
-    7.559633255e-01f,
-    4.930144310e+00f,
-    4.688082695e+00f,
-    2.078856468e+00f,
-    2.565304339e-01f,
-    3.674716502e-02f,
-    8.137117326e-02f,
-    1.710898519e+00f,
-    8.490110397e+00f,
-    5.799490452e+00f,
-    1.228558540e+00f,
-    1.200705290e+00f,
-    1.126774549e+00f,
-    1.309180632e-02f,
-    1.277727127e+00f,
-    8.525086641e-01f,
-    7.405033708e-01f,
-    4.397080898e+00f,
-    4.894811153e+00f,
-    3.848339796e+00f,
-    1.681305408e+00f,
-    1.306313634e+00f,
-    1.430287600e+00f,
-    9.755852818e-01f,
-    1.178488255e+00f,
-    7.578277588e-01f,
-    3.472189188e+00f,
-    1.959420294e-01f,
-    2.231796265e+00f,
-    6.070763618e-02f,
-    2.437582254e+00f,
-    8.761681914e-01f,
-    2.675330965e-03f,
-    2.469415069e-01f,
-    4.729799330e-01f,
-    2.942384481e-01f,
-    5.235548973e+00f,
-    4.270794868e+00f,
-    5.911920547e+00f,
-    3.914625049e-01f,
-    4.514711797e-01f,
-    2.714886069e-01f,
-    3.126261830e-01f,
-    2.798500657e-01f,
-    4.228058457e-01f,
-    2.239824831e-01f,
-    1.888440490e+00f,
-    1.082271671e+01f,
-    8.783619404e-01f,
-    2.316146851e+00f,
-    3.089933395e+00f,
-    1.692610025e+00f,
-    2.855640173e+00f,
-    3.285948277e+00f,
-    1.256205916e+00f,
-    1.045847225e+01f,
-    1.188855171e+00f,
-    9.522148967e-01f,
-    1.165885329e+00f,
-    7.945839167e-01f,
-    1.120168805e+00f,
-    6.362825036e-01f,
-    4.131135345e-01f,
-    2.904061377e-01f,
-    8.416733742e-01f,
-    8.465323448e-01f,
-    2.789757848e-01f,
-    3.252346814e-01f,
-    9.041588902e-01f,
-    6.699320078e-01f,
-    6.115791798e-01f,
-    3.331924677e+00f,
-    3.815600157e+00f,
-    4.619451523e+00f,
-    8.099175692e-01f,
-    5.530824065e-01f,
-    4.523977041e-01f,
-    1.628823042e+00f,
-    6.188165545e-01f,
-    7.094984055e-01f,
-    7.835115790e-01f,
-    7.426459312e+00f,
-    2.138588905e+00f,
-    2.065048218e+00f,
-    1.577190638e+00f,
-    3.393970966e+00f,
-    1.604538441e+00f,
-    8.673911095e-01f,
-    2.453044653e+00f,
-    1.937826157e+00f,
-    8.909590840e-01f,
-    2.622564554e+00f,
-    1.438744664e+00f,
-    2.151398182e+00f,
-    6.002890778e+01f,
-    5.532636642e+00f,
-    9.832288742e+00f,
-    4.740656853e+00f,
-    1.108554554e+01f,
-    9.657009125e+00f,
-    1.905035858e+02f,
-    7.726824760e+00f,
-    6.956153870e+01f,
-    1.084343910e+01f,
-    1.085162520e+00f,
-    7.307804823e-01f,
-    8.048431873e-01f,
-    8.724448681e-01f,
-    1.456137538e+00f,
-    9.916386604e-01f,
-    7.196877599e-01f,
-    1.240704346e+01f,
-    7.032862902e-01f,
-    1.675369501e+00f,
-    8.947240114e-01f,
-    3.554532826e-01f,
-    1.746547580e+00f,
-    7.765205503e-01f,
-    2.332670927e+00f,
-    1.289791226e+00f,
-    1.327249527e+00f,
-    3.013925791e+00f,
-    1.258512974e+00f,
-    1.262446284e+00f,
-    6.043388844e-01f,
-    8.353316188e-01f,
-    6.585616469e-01f,
-    9.078774452e-01f,
-    1.081675243e+01f,
-    2.159083366e+00f,
-    2.325317860e+00f,
-    1.652820826e+00f,
-    1.383495617e+01f,
-    4.226114750e+00f,
-    2.218611956e+00f,
-    3.703271866e+00f,
-    2.585796595e+00f,
-    3.255636692e+00f,
-    1.502598763e+00f,
-    9.527544379e-01f,
-    5.114109993e+00f,
-    9.931036234e-01f,
-    6.465329528e-01f,
-    1.335734725e+00f,
-    9.615924358e-01f,
-    3.699972153e+00f,
-    2.748576403e+00f,
-    1.309581757e+00f,
-    1.016769648e+00f,
-    9.289381504e-01f,
-    2.466581821e+00f,
-    1.219148159e+00f,
-    1.310913563e+00f,
-    1.054273129e+00f,
-    4.160806537e-01f,
-    7.641778588e-01f,
-    3.172399282e+00f,
-    3.403369188e+00f,
-    1.400033355e+00f,
-    1.366609931e+00f,
-    2.646821439e-01f,
-    4.343581498e-01f,
-    5.053091645e-01f,
-    1.639040947e+01f,
-    9.606174469e+00f,
-    1.608222961e+01f,
-    2.039383203e-01f,
-    4.150921404e-01f,
-    3.919551373e-01f,
-    3.143519759e-01f,
-    1.953691840e-01f,
-    2.760176957e-01f,
-    2.901538610e-01f,
-    7.244997978e+00f,
-    5.376467896e+01f,
-    1.578821850e+01f,
-    3.316743851e+00f,
-    6.752635479e+00f,
-    3.571011305e+00f,
-    1.476877499e+01f,
-    1.318947792e+01f,
-    8.809264183e+00f,
-    2.623406029e+01f,
-    1.648421884e+00f,
-    1.081002593e+00f,
-    1.659097672e+00f,
-    2.578138411e-01f,
-    4.100233912e-01f,
-    6.528133750e-01f,
-    2.807197869e-01f,
-    3.010073602e-01f,
-    5.723991394e-01f,
-    3.970777988e-01f,
-    4.867363870e-01f,
-    3.238328695e-01f,
-    2.178253412e+00f,
-    8.604912758e-01f,
-    6.187490821e-01f,
-    7.548189759e-01f,
-    9.906737208e-01f,
-    9.500688553e+00f,
-    1.399526882e+01f,
-    7.005544305e-01f,
-    9.028555155e-01f,
-    1.808144927e+00f,
-    9.369351864e-01f,
-    1.120224953e+00f,
-    5.591916442e-01f,
-    9.628583193e-01f,
-    3.006462574e+00f,
-    1.145094275e+00f,
-    1.550447464e+00f,
-    7.127641678e+00f,
-    1.480665565e+00f,
-    2.061711788e+00f,
-    2.668020010e+00f,
-    6.438769102e-01f,
-    3.221085072e+00f,
-    8.597135544e-01f,
-    8.994271159e-01f,
-    1.315535545e+00f,
-    4.153873920e+00f,
-    5.189230919e+00f,
-    1.627041340e+00f,
-    5.978363752e-01f,
-    1.245242596e+00f,
-    9.439312816e-01f,
-    8.937138915e-01f,
-    2.888760567e-01f,
-    5.620387197e-01f,
-    1.635505199e+00f,
-    6.393314600e-01f,
-    2.130528688e+00f,
-    6.919951439e-01f,
-    4.337924719e-01f,
-    1.606478691e-01f,
-    2.361217141e-01f,
-    1.233166382e-01f,
-    8.789338112e+00f,
-    1.319586784e-01f,
-    6.392868757e-01f,
-    4.517572820e-01f,
-    6.842911839e-01f,
-    9.524099529e-02f,
-    3.759529114e+00f,
-    2.246072143e-01f,
-    1.398774981e-01f,
-    2.103393078e-01f,
-    2.663469017e-01f,
-    1.044980735e-01f,
-    5.553179264e+00f,
-    3.046733737e-01f,
-    1.925538480e-01f,
-    2.447058260e-01f,
-    2.242275327e-01f,
-    3.747562170e-01f,
-    4.677831531e-01f,
-    3.039492369e-01f,
-    6.951833963e-01f,
-    5.926200151e-01f,
-    4.432398677e-01f,
-    2.258786559e-01f,
-    3.335040510e-01f,
-    7.099013776e-02f,
-    4.084965289e-01f,
-    2.258349657e-01f,
-    3.792080879e-01f,
-    7.242581844e-01f,
-    5.285742283e-01f,
-    2.270890772e-01f,
-    7.347737551e-01f,
-    2.760807574e-01f,
-    2.285156488e+00f,
-    1.459628820e+00f,
-    2.491623878e+00f,
-    1.152220607e+00f,
-    4.615153670e-01f,
-    1.185212493e+00f,
-    8.627050519e-01f,
-    6.101356030e+00f,
-    1.914198303e+01f,
-    2.131388664e+00f,
-    2.957752943e+00f,
-    1.947320557e+01f,
-    1.119469833e+01f,
-    2.972991943e+00f,
-    3.056956530e+00f,
-    2.220756054e+00f,
-    7.280218124e+00f,
-    3.857329559e+01f,
-    1.535855675e+01f,
-    5.841663361e+00f,
-    7.814741611e+00f,
-    2.068206787e+00f,
-    4.550275803e+00f,
-    7.582065582e+00f,
-    5.538563728e+00f,
-    3.965621233e+00f,
-    6.330329418e+00f,
-    9.135263443e+00f,
-    6.096783161e+00f,
-    2.509114981e+00f,
-    5.275408745e+00f,
-    8.980835915e+00f,
-    6.676488876e+00f,
-    9.624446630e-01f,
-    4.801923931e-01f,
-    4.277839661e-01f,
-    2.609466791e+00f,
-    1.397694111e+00f,
-    1.127413154e+00f,
-    1.244035721e+00f,
-    1.196584821e+00f,
-    1.125984788e+00f,
-    1.272340775e+00f,
-    1.203873038e+00f,
-    3.179326057e+00f,
-    9.127575159e-01f,
-    4.997030199e-01f,
-    9.766212106e-01f,
-    1.841301799e+00f,
-    2.828886986e+00f,
-    1.364321947e+00f,
-    3.562417030e+00f,
-    1.885474086e+00f,
-    2.064827204e+00f,
-    3.341753483e+00f,
-    3.040055037e+00f,
-    2.925626755e+00f,
-    2.314259052e+00f,
-    5.091184616e+00f,
-    5.736034393e+00f,
-    4.001072884e+00f,
-    1.725473046e+00f,
-    1.695006847e+00f,
-    2.463513851e+00f,
-    5.880836964e+00f,
-    2.986574471e-01f,
-    1.234487534e+01f,
-    1.511268765e-01f,
-    4.268088818e+00f,
-    1.456121349e+01f,
-    1.034429455e+01f,
-    1.010762310e+01f,
-    7.175804615e+00f,
-    1.420758438e+01f,
-    1.172352409e+01f,
-    1.059230566e-01f,
-    7.106617093e-02f,
-    2.108080685e-01f,
-    5.584775805e-01f,
-    4.561021551e-02f,
-    2.227544188e-01f,
-    1.221526337e+01f,
-    7.190045357e+00f,
-    8.734438896e+00f,
-    5.990507007e-01f,
-    1.225842386e-01f,
-    2.603809834e-01f,
-    1.361027807e-01f,
-    1.181470305e-01f,
-    6.328556538e-01f,
-    6.484533548e-01f,
-    2.394811064e-01f,
-    1.304211617e-01f,
-    2.338005155e-01f,
-    2.541409492e+00f,
-    2.196396291e-01f,
-    8.886125088e-01f,
-    8.836517930e-01f,
-    5.916918755e+00f,
-    2.811273932e-01f,
-    3.215820491e-01f,
-    5.882921815e-01f,
-    1.736301541e+00f,
-    6.597454548e-01f,
-    1.316588283e+00f,
-    1.172443986e+00f,
-    1.138144016e+00f,
-    1.497223854e+00f,
-    8.005340695e-01f,
-    1.691513062e+00f,
-    1.052018166e+00f,
-    6.658647060e+00f,
-    2.120131302e+01f,
-    1.407120132e+01f,
-    1.886529446e+00f,
-    6.972111464e-01f,
-    5.352486134e+00f,
-    4.627749634e+01f,
-    1.050027084e+01f,
-    1.181679487e+00f,
-    7.098628521e+00f,
-    5.272151470e+00f,
-    8.460315466e-01f,
-    1.014559031e+00f,
-    9.044724107e-01f,
-    3.427878141e+00f,
-    8.636153221e+00f,
-    1.090490627e+01f,
-    2.152130365e+00f,
-    2.543864250e-01f,
-    3.983634710e-01f,
-    3.706321716e-01f,
-    1.064120674e+01f,
-    2.316652870e+01f,
-    5.305311680e+00f,
-    1.026279926e+00f,
-    1.013483524e+00f,
-    2.002859306e+01f,
-    1.137516785e+01f,
-    1.260118484e+01f,
-    4.587417984e+01f,
-    3.078835869e+01f,
-    1.313492203e+01f,
-    7.569302320e-01f,
-    9.063811302e-01f,
-    2.162718534e+00f,
-    8.217490196e+00f,
-    9.858707428e+00f,
-    6.556862593e-01f,
-    4.373731911e-01f,
-    2.734278917e+00f,
-    1.581298828e+00f,
-    5.200408101e-01f,
-    5.051858425e-01f,
-    3.080977440e+00f,
-    7.935115337e+00f,
-    1.149277925e+00f,
-    1.283866644e+00f,
-    1.211444139e+00f,
-    3.746246576e+00f,
-    6.946326733e+00f,
-    3.587336540e+00f,
-    1.794334769e+00f,
-    6.446180940e-01f,
-    5.548461914e+00f,
-    3.084069729e+00f,
-    2.701498508e+00f,
-    3.414882183e+00f,
-    2.697520971e+00f,
-    2.475869894e+00f,
-    1.402011585e+01f,
-    2.185528040e+00f,
-    4.444822788e+00f,
-    3.776136637e-01f,
-    4.241498947e+00f,
-    1.391705513e+01f,
-    1.121269703e+01f,
-    5.272782326e+00f,
-    8.113305569e-01f,
-    5.817416906e-01f,
-    3.985461950e+00f,
-    2.999326706e+00f,
-    2.468432426e+00f,
-    1.100741029e+00f,
-    4.226872623e-01f,
-    4.165127754e+00f,
-    3.040673494e+00f,
-    3.298777342e+00f,
-    1.497522831e+00f,
-    1.758486509e+00f,
-    1.437238097e+00f,
-    5.056982994e+00f,
-    5.149052620e+00f,
-    7.136723995e-01f,
-    2.348197699e+00f,
-    7.839295864e-01f,
-    7.185242176e-01f,
-    7.091370583e+00f,
-    2.047457457e+00f,
-    3.161066771e+00f,
-    4.947012424e+00f,
-    1.192138386e+01f,
-    5.306198120e+00f,
-    6.744093418e+00f,
-    7.820437908e+00f,
-    3.182889223e+00f,
-    5.684284210e+00f,
-    3.750247002e+00f,
-    2.495332241e+00f,
-    6.038006544e-01f,
-    5.786533356e-01f,
-    1.120308208e+01f,
-    3.085448265e+00f,
-    1.200291348e+01f,
-    1.125172734e+00f,
-    4.444999695e-01f,
-    7.313913703e-01f,
-    2.276723862e+00f,
-    1.383211374e+00f,
-    4.349384904e-01f,
-    1.053298235e+00f,
-    7.176425934e+00f,
-    1.874527168e+01f,
-    1.018296432e+01f,
-    1.684305191e+00f,
-    9.829643369e-01f,
-    9.659768105e+00f,
-    6.249257565e+00f,
-    2.102227449e+00f,
-    1.987314224e+00f,
-    3.322571039e+00f,
-    7.249767780e+00f,
-    7.355587959e+00f,
-    5.866326094e-01f,
-    1.158320785e+00f,
-    2.313509941e+00f,
-    3.421034336e+00f,
-    9.806117415e-01f,
-    3.119672775e+00f,
-    5.297494411e+00f,
-    1.707352829e+01f,
-    1.112026024e+01f,
-    1.821318746e+00f,
-    9.179410338e-01f,
-    8.716133237e-01f,
-    1.172209501e+00f,
-    3.114488125e-01f,
-    8.898782730e+00f,
-    1.581392670e+01f,
-    1.141555190e+00f,
-    2.599960566e-01f,
-    1.676397133e+01f,
-    6.025024652e-01f,
-    3.468250930e-01f,
-    3.261394501e-01f,
-    1.000229168e+01f,
-    7.084059715e+00f,
-    5.848228335e-01f,
-    5.863042474e-01f,
-    5.947523713e-01f,
-    1.680873632e-01f,
-    8.932012558e+00f,
-    1.286102390e+01f,
-    5.615705490e+00f,
-    9.503223419e+00f,
-    3.284640610e-01f,
-    2.511657000e+00f,
-    7.638452530e+00f,
-    7.210997581e+00f,
-    5.901329994e+00f,
-    3.277487159e-01f,
-    4.328668118e-01f,
-    6.755224466e-01f,
-    1.852064878e-01f,
-    1.429945374e+01f,
-    4.810331345e+01f,
-    8.726584911e-02f,
-    2.271750069e+01f,
-    2.562071800e+01f,
-    4.165468216e+00f,
-    1.562061071e+00f,
-    7.912720442e-01f,
-    7.200732231e-01f,
-    6.764162183e-01f,
-    5.826439857e-01f,
-    1.870602036e+01f,
-    1.055790615e+01f,
-    3.905154228e+00f,
-    6.977200508e-01f,
-    1.829720497e+01f,
-    4.534429312e-01f,
-    1.445093918e+01f,
-    1.730778694e+01f,
-    1.516182899e+01f,
-    7.504645586e-01f,
-    4.178904593e-01f,
-    4.952718019e-01f,
-    1.868333220e-01f,
-    8.302294016e-01f,
-    9.012760967e-02f,
-    6.262494564e+00f,
-    1.273323727e+01f,
-    7.708738804e+00f,
-    9.612282753e+00f,
-    3.785809278e-01f,
-    1.323935032e+00f,
-    5.323253274e-01f,
-    3.513986468e-01f,
-    3.047049522e+00f,
-    3.681629181e+00f,
-    5.765901804e-01f,
-    1.139900804e+00f,
-    3.416983783e-01f,
-    3.226051092e+00f,
-    1.665487170e+00f,
-    3.084823787e-01f,
-    3.493458748e+00f,
-    4.391461372e+00f,
-    2.999760866e+00f,
-    3.685378551e+00f,
-    6.057888031e+00f,
-    9.484279156e-01f,
-    1.444304943e+00f,
-    8.608959913e-01f,
-    6.268237591e+00f,
-    6.054223537e+00f,
-    2.504735470e+00f,
-    4.561394453e-01f,
-    2.859291077e+00f,
-    1.583547711e+00f,
-    2.542320967e+00f,
-    5.188310742e-01f,
-    7.289808273e+00f,
-    1.056297684e+01f,
-    1.094840527e+00f,
-    6.010596752e+00f,
-    8.118658066e+00f,
-    9.110313416e+00f,
-    2.035247564e+00f,
-    2.363829374e+00f,
-    1.955419302e+00f,
-    4.674211502e+00f,
-    9.208033562e+00f,
-    3.066238880e+00f,
-    8.043273926e+00f,
-    2.740319490e+00f,
-    1.801449537e+00f,
-    1.106650233e+00f,
-    6.050511837e+00f,
-    5.657791138e+00f,
-    1.069663286e+00f,
-    1.064305210e+01f,
-    2.718393564e+00f,
-    7.095207691e+00f,
-    1.078141212e+01f,
-    1.158987808e+01f,
-    1.094271755e+01f,
-    1.327600479e+00f,
-    9.530876279e-01f,
-    6.566897631e-01f,
-    1.105419874e+00f,
-    2.896506786e-01f,
-    6.112729073e+00f,
-    1.191566563e+01f,
-    8.635780334e+00f,
-    1.003802776e+00f,
-    6.957971454e-01f,
-    2.716277599e+00f,
-    7.398862243e-01f,
-    2.852997184e-01f,
-    1.047877598e+01f,
-    2.862359428e+01f,
-    2.478888512e+01f,
-    2.149283171e+00f,
-    1.517265797e+00f,
-    6.833681464e-01f,
-    7.421738505e-01f,
-    2.603910208e+00f,
-    1.915202737e+00f,
-    3.101136684e+00f,
-    8.385069847e+00f,
-    3.019184589e+00f,
-    2.020227671e+00f,
-    2.709941149e+00f,
-    3.212696791e+00f,
-    2.407989025e+00f,
-    1.585656166e+00f,
-    5.271981716e+00f,
-    7.649558783e-01f,
-    5.673954487e+00f,
-    5.906713009e-01f,
-    2.610975981e+00f,
-    2.651184559e+00f,
-    5.068621635e+00f,
-    1.083216476e+01f,
-    2.494143963e+00f,
-    2.893958092e+00f,
-    2.001283646e+00f,
-    4.402863026e+00f,
-    2.521667242e+00f,
-    5.162975311e+00f,
-    2.010598898e+00f,
-    3.669760823e-01f,
-    1.184723854e+01f,
-    2.757490635e+00f,
-    1.163734531e+01f,
-    1.253744984e+01f,
-    1.698615646e+01f,
-    3.473409414e+00f,
-    3.331287861e+00f,
-    1.630330276e+01f,
-    7.239003658e+00f,
-    1.193099380e+00f,
-    1.506603527e+01f,
-    1.088297749e+01f,
-    4.394740760e-01f,
-    4.235844910e-01f,
-    1.020035893e-01f,
-    9.935759753e-02f,
-    2.358167022e-01f,
-    9.791061401e+00f,
-    5.987112045e+00f,
-    8.767724037e+00f,
-    4.582251012e-01f,
-    4.984102547e-01f,
-    1.456059265e+01f,
-    4.773833275e+00f,
-    1.334118176e+01f,
-    1.349210858e+00f,
-    2.343149424e+00f,
-    2.936527729e+00f,
-    3.447810709e-01f,
-    3.005097210e-01f,
-    1.954743576e+01f,
-    7.675214767e+00f,
-    1.014958763e+01f,
-    1.346984953e-01f,
-    1.002857018e+01f,
-    1.343022442e+01f,
-    2.498381615e+00f,
-    1.823544025e+00f,
-    8.445713520e-01f,
-    2.405773401e+00f,
-    1.735698819e+00f,
-    1.809152067e-01f,
-    1.766314888e+01f,
-    2.528284311e+00f,
-    5.190758057e+02f,
-    4.451072514e-01f,
-    1.923421502e+00f,
-    3.903079331e-01f,
-    1.724747062e+00f,
-    6.706199050e-01f,
-    8.138186455e+00f,
-    1.117925262e+01f,
-    1.052632427e+01f,
-    4.053289592e-01f,
-    1.522798538e+00f,
-    1.112975717e+00f,
-    2.072071582e-01f,
-    1.398516536e+00f,
-    6.133769512e+00f,
-    7.133406830e+01f,
-    1.416221380e+00f,
-    1.096074343e+00f,
-    8.314677477e-01f,
-    3.626773682e+02f,
-    1.260873199e+00f,
-    6.266891956e-01f,
-    2.190986633e+00f,
-    1.463572621e+00f,
-    1.215748072e+00f,
-    1.569241762e+00f,
-    1.732720256e+00f,
-    3.546758175e+00f,
-    6.486225605e+00f,
-    6.916021824e+00f,
-    2.883042336e+00f,
-    5.600152016e-01f,
-    6.463567615e-01f,
-    5.684200525e-01f,
-    8.059013486e-01f,
-    9.061803818e-01f,
-    1.272837281e+00f,
-    2.283454895e+00f,
-    8.918683529e-01f,
-    4.963501096e-01f,
-    1.040787816e+00f,
-    3.859470129e+00f,
-    6.041201591e+00f,
-    8.887068629e-01f,
-    9.711102843e-01f,
-    1.994788170e+00f,
-    4.326924324e+00f,
-    1.453985214e+00f,
-    9.071375132e-01f,
-    1.420276284e+00f,
-    1.543049455e+00f,
-    2.449326038e+00f,
-    1.347281814e+00f,
-    1.215010285e+00f,
-    1.367305875e+00f,
-    2.205880642e+00f,
-    1.974600911e+00f,
-    1.145875573e+00f,
-    2.460955858e+00f,
-    9.648237824e-01f,
-    1.077513576e+00f,
-    1.601103210e+01f,
-    2.546114683e+00f,
-    1.942916155e+00f,
-    1.380464554e+00f,
-    4.526804447e+00f,
-    2.677938938e+00f,
-    1.494505763e+00f,
-    1.516099334e+00f,
-    9.594701529e-01f,
-    1.256594062e+00f,
-    8.403902650e-01f,
-    4.980772138e-01f,
-    6.925292611e-01f,
-    4.067716897e-01f,
-    2.472162485e+00f,
-    7.514315844e-01f,
-    7.391993999e-01f,
-    6.052552462e-01f,
-    2.428523898e-01f,
-    6.704219580e-01f,
-    5.739883184e-01f,
-    5.834268332e-01f,
-    3.728212714e-01f,
-    6.008811593e-01f,
-    3.374734163e+00f,
-    5.167917252e+00f,
-    1.075892067e+01f,
-    1.145116234e+01f,
-    3.226627731e+01f,
-    2.308636904e+00f,
-    6.156093597e+00f,
-    1.618432236e+01f,
-    8.348222733e+00f,
-    1.317320538e+01f,
-    2.855913877e+00f,
-    1.464272308e+01f,
-    7.550815582e+00f,
-    5.251607895e-01f,
-    3.379092515e-01f,
-    4.630877972e-01f,
-    1.112498164e+00f,
-    5.357859731e-01f,
-    3.932623267e-01f,
-    4.778597653e-01f,
-    5.561270118e-01f,
-    3.670795262e-01f,
-    6.094607115e-01f,
-    3.716536462e-01f,
-    7.030389905e-01f,
-    8.198101521e-01f,
-    8.013395667e-01f,
-    2.058628649e-01f,
-    1.306819320e+00f,
-    1.218810797e+00f,
-    8.564010859e-01f,
-    5.811273456e-01f,
-    5.337722898e-01f,
-    1.512446523e+00f,
-    1.644693375e+00f,
-    2.362359047e+00f,
-    7.273693085e-01f,
-    7.495232821e-01f,
-    8.159416914e-01f,
-    1.371550179e+01f,
-    1.032897472e+01f,
-    2.103614330e+00f,
-    6.763741970e+00f,
-    7.227440834e+00f,
-    3.954590082e+00f,
-    3.734337568e+00f,
-    2.655489683e+00f,
-    2.646934986e+00f,
-    2.890695810e+00f,
-    1.123604298e+01f,
-    9.023275375e+00f,
-    2.240417719e+00f,
-    1.764556766e+00f,
-    2.440009594e+00f,
-    3.290380001e+00f,
-    2.590388775e+00f,
-    6.300355911e+00f,
-    1.732473373e+00f,
-    2.071629524e+00f,
-    6.438261509e+00f,
-    6.368000984e+00f,
-    2.088155031e+00f,
-    9.901111126e-01f,
-    3.561280489e+00f,
-    4.095073223e+00f,
-    3.928856850e+00f,
-    6.300803185e+00f,
-    4.888885975e+00f,
-    6.521724224e+00f,
-    6.979810715e+00f,
-    5.174018860e+00f,
-    3.662445068e+00f,
-    6.586869240e+00f,
-    1.199994278e+01f,
-    6.641728878e+00f,
-    2.272887468e+00f,
-    3.836744308e+00f,
-    4.182798386e+00f,
-    4.911562800e-01f,
-    4.290723503e-01f,
-    1.634238601e+00f,
-    2.165490627e+00f,
-    7.303793430e-01f,
-    6.954679489e-01f,
-    6.633321047e-01f,
-    1.571033120e+00f,
-    6.265370250e-01f,
-    6.690472364e-01f,
-    9.503756166e-01f,
-    8.102561831e-01f,
-    1.327914119e+00f,
-    2.179301739e+00f,
-    2.645269156e+00f,
-    1.320740342e+00f,
-    1.484817505e+00f,
-    1.573981762e+00f,
-    2.896510839e+00f,
-    1.923264027e+00f,
-    2.058134079e+00f,
-    3.502975464e+00f,
-    1.504825950e+00f,
-    1.267801046e+00f,
-    1.291934013e+00f,
-    1.514795303e+00f,
-    1.636968851e+00f,
-    1.266273260e+00f,
-    1.182946444e+00f,
-    7.208658457e-01f,
-    3.518765271e-01f,
-    5.683614254e+00f,
-    2.644084930e+00f,
-    6.007648945e+00f,
-    9.208509326e-01f,
-    2.532737553e-01f,
-    9.781497121e-01f,
-    6.630915403e-01f,
-    7.735913992e-01f,
-    4.408565760e-01f,
-    4.702051878e-01f,
-    5.779137611e-01f,
-    1.287182808e+00f,
-    3.915102184e-01f,
-    3.228744566e-01f,
-    4.542172849e-01f,
-    7.196863890e-01f,
-    4.875423908e-01f,
-    7.821283340e-01f,
-    5.591884851e-01f,
-    8.648322821e-01f,
-    8.024594188e-01f,
-    1.160454369e+01f,
-    2.122933388e+00f,
-    1.575247669e+01f,
-    8.852169991e+00f,
-    1.494628525e+01f,
-    1.249375248e+01f,
-    2.055933189e+01f,
-    9.885245323e+00f,
-    4.436612606e+00f,
-    1.793571663e+01f,
-    5.201409340e+00f,
-    9.192661285e+00f,
-    8.376781464e+00f,
-    9.782131910e-01f,
-    6.821566224e-01f,
-    4.576680660e-01f,
-    5.521767735e-01f,
-    1.839397699e-01f,
-    1.078778934e+01f,
-    7.764192104e+00f,
-    5.504815102e+00f,
-    6.666602492e-01f,
-    4.110521972e-01f,
-    5.750362873e-01f,
-    8.207991719e-01f,
-    7.697037458e-01f,
-    2.361722469e+00f,
-    5.045376778e+00f,
-    1.352579021e+01f,
-    2.173968124e+01f,
-    1.585706520e+01f,
-    4.160311699e+00f,
-    4.695425034e+00f,
-    4.037693024e+00f,
-    9.476929665e+00f,
-    3.885082006e+00f,
-    3.676920652e+00f,
-    1.107006550e+01f,
-    4.998841763e+00f,
-    4.110092819e-01f,
-    2.061934918e-01f,
-    7.433723211e-01f,
-    9.116289616e-01f,
-    4.701862633e-01f,
-    4.261648357e-01f,
-    3.510258198e-01f,
-    6.954679489e-01f,
-    6.369923353e-01f,
-    5.636865497e-01f,
-    8.925905824e-01f,
-    3.620399237e-01f,
-    5.075414777e-01f,
-    9.654454589e-01f,
-    3.503765464e-01f,
-    2.447666645e+00f,
-    8.977208138e-01f,
-    8.508197665e-01f,
-    1.294934988e+00f,
-    3.978508115e-01f,
-    3.901909590e+00f,
-    2.027729511e+00f,
-    1.370375156e+00f,
-    7.307455540e-01f,
-    1.437783837e+00f,
-    2.242332935e+00f,
-    6.639408588e+00f,
-    8.693492889e+00f,
-    1.434898853e+00f,
-    1.533207655e+00f,
-    1.985717773e+00f,
-    4.608373165e+00f,
-    3.469344854e+00f,
-    3.377554655e+00f,
-    2.795786858e+00f,
-    3.235920429e+00f,
-    5.839738369e+00f,
-    1.219168186e+01f,
-    2.167187929e+00f,
-    5.309250951e-01f,
-    3.740806580e-01f,
-    2.295944214e+00f,
-    1.715642452e+00f,
-    7.114387155e-01f,
-    2.292225599e+00f,
-    5.435168147e-01f,
-    1.261631131e+00f,
-    9.701828957e-01f,
-    5.442035198e-01f,
-    1.654109836e+00f,
-    8.512935638e-01f,
-    8.189091682e-01f,
-    3.396145821e+00f,
-    9.931974030e+01f,
-    2.883162260e+00f,
-    2.665861130e+00f,
-    4.255747199e-01f,
-    1.195983291e+00f,
-    8.423729897e+00f,
-    8.091370583e+00f,
-    1.534876823e+01f,
-    2.060794592e+00f,
-    7.234886932e+01f,
-    9.279328346e+00f,
-    7.054384947e-01f,
-    4.084967375e-01f,
-    8.603149056e-01f,
-    5.789930820e+00f,
-    4.003024101e+00f,
-    4.963306904e+00f,
-    6.242186546e+00f,
-    1.866697502e+01f,
-    3.117242622e+01f,
-    8.984810829e+00f,
-    5.404444218e+00f,
-    8.829022408e+00f,
-    2.629846811e+00f,
-    5.160783291e+00f,
-    5.071413994e+00f,
-    1.323435211e+01f,
-    1.319844913e+01f,
-    6.746903896e+00f,
-    5.976847649e+00f,
-    2.606744766e+01f,
-    5.048633099e+00f,
-    2.249867439e+00f,
-    5.558595061e-01f,
-    6.616199613e-01f,
-    4.010571003e+00f,
-    4.708868504e+00f,
-    2.347236824e+01f,
-    3.407650709e+00f,
-    6.939917088e+00f,
-    6.728194714e+00f,
-    6.469517350e-01f,
-    5.178868175e-01f,
-    9.264752865e-01f,
-    4.525310516e+00f,
-    5.104870796e+00f,
-    2.299462080e+00f,
-    1.051192880e+00f,
-    3.678242862e-01f,
-    7.697860003e-01f,
-    5.389599323e+00f,
-    2.696430683e+00f,
-    1.468811035e+00f,
-    3.360167444e-01f,
-    5.988721848e-01f,
-    3.407135308e-01f,
-    2.663792610e+00f,
-    1.331892371e+00f,
-    4.876002312e+00f,
-    3.741194487e+00f,
-    7.811915874e+00f,
-    7.152540684e+00f,
-    3.767075062e+00f,
-    3.157022238e+00f,
-    5.129204273e+00f,
-    2.977603912e+00f,
-    7.151071072e+00f,
-    4.444467068e+00f,
-    8.199694633e+00f,
-    4.263737679e+00f,
-    1.939500451e+00f,
-    1.543053865e+00f,
-    3.729364395e+00f,
-    4.694677353e+00f,
-    3.331949711e+00f,
-    2.080854416e+00f,
-    1.093353748e+00f,
-    5.584329605e+00f,
-    4.023951054e+00f,
-    5.553050995e+00f,
-    2.412824869e+00f,
-    1.085000634e+00f,
-    1.479782581e+00f,
-    7.553365231e-01f,
-    1.731032610e+00f,
-    1.351883173e+00f,
-    2.975329638e+00f,
-    1.521307707e+00f,
-    2.370197058e+00f,
-    5.232839108e+00f,
-    5.539726257e+00f,
-    6.117909908e+00f,
-    1.496731877e+00f,
-    1.148932076e+01f,
-    1.657713699e+01f,
-    3.098595619e+00f,
-    1.942815304e+00f,
-    3.202135324e+00f,
-    4.015533447e+00f,
-    5.092122555e+00f,
-    3.339472294e+00f,
-    4.651717663e+00f,
-    8.953446388e+00f,
-    6.969941616e+00f,
-    7.698304653e+00f,
-    4.938410282e+00f,
-    5.806651115e+00f,
-    7.346178889e-01f,
-    8.001326919e-01f,
-    8.401811123e-01f,
-    4.059106350e+00f,
-    2.997010708e+00f,
-    3.543985605e+00f,
-    5.747026205e-01f,
-    4.110866189e-01f,
-    4.688102901e-01f,
-    1.586932182e+00f,
-    2.554964781e+00f,
-    4.133597851e+00f,
-    2.333951950e+00f,
-    1.381891251e+00f,
-    1.796015859e+00f,
-    1.455289245e+00f,
-    1.930653453e+00f,
-    2.001379251e+00f,
-    2.784997940e+00f,
-    1.907433391e+00f,
-    2.260136366e+00f,
-    9.130965471e-01f,
-    1.226567507e+00f,
-    5.929626226e-01f,
-    3.403653145e+00f,
-    1.588096023e+00f,
-    1.153440356e+00f,
-    1.478929043e+00f,
-    6.966643929e-01f,
-    1.343197823e+00f,
-    5.078920364e+00f,
-    3.941950798e+00f,
-    8.715794563e+00f,
-    2.479509354e+00f,
-    9.628944397e-01f,
-    6.592921019e-01f,
-    1.715255857e+00f,
-    8.792997360e+00f,
-    2.831418037e+00f,
-    1.473305941e+00f,
-    7.072540522e-01f,
-    7.645476460e-01f,
-    2.629944086e+00f,
-    1.425216007e+01f,
-    8.977104187e+00f,
-    1.962420940e+00f,
-    3.510176539e-01f,
-    9.494929314e-01f,
-    7.991190910e+00f,
-    6.510411263e+00f,
-    2.197547340e+01f,
-    3.527567148e+00f,
-    8.062650681e+00f,
-    6.265226841e+00f,
-    9.471948147e-01f,
-    3.237781823e-01f,
-    8.572539687e-01f,
-    4.397089958e+00f,
-    8.582206726e+00f,
-    9.479571342e+00f,
-    8.765740395e+00f,
-    5.832348347e+00f,
-    1.212369442e+01f,
-    7.007599831e+00f,
-    7.593457222e+00f,
-    1.253255463e+01f,
-    1.285207868e+00f,
-    7.025262833e+00f,
-    6.207356453e+00f,
-    4.662616253e+00f,
-    7.739685059e+00f,
-    1.085903931e+01f,
-    2.399787664e+00f,
-    8.039569855e-01f,
-    1.019363165e+00f,
-    6.584296703e+00f,
-    5.536960602e+00f,
-    6.659190178e+00f,
-    1.587752819e+00f,
-    1.547829628e+00f,
-    5.503914356e-01f,
-    3.307320118e+00f,
-    4.550688267e+00f,
-    1.596969008e+00f,
-    7.747484446e-01f,
-    8.702547550e-01f,
-    5.331497788e-01f,
-    4.037790298e-01f,
-    1.892644405e+00f,
-    3.542205334e+00f,
-    7.139254570e+00f,
-    2.188494110e+01f,
-    8.640152740e+01f,
-    2.389630795e+00f,
-    2.876302958e+00f,
-    4.305036545e+00f,
-    1.255167603e+00f,
-    2.442895174e+00f,
-    2.635569811e+00f,
-    1.365917015e+01f,
-    5.971912384e+00f,
-    6.996303082e+00f,
-    6.978827953e+00f,
-    1.146127701e+01f,
-    8.635951042e+00f,
-    1.493565202e+00f,
-    3.754375875e-01f,
-    1.435704827e+00f,
-    6.452633858e+00f,
-    7.553339958e+00f,
-    1.605830383e+01f,
-    2.512524843e+00f,
-    9.110000610e+00f,
-    3.005054474e+00f,
-    8.281424642e-01f,
-    8.864552379e-01f,
-    8.075476289e-01f,
-    3.954048157e+00f,
-    3.752823830e+00f,
-    2.205691576e+00f,
-    1.243721485e+00f,
-    7.070246935e-01f,
-    7.665265799e-01f,
-    8.798003197e+00f,
-    1.956516385e+00f,
-    1.553880334e+00f,
-    4.202584922e-01f,
-    6.168556809e-01f,
-    3.410952985e-01f,
-    4.797030449e+00f,
-    1.444227576e+00f,
-    3.211280823e+00f,
-    1.615222335e+00f,
-    7.553716183e+00f,
-    5.671585560e+00f,
-    3.957976103e+00f,
-    1.447744489e+00f,
-    4.008195877e+00f,
-    1.100787997e+00f,
-    6.792218208e+00f,
-    2.029747248e+00f,
-    6.541983128e+00f,
-    1.003244209e+01f,
-    1.347702265e+00f,
-    2.474850655e+00f,
-    2.495455980e+00f,
-    4.121325016e+00f,
-    5.720527172e+00f,
-    4.118820190e+00f,
-    7.115545750e+00f,
-    8.612149358e-01f,
-    1.367263556e+00f,
-    1.308259368e+00f,
-    4.417138577e+00f,
-    1.768392205e+00f,
-    2.517401934e+00f,
-    7.687674761e-01f,
-    7.815966606e-01f,
-    4.682004452e-01f,
-    9.281538963e+00f,
-    2.105412245e+00f,
-    4.147042274e+00f,
-    8.730508804e+00f,
-    4.100874710e+01f,
-    1.252770901e+01f,
-    1.267138004e+00f,
-    7.640354633e-01f,
-    8.012631536e-01f,
-    5.516552925e-01f,
-    4.342976809e-01f,
-    1.550475597e+01f,
-    9.681856155e+00f,
-    1.526237869e+01f,
-    1.524275661e+00f,
-    8.002980351e-01f,
-    5.305833817e-01f,
-    5.495034218e+00f,
-    7.750694275e+00f,
-    1.648823547e+01f,
-    8.202849030e-01f,
-    3.900608420e-01f,
-    1.010799527e+00f,
-    3.099299073e-01f,
-    3.950815201e-01f,
-    5.750336647e-01f,
-    3.380857229e+00f,
-    1.022819233e+01f,
-    3.878042221e+00f,
-    1.523782921e+01f,
-    9.477399826e+00f,
-    1.805272293e+01f,
-    7.867113590e+00f,
-    5.192407608e+01f,
-    1.727149725e+00f,
-    6.081097603e+00f,
-    8.176214218e+00f,
-    2.492035866e+00f,
-    1.675320625e+01f,
-    3.650908232e+00f,
-    7.442758083e+00f,
-    6.397398949e+00f,
-    2.409938049e+01f,
-    3.650165176e+01f,
-    1.573612118e+01f,
-    1.953971100e+01f,
-    6.695243073e+01f,
-    1.570912457e+01f,
-    2.631608200e+01f,
-    2.345835495e+01f,
-    9.886794090e+00f,
-    9.931366444e-01f,
-    1.065324306e+00f,
-    9.256507754e-01f,
-    1.726566106e-01f,
-    2.991356850e-01f,
-    1.821017265e+01f,
-    1.666638184e+01f,
-    8.435157776e+00f,
-    5.409562588e-01f,
-    1.674872637e+00f,
-    3.951573372e-01f,
-    1.004933167e+01f,
-    7.360035896e+00f,
-    1.498240471e+01f,
-    5.555076599e-01f,
-    4.456765354e-01f,
-    5.333161354e-01f,
-    3.508128822e-01f,
-    4.254385531e-01f,
-    2.870170474e-01f,
-    1.468915844e+01f,
-    8.147905350e+00f,
-    1.000404263e+01f,
-    1.655280709e+00f,
-    9.491652846e-01f,
-    4.973578155e-01f,
-    1.051543474e+00f,
-    6.033619046e-01f,
-    1.093483925e+01f,
-    3.780494213e+00f,
-    6.513134956e+00f,
-    6.977630258e-01f,
-    9.146678448e-01f,
-    5.398059487e-01f,
-    8.013639450e-01f,
-    3.860982060e-01f,
-    5.938690662e+00f,
-    3.290002823e+00f,
-    9.723025322e+00f,
-    6.211783290e-01f,
-    8.122510910e-01f,
-    5.464118123e-01f,
-    1.304797053e+00f,
-    1.994639277e+00f,
-    2.341727018e+00f,
-    4.288727760e+00f,
-    8.454145432e+00f,
-    1.294724560e+01f,
-    3.897255182e+00f,
-    2.728220224e+00f,
-    6.113980293e+00f,
-    2.332862139e+00f,
-    5.281496525e+00f,
-    5.693615437e+00f,
-    2.538101912e+00f,
-    5.759681225e+00f,
-    4.958279133e+00f,
-    3.309197903e+00f,
-    2.003218412e+00f,
-    1.927311301e+00f,
-    5.391125202e+00f,
-    1.305187464e+00f,
-    3.129328251e+00f,
-    1.125989151e+01f,
-    1.125388813e+01f,
-    2.020651102e+00f,
-    6.427566409e-01f,
-    9.780130386e+00f,
-    2.156798840e+00f,
-    3.600311995e+00f,
-    1.172087193e+00f,
-    9.870002270e-01f,
-    1.056982160e+00f,
-    1.104115486e+00f,
-    1.559573054e+00f,
-    7.459940314e-01f,
-    4.654600322e-01f,
-    1.525141954e+00f,
-    1.423950195e+00f,
-    6.836236119e-01f,
-    6.936283588e+00f,
-    1.022910976e+01f,
-    3.456217051e+00f,
-    4.756545126e-01f,
-    3.117953062e+00f,
-    2.424283504e+00f,
-    1.069193125e+00f,
-    3.789599180e+00f,
-    1.472952604e+00f,
-    6.678380013e+00f,
-    2.159121037e+00f,
-    6.668210983e+00f,
-    4.722460747e+00f,
-    5.851408482e+00f,
-    2.037548637e+01f,
-    2.557224035e+00f,
-    1.632908344e+00f,
-    3.903340578e+00f,
-    6.276802063e+00f,
-    3.285960436e+00f,
-    1.430720806e+01f,
-    2.665663004e+00f,
-    1.937438369e+00f,
-    4.124442101e+00f,
-    2.516322136e+00f,
-    1.359316254e+01f,
-    3.273169756e+00f,
-    4.499525070e+00f,
-    1.921546555e+01f,
-    1.319687557e+01f,
-    1.432549381e+01f,
-    1.903592873e+01f,
-    1.441191864e+01f,
-    5.916340947e-01f,
-    9.603537321e-01f,
-    4.959208667e-01f,
-    8.649237752e-01f,
-    5.689964294e-01f,
-    9.872253418e+00f,
-    8.584844589e+00f,
-    8.058599472e+00f,
-    8.119055629e-01f,
-    9.322856665e-01f,
-    1.063634038e+00f,
-    6.383927464e-01f,
-    4.436317682e-01f,
-    5.746407986e+00f,
-    1.629670143e+01f,
-    1.152760506e+01f,
-    6.243818402e-01f,
-    2.354429245e+00f,
-    9.694955349e-01f,
-    7.305533290e-01f,
-    2.051581621e+00f,
-    2.192707539e+00f,
-    2.689538002e+00f,
-    3.162057877e+00f,
-    1.499289513e+00f,
-    2.099500895e+00f,
-    1.215766668e+00f,
-    2.744037867e+00f,
-    1.505914450e+00f,
-    5.063377857e+00f,
-    7.212538123e-01f,
-    7.371140718e-01f,
-    1.243459582e+00f,
-    7.580706477e-01f,
-    1.169157863e+00f,
-    2.259053707e+00f,
-    4.837189198e+00f,
-    6.453275204e+00f,
-    6.062036157e-01f,
-    7.646542788e-01f,
-    1.316921234e+00f,
-    9.735002518e-01f,
-    2.309159040e+00f,
-    1.753614068e+00f,
-    9.630418420e-01f,
-    1.393181086e+00f,
-    3.466462851e+00f,
-    4.512652397e+00f,
-    3.344068289e+00f,
-    7.948886871e+00f,
-    1.324972987e+00f,
-    7.851372361e-01f,
-    1.658746004e+00f,
-    6.735465527e+00f,
-    9.540351868e+00f,
-    4.144207954e+00f,
-    7.176439762e+00f,
-    1.236164570e+01f,
-    1.651311398e+00f,
-    1.194761395e+00f,
-    1.257236481e+00f,
-    1.180094123e+00f,
-    1.972402573e+01f,
-    1.756918550e+00f,
-    4.393734932e+00f,
-    7.193571568e+00f,
-    1.205338478e+01f,
-    1.636800528e+00f,
-    8.419450521e-01f,
-    3.609891832e-01f,
-    3.513237536e-01f,
-    3.169427514e-01f,
-    1.864910507e+01f,
-    1.386568260e+01f,
-    5.447683334e+00f,
-    7.092258930e-01f,
-    5.976966619e-01f,
-    2.613904476e-01f,
-    2.756425858e+00f,
-    2.964755535e+00f,
-    3.984476805e+00f,
-    1.514075994e+00f,
-    4.372003078e-01f,
-    3.438418508e-01f,
-    5.133680105e-01f,
-    2.717155218e-01f,
-    7.885515094e-01f,
-    7.806241035e+00f,
-    6.285736084e+00f,
-    1.483807850e+01f,
-    5.774365902e+00f,
-    8.441758156e+00f,
-    1.127227402e+01f,
-    6.069839001e+00f,
-    8.263609886e+00f,
-    7.009006977e+00f,
-    7.534199238e+00f,
-    1.163844681e+01f,
-    1.405128384e+01f,
-    5.855317116e+00f,
-    3.563463974e+01f,
-    3.652411461e+00f,
-    6.775884151e+00f,
-    3.573613644e+00f,
-    8.733046532e+00f,
-    1.392895222e+01f,
-    7.749216080e+00f,
-    1.406471729e+01f,
-    2.331420517e+01f,
-    5.061773300e+00f,
-    1.723610520e+00f,
-    9.887615442e-01f,
-    9.872555137e-01f,
-    6.261985898e-01f,
-    3.802867830e-01f,
-    5.749648571e+00f,
-    3.585902452e+00f,
-    4.809733868e+00f,
-    1.646976352e+00f,
-    1.403723121e+00f,
-    1.390456200e+00f,
-    2.739921093e+00f,
-    3.899883509e+00f,
-    6.900800228e+00f,
-    4.732562065e+00f,
-    3.534426928e+00f,
-    1.357084632e+00f,
-    8.505651355e-01f,
-    2.578372955e+00f,
-    4.611580074e-01f,
-    1.367997646e+00f,
-    7.930603623e-01f,
-    3.476126194e+00f,
-    6.070841312e+00f,
-    1.299963665e+01f,
-    1.863710022e+01f,
-    2.723004150e+01f,
-    8.525664330e+00f,
-    4.588136196e+00f,
-    2.257014275e+01f,
-    2.139639139e+00f,
-    3.594703913e+00f,
-    5.508778572e+00f,
-    3.465330839e+00f,
-    7.695021629e+00f,
-    1.536463261e+00f,
-    1.981188893e+00f,
-    4.115478516e+00f,
-    1.107770061e+01f,
-    1.291243267e+01f,
-    2.182992220e+00f,
-    4.705987453e+00f,
-    1.238721657e+01f,
-    1.002915573e+01f,
-    6.339942455e+00f,
-    1.143817711e+01f,
-    7.223467350e+00f,
-    6.986488104e-01f,
-    6.774547100e-01f,
-    1.456551552e+00f,
-    2.642419338e-01f,
-    8.703472614e-01f,
-    8.782737732e+00f,
-    1.659897995e+01f,
-    6.133073807e+00f,
-    2.045900077e-01f,
-    1.664164734e+01f,
-    3.714942634e-01f,
-    2.656905174e+00f,
-    3.150727272e+00f,
-    4.524705410e+00f,
-    8.478813767e-01f,
-    4.953849018e-01f,
-    6.689909101e-01f,
-    7.688946128e-01f,
-    6.250662208e-01f,
-    6.874673367e-01f,
-    1.212499237e+01f,
-    8.170998573e+00f,
-    1.671637154e+01f,
-    4.993812144e-01f,
-    9.847798944e-01f,
-    1.424417138e+00f,
-    3.764167428e-01f,
-    4.119974077e-01f,
-    1.250576019e+01f,
-    8.719125748e+00f,
-    4.222042847e+01f,
-    1.372315645e+00f,
-    7.672855854e-01f,
-    8.576413393e-01f,
-    3.331131041e-01f,
-    3.736018836e-01f,
-    1.044053936e+01f,
-    6.183913708e+00f,
-    2.515477753e+01f,
-    6.514340639e-01f,
-    1.459348321e+00f,
-    4.577929676e-01f,
-    4.417758584e-01f,
-    1.057639837e+00f,
-    3.066755772e+00f,
-    2.600979090e+00f,
-    2.659007788e+00f,
-    2.604404211e+00f,
-    1.786820650e+00f,
-    2.220326185e+00f,
-    3.575410604e+00f,
-    1.313560486e+00f,
-    5.460739136e+00f,
-    8.418641686e-01f,
-    8.491499424e-01f,
-    2.658889294e+00f,
-    4.604032040e+00f,
-    2.255168915e+00f,
-    8.487252235e+00f,
-    1.985493779e+00f,
-    2.869687557e+00f,
-    1.088763475e+00f,
-    3.691831112e+00f,
-    7.021431446e+00f,
-    5.371872902e+00f,
-    5.580615520e+00f,
-    8.785954475e+00f,
-    9.610564232e+00f,
-    5.784300566e-01f,
-    8.198158741e-01f,
-    1.419610739e+00f,
-    1.200975418e+00f,
-    6.431984901e-01f,
-    1.514066410e+01f,
-    1.521344948e+01f,
-    3.311453629e+01f,
-    7.057551742e-01f,
-    5.400910378e-01f,
-    2.182547569e+00f,
-    1.045870423e+00f,
-    2.863021791e-01f,
-    6.447705746e+00f,
-    8.524259949e+01f,
-    4.851630020e+01f,
-    9.074057341e-01f,
-    1.657799482e+00f,
-    9.004079700e-01f,
-    7.751242518e-01f,
-    8.093949556e-01f,
-    6.222482324e-01f,
-    1.173202395e+00f,
-    7.157742381e-01f,
-    6.527312398e-01f,
-    3.246025085e+00f,
-    6.443958759e+00f,
-    4.752622128e+00f,
-    2.671561956e+00f,
-    3.053690195e-01f,
-    1.553005934e+00f,
-    7.423536777e-01f,
-    7.138376832e-01f,
-    1.157083511e+00f,
-    5.749507904e+00f,
-    5.581016541e-01f,
-    1.250811934e+00f,
-    4.100471735e-01f,
-    6.605906487e-01f,
-    1.111587167e+00f,
-    8.980114460e-01f,
-    2.560635567e+00f,
-    5.726647377e-01f,
-    9.239019156e-01f,
-    1.514529109e+00f,
-    4.198437691e+00f,
-    5.519802570e+00f,
-    2.057419062e+00f,
-    1.390150666e+00f,
-    8.818881989e+00f,
-    8.362963200e-01f,
-    1.689170837e+00f,
-    2.389200449e+00f,
-    3.456543446e+00f,
-    2.149854898e+00f,
-    1.413921595e+00f,
-    1.023865342e+00f,
-    1.463452458e+00f,
-    6.719478607e+00f,
-    6.801029444e-01f,
-    2.173714399e+00f,
-    1.038373351e+00f,
-    8.171240687e-01f,
-    1.634059668e+00f,
-    1.433146715e+00f,
-    9.193453789e-01f,
-    2.734026670e+00f,
-    1.507102251e+00f,
-    3.113604784e+00f,
-    7.516876459e-01f,
-    1.389108777e+00f,
-    2.002302170e+00f,
-    1.576151729e+00f,
-    6.499905586e-01f,
-    1.218547940e+00f,
-    2.088700294e+01f,
-    2.613175154e+00f,
-    2.207014322e+00f,
-    1.294131637e+00f,
-    3.643509626e+00f,
-    2.965117931e+00f,
-    8.587059975e+00f,
-    2.743356228e+00f,
-    7.454250455e-01f,
-    6.422234774e-01f,
-    1.012405992e+00f,
-    1.412008524e+00f,
-    8.426213861e-01f,
-    4.784998000e-01f,
-    5.922939777e-01f,
-    8.827654123e-01f,
-    1.054955006e+00f,
-    2.190033674e+00f,
-    6.760061979e-01f,
-    2.896692753e-01f,
-    4.174436033e-01f,
-    8.588498235e-01f,
-    1.112059116e+00f,
-    6.336292028e-01f,
-    5.112952590e-01f,
-    5.022803545e-01f,
-    6.476973891e-01f,
-    7.381196618e-01f,
-    4.411031306e-01f,
-    3.287726343e-01f,
-    5.230369568e-01f,
-    5.003557801e-01f,
-    4.232552528e+00f,
-    3.556713104e+00f,
-    8.958752632e+00f,
-    1.697372437e+01f,
-    1.142775345e+01f,
-    4.298993111e+00f,
-    6.291963100e+00f,
-    1.317614460e+01f,
-    1.273612499e+01f,
-    7.145175457e+00f,
-    5.025600910e+00f,
-    8.863813400e+00f,
-    1.490368748e+01f,
-    2.315630168e-01f,
-    1.329852790e-01f,
-    2.027524412e-01f,
-    7.678073049e-01f,
-    3.824545443e-01f,
-    3.225588799e-01f,
-    2.522096038e-01f,
-    2.201972753e-01f,
-    2.995558679e-01f,
-    5.473996401e-01f,
-    2.831192017e-01f,
-    3.525791168e-01f,
-    3.823992610e-01f,
-    2.450259477e-01f,
-    9.368786812e+00f,
-    8.542305946e+00f,
-    1.419211388e+00f,
-    1.004029512e+00f,
-    8.583756089e-01f,
-    2.260766625e-01f,
-    3.250937939e+00f,
-    1.442600632e+01f,
-    1.327450424e-01f,
-    2.444367409e+00f,
-    4.063003659e-01f,
-    4.873197079e+00f,
-    3.568028212e-01f,
-    9.931013733e-02f,
-    7.950121760e-01f,
-    9.084832668e-02f,
-    9.838499874e-02f,
-    1.870184243e-01f,
-    2.334018499e-01f,
-    4.131845832e-01f,
-    1.331744790e-01f,
-    3.278021097e+00f,
-    1.916470766e+00f,
-    5.941357017e-01f,
-    6.264682412e-01f,
-    3.056768775e-01f,
-    2.374068737e+00f,
-    1.455225945e+00f,
-    1.791530490e+00f,
-    7.481255531e-01f,
-    1.113523364e+00f,
-    1.312778234e+00f,
-    1.495259666e+01f,
-    1.789543724e+01f,
-    7.686951637e+00f,
-    1.126504421e+01f,
-    1.234777546e+01f,
-    1.358610630e+01f,
-    6.227106571e+00f,
-    9.124694824e+00f,
-    4.547944546e+00f,
-    2.582627773e+00f,
-    1.319873524e+01f,
-    1.738087654e+01f,
-    1.918839455e+00f,
-    5.914971352e+00f,
-    7.460162044e-01f,
-    1.071768403e+00f,
-    2.857099533e+00f,
-    1.709755659e+00f,
-    3.275787354e+00f,
-    9.595872164e-01f,
-    3.968141675e-01f,
-    7.047765255e-01f,
-    1.614264011e+00f,
-    5.791770935e+00f,
-    1.390825987e+00f,
-    5.140400529e-01f,
-    3.002592087e+00f,
-    9.301867485e-01f,
-    5.645864964e+00f,
-    2.046340227e+00f,
-    3.796428680e+00f,
-    1.595713377e+00f,
-    1.455241799e+00f,
-    3.433062792e+00f,
-    4.353935719e+00f,
-    4.570927143e+00f,
-    1.135522127e+00f,
-    6.974250078e-01f,
-    1.102576852e+00f,
-    3.199198961e+00f,
-    6.745253563e+00f,
-    7.385611057e+00f,
-    3.593975544e+00f,
-    1.553387165e+01f,
-    3.269429016e+01f,
-    3.707604408e+00f,
-    7.965935230e+00f,
-    7.215999603e+00f,
-    6.619699097e+01f,
-    6.833071232e+00f,
-    4.688092709e+00f,
-    3.150297642e+00f,
-    1.501214027e+01f,
-    4.915800571e+00f,
-    3.405286312e+00f,
-    2.397603750e+00f,
-    2.765131235e+00f,
-    5.863933086e+00f,
-    4.822422504e+00f,
-    3.753971577e+00f,
-    9.268439412e-01f,
-    1.801250577e+00f,
-    4.892796516e+00f,
-    6.903340340e+00f,
-    2.683591127e+00f,
-    1.088459611e+00f,
-    2.849287510e+00f,
-    8.924963474e-01f,
-    3.978202641e-01f,
-    1.184317231e+00f,
-    2.255549669e+00f,
-    7.334569097e-01f,
-    8.137899041e-01f,
-    4.778868556e-01f,
-    2.084290743e+00f,
-    2.411115646e+00f,
-    6.868171692e-01f,
-    5.622624159e-01f,
-    2.262681723e+00f,
-    2.328277588e+00f,
-    8.899741173e-01f,
-    2.781800508e+00f,
-    1.401288152e+00f,
-    1.636201143e+00f,
-    1.365801573e+00f,
-    1.258633971e+00f,
-    1.145010233e+00f,
-    1.847033620e+00f,
-    3.238609791e+00f,
-    2.023280859e+00f,
-    1.242994785e+00f,
-    1.353868842e+00f,
-    3.599959612e+00f,
-    7.274191976e-01f,
-    9.471099854e+00f,
-    8.285428286e-01f,
-    9.411247253e+00f,
-    2.914037108e-01f,
-    3.074823856e+00f,
-    3.821717501e+00f,
-    1.054719543e+01f,
-    4.848935604e+00f,
-    1.461836147e+01f,
-    1.397457004e+00f,
-    8.821296692e+00f,
-    1.110119462e+00f,
-    9.138845205e-01f,
-    7.284168601e-01f,
-    4.900919497e-01f,
-    2.684698999e-01f,
-    2.371962309e+00f,
-    4.317565441e+00f,
-    8.701575994e-01f,
-    9.098212719e-01f,
-    4.089555740e-01f,
-    2.255984694e-01f,
-    8.478969336e-01f,
-    4.869460166e-01f,
-    2.802908123e-01f,
-    3.630929887e-01f,
-    5.033221245e-01f,
-    7.031371593e-01f,
-    1.115502238e+00f,
-    2.097236365e-01f,
-    5.986537933e-01f,
-    6.166338921e-01f,
-    4.204548299e-01f,
-    4.823347926e-01f,
-    5.240394473e-01f,
-    4.639601707e-01f,
-    5.881189108e-01f,
-    1.474699116e+01f,
-    2.315102339e+00f,
-    6.483450890e+00f,
-    7.366289616e+00f,
-    9.129928589e+00f,
-    2.373060226e+01f,
-    2.130819702e+01f,
-    1.433782482e+01f,
-    1.216174412e+01f,
-    8.917060852e+00f,
-    8.409011841e+00f,
-    4.934932232e+00f,
-    6.169892311e+00f,
-    1.359057546e+00f,
-    5.156433582e-01f,
-    9.958229661e-01f,
-    5.364520550e-01f,
-    9.715463221e-02f,
-    6.258322239e+00f,
-    9.640919685e+00f,
-    4.576738834e+00f,
-    5.355986357e-01f,
-    2.715999782e-01f,
-    2.246698737e-01f,
-    4.643653631e-01f,
-    5.714050531e-01f,
-    4.713594019e-01f,
-    1.019810215e-01f,
-    1.752238162e-02f,
-    1.295961380e+01f,
-    2.043227673e+00f,
-    3.196327019e+01f,
-    2.394436646e+01f,
-    8.518723488e+00f,
-    4.219764328e+01f,
-    7.278141499e+00f,
-    5.994933128e+00f,
-    2.435044098e+01f,
-    2.607609034e-01f,
-    1.564619732e+01f,
-    4.798458576e+00f,
-    8.261309862e-01f,
-    1.922821808e+01f,
-    1.161628914e+01f,
-    6.135301113e+00f,
-    3.041739225e+00f,
-    1.060769320e+00f,
-    5.149978161e+00f,
-    8.717784882e+00f,
-    4.395108223e+00f,
-    3.500520229e+00f,
-    6.488061428e+00f,
-    6.737855434e+00f,
-    2.159935534e-01f,
-    1.184807941e-01f,
-    5.039300323e-01f,
-    1.752644181e+00f,
-    8.243833780e-01f,
-    2.225170732e-01f,
-    2.910525203e-01f,
-    4.074068666e-01f,
-    5.659760833e-01f,
-    2.592124343e-01f,
-    5.156478882e-01f,
-    4.366050661e-01f,
-    4.379964471e-01f,
-    2.217825800e-01f,
-    7.182902336e+00f,
-    1.285576344e+01f,
-    2.891088009e+00f,
-    8.606960297e+00f,
-    1.094117641e+00f,
-    2.735406756e-01f,
-    2.891769028e+01f,
-    2.479638481e+01f,
-    1.439925730e-01f,
-    7.459448242e+01f,
-    2.558660805e-01f,
-    3.591470957e+00f,
-    7.047974467e-01f,
-    1.672463566e-01f,
-    1.172930524e-01f,
-    9.632462502e+00f,
-    2.761513293e-01f,
-    1.342713088e-01f,
-    1.791406125e-01f,
-    5.516114458e-02f,
-    1.089020729e+00f,
-    7.814200968e-02f,
-    1.848485470e-01f,
-    7.563197017e-01f,
-    9.031897783e-01f,
-    6.081943512e-01f,
-    1.995002478e-01f,
-    9.124423265e-01f,
-    1.403998494e+00f,
-    1.227923512e+00f,
-    1.880746484e+00f,
-    4.609407187e-01f,
-    2.522759914e+00f,
-    2.594501019e+00f,
-    1.551904678e+00f,
-    7.432412505e-01f,
-    1.446283698e+00f,
-    9.354795814e-01f,
-    2.029340744e+01f,
-    1.663404465e+01f,
-    6.270280361e+00f,
-    2.379996538e+00f,
-    2.045049906e+00f,
-    4.426311016e+00f,
-    2.889103413e+00f,
-    6.852980614e+00f,
-    2.605424643e+00f,
-    5.635754108e+00f,
-    2.547583199e+01f,
-    1.414860439e+01f,
-    2.965863228e+00f,
-    4.279580414e-01f,
-    9.689135551e-01f,
-    7.068908811e-01f,
-    8.536580205e-01f,
-    3.805462599e+00f,
-    1.064891577e+00f,
-    6.341617703e-01f,
-    7.804743648e-01f,
-    1.756254554e+00f,
-    5.757050514e-01f,
-    1.607585311e+00f,
-    9.181531668e-01f,
-    8.110370040e-01f,
-    1.367989302e+00f,
-    5.294068456e-01f,
-    5.404584408e-01f,
-    3.012781382e+00f,
-    1.785791278e+00f,
-    9.660120010e-01f,
-    1.553047419e+00f,
-    8.123944998e-01f,
-    2.313621521e+00f,
-    3.449635744e+00f,
-    5.614872575e-01f,
-    1.724717259e+00f,
-    8.305200338e-01f,
-    1.068364263e+00f,
-    7.998386621e-01f,
-    5.762164116e+00f,
-    5.690094829e-01f,
-    4.345531464e+00f,
-    3.669742048e-01f,
-    3.105952263e+00f,
-    2.405714035e+00f,
-    2.258960915e+01f,
-    2.641153812e+00f,
-    8.835591674e-01f,
-    6.594705582e-01f,
-    8.756090164e+00f,
-    5.421958447e+00f,
-    5.087872028e+00f,
-    2.028545618e+00f,
-    1.427747059e+01f,
-    2.048954725e+00f,
-    9.860512614e-01f,
-    8.467736244e-01f,
-    3.782830238e+00f,
-    3.331835270e+00f,
-    7.695256710e+00f,
-    1.218444633e+01f,
-    9.972475052e+00f,
-    2.685796261e+00f,
-    5.469626427e+00f,
-    6.834646225e+00f,
-    1.846059799e+00f,
-    1.518858433e+01f,
-    1.078618717e+01f,
-    5.982250214e+00f,
-    7.076839447e+00f,
-    5.784874344e+01f,
-    1.511460590e+01f,
-    1.045687556e+00f,
-    1.481645226e+00f,
-    8.334918976e+00f,
-    1.628286743e+01f,
-    1.941643715e+01f,
-    3.059664726e+00f,
-    1.720790100e+01f,
-    5.412646770e+00f,
-    5.147973299e-01f,
-    4.312126338e-01f,
-    5.444337368e+00f,
-    1.499923515e+01f,
-    1.125632477e+01f,
-    1.010404706e+00f,
-    1.185870051e+00f,
-    9.414337873e-01f,
-    6.916111946e+00f,
-    4.229364872e+00f,
-    1.763782310e+01f,
-    2.569319725e+00f,
-    1.674692535e+01f,
-    1.159617138e+01f,
-    4.024377167e-01f,
-    1.023952961e+00f,
-    4.012719095e-01f,
-    4.940414429e+00f,
-    1.122951269e+00f,
-    4.942562580e+00f,
-    3.936735868e+00f,
-    2.632947564e-01f,
-    7.269908905e+00f,
-    4.269479752e+00f,
-    6.098064899e+00f,
-    2.563863695e-01f,
-    4.103403986e-01f,
-    2.986110210e+00f,
-    4.011469364e+00f,
-    3.005999088e+00f,
-    3.038171232e-01f,
-    4.019115865e-01f,
-    4.539349556e+00f,
-    1.853131175e+00f,
-    2.385444164e+00f,
-    1.194273829e+00f,
-    9.126577377e+00f,
-    1.246304989e+01f,
-    3.895081043e+00f,
-    1.394311333e+01f,
-    3.492541790e+00f,
-    3.080537796e+00f,
-    8.294281006e+00f,
-    8.480402946e+00f,
-    4.044834137e+00f,
-    1.741198778e+00f,
-    2.016236544e+00f,
-    1.309592819e+01f,
-    5.380697727e+00f,
-    1.830065536e+01f,
-    1.044761300e+00f,
-    9.916408658e-01f,
-    9.562366605e-01f,
-    4.086762905e+00f,
-    2.715813160e+00f,
-    2.734369993e+00f,
-    3.594966531e-01f,
-    9.326898456e-01f,
-    4.302585721e-01f,
-    3.484879017e+00f,
-    1.064526439e+00f,
-    2.754601717e+00f,
-    1.799709678e+00f,
-    1.833432794e+00f,
-    4.414735317e+00f,
-    7.010776520e+00f,
-    7.177574158e+00f,
-    8.573307395e-01f,
-    9.846865535e-01f,
-    1.038249612e+00f,
-    6.904574633e-01f,
-    3.275357485e+00f,
-    1.573657632e+00f,
-    1.570674896e+00f,
-    6.410311699e+00f,
-    1.135782146e+01f,
-    1.926601171e+00f,
-    3.102713823e+00f,
-    1.273523808e+01f,
-    4.619790077e+00f,
-    6.253782749e+00f,
-    5.301116467e+00f,
-    3.507580757e+00f,
-    5.340633869e+00f,
-    3.051598072e+00f,
-    8.989863396e+00f,
-    8.094225883e+00f,
-    2.616161585e+00f,
-    1.150985479e+00f,
-    3.299054623e+00f,
-    3.387756348e+00f,
-    5.397554398e+00f,
-    9.094711304e+00f,
-    2.764061928e+00f,
-    1.771563530e+00f,
-    2.037972450e+00f,
-    1.129984856e+00f,
-    1.029396534e+00f,
-    1.701622367e+00f,
-    3.263448000e+00f,
-    2.560025930e+00f,
-    4.621104717e+00f,
-    6.715035439e+00f,
-    6.109962463e+00f,
-    7.869555950e+00f,
-    5.847594142e-01f,
-    4.509184659e-01f,
-    4.823958874e+00f,
-    4.313992977e+00f,
-    2.173740387e+00f,
-    4.204844832e-01f,
-    5.221412182e-01f,
-    1.144121408e+00f,
-    1.972825766e+00f,
-    4.538471699e+00f,
-    1.155063748e+00f,
-    8.094676733e-01f,
-    1.743672967e+00f,
-    1.849016428e+00f,
-    2.948813915e+00f,
-    1.369271755e+00f,
-    1.927890658e+00f,
-    1.127224207e+00f,
-    1.124057651e+00f,
-    2.405220270e+00f,
-    1.365519404e+00f,
-    8.054701686e-01f,
-    1.172382927e+01f,
-    4.061986506e-01f,
-    6.403451443e+00f,
-    3.426988721e-01f,
-    2.273852348e+00f,
-    7.965720892e-01f,
-    3.805743933e+00f,
-    1.233488798e+00f,
-    2.801459432e-01f,
-    9.782588959e+00f,
-    1.693346739e+00f,
-    1.567218781e+00f,
-    2.171540260e+00f,
-    4.297074318e+00f,
-    4.517111778e+00f,
-    9.028723240e-01f,
-    2.032506227e+00f,
-    2.414700508e+00f,
-    4.536586761e+00f,
-    3.930142522e-01f,
-    1.119042635e+00f,
-    1.444322944e+00f,
-    5.345000744e+00f,
-    5.575887680e+00f,
-    2.974045753e+00f,
-    8.552238345e-01f,
-    6.857171059e-01f,
-    9.102937698e+00f,
-    6.914028168e+00f,
-    1.026454353e+01f,
-    2.635581970e+00f,
-    8.174013138e+00f,
-    6.272605896e+00f,
-    5.264900923e-01f,
-    5.188354254e-01f,
-    5.229157448e+00f,
-    6.225332737e+00f,
-    1.808820915e+01f,
-    3.287534475e+00f,
-    1.289023304e+01f,
-    9.697431564e+00f,
-    1.147814655e+01f,
-    5.272866249e+00f,
-    9.045353889e+00f,
-    5.391683578e+00f,
-    5.843080044e+00f,
-    5.165112972e+00f,
-    4.939501286e+00f,
-    1.293922305e+00f,
-    1.358630180e+00f,
-    4.208656788e+00f,
-    8.331652641e+00f,
-    7.216232777e+00f,
-    1.223970652e+00f,
-    7.561712265e-01f,
-    2.627875328e+00f,
-    3.586056948e+00f,
-    7.450381517e-01f,
-    1.111672044e+00f,
-    4.702387452e-01f,
-    3.910004854e+00f,
-    1.003255939e+01f,
-    7.166619301e+00f,
-    1.472740269e+01f,
-    6.125895977e+00f,
-    3.967118835e+01f,
-    3.655828238e+00f,
-    9.724945068e+00f,
-    1.539499378e+01f,
-    1.303358972e-01f,
-    5.417443275e+00f,
-    1.350889015e+01f,
-    4.712481499e+00f,
-    9.448233247e-01f,
-    6.745941162e+00f,
-    2.944986820e+00f,
-    2.051686049e+00f,
-    2.303423309e+01f,
-    1.108166122e+01f,
-    3.644640732e+01f,
-    1.728936791e+00f,
-    1.439684510e+00f,
-    1.830711961e+00f,
-    1.306210041e+00f,
-    9.730837822e+00f,
-    9.694897652e+00f,
-    5.248123646e+00f,
-    5.554856300e+00f,
-    1.492976284e+01f,
-    9.906047821e+00f,
-    1.610153317e+00f,
-    2.959640622e-01f,
-    1.069873524e+01f,
-    1.624378967e+01f,
-    1.781867981e+01f,
-    3.302644730e+00f,
-    7.126503944e+00f,
-    1.177517986e+01f,
-    8.693539500e-01f,
-    5.734848976e-01f,
-    5.419786453e+00f,
-    6.356124878e+00f,
-    1.261374569e+01f,
-    6.220722795e-01f,
-    8.650196195e-01f,
-    4.920745790e-01f,
-    9.792781830e+00f,
-    5.054392815e+00f,
-    2.845726395e+01f,
-    1.397749305e+00f,
-    7.219707012e+00f,
-    6.661375046e+00f,
-    6.039327383e-01f,
-    1.267559290e+00f,
-    8.848356009e-01f,
-    1.148538470e+00f,
-    3.991535187e+00f,
-    7.591850162e-01f,
-    1.112779236e+01f,
-    1.160547137e+00f,
-    1.570129633e+00f,
-    1.061227918e+00f,
-    3.211607695e+00f,
-    6.006740928e-01f,
-    9.089288712e-01f,
-    6.350935936e+00f,
-    3.374786139e+00f,
-    3.880339146e+00f,
-    1.226616263e+00f,
-    7.216290832e-01f,
-    6.083926201e+00f,
-    2.182558537e+00f,
-    2.473813295e+00f,
-    3.173039556e-01f,
-    3.262018561e-01f,
-    6.374653339e+00f,
-    1.351929188e+00f,
-    3.085829258e+00f,
-    1.443268776e+00f,
-    2.711975098e+00f,
-    1.053057957e+01f,
-    1.766645551e+00f,
-    3.968999147e+00f,
-    1.938708544e+00f,
-    1.787070513e+00f,
-    9.831245422e+00f,
-    1.754427528e+01f,
-    7.869961262e+00f,
-    2.208160400e+00f,
-    2.361769438e+00f,
-    4.168692112e+00f,
-    1.984968424e+00f,
-    3.522156715e+00f,
-    5.662443638e-01f,
-    1.043595195e+00f,
-    6.337750554e-01f,
-    1.751645565e+00f,
-    7.925856113e-01f,
-    2.920324564e+00f,
-    5.057370663e-01f,
-    8.522123098e-01f,
-    6.557947993e-01f,
-    3.773007870e+00f,
-    2.166225195e+00f,
-    4.511264324e+00f,
-    3.511354923e+00f,
-    4.300678730e+00f,
-    2.752635717e+00f,
-    5.608659387e-01f,
-    1.138566852e+00f,
-    3.039554358e+00f,
-    1.391605854e+00f,
-    1.138541460e+00f,
-    5.860442519e-01f,
-    4.395396411e-01f,
-    2.444408178e+00f,
-    2.365900278e+00f,
-    4.045050144e+00f,
-    6.631480217e+00f,
-    1.282950878e+00f,
-    4.634555817e+00f,
-    3.640266061e-01f,
-    8.007690430e+00f,
-    1.410333347e+01f,
-    3.021654320e+01f,
-    5.977292538e+00f,
-    4.848889410e-01f,
-    3.185478747e-01f,
-    9.856328964e-01f,
-    8.385118246e-01f,
-    4.392053485e-01f,
-    6.162153482e-01f,
-    1.461368847e+01f,
-    1.280843449e+01f,
-    8.292455673e+00f,
-    6.986004710e-01f,
-    1.250820160e+00f,
-    8.721965551e-01f,
-    6.352786541e+00f,
-    5.570802212e+00f,
-    7.289513588e+00f,
-    1.100734830e+00f,
-    1.470067948e-01f,
-    2.482635826e-01f,
-    8.377671242e-01f,
-    4.233261645e-01f,
-    6.515168548e-01f,
-    3.026195765e-01f,
-    5.621930599e+00f,
-    4.127117634e+00f,
-    4.985022068e+00f,
-    7.899923325e+00f,
-    1.025220680e+01f,
-    7.202237129e+00f,
-    3.783759308e+01f,
-    4.411956787e+00f,
-    3.066780663e+01f,
-    7.052036762e+00f,
-    2.223558187e+00f,
-    4.150393009e+00f,
-    7.073326588e+00f,
-    2.474754810e+00f,
-    8.353711128e+00f,
-    2.522119761e+00f,
-    3.354393244e+00f,
-    3.846197605e+00f,
-    5.280452251e+00f,
-    1.817280388e+01f,
-    1.042424202e+01f,
-    2.901636124e+01f,
-    1.970748901e+01f,
-    5.370750046e+01f,
-    1.685537529e+01f,
-    2.250804329e+01f,
-    7.390853119e+01f,
-    1.184018135e+01f,
-    1.143187165e+00f,
-    4.017772973e-01f,
-    9.865095615e-01f,
-    3.977192342e-01f,
-    1.553221196e-01f,
-    2.479144186e-01f,
-    9.956139565e+00f,
-    1.818246460e+01f,
-    9.944823265e+00f,
-    2.232153714e-01f,
-    6.332451105e-01f,
-    3.161049783e-01f,
-    3.970983982e+00f,
-    4.740977764e+00f,
-    5.475049973e+00f,
-    5.694246292e-01f,
-    3.695972562e-01f,
-    4.043442309e-01f,
-    5.276835561e-01f,
-    2.696961164e-01f,
-    2.685434222e-01f,
-    2.694921494e-01f,
-    9.292908669e+00f,
-    7.254403114e+00f,
-    1.791742897e+01f,
-    1.072559118e+00f,
-    1.101151943e+00f,
-    3.653185070e-01f,
-    3.356580353e+01f,
-    4.984549713e+01f,
-    2.715245361e+02f,
-    8.271200180e+00f,
-    6.875370979e+00f,
-    2.032782745e+01f,
-    1.694121361e+01f,
-    4.246309280e+00f,
-    1.144184036e+02f,
-    9.584999084e+00f,
-    1.575512028e+01f,
-    4.671670914e+01f,
-    2.900252640e-01f,
-    5.738101602e-01f,
-    4.414820373e-01f,
-    3.184278679e+01f,
-    3.203872681e+01f,
-    2.098886566e+02f,
-    2.413479835e-01f,
-    4.161925316e+00f,
-    2.560988426e+00f,
-    2.400783896e-01f,
-    9.114734650e+00f,
-    2.401370704e-01f,
-    1.514970422e+00f,
-    7.000096440e-01f,
-    7.321023941e-02f,
-    7.012728602e-02f,
-    1.904095840e+01f,
-    1.510698891e+01f,
-    1.957735062e+01f,
-    1.799430400e-01f,
-    5.008389950e-01f,
-    2.381402701e-01f,
-    3.734680116e-01f,
-    5.681029558e-01f,
-    5.179711580e-01f,
-    1.921564865e+01f,
-    9.332043648e+00f,
-    1.322789192e+01f,
-    3.087219298e-01f,
-    1.561165690e+00f,
-    6.116729379e-01f,
-    1.401416510e-01f,
-    6.522139311e-01f,
-    1.461661011e-01f,
-    1.145870590e+01f,
-    5.765248775e+00f,
-    1.215919590e+01f,
-    1.841200292e-01f,
-    4.090861678e-01f,
-    1.846817583e-01f,
-    5.229746103e-01f,
-    2.308639288e+00f,
-    1.136038303e+01f,
-    2.741903782e+00f,
-    7.726003170e+00f,
-    6.807862282e+00f,
-    4.149636269e+00f,
-    7.089035034e+00f,
-    5.781142712e+00f,
-    5.957705021e+00f,
-    3.922042370e+00f,
-    1.117800522e+01f,
-    6.606697559e+00f,
-    5.034409523e+00f,
-    5.050048828e+00f,
-    1.624194145e+00f,
-    1.282244968e+01f,
-    9.933025360e+00f,
-    1.688973236e+01f,
-    1.251753449e+00f,
-    3.829406261e+00f,
-    6.040820599e+00f,
-    2.825824738e+00f,
-    1.022905064e+01f,
-    1.047936535e+01f,
-    9.227329254e+00f,
-    3.253514862e+01f,
-    6.363917351e+00f,
-    1.149342728e+01f,
-    1.737677813e+00f,
-    1.878811121e+00f,
-    1.388052106e+00f,
-    1.196291208e+00f,
-    6.645861268e-01f,
-    5.703403354e-01f,
-    1.081424618e+01f,
-    4.803484440e+00f,
-    4.544333458e+00f,
-    1.794114947e+00f,
-    2.236215591e+00f,
-    1.241731167e+00f,
-    2.545628548e-01f,
-    4.283284843e-01f,
-    2.490012646e-01f,
-    2.292062521e+00f,
-    2.927018642e+00f,
-    2.859602690e+00f,
-    2.027910709e+00f,
-    3.115586042e+00f,
-    3.576582909e+00f,
-    9.342753887e-01f,
-    8.239840269e-01f,
-    1.202947497e+00f,
-    1.063499570e+00f,
-    8.669733047e+00f,
-    5.995379925e+00f,
-    1.236633873e+01f,
-    9.699190259e-01f,
-    1.714450121e+00f,
-    2.500840425e+00f,
-    1.535490513e+00f,
-    6.944234371e-01f,
-    1.252630234e+00f,
-    5.255431533e-01f,
-    4.644921422e-01f,
-    1.140256763e+00f,
-    4.323000610e-01f,
-    7.220178843e-01f,
-    5.678209662e-01f,
-    3.827088833e+00f,
-    5.932227612e+00f,
-    4.224151611e+00f,
-    8.997197151e-01f,
-    1.625617027e+00f,
-    1.101824403e+00f,
-    1.583937049e+00f,
-    9.904189110e+00f,
-    5.010243416e+00f,
-    5.651998520e+00f,
-    5.229829788e+00f,
-    4.735116196e+01f,
-    5.722872257e+00f,
-    6.415047646e+00f,
-    2.754358482e+01f,
-    1.773422050e+01f,
-    3.370445728e+00f,
-    4.027464390e+00f,
-    3.316677809e+00f,
-    1.782431030e+01f,
-    2.288103104e+00f,
-    2.072952461e+01f,
-    7.759280682e+00f,
-    5.748999596e+00f,
-    5.066742897e+00f,
-    4.098562241e+00f,
-    2.347750664e+01f,
-    7.483649731e+00f,
-    5.409174442e+00f,
-    1.143927383e+01f,
-    2.110212326e+01f,
-    1.930282784e+01f,
-    3.106267929e+00f,
-    2.214760780e+00f,
-    4.409895420e+00f,
-    2.586808920e+00f,
-    2.501564598e+01f,
-    9.645632744e+00f,
-    1.384759068e+00f,
-    5.252545834e+00f,
-    5.057109356e+00f,
-    1.578973293e+00f,
-    1.090783000e+00f,
-    1.048067093e+00f,
-    5.043188095e+00f,
-    1.772321820e+00f,
-    4.564728165e+01f,
-    1.862807751e+00f,
-    3.063674450e+00f,
-    1.832467556e+00f,
-    3.699146032e+00f,
-    8.892519951e+00f,
-    1.337803745e+01f,
-    1.607054353e+00f,
-    8.418507576e+00f,
-    4.361960888e+00f,
-    1.901098251e+01f,
-    1.412669563e+01f,
-    9.316857338e+00f,
-    9.757771492e+00f,
-    2.468449324e-01f,
-    5.155981183e-01f,
-    6.128709316e-01f,
-    6.966751814e-01f,
-    1.022389770e+00f,
-    1.099851727e+00f,
-    5.788012981e+00f,
-    8.101535797e+00f,
-    8.236714363e+00f,
-    9.169130325e-01f,
-    1.283461690e+00f,
-    6.981486678e-01f,
-    2.635029554e-01f,
-    8.048313260e-01f,
-    5.823737383e-01f,
-    4.104391098e+00f,
-    1.324119759e+01f,
-    6.609624863e+00f,
-    6.010390520e-01f,
-    1.250624657e+00f,
-    5.637781620e-01f,
-    7.448476553e-01f,
-    1.258273125e+00f,
-    6.887867451e-01f,
-    1.001705647e+00f,
-    2.924745321e+00f,
-    6.140723705e+00f,
-    3.026775360e+00f,
-    1.294664502e+00f,
-    1.618672252e+00f,
-    1.331722617e+00f,
-    1.643589377e+00f,
-    8.134903908e-01f,
-    1.298730493e+00f,
-    1.180886149e+00f,
-    8.441215754e-01f,
-    9.936798811e-01f,
-    4.741763771e-01f,
-    9.236676693e-01f,
-    6.937130690e-01f,
-    3.273892879e+00f,
-    3.223578691e+00f,
-    5.535145760e+00f,
-    5.690441132e-01f,
-    1.363216281e+00f,
-    8.794255257e-01f,
-    1.965566993e+00f,
-    1.002458286e+01f,
-    5.283303261e+00f,
-    1.041858792e+00f,
-    1.632009315e+01f,
-    9.883991480e-01f,
-    6.233615875e-01f,
-    1.479398966e+00f,
-    1.003286719e+00f,
-    2.526626587e-01f,
-    6.756421924e-01f,
-    1.378692436e+01f,
-    9.323293567e-01f,
-    7.072966099e-01f,
-    1.651610494e+00f,
-    3.987180293e-01f,
-    1.000999069e+01f,
-    9.211215377e-01f,
-    1.343525052e+00f,
-    1.735621214e+00f,
-    3.561054766e-01f,
-    6.606143713e-01f,
-    6.157767177e-01f,
-    8.848038316e-01f,
-    4.121138752e-01f,
-    4.176736355e+00f,
-    2.689425230e+00f,
-    4.409423351e+00f,
-    1.062505841e+00f,
-    4.619864225e-01f,
-    1.138698578e+00f,
-    1.822588086e+00f,
-    1.837810516e+00f,
-    1.666134119e+00f,
-    5.573341846e+00f,
-    4.820809841e+00f,
-    2.689712524e+00f,
-    1.546946526e+00f,
-    7.728659511e-01f,
-    1.203203559e+00f,
-    4.099657536e-01f,
-    9.307692051e-01f,
-    1.836171627e+00f,
-    4.181803763e-01f,
-    7.701429367e+00f,
-    1.700731659e+01f,
-    4.629173756e+00f,
-    6.896345019e-01f,
-    2.889871597e-01f,
-    9.534775019e-01f,
-    8.543792963e-01f,
-    2.297601253e-01f,
-    4.420207739e-01f,
-    2.236123085e+01f,
-    1.535529804e+01f,
-    4.779424667e+00f,
-    4.505597949e-01f,
-    4.922672510e-01f,
-    7.176644206e-01f,
-    3.179661512e+00f,
-    3.671374321e+00f,
-    5.591362000e+00f,
-    1.005973577e+00f,
-    4.498081505e-01f,
-    1.268445373e+00f,
-    1.082913160e+00f,
-    2.642746270e-01f,
-    3.828176856e-01f,
-    5.716749430e-01f,
-    1.184699821e+01f,
-    6.834354401e+00f,
-    6.853272915e+00f,
-    8.260713577e+00f,
-    2.312948608e+01f,
-    8.063050270e+00f,
-    1.755209541e+01f,
-    6.240228176e+00f,
-    9.286235809e+00f,
-    1.083512306e+01f,
-    1.509986305e+01f,
-    5.560536861e+00f,
-    1.984294891e+01f,
-    5.661722660e+00f,
-    2.302496529e+01f,
-    4.154288769e+00f,
-    4.467948437e+00f,
-    4.745423794e+00f,
-    2.968984127e+00f,
-    6.274176598e+00f,
-    6.065880299e+00f,
-    1.084341526e+01f,
-    2.004309654e+01f,
-    2.984073067e+01f,
-    8.790449142e+00f,
-    1.728410840e+00f,
-    4.214646518e-01f,
-    1.232549191e+00f,
-    4.797342122e-01f,
-    6.333569288e-01f,
-    8.780562282e-01f,
-    4.030718803e+00f,
-    5.083644867e+00f,
-    6.197118282e+00f,
-    7.060904503e-01f,
-    8.814513087e-01f,
-    6.058858037e-01f,
-    3.269210815e+00f,
-    2.968602657e+00f,
-    2.952930689e+00f,
-    9.719817162e+00f,
-    6.109001160e+00f,
-    2.440699577e+00f,
-    5.513815284e-01f,
-    1.321041346e+00f,
-    5.789846778e-01f,
-    1.426263809e+00f,
-    5.702315643e-02f,
-    8.175716996e-01f,
-    1.057906270e+00f,
-    3.253428698e+00f,
-    5.734337807e+00f,
-    8.157175064e+00f,
-    2.946656227e+00f,
-    1.128905118e-01f,
-    1.796504408e-01f,
-    3.973665619e+01f,
-    5.861955166e+00f,
-    2.323629951e+01f,
-    2.585498095e+00f,
-    7.854593754e+00f,
-    1.512447166e+01f,
-    1.364560032e+01f,
-    1.097729969e+01f,
-    2.954235268e+01f,
-    6.256335735e+00f,
-    9.137155533e+00f,
-    2.303502274e+01f,
-    3.603659630e+00f,
-    5.115038157e-01f,
-    4.827712536e+00f,
-    1.818703842e+01f,
-    1.208759403e+01f,
-    3.900430298e+01f,
-    7.192495346e+00f,
-    1.493226409e+00f,
-    2.672422647e+00f,
-    1.221993804e+00f,
-    1.115277195e+01f,
-    2.475687218e+01f,
-    5.731585979e+00f,
-    8.246832848e+00f,
-    7.981683731e+00f,
-    6.222768307e+00f,
-    3.665657282e+00f,
-    2.316055298e+00f,
-    1.183731794e+00f,
-    5.645671368e+00f,
-    3.115982056e+00f,
-    3.059244156e+00f,
-    1.075792313e+00f,
-    9.381771088e-01f,
-    1.619191051e+00f,
-    1.540370274e+01f,
-    1.165240669e+01f,
-    1.242779922e+01f,
-    3.541021585e+00f,
-    3.774957180e+00f,
-    5.056322575e+00f,
-    6.114237309e+00f,
-    1.635185432e+01f,
-    2.143525505e+01f,
-    1.280655384e+01f,
-    1.316751719e+00f,
-    5.103719234e-01f,
-    8.064637780e-01f,
-    4.946306944e-01f,
-    1.099968031e-01f,
-    4.088809192e-01f,
-    1.026700020e+01f,
-    2.238375092e+01f,
-    5.817281246e+00f,
-    2.678533196e-01f,
-    6.967968345e-01f,
-    2.444875091e-01f,
-    4.114094257e+00f,
-    5.731523991e+00f,
-    9.770442009e+00f,
-    6.556966305e-01f,
-    4.868394434e-01f,
-    4.747564793e-01f,
-    2.647795379e-01f,
-    2.222433090e-01f,
-    1.475487202e-01f,
-    3.717540801e-01f,
-    8.775451660e+00f,
-    1.130585670e+01f,
-    2.269471931e+01f,
-    2.229348898e+00f,
-    5.103482604e-01f,
-    8.263919353e-01f,
-    6.933701992e+00f,
-    2.681154060e+01f,
-    3.082839012e+01f,
-    8.069100380e+00f,
-    7.479916096e+00f,
-    1.262135124e+01f,
-    1.579519463e+01f,
-    1.160145998e+00f,
-    2.956884766e+01f,
-    4.162962437e+00f,
-    5.140192509e+00f,
-    2.486058807e+01f,
-    5.853117704e-01f,
-    1.172645926e+00f,
-    9.950280786e-01f,
-    1.803236198e+01f,
-    1.706398964e+01f,
-    1.386506195e+02f,
-    2.871980906e+00f,
-    1.883030534e+00f,
-    2.164824605e-01f,
-    1.156828117e+01f,
-    8.737269044e-01f,
-    5.727998734e+00f,
-    4.054278851e+00f,
-    1.416535258e+00f,
-    1.726182178e-03f,
-    4.058807492e-01f,
-    4.214508057e+00f,
-    3.408984423e+00f,
-    1.124806762e+00f,
-    7.562475681e+00f,
-    4.390622330e+01f,
-    7.202788591e-01f,
-    1.165876627e+00f,
-    1.080564559e-01f,
-    1.505170166e-01f,
-    1.716897011e+01f,
-    1.261895561e+01f,
-    1.490163040e+01f,
-    1.570205241e-01f,
-    5.845274925e-01f,
-    6.603478789e-01f,
-    2.397982925e-01f,
-    9.680500627e-01f,
-    5.577866435e-01f,
-    1.304265213e+01f,
-    9.383426666e+00f,
-    6.175904846e+01f,
-    6.724196672e-01f,
-    1.750305295e+00f,
-    1.199848652e+00f,
-    9.374023229e-02f,
-    3.950640857e-01f,
-    5.018883348e-01f,
-    1.356036949e+01f,
-    2.776935816e+00f,
-    3.135734177e+01f,
-    2.785311937e-01f,
-    7.134251595e-01f,
-    2.585443556e-01f,
-    2.042649090e-01f,
-    1.367913127e+00f,
-    1.004091072e+01f,
-    2.379578829e+00f,
-    2.570131540e+00f,
-    7.073710442e+00f,
-    2.575742722e+00f,
-    7.481235981e+00f,
-    3.828428984e+00f,
-    5.605131626e+00f,
-    1.201193929e+00f,
-    1.142398357e+01f,
-    3.117285728e+00f,
-    1.055240512e+00f,
-    7.264626026e+00f,
-    2.359620810e+00f,
-    1.847170639e+01f,
-    6.618618011e+00f,
-    3.237168121e+01f,
-    2.840264797e+00f,
-    1.045261860e+01f,
-    6.583055973e+00f,
-    2.018520832e+00f,
-    9.692635536e+00f,
-    4.078965664e+00f,
-    9.159632683e+00f,
-    4.039199829e+00f,
-    5.609513760e+00f,
-    3.118280172e+00f,
-    2.128969669e+00f,
-    3.092714787e+00f,
-    2.034320354e+00f,
-    4.473824203e-01f,
-    6.722987294e-01f,
-    9.084873199e-01f,
-    4.350430012e+00f,
-    4.855041504e+00f,
-    3.809244394e+00f,
-    1.971948266e+00f,
-    8.666263819e-01f,
-    1.320692539e+00f,
-    4.982980192e-01f,
-    6.683511138e-01f,
-    1.554971218e+00f,
-    4.122167587e+00f,
-    3.194694996e+00f,
-    5.719527721e+00f,
-    1.188536048e+00f,
-    1.406906009e+00f,
-    4.887987137e+00f,
-    1.997001171e-01f,
-    1.005394936e+01f,
-    1.266408062e+01f,
-    1.605685616e+01f,
-    3.942123652e-01f,
-    1.024514914e+00f,
-    6.149975657e-01f,
-    3.620311022e-01f,
-    4.416602850e-01f,
-    8.366060853e-01f,
-    1.222491264e+01f,
-    8.126542091e+00f,
-    2.003355980e+01f,
-    7.482747436e-01f,
-    1.085532308e+00f,
-    1.389238596e+00f,
-    2.380296439e-01f,
-    9.184693694e-01f,
-    8.115824461e-01f,
-    1.393466854e+01f,
-    1.528178978e+01f,
-    1.697072029e+01f,
-    8.186900020e-01f,
-    2.173517942e+00f,
-    6.613150835e-01f,
-    4.848721027e-01f,
-    1.193350601e+01f,
-    1.607894152e-01f,
-    6.570271850e-01f,
-    2.225503731e+01f,
-    9.927186966e-01f,
-    3.895609379e-01f,
-    1.014830589e+01f,
-    3.260068297e-01f,
-    3.302655220e-01f,
-    2.165488005e+00f,
-    5.881415606e-01f,
-    5.345762372e-01f,
-    1.693420887e+00f,
-    2.033636570e+00f,
-    2.923302174e+00f,
-    2.161583185e+00f,
-    1.451149940e+00f,
-    5.142099261e-01f,
-    1.342785716e+00f,
-    1.464272618e+00f,
-    6.040059924e-01f,
-    5.397629738e-01f,
-    7.153928876e-01f,
-    3.437016010e+00f,
-    8.939769268e-01f,
-    1.132889152e+00f,
-    5.325367928e+00f,
-    1.789105415e+00f,
-    1.499788404e+00f,
-    2.389597178e+00f,
-    6.685581207e-01f,
-    1.331859112e+00f,
-    5.116008520e-01f,
-    1.298865080e+00f,
-    1.121426821e+00f,
-    1.278898478e+00f,
-    4.031620026e+00f,
-    2.139389753e+00f,
-    3.472200871e+00f,
-    1.170777559e+00f,
-    1.960449934e+00f,
-    1.721481085e+00f,
-    1.085060000e+00f,
-    9.317483306e-01f,
-    3.020860195e+00f,
-    4.377034307e-01f,
-    1.826426625e+00f,
-    1.362483263e+00f,
-    1.990939379e+00f,
-    2.464869976e+00f,
-    3.461498022e+00f,
-    5.027698517e+00f,
-    3.407582045e+00f,
-    3.791909218e+00f,
-    2.416112900e+00f,
-    3.891198874e+00f,
-    8.828645706e+00f,
-    8.094079971e+00f,
-    1.505349994e+00f,
-    1.936772108e+00f,
-    2.539540768e+00f,
-    1.238732457e+00f,
-    7.610414624e-01f,
-    1.696840525e+00f,
-    1.030491590e+00f,
-    8.855100870e-01f,
-    1.035384655e+00f,
-    8.979839683e-01f,
-    7.130460143e-01f,
-    2.560934544e+00f,
-    1.768414378e+00f,
-    1.076443791e+00f,
-    8.684384823e-01f,
-    5.781725049e-01f,
-    2.201065063e+00f,
-    7.301090360e-01f,
-    2.787067175e+00f,
-    1.901342988e+00f,
-    2.761910200e+00f,
-    2.986525774e+00f,
-    3.321174383e+00f,
-    3.633972883e+00f,
-    1.682547927e+00f,
-    6.891419888e+00f,
-    5.083405495e+00f,
-    1.337664843e+00f,
-    3.107404947e+00f,
-    2.619369030e+00f,
-    1.567165613e+00f,
-    1.191348314e+00f,
-    5.322998047e+00f,
-    3.874058008e+00f,
-    8.042890549e+00f,
-    1.432016492e+00f,
-    1.216305733e+00f,
-    2.258942604e+00f,
-    5.373591185e-01f,
-    8.626311421e-01f,
-    1.217767239e+00f,
-    1.883566380e+00f,
-    4.753244519e-01f,
-    4.584752917e-01f,
-    1.199508667e+00f,
-    1.670146942e+00f,
-    1.636081457e+00f,
-    2.747814655e+00f,
-    2.084024906e+00f,
-    1.030859470e+00f,
-    1.959717870e+00f,
-    1.279115558e+00f,
-    4.228913307e+00f,
-    1.427896857e+00f,
-    2.239568233e+00f,
-    1.884313583e+00f,
-    6.157001972e+00f,
-    9.629619598e+00f,
-    1.343507004e+01f,
-    4.826432228e+00f,
-    9.761449814e+00f,
-    2.801576376e+00f,
-    1.413759804e+01f,
-    3.339487553e+00f,
-    2.781886482e+01f,
-    3.386310101e+00f,
-    5.215564728e+00f,
-    1.616982937e+00f,
-    1.275892830e+01f,
-    1.126856613e+01f,
-    5.048126221e+00f,
-    8.472218513e+00f,
-    1.492704010e+01f,
-    1.254106760e+00f,
-    4.586793780e-01f,
-    1.452810645e+00f,
-    2.000701904e+00f,
-    5.944012403e-01f,
-    1.313185215e+00f,
-    1.068967938e+00f,
-    2.004104376e+00f,
-    9.883528948e-01f,
-    2.509062529e+00f,
-    9.806649685e-01f,
-    8.943331242e-01f,
-    9.646586776e-01f,
-    1.012559891e+00f,
-    8.277993202e-01f,
-    1.402162647e+01f,
-    2.226242781e+00f,
-    1.327800155e+00f,
-    4.667400420e-01f,
-    7.816713452e-01f,
-    1.761682153e+00f,
-    2.529369926e+01f,
-    3.778566420e-01f,
-    5.197003484e-01f,
-    9.172276258e-01f,
-    3.996232748e-01f,
-    3.023419380e+00f,
-    1.768266439e+00f,
-    3.130930424e+00f,
-    2.181810856e+00f,
-    6.578397751e+00f,
-    2.537989616e+00f,
-    5.099670410e+00f,
-    1.562157154e+00f,
-    1.375633335e+01f,
-    7.955454350e+00f,
-    6.731859684e+00f,
-    2.794938564e+00f,
-    4.250596046e+00f,
-    6.308105946e+00f,
-    6.578601837e+00f,
-    3.087306976e+00f,
-    6.081972599e+00f,
-    5.300842285e+00f,
-    4.989516735e+00f,
-    9.953317642e+00f,
-    2.559182644e+00f,
-    1.993937850e+00f,
-    6.083160639e-01f,
-    1.410527587e+00f,
-    8.825935364e+00f,
-    4.781795979e+00f,
-    4.135798931e+00f,
-    4.344170690e-01f,
-    1.430007815e-01f,
-    4.335139990e-01f,
-    3.987161875e+00f,
-    6.387707710e+00f,
-    2.246590376e+00f,
-    5.060466528e-01f,
-    4.869402349e-01f,
-    5.305722952e-01f,
-    2.843963802e-01f,
-    3.082826138e-01f,
-    2.688251138e-01f,
-    2.932415962e+00f,
-    3.512708664e+00f,
-    2.711400032e+00f,
-    8.659938574e-01f,
-    3.404962420e-01f,
-    2.398080349e+00f,
-    1.582736015e+00f,
-    6.160600781e-01f,
-    1.025179625e+00f,
-    1.103845787e+01f,
-    9.537527084e+00f,
-    2.876365662e+00f,
-    2.609936714e+00f,
-    6.110561371e+00f,
-    5.063277721e+00f,
-    3.203360796e+00f,
-    2.458239079e+00f,
-    5.214489460e+00f,
-    1.907638907e+00f,
-    4.756708145e+00f,
-    1.280459881e+00f,
-    2.932365656e+00f,
-    1.555245757e+00f,
-    1.011696100e+00f,
-    4.655000687e+00f,
-    2.459381580e+00f,
-    2.762681484e+00f,
-    2.531426430e+00f,
-    4.565254211e+00f,
-    2.301039934e+00f,
-    1.005589008e+00f,
-    5.673994064e+00f,
-    4.964735031e+00f,
-    2.506654024e+00f,
-    4.318100452e+00f,
-    6.366238594e+00f,
-    2.382595301e+00f,
-    1.502354741e+00f,
-    3.575718403e+00f,
-    3.400327265e-01f,
-    6.318128109e-01f,
-    5.895286798e-01f,
-    7.287115097e+00f,
-    2.396125317e+00f,
-    3.524643660e+00f,
-    6.469928622e-01f,
-    1.107466102e+00f,
-    2.690142989e-01f,
-    4.283756256e+00f,
-    2.411502361e+00f,
-    8.939260244e-01f,
-    4.645997286e-01f,
-    3.621652424e-01f,
-    4.649880826e-01f,
-    2.035491943e+00f,
-    1.438742757e+00f,
-    1.639483094e+00f,
-    5.474099636e+00f,
-    2.458551168e+00f,
-    7.760289192e+00f,
-    1.174447536e+00f,
-    1.413197994e+00f,
-    1.755644798e+00f,
-    3.585220814e+00f,
-    1.159780145e+00f,
-    2.469386339e+00f,
-    4.123003006e+00f,
-    4.417074203e+00f,
-    1.737760067e+00f,
-    2.780566454e+00f,
-    2.356975079e+00f,
-    2.118688345e+00f,
-    1.523664474e+00f,
-    1.346371531e+00f,
-    2.110328436e+00f,
-    5.209241509e-01f,
-    1.418245506e+01f,
-    2.205703497e+00f,
-    3.932153940e+00f,
-    1.341251945e+01f,
-    1.143630695e+01f,
-    2.190143824e+00f,
-    8.413658142e+00f,
-    5.234989643e+00f,
-    6.210866928e+00f,
-    5.188436508e+00f,
-    5.813250065e+00f,
-    5.524859428e+00f,
-    4.556397438e+00f,
-    3.379686773e-01f,
-    5.320835590e+00f,
-    5.693429470e+00f,
-    8.293011665e+00f,
-    2.722958326e+00f,
-    4.332973003e+00f,
-    4.026238918e+00f,
-    1.708973694e+01f,
-    9.486769676e+00f,
-    7.590150356e+00f,
-    7.898441315e+00f,
-    9.368934631e+00f,
-    3.763669491e+00f,
-    1.217756271e+01f,
-    1.104398489e+00f,
-    3.145925283e+00f,
-    2.157711506e+00f,
-    6.266113758e+00f,
-    1.887082458e+00f,
-    1.044630766e+00f,
-    7.905894518e-01f,
-    9.177693725e-01f,
-    3.585359812e+00f,
-    4.577996254e+00f,
-    3.808012605e-01f,
-    7.391626835e-01f,
-    1.389528394e+00f,
-    1.367246032e+00f,
-    6.639668345e-01f,
-    7.553551197e-01f,
-    3.660361171e-01f,
-    2.896385908e+00f,
-    2.185369730e+00f,
-    2.512541056e+00f,
-    8.938117027e-01f,
-    5.564196110e-01f,
-    2.880857944e+00f,
-    1.313861966e+00f,
-    7.578458190e-01f,
-    8.055377603e-01f,
-    3.677830219e+00f,
-    1.181568146e+02f,
-    2.543277979e+00f,
-    2.151534319e+00f,
-    1.130692482e+00f,
-    3.139424086e+00f,
-    1.552979469e+00f,
-    3.032393217e+00f,
-    3.760159016e+00f,
-    1.022920895e+01f,
-    6.335644722e-01f,
-    1.066319346e+00f,
-    7.536267281e+00f,
-    5.709192753e-01f,
-    8.393891454e-01f,
-    2.165186644e+00f,
-    1.708555102e+00f,
-    3.947958946e+00f,
-    2.755849600e+00f,
-    3.545368195e+00f,
-    3.540883541e+00f,
-    3.484277725e+00f,
-    1.993295550e+00f,
-    1.890656471e+01f,
-    2.278890133e+00f,
-    1.056383038e+01f,
-    6.461932659e+00f,
-    2.056955338e+00f,
-    2.140459824e+01f,
-    4.802787304e+00f,
-    9.528838158e+00f,
-    5.053404331e+00f,
-    1.724153519e+01f,
-    1.792502022e+01f,
-    1.781353188e+01f,
-    9.346696854e+00f,
-    4.930297852e+01f,
-    1.925649881e+00f,
-    1.300617790e+01f,
-    1.208627415e+01f,
-    4.240341663e+00f,
-    1.985560656e+00f,
-    1.210295081e+00f,
-    1.523734689e+00f,
-    1.220511079e+00f,
-    1.171949983e+00f,
-    1.649067307e+01f,
-    8.864244461e+00f,
-    4.734647751e+00f,
-    1.461139202e+00f,
-    1.543300152e+00f,
-    1.359949946e+00f,
-    1.098185635e+01f,
-    8.198906898e+00f,
-    6.717752934e+00f,
-    8.287292719e-01f,
-    1.112266779e+00f,
-    7.603366971e-01f,
-    1.637126207e+00f,
-    1.490657687e+00f,
-    3.256683052e-01f,
-    1.476613045e+01f,
-    1.510638046e+01f,
-    1.130856609e+01f,
-    1.023105025e+00f,
-    4.273646474e-01f,
-    3.343115151e-01f,
-    5.812549591e-01f,
-    1.755182892e-01f,
-    4.370548248e+00f,
-    4.611690998e+00f,
-    1.328277349e+00f,
-    7.356796861e-01f,
-    4.093964994e-01f,
-    7.723006725e+00f,
-    1.559049636e-01f,
-    3.633292913e-01f,
-    4.783609867e+00f,
-    5.290970325e+00f,
-    4.443244934e+00f,
-    3.353450060e+00f,
-    8.082285881e+00f,
-    2.938577414e+00f,
-    3.467764378e+00f,
-    2.396445274e+00f,
-    2.938659191e+00f,
-    2.109335661e+00f,
-    4.770107746e+00f,
-    1.065759182e+00f,
-    2.141535997e+00f,
-    2.904423952e+00f,
-    4.672683239e+00f,
-    6.942523718e-01f,
-    2.682291031e+00f,
-    8.160495758e+00f,
-    2.956493139e+00f,
-    2.983185530e+00f,
-    1.342296410e+01f,
-    3.690246582e+00f,
-    1.767635345e+00f,
-    2.610797167e+00f,
-    5.100171089e+00f,
-    1.434887290e+00f,
-    1.531170964e+00f,
-    3.830656052e+00f,
-    3.727025747e+00f,
-    3.227689028e+00f,
-    2.288327456e+00f,
-    4.022779942e+00f,
-    7.349593639e+00f,
-    4.809832573e+00f,
-    6.035368919e+00f,
-    3.890367746e+00f,
-    1.046561050e+01f,
-    1.687975883e+00f,
-    1.158040905e+01f,
-    1.601201630e+01f,
-    1.309577274e+01f,
-    3.642749190e-01f,
-    6.449104548e-01f,
-    3.654184341e-01f,
-    1.421244740e+00f,
-    4.213275909e-01f,
-    1.425168133e+01f,
-    9.019109726e+00f,
-    5.657536030e+00f,
-    6.453075409e-01f,
-    5.753617287e-01f,
-    1.136645675e+00f,
-    7.216637731e-01f,
-    2.794203162e-01f,
-    6.040923595e+00f,
-    2.982321930e+01f,
-    1.913655853e+01f,
-    5.497784019e-01f,
-    2.015417099e+00f,
-    5.304808617e-01f,
-    3.114873171e-01f,
-    1.802737713e+00f,
-    3.850565434e+00f,
-    1.578230619e+00f,
-    1.153790712e+00f,
-    1.251662374e+00f,
-    3.488133907e+00f,
-    1.517275095e+00f,
-    1.415519118e+00f,
-    6.875123978e-01f,
-    1.314234376e+00f,
-    2.213017702e+00f,
-    1.747119308e+00f,
-    1.626489997e+00f,
-    2.370482683e+00f,
-    3.091428518e+00f,
-    2.028648376e+00f,
-    3.803224087e+00f,
-    1.818449259e+00f,
-    2.383243799e+00f,
-    3.956977367e+00f,
-    8.108923912e+00f,
-    1.325152040e+00f,
-    7.155258179e+00f,
-    1.118045807e+01f,
-    1.367081451e+01f,
-    4.185394287e+00f,
-    1.198546410e+01f,
-    1.703986740e+01f,
-    1.557455063e+00f,
-    3.709553957e+00f,
-    4.449628353e+00f,
-    1.386620903e+01f,
-    3.132547140e+00f,
-    1.475645256e+01f,
-    5.718651772e+00f,
-    1.370721149e+01f,
-    3.095287895e+01f,
-    2.850611210e+00f,
-    3.946913481e+00f,
-    8.818705559e+00f,
-    2.858773708e+00f,
-    2.593843699e+00f,
-    1.562185287e+00f,
-    3.102275372e+00f,
-    2.489172459e+00f,
-    3.988169193e+00f,
-    1.445950699e+01f,
-    3.717791796e+00f,
-    2.804852962e+00f,
-    2.934643269e+00f,
-    6.815653801e+00f,
-    9.855360985e+00f,
-    6.784915447e+00f,
-    5.969344139e+00f,
-    6.232637882e+00f,
-    4.429746628e+00f,
-    9.344887733e+00f,
-    1.172521019e+01f,
-    1.745170784e+01f,
-    3.847897530e+00f,
-    5.502947807e+00f,
-    1.323090744e+01f,
-    7.632630825e+00f,
-    1.285952091e+00f,
-    6.054084301e-01f,
-    8.691493869e-01f,
-    9.613475204e-01f,
-    1.447598934e+00f,
-    1.627784348e+01f,
-    3.420298100e+00f,
-    3.495312119e+01f,
-    1.477967978e+00f,
-    2.475109577e+00f,
-    4.908113182e-01f,
-    1.084273338e+00f,
-    6.491996050e-01f,
-    1.037084293e+01f,
-    9.364066124e+00f,
-    8.220184326e+00f,
-    6.995162368e-01f,
-    5.316334367e-01f,
-    5.258968472e-01f,
-    8.213262558e-01f,
-    8.257917762e-01f,
-    1.918006420e+00f,
-    1.626244736e+01f,
-    1.427855849e+00f,
-    1.052002192e+00f,
-    4.679880142e-01f,
-    9.007017136e+00f,
-    8.986396790e-01f,
-    7.721664906e-01f,
-    8.526030779e-01f,
-    6.045241952e-01f,
-    1.787099242e+00f,
-    1.147960067e+00f,
-    1.273125410e+00f,
-    2.370754719e+00f,
-    4.486101627e+00f,
-    2.721286774e+00f,
-    2.194806814e+00f,
-    1.069433689e+00f,
-    1.601876855e+00f,
-    9.986182451e-01f,
-    8.047702909e-01f,
-    2.045264482e+00f,
-    1.908614516e+00f,
-    9.622836113e-01f,
-    4.400095940e-01f,
-    6.404290795e-01f,
-    7.610168457e-01f,
-    3.933615386e-01f,
-    4.247563481e-01f,
-    3.426938534e+00f,
-    4.831686914e-01f,
-    6.560879350e-01f,
-    3.625515699e+00f,
-    3.511750698e+00f,
-    3.587878942e+00f,
-    2.663979053e+00f,
-    3.492200375e-01f,
-    1.036009979e+01f,
-    9.829497933e-01f,
-    1.357056141e+00f,
-    1.389400959e+00f,
-    2.868937731e+00f,
-    1.759399414e+00f,
-    8.230221272e-01f,
-    1.672348380e+00f,
-    1.308341742e+00f,
-    4.046791077e+00f,
-    8.488817215e-01f,
-    1.168619156e+00f,
-    6.746926308e-01f,
-    1.642879844e+00f,
-    1.304256082e+00f,
-    1.860162139e+00f,
-    2.025942087e+00f,
-    2.717743874e+00f,
-    3.054121435e-01f,
-    2.084182024e+00f,
-    4.162493229e+00f,
-    2.988788605e+00f,
-    2.130807400e+00f,
-    2.473862886e+00f,
-    5.712081790e-01f,
-    9.886412621e-01f,
-    7.489495277e+00f,
-    1.392082095e+00f,
-    1.867613196e+00f,
-    3.796841860e+00f,
-    2.348038435e+00f,
-    3.120401382e+00f,
-    4.347878933e+00f,
-    2.794569254e+00f,
-    6.390525699e-01f,
-    1.092679143e+00f,
-    4.196053505e+00f,
-    2.141066074e+00f,
-    8.380545974e-01f,
-    5.394852161e-01f,
-    8.012080789e-01f,
-    1.026439190e+00f,
-    5.177757740e-01f,
-    8.405436873e-01f,
-    5.611662269e-01f,
-    1.129713416e+00f,
-    1.568882227e+00f,
-    1.569480538e+00f,
-    2.020381451e+00f,
-    1.331763864e+00f,
-    1.357773662e+00f,
-    9.827622771e-01f,
-    1.165678144e+00f,
-    1.085710406e+00f,
-    1.444564342e+00f,
-    5.044510961e-01f,
-    3.413925171e+00f,
-    3.488308430e+00f,
-    5.614571095e+00f,
-    5.257761002e+00f,
-    6.918395042e+00f,
-    2.703052521e+00f,
-    3.209237099e+00f,
-    6.214905739e+00f,
-    1.804732895e+01f,
-    6.989560604e+00f,
-    1.773869872e+00f,
-    1.134138703e+00f,
-    8.473640084e-01f,
-    8.651220202e-01f,
-    1.412515879e+00f,
-    1.684751272e+00f,
-    6.919375062e-01f,
-    7.446312904e-01f,
-    8.272701502e-01f,
-    8.606300950e-01f,
-    1.120844841e+00f,
-    1.477743983e+00f,
-    2.471921682e+00f,
-    9.913447499e-01f,
-    6.440436840e-01f,
-    1.115711808e+00f,
-    8.879839182e-01f,
-    1.486385226e+00f,
-    2.495631933e+00f,
-    7.337675691e-01f,
-    8.468277454e-01f,
-    5.930265784e-01f,
-    5.055333376e-01f,
-    8.197350502e-01f,
-    1.151261568e+00f,
-    1.099782348e+00f,
-    3.433884084e-01f,
-    1.898822546e+00f,
-    1.484095573e+00f,
-    5.008768439e-01f,
-    1.366586924e+00f,
-    2.949754596e-01f,
-    1.405698180e+00f,
-    4.781067848e+00f,
-    1.103921890e+00f,
-    2.030759752e-01f,
-    4.272433817e-01f,
-    3.186031878e-01f,
-    3.658954859e+00f,
-    3.813052416e+00f,
-    1.016011047e+01f,
-    3.647164345e+00f,
-    4.117831707e+00f,
-    5.846577644e+00f,
-    1.916483283e+00f,
-    1.261431789e+01f,
-    9.314036369e+00f,
-    2.652080536e+00f,
-    2.604257107e+00f,
-    3.007401705e+00f,
-    2.194648981e+00f,
-    7.126541734e-01f,
-    1.082231045e+00f,
-    3.977250457e-01f,
-    1.569537044e+00f,
-    1.797788143e+00f,
-    1.091223359e+00f,
-    5.283142328e-01f,
-    1.732845068e+00f,
-    4.040652752e+00f,
-    2.156636477e+00f,
-    3.486546516e+00f,
-    1.796309710e+00f,
-    2.360929012e+00f,
-    1.799622416e+00f,
-    3.640861511e+00f,
-    2.397993565e+00f,
-    2.261404514e+00f,
-    2.059568167e+00f,
-    2.753788710e+00f,
-    2.454174280e+00f,
-    1.938110590e+00f,
-    6.902250290e+00f,
-    5.082901478e+00f,
-    3.191291332e+00f,
-    5.983893394e+00f,
-    2.411355495e+00f,
-    4.471693516e+00f,
-    6.288736343e+00f,
-    7.371588707e+00f,
-    4.074493885e+00f,
-    2.385736227e+00f,
-    2.839088678e+00f,
-    3.620932102e+00f,
-    3.761430740e+00f,
-    3.803601742e+00f,
-    4.009602070e+00f,
-    2.139444828e+00f,
-    9.793028831e+00f,
-    3.363999605e+00f,
-    2.810897589e+00f,
-    2.945077658e+00f,
-    2.192479610e+00f,
-    4.674313068e-01f,
-    7.336797714e-01f,
-    4.189073443e-01f,
-    1.047428012e+00f,
-    1.110120296e+00f,
-    1.058587432e+00f,
-    2.770284116e-01f,
-    5.059882402e-01f,
-    5.926140547e-01f,
-    2.395030022e+00f,
-    2.203445911e+00f,
-    1.515913010e+00f,
-    2.440172195e+00f,
-    1.082118392e+00f,
-    1.751017928e+00f,
-    1.309378862e+00f,
-    2.287130594e+00f,
-    2.254879951e+00f,
-    1.904081941e+00f,
-    5.135670185e+00f,
-    7.414920926e-01f,
-    3.103210449e+00f,
-    2.413020134e-01f,
-    4.536497593e-01f,
-    3.226862669e+00f,
-    8.902042389e+00f,
-    7.689244747e+00f,
-    8.602266312e-01f,
-    5.969618797e+00f,
-    4.492260456e+00f,
-    2.564592838e+00f,
-    1.320197105e+00f,
-    2.620960712e+00f,
-    3.031870842e+00f,
-    6.526901722e+00f,
-    1.749059796e+00f,
-    3.149718523e+00f,
-    5.764664650e+00f,
-    9.129510880e+00f,
-    1.206825614e+00f,
-    1.056760192e+00f,
-    9.171350002e-01f,
-    9.316729307e-01f,
-    1.586884141e+00f,
-    8.596178293e-01f,
-    2.097399473e+00f,
-    7.888513803e-01f,
-    1.109911799e+00f,
-    1.036613464e+00f,
-    5.344873667e-01f,
-    1.073563671e+01f,
-    7.554087162e+00f,
-    7.020732403e+00f,
-    7.786962986e+00f,
-    7.457481384e+00f,
-    4.295120716e+00f,
-    5.704275131e+00f,
-    5.334726334e+00f,
-    8.801601410e+00f,
-    1.037982464e+01f,
-    7.650785923e+00f,
-    7.921541214e+00f,
-    3.825958967e+00f,
-    2.391734123e+00f,
-    4.792899132e+00f,
-    2.393613100e+00f,
-    1.312519264e+01f,
-    1.072458839e+01f,
-    1.874028444e+00f,
-    4.810685635e+00f,
-    1.118318748e+01f,
-    1.395574760e+01f,
-    1.132813835e+01f,
-    7.489593506e+01f,
-    2.375709534e+01f,
-    4.978146553e+00f,
-    3.718881607e+01f,
-    7.030993938e+00f,
-    1.161940479e+01f,
-    2.646013641e+01f,
-    4.983734131e+00f,
-    4.024787140e+01f,
-    7.027807236e+00f,
-    2.579069376e+00f,
-    7.077311039e+00f,
-    1.387724495e+01f,
-    1.299118996e+01f,
-    3.536088705e+00f,
-    3.579057455e+00f,
-    3.567437649e+00f,
-    1.107284737e+01f,
-    1.107806587e+01f,
-    2.181602478e+00f,
-    1.359413266e+00f,
-    1.193865538e+00f,
-    7.412213683e-01f,
-    7.450697422e-01f,
-    5.449038148e-01f,
-    1.307952166e+00f,
-    7.606266141e-01f,
-    7.465497851e-01f,
-    8.135360479e-01f,
-    3.299885988e-01f,
-    6.684429049e-01f,
-    6.291436195e+00f,
-    2.834071815e-01f,
-    1.236575246e+00f,
-    6.158802509e-01f,
-    4.436504543e-01f,
-    8.291634917e-01f,
-    7.460577488e+00f,
-    2.178347558e-01f,
-    4.016427696e-01f,
-    4.145245254e-01f,
-    8.444246292e+00f,
-    4.200303555e+00f,
-    2.730356216e+00f,
-    3.551928282e+00f,
-    2.860394716e+00f,
-    8.564302325e-01f,
-    8.429390192e-01f,
-    1.174945474e+00f,
-    8.822753429e-01f,
-    1.102989197e+00f,
-    1.782105088e+00f,
-    3.716159105e+00f,
-    1.056322932e+00f,
-    6.636410356e-01f,
-    7.368918657e-01f,
-    1.590552449e+00f,
-    8.931280375e-01f,
-    1.664972544e+00f,
-    3.252392113e-01f,
-    7.490454912e-01f,
-    1.093533039e+00f,
-    1.459010482e+00f,
-    2.488863945e+00f,
-    3.233762264e+00f,
-    6.199967861e+00f,
-    1.773246050e+00f,
-    1.978424191e+00f,
-    1.466656923e+00f,
-    5.725568295e+00f,
-    1.172069550e+01f,
-    1.892084837e+00f,
-    8.158781528e-01f,
-    1.796672225e+00f,
-    1.233499646e+00f,
-    6.234002709e-01f,
-    1.071210623e+00f,
-    7.594416738e-01f,
-    1.717177033e+00f,
-    2.122493982e+00f,
-    1.349607348e+00f,
-    1.066860199e+00f,
-    1.743511915e+00f,
-    1.661549211e+00f,
-    1.432058454e+00f,
-    1.057210088e+00f,
-    7.025662661e-01f,
-    6.641638279e-01f,
-    1.121706247e+00f,
-    1.021794200e+00f,
-    1.038794279e+00f,
-    6.341426969e-01f,
-    7.324208021e-01f,
-    9.537025690e-01f,
-    1.964066982e+00f,
-    6.663113832e-01f,
-    1.132368326e+00f,
-    5.353162289e-01f,
-    8.387193680e-01f,
-    1.166373610e+00f,
-    1.977627563e+01f,
-    8.485323787e-01f,
-    1.248085380e+00f,
-    9.733967185e-01f,
-    2.036788559e+01f,
-    7.075475216e+00f,
-    6.061584473e+00f,
-    1.140867949e+00f,
-    3.544935286e-01f,
-    2.446175098e+00f,
-    4.439613819e+00f,
-    1.170018435e+00f,
-    5.529794097e-01f,
-    6.452167034e-01f,
-    1.113736510e+00f,
-    2.007864237e+00f,
-    2.464870930e+00f,
-    5.603731632e+00f,
-    5.329599380e+00f,
-    2.162242889e+00f,
-    3.524255514e+00f,
-    9.378497124e+00f,
-    9.709749222e+00f,
-    5.381681919e+00f,
-    6.695254803e+00f,
-    6.833081245e+00f,
-    7.973084927e+00f,
-    8.857722282e+00f,
-    5.364107609e+00f,
-    3.289889812e+00f,
-    1.735935783e+01f,
-    2.212966681e+00f,
-    1.183997154e+00f,
-    9.219368696e-01f,
-    7.299377441e+00f,
-    4.424612999e+00f,
-    1.042992783e+01f,
-    9.741582274e-01f,
-    2.423852086e-01f,
-    3.853522062e+00f,
-    1.292348289e+01f,
-    1.692937136e+00f,
-    3.562246561e-01f,
-    5.449075699e-01f,
-    2.314964533e+00f,
-    6.914835930e+00f,
-    7.286153316e+00f,
-    2.797894716e+00f,
-    1.096411705e+00f,
-    1.419278741e+00f,
-    4.923843861e+00f,
-    4.777724743e+00f,
-    2.133227539e+01f,
-    1.155381441e+00f,
-    1.730112076e+00f,
-    4.470238686e-01f,
-    1.156878233e+00f,
-    1.327040291e+01f,
-    3.143707085e+01f,
-    1.604404092e+00f,
-    2.229708433e+00f,
-    9.816635847e-01f,
-    3.109157324e+00f,
-    8.124049902e-01f,
-    1.480799198e+00f,
-    3.392429352e-01f,
-    2.580536127e+00f,
-    2.521600425e-01f,
-    1.194149703e-01f,
-    8.070695400e-02f,
-    3.786478758e+00f,
-    3.097212791e+00f,
-    5.206774235e+00f,
-    3.336523175e-01f,
-    2.819385231e-01f,
-    3.431757450e+00f,
-    3.493509054e+00f,
-    1.371523380e+00f,
-    4.425313473e-01f,
-    1.933255047e-01f,
-    3.271746635e+00f,
-    1.132380724e+00f,
-    1.288812280e+00f,
-    1.292467880e+01f,
-    1.188562965e+01f,
-    4.332828522e+00f,
-    4.553123951e+00f,
-    3.557770729e+00f,
-    8.823486328e+00f,
-    3.176378012e+00f,
-    1.514312267e+01f,
-    3.831922054e+00f,
-    1.098755836e+00f,
-    1.704730797e+01f,
-    1.236487961e+01f,
-    3.842529297e+00f,
-    2.504095078e+00f,
-    1.163296223e+00f,
-    2.632529259e+00f,
-    8.713290691e-01f,
-    5.034412742e-01f,
-    1.200292778e+01f,
-    2.162426710e+00f,
-    3.714746237e+00f,
-    5.610498190e-01f,
-    1.698964119e+00f,
-    3.541822731e-01f,
-    3.588106871e+00f,
-    2.008264303e+00f,
-    1.469299197e+00f,
-    1.429869771e+00f,
-    6.197987795e-01f,
-    4.418694675e-01f,
-    3.515066385e+00f,
-    7.689698339e-01f,
-    1.458457708e+00f,
-    3.749042749e+00f,
-    2.769601107e+00f,
-    4.711353302e+00f,
-    3.347988844e+00f,
-    1.294337177e+01f,
-    2.164803267e+00f,
-    1.249606133e+00f,
-    2.309268475e+00f,
-    4.697315216e+00f,
-    1.021571517e+00f,
-    3.995781183e+00f,
-    1.022858620e+00f,
-    5.204890728e+00f,
-    2.942922831e+00f,
-    1.525765777e+00f,
-    1.218555570e+00f,
-    2.187229633e+00f,
-    4.475752354e+00f,
-    8.987381458e-01f,
-    5.937747002e+00f,
-    5.083010674e+00f,
-    3.319598675e+00f,
-    4.706142426e+00f,
-    6.303303719e+00f,
-    3.472930670e+00f,
-    2.964203358e+00f,
-    5.135524750e+00f,
-    2.603917599e+00f,
-    6.107750893e+00f,
-    3.379677296e+00f,
-    3.086919069e+00f,
-    3.286277056e+00f,
-    3.063169718e+00f,
-    2.840124846e+00f,
-    5.431875706e+00f,
-    4.556670189e+00f,
-    6.416823387e+00f,
-    2.526385307e+00f,
-    4.662693024e+00f,
-    3.784741402e+00f,
-    3.144478798e+00f,
-    3.050879478e+00f,
-    1.066639543e+00f,
-    3.408067465e+00f,
-    1.171308756e+00f,
-    3.003117085e+00f,
-    1.537806749e+00f,
-    4.253611088e+00f,
-    4.397844374e-01f,
-    2.395313233e-01f,
-    4.209468365e+00f,
-    5.540557384e+00f,
-    1.572940469e+00f,
-    1.386805296e+00f,
-    7.266952395e-01f,
-    1.564296246e+00f,
-    3.191658258e+00f,
-    1.537729979e+00f,
-    6.127836108e-01f,
-    3.882826567e-01f,
-    1.547399879e+00f,
-    2.024205446e+00f,
-    1.432389975e+00f,
-    5.237742424e+00f,
-    1.818301678e+00f,
-    8.063421249e-01f,
-    1.623468280e+00f,
-    1.166883230e+00f,
-    1.313880086e+00f,
-    3.159884453e+00f,
-    2.322876453e+00f,
-    5.680271626e+00f,
-    1.020564318e+00f,
-    4.038786888e+00f,
-    1.314362645e+00f,
-    3.950738192e+00f,
-    1.274771333e+00f,
-    3.209076405e+00f,
-    2.834911942e-01f,
-    2.556345701e+00f,
-    8.126654625e-01f,
-    5.772115231e+00f,
-    2.874420881e-01f,
-    1.716939807e+00f,
-    1.046504378e+00f,
-    2.703964472e+00f,
-    1.302914619e+00f,
-    4.494692326e+00f,
-    1.109769702e+00f,
-    3.156797409e+00f,
-    2.115487576e+00f,
-    3.143372774e+00f,
-    3.777118921e-01f,
-    1.796420574e+00f,
-    1.232889891e+00f,
-    3.599052906e+00f,
-    1.637879848e+00f,
-    2.095121145e+00f,
-    4.052504063e+00f,
-    1.278413653e+00f,
-    4.320562363e+00f,
-    3.860573053e+00f,
-    3.227582693e+00f,
-    1.758084536e+00f,
-    1.534034014e+00f,
-    3.868218422e+00f,
-    7.565245628e+00f,
-    1.435035706e+00f,
-    1.461264610e+00f,
-    5.299608707e-01f,
-    5.522518635e+00f,
-    5.492383480e+00f,
-    4.784235001e+00f,
-    4.353132844e-01f,
-    7.973346710e-01f,
-    2.145266294e+00f,
-    3.143086433e+00f,
-    1.438270092e+00f,
-    1.199698329e+00f,
-    6.616790295e-01f,
-    8.177752495e+00f,
-    2.348626852e+00f,
-    3.704835415e+00f,
-    1.654142570e+01f,
-    1.097620010e+01f,
-    2.496112108e+00f,
-    1.779190660e+00f,
-    5.318216801e+00f,
-    6.210042477e+00f,
-    2.806411505e+00f,
-    7.753370285e+00f,
-    5.510408878e+00f,
-    1.244361687e+01f,
-    1.106789112e+01f,
-    8.587950706e+00f,
-    1.315324664e+00f,
-    3.606571674e+00f,
-    2.643020153e-01f,
-    3.580955505e+00f,
-    4.813490868e+00f,
-    3.557247877e+00f,
-    5.345475674e+00f,
-    6.525679111e+00f,
-    9.304061890e+00f,
-    5.085696220e+00f,
-    2.938514709e+00f,
-    1.517118359e+01f,
-    3.693089962e+00f,
-    6.127977848e+00f,
-    1.529466987e+00f,
-    2.568587661e-01f,
-    3.414062262e-01f,
-    4.210347652e+00f,
-    1.313763046e+01f,
-    1.297324085e+01f,
-    4.239991379e+01f,
-    2.414239693e+01f,
-    2.300570250e+00f,
-    2.882424164e+01f,
-    9.629872322e+00f,
-    1.391428471e+01f,
-    2.942753601e+01f,
-    2.098564386e+00f,
-    7.158172131e+00f,
-    1.072514057e+01f,
-    1.413089561e+01f,
-    1.109694481e+01f,
-    2.614176750e+01f,
-    2.970245123e+00f,
-    1.926847219e+00f,
-    7.784523487e+00f,
-    2.590394402e+01f,
-    1.664078331e+01f,
-    2.261115551e+00f,
-    4.941852093e+00f,
-    1.341958141e+01f,
-    2.440187454e+01f,
-    5.711356640e+00f,
-    3.473456144e+00f,
-    2.098312616e+00f,
-    1.105971622e+01f,
-    7.397189140e+00f,
-    5.890960217e+00f,
-    6.560785294e+00f,
-    6.182044029e+00f,
-    1.100271225e+00f,
-    1.436818480e+00f,
-    9.707781076e-01f,
-    9.737324715e+00f,
-    3.508425951e+00f,
-    3.627907753e+00f,
-    6.845381260e-01f,
-    5.578799844e-01f,
-    1.370992422e+00f,
-    7.138192654e+00f,
-    1.565210104e+00f,
-    1.218834877e+00f,
-    6.965768337e-01f,
-    3.056766033e+00f,
-    4.907934666e+00f,
-    7.348786354e+00f,
-    1.575925946e+00f,
-    6.947976351e-01f,
-    1.337883115e+00f,
-    3.313397169e+00f,
-    3.033733845e+00f,
-    4.680294418e+01f,
-    5.807761550e-01f,
-    2.130073929e+01f,
-    1.014934182e+00f,
-    1.096888781e-01f,
-    1.282298756e+01f,
-    1.475890827e+01f,
-    1.034788251e+00f,
-    2.582832336e+00f,
-    1.012108922e+00f,
-    7.817028761e-01f,
-    2.278794765e+00f,
-    2.174538612e+00f,
-    2.325554848e+00f,
-    1.152931094e+00f,
-    2.204921722e+00f,
-    1.206981063e+00f,
-    1.142541528e+00f,
-    3.430570126e+00f,
-    3.718717992e-01f,
-    1.056563616e+00f,
-    8.997440934e-01f,
-    3.953680694e-01f,
-    3.202847540e-01f,
-    4.553475380e+00f,
-    1.639174581e+00f,
-    4.197802544e+00f,
-    1.135740519e+00f,
-    2.238585353e-01f,
-    4.417275429e+00f,
-    3.896716356e+00f,
-    9.545093775e-01f,
-    3.080532849e-01f,
-    4.038163424e-01f,
-    4.427569389e+00f,
-    6.281487942e-01f,
-    1.326723337e+00f,
-    1.292131710e+01f,
-    9.534660339e+00f,
-    8.042526245e+00f,
-    1.798009157e+00f,
-    2.218354702e+00f,
-    1.363196945e+01f,
-    2.773858309e+00f,
-    6.355329990e+00f,
-    1.138647914e+00f,
-    1.023075104e+00f,
-    4.830720901e+00f,
-    5.260885715e+00f,
-    2.536151886e+00f,
-    1.476262331e+00f,
-    2.131653070e+00f,
-    6.693760157e-01f,
-    5.701576471e-01f,
-    7.302849293e-01f,
-    1.363451838e+00f,
-    9.674657583e-01f,
-    1.707212090e+00f,
-    4.275285900e-01f,
-    9.316962361e-01f,
-    6.634562612e-01f,
-    2.126168013e+00f,
-    7.197641134e-01f,
-    1.024159670e+00f,
-    7.621189952e-01f,
-    5.790257454e-01f,
-    5.281386375e-01f,
-    4.494318008e+00f,
-    1.706442595e+00f,
-    2.420509338e+00f,
-    6.024413109e-01f,
-    4.888251126e-01f,
-    1.979224682e+00f,
-    3.122251034e+00f,
-    2.353456020e+00f,
-    6.717889905e-01f,
-    4.056770802e-01f,
-    4.461296558e+00f,
-    1.592470765e+00f,
-    5.046307445e-01f,
-    3.404295146e-01f,
-    3.692574203e-01f,
-    8.563454151e-01f,
-    1.447350979e+00f,
-    1.116211176e+00f,
-    2.363744676e-01f,
-    3.870603561e+00f,
-    9.311143756e-01f,
-    6.632142067e+00f,
-    4.657391608e-01f,
-    2.068570852e+00f,
-    4.862797737e+00f,
-    2.410304642e+01f,
-    2.284653902e+00f,
-    1.815249681e+00f,
-    6.722531319e-01f,
-    1.054407954e+00f,
-    1.423306584e+00f,
-    1.072283149e+00f,
-    1.724764824e+00f,
-    8.695628357e+01f,
-    8.561128616e+00f,
-    2.524400473e+00f,
-    1.692948461e+00f,
-    6.800467968e-01f,
-    1.453096747e+00f,
-    4.292416573e+00f,
-    1.608315086e+01f,
-    3.743167639e+00f,
-    7.259622812e-01f,
-    3.676930666e-01f,
-    4.920549095e-01f,
-    8.062201142e-01f,
-    7.322704792e-01f,
-    8.717857003e-01f,
-    6.176786423e-01f,
-    5.764647007e+00f,
-    1.587371826e+00f,
-    2.652517080e+00f,
-    5.924327374e+00f,
-    6.349836826e+00f,
-    3.873245239e+00f,
-    7.644269466e+00f,
-    2.037646055e+00f,
-    6.176154137e+00f,
-    5.470026493e+00f,
-    2.244063616e+00f,
-    3.024239063e+00f,
-    1.652190781e+01f,
-    1.630173564e+00f,
-    9.806606293e+00f,
-    7.731370926e+00f,
-    3.970129490e+00f,
-    7.205081463e+00f,
-    6.896753311e+00f,
-    7.869162083e+00f,
-    9.521359444e+00f,
-    1.401330853e+01f,
-    1.006214333e+01f,
-    4.805746078e+01f,
-    5.231389999e+00f,
-    4.811956406e+00f,
-    2.880458069e+01f,
-    4.204145908e+00f,
-    7.507776022e-01f,
-    5.818133950e-01f,
-    5.337594748e-01f,
-    1.112453341e+00f,
-    7.322519422e-01f,
-    1.103139877e+00f,
-    4.947729111e+00f,
-    1.238404179e+01f,
-    4.733555317e+00f,
-    5.378836393e-01f,
-    5.920113921e-01f,
-    7.043248415e-01f,
-    8.886496544e+00f,
-    9.370330811e+00f,
-    1.526755047e+01f,
-    6.024231315e-01f,
-    2.121949792e-01f,
-    5.878738165e-01f,
-    1.779448867e+00f,
-    7.845218182e-01f,
-    5.544498563e-01f,
-    6.988253593e-01f,
-    5.139512062e+00f,
-    8.804644585e+00f,
-    1.028263474e+01f,
-    1.644705057e+00f,
-    1.431915879e+00f,
-    1.760874033e+00f,
-    1.374555302e+01f,
-    4.661990166e+00f,
-    2.039167480e+02f,
-    1.217451763e+01f,
-    9.091773987e+00f,
-    2.347452354e+01f,
-    1.181664181e+01f,
-    3.225228071e+00f,
-    3.838261032e+01f,
-    2.946939468e+01f,
-    1.215688229e+01f,
-    3.522034073e+01f,
-    1.302605391e+00f,
-    6.307502985e-01f,
-    1.418598175e+00f,
-    2.344773674e+01f,
-    1.452569675e+01f,
-    2.907507324e+02f,
-    7.628180981e-01f,
-    4.083352089e+00f,
-    1.856142879e+00f,
-    5.908648968e-01f,
-    6.202328682e+00f,
-    9.264876246e-01f,
-    1.219902039e+00f,
-    1.542366743e+00f,
-    2.472252697e-01f,
-    2.414769977e-01f,
-    2.288853073e+01f,
-    1.561427212e+01f,
-    1.464244366e+01f,
-    1.601730585e-01f,
-    3.555163741e-01f,
-    7.259747386e-02f,
-    2.940042913e-01f,
-    5.146664381e-01f,
-    4.771613181e-01f,
-    1.544438171e+01f,
-    8.964297295e+00f,
-    1.020872402e+01f,
-    1.534955055e-01f,
-    4.951130450e-01f,
-    3.382027745e-01f,
-    1.498415768e-01f,
-    2.884609103e-01f,
-    1.767206937e-01f,
-    1.699002075e+01f,
-    8.547423363e+00f,
-    1.034096050e+01f,
-    8.525537699e-02f,
-    5.921043754e-01f,
-    1.029215530e-01f,
-    2.193130106e-01f,
-    1.495641351e+00f,
-    7.992387772e+00f,
-    3.934489965e+00f,
-    1.102889538e+01f,
-    8.948627472e+00f,
-    3.989873409e+00f,
-    6.842042446e+00f,
-    4.038685799e+00f,
-    6.575248241e+00f,
-    1.951798677e+00f,
-    1.048228645e+01f,
-    5.069268703e+00f,
-    2.118724346e+00f,
-    2.299024105e+00f,
-    2.283450127e+00f,
-    1.221117783e+01f,
-    4.533368111e+00f,
-    1.386868191e+01f,
-    1.856216550e+00f,
-    3.632428646e+00f,
-    2.860098362e+00f,
-    1.297580242e+01f,
-    8.128172874e+00f,
-    5.971409798e+00f,
-    3.511654854e+00f,
-    4.019730759e+01f,
-    8.894618988e+00f,
-    5.412679195e+00f,
-    8.278815150e-01f,
-    2.041760206e+00f,
-    6.674593091e-01f,
-    3.090344667e-01f,
-    6.272795796e-01f,
-    5.473994613e-01f,
-    7.066307068e+00f,
-    3.812495708e+00f,
-    5.350624561e+00f,
-    7.128073573e-01f,
-    2.012664795e+00f,
-    4.859590828e-01f,
-    3.981244862e-01f,
-    3.418900371e-01f,
-    2.509517074e-01f,
-    1.765059090e+01f,
-    5.780676842e+00f,
-    1.185013962e+01f,
-    5.438734293e-01f,
-    2.794546127e+00f,
-    5.231547952e-01f,
-    2.866067290e-01f,
-    5.840826035e+00f,
-    3.097210884e+00f,
-    1.261910319e+00f,
-    4.322549820e+00f,
-    2.914159060e+00f,
-    1.452271938e+00f,
-    2.904828310e+00f,
-    1.869883776e+00f,
-    4.015077114e+00f,
-    3.512181520e+00f,
-    1.003726006e+00f,
-    3.429513931e+00f,
-    1.341699481e+00f,
-    1.684551716e+00f,
-    1.992969751e+00f,
-    5.995824933e-01f,
-    6.980051398e-01f,
-    3.616125286e-01f,
-    4.585315704e+00f,
-    5.023165226e+00f,
-    5.471575737e+00f,
-    2.159004211e+00f,
-    1.462117195e+00f,
-    1.408679366e+00f,
-    2.191416979e+00f,
-    1.312549353e+00f,
-    6.369203568e+00f,
-    1.911068797e+00f,
-    1.175138235e+00f,
-    1.533236790e+01f,
-    8.783764839e-01f,
-    2.517436743e+00f,
-    4.878296852e+00f,
-    1.525183678e+00f,
-    4.435321808e+00f,
-    3.805838823e+00f,
-    5.429467678e+00f,
-    4.841805458e+00f,
-    5.987650871e+00f,
-    4.087574959e+00f,
-    9.133810043e+00f,
-    6.539932251e+00f,
-    1.149899960e+01f,
-    3.898041964e+00f,
-    8.933696747e+00f,
-    5.846902847e+00f,
-    6.521170616e+00f,
-    9.921093941e+00f,
-    1.242814922e+01f,
-    2.824434996e+00f,
-    5.188282490e+00f,
-    1.182295203e+00f,
-    2.675729036e+00f,
-    2.612502575e+00f,
-    4.929357052e+00f,
-    2.641160727e+00f,
-    3.600639582e+00f,
-    2.792719126e+00f,
-    5.829422951e+00f,
-    1.288780928e+00f,
-    1.737972856e+00f,
-    1.637673497e+00f,
-    2.305386543e+00f,
-    2.992605925e+00f,
-    9.958423615e+00f,
-    1.588966131e+00f,
-    3.554311991e+00f,
-    3.388575554e+00f,
-    6.014122963e+00f,
-    4.043726921e+00f,
-    2.427069855e+01f,
-    5.036881924e+00f,
-    2.497904205e+01f,
-    2.153776741e+01f,
-    7.241127014e+00f,
-    1.791415215e+01f,
-    1.546234703e+01f,
-    1.278776836e+01f,
-    2.370062172e-01f,
-    8.775094748e-01f,
-    4.628193378e-01f,
-    1.334833950e-01f,
-    7.293349504e-01f,
-    8.399401903e-01f,
-    1.724506950e+01f,
-    1.009584999e+01f,
-    1.451370239e+01f,
-    1.304007649e+00f,
-    7.227822542e-01f,
-    5.678015351e-01f,
-    2.417213172e-01f,
-    3.982439339e-01f,
-    4.334127903e-01f,
-    1.178029537e+01f,
-    1.452640057e+01f,
-    6.713865757e+00f,
-    2.409774065e-01f,
-    4.621042609e-01f,
-    2.116771042e-01f,
-    3.519589603e-01f,
-    4.678769588e+00f,
-    1.698539257e+00f,
-    3.266780376e+00f,
-    1.417507887e+00f,
-    1.360185385e+00f,
-    2.323348761e+00f,
-    1.849959373e+00f,
-    1.237215400e+00f,
-    1.012875080e+00f,
-    2.370006800e+00f,
-    7.162546515e-01f,
-    2.003858566e+00f,
-    1.175543904e+00f,
-    1.313650846e+00f,
-    1.416998148e+00f,
-    1.185377955e+00f,
-    1.634008765e+00f,
-    5.819684267e-01f,
-    1.914210320e+00f,
-    4.216435909e+00f,
-    3.423039675e+00f,
-    2.369711876e+00f,
-    1.259982944e+00f,
-    6.877004623e+00f,
-    1.365227938e+00f,
-    1.042321110e+01f,
-    6.261125207e-01f,
-    5.935726762e-01f,
-    4.990618229e+00f,
-    5.379578471e-01f,
-    2.622164190e-01f,
-    4.759652138e+00f,
-    2.657499611e-01f,
-    1.830955744e-01f,
-    1.430830717e+00f,
-    8.792164326e-01f,
-    4.950495243e+00f,
-    1.872638464e+00f,
-    2.933542967e+00f,
-    7.083134651e-01f,
-    4.856875896e+00f,
-    7.007049322e-01f,
-    1.949320316e+00f,
-    1.303882837e+00f,
-    4.934603691e+00f,
-    9.221620560e-01f,
-    2.682927608e+00f,
-    2.403925657e+00f,
-    2.129049540e+00f,
-    6.035394192e+00f,
-    1.510792136e+00f,
-    1.121098518e+00f,
-    2.950540304e+00f,
-    1.257720280e+01f,
-    2.818719149e+00f,
-    1.249257803e+00f,
-    4.032765388e+00f,
-    1.501740217e+00f,
-    6.996911049e+00f,
-    4.566898823e+00f,
-    8.460131645e+00f,
-    2.672660351e+00f,
-    3.074354649e+00f,
-    2.662072897e+00f,
-    8.843904495e+00f,
-    1.217510414e+01f,
-    1.014019585e+01f,
-    3.764421463e+00f,
-    7.835710049e+00f,
-    1.575494766e+01f,
-    5.164370060e+00f,
-    2.408208609e+00f,
-    6.321880221e-01f,
-    6.972854733e-01f,
-    1.185250998e+00f,
-    1.013283253e+00f,
-    8.597196341e-01f,
-    1.863883209e+01f,
-    1.300018787e+01f,
-    1.403009415e+01f,
-    6.623182893e-01f,
-    6.066713333e-01f,
-    1.135831118e+00f,
-    7.058988094e+00f,
-    4.355971813e+00f,
-    4.775887012e+00f,
-    1.020386219e+00f,
-    2.991686165e-01f,
-    6.318461299e-01f,
-    1.010627985e+00f,
-    5.127903819e-01f,
-    1.194824338e+00f,
-    6.261218786e-01f,
-    9.060256958e+00f,
-    9.378059387e+00f,
-    1.290508270e+01f,
-    5.489534855e+00f,
-    1.352848053e+01f,
-    8.221735001e+00f,
-    1.139534950e+01f,
-    2.956656933e+00f,
-    5.126463413e+00f,
-    6.852139950e+00f,
-    9.896106720e+00f,
-    4.101021767e+00f,
-    1.357740879e+01f,
-    3.809894323e+00f,
-    6.938866615e+00f,
-    5.386259079e+00f,
-    3.182282209e+00f,
-    2.725566626e+00f,
-    8.686679840e+00f,
-    2.015378761e+01f,
-    1.972551346e+01f,
-    1.290930176e+01f,
-    3.588259506e+01f,
-    3.464387512e+01f,
-    1.769581437e+00f,
-    2.795238018e+00f,
-    3.931675911e+00f,
-    3.743999004e+00f,
-    3.902714252e+00f,
-    5.884189010e-01f,
-    7.972147465e-01f,
-    4.898612022e+00f,
-    4.300585270e+00f,
-    5.226402283e+00f,
-    4.180706501e+00f,
-    5.316140652e+00f,
-    3.166813612e+00f,
-    4.025995255e+00f,
-    6.205379486e+00f,
-    4.916332722e+00f,
-    5.814938545e+00f,
-    1.343632603e+01f,
-    6.128720760e+00f,
-    1.839737892e+00f,
-    4.805148244e-01f,
-    2.012416840e+00f,
-    1.067707062e+01f,
-    9.403663635e+00f,
-    2.024311256e+01f,
-    2.315657139e+00f,
-    1.378478813e+01f,
-    1.294724178e+01f,
-    2.155505371e+01f,
-    6.300136566e+00f,
-    8.634367943e+00f,
-    2.465281105e+01f,
-    1.227881813e+01f,
-    1.788581014e+00f,
-    1.659450722e+01f,
-    9.113711357e+00f,
-    1.341644955e+01f,
-    2.394503975e+01f,
-    1.822275925e+01f,
-    2.249424171e+01f,
-    5.473132324e+01f,
-    5.692799568e+00f,
-    9.028571129e+00f,
-    2.122829247e+01f,
-    1.999004745e+01f,
-    2.541592979e+01f,
-    8.287133789e+01f,
-    2.708021355e+01f,
-    2.890231323e+01f,
-    9.371086121e+01f,
-    3.493700743e+00f,
-    1.024474144e+01f,
-    3.298105001e+00f,
-    5.875282764e+00f,
-    9.549513817e+00f,
-    1.366629124e+01f,
-    7.461326599e+00f,
-    1.249128914e+01f,
-    3.893943310e+00f,
-    4.535527229e+00f,
-    7.857274055e+00f,
-    3.545073748e+00f,
-    5.711448193e+00f,
-    9.104728699e+00f,
-    8.066509247e+00f,
-    1.077448750e+01f,
-    2.293076277e+00f,
-    1.736795068e+00f,
-    1.508460402e+00f,
-    1.056688595e+01f,
-    2.076844215e+01f,
-    1.007003403e+01f,
-    4.842764854e+00f,
-    6.309648514e+00f,
-    1.031265640e+01f,
-    4.816116333e+00f,
-    9.111525536e+00f,
-    1.467110538e+01f,
-    5.735091686e+00f,
-    1.245128989e+00f,
-    5.595019460e-01f,
-    4.723809958e-01f,
-    2.530181408e+00f,
-    1.186267853e+00f,
-    1.123200536e+00f,
-    9.254219055e+00f,
-    1.335117912e+01f,
-    8.340894699e+00f,
-    8.710457683e-01f,
-    4.850959778e-01f,
-    1.290501595e+00f,
-    2.302092552e+00f,
-    7.772235870e+00f,
-    1.267087650e+01f,
-    4.378333688e-01f,
-    3.787451982e-01f,
-    6.138136983e-01f,
-    1.069772005e+00f,
-    1.602295160e+00f,
-    9.193689227e-01f,
-    8.523595333e-01f,
-    7.531248569e+00f,
-    3.220577717e+00f,
-    2.637210083e+01f,
-    1.662915111e+00f,
-    2.322361946e+00f,
-    1.542451620e+00f,
-    1.010966206e+01f,
-    1.007588863e+00f,
-    8.905878067e+00f,
-    1.015960407e+01f,
-    6.288934708e+00f,
-    3.477585983e+01f,
-    8.104485512e+00f,
-    1.100905165e-01f,
-    7.019816875e+00f,
-    6.856706142e+00f,
-    2.952142954e+00f,
-    3.744020081e+01f,
-    1.509683013e+00f,
-    9.607666731e-01f,
-    8.278731704e-01f,
-    1.508793736e+01f,
-    4.271644056e-01f,
-    3.754649734e+01f,
-    1.211339593e+00f,
-    1.272781372e+00f,
-    1.177072287e+00f,
-    1.035248637e+00f,
-    7.463024855e-01f,
-    1.069764900e+01f,
-    2.018204927e+00f,
-    1.159656048e+00f,
-    5.032781124e+00f,
-    4.759549201e-01f,
-    2.136568785e+00f,
-    1.051898718e+00f,
-    3.310621977e+00f,
-    8.844412804e+00f,
-    1.659001350e+01f,
-    1.086429715e+00f,
-    1.134809852e+00f,
-    1.462916613e+00f,
-    2.419542223e-01f,
-    1.890137672e+01f,
-    9.376561165e+00f,
-    8.862160683e+00f,
-    1.646167487e-01f,
-    4.263346493e-01f,
-    2.556942105e-01f,
-    1.396729201e-01f,
-    5.683975816e-01f,
-    6.714842319e-01f,
-    1.446953201e+01f,
-    8.315280914e+00f,
-    5.817945862e+01f,
-    3.167799115e-01f,
-    7.111540437e-01f,
-    1.254490972e+00f,
-    1.747288257e-01f,
-    4.264926314e-01f,
-    5.102639198e-01f,
-    1.250303173e+01f,
-    4.104397297e+00f,
-    1.727185631e+01f,
-    1.641272157e-01f,
-    8.659474850e-01f,
-    1.607604772e-01f,
-    4.845062196e-01f,
-    1.056956768e+00f,
-    4.324160099e+00f,
-    1.800670385e+00f,
-    3.526870728e+00f,
-    3.363436937e+00f,
-    2.444830179e+00f,
-    4.316983223e+00f,
-    1.871114254e+00f,
-    4.218669891e+00f,
-    1.950384855e+00f,
-    9.077385902e+00f,
-    1.292722106e+00f,
-    1.365724325e+00f,
-    2.095967054e+00f,
-    1.144803047e+00f,
-    8.417367935e+00f,
-    5.602870941e+00f,
-    1.144137669e+01f,
-    1.034158111e+00f,
-    2.838770628e+00f,
-    1.804092526e+00f,
-    2.184275627e+00f,
-    3.684177637e+00f,
-    4.645522118e+00f,
-    5.596794605e+00f,
-    5.597096920e+00f,
-    3.978131771e+00f,
-    3.759184599e+00f,
-    1.407326937e+00f,
-    1.741301298e+00f,
-    2.361678362e+00f,
-    4.476883113e-01f,
-    7.263343930e-01f,
-    1.380455136e+00f,
-    2.826420069e+00f,
-    4.494241714e+00f,
-    1.911948800e+00f,
-    2.228171825e+00f,
-    1.870393157e+00f,
-    1.095883489e+00f,
-    3.367899060e-01f,
-    8.393481374e-01f,
-    8.150041103e-01f,
-    2.691148043e+00f,
-    1.921554565e+00f,
-    2.605972528e+00f,
-    2.167278767e+00f,
-    1.470353723e+00f,
-    8.373808265e-01f,
-    4.144599140e-01f,
-    9.324146271e+00f,
-    1.137131214e+01f,
-    6.544454098e+00f,
-    2.627626359e-01f,
-    6.228070259e-01f,
-    4.998815954e-01f,
-    4.831822217e-01f,
-    1.504705191e+00f,
-    7.627339363e-01f,
-    6.559748173e+00f,
-    3.367032290e+00f,
-    9.230020523e+00f,
-    7.094900012e-01f,
-    6.809756160e-01f,
-    1.238791704e+00f,
-    3.937768340e-01f,
-    7.526001930e-01f,
-    4.852006137e-01f,
-    1.076664448e+01f,
-    1.541153145e+01f,
-    1.462383080e+01f,
-    5.294194818e-01f,
-    1.129262328e+00f,
-    7.313442826e-01f,
-    4.421706796e-01f,
-    6.908877850e+00f,
-    2.185958475e-01f,
-    3.903493881e-01f,
-    1.100847530e+01f,
-    1.199513316e+00f,
-    4.974670708e-01f,
-    3.242886066e+00f,
-    2.487391829e-01f,
-    4.391204119e-01f,
-    1.198451161e+00f,
-    6.272181869e-01f,
-    1.336772084e+00f,
-    1.045910835e+00f,
-    2.361672163e+00f,
-    2.456134558e+00f,
-    3.065685272e+00f,
-    3.187292099e+00f,
-    5.487368703e-01f,
-    2.339007378e+00f,
-    8.849773407e-01f,
-    6.389634013e-01f,
-    1.286261559e+00f,
-    2.584297895e+00f,
-    1.096993089e+00f,
-    7.936972380e-01f,
-    8.352591991e-01f,
-    3.761166930e-01f,
-    3.281717002e-01f,
-    3.189962804e-01f,
-    2.661256313e+00f,
-    6.887977719e-01f,
-    2.684644938e+00f,
-    3.704745054e+00f,
-    4.208116055e+00f,
-    7.541663051e-01f,
-    1.059151840e+01f,
-    1.189841032e+00f,
-    1.395187736e+00f,
-    1.477465034e+00f,
-    1.080042720e+00f,
-    3.537560225e+00f,
-    1.100748181e+00f,
-    5.266612053e+00f,
-    5.050724745e-01f,
-    1.514269829e+00f,
-    4.528498054e-01f,
-    6.601725221e-01f,
-    1.414615035e+00f,
-    2.057028770e+00f,
-    1.047894001e+00f,
-    6.882568359e+00f,
-    3.298022151e-01f,
-    2.678463936e+00f,
-    3.200562298e-01f,
-    2.624351263e+00f,
-    2.402456760e+00f,
-    1.284279585e+00f,
-    1.219396710e+00f,
-    5.468415737e+00f,
-    6.758239865e-01f,
-    2.688322783e+00f,
-    2.263276339e+00f,
-    9.768623114e-01f,
-    1.058472276e+00f,
-    1.270577431e+00f,
-    5.630712509e+00f,
-    1.352525353e+00f,
-    9.456458092e-01f,
-    1.231139660e+00f,
-    7.329814434e-01f,
-    4.334787428e-01f,
-    2.631800890e+00f,
-    2.204635620e+00f,
-    1.215790391e+00f,
-    7.179538608e-01f,
-    6.414877176e-01f,
-    1.085345626e+00f,
-    1.017852068e+00f,
-    4.358555317e+00f,
-    2.885812759e+00f,
-    4.565762043e+00f,
-    5.252788067e+00f,
-    3.679523468e+00f,
-    2.457816362e+00f,
-    6.611738682e+00f,
-    7.114858627e-01f,
-    1.037396622e+01f,
-    5.239135742e+00f,
-    6.959052086e-01f,
-    8.527100682e-01f,
-    9.045336246e-01f,
-    9.834358692e-01f,
-    5.537862778e-01f,
-    1.297151208e+00f,
-    1.238174438e+00f,
-    1.563486814e+00f,
-    1.023479104e+00f,
-    1.095170856e+00f,
-    5.041456819e-01f,
-    1.493713021e+00f,
-    1.910341978e+00f,
-    1.577364206e+00f,
-    1.025202394e+00f,
-    6.903353333e-01f,
-    5.158267617e-01f,
-    5.170366168e-01f,
-    3.080191135e+00f,
-    1.642559767e+00f,
-    5.680783391e-01f,
-    4.253015816e-01f,
-    4.949104190e-01f,
-    7.725419402e-01f,
-    1.456409693e+00f,
-    9.391494393e-01f,
-    3.986091316e-01f,
-    1.102651954e+00f,
-    1.159374118e+00f,
-    2.671571076e-01f,
-    1.353601694e+00f,
-    6.448072195e-02f,
-    2.129180670e+00f,
-    8.068510294e-01f,
-    5.848187447e+00f,
-    5.032709599e+00f,
-    1.256953716e+01f,
-    6.900406361e+00f,
-    5.271473885e+00f,
-    3.787825108e+00f,
-    2.574109077e+00f,
-    1.120744801e+01f,
-    9.240878105e+00f,
-    3.590397358e+00f,
-    2.903259754e+00f,
-    1.199856162e+00f,
-    1.722875595e+00f,
-    5.851604939e-01f,
-    8.557468057e-01f,
-    2.402081043e-01f,
-    1.348475099e+00f,
-    1.365885854e+00f,
-    2.005033016e+00f,
-    5.308760405e-01f,
-    1.832693577e+00f,
-    1.421985745e+00f,
-    4.394028664e+00f,
-    1.916218519e+00f,
-    4.885936260e+00f,
-    8.147517204e+00f,
-    3.459694624e+00f,
-    6.673899651e+00f,
-    4.561877728e+00f,
-    5.766881943e+00f,
-    3.549388170e+00f,
-    3.236972570e+00f,
-    7.748634338e+00f,
-    8.060199738e+00f,
-    1.085929775e+01f,
-    5.743514538e+00f,
-    4.729827404e+00f,
-    2.276681423e+00f,
-    3.796397924e+00f,
-    1.014953375e+00f,
-    6.918597221e-01f,
-    4.070381165e+00f,
-    3.697102308e+00f,
-    5.108669400e-01f,
-    1.024187684e+00f,
-    8.917838335e-01f,
-    8.032109141e-01f,
-    3.232088685e-01f,
-    5.439907908e-01f,
-    2.608820498e-01f,
-    1.921689987e+00f,
-    1.616602421e+00f,
-    8.644657731e-01f,
-    3.477010429e-01f,
-    3.368196189e-01f,
-    3.872300386e-01f,
-    3.706874371e+00f,
-    4.119094372e+00f,
-    1.637823701e+00f,
-    2.195890665e+00f,
-    1.975159168e+00f,
-    2.426794767e+00f,
-    4.113714695e+00f,
-    3.896825552e+00f,
-    1.509164810e+00f,
-    2.837353468e+00f,
-    5.167867541e-01f,
-    1.639294505e+00f,
-    1.055555463e+00f,
-    7.979187369e-01f,
-    1.690265417e+00f,
-    2.571939528e-01f,
-    2.083924532e+00f,
-    1.181002975e+00f,
-    5.038421750e-01f,
-    1.271771550e+00f,
-    5.466406345e-01f,
-    1.166213751e+00f,
-    9.153666496e-01f,
-    2.058582067e+00f,
-    1.945147663e-01f,
-    3.528144360e-01f,
-    3.237923622e+00f,
-    2.260242653e+01f,
-    7.062825680e+00f,
-    2.885976553e+00f,
-    7.245181561e+00f,
-    1.732467771e+00f,
-    2.954195023e+00f,
-    8.575232029e-01f,
-    2.401867151e+00f,
-    3.052773178e-01f,
-    9.227695465e-01f,
-    6.353403091e+00f,
-    8.919425011e+00f,
-    6.174664974e+00f,
-    2.281579018e+00f,
-    5.240161419e+00f,
-    5.252582550e+00f,
-    3.144060135e+00f,
-    1.300967598e+01f,
-    1.545520401e+01f,
-    2.865746260e+00f,
-    2.767770052e+00f,
-    5.621865273e+00f,
-    1.860847473e+01f,
-    8.821321487e+00f,
-    5.791748524e+00f,
-    5.766826630e+00f,
-    9.677600861e+00f,
-    1.611502457e+01f,
-    1.879876518e+01f,
-    4.539279556e+01f,
-    2.215686989e+01f,
-    7.722991943e+00f,
-    2.964840508e+01f,
-    7.612339973e+00f,
-    3.720438719e+00f,
-    1.900430679e+01f,
-    3.160459757e+00f,
-    1.135685158e+01f,
-    6.906121373e-01f,
-    1.176244497e+00f,
-    9.772320986e-01f,
-    1.854832768e+00f,
-    2.592983842e-01f,
-    1.002243757e+00f,
-    1.762674212e+00f,
-    5.842640996e-01f,
-    1.016603708e+00f,
-    3.533764482e-01f,
-    6.586549282e-01f,
-    5.021066070e-01f,
-    1.470816731e+00f,
-    4.305319488e-01f,
-    3.664321661e+00f,
-    2.036566436e-01f,
-    9.383323044e-02f,
-    4.897259176e-01f,
-    6.441461295e-02f,
-    5.751385689e+00f,
-    1.824270821e+01f,
-    5.163391876e+01f,
-    1.925466537e+00f,
-    1.190689373e+01f,
-    1.119876194e+01f,
-    1.073242283e+01f,
-    2.540301323e+00f,
-    2.736883402e+00f,
-    2.016769171e+00f,
-    4.901420176e-01f,
-    1.192586184e+00f,
-    1.905636072e+00f,
-    1.510008931e+00f,
-    6.441686153e-01f,
-    7.498185039e-01f,
-    8.423284292e-01f,
-    2.497253180e+00f,
-    4.588271332e+01f,
-    5.586027503e-01f,
-    7.751159072e-01f,
-    1.365159988e+00f,
-    1.087143779e+00f,
-    9.886958599e-01f,
-    1.396459341e+00f,
-    2.804687321e-01f,
-    7.097967863e-01f,
-    1.178814769e+00f,
-    2.782466650e+00f,
-    5.089154243e-01f,
-    2.144655943e+00f,
-    4.453695416e-01f,
-    4.184650779e-01f,
-    8.681287169e-01f,
-    4.853730202e+00f,
-    8.708547950e-01f,
-    1.329799414e+00f,
-    8.364933133e-01f,
-    2.568490505e+00f,
-    1.255957484e+00f,
-    8.872848153e-01f,
-    1.120882392e+00f,
-    1.894114971e+00f,
-    1.466789961e+00f,
-    2.679086924e+00f,
-    9.816822052e+00f,
-    2.594927549e+00f,
-    2.896688938e+00f,
-    3.355213881e+00f,
-    1.193885326e+00f,
-    1.301254392e+00f,
-    3.289003611e+00f,
-    3.721144438e+00f,
-    1.996713400e+00f,
-    1.446733236e+00f,
-    7.617341518e+00f,
-    1.020322084e+00f,
-    8.426344395e-01f,
-    5.025188923e-01f,
-    2.071916580e+00f,
-    2.258352757e+00f,
-    1.152961135e+00f,
-    1.216381788e+00f,
-    3.923420191e+00f,
-    5.447452664e-01f,
-    4.431275129e-01f,
-    4.342927635e-01f,
-    2.523013353e+00f,
-    3.652733564e+00f,
-    5.528149605e+00f,
-    1.499170423e+00f,
-    7.783436775e-01f,
-    1.581884980e+00f,
-    2.505533218e+00f,
-    4.206408978e+00f,
-    1.089061928e+01f,
-    1.164624333e+00f,
-    4.574363232e+00f,
-    4.851715088e+00f,
-    1.242581487e+00f,
-    4.392325282e-01f,
-    8.699938655e-01f,
-    2.531019449e+00f,
-    1.230553865e+00f,
-    4.461698532e+00f,
-    1.217859507e+00f,
-    6.305431724e-01f,
-    2.067121983e+00f,
-    2.265192986e+00f,
-    9.253127575e-01f,
-    3.854247332e-01f,
-    1.059703678e-01f,
-    1.901967525e+00f,
-    1.418891549e+00f,
-    1.004150808e-01f,
-    5.212765336e-01f,
-    2.501246452e+00f,
-    3.344937563e+00f,
-    8.863001823e+00f,
-    6.793565750e+00f,
-    8.656970024e+00f,
-    4.875866890e+00f,
-    1.320835948e+00f,
-    8.687860489e+00f,
-    6.783055305e+00f,
-    2.110290527e+00f,
-    1.093635941e+01f,
-    1.653945208e+00f,
-    7.253900051e+00f,
-    1.465934873e+00f,
-    2.786952496e+00f,
-    2.285972983e-01f,
-    1.142484426e+00f,
-    3.430312872e-01f,
-    7.134039402e+00f,
-    1.564385533e+00f,
-    1.024175644e+00f,
-    3.238869011e-01f,
-    3.479966223e-01f,
-    1.977412105e-01f,
-    7.792075634e+00f,
-    1.060420394e+00f,
-    1.794557571e+00f,
-    2.105253696e+00f,
-    5.002150059e+00f,
-    1.977572560e+00f,
-    1.459398746e+00f,
-    3.037820339e+00f,
-    4.049448013e+00f,
-    6.477724075e+00f,
-    2.015107870e+00f,
-    3.951366901e+00f,
-    3.979161501e+00f,
-    2.607537031e+00f,
-    8.919172287e+00f,
-    2.319430113e+00f,
-    7.753584862e+00f,
-    5.281906605e+00f,
-    5.018937588e+00f,
-    4.691054821e+00f,
-    5.014859200e+00f,
-    1.270950794e+00f,
-    2.085863352e+00f,
-    3.578561068e+00f,
-    1.783287883e+00f,
-    2.341391087e+00f,
-    4.570714951e+00f,
-    1.373496175e+00f,
-    8.189040422e-01f,
-    1.606202483e+00f,
-    3.352988720e+00f,
-    2.888905525e+00f,
-    1.926522851e+00f,
-    8.428481221e-01f,
-    1.976465344e+00f,
-    2.675590515e+00f,
-    2.714226723e+00f,
-    1.075211763e+00f,
-    2.107986212e+00f,
-    2.613994598e+00f,
-    2.892822981e+00f,
-    1.609348416e+00f,
-    6.284188032e-01f,
-    3.847014606e-01f,
-    3.581057549e+00f,
-    1.641358018e+00f,
-    1.308750033e+00f,
-    3.947583437e-01f,
-    3.335785568e-01f,
-    1.150629520e+00f,
-    6.391500831e-01f,
-    5.872983336e-01f,
-    3.975499630e+00f,
-    3.841356516e+00f,
-    1.539574504e+00f,
-    2.661093473e+00f,
-    1.076509237e+00f,
-    3.274758577e+00f,
-    3.069636583e+00f,
-    6.556585789e+00f,
-    2.538600206e+00f,
-    3.741157532e+00f,
-    2.874684334e+00f,
-    2.712164879e+00f,
-    3.840537667e-01f,
-    3.259221911e-01f,
-    3.221686840e+00f,
-    5.054717541e+00f,
-    1.816364646e+00f,
-    9.574024081e-01f,
-    9.982740283e-01f,
-    1.644331813e+00f,
-    1.299267292e+00f,
-    2.609351635e+00f,
-    9.202345014e-01f,
-    2.585055530e-01f,
-    1.801732898e+00f,
-    1.072154045e+00f,
-    3.412294149e+00f,
-    2.682729483e+00f,
-    3.317902088e-01f,
-    5.084534168e+00f,
-    1.637177169e-01f,
-    6.185901165e-01f,
-    5.226628304e+00f,
-    1.203024745e+00f,
-    2.698901653e+00f,
-    3.011908054e+00f,
-    3.686035872e+00f,
-    8.194054365e-01f,
-    3.318418741e+00f,
-    1.188430548e+00f,
-    1.657835245e+00f,
-    3.458201289e-01f,
-    1.275295019e+00f,
-    3.186489105e+00f,
-    1.182321072e+01f,
-    1.123657322e+01f,
-    1.521012902e+00f,
-    4.283424377e+00f,
-    6.899283409e+00f,
-    2.663984776e+00f,
-    2.113245487e+00f,
-    4.363065720e+00f,
-    4.706789970e+00f,
-    1.007826805e+01f,
-    4.850500584e+00f,
-    2.479738235e+00f,
-    2.308457851e+00f,
-    9.679117203e+00f,
-    1.127978611e+01f,
-    4.197433472e+00f,
-    1.239618874e+01f,
-    2.812810659e+00f,
-    8.642117500e+00f,
-    3.858252525e+00f,
-    8.607052803e+00f,
-    1.459059620e+01f,
-    9.882757568e+01f,
-    9.824091911e+00f,
-    1.834447503e+00f,
-    1.613588524e+01f,
-    9.220381737e+00f,
-    1.774744225e+01f,
-    3.466149139e+01f,
-    1.034818649e+00f,
-    2.525595188e+00f,
-    9.932126999e+00f,
-    1.125931740e+01f,
-    3.874650478e+00f,
-    1.632930565e+01f,
-    1.881601572e+00f,
-    1.767938495e+00f,
-    1.237710118e+00f,
-    7.951914668e-01f,
-    6.601828933e-01f,
-    3.945385933e+00f,
-    1.017565489e+00f,
-    4.153414369e-01f,
-    9.150586724e-01f,
-    1.163637161e+00f,
-    7.453591824e-01f,
-    3.836287737e+00f,
-    1.079283237e+00f,
-    1.295181751e+00f,
-    1.580972195e+00f,
-    2.142377138e+00f,
-    2.591610432e+00f,
-    1.022871208e+01f,
-    5.083610862e-02f,
-    4.343219280e+00f,
-    4.662222862e+00f,
-    1.596276522e+00f,
-    1.299430728e+00f,
-    9.306268096e-01f,
-    2.842030860e-02f,
-    5.596389294e+00f,
-    6.010689259e+00f,
-    4.591471672e+00f,
-    1.916662455e+00f,
-    1.424368477e+01f,
-    6.492349148e+00f,
-    8.896803856e+00f,
-    7.979955673e-01f,
-    1.082149386e+00f,
-    2.352632904e+01f,
-    2.057781029e+01f,
-    3.386284590e+00f,
-    2.058080435e+00f,
-    3.371745586e+00f,
-    2.323410273e+00f,
-    1.049003220e+01f,
-    1.432802200e+00f,
-    6.470702887e-01f,
-    1.091480136e+00f,
-    7.916812301e-01f,
-    6.664041877e-01f,
-    8.973681331e-01f,
-    9.495781064e-01f,
-    1.928605914e+00f,
-    4.918273449e+00f,
-    7.716647387e-01f,
-    1.987950087e+00f,
-    3.228091478e+00f,
-    2.801337957e+00f,
-    2.046348095e+00f,
-    4.767802656e-01f,
-    1.131502032e+00f,
-    2.631569386e+00f,
-    7.328652740e-01f,
-    5.665103793e-01f,
-    4.463154674e-01f,
-    3.316498280e+00f,
-    8.221772313e-01f,
-    4.343187332e+00f,
-    2.049393803e-01f,
-    1.305501342e+00f,
-    3.929954290e+00f,
-    1.673624420e+01f,
-    1.989722133e+00f,
-    1.572486043e+00f,
-    4.056882858e-01f,
-    7.006644011e-01f,
-    1.235019326e+00f,
-    1.267457604e+00f,
-    1.493341684e+00f,
-    2.426355124e+00f,
-    5.571127415e+00f,
-    1.504966319e-01f,
-    5.188611746e-01f,
-    9.162274599e-01f,
-    3.779996336e-01f,
-    3.426105499e+00f,
-    4.097118974e-01f,
-    9.200427532e-01f,
-    8.890615702e-01f,
-    8.439969063e+00f,
-    1.512215614e+00f,
-    5.369915962e+00f,
-    3.640521288e+00f,
-    6.165241241e+00f,
-    2.338443041e+00f,
-    1.031269264e+01f,
-    3.186840534e+00f,
-    4.474999428e+00f,
-    8.300587654e+00f,
-    1.188347816e+00f,
-    3.076927900e+00f,
-    9.785926819e+00f,
-    1.679960060e+01f,
-    1.200329685e+01f,
-    1.283405399e+01f,
-    6.148702145e+00f,
-    1.526578903e+01f,
-    3.419712782e+00f,
-    1.537978292e+00f,
-    3.046235323e+00f,
-    6.983965397e+00f,
-    8.756490707e+00f,
-    4.401266098e+00f,
-    6.144044399e+00f,
-    3.451192141e+00f,
-    6.631865501e+00f,
-    7.749740601e+00f,
-    2.330145836e+00f,
-    3.214912033e+01f,
-    1.001515865e+01f,
-    8.775099516e-01f,
-    4.557165802e-01f,
-    4.390645623e-01f,
-    1.114052892e+00f,
-    5.015411973e-01f,
-    1.018651009e+00f,
-    9.191467285e+00f,
-    8.555017471e+00f,
-    7.837251663e+00f,
-    3.052322567e-01f,
-    1.252031475e-01f,
-    3.498758674e-01f,
-    6.215219498e-01f,
-    1.029087424e+00f,
-    7.797852755e-01f,
-    6.816390038e+00f,
-    7.053946018e+00f,
-    4.410552502e+00f,
-    1.847993970e+00f,
-    3.450964987e-01f,
-    7.035208941e-01f,
-    5.062370896e-01f,
-    9.223209023e-01f,
-    3.060351312e-01f,
-    6.539536715e-01f,
-    1.145069313e+01f,
-    2.548147678e+00f,
-    1.071672535e+01f,
-    1.682637811e+00f,
-    1.264275193e+00f,
-    1.066994548e+00f,
-    1.795381546e+01f,
-    1.339331746e+00f,
-    9.197723389e+01f,
-    6.903357029e+00f,
-    6.843532085e+00f,
-    1.250583172e+01f,
-    8.535032272e-01f,
-    8.886415362e-01f,
-    3.891546428e-01f,
-    1.096831322e+01f,
-    1.061131954e+00f,
-    1.979400253e+01f,
-    6.181833744e+00f,
-    3.926198244e+00f,
-    2.080782890e+01f,
-    1.552891016e+00f,
-    1.162683487e+00f,
-    1.871308446e+00f,
-    7.621603489e+00f,
-    1.818663955e+00f,
-    2.349319649e+01f,
-    3.658454120e-01f,
-    2.600816011e+00f,
-    1.902966261e+00f,
-    3.657086194e-01f,
-    4.014540672e+00f,
-    2.492760718e-01f,
-    3.522775173e-01f,
-    9.559520483e-01f,
-    4.695359170e-01f,
-    3.179886341e-01f,
-    3.427557647e-01f,
-    7.147900760e-02f,
-    9.637754411e-02f,
-    9.542023391e-02f,
-    1.842020798e+01f,
-    1.493889999e+01f,
-    1.358270168e+01f,
-    1.330051869e-01f,
-    1.088353768e-01f,
-    6.911063194e-02f,
-    3.165803254e-01f,
-    1.803599149e-01f,
-    6.594198704e+00f,
-    4.273578644e+00f,
-    1.070073247e+00f,
-    2.938746810e-01f,
-    1.415683329e-01f,
-    4.045095921e+00f,
-    1.178771183e-01f,
-    8.497332782e-02f,
-    1.360583115e+01f,
-    9.443030357e+00f,
-    3.724458218e+00f,
-    4.088266850e+00f,
-    5.537305832e+00f,
-    1.923761964e+00f,
-    1.373266983e+01f,
-    5.640016556e+00f,
-    1.581553650e+01f,
-    5.385253906e+00f,
-    4.124711514e+00f,
-    7.008488655e+00f,
-    2.402264833e+00f,
-    5.340161324e+00f,
-    3.308405399e+00f,
-    1.683856487e+00f,
-    2.375980854e+00f,
-    1.201015830e+00f,
-    1.197226620e+01f,
-    9.126431465e+00f,
-    6.916969299e+00f,
-    1.986516237e+00f,
-    1.833018780e+00f,
-    2.388166666e+00f,
-    3.536270142e+01f,
-    4.069083214e+00f,
-    2.297222137e+01f,
-    4.653275967e+00f,
-    2.571357489e-01f,
-    3.272303343e-01f,
-    1.231587678e-01f,
-    3.744746017e+01f,
-    7.503693581e+00f,
-    9.570622444e+00f,
-    4.044094980e-01f,
-    1.024319053e+00f,
-    5.246931911e-01f,
-    2.350497097e-01f,
-    5.754608512e-01f,
-    3.689915836e-01f,
-    6.567047596e+00f,
-    4.395658016e+00f,
-    2.426385403e+00f,
-    5.696591735e-01f,
-    9.450805187e-01f,
-    5.151947737e-01f,
-    2.335986495e-01f,
-    4.059055746e-01f,
-    1.780622452e-01f,
-    3.117524338e+01f,
-    2.881738424e+00f,
-    6.661763668e+00f,
-    4.130657613e-01f,
-    2.251589298e+00f,
-    3.318077028e-01f,
-    2.100365758e-01f,
-    2.720729113e+00f,
-    4.195488453e+00f,
-    4.500186920e+00f,
-    9.291641712e-01f,
-    1.087582588e+01f,
-    4.455163002e+00f,
-    2.171990156e+00f,
-    4.035434246e+00f,
-    4.000064373e+00f,
-    5.839450359e+00f,
-    2.694633961e+00f,
-    8.042681694e+00f,
-    5.271012783e+00f,
-    4.007654667e+00f,
-    5.191691399e+00f,
-    3.709701300e+00f,
-    1.803446889e+00f,
-    3.512228012e+00f,
-    2.733959436e+00f,
-    6.361002445e+00f,
-    2.516622305e+00f,
-    8.985854149e+00f,
-    1.767743587e+00f,
-    2.403650761e+00f,
-    4.598289013e+00f,
-    5.869175911e+00f,
-    3.173244715e+00f,
-    1.411672211e+01f,
-    4.788461685e+00f,
-    2.229149580e+00f,
-    2.852363825e+00f,
-    5.704504967e+00f,
-    1.814208150e+00f,
-    3.658885002e+00f,
-    7.597169876e+00f,
-    4.517579079e+00f,
-    2.407351494e+01f,
-    6.056101322e+00f,
-    3.273601294e+00f,
-    7.153946877e+00f,
-    2.685501099e+00f,
-    3.192737103e+00f,
-    7.148527622e+00f,
-    5.600543499e+00f,
-    6.503707409e+00f,
-    2.398392105e+01f,
-    1.383532619e+01f,
-    5.395113230e-01f,
-    9.375700355e-01f,
-    4.726461470e-01f,
-    5.879443169e+00f,
-    4.461838245e+00f,
-    2.482327700e+00f,
-    1.345207214e+00f,
-    2.700101137e+00f,
-    1.771940827e+00f,
-    1.634628892e+00f,
-    1.069075942e+00f,
-    5.760701180e+00f,
-    6.758672237e+00f,
-    5.864492893e+00f,
-    7.024401665e+00f,
-    7.869452834e-01f,
-    8.282858849e+00f,
-    1.509590387e+00f,
-    2.394943535e-01f,
-    9.361806512e-02f,
-    1.414727420e-01f,
-    2.493755817e-01f,
-    1.810071564e+01f,
-    1.188549709e+01f,
-    6.642073154e+00f,
-    1.906683892e-01f,
-    1.869378537e-01f,
-    1.509412974e-01f,
-    1.583903432e-01f,
-    6.763222218e-01f,
-    2.503997982e-01f,
-    1.117068195e+01f,
-    6.630105019e+00f,
-    3.962421179e+00f,
-    2.966225445e-01f,
-    5.442706943e-01f,
-    4.333788753e-01f,
-    1.686760038e-01f,
-    3.373322487e-01f,
-    3.202349544e-01f,
-    1.273192596e+01f,
-    1.132734394e+01f,
-    5.573709011e+00f,
-    1.095304340e-01f,
-    6.420987844e-01f,
-    1.251980662e-01f,
-    1.567875147e-01f,
-    1.258603954e+01f,
-    4.638893127e+00f,
-    4.422816277e+00f,
-    1.637805581e+00f,
-    1.634679556e+00f,
-    1.175045133e+00f,
-    4.388733864e+00f,
-    1.708975196e+00f,
-    3.147401571e+00f,
-    8.635901451e+00f,
-    2.720067501e+00f,
-    3.901260138e+00f,
-    7.742611885e+00f,
-    1.355293846e+01f,
-    4.147989273e+00f,
-    5.240754128e+00f,
-    3.848582029e+00f,
-    4.479424477e+00f,
-    8.623050690e+00f,
-    4.318912983e+00f,
-    3.803678989e+00f,
-    2.771703482e+00f,
-    4.084276676e+00f,
-    1.557843924e+00f,
-    2.218100548e+00f,
-    1.060556054e+00f,
-    2.855064392e+00f,
-    3.948021173e+00f,
-    1.586320996e-01f,
-    2.593660057e-01f,
-    2.754715681e-01f,
-    3.462859631e+00f,
-    5.027137756e+00f,
-    2.933804035e+00f,
-    1.391951799e+00f,
-    6.926072240e-01f,
-    9.799564481e-01f,
-    6.292494535e-01f,
-    4.474279881e-01f,
-    6.620724201e-01f,
-    3.225433588e+00f,
-    2.215024948e+00f,
-    2.085613251e+00f,
-    1.490564346e+00f,
-    1.100143313e+00f,
-    1.609302998e+00f,
-    6.032081842e-01f,
-    4.483168423e-01f,
-    4.528478384e-01f,
-    1.236869693e+00f,
-    3.101414204e+00f,
-    3.585452795e+00f,
-    1.725316286e+00f,
-    1.037195802e+00f,
-    1.403228879e+00f,
-    2.067348212e-01f,
-    1.004290432e-01f,
-    4.175661087e+00f,
-    8.546081930e-02f,
-    8.795654774e-01f,
-    1.062414646e+01f,
-    3.833016157e-01f,
-    1.982237250e-01f,
-    3.610472441e+00f,
-    1.066724584e-01f,
-    7.451974601e-02f,
-    2.755902767e+00f,
-    7.621559501e-01f,
-    1.623369217e+01f,
-    3.820466042e+00f,
-    6.036383629e+00f,
-    4.016974449e+00f,
-    1.411035419e+00f,
-    1.730945826e+00f,
-    6.985430241e+00f,
-    2.281425238e+00f,
-    3.495628238e-01f,
-    6.456594944e+00f,
-    5.295333862e-01f,
-    8.933755159e-01f,
-    2.337901831e+00f,
-    1.565243483e+00f,
-    7.091560364e-01f,
-    1.055362463e+00f,
-    7.950496674e-01f,
-    1.983733624e-01f,
-    3.176893711e+00f,
-    9.157012939e+00f,
-    2.760491848e+00f,
-    8.624607086e+00f,
-    6.631523132e+00f,
-    8.798347473e+00f,
-    4.918465614e+00f,
-    8.225103378e+00f,
-    5.743720531e+00f,
-    2.392327309e+00f,
-    2.058436394e+00f,
-    5.098418713e+00f,
-    8.123003006e+00f,
-    4.862524509e+00f,
-    5.979111671e+00f,
-    3.417034626e+00f,
-    1.231490898e+01f,
-    1.211458397e+01f,
-    1.604391813e+00f,
-    4.902595520e+00f,
-    7.139022827e+00f,
-    1.219546318e+00f,
-    2.995543003e+00f,
-    9.577707291e+00f,
-    7.294979095e+00f,
-    2.845384836e+00f,
-    8.591118813e+00f,
-    4.139678478e+00f,
-    3.160776138e+00f,
-    4.341705799e+00f,
-    3.094927788e+00f,
-    1.281995201e+01f,
-    2.820072937e+01f,
-    2.245497513e+01f,
-    3.355434179e+00f,
-    9.731937408e+00f,
-    7.504327297e+00f,
-    5.882486820e+00f,
-    4.202064514e+00f,
-    2.705463886e+00f,
-    4.188202858e+00f,
-    4.559715748e+00f,
-    1.481553936e+01f,
-    8.369087219e+00f,
-    1.501158142e+01f,
-    2.278953743e+01f,
-    2.965770960e+00f,
-    1.108173966e+00f,
-    7.256888151e-01f,
-    3.685565233e+00f,
-    1.353638172e+01f,
-    1.581509495e+01f,
-    3.727291870e+01f,
-    6.569384575e+00f,
-    1.307922268e+01f,
-    2.654380035e+01f,
-    5.765330791e+00f,
-    3.028157711e+00f,
-    8.151828766e+00f,
-    5.956784248e+00f,
-    1.448531723e+01f,
-    2.873584366e+01f,
-    1.496775246e+01f,
-    1.555431366e+01f,
-    5.769467163e+01f,
-    3.233484268e+00f,
-    1.457406163e+00f,
-    1.193428326e+01f,
-    1.271366501e+01f,
-    1.479260063e+01f,
-    6.302772522e+01f,
-    2.072182655e+01f,
-    2.782908630e+01f,
-    6.716282654e+01f,
-    5.205628395e+00f,
-    3.815993309e+00f,
-    9.502523422e+00f,
-    2.888353348e+00f,
-    7.010552287e-01f,
-    2.441548407e-01f,
-    6.211488843e-01f,
-    2.724153996e+00f,
-    4.670145512e-01f,
-    1.708468795e+00f,
-    7.897275448e+00f,
-    1.094949818e+01f,
-    1.854895502e-01f,
-    3.614233434e-01f,
-    1.915489793e+00f,
-    1.327120781e+00f,
-    2.478198051e+00f,
-    6.531786919e-01f,
-    6.271144152e-01f,
-    1.739341468e-01f,
-    3.360797167e+00f,
-    4.033836842e+00f,
-    8.981186867e+00f,
-    1.215797424e+00f,
-    1.341473103e+00f,
-    1.453844547e+00f,
-    4.961610317e+00f,
-    2.151672840e-01f,
-    2.186270952e+00f,
-    1.595252419e+01f,
-    8.388476372e+00f,
-    2.664075279e+01f,
-    7.291062474e-01f,
-    2.686495781e+00f,
-    1.438110709e+00f,
-    2.844179392e+00f,
-    5.261230748e-03f,
-    9.247506410e-02f,
-    2.979857683e+00f,
-    2.889352560e+00f,
-    1.642030525e+01f,
-    2.431226254e+00f,
-    2.447998762e+00f,
-    1.342402816e+00f,
-    8.311185837e+00f,
-    5.369844381e-03f,
-    1.348939538e-01f,
-    1.204783201e+00f,
-    3.860346317e+00f,
-    9.613798141e+00f,
-    1.273732090e+01f,
-    4.967164993e+00f,
-    9.745802879e-01f,
-    2.452804565e+01f,
-    2.068163872e+00f,
-    3.015717745e+00f,
-    7.800795078e+00f,
-    3.089784145e+00f,
-    8.247005463e+00f,
-    1.059186608e-01f,
-    2.223615199e-01f,
-    1.551812649e+00f,
-    6.274922371e+00f,
-    3.655807114e+01f,
-    4.045767593e+01f,
-    2.505854225e+01f,
-    2.025724202e-02f,
-    2.661987305e+00f,
-    5.430338383e+00f,
-    6.988623619e+00f,
-    1.837241292e+00f,
-    6.485479355e+00f,
-    1.301033688e+01f,
-    1.035540462e+00f,
-    1.967069507e+00f,
-    5.328406811e+00f,
-    1.393184662e+00f,
-    6.743875027e+00f,
-    1.303443670e+00f,
-    1.747302532e+00f,
-    3.770503044e+00f,
-    5.093063712e-01f,
-    2.214219332e+00f,
-    1.187713504e+00f,
-    9.676047564e-01f,
-    5.541999340e-01f,
-    5.514858365e-01f,
-    1.021775365e+00f,
-    6.166381240e-01f,
-    1.084486485e+00f,
-    2.012885332e+00f,
-    1.180283785e+00f,
-    2.623641631e-03f,
-    9.669522047e-01f,
-    1.305230141e+00f,
-    8.331449353e-04f,
-    1.078696609e+00f,
-    2.138543576e-01f,
-    2.618243694e-01f,
-    1.164267585e-01f,
-    5.785777569e+00f,
-    7.313993931e+00f,
-    1.838868904e+01f,
-    2.855894864e-01f,
-    2.487081438e-01f,
-    4.455611110e-01f,
-    8.933595419e-01f,
-    4.589939415e-01f,
-    6.299324512e+00f,
-    6.365155697e+00f,
-    6.507663131e-01f,
-    5.970249772e-01f,
-    8.015389442e-01f,
-    9.218174934e+00f,
-    4.942277372e-01f,
-    8.890836239e-01f,
-    1.339984834e-01f,
-    1.678182220e+01f,
-    8.592719585e-02f,
-    1.114856362e+00f,
-    4.508872032e+00f,
-    3.841123581e-01f,
-    4.566258788e-01f,
-    2.798933744e+00f,
-    1.595708430e-01f,
-    1.084925160e-01f,
-    2.284690857e+00f,
-    1.288438290e-01f,
-    3.871142492e-02f,
-    2.474368513e-01f,
-    5.442275852e-02f,
-    6.417692900e-01f,
-    5.781571567e-02f,
-    1.015216485e-01f,
-    5.240569711e-01f,
-    3.831067309e-02f,
-    9.286122024e-02f,
-    5.866339207e-01f,
-    7.640268326e+00f,
-    3.265030146e+00f,
-    1.712886691e-01f,
-    1.555029303e-02f,
-    1.944690570e-02f,
-    6.021029130e-02f,
-    2.814331837e-02f,
-    2.695188224e-01f,
-    4.954963923e-02f,
-    7.194549561e+00f,
-    1.265555382e+01f,
-    6.522808552e+00f,
-    4.535185993e-01f,
-    6.697551161e-02f,
-    8.114615083e-02f,
-    1.292509747e+01f,
-    1.750776482e+01f,
-    3.123764880e-02f,
-    1.812463440e-02f,
-    2.440582067e-01f,
-    7.410167456e-01f,
-    2.257699519e-01f,
-    5.734221458e+00f,
-    4.783069611e+00f,
-    3.813112497e+00f,
-    6.837701201e-01f,
-    1.074969247e-01f,
-    1.144775152e+00f,
-    3.216771126e+00f,
-    1.296871603e-01f,
-    2.100000530e-02f,
-    2.640048414e-02f,
-    1.923977397e-02f,
-    1.138420124e-02f,
-    5.476194993e-02f,
-    2.985687256e-01f,
-    8.932248950e-01f,
-    6.534212589e+00f,
-    5.787712097e+00f,
-    1.877091599e+01f,
-    8.421426773e+00f,
-    1.906352162e+00f,
-    5.066049576e+00f,
-    6.776658058e+00f,
-    9.957860947e+00f,
-    1.262926579e+00f,
-    2.165128231e+00f,
-    8.931703568e+00f,
-    8.315877914e+00f,
-    9.006620407e+00f,
-    1.353487110e+01f,
-    5.158782601e-01f,
-    6.109343842e-02f,
-    1.476060301e-01f,
-    1.668357658e+01f,
-    1.367872047e+01f,
-    9.846051216e+00f,
-    8.711460233e-02f,
-    3.701175330e-03f,
-    1.068226621e-02f,
-    5.591526985e+00f,
-    9.692632675e+00f,
-    1.342943311e-01f,
-    4.010549746e-03f,
-    3.592113853e-01f,
-    1.308853626e-01f,
-    6.712996006e+00f,
-    4.019431025e-02f,
-    1.488035196e-03f,
-    1.470468044e+00f,
-    4.107032716e-02f,
-    2.129933052e-02f,
-    3.308543861e-01f,
-    2.307389975e-01f,
-    1.879606247e+01f,
-    5.533962324e-02f,
-    4.225032032e-02f,
-    5.425115585e+00f,
-    8.115975380e+00f,
-    1.456454098e-01f,
-    1.018808842e+00f,
-    3.509902239e+00f,
-    1.425732994e+01f,
-    1.833674312e-01f,
-    7.219684720e-01f,
-    3.821964562e-01f,
-    9.201066017e+00f,
-    1.774294227e-01f,
-    1.624595821e-01f,
-    3.069631338e+00f,
-    1.277280599e-01f,
-    1.711175680e+00f,
-    6.948968172e-01f,
-    1.232114792e+00f,
-    8.839579821e-01f,
-    4.520929813e+00f,
-    6.091091633e+00f,
-    6.887661457e+00f,
-    2.832117319e+00f,
-    4.521221161e+00f,
-    1.518658161e+01f,
-    1.560764313e-01f,
-    4.338525236e-02f,
-    3.452524245e-01f,
-    2.076946497e+00f,
-    6.937741768e-03f,
-    5.573157221e-02f,
-    2.466344357e+00f,
-    1.022959995e+01f,
-    4.627253056e+00f,
-    2.003317833e+00f,
-    5.545266151e+00f,
-    1.098494902e-01f,
-    8.082599379e-03f,
-    9.782326818e-01f,
-    9.059517384e-01f,
-    9.477768540e-01f,
-    3.197925687e-01f,
-    1.042317390e+00f,
-    3.051497698e+00f,
-    4.807793200e-01f,
-    3.328280151e-01f,
-    1.028632149e-01f,
-    7.557162642e-01f,
-    2.738033533e+00f,
-    2.902903259e-01f,
-    5.692748427e-01f,
-    2.424742579e-01f,
-    5.344391346e+00f,
-    7.469638348e+00f,
-    6.574727058e+00f,
-    1.277047396e+00f,
-    2.678644061e-01f,
-    3.091600657e+00f,
-    1.513279629e+01f,
-    4.258052349e+00f,
-    1.768763959e-01f,
-    1.446783161e+01f,
-    8.221826553e+00f,
-    9.564134479e-01f,
-    8.731743693e-01f,
-    2.461019009e-01f,
-    1.304466724e+01f,
-    1.616719627e+01f,
-    9.964748621e-01f,
-    3.065352142e-01f,
-    1.752695255e-02f,
-    2.124249220e+00f,
-    1.263760567e+00f,
-    4.289397597e-01f,
-    5.199307799e-01f,
-    3.134195805e-01f,
-    1.651921511e+00f,
-    2.218935966e+00f,
-    1.255189896e+00f,
-    2.755438685e-01f,
-    9.656308591e-02f,
-    2.340506077e+00f,
-    1.995940089e+00f,
-    7.474828959e-01f,
-    6.479378343e-01f,
-    4.599033594e-01f,
-    1.843860984e+00f,
-    1.269522190e+00f,
-    1.254791355e+01f,
-    4.677853394e+01f,
-    2.301659393e+01f,
-    1.471134186e+00f,
-    1.653600931e+00f,
-    1.827283382e+00f,
-    4.401793480e-01f,
-    1.156808567e+01f,
-    1.581995201e+01f,
-    5.893984318e+00f,
-    1.530469894e+01f,
-    8.744832993e+00f,
-    6.642618179e+00f,
-    7.933501005e-01f,
-    1.603221297e-01f,
-    9.564793587e+00f,
-    4.386384010e+00f,
-    5.098333836e+00f,
-    3.824934721e+00f,
-    4.431649685e+00f,
-    2.582485676e+00f,
-    1.310933828e-01f,
-    1.341299564e-01f,
-    6.776397824e-01f,
-    3.977220953e-01f,
-    2.052081227e-01f,
-    3.069542646e-01f,
-    2.531352341e-01f,
-    6.110945940e-01f,
-    8.588160276e-01f,
-    1.159255505e+00f,
-    2.373299152e-01f,
-    1.994108915e+00f,
-    4.770126343e-01f,
-    1.754327863e-01f,
-    3.671318293e+00f,
-    1.232945681e+00f,
-    1.755430996e-01f,
-    1.259083450e-01f,
-    6.799281597e+00f,
-    4.792454720e+00f,
-    8.411442041e-01f,
-    3.932854891e+00f,
-    2.025658131e+00f,
-    3.784329414e+00f,
-    4.004973412e+00f,
-    1.173054427e-01f,
-    1.497119617e+01f,
-    1.728875732e+01f,
-    1.091225624e+01f,
-    1.787802577e+00f,
-    2.693482399e+00f,
-    1.808116913e+01f,
-    1.251166153e+01f,
-    3.752218962e+00f,
-    3.828622580e+00f,
-    9.809133410e-01f,
-    2.509272695e-01f,
-    8.918642044e+00f,
-    2.717560053e+00f,
-    1.862692642e+01f,
-    9.814284444e-01f,
-    2.517173290e-01f,
-    6.698619843e+00f,
-    1.760848236e+01f,
-    6.344561100e+00f,
-    9.596368670e-01f,
-    3.812592626e-01f,
-    2.277342224e+01f,
-    4.363212967e+01f,
-    1.322850323e+01f,
-    7.697579861e+00f,
-    3.064010811e+01f,
-    6.321669102e+00f,
-    1.478412056e+01f,
-    2.974078178e+01f,
-    4.067317581e+01f,
-    1.892524242e+00f,
-    1.540300369e+00f,
-    3.800722885e+01f,
-    4.043318176e+01f,
-    5.099763107e+01f,
-    2.178407907e+00f,
-    3.893430710e+00f,
-    2.998859596e+01f,
-    1.193679810e+01f,
-    2.335770226e+01f,
-    1.977834105e-01f,
-    7.515798509e-02f,
-    3.108060122e+00f,
-    3.899261475e+00f,
-    1.552926302e+00f,
-    1.130551845e-01f,
-    4.096749425e-02f,
-    3.143281221e+00f,
-    4.415509224e+00f,
-    1.399821043e+00f,
-    1.639570147e-01f,
-    1.361676455e-01f,
-    1.285315228e+01f,
-    9.568926811e+00f,
-    9.014808536e-01f,
-    5.383586287e-01f,
-    1.952047706e+00f,
-    5.056959629e+00f,
-    1.272312260e+01f,
-    6.388423443e+00f,
-    8.485226631e+00f,
-    2.625743151e-01f,
-    2.534258068e-01f,
-    7.018638253e-01f,
-    1.167622375e+01f,
-    7.322986126e+00f,
-    6.456816673e+00f,
-    9.318805695e+00f,
-    1.308495235e+01f,
-    1.010826588e+01f,
-    6.316680908e+00f,
-    8.806933403e+00f,
-    2.715222120e+00f,
-    1.369204617e+01f,
-    1.182367039e+01f,
-    2.963110209e+00f,
-    1.138301086e+01f,
-    1.854621315e+01f,
-    1.421935678e+00f,
-    1.061971951e+01f,
-    1.776658249e+01f,
-    4.662062526e-01f,
-    6.143168926e+00f,
-    2.944898844e+00f,
-    1.098257899e-01f,
-    1.340914631e+01f,
-    5.760279179e+00f,
-    2.768327594e-01f,
-    6.198334217e+00f,
-    6.295844913e-01f,
-    6.445975900e-01f,
-    3.053818464e+00f,
-    7.714180946e+00f,
-    3.107560575e-01f,
-    1.505590677e-01f,
-    4.634333420e+01f,
-    2.897566986e+01f,
-    2.385049820e+01f,
-    9.080374718e+00f,
-    1.308419704e+01f,
-    9.080899239e+00f,
-    2.591612101e+00f,
-    7.485749722e+00f,
-    6.981742859e+00f,
-    5.609202981e-01f,
-    6.277243495e-01f,
-    2.049938917e+00f,
-    5.298623085e+00f,
-    2.368227243e-01f,
-    8.885203600e-01f,
-    2.025072479e+01f,
-    8.369269371e+00f,
-    2.179434299e+00f,
-    1.066848993e+00f,
-    1.162538290e+00f,
-    2.461318207e+01f,
-    7.896059513e+00f,
-    2.256452560e+00f,
-    1.992459178e+00f,
-    4.831745923e-01f,
-    4.107356262e+01f,
-    6.744974136e+00f,
-    5.459190845e+00f,
-    8.435394287e+00f,
-    4.984962463e+00f,
-    9.825870991e-01f,
-    3.234013915e-01f,
-    2.313030243e+00f,
-    5.391756535e+00f,
-    1.136216640e+00f,
-    1.701718420e-01f,
-    1.029916382e+01f,
-    1.776202583e+01f,
-    5.379753709e-01f,
-    6.846874237e+00f,
-    4.921009064e+00f,
-    2.722306252e-01f,
-    1.814278007e+00f,
-    7.040491700e-01f,
-    1.302325630e+01f,
-    1.720747828e+00f,
-    6.748915911e-01f,
-    1.397504902e+01f,
-    1.223517537e+00f,
-    1.112399697e+00f,
-    1.195051289e+01f,
-    2.053000689e+00f,
-    3.876126111e-01f,
-    2.258122414e-01f,
-    2.757699490e+00f,
-    2.395248890e+00f,
-    2.069333345e-01f,
-    8.746185154e-02f,
-    4.329462528e+00f,
-    5.480277061e+00f,
-    1.136928678e+00f,
-    4.226052761e+00f,
-    2.752972603e+00f,
-    1.510213256e+00f,
-    7.275812626e+00f,
-    1.606096476e-01f,
-    8.810482025e+00f,
-    1.622154427e+01f,
-    3.600066376e+01f,
-    1.030139208e+00f,
-    3.993436575e+00f,
-    1.378187656e+01f,
-    3.429891968e+01f,
-    3.223045826e+00f,
-    1.101033115e+01f,
-    1.029122248e-01f,
-    4.662948474e-02f,
-    3.087528229e+00f,
-    3.389295101e+00f,
-    1.371733904e+00f,
-    6.476004422e-02f,
-    1.005500555e-01f,
-    4.453751564e+00f,
-    5.479078293e+00f,
-    1.156259418e+00f,
-    1.113231331e-01f,
-    1.806910187e-01f,
-    4.436210155e+00f,
-    3.714245796e+00f,
-    2.365528345e+00f,
-    3.106093168e+00f,
-    2.511042595e+00f,
-    9.216966629e+00f,
-    5.444037914e+00f,
-    6.842017174e-01f,
-    1.053882504e+01f,
-    2.841253281e+01f,
-    1.448601127e+00f,
-    7.029068470e+00f,
-    1.183836651e+01f,
-    3.381349146e-01f,
-    6.890628338e+00f,
-    1.983306766e+00f,
-    1.967623681e-01f,
-    1.061960602e+01f,
-    1.165047932e+01f,
-    6.800982356e-01f,
-    1.332988858e+00f,
-    2.934478223e-01f,
-    1.697500497e-01f,
-    1.833916187e+00f,
-    3.412187576e+00f,
-    5.447307110e+00f,
-    4.666133881e+00f,
-    4.242397785e+00f,
-    1.364004493e+00f,
-    9.411184788e-01f,
-    2.527870417e+00f,
-    1.232384801e+00f,
-    1.213954687e+00f,
-    2.640075684e-01f,
-    7.389619201e-02f,
-    7.160962224e-01f,
-    8.325334787e-01f,
-    3.160398453e-02f,
-    8.526515216e-03f,
-    8.290000558e-01f,
-    3.077622652e-01f,
-    3.410322368e-01f,
-    6.639573723e-02f,
-    4.242867529e-01f,
-    6.182052493e-01f,
-    8.974322677e-01f,
-    6.867273450e-01f,
-    6.963338256e-01f,
-    7.582011074e-02f,
-    2.969260693e+00f,
-    9.120365977e-02f,
-    2.804147601e-01f,
-    1.438476443e+00f,
-    1.020048141e+00f,
-    1.661774516e-01f,
-    8.929640055e-01f,
-    1.982958317e-01f,
-    4.846555710e+00f,
-    1.298931479e+00f,
-    6.898401260e+00f,
-    1.655175723e-02f,
-    6.489825726e+00f,
-    1.457668114e+01f,
-    7.822589874e+00f,
-    1.168018341e+00f,
-    3.104339242e-01f,
-    2.298790169e+01f,
-    1.659987831e+01f,
-    1.546025085e+02f,
-    4.689253807e+00f,
-    1.088917542e+01f,
-    6.145911694e+00f,
-    4.373496628e+01f,
-    2.533322334e+00f,
-    1.104342639e-01f,
-    5.084135132e+02f,
-    1.443469971e-01f,
-    1.134687614e+01f,
-    6.343106270e+00f,
-    8.054687381e-01f,
-    2.904129922e-01f,
-    9.107811451e-01f,
-    3.699052613e-03f,
-    1.112709165e+00f,
-    2.156501412e-01f,
-    1.138065529e+01f,
-    5.230848789e+00f,
-    5.212348104e-01f,
-    1.038009644e+00f,
-    4.154442549e-01f,
-    1.899573356e-01f,
-    3.769221604e-01f,
-    5.966580659e-02f,
-    5.945647955e-01f,
-    3.740168512e-01f,
-    1.237667650e-01f,
-    8.836872876e-03f,
-    3.028358519e-01f,
-    3.229658306e-02f,
-    5.682523921e-02f,
-    2.961771190e-01f,
-    1.935244501e-01f,
-    1.396869123e-01f,
-    3.113795817e-02f,
-    2.082417160e-01f,
-    2.017249107e+00f,
-    2.006893396e+00f,
-    1.266633272e+00f,
-    2.072787285e-01f,
-    3.314691037e-02f,
-    5.880740643e+00f,
-    6.413336098e-02f,
-    9.275380373e-01f,
-    1.384647250e+00f,
-    9.552165270e-01f,
-    5.343098044e-01f,
-    9.788218737e-01f,
-    1.997115761e-01f,
-    3.750047207e+00f,
-    6.860205173e+00f,
-    5.588689804e+00f,
-    1.319517288e-02f,
-    1.142045856e+00f,
-    1.567360878e+00f,
-    2.182812500e+01f,
-    2.285815620e+01f,
-    2.559633827e+01f,
-    9.188782692e+00f,
-    4.540022373e+00f,
-    9.788167000e+00f,
-    9.554907084e-01f,
-    1.451646686e+00f,
-    7.461458206e+00f,
-    5.248384476e-01f,
-    4.498292923e+00f,
-    9.260001779e-01f,
-    5.387018323e-01f,
-    6.953598499e+00f,
-    8.232110977e+00f,
-    9.028423309e+00f,
-    6.497870445e+00f,
-    2.444163799e+00f,
-    1.269418049e+01f,
-    4.935211182e+00f,
-    1.325360107e+01f,
-    9.072976112e+00f,
-    4.356846333e+00f,
-    4.430409968e-01f,
-    2.472628206e-01f,
-    6.935989380e+01f,
-    1.921137428e+01f,
-    1.017605972e+02f,
-    6.564589977e+00f,
-    7.067148685e+00f,
-    4.174973965e+00f,
-    1.339403629e+01f,
-    3.110101891e+01f,
-    3.565223312e+01f,
-    6.239087105e+00f,
-    8.431003571e+00f,
-    8.180007935e+00f,
-    1.949308962e-01f,
-    6.932274252e-02f,
-    1.675068359e+02f,
-    2.005762863e+01f,
-    3.326705933e+02f,
-    5.432655290e-02f,
-    2.468108684e-01f,
-    2.071490437e-01f,
-    3.167933822e-01f,
-    2.644369602e-01f,
-    1.142136306e-01f,
-    7.615249604e-02f,
-    3.767228723e-01f,
-    3.006854653e-01f,
-    6.087496281e-01f,
-    1.626197994e-01f,
-    6.992102265e-01f,
-    2.409112826e-02f,
-    2.699088812e+00f,
-    4.156984389e-01f,
-    3.072841465e-01f,
-    2.620388508e+00f,
-    1.803046346e+00f,
-    2.044285089e-01f,
-    7.091641426e-01f,
-    1.421422064e-01f,
-    6.701550633e-02f,
-    4.742138088e-01f,
-    3.403172130e-03f,
-    6.999542236e+00f,
-    4.317172050e+00f,
-    4.832791984e-01f,
-    1.694162178e+01f,
-    3.048599243e+00f,
-    4.380906105e+00f,
-    1.070114613e+01f,
-    3.439537525e+00f,
-    3.314895153e+00f,
-    2.200423926e-01f,
-    5.160432053e+01f,
-    7.988481969e-02f,
-    1.715761757e+01f,
-    3.318202209e+01f,
-    1.616649055e+01f,
-    4.458391070e-01f,
-    8.813234329e+00f,
-    6.442040920e+00f,
-    2.409204960e+00f,
-    1.675006747e+00f,
-    2.302242279e+01f,
-    1.305393505e+01f,
-    2.081443071e+00f,
-    7.571945667e+00f,
-    1.918336630e+00f,
-    4.714466095e+00f,
-    1.559324551e+01f,
-    4.985762537e-01f,
-    7.454809546e-01f,
-    3.474508226e-01f,
-    2.643223405e-01f,
-    1.639112383e-01f,
-    2.324063629e-01f,
-    9.923273087e+00f,
-    5.816191196e+00f,
-    7.796648979e+00f,
-    4.592967331e-01f,
-    1.267443448e-01f,
-    6.265191269e+01f,
-    1.398215103e+01f,
-    1.832357330e+02f,
-    8.474122047e+00f,
-    7.202746391e+00f,
-    7.856466770e+00f,
-    8.458706141e-01f,
-    3.635072410e-01f,
-    6.960643005e+01f,
-    1.674940109e+01f,
-    1.193550415e+02f,
-    1.239345446e-01f,
-    3.171747971e+01f,
-    4.633178711e+01f,
-    1.462318611e+01f,
-    1.239343643e+00f,
-    1.207494049e+02f,
-    4.794605970e-01f,
-    2.666968727e+01f,
-    1.053122997e+01f,
-    5.528547974e+02f,
-    3.061977625e+00f,
-    8.222150803e+00f,
-    2.192451715e+00f,
-    2.794685364e+01f,
-    6.597521210e+01f,
-    2.117432594e+01f,
-    2.058193833e-01f,
-    8.323911667e+00f,
-    9.902359009e+00f,
-    1.281445146e+00f,
-    2.237401962e+00f,
-    2.448160934e+01f,
-    1.296997833e+02f,
-    1.375803528e+02f,
-    9.096960068e+00f,
-    2.510523081e+00f,
-    6.853145599e+00f,
-    1.041065097e+00f,
-    1.534725428e+00f,
-    1.099066257e+01f,
-    3.521573257e+01f,
-    3.015977097e+01f,
-    7.814805031e+00f,
-    5.895856857e+00f,
-    5.328846931e+00f,
-    6.307058811e+00f,
-    1.468106210e-01f,
-    1.224306896e-01f,
-    3.254138306e-02f,
-    8.563774079e-02f,
-    8.297496289e-02f,
-    4.275166035e+00f,
-    2.738243103e+00f,
-    1.021862864e+00f,
-    1.327853054e-01f,
-    4.169116914e-02f,
-    8.987614632e+00f,
-    3.623613343e-02f,
-    3.656302094e-01f,
-    2.171782494e+00f,
-    2.666809082e+00f,
-    1.008178830e+00f,
-    4.762514830e-01f,
-    1.378613710e-01f,
-    1.599537754e+01f,
-    5.883072376e+00f,
-    6.667314529e+00f,
-    9.408188052e-03f,
-    4.522913933e+00f,
-    6.557337761e+00f,
-    6.689964533e-01f,
-    7.319374681e-01f,
-    2.638738632e+00f,
-    3.077863455e-01f,
-    2.248093987e+01f,
-    1.092842255e+02f,
-    1.161334801e+01f,
-    6.100190163e+00f,
-    8.403290808e-02f,
-    8.664668083e+00f,
-    2.626703835e+01f,
-    6.195128441e+00f,
-    7.976902962e+00f,
-    1.862451732e-01f,
-    2.483526468e-01f,
-    7.931334972e-01f,
-    1.813486218e-01f,
-    2.625176392e+02f,
-    1.897962646e+02f,
-    1.956447363e-01f,
-    9.362706184e+00f,
-    1.506543922e+01f,
-    5.188602924e+00f,
-    1.477081895e+00f,
-    2.995331764e+01f,
-    9.613897800e-01f,
-    1.113534260e+01f,
-    1.494356251e+01f,
-    8.748646736e+00f,
-    7.766243744e+01f,
-    1.014007568e+02f,
-    5.569037050e-02f,
-    5.345043659e+00f,
-    5.203818798e+00f,
-    2.110791683e+00f,
-    2.587548792e-01f,
-    9.966187179e-03f,
-    1.443890855e-02f,
-    9.506286621e+00f,
-    1.113355637e+01f,
-    2.339961290e+00f,
-    3.438775301e+00f,
-    1.138377094e+01f,
-    1.509705925e+01f,
-    1.264915824e+00f,
-    2.140187263e+00f,
-    3.911991119e+00f,
-    1.057076931e+01f,
-    2.638005257e+00f,
-    8.757118583e-01f,
-    1.905589402e-01f,
-    5.029121414e-02f,
-    1.289167762e+00f,
-    3.182303190e+00f,
-    1.521946192e-01f,
-    1.363805485e+01f,
-    1.440731168e+00f,
-    2.598637581e+00f,
-    4.235099852e-01f,
-    1.675822449e+01f,
-    2.560812747e-03f,
-    2.717315435e+00f,
-    5.239540339e-01f,
-    1.000272512e+00f,
-    1.439629650e+01f,
-    6.515718460e+00f,
-    5.590821266e+00f,
-    5.518348694e+00f,
-    2.466043234e-01f,
-    2.484899312e-01f,
-    5.152398300e+01f,
-    2.224909216e-01f,
-    9.344914436e+00f,
-    2.670364380e+01f,
-    1.390292645e+00f,
-    1.463452816e+01f,
-    1.505389214e+01f,
-    6.998974609e+01f,
-    3.284832239e+00f,
-    3.271449089e+00f,
-    5.384075642e-01f,
-    4.004757881e+00f,
-    9.028868675e+00f,
-    5.847541332e+00f,
-    5.879591942e+00f,
-    4.005851746e+00f,
-    1.288721204e+00f,
-    9.701898098e-01f,
-    1.004422665e+00f,
-    3.453567982e+00f,
-    3.414751530e+00f,
-    2.114296436e+00f,
-    2.554570436e+00f,
-    2.005321831e-01f,
-    2.212129593e+00f,
-    1.642491817e+00f,
-    7.117161751e-01f,
-    1.986090660e+01f,
-    1.176278591e+01f,
-    5.009120941e+00f,
-    1.006077576e+01f,
-    4.287234306e+00f,
-    2.058471441e+00f,
-    1.204003572e+00f,
-    1.232486606e+00f,
-    3.266347122e+01f,
-    7.449509621e+00f,
-    3.383938074e+00f,
-    2.860147953e-01f,
-    1.511783481e+00f,
-    1.849341989e+00f,
-    2.154467821e+00f,
-    7.683103681e-01f,
-    3.019274330e+01f,
-    9.827041626e+00f,
-    1.292011833e+01f,
-    5.657280922e+00f,
-    1.083709908e+01f,
-    7.503757954e+00f,
-    1.214165497e+01f,
-    4.777409554e+00f,
-    3.570900202e+00f,
-    1.428917408e+00f,
-    3.432261348e-01f,
-    2.693271828e+01f,
-    1.625754356e+01f,
-    1.049243622e+02f,
-    4.507936954e+00f,
-    3.116658926e+00f,
-    3.294844389e+00f,
-    1.769325447e+01f,
-    2.132591486e+00f,
-    2.554905713e-01f,
-    1.639832611e+02f,
-    3.607893944e+00f,
-    1.175501442e+01f,
-    1.190430260e+01f,
-    1.281115055e+00f,
-    1.061138749e+00f,
-    7.697269440e+00f,
-    5.209813595e+00f,
-    7.867478132e-01f,
-    2.078315467e-01f,
-    8.021965623e-01f,
-    3.272836804e-01f,
-    8.677639365e-01f,
-    2.339052856e-01f,
-    1.011872673e+01f,
-    2.347533941e+00f,
-    1.276702285e+00f,
-    1.825912595e+00f,
-    5.908121586e+00f,
-    4.315245152e+00f,
-    2.899217904e-01f,
-    6.392683387e-01f,
-    1.067812729e+01f,
-    4.722136021e+00f,
-    1.540939331e+00f,
-    1.473875523e+00f,
-    2.645563781e-01f,
-    1.429016590e-01f,
-    6.398327827e+00f,
-    1.967876792e+00f,
-    6.396953017e-02f,
-    9.914547205e-01f,
-    1.532903910e-01f,
-    6.080526859e-02f,
-    7.371429205e-01f,
-    5.400177091e-03f,
-    4.479425907e+00f,
-    4.930596828e+00f,
-    2.391070604e+00f,
-    2.606631088e+01f,
-    3.104679108e+00f,
-    6.375525951e+00f,
-    1.361388397e+01f,
-    4.755155563e+00f,
-    2.258365393e+00f,
-    5.705688596e-01f,
-    6.328457642e+01f,
-    8.655344248e-01f,
-    1.420515537e+01f,
-    3.025770760e+01f,
-    2.575331306e+01f,
-    7.506220043e-02f,
-    1.836688232e+01f,
-    1.593769455e+01f,
-    1.079478741e+00f,
-    3.008192778e+00f,
-    3.942072296e+01f,
-    6.355520248e+01f,
-    1.037850738e+00f,
-    8.415566444e+00f,
-    1.258650780e+00f,
-    2.883941269e+01f,
-    1.645498085e+01f,
-    9.276218414e+00f,
-    1.694920212e-01f,
-    1.036835760e-01f,
-    1.631248929e-02f,
-    2.994177677e-02f,
-    4.977410659e-02f,
-    4.531012535e+00f,
-    2.927652836e+00f,
-    1.652338624e+00f,
-    1.427488774e-01f,
-    6.143678352e-02f,
-    1.433490276e+01f,
-    1.361418515e-01f,
-    6.975953579e-01f,
-    3.441420555e+00f,
-    4.863405704e+00f,
-    1.459579706e+00f,
-    2.117243260e-01f,
-    2.387200743e-01f,
-    9.140506744e+00f,
-    3.453059912e+00f,
-    2.818367481e+00f,
-    6.256901473e-02f,
-    3.942280769e+00f,
-    4.588395119e+00f,
-    1.826405644e+00f,
-    1.172939464e-01f,
-    3.202767849e+00f,
-    1.772732884e-01f,
-    3.209428549e+00f,
-    2.649194479e+00f,
-    5.198242950e+01f,
-    1.063855076e+01f,
-    1.199695396e+01f,
-    6.363172531e+00f,
-    1.129189968e+00f,
-    1.494309902e+01f,
-    3.253549194e+01f,
-    1.081075191e+00f,
-    1.180779219e+00f,
-    1.379956245e+01f,
-    1.654467201e+01f,
-    9.549905777e+00f,
-    2.085707664e+00f,
-    3.863064945e-01f,
-    1.163850725e-01f,
-    2.393156528e+00f,
-    2.009145260e+00f,
-    1.774468124e-01f,
-    7.243631840e+00f,
-    2.337612629e+00f,
-    7.299432755e+00f,
-    6.643723249e-01f,
-    1.639339256e+01f,
-    9.231911972e-03f,
-    8.657555580e-01f,
-    3.242691755e-01f,
-    2.483491451e-01f,
-    2.465320110e+00f,
-    2.732009888e+00f,
-    3.731233180e-01f,
-    4.715662479e+00f,
-    4.662880898e+00f,
-    4.647862315e-01f,
-    7.492722511e+00f,
-    3.493883133e+00f,
-    1.185852408e+00f,
-    8.875202537e-01f,
-    2.074063540e+00f,
-    1.153042793e+01f,
-    6.518749237e+00f,
-    3.847097158e+00f,
-    1.754864216e+00f,
-    2.216625065e-01f,
-    4.930073619e-01f,
-    1.158484101e+00f,
-    1.151065707e+00f,
-    2.387121916e-01f,
-    1.757128000e+00f,
-    9.609094262e-01f,
-    1.401461005e+00f,
-    1.197296238e+01f,
-    1.905658913e+01f,
-    3.558430481e+01f,
-    9.743098021e-01f,
-    1.316930950e-01f,
-    3.893605471e-01f,
-    1.539861774e+01f,
-    2.369188309e+01f,
-    2.478380775e+01f,
-    9.422333717e+00f,
-    3.420186615e+01f,
-    2.427996445e+01f,
-    4.535779357e-01f,
-    1.023579538e-01f,
-    3.595598936e-01f,
-    2.127980441e-01f,
-    1.248917937e+00f,
-    3.408030868e-01f,
-    6.048361301e+00f,
-    4.671722412e+00f,
-    2.275079012e+00f,
-    1.411516964e-02f,
-    1.865750253e-01f,
-    3.658245504e-02f,
-    2.598633289e+00f,
-    3.073502064e+00f,
-    1.815137267e+00f,
-    1.056991458e+00f,
-    3.215287030e-01f,
-    1.284760237e+00f,
-    8.593952060e-01f,
-    6.761810184e-01f,
-    2.228879929e-01f,
-    7.570754290e-01f,
-    4.551382065e-01f,
-    9.617972374e-01f,
-    5.251557827e-01f,
-    1.360875726e+00f,
-    1.228927016e+00f,
-    1.463370514e+01f,
-    9.516199112e+00f,
-    3.635796738e+01f,
-    2.322413206e+00f,
-    1.677682638e+00f,
-    3.175267220e+00f,
-    4.007449150e-01f,
-    5.437977910e-01f,
-    1.205972791e+00f,
-    1.046722794e+01f,
-    8.558179855e+00f,
-    4.525395393e+00f,
-    4.141096878e+01f,
-    2.173487282e+01f,
-    1.943997765e+01f,
-    1.285044312e+00f,
-    1.135099083e-01f,
-    2.284751385e-01f,
-    8.823795319e+00f,
-    1.800709152e+01f,
-    4.640373230e+01f,
-    1.344190693e+01f,
-    1.464732170e+01f,
-    6.112009048e+00f,
-    3.107849956e-01f,
-    5.794562772e-02f,
-    1.022261605e-01f,
-    1.051261187e+00f,
-    2.752036333e+00f,
-    9.602066875e-01f,
-    8.386301041e+00f,
-    1.692422676e+01f,
-    8.104187965e+00f,
-    2.533289671e+00f,
-    1.362209439e+00f,
-    1.446604371e+00f,
-    2.975387275e-01f,
-    6.869485378e-01f,
-    4.204887450e-01f,
-    2.540561676e+00f,
-    4.760257721e+00f,
-    2.392200708e+00f,
-    8.274926186e+00f,
-    9.326920509e+00f,
-    9.892599106e+00f,
-    1.319008589e+00f,
-    2.391164154e-01f,
-    5.522583127e-01f,
-    1.254648590e+01f,
-    2.644658327e+00f,
-    9.491844177e+00f,
-    1.484016228e+01f,
-    2.580169296e+01f,
-    7.153350830e+00f,
-    3.957264721e-01f,
-    4.991827309e-01f,
-    2.820603848e-01f,
-    3.532213211e+00f,
-    3.086866379e+00f,
-    2.246174097e+00f,
-    1.548798561e+01f,
-    4.173062515e+01f,
-    4.635894775e+01f,
-    6.849149704e+00f,
-    2.721367598e+00f,
-    1.034483433e+01f,
-    1.091450977e+01f,
-    1.522389603e+01f,
-    4.522812366e+00f,
-    4.991691208e+01f,
-    2.010989761e+01f,
-    1.921137428e+01f,
-    2.963670921e+01f,
-    1.048924637e+01f,
-    1.900734863e+02f,
-    9.354544640e+00f,
-    2.963182640e+01f,
-    2.070098305e+01f,
-    6.784865379e+00f,
-    7.513901591e-01f,
-    5.720371246e+00f,
-    7.159335613e+00f,
-    3.451051712e+00f,
-    3.656105042e+00f,
-    4.991962433e+01f,
-    1.775129318e+01f,
-    1.883133125e+01f,
-    5.573242903e-01f,
-    3.114384413e+00f,
-    7.854110003e-01f,
-    1.894254303e+01f,
-    1.830912209e+01f,
-    7.258697987e+00f,
-    4.199536800e+00f,
-    9.274068832e+00f,
-    8.127820969e+00f,
-    5.544365406e+00f,
-    3.571064234e+00f,
-    6.368089676e+00f,
-    1.611686134e+01f,
-    8.835147858e+00f,
-    1.611890221e+01f,
-    1.589637566e+01f,
-    1.593540668e+01f,
-    3.383153677e+00f,
-    6.489742279e+00f,
-    7.402628660e-01f,
-    2.339425802e+00f,
-    1.392960262e+01f,
-    1.668830681e+01f,
-    1.899537468e+01f,
-    1.183131695e+00f,
-    7.424596697e-02f,
-    1.404503882e-01f,
-    1.580550957e+01f,
-    1.135022259e+01f,
-    2.563559532e+01f,
-    4.498176575e+00f,
-    9.932548523e+00f,
-    1.776701164e+01f,
-    5.360881090e-01f,
-    7.652151585e-02f,
-    1.253906041e-01f,
-    1.155065656e+00f,
-    4.513980150e-01f,
-    1.083618760e+00f,
-    8.579074860e+00f,
-    3.487899303e+00f,
-    2.628532171e+00f,
-    1.759555191e-01f,
-    1.255400658e+00f,
-    3.470748663e-01f,
-    3.539017916e+00f,
-    1.720372677e+00f,
-    3.781013727e+00f,
-    7.559445381e+00f,
-    5.288607121e+00f,
-    3.549587965e+00f,
-    7.756230831e+00f,
-    1.147214699e+01f,
-    1.435503364e+00f,
-    1.109297180e+01f,
-    8.991863132e-01f,
-    2.196945906e+00f,
-    2.182923555e+00f,
-    2.454968691e+00f,
-    1.200911164e+00f,
-    1.932248878e+01f,
-    1.662660599e+01f,
-    2.530040550e+01f,
-    2.170573473e+00f,
-    1.218863726e+00f,
-    8.367350698e-01f,
-    7.496355772e-01f,
-    1.309077859e+00f,
-    7.937886715e-01f,
-    1.505011654e+01f,
-    2.302259445e+00f,
-    4.634232044e+00f,
-    1.929915047e+01f,
-    1.480162525e+01f,
-    8.148319244e+00f,
-    5.713291168e-01f,
-    7.473767549e-02f,
-    3.225601912e-01f,
-    6.410761833e+00f,
-    1.004154491e+01f,
-    1.440579319e+01f,
-    1.350813389e+01f,
-    1.858544540e+01f,
-    5.903817654e+00f,
-    2.773724794e-01f,
-    5.689487606e-02f,
-    1.690163910e-01f,
-    4.401309416e-02f,
-    5.194578767e-01f,
-    3.139826059e-01f,
-    5.839229584e+00f,
-    1.934720159e+00f,
-    5.259009600e-01f,
-    1.243389130e+00f,
-    4.820499718e-01f,
-    6.873824596e-01f,
-    1.969011426e+00f,
-    1.353012443e+00f,
-    9.671961665e-01f,
-    1.792902946e+01f,
-    2.935276985e+01f,
-    1.332761288e+01f,
-    4.778795242e+00f,
-    1.056837916e+00f,
-    1.527021408e+00f,
-    4.615529478e-01f,
-    9.507523179e-01f,
-    5.437452793e-01f,
-    5.070178986e+00f,
-    4.997670650e+00f,
-    2.724274397e+00f,
-    3.430234528e+01f,
-    3.749069595e+01f,
-    9.966765404e+00f,
-    1.068243146e+00f,
-    1.809665859e-01f,
-    6.516438127e-01f,
-    1.109535789e+01f,
-    8.881065369e+00f,
-    1.502561092e+01f,
-    1.598556805e+01f,
-    1.843578339e+01f,
-    4.939733505e+00f,
-    5.157958269e-01f,
-    1.934979558e-01f,
-    5.317969918e-01f,
-    2.053717375e+00f,
-    2.579723597e+00f,
-    1.590816498e+00f,
-    1.538503170e+01f,
-    1.935996819e+01f,
-    2.340341759e+01f,
-    2.979251862e+00f,
-    5.547607899e+00f,
-    3.656409264e+00f,
-    6.880260706e-01f,
-    1.338667989e+00f,
-    7.978641391e-01f,
-    1.886320949e+00f,
-    2.016514778e+00f,
-    4.074493885e+00f,
-    1.960476875e+01f,
-    2.968109512e+01f,
-    6.822839355e+01f,
-    5.746008873e+00f,
-    8.723242760e+00f,
-    1.354482746e+01f,
-    3.043029785e+00f,
-    1.603712201e+00f,
-    3.370038748e+00f,
-    7.645098567e-01f,
-    1.498863578e+00f,
-    2.836565673e-01f,
-    1.146791577e+00f,
-    2.848817110e+00f,
-    3.502175570e+00f,
-    2.130837202e+00f,
-    3.062340021e-01f,
-    7.545296550e-01f,
-    1.505588341e+01f,
-    7.481157303e+00f,
-    4.233929157e+00f,
-    9.211009741e-01f,
-    1.673790216e-01f,
-    9.473422170e-01f,
-    6.506602287e+00f,
-    8.531598091e+00f,
-    1.118553638e+01f,
-    1.104475737e+00f,
-    1.199304610e-01f,
-    3.061129749e-01f,
-    4.260908604e+00f,
-    1.274755287e+01f,
-    1.990852928e+01f,
-    1.340214610e-01f,
-    8.114226460e-01f,
-    1.693993509e-01f,
-    1.104758549e+01f,
-    5.170548439e+00f,
-    6.016919613e+00f,
-    1.276078105e+00f,
-    1.542508006e-01f,
-    7.181919813e-01f,
-    6.298207641e-01f,
-    5.327428579e-01f,
-    6.257403493e-01f,
-    7.472453117e+00f,
-    8.324110031e+00f,
-    2.435766411e+01f,
-    2.490540981e+00f,
-    7.237921357e-01f,
-    7.444270253e-01f,
-    2.094383049e+01f,
-    6.950986862e+00f,
-    9.015099525e+00f,
-    6.725142002e-01f,
-    1.492765546e-01f,
-    2.020389736e-01f,
-    1.218715668e+01f,
-    6.963974476e+00f,
-    1.976074028e+01f,
-    4.668229103e+00f,
-    1.506989002e+00f,
-    5.212867260e+00f,
-    2.171368217e+01f,
-    2.598676682e+01f,
-    1.017181931e+02f,
-    3.445881844e+00f,
-    1.740578175e+00f,
-    2.573055029e+00f,
-    1.823673248e+01f,
-    1.917979050e+01f,
-    2.672895813e+02f,
-    5.888442039e+00f,
-    1.496032000e+00f,
-    4.499063969e+00f,
-    2.699541092e+00f,
-    1.185414791e+00f,
-    2.676348448e+00f,
-    9.117994308e-01f,
-    8.544635773e-01f,
-    1.156536961e+01f,
-    8.918083191e+00f,
-    1.311993027e+01f,
-    1.576164246e+00f,
-    5.579048395e-01f,
-    1.107065320e+00f,
-    6.401040405e-02f,
-    1.417005360e-01f,
-    2.321001768e+00f,
-    2.199215412e+00f,
-    9.164229631e-01f,
-    2.265960932e+00f,
-    9.983190298e-01f,
-    5.519478917e-01f,
-    2.697587572e-02f,
-    4.110932723e-02f,
-    2.605797946e-01f,
-    1.995633698e+01f,
-    3.695967865e+01f,
-    4.664106369e+01f,
-    1.118211508e+00f,
-    2.581834793e-01f,
-    4.518994904e+01f,
-    4.596156693e+01f,
-    9.191081238e+01f,
-    1.414842606e+01f,
-    1.317294121e+01f,
-    3.486308670e+01f,
-    8.098301697e+01f,
-    1.748387527e+01f,
-    4.939962769e+01f,
-    2.705968285e+01f,
-    3.131937790e+01f,
-    4.281055450e+01f,
-    4.289071560e-01f,
-    6.790204346e-02f,
-    1.703605499e+02f,
-    1.431455536e+02f,
-    8.286481934e+02f,
-    2.767037749e-01f,
-    1.985782433e+01f,
-    9.688159943e+00f,
-    1.442333412e+01f,
-    2.582550235e-02f,
-    1.167502761e+00f,
-    1.835966483e-02f,
-    3.912505507e-01f,
-    3.395531178e-01f,
-    1.353328705e+01f,
-    1.074789906e+01f,
-    9.507821083e+00f,
-    3.002654314e-01f,
-    7.271518707e-01f,
-    3.564660847e-01f,
-    3.877154291e-01f,
-    9.439513832e-02f,
-    5.762847424e+00f,
-    1.089229345e+00f,
-    1.687432885e+00f,
-    2.143156342e-02f,
-    3.464158475e-01f,
-    6.022094563e-02f,
-    2.701385021e-01f,
-    1.900243640e+00f,
-    7.896353006e-01f,
-    6.743071079e-01f,
-    7.564517856e-01f,
-    8.290890455e-01f,
-    1.401810074e+01f,
-    1.181570721e+01f,
-    4.406247139e+00f,
-    6.737627983e-01f,
-    3.727419972e-01f,
-    4.638910592e-01f,
-    9.129024297e-02f,
-    1.964259744e-01f,
-    1.246180654e+00f,
-    1.665746450e+00f,
-    3.249409497e-01f,
-    1.885913849e+00f,
-    1.078836679e+00f,
-    5.190635920e-01f,
-    2.249365486e-02f,
-    1.916188188e-02f,
-    2.021957338e-01f,
-    1.656682372e+00f,
-    8.005685806e-01f,
-    1.091283417e+01f,
-    2.745655441e+01f,
-    2.594947624e+01f,
-    7.591527939e+00f,
-    2.621598482e+00f,
-    1.561494637e+01f,
-    8.003572226e-01f,
-    5.286944509e-01f,
-    3.868266821e+00f,
-    1.479822755e+00f,
-    2.877743244e+00f,
-    5.038942695e-01f,
-    7.144079208e-01f,
-    1.989642906e+01f,
-    1.293741703e+01f,
-    2.769268227e+01f,
-    1.662698627e+00f,
-    1.274637103e+00f,
-    1.167954445e+01f,
-    1.219089746e+00f,
-    5.702413940e+01f,
-    2.053135681e+01f,
-    1.747489738e+01f,
-    8.239455819e-01f,
-    3.114088476e-01f,
-    4.033896255e+01f,
-    4.455295944e+01f,
-    1.232620316e+02f,
-    8.709674835e+00f,
-    1.302630901e+01f,
-    7.666105270e+00f,
-    2.296298790e+01f,
-    1.115504074e+01f,
-    1.436225700e+01f,
-    2.897222328e+01f,
-    1.628401184e+01f,
-    2.242181778e+01f,
-    2.474634200e-01f,
-    9.505885094e-02f,
-    4.304905701e+01f,
-    6.197806549e+01f,
-    2.926360779e+02f,
-    9.154374897e-02f,
-    2.102874517e+00f,
-    9.413068295e-01f,
-    1.230813935e-01f,
-    1.570313722e-01f,
-    1.239307001e-01f,
-    8.519170880e-01f,
-    5.063648224e-01f,
-    6.439654529e-02f,
-    1.706644520e-02f,
-    2.910443246e-01f,
-    8.938714117e-02f,
-    2.299068928e+00f,
-    1.067047358e+00f,
-    1.725341082e+00f,
-    1.809353232e+00f,
-    8.236474991e+00f,
-    7.602399588e-01f,
-    4.258050323e-01f,
-    3.754697144e-01f,
-    2.091703415e-01f,
-    2.663245797e-01f,
-    4.250498414e-01f,
-    4.472284317e+00f,
-    1.410417676e+00f,
-    1.357472801e+01f,
-    1.206679249e+01f,
-    5.473139286e+00f,
-    2.874314547e+00f,
-    3.429069519e+00f,
-    4.693568230e+00f,
-    2.644191027e+00f,
-    3.005298615e+00f,
-    1.218027592e+00f,
-    1.146469265e-01f,
-    1.532295704e+00f,
-    6.326514482e-01f,
-    2.145579010e-01f,
-    1.592582941e+00f,
-    6.580446959e-01f,
-    6.882359982e-01f,
-    1.140133262e+00f,
-    8.220697045e-01f,
-    5.416353226e+00f,
-    2.305813551e+00f,
-    3.094168663e+01f,
-    7.367158890e+00f,
-    2.524741554e+01f,
-    8.282798529e-01f,
-    7.934758067e-01f,
-    3.468512344e+01f,
-    2.189597321e+01f,
-    2.146210861e+01f,
-    1.998833656e+01f,
-    1.506097126e+01f,
-    9.705582619e+00f,
-    4.437532806e+01f,
-    1.132003307e+01f,
-    1.437605953e+01f,
-    3.749089432e+01f,
-    1.068719196e+01f,
-    1.795893097e+01f,
-    3.486040831e-01f,
-    2.134308666e-01f,
-    1.073916245e+02f,
-    1.782249641e+01f,
-    1.258054123e+02f,
-    2.918896973e-01f,
-    2.524786568e+01f,
-    5.246904755e+01f,
-    1.539833450e+01f,
-    8.380031586e+00f,
-    8.825735092e+00f,
-    9.199206352e+00f,
-    1.629701376e+00f,
-    1.107088923e+00f,
-    2.743265724e+01f,
-    1.046890259e+02f,
-    3.417984009e+01f,
-    5.814100742e+00f,
-    5.075086594e+00f,
-    5.547081947e+00f,
-    2.872146606e+00f,
-    9.561896324e-01f,
-    1.141346931e+01f,
-    3.333072662e+01f,
-    1.503665543e+01f,
-    5.429570198e+00f,
-    4.619467735e+00f,
-    1.216476345e+01f,
-    2.959436774e-01f,
-    1.511611462e+00f,
-    2.812239528e-01f,
-    3.443686068e-01f,
-    2.743624449e-01f,
-    1.993278116e-01f,
-    1.110149670e+01f,
-    3.520069122e+01f,
-    3.218077469e+01f,
-    7.191380262e-01f,
-    1.279226243e-01f,
-    1.863067627e+01f,
-    3.681723404e+01f,
-    1.199383392e+02f,
-    6.132134914e+00f,
-    1.044103909e+01f,
-    2.766284180e+01f,
-    1.357052565e+00f,
-    2.671603262e-01f,
-    1.763742065e+01f,
-    1.764304352e+01f,
-    1.134833450e+02f,
-    2.733297944e-01f,
-    1.027228451e+01f,
-    3.464134693e+00f,
-    3.086236000e+01f,
-    3.815579224e+01f,
-    1.270682526e+01f,
-    2.103339767e+01f,
-    2.461295891e+01f,
-    2.202491379e+01f,
-    4.831575394e+00f,
-    4.796656132e+00f,
-    1.425243568e+01f,
-    8.905880928e+00f,
-    2.104149818e+01f,
-    9.069993973e+00f,
-    3.203893661e+00f,
-    4.779801559e+01f,
-    1.120768585e+02f,
-    1.080760956e+02f,
-    9.884196281e+00f,
-    2.885869980e+01f,
-    1.306214237e+01f,
-    7.474211693e+00f,
-    2.327842522e+01f,
-    3.292369461e+01f,
-    4.221603012e+01f,
-    3.131994724e+00f,
-    9.565122724e-01f,
-    1.778228283e+00f,
-    1.607784462e+01f,
-    5.350972366e+01f,
-    3.243852615e+01f,
-    8.552132416e+01f,
-    4.853223038e+01f,
-    1.376708865e+00f,
-    1.701921463e+01f,
-    2.557286644e+01f,
-    8.175617981e+01f,
-    9.279464483e-01f,
-    3.250696659e+00f,
-    2.034259081e+00f,
-    1.692409706e+01f,
-    3.990296936e+01f,
-    1.798928452e+01f,
-    7.025629520e+00f,
-    5.102202415e+00f,
-    4.456346512e+00f,
-    1.546189189e+00f,
-    3.545750856e+00f,
-    1.612017250e+01f,
-    2.912557983e+01f,
-    1.048855438e+02f,
-    7.301565170e+00f,
-    1.311569691e+00f,
-    1.082997513e+01f,
-    1.499308825e+00f,
-    1.488878369e+00f,
-    1.012074852e+01f,
-    1.875636292e+01f,
-    2.358111000e+01f,
-    5.564476490e+00f,
-    6.633015633e+00f,
-    1.121537304e+01f,
-    8.842673302e-01f,
-    2.406405687e+00f,
-    7.278588295e+00f,
-    2.573759270e+01f,
-    6.815159607e+01f,
-    5.228387070e+01f,
-    4.801784515e+01f,
-    2.781121063e+01f,
-    8.280979156e+01f,
-    1.599828243e+00f,
-    4.008252144e+00f,
-    1.349009705e+01f,
-    7.667854786e+00f,
-    9.775144577e+00f,
-    3.015366793e+00f,
-    2.794593334e+00f,
-    4.046266174e+01f,
-    8.022305298e+01f,
-    1.346211243e+02f,
-    1.940398026e+01f,
-    1.247759151e+01f,
-    7.345281982e+01f,
-    5.411222458e+00f,
-    1.413393497e+01f,
-    4.501216125e+01f,
-    1.714678192e+01f,
-    5.927664757e+00f,
-    8.078677177e+00f,
-    1.532962918e+00f,
-    2.092848778e+00f,
-    6.468845010e-01f,
-    1.613289642e+01f,
-    3.570304108e+01f,
-    1.082470894e+01f,
-    1.576560497e+00f,
-    3.234010458e+00f,
-    2.266946793e+00f,
-    3.600565493e-01f,
-    2.663471699e-01f,
-    1.492691898e+01f,
-    3.445690918e+01f,
-    8.101420403e+00f,
-    3.777519941e+00f,
-    6.123746395e+00f,
-    4.022374630e+00f,
-    3.436113000e-01f,
-    4.602781832e-01f,
-    2.176147550e-01f,
-    1.292093396e-01f,
-    1.577993482e-01f,
-    2.200078964e-01f,
-    1.612595940e+01f,
-    4.631700993e+00f,
-    3.594909668e+00f,
-    1.884000003e-01f,
-    1.905424893e-01f,
-    2.945955276e+01f,
-    1.661757827e+00f,
-    1.244063282e+01f,
-    1.793771386e+00f,
-    4.077292442e+00f,
-    1.259734631e+00f,
-    4.948286712e-01f,
-    4.022769928e-01f,
-    1.416228008e+01f,
-    2.346180439e+00f,
-    4.468788528e+01f,
-    4.152401909e-02f,
-    4.069537163e+00f,
-    1.850730062e+00f,
-    1.527204704e+01f,
-    2.700591850e+01f,
-    1.730860329e+01f,
-    4.889013290e+00f,
-    1.785914421e+01f,
-    7.936377048e+00f,
-    3.319173336e+00f,
-    2.680118799e+00f,
-    1.798783660e+00f,
-    1.791761994e+00f,
-    3.269504786e+00f,
-    3.318272114e+00f,
-    6.955299377e-01f,
-    2.668850327e+01f,
-    5.085315704e+01f,
-    1.803075790e+01f,
-    6.060211658e+00f,
-    3.819002151e+01f,
-    5.558410168e+00f,
-    2.589403391e+00f,
-    5.310977936e+01f,
-    2.707890320e+01f,
-    6.314434052e+00f,
-    9.697149992e-01f,
-    7.436640263e-01f,
-    3.815933764e-01f,
-    3.008008766e+01f,
-    3.547236633e+01f,
-    1.213638210e+01f,
-    4.927990112e+02f,
-    8.264939785e-01f,
-    3.611948490e-01f,
-    3.293949127e+01f,
-    1.034563828e+01f,
-    2.151766777e+00f,
-    2.944820225e-01f,
-    5.614794493e-01f,
-    4.216569662e-01f,
-    2.501304865e+00f,
-    6.441669464e+00f,
-    3.465090561e+01f,
-    5.882616520e+00f,
-    1.217313290e+01f,
-    1.124570751e+01f,
-    5.838447094e+00f,
-    1.300867367e+01f,
-    1.341832447e+01f,
-    6.983735561e+00f,
-    6.503758430e+00f,
-    3.159357071e+00f,
-    1.366283417e+01f,
-    1.271736336e+01f,
-    1.337654400e+01f,
-    9.683038712e+00f,
-    1.658202887e+00f,
-    4.438796639e-01f,
-    3.897616577e+01f,
-    1.155594254e+01f,
-    5.570155716e+01f,
-    4.112355709e+00f,
-    2.946494865e+01f,
-    1.108113194e+01f,
-    4.508571243e+01f,
-    1.242942333e+00f,
-    2.882220447e-01f,
-    3.478281021e+01f,
-    3.635794830e+01f,
-    1.497205353e+02f,
-    1.649079132e+01f,
-    9.515633583e+00f,
-    1.761485672e+01f,
-    3.324105835e+01f,
-    2.128430748e+01f,
-    3.617161560e+01f,
-    1.196602535e+01f,
-    1.735686111e+01f,
-    1.667019272e+01f,
-    9.059730768e-01f,
-    6.553699076e-02f,
-    2.284427948e+02f,
-    2.812507629e+01f,
-    5.793442993e+02f,
-    2.848218977e-01f,
-    8.858833313e+00f,
-    3.727808714e+00f,
-    1.190843296e+01f,
-    2.310323477e+00f,
-    1.351895571e+00f,
-    7.629836202e-01f,
-    6.921708584e-01f,
-    1.026687503e+00f,
-    5.994598866e+00f,
-    1.002132607e+01f,
-    1.153431606e+01f,
-    9.598479867e-01f,
-    1.136882305e+00f,
-    1.412145138e+00f,
-    8.942688107e-01f,
-    3.264500201e-01f,
-    5.352095604e+00f,
-    6.114720821e+00f,
-    4.386995697e+01f,
-    5.360742211e-01f,
-    7.009472847e-01f,
-    6.577189565e-01f,
-    7.018681765e-01f,
-    1.147975349e+01f,
-    5.914181232e+00f,
-    6.175046921e+00f,
-    5.867687702e+00f,
-    4.790810108e+00f,
-    1.185506248e+01f,
-    2.876653194e+00f,
-    3.394642591e+00f,
-    8.345930099e+00f,
-    6.973933697e+00f,
-    4.702770233e+00f,
-    9.018257856e-01f,
-    4.512130737e+00f,
-    1.106624985e+01f,
-    6.982917309e+00f,
-    4.166194916e+00f,
-    4.128807545e+00f,
-    1.259120464e+00f,
-    1.521744347e+01f,
-    7.403119087e+00f,
-    2.321607780e+01f,
-    6.260526657e+00f,
-    1.656298399e+00f,
-    9.026366472e-01f,
-    1.508529377e+01f,
-    8.130576134e+00f,
-    1.106001663e+01f,
-    3.581045151e+00f,
-    4.421743393e+00f,
-    4.717414856e+00f,
-    6.891175508e-01f,
-    6.949369311e-01f,
-    2.394459724e+00f,
-    1.161252141e+00f,
-    1.788419247e+00f,
-    7.987399101e-01f,
-    6.700736880e-01f,
-    1.143606377e+01f,
-    5.569306374e+00f,
-    1.192716885e+01f,
-    2.482428074e+00f,
-    1.301273108e+00f,
-    8.588173866e+00f,
-    1.888367176e+00f,
-    3.319056702e+01f,
-    1.222826767e+01f,
-    3.717533875e+01f,
-    5.457785130e-01f,
-    2.781822979e-01f,
-    7.285743713e+01f,
-    4.421973801e+01f,
-    1.113310471e+02f,
-    1.006697083e+01f,
-    1.023809338e+01f,
-    1.026156044e+01f,
-    1.657031631e+01f,
-    1.558140564e+01f,
-    1.407213402e+01f,
-    3.787265015e+01f,
-    1.063919258e+01f,
-    2.245248604e+01f,
-    2.662111819e-01f,
-    1.471762508e-01f,
-    5.729855728e+01f,
-    2.394983101e+01f,
-    3.425570374e+02f,
-    1.408385336e-01f,
-    1.547690868e+01f,
-    1.528955650e+01f,
-    1.005602741e+01f,
-    4.894807562e-02f,
-    4.251201153e+00f,
-    2.164554894e-01f,
-    5.175987482e-01f,
-    4.356829822e-01f,
-    9.655874252e+00f,
-    1.635278702e+01f,
-    3.662900925e+00f,
-    5.760455132e-01f,
-    7.701102495e-01f,
-    4.611424804e-01f,
-    1.479294747e-01f,
-    8.828818053e-02f,
-    5.356595516e+00f,
-    4.395760536e+00f,
-    2.562776804e+00f,
-    1.200634390e-01f,
-    5.324292779e-01f,
-    3.116174340e-01f,
-    3.368511796e-01f,
-    1.870878577e+00f,
-    1.432657480e+00f,
-    2.954504251e+00f,
-    3.762382865e-01f,
-    1.803192496e+00f,
-    4.321926594e+00f,
-    5.210902214e+00f,
-    3.906725883e+00f,
-    2.419439316e+00f,
-    1.300227284e+00f,
-    8.195816994e+00f,
-    8.979230523e-01f,
-    3.058545589e+00f,
-    4.220840454e+00f,
-    2.577361107e+00f,
-    1.873889685e+00f,
-    1.226464629e+00f,
-    4.234403372e-01f,
-    2.657719803e+01f,
-    1.500913382e+00f,
-    1.318977642e+01f,
-    2.109711885e+00f,
-    1.774765730e+00f,
-    1.238414884e+00f,
-    1.617885590e+01f,
-    3.735848999e+01f,
-    2.375369835e+01f,
-    1.641065001e+00f,
-    4.256886482e+00f,
-    4.170434475e+00f,
-    1.726095080e+00f,
-    1.019579172e+00f,
-    3.658962250e+00f,
-    1.480063945e-01f,
-    2.043795347e+00f,
-    6.392842531e-01f,
-    3.914048970e-01f,
-    1.866771579e+00f,
-    7.368236780e-01f,
-    3.000318706e-01f,
-    9.067808986e-01f,
-    7.260833383e-01f,
-    4.490064621e+00f,
-    3.025192022e+00f,
-    4.164412689e+01f,
-    1.701598549e+01f,
-    1.589843369e+01f,
-    9.274314642e-01f,
-    6.010530591e-01f,
-    4.937468719e+01f,
-    1.220432091e+01f,
-    8.392459869e+01f,
-    2.236083031e+01f,
-    1.351021767e+01f,
-    2.602795219e+01f,
-    1.034162369e+02f,
-    2.030099106e+01f,
-    1.071079445e+01f,
-    5.781772232e+01f,
-    1.948482895e+01f,
-    1.346172428e+01f,
-    3.807912767e-01f,
-    1.529345661e-01f,
-    1.068281250e+02f,
-    2.148814774e+01f,
-    2.289530487e+02f,
-    1.802508980e-01f,
-    1.820855331e+01f,
-    3.085362625e+01f,
-    1.688316345e+01f,
-    9.715209007e+00f,
-    5.310376167e+00f,
-    5.239978313e+00f,
-    1.229179263e+00f,
-    2.342825890e+00f,
-    4.745905304e+01f,
-    6.660562897e+01f,
-    2.167786789e+01f,
-    4.308459282e+00f,
-    4.798822880e+00f,
-    5.248016834e+00f,
-    9.995340705e-01f,
-    1.861656904e+00f,
-    2.277886200e+01f,
-    1.012355270e+02f,
-    2.921530342e+01f,
-    5.761254787e+00f,
-    6.287668705e+00f,
-    7.546233177e+00f,
-    7.756950259e-01f,
-    8.830537200e-01f,
-    3.362995684e-01f,
-    2.958156765e-01f,
-    1.849685013e-01f,
-    3.663048744e-01f,
-    1.118287277e+01f,
-    9.762166977e+00f,
-    2.065184975e+01f,
-    5.670700073e-01f,
-    3.933508694e-01f,
-    1.660388756e+01f,
-    8.089440155e+01f,
-    7.686734009e+01f,
-    1.099413300e+01f,
-    1.286267757e+01f,
-    4.596201324e+01f,
-    5.134720206e-01f,
-    4.418316185e-01f,
-    4.366310883e+01f,
-    3.890889740e+01f,
-    4.743531189e+02f,
-    6.674790382e-01f,
-    2.683719158e+00f,
-    8.925107718e-01f,
-    2.109229851e+01f,
-    4.243914795e+01f,
-    3.012853622e+01f,
-    1.534275651e+00f,
-    4.411392212e+00f,
-    4.589831829e+00f,
-    1.540834785e+00f,
-    1.250698090e+00f,
-    6.753964424e+00f,
-    6.684210151e-02f,
-    1.487485290e+00f,
-    1.311798215e+00f,
-    6.291625500e-01f,
-    6.140372753e-01f,
-    3.204485178e-01f,
-    1.548230499e-01f,
-    2.154082656e-01f,
-    1.166027188e+00f,
-    1.998936296e+00f,
-    4.396181107e+00f,
-    1.092503548e+01f,
-    2.222897911e+01f,
-    1.924008179e+01f,
-    1.416298747e+00f,
-    3.175464272e-01f,
-    2.412362397e-01f,
-    2.109726334e+01f,
-    1.751295280e+01f,
-    2.579490280e+01f,
-    6.278062820e+01f,
-    4.447210133e-01f,
-    4.117112234e-02f,
-    8.842169762e+00f,
-    5.585398197e+00f,
-    1.297144127e+01f,
-    4.500988722e-01f,
-    5.003273115e-02f,
-    5.633026734e-02f,
-    1.753155708e+01f,
-    2.531411934e+01f,
-    1.705829430e+01f,
-    9.670425415e+00f,
-    7.486890316e+00f,
-    4.247745037e+00f,
-    1.349363804e+00f,
-    1.346414924e+00f,
-    1.356257439e+01f,
-    1.472714329e+01f,
-    6.996745300e+01f,
-    8.175475121e+00f,
-    1.784258485e+00f,
-    1.291474724e+01f,
-    1.309569001e+00f,
-    1.980774760e+00f,
-    2.038924789e+01f,
-    2.450930405e+01f,
-    3.246304321e+01f,
-    4.636717796e+00f,
-    3.025659800e+00f,
-    1.309446430e+01f,
-    2.268054485e+00f,
-    4.987158298e+00f,
-    3.571522951e+00f,
-    3.807654190e+01f,
-    2.825956154e+01f,
-    4.269671631e+01f,
-    3.752847910e+00f,
-    4.416430950e+00f,
-    6.820811749e+00f,
-    1.843138337e+00f,
-    2.537964582e+00f,
-    1.044414902e+01f,
-    1.497511715e-01f,
-    1.649918199e+00f,
-    1.285144210e+00f,
-    7.159312963e-01f,
-    5.601326227e-01f,
-    4.483157396e-01f,
-    1.142554879e-01f,
-    1.950576752e-01f,
-    6.580598354e-01f,
-    1.525712013e+00f,
-    6.105937481e+00f,
-    1.209659481e+01f,
-    1.173668861e+01f,
-    7.574488163e+00f,
-    3.083021641e+00f,
-    7.048196793e+00f,
-    1.681424975e+00f,
-    1.464450002e+00f,
-    2.727842331e-01f,
-    4.601700211e+01f,
-    6.055683899e+01f,
-    1.580317688e+01f,
-    1.154404879e+00f,
-    3.333409786e+00f,
-    1.646435976e+00f,
-    1.167538047e+00f,
-    6.358214021e-01f,
-    1.936091995e+01f,
-    1.041841125e+02f,
-    2.214818192e+01f,
-    1.918943048e+00f,
-    8.392720222e+00f,
-    2.166179895e+00f,
-    1.140507102e+00f,
-    2.502351403e-01f,
-    3.479306400e-01f,
-    1.138229147e-01f,
-    1.525485665e-01f,
-    1.799166352e-01f,
-    6.008193970e+00f,
-    8.783324242e+00f,
-    1.322532654e+00f,
-    4.445547462e-01f,
-    2.380810678e-01f,
-    3.216336441e+01f,
-    3.118692160e+00f,
-    3.231686020e+01f,
-    1.779593825e+00f,
-    2.074532270e+00f,
-    3.303540707e+00f,
-    8.329116702e-01f,
-    4.797837436e-01f,
-    2.003134918e+01f,
-    3.935276031e+00f,
-    3.013500214e+01f,
-    1.540211122e-02f,
-    1.339666605e+00f,
-    6.740784645e-01f,
-    6.578341484e+00f,
-    1.762623405e+01f,
-    1.362906742e+01f,
-    7.427650094e-01f,
-    4.143833160e+00f,
-    7.840784788e-01f,
-    6.208309531e-01f,
-    5.968883038e-01f,
-    6.741838902e-02f,
-    2.803690434e+00f,
-    2.884644032e+00f,
-    1.860912085e+00f,
-    7.253467441e-01f,
-    2.025646567e-01f,
-    3.842773139e-01f,
-    3.129606485e+00f,
-    4.475192547e+00f,
-    1.469972610e+00f,
-    1.177352428e+00f,
-    7.038761973e-01f,
-    1.304208279e+01f,
-    8.723550797e+00f,
-    6.833065510e+00f,
-    6.983999610e-01f,
-    3.879270554e-01f,
-    8.591786027e-01f,
-    9.713795781e-02f,
-    4.252840281e-01f,
-    2.562211752e-01f,
-    7.379621029e+00f,
-    7.052196980e+00f,
-    1.641321564e+01f,
-    8.599198461e-01f,
-    4.014745057e-01f,
-    1.215206909e+01f,
-    1.825424576e+01f,
-    2.311894608e+01f,
-    5.323865414e+00f,
-    6.684964180e+00f,
-    1.446152782e+01f,
-    3.812533319e-01f,
-    1.478571033e+01f,
-    1.239493847e+01f,
-    7.511787891e+00f,
-    8.696068525e-01f,
-    3.946557045e-01f,
-    1.786185646e+01f,
-    8.636865616e+00f,
-    1.863765907e+01f,
-    6.204142570e-01f,
-    7.950203419e-01f,
-    4.333716333e-01f,
-    2.217919379e-01f,
-    9.349838495e-01f,
-    5.836030245e-01f,
-    1.615225792e+01f,
-    7.307967186e+00f,
-    5.814658642e+00f,
-    7.646949887e-01f,
-    4.613310993e-01f,
-    5.544891953e-01f,
-    5.232683942e-02f,
-    2.938601077e-01f,
-    1.272476315e-01f,
-    6.395112872e-01f,
-    8.440473080e-01f,
-    1.113734150e+01f,
-    1.519380665e+01f,
-    1.405786514e+01f,
-    2.984436512e+00f,
-    1.980722308e+00f,
-    4.202161312e+00f,
-    7.032802105e-01f,
-    1.047762036e+00f,
-    7.187172771e-01f,
-    1.280841923e+01f,
-    8.285942078e+00f,
-    1.969846153e+01f,
-    7.201254964e-01f,
-    3.640754223e-01f,
-    1.724890327e+01f,
-    1.188477707e+01f,
-    3.010936928e+01f,
-    1.321399689e+01f,
-    1.152672005e+01f,
-    5.591625214e+00f,
-    1.289886832e-01f,
-    1.898950577e+01f,
-    9.140879631e+00f,
-    9.200242996e+00f,
-    7.351301908e-01f,
-    4.323200583e-01f,
-    1.259182072e+01f,
-    1.104347229e+01f,
-    1.513333416e+01f,
-    8.146681786e+00f,
-    1.918168783e+00f,
-    2.768690348e+00f,
-    6.286121011e-01f,
-    8.011391163e-01f,
-    1.906493008e-01f,
-    1.017964554e+01f,
-    7.289330482e+00f,
-    2.780069733e+01f,
-    5.661228299e-01f,
-    3.866413534e-01f,
-    7.432104588e+00f,
-    8.004080772e+00f,
-    4.613598633e+01f,
-    9.457845092e-01f,
-    2.677546024e+00f,
-    1.621191740e+00f,
-    3.943197250e+01f,
-    8.120547485e+01f,
-    4.571810913e+01f,
-    7.077153206e+00f,
-    5.257767200e+00f,
-    1.487502575e+01f,
-    1.753465772e+00f,
-    1.560116291e+00f,
-    5.861313343e+00f,
-    2.294638443e+01f,
-    1.886077118e+01f,
-    7.271128845e+01f,
-    5.192275047e-01f,
-    8.107952476e-01f,
-    4.021143615e-01f,
-    1.253299618e+01f,
-    2.288112831e+01f,
-    2.832912445e+01f,
-    1.088535690e+01f,
-    1.529322338e+01f,
-    1.123313427e+01f,
-    6.707504392e-01f,
-    6.122220159e-01f,
-    1.210749817e+01f,
-    1.553448296e+01f,
-    3.504471588e+01f,
-    9.547521591e+00f,
-    1.805881262e+00f,
-    2.284599781e+00f,
-    1.500124574e+00f,
-    1.863309622e+00f,
-    3.923413038e+00f,
-    1.394808674e+01f,
-    3.016178322e+01f,
-    7.908094788e+01f,
-    1.392583752e+01f,
-    9.054441452e+00f,
-    1.483001804e+01f,
-    1.944462538e+00f,
-    2.589165211e+00f,
-    5.839049339e+00f,
-    1.866766930e+00f,
-    1.176745415e+00f,
-    2.532677889e+00f,
-    1.324402928e+00f,
-    7.720188498e-01f,
-    1.103047490e+00f,
-    1.728991890e+01f,
-    1.590027523e+01f,
-    1.347711277e+01f,
-    7.235119939e-01f,
-    3.319693208e-01f,
-    3.633843064e-01f,
-    2.625787258e-01f,
-    8.460171521e-02f,
-    1.169493124e-01f,
-    1.366688609e+00f,
-    1.319034338e+00f,
-    3.975835443e-01f,
-    9.247976542e-01f,
-    7.335221171e-01f,
-    3.474024534e+00f,
-    4.440202415e-01f,
-    2.073532157e-02f,
-    3.919947520e-02f,
-    4.557175934e-01f,
-    1.924001239e-02f,
-    7.843651772e+00f,
-    3.074886650e-02f,
-    3.778481781e-01f,
-    4.593287408e-01f,
-    4.329503477e-01f,
-    5.254277587e-02f,
-    7.129608095e-02f,
-    2.460373938e-02f,
-    7.213045657e-02f,
-    5.081238556e+01f,
-    9.233304596e+01f,
-    5.044723892e+01f,
-    8.897943497e-01f,
-    2.971921563e-01f,
-    4.672372341e-01f,
-    7.153497314e+01f,
-    4.644568253e+01f,
-    1.242835388e+02f,
-    1.813495827e+01f,
-    3.743405914e+01f,
-    2.290208054e+01f,
-    1.357335968e+02f,
-    9.872486442e-02f,
-    3.075907707e+01f,
-    1.893444633e+01f,
-    4.165724182e+01f,
-    8.863071442e+01f,
-    5.075878501e-01f,
-    5.927680433e-02f,
-    1.152793914e-01f,
-    1.426143341e+02f,
-    3.819778061e+01f,
-    2.975306091e+02f,
-    3.066143394e-01f,
-    8.425250053e-01f,
-    1.069266129e+01f,
-    5.650017738e+00f,
-    5.410365462e-01f,
-    3.411544859e-01f,
-    2.975389659e-01f,
-    1.403749847e+01f,
-    6.329616547e+01f,
-    4.808765030e+01f,
-    2.290777922e+00f,
-    3.747438192e+00f,
-    4.058502674e+00f,
-    5.782643795e+00f,
-    2.724702358e-01f,
-    4.509823799e+00f,
-    5.379843712e-01f,
-    1.484339237e+01f,
-    6.531422138e+00f,
-    1.173349768e-01f,
-    2.470446825e-01f,
-    1.602430344e-01f,
-    5.467303753e+00f,
-    4.119699097e+01f,
-    4.820590973e+01f,
-    2.951537818e-02f,
-    2.633001208e-01f,
-    6.104792356e-01f,
-    3.141750991e-01f,
-    2.115462685e+01f,
-    1.627116585e+01f,
-    2.559951782e+01f,
-    2.367671430e-01f,
-    8.933348656e-01f,
-    2.218194604e-01f,
-    2.360488847e-02f,
-    1.057039052e-01f,
-    7.856998593e-02f,
-    7.796920300e+00f,
-    3.671589375e+00f,
-    4.059534073e+00f,
-    2.835799754e-02f,
-    9.467647672e-01f,
-    1.387737393e-01f,
-    3.623117208e-01f,
-    1.120728016e+00f,
-    3.564532399e-01f,
-    3.136899173e-01f,
-    7.034378052e-01f,
-    5.868050084e-02f,
-    1.076258644e-01f,
-    9.623988867e-01f,
-    9.455382228e-01f,
-    1.172850281e-01f,
-    2.807100773e+00f,
-    6.299921274e-01f,
-    7.700579762e-01f,
-    6.211729050e-01f,
-    1.211530529e-02f,
-    3.479619324e-02f,
-    2.066616565e-01f,
-    1.418753505e+00f,
-    4.671418369e-01f,
-    4.825231433e-01f,
-    1.839433052e-02f,
-    6.036556363e-01f,
-    6.596592814e-02f,
-    3.013447225e-01f,
-    7.953388989e-02f,
-    1.181779057e-01f,
-    1.721923947e-01f,
-    2.142742276e-01f,
-    1.147863865e-01f,
-    1.008466003e-03f,
-    6.013762355e-01f,
-    8.348633051e-01f,
-    1.093699574e+00f,
-    2.810043716e+01f,
-    2.426950073e+01f,
-    2.443181419e+01f,
-    1.479410267e+01f,
-    1.951202393e+00f,
-    6.915476322e+00f,
-    2.229132891e+00f,
-    1.205840945e+00f,
-    9.022209644e-01f,
-    1.408353686e+00f,
-    5.453072786e-01f,
-    2.107728958e+00f,
-    1.906390935e-01f,
-    7.526829243e-01f,
-    7.188977003e-01f,
-    1.706814766e+01f,
-    1.846602249e+01f,
-    2.697924232e+01f,
-    5.311950207e+00f,
-    1.052634835e+00f,
-    1.185352993e+01f,
-    1.511663437e+00f,
-    1.188684082e+02f,
-    1.421255493e+02f,
-    1.504927673e+02f,
-    5.834491253e-01f,
-    8.845633268e-02f,
-    2.025824785e-01f,
-    4.395188904e+01f,
-    7.980820465e+01f,
-    1.418474121e+02f,
-    2.256027031e+01f,
-    2.784028816e+01f,
-    4.565760040e+01f,
-    7.750635529e+01f,
-    7.701405138e-02f,
-    1.774486542e+01f,
-    8.959117889e+01f,
-    2.391675186e+01f,
-    5.228344727e+01f,
-    2.454831600e-01f,
-    3.920684382e-02f,
-    8.139987290e-02f,
-    7.120075226e+01f,
-    3.316711044e+01f,
-    4.817371826e+02f,
-    1.153743416e-01f,
-    6.179518700e+00f,
-    5.874912262e+00f,
-    1.098765469e+01f,
-    2.006300354e+01f,
-    3.871403122e+01f,
-    4.716217422e+01f,
-    6.350291824e+01f,
-    7.929103851e+01f,
-    3.724028625e+02f,
-    7.278997898e+00f,
-    2.769650459e+00f,
-    4.696200371e+00f,
-    2.122759247e+01f,
-    1.424420357e+00f,
-    1.826300049e+01f,
-    5.564739227e+00f,
-    4.063582897e+00f,
-    1.203259182e+01f,
-    1.405436611e+01f,
-    5.780174136e-01f,
-    2.519265556e+01f,
-    1.598138123e+02f,
-    4.816256332e+01f,
-    2.303755127e+03f,
-    2.235713959e+00f,
-    1.111347556e+00f,
-    6.872328231e-05f,
-    7.868400216e-01f,
-    2.557480574e+00f,
-    1.157096148e+00f,
-    2.209138298e+01f,
-    1.341392326e+01f,
-    1.252637959e+01f,
-    1.601946592e+00f,
-    2.393305063e+00f,
-    3.703361034e+00f,
-    1.390211463e+00f,
-    1.410304308e+00f,
-    9.850670695e-01f,
-    1.312317848e+00f,
-    4.623824060e-01f,
-    1.624689460e+00f,
-    7.529885322e-02f,
-    5.588149428e-01f,
-    1.128484234e-01f,
-    2.365356922e+00f,
-    1.228799820e+00f,
-    8.497902751e-01f,
-    5.507006645e-01f,
-    7.613859773e-01f,
-    8.153432608e-01f,
-    2.148968935e+00f,
-    2.371516228e+01f,
-    2.856482124e+01f,
-    2.775778008e+01f,
-    8.248554468e-01f,
-    3.639948964e-01f,
-    3.538289666e-01f,
-    3.214269638e+01f,
-    4.401844025e+01f,
-    1.255477219e+02f,
-    1.133312511e+01f,
-    2.069386673e+01f,
-    1.867439079e+01f,
-    2.988090515e+01f,
-    7.974776626e-02f,
-    3.461854553e+01f,
-    4.173076248e+01f,
-    2.339740944e+01f,
-    1.138154907e+02f,
-    5.796503425e-01f,
-    1.880786121e-01f,
-    2.291710973e-01f,
-    6.880297089e+01f,
-    1.662627220e+01f,
-    5.452922974e+02f,
-    8.839620948e-01f,
-    7.119386196e+00f,
-    9.320500374e+00f,
-    9.977718353e+00f,
-    1.846284866e+01f,
-    2.173195457e+01f,
-    3.830228043e+01f,
-    2.668657494e+01f,
-    1.235221024e+02f,
-    1.867202393e+03f,
-    4.023645878e+00f,
-    6.034065247e+00f,
-    1.358941650e+01f,
-    8.546223640e+00f,
-    3.965745270e-01f,
-    1.325747871e+01f,
-    2.059356213e+00f,
-    9.615821838e+00f,
-    1.630557823e+01f,
-    1.464475536e+01f,
-    2.390107214e-01f,
-    1.897054195e+00f,
-    4.987307358e+01f,
-    1.959530182e+02f,
-    2.608857727e+02f,
-    4.567229271e+00f,
-    3.515660465e-01f,
-    5.517121553e-01f,
-    3.398813248e+00f,
-    1.150785804e+00f,
-    1.122253895e+01f,
-    8.923125863e-01f,
-    1.397691816e-01f,
-    3.255413055e+00f,
-    9.617148899e-03f,
-    4.595575809e+00f,
-    2.270761728e+00f,
-    6.297588825e+00f,
-    3.931672287e+01f,
-    5.942057419e+01f,
-    1.517708778e+01f,
-    1.426801109e+01f,
-    1.043180847e+01f,
-    1.951587677e+01f,
-    6.900952816e+00f,
-    4.278381348e+00f,
-    4.506744862e+00f,
-    7.050146103e+00f,
-    4.442321301e+00f,
-    5.104063511e+00f,
-    1.231472135e+00f,
-    2.751543760e+00f,
-    5.030706882e+00f,
-    8.343313599e+01f,
-    9.039448547e+01f,
-    4.751517868e+01f,
-    1.395455647e+01f,
-    1.624033165e+01f,
-    1.287844658e+01f,
-    4.424872875e+00f,
-    7.423093915e-01f,
-    1.368309975e+00f,
-    6.088953614e-01f,
-    2.432047844e+01f,
-    2.454487610e+01f,
-    1.595519829e+01f,
-    1.980095520e+02f,
-    2.014558220e+01f,
-    3.661928654e+00f,
-    1.357446289e+01f,
-    2.912853813e+01f,
-    2.615970421e+01f,
-    8.619012237e-01f,
-    2.038035154e+00f,
-    2.717257977e+00f,
-    5.952146912e+01f,
-    7.393328094e+01f,
-    1.340728855e+01f,
-    3.752185059e+01f,
-    1.589514732e+01f,
-    1.541454411e+01f,
-    1.312111855e+01f,
-    9.540188599e+01f,
-    1.268034210e+02f,
-    2.791413069e+00f,
-    5.592173576e+00f,
-    2.049934959e+01f,
-    2.144072533e+00f,
-    2.804429233e-01f,
-    6.823489666e-01f,
-    1.189657669e+02f,
-    4.348964844e+02f,
-    4.395166931e+02f,
-    1.771136820e-01f,
-    1.032882977e+01f,
-    2.262005806e+00f,
-    2.310663223e+00f,
-    8.799559593e+00f,
-    4.288285732e+00f,
-    2.830218077e+00f,
-    2.044339418e+00f,
-    2.014712095e+00f,
-    3.295117855e+00f,
-    3.921109772e+01f,
-    5.405049515e+01f,
-    6.869112396e+01f,
-    8.286228180e+00f,
-    6.470293522e+00f,
-    1.520453644e+01f,
-    6.861256123e+00f,
-    7.599461079e+00f,
-    9.984024811e+01f,
-    5.413023376e+01f,
-    9.195292592e-01f,
-    3.286495924e+00f,
-    2.384808779e+00f,
-    3.227471924e+02f,
-    1.476946950e+00f,
-    5.512653589e-01f,
-    1.674350357e+01f,
-    5.987439346e+01f,
-    4.153792572e+01f,
-    2.271660156e+02f,
-    4.558687210e-01f,
-    1.149067163e+00f,
-    1.294540882e+00f,
-    2.670318604e+01f,
-    3.547628021e+01f,
-    4.481287384e+01f,
-    6.972087622e-01f,
-    5.311044693e+00f,
-    6.032493114e+00f,
-    1.480859995e+00f,
-    4.498595595e-01f,
-    1.020143867e+00f,
-    3.869350255e-01f,
-    1.537559319e+01f,
-    1.493927002e+02f,
-    7.128395081e+01f,
-    8.398834467e-01f,
-    1.210291505e+00f,
-    6.719859123e+00f,
-    3.878441811e+00f,
-    1.581974888e+01f,
-    1.749374866e+00f,
-    3.982491255e+00f,
-    1.128600788e+01f,
-    6.478811264e+00f,
-    2.297969818e+01f,
-    5.136177540e+00f,
-    6.538952351e+00f,
-    3.672972679e+00f,
-    1.546601582e+01f,
-    2.602699518e+00f,
-    8.621438980e+00f,
-    1.719421959e+01f,
-    1.793596840e+01f,
-    4.192540741e+01f,
-    7.008533478e-01f,
-    3.325698972e-01f,
-    6.286147833e-01f,
-    2.790634537e+01f,
-    1.749693489e+01f,
-    4.529973221e+01f,
-    3.799455166e+00f,
-    9.953671455e+00f,
-    4.908486307e-01f,
-    3.608802080e+00f,
-    4.730956852e-01f,
-    8.135325432e+00f,
-    6.093156934e-01f,
-    6.573596954e+00f,
-    8.172380924e-01f,
-    2.052594662e+00f,
-    4.122790813e+00f,
-    3.330137730e+00f,
-    2.844983816e+00f,
-    4.926851019e-02f,
-    6.252983570e+00f,
-    7.043083757e-02f,
-    5.419222713e-01f,
-    1.770072579e-01f,
-    1.055745184e-01f,
-    5.854861736e+00f,
-    7.615309715e+00f,
-    1.426751423e+01f,
-    1.177917957e+00f,
-    2.125312614e+01f,
-    1.961573219e+01f,
-    5.712636185e+01f,
-    8.928533792e-01f,
-    5.230819061e-02f,
-    2.258915603e-01f,
-    6.470437622e+01f,
-    6.075695801e+01f,
-    6.697711182e+01f,
-    2.489349556e+01f,
-    1.468673134e+01f,
-    1.520865917e+01f,
-    1.048187943e+02f,
-    2.378572673e-01f,
-    3.222365570e+01f,
-    1.874687767e+01f,
-    8.898488045e+00f,
-    3.688677979e+01f,
-    2.766300142e-01f,
-    3.435304388e-02f,
-    1.031204313e-01f,
-    7.829875946e+01f,
-    3.805300903e+01f,
-    2.223879242e+02f,
-    3.077642620e-01f,
-    2.294833660e+00f,
-    9.365168571e+00f,
-    2.998549223e+00f,
-    4.291923344e-01f,
-    2.280646414e-01f,
-    3.686688244e-01f,
-    5.567548275e+00f,
-    7.957268524e+01f,
-    2.076216507e+01f,
-    3.133822203e+00f,
-    6.526575565e+00f,
-    5.363224983e+00f,
-    1.302278423e+01f,
-    1.982020736e-01f,
-    5.449876308e+00f,
-    7.543510795e-01f,
-    6.999004841e+00f,
-    2.675726891e+00f,
-    2.288175672e-01f,
-    2.250588536e-01f,
-    1.702148169e-01f,
-    3.193519115e+00f,
-    3.299164200e+01f,
-    2.542986488e+01f,
-    1.209300291e-02f,
-    1.219701648e+00f,
-    9.579392076e-01f,
-    8.827446699e-01f,
-    1.496098423e+01f,
-    8.353353500e+00f,
-    1.301710987e+01f,
-    6.713206768e-01f,
-    1.237012982e+00f,
-    1.358296752e+00f,
-    2.046342492e-01f,
-    6.787868738e-01f,
-    3.086067736e-01f,
-    1.339715290e+01f,
-    7.905592918e+00f,
-    4.911297607e+01f,
-    5.803452134e-01f,
-    2.033390999e+00f,
-    2.623786628e-01f,
-    1.087967157e+00f,
-    2.569022894e+00f,
-    1.923245668e+00f,
-    2.259758234e+00f,
-    4.636534214e+00f,
-    2.343059778e+00f,
-    6.209682465e+00f,
-    1.635547638e+01f,
-    1.761953545e+01f,
-    2.093582344e+01f,
-    1.060236812e+00f,
-    1.165620461e-01f,
-    3.225036561e-01f,
-    2.265337563e+01f,
-    1.350643635e+01f,
-    1.629694176e+01f,
-    3.675446033e+00f,
-    5.849895477e+00f,
-    1.344813466e+00f,
-    3.092063427e+00f,
-    2.635795772e-01f,
-    8.662921786e-01f,
-    5.844243765e-01f,
-    2.192672253e+00f,
-    1.198226810e+00f,
-    2.450502872e+00f,
-    8.197005272e+00f,
-    7.209691048e+00f,
-    7.728676319e+00f,
-    4.160692394e-01f,
-    1.199110627e+00f,
-    9.267538190e-01f,
-    1.065949440e+00f,
-    1.107502842e+01f,
-    9.217748642e+00f,
-    9.804018021e+00f,
-    4.914146900e+00f,
-    1.188328028e+00f,
-    4.192600250e+00f,
-    1.930114985e+00f,
-    1.604748607e+00f,
-    1.376008272e+00f,
-    1.211479545e+00f,
-    4.601283669e-01f,
-    7.573699951e-01f,
-    4.252460003e-01f,
-    1.068700671e+00f,
-    1.526911259e+00f,
-    9.418321609e+00f,
-    8.917559624e+00f,
-    9.467726707e+00f,
-    3.974620104e+00f,
-    3.275517464e+00f,
-    4.736157417e+00f,
-    1.427796006e+00f,
-    5.462265396e+01f,
-    9.582538605e+01f,
-    8.822747803e+01f,
-    9.658252597e-01f,
-    8.485365659e-02f,
-    1.807599366e-01f,
-    8.252204132e+01f,
-    1.325213776e+02f,
-    1.762306213e+02f,
-    2.152156258e+01f,
-    3.241438675e+01f,
-    1.773869133e+01f,
-    3.581071091e+01f,
-    6.391521096e-01f,
-    4.044097900e+01f,
-    8.775817871e+01f,
-    2.941554070e+01f,
-    8.321203613e+01f,
-    1.846701354e-01f,
-    8.390544355e-02f,
-    1.737924814e-01f,
-    8.051695251e+01f,
-    4.110298157e+01f,
-    4.419046021e+02f,
-    2.661238611e-01f,
-    7.146396637e+00f,
-    3.688570023e+00f,
-    1.444417477e+01f,
-    1.736168861e+01f,
-    1.721109009e+02f,
-    7.564550018e+01f,
-    2.056804962e+02f,
-    4.979538574e+02f,
-    3.335726807e+03f,
-    1.109438705e+01f,
-    5.945961475e+00f,
-    6.180724144e+00f,
-    1.327965736e+01f,
-    1.394635916e+00f,
-    8.530364990e+00f,
-    2.174544811e+00f,
-    2.570501566e+00f,
-    3.987643719e+00f,
-    1.537337208e+01f,
-    8.810328841e-01f,
-    2.815254211e+01f,
-    1.421948242e+02f,
-    2.105158081e+02f,
-    1.452689941e+03f,
-    4.220560455e+01f,
-    6.407538801e-02f,
-    3.806501329e-01f,
-    1.753718853e-01f,
-    9.171362877e+00f,
-    4.639739513e+00f,
-    1.565531349e+01f,
-    5.147645995e-02f,
-    6.823902130e-01f,
-    1.325098425e-01f,
-    4.696790576e-01f,
-    8.608346581e-01f,
-    1.551943421e-01f,
-    1.932221949e-01f,
-    1.745391273e+01f,
-    2.499559164e+00f,
-    2.105361748e+01f,
-    9.921385646e-01f,
-    4.215483189e+00f,
-    2.937390518e+01f,
-    3.408840561e+01f,
-    6.124843359e-01f,
-    5.354372263e-01f,
-    8.717561364e-01f,
-    6.935667396e-01f,
-    3.809895325e+01f,
-    1.583660221e+01f,
-    3.563000488e+01f,
-    1.569990635e+00f,
-    2.994172096e+00f,
-    2.005255222e+00f,
-    1.234321356e+00f,
-    1.569436431e+00f,
-    1.363615036e+00f,
-    9.447633624e-01f,
-    3.881585300e-01f,
-    3.354342699e+00f,
-    2.228221148e-01f,
-    4.342986643e-01f,
-    2.832283378e-01f,
-    1.899601936e+00f,
-    9.374001026e-01f,
-    7.477307320e-01f,
-    2.636636198e-01f,
-    8.691585660e-01f,
-    1.108201027e+00f,
-    2.692460060e+00f,
-    9.421343231e+01f,
-    7.084259033e+01f,
-    6.738462067e+01f,
-    6.889158487e-01f,
-    4.915330410e-01f,
-    5.251978040e-01f,
-    8.835378265e+01f,
-    1.028463287e+02f,
-    3.483370056e+02f,
-    1.641136551e+01f,
-    4.838459015e+01f,
-    2.827221680e+01f,
-    6.445983887e+01f,
-    3.569031954e-01f,
-    8.959075165e+01f,
-    6.728697968e+01f,
-    5.006593323e+01f,
-    1.682250671e+02f,
-    8.152046800e-01f,
-    3.732188046e-01f,
-    8.963053823e-01f,
-    1.078776093e+02f,
-    3.003401756e+01f,
-    1.240358276e+03f,
-    2.978323102e-01f,
-    2.539026022e+00f,
-    7.987607956e+00f,
-    7.267755985e+00f,
-    5.295592880e+01f,
-    1.146706924e+02f,
-    7.331886292e+01f,
-    1.844269943e+01f,
-    9.401193237e+01f,
-    2.272387085e+02f,
-    7.044156551e+00f,
-    7.219648838e+00f,
-    8.978392601e+00f,
-    1.586950779e+01f,
-    3.199670315e-01f,
-    1.462762833e+01f,
-    7.715012431e-01f,
-    2.882533789e+00f,
-    5.399794579e+00f,
-    7.631835461e+00f,
-    3.909959793e-01f,
-    1.133297920e+00f,
-    1.334519958e+01f,
-    2.086282043e+02f,
-    4.610831070e+01f,
-    1.464241219e+01f,
-    1.090659350e-01f,
-    6.240809560e-01f,
-    1.578846097e+00f,
-    6.435825825e+00f,
-    1.381237149e+00f,
-    1.266931438e+01f,
-    6.568589211e-01f,
-    3.865078837e-02f,
-    2.109225750e+00f,
-    6.682323664e-02f,
-    1.092051148e+00f,
-    1.694096327e+00f,
-    1.211866140e+00f,
-    5.209146118e+01f,
-    4.360517502e+01f,
-    2.775687981e+01f,
-    1.147126555e+00f,
-    4.364868641e+00f,
-    2.468569994e+00f,
-    2.891450882e+00f,
-    1.098203897e+00f,
-    1.783382535e+00f,
-    2.293414831e+00f,
-    4.128590226e-02f,
-    1.303981304e+00f,
-    2.073446363e-01f,
-    6.236542463e-01f,
-    4.965859056e-01f,
-    1.690132380e+00f,
-    8.135633469e-01f,
-    7.814537883e-01f,
-    2.875312567e-01f,
-    1.863610268e+00f,
-    1.084136009e+00f,
-    1.894051075e+00f,
-    1.361985803e+00f,
-    1.245444119e-01f,
-    2.589972913e-01f,
-    2.892330360e+01f,
-    5.677466202e+01f,
-    4.008837891e+01f,
-    2.326894379e+02f,
-    4.576484859e-01f,
-    1.793244928e-01f,
-    1.429910278e+01f,
-    1.566209316e+01f,
-    1.976318169e+01f,
-    5.160219669e-01f,
-    1.123011559e-01f,
-    7.565573603e-02f,
-    1.941109657e+00f,
-    3.547039413e+01f,
-    1.573421574e+01f,
-    7.126602650e+00f,
-    3.086833477e+00f,
-    2.718208551e+00f,
-    3.470142603e+00f,
-    1.186767668e-01f,
-    1.814208746e+00f,
-    4.885633886e-01f,
-    2.095305443e+00f,
-    1.271091223e+00f,
-    3.387148082e-01f,
-    1.029815897e-01f,
-    9.567160904e-02f,
-    5.915014744e-01f,
-    3.916396618e+00f,
-    3.851123095e+00f,
-    9.048607200e-03f,
-    2.872053385e+00f,
-    1.510813236e+00f,
-    2.619622946e+00f,
-    4.901579857e+00f,
-    1.968020797e-01f,
-    1.423396707e+00f,
-    9.465458393e-01f,
-    1.576265335e+00f,
-    1.199605823e+00f,
-    1.734959126e+00f,
-    8.088009953e-01f,
-    6.851027012e-01f,
-    2.940105796e-01f,
-    8.915569782e-01f,
-    2.284363508e+00f,
-    1.963200927e+00f,
-    1.742961502e+01f,
-    4.589627087e-01f,
-    3.921252501e-04f,
-    1.131761551e+00f,
-    2.624446452e-01f,
-    1.090271711e+00f,
-    1.906205559e+01f,
-    1.376618576e+01f,
-    1.481629848e+01f,
-    4.618214071e-01f,
-    1.064395159e-01f,
-    4.460646808e-01f,
-    5.837891102e-01f,
-    9.874214232e-02f,
-    2.340399176e-01f,
-    1.301542670e-01f,
-    1.397630882e+01f,
-    7.965471745e+00f,
-    1.587157059e+01f,
-    6.327338815e-01f,
-    1.157626212e-01f,
-    2.293391228e-01f,
-    2.588151741e+01f,
-    9.621451378e+00f,
-    1.610500717e+01f,
-    1.329343414e+01f,
-    1.214503384e+01f,
-    1.556873512e+01f,
-    3.261385858e-01f,
-    1.853139549e-01f,
-    1.110316396e+00f,
-    5.206803679e-01f,
-    1.733707237e+01f,
-    1.778950500e+01f,
-    1.667991638e+01f,
-    2.305861115e-01f,
-    8.010500669e-01f,
-    4.447530210e-01f,
-    5.968614817e-01f,
-    8.581916094e-01f,
-    9.558330476e-02f,
-    2.930050194e-01f,
-    7.749501467e-01f,
-    4.740504175e-02f,
-    1.318449378e-01f,
-    8.047269285e-02f,
-    2.194839954e+00f,
-    4.154969752e-01f,
-    6.278499365e-01f,
-    5.722452886e-03f,
-    2.198619395e-01f,
-    3.611384332e-01f,
-    5.839190483e-01f,
-    1.456091213e+01f,
-    1.932960320e+01f,
-    1.755839539e+01f,
-    2.999700785e+00f,
-    3.679858685e+00f,
-    2.488741636e+00f,
-    1.209001899e+00f,
-    1.350325704e+00f,
-    1.238067150e+00f,
-    1.274780512e+00f,
-    1.480784416e+01f,
-    1.202393341e+01f,
-    1.267165279e+01f,
-    6.818208098e-01f,
-    1.023840979e-01f,
-    3.290236890e-01f,
-    1.457047272e+01f,
-    2.557203674e+01f,
-    3.467085266e+01f,
-    1.618815613e+01f,
-    2.746522331e+01f,
-    1.779940414e+01f,
-    2.858349085e-01f,
-    3.330874920e+00f,
-    3.378350496e+00f,
-    1.494935989e+00f,
-    1.529269123e+01f,
-    1.088525295e+01f,
-    7.770949841e+00f,
-    1.113622952e+01f,
-    1.938327980e+01f,
-    1.249121857e+02f,
-    6.754974842e+00f,
-    1.084579706e+00f,
-    1.327992320e+00f,
-    4.835429788e-01f,
-    2.200587243e-01f,
-    1.405817270e+00f,
-    2.041471481e+00f,
-    6.695598364e-01f,
-    1.424819976e-01f,
-    1.746015787e+00f,
-    1.159988523e+00f,
-    1.202281356e+00f,
-    3.046009254e+01f,
-    2.901133156e+01f,
-    4.777994537e+01f,
-    2.200201273e+00f,
-    3.211742401e+00f,
-    4.671980858e+00f,
-    1.850307822e+00f,
-    9.444826841e-01f,
-    2.310370922e+00f,
-    1.834218621e+00f,
-    6.662418842e-01f,
-    3.675140142e-01f,
-    6.173338890e-01f,
-    2.009073257e+01f,
-    4.301519012e+01f,
-    2.451907158e+01f,
-    5.518072605e+00f,
-    1.077524796e+02f,
-    2.895335007e+01f,
-    3.744074106e+00f,
-    2.366489410e+00f,
-    2.747648478e+00f,
-    2.250075936e-01f,
-    3.359865189e+00f,
-    1.918280602e+00f,
-    3.173538685e+00f,
-    2.024484396e+00f,
-    1.787278295e+00f,
-    1.275471306e+01f,
-    3.841599226e+00f,
-    1.421952128e+00f,
-    2.127871662e-01f,
-    1.099608803e+01f,
-    3.283478260e+00f,
-    3.653794527e+00f,
-    1.128655148e+01f,
-    4.185518265e+00f,
-    4.346862793e+00f,
-    1.646471977e+01f,
-    3.042107821e+00f,
-    1.477419090e+01f,
-    3.395739555e+00f,
-    5.690388203e+00f,
-    2.967321157e+00f,
-    5.632375717e+00f,
-    3.286668777e+00f,
-    9.028076530e-01f,
-    4.550392330e-01f,
-    4.953454494e+00f,
-    1.561817074e+01f,
-    2.433687925e+00f,
-    6.795759201e+00f,
-    9.458740234e+00f,
-    2.761473656e-01f,
-    6.413043141e-01f,
-    7.579768658e+00f,
-    1.921903038e+01f,
-    5.438689232e+00f,
-    1.037074184e+01f,
-    2.649860382e+00f,
-    1.766002774e+00f,
-    2.220807791e+00f,
-    6.884924412e+00f,
-    2.304317474e+00f,
-    1.286232114e+00f,
-    9.033083320e-01f,
-    6.388463974e+00f,
-    1.657340527e+00f,
-    1.150940537e+00f,
-    2.181734562e+00f,
-    3.808192313e-01f,
-    5.916969299e+00f,
-    6.243363857e+00f,
-    6.925063133e+00f,
-    1.230542064e+00f,
-    1.180549026e+00f,
-    4.147546291e+00f,
-    2.906676054e+00f,
-    7.488525867e+00f,
-    2.966856575e+01f,
-    1.384990978e+01f,
-    1.092392921e+01f,
-    1.628341866e+01f,
-    4.927093506e+01f,
-    6.348185062e+00f,
-    5.070517063e+00f,
-    1.922760963e+00f,
-    6.762926579e-01f,
-    4.387403011e+00f,
-    6.887959480e+00f,
-    2.426732540e+00f,
-    9.389857054e-01f,
-    3.801957607e+00f,
-    3.086717129e+00f,
-    1.884196281e+00f,
-    1.008560419e+00f,
-    2.529239416e+00f,
-    3.934056044e+00f,
-    5.682226181e+00f,
-    2.356649017e+01f,
-    5.287095547e+00f,
-    1.818570709e+01f,
-    1.732621765e+01f,
-    1.161391296e+02f,
-    5.809407425e+01f,
-    1.838848233e+00f,
-    1.137114644e+00f,
-    6.017227769e-01f,
-    4.862287998e+00f,
-    2.015383720e+00f,
-    5.877887607e-01f,
-    3.075917959e+00f,
-    2.158063889e+00f,
-    4.583020210e+00f,
-    5.125183582e+00f,
-    5.180633068e+00f,
-    1.292881775e+01f,
-    3.810714960e+00f,
-    3.590258789e+01f,
-    3.135411024e+00f,
-    1.598993587e+01f,
-    5.615249634e+00f,
-    2.081652260e+01f,
-    3.125509262e+01f,
-    3.855822682e-01f,
-    5.042684078e-01f,
-    9.967324734e-01f,
-    8.273833394e-01f,
-    1.049182534e+00f,
-    5.353223085e-01f,
-    7.297576666e-01f,
-    2.039788723e+00f,
-    1.118262768e+00f,
-    2.703797579e+00f,
-    9.518507004e+00f,
-    1.189130783e+01f,
-    3.955532455e+01f,
-    3.427840471e-01f,
-    1.932772636e+00f,
-    1.326886296e+00f,
-    3.683235645e-01f,
-    6.983383298e-01f,
-    2.999083519e+00f,
-    1.499953389e+00f,
-    1.645504355e+00f,
-    8.663704991e-01f,
-    3.127264023e+00f,
-    1.328580618e+00f,
-    9.876525998e-01f,
-    1.830069661e+00f,
-    2.447515726e+00f,
-    1.174460530e+00f,
-    2.370184660e+00f,
-    2.706582785e+00f,
-    8.024470329e+00f,
-    1.827895355e+01f,
-    1.235795403e+01f,
-    1.078195572e+00f,
-    1.667506456e+00f,
-    1.293622732e+00f,
-    2.971652746e+00f,
-    1.876423645e+01f,
-    4.131770730e-01f,
-    4.276632071e-01f,
-    7.319811821e+00f,
-    7.697317600e-01f,
-    9.364137650e+00f,
-    3.825828552e+00f,
-    7.102598190e+00f,
-    1.134739494e+01f,
-    5.369762897e+00f,
-    1.607973480e+01f,
-    1.513541985e+01f,
-    3.109262943e+00f,
-    1.469441319e+01f,
-    8.756852150e+00f,
-    9.789254189e+00f,
-    7.829672813e+00f,
-    2.200063705e+00f,
-    3.989950895e+00f,
-    4.075960159e+00f,
-    7.964930534e+00f,
-    5.218104839e+00f,
-    4.375712395e+00f,
-    1.254313660e+01f,
-    1.235564137e+01f,
-    2.890603304e+00f,
-    2.369100094e+00f,
-    5.729998946e-01f,
-    2.232551813e+00f,
-    7.099675179e+00f,
-    8.641980171e+00f,
-    1.089011002e+01f,
-    6.463559866e-01f,
-    1.000948399e-01f,
-    6.204490662e-01f,
-    1.784776688e+01f,
-    1.936985397e+01f,
-    1.165338230e+01f,
-    1.043433189e+00f,
-    2.642180920e-01f,
-    5.842370987e-01f,
-    1.089334369e+00f,
-    7.791059494e+00f,
-    1.833006263e+00f,
-    1.782739878e+00f,
-    1.453047752e+01f,
-    9.654075503e-01f,
-    8.880530596e-01f,
-    4.432474613e+00f,
-    2.547317743e+00f,
-    6.582337618e-01f,
-    7.183781862e-01f,
-    2.727063298e-01f,
-    2.089984566e-01f,
-    4.928560734e+00f,
-    1.188259482e+00f,
-    1.570063949e+00f,
-    1.236614704e+00f,
-    7.155776620e-01f,
-    4.333504677e+00f,
-    6.634785652e+00f,
-    2.427656651e+00f,
-    2.322476387e+00f,
-    1.243605018e+00f,
-    1.179957509e+00f,
-    1.245418644e+01f,
-    9.279762268e+00f,
-    6.586104870e+00f,
-    6.917350888e-01f,
-    1.880006343e-01f,
-    1.011924148e+00f,
-    5.903015614e+00f,
-    1.318344784e+01f,
-    2.377068520e+00f,
-    1.058941722e+00f,
-    1.299198270e+00f,
-    6.160284281e-01f,
-    1.308026910e-01f,
-    3.429512680e-01f,
-    4.745626748e-01f,
-    1.596555614e+01f,
-    4.637738800e+01f,
-    1.046487999e+01f,
-    1.142043591e+00f,
-    9.098772407e-01f,
-    8.375219345e+00f,
-    7.383419037e+00f,
-    5.632659793e-01f,
-    5.539072514e+00f,
-    5.114118099e+00f,
-    5.138158321e+00f,
-    4.501036167e+00f,
-    5.473043442e+00f,
-    8.691046715e+00f,
-    1.283491039e+01f,
-    8.911927223e+00f,
-    6.819793224e+00f,
-    2.228877831e+01f,
-    1.070228386e+01f,
-    9.698141098e+00f,
-    1.107660770e+01f,
-    7.205401897e+00f,
-    1.003223896e+01f,
-    4.623007298e+00f,
-    1.375355816e+01f,
-    2.256084919e+00f,
-    8.182520866e+00f,
-    6.658478737e+00f,
-    2.104137421e+01f,
-    1.400769329e+01f,
-    1.048737144e+01f,
-    7.554060364e+01f,
-    1.750279236e+01f,
-    5.851079822e-01f,
-    7.585623860e-01f,
-    1.156344175e+00f,
-    1.143466568e+01f,
-    1.740997887e+01f,
-    2.804925919e+01f,
-    2.777988434e+00f,
-    1.149193764e+00f,
-    9.333848357e-01f,
-    1.508049583e+01f,
-    1.349648666e+01f,
-    1.613550377e+01f,
-    7.310383916e-01f,
-    1.666444182e+00f,
-    1.777363420e+00f,
-    2.252337074e+01f,
-    4.144898415e+00f,
-    1.169060516e+01f,
-    7.464171410e+00f,
-    5.208156109e+00f,
-    9.782840729e+00f,
-    5.420011997e+00f,
-    1.387408924e+01f,
-    3.601739502e+01f,
-    1.321212292e+01f,
-    4.198371410e+00f,
-    1.641390800e+01f,
-    1.793458366e+01f,
-    1.419719601e+01f,
-    1.497354507e+01f,
-    8.593169212e+00f,
-    2.622937012e+01f,
-    1.290248013e+01f,
-    4.059934998e+01f,
-    1.730489731e+01f,
-    2.469509697e+01f,
-    3.129849583e-02f,
-    1.757928133e-01f,
-    1.571747363e-01f,
-    8.724276543e+00f,
-    2.504603386e+01f,
-    8.659368515e+00f,
-    3.077823222e-01f,
-    1.353374839e+00f,
-    4.988242686e-01f,
-    1.776953506e+01f,
-    7.338212490e+00f,
-    2.374173880e+00f,
-    2.026512772e-01f,
-    6.746194959e-01f,
-    3.261280060e-01f,
-    1.327439404e+01f,
-    1.079914284e+01f,
-    3.267107725e+00f,
-    2.436075926e+00f,
-    2.228987455e+00f,
-    2.345650196e+00f,
-    1.978400421e+01f,
-    2.006295919e+00f,
-    6.021574497e+00f,
-    5.541212082e+00f,
-    2.567968369e+00f,
-    3.718594551e+00f,
-    5.604401398e+01f,
-    1.566685081e+00f,
-    4.682548046e+00f,
-    2.109508514e+00f,
-    2.090803385e+00f,
-    2.754590988e+00f,
-    5.993266296e+01f,
-    8.465330601e-01f,
-    1.427917123e+00f,
-    1.919238329e+00f,
-    1.313387299e+01f,
-    3.108927965e+00f,
-    4.527739048e+00f,
-    5.690090656e+00f,
-    8.242568970e+00f,
-    2.226317406e+00f,
-    1.345053387e+01f,
-    4.350568295e+00f,
-    3.807779312e+00f,
-    6.445982456e+00f,
-    2.799190044e+00f,
-    8.503208756e-01f,
-    1.191758957e+02f,
-    2.789511919e+00f,
-    7.171780109e+00f,
-    1.242610455e+01f,
-    3.651060581e+00f,
-    3.876808167e+01f,
-    1.973886871e+01f,
-    8.086074829e+00f,
-    9.452613068e+01f,
-    1.924712563e+01f,
-    1.690744781e+01f,
-    1.055170593e+02f,
-    1.614452515e+02f,
-    1.347982502e+01f,
-    5.045265704e-02f,
-    1.088868856e+00f,
-    4.174785018e-01f,
-    4.047167778e+00f,
-    5.907618999e+00f,
-    5.544035912e+00f,
-    6.737638116e-01f,
-    1.095372796e+00f,
-    3.016336203e+00f,
-    2.569412947e+00f,
-    3.917230666e-01f,
-    3.179471970e+00f,
-    5.101798058e+00f,
-    6.015987873e+00f,
-    2.058286190e+00f,
-    1.885368156e+01f,
-    7.335011482e+00f,
-    1.418514347e+01f,
-    1.590724111e+00f,
-    2.372701168e+00f,
-    3.625618458e+00f,
-    9.474972725e+00f,
-    3.896959305e+00f,
-    3.194101810e+00f,
-    5.367362976e+00f,
-    5.561260700e+00f,
-    1.073436141e+00f,
-    1.632196045e+01f,
-    3.050774336e+00f,
-    2.973148346e+00f,
-    1.570574665e+01f,
-    2.227987862e+01f,
-    1.979187965e+01f,
-    2.420958996e+00f,
-    1.063470244e+00f,
-    1.430372953e+00f,
-    4.481025696e+00f,
-    1.004167252e+02f,
-    2.884313762e-01f,
-    5.510408282e-01f,
-    2.857490301e+00f,
-    7.611172795e-01f,
-    3.397233086e-03f,
-    6.675790995e-02f,
-    2.813294716e-02f,
-    1.034242249e+01f,
-    1.139221191e+01f,
-    3.272655725e+00f,
-    2.934284210e-01f,
-    6.517734528e-01f,
-    2.199068964e-01f,
-    4.653890610e+00f,
-    6.173036575e+00f,
-    2.877364874e+00f,
-    1.171361655e-01f,
-    1.424196064e-01f,
-    1.155111566e-01f,
-    6.304082870e+00f,
-    3.625823021e+00f,
-    1.166960835e+00f,
-    2.835413694e+00f,
-    2.233190536e+00f,
-    8.106875420e-01f,
-    2.838034821e+01f,
-    1.500468135e+00f,
-    4.850531101e+00f,
-    2.549803734e+00f,
-    8.824346066e-01f,
-    4.915520668e+00f,
-    1.594945526e+01f,
-    1.003435850e+00f,
-    1.566078305e+00f,
-    6.474818707e+00f,
-    1.092264175e+00f,
-    8.869863749e-01f,
-    3.905000687e+01f,
-    8.029996753e-01f,
-    1.262906790e+00f,
-    1.221016526e+00f,
-    1.193762970e+01f,
-    3.310169220e+00f,
-    1.290745163e+01f,
-    5.432112122e+01f,
-    1.054250717e+00f,
-    4.308384657e-01f,
-    9.137036324e+00f,
-    3.860373497e+00f,
-    6.404752731e-01f,
-    5.271224380e-01f,
-    5.746565387e-02f,
-    8.986684680e-02f,
-    4.448677540e+00f,
-    5.483841896e-01f,
-    5.198096037e-01f,
-    9.673486352e-01f,
-    3.152565658e-01f,
-    1.534596539e+01f,
-    1.221143150e+01f,
-    7.003513813e+00f,
-    1.198734403e+00f,
-    6.681146622e-01f,
-    2.081811428e+00f,
-    2.458248520e+01f,
-    1.404469967e+01f,
-    1.304506207e+01f,
-    3.990722001e-01f,
-    6.215141416e-01f,
-    1.498901248e+00f,
-    2.205293655e+01f,
-    7.341258240e+01f,
-    6.245661736e+00f,
-    1.074986339e+00f,
-    6.393203139e-01f,
-    1.438323259e+00f,
-    2.029071569e+00f,
-    1.882718325e+00f,
-    2.880457878e+00f,
-    8.623221397e+00f,
-    1.134881878e+01f,
-    2.433738136e+01f,
-    8.000697494e-01f,
-    2.291717529e+00f,
-    1.571922541e+00f,
-    4.642817974e+00f,
-    1.409552336e+00f,
-    8.675698280e+00f,
-    1.859474033e-01f,
-    9.320086241e-01f,
-    7.218631506e-01f,
-    4.443182468e+00f,
-    1.159714508e+01f,
-    4.151254654e+00f,
-    5.257308483e-01f,
-    1.351411939e+00f,
-    7.955373526e-01f,
-    8.081819534e+00f,
-    1.347638416e+01f,
-    1.927968144e+00f,
-    4.150032401e-01f,
-    1.853357196e+00f,
-    7.257382870e-01f,
-    4.974572659e+00f,
-    1.493780613e+01f,
-    1.356222749e+00f,
-    2.327661276e+00f,
-    2.307439566e+00f,
-    3.635031223e+00f,
-    1.038169575e+01f,
-    3.080630302e+00f,
-    1.009838295e+01f,
-    6.750925064e+00f,
-    1.257264256e+00f,
-    2.466275930e+00f,
-    4.830509186e+01f,
-    3.845192194e+00f,
-    5.543961525e+00f,
-    2.797036409e+00f,
-    1.123806953e+00f,
-    2.162477493e+00f,
-    1.403052673e+02f,
-    1.098898411e+00f,
-    3.428312063e+00f,
-    8.849991798e+00f,
-    1.049695015e+01f,
-    1.323776054e+01f,
-    1.373725772e+00f,
-    2.477831841e+00f,
-    1.250914192e+01f,
-    1.814898109e+01f,
-    1.643051338e+01f,
-    8.671537399e+00f,
-    3.374301910e+01f,
-    4.937750697e-01f,
-    4.137321711e-01f,
-    2.257365799e+01f,
-    1.292019606e+00f,
-    1.526044726e+00f,
-    1.360904932e+00f,
-    2.628689289e+00f,
-    1.556470108e+01f,
-    6.024533272e+00f,
-    9.701302528e+00f,
-    3.517663240e+00f,
-    3.567111588e+01f,
-    5.242509842e+00f,
-    1.193903351e+02f,
-    1.671947837e+00f,
-    9.104817390e+00f,
-    9.443556786e+00f,
-    2.330489397e+00f,
-    1.305131531e+01f,
-    3.244257927e+00f,
-    8.340500832e+00f,
-    1.201267815e+01f,
-    1.056669712e+01f,
-    2.122496223e+01f,
-    1.639539337e+01f,
-    8.532781601e+00f,
-    8.793033600e+01f,
-    3.146572590e+00f,
-    1.170337200e+01f,
-    1.451854706e+01f,
-    2.031245995e+01f,
-    1.715988398e+00f,
-    7.828685641e-01f,
-    2.344370651e+01f,
-    1.541834545e+01f,
-    5.490190506e+00f,
-    1.504789925e+01f,
-    1.030059052e+01f,
-    1.306617260e+01f,
-    9.040468216e+00f,
-    8.994946480e-01f,
-    1.170895815e+00f,
-    2.869378662e+01f,
-    2.048356438e+01f,
-    6.809471130e+01f,
-    6.727048755e-01f,
-    3.540495932e-01f,
-    6.489562035e+00f,
-    4.985702932e-01f,
-    5.718574524e+00f,
-    4.747790396e-01f,
-    1.695742226e+01f,
-    2.721799612e+00f,
-    2.170622587e+00f,
-    2.681199312e+00f,
-    6.657392979e-01f,
-    6.359398961e-01f,
-    4.458514214e+00f,
-    5.659464836e+00f,
-    7.365855694e+00f,
-    4.256665707e+00f,
-    1.393711120e-01f,
-    5.715085864e-01f,
-    6.071302891e-01f,
-    5.010836601e+00f,
-    1.073615074e+00f,
-    7.747347951e-01f,
-    7.057224512e-01f,
-    3.193190098e-01f,
-    2.353154123e-01f,
-    2.194402218e+00f,
-    3.707021475e+00f,
-    3.580366850e+00f,
-    1.108178234e+01f,
-    6.699078083e+00f,
-    1.080586243e+01f,
-    1.566325903e+00f,
-    1.521295428e+00f,
-    1.401596832e+01f,
-    1.397279978e+00f,
-    2.071503639e+00f,
-    1.106495667e+01f,
-    1.177018070e+01f,
-    6.557603836e+00f,
-    4.613632679e+00f,
-    1.535438597e-01f,
-    2.084280849e-01f,
-    5.062422180e+01f,
-    1.741781616e+01f,
-    6.090248585e+00f,
-    8.768942952e-01f,
-    5.771629810e-01f,
-    3.204246283e+00f,
-    3.593060374e-01f,
-    7.429328561e-01f,
-    1.028260350e+00f,
-    2.269834518e+01f,
-    7.752520752e+01f,
-    2.482533455e+01f,
-    6.935432911e+00f,
-    8.229045868e+00f,
-    2.620870829e+00f,
-    9.100467563e-01f,
-    6.364262700e-01f,
-    6.698362732e+01f,
-    4.217975998e+01f,
-    3.312339783e+00f,
-    3.702648163e+00f,
-    7.652680278e-01f,
-    1.835955811e+01f,
-    4.108811378e+00f,
-    3.428691030e-01f,
-    5.883555412e+00f,
-    1.276059246e+01f,
-    1.287462139e+01f,
-    8.081087112e+00f,
-    1.651213837e+01f,
-    8.636162758e+00f,
-    8.848922729e+00f,
-    2.474883461e+01f,
-    7.423593521e+00f,
-    2.244341850e+01f,
-    1.018272400e+01f,
-    1.451065731e+01f,
-    1.323683014e+02f,
-    6.740835667e+00f,
-    5.622128963e+00f,
-    1.017461586e+01f,
-    5.927836418e+00f,
-    2.548809242e+01f,
-    1.375144386e+01f,
-    1.050597572e+01f,
-    4.835488510e+01f,
-    3.659760237e+00f,
-    6.458239079e+00f,
-    2.093889809e+01f,
-    1.741361809e+01f,
-    1.722489119e+00f,
-    8.221333027e-01f,
-    1.061606765e+00f,
-    1.414169407e+01f,
-    3.646265793e+01f,
-    7.501134491e+01f,
-    1.099994659e+00f,
-    5.905224228e+01f,
-    8.381339908e-01f,
-    2.335196877e+01f,
-    3.732807541e+01f,
-    2.311315346e+01f,
-    2.481388569e+00f,
-    4.937593460e+00f,
-    1.439417839e+00f,
-    1.032207966e+00f,
-    1.675900340e+00f,
-    2.303784180e+01f,
-    5.303858948e+01f,
-    8.200026703e+01f,
-    5.822808743e+00f,
-    2.981377363e+00f,
-    6.360948563e+00f,
-    1.391559124e+00f,
-    1.006996274e+00f,
-    2.146369362e+01f,
-    6.391543198e+01f,
-    7.922569275e+01f,
-    1.820783615e+00f,
-    6.184019089e+00f,
-    3.630082846e+00f,
-    1.991370618e-01f,
-    6.157453060e+00f,
-    1.245643425e+01f,
-    7.700292587e+00f,
-    7.203661919e+00f,
-    1.508777142e+01f,
-    2.415726280e+01f,
-    6.447804928e+00f,
-    6.232623291e+01f,
-    3.367915392e+00f,
-    1.818653870e+01f,
-    1.532710838e+01f,
-    2.118038559e+01f,
-    2.438550758e+01f,
-    1.409688854e+01f,
-    5.077327347e+01f,
-    1.940570450e+01f,
-    4.490750885e+01f,
-    6.777647400e+01f,
-    2.996008873e+01f,
-    2.036547661e+01f,
-    1.064224014e+02f,
-    2.138674021e+00f,
-    1.689783669e+01f,
-    2.854478645e+01f,
-    9.875680923e+00f,
-    9.215505600e+00f,
-    9.162384987e+00f,
-    9.574949741e-01f,
-    1.240839601e+00f,
-    8.389150500e-01f,
-    8.447853088e+00f,
-    5.818017960e+01f,
-    5.744693756e+00f,
-    6.307529807e-01f,
-    3.574833155e+00f,
-    5.048006177e-01f,
-    4.643045962e-01f,
-    1.136358455e-01f,
-    2.321276665e+01f,
-    3.259465408e+01f,
-    2.846926880e+01f,
-    3.787688911e-01f,
-    1.975365520e+00f,
-    1.828536153e+00f,
-    1.510339975e-01f,
-    2.053156281e+01f,
-    6.722536087e+00f,
-    3.749530315e+00f,
-    1.124360561e+00f,
-    2.195303202e+00f,
-    1.011657715e+01f,
-    3.020484447e+00f,
-    1.838403463e+00f,
-    2.557790184e+01f,
-    6.945349693e+00f,
-    8.833657265e+00f,
-    1.333598256e+00f,
-    6.667088985e+00f,
-    1.536202431e+00f,
-    2.691084862e+00f,
-    1.340366125e+00f,
-    2.701149368e+01f,
-    2.166697979e+00f,
-    1.071468449e+01f,
-    1.740624309e+00f,
-    3.425279379e+00f,
-    1.655601859e+00f,
-    1.773155785e+01f,
-    2.153158903e+00f,
-    3.793210506e+00f,
-    4.476157665e+00f,
-    3.292120934e+00f,
-    1.856738210e+00f,
-    1.025650406e+01f,
-    4.696802139e+00f,
-    7.927405834e+00f,
-    2.429438114e+00f,
-    2.330423594e+00f,
-    1.104093933e+01f,
-    4.562544346e+00f,
-    7.272529602e+01f,
-    3.934890032e+00f,
-    6.806212902e+00f,
-    2.197694969e+01f,
-    4.295673847e+00f,
-    4.142846107e+00f,
-    9.985329437e+01f,
-    3.175113297e+01f,
-    1.929849863e+00f,
-    3.221994400e+01f,
-    3.246034241e+01f,
-    1.052363682e+01f,
-    1.244976282e+00f,
-    8.517202735e-01f,
-    7.192503214e-01f,
-    3.881726837e+01f,
-    1.675778961e+01f,
-    8.466758728e+00f,
-    3.242410719e-01f,
-    4.077848911e+00f,
-    4.820805192e-01f,
-    1.786558838e+02f,
-    2.832181168e+01f,
-    1.585521984e+01f,
-    6.109017730e-01f,
-    7.162471414e-01f,
-    4.096119106e-01f,
-    7.144007683e+00f,
-    1.250605774e+01f,
-    2.080764580e+01f,
-    1.147542119e+00f,
-    1.232502222e+00f,
-    2.703777254e-01f,
-    8.393654823e-01f,
-    5.821012259e-01f,
-    2.268649578e+00f,
-    9.642852783e+00f,
-    9.411267638e-01f,
-    5.715996623e-01f,
-    3.182158172e-01f,
-    4.859615707e+01f,
-    2.899252474e-01f,
-    1.137494683e+00f,
-    1.095666599e+01f,
-    6.846955299e+00f,
-    9.975256920e+00f,
-    9.073255539e+00f,
-    2.599174976e+00f,
-    4.578617096e+00f,
-    4.206155777e+00f,
-    2.226831198e+00f,
-    8.388534546e+00f,
-    7.818698406e+00f,
-    1.703686118e+00f,
-    1.168198943e+00f,
-    5.117615223e+00f,
-    9.675019264e+00f,
-    5.078510284e+00f,
-    3.687819004e+00f,
-    2.057233620e+01f,
-    1.056353855e+01f,
-    2.651764488e+01f,
-    1.017586040e+01f,
-    1.425589180e+01f,
-    3.454211473e+00f,
-    1.560159016e+01f,
-    1.527155495e+01f,
-    4.455062103e+01f,
-    2.223810196e+00f,
-    1.735623956e+00f,
-    1.018081093e+01f,
-    1.803008842e+01f,
-    1.270853424e+01f,
-    6.611049652e+00f,
-    1.704899597e+01f,
-    1.871764064e+00f,
-    1.438490033e+00f,
-    1.975580788e+01f,
-    1.466661334e+00f,
-    8.292705536e+00f,
-    5.604687929e-01f,
-    1.482870579e+01f,
-    1.783835220e+01f,
-    1.473911095e+01f,
-    9.303364903e-02f,
-    3.614450991e-01f,
-    6.519842148e-02f,
-    7.182207108e-01f,
-    9.889924526e-02f,
-    1.304451752e+01f,
-    1.401499557e+01f,
-    3.950289726e+00f,
-    6.322714090e-01f,
-    4.412349164e-01f,
-    9.407591224e-01f,
-    2.395673096e-01f,
-    2.001306415e-01f,
-    1.155012798e+01f,
-    1.359659481e+01f,
-    5.710723877e+00f,
-    7.889350504e-02f,
-    4.158156812e-01f,
-    1.031551287e-01f,
-    3.842710257e-01f,
-    5.222828865e+00f,
-    4.757201195e+00f,
-    1.288191986e+01f,
-    1.145998478e+00f,
-    1.834733009e+00f,
-    1.755910039e+00f,
-    2.054977655e+00f,
-    1.558038473e+00f,
-    1.564202404e+01f,
-    2.821638584e+00f,
-    2.243574142e+00f,
-    1.393368840e+00f,
-    4.007421494e+00f,
-    2.727933645e+00f,
-    1.883124113e+00f,
-    1.579046965e+00f,
-    6.615921021e+00f,
-    4.359987259e+00f,
-    1.060918236e+01f,
-    1.211953044e+00f,
-    7.607925415e+00f,
-    1.894307971e+00f,
-    8.789891243e+00f,
-    1.338118553e+00f,
-    5.469182014e+00f,
-    1.206195736e+01f,
-    3.079198837e+00f,
-    7.340298891e-01f,
-    3.110653162e+00f,
-    4.556058407e+00f,
-    8.557502747e+00f,
-    2.166447639e+00f,
-    2.557732463e-01f,
-    2.093644291e-01f,
-    4.713025093e-01f,
-    2.786227703e+00f,
-    6.384582520e-01f,
-    1.001024723e+00f,
-    2.621422410e-01f,
-    7.889022678e-02f,
-    1.726910770e-01f,
-    8.441779017e-01f,
-    9.105076790e-01f,
-    2.580515862e+00f,
-    1.802680779e+01f,
-    7.143511772e+00f,
-    1.088831902e+01f,
-    1.331745148e+00f,
-    2.081948996e+00f,
-    1.948937798e+01f,
-    4.656095505e+00f,
-    2.016164303e+00f,
-    1.075960827e+01f,
-    9.566716194e+00f,
-    8.298838615e+00f,
-    9.631423950e+00f,
-    1.931614399e+00f,
-    8.426809311e-01f,
-    2.986475220e+02f,
-    7.590827465e+00f,
-    1.270768929e+01f,
-    1.001626492e+00f,
-    6.608108282e-01f,
-    1.571935940e+01f,
-    1.584843248e-01f,
-    6.121175289e-01f,
-    1.037383080e+00f,
-    1.600832939e+01f,
-    1.820661354e+01f,
-    3.013108635e+01f,
-    3.688071012e+00f,
-    3.376139402e+00f,
-    3.288979292e+00f,
-    6.073577404e-01f,
-    3.515778303e+00f,
-    8.828288078e+00f,
-    8.959562683e+01f,
-    2.884907484e+00f,
-    2.978554249e+00f,
-    1.932783127e+00f,
-    4.509163284e+01f,
-    3.720651627e+00f,
-    7.568255663e-01f,
-    1.351233673e+01f,
-    1.683026505e+01f,
-    1.246258926e+01f,
-    5.775882006e-01f,
-    5.626480579e+00f,
-    7.106397152e-01f,
-    1.247522235e+00f,
-    8.104209900e-01f,
-    1.122067642e+01f,
-    3.668206787e+01f,
-    1.673795509e+01f,
-    1.826020598e+00f,
-    1.034618497e+00f,
-    6.852339506e-01f,
-    7.702928185e-01f,
-    3.352766037e-01f,
-    1.774722672e+01f,
-    1.148970718e+02f,
-    1.671996307e+01f,
-    4.834068418e-01f,
-    4.758110046e+00f,
-    6.045503616e-01f,
-    4.940978289e-01f,
-    1.588192654e+01f,
-    1.279891014e+01f,
-    5.623045444e+00f,
-    2.084763527e+00f,
-    1.531244159e+00f,
-    3.870201826e+00f,
-    2.231606960e+00f,
-    1.149895668e+00f,
-    2.023379517e+01f,
-    5.711701870e+00f,
-    1.157278919e+01f,
-    2.400559664e+00f,
-    5.712414742e+00f,
-    1.889439940e+00f,
-    1.618956327e+00f,
-    1.396210194e+00f,
-    2.749169731e+01f,
-    1.010438919e+01f,
-    1.105649185e+01f,
-    1.864606619e+00f,
-    8.033473015e+00f,
-    5.381292343e+00f,
-    7.053756714e+00f,
-    9.900439262e+00f,
-    2.382034063e+00f,
-    9.985680580e-01f,
-    6.351699233e-01f,
-    9.452508926e+00f,
-    6.311631680e+00f,
-    3.089251518e+00f,
-    1.543724418e+00f,
-    1.415233374e+00f,
-    1.962289065e-01f,
-    1.771537304e+00f,
-    2.562922001e+00f,
-    1.428641081e+00f,
-    7.018964887e-01f,
-    3.491812646e-01f,
-    3.286055624e-01f,
-    9.443258643e-01f,
-    3.974883080e+00f,
-    1.232440233e+00f,
-    5.261772275e-01f,
-    2.125159204e-01f,
-    3.199492216e+00f,
-    9.670607567e+00f,
-    7.658443928e+00f,
-    6.865457535e+00f,
-    1.168811893e+01f,
-    4.101753712e+00f,
-    1.200011158e+01f,
-    6.310880661e+00f,
-    1.429350567e+01f,
-    6.122467041e+00f,
-    1.548398018e+01f,
-    2.399064302e+00f,
-    9.351683259e-01f,
-    5.591027141e-01f,
-    1.157838821e+01f,
-    2.394862556e+01f,
-    1.928045154e+00f,
-    1.444663525e+00f,
-    5.544022083e+00f,
-    2.933578193e-01f,
-    2.712449074e+00f,
-    1.894686890e+01f,
-    1.901637840e+01f,
-    3.252057314e+00f,
-    2.426597595e+01f,
-    2.163766384e+00f,
-    3.427489996e+00f,
-    4.631816101e+01f,
-    4.837502480e+00f,
-    7.838038635e+01f,
-    2.699241877e+00f,
-    6.945945740e+00f,
-    7.615362644e+00f,
-    9.336808205e+00f,
-    8.383190155e+00f,
-    3.442731857e+00f,
-    3.669327021e+00f,
-    2.430444956e+00f,
-    2.158547401e+00f,
-    6.947054267e-01f,
-    8.493039608e-01f,
-    3.800910711e-01f,
-    1.784908772e+00f,
-    3.248525143e+00f,
-    4.799810350e-01f,
-    9.411154985e-01f,
-    4.805310667e-01f,
-    1.221995831e+00f,
-    1.379916096e+01f,
-    2.291016197e+01f,
-    2.131452179e+01f,
-    4.254585648e+01f,
-    1.045135021e+00f,
-    1.063571835e+01f,
-    1.391113949e+01f,
-    9.817367554e+00f,
-    3.318031311e+01f,
-    3.369391203e+00f,
-    6.535466909e-01f,
-    6.978683949e+00f,
-    1.780091405e+00f,
-    1.493230909e-01f,
-    6.293741703e+00f,
-    6.430009842e+00f,
-    9.376629829e+00f,
-    8.177736998e-01f,
-    1.271788239e+00f,
-    1.192262268e+01f,
-    5.276051998e+00f,
-    3.365147352e+00f,
-    1.240415454e+00f,
-    3.539419174e+00f,
-    4.700508595e+00f,
-    1.711414909e+01f,
-    2.017755318e+01f,
-    1.199135780e+01f,
-    8.947921753e+00f,
-    1.091178799e+01f,
-    2.060316658e+01f,
-    2.075895691e+01f,
-    1.751902580e+01f,
-    8.671751976e+00f,
-    1.188181400e+01f,
-    8.499363899e+00f,
-    8.967792511e+00f,
-    2.343871498e+01f,
-    4.311395168e+00f,
-    3.110933304e+00f,
-    3.496838093e+00f,
-    2.209111595e+01f,
-    1.321207523e+01f,
-    1.555635357e+01f,
-    1.906876206e+00f,
-    1.715489769e+01f,
-    1.620180130e+01f,
-    1.820808029e+01f,
-    5.776170254e+00f,
-    1.599305153e+01f,
-    6.250673771e+00f,
-    1.887464905e+01f,
-    2.923235321e+01f,
-    2.207130432e+01f,
-    7.519960999e-01f,
-    4.831991494e-01f,
-    1.100118399e+00f,
-    7.433285117e-01f,
-    2.177155495e+00f,
-    1.357229948e+00f,
-    2.425239563e+01f,
-    6.532896161e-01f,
-    4.087157547e-01f,
-    1.312193871e+01f,
-    1.838856697e+01f,
-    3.131063461e+01f,
-    7.749127746e-01f,
-    6.423108101e+00f,
-    2.588835716e+00f,
-    1.175048470e+00f,
-    1.548388243e+00f,
-    6.218071461e+00f,
-    7.448584080e+00f,
-    6.140469551e+00f,
-    1.449783802e+00f,
-    1.036736727e+00f,
-    2.409956694e+00f,
-    5.251719475e+00f,
-    1.762406921e+01f,
-    6.119051456e+00f,
-    1.200580955e+00f,
-    2.168332338e+00f,
-    9.678805351e+00f,
-    5.044735909e+00f,
-    1.305043411e+01f,
-    1.236438900e-01f,
-    5.359097481e+00f,
-    1.240408802e+01f,
-    7.239480972e+00f,
-    1.198896790e+01f,
-    1.381590366e+01f,
-    1.245580482e+01f,
-    3.202225494e+01f,
-    2.442126656e+01f,
-    8.225078125e+02f,
-    9.940298200e-01f,
-    1.649904847e-01f,
-    2.005493546e+01f,
-    3.952746582e+01f,
-    8.728993416e+00f,
-    2.357656250e+02f,
-    1.290547729e+00f,
-    9.882006049e-01f,
-    3.477817178e-01f,
-    5.298582554e+00f,
-    2.662750244e+00f,
-    3.228944778e+00f,
-    5.890179873e-01f,
-    2.845979691e+00f,
-    1.162280917e+00f,
-    2.703450203e+01f,
-    1.064177322e+01f,
-    9.142682076e+00f,
-    5.920451641e+00f,
-    4.196672058e+01f,
-    1.455136776e+01f,
-    1.554803252e+00f,
-    5.825279951e-01f,
-    1.609853745e+01f,
-    1.387014675e+01f,
-    3.797861338e+00f,
-    3.326980114e+00f,
-    1.224633694e+01f,
-    1.501721954e+01f,
-    1.138745785e+01f,
-    1.352686119e+01f,
-    1.644083142e+00f,
-    7.477257729e+00f,
-    4.960155487e+00f,
-    5.643927574e+00f,
-    9.189098358e+00f,
-    1.529682636e+01f,
-    1.434369946e+01f,
-    1.246330833e+01f,
-    3.412812650e-01f,
-    3.989487290e-01f,
-    4.028415680e-01f,
-    2.453766316e-01f,
-    5.017496347e-01f,
-    5.382114053e-01f,
-    2.614196241e-01f,
-    1.417172337e+01f,
-    5.964833069e+01f,
-    1.801937561e+02f,
-    4.576850235e-01f,
-    1.631398010e+01f,
-    3.240624189e+00f,
-    1.673210144e+01f,
-    1.045930862e+00f,
-    3.197783709e+00f,
-    3.691954017e-01f,
-    6.876909137e-01f,
-    3.094849825e+00f,
-    5.830907345e+00f,
-    4.855741024e+00f,
-    9.021842957e+00f,
-    5.980076313e+00f,
-    1.201407623e+01f,
-    2.256412315e+01f,
-    1.509725285e+01f,
-    7.499437332e+00f,
-    1.946769834e+00f,
-    7.293221951e-01f,
-    4.084050655e+00f,
-    6.407002926e+00f,
-    2.804526329e+00f,
-    3.586261272e+00f,
-    4.307928085e+00f,
-    1.124302387e+01f,
-    1.477611446e+01f,
-    4.058117867e+00f,
-    5.419571877e+00f,
-    2.484376431e+00f,
-    3.120666146e-01f,
-    8.951929808e-01f,
-    6.053901672e+00f,
-    2.863172293e-01f,
-    5.231866837e-01f,
-    1.243655458e-01f,
-    1.485769868e+00f,
-    1.057430506e+00f,
-    9.173272252e-01f,
-    1.755466580e+00f,
-    1.456125379e+00f,
-    7.258833051e-01f,
-    6.872699857e-01f,
-    1.729393601e+00f,
-    2.868383408e+00f,
-    2.355236769e+00f,
-    8.725811958e+00f,
-    7.186657906e+00f,
-    9.226321220e+00f,
-    1.451136303e+01f,
-    1.434414005e+01f,
-    1.036903143e+00f,
-    9.107336998e-01f,
-    1.201621652e+00f,
-    4.329682589e-01f,
-    1.124730706e+00f,
-    4.665805995e-01f,
-    3.397699356e+00f,
-    1.269621611e+00f,
-    7.284890652e+00f,
-    1.452242732e+00f,
-    7.674536228e+00f,
-    3.380106926e+00f,
-    2.009996033e+01f,
-    1.202350903e+01f,
-    4.176974297e+00f,
-    1.539457226e+01f,
-    1.658563614e-01f,
-    3.332544327e+00f,
-    2.073180389e+01f,
-    4.479912281e+00f,
-    3.453096771e+01f,
-    2.825354040e-01f,
-    8.835983276e-01f,
-    1.703149080e+00f,
-    4.598483145e-01f,
-    2.080772221e-01f,
-    6.685687900e-01f,
-    1.446850538e+00f,
-    2.646438360e+00f,
-    1.643239784e+01f,
-    6.948250771e+00f,
-    3.944798708e+00f,
-    2.753129959e+00f,
-    1.448278904e+01f,
-    1.354047656e+00f,
-    2.915905952e+00f,
-    2.582626820e+00f,
-    8.341360092e+00f,
-    4.140346944e-01f,
-    9.481189728e+00f,
-    3.502708197e+00f,
-    2.162075281e+00f,
-    3.040793180e+00f,
-    3.335157394e+00f,
-    7.365118265e-01f,
-    1.912120700e+00f,
-    4.052023888e-01f,
-    8.710517883e-01f,
-    1.859094620e+01f,
-    6.712162018e+01f,
-    3.711772156e+01f,
-    7.147253156e-01f,
-    2.833389521e+00f,
-    1.695185304e-01f,
-    5.037446022e-01f,
-    1.107191277e+01f,
-    3.963969469e+00f,
-    1.480268538e-01f,
-    4.074145794e+00f,
-    5.548873425e+00f,
-    1.278192878e+00f,
-    1.815105677e+00f,
-    2.651313543e+00f,
-    1.995882273e+00f,
-    1.007355213e+01f,
-    2.321529007e+01f,
-    1.659361267e+01f,
-    1.985062408e+01f,
-    2.177526093e+01f,
-    1.007155704e+01f,
-    3.588791847e+00f,
-    8.829338074e+00f,
-    3.257738113e+00f,
-    1.135270691e+01f,
-    2.437913418e+00f,
-    3.112589121e+00f,
-    2.155940533e+00f,
-    1.291918755e+00f,
-    1.551982760e+00f,
-    4.152821541e+00f,
-    1.295260525e+01f,
-    2.196990848e-01f,
-    5.323178768e+00f,
-    2.269046783e+00f,
-    4.849687517e-01f,
-    9.605873823e-01f,
-    2.560492516e+00f,
-    1.231476212e+01f,
-    4.706734180e+00f,
-    1.685662389e+00f,
-    1.740918922e+01f,
-    9.787396431e+00f,
-    2.602043629e+00f,
-    1.109997177e+01f,
-    1.260020542e+01f,
-    2.300759077e+00f,
-    3.165788174e+00f,
-    2.152142048e+00f,
-    1.773299456e+00f,
-    5.769755840e+00f,
-    2.330549240e+00f,
-    1.623970032e+00f,
-    1.128861904e+00f,
-    1.420311332e-01f,
-    2.812027931e-01f,
-    5.715345144e-01f,
-    6.295079589e-01f,
-    4.782347202e+00f,
-    4.389598370e-01f,
-    1.306946039e+00f,
-    2.253504753e+00f,
-    4.814379215e+00f,
-    5.192451954e+00f,
-    1.729224443e+00f,
-    7.478722334e-01f,
-    4.423888206e+00f,
-    7.362076759e+00f,
-    3.456289470e-01f,
-    4.385297298e-01f,
-    4.160713851e-01f,
-    1.146912098e+00f,
-    1.495551944e+00f,
-    4.140726089e+00f,
-    1.731405616e+00f,
-    4.913145065e+00f,
-    5.682247162e+00f,
-    1.508726001e+00f,
-    1.675946593e+00f,
-    3.198039055e+00f,
-    9.605924487e-01f,
-    5.688321114e+00f,
-    1.267707348e+01f,
-    4.725957394e+00f,
-    1.844277620e+00f,
-    3.266070843e+00f,
-    1.293750668e+01f,
-    5.427804470e+00f,
-    2.276745605e+01f,
-    9.220960736e-01f,
-    8.045867085e-01f,
-    1.558198929e+01f,
-    2.037905693e+01f,
-    4.669438839e+00f,
-    1.067606449e+00f,
-    4.831471145e-01f,
-    2.255698919e+00f,
-    1.182627869e+01f,
-    8.001762390e+00f,
-    2.140407085e+00f,
-    1.294555187e+00f,
-    1.948961020e+00f,
-    5.024323463e+00f,
-    8.403704643e+00f,
-    7.846042156e+00f,
-    2.464448661e-01f,
-    3.499541879e-01f,
-    3.811086416e-01f,
-    4.062663317e-01f,
-    8.624599457e+00f,
-    4.788949490e+00f,
-    4.978367090e-01f,
-    7.016557455e-01f,
-    7.964977026e-01f,
-    3.017429829e+00f,
-    1.419619751e+01f,
-    4.319674492e+00f,
-    1.133455753e+01f,
-    1.285267735e+01f,
-    1.482223511e+00f,
-    9.398221970e+00f,
-    1.760334969e+01f,
-    6.458168030e+00f,
-    3.133018255e+00f,
-    3.796070099e+00f,
-    2.320364237e+00f,
-    1.257347870e+01f,
-    7.465507984e+00f,
-    5.778251171e+00f,
-    8.415041924e+00f,
-    3.081404686e+01f,
-    1.054547596e+01f,
-    2.443077087e+00f,
-    1.155632615e+00f,
-    9.279040337e+00f,
-    1.249856758e+01f,
-    1.968757820e+01f,
-    5.250619650e-01f,
-    5.047957897e-01f,
-    1.282003498e+01f,
-    2.859724426e+01f,
-    7.405913353e+00f,
-    7.508015633e-01f,
-    3.382724524e-01f,
-    1.249889183e+01f,
-    6.134084225e+00f,
-    2.384634209e+01f,
-    1.706793785e+00f,
-    5.028821945e+00f,
-    2.595114470e+00f,
-    2.453555489e+01f,
-    3.027396441e+00f,
-    8.959587860e+01f,
-    3.495062590e-01f,
-    7.976210117e-02f,
-    9.141509235e-02f,
-    1.455854797e+01f,
-    1.744675636e+01f,
-    4.204291534e+01f,
-    1.450621963e+00f,
-    5.294463038e-01f,
-    3.420353830e-01f,
-    5.165303230e+00f,
-    1.259246588e+00f,
-    8.787391663e+00f,
-    3.868602991e+00f,
-    1.024396801e+01f,
-    3.153646708e+00f,
-    1.267432809e+00f,
-    1.978043795e+00f,
-    1.990531445e+00f,
-    3.137791157e-01f,
-    4.014768124e+00f,
-    1.335494518e+00f,
-    1.727813601e+00f,
-    9.268285632e-01f,
-    1.456228375e+00f,
-    7.145434856e+00f,
-    7.479074478e+00f,
-    6.868060589e+00f,
-    1.815050006e+00f,
-    1.071051240e+00f,
-    8.285031319e+00f,
-    4.985697746e+00f,
-    7.984763622e+00f,
-    6.497577429e-01f,
-    8.778850436e-01f,
-    6.133929729e+00f,
-    6.409143925e+00f,
-    6.152565479e+00f,
-    1.070763946e+00f,
-    7.993986607e-01f,
-    5.077514648e+00f,
-    1.629923439e+01f,
-    1.697945023e+01f,
-    1.236608624e+00f,
-    9.462794065e-01f,
-    1.502835274e+00f,
-    5.294886112e+00f,
-    2.062328148e+01f,
-    1.905067062e+01f,
-    4.184669554e-01f,
-    1.450716238e-02f,
-    1.516675111e-02f,
-    4.896474361e+00f,
-    3.833795166e+01f,
-    2.860996246e+01f,
-    8.118304610e-01f,
-    1.831262410e-01f,
-    2.697882950e-01f,
-    4.230408669e+00f,
-    1.330607176e+00f,
-    3.407291174e+00f,
-    1.421581805e-01f,
-    6.259115934e-01f,
-    4.850295186e-01f,
-    3.629137874e-01f,
-    7.206022143e-01f,
-    1.640953445e+01f,
-    1.997390556e+01f,
-    3.083142662e+01f,
-    8.721291423e-01f,
-    8.799965382e-01f,
-    3.481252670e+01f,
-    3.185795212e+01f,
-    1.483255005e+01f,
-    3.100768328e-01f,
-    4.454807937e-01f,
-    1.530202103e+01f,
-    1.091280079e+01f,
-    3.075239754e+01f,
-    9.450415611e+00f,
-    1.761509323e+01f,
-    4.883141518e+00f,
-    3.531677961e+00f,
-    1.145747948e+01f,
-    2.124283791e+01f,
-    1.311619282e+01f,
-    1.141411686e+01f,
-    8.194397926e+00f,
-    1.537349701e+01f,
-    8.772549629e+00f,
-    1.508652020e+01f,
-    3.427272320e+00f,
-    1.116172600e+01f,
-    5.067356110e+00f,
-    7.870933056e+00f,
-    1.222056746e+00f,
-    1.194045901e+00f,
-    1.994079781e+01f,
-    1.212291718e+01f,
-    5.770561981e+01f,
-    1.815623760e+00f,
-    3.858482599e+00f,
-    1.060918713e+01f,
-    2.052501488e+01f,
-    1.698587608e+01f,
-    5.958755112e+01f,
-    7.270664573e-01f,
-    2.391047955e+00f,
-    1.634726882e+00f,
-    4.900440979e+01f,
-    4.190816402e+00f,
-    1.217299080e+01f,
-    9.984726906e+00f,
-    9.347855568e+00f,
-    5.658007622e+00f,
-    1.238729572e+01f,
-    3.199546814e+01f,
-    9.455443382e+00f,
-    1.025389767e+01f,
-    7.228231907e+00f,
-    1.213434505e+01f,
-    2.840624094e+00f,
-    1.597206306e+01f,
-    2.772411585e+00f,
-    1.689567375e+01f,
-    2.595476151e+01f,
-    1.016536045e+01f,
-    8.979578972e+00f,
-    1.954275322e+01f,
-    9.488584518e+00f,
-    2.875382614e+01f,
-    1.690830231e+01f,
-    4.302707672e+01f,
-    1.611003494e+01f,
-    1.214941025e+02f,
-    1.442887497e+01f,
-    6.700796127e+00f,
-    8.976689339e+00f,
-    8.222385406e+00f,
-    2.177386284e+00f,
-    7.682051659e-01f,
-    6.768035293e-01f,
-    1.386458206e+01f,
-    2.100177002e+01f,
-    6.937458038e+01f,
-    5.187488198e-01f,
-    2.424895763e-01f,
-    2.318528742e-01f,
-    4.392708778e+00f,
-    5.674148178e+01f,
-    2.115175247e+01f,
-    1.758521795e+00f,
-    4.023171961e-01f,
-    5.594477654e-01f,
-    9.032694697e-01f,
-    8.167031407e-01f,
-    1.582417011e+01f,
-    1.656672478e+01f,
-    1.861003685e+01f,
-    1.340323567e+00f,
-    7.657172084e-01f,
-    1.653408432e+01f,
-    1.445561600e+01f,
-    9.435668945e+00f,
-    6.049433947e-01f,
-    1.674543142e+00f,
-    8.044317245e+00f,
-    9.515250206e+00f,
-    8.885572433e+00f,
-    2.227680385e-01f,
-    1.020235792e-01f,
-    6.134327054e-01f,
-    3.794100952e+01f,
-    2.046901131e+01f,
-    5.234455109e+01f,
-    2.171912909e+00f,
-    7.784575820e-01f,
-    2.355675220e+00f,
-    1.582277012e+01f,
-    1.382340336e+01f,
-    2.552434921e+01f,
-    1.386556268e+00f,
-    1.337519437e-01f,
-    1.304338694e+00f,
-    4.804838943e+01f,
-    2.511977196e+00f,
-    6.159588337e+00f,
-    7.150749683e+00f,
-    4.498787880e+00f,
-    7.663172722e+00f,
-    1.560557461e+01f,
-    2.630732346e+01f,
-    4.272730350e+00f,
-    7.259693146e+00f,
-    2.128652000e+01f,
-    2.260757828e+01f,
-    6.785278320e+00f,
-    1.571007919e+01f,
-    6.122226238e+00f,
-    3.255876923e+01f,
-    2.498492050e+01f,
-    1.057844830e+01f,
-    1.640025330e+01f,
-    8.496717453e+00f,
-    1.240052223e+01f,
-    1.447773838e+01f,
-    3.289599895e+00f,
-    9.221594334e-01f,
-    3.560911179e+01f,
-    6.858649254e+00f,
-    3.437279358e+02f,
-    2.593059692e+02f,
-    1.316413999e+00f,
-    9.394470602e-02f,
-    1.866457558e+01f,
-    1.061419868e+01f,
-    3.779870605e+01f,
-    2.755130920e+02f,
-    1.907684207e+00f,
-    7.539087534e-01f,
-    1.435831338e-01f,
-    1.277963221e-01f,
-    8.363448143e+00f,
-    1.430220222e+01f,
-    2.126172638e+01f,
-    9.349741340e-01f,
-    4.537297487e-01f,
-    1.328385639e+01f,
-    7.485352039e+00f,
-    4.070334435e+00f,
-    3.503527939e-01f,
-    4.122376144e-01f,
-    1.929775620e+01f,
-    3.859640360e+00f,
-    3.489850044e+00f,
-    3.840258420e-01f,
-    2.767212987e-01f,
-    7.353178412e-02f,
-    4.124358177e+00f,
-    5.086407661e-01f,
-    1.795602798e+01f,
-    1.265897369e+01f,
-    2.490770149e+01f,
-    9.778692245e+00f,
-    1.931602120e+00f,
-    1.649963737e+00f,
-    6.719591022e-01f,
-    3.713241518e-01f,
-    9.033133507e+00f,
-    1.407215834e+00f,
-    2.982182205e-01f,
-    1.380511165e+00f,
-    1.545989037e+00f,
-    3.893830490e+01f,
-    5.343183136e+01f,
-    3.660924683e+02f,
-    1.230482817e+00f,
-    1.931204319e+00f,
-    1.905471325e+00f,
-    2.598847008e+01f,
-    2.904728699e+01f,
-    9.614527130e+01f,
-    7.238905430e-01f,
-    8.567829728e-01f,
-    1.296190619e+00f,
-    7.167913055e+01f,
-    1.702445793e+01f,
-    1.160792847e+02f,
-    1.143768406e+01f,
-    4.677334309e+00f,
-    1.337869740e+01f,
-    8.591464996e+00f,
-    4.731057358e+01f,
-    3.713849545e+00f,
-    7.353621960e+00f,
-    8.673721313e+00f,
-    5.352152348e+00f,
-    3.949963093e+00f,
-    6.063415909e+01f,
-    4.147907734e+00f,
-    2.990905952e+01f,
-    2.593591309e+01f,
-    6.834584236e+00f,
-    7.430045605e+00f,
-    1.917324448e+01f,
-    1.587451839e+01f,
-    1.013571739e+01f,
-    9.190886497e+00f,
-    6.564915466e+01f,
-    1.494060612e+01f,
-    3.097699165e+01f,
-    5.933918953e+00f,
-    7.719094753e+00f,
-    2.011998367e+01f,
-    1.155219078e+01f,
-    1.321654677e+00f,
-    1.082189679e+00f,
-    8.411935568e-01f,
-    5.516953945e+00f,
-    1.782660484e+01f,
-    1.978882599e+02f,
-    5.734916925e-01f,
-    4.844427481e-02f,
-    6.524641067e-02f,
-    6.960526943e+00f,
-    1.102883530e+02f,
-    1.385977364e+01f,
-    4.196171463e-01f,
-    4.123012722e-01f,
-    2.465811819e-01f,
-    6.817857921e-02f,
-    7.821327209e+00f,
-    1.188152909e+00f,
-    2.085013580e+01f,
-    1.865784287e+00f,
-    9.685217857e+00f,
-    9.471869469e+00f,
-    1.230656719e+01f,
-    8.456215858e+00f,
-    1.602594566e+01f,
-    1.746103477e+01f,
-    5.938743591e+00f,
-    5.691281796e+00f,
-    1.500385666e+01f,
-    9.483201981e+00f,
-    5.925620079e+00f,
-    7.198392868e+00f,
-    7.389938831e+00f,
-    2.362986565e+00f,
-    1.058503532e+01f,
-    1.506245041e+01f,
-    9.837796211e+00f,
-    2.198638916e+01f,
-    3.161891222e+00f,
-    1.335181482e-02f,
-    3.322049856e+00f,
-    2.736389078e-02f,
-    1.390248299e+01f,
-    4.723687172e+00f,
-    7.540965557e+00f,
-    7.662388682e-01f,
-    3.026923656e+00f,
-    7.694888115e-01f,
-    1.029366970e+01f,
-    3.798589706e+00f,
-    3.065773487e+00f,
-    1.186847761e-01f,
-    4.754228115e+00f,
-    9.536389261e-02f,
-    1.296678734e+01f,
-    8.447194099e-01f,
-    5.995070457e+00f,
-    1.006215096e+01f,
-    1.141575813e+01f,
-    1.076765919e+01f,
-    2.014055729e+00f,
-    2.060006857e+00f,
-    1.678692055e+01f,
-    1.601270103e+01f,
-    1.883862495e+01f,
-    1.021633148e+00f,
-    4.182783663e-01f,
-    7.700296402e+00f,
-    8.254280090e+00f,
-    6.117821693e+00f,
-    1.814931035e+00f,
-    1.130253315e+00f,
-    3.517939806e+00f,
-    1.101200867e+01f,
-    5.231114864e+00f,
-    1.130083323e+00f,
-    8.889419436e-01f,
-    1.148459673e+00f,
-    3.256982803e+00f,
-    7.686277390e+00f,
-    4.555051804e+00f,
-    3.397622705e-01f,
-    2.005355805e-01f,
-    2.464774400e-01f,
-    2.069473416e-01f,
-    2.041493225e+01f,
-    1.613481879e+00f,
-    5.279685855e-01f,
-    5.502364039e-01f,
-    6.146579981e-01f,
-    7.463148236e-01f,
-    5.951690078e-01f,
-    9.539596558e+00f,
-    6.525915623e+00f,
-    7.194200993e+00f,
-    1.580246449e+00f,
-    7.198194861e-01f,
-    3.945851564e+00f,
-    1.904328346e+00f,
-    3.619677067e+00f,
-    4.660108089e-01f,
-    9.502771497e-01f,
-    1.008395958e+01f,
-    2.782135963e+00f,
-    5.477785110e+00f,
-    7.773469925e+00f,
-    7.890601635e+00f,
-    1.754579067e+00f,
-    7.424552917e+00f,
-    6.955771446e+00f,
-    7.914954662e+00f,
-    4.796402931e+00f,
-    3.918299198e+00f,
-    1.068928909e+01f,
-    5.722392082e+00f,
-    6.952446461e+00f,
-    1.526510143e+01f,
-    2.739289999e+00f,
-    2.045127869e+01f,
-    5.146550179e+00f,
-    2.322357148e-01f,
-    7.562013865e-01f,
-    3.556879163e-01f,
-    6.461617947e+00f,
-    2.271590948e+00f,
-    1.526228428e+01f,
-    9.768715501e-01f,
-    9.406408668e-01f,
-    2.032730818e+00f,
-    2.036678076e+00f,
-    1.324330688e+00f,
-    4.372481346e+00f,
-    4.590902627e-01f,
-    5.822867751e-01f,
-    4.903842807e-01f,
-    5.051382065e+00f,
-    1.285490513e+00f,
-    5.925258160e+00f,
-    3.481184483e+00f,
-    6.497803688e+00f,
-    1.156625748e+01f,
-    7.638539791e+00f,
-    1.104553890e+01f,
-    9.926870465e-01f,
-    4.050177097e+00f,
-    1.025024128e+01f,
-    8.540175438e+00f,
-    3.473466396e+00f,
-    1.563858509e+00f,
-    7.270394564e-01f,
-    7.588742733e+00f,
-    3.357716084e+00f,
-    1.956909776e+00f,
-    1.375121784e+01f,
-    2.146058273e+01f,
-    1.637833977e+01f,
-    1.282114148e+00f,
-    1.142791510e+00f,
-    9.696585655e+00f,
-    2.002496529e+01f,
-    2.903548241e+01f,
-    8.178158402e-01f,
-    8.762744069e-01f,
-    1.107538223e+01f,
-    9.268933868e+01f,
-    7.944996834e+00f,
-    1.236603975e+00f,
-    1.021142244e+00f,
-    1.384547901e+01f,
-    6.253515244e+00f,
-    1.870155716e+01f,
-    1.926800132e+00f,
-    1.742042923e+01f,
-    1.897627640e+01f,
-    2.229719162e+01f,
-    8.401234627e+00f,
-    9.266273499e+01f,
-    2.236850113e-01f,
-    1.734873503e-01f,
-    1.170316488e-01f,
-    6.987978458e+00f,
-    7.134316444e+00f,
-    2.202898979e+01f,
-    1.121797562e+00f,
-    4.273531735e-01f,
-    7.483281493e-01f,
-    1.753398627e-01f,
-    6.384275109e-02f,
-    6.851575851e+00f,
-    6.074604034e+00f,
-    8.633777618e+00f,
-    1.262894034e+00f,
-    3.413162529e-01f,
-    7.240278721e+00f,
-    3.546428919e+00f,
-    3.605442762e+00f,
-    1.475524306e-01f,
-    1.330840737e-01f,
-    7.122265339e+00f,
-    2.216029167e+00f,
-    1.488843918e+00f,
-    2.736310005e+00f,
-    1.011639714e+00f,
-    1.814863443e+00f,
-    9.462243080e+00f,
-    5.006579876e+00f,
-    4.064971924e+00f,
-    3.104149580e+00f,
-    1.444847679e+01f,
-    7.654444218e+00f,
-    2.540954590e+00f,
-    3.182960272e+00f,
-    3.000780582e+00f,
-    1.584191680e+00f,
-    1.635939598e+01f,
-    3.317733765e+00f,
-    1.431619097e-02f,
-    3.682552576e-01f,
-    1.036625952e-01f,
-    1.326266003e+01f,
-    8.841661453e+00f,
-    7.151396179e+01f,
-    4.932587743e-01f,
-    1.294520736e+00f,
-    5.505595803e-01f,
-    8.292274475e+00f,
-    4.760598183e+00f,
-    1.348841190e+01f,
-    1.920811832e-01f,
-    4.918005168e-01f,
-    1.745619327e-01f,
-    2.776023483e+01f,
-    4.011646748e+00f,
-    2.594235039e+01f,
-    1.008334923e+01f,
-    1.956742406e+00f,
-    1.398819637e+01f,
-    1.062889671e+01f,
-    1.535420036e+01f,
-    4.952800274e+00f,
-    1.690456033e+00f,
-    2.367898941e+00f,
-    2.769244909e+00f,
-    1.697410941e-01f,
-    3.033979654e+00f,
-    3.731085956e-01f,
-    1.375258565e+00f,
-    1.945540905e+00f,
-    8.196414709e-01f,
-    1.496253967e+01f,
-    1.064341259e+01f,
-    6.785607815e+00f,
-    2.415816545e+00f,
-    1.578555465e+00f,
-    6.278431416e+00f,
-    5.308393478e+00f,
-    2.441228485e+01f,
-    1.367132902e+00f,
-    6.327193975e-01f,
-    1.561010361e+01f,
-    8.791645813e+01f,
-    8.838494301e+00f,
-    1.139196396e+00f,
-    9.290926456e-01f,
-    8.462710381e+00f,
-    2.678579140e+01f,
-    1.421968555e+01f,
-    2.460226536e+00f,
-    4.686213732e-01f,
-    1.133652973e+01f,
-    9.013092995e+00f,
-    1.879434586e+01f,
-    3.275568771e+01f,
-    3.037481308e-01f,
-    8.172283880e-03f,
-    2.122832462e-02f,
-    1.674928784e+00f,
-    6.547074890e+01f,
-    5.035593510e+00f,
-    8.271545768e-01f,
-    1.780344546e-01f,
-    1.875883639e-01f,
-    2.094614655e-01f,
-    8.767071724e+00f,
-    8.576613665e-01f,
-    1.227668095e+01f,
-    3.485248387e-01f,
-    3.515665531e+00f,
-    6.110446930e+00f,
-    1.544009686e+00f,
-    2.162627697e+00f,
-    3.297262490e-01f,
-    1.492278695e+00f,
-    4.959436953e-01f,
-    1.701597095e+00f,
-    8.076116443e-01f,
-    1.657210159e+01f,
-    1.482707310e+01f,
-    2.091395187e+01f,
-    4.952754080e-01f,
-    9.244464636e-01f,
-    2.673616028e+01f,
-    1.082690048e+01f,
-    1.235250950e+01f,
-    1.825451136e+00f,
-    4.591903090e-01f,
-    4.232831192e+01f,
-    1.600120926e+01f,
-    9.637079239e+00f,
-    2.087880325e+01f,
-    2.044255257e+01f,
-    1.876459885e+01f,
-    4.948386669e+00f,
-    2.873707581e+01f,
-    1.207532310e+01f,
-    4.888266087e+00f,
-    1.343901348e+01f,
-    1.280462074e+01f,
-    1.462870312e+01f,
-    1.269298840e+01f,
-    4.932312012e+01f,
-    7.682195663e+00f,
-    2.723201561e+01f,
-    9.799540520e+00f,
-    2.932182789e+00f,
-    4.207982063e+00f,
-    1.718901396e+00f,
-    2.077108192e+01f,
-    2.124363327e+01f,
-    6.233449554e+01f,
-    1.599157333e+00f,
-    1.053919315e+00f,
-    2.469630957e+00f,
-    2.767042732e+01f,
-    1.211810303e+01f,
-    3.540604782e+01f,
-    1.067718148e+00f,
-    3.616140842e+00f,
-    1.884614825e+00f,
-    4.989250946e+01f,
-    3.598467112e+00f,
-    7.056131744e+01f,
-    1.271710873e+00f,
-    1.353218675e+00f,
-    1.524627113e+01f,
-    1.464608955e+01f,
-    1.181442833e+01f,
-    8.192222118e-01f,
-    3.176373243e+00f,
-    7.933420181e+00f,
-    4.511341572e+00f,
-    3.357303143e+00f,
-    7.891853452e-01f,
-    1.446854353e+00f,
-    1.135049057e+01f,
-    1.024196529e+01f,
-    6.759181499e+00f,
-    2.261796951e+00f,
-    8.429047465e-02f,
-    2.363989830e+00f,
-    2.711577988e+01f,
-    1.089256382e+01f,
-    5.484875870e+01f,
-    3.241095304e+00f,
-    7.150993347e-01f,
-    1.417349219e+00f,
-    1.131136990e+01f,
-    7.788847446e+00f,
-    1.319202232e+01f,
-    7.823524475e-01f,
-    4.274919033e-01f,
-    1.196078539e+00f,
-    5.966445923e+01f,
-    2.170994282e+00f,
-    1.669470596e+01f,
-    6.233019233e-01f,
-    5.663915277e-01f,
-    8.502837181e+00f,
-    3.184657812e+00f,
-    1.157505131e+01f,
-    6.499289870e-01f,
-    9.646621346e-01f,
-    2.039603043e+01f,
-    9.300604820e+00f,
-    1.700285721e+01f,
-    6.528505683e-01f,
-    5.475362539e-01f,
-    2.504300117e+01f,
-    1.232712555e+01f,
-    5.929639339e+00f,
-    5.551142693e-01f,
-    1.846366525e-01f,
-    1.512486190e-01f,
-    4.209336758e+00f,
-    1.132163644e+00f,
-    5.292897224e+00f,
-    2.447539330e+00f,
-    6.610264778e+00f,
-    6.893411160e+00f,
-    1.531363010e+00f,
-    1.267303705e+00f,
-    1.376221657e+00f,
-    7.334438562e-01f,
-    1.364662552e+01f,
-    1.666874766e+00f,
-    3.905738592e-01f,
-    1.680148005e+00f,
-    3.182491302e+00f,
-    6.517263031e+01f,
-    1.557483578e+01f,
-    1.503311768e+02f,
-    5.750195980e-01f,
-    1.835766554e+00f,
-    2.006359100e+00f,
-    3.503858566e+01f,
-    1.169114017e+01f,
-    6.744431305e+01f,
-    8.818311095e-01f,
-    8.404559493e-01f,
-    1.799241662e+00f,
-    1.461261597e+02f,
-    9.225593567e+00f,
-    1.221255875e+02f,
-    1.474312305e+00f,
-    2.210750198e+01f,
-    7.806916833e-01f,
-    4.081487656e+01f,
-    1.604333282e+00f,
-    3.690876389e+01f,
-    1.742189646e+00f,
-    7.557333708e-01f,
-    1.732103080e-01f,
-    5.025007725e+00f,
-    4.936963916e-01f,
-    1.249178982e+01f,
-    6.138772488e+00f,
-    1.001828957e+01f,
-    1.427033138e+01f,
-    1.397555947e+00f,
-    2.028360844e+00f,
-    2.257917166e+00f,
-    7.496157289e-01f,
-    2.851298451e-01f,
-    3.875689507e-01f,
-    8.054798126e+00f,
-    8.223917007e+00f,
-    4.080317020e+00f,
-    1.919374824e+00f,
-    1.845122457e+00f,
-    7.596419811e+00f,
-    4.972655296e+00f,
-    7.744565487e+00f,
-    1.098667502e+00f,
-    1.198151588e+00f,
-    3.284302473e+00f,
-    6.030663490e+00f,
-    1.063445926e+00f,
-    1.619295955e+00f,
-    8.406485319e-01f,
-    1.206392422e-01f,
-    3.800193369e-01f,
-    1.204437637e+01f,
-    8.948953629e+00f,
-    6.921921253e+00f,
-    3.639901578e-01f,
-    2.574101090e-01f,
-    1.679666138e+01f,
-    4.326370239e+00f,
-    3.295200348e+00f,
-    7.313712686e-02f,
-    1.505315155e-01f,
-    4.428304672e+00f,
-    1.853885651e+00f,
-    9.967596531e-01f,
-    5.069605708e-01f,
-    5.581387281e-01f,
-    5.916265026e-02f,
-    3.849695206e+00f,
-    2.381492108e-01f,
-    2.291317177e+01f,
-    1.603836823e+01f,
-    1.446857738e+01f,
-    2.478975296e+01f,
-    6.374672055e-01f,
-    1.215831161e+00f,
-    1.332106590e+00f,
-    5.410984755e-01f,
-    1.009084105e+00f,
-    1.738185436e-01f,
-    1.278312132e-02f,
-    3.278067112e-01f,
-    6.189592555e-02f,
-    1.764104724e+00f,
-    4.721389413e-01f,
-    1.356555462e+00f,
-    7.065628171e-01f,
-    4.145822823e-01f,
-    2.073419392e-01f,
-    2.041807890e+00f,
-    3.631348312e-01f,
-    1.764354944e+00f,
-    1.003126428e-01f,
-    4.388295710e-01f,
-    1.941717863e-01f,
-    1.961889386e+00f,
-    1.800095290e-01f,
-    7.636430860e-01f,
-    3.451141119e+00f,
-    1.391769528e+00f,
-    1.280762196e+01f,
-    1.499539185e+01f,
-    2.188774681e+01f,
-    1.834376812e+00f,
-    1.969594598e+00f,
-    3.989255190e+00f,
-    2.581323624e+00f,
-    9.276393652e-01f,
-    4.279566765e+00f,
-    7.790061831e-01f,
-    6.961692810e+00f,
-    4.816419601e+00f,
-    1.716806650e+00f,
-    7.420171261e+00f,
-    1.189809704e+01f,
-    9.238108635e+00f,
-    2.820986986e+00f,
-    4.747258127e-01f,
-    1.044977856e+01f,
-    1.287187767e+01f,
-    6.989619446e+01f,
-    7.427088022e-01f,
-    6.567299962e-01f,
-    5.039905548e+00f,
-    7.956831455e+00f,
-    3.297083616e+00f,
-    1.318063498e+00f,
-    1.332779050e+00f,
-    3.519004345e+00f,
-    3.632117748e+00f,
-    2.406187248e+01f,
-    1.784360170e+00f,
-    7.825140953e-01f,
-    1.921867967e+00f,
-    4.451910973e+00f,
-    3.434406996e+00f,
-    1.120287895e+01f,
-    2.624190748e-01f,
-    3.857711256e-01f,
-    2.916276753e-01f,
-    2.937538862e+00f,
-    5.287329197e+00f,
-    3.422567606e+00f,
-    5.295088291e-01f,
-    3.029535711e-01f,
-    4.228723049e-01f,
-    1.617393613e+00f,
-    3.817562461e-01f,
-    2.104279518e+00f,
-    1.110776514e-01f,
-    1.483059525e+00f,
-    2.659377098e+00f,
-    9.312253594e-01f,
-    8.080237508e-01f,
-    3.019034863e-01f,
-    1.129227161e+00f,
-    8.568178862e-02f,
-    1.386296451e-01f,
-    1.254237938e+01f,
-    1.399964046e+01f,
-    1.163556671e+01f,
-    1.217406511e+00f,
-    3.843165934e-01f,
-    1.115345860e+01f,
-    7.098099232e+00f,
-    6.909893036e+00f,
-    3.537318707e-01f,
-    3.440010250e-01f,
-    2.656367064e+00f,
-    1.917065024e+00f,
-    2.162339449e+00f,
-    4.587045193e+00f,
-    1.189592648e+01f,
-    2.219384670e+00f,
-    5.918066502e+00f,
-    5.337735176e+00f,
-    3.585840225e+01f,
-    1.276852608e+01f,
-    2.299985695e+01f,
-    1.258736610e+01f,
-    9.437688828e+00f,
-    3.715907335e+00f,
-    4.638652325e+00f,
-    2.204285860e+00f,
-    2.495058441e+01f,
-    4.112270355e+00f,
-    4.277144909e+00f,
-    7.888469696e-01f,
-    7.819918990e-01f,
-    9.625267029e+00f,
-    1.578932858e+01f,
-    6.363004303e+01f,
-    1.584910989e+00f,
-    2.186972618e+00f,
-    3.379463673e+00f,
-    1.536146069e+01f,
-    8.324435234e+00f,
-    4.625719833e+01f,
-    1.166570544e+00f,
-    7.738373876e-01f,
-    1.344251394e+00f,
-    1.061543179e+01f,
-    1.104088306e+00f,
-    3.668368816e+00f,
-    1.133206844e+01f,
-    2.422864437e+00f,
-    4.209066391e+01f,
-    2.423095894e+01f,
-    8.442261505e+01f,
-    3.766396046e+00f,
-    1.777777910e+00f,
-    2.673090696e+00f,
-    1.721639633e+00f,
-    5.344384313e-01f,
-    2.051986456e+00f,
-    7.295189500e-01f,
-    9.582664490e+00f,
-    3.986291647e+00f,
-    1.238304496e+00f,
-    1.805839157e+01f,
-    2.811963272e+01f,
-    1.527803802e+01f,
-    2.372232056e+01f,
-    1.679784966e+01f,
-    4.893733597e+01f,
-    1.937696266e+01f,
-    3.197339249e+01f,
-    1.814116859e+01f,
-    4.823920250e+00f,
-    1.918311501e+01f,
-    1.965015984e+01f,
-    1.810745120e+00f,
-    3.440490067e-01f,
-    5.842846036e-01f,
-    6.110372066e+00f,
-    1.347645092e+01f,
-    8.185496330e+00f,
-    6.885974407e-01f,
-    4.044266418e-02f,
-    5.616583228e-01f,
-    1.486104727e+00f,
-    8.451044083e+00f,
-    1.696221709e+00f,
-    2.456537336e-01f,
-    4.270594120e-01f,
-    3.567290008e-01f,
-    6.615357995e-01f,
-    6.903462410e-01f,
-    6.891505241e+00f,
-    1.026522541e+01f,
-    1.236196136e+01f,
-    1.235808134e+00f,
-    5.117222071e-01f,
-    1.147043800e+01f,
-    7.367928505e+00f,
-    1.612347364e+00f,
-    2.806198299e-01f,
-    6.813514233e-01f,
-    3.848737478e+00f,
-    2.821112156e+00f,
-    1.530041575e+00f,
-    6.638752460e+00f,
-    3.604780912e+00f,
-    1.191761780e+01f,
-    5.531229782e+01f,
-    4.621927643e+01f,
-    1.629131317e+00f,
-    1.344185352e+00f,
-    3.041545630e+00f,
-    3.980027676e+00f,
-    8.102118969e-01f,
-    2.401576757e+00f,
-    2.980853558e+00f,
-    8.370823860e+00f,
-    4.394354343e+00f,
-    1.656299233e+00f,
-    5.631591380e-02f,
-    3.164280176e+00f,
-    3.405212462e-01f,
-    4.846415997e+00f,
-    1.274754703e-01f,
-    1.134156227e+00f,
-    2.592195988e+00f,
-    4.528341770e+00f,
-    5.484181881e+00f,
-    1.892711639e+01f,
-    1.619110489e+01f,
-    8.949035645e+00f,
-    1.940835357e+00f,
-    1.289512753e+00f,
-    1.141516447e+00f,
-    1.809709167e+01f,
-    1.346649528e+00f,
-    4.673679352e+00f,
-    2.450225258e+01f,
-    8.859870911e+00f,
-    2.563546753e+01f,
-    1.118277931e+01f,
-    2.577190995e-01f,
-    3.562244177e-01f,
-    2.695787621e+01f,
-    1.640348244e+01f,
-    3.405456543e+01f,
-    1.847822905e+00f,
-    6.418587565e-01f,
-    4.645840228e-01f,
-    9.132950783e+00f,
-    5.071834326e-01f,
-    1.729642391e+00f,
-    8.614000082e-01f,
-    1.931094050e+00f,
-    6.967605591e+00f,
-    9.495835304e+00f,
-    1.363952518e+00f,
-    6.620980501e-01f,
-    1.129630327e+00f,
-    1.230228710e+01f,
-    4.969289005e-01f,
-    8.415208459e-01f,
-    2.707640886e+00f,
-    9.817744255e+00f,
-    1.015727901e+01f,
-    8.386995196e-01f,
-    8.000823855e-02f,
-    4.232343659e-02f,
-    9.795215726e-01f,
-    2.003712273e+01f,
-    1.720937729e+01f,
-    7.124601007e-01f,
-    8.656464815e-01f,
-    5.815598965e-01f,
-    1.641940594e+00f,
-    9.493806213e-02f,
-    2.895062864e-01f,
-    5.242970586e-01f,
-    1.779366302e+01f,
-    7.262100697e+00f,
-    8.455450058e+00f,
-    4.162085533e+00f,
-    3.072471142e+00f,
-    4.369322777e+00f,
-    5.060843658e+01f,
-    6.837771416e+00f,
-    9.147930908e+01f,
-    1.720235062e+01f,
-    2.876491308e+00f,
-    5.499129772e+00f,
-    6.218771458e+00f,
-    1.977115750e+00f,
-    1.055493355e+01f,
-    4.366771221e+00f,
-    6.299602509e+00f,
-    7.942326546e+00f,
-    1.018055344e+01f,
-    1.143448257e+01f,
-    1.354460716e+01f,
-    2.208818245e+01f,
-    1.425163078e+01f,
-    5.727607727e+01f,
-    4.047197819e+00f,
-    2.162936974e+01f,
-    2.128775787e+01f,
-    1.598364353e+01f,
-    1.665630221e+00f,
-    6.075822115e-01f,
-    1.986781001e+00f,
-    2.485908890e+01f,
-    8.489066362e-01f,
-    7.504235744e+00f,
-    2.556544685e+01f,
-    2.204016304e+01f,
-    1.180279160e+01f,
-    1.950846672e+01f,
-    1.703923792e-01f,
-    3.559820056e-01f,
-    5.720241165e+01f,
-    4.520851517e+01f,
-    8.380526733e+01f,
-    6.768106222e-01f,
-    2.367980778e-01f,
-    7.865137458e-01f,
-    6.960518360e+00f,
-    2.499448061e-01f,
-    1.091445327e+00f,
-    1.059097052e+00f,
-    1.781720543e+01f,
-    9.583432198e+00f,
-    2.321350288e+01f,
-    1.062092423e+00f,
-    1.635205626e+00f,
-    3.106366634e+00f,
-    9.363353729e+01f,
-    1.094652748e+01f,
-    3.930757446e+02f,
-    3.655792999e+01f,
-    7.649708271e+00f,
-    1.037567139e+02f,
-    4.164839554e+01f,
-    6.201029301e+00f,
-    6.035055542e+02f,
-    3.592822266e+01f,
-    1.477129269e+01f,
-    2.175132599e+02f,
-    8.440570235e-01f,
-    2.169217467e-01f,
-    2.368450016e-01f,
-    2.431558075e+02f,
-    3.830011749e+01f,
-    7.760139648e+03f,
-    2.123999119e+00f,
-    3.005393744e+00f,
-    4.846771240e+00f,
-    1.603847623e+00f,
-    7.762727737e+00f,
-    5.470105648e+00f,
-    5.475134850e+00f,
-    2.833039045e+00f,
-    3.272749424e+00f,
-    5.317042828e+00f,
-    9.522498250e-01f,
-    2.332739830e+00f,
-    1.508772135e+00f,
-    3.773851991e-01f,
-    4.608227015e-01f,
-    7.802348733e-01f,
-    3.317665160e-01f,
-    2.650512934e+00f,
-    9.583381414e-01f,
-    1.082956672e+00f,
-    5.957852602e-01f,
-    4.948186874e-01f,
-    3.255874515e-01f,
-    2.023372650e+00f,
-    2.494704723e+00f,
-    3.619524002e+00f,
-    1.163319778e+01f,
-    1.236440468e+01f,
-    1.428934574e+01f,
-    1.126369476e+00f,
-    7.591391802e-01f,
-    1.775464892e+00f,
-    7.651665211e+00f,
-    4.103225768e-01f,
-    1.504396915e+00f,
-    7.380509853e+00f,
-    8.370855331e+00f,
-    1.903169441e+01f,
-    9.969672203e+00f,
-    1.401837021e-01f,
-    1.995533854e-01f,
-    1.954141045e+01f,
-    1.791936874e+01f,
-    1.017581253e+02f,
-    7.756275535e-01f,
-    4.617487192e-01f,
-    5.852146745e-01f,
-    3.159597397e+00f,
-    1.141724661e-01f,
-    1.083698198e-01f,
-    9.091306329e-01f,
-    1.063052654e+01f,
-    1.613449287e+01f,
-    1.093623447e+01f,
-    2.686183929e+00f,
-    7.472903728e-01f,
-    8.050392866e-01f,
-    4.449443436e+01f,
-    3.777373123e+01f,
-    1.664792358e+03f,
-    4.981216908e+00f,
-    2.671426010e+01f,
-    2.785512733e+01f,
-    1.024102020e+01f,
-    9.123223424e-01f,
-    3.083194017e+00f,
-    8.887831688e+00f,
-    1.433440018e+01f,
-    7.293814850e+01f,
-    9.889900088e-01f,
-    6.861780584e-02f,
-    2.032546699e-01f,
-    1.750049782e+01f,
-    4.070403290e+01f,
-    1.387039795e+02f,
-    6.265950948e-02f,
-    4.466925621e+00f,
-    1.625975013e+00f,
-    2.560098839e+01f,
-    3.019519567e+00f,
-    2.991248965e-01f,
-    7.911601663e-01f,
-    6.744098663e-01f,
-    1.432608068e-01f,
-    1.091025546e-01f,
-    6.465404510e+01f,
-    7.604237366e+01f,
-    5.961796188e+01f,
-    1.849279165e+00f,
-    5.232626915e+00f,
-    1.569895506e+00f,
-    7.941572070e-01f,
-    1.056131005e+00f,
-    9.965742826e-01f,
-    2.099008636e+02f,
-    1.293975983e+02f,
-    1.427617035e+02f,
-    7.815270901e+00f,
-    1.337401199e+01f,
-    7.561979771e+00f,
-    2.323549837e-01f,
-    1.587699771e+00f,
-    5.592299104e-01f,
-    5.006577682e+01f,
-    5.986548615e+01f,
-    9.513871765e+01f,
-    1.494483829e+00f,
-    8.852558136e+00f,
-    4.503545761e+00f,
-    3.029051423e-01f,
-    2.811744928e+00f,
-    1.619725418e+01f,
-    4.092301369e+00f,
-    9.924874306e+00f,
-    1.302125072e+01f,
-    1.562292290e+01f,
-    2.029313660e+01f,
-    1.546174622e+01f,
-    2.300551796e+01f,
-    7.440064907e+00f,
-    1.536159611e+01f,
-    1.183722401e+01f,
-    1.387679195e+01f,
-    2.281960869e+01f,
-    2.757129860e+01f,
-    1.128466034e+01f,
-    8.414972305e+00f,
-    2.647335625e+01f,
-    4.083010674e+00f,
-    8.817448616e+00f,
-    1.312915421e+01f,
-    5.703474426e+01f,
-    1.590374851e+01f,
-    1.958047867e+01f,
-    4.410830975e+00f,
-    3.906283951e+01f,
-    5.366413498e+01f,
-    6.032690430e+01f,
-    7.427327156e+00f,
-    3.725799179e+01f,
-    1.374027824e+01f,
-    4.085982800e+00f,
-    2.111093283e+00f,
-    2.755035639e+00f,
-    4.656673050e+01f,
-    6.253270721e+01f,
-    1.672889252e+02f,
-    1.671574211e+01f,
-    5.853179169e+01f,
-    8.282546997e+01f,
-    1.502069235e+00f,
-    2.001930952e+00f,
-    1.612586141e+00f,
-    3.815540314e+01f,
-    2.998186874e+01f,
-    1.159160538e+02f,
-    6.466617107e+00f,
-    1.792244911e+01f,
-    1.791130447e+01f,
-    2.166616678e+00f,
-    1.106412888e+01f,
-    5.284413815e+00f,
-    5.272767544e+00f,
-    1.256026554e+01f,
-    1.488915062e+01f,
-    7.833184719e+00f,
-    1.214779091e+01f,
-    1.102260685e+01f,
-    2.662977982e+01f,
-    5.169383049e+00f,
-    4.912059784e+00f,
-    6.660250187e+00f,
-    7.697139263e+00f,
-    1.300602245e+01f,
-    1.166363049e+01f,
-    2.578115463e+00f,
-    1.079332352e+01f,
-    1.052105331e+01f,
-    1.494783878e+01f,
-    2.356795120e+01f,
-    2.568697548e+01f,
-    1.658908081e+01f,
-    6.299990082e+01f,
-    8.442446899e+01f,
-    4.602043629e+00f,
-    1.202463055e+01f,
-    1.508160019e+01f,
-    1.069624043e+01f,
-    1.942904592e+00f,
-    1.224299431e+00f,
-    9.445283413e-01f,
-    3.112336159e+01f,
-    2.529909134e+01f,
-    9.373595238e+00f,
-    9.421440363e-01f,
-    2.448046684e+01f,
-    6.741111875e-01f,
-    3.208613586e+01f,
-    2.812810707e+01f,
-    5.945721817e+01f,
-    8.678609133e-01f,
-    2.207645655e+00f,
-    5.823640823e-01f,
-    1.622092056e+01f,
-    1.220266247e+01f,
-    1.684494591e+01f,
-    1.659352064e+00f,
-    7.642946839e-01f,
-    2.713183641e+00f,
-    3.433351898e+01f,
-    2.662241554e+01f,
-    1.578730011e+01f,
-    1.162679291e+01f,
-    1.510920143e+01f,
-    1.932681084e+01f,
-    9.827629089e+00f,
-    2.096405792e+01f,
-    1.958039474e+01f,
-    1.441747189e+01f,
-    3.438826752e+01f,
-    6.625124359e+01f,
-    7.808721662e-01f,
-    5.278661251e-01f,
-    2.526403964e-01f,
-    8.224481964e+01f,
-    1.034813538e+02f,
-    3.461076355e+02f,
-    4.401965439e-01f,
-    2.338655090e+01f,
-    3.282607269e+01f,
-    1.961405373e+01f,
-    1.234026551e+00f,
-    4.852330208e+00f,
-    1.582812548e+00f,
-    1.096172810e+00f,
-    9.737208486e-01f,
-    9.665565491e-01f,
-    4.267547607e+01f,
-    3.802326965e+01f,
-    3.310386276e+01f,
-    4.844550133e+00f,
-    3.295315742e+00f,
-    7.438617706e+00f,
-    8.869000077e-01f,
-    2.874690294e+00f,
-    8.074140549e-01f,
-    2.378631783e+01f,
-    6.684262848e+01f,
-    5.258041382e+01f,
-    1.171408534e+00f,
-    2.822522879e+00f,
-    2.827341080e+00f,
-    6.641800404e-01f,
-    1.354380646e+02f,
-    5.766044855e-01f,
-    6.031643295e+01f,
-    1.394980788e+00f,
-    1.214641109e-01f,
-    1.105586529e+00f,
-    4.531469643e-01f,
-    3.356110156e-01f,
-    2.671218157e+00f,
-    3.225323868e+01f,
-    2.921273112e-01f,
-    5.191093063e+01f,
-    5.926273346e+00f,
-    3.293313742e+00f,
-    2.946973228e+01f,
-    5.841315389e-01f,
-    4.777789712e-01f,
-    1.412714005e+00f,
-    1.004154739e+02f,
-    3.639044166e-01f,
-    1.716457825e+02f,
-    1.874300838e+00f,
-    4.807198942e-01f,
-    4.168440819e+00f,
-    1.033885956e+00f,
-    1.361563396e+01f,
-    4.013702393e+00f,
-    7.304131508e+00f,
-    1.044492626e+01f,
-    8.728368759e+00f,
-    9.940665245e+00f,
-    1.720181847e+01f,
-    1.134570217e+01f,
-    8.826697350e+00f,
-    1.457659435e+01f,
-    7.574856281e+00f,
-    5.940351009e+00f,
-    9.358619690e+00f,
-    1.590979004e+01f,
-    1.038668251e+01f,
-    2.109314346e+01f,
-    1.334588051e+01f,
-    2.116357613e+01f,
-    2.084640694e+01f,
-    3.018475342e+01f,
-    2.411912537e+01f,
-    4.068895721e+01f,
-    3.207354736e+01f,
-    8.596931458e+01f,
-    7.031244755e+00f,
-    4.213628769e+01f,
-    7.395684719e+00f,
-    1.794690704e+01f,
-    1.586843300e+01f,
-    3.649418116e+00f,
-    9.336657524e-01f,
-    3.533638763e+01f,
-    1.494261456e+01f,
-    1.592789001e+02f,
-    2.725055122e+01f,
-    7.966482162e+00f,
-    1.487752247e+01f,
-    4.190916061e+01f,
-    1.344665766e+00f,
-    2.409890938e+01f,
-    4.957220078e+01f,
-    1.411949253e+01f,
-    2.622478943e+02f,
-    2.426338043e+02f,
-    8.400513530e-01f,
-    3.461169600e-01f,
-    5.398517456e+02f,
-    2.292220592e+00f,
-    5.749427490e+02f,
-    1.478555603e+02f,
-    2.428589249e+01f,
-    2.078743553e+01f,
-    3.944155502e+01f,
-    3.453029096e-01f,
-    6.824427605e+00f,
-    2.537519336e-01f,
-    2.078939229e-01f,
-    7.460018992e-01f,
-    2.737300992e-01f,
-    3.653796005e+01f,
-    2.562948418e+01f,
-    3.579926300e+01f,
-    6.701947451e-01f,
-    3.775824547e+00f,
-    3.024929285e+00f,
-    1.364557445e-01f,
-    5.150026679e-01f,
-    1.076784581e-01f,
-    2.254391479e+01f,
-    2.524553108e+01f,
-    2.172827148e+02f,
-    3.548870683e-01f,
-    4.486814022e+00f,
-    1.431808352e+00f,
-    3.012136519e-01f,
-    1.905616403e+00f,
-    1.279358268e-01f,
-    4.597239792e-01f,
-    2.562644720e+00f,
-    5.323366821e-02f,
-    2.374888510e-01f,
-    1.282078075e+01f,
-    5.833572388e+00f,
-    1.532682037e+01f,
-    6.946156979e+00f,
-    1.329062879e-01f,
-    7.324935198e-01f,
-    6.574481010e+00f,
-    2.146616697e+00f,
-    6.806602955e+00f,
-    2.151532650e+00f,
-    1.205997467e+00f,
-    5.553354025e-01f,
-    2.646405458e+00f,
-    7.250037044e-02f,
-    2.644488811e-01f,
-    4.836606503e+00f,
-    3.289423883e-01f,
-    2.250021935e+00f,
-    1.322626591e+00f,
-    2.087999878e+02f,
-    5.391383743e+01f,
-    3.940581970e+02f,
-    1.116688728e+00f,
-    1.013028145e+01f,
-    1.073917484e+01f,
-    2.008605957e+00f,
-    2.413919449e+00f,
-    2.016746044e+00f,
-    6.051174927e+01f,
-    4.479948807e+01f,
-    4.716744995e+02f,
-    1.031682682e+01f,
-    4.807724380e+01f,
-    3.170427132e+01f,
-    3.420903683e-01f,
-    9.915027618e-01f,
-    8.185244203e-01f,
-    9.942526245e+01f,
-    2.502933311e+01f,
-    9.461785278e+02f,
-    1.654980779e+00f,
-    2.437188339e+01f,
-    2.084430504e+01f,
-    9.552282691e-01f,
-    2.355306149e+00f,
-    1.644839478e+01f,
-    6.939028740e+00f,
-    5.226536751e+00f,
-    1.477067661e+01f,
-    9.237091064e+00f,
-    7.523111820e+00f,
-    7.354366302e+00f,
-    3.732624054e+01f,
-    4.036836624e+00f,
-    2.911507845e+00f,
-    5.032135487e+00f,
-    3.564944267e+00f,
-    1.796409416e+01f,
-    9.800244331e+00f,
-    1.721441031e+00f,
-    1.085795212e+01f,
-    7.581881523e+00f,
-    3.021003914e+01f,
-    2.108572197e+01f,
-    4.477816391e+01f,
-    1.309094334e+01f,
-    2.239534378e+01f,
-    8.766227722e+01f,
-    2.047112942e+00f,
-    1.614215660e+01f,
-    1.516054153e+01f,
-    2.376888084e+01f,
-    1.592943072e+00f,
-    5.073596239e-01f,
-    4.785428047e-01f,
-    2.585772705e+01f,
-    3.379684448e+01f,
-    1.833838463e+01f,
-    2.439235598e-01f,
-    2.249454498e+00f,
-    4.568842053e-01f,
-    8.228526306e+01f,
-    5.808701324e+01f,
-    6.113370514e+01f,
-    3.908566236e-01f,
-    5.466573238e-01f,
-    4.442665577e-01f,
-    7.510846138e+00f,
-    1.513756371e+01f,
-    1.902771950e+01f,
-    1.500447154e+00f,
-    1.340293527e+00f,
-    9.574803114e-01f,
-    2.975695419e+01f,
-    9.928394318e+01f,
-    2.966988220e+02f,
-    1.219758987e+01f,
-    1.090425110e+01f,
-    1.236731434e+01f,
-    1.885803413e+01f,
-    1.912896347e+01f,
-    2.219236183e+01f,
-    6.736247540e+00f,
-    5.099094391e+01f,
-    1.145348969e+02f,
-    3.457344770e-01f,
-    9.854431748e-01f,
-    3.273158371e-01f,
-    6.260478973e+01f,
-    1.524896545e+02f,
-    2.332237396e+02f,
-    8.697083592e-01f,
-    1.483206558e+01f,
-    3.308831692e+00f,
-    9.744479656e-01f,
-    4.845729828e+01f,
-    1.405466843e+01f,
-    1.186382294e+00f,
-    2.590498209e+00f,
-    3.186008453e+00f,
-    6.527984887e-02f,
-    1.669813728e+01f,
-    1.951270103e-01f,
-    1.140188885e+01f,
-    5.615288544e+01f,
-    1.287213922e+00f,
-    7.746139169e-01f,
-    2.574857950e+00f,
-    8.509416580e+00f,
-    2.945015907e+00f,
-    3.235116577e+01f,
-    1.067317867e+01f,
-    1.471623421e+01f,
-    8.562236786e+00f,
-    7.214867592e+00f,
-    8.875684738e+00f,
-    5.943857193e+00f,
-    1.149045753e+01f,
-    6.035599709e+00f,
-    3.734593630e+00f,
-    8.784553528e+00f,
-    2.508996487e+00f,
-    1.634287071e+01f,
-    1.755216599e+01f,
-    2.376725960e+01f,
-    4.111419201e+00f,
-    5.663138866e+00f,
-    1.188705254e+01f,
-    8.392372131e+01f,
-    2.698772240e+01f,
-    6.731608582e+01f,
-    1.830727696e+00f,
-    8.008545685e+01f,
-    5.166946888e+00f,
-    7.894592762e+00f,
-    1.954241872e+00f,
-    3.599168539e+00f,
-    7.319318771e+00f,
-    3.130968213e-01f,
-    1.883326054e+00f,
-    5.986672640e-01f,
-    2.562549400e+01f,
-    2.295197725e+00f,
-    6.790525913e+00f,
-    2.069550753e+00f,
-    2.193354368e+00f,
-    3.085010529e+00f,
-    3.555461019e-02f,
-    7.432200432e+00f,
-    1.056312695e-01f,
-    2.353044128e+01f,
-    3.718736410e+00f,
-    7.645853519e+00f,
-    6.978836656e-01f,
-    1.672702789e+01f,
-    5.583144665e+00f,
-    5.198478222e+00f,
-    1.932134628e+01f,
-    2.065013504e+01f,
-    2.427654266e+01f,
-    9.745176435e-01f,
-    6.133097410e-01f,
-    8.956256509e-01f,
-    3.154381752e+01f,
-    1.090738773e+00f,
-    2.885009527e+00f,
-    1.771258545e+01f,
-    1.191138554e+01f,
-    2.053120613e+01f,
-    1.485431767e+01f,
-    1.275442541e-01f,
-    7.885643840e-01f,
-    1.459191513e+01f,
-    1.161170864e+01f,
-    3.956247330e+01f,
-    1.489765167e+00f,
-    2.576150000e-01f,
-    5.071269870e-01f,
-    7.639483452e+00f,
-    4.731006324e-01f,
-    1.798880577e+00f,
-    9.396746755e-01f,
-    1.388670921e+00f,
-    1.470698166e+01f,
-    1.111255264e+01f,
-    1.532109737e+00f,
-    4.874911606e-01f,
-    1.840990305e+00f,
-    1.256808376e+01f,
-    3.900585473e-01f,
-    3.839157820e-01f,
-    1.758175731e+00f,
-    9.386988640e+00f,
-    9.591478348e+00f,
-    7.107978463e-01f,
-    1.184545532e-01f,
-    3.253536299e-02f,
-    3.497219384e-01f,
-    1.128422451e+01f,
-    4.982800961e+00f,
-    9.596479535e-01f,
-    8.182607293e-01f,
-    3.862233460e-01f,
-    2.188076526e-01f,
-    9.548076242e-02f,
-    7.085494697e-02f,
-    1.024202779e-01f,
-    1.524716568e+01f,
-    5.760102749e+00f,
-    1.352689075e+01f,
-    2.336196750e-01f,
-    2.319208860e+00f,
-    2.969141006e-01f,
-    5.431239009e-01f,
-    5.226649642e-01f,
-    6.734091640e-01f,
-    6.445869446e+00f,
-    3.778453112e+00f,
-    1.994802666e+01f,
-    3.638836145e-01f,
-    1.074303508e+00f,
-    1.103160620e+00f,
-    2.982437015e-01f,
-    6.611459255e-01f,
-    2.653537393e-01f,
-    2.217739296e+01f,
-    7.582522869e+00f,
-    5.635723495e+01f,
-    4.169434905e-01f,
-    1.551940322e+00f,
-    4.804102778e-01f,
-    1.911602736e+00f,
-    5.112088203e+00f,
-    8.244770050e+00f,
-    4.857842922e+00f,
-    1.490193558e+01f,
-    4.497882843e+00f,
-    3.677580357e+00f,
-    6.017054558e+00f,
-    4.222703934e+00f,
-    5.544179440e+00f,
-    2.455725908e+00f,
-    2.302797318e+00f,
-    4.022562504e+00f,
-    4.354630470e+00f,
-    5.241479397e+00f,
-    5.553649902e+00f,
-    1.149470139e+01f,
-    1.298291683e+01f,
-    1.009766769e+01f,
-    5.371497154e+00f,
-    1.645650148e+00f,
-    8.635046959e+00f,
-    1.571819019e+01f,
-    1.615416908e+01f,
-    2.321923256e+01f,
-    1.683656693e+00f,
-    8.397497177e+00f,
-    5.425516605e+00f,
-    1.361330700e+01f,
-    2.212818861e+00f,
-    1.903830528e+00f,
-    1.039628744e+00f,
-    1.074495077e+00f,
-    1.420392632e+00f,
-    1.456813931e+00f,
-    3.041601181e+00f,
-    4.057948589e+00f,
-    5.560667038e+00f,
-    6.419639587e+00f,
-    1.779897809e+00f,
-    1.920294046e+00f,
-    1.684169620e-01f,
-    7.904845476e-01f,
-    4.623275697e-01f,
-    1.423439026e+01f,
-    4.360183239e+00f,
-    2.010669518e+01f,
-    5.978444099e+00f,
-    3.415815592e+00f,
-    2.684129000e+00f,
-    3.788017631e-01f,
-    7.024621010e+00f,
-    1.543127537e+00f,
-    2.241118431e+00f,
-    1.360456848e+01f,
-    8.075013161e+00f,
-    7.889256954e+00f,
-    7.484698772e+00f,
-    2.387956381e+00f,
-    9.696079254e+00f,
-    7.830885887e+00f,
-    2.258348227e+00f,
-    2.861832857e+00f,
-    4.400981426e+00f,
-    1.830871105e+00f,
-    3.676245689e+00f,
-    1.697915792e+00f,
-    2.251835346e+00f,
-    2.968128920e+00f,
-    1.120527840e+01f,
-    9.046104431e+00f,
-    7.632678032e+00f,
-    3.230753183e+00f,
-    1.850542784e+00f,
-    6.430590153e+00f,
-    1.489552259e+00f,
-    1.950113297e+01f,
-    3.284512711e+01f,
-    1.920742607e+01f,
-    1.509334207e+00f,
-    1.557411194e+00f,
-    2.373856544e+00f,
-    2.241121864e+01f,
-    2.596645117e+00f,
-    1.197319412e+01f,
-    2.047306633e+01f,
-    1.650037575e+01f,
-    2.574311066e+01f,
-    2.154735184e+01f,
-    4.913716018e-01f,
-    9.933133721e-01f,
-    1.880123901e+01f,
-    2.367559242e+01f,
-    2.883655357e+01f,
-    1.834373951e+00f,
-    5.758080482e-01f,
-    1.261505604e+00f,
-    1.767715645e+01f,
-    1.156894207e+00f,
-    5.875927448e+00f,
-    1.571805358e+00f,
-    2.343963242e+01f,
-    7.878571033e+00f,
-    7.977087402e+01f,
-    2.388557434e+00f,
-    1.177935791e+01f,
-    3.866218567e+00f,
-    3.075848961e+01f,
-    1.676818466e+01f,
-    7.639337921e+01f,
-    1.697484398e+01f,
-    2.917981386e+00f,
-    3.043757248e+01f,
-    2.448288345e+01f,
-    2.359084368e+00f,
-    2.954975700e+01f,
-    1.027095413e+01f,
-    5.491907597e+00f,
-    1.745123291e+02f,
-    1.277920723e+00f,
-    3.457835317e-01f,
-    3.355962932e-01f,
-    8.980974579e+01f,
-    9.517415619e+01f,
-    1.153206421e+03f,
-    4.439814568e+00f,
-    1.969333839e+01f,
-    2.381034088e+01f,
-    3.192962837e+01f,
-    3.417811915e-02f,
-    6.089019775e-01f,
-    4.269104078e-02f,
-    8.573933691e-02f,
-    3.877210021e-01f,
-    3.453180492e-01f,
-    1.784704781e+01f,
-    9.173862457e+00f,
-    1.878190231e+01f,
-    1.403637379e-01f,
-    6.322795153e-01f,
-    2.931290567e-01f,
-    6.157017872e-02f,
-    1.089617908e-01f,
-    1.190633401e-01f,
-    1.924729538e+01f,
-    1.809888649e+01f,
-    5.686605072e+01f,
-    5.126756802e-02f,
-    3.956604004e-01f,
-    3.124166280e-02f,
-    6.664367914e-01f,
-    4.517443180e+00f,
-    6.921860576e-01f,
-    5.860677361e-01f,
-    4.893188953e+00f,
-    1.151439071e+00f,
-    2.562821150e+00f,
-    9.832925797e+00f,
-    3.479474783e+00f,
-    8.836319923e+00f,
-    7.374977112e+00f,
-    6.757658720e-01f,
-    1.768417597e+00f,
-    4.313453674e+00f,
-    6.707769871e+00f,
-    1.653545189e+01f,
-    5.562802315e+00f,
-    3.223041296e+00f,
-    6.729018688e+00f,
-    2.719099522e+00f,
-    4.442416131e-01f,
-    2.827936172e+00f,
-    1.472606850e+01f,
-    2.283295870e+00f,
-    1.602205276e+01f,
-    1.348747373e+00f,
-    3.752421188e+01f,
-    2.084001732e+01f,
-    4.852565765e+01f,
-    1.889569402e+00f,
-    1.182643318e+01f,
-    8.055694580e+00f,
-    2.571576834e-01f,
-    1.285495162e+00f,
-    8.998354673e-01f,
-    2.818708420e+01f,
-    1.506992245e+01f,
-    6.046297836e+01f,
-    7.996350288e+00f,
-    1.288430595e+01f,
-    5.428588867e+00f,
-    7.804176956e-02f,
-    4.406862259e-01f,
-    1.037362441e-01f,
-    4.195663834e+01f,
-    1.514998722e+01f,
-    2.807155762e+02f,
-    1.890034676e+00f,
-    2.644021416e+01f,
-    2.179535675e+01f,
-    8.943030834e-01f,
-    1.032763720e+00f,
-    6.735628128e+00f,
-    1.973593712e+00f,
-    8.785606384e+00f,
-    3.049510193e+01f,
-    1.656114578e+01f,
-    1.471318364e+00f,
-    2.755630732e+00f,
-    4.450107574e+00f,
-    9.300583005e-01f,
-    2.778922081e+00f,
-    9.846704006e-01f,
-    6.443089247e-01f,
-    4.564186931e-01f,
-    8.756501675e-01f,
-    3.028211892e-01f,
-    2.510668516e+00f,
-    4.547964931e-01f,
-    1.097642422e+00f,
-    8.610904217e-01f,
-    2.958811820e-01f,
-    1.915953904e-01f,
-    1.267625332e+00f,
-    3.844358623e-01f,
-    1.765669823e+00f,
-    1.537681007e+01f,
-    1.751298332e+01f,
-    1.509468365e+01f,
-    1.832751751e+00f,
-    9.232614636e-01f,
-    8.181439042e-01f,
-    1.859351730e+01f,
-    2.154370993e-01f,
-    4.446341038e+00f,
-    3.786241150e+01f,
-    2.384260178e+01f,
-    1.569416142e+01f,
-    1.709827042e+01f,
-    2.105249017e-01f,
-    2.010363340e-01f,
-    7.002062225e+01f,
-    5.412445068e+01f,
-    1.786660156e+02f,
-    1.294734597e+00f,
-    8.728876710e-01f,
-    6.330321431e-01f,
-    7.307193756e+00f,
-    6.796558201e-02f,
-    1.614532918e-01f,
-    7.857775092e-01f,
-    6.151101589e+00f,
-    1.806128883e+01f,
-    2.031792831e+01f,
-    3.443907499e+00f,
-    4.505965412e-01f,
-    1.115840077e+00f,
-    2.225850296e+01f,
-    2.221845055e+01f,
-    3.454273376e+02f,
-    4.672652721e+00f,
-    1.370366287e+01f,
-    1.598156261e+01f,
-    7.891762733e+00f,
-    8.815912604e-01f,
-    1.120332122e+00f,
-    1.519103050e+00f,
-    1.286877251e+01f,
-    1.253699875e+02f,
-    6.875480413e-01f,
-    6.476085633e-02f,
-    6.802301854e-02f,
-    6.324968815e+00f,
-    4.339935684e+01f,
-    2.271926689e+01f,
-    2.294143662e-02f,
-    1.078302956e+01f,
-    6.275714040e-01f,
-    5.012657046e-01f,
-    6.886724472e+00f,
-    3.468854129e-01f,
-    4.325909913e-01f,
-    3.931455135e+00f,
-    1.833114773e-01f,
-    7.216408849e-02f,
-    3.584179878e+00f,
-    1.582739592e+00f,
-    1.493474770e+01f,
-    3.602146864e+00f,
-    1.785842657e+00f,
-    9.573579431e-01f,
-    9.092888236e-01f,
-    3.291520476e-01f,
-    1.421273202e-01f,
-    2.777242851e+01f,
-    2.906633759e+01f,
-    6.758815765e+01f,
-    1.366664410e+00f,
-    5.589079857e+00f,
-    1.812739730e+00f,
-    1.255659342e+00f,
-    1.468178511e+00f,
-    1.724333048e+00f,
-    3.643415451e+01f,
-    2.756655884e+01f,
-    1.796260071e+02f,
-    2.020171881e+00f,
-    3.467993975e+00f,
-    3.154189110e+00f,
-    4.051998258e-01f,
-    7.907435298e-01f,
-    6.939706802e-01f,
-    6.356389999e+01f,
-    6.112598038e+01f,
-    2.008433075e+02f,
-    6.470456123e-01f,
-    2.853394270e+00f,
-    1.524678707e+00f,
-    2.569868267e-01f,
-    4.699451447e+00f,
-    4.373947144e+01f,
-    2.371171188e+01f,
-    3.922312546e+01f,
-    4.132043076e+01f,
-    3.161182594e+01f,
-    9.794677734e+00f,
-    1.037892914e+01f,
-    8.700038910e+00f,
-    1.117348957e+01f,
-    4.950850296e+01f,
-    2.295223236e+01f,
-    1.425624847e+01f,
-    6.057864380e+01f,
-    1.507842541e+01f,
-    1.906183434e+01f,
-    1.964896202e+01f,
-    2.027818680e+01f,
-    1.495260429e+01f,
-    3.127774620e+01f,
-    3.417903519e+01f,
-    1.061357651e+02f,
-    4.634539795e+01f,
-    6.675688171e+01f,
-    3.920446634e+00f,
-    9.815607452e+01f,
-    6.212959290e+01f,
-    1.058125610e+02f,
-    2.848331928e+00f,
-    4.938449478e+01f,
-    3.538756847e+00f,
-    1.419860721e+00f,
-    1.779237270e+00f,
-    3.399337530e+00f,
-    6.848974609e+01f,
-    1.041606674e+02f,
-    1.471804810e+02f,
-    6.223574162e+00f,
-    6.059987640e+01f,
-    4.397524261e+01f,
-    2.944447279e+00f,
-    2.337110281e+00f,
-    1.846596122e+00f,
-    1.514405518e+02f,
-    1.193420105e+02f,
-    1.202023438e+03f,
-    3.447173357e+00f,
-    1.160643387e+02f,
-    1.321763611e+01f,
-    1.937019348e+00f,
-    1.457678890e+01f,
-    2.604969215e+01f,
-    2.276304245e+01f,
-    1.792466640e+00f,
-    7.337066650e+00f,
-    2.505671978e+00f,
-    2.382359028e+00f,
-    7.187306285e-01f,
-    6.474409103e-01f,
-    1.780778313e+01f,
-    1.021399498e+01f,
-    2.583663368e+01f,
-    5.502283096e+00f,
-    2.797236681e+00f,
-    3.204371929e+00f,
-    1.421894550e+00f,
-    8.807560802e-01f,
-    7.556096315e-01f,
-    3.654442596e+01f,
-    6.240015793e+01f,
-    6.246225739e+01f,
-    1.181962252e+00f,
-    2.661759138e+00f,
-    4.775158882e+00f,
-    1.763425946e+00f,
-    3.935628128e+01f,
-    6.176279783e-01f,
-    4.005868530e+01f,
-    4.139612198e+00f,
-    1.611589491e-01f,
-    4.332718849e+00f,
-    1.626896024e+00f,
-    1.169519901e+00f,
-    1.791903019e+00f,
-    3.556094742e+01f,
-    4.585005045e-01f,
-    1.096132812e+02f,
-    4.131906509e+00f,
-    4.952558041e+00f,
-    6.245933533e+00f,
-    5.994185805e-01f,
-    2.746457160e-01f,
-    1.600356340e+00f,
-    5.118865967e+01f,
-    5.255285501e-01f,
-    9.393992615e+01f,
-    7.148619175e+00f,
-    4.621743262e-01f,
-    4.030661583e+00f,
-    1.202827334e+00f,
-    1.027578259e+01f,
-    1.163835239e+01f,
-    2.177385521e+01f,
-    2.024844289e-01f,
-    2.349820614e+00f,
-    6.763787270e-01f,
-    7.394806743e-01f,
-    1.280617118e+00f,
-    8.018292785e-01f,
-    1.768776321e+01f,
-    2.740707016e+01f,
-    7.151938629e+01f,
-    9.219366312e-01f,
-    2.343173027e+00f,
-    2.891887903e+00f,
-    1.695802361e-01f,
-    6.804022789e-01f,
-    5.830314755e-01f,
-    3.462485886e+01f,
-    3.417340469e+01f,
-    1.555487061e+02f,
-    2.689006329e-01f,
-    2.365606308e+00f,
-    5.288617611e-01f,
-    8.117392659e-01f,
-    2.266807079e+00f,
-    2.082128227e-01f,
-    5.105323792e-01f,
-    1.970741749e+00f,
-    9.843053669e-02f,
-    2.629335225e-01f,
-    7.706213951e+00f,
-    3.336633205e+00f,
-    3.366384506e+00f,
-    8.025031090e+00f,
-    1.667796075e-01f,
-    5.683281422e-01f,
-    1.337748814e+01f,
-    3.956525326e+00f,
-    9.561084747e+00f,
-    1.607185483e+00f,
-    2.044001579e+00f,
-    4.765601158e-01f,
-    5.537878513e+00f,
-    2.190863788e-01f,
-    4.158867300e-01f,
-    2.868369818e+00f,
-    4.090243280e-01f,
-    2.476780415e+00f,
-    2.249594450e+00f,
-    7.253585052e+01f,
-    3.559101486e+01f,
-    1.879803925e+02f,
-    9.192907810e-01f,
-    1.052490139e+01f,
-    1.176460552e+01f,
-    7.467571497e-01f,
-    1.842115521e+00f,
-    1.701419353e+00f,
-    6.564358521e+01f,
-    5.512519455e+01f,
-    6.966580811e+02f,
-    6.049892902e+00f,
-    6.379065704e+01f,
-    4.892556381e+01f,
-    1.902364939e-01f,
-    8.543838859e-01f,
-    8.818836808e-01f,
-    2.615903320e+02f,
-    6.145579147e+01f,
-    1.297790405e+03f,
-    8.413892984e-01f,
-    8.951811981e+01f,
-    1.370894051e+01f,
-    1.132877588e+00f,
-    4.890262604e+01f,
-    9.779704094e+00f,
-    1.189526320e+00f,
-    1.063819122e+02f,
-    1.985203934e+01f,
-    2.399411917e+00f,
-    9.407110214e+00f,
-    1.330290127e+01f,
-    1.479353428e+00f,
-    2.432428122e+00f,
-    3.596928418e-01f,
-    1.134671688e+00f,
-    1.008053899e+00f,
-    2.846589312e-02f,
-    3.233393431e-01f,
-    1.593103027e+01f,
-    1.148184967e+01f,
-    1.637891006e+01f,
-    3.444997311e+00f,
-    4.127875865e-01f,
-    3.197164237e-01f,
-    2.485444307e+00f,
-    5.836580992e-01f,
-    1.994475603e+00f,
-    3.799403667e+00f,
-    3.128841877e+00f,
-    2.233283758e+00f,
-    1.030233979e+00f,
-    4.588858411e-02f,
-    2.398343682e-01f,
-    7.023803234e+00f,
-    2.765905857e-01f,
-    2.004876375e+00f,
-    1.825114441e+01f,
-    1.542134094e+01f,
-    1.561537075e+01f,
-    1.477934170e+01f,
-    2.368899107e+00f,
-    9.905223846e-01f,
-    1.761853337e+00f,
-    1.754576111e+01f,
-    5.929962397e-01f,
-    1.418617725e+00f,
-    6.777739048e+00f,
-    8.158495903e+00f,
-    5.494936466e+00f,
-    5.250213146e+00f,
-    3.241843283e-01f,
-    4.665847719e-01f,
-    7.000542164e+00f,
-    8.286598206e+00f,
-    4.293700218e+00f,
-    9.602428675e-01f,
-    3.463602662e-01f,
-    8.055580258e-01f,
-    2.402786016e+00f,
-    1.083586589e-01f,
-    5.198137760e-01f,
-    7.316995263e-01f,
-    1.595885468e+01f,
-    1.888634872e+01f,
-    1.845103836e+01f,
-    3.968031332e-02f,
-    3.649914861e-01f,
-    1.156278476e-01f,
-    3.969932348e-02f,
-    8.290985823e-01f,
-    5.293220282e-01f,
-    1.553122044e+01f,
-    1.491777229e+01f,
-    1.875248337e+01f,
-    1.367427558e-01f,
-    7.138226628e-01f,
-    2.903230190e-01f,
-    6.184103712e-02f,
-    1.076981500e-01f,
-    1.527868360e-01f,
-    1.698328018e+01f,
-    3.371744394e+00f,
-    1.267305183e+01f,
-    3.943620995e-02f,
-    4.777086973e-01f,
-    1.616992652e-01f,
-    2.518163323e-01f,
-    3.432211637e+00f,
-    2.845654786e-01f,
-    2.323572189e-01f,
-    1.052915692e+00f,
-    2.208725363e-02f,
-    7.347209752e-02f,
-    1.904297256e+01f,
-    1.253953934e+01f,
-    1.573848152e+01f,
-    4.469223022e+00f,
-    2.287383080e-01f,
-    1.821482033e-01f,
-    2.997039557e+00f,
-    4.179674387e-01f,
-    4.395670891e-01f,
-    1.264588833e+00f,
-    1.870596766e+00f,
-    5.028853416e-01f,
-    4.107291102e-01f,
-    2.019865252e-02f,
-    6.357395649e-02f,
-    3.686989069e+00f,
-    1.320679635e-01f,
-    4.628248215e-01f,
-    5.246014118e+00f,
-    5.958769798e+00f,
-    3.652791381e-01f,
-    5.418782234e-01f,
-    1.695631742e-01f,
-    2.879495323e-01f,
-    1.806717962e-01f,
-    1.160011441e-01f,
-    1.159888506e+00f,
-    3.116278350e-01f,
-    2.699673176e+00f,
-    3.511784971e-01f,
-    8.140971661e-01f,
-    1.304571271e+00f,
-    1.513603449e+00f,
-    1.238644481e+00f,
-    1.045222655e-01f,
-    4.737689495e-01f,
-    7.847543806e-02f,
-    2.198848248e+00f,
-    2.214693278e-01f,
-    5.265808105e-01f,
-    2.553673089e-01f,
-    3.855260015e-01f,
-    2.371595949e-01f,
-    7.830304652e-02f,
-    1.563249469e+00f,
-    1.829098582e+00f,
-    2.171761751e+00f,
-    1.107047462e+01f,
-    7.504105091e+00f,
-    4.385229111e+00f,
-    7.476867199e+00f,
-    4.697672844e+00f,
-    4.440632343e+00f,
-    2.728205204e+00f,
-    1.515051484e+00f,
-    1.739877820e+00f,
-    1.634834528e+00f,
-    1.644846439e+00f,
-    1.834956169e+00f,
-    1.204060555e+00f,
-    1.732548833e+00f,
-    2.364711285e+00f,
-    5.046444893e+00f,
-    1.004311848e+01f,
-    3.783112049e+00f,
-    9.705064774e+00f,
-    2.648172379e+00f,
-    7.343066692e+00f,
-    3.084901810e+00f,
-    1.507969475e+01f,
-    1.156168270e+01f,
-    4.388554382e+01f,
-    3.363003969e+00f,
-    6.130185127e-01f,
-    8.140861988e-01f,
-    1.207711983e+01f,
-    3.861193061e-01f,
-    4.518460751e+00f,
-    1.161472988e+01f,
-    1.115140533e+01f,
-    8.809556007e+00f,
-    6.370173931e+00f,
-    1.704495400e-01f,
-    2.542848587e-01f,
-    8.138392448e+00f,
-    1.075329971e+01f,
-    1.667507744e+01f,
-    2.076327324e+00f,
-    7.328044772e-01f,
-    4.538877904e-01f,
-    2.876952171e+00f,
-    2.626335323e-01f,
-    1.816064715e-01f,
-    6.869844198e-01f,
-    7.545792580e+00f,
-    5.918840408e+00f,
-    1.058817062e+02f,
-    1.622230649e+00f,
-    6.585953832e-01f,
-    1.218945265e+00f,
-    2.474794388e+01f,
-    1.286223507e+01f,
-    1.558404083e+02f,
-    7.201523781e+00f,
-    4.464683533e+00f,
-    2.097710228e+01f,
-    3.214647532e+00f,
-    1.977145433e+00f,
-    3.968010664e+00f,
-    4.922278881e+00f,
-    6.189739704e+00f,
-    1.165317059e+01f,
-    1.001699090e+00f,
-    3.384912610e-01f,
-    2.561611235e-01f,
-    1.177969456e+01f,
-    3.046385765e+00f,
-    1.351471863e+02f,
-    2.896960080e-01f,
-    5.542413712e+00f,
-    9.254663251e-03f,
-    3.906091452e-01f,
-    9.723226428e-01f,
-    4.216539860e-02f,
-    3.026532531e-01f,
-    8.483150974e-03f,
-    7.047751546e-01f,
-    1.039507031e+00f,
-    2.639918566e+00f,
-    1.709610462e+00f,
-    9.373178482e-01f,
-    4.669876993e-01f,
-    8.082055449e-01f,
-    5.385038257e-01f,
-    7.753148675e-01f,
-    1.646802139e+01f,
-    1.174608803e+01f,
-    1.497761536e+01f,
-    2.511402369e-01f,
-    1.147310138e+00f,
-    4.666410983e-01f,
-    1.391290128e-01f,
-    7.883570194e-01f,
-    3.317130804e-01f,
-    2.697355080e+01f,
-    1.516413116e+01f,
-    3.077752686e+01f,
-    9.436759353e-01f,
-    4.436713219e+00f,
-    1.688204288e+00f,
-    1.006966904e-01f,
-    2.779804170e-01f,
-    1.482819915e-01f,
-    1.101194572e+01f,
-    3.597552061e+00f,
-    1.695190048e+01f,
-    2.829010487e-01f,
-    5.296553373e-01f,
-    9.813593030e-01f,
-    1.567180455e-01f,
-    2.794991016e+00f,
-    1.274159145e+01f,
-    3.708293438e+00f,
-    2.106949806e+00f,
-    4.197331429e+00f,
-    2.218324661e+00f,
-    2.413015747e+01f,
-    1.120852757e+01f,
-    1.284965324e+01f,
-    8.408648491e+00f,
-    9.951080322e+00f,
-    1.369958878e+01f,
-    1.150624180e+01f,
-    2.641659927e+01f,
-    3.660618973e+01f,
-    5.884554386e+00f,
-    6.335180759e+00f,
-    2.270161867e+00f,
-    8.271387100e+00f,
-    4.968237877e+00f,
-    3.446095943e+00f,
-    1.216312408e+01f,
-    5.543686390e+00f,
-    1.282596016e+01f,
-    4.309879780e+00f,
-    2.635501671e+01f,
-    1.775678825e+01f,
-    3.687815094e+01f,
-    1.070313931e+00f,
-    3.475785971e+00f,
-    2.168645144e+00f,
-    1.370016694e+00f,
-    2.189389229e+00f,
-    1.888832211e+00f,
-    2.465221214e+01f,
-    3.202165222e+01f,
-    7.430851746e+01f,
-    6.806232929e+00f,
-    3.876879501e+01f,
-    5.820262909e+01f,
-    3.251186609e-01f,
-    1.351963162e+00f,
-    1.740167737e-01f,
-    1.095958996e+01f,
-    5.077238560e+00f,
-    2.068880463e+01f,
-    1.944648623e+00f,
-    1.152238369e+01f,
-    4.937694073e+00f,
-    4.899588227e-01f,
-    2.275149107e+00f,
-    7.432848930e+00f,
-    1.516743183e+00f,
-    4.366976166e+01f,
-    3.355566025e+01f,
-    3.694742966e+01f,
-    3.729142904e+00f,
-    5.795938492e+00f,
-    7.185870647e+00f,
-    4.237040043e+00f,
-    2.074405432e+00f,
-    2.771970034e+00f,
-    7.881281376e-01f,
-    1.678157210e+00f,
-    7.903963923e-01f,
-    1.192268848e+00f,
-    1.349887252e+00f,
-    1.128045321e+00f,
-    1.026003647e+01f,
-    1.213306904e+01f,
-    3.024598122e+00f,
-    1.302327633e+00f,
-    4.101581097e+00f,
-    3.021169186e+00f,
-    5.629271984e+00f,
-    3.205674362e+01f,
-    4.091875076e+01f,
-    3.930746078e+01f,
-    1.276820183e+00f,
-    4.883773327e-01f,
-    5.970988870e-01f,
-    2.916900635e+01f,
-    2.397069931e+01f,
-    1.413309288e+01f,
-    6.097246408e-01f,
-    1.340704560e+00f,
-    5.502952337e-01f,
-    8.804230690e+00f,
-    1.010379219e+01f,
-    1.412137127e+01f,
-    9.302620292e-01f,
-    3.744287193e-01f,
-    2.922472060e-01f,
-    2.616750002e+00f,
-    1.154896355e+01f,
-    1.041676426e+01f,
-    1.005720854e+00f,
-    2.317284793e-01f,
-    5.255227685e-01f,
-    1.797418785e+01f,
-    4.048462296e+01f,
-    3.834519958e+01f,
-    4.148436546e+00f,
-    2.783643723e+00f,
-    5.968466759e+00f,
-    1.143738627e+00f,
-    2.300339937e+00f,
-    3.955906153e+00f,
-    1.148620844e+00f,
-    4.615590096e+00f,
-    2.148801088e+00f,
-    7.073678970e-01f,
-    2.283883989e-01f,
-    2.616710067e-01f,
-    7.816232204e+00f,
-    1.331089306e+01f,
-    5.168987656e+01f,
-    9.800442308e-02f,
-    1.299830055e+01f,
-    1.733922577e+01f,
-    1.785910988e+01f,
-    2.852078378e-01f,
-    1.483987570e+00f,
-    3.615748286e-01f,
-    3.633687496e-01f,
-    1.502827525e+00f,
-    6.653987765e-01f,
-    1.327154255e+01f,
-    3.477344131e+01f,
-    2.773465157e+01f,
-    1.306732774e+00f,
-    1.469716072e+00f,
-    1.625135660e+00f,
-    2.621715367e-01f,
-    2.776659727e-01f,
-    4.611361623e-01f,
-    4.587795734e+00f,
-    8.414916039e+00f,
-    1.438650322e+01f,
-    6.598041654e-01f,
-    1.105220914e+00f,
-    1.058209896e+00f,
-    4.182555676e-01f,
-    3.216559172e+00f,
-    4.007558823e+00f,
-    2.111396551e+00f,
-    2.128054810e+01f,
-    7.617359924e+01f,
-    2.081061745e+01f,
-    3.495369434e+00f,
-    3.908076048e+00f,
-    3.315505505e+00f,
-    4.183444023e+00f,
-    1.942643881e+00f,
-    2.908406496e+00f,
-    2.368793964e+00f,
-    3.521073580e+00f,
-    1.069249153e+00f,
-    9.271983504e-01f,
-    1.052722096e+00f,
-    1.780045152e+00f,
-    7.528306007e+00f,
-    1.456328297e+01f,
-    6.563300133e+00f,
-    3.406275034e+00f,
-    7.804370880e+00f,
-    4.210539341e+00f,
-    1.058012295e+01f,
-    9.695631027e+00f,
-    1.324387193e+00f,
-    9.776482582e-01f,
-    6.096674919e+00f,
-    1.044460177e+00f,
-    2.836938798e-01f,
-    1.233006954e+00f,
-    1.653410345e-01f,
-    1.341994554e-01f,
-    1.819578886e+00f,
-    4.504854381e-01f,
-    5.732923985e+00f,
-    1.421016753e-01f,
-    1.377621174e+00f,
-    2.386934757e-01f,
-    5.222311497e+00f,
-    1.396813107e+01f,
-    8.804455400e-01f,
-    8.547070622e-01f,
-    5.527014732e-01f,
-    3.384384394e+00f,
-    2.157305717e+00f,
-    1.367394328e+00f,
-    4.016599178e+00f,
-    1.266310334e+00f,
-    6.557209492e-01f,
-    1.969928592e-01f,
-    5.570152998e-01f,
-    1.191869140e+00f,
-    3.099827051e+00f,
-    5.308887362e-01f,
-    4.073495269e-01f,
-    1.746062487e-01f,
-    5.426161289e+00f,
-    1.353510666e+01f,
-    1.121187305e+01f,
-    8.715854645e+00f,
-    1.937396049e+01f,
-    6.980772495e+00f,
-    1.830373192e+01f,
-    6.010549545e+00f,
-    1.327701092e+01f,
-    6.227794647e+00f,
-    8.229810715e+00f,
-    1.020837069e+00f,
-    9.569609165e-01f,
-    2.833638489e-01f,
-    5.255437374e+00f,
-    8.817935944e+00f,
-    7.961485386e-01f,
-    2.422322273e+00f,
-    1.580723882e+00f,
-    4.287971556e-01f,
-    3.877919912e+00f,
-    1.649169159e+01f,
-    8.882550240e+00f,
-    5.162923336e+00f,
-    1.050180340e+01f,
-    2.880964756e+00f,
-    2.818693399e+00f,
-    1.828437424e+01f,
-    1.989332080e+00f,
-    1.023668194e+01f,
-    1.950409889e+01f,
-    2.763957500e+00f,
-    1.995831609e+00f,
-    5.891435623e+00f,
-    1.185442066e+01f,
-    8.261373520e+00f,
-    8.810998797e-01f,
-    2.442430258e+00f,
-    5.455159545e-01f,
-    1.097847462e+01f,
-    3.749496460e+00f,
-    6.915996075e-01f,
-    3.184243143e-01f,
-    8.715053648e-02f,
-    2.449209929e+00f,
-    9.653295577e-02f,
-    1.816756576e-01f,
-    4.847865999e-01f,
-    2.422221005e-01f,
-    2.619503736e-01f,
-    2.913897336e-01f,
-    1.303165817e+01f,
-    3.561742604e-01f,
-    4.562622070e+00f,
-    2.663174272e-01f,
-    9.605751038e-01f,
-    6.027215004e+00f,
-    6.302519989e+01f,
-    1.614681363e+00f,
-    1.135468864e+01f,
-    7.012079716e+00f,
-    1.171354485e+01f,
-    1.535066032e+01f,
-    9.043733597e+00f,
-    4.517295361e+00f,
-    3.412348032e+00f,
-    3.749382019e+00f,
-    2.374184370e+00f,
-    3.043033123e+00f,
-    6.585271955e-01f,
-    1.027207971e+00f,
-    5.458850265e-01f,
-    1.690875292e+00f,
-    5.388348103e-01f,
-    3.896949589e-01f,
-    3.403572142e-01f,
-    8.741692305e-01f,
-    1.179088879e+01f,
-    1.779251671e+01f,
-    2.696940994e+01f,
-    3.243056870e+01f,
-    1.828053474e+01f,
-    6.057945728e+00f,
-    2.716457129e+00f,
-    5.510247707e+00f,
-    2.634337187e+00f,
-    3.617105782e-01f,
-    6.225428104e+00f,
-    4.317429960e-01f,
-    1.546096802e-01f,
-    1.835158467e-01f,
-    1.565805376e-01f,
-    2.314406633e+00f,
-    2.238850854e-02f,
-    8.710456491e-01f,
-    3.567734063e-01f,
-    2.108144522e+00f,
-    9.923892975e+00f,
-    2.300713539e+00f,
-    1.018428802e+00f,
-    7.384772897e-01f,
-    3.948480606e+00f,
-    1.652274251e+00f,
-    1.268393993e+01f,
-    3.832449722e+01f,
-    1.583352566e+01f,
-    6.630860806e+00f,
-    1.930589676e+01f,
-    1.045795536e+01f,
-    1.508050346e+01f,
-    2.678169250e+01f,
-    1.523197079e+01f,
-    7.843870640e+00f,
-    1.176812935e+01f,
-    1.437578201e+00f,
-    2.550384521e+00f,
-    3.342180252e+01f,
-    1.144035339e+01f,
-    1.013304710e+01f,
-    1.270356655e+00f,
-    1.013272858e+01f,
-    5.521790385e-01f,
-    8.491271734e-01f,
-    1.335517168e+00f,
-    1.232888412e+02f,
-    1.117835045e+00f,
-    3.623387527e+01f,
-    1.717697334e+01f,
-    1.829841232e+01f,
-    1.627214670e+00f,
-    1.326713848e+01f,
-    3.507020187e+01f,
-    5.644558334e+01f,
-    1.668838882e+01f,
-    1.901416016e+01f,
-    7.566699505e+00f,
-    2.057629108e+00f,
-    2.009642363e+00f,
-    8.702424765e-01f,
-    2.835798264e+00f,
-    4.434471607e+00f,
-    3.197224140e+00f,
-    9.977737665e-01f,
-    1.402900219e+00f,
-    1.388890266e+00f,
-    1.827066422e+00f,
-    1.731613541e+01f,
-    3.917244971e-01f,
-    1.961303353e+00f,
-    7.335304260e+00f,
-    9.647643089e+00f,
-    4.171271324e+00f,
-    1.214308143e-01f,
-    2.310338497e+00f,
-    1.152088165e+01f,
-    7.674232483e+00f,
-    1.831545639e+01f,
-    2.017464638e+01f,
-    8.270302773e+00f,
-    1.908773422e+01f,
-    2.034506035e+01f,
-    2.244339355e+03f,
-    1.153074741e+00f,
-    1.494793129e+01f,
-    5.065012741e+01f,
-    1.452020168e+01f,
-    4.200748596e+02f,
-    3.061758280e+00f,
-    9.285611153e+00f,
-    1.842723489e+00f,
-    3.125694990e+00f,
-    4.724921703e+00f,
-    1.585844874e+00f,
-    5.798030376e+00f,
-    3.896336794e+00f,
-    1.655253220e+01f,
-    1.012095566e+02f,
-    1.843600392e+00f,
-    1.890024948e+01f,
-    6.865519047e+00f,
-    9.824938178e-01f,
-    2.614111328e+01f,
-    8.288182616e-01f,
-    9.703990221e-01f,
-    8.303328604e-02f,
-    5.056447983e+00f,
-    1.371963978e+00f,
-    1.657238901e-01f,
-    4.861234725e-01f,
-    1.264020562e+00f,
-    1.364191437e+01f,
-    1.493180656e+01f,
-    2.118192101e+01f,
-    1.155166149e+01f,
-    1.090040088e+00f,
-    1.901957893e+01f,
-    1.999032402e+01f,
-    1.975182414e+00f,
-    9.687550545e+00f,
-    6.797295094e+00f,
-    1.371787930e+01f,
-    1.744518280e+00f,
-    1.020213032e+01f,
-    8.586570740e+00f,
-    1.058972359e+01f,
-    2.205853271e+01f,
-    8.465055466e+00f,
-    7.005437374e+00f,
-    7.028712034e-01f,
-    3.080593646e-01f,
-    4.241553247e-01f,
-    1.007736087e+00f,
-    1.035994720e+01f,
-    5.724178314e+01f,
-    4.488782120e+01f,
-    6.254838705e-01f,
-    1.344742060e+00f,
-    1.318281412e+00f,
-    2.110282898e+00f,
-    3.119195223e+00f,
-    5.468152046e+00f,
-    3.291707277e+00f,
-    6.746315360e-01f,
-    1.872881126e+01f,
-    1.132313728e+01f,
-    3.343031168e+00f,
-    7.682369995e+01f,
-    5.336480331e+01f,
-    4.958021545e+01f,
-    4.940904999e+01f,
-    2.789524269e+01f,
-    1.331290913e+01f,
-    3.431813240e+00f,
-    1.339785862e+01f,
-    3.972784281e-01f,
-    3.873303413e+00f,
-    3.073659539e-01f,
-    8.780389428e-01f,
-    2.368107796e+00f,
-    7.689879537e-01f,
-    2.898273087e+01f,
-    2.610859632e+00f,
-    1.015064955e+00f,
-    9.117414355e-01f,
-    1.350816488e+00f,
-    1.136923313e+00f,
-    7.200331688e-01f,
-    8.472368240e+00f,
-    7.603986740e+00f,
-    6.037587643e+00f,
-    1.130608845e+01f,
-    5.369946957e-01f,
-    1.026789427e+00f,
-    4.966818094e-01f,
-    2.928376198e+00f,
-    4.200976491e-01f,
-    3.316024065e+00f,
-    4.100959301e+00f,
-    1.901697278e+00f,
-    2.972945976e+01f,
-    7.823204994e+00f,
-    1.224169612e+00f,
-    2.279035091e+00f,
-    1.424823552e-01f,
-    7.113099098e-01f,
-    2.595846653e-01f,
-    2.158124447e-01f,
-    7.473771572e-01f,
-    3.112898588e+00f,
-    1.216918373e+01f,
-    5.416847229e+00f,
-    6.701900959e-01f,
-    1.249108791e+00f,
-    5.016118050e+00f,
-    3.886338472e-01f,
-    1.833726764e+00f,
-    1.835683465e+00f,
-    3.146683574e-01f,
-    2.014269382e-01f,
-    8.451267242e+00f,
-    7.023397923e+00f,
-    3.101944923e-01f,
-    1.621794999e-01f,
-    1.929790139e+00f,
-    1.247203588e+00f,
-    1.051317930e+00f,
-    7.471779346e+00f,
-    3.887578249e-01f,
-    2.367883205e+00f,
-    3.803606331e-01f,
-    4.470337927e-01f,
-    1.117958641e+01f,
-    5.780781507e-01f,
-    1.802376509e-01f,
-    1.776739001e+00f,
-    6.093021035e-01f,
-    2.678842545e-01f,
-    1.226049304e+00f,
-    1.824938178e+00f,
-    9.511304498e-01f,
-    4.340975285e+00f,
-    4.232977867e+00f,
-    1.312847018e+00f,
-    1.830180526e+00f,
-    1.200302505e+01f,
-    5.500885487e+00f,
-    4.909874916e+00f,
-    6.991614103e-01f,
-    3.623202085e+00f,
-    1.080616093e+01f,
-    7.588272691e-01f,
-    2.449136078e-01f,
-    1.429476589e-01f,
-    3.772948980e-01f,
-    5.810201168e-01f,
-    1.609601527e-01f,
-    1.271806717e+00f,
-    1.135977626e+00f,
-    7.858760953e-01f,
-    6.703135967e+00f,
-    2.196941757e+01f,
-    8.095083237e+00f,
-    1.418285847e+00f,
-    7.316332459e-01f,
-    8.091928482e+00f,
-    1.135350609e+01f,
-    2.066689253e+00f,
-    1.068631768e+00f,
-    3.581967354e+00f,
-    1.522833920e+01f,
-    7.859044552e+00f,
-    1.445199966e+00f,
-    1.751608491e+00f,
-    1.235799670e+00f,
-    3.019978762e+00f,
-    3.556895971e+00f,
-    4.615223885e+00f,
-    1.859942079e-01f,
-    5.986040115e+00f,
-    2.028464317e+00f,
-    5.128893256e-01f,
-    7.292303443e-01f,
-    9.185513258e-01f,
-    1.653226280e+01f,
-    1.015467834e+01f,
-    4.017383099e+00f,
-    8.395103455e+00f,
-    8.743796349e+00f,
-    4.277528763e+00f,
-    1.869773483e+01f,
-    1.254279232e+01f,
-    1.263384819e+01f,
-    1.111754513e+01f,
-    7.753209591e+00f,
-    4.620612144e+00f,
-    1.457467937e+01f,
-    2.495133400e+01f,
-    7.851903439e+00f,
-    2.588388205e+00f,
-    6.627798080e-01f,
-    1.294070625e+01f,
-    8.669389725e+00f,
-    1.781546402e+01f,
-    4.013062477e+00f,
-    1.486896896e+01f,
-    3.128520250e+00f,
-    8.275429606e-01f,
-    5.996803641e-01f,
-    1.797235489e+01f,
-    1.157503223e+01f,
-    1.691509628e+01f,
-    1.128435731e+00f,
-    1.717731953e+00f,
-    6.562770605e-01f,
-    1.894573975e+01f,
-    3.879023790e+00f,
-    1.105859833e+02f,
-    2.793228149e+00f,
-    2.203559875e+01f,
-    2.582267952e+01f,
-    2.409841061e+00f,
-    7.214560509e-01f,
-    5.078579783e-01f,
-    1.451190710e+00f,
-    1.117301956e-01f,
-    3.005924034e+01f,
-    6.691432476e+00f,
-    1.344935417e+01f,
-    2.211817265e+00f,
-    9.203367233e+00f,
-    1.468400764e+01f,
-    4.816882610e+00f,
-    2.934040785e+00f,
-    1.487562180e+00f,
-    2.816710472e-01f,
-    1.382977200e+01f,
-    6.518994331e+00f,
-    1.111504841e+01f,
-    2.357926369e+00f,
-    1.645300031e+00f,
-    7.713565975e-02f,
-    1.501022458e+00f,
-    4.459211230e-01f,
-    5.290545464e+00f,
-    5.877992630e+00f,
-    3.286238909e+00f,
-    6.608130336e-01f,
-    5.850432515e-01f,
-    4.969494343e+00f,
-    3.286527395e+00f,
-    1.455482960e+00f,
-    1.243589282e+00f,
-    3.818558753e-01f,
-    6.995250285e-02f,
-    6.619542241e-01f,
-    1.644259393e-01f,
-    5.634590983e-01f,
-    2.606162727e-01f,
-    3.203931451e-01f,
-    2.504697084e+00f,
-    1.534664989e+00f,
-    4.737070084e+00f,
-    2.895979583e-01f,
-    2.385360003e-01f,
-    1.466212124e-01f,
-    6.415060759e-01f,
-    9.308127165e-01f,
-    5.033975840e-01f,
-    2.199041396e-01f,
-    1.817370206e-01f,
-    3.332532942e-01f,
-    9.282341957e+00f,
-    2.845814228e+00f,
-    7.432506561e+00f,
-    1.448177719e+01f,
-    5.979115486e+00f,
-    1.346329689e+01f,
-    9.857037663e-01f,
-    4.366239548e+00f,
-    2.333259821e+00f,
-    1.765144110e+00f,
-    1.297854543e+00f,
-    1.617586374e+00f,
-    4.531988144e+00f,
-    4.172827721e+00f,
-    2.328727484e+00f,
-    2.930095434e+00f,
-    1.933556199e+00f,
-    4.455085278e+00f,
-    7.561729431e+00f,
-    5.122214794e+00f,
-    2.137066364e+00f,
-    5.359663963e+00f,
-    1.510931134e+00f,
-    1.647768855e+00f,
-    1.651136637e+00f,
-    7.795450211e+00f,
-    2.067200661e+01f,
-    1.543860912e+01f,
-    1.251339078e+00f,
-    7.185543776e-01f,
-    1.145100832e+00f,
-    3.781918049e+00f,
-    1.361461449e+01f,
-    1.773387337e+01f,
-    2.037342310e+00f,
-    2.459545326e+01f,
-    1.011186790e+01f,
-    9.678131938e-01f,
-    2.458785027e-01f,
-    1.537254304e-01f,
-    4.323901653e+00f,
-    1.073147655e+00f,
-    3.124505758e+00f,
-    4.453494549e+00f,
-    5.738114715e-01f,
-    2.458838560e-02f,
-    5.287926793e-01f,
-    1.152388692e+00f,
-    3.929935992e-01f,
-    2.876245975e-01f,
-    4.559877813e-01f,
-    1.541760254e+01f,
-    6.191163254e+01f,
-    2.367336845e+01f,
-    1.064314842e+00f,
-    5.322893262e-01f,
-    5.248122692e+00f,
-    1.750273895e+01f,
-    8.045842052e-01f,
-    7.709560394e+00f,
-    1.161545467e+01f,
-    1.476639080e+01f,
-    1.476641941e+01f,
-    6.192540646e+00f,
-    1.308559132e+01f,
-    1.189773655e+01f,
-    1.299477100e+01f,
-    1.469853306e+01f,
-    1.634991646e+01f,
-    9.496623039e+00f,
-    2.838303375e+01f,
-    5.637154579e+00f,
-    3.074220657e+01f,
-    1.586141682e+01f,
-    1.106791992e+02f,
-    2.119714022e+00f,
-    1.262055635e+00f,
-    9.834540486e-01f,
-    1.744836617e+01f,
-    2.087791634e+01f,
-    2.657961273e+01f,
-    9.734861255e-01f,
-    1.517041683e+00f,
-    1.272217393e+00f,
-    2.483978653e+01f,
-    1.923516035e+00f,
-    1.437507629e+01f,
-    7.523274899e+00f,
-    1.817863274e+01f,
-    1.690428925e+01f,
-    1.183575916e+01f,
-    2.697424507e+01f,
-    7.305733681e+00f,
-    1.459607315e+01f,
-    1.379754257e+01f,
-    1.689414787e+01f,
-    7.519356012e-01f,
-    6.737913489e-01f,
-    1.012542605e+00f,
-    9.096025467e+00f,
-    7.194712162e+00f,
-    2.276469231e+01f,
-    8.415599823e+00f,
-    1.046033478e+01f,
-    1.930666161e+01f,
-    1.089628696e+00f,
-    1.088782907e+00f,
-    4.319240749e-01f,
-    4.608891904e-01f,
-    6.191140175e+00f,
-    2.127709866e+00f,
-    1.200755596e+01f,
-    1.906579781e+01f,
-    6.720645905e+01f,
-    3.648452759e+00f,
-    1.278124523e+01f,
-    9.998007774e+00f,
-    1.478728962e+01f,
-    5.555723190e+00f,
-    1.591239643e+01f,
-    1.404329967e+01f,
-    2.601247978e+01f,
-    1.794741631e+01f,
-    5.885044336e-01f,
-    8.208348751e-01f,
-    2.309646225e+01f,
-    1.397866154e+01f,
-    4.105458736e+00f,
-    3.980404437e-01f,
-    6.982402205e-01f,
-    2.208023071e+01f,
-    5.632122993e+00f,
-    6.044792175e+00f,
-    2.694250107e+01f,
-    2.363165092e+01f,
-    2.159539795e+01f,
-    1.025385141e+00f,
-    3.744406998e-01f,
-    8.982535601e-01f,
-    8.263800621e+00f,
-    2.003421021e+01f,
-    1.036960220e+01f,
-    4.139868915e-01f,
-    2.348785698e-01f,
-    5.009602308e-01f,
-    4.960755157e+01f,
-    1.115504026e+00f,
-    2.519918203e+00f,
-    1.163210773e+01f,
-    1.664726830e+01f,
-    2.326430321e+00f,
-    1.878438377e+01f,
-    1.544245625e+01f,
-    1.105649757e+01f,
-    1.631102562e+01f,
-    1.368863869e+01f,
-    8.133610725e+00f,
-    2.996585274e+01f,
-    1.299985981e+01f,
-    1.492268085e+01f,
-    3.286858749e+01f,
-    4.592769623e+00f,
-    3.639406967e+01f,
-    3.997541428e+01f,
-    6.388426423e-01f,
-    7.131656408e-01f,
-    3.221319962e+01f,
-    1.440892601e+01f,
-    9.680522919e+01f,
-    2.267776299e+01f,
-    7.439618111e+00f,
-    3.433847809e+01f,
-    2.781408386e+02f,
-    4.499624670e-01f,
-    5.257538557e-01f,
-    1.904105425e+00f,
-    8.774574995e-01f,
-    1.670712090e+01f,
-    2.156298447e+01f,
-    6.216521072e+01f,
-    2.102115393e+00f,
-    1.861878395e+00f,
-    3.072218132e+01f,
-    7.151067734e+00f,
-    3.573779345e+00f,
-    2.005252838e+00f,
-    9.480103254e-01f,
-    6.177530289e+01f,
-    1.988515091e+01f,
-    1.254195786e+01f,
-    1.148304343e+00f,
-    6.465940475e-01f,
-    1.037912011e+00f,
-    7.845030975e+01f,
-    4.357283401e+01f,
-    3.874013138e+01f,
-    4.755889893e+00f,
-    1.712132335e+00f,
-    4.158255100e+00f,
-    3.231945419e+01f,
-    1.261792660e+01f,
-    5.457438469e+00f,
-    3.307607651e+00f,
-    5.039511323e-01f,
-    1.729993939e+00f,
-    1.693011475e+02f,
-    1.184801197e+01f,
-    6.841933250e+00f,
-    5.332159042e+00f,
-    7.745726585e+00f,
-    1.255898380e+01f,
-    9.097654819e-01f,
-    1.325497180e-01f,
-    1.018327999e+01f,
-    5.878464222e+00f,
-    4.022173405e+00f,
-    2.184537649e-01f,
-    1.940459162e-01f,
-    2.701132536e+00f,
-    3.887593508e+00f,
-    8.006676435e-01f,
-    1.079483891e+01f,
-    5.723063469e+00f,
-    1.434729004e+01f,
-    1.764133072e+01f,
-    2.558616638e+01f,
-    2.325777817e+01f,
-    8.522987366e+00f,
-    1.729167819e+00f,
-    8.509151936e-01f,
-    7.611852884e-01f,
-    3.686884308e+01f,
-    1.285481930e+00f,
-    4.396005249e+01f,
-    1.858160782e+01f,
-    1.777004089e+02f,
-    1.378942966e+00f,
-    1.423002005e+00f,
-    1.724781752e+00f,
-    1.084790993e+01f,
-    5.575885010e+01f,
-    6.386278915e+01f,
-    6.428567767e-01f,
-    1.419921160e+00f,
-    8.412978053e-01f,
-    1.354781189e+02f,
-    1.425162411e+01f,
-    2.507673454e+01f,
-    2.389018822e+01f,
-    1.216963673e+01f,
-    6.568056583e+00f,
-    6.576634407e+00f,
-    1.957224083e+01f,
-    5.307073116e+00f,
-    1.032147408e+01f,
-    1.562031555e+01f,
-    4.813436985e+00f,
-    1.466232872e+01f,
-    9.833700180e+00f,
-    5.476547241e+00f,
-    2.659232855e+00f,
-    6.452961922e+00f,
-    6.078319550e+00f,
-    7.786513329e+00f,
-    9.382276535e+00f,
-    7.076860428e+00f,
-    3.562147856e+00f,
-    7.075402737e+00f,
-    3.701838732e+00f,
-    8.177525520e+00f,
-    3.062594032e+01f,
-    2.166427422e+01f,
-    1.222972751e+00f,
-    8.913560510e-01f,
-    6.382269263e-01f,
-    8.272957802e+00f,
-    2.520667267e+01f,
-    6.574448395e+01f,
-    5.107938766e+00f,
-    2.787858772e+01f,
-    1.515396500e+01f,
-    1.985140890e-01f,
-    4.904114008e-01f,
-    4.341491461e-01f,
-    8.719719648e-01f,
-    4.225016832e-01f,
-    1.443438721e+01f,
-    1.115305901e+01f,
-    2.922773933e+01f,
-    1.151320338e+00f,
-    8.186545968e-01f,
-    8.124629974e+00f,
-    6.708432198e+00f,
-    1.169732332e+00f,
-    4.596623421e+00f,
-    3.965056539e-01f,
-    9.592651367e+01f,
-    1.689851761e+01f,
-    7.611241817e+00f,
-    1.668884158e+00f,
-    1.005243421e+00f,
-    6.998211741e-01f,
-    7.342845798e-01f,
-    2.885905206e-01f,
-    2.346909523e+01f,
-    1.342498684e+01f,
-    2.534882355e+01f,
-    3.984740078e-01f,
-    3.807018995e-01f,
-    9.417266846e+00f,
-    5.329775810e+00f,
-    3.851173639e+00f,
-    5.088683367e-01f,
-    2.685367465e-01f,
-    2.413758993e+00f,
-    3.159977436e+00f,
-    3.013023376e+00f,
-    1.382833099e+02f,
-    2.335474586e+01f,
-    2.894907227e+02f,
-    3.055744648e+00f,
-    1.007430363e+01f,
-    2.369796181e+01f,
-    1.912016678e+01f,
-    6.440721989e+00f,
-    2.351965523e+01f,
-    1.112146378e+00f,
-    7.001106262e+00f,
-    1.083109093e+01f,
-    8.056338501e+01f,
-    1.447734833e+01f,
-    1.685756531e+02f,
-    1.220056152e+01f,
-    1.338152647e+00f,
-    3.302082825e+01f,
-    6.610335112e-01f,
-    2.251801109e+01f,
-    1.709740257e+01f,
-    2.334986305e+01f,
-    2.895059586e+01f,
-    4.492075920e+00f,
-    1.826248884e+00f,
-    8.677381873e-01f,
-    3.251382709e-01f,
-    2.349618196e+00f,
-    8.602054715e-01f,
-    6.676841259e+00f,
-    5.914741516e+00f,
-    3.469984293e+00f,
-    1.207607150e+00f,
-    4.524061978e-01f,
-    1.561327577e+00f,
-    1.231362462e+00f,
-    3.430058062e-01f,
-    2.880494118e+00f,
-    6.000128746e+00f,
-    9.684287071e+00f,
-    7.743145466e+00f,
-    3.118578672e+00f,
-    9.903667450e+00f,
-    1.127480316e+01f,
-    5.662131310e+00f,
-    8.149607658e+00f,
-    4.221207619e+00f,
-    3.904202938e+00f,
-    1.209712219e+01f,
-    9.741843224e+00f,
-    5.925095081e+00f,
-    3.330099583e+00f,
-    1.803633881e+01f,
-    9.319425821e-01f,
-    6.105943918e-01f,
-    8.548539281e-01f,
-    3.700071812e+00f,
-    1.553696394e+00f,
-    5.346178055e+00f,
-    6.485217214e-01f,
-    9.378895164e-01f,
-    3.710817695e-01f,
-    6.690105438e+00f,
-    2.357927084e+00f,
-    4.092491150e+00f,
-    4.894511223e+00f,
-    1.522175121e+01f,
-    4.854746342e+00f,
-    2.122607708e+00f,
-    1.317562461e+00f,
-    7.630625248e+00f,
-    2.503082466e+01f,
-    2.676160574e+00f,
-    1.283104420e+00f,
-    8.191520691e+00f,
-    2.417162180e+00f,
-    2.390497398e+01f,
-    3.647803545e+00f,
-    2.786930561e+00f,
-    2.413225651e+00f,
-    7.330611229e+00f,
-    4.464923382e+00f,
-    9.545352936e+01f,
-    1.604098320e+00f,
-    7.490653992e+00f,
-    2.525914383e+01f,
-    3.012521267e+00f,
-    2.285451442e-01f,
-    5.172773004e-01f,
-    9.631904364e-01f,
-    1.013823867e+00f,
-    1.332785010e+00f,
-    3.373176813e+00f,
-    6.398380280e+00f,
-    3.449878311e+01f,
-    9.665523171e-01f,
-    2.070695400e+00f,
-    3.061304092e-01f,
-    1.386055112e+00f,
-    3.192300081e+00f,
-    5.647249699e+00f,
-    4.146297455e+00f,
-    5.780460358e+00f,
-    2.513340473e+00f,
-    5.839680433e-01f,
-    6.873007119e-02f,
-    4.090198517e+00f,
-    2.254900217e+00f,
-    2.822635412e+00f,
-    2.091362923e-01f,
-    2.131688595e-01f,
-    1.687884927e+00f,
-    1.819766641e+00f,
-    6.923462152e-01f,
-    4.178712845e+00f,
-    1.063949203e+01f,
-    4.569821358e+00f,
-    2.647089720e+00f,
-    1.736787224e+01f,
-    1.616436768e+01f,
-    4.853708744e+00f,
-    5.016065121e+00f,
-    2.951668501e+00f,
-    4.498602390e+00f,
-    7.643923283e+00f,
-    2.334586620e+00f,
-    1.001794815e+01f,
-    1.093470097e+01f,
-    7.223225403e+01f,
-    2.565895617e-01f,
-    7.927615643e-01f,
-    7.545725107e-01f,
-    9.802461624e+00f,
-    6.363827705e+00f,
-    1.143831921e+01f,
-    2.353024185e-01f,
-    3.950272799e-01f,
-    1.822499335e-01f,
-    1.356173992e+01f,
-    2.916193247e+00f,
-    5.016633606e+01f,
-    2.185788155e+01f,
-    2.540212631e+00f,
-    1.464096737e+01f,
-    1.205152321e+01f,
-    1.167648792e+01f,
-    9.153548241e+00f,
-    8.448085785e-01f,
-    9.766520500e+00f,
-    4.714241624e-01f,
-    6.093405485e-01f,
-    1.144672394e+00f,
-    5.023849607e-01f,
-    3.925204754e+00f,
-    4.889331341e+00f,
-    2.589962482e+00f,
-    1.123485327e+00f,
-    5.116267800e-01f,
-    8.365776062e+00f,
-    3.354974270e+00f,
-    1.430440521e+01f,
-    3.127052784e+00f,
-    2.163371277e+01f,
-    1.008534074e+00f,
-    1.056409121e+00f,
-    1.397166252e+00f,
-    4.456991196e+00f,
-    2.703397942e+01f,
-    1.374336433e+01f,
-    5.014131069e+00f,
-    6.179054976e-01f,
-    2.732939243e+00f,
-    3.732445240e+00f,
-    2.319542885e+01f,
-    1.373222160e+01f,
-    2.173202038e+00f,
-    6.520346832e+01f,
-    4.338035107e+00f,
-    7.970933318e-01f,
-    1.758328229e-01f,
-    6.936836988e-02f,
-    5.026385188e-01f,
-    7.016064972e-02f,
-    2.364368916e+00f,
-    1.864689708e+00f,
-    1.611138225e+00f,
-    8.102329969e-01f,
-    1.409274638e-01f,
-    3.301544785e-01f,
-    6.261048913e-01f,
-    2.951284349e-01f,
-    3.104026914e-01f,
-    8.662370592e-02f,
-    9.353896379e-01f,
-    1.938941002e+00f,
-    1.023917556e+00f,
-    2.239670992e+00f,
-    1.265551567e+00f,
-    6.517781019e-01f,
-    3.062754154e+00f,
-    1.070814967e+00f,
-    2.760482311e+00f,
-    5.328238487e+00f,
-    6.046250820e+00f,
-    4.382432103e-01f,
-    1.742679030e-01f,
-    7.870569229e+00f,
-    3.016962242e+01f,
-    5.174025059e+00f,
-    4.894467890e-01f,
-    1.612963974e-01f,
-    4.158900976e-01f,
-    2.315931082e+00f,
-    6.420956254e-01f,
-    1.099760628e+01f,
-    2.732692480e+00f,
-    1.976572037e+01f,
-    1.137766719e+00f,
-    4.005316257e+00f,
-    1.120611548e+00f,
-    3.888084888e+00f,
-    1.949014664e-01f,
-    1.167787790e+00f,
-    3.935692608e-01f,
-    2.042332888e+00f,
-    8.033739328e-01f,
-    9.432049751e+00f,
-    1.260521293e+00f,
-    3.743286371e+00f,
-    9.472181320e+00f,
-    1.425007820e+00f,
-    1.408050346e+01f,
-    4.741155803e-01f,
-    1.234158897e+01f,
-    1.106264591e+01f,
-    1.135710835e+00f,
-    9.524406433e+00f,
-    4.163345814e+00f,
-    6.074329615e-01f,
-    1.835149527e-01f,
-    6.161793470e-01f,
-    8.470631838e-01f,
-    3.514281809e-01f,
-    8.879585266e-01f,
-    6.334106922e-01f,
-    1.204452324e+01f,
-    1.167408562e+01f,
-    5.235505581e+00f,
-    9.108064175e-01f,
-    1.062341332e+00f,
-    4.915710926e+00f,
-    4.009284496e+00f,
-    1.056375027e+00f,
-    2.748624086e+00f,
-    1.934982681e+01f,
-    1.355516529e+01f,
-    2.260228539e+01f,
-    9.403825998e-01f,
-    6.208062172e-01f,
-    9.195213318e-01f,
-    1.736895370e+01f,
-    1.574355125e+01f,
-    6.861196518e+00f,
-    1.345890164e+00f,
-    5.451908708e-01f,
-    7.283459902e-01f,
-    9.993874550e+00f,
-    1.151571274e+00f,
-    7.292400360e+00f,
-    1.056864166e+01f,
-    6.607938290e+00f,
-    4.363329411e+00f,
-    8.876729608e-01f,
-    5.062565207e-01f,
-    6.259172916e+00f,
-    8.363460541e+00f,
-    2.962881565e+00f,
-    4.765068889e-01f,
-    6.600096822e-01f,
-    5.207015514e+00f,
-    2.699871540e+00f,
-    9.269949794e-01f,
-    1.411725426e+01f,
-    2.867649078e+00f,
-    1.553501225e+01f,
-    5.484253883e+00f,
-    5.178100586e+00f,
-    1.111310863e+01f,
-    3.522703409e+00f,
-    1.616420507e+00f,
-    1.046541572e+00f,
-    1.088609457e+00f,
-    9.595695496e+00f,
-    2.332963705e+00f,
-    2.350596428e+01f,
-    2.507387733e+01f,
-    5.080897141e+01f,
-    1.261302948e+00f,
-    2.882205009e+00f,
-    2.364463806e+00f,
-    1.491756916e+01f,
-    1.936792374e+01f,
-    2.517669487e+01f,
-    5.833638906e-01f,
-    6.224812269e-01f,
-    1.143532634e+00f,
-    2.658650780e+01f,
-    6.820415020e+00f,
-    1.944076538e+01f,
-    1.715950775e+01f,
-    1.513478279e+00f,
-    4.333781433e+01f,
-    9.414899349e-01f,
-    1.361078835e+01f,
-    3.201403618e-01f,
-    4.377608871e+01f,
-    9.585655928e-01f,
-    2.842227221e+00f,
-    9.700505733e-01f,
-    5.800263286e-01f,
-    1.760474682e+00f,
-    3.574634790e-01f,
-    1.422943711e+00f,
-    1.579150558e-01f,
-    1.258572817e+00f,
-    2.639822483e+00f,
-    1.274841428e+00f,
-    1.136763334e+00f,
-    4.992412031e-01f,
-    1.513587311e-02f,
-    9.290586114e-01f,
-    7.838609219e-01f,
-    7.130291313e-02f,
-    9.527438134e-02f,
-    1.533507258e-01f,
-    2.105067492e+00f,
-    5.812893510e-01f,
-    6.787017822e+00f,
-    1.148794144e-01f,
-    1.219795465e+00f,
-    1.241682887e+00f,
-    2.327760220e+00f,
-    1.069298506e+00f,
-    1.214548796e-01f,
-    6.042382717e-01f,
-    1.255044699e+00f,
-    7.593746483e-02f,
-    5.653962493e-01f,
-    4.113022387e-01f,
-    1.457407475e+01f,
-    1.671337509e+01f,
-    1.802371407e+01f,
-    2.703770399e+00f,
-    7.998461127e-01f,
-    1.005889654e+00f,
-    1.504221344e+01f,
-    6.999747753e-01f,
-    2.682727575e+00f,
-    4.208930969e+00f,
-    1.952795982e+01f,
-    1.653023660e-01f,
-    4.261664748e-01f,
-    6.551822275e-02f,
-    2.868055999e-01f,
-    1.058632755e+01f,
-    8.523929715e-01f,
-    5.726097822e-01f,
-    1.056040645e+00f,
-    2.237939358e+00f,
-    1.654693604e+01f,
-    9.431638718e+00f,
-    1.567039847e+00f,
-    9.889444709e-01f,
-    8.608511090e-01f,
-    1.129498482e+01f,
-    6.263353229e-01f,
-    2.068655252e+00f,
-    2.160335541e+00f,
-    9.627750397e+00f,
-    4.799526691e+00f,
-    1.669229418e-01f,
-    2.799509168e-01f,
-    3.116869926e-01f,
-    3.650331125e-02f,
-    5.611180887e-02f,
-    2.552715130e-02f,
-    6.665611267e-01f,
-    1.015589809e+01f,
-    2.049493217e+01f,
-    8.563842177e-01f,
-    5.959368944e-01f,
-    7.797676325e-01f,
-    5.787286758e-01f,
-    9.787897766e-02f,
-    1.241662726e-01f,
-    4.140160680e-01f,
-    1.639557266e+01f,
-    7.254323006e+00f,
-    1.565756035e+01f,
-    4.510345459e+00f,
-    5.226319790e+00f,
-    3.298273325e+00f,
-    1.161340942e+02f,
-    1.587352657e+01f,
-    1.429193878e+02f,
-    2.737519455e+01f,
-    4.887968063e+00f,
-    1.271071911e+01f,
-    1.263078785e+01f,
-    8.652152061e+00f,
-    7.586908340e+00f,
-    1.848745346e+01f,
-    6.744346619e+00f,
-    2.155967903e+01f,
-    1.640578651e+01f,
-    1.241108131e+01f,
-    3.121478081e+01f,
-    4.214495182e+00f,
-    1.180374050e+01f,
-    6.576365471e+00f,
-    2.282089806e+01f,
-    7.625235081e+00f,
-    4.510431290e+01f,
-    4.016285419e+00f,
-    2.476576805e+01f,
-    2.096076584e+01f,
-    1.672466087e+01f,
-    9.565173388e-01f,
-    6.973801851e-01f,
-    1.173030853e+00f,
-    3.963563156e+01f,
-    1.457918584e-01f,
-    2.516291857e+00f,
-    1.359830666e+01f,
-    2.226946449e+01f,
-    3.027428246e+01f,
-    1.159178019e+00f,
-    1.001870930e-01f,
-    5.083502531e-01f,
-    6.510737538e-01f,
-    7.224497944e-02f,
-    3.068460524e-01f,
-    1.401232338e+01f,
-    2.339116287e+01f,
-    3.479295349e+01f,
-    6.094257832e-01f,
-    4.714672863e-01f,
-    6.192383170e-01f,
-    4.548796177e+00f,
-    1.224948987e-01f,
-    4.035812020e-01f,
-    7.227737904e-01f,
-    2.728725815e+01f,
-    1.439767933e+01f,
-    6.114877701e+01f,
-    1.782914042e+00f,
-    7.889571190e-01f,
-    1.345182776e+00f,
-    9.688876343e+01f,
-    8.063117981e+00f,
-    3.566054077e+02f,
-    2.261455345e+01f,
-    5.766068459e+00f,
-    4.744527435e+01f,
-    3.649536371e-01f,
-    3.317199647e-02f,
-    8.672481775e-02f,
-    5.071717072e+01f,
-    1.164946318e+00f,
-    1.103599472e+02f,
-    1.598314381e+01f,
-    2.380878067e+01f,
-    2.059420319e+02f,
-    9.539756179e-01f,
-    1.649923325e-01f,
-    3.569454253e-01f,
-    8.086177063e+01f,
-    6.062148094e+00f,
-    2.270862061e+03f,
-    7.244533300e-01f,
-    1.263492834e-02f,
-    1.786917597e-01f,
-    5.308910087e-02f,
-    6.543114471e+01f,
-    1.699993515e+01f,
-    4.649988556e+01f,
-    3.145393729e-01f,
-    2.335015535e+00f,
-    4.362232387e-01f,
-    8.830197334e+00f,
-    3.230504036e+00f,
-    1.077005959e+01f,
-    1.234719563e+01f,
-    1.293544674e+01f,
-    1.011174679e+01f,
-    9.021120071e+00f,
-    4.538093567e+00f,
-    1.313097954e+01f,
-    4.178258777e-02f,
-    3.535184860e-01f,
-    9.268712252e-02f,
-    1.168746662e+01f,
-    9.130843163e+00f,
-    1.342316532e+01f,
-    7.138447762e+00f,
-    2.474661827e+00f,
-    5.232540131e+00f,
-    6.961271763e+00f,
-    1.183219552e+00f,
-    8.601246476e-01f,
-    2.842231095e-01f,
-    1.128126144e+00f,
-    2.848026752e-01f,
-    5.593423247e-01f,
-    1.084332752e+01f,
-    3.032900393e-02f,
-    1.709796637e-01f,
-    1.377659035e+01f,
-    1.341048241e+01f,
-    8.297144890e+00f,
-    6.772809029e-01f,
-    2.096405029e-01f,
-    1.227422357e+00f,
-    3.154395223e-01f,
-    2.011653222e-02f,
-    6.129318476e-02f,
-    3.652954340e+00f,
-    5.182006359e+00f,
-    3.019170284e+00f,
-    8.559756279e-01f,
-    4.541998804e-01f,
-    7.997643352e-01f,
-    6.960152984e-01f,
-    1.934629120e-02f,
-    1.512735151e-02f,
-    1.746169627e-01f,
-    5.815370008e-02f,
-    4.409743547e-01f,
-    5.783469975e-02f,
-    4.573075175e-01f,
-    2.588308454e-01f,
-    3.027645051e-01f,
-    4.431057870e-01f,
-    4.777070880e-01f,
-    1.077546835e+00f,
-    6.632624149e+00f,
-    2.595318079e+00f,
-    6.227509499e+00f,
-    1.968695670e-01f,
-    2.900386602e-02f,
-    4.312158376e-02f,
-    2.149077225e+01f,
-    2.518075705e-01f,
-    7.409899712e+00f,
-    5.139041543e-01f,
-    1.357832193e+00f,
-    3.894761205e-01f,
-    2.728841305e-01f,
-    5.510720983e-02f,
-    8.303389698e-02f,
-    9.480375290e+00f,
-    6.449012756e-01f,
-    9.946230054e-01f,
-    4.185805563e-03f,
-    1.130683064e+00f,
-    1.691975212e+01f,
-    2.336647749e+00f,
-    2.955911398e+00f,
-    9.300613403e+00f,
-    4.440809250e+00f,
-    3.142067909e+00f,
-    1.570401192e+00f,
-    4.411134243e+00f,
-    9.032433033e-01f,
-    2.816893816e+00f,
-    1.188220501e+00f,
-    7.070170045e-01f,
-    5.965792537e-01f,
-    9.968342632e-02f,
-    3.195391297e-01f,
-    1.353937745e+00f,
-    4.002545476e-01f,
-    6.016265154e-01f,
-    6.588976383e+00f,
-    1.565535903e+00f,
-    5.703483820e-01f,
-    1.627969265e+00f,
-    1.690808684e-01f,
-    3.872656524e-01f,
-    2.302131414e+00f,
-    1.828935266e+00f,
-    4.547188759e+00f,
-    1.226685333e+01f,
-    1.178778267e+01f,
-    1.394348526e+01f,
-    1.162662745e+00f,
-    2.083922148e+00f,
-    9.733791947e-01f,
-    1.036273098e+01f,
-    1.776639372e-01f,
-    1.185991406e+00f,
-    4.577721119e+00f,
-    8.738192558e+00f,
-    6.704246998e+00f,
-    1.499351263e+00f,
-    6.149072051e-01f,
-    6.059690118e-01f,
-    6.323573589e-01f,
-    5.874102563e-02f,
-    1.204463392e-01f,
-    1.105486584e+01f,
-    7.258666039e+00f,
-    1.591916561e+01f,
-    2.949899197e+00f,
-    8.290398121e-01f,
-    7.204304934e-01f,
-    2.185801744e+00f,
-    1.602388769e-01f,
-    1.631443053e-01f,
-    6.561201215e-01f,
-    1.347187996e+01f,
-    2.990533638e+01f,
-    3.205057907e+01f,
-    1.360391498e+00f,
-    3.586420119e-01f,
-    6.030440927e-01f,
-    3.714268494e+01f,
-    1.689777756e+01f,
-    3.302438660e+02f,
-    6.140258789e+00f,
-    1.739929390e+01f,
-    1.831529045e+01f,
-    5.801724195e-01f,
-    9.664107114e-03f,
-    2.001194283e-02f,
-    8.262273788e+00f,
-    3.975860476e-01f,
-    4.464184940e-01f,
-    8.859986305e+00f,
-    1.671343994e+01f,
-    7.977262878e+01f,
-    1.003409386e+00f,
-    6.119040772e-02f,
-    1.201582253e-01f,
-    1.237719059e+01f,
-    2.081523895e+00f,
-    3.900388336e+01f,
-    1.113756672e-01f,
-    9.740791321e+00f,
-    8.771978021e-01f,
-    2.042553520e+01f,
-    6.714701653e+00f,
-    2.642642260e-01f,
-    1.152876951e-02f,
-    1.394364357e+00f,
-    1.033641338e+00f,
-    6.935129315e-02f,
-    3.333175778e-01f,
-    2.521582320e-02f,
-    9.274433255e-01f,
-    4.933062196e-01f,
-    3.526262045e+00f,
-    6.165660620e-01f,
-    4.283206165e-02f,
-    1.909933090e-01f,
-    6.337806582e-01f,
-    1.875228286e-01f,
-    5.749828368e-02f,
-    2.356974185e-01f,
-    1.152297407e-01f,
-    1.015795171e-01f,
-    3.837430954e+01f,
-    2.033821716e+02f,
-    6.909044647e+01f,
-    4.096787870e-01f,
-    2.178889275e+00f,
-    2.714227140e-01f,
-    2.762000263e-01f,
-    4.502349794e-01f,
-    1.138291626e+02f,
-    5.655868530e+01f,
-    7.276346684e+00f,
-    3.572539806e+00f,
-    2.979157865e-01f,
-    1.300805664e+02f,
-    8.018738627e-01f,
-    6.661364436e-02f,
-    1.606136322e+01f,
-    1.654871559e+01f,
-    8.344045639e+00f,
-    7.739860058e+00f,
-    1.591989422e+01f,
-    1.822194672e+01f,
-    1.671919441e+01f,
-    2.439062500e+01f,
-    2.808023834e+01f,
-    7.108148098e+00f,
-    1.552701473e+01f,
-    1.261880875e+01f,
-    1.550636387e+01f,
-    2.160535240e+01f,
-    1.666776085e+01f,
-    9.784718513e+00f,
-    1.773122406e+01f,
-    2.624466515e+01f,
-    1.718733406e+01f,
-    1.418889809e+01f,
-    3.005763435e+01f,
-    3.819010019e+00f,
-    9.183405876e+00f,
-    1.303200245e+01f,
-    7.688519287e+01f,
-    2.746560287e+01f,
-    3.276353836e+01f,
-    3.921292067e+00f,
-    5.350560546e-01f,
-    8.157831430e-01f,
-    4.906408787e-01f,
-    1.089517975e+02f,
-    8.284660339e+01f,
-    1.380913086e+02f,
-    1.276066661e+00f,
-    1.413962746e+01f,
-    2.937130213e+00f,
-    4.777168632e-01f,
-    1.395297289e+00f,
-    9.166672230e-01f,
-    4.863566971e+01f,
-    3.735956573e+01f,
-    1.410150146e+02f,
-    6.473020077e+00f,
-    7.002272797e+01f,
-    2.507553291e+01f,
-    4.311327338e-01f,
-    1.500322342e+00f,
-    3.095066249e-01f,
-    1.243823090e+02f,
-    3.476737976e+01f,
-    1.725232849e+02f,
-    1.206372499e+00f,
-    3.161614418e+01f,
-    8.322312355e+00f,
-    4.210348427e-01f,
-    4.858089447e+00f,
-    1.614560127e+01f,
-    1.098293304e+01f,
-    1.329167008e+00f,
-    1.278176665e+00f,
-    6.916627884e-01f,
-    1.297614574e+01f,
-    1.510159874e+01f,
-    2.100535393e+01f,
-    2.202088833e+00f,
-    7.691531181e+00f,
-    6.301067472e-01f,
-    1.355376244e+01f,
-    1.244512177e+01f,
-    1.747332764e+01f,
-    9.130083323e-01f,
-    8.004540801e-01f,
-    8.226748705e-01f,
-    4.378411865e+01f,
-    2.465863228e+01f,
-    4.046167755e+01f,
-    1.520922470e+01f,
-    2.260434532e+01f,
-    1.851006126e+01f,
-    7.570836544e-01f,
-    2.540572882e-01f,
-    2.102233768e-01f,
-    1.873929405e+01f,
-    2.615840721e+01f,
-    2.805303764e+01f,
-    2.438294983e+01f,
-    1.428351784e+01f,
-    2.347103119e+01f,
-    4.817077219e-01f,
-    2.632492185e-01f,
-    3.062057495e-01f,
-    2.422084045e+01f,
-    2.710321426e+01f,
-    9.595460510e+01f,
-    1.005141854e+00f,
-    4.660075903e-01f,
-    4.317056656e+00f,
-    1.736462116e+00f,
-    1.901958275e+01f,
-    2.874875450e+01f,
-    4.354067993e+01f,
-    5.635755062e+00f,
-    4.788614273e+01f,
-    4.932973862e+01f,
-    2.254802227e+00f,
-    5.887856483e+00f,
-    1.315260506e+01f,
-    3.646191788e+01f,
-    5.507897568e+01f,
-    2.041945496e+02f,
-    2.670983553e+00f,
-    1.498027954e+02f,
-    7.234483643e+02f,
-    3.298082590e+00f,
-    7.644820213e-01f,
-    8.131393790e-01f,
-    4.654075503e-01f,
-    2.685556984e+01f,
-    6.157461929e+01f,
-    3.434922028e+01f,
-    7.765235901e-01f,
-    9.945232272e-01f,
-    4.792971909e-01f,
-    4.777385890e-01f,
-    7.384060025e-01f,
-    2.528152168e-01f,
-    4.090665436e+01f,
-    5.067063904e+01f,
-    7.093125153e+01f,
-    2.609771013e+00f,
-    3.585399866e+00f,
-    1.032681942e+00f,
-    3.891958594e-01f,
-    7.380578518e-01f,
-    3.864106834e-01f,
-    4.281124878e+01f,
-    6.888241577e+01f,
-    1.390435638e+02f,
-    6.176134348e-01f,
-    2.401855230e+00f,
-    9.590441585e-01f,
-    4.080778062e-01f,
-    1.375919431e-01f,
-    8.554909378e-02f,
-    4.102762938e-01f,
-    1.102932968e+02f,
-    1.976925015e+00f,
-    3.942463303e+01f,
-    4.380567968e-01f,
-    3.269491196e-01f,
-    6.018287539e-01f,
-    9.799341857e-02f,
-    2.181031704e+00f,
-    6.952260733e-01f,
-    2.009792900e+01f,
-    1.503394127e+00f,
-    2.447783470e+01f,
-    1.273836136e+00f,
-    1.746714592e+01f,
-    3.457952976e+00f,
-    1.730081290e-01f,
-    1.330847740e-01f,
-    4.668461382e-01f,
-    8.351644897e+01f,
-    9.913887382e-01f,
-    1.045101700e+02f,
-    1.113279581e+00f,
-    7.512388825e-01f,
-    1.464213133e+00f,
-    2.195561230e-01f,
-    3.683912659e+01f,
-    6.454667091e+00f,
-    1.470974159e+01f,
-    7.788893700e+00f,
-    2.105268860e+01f,
-    6.272487164e+00f,
-    3.251362228e+01f,
-    1.852027130e+01f,
-    5.035060501e+01f,
-    2.437659073e+01f,
-    7.154221058e+00f,
-    1.424244213e+01f,
-    2.322130203e+01f,
-    5.436397934e+01f,
-    3.917519760e+01f,
-    4.066283035e+01f,
-    3.256653976e+01f,
-    4.271352768e+01f,
-    1.964599228e+01f,
-    6.660053730e+00f,
-    1.959735298e+01f,
-    1.323544121e+01f,
-    2.755484962e+01f,
-    2.925051498e+01f,
-    3.017120552e+01f,
-    1.854979134e+01f,
-    2.430944633e+01f,
-    3.672656536e+00f,
-    3.472348404e+01f,
-    1.096237850e+01f,
-    3.236927032e+01f,
-    4.043702698e+01f,
-    2.436867237e+00f,
-    1.798581362e+00f,
-    9.173323059e+01f,
-    1.655630112e+01f,
-    3.688054504e+02f,
-    4.567839813e+01f,
-    1.722696877e+01f,
-    3.097414017e+01f,
-    8.433981323e+02f,
-    3.809085190e-01f,
-    3.289594650e-01f,
-    1.398968811e+02f,
-    9.557194710e-01f,
-    2.396217346e+02f,
-    2.202117157e+01f,
-    1.814723778e+01f,
-    7.008980560e+01f,
-    3.126156921e+02f,
-    7.954190373e-01f,
-    2.843852639e-01f,
-    1.056782837e+02f,
-    2.459378004e+00f,
-    3.226794739e+02f,
-    4.676360474e+02f,
-    5.484973788e-01f,
-    9.156626463e-01f,
-    6.165447831e-01f,
-    5.614975357e+01f,
-    3.043057060e+01f,
-    5.801938629e+01f,
-    1.467750549e+00f,
-    1.341483712e+00f,
-    1.702916145e+00f,
-    1.502945423e+00f,
-    1.181314230e+00f,
-    2.438830614e+00f,
-    7.151194763e+01f,
-    4.746173477e+01f,
-    4.607632065e+01f,
-    2.788596725e+01f,
-    7.471113586e+01f,
-    4.974081421e+01f,
-    2.204989433e+00f,
-    1.435797811e+00f,
-    1.869638681e+00f,
-    5.548177719e+01f,
-    1.558843994e+02f,
-    1.311100616e+02f,
-    2.795213699e+00f,
-    1.627433968e+01f,
-    3.379610062e+00f,
-    9.175653458e-01f,
-    4.663493037e-01f,
-    1.210848570e+00f,
-    6.608043909e-01f,
-    1.073081894e+02f,
-    1.364381790e+00f,
-    3.806779099e+01f,
-    1.507456660e+00f,
-    1.285753608e+00f,
-    8.318060875e+00f,
-    5.578040123e+00f,
-    2.119953394e+00f,
-    3.282289505e+00f,
-    5.893786240e+01f,
-    9.101586938e-01f,
-    2.537727356e+01f,
-    1.511727295e+02f,
-    3.076132298e+00f,
-    3.089596252e+02f,
-    1.278108478e+00f,
-    1.603944540e+00f,
-    5.304089546e+00f,
-    2.220430145e+02f,
-    4.130083323e-01f,
-    8.315146637e+01f,
-    5.122954941e+01f,
-    3.171342611e+00f,
-    1.805262299e+02f,
-    1.057833290e+01f,
-    3.389053792e-02f,
-    9.794660658e-02f,
-    9.007504582e-02f,
-    3.306436157e+01f,
-    2.374956322e+01f,
-    4.244395447e+01f,
-    1.571433991e-01f,
-    4.223730862e-01f,
-    1.080750078e-01f,
-    8.872722089e-02f,
-    4.361919761e-01f,
-    8.217824996e-02f,
-    1.646129799e+01f,
-    1.905615807e+01f,
-    1.965507126e+01f,
-    6.301258206e-01f,
-    2.748729229e+00f,
-    8.520594835e-01f,
-    9.058636427e-02f,
-    1.690799147e-01f,
-    1.224694028e-01f,
-    2.216863823e+01f,
-    1.682061768e+01f,
-    1.175287628e+02f,
-    7.698994130e-02f,
-    1.084902048e+00f,
-    1.309415102e-01f,
-    1.890180707e-01f,
-    1.555101752e+00f,
-    5.885027647e-01f,
-    3.538321257e-01f,
-    5.663749695e+00f,
-    6.768916249e-01f,
-    2.437307835e+00f,
-    4.444005966e+00f,
-    4.472514391e-01f,
-    4.991947711e-01f,
-    1.482503319e+01f,
-    5.724879265e+00f,
-    1.524192047e+01f,
-    1.300662994e+01f,
-    8.428689241e-01f,
-    4.423092842e+00f,
-    1.231558990e+01f,
-    5.164475441e+00f,
-    8.406463623e+00f,
-    3.734252214e+00f,
-    1.180122852e+00f,
-    5.341311693e-01f,
-    8.254006386e+00f,
-    1.945199370e-01f,
-    7.742059827e-01f,
-    7.452888489e+00f,
-    5.591692328e-01f,
-    2.277681589e+00f,
-    4.655499458e+00f,
-    1.553765684e-01f,
-    1.270215273e+00f,
-    2.262731045e-01f,
-    1.693688049e+02f,
-    7.670349121e+01f,
-    2.966532593e+02f,
-    4.570742249e-01f,
-    3.467721939e+00f,
-    1.386721492e+00f,
-    4.884703457e-01f,
-    2.890325069e+00f,
-    1.178600907e+00f,
-    1.969846153e+01f,
-    4.856835938e+01f,
-    2.005825043e+02f,
-    4.519112110e+00f,
-    2.209337425e+01f,
-    1.826543427e+01f,
-    1.566805989e-01f,
-    9.041155577e-01f,
-    3.524923921e-01f,
-    3.389979248e+02f,
-    1.946349144e+01f,
-    5.939230347e+02f,
-    9.802850485e-01f,
-    2.254602623e+01f,
-    4.646935940e+00f,
-    6.519907713e-01f,
-    5.831074238e+00f,
-    1.315678024e+01f,
-    1.028546906e+01f,
-    3.885418415e+00f,
-    6.774088383e+00f,
-    7.827464581e+00f,
-    1.106427860e+01f,
-    7.078879833e+00f,
-    3.594992828e+01f,
-    7.354474068e+00f,
-    7.606198788e+00f,
-    1.156984234e+01f,
-    1.527205086e+01f,
-    9.909437180e+00f,
-    8.047939301e+00f,
-    1.063578987e+01f,
-    1.529343510e+01f,
-    2.583485413e+01f,
-    2.829393625e+00f,
-    9.195276260e+00f,
-    9.883928299e+00f,
-    8.827473640e+00f,
-    8.074548721e+00f,
-    1.736069870e+01f,
-    1.173131084e+01f,
-    6.100715637e+00f,
-    1.869666481e+01f,
-    1.335809708e+00f,
-    1.244181347e+01f,
-    1.646777534e+01f,
-    1.318248940e+01f,
-    1.157178879e+00f,
-    4.038616121e-01f,
-    9.479004741e-01f,
-    2.557517052e+01f,
-    2.303745079e+01f,
-    1.322862625e+01f,
-    3.511926532e-01f,
-    2.254086733e+00f,
-    1.025666118e+00f,
-    1.293128967e+01f,
-    9.532054901e+00f,
-    3.303827667e+01f,
-    1.018012524e+00f,
-    8.102813363e-01f,
-    3.209623098e-01f,
-    5.993216038e+00f,
-    2.638311958e+01f,
-    1.674423027e+01f,
-    7.590882182e-01f,
-    1.232682943e+00f,
-    7.019175887e-01f,
-    5.283716583e+01f,
-    4.144807053e+01f,
-    2.605198975e+02f,
-    1.278544807e+01f,
-    1.533090973e+01f,
-    1.808956909e+01f,
-    1.818501204e-01f,
-    1.572787017e-01f,
-    9.839048237e-02f,
-    1.758488846e+01f,
-    2.988443184e+01f,
-    5.053194809e+01f,
-    7.790771484e+00f,
-    2.042023849e+01f,
-    6.466150665e+01f,
-    5.971425176e-01f,
-    3.749091923e-01f,
-    2.584802806e-01f,
-    1.883484268e+01f,
-    3.444083023e+01f,
-    1.398021851e+02f,
-    3.722387552e-01f,
-    2.631069422e-01f,
-    2.825861871e-01f,
-    2.172385603e-01f,
-    5.648424530e+01f,
-    3.287517166e+01f,
-    8.007858276e+01f,
-    3.280980289e-01f,
-    1.966996670e+00f,
-    7.540489435e-01f,
-    4.882091880e-01f,
-    1.378634572e+00f,
-    1.531751752e+00f,
-    2.618272209e+01f,
-    2.165736389e+01f,
-    1.714584160e+01f,
-    1.110961246e+01f,
-    3.056211472e+01f,
-    3.961677551e+01f,
-    1.737214029e-01f,
-    6.474138498e-01f,
-    4.798947573e-01f,
-    1.217967148e+02f,
-    7.310371399e+01f,
-    1.536290131e+02f,
-    3.377126157e-01f,
-    2.107464600e+01f,
-    1.431572533e+01f,
-    5.664798617e-01f,
-    3.362758160e+00f,
-    1.003718495e+00f,
-    1.356301665e+00f,
-    1.353419781e+00f,
-    2.763754129e-01f,
-    4.460156560e-01f,
-    1.397933197e+01f,
-    1.094317794e+00f,
-    3.683248520e+00f,
-    6.070510387e+00f,
-    1.531836319e+01f,
-    1.649954987e+01f,
-    2.736128867e-01f,
-    1.717152297e-01f,
-    1.447125822e-01f,
-    8.479698181e+00f,
-    2.781198621e-01f,
-    2.539617062e+00f,
-    4.601780891e+00f,
-    3.949069500e+00f,
-    3.374854565e+00f,
-    6.926614046e-01f,
-    2.303338796e-01f,
-    2.344134897e-01f,
-    2.101898193e+01f,
-    1.006373167e+00f,
-    4.489139080e+00f,
-    1.517984271e-01f,
-    3.359626830e-01f,
-    4.054818630e+00f,
-    9.573020339e-01f,
-    1.230617752e+02f,
-    2.316859055e+01f,
-    2.631607056e+02f,
-    1.125616074e+00f,
-    6.468056488e+01f,
-    2.568565941e+01f,
-    1.585865259e+00f,
-    5.605365276e+00f,
-    1.654238129e+01f,
-    5.122956085e+01f,
-    6.724282742e+00f,
-    3.018718529e+01f,
-    3.352656555e+01f,
-    9.534203339e+01f,
-    1.842583923e+02f,
-    5.051562786e-01f,
-    2.880066633e+00f,
-    2.375412226e+00f,
-    1.906999817e+02f,
-    1.296134758e+01f,
-    5.119506836e+02f,
-    2.202872658e+01f,
-    6.590374146e+02f,
-    8.623664093e+01f,
-    1.050599098e+00f,
-    1.650643200e-01f,
-    2.145375252e+01f,
-    1.485299826e+00f,
-    5.014835596e-01f,
-    8.352596283e+01f,
-    2.032863235e+01f,
-    5.336509943e-01f,
-    8.495268822e+00f,
-    2.897254944e+00f,
-    2.372488379e-01f,
-    2.704796410e+01f,
-    1.757299453e-01f,
-    1.741935349e+01f,
-    2.799462128e+01f,
-    2.945490360e+00f,
-    1.372581601e+00f,
-    1.239421368e+00f,
-    1.187744617e+00f,
-    9.976610184e+00f,
-    1.783835888e+00f,
-    2.843679190e-01f,
-    7.672033310e+00f,
-    1.111316323e+00f,
-    6.830686927e-01f,
-    7.583193779e+00f,
-    9.363415651e-03f,
-    3.082568645e-01f,
-    5.478670597e-01f,
-    4.459486902e-01f,
-    1.960321808e+01f,
-    1.496539688e+01f,
-    1.636204910e+01f,
-    3.645848930e-01f,
-    9.738191366e-01f,
-    3.246921897e-01f,
-    1.157259107e+00f,
-    5.551940203e-01f,
-    3.115897655e+00f,
-    1.547132301e+01f,
-    1.206467986e+00f,
-    6.044005156e-01f,
-    1.074146152e+00f,
-    3.643655396e+01f,
-    4.480333328e-01f,
-    7.767210007e-01f,
-    1.407906342e+01f,
-    1.190198326e+01f,
-    2.852469206e+00f,
-    5.870173931e+00f,
-    8.998052597e+00f,
-    9.845664024e+00f,
-    1.604367638e+01f,
-    1.393622971e+01f,
-    6.527730465e+00f,
-    5.427303314e+00f,
-    3.971228123e+00f,
-    3.974965572e+00f,
-    5.214243412e+00f,
-    8.694968224e+00f,
-    1.081341839e+01f,
-    4.212537289e+00f,
-    4.013800144e+00f,
-    3.757410765e+00f,
-    1.449391174e+01f,
-    7.754427910e+00f,
-    5.029047489e+00f,
-    3.479594231e+00f,
-    4.350008488e+00f,
-    1.077120781e+01f,
-    6.932103634e+00f,
-    7.639091492e+00f,
-    9.931366920e+00f,
-    3.938697577e+00f,
-    1.382156014e-01f,
-    7.049402595e-01f,
-    1.639574766e-01f,
-    1.380563354e+01f,
-    1.052654266e+01f,
-    8.383642197e+00f,
-    1.390978813e+00f,
-    2.679303169e+00f,
-    1.291633248e+00f,
-    1.037415862e+00f,
-    5.390688181e-01f,
-    8.421996236e-01f,
-    3.150359154e+00f,
-    5.350036621e+00f,
-    4.388735294e+00f,
-    4.231752396e+00f,
-    2.478859901e+00f,
-    2.287525654e+00f,
-    3.852685094e-01f,
-    1.089321375e+00f,
-    3.401741385e-01f,
-    7.208762646e+00f,
-    4.317111492e+00f,
-    1.585391617e+01f,
-    4.437499046e+00f,
-    4.184302807e+00f,
-    3.283485889e+00f,
-    5.770524740e-01f,
-    9.090724945e+00f,
-    1.528372860e+01f,
-    1.218924618e+01f,
-    1.860888600e+00f,
-    5.795575976e-01f,
-    1.014229536e+00f,
-    1.231201649e+01f,
-    9.650400281e-01f,
-    5.296495914e+00f,
-    9.072889328e+00f,
-    2.089175415e+01f,
-    2.524848878e-01f,
-    5.149646997e-01f,
-    8.271674812e-02f,
-    3.009011149e-01f,
-    1.909275818e+01f,
-    1.334452033e+00f,
-    1.062006712e+00f,
-    6.304392219e-01f,
-    1.448456764e+01f,
-    4.522555828e+00f,
-    4.929309464e+01f,
-    1.055608630e+00f,
-    7.663269639e-01f,
-    8.936251998e-01f,
-    1.597946739e+01f,
-    5.056758404e+00f,
-    3.321966934e+01f,
-    1.839854431e+01f,
-    4.780263424e+00f,
-    3.571221924e+01f,
-    3.421760499e-01f,
-    4.053812101e-02f,
-    7.076323032e-02f,
-    1.892838478e+01f,
-    1.691206336e+00f,
-    1.713604546e+01f,
-    9.975128174e+00f,
-    3.013204098e+00f,
-    9.456309509e+01f,
-    1.615257025e+00f,
-    1.108787060e-01f,
-    2.621771097e-01f,
-    5.587601471e+01f,
-    1.138136101e+01f,
-    3.040269470e+02f,
-    5.735849142e-01f,
-    1.208795428e+00f,
-    2.482914448e+00f,
-    1.160898566e+00f,
-    3.475791693e+00f,
-    5.719114304e+00f,
-    7.327021122e+00f,
-    1.509567642e+01f,
-    1.756816292e+01f,
-    3.665693359e+02f,
-    1.076882362e+00f,
-    4.053454399e+00f,
-    6.705222130e-01f,
-    1.038108587e+00f,
-    6.179848194e+00f,
-    3.207139893e+02f,
-    6.907841682e+00f,
-    6.263479614e+01f,
-    2.402640625e+03f,
-    1.080274224e+00f,
-    8.081897162e-03f,
-    4.965827614e-02f,
-    4.881054163e-02f,
-    1.638010788e+01f,
-    2.670754814e+01f,
-    1.357143402e+01f,
-    1.799031906e-02f,
-    1.871174425e-01f,
-    2.405112237e-02f,
-    8.307909220e-02f,
-    4.249718189e-01f,
-    1.495894492e-01f,
-    1.805810738e+01f,
-    6.415126801e+00f,
-    9.172690392e+00f,
-    1.209097952e-01f,
-    1.211781979e+00f,
-    1.976248473e-01f,
-    8.523730934e-02f,
-    2.052457780e-01f,
-    1.735569388e-01f,
-    9.914033890e+00f,
-    9.498842239e+00f,
-    1.739471817e+01f,
-    3.329489753e-02f,
-    5.786691308e-01f,
-    6.346715987e-02f,
-    5.546166897e-01f,
-    1.289511776e+01f,
-    6.181265831e+00f,
-    5.386492729e+00f,
-    2.114132881e+00f,
-    6.008090019e+00f,
-    1.307631683e+01f,
-    6.630185604e+00f,
-    3.383596897e+00f,
-    6.287689209e+00f,
-    6.209868908e+00f,
-    4.403920174e+00f,
-    4.022752762e+00f,
-    5.703551769e+00f,
-    1.515171766e+00f,
-    8.820722580e+00f,
-    4.472441673e+00f,
-    4.866062164e+00f,
-    6.931989670e+00f,
-    5.465878963e+00f,
-    4.337894440e+00f,
-    5.369028568e+00f,
-    3.717990398e+00f,
-    4.913819134e-01f,
-    5.567090034e+00f,
-    6.236122131e+00f,
-    3.289867878e+00f,
-    1.148950958e+01f,
-    1.631050706e+00f,
-    1.413920522e-02f,
-    7.121011019e-01f,
-    4.350593686e-02f,
-    5.426327133e+01f,
-    2.670948410e+01f,
-    4.573299026e+01f,
-    1.525158525e+00f,
-    9.385773659e+00f,
-    9.253947258e+00f,
-    2.402162105e-01f,
-    6.301351786e-01f,
-    5.926674604e-01f,
-    1.230995369e+01f,
-    2.047571754e+01f,
-    1.874758720e+01f,
-    2.168989897e+00f,
-    7.573422432e+00f,
-    8.569047928e+00f,
-    9.004423022e-02f,
-    6.224855781e-01f,
-    1.857731342e-01f,
-    2.242725372e+01f,
-    1.545692921e+01f,
-    1.142351303e+02f,
-    1.022331238e+00f,
-    1.550046825e+01f,
-    6.772927284e+00f,
-    9.306018949e-01f,
-    5.882223248e-01f,
-    1.920886040e+01f,
-    1.167444706e+00f,
-    1.151341534e+01f,
-    1.176323414e+01f,
-    1.362399197e+01f,
-    1.280870795e+00f,
-    3.776009560e+00f,
-    3.516558409e+00f,
-    3.510286510e-01f,
-    5.554327488e+00f,
-    6.498844624e-01f,
-    4.005702734e-01f,
-    6.719432473e-01f,
-    1.121544465e-01f,
-    2.116259634e-01f,
-    1.016277194e+00f,
-    1.793671697e-01f,
-    1.392569095e-01f,
-    1.129369545e+01f,
-    3.225478828e-01f,
-    7.744678259e-01f,
-    1.039975047e+00f,
-    1.575279683e-01f,
-    1.373966634e-01f,
-    1.190711975e+00f,
-    3.559777439e-01f,
-    5.073725224e+00f,
-    1.372999859e+01f,
-    4.296220779e+00f,
-    1.128443623e+01f,
-    7.934802771e-01f,
-    1.190630078e+00f,
-    6.697956324e-01f,
-    1.357672882e+01f,
-    2.618871331e-01f,
-    2.167352438e+00f,
-    1.850769615e+01f,
-    7.701737404e+00f,
-    2.200428200e+01f,
-    7.561531663e-01f,
-    7.533785105e-01f,
-    1.294510961e+00f,
-    4.531370699e-01f,
-    6.237996742e-02f,
-    8.085158467e-02f,
-    2.371138000e+01f,
-    2.393286705e+01f,
-    5.244754791e+01f,
-    1.605377793e+00f,
-    4.528132081e-01f,
-    6.953219175e-01f,
-    3.965588570e+00f,
-    6.916316599e-02f,
-    6.228969619e-02f,
-    8.503150940e-01f,
-    1.140996552e+01f,
-    2.495474815e+01f,
-    1.556418514e+01f,
-    3.320025206e+00f,
-    4.973861873e-01f,
-    6.656186581e-01f,
-    1.508373260e+01f,
-    4.428750515e+00f,
-    6.251079559e+01f,
-    3.170870066e+00f,
-    2.892301369e+01f,
-    1.382709122e+01f,
-    1.900271326e-01f,
-    1.233319193e-02f,
-    2.013214491e-02f,
-    3.852519989e+00f,
-    2.601166368e-01f,
-    3.027175665e-01f,
-    2.186521053e+00f,
-    2.120836449e+01f,
-    2.507595825e+01f,
-    6.193673611e-01f,
-    5.813186616e-02f,
-    3.221174702e-02f,
-    1.161582375e+01f,
-    1.618723273e+00f,
-    2.544008255e+01f,
-    3.686687723e-02f,
-    1.999907941e-02f,
-    7.996553928e-02f,
-    4.132867604e-02f,
-    2.442373991e+00f,
-    2.489051580e+00f,
-    3.166336536e+00f,
-    7.449062914e-02f,
-    9.538698792e-01f,
-    1.354259700e-01f,
-    2.254303694e-01f,
-    4.931892455e-01f,
-    4.715447724e-01f,
-    5.371105671e-01f,
-    1.021727085e+00f,
-    4.014141858e-01f,
-    1.859608591e-01f,
-    1.762010813e+00f,
-    2.507833540e-01f,
-    9.424145520e-02f,
-    2.259057760e-01f,
-    8.875115216e-02f,
-    7.086105943e-01f,
-    8.301650286e-01f,
-    5.979454517e-01f,
-    8.481923491e-02f,
-    1.102905393e+00f,
-    1.520539522e-01f,
-    9.082290530e-02f,
-    6.693553448e+00f,
-    5.994853020e+00f,
-    4.922905445e+00f,
-    1.173704982e+00f,
-    3.722532094e-01f,
-    8.655942678e-01f,
-    1.582072926e+01f,
-    3.591389418e+00f,
-    1.346987247e+01f,
-    4.637544155e+00f,
-    6.701846600e+00f,
-    2.519049835e+01f,
-    7.919339091e-02f,
-    7.188557088e-02f,
-    8.272765577e-02f,
-    6.976041317e+00f,
-    5.263707638e-01f,
-    1.319091916e+00f,
-    6.130654907e+01f,
-    1.070461369e+01f,
-    8.230535126e+01f,
-    5.275976062e-01f,
-    1.020053402e-01f,
-    1.064725146e-01f,
-    1.194619141e+02f,
-    1.500498772e+00f,
-    3.102658691e+02f,
-    2.132468671e-01f,
-    1.021405980e-01f,
-    2.619050503e+00f,
-    7.294650674e-01f,
-    3.007849693e+01f,
-    2.724902868e+00f,
-    1.067344856e+01f,
-    1.719230652e+00f,
-    4.726611710e+01f,
-    1.338448524e+01f,
-    1.084662914e+00f,
-    2.042887449e+00f,
-    2.754096508e+00f,
-    2.832891226e+00f,
-    2.957497537e-01f,
-    5.172405839e-01f,
-    4.716806412e+00f,
-    7.953457355e+00f,
-    6.461239338e+00f,
-    3.656100631e-01f,
-    1.830734015e+00f,
-    7.112469077e-01f,
-    6.311755657e+00f,
-    5.108645558e-01f,
-    1.849099159e+00f,
-    5.814598083e+00f,
-    6.843810425e+02f,
-    1.238615952e+02f,
-    2.501359284e-01f,
-    2.345478535e-01f,
-    1.471932888e+01f,
-    2.622493505e-01f,
-    1.980682135e+00f,
-    1.472077465e+01f,
-    5.017887354e-01f,
-    2.373766005e-01f,
-    4.497288227e+00f,
-    2.846507132e-01f,
-    9.295086563e-02f,
-    1.890834808e+01f,
-    1.794541836e+00f,
-    1.658662415e+01f,
-    8.195449829e+00f,
-    2.941625416e-01f,
-    1.200359315e-01f,
-    1.491326928e+00f,
-    9.439951181e-01f,
-    3.589555323e-01f,
-    3.075717092e-01f,
-    7.460520416e-02f,
-    7.914595604e-01f,
-    4.953604341e-01f,
-    1.443226457e+00f,
-    2.270848453e-01f,
-    9.004185796e-01f,
-    5.402756333e-01f,
-    8.005858660e-01f,
-    1.030387521e+00f,
-    1.344307233e-02f,
-    1.210336328e+00f,
-    1.327641129e+00f,
-    5.995448828e-01f,
-    2.126996613e+01f,
-    1.861198997e+01f,
-    1.228789139e+01f,
-    1.751663804e+00f,
-    1.758794188e+00f,
-    1.953052044e+00f,
-    9.995474219e-01f,
-    5.577875972e-01f,
-    9.825586319e+00f,
-    2.617039680e+01f,
-    2.380497456e+00f,
-    1.789477587e+00f,
-    1.474473000e+00f,
-    2.703119469e+01f,
-    2.374378920e+00f,
-    1.024614811e+00f,
-    1.129085064e+00f,
-    3.416926786e-02f,
-    7.477216721e-01f,
-    4.112482071e+01f,
-    2.446069717e+00f,
-    4.195036697e+01f,
-    2.869277716e+00f,
-    3.511162996e-01f,
-    1.879584312e+00f,
-    6.370017529e-01f,
-    5.389834046e-01f,
-    1.465146661e+00f,
-    4.963859558e+01f,
-    2.187764883e+00f,
-    4.262943268e+01f,
-    2.423016787e+00f,
-    3.741914988e+00f,
-    9.147686005e+00f,
-    6.203518510e-01f,
-    5.377997756e-01f,
-    1.770718217e+00f,
-    3.247017288e+01f,
-    1.881384492e+00f,
-    7.446398926e+01f,
-    2.820549488e+00f,
-    1.115373254e+00f,
-    1.362414002e+00f,
-    1.020668268e+00f,
-    1.565909088e-01f,
-    2.895216048e-01f,
-    3.102553785e-01f,
-    1.415843391e+01f,
-    9.823263168e+00f,
-    1.366791344e+01f,
-    2.112454921e-01f,
-    7.660140991e-01f,
-    5.002450347e-01f,
-    2.968727946e-01f,
-    6.432270408e-01f,
-    5.527371764e-01f,
-    2.417492294e+01f,
-    1.535362911e+01f,
-    2.680956650e+01f,
-    1.048447609e+00f,
-    3.829194546e+00f,
-    1.030932069e+00f,
-    3.564316928e-01f,
-    4.628052711e-01f,
-    5.521601439e-01f,
-    2.150172997e+01f,
-    1.906621170e+01f,
-    7.916323090e+01f,
-    2.884479165e-01f,
-    1.539019346e+00f,
-    2.423823178e-01f,
-    4.195945263e-01f,
-    1.830145836e+00f,
-    9.836914539e-01f,
-    5.941392779e-01f,
-    6.724841118e+00f,
-    7.839447260e-01f,
-    3.578287125e+00f,
-    2.435516357e+00f,
-    2.305631340e-01f,
-    1.027077317e+00f,
-    4.119136810e+00f,
-    4.223122120e+00f,
-    4.216285229e+00f,
-    1.064125538e+01f,
-    1.177498698e+00f,
-    5.422118187e+00f,
-    7.260066509e+00f,
-    5.169699192e+00f,
-    1.279504776e+01f,
-    1.744450808e+00f,
-    6.361234784e-01f,
-    1.187651396e+00f,
-    6.734810352e+00f,
-    2.151318789e-01f,
-    2.112488508e+00f,
-    3.941293001e+00f,
-    6.294407845e-01f,
-    3.460728168e+00f,
-    4.341527939e+00f,
-    2.681139410e-01f,
-    1.832827210e+00f,
-    1.254197359e+00f,
-    7.987444305e+01f,
-    5.843778229e+01f,
-    1.176094894e+02f,
-    3.260409832e-01f,
-    1.411704540e+01f,
-    5.779444695e+00f,
-    1.052448273e+00f,
-    1.362749219e+00f,
-    1.416489959e+00f,
-    4.096801758e+01f,
-    5.541002274e+01f,
-    2.823521729e+02f,
-    1.959492087e+00f,
-    9.322100830e+01f,
-    1.848754692e+01f,
-    4.618825018e-01f,
-    1.159848690e+00f,
-    8.318040371e-01f,
-    1.463107147e+02f,
-    2.826545715e+01f,
-    7.406818237e+02f,
-    9.525547624e-01f,
-    1.962139320e+01f,
-    5.019165039e+00f,
-    6.320903897e-01f,
-    8.721100688e-01f,
-    7.436055756e+01f,
-    3.560107946e+00f,
-    6.549603343e-01f,
-    1.495845947e+02f,
-    1.904860497e+01f,
-    6.197074652e-01f,
-    1.998076057e+01f,
-    6.201415539e+00f,
-    1.307643175e+00f,
-    2.305611223e-01f,
-    1.912381592e+02f,
-    4.279842675e-01f,
-    5.022820234e-01f,
-    1.150559068e+00f,
-    6.619209647e-01f,
-    5.982378125e-01f,
-    4.454568028e-01f,
-    3.110084683e-02f,
-    1.689042449e+00f,
-    4.788815975e+00f,
-    6.434451323e-03f,
-    2.298308313e-01f,
-    2.803355217e+00f,
-    1.240578219e-01f,
-    2.624212265e+00f,
-    8.600103669e-03f,
-    1.986572266e+00f,
-    1.680579185e+00f,
-    3.827241659e+00f,
-    3.749235868e+00f,
-    4.262236953e-01f,
-    4.756212980e-02f,
-    6.171512604e-01f,
-    6.768785715e-01f,
-    1.233076975e-01f,
-    2.716078043e+00f,
-    2.692650072e-02f,
-    1.500628114e+00f,
-    2.235936224e-01f,
-    7.021008730e-01f,
-    6.568152457e-02f,
-    8.595539629e-02f,
-    2.203153074e-01f,
-    6.342471838e-01f,
-    1.799604744e-01f,
-    4.530400038e-03f,
-    1.325971633e-01f,
-    5.252131939e+00f,
-    6.813275814e-02f,
-    7.834160328e-01f,
-    1.270861626e+01f,
-    2.209400892e+00f,
-    3.117813468e-01f,
-    2.844381809e+00f,
-    4.088962451e-02f,
-    2.101164460e-01f,
-    1.669325352e+00f,
-    2.578988671e-01f,
-    3.164703608e+00f,
-    1.101246953e+00f,
-    8.439599872e-01f,
-    5.491777658e-01f,
-    2.465815097e-01f,
-    4.830296338e-01f,
-    6.846312284e-01f,
-    1.074654460e+00f,
-    3.555177748e-01f,
-    4.450103641e-01f,
-    8.235817552e-01f,
-    2.736809850e-01f,
-    2.829556465e-01f,
-    5.901402608e-02f,
-    3.742975416e-03f,
-    2.082047760e-01f,
-    6.120081246e-02f,
-    4.034367204e-02f,
-    8.038187772e-02f,
-    1.431802101e-02f,
-    9.688563645e-02f,
-    2.896888368e-02f,
-    8.410204202e-02f,
-    2.361134529e+00f,
-    1.327240914e-01f,
-    1.827800125e-01f,
-    6.835299015e+00f,
-    9.731988907e+00f,
-    4.069259644e+00f,
-    1.169005299e+01f,
-    8.114057779e-02f,
-    2.067482471e-01f,
-    1.836208820e+00f,
-    5.503305793e-01f,
-    5.441152453e-01f,
-    3.734804094e-01f,
-    4.826526716e-02f,
-    3.661515117e-01f,
-    1.772806883e+00f,
-    1.322536564e+01f,
-    5.776605129e+00f,
-    2.584882021e+00f,
-    6.981453419e+00f,
-    6.050512791e+00f,
-    8.470169067e+00f,
-    2.630206299e+01f,
-    1.079190448e-01f,
-    2.943768799e-01f,
-    5.506320953e+00f,
-    5.795997977e-01f,
-    4.611349478e-02f,
-    6.435973644e-01f,
-    2.356347144e-01f,
-    7.697511673e+00f,
-    2.407297850e+00f,
-    9.982922077e-01f,
-    1.403261162e-02f,
-    2.336685658e-01f,
-    9.329053015e-02f,
-    2.061660290e+00f,
-    1.166388035e+00f,
-    1.270061851e+00f,
-    5.174668312e+00f,
-    2.562263608e-01f,
-    4.635218680e-01f,
-    2.675008774e+00f,
-    1.249929070e+00f,
-    4.011161625e-01f,
-    9.570382237e-01f,
-    6.077158451e-02f,
-    2.242522687e-01f,
-    1.988281250e+00f,
-    6.493840694e+00f,
-    3.440324068e+00f,
-    5.424419880e+00f,
-    3.706830215e+01f,
-    2.624416113e+00f,
-    1.241793919e+01f,
-    4.891122818e+00f,
-    1.032765484e+01f,
-    2.077576399e+00f,
-    2.159626484e+00f,
-    1.752642632e+00f,
-    1.146127701e+01f,
-    5.474185944e+00f,
-    7.886815548e+00f,
-    9.198411942e+00f,
-    3.311369419e+00f,
-    3.745572567e+00f,
-    9.503230095e+00f,
-    1.031511784e+01f,
-    1.193803978e+01f,
-    1.170112324e+01f,
-    2.168166733e+01f,
-    1.363174820e+01f,
-    9.485036880e-02f,
-    2.497653216e-01f,
-    1.853454018e+01f,
-    6.236145782e+01f,
-    5.301132679e+00f,
-    2.385363197e+01f,
-    1.959477663e-01f,
-    8.540712595e-01f,
-    1.981365681e-01f,
-    4.286206961e-01f,
-    3.825295866e-01f,
-    5.302923322e-01f,
-    4.417480826e-01f,
-    2.875560224e-01f,
-    7.720377445e-01f,
-    1.877282381e+00f,
-    4.852862358e+00f,
-    2.689387321e+01f,
-    6.152384281e+00f,
-    2.265063047e+00f,
-    2.030255318e+00f,
-    2.772703886e+00f,
-    9.519093633e-01f,
-    6.329702139e-01f,
-    9.473995209e+00f,
-    7.723211050e-01f,
-    2.667624235e+00f,
-    1.150931597e+00f,
-    4.265574217e-01f,
-    3.599191189e+00f,
-    2.870168924e+00f,
-    1.342913747e+00f,
-    2.984211445e+00f,
-    8.677098274e+00f,
-    6.770067692e+00f,
-    4.379546940e-01f,
-    5.042801797e-02f,
-    2.173684537e-01f,
-    7.260939598e+00f,
-    6.499597931e+01f,
-    4.056878567e+00f,
-    2.387526989e+00f,
-    1.895463765e-01f,
-    5.551019907e-01f,
-    6.768165112e+00f,
-    7.557306290e+00f,
-    1.184359550e+00f,
-    5.426095486e+00f,
-    1.075840302e+02f,
-    1.068645763e+01f,
-    9.903621078e-01f,
-    2.043902397e+01f,
-    6.943212986e+00f,
-    1.392158794e+01f,
-    5.298233032e+00f,
-    2.129703760e+00f,
-    4.944652617e-01f,
-    7.572438812e+01f,
-    1.489610195e+00f,
-    8.620273590e+00f,
-    1.481928468e+00f,
-    6.493629813e-01f,
-    8.485156894e-01f,
-    1.337545156e+00f,
-    1.541634560e+00f,
-    3.589001298e-01f,
-    2.869572878e+00f,
-    1.272462964e+00f,
-    2.926132441e+00f,
-    2.833369732e+00f,
-    9.614389539e-01f,
-    1.658127308e+00f,
-    3.183248520e+00f,
-    3.590774298e+00f,
-    2.419167900e+01f,
-    1.456396282e-01f,
-    4.745756388e-01f,
-    2.736144781e+00f,
-    1.490032434e+00f,
-    4.664132595e-01f,
-    3.511893153e-01f,
-    1.579143882e+00f,
-    7.128482461e-01f,
-    5.932708979e-01f,
-    1.278176665e+00f,
-    1.371412396e+00f,
-    4.470239878e-01f,
-    3.042904437e-01f,
-    4.311212301e-01f,
-    9.193277359e-01f,
-    5.278974771e-01f,
-    1.218015289e+01f,
-    5.551882088e-02f,
-    1.294033229e-01f,
-    2.500995827e+01f,
-    5.032048702e+00f,
-    2.191551775e-01f,
-    5.503022671e-01f,
-    1.951644570e-01f,
-    5.506049395e-01f,
-    7.465112209e-01f,
-    8.021012545e-01f,
-    1.215315819e+00f,
-    8.907114267e-01f,
-    7.402580380e-01f,
-    1.594671160e-01f,
-    9.820688516e-02f,
-    3.252241015e-02f,
-    9.670436382e-03f,
-    2.235631691e-03f,
-    3.681895032e-04f,
-    1.914652586e-01f,
-    5.866849795e-02f,
-    9.310756624e-02f,
-    1.032894664e-02f,
-    1.046500877e-01f,
-    1.006613951e-02f,
-    6.883141398e-02f,
-    4.757940304e-03f,
-    3.249104023e+00f,
-    1.366983354e-01f,
-    1.012428761e+00f,
-    2.433119528e-02f,
-    1.326295286e-01f,
-    8.025321960e+00f,
-    5.885839462e+00f,
-    2.340562344e+00f,
-    6.751430988e+00f,
-    1.319335103e-01f,
-    5.929698944e-01f,
-    2.253284305e-01f,
-    2.109484226e-01f,
-    1.517713666e+00f,
-    8.241155744e-01f,
-    4.117376208e-01f,
-    6.337023377e-01f,
-    5.219867080e-02f,
-    1.207373261e+00f,
-    1.113278046e-01f,
-    6.395586729e-01f,
-    2.765619457e-01f,
-    7.809737206e+00f,
-    1.787785530e+01f,
-    1.634059525e+01f,
-    2.075964689e+00f,
-    2.124115944e+00f,
-    7.574529648e+00f,
-    2.545430946e+01f,
-    1.207471008e+02f,
-    1.319046497e+01f,
-    3.680513382e+01f,
-    3.683130264e+00f,
-    1.788946533e+01f,
-    2.061386299e+01f,
-    4.149321318e-01f,
-    1.236739807e+02f,
-    1.556304932e+00f,
-    1.818008804e+01f,
-    1.321405411e+01f,
-    1.043316078e+01f,
-    1.421779953e-02f,
-    1.245819479e-01f,
-    1.627428085e-02f,
-    4.447868168e-01f,
-    1.185736209e-01f,
-    1.525171375e+01f,
-    1.425442028e+01f,
-    6.914163113e+00f,
-    3.890709281e-01f,
-    1.087703586e+00f,
-    3.793532252e-01f,
-    5.595276952e-01f,
-    8.148112893e-02f,
-    9.503146172e+00f,
-    2.261169434e+00f,
-    3.634745359e+00f,
-    1.213658322e-02f,
-    6.506134868e-01f,
-    6.485313177e-02f,
-    2.360505797e-02f,
-    5.663874626e+00f,
-    1.491459608e-01f,
-    8.117287755e-01f,
-    6.091448292e-02f,
-    6.597325206e-02f,
-    8.621874809e+00f,
-    3.031028509e+00f,
-    1.513673544e+00f,
-    1.034743214e+01f,
-    8.657342941e-02f,
-    5.938056707e-01f,
-    2.531776726e-01f,
-    2.356398255e-01f,
-    1.439899445e+00f,
-    1.679143906e+00f,
-    5.472345948e-01f,
-    1.682552695e+00f,
-    6.604890525e-02f,
-    1.022966385e+00f,
-    8.916576952e-02f,
-    3.148163259e-01f,
-    6.255709380e-02f,
-    3.285861015e+00f,
-    7.722690105e+00f,
-    1.781151962e+01f,
-    2.370277405e+00f,
-    1.004774761e+01f,
-    2.566159058e+01f,
-    5.932184696e+00f,
-    2.707939911e+01f,
-    1.647944808e+00f,
-    1.113486481e+01f,
-    4.618491173e+00f,
-    1.226704121e+00f,
-    5.060306549e+00f,
-    2.527260780e+00f,
-    6.498948097e+00f,
-    9.700539589e+00f,
-    2.006268883e+01f,
-    1.940516472e+01f,
-    9.845453262e+00f,
-    1.226044178e+01f,
-    3.863400650e+01f,
-    1.541462302e+00f,
-    1.808304405e+01f,
-    1.918226433e+01f,
-    1.334926987e+01f,
-    2.948197842e+00f,
-    1.357666731e+00f,
-    2.607367706e+01f,
-    1.947902870e+01f,
-    4.033348083e+01f,
-    1.190585518e+01f,
-    1.194145012e+01f,
-    2.244215584e+01f,
-    3.983818436e+01f,
-    3.072449207e+00f,
-    1.443206120e+01f,
-    4.293629456e+01f,
-    1.851293564e+01f,
-    6.381171036e+01f,
-    5.532001019e+00f,
-    2.693573833e-01f,
-    4.125470734e+01f,
-    1.542175674e+01f,
-    9.571459961e+01f,
-    6.498807907e+00f,
-    1.568124771e+00f,
-    7.214321494e-01f,
-    3.050129414e-01f,
-    4.906252027e-02f,
-    9.161920846e-02f,
-    4.451310635e-02f,
-    9.193219990e-02f,
-    2.093685418e-01f,
-    6.699178815e-01f,
-    2.139638811e-01f,
-    3.487977087e-01f,
-    4.922388121e-02f,
-    1.520063728e-01f,
-    1.723545939e-01f,
-    5.743275285e-01f,
-    5.287197828e-01f,
-    1.419036090e-01f,
-    2.343630791e-01f,
-    2.470218949e-02f,
-    1.561819911e-01f,
-    2.283962071e-02f,
-    4.535931349e-01f,
-    1.402194351e-01f,
-    7.701681256e-01f,
-    1.831447333e-01f,
-    2.435773164e-01f,
-    1.673002839e+00f,
-    1.156728506e+00f,
-    4.607777596e-01f,
-    7.416468859e-01f,
-    6.084491313e-02f,
-    2.493668497e-01f,
-    1.016796827e-01f,
-    4.120875299e-01f,
-    3.132294416e-01f,
-    2.839926183e-01f,
-    9.231859446e-02f,
-    4.577736855e-01f,
-    1.429589391e-01f,
-    8.684955239e-01f,
-    2.226658762e-01f,
-    2.119905949e-01f,
-    1.497537922e-02f,
-    3.757397890e+00f,
-    1.310455441e+00f,
-    3.841676474e+00f,
-    8.227745056e+00f,
-    2.421706200e+00f,
-    9.722980857e-01f,
-    2.387503386e+00f,
-    4.246526718e+00f,
-    4.539530754e+00f,
-    1.032875896e+00f,
-    7.935299277e-01f,
-    7.542161345e-01f,
-    4.085905850e-01f,
-    2.582478046e+00f,
-    5.077959895e-01f,
-    9.661921859e-01f,
-    7.225083709e-01f,
-    6.751449108e-01f,
-    4.847870171e-01f,
-    7.712442875e-01f,
-    4.796923161e+00f,
-    1.437114239e+00f,
-    1.795828438e+01f,
-    5.175011158e+00f,
-    3.503807068e+00f,
-    1.813733935e+00f,
-    1.901175261e+00f,
-    2.155634308e+01f,
-    4.401385784e+00f,
-    4.211632252e+00f,
-    1.279049969e+01f,
-    6.609468937e+00f,
-    1.271875572e+01f,
-    3.269514847e+01f,
-    9.209937453e-01f,
-    1.824651241e+00f,
-    5.200117493e+01f,
-    8.685168266e+00f,
-    2.914785767e+01f,
-    1.444283366e+00f,
-    1.830214262e-01f,
-    5.829492569e+01f,
-    6.749116898e+00f,
-    5.453807068e+01f,
-    4.169559956e+00f,
-    1.652848816e+01f,
-    1.363512516e+01f,
-    1.464599800e+01f,
-    5.531879425e+00f,
-    1.010768032e+01f,
-    3.495951653e+00f,
-    4.316390514e+00f,
-    2.446714163e+00f,
-    2.407512283e+01f,
-    1.532878590e+01f,
-    6.086998940e+00f,
-    9.542588234e+00f,
-    5.521045923e-01f,
-    6.801993370e+00f,
-    8.839050293e+00f,
-    2.348435640e+00f,
-    2.801352262e+00f,
-    4.469108105e+00f,
-    8.632087708e+00f,
-    3.161851645e+00f,
-    7.887498379e+00f,
-    1.159259224e+01f,
-    4.781771183e+00f,
-    1.565652275e+01f,
-    4.861238956e+00f,
-    1.104673195e+01f,
-    1.364444256e+01f,
-    1.136806679e+01f,
-    5.862838364e+01f,
-    1.140203571e+01f,
-    8.525662422e+00f,
-    9.136720657e+00f,
-    1.302102685e+00f,
-    3.101185560e+00f,
-    1.466246510e+01f,
-    1.504016590e+01f,
-    5.325479507e+01f,
-    3.229383230e+00f,
-    2.001215219e+00f,
-    6.780476570e+00f,
-    7.388076782e+00f,
-    1.099530697e+00f,
-    2.206711531e+00f,
-    1.352893591e+00f,
-    7.936591148e+00f,
-    3.117457390e+01f,
-    3.058780193e+00f,
-    1.337360978e+00f,
-    2.271503067e+01f,
-    1.740142226e+00f,
-    1.472756767e+01f,
-    1.590339565e+01f,
-    2.006296158e+01f,
-    4.582629204e+00f,
-    1.095274830e+01f,
-    3.110112667e+00f,
-    3.072701931e+00f,
-    6.844946861e+00f,
-    1.351433754e+01f,
-    2.398144531e+01f,
-    4.366746140e+01f,
-    1.829974747e+01f,
-    4.358066082e+00f,
-    7.027355957e+01f,
-    2.808386564e+00f,
-    6.155503988e-01f,
-    8.437927246e+00f,
-    1.241371250e+01f,
-    3.874610138e+01f,
-    4.788327694e+00f,
-    1.867968178e+01f,
-    2.239578819e+01f,
-    2.039022684e+00f,
-    4.743405819e+00f,
-    1.574965268e-01f,
-    5.668939352e-01f,
-    1.094595566e-01f,
-    3.338428959e-02f,
-    1.121274471e+01f,
-    8.830931664e+00f,
-    1.806849837e+00f,
-    8.978258133e+00f,
-    8.113368601e-02f,
-    5.749920607e-01f,
-    1.858433485e-01f,
-    2.588781714e-01f,
-    8.467692733e-01f,
-    1.541090012e+00f,
-    4.037579000e-01f,
-    2.972779751e+00f,
-    3.842146322e-02f,
-    1.476608396e+00f,
-    1.386029273e-01f,
-    3.865564764e-01f,
-    9.310410172e-02f,
-    6.492632389e+00f,
-    4.594087219e+01f,
-    5.402634144e+00f,
-    3.911127329e+00f,
-    4.610791206e+00f,
-    8.840497971e+00f,
-    6.004022121e+00f,
-    1.209783783e+02f,
-    4.524931908e+00f,
-    1.092208252e+02f,
-    5.007536411e+00f,
-    1.171146107e+01f,
-    3.621445923e+02f,
-    1.712803841e+01f,
-    8.762876129e+01f,
-    1.531630707e+01f,
-    1.238408852e+01f,
-    2.690246582e+01f,
-    9.135701180e+00f,
-    6.535122681e+01f,
-    5.810621338e+02f,
-    1.025888681e+00f,
-    2.030096245e+01f,
-    2.049215126e+01f,
-    6.730107784e+00f,
-    1.005041838e+00f,
-    8.005096316e-01f,
-    4.816271067e-01f,
-    2.658011246e+01f,
-    1.760042953e+01f,
-    5.683215618e+00f,
-    5.969239473e-01f,
-    9.612382650e-01f,
-    3.527316451e-01f,
-    1.323260784e+01f,
-    1.704475594e+01f,
-    3.710155964e+00f,
-    8.111313581e-01f,
-    4.124815166e-01f,
-    4.615092278e-01f,
-    1.461803722e+01f,
-    2.743493462e+01f,
-    7.240694523e+00f,
-    2.162750006e+00f,
-    1.450792122e+01f,
-    2.711304665e+00f,
-    3.192803621e+00f,
-    1.827371597e+00f,
-    2.642607880e+01f,
-    6.600154877e+01f,
-    2.892493057e+01f,
-    3.133695126e+00f,
-    1.014507866e+01f,
-    5.725425243e+00f,
-    1.674755692e+00f,
-    2.686648369e-01f,
-    1.088730621e+01f,
-    2.621482277e+01f,
-    1.208793354e+01f,
-    2.352648020e+00f,
-    2.262197495e+01f,
-    4.757171631e+00f,
-    6.490586400e-01f,
-    3.571937323e+00f,
-    9.512542486e-01f,
-    1.620071054e+00f,
-    2.500490248e-01f,
-    6.075512767e-01f,
-    1.248891926e+01f,
-    6.395658016e+00f,
-    4.315913200e+00f,
-    8.037362099e+00f,
-    3.237395883e-01f,
-    3.280629158e+00f,
-    4.907511473e-01f,
-    1.677197933e+00f,
-    1.324649453e+00f,
-    1.750615716e+00f,
-    7.309256792e-01f,
-    1.780363441e+00f,
-    2.014043480e-01f,
-    4.043127537e+00f,
-    1.253759742e+00f,
-    1.787555337e+00f,
-    2.027270198e-01f,
-    1.837172127e+01f,
-    6.340155602e+00f,
-    2.729827642e+00f,
-    1.132227898e+01f,
-    1.236180067e+00f,
-    8.750193119e-01f,
-    1.044676685e+01f,
-    1.573736668e+01f,
-    3.606586075e+01f,
-    8.249912262e+00f,
-    2.658491731e-01f,
-    1.773105431e+01f,
-    1.501825047e+01f,
-    1.005982132e+02f,
-    9.129203796e+00f,
-    1.469878435e+00f,
-    5.012868404e+00f,
-    6.991501451e-01f,
-    3.152402341e-01f,
-    2.315459747e+02f,
-    7.740995026e+01f,
-    6.468086243e-01f,
-    2.124635315e+01f,
-    2.523839378e+01f,
-    8.096874237e+00f,
-    2.179671526e+00f,
-    1.184547424e+00f,
-    1.673891068e+00f,
-    2.552168274e+01f,
-    1.574514294e+01f,
-    4.768840790e+00f,
-    1.439669490e+00f,
-    2.458997011e+00f,
-    1.248724937e+00f,
-    4.093695831e+01f,
-    1.271876431e+01f,
-    4.241881371e+00f,
-    4.679964185e-01f,
-    9.548338652e-01f,
-    7.123855948e-01f,
-    5.960689068e+00f,
-    4.604692459e+00f,
-    8.661148071e+00f,
-    1.236063480e+00f,
-    1.310133100e+00f,
-    6.139201522e-01f,
-    1.969121099e+00f,
-    1.257148027e+00f,
-    1.522824645e+00f,
-    6.650326729e+00f,
-    9.707074165e-01f,
-    7.716937065e-01f,
-    3.663296998e-01f,
-    7.869405746e+00f,
-    1.334433198e+00f,
-    6.208754778e-01f,
-    8.369967461e+00f,
-    5.070206165e+00f,
-    7.789710999e+00f,
-    2.686327457e+00f,
-    2.942869186e+00f,
-    2.574796438e+00f,
-    1.078814387e+00f,
-    1.897627711e+00f,
-    1.510253143e+01f,
-    6.671588898e+00f,
-    1.529370904e+00f,
-    1.255633473e+00f,
-    3.081572533e+00f,
-    4.009426117e+00f,
-    7.354958057e+00f,
-    2.431287289e+00f,
-    1.158517838e+01f,
-    5.878262520e+00f,
-    8.289846420e+00f,
-    2.937782526e+00f,
-    6.908276558e+00f,
-    1.554302216e+00f,
-    1.073856068e+01f,
-    1.296726704e+01f,
-    1.858090782e+01f,
-    3.583853006e+00f,
-    1.534695339e+01f,
-    9.406764984e+00f,
-    2.335086632e+01f,
-    1.830827522e+01f,
-    3.443069696e+00f,
-    4.620059013e+00f,
-    1.894331098e+00f,
-    1.149311161e+01f,
-    5.723607063e+00f,
-    7.022951841e-01f,
-    3.001043129e+01f,
-    5.738499165e+00f,
-    1.576714897e+01f,
-    2.033839607e+01f,
-    6.662681580e+00f,
-    6.962385029e-02f,
-    6.593348384e-01f,
-    9.227357060e-02f,
-    7.080345750e-01f,
-    4.766699970e-01f,
-    6.689067364e+00f,
-    1.113266182e+01f,
-    2.035816669e+00f,
-    6.029147506e-01f,
-    7.946596146e-01f,
-    8.488565087e-01f,
-    1.737443656e-01f,
-    2.143909484e-01f,
-    8.176270485e+00f,
-    1.308169842e+01f,
-    3.431748867e+00f,
-    1.725655049e-01f,
-    3.041025996e-01f,
-    1.250482351e-01f,
-    8.719385415e-02f,
-    2.300974655e+01f,
-    8.155767441e+00f,
-    1.504177952e+01f,
-    9.546624422e-01f,
-    1.456994414e+00f,
-    3.506898403e+00f,
-    1.235856175e+00f,
-    2.069130898e+00f,
-    3.400989151e+01f,
-    9.280651093e+00f,
-    3.388025284e+00f,
-    1.162615180e+00f,
-    2.787339926e+00f,
-    2.550544739e+00f,
-    1.326126814e+00f,
-    3.223425746e-01f,
-    1.473818684e+01f,
-    8.635712624e+00f,
-    1.974748802e+01f,
-    8.275027871e-01f,
-    6.117292881e+00f,
-    1.414508104e+00f,
-    5.790517330e+00f,
-    8.625771403e-01f,
-    2.476459312e+01f,
-    6.649970245e+01f,
-    5.032235146e+00f,
-    7.719185948e-01f,
-    1.145730972e+00f,
-    1.036637306e+00f,
-    8.523386002e+00f,
-    1.465144157e+00f,
-    9.316278100e-01f,
-    2.885067165e-01f,
-    1.408120275e+00f,
-    1.639134049e+00f,
-    5.877724886e-01f,
-    1.412383556e+00f,
-    7.848463058e-01f,
-    8.305684924e-01f,
-    5.615185499e-01f,
-    1.041373014e+00f,
-    8.666840196e-01f,
-    1.439855695e+00f,
-    6.078590775e+01f,
-    2.207235146e+01f,
-    1.796237373e+01f,
-    5.325482845e+00f,
-    3.455049515e+00f,
-    4.396154022e+01f,
-    7.003773212e+00f,
-    8.673171043e+00f,
-    2.389036560e+01f,
-    1.296516132e+01f,
-    1.691064072e+01f,
-    4.606549072e+01f,
-    1.613665938e+00f,
-    2.514164686e+00f,
-    8.181280518e+01f,
-    1.491206455e+01f,
-    9.973492622e+00f,
-    4.659918308e+00f,
-    2.139560729e-01f,
-    2.836260071e+02f,
-    3.193053007e+00f,
-    5.820063019e+01f,
-    5.273321152e+00f,
-    1.213997364e+01f,
-    1.285058117e+01f,
-    1.502701187e+01f,
-    3.869436502e+00f,
-    1.688594437e+01f,
-    4.983923435e+00f,
-    1.174851656e+00f,
-    2.529993534e+00f,
-    6.339564800e+00f,
-    5.377615356e+01f,
-    1.582884908e+00f,
-    2.259334755e+01f,
-    7.566576600e-01f,
-    4.226151657e+01f,
-    1.529453278e+01f,
-    1.528644323e+00f,
-    9.475167274e+00f,
-    1.968527436e-01f,
-    9.235165119e-01f,
-    7.751371711e-02f,
-    4.722508788e-02f,
-    4.952896118e+00f,
-    6.240098000e+00f,
-    3.911025763e+00f,
-    1.535884953e+01f,
-    2.507422268e-01f,
-    7.063307762e-01f,
-    1.897475868e-01f,
-    3.510662913e-01f,
-    1.546343565e+00f,
-    1.186794043e+00f,
-    2.642588913e-01f,
-    5.902562618e+00f,
-    8.102012426e-02f,
-    1.012660503e+00f,
-    1.584985405e-01f,
-    2.502152324e-01f,
-    3.326829672e-01f,
-    1.268107653e+00f,
-    1.792397261e+00f,
-    3.648626506e-01f,
-    3.235520124e-01f,
-    8.867118508e-02f,
-    3.849793673e-01f,
-    1.657028079e+00f,
-    5.288907886e-01f,
-    1.894969583e+00f,
-    2.935143746e-02f,
-    4.768603742e-01f,
-    5.132373795e-02f,
-    8.604276657e+00f,
-    2.194316483e+01f,
-    1.065567303e+01f,
-    6.964919567e-01f,
-    1.182265568e+01f,
-    8.893771768e-01f,
-    8.795878291e-01f,
-    2.195597172e+00f,
-    9.503429413e+00f,
-    1.586144352e+01f,
-    5.995730877e+00f,
-    3.422219992e+00f,
-    5.149518967e+00f,
-    5.031695366e+00f,
-    8.848307133e-01f,
-    2.701983154e-01f,
-    2.371100616e+01f,
-    1.982318420e+02f,
-    3.653705215e+01f,
-    1.382186890e+00f,
-    2.357377815e+01f,
-    1.535115004e+00f,
-    1.667561531e+00f,
-    5.674429893e+00f,
-    5.132850409e-01f,
-    7.987378836e-01f,
-    2.819159627e-01f,
-    3.279574513e-01f,
-    8.091089249e+00f,
-    1.573695064e+00f,
-    1.069396257e+00f,
-    1.057195377e+01f,
-    1.507985592e+00f,
-    1.473126531e+00f,
-    8.162261844e-01f,
-    3.085486412e+00f,
-    1.561843872e+00f,
-    9.481894970e-01f,
-    7.094833851e-01f,
-    7.601458073e+00f,
-    3.907503784e-01f,
-    3.825809956e+00f,
-    8.568759561e-01f,
-    9.067445993e-01f,
-    8.258209825e-01f,
-    1.066335320e+00f,
-    1.990061253e-01f,
-    1.474129558e+00f,
-    2.760464907e+00f,
-    1.729808599e-01f,
-    2.495380789e-01f,
-    6.110743880e-01f,
-    5.567905307e-01f,
-    9.313349128e-01f,
-    3.716599047e-01f,
-    2.725933790e-01f,
-    1.588109881e-01f,
-    7.492668182e-02f,
-    1.439944148e+00f,
-    1.837715954e-01f,
-    2.766568661e-01f,
-    8.463460207e-02f,
-    1.981372833e-01f,
-    1.512064785e-01f,
-    3.294025660e-01f,
-    2.533897460e-01f,
-    7.096756250e-02f,
-    6.980519891e-01f,
-    7.805334330e-01f,
-    6.815299392e-01f,
-    8.702239394e-01f,
-    7.022082806e-01f,
-    4.086836278e-01f,
-    1.187556863e+00f,
-    1.059574604e+00f,
-    1.041315198e+00f,
-    5.139502883e-01f,
-    1.833992839e+00f,
-    3.993206024e-01f,
-    3.830289245e-01f,
-    6.310048103e-01f,
-    4.236611724e-01f,
-    6.954475641e-01f,
-    7.070567608e-01f,
-    8.258116841e-01f,
-    2.562740564e+00f,
-    7.435458302e-01f,
-    1.131773829e+00f,
-    2.484877408e-01f,
-    1.090167239e-01f,
-    9.691821039e-02f,
-    1.267147958e-01f,
-    3.564984202e-01f,
-    3.838687837e-01f,
-    4.012449384e-01f,
-    5.031521916e-01f,
-    3.065122664e-01f,
-    6.006339192e-01f,
-    6.955529749e-02f,
-    2.784242630e+00f,
-    5.767310858e-01f,
-    5.330293775e-01f,
-    7.112797499e-01f,
-    5.510364771e-01f,
-    2.016013861e+00f,
-    1.229507923e+00f,
-    3.983542025e-01f,
-    7.525623322e+00f,
-    3.941739798e-01f,
-    1.446629167e+00f,
-    1.627234668e-01f,
-    5.229588747e-01f,
-    7.647049427e-01f,
-    5.939702988e-01f,
-    2.364818603e-01f,
-    3.377465248e+00f,
-    4.391724467e-01f,
-    1.019036412e+00f,
-    3.683220744e-01f,
-    8.938553333e-01f,
-    7.517969012e-01f,
-    6.494015694e+00f,
-    6.353077412e+00f,
-    1.272000217e+01f,
-    1.011236668e+00f,
-    7.199255824e-01f,
-    1.452135181e+01f,
-    2.734107733e+00f,
-    4.990589142e+00f,
-    3.096020699e+00f,
-    3.100133181e+00f,
-    1.269324899e+00f,
-    1.642762065e+00f,
-    2.463998318e+00f,
-    4.861420989e-01f,
-    6.752926111e-01f,
-    4.067538977e-01f,
-    3.828036070e+00f,
-    8.033569336e+00f,
-    4.757565498e+00f,
-    1.559356928e+00f,
-    2.667668581e+00f,
-    4.902658165e-01f,
-    1.098045826e+00f,
-    5.047621727e-01f,
-    1.709507942e+01f,
-    8.409803391e+00f,
-    1.085608006e+01f,
-    3.887418032e+00f,
-    7.905268669e-01f,
-    3.155938387e+00f,
-    7.129054666e-01f,
-    7.523016930e-01f,
-    2.291143656e+00f,
-    4.455048144e-01f,
-    4.900729060e-01f,
-    3.875117898e-01f,
-    2.246519327e-01f,
-    4.885913372e+00f,
-    3.036356449e+00f,
-    2.847010374e+00f,
-    5.528743744e+00f,
-    2.100234181e-01f,
-    1.991600275e+00f,
-    5.416675806e-01f,
-    5.733326077e-01f,
-    3.774484396e-01f,
-    6.936573982e-01f,
-    5.203460455e-01f,
-    7.838348150e-01f,
-    5.248296261e-01f,
-    8.449287415e-01f,
-    6.264239550e-01f,
-    9.429262280e-01f,
-    3.588847518e-01f,
-    1.974956512e+00f,
-    1.485434532e+00f,
-    1.408498645e+00f,
-    1.045016408e+00f,
-    1.141223788e+00f,
-    5.231044888e-01f,
-    1.158594251e+00f,
-    7.697988153e-01f,
-    1.618701696e+00f,
-    7.768286467e-01f,
-    6.098535061e-01f,
-    7.202740908e-01f,
-    1.024204254e+00f,
-    5.771901831e-02f,
-    2.585030496e-01f,
-    9.180144072e-01f,
-    7.764994632e-03f,
-    1.068019345e-01f,
-    2.841852188e+01f,
-    1.503882885e+01f,
-    1.212399769e+01f,
-    2.093590736e+00f,
-    4.019038379e-02f,
-    7.454128563e-02f,
-    7.853673697e-01f,
-    1.597872674e-01f,
-    2.452276051e-01f,
-    7.167298794e-01f,
-    1.048071265e+00f,
-    5.833718181e-01f,
-    2.196067572e-01f,
-    7.646512706e-03f,
-    5.655158684e-02f,
-    1.270683765e+00f,
-    4.390560091e-02f,
-    3.490552008e-01f,
-    1.689495593e-01f,
-    1.078839588e+01f,
-    1.519496087e-02f,
-    1.175912842e-01f,
-    2.238245681e-02f,
-    4.295678735e-01f,
-    2.201033011e-02f,
-    6.667320728e-01f,
-    5.438424647e-03f,
-    2.188149467e-02f,
-    4.010165483e-02f,
-    4.437112063e-02f,
-    5.252303556e-02f,
-    4.748373479e-02f,
-    1.004245877e-01f,
-    2.903999202e-02f,
-    1.859570295e-01f,
-    1.275250409e-02f,
-    2.845489420e-02f,
-    2.384975851e-01f,
-    3.748217598e-02f,
-    3.161815554e-02f,
-    1.928796060e-03f,
-    2.573119926e+01f,
-    2.479150200e+01f,
-    1.472624397e+01f,
-    3.164054871e+00f,
-    3.868001223e+00f,
-    2.866401911e+00f,
-    1.843972206e+01f,
-    2.352665901e+01f,
-    3.085821724e+01f,
-    1.620933914e+01f,
-    2.995410919e+01f,
-    1.740619278e+01f,
-    6.914406586e+01f,
-    4.088693857e-01f,
-    1.986245537e+01f,
-    4.132360458e+01f,
-    3.155961609e+01f,
-    5.404362869e+01f,
-    1.389927149e+00f,
-    4.452174529e-02f,
-    2.269091457e-01f,
-    8.133529663e+01f,
-    1.169323921e+01f,
-    1.144890289e+02f,
-    2.923715591e+00f,
-    1.274696350e+00f,
-    1.559891605e+01f,
-    3.496047974e+00f,
-    4.975351334e+00f,
-    2.151094675e+00f,
-    3.172014713e+00f,
-    9.159241676e+00f,
-    6.461504936e+00f,
-    1.573789215e+01f,
-    1.226139665e+00f,
-    1.269408035e+01f,
-    3.050033092e+00f,
-    9.220065475e-01f,
-    2.086300254e-01f,
-    1.003667235e+00f,
-    5.730509758e-01f,
-    1.000755119e+01f,
-    2.063493729e+00f,
-    6.826444864e-01f,
-    2.987947688e-02f,
-    8.153099567e-02f,
-    2.555482388e+00f,
-    1.590188622e+00f,
-    1.227775002e+01f,
-    3.186160803e+00f,
-    1.007291004e-01f,
-    3.893953562e-01f,
-    2.228760123e-01f,
-    1.554967880e+01f,
-    1.061149883e+01f,
-    1.220458221e+01f,
-    1.512428671e-01f,
-    7.935601473e-01f,
-    2.480965108e-01f,
-    5.937642604e-02f,
-    2.169358879e-01f,
-    4.132860303e-01f,
-    1.426780319e+01f,
-    3.670207739e+00f,
-    4.052946091e+00f,
-    1.608563028e-02f,
-    2.166986912e-01f,
-    4.154883698e-02f,
-    1.171124801e-01f,
-    1.851142049e+00f,
-    4.452900589e-02f,
-    1.065228134e-01f,
-    1.333216906e+00f,
-    1.361416578e-01f,
-    1.899035424e-01f,
-    5.683419108e-01f,
-    8.053551316e-01f,
-    1.922712177e-01f,
-    4.407462478e-01f,
-    5.933746230e-03f,
-    1.761267520e-02f,
-    2.379036903e+00f,
-    2.221282385e-02f,
-    6.253983080e-02f,
-    8.904077113e-02f,
-    8.316323757e-01f,
-    6.312188506e-01f,
-    4.102883041e-01f,
-    3.451497108e-02f,
-    3.438302279e-01f,
-    5.366063863e-02f,
-    6.515181661e-01f,
-    5.484349653e-02f,
-    1.011925861e-01f,
-    1.789320260e-01f,
-    1.766525060e-01f,
-    6.883087754e-02f,
-    1.282796450e-02f,
-    7.647434235e+00f,
-    3.899251699e+00f,
-    1.010108185e+01f,
-    5.821753979e+00f,
-    6.754198074e+00f,
-    4.685287952e+00f,
-    2.133818626e+01f,
-    3.738724947e+00f,
-    1.145821190e+01f,
-    8.260083199e+00f,
-    3.006459713e+00f,
-    8.473937988e+00f,
-    6.206789017e+00f,
-    2.301242113e+00f,
-    2.756563187e+00f,
-    1.868878603e+00f,
-    1.155383587e+00f,
-    3.134520531e+00f,
-    1.799832726e+01f,
-    1.513354683e+01f,
-    1.595066833e+01f,
-    8.086393356e+00f,
-    3.157832146e+00f,
-    2.031776428e+01f,
-    8.324551582e-01f,
-    5.410944366e+01f,
-    4.648368073e+01f,
-    4.462474823e+01f,
-    7.068068504e+00f,
-    1.208188057e+01f,
-    5.083158493e+00f,
-    2.861243248e+01f,
-    1.447941971e+01f,
-    3.902636719e+01f,
-    1.770981598e+01f,
-    3.905223465e+01f,
-    5.010354996e+01f,
-    2.339111900e+01f,
-    7.498822212e-01f,
-    1.149315548e+01f,
-    4.201785278e+01f,
-    8.584695435e+01f,
-    9.386908722e+01f,
-    1.964985013e+00f,
-    5.495362729e-02f,
-    2.130310833e-01f,
-    5.485173798e+01f,
-    9.582180023e+00f,
-    6.440265656e+01f,
-    6.583996296e+00f,
-    1.968485451e+01f,
-    7.745285511e+00f,
-    1.467622375e+01f,
-    4.766012669e+00f,
-    6.185978413e+00f,
-    4.050725460e+00f,
-    8.837678528e+01f,
-    4.686213303e+01f,
-    2.393658142e+02f,
-    1.833789062e+01f,
-    6.001823425e+00f,
-    5.542828369e+01f,
-    2.032964516e+01f,
-    1.263240814e+01f,
-    5.191163940e+02f,
-    1.011398697e+01f,
-    1.233589935e+01f,
-    1.211633530e+02f,
-    1.814724207e+00f,
-    4.862341583e-01f,
-    1.753888845e+00f,
-    1.150744400e+02f,
-    6.312183380e+01f,
-    1.149681055e+04f,
-    2.408671379e+01f,
-    5.908819437e-01f,
-    4.182122052e-01f,
-    3.474261165e-01f,
-    2.129676491e-01f,
-    3.076681867e-02f,
-    4.425912201e-01f,
-    1.156348176e-02f,
-    4.237005711e-01f,
-    7.782060653e-02f,
-    2.819069326e-01f,
-    8.323078156e-01f,
-    9.564688802e-02f,
-    5.967936292e-02f,
-    1.360347867e-01f,
-    1.063562110e-01f,
-    1.218326315e-01f,
-    4.499085993e-02f,
-    9.710168815e-04f,
-    8.893914223e-01f,
-    4.632173538e+00f,
-    1.229976654e+00f,
-    7.468153477e+00f,
-    6.423226833e+00f,
-    1.357181263e+01f,
-    1.716476083e+00f,
-    2.437903881e+00f,
-    1.864687681e+00f,
-    8.718392849e-01f,
-    1.647764325e+00f,
-    1.772526383e+00f,
-    4.417321384e-01f,
-    6.698639989e-01f,
-    5.092215538e-01f,
-    3.316368461e-01f,
-    1.079872370e+00f,
-    3.827605546e-01f,
-    1.633534908e+00f,
-    6.407722235e-01f,
-    6.729109287e-01f,
-    2.994327247e-01f,
-    1.217373729e+00f,
-    6.424115896e-01f,
-    1.436467290e+00f,
-    1.303324890e+01f,
-    1.593888760e+01f,
-    2.163030815e+01f,
-    9.121521711e-01f,
-    1.583675742e+00f,
-    1.657591939e+00f,
-    2.136993027e+01f,
-    7.394963741e+00f,
-    3.172076225e+01f,
-    1.863786888e+01f,
-    3.777890396e+01f,
-    4.557883453e+01f,
-    4.312468338e+01f,
-    4.685755074e-01f,
-    7.403805542e+01f,
-    3.362645721e+01f,
-    3.264053726e+01f,
-    9.582808685e+01f,
-    8.346616030e-01f,
-    5.468899012e-02f,
-    5.581066385e-02f,
-    8.279763031e+01f,
-    4.484021664e+00f,
-    1.809474030e+02f,
-    5.305090547e-01f,
-    4.974049568e+00f,
-    1.295802593e+01f,
-    1.884995651e+01f,
-    1.016180801e+01f,
-    1.991083527e+01f,
-    1.670872116e+01f,
-    2.244696236e+01f,
-    3.038831711e+01f,
-    1.148482056e+02f,
-    4.405044556e+00f,
-    1.250360775e+01f,
-    1.100956154e+01f,
-    4.235043526e+00f,
-    7.413610220e-01f,
-    3.027081966e+00f,
-    1.684672356e+00f,
-    1.619566345e+01f,
-    2.127315521e+01f,
-    3.027765989e+00f,
-    2.082003802e-01f,
-    9.894462228e-01f,
-    5.372415066e+00f,
-    2.393597603e+01f,
-    6.740567017e+01f,
-    3.852993488e+00f,
-    1.497976303e+00f,
-    1.464896202e+00f,
-    1.081286430e+01f,
-    1.447434068e+00f,
-    2.731554270e+00f,
-    1.171959877e+00f,
-    6.130481958e-01f,
-    1.652012348e+00f,
-    1.739890873e-01f,
-    9.473384857e+00f,
-    2.937196016e+00f,
-    3.984225988e+00f,
-    4.425431728e+00f,
-    1.237343502e+01f,
-    5.738934040e+00f,
-    1.708898354e+01f,
-    1.793036938e+00f,
-    1.119305992e+01f,
-    1.381639194e+01f,
-    8.603139877e+00f,
-    1.384225464e+01f,
-    1.966708946e+01f,
-    1.193727684e+01f,
-    1.953443336e+01f,
-    8.241761208e+00f,
-    1.086161804e+01f,
-    2.964199448e+01f,
-    1.521288776e+01f,
-    3.146207047e+01f,
-    1.630535698e+01f,
-    1.546539593e+01f,
-    6.489406586e+01f,
-    7.570983887e+01f,
-    2.995846987e+00f,
-    1.731668830e+00f,
-    1.025438190e+00f,
-    1.246750355e+00f,
-    1.055855560e+01f,
-    7.477744102e+00f,
-    8.337437630e+00f,
-    1.549721837e+00f,
-    4.183320045e+00f,
-    1.288674474e+00f,
-    9.732547760e+00f,
-    1.224473381e+01f,
-    6.289771080e+00f,
-    1.446254253e+00f,
-    1.488290787e+00f,
-    1.251924396e+00f,
-    1.215688801e+01f,
-    3.707840443e+00f,
-    1.311799407e+00f,
-    3.028732872e+01f,
-    6.556196690e+00f,
-    2.950276756e+01f,
-    3.236251068e+01f,
-    1.217984915e+00f,
-    1.891360092e+01f,
-    2.076922417e+01f,
-    2.441595268e+01f,
-    1.128530045e+02f,
-    8.300738335e-01f,
-    1.580831170e+00f,
-    2.416627884e+00f,
-    6.864220428e+01f,
-    2.586479950e+01f,
-    1.018049088e+02f,
-    9.599946141e-01f,
-    1.248190594e+01f,
-    1.679550529e+00f,
-    6.501659393e+00f,
-    1.732025719e+01f,
-    1.736171722e+01f,
-    4.860322571e+01f,
-    1.226199627e+01f,
-    1.318254280e+01f,
-    1.931318092e+01f,
-    3.716933060e+01f,
-    1.711233330e+01f,
-    3.900106812e+01f,
-    1.857517242e+01f,
-    3.404902267e+01f,
-    5.540439606e+01f,
-    1.153241873e+00f,
-    1.674787903e+01f,
-    5.637995005e-01f,
-    5.526315570e-01f,
-    8.307134628e+00f,
-    1.608415604e+01f,
-    2.433024597e+01f,
-    5.759986043e-01f,
-    3.637100935e+00f,
-    2.574804783e+00f,
-    3.189714622e+01f,
-    1.450277567e+00f,
-    3.418435752e-01f,
-    3.942615271e+00f,
-    1.490920663e+00f,
-    1.528540134e+01f,
-    1.981093788e+01f,
-    1.379864120e+01f,
-    5.072106552e+01f,
-    3.514071655e+01f,
-    1.497410583e+01f,
-    4.518587494e+01f,
-    4.472846375e+02f,
-    8.919646144e-01f,
-    2.774649382e+00f,
-    1.984179497e+00f,
-    1.142776251e+00f,
-    1.110892410e+02f,
-    4.745875359e+00f,
-    7.336268616e+01f,
-    1.473490596e+00f,
-    1.780483961e+00f,
-    1.577026558e+01f,
-    4.876335144e+00f,
-    6.613957214e+01f,
-    1.028173733e+01f,
-    1.177110100e+01f,
-    9.714134216e+00f,
-    3.243057728e+00f,
-    7.185949802e+00f,
-    6.850066662e+00f,
-    1.122601032e+01f,
-    1.002253246e+01f,
-    7.417268753e+00f,
-    9.193886757e+00f,
-    7.279935360e+00f,
-    1.607783318e+01f,
-    1.663189125e+01f,
-    2.500240898e+01f,
-    7.382287502e+00f,
-    6.909449100e+00f,
-    2.044706154e+01f,
-    1.572007599e+02f,
-    3.263551712e+01f,
-    1.547350311e+02f,
-    2.282038927e+00f,
-    3.640112281e-01f,
-    2.667045832e+00f,
-    4.998756349e-01f,
-    1.728820205e-01f,
-    1.212258101e+00f,
-    3.105961084e-01f,
-    1.643040848e+01f,
-    1.297740173e+01f,
-    6.233979702e+00f,
-    1.342310548e+00f,
-    3.725489616e+00f,
-    9.830964804e-01f,
-    3.381327167e-02f,
-    9.381498694e-01f,
-    7.094348967e-02f,
-    2.569178963e+01f,
-    4.330465794e+00f,
-    1.487647629e+01f,
-    2.554965615e-01f,
-    4.038700104e+00f,
-    5.512368083e-01f,
-    5.022579432e-01f,
-    3.211634445e+01f,
-    2.322715569e+01f,
-    3.233982849e+01f,
-    3.254181623e+00f,
-    1.548913479e+01f,
-    6.424252033e+00f,
-    6.461956024e+01f,
-    2.144398689e+01f,
-    2.950517273e+01f,
-    2.690993309e+01f,
-    1.714711189e+01f,
-    3.087818336e+01f,
-    4.206443024e+01f,
-    7.084813714e-01f,
-    1.454778481e+01f,
-    1.638535500e+01f,
-    1.162955666e+01f,
-    4.461125946e+01f,
-    4.549970150e+00f,
-    1.580472887e-01f,
-    3.223051131e-01f,
-    6.049951553e+01f,
-    1.228683949e+01f,
-    6.184326935e+01f,
-    2.410749197e+00f,
-    9.029581547e-01f,
-    1.871376801e+01f,
-    3.947704792e+00f,
-    1.367322350e+01f,
-    2.501839399e+00f,
-    4.487378120e+00f,
-    7.084068775e+00f,
-    2.931170702e+00f,
-    8.574913025e+00f,
-    1.539770961e+00f,
-    6.732088089e+00f,
-    3.632796288e+00f,
-    1.489449739e+00f,
-    1.369559765e-01f,
-    1.096776843e+00f,
-    3.704783916e-01f,
-    5.320714474e+00f,
-    1.093197823e+00f,
-    5.786629915e-01f,
-    8.584791422e-02f,
-    1.496073604e-01f,
-    5.420988798e-01f,
-    3.155108690e+00f,
-    2.322756767e+00f,
-    4.729866982e-01f,
-    6.278021932e-01f,
-    1.079422116e+00f,
-    8.073573112e-01f,
-    4.474776745e+00f,
-    3.854018688e+00f,
-    4.130767822e+00f,
-    4.924703240e-01f,
-    1.165996313e+00f,
-    5.854136348e-01f,
-    1.163033247e-01f,
-    5.259267092e-01f,
-    2.691942453e-01f,
-    1.105359745e+01f,
-    6.143969059e+00f,
-    1.819395638e+01f,
-    2.049821168e-01f,
-    8.705908656e-01f,
-    2.628826201e-01f,
-    1.213933706e+00f,
-    3.562141895e+00f,
-    3.427024603e+00f,
-    6.661011696e+00f,
-    4.970578671e+00f,
-    3.949144363e+00f,
-    4.080760956e+00f,
-    1.330288219e+01f,
-    8.607534409e+00f,
-    9.605398178e+00f,
-    6.855110168e+00f,
-    5.530798912e+00f,
-    1.531088161e+01f,
-    2.722964478e+01f,
-    1.723458862e+01f,
-    2.193818474e+01f,
-    1.625973821e+00f,
-    1.336010933e+00f,
-    4.666445255e+00f,
-    1.413500190e+00f,
-    1.756526679e-01f,
-    9.055264592e-01f,
-    5.236129761e-01f,
-    6.724645615e+00f,
-    3.959687233e+00f,
-    1.634907150e+01f,
-    2.661454916e+00f,
-    6.621038437e+00f,
-    8.315936923e-01f,
-    7.769847512e-01f,
-    4.756216526e+00f,
-    2.104037046e+00f,
-    3.059638023e+00f,
-    5.987157822e+00f,
-    7.589658260e+00f,
-    8.419915199e+00f,
-    6.702633381e+00f,
-    1.798700571e+00f,
-    3.576538563e+00f,
-    6.848887444e+00f,
-    1.807086349e+00f,
-    2.941995859e+00f,
-    1.217992544e+00f,
-    1.636748314e+00f,
-    1.677750111e+00f,
-    9.287517667e-01f,
-    8.551976085e-01f,
-    1.189705610e+00f,
-    9.679063797e+00f,
-    3.761221886e+00f,
-    8.443954468e+00f,
-    3.182438612e+00f,
-    1.135583520e+00f,
-    2.551241398e+00f,
-    1.397015810e+00f,
-    2.009251022e+01f,
-    2.067102051e+01f,
-    9.642115021e+01f,
-    5.308176517e+00f,
-    8.775254250e+00f,
-    9.889017105e+00f,
-    2.219815063e+01f,
-    1.061122322e+01f,
-    5.090258789e+01f,
-    1.473785305e+01f,
-    1.286542225e+01f,
-    2.673029518e+01f,
-    1.533848190e+01f,
-    7.642198801e-01f,
-    1.826110268e+01f,
-    1.797755241e+01f,
-    1.389053917e+01f,
-    7.715126801e+01f,
-    3.322952509e+00f,
-    1.807514876e-01f,
-    2.266547084e-01f,
-    2.174434090e+01f,
-    1.596778679e+01f,
-    8.166383362e+01f,
-    6.085927486e+00f,
-    1.373560715e+01f,
-    3.957062244e+00f,
-    5.581042862e+01f,
-    5.106265068e+00f,
-    1.491150665e+01f,
-    9.089444160e+00f,
-    2.874549866e+01f,
-    2.074284744e+01f,
-    1.114433823e+02f,
-    1.132295322e+01f,
-    6.716553211e+00f,
-    1.871033287e+01f,
-    1.395998764e+01f,
-    1.214015007e+01f,
-    1.190544033e+01f,
-    4.024452686e+00f,
-    5.755694389e+00f,
-    2.553897095e+01f,
-    1.318597078e+00f,
-    6.351686120e-01f,
-    2.201126099e+00f,
-    2.188809204e+01f,
-    8.015384674e+01f,
-    1.216694214e+03f,
-    1.632721519e+01f,
-    1.247089580e-01f,
-    3.719434142e-01f,
-    3.722975254e-01f,
-    1.140545845e+01f,
-    8.495125771e+00f,
-    1.083964157e+01f,
-    5.217521638e-02f,
-    3.426143825e-01f,
-    5.126611516e-02f,
-    2.830906808e-01f,
-    6.358723640e+00f,
-    1.801589966e+00f,
-    6.044162750e+00f,
-    8.019104004e+01f,
-    6.014195442e+00f,
-    1.201898422e+02f,
-    1.255208015e+00f,
-    7.100691199e-01f,
-    5.557256699e+00f,
-    5.423346758e-01f,
-    4.177262783e-01f,
-    5.360694528e-01f,
-    2.119974852e+00f,
-    6.133275032e-01f,
-    4.454734039e+01f,
-    8.840974426e+01f,
-    8.022829437e+01f,
-    6.449339986e-01f,
-    1.461957932e+00f,
-    9.698421955e-01f,
-    6.877874732e-01f,
-    2.284514666e+00f,
-    8.579630852e-01f,
-    3.596954942e-01f,
-    6.018533707e-01f,
-    1.131369948e+00f,
-    1.899877042e-01f,
-    6.452055573e-01f,
-    2.057586163e-01f,
-    9.971997738e-01f,
-    1.794868469e+00f,
-    4.351299703e-01f,
-    2.067089230e-01f,
-    9.621956348e-01f,
-    4.539461434e-01f,
-    6.930354238e-01f,
-    2.642000580e+01f,
-    2.427542686e+01f,
-    9.293877411e+01f,
-    2.336251020e+00f,
-    2.176029682e+00f,
-    5.044410229e+00f,
-    3.248150635e+01f,
-    2.110655975e+01f,
-    1.797297668e+02f,
-    1.620779610e+01f,
-    4.041311646e+01f,
-    3.961502838e+01f,
-    6.533128357e+01f,
-    4.770713747e-01f,
-    2.745700645e+01f,
-    9.404107666e+01f,
-    7.493959045e+01f,
-    5.054374390e+02f,
-    9.199375510e-01f,
-    8.226448298e-02f,
-    1.272508204e-01f,
-    1.872164612e+02f,
-    1.440965462e+01f,
-    5.520097656e+02f,
-    1.399075866e+00f,
-    2.159810066e+00f,
-    1.910095406e+01f,
-    8.197853088e+00f,
-    8.035153198e+01f,
-    1.952326355e+02f,
-    4.393863525e+02f,
-    2.192638779e+01f,
-    4.786631393e+01f,
-    2.611258545e+02f,
-    2.203279734e+00f,
-    2.008680534e+01f,
-    5.810211658e+00f,
-    2.197859287e+00f,
-    4.092156887e-01f,
-    1.809036851e+00f,
-    5.187213421e-01f,
-    8.055948257e+00f,
-    6.909699917e+00f,
-    3.131117582e+00f,
-    2.199096382e-01f,
-    7.538147569e-01f,
-    1.986614585e+00f,
-    5.262215042e+01f,
-    3.745697784e+01f,
-    1.257395864e+00f,
-    1.894550771e-02f,
-    2.484253168e+00f,
-    1.905857682e+00f,
-    8.541179657e+00f,
-    5.918928981e-01f,
-    3.903555155e+00f,
-    6.817797422e-01f,
-    2.785960436e-01f,
-    1.532937169e+00f,
-    1.099642068e-01f,
-    6.036598682e-01f,
-    4.793809891e+00f,
-    8.741218448e-01f,
-    3.783919144e+01f,
-    2.131436539e+01f,
-    1.418236732e+01f,
-    8.374593258e-01f,
-    1.713725686e+00f,
-    1.651065588e+00f,
-    1.179435015e+00f,
-    4.518249989e+00f,
-    2.842812300e+00f,
-    7.829655409e-01f,
-    2.671022415e-01f,
-    6.457358003e-01f,
-    2.534134388e-01f,
-    2.337215185e+00f,
-    3.752106428e-01f,
-    1.166370749e+00f,
-    4.726848006e-01f,
-    1.367608309e-01f,
-    9.846884012e-02f,
-    4.117752314e-01f,
-    8.849256635e-01f,
-    7.870243192e-01f,
-    1.480346322e+00f,
-    1.014164805e+00f,
-    2.532140255e+00f,
-    2.232059479e+01f,
-    1.655006599e+01f,
-    1.663041878e+01f,
-    5.419633389e-01f,
-    8.651240468e-01f,
-    1.095712185e+00f,
-    1.036277771e+01f,
-    1.026306248e+01f,
-    8.099320412e+00f,
-    1.203515053e+00f,
-    5.290265083e-01f,
-    3.673442006e-01f,
-    3.415822744e+00f,
-    5.037477016e-01f,
-    2.963877618e-01f,
-    1.445904613e+00f,
-    1.910497546e+00f,
-    1.364730716e+00f,
-    5.867543221e-01f,
-    2.378670685e-02f,
-    3.496278450e-02f,
-    2.320848554e-01f,
-    7.804385424e-01f,
-    3.048684597e-01f,
-    7.771822810e-01f,
-    1.019818902e+00f,
-    4.642034769e-01f,
-    2.862469852e-01f,
-    4.060494900e-02f,
-    2.523917891e-02f,
-    1.115617305e-01f,
-    1.620693922e+00f,
-    2.962881327e+00f,
-    1.282423258e+00f,
-    9.000567794e-01f,
-    4.122455716e-01f,
-    7.936888337e-01f,
-    2.778922617e-01f,
-    7.142553926e-01f,
-    5.005654097e-01f,
-    1.038787007e+00f,
-    8.882859945e-01f,
-    3.568222821e-01f,
-    1.535417289e-01f,
-    7.300579548e-01f,
-    5.271013379e-01f,
-    1.819532156e+00f,
-    1.526614279e-01f,
-    4.283078194e+00f,
-    2.087427676e-02f,
-    2.705487609e-01f,
-    1.428612918e-01f,
-    2.414640188e-01f,
-    5.848051906e-01f,
-    1.711649299e+00f,
-    6.823728085e-01f,
-    2.480824590e-01f,
-    5.724796280e-02f,
-    1.666125469e-02f,
-    1.453319490e-01f,
-    9.446890950e-01f,
-    5.696076751e-01f,
-    3.667955995e-01f,
-    3.297873437e-01f,
-    3.876154721e-01f,
-    1.255946606e-01f,
-    1.032581553e-01f,
-    9.460283518e-01f,
-    2.006379664e-01f,
-    3.188189268e-01f,
-    1.244727492e+00f,
-    7.652145624e-01f,
-    6.816008687e-01f,
-    9.416538477e-02f,
-    8.704254031e-02f,
-    1.556315646e-02f,
-    4.500962421e-02f,
-    7.982414365e-01f,
-    6.261318326e-01f,
-    4.226789773e-01f,
-    8.427552581e-01f,
-    3.413936198e-01f,
-    6.333200336e-01f,
-    1.144633102e+01f,
-    1.297340488e+01f,
-    9.114087105e+00f,
-    5.523508549e+00f,
-    3.357757628e-01f,
-    8.260996938e-01f,
-    2.006095886e+00f,
-    6.049938202e-01f,
-    7.322186232e-01f,
-    1.320085406e+00f,
-    1.490560532e+00f,
-    6.776388288e-01f,
-    1.735294819e+00f,
-    1.784779280e-01f,
-    6.457391977e-01f,
-    4.319730282e+00f,
-    5.311205387e-01f,
-    1.804964066e+00f,
-    2.489166975e+00f,
-    2.233079076e-01f,
-    2.508936822e-01f,
-    1.412489265e-01f,
-    5.017867684e-02f,
-    4.304997325e-01f,
-    1.327748895e-01f,
-    1.043982267e+00f,
-    2.102476656e-01f,
-    2.219882160e-01f,
-    1.423764974e-01f,
-    3.530379832e-01f,
-    1.480404437e-01f,
-    2.847292461e-02f,
-    3.126793802e-01f,
-    6.240119413e-02f,
-    4.123102129e-01f,
-    7.208314538e-02f,
-    1.483108997e-01f,
-    2.597273588e-01f,
-    1.064583734e-01f,
-    1.001186818e-01f,
-    1.804779284e-02f,
-    1.527915192e+01f,
-    1.839410973e+01f,
-    3.361332703e+01f,
-    1.751798511e+00f,
-    7.685825825e-01f,
-    1.602599502e+00f,
-    5.268416595e+01f,
-    1.464775467e+01f,
-    6.021648407e+01f,
-    1.028550816e+01f,
-    1.566338921e+01f,
-    1.145386314e+01f,
-    1.076624489e+01f,
-    4.629704356e-01f,
-    3.235156775e+00f,
-    1.486793041e+01f,
-    2.009759903e+01f,
-    8.202777863e+00f,
-    8.458383083e-01f,
-    3.700261191e-02f,
-    2.085965276e-01f,
-    6.595182896e+00f,
-    1.239699721e+00f,
-    9.996295929e+00f,
-    5.755896568e+00f,
-    4.988388121e-01f,
-    3.041026592e+00f,
-    1.202908397e+00f,
-    2.159605503e+00f,
-    1.453520060e-01f,
-    3.275407553e-01f,
-    1.851570249e+00f,
-    1.401428461e+00f,
-    3.861707687e+00f,
-    4.212056994e-01f,
-    2.254041672e+00f,
-    7.111528516e-01f,
-    2.620062232e-01f,
-    3.871042728e-01f,
-    4.088180959e-01f,
-    3.416151106e-01f,
-    1.372308350e+01f,
-    4.262917936e-01f,
-    4.181297719e-01f,
-    2.193927318e-01f,
-    1.214006841e-01f,
-    3.519317210e-01f,
-    5.197612643e-01f,
-    5.128065348e-01f,
-    7.499838620e-02f,
-    1.025749445e-01f,
-    9.185876846e-01f,
-    3.381130695e-01f,
-    3.696978760e+01f,
-    1.008477688e+01f,
-    1.428122902e+01f,
-    1.127438918e-01f,
-    8.917543888e-01f,
-    1.824613661e-01f,
-    1.292119920e-01f,
-    2.476403713e-01f,
-    3.263729215e-01f,
-    1.060530472e+01f,
-    2.503396273e+00f,
-    4.519979000e+00f,
-    3.573486954e-02f,
-    4.888500273e-01f,
-    1.052038223e-01f,
-    3.727323711e-01f,
-    1.094677067e+01f,
-    1.786486953e-01f,
-    4.618386328e-01f,
-    2.836590767e+00f,
-    3.387560546e-01f,
-    5.266324282e-01f,
-    9.634484649e-01f,
-    1.007422328e+00f,
-    2.113107443e-01f,
-    2.517674446e+00f,
-    1.118710190e-01f,
-    2.167962641e-01f,
-    2.470711231e+00f,
-    2.994863391e-01f,
-    6.379016042e-01f,
-    8.675941825e-01f,
-    5.857814550e-01f,
-    1.668228030e+00f,
-    6.681205630e-01f,
-    7.598085701e-02f,
-    1.488939524e-01f,
-    1.710620075e-01f,
-    1.346160054e+00f,
-    4.207653105e-01f,
-    6.463180780e-01f,
-    1.933858991e-01f,
-    2.254624814e-01f,
-    1.874166280e-01f,
-    7.318029553e-02f,
-    1.077644348e+00f,
-    6.141585708e-01f,
-    1.424230218e+00f,
-    1.921267128e+01f,
-    1.953494072e+01f,
-    1.043815708e+01f,
-    1.387667942e+01f,
-    6.174825191e+00f,
-    7.874614239e+00f,
-    1.808502197e+00f,
-    2.203751564e+00f,
-    2.275506020e+00f,
-    6.720412374e-01f,
-    1.134012818e+00f,
-    7.718342543e-01f,
-    5.206143260e-01f,
-    9.591451883e-01f,
-    7.817435265e-01f,
-    1.506196976e+01f,
-    6.066966534e+00f,
-    7.783350945e+00f,
-    2.402945042e+00f,
-    3.889799356e+00f,
-    2.726330042e+00f,
-    4.108990729e-01f,
-    4.817227936e+01f,
-    2.849893951e+01f,
-    9.639057922e+01f,
-    2.253765583e+00f,
-    6.400719881e-01f,
-    2.737590551e+00f,
-    4.595047760e+01f,
-    1.577478218e+01f,
-    1.381748199e+02f,
-    1.654320526e+01f,
-    2.691695404e+01f,
-    6.836807251e+01f,
-    1.802967072e+01f,
-    6.434138417e-01f,
-    5.825658798e+00f,
-    7.369728088e+01f,
-    3.091754341e+01f,
-    5.054265976e+01f,
-    1.689134598e+00f,
-    4.950247705e-02f,
-    5.993388593e-02f,
-    9.720322609e+00f,
-    2.021133661e+00f,
-    1.196956062e+01f,
-    5.890937805e+00f,
-    1.066746807e+01f,
-    8.942964554e+00f,
-    6.104940033e+01f,
-    1.514245796e+01f,
-    3.878781128e+01f,
-    3.080111122e+01f,
-    5.064578247e+01f,
-    5.135964584e+01f,
-    4.420820618e+02f,
-    1.380943966e+01f,
-    9.988438606e+00f,
-    9.941080093e+00f,
-    2.439358950e+00f,
-    1.158749390e+01f,
-    1.907874823e+00f,
-    1.189126134e+00f,
-    4.557322693e+01f,
-    6.658551216e+00f,
-    2.386909246e+00f,
-    5.183898211e-01f,
-    1.153535128e+00f,
-    1.064519405e+01f,
-    2.472468948e+01f,
-    2.443303833e+02f,
-    7.008010864e+00f,
-    8.027041554e-01f,
-    6.907912493e-01f,
-    5.055005550e-01f,
-    1.223066211e+00f,
-    4.561309516e-02f,
-    3.625156879e-01f,
-    4.341153428e-02f,
-    1.327996612e+00f,
-    9.014587849e-02f,
-    2.851330936e-01f,
-    1.023494482e+00f,
-    1.799216866e-01f,
-    3.560296297e-01f,
-    2.031934023e+00f,
-    1.719109863e-01f,
-    1.698110104e-01f,
-    1.558259130e-01f,
-    1.293743774e-02f,
-    1.573397219e-01f,
-    8.513451219e-01f,
-    2.730602324e-01f,
-    7.037401676e+00f,
-    7.215670109e+00f,
-    9.499501228e+00f,
-    3.479142487e-01f,
-    1.745746374e+00f,
-    6.348586679e-01f,
-    2.360136807e-01f,
-    6.644452810e-01f,
-    3.971557915e-01f,
-    1.785815507e-01f,
-    3.528108299e-01f,
-    3.704456985e-01f,
-    1.211246327e-01f,
-    4.897575676e-01f,
-    1.350724697e-01f,
-    6.275093555e-01f,
-    5.275530815e-01f,
-    2.530793846e-01f,
-    1.721595526e-01f,
-    1.152385831e+00f,
-    1.726878583e-01f,
-    6.220162511e-01f,
-    2.071466827e+01f,
-    1.170203876e+01f,
-    3.941355896e+01f,
-    7.618008852e-01f,
-    2.232800424e-01f,
-    3.852836490e-01f,
-    1.512113667e+01f,
-    2.499097586e+00f,
-    2.515145493e+01f,
-    2.526079941e+01f,
-    1.508908081e+01f,
-    1.232056236e+01f,
-    5.157859802e+00f,
-    5.498555303e-01f,
-    1.133260727e+00f,
-    9.395110130e+00f,
-    8.438032150e+00f,
-    1.216190338e+01f,
-    2.111078948e-01f,
-    1.624979675e-01f,
-    3.049223721e-01f,
-    5.563993931e+00f,
-    1.217060208e+00f,
-    2.032133341e+00f,
-    3.116833270e-01f,
-    1.513549924e+00f,
-    1.066772175e+01f,
-    4.836295128e+00f,
-    1.527503681e+01f,
-    4.314859390e+00f,
-    8.815594673e+00f,
-    5.196051121e+00f,
-    2.000226021e+01f,
-    2.102782822e+01f,
-    6.065246463e-01f,
-    9.275588036e+00f,
-    2.408401728e+00f,
-    3.000114262e-01f,
-    7.404150367e-01f,
-    4.994454384e-01f,
-    9.466713071e-01f,
-    2.576285839e+00f,
-    5.714077353e-01f,
-    9.728420377e-01f,
-    2.414937019e-01f,
-    2.559398711e-01f,
-    2.599895298e-01f,
-    8.195293546e-01f,
-    1.700245500e+00f,
-    2.845396399e-01f,
-    4.232881665e-01f,
-    6.550499201e-01f,
-    2.479872465e+00f,
-    7.319096923e-01f,
-    2.591229081e-01f,
-    1.994288266e-01f,
-    8.388412595e-01f,
-    2.827793658e-01f,
-    1.702572964e-02f,
-    9.540351629e-01f,
-    1.138073444e+01f,
-    6.280618906e-01f,
-    1.602508926e+01f,
-    3.078722191e+01f,
-    1.870741653e+01f,
-    2.011257410e+00f,
-    8.415734291e+00f,
-    5.683670521e+00f,
-    9.154148102e-01f,
-    4.906146049e+00f,
-    2.141243696e+00f,
-    3.905746043e-01f,
-    7.610972524e-01f,
-    8.114505410e-01f,
-    2.874270082e-01f,
-    3.918636084e+00f,
-    5.154699683e-01f,
-    2.830018282e+00f,
-    1.845871091e+00f,
-    8.101715446e-01f,
-    5.632149577e-01f,
-    1.097586393e+00f,
-    1.056011677e+00f,
-    8.606395125e-01f,
-    1.880131960e+00f,
-    1.083931804e+00f,
-    7.074353695e-01f,
-    1.461995506e+01f,
-    1.291885567e+01f,
-    1.545784283e+01f,
-    1.461001039e+00f,
-    1.796899915e+00f,
-    1.472736478e+00f,
-    6.711562157e+00f,
-    1.020248508e+01f,
-    6.633917809e+00f,
-    1.983434677e+00f,
-    1.456122518e+00f,
-    1.137799740e+00f,
-    4.727903366e+00f,
-    1.108259320e+00f,
-    5.456975102e-01f,
-    2.035636187e+00f,
-    3.972338915e+00f,
-    3.582988024e+00f,
-    6.791379452e-01f,
-    8.499642462e-02f,
-    1.295945942e-01f,
-    2.687314749e-01f,
-    3.326618671e+00f,
-    9.947339892e-01f,
-    5.081666708e-01f,
-    8.789898753e-01f,
-    1.355957627e+00f,
-    1.211183786e+00f,
-    1.424243301e-01f,
-    5.792170390e-02f,
-    3.494617641e-01f,
-    1.136663556e+00f,
-    1.987765193e+00f,
-    7.337101698e-01f,
-    7.836919427e-01f,
-    1.082693815e+00f,
-    9.476894736e-01f,
-    5.853028893e-01f,
-    2.801374674e+00f,
-    1.744012952e+00f,
-    2.505940199e+00f,
-    2.487211943e+00f,
-    1.698354125e+00f,
-    7.136248350e-01f,
-    2.782096148e+00f,
-    1.228858471e+00f,
-    2.267944813e+00f,
-    3.572324216e-01f,
-    4.980345070e-01f,
-    3.005556762e-02f,
-    3.224534690e-01f,
-    4.416618645e-01f,
-    2.478852868e-01f,
-    9.128169417e-01f,
-    1.002812028e+00f,
-    5.545313954e-01f,
-    3.894141912e-01f,
-    1.627246886e-01f,
-    4.505553469e-02f,
-    9.008249044e-01f,
-    2.045335919e-01f,
-    1.169247866e+00f,
-    5.113352537e-01f,
-    5.830044746e-01f,
-    6.790224910e-01f,
-    7.452546358e-01f,
-    2.854109108e-01f,
-    1.141084552e+00f,
-    2.842380404e-01f,
-    1.527649522e+00f,
-    8.847697377e-01f,
-    9.897205234e-01f,
-    9.611273408e-01f,
-    5.501917005e-01f,
-    2.024632096e-01f,
-    6.200423092e-02f,
-    4.880421162e-01f,
-    4.967873096e+00f,
-    1.729386902e+01f,
-    1.497538757e+01f,
-    1.820087194e+00f,
-    1.713733554e+00f,
-    5.490381241e+00f,
-    1.770070267e+01f,
-    4.202548981e+00f,
-    6.546784043e-01f,
-    2.750454664e+00f,
-    2.470889664e+01f,
-    7.471177578e+00f,
-    1.045129299e+01f,
-    3.639563322e+00f,
-    2.914745092e+00f,
-    1.885656714e+00f,
-    1.715061188e+01f,
-    5.205841541e+00f,
-    7.001920342e-01f,
-    2.169617653e+01f,
-    2.012022972e+00f,
-    1.556076765e+00f,
-    3.317974210e-01f,
-    2.654947937e-01f,
-    4.562203979e+01f,
-    2.056948245e-01f,
-    2.743476629e-01f,
-    4.955423474e-01f,
-    1.133358359e+00f,
-    6.104977131e-01f,
-    1.124243021e+00f,
-    2.778370678e-01f,
-    3.585621119e-01f,
-    1.323286593e-01f,
-    2.742933631e-01f,
-    1.769966483e-01f,
-    6.075297356e+00f,
-    1.501568413e+01f,
-    4.816529751e+00f,
-    6.621604443e+00f,
-    1.602648926e+01f,
-    3.739104271e+00f,
-    2.072984505e+01f,
-    7.298198223e+00f,
-    6.184453487e+00f,
-    1.081288242e+01f,
-    6.438751221e+00f,
-    5.287820816e+00f,
-    1.668433189e+01f,
-    1.384203720e+01f,
-    4.007919788e+00f,
-    3.960756540e+00f,
-    7.880699158e+00f,
-    1.452029228e+01f,
-    2.172162056e+01f,
-    9.054113388e+00f,
-    1.304105091e+01f,
-    1.182114220e+01f,
-    3.854307890e+00f,
-    4.086724222e-01f,
-    8.254801750e+00f,
-    3.269966888e+01f,
-    5.292077065e+00f,
-    2.926539660e+00f,
-    2.881829262e+01f,
-    2.255002594e+01f,
-    4.148217201e+00f,
-    8.024382782e+01f,
-    2.180871010e+00f,
-    1.978829193e+01f,
-    1.575222111e+01f,
-    2.627807617e+00f,
-    1.537053466e+00f,
-    5.703979135e-01f,
-    6.960403919e-01f,
-    7.804244012e-02f,
-    1.364481926e+01f,
-    4.270237446e+00f,
-    1.345228195e+01f,
-    7.193332911e-01f,
-    6.354942918e-01f,
-    3.332735062e+00f,
-    4.009434223e+00f,
-    1.774115682e+00f,
-    3.279378712e-01f,
-    2.062462270e-01f,
-    6.609858036e+00f,
-    1.797359705e+00f,
-    1.777332544e+00f,
-    1.888975739e+00f,
-    1.381109506e-01f,
-    7.203893661e+00f,
-    4.878382087e-01f,
-    1.985329819e+01f,
-    1.375024700e+01f,
-    3.716481924e+00f,
-    1.547118276e-01f,
-    4.289523125e+00f,
-    2.086007595e+00f,
-    7.139438391e-01f,
-    2.911466122e+00f,
-    1.119362488e-01f,
-    6.265534759e-01f,
-    1.901369393e-01f,
-    1.760943055e+00f,
-    5.794540644e-01f,
-    9.281858802e-01f,
-    1.082296371e+00f,
-    1.917582989e+00f,
-    1.270524025e+00f,
-    4.005738795e-01f,
-    6.431813538e-02f,
-    1.970514655e-01f,
-    4.192114472e-01f,
-    6.410360932e-01f,
-    1.671047211e-01f,
-    1.043945193e+00f,
-    1.851712018e-01f,
-    2.540292144e-01f,
-    1.664041877e+00f,
-    1.189307117e+01f,
-    1.064111805e+01f,
-    1.225448895e+01f,
-    5.013717651e+00f,
-    5.091165900e-01f,
-    8.653540611e+00f,
-    1.101805568e+00f,
-    1.047061920e+00f,
-    7.949814796e-01f,
-    1.313027024e+00f,
-    1.072173691e+01f,
-    2.627425909e+00f,
-    8.882301450e-01f,
-    1.119954681e+01f,
-    1.890183067e+01f,
-    6.517497063e+00f,
-    1.756136703e+01f,
-    3.779856443e+00f,
-    1.133721709e+00f,
-    1.653180569e-01f,
-    1.391361809e+01f,
-    1.480804157e+01f,
-    1.829896736e+01f,
-    1.733187675e+01f,
-    2.580323029e+01f,
-    2.076158524e+01f,
-    1.010303140e+00f,
-    2.944383240e+01f,
-    4.247828007e+00f,
-    1.555842161e+00f,
-    8.273504972e-01f,
-    1.024618506e+00f,
-    1.179626137e-01f,
-    3.786461055e-01f,
-    1.266889691e+00f,
-    3.048658669e-01f,
-    6.045575142e-01f,
-    1.106178015e-01f,
-    2.635317147e-01f,
-    8.421058655e-01f,
-    3.911573887e-01f,
-    1.188373640e-01f,
-    4.551010579e-02f,
-    2.728371620e-01f,
-    8.539246321e-01f,
-    2.906076610e-01f,
-    3.444360197e-01f,
-    1.651931047e+00f,
-    1.979632825e-01f,
-    1.437495589e+00f,
-    1.996686220e+00f,
-    3.980801105e-01f,
-    9.215126932e-02f,
-    3.443484604e-01f,
-    1.169974208e+00f,
-    8.164517283e-01f,
-    1.777996123e-01f,
-    1.369852871e-01f,
-    1.379091501e+00f,
-    2.814289927e-01f,
-    9.159219861e-01f,
-    1.409641981e+00f,
-    3.863614798e-01f,
-    5.361592174e-01f,
-    1.341619343e-01f,
-    7.233923078e-01f,
-    2.891066074e-01f,
-    3.453996778e-01f,
-    1.136984453e-01f,
-    6.898256540e-01f,
-    1.525702626e-01f,
-    2.760926485e-01f,
-    5.877789497e+00f,
-    2.168386936e+00f,
-    7.501075268e+00f,
-    5.896719456e+00f,
-    1.898286939e-01f,
-    1.510520186e-02f,
-    1.033835411e+00f,
-    4.225831851e-02f,
-    7.321707159e-02f,
-    1.366806589e-02f,
-    7.514137775e-02f,
-    9.119101524e+00f,
-    2.954997444e+01f,
-    2.496424103e+01f,
-    2.220616102e+00f,
-    3.147456408e+00f,
-    1.299134159e+01f,
-    8.537632942e+00f,
-    7.528799772e-01f,
-    5.267858505e+00f,
-    3.176009178e+00f,
-    8.297422409e+00f,
-    5.869825363e+00f,
-    6.444774628e+00f,
-    5.367235184e+00f,
-    8.878000259e+00f,
-    2.015850639e+01f,
-    6.800103664e+00f,
-    5.203639030e+00f,
-    3.803406477e+00f,
-    2.436094475e+01f,
-    4.219647598e+01f,
-    1.381347046e+02f,
-    1.579630613e+00f,
-    1.402892971e+01f,
-    2.064781189e+01f,
-    3.226164627e+01f,
-    5.253998947e+01f,
-    1.951356173e+00f,
-    1.725891709e+00f,
-    4.546751022e+01f,
-    7.940743923e+00f,
-    4.571559429e+00f,
-    7.020656586e+00f,
-    5.900361061e+00f,
-    1.091943026e+00f,
-    1.244937658e+00f,
-    1.027657509e+00f,
-    2.034060001e+00f,
-    4.148233891e+00f,
-    2.726067543e+01f,
-    9.900099754e+00f,
-    9.213328362e+00f,
-    1.309843302e+00f,
-    1.209041476e+00f,
-    1.583534002e+00f,
-    8.281281471e+00f,
-    3.012286949e+01f,
-    6.259810257e+01f,
-    2.891890287e+00f,
-    1.675762558e+01f,
-    2.626245737e+00f,
-    5.127427101e+00f,
-    3.029860735e+00f,
-    4.048973083e+00f,
-    1.361251163e+01f,
-    4.121759033e+01f,
-    3.012603045e+00f,
-    6.534086227e+00f,
-    2.236905861e+01f,
-    1.274530697e+01f,
-    1.072808170e+01f,
-    2.060811281e+00f,
-    5.685839653e-01f,
-    2.866843796e+01f,
-    2.101887512e+01f,
-    3.734647369e+01f,
-    5.237371445e+00f,
-    3.279108429e+01f,
-    5.156932354e+00f,
-    2.509144545e+00f,
-    2.143822479e+01f,
-    9.353806496e+00f,
-    1.572537231e+01f,
-    3.691075742e-01f,
-    5.020403862e-01f,
-    7.572434998e+01f,
-    9.403036237e-01f,
-    2.728573084e+00f,
-    1.148184681e+01f,
-    2.321946526e+01f,
-    3.780371666e+00f,
-    1.785976982e+01f,
-    1.140422153e+01f,
-    4.200607300e+00f,
-    2.118529892e+01f,
-    1.428510475e+01f,
-    5.153917789e+00f,
-    2.456445932e+00f,
-    1.045954466e+00f,
-    7.788687706e+00f,
-    6.889391327e+01f,
-    1.187484932e+01f,
-    1.007710266e+01f,
-    7.682181597e-01f,
-    7.532542348e-01f,
-    1.117199421e+00f,
-    1.024034405e+01f,
-    3.983259201e+01f,
-    1.246066213e+00f,
-    1.868796110e+00f,
-    1.765226936e+01f,
-    8.742960930e+00f,
-    4.236046314e+00f,
-    2.949473858e+00f,
-    4.719425201e+01f,
-    3.627711105e+01f,
-    8.998078346e+00f,
-    2.201226950e+00f,
-    4.709578037e+00f,
-    2.487842560e+00f,
-    1.872168422e+00f,
-    6.419503689e+00f,
-    2.543489695e+00f,
-    1.893579721e+00f,
-    2.185558558e+00f,
-    7.995366454e-01f,
-    8.869401932e+00f,
-    8.018751740e-01f,
-    7.994051576e-01f,
-    1.657876778e+01f,
-    2.635479212e+00f,
-    1.944442272e+00f,
-    1.467185783e+01f,
-    1.521392822e+01f,
-    9.215517640e-01f,
-    2.194761634e-01f,
-    2.180550766e+01f,
-    2.040341377e+01f,
-    5.214981461e+01f,
-    3.049671412e+00f,
-    9.858145714e+00f,
-    1.452931309e+01f,
-    2.235862970e+00f,
-    4.807983637e-01f,
-    3.806281090e-01f,
-    2.168546677e+01f,
-    4.170822203e-01f,
-    2.789727173e+02f,
-    7.223809242e+00f,
-    2.544517136e+01f,
-    1.520206833e+01f,
-    9.648374939e+01f,
-    1.009668589e+00f,
-    8.091330528e-01f,
-    3.217867432e+02f,
-    5.482535839e+00f,
-    2.884967422e+01f,
-    6.506010532e+00f,
-    9.606293678e+00f,
-    2.564976120e+01f,
-    1.364710045e+01f,
-    1.096205711e+01f,
-    1.446806335e+01f,
-    8.516691208e+00f,
-    5.376404285e+00f,
-    3.758456469e+00f,
-    4.236330986e+00f,
-    5.556745529e-01f,
-    1.446325898e+00f,
-    1.709042549e+01f,
-    8.315931702e+01f,
-    7.515917969e+01f,
-    1.533212662e+01f,
-    1.013453364e+00f,
-    9.542773962e-01f,
-    1.513883114e+00f,
-    3.372866058e+01f,
-    4.075099468e+00f,
-    8.025364280e-01f,
-    1.671047783e+01f,
-    4.712965488e+00f,
-    1.376140785e+01f,
-    1.198539972e+00f,
-    5.319717026e+01f,
-    1.827466583e+01f,
-    1.022870779e+00f,
-    6.164183140e+00f,
-    7.761199474e+00f,
-    8.075613976e-01f,
-    2.364090204e+00f,
-    1.347193480e+00f,
-    7.639197111e-01f,
-    2.844284248e+01f,
-    3.053972435e+01f,
-    2.053578377e+01f,
-    3.252226591e+00f,
-    2.909373045e+00f,
-    9.257584572e+00f,
-    3.495591640e+00f,
-    9.632317543e+00f,
-    7.051506042e-01f,
-    8.499917984e-01f,
-    6.561158180e+00f,
-    1.500264049e+00f,
-    1.261774349e+01f,
-    9.946538210e-01f,
-    9.310525894e+00f,
-    1.798140168e+00f,
-    9.435850978e-01f,
-    8.881354928e-01f,
-    9.588575363e-01f,
-    7.169438601e-01f,
-    1.877092004e+00f,
-    8.199048638e-01f,
-    1.162494659e+00f,
-    1.138722777e+00f,
-    1.250142217e+00f,
-    1.552791953e+00f,
-    8.677223921e-01f,
-    1.054225922e+00f,
-    1.320420504e+00f,
-    3.986056328e+00f,
-    4.541492462e+00f,
-    5.339021683e+00f,
-    1.226711154e+00f,
-    2.116424561e+00f,
-    8.518208861e-01f,
-    1.207626820e+00f,
-    3.038319349e+00f,
-    1.852229118e+00f,
-    4.767299592e-01f,
-    1.185405970e+00f,
-    9.896613955e-01f,
-    5.074728012e+00f,
-    4.244740009e+00f,
-    3.065660095e+01f,
-    2.025697708e+00f,
-    2.065853775e-01f,
-    2.204916716e+00f,
-    8.685077667e+01f,
-    1.440692711e+01f,
-    1.099305344e+01f,
-    5.623429418e-01f,
-    5.067462325e-01f,
-    6.714983582e-01f,
-    1.690752745e+00f,
-    6.095923781e-01f,
-    1.883208156e+00f,
-    2.742703915e+00f,
-    7.306346893e+00f,
-    1.617604494e-01f,
-    2.312517405e+00f,
-    1.329565883e+00f,
-    1.784319431e-01f,
-    4.167678952e-01f,
-    8.149749041e-01f,
-    3.227543533e-01f,
-    5.159379482e+00f,
-    1.559969711e+01f,
-    8.148811340e+00f,
-    1.624783158e+00f,
-    5.805939674e+00f,
-    3.733482361e-01f,
-    2.573806763e+00f,
-    5.499400616e+00f,
-    6.598236561e-01f,
-    1.322836429e-01f,
-    1.025759459e+00f,
-    4.231622696e+00f,
-    3.353527486e-01f,
-    1.064144745e-01f,
-    7.632361650e-01f,
-    3.549544513e-01f,
-    2.613894463e+01f,
-    3.604213333e+01f,
-    4.975587463e+01f,
-    2.025539428e-01f,
-    1.100400352e+01f,
-    1.071612320e+02f,
-    2.145343542e+00f,
-    3.392292857e-01f,
-    6.197175980e-01f,
-    3.217908144e-01f,
-    3.117409348e-01f,
-    2.230931967e-01f,
-    1.331708282e-01f,
-    7.182157636e-01f,
-    4.685883522e-01f,
-    3.379787445e+01f,
-    4.885070622e-01f,
-    2.294223785e+01f,
-    5.978794098e-01f,
-    1.679014325e+00f,
-    1.011926830e-01f,
-    6.483792663e-01f,
-    7.302662730e-01f,
-    4.182360172e-01f,
-    5.071483850e-01f,
-    1.042461038e+00f,
-    1.596154213e+00f,
-    3.137020588e+00f,
-    2.902585864e-01f,
-    1.738158226e+00f,
-    1.665466785e+00f,
-    2.928657770e+00f,
-    5.924283266e-01f,
-    1.211195111e+00f,
-    1.135231733e+00f,
-    1.247692108e+00f,
-    1.263549924e+00f,
-    5.407305717e+00f,
-    9.506500244e+00f,
-    1.577482462e+00f,
-    1.106590939e+01f,
-    2.784610510e+00f,
-    1.438616753e+01f,
-    1.407714725e+00f,
-    4.483608723e+00f,
-    3.748661518e+00f,
-    2.024528122e+01f,
-    9.974631667e-01f,
-    4.517590404e-01f,
-    6.776436418e-02f,
-    3.906933069e+00f,
-    7.677494287e-01f,
-    5.603881359e+00f,
-    3.759346247e+00f,
-    1.057566285e+00f,
-    3.202892542e-01f,
-    1.499298215e+00f,
-    5.491541290e+01f,
-    1.618180156e+00f,
-    2.729982615e+00f,
-    2.171720886e+01f,
-    6.227145195e-01f,
-    3.941736817e-01f,
-    6.418390274e-01f,
-    7.920355797e-01f,
-    5.338165164e-01f,
-    1.394475460e+00f,
-    4.622659385e-01f,
-    4.252570271e-01f,
-    2.166319042e-01f,
-    1.040640995e-01f,
-    6.062288761e+00f,
-    1.231921315e+00f,
-    1.858143616e+01f,
-    7.162729502e-01f,
-    3.994163275e-01f,
-    4.473737478e-01f,
-    2.305561751e-01f,
-    3.400769830e-01f,
-    5.287936926e-01f,
-    6.988270581e-02f,
-    2.894174457e-01f,
-    1.349640489e+00f,
-    3.091082275e-01f,
-    1.049312472e+00f,
-    5.600250959e-01f,
-    3.109170198e-01f,
-    6.141879559e-01f,
-    1.655718982e-01f,
-    1.377368331e+00f,
-    1.023257449e-01f,
-    3.391217589e-01f,
-    5.759001374e-01f,
-    6.173675656e-01f,
-    9.780542254e-01f,
-    1.451334000e+00f,
-    1.490470052e+00f,
-    2.791971266e-01f,
-    3.818715334e+00f,
-    6.429241300e-01f,
-    1.949390411e+01f,
-    1.956537819e+01f,
-    2.424447060e+01f,
-    9.676889777e-01f,
-    2.238968372e+00f,
-    1.176145434e+00f,
-    2.053735924e+01f,
-    9.541905403e+00f,
-    3.166126823e+01f,
-    9.634721756e+00f,
-    3.161362648e+01f,
-    3.879801184e-02f,
-    5.996573344e-02f,
-    3.605786860e-01f,
-    1.889672279e+00f,
-    2.994714737e+01f,
-    2.393001765e-01f,
-    5.366511345e+00f,
-    8.655079007e-01f,
-    1.847946882e+00f,
-    1.556208515e+01f,
-    1.121451759e+01f,
-    3.924254179e+00f,
-    5.018113256e-01f,
-    7.307050824e-01f,
-    8.027086258e+00f,
-    3.341039896e+00f,
-    1.645547867e+01f,
-    1.182082057e+00f,
-    2.069205093e+01f,
-    4.430719852e+00f,
-    8.811535835e-01f,
-    3.792476142e-03f,
-    1.047272049e-02f,
-    1.818920523e-01f,
-    1.459374428e-01f,
-    1.257137954e-01f,
-    4.862582088e-01f,
-    2.762093353e+01f,
-    4.801130772e+00f,
-    6.988841295e-01f,
-    3.222272918e-02f,
-    6.167088822e-02f,
-    1.030180216e+00f,
-    7.464319468e-01f,
-    1.927035332e+00f,
-    1.928126931e+00f,
-    3.599937260e-01f,
-    1.351319253e-01f,
-    5.225585029e-02f,
-    6.621426344e-01f,
-    3.430088758e-01f,
-    4.847427905e-01f,
-    2.306549549e-01f,
-    1.896036863e-01f,
-    2.661098242e-01f,
-    2.067021132e+00f,
-    1.001808047e+00f,
-    1.275045518e-02f,
-    2.724685147e-02f,
-    2.976205647e-01f,
-    1.100227386e-01f,
-    1.085875109e-01f,
-    7.796042413e-02f,
-    4.179032445e-01f,
-    5.754937530e-01f,
-    1.979826927e+01f,
-    1.032824898e+01f,
-    1.322024632e+01f,
-    9.571055412e+00f,
-    5.599025726e+00f,
-    6.942977905e+00f,
-    1.335851593e+02f,
-    1.515032005e+01f,
-    6.917981720e+01f,
-    2.935575867e+01f,
-    1.392284298e+01f,
-    1.166234875e+01f,
-    1.300010777e+01f,
-    1.372180462e+01f,
-    4.881141663e+00f,
-    1.664433479e+01f,
-    8.795626640e+00f,
-    1.249069691e+01f,
-    1.507934952e+01f,
-    6.446424484e+00f,
-    1.487683392e+01f,
-    1.050258255e+01f,
-    8.050024986e+00f,
-    1.506371880e+01f,
-    2.145605087e+01f,
-    9.578145981e+00f,
-    3.791883469e+01f,
-    2.167450666e+00f,
-    4.255224609e+01f,
-    4.210370255e+01f,
-    3.340660095e+01f,
-    2.773020267e+00f,
-    1.403502107e+00f,
-    2.825760365e+00f,
-    7.198149872e+01f,
-    6.790397167e+00f,
-    3.878025818e+01f,
-    1.680869484e+01f,
-    2.319871330e+01f,
-    1.720513916e+01f,
-    2.256789446e+00f,
-    2.906377241e-02f,
-    3.723977506e-02f,
-    5.625660896e+00f,
-    2.624986768e-01f,
-    1.947395205e+00f,
-    6.221986771e+01f,
-    2.938010406e+01f,
-    7.163112640e+01f,
-    4.132213593e+00f,
-    7.849688828e-02f,
-    1.800092608e-01f,
-    1.424096203e+01f,
-    1.039400578e+00f,
-    4.424615860e+00f,
-    8.149464726e-01f,
-    2.056953049e+01f,
-    1.647340584e+01f,
-    8.088571930e+01f,
-    2.308886290e+00f,
-    2.832600355e+00f,
-    1.219164729e+00f,
-    1.580515137e+02f,
-    4.196231842e+01f,
-    1.186282715e+03f,
-    3.803755951e+01f,
-    6.437207699e+00f,
-    1.472054749e+02f,
-    4.703077674e-01f,
-    7.715215534e-02f,
-    7.169588655e-02f,
-    4.797372055e+01f,
-    5.108254910e+00f,
-    6.461376953e+02f,
-    1.071527481e+01f,
-    2.064319038e+01f,
-    3.431014099e+02f,
-    1.086383343e+00f,
-    2.082231641e-01f,
-    8.121285439e-01f,
-    1.712790070e+02f,
-    3.726158142e+01f,
-    4.779032715e+03f,
-    7.599051952e+00f,
-    8.715697564e-03f,
-    9.038893878e-02f,
-    2.661813423e-02f,
-    1.058267441e+02f,
-    1.203130913e+01f,
-    4.880701828e+01f,
-    7.565405965e-02f,
-    5.612666607e-01f,
-    7.444166392e-02f,
-    4.527827799e-01f,
-    8.592895865e-01f,
-    1.104807615e+00f,
-    1.840151405e+01f,
-    1.501690102e+01f,
-    9.177120209e+00f,
-    2.662568808e+00f,
-    3.151976824e+00f,
-    4.554398060e+00f,
-    2.437770553e-02f,
-    2.322354913e-01f,
-    5.873007327e-02f,
-    1.291532612e+01f,
-    5.461184978e+00f,
-    1.440112972e+01f,
-    1.630745828e-01f,
-    1.299880505e+00f,
-    4.137401581e-01f,
-    4.946604669e-01f,
-    1.149462819e+00f,
-    9.310544729e-01f,
-    1.769837588e-01f,
-    7.152502537e+00f,
-    4.258665144e-01f,
-    5.236993432e-01f,
-    8.567334175e+00f,
-    1.151516587e-01f,
-    4.045780599e-01f,
-    2.670226288e+01f,
-    1.828161049e+01f,
-    1.210980511e+01f,
-    1.006266952e+00f,
-    7.494533435e-03f,
-    2.045158856e-02f,
-    1.992783070e+00f,
-    1.074040607e-01f,
-    2.360602766e-01f,
-    2.329859972e+00f,
-    3.681964397e+00f,
-    1.115633607e+00f,
-    8.663819432e-01f,
-    1.661503315e-02f,
-    3.741375729e-02f,
-    4.585497379e+00f,
-    1.117514595e-01f,
-    6.715566516e-01f,
-    3.190619051e-01f,
-    2.327942848e-02f,
-    4.673717022e-01f,
-    7.993774116e-02f,
-    9.637320638e-01f,
-    3.516333401e-01f,
-    6.682292819e-01f,
-    1.632787287e-01f,
-    5.684773326e-01f,
-    4.462243617e-01f,
-    8.552166820e-01f,
-    2.081103086e+00f,
-    1.136476159e+00f,
-    7.284284234e-01f,
-    6.124920025e-02f,
-    1.333655715e-01f,
-    8.993679047e+00f,
-    1.004215002e+00f,
-    3.409344196e+00f,
-    5.604908615e-02f,
-    1.044958830e+00f,
-    9.439392388e-02f,
-    1.030707955e+00f,
-    1.308911592e-01f,
-    1.830689907e-01f,
-    7.923436165e-01f,
-    6.234762669e-01f,
-    6.890882850e-01f,
-    8.495132625e-02f,
-    1.087544203e+00f,
-    1.265443802e+01f,
-    1.052036762e+00f,
-    4.082591534e+00f,
-    6.630822659e+00f,
-    3.116518736e+00f,
-    8.346141577e-01f,
-    1.220832348e+00f,
-    2.281865835e+00f,
-    5.429599285e-01f,
-    3.863625050e+00f,
-    8.887804151e-01f,
-    5.800663829e-01f,
-    4.637745321e-01f,
-    1.476773471e-01f,
-    2.947009504e-01f,
-    4.124091566e-01f,
-    2.508345544e-01f,
-    2.968399525e-01f,
-    7.320693016e+00f,
-    4.564524591e-01f,
-    1.192189693e+00f,
-    1.474961996e+00f,
-    2.433496565e-01f,
-    3.320036530e-01f,
-    9.055420160e-01f,
-    1.199330926e+00f,
-    1.573297977e+00f,
-    1.654659271e+01f,
-    2.508515358e+01f,
-    4.794573975e+01f,
-    9.215006232e-01f,
-    4.470132291e-01f,
-    5.763856769e-01f,
-    2.862653542e+01f,
-    7.191549778e+00f,
-    4.946245575e+01f,
-    2.063650322e+01f,
-    4.637078857e+01f,
-    4.560743332e+01f,
-    7.043599486e-01f,
-    5.201815628e-03f,
-    3.064545989e-02f,
-    1.117679310e+01f,
-    1.881964952e-01f,
-    1.158393741e+00f,
-    2.072968674e+01f,
-    1.732384491e+01f,
-    6.775236511e+01f,
-    1.202757478e+00f,
-    9.638560563e-02f,
-    1.247563064e-01f,
-    2.063398361e+01f,
-    6.883192658e-01f,
-    1.828471947e+01f,
-    5.871804357e-01f,
-    7.039712429e+00f,
-    2.671437454e+01f,
-    2.082044411e+01f,
-    3.256064415e+00f,
-    8.105272293e+00f,
-    6.975258350e+00f,
-    2.564077377e+01f,
-    1.824191666e+01f,
-    1.676083832e+02f,
-    4.130587578e+00f,
-    2.106220818e+01f,
-    9.757543564e+00f,
-    1.052160978e+00f,
-    1.188945770e-02f,
-    8.928553760e-02f,
-    3.016857624e+00f,
-    2.816849351e-01f,
-    1.075986266e+00f,
-    2.987790823e+00f,
-    2.051770401e+01f,
-    3.583385849e+01f,
-    1.474583030e+00f,
-    1.142492220e-01f,
-    4.776684940e-01f,
-    1.053865910e+01f,
-    2.607964277e+00f,
-    3.396550751e+01f,
-    2.702303648e+00f,
-    3.059127182e-02f,
-    8.584832400e-02f,
-    5.183053017e-02f,
-    6.339018345e-01f,
-    1.009464383e+00f,
-    8.186090589e-01f,
-    8.842083067e-02f,
-    3.655972183e-01f,
-    8.889240026e-02f,
-    5.571501702e-02f,
-    3.538141251e-01f,
-    1.987001598e-01f,
-    3.109322488e-01f,
-    4.884756207e-01f,
-    1.738496125e-01f,
-    1.370817572e-01f,
-    3.872452378e-01f,
-    1.092854142e-01f,
-    1.372811198e-02f,
-    3.973681629e-01f,
-    3.844833747e-02f,
-    6.428422928e-01f,
-    3.388257623e-01f,
-    1.292181760e-01f,
-    7.356430590e-02f,
-    1.989842504e-01f,
-    5.641433597e-02f,
-    8.449816704e-02f,
-    4.773842692e-01f,
-    1.585790813e-01f,
-    2.270702571e-01f,
-    1.267837882e+00f,
-    1.022123173e-01f,
-    1.154273003e-01f,
-    2.137512922e+00f,
-    9.396292269e-02f,
-    2.121637762e-01f,
-    7.665650368e+00f,
-    1.460562944e+00f,
-    3.882492065e+00f,
-    2.526498139e-01f,
-    5.029775947e-02f,
-    5.789889768e-02f,
-    5.956555009e-01f,
-    1.508633494e-01f,
-    8.432492614e-02f,
-    1.041660070e+00f,
-    7.446808815e-01f,
-    9.787420034e-01f,
-    4.402726889e-01f,
-    5.119467154e-02f,
-    6.772135198e-02f,
-    2.136178493e+00f,
-    4.672781006e-02f,
-    1.934540123e-01f,
-    1.248111650e-01f,
-    3.411162272e-02f,
-    7.056585699e-02f,
-    3.275608271e-02f,
-    8.306044936e-01f,
-    1.408491731e-01f,
-    3.709623218e-01f,
-    1.417734176e-01f,
-    1.157801524e-01f,
-    1.489205807e-01f,
-    1.483868808e-01f,
-    9.853594899e-01f,
-    7.533237934e-01f,
-    8.165551424e-01f,
-    3.108536080e-02f,
-    5.728679150e-02f,
-    4.370895922e-01f,
-    1.391683221e-01f,
-    1.796913296e-01f,
-    6.672495604e-02f,
-    2.321119159e-01f,
-    5.870698765e-02f,
-    5.100976825e-01f,
-    6.486959010e-02f,
-    2.211783528e-01f,
-    2.687321007e-01f,
-    7.691229880e-02f,
-    2.157088667e-01f,
-    1.437440980e-02f,
-    4.881287575e+00f,
-    6.885766983e-01f,
-    2.282577896e+01f,
-    9.647578239e+00f,
-    7.462117821e-02f,
-    4.647834599e-01f,
-    2.566480875e+00f,
-    2.636345029e-01f,
-    7.092983723e+00f,
-    2.453499883e-01f,
-    1.300442778e-02f,
-    1.639863610e+00f,
-    2.756636441e-01f,
-    2.415146828e-01f,
-    1.008232869e-02f,
-    4.059891775e-02f,
-    7.749420404e-02f,
-    2.970348597e-01f,
-    1.863267645e-02f,
-    2.615294186e-03f,
-    3.697544336e-01f,
-    4.443267822e+00f,
-    3.668598235e-01f,
-    2.449365997e+01f,
-    4.257494736e+01f,
-    2.605993652e+01f,
-    1.288470864e+00f,
-    8.588670731e+00f,
-    1.463136673e+00f,
-    1.056173086e+00f,
-    2.557240963e+00f,
-    2.272884560e+01f,
-    4.348948288e+01f,
-    6.938253403e+00f,
-    1.376171589e+01f,
-    4.937712252e-01f,
-    5.296428680e+01f,
-    2.211692095e+00f,
-    1.532934546e+00f,
-    1.607625389e+01f,
-    1.349921894e+01f,
-    6.006658077e+00f,
-    7.283630371e+00f,
-    1.096842575e+01f,
-    8.168318748e+00f,
-    2.561087799e+01f,
-    4.652252960e+01f,
-    2.016917419e+01f,
-    1.245072460e+01f,
-    4.403055191e+00f,
-    8.679225922e+00f,
-    5.688856125e+00f,
-    3.086001968e+01f,
-    1.493265057e+01f,
-    4.948597431e+00f,
-    1.753463364e+01f,
-    1.553406048e+01f,
-    9.152053833e+00f,
-    9.690916061e+00f,
-    1.460012436e+01f,
-    2.592914104e+00f,
-    1.163987350e+01f,
-    1.665274239e+01f,
-    1.896244240e+01f,
-    5.305891418e+01f,
-    2.119565582e+01f,
-    1.303450227e+00f,
-    4.773982763e-01f,
-    8.762413263e-01f,
-    1.001916289e+00f,
-    3.772909927e+01f,
-    4.781147766e+01f,
-    1.010679703e+02f,
-    3.529680014e+00f,
-    4.818033218e+00f,
-    1.140286732e+01f,
-    1.297778225e+01f,
-    2.017271280e+00f,
-    7.903035641e+00f,
-    6.256843948e+01f,
-    4.271792603e+01f,
-    1.293763123e+02f,
-    2.327276993e+01f,
-    1.046760941e+02f,
-    1.903019257e+02f,
-    7.841915488e-01f,
-    1.527801514e+00f,
-    8.024978638e-01f,
-    4.116803360e+01f,
-    2.355043793e+01f,
-    6.700985718e+01f,
-    1.243815327e+01f,
-    3.341982651e+01f,
-    2.896866608e+01f,
-    1.047271156e+01f,
-    4.338669777e+00f,
-    1.095004368e+01f,
-    4.411697865e+00f,
-    2.058083296e+00f,
-    1.644641638e+00f,
-    1.565086365e+00f,
-    6.840621948e+00f,
-    8.173943520e+00f,
-    3.621924639e+00f,
-    8.349606395e-01f,
-    5.331086159e+00f,
-    2.645582199e+00f,
-    1.194334888e+01f,
-    3.312203169e+00f,
-    1.590191746e+01f,
-    1.893617868e+00f,
-    7.070151567e-01f,
-    2.610147476e+00f,
-    2.143030357e+01f,
-    4.141817570e+00f,
-    1.969220161e+00f,
-    1.545032310e+01f,
-    3.004706860e+00f,
-    9.370817184e+00f,
-    1.578318954e+00f,
-    1.388540864e+00f,
-    1.512168169e+00f,
-    4.705168152e+01f,
-    1.799122095e+00f,
-    3.268761396e+00f,
-    6.975727081e+00f,
-    3.934505463e+00f,
-    1.751080322e+01f,
-    1.823345900e+00f,
-    1.197559953e+00f,
-    8.715977073e-01f,
-    2.020868301e+01f,
-    3.827553272e+00f,
-    8.222644806e+00f,
-    1.903567553e+00f,
-    9.117302895e-01f,
-    3.084890366e+00f,
-    1.709859848e+00f,
-    1.322263241e+01f,
-    5.071265030e+01f,
-    4.638695526e+01f,
-    1.509584618e+01f,
-    7.311524963e+01f,
-    2.003118286e+02f,
-    2.249393225e+00f,
-    4.019514561e+00f,
-    4.988303185e+00f,
-    3.857730865e+00f,
-    1.390779114e+02f,
-    5.477910156e+02f,
-    4.992288113e+00f,
-    3.742076492e+01f,
-    2.255591553e+03f,
-    6.942369080e+01f,
-    5.319140553e-01f,
-    2.038187265e+00f,
-    7.878983021e-01f,
-    4.660583878e+01f,
-    2.757817459e+01f,
-    2.170601273e+01f,
-    9.876692891e-01f,
-    5.238478661e+00f,
-    1.820495605e+00f,
-    3.090598583e+00f,
-    2.114165068e+00f,
-    5.231007576e+00f,
-    2.421354103e+01f,
-    1.888091469e+01f,
-    2.738084793e+01f,
-    1.317645264e+01f,
-    6.088866234e+00f,
-    1.677572250e+01f,
-    9.418367147e-01f,
-    9.531145096e-01f,
-    3.124017417e-01f,
-    2.654811096e+01f,
-    8.704776001e+01f,
-    2.518901672e+02f,
-    1.678579569e+00f,
-    3.179036331e+01f,
-    2.798604012e+00f,
-    6.153579354e-01f,
-    1.365502328e-01f,
-    4.488987625e-01f,
-    4.421645105e-01f,
-    5.116306305e+01f,
-    1.983215332e+00f,
-    4.433319473e+01f,
-    5.366947651e-01f,
-    2.468853444e-01f,
-    6.522699594e-01f,
-    1.779871345e+00f,
-    2.551623583e+00f,
-    1.483563662e+00f,
-    1.827636337e+01f,
-    1.967448592e+00f,
-    1.888235474e+01f,
-    1.381691551e+01f,
-    2.340476227e+01f,
-    3.867852783e+01f,
-    2.641423941e-01f,
-    6.723096371e-01f,
-    2.897877395e-01f,
-    5.291537857e+01f,
-    1.222791076e+00f,
-    6.642728424e+01f,
-    1.320566893e+00f,
-    5.721814632e-01f,
-    2.606349468e+00f,
-    2.696695805e+00f,
-    1.395546436e+01f,
-    7.743369102e+00f,
-    1.496538639e+01f,
-    5.249427319e+00f,
-    1.196594238e+01f,
-    4.857052326e+00f,
-    3.480850220e+01f,
-    1.630496788e+01f,
-    5.021531677e+01f,
-    3.438739014e+01f,
-    4.584877491e+00f,
-    1.292777920e+01f,
-    2.217819595e+01f,
-    2.907381630e+01f,
-    1.519830322e+01f,
-    3.988508606e+01f,
-    1.697021866e+01f,
-    5.768113708e+01f,
-    1.062577248e+01f,
-    4.145413876e+00f,
-    1.900016212e+01f,
-    1.521920013e+01f,
-    2.714765739e+01f,
-    2.269044685e+01f,
-    1.510151577e+01f,
-    1.575646877e+01f,
-    3.762329102e+01f,
-    4.010228157e+00f,
-    2.325263214e+01f,
-    1.080612278e+01f,
-    2.720492744e+01f,
-    1.509197474e+00f,
-    9.987613559e-01f,
-    2.943037987e+00f,
-    2.631195450e+01f,
-    9.298853278e-01f,
-    2.443347359e+01f,
-    3.862960052e+01f,
-    1.502370834e+01f,
-    2.976717758e+01f,
-    6.200423241e-01f,
-    4.268067479e-01f,
-    6.309847832e-01f,
-    3.309466171e+01f,
-    9.624835104e-02f,
-    2.177968919e-01f,
-    1.162371063e+01f,
-    7.302267551e+00f,
-    6.315203094e+01f,
-    9.640570879e-01f,
-    1.233192921e+00f,
-    1.697040915e+00f,
-    3.387486649e+01f,
-    2.678846717e-01f,
-    2.799960077e-01f,
-    3.045269489e+00f,
-    1.171714425e+00f,
-    5.479086399e+00f,
-    1.204240680e+00f,
-    4.318673706e+01f,
-    5.698347473e+01f,
-    4.109031296e+01f,
-    5.702049255e+00f,
-    1.485509682e+01f,
-    5.135474205e+00f,
-    1.634262204e+00f,
-    1.082857132e+00f,
-    1.885676265e+00f,
-    6.379726028e+01f,
-    2.857664108e+01f,
-    2.178219414e+01f,
-    5.227452278e+00f,
-    6.781591034e+01f,
-    4.290015030e+01f,
-    1.187336087e+00f,
-    2.786465168e+00f,
-    1.338176370e+00f,
-    3.544874191e+01f,
-    5.307241440e+01f,
-    1.483030090e+02f,
-    6.940430164e+00f,
-    9.887088776e+01f,
-    2.221653938e+01f,
-    8.259786606e+00f,
-    4.294582605e-01f,
-    8.629238605e-01f,
-    3.971165419e-01f,
-    5.041109467e+01f,
-    2.070410967e+00f,
-    5.418243885e+00f,
-    3.440629959e+00f,
-    1.620699883e+00f,
-    5.411664486e+00f,
-    5.079113841e-01f,
-    1.846474528e+00f,
-    1.832419991e+00f,
-    1.286404514e+01f,
-    5.460284278e-02f,
-    3.284434378e-01f,
-    6.072339058e+00f,
-    1.574899077e+00f,
-    9.793981552e+00f,
-    4.883131683e-01f,
-    2.209670782e+00f,
-    5.811563730e-01f,
-    2.166827774e+01f,
-    3.324445486e-01f,
-    4.755389988e-01f,
-    4.759940147e+00f,
-    1.700538158e+00f,
-    2.807812452e+00f,
-    8.153207898e-01f,
-    6.276095659e-02f,
-    3.857675493e-01f,
-    9.907865524e-02f,
-    6.341625214e+01f,
-    5.801960754e+01f,
-    8.282886505e+01f,
-    1.646498889e-01f,
-    3.997113705e+00f,
-    4.978500009e-01f,
-    3.230909407e-01f,
-    6.945783496e-01f,
-    3.639132679e-01f,
-    7.035181427e+01f,
-    3.715088654e+01f,
-    9.884260559e+01f,
-    2.851767302e+00f,
-    1.985742188e+01f,
-    2.171948624e+01f,
-    1.149353608e-01f,
-    1.064412832e+00f,
-    1.338527799e-01f,
-    8.449127960e+01f,
-    9.160642242e+01f,
-    3.820244751e+02f,
-    2.880812287e-01f,
-    1.845032883e+01f,
-    2.709120750e+00f,
-    1.502687484e-01f,
-    5.762832165e-01f,
-    4.169188440e-01f,
-    9.194955975e-02f,
-    7.514609337e+00f,
-    4.276219010e-01f,
-    1.480079174e+00f,
-    1.453647852e+00f,
-    2.436037511e-01f,
-    2.242360115e-01f,
-    1.121227169e+01f,
-    1.401356220e+01f,
-    2.569525719e+01f,
-    1.497976875e+01f,
-    2.370585501e-01f,
-    1.941900730e+00f,
-    6.139280796e+00f,
-    1.231760979e+00f,
-    2.003525496e+00f,
-    1.427942634e+00f,
-    5.364782810e-01f,
-    4.263280928e-01f,
-    8.706630707e+00f,
-    7.305159420e-02f,
-    6.032285690e-01f,
-    3.632595778e+00f,
-    4.099539220e-01f,
-    1.151069403e+00f,
-    6.581587195e-01f,
-    9.139443189e-02f,
-    2.331135571e-01f,
-    2.708643079e-01f,
-    1.662570190e+02f,
-    3.487212372e+01f,
-    2.410497742e+02f,
-    4.798975289e-01f,
-    1.130776644e+00f,
-    2.568535328e+00f,
-    3.618039846e+00f,
-    3.757937193e+00f,
-    5.934388638e+00f,
-    2.849585533e+01f,
-    1.831549644e+01f,
-    1.128447189e+02f,
-    1.853426552e+01f,
-    5.294412231e+01f,
-    5.586053467e+02f,
-    1.196164861e-01f,
-    1.551072240e+00f,
-    4.301600158e-01f,
-    5.780787964e+02f,
-    5.835211754e+00f,
-    7.727947388e+02f,
-    3.142367601e+00f,
-    1.639165306e+01f,
-    1.225992393e+01f,
-    1.062507272e+00f,
-    9.937399864e+00f,
-    1.379082394e+01f,
-    1.805291557e+01f,
-    2.524684668e+00f,
-    9.406769753e+00f,
-    7.042456150e+00f,
-    9.121323586e+00f,
-    4.990206718e+00f,
-    1.322534790e+02f,
-    9.985816956e+00f,
-    1.303645325e+01f,
-    1.549253559e+01f,
-    1.380503178e+01f,
-    1.118077183e+01f,
-    7.744278908e+00f,
-    1.843803787e+01f,
-    1.492859554e+01f,
-    3.453575134e+01f,
-    4.519824505e+00f,
-    8.907390594e+00f,
-    2.117499352e+01f,
-    9.527794838e+00f,
-    1.589146423e+01f,
-    1.509920025e+01f,
-    1.295516205e+01f,
-    2.263884163e+01f,
-    6.563250732e+01f,
-    1.278655887e+00f,
-    1.009346771e+01f,
-    9.261423111e+00f,
-    7.102447510e+00f,
-    1.390194654e+00f,
-    8.450887203e-01f,
-    2.990974903e+00f,
-    1.039309311e+01f,
-    2.170645714e+01f,
-    2.271341133e+01f,
-    1.211192012e+00f,
-    9.944573045e-01f,
-    8.117575049e-01f,
-    1.547943211e+01f,
-    1.737674904e+01f,
-    1.255762768e+01f,
-    1.189958334e+00f,
-    6.620088816e-01f,
-    1.151651740e+00f,
-    8.781881332e+00f,
-    3.403587341e+01f,
-    5.009278488e+01f,
-    1.264085889e+00f,
-    1.693404794e+00f,
-    9.616009593e-01f,
-    5.201570511e+01f,
-    2.739024162e+00f,
-    3.885250854e+01f,
-    9.665992737e+00f,
-    5.338568497e+01f,
-    1.011657486e+02f,
-    4.812827706e-01f,
-    2.952075899e-01f,
-    6.972738504e-01f,
-    1.604903221e+01f,
-    4.515839517e-01f,
-    1.143445745e-01f,
-    5.360204697e+00f,
-    1.233076191e+01f,
-    9.444561768e+01f,
-    9.663217068e-01f,
-    1.367749572e+00f,
-    1.167368293e+00f,
-    5.247920609e+01f,
-    3.425115049e-01f,
-    2.131830007e-01f,
-    6.307739615e-01f,
-    2.789509892e-01f,
-    1.235931158e+00f,
-    1.793950349e-01f,
-    4.574326324e+01f,
-    4.495698929e+01f,
-    8.272631836e+01f,
-    1.673373103e+00f,
-    1.831877136e+01f,
-    8.560693741e+00f,
-    3.864955008e-01f,
-    1.099994421e+00f,
-    3.796106577e-01f,
-    2.776846313e+01f,
-    1.933222008e+01f,
-    2.687647629e+01f,
-    3.479292631e+00f,
-    1.032660446e+02f,
-    7.082621002e+01f,
-    8.977296948e-01f,
-    2.183314323e+00f,
-    5.758981705e-01f,
-    1.659039001e+02f,
-    1.378369751e+02f,
-    3.084754333e+02f,
-    2.372996330e+00f,
-    1.950436554e+02f,
-    2.662232590e+01f,
-    4.377711117e-01f,
-    2.314646244e+00f,
-    5.716363788e-01f,
-    4.370308816e-01f,
-    8.881309628e-01f,
-    3.356527388e-01f,
-    1.008749366e+00f,
-    7.623157501e+00f,
-    3.022676110e-01f,
-    3.078097820e+00f,
-    7.344666004e+00f,
-    7.614057064e+00f,
-    4.865570068e+00f,
-    8.536670804e-01f,
-    5.957801938e-01f,
-    9.921998382e-01f,
-    2.312735796e+00f,
-    1.169944033e-01f,
-    1.171511859e-01f,
-    4.278096199e+00f,
-    3.991255760e+00f,
-    5.226868629e+00f,
-    1.501177430e+00f,
-    8.304663301e-01f,
-    9.084183574e-01f,
-    1.559201241e+00f,
-    2.970921434e-02f,
-    3.670683876e-02f,
-    4.650447369e-01f,
-    1.703627855e-01f,
-    2.362948418e+00f,
-    1.344217539e+00f,
-    8.516159058e+01f,
-    4.699714184e+00f,
-    5.739328003e+01f,
-    5.157059669e+00f,
-    2.488389969e+01f,
-    4.381155777e+01f,
-    1.379474998e+00f,
-    1.633028603e+01f,
-    9.646366119e+00f,
-    6.462716579e+00f,
-    4.147133231e-02f,
-    1.273102611e-01f,
-    1.709374619e+01f,
-    2.089276505e+01f,
-    8.193648529e+01f,
-    4.879799783e-01f,
-    3.786013842e+00f,
-    1.978049755e+00f,
-    1.383171749e+01f,
-    2.750523984e-01f,
-    6.830150485e-01f,
-    1.979067039e+01f,
-    3.452121353e+01f,
-    7.603581238e+01f,
-    1.546679437e-01f,
-    5.542929173e-01f,
-    7.174959660e+00f,
-    2.839278698e+00f,
-    1.413798451e+00f,
-    9.321169853e+00f,
-    2.675103569e+01f,
-    7.322512269e-01f,
-    3.404519320e+00f,
-    5.422070980e+00f,
-    1.200555921e+00f,
-    1.894620657e+00f,
-    1.705845475e+00f,
-    2.595944881e+00f,
-    2.813811302e+00f,
-    8.893064260e-01f,
-    1.156670094e+00f,
-    1.964028835e+00f,
-    1.031962872e+00f,
-    9.684862137e+00f,
-    1.331687689e+00f,
-    5.638585091e-01f,
-    2.991293967e-01f,
-    1.573101878e+00f,
-    1.264914751e+00f,
-    1.327115536e+00f,
-    4.088746607e-01f,
-    1.087195724e-01f,
-    3.492290974e-01f,
-    1.871245354e-01f,
-    7.311220169e+00f,
-    2.682561874e+00f,
-    1.385895729e+01f,
-    1.634453386e-01f,
-    8.067010045e-01f,
-    1.394199282e-01f,
-    1.136643529e+00f,
-    6.769305468e-01f,
-    2.323818922e+00f,
-    3.530865908e+00f,
-    5.834203362e-01f,
-    8.956223726e-01f,
-    4.258649647e-01f,
-    3.723497868e+00f,
-    4.570237994e-01f,
-    2.067855597e+00f,
-    1.526550865e+01f,
-    1.404516125e+01f,
-    5.661060333e+00f,
-    7.655216217e+00f,
-    1.457008648e+01f,
-    1.591163731e+01f,
-    1.837424850e+01f,
-    1.148893452e+01f,
-    7.538592815e+00f,
-    5.067842484e+00f,
-    2.680045843e+00f,
-    3.180328369e+00f,
-    3.324375629e+00f,
-    7.503851414e+00f,
-    6.922062874e+00f,
-    3.654602528e+00f,
-    9.850205421e+00f,
-    3.997046232e+00f,
-    1.317358208e+01f,
-    9.971414566e+00f,
-    4.632851124e+00f,
-    6.879613876e+00f,
-    8.109938622e+00f,
-    3.965056419e+00f,
-    8.161431313e+00f,
-    1.220137310e+01f,
-    1.597328949e+01f,
-    3.384191036e+00f,
-    1.672918946e-01f,
-    1.011097431e+00f,
-    1.899050325e-01f,
-    7.689178944e+00f,
-    7.525201797e+00f,
-    6.701148987e+00f,
-    1.098968029e+00f,
-    5.524057388e+00f,
-    1.748096585e+00f,
-    1.216332316e+00f,
-    1.353846669e+00f,
-    1.158443928e+00f,
-    2.800479174e+00f,
-    4.781672478e+00f,
-    3.415917873e+00f,
-    1.825702429e+00f,
-    3.870272875e+00f,
-    2.905353069e+00f,
-    7.675247788e-01f,
-    1.088183761e+00f,
-    9.668281674e-01f,
-    2.977787733e+00f,
-    6.021744728e+00f,
-    9.631233215e+00f,
-    1.062497139e+00f,
-    1.837689281e+00f,
-    6.734750867e-01f,
-    1.740139842e+00f,
-    1.456064415e+01f,
-    1.297053146e+01f,
-    3.766185760e+01f,
-    1.451611161e+00f,
-    1.613371730e+00f,
-    2.553477526e+00f,
-    1.346080589e+01f,
-    5.858187675e+00f,
-    6.167649841e+01f,
-    1.094202614e+01f,
-    1.833795929e+01f,
-    4.725253582e-02f,
-    4.717969149e-02f,
-    3.137806356e-01f,
-    1.821583986e+00f,
-    2.710724068e+01f,
-    1.517889053e-01f,
-    4.585760117e+00f,
-    1.259065747e+00f,
-    1.809116936e+01f,
-    7.770006657e+00f,
-    1.165809021e+02f,
-    2.159267426e+00f,
-    2.015654087e+00f,
-    4.306708813e+00f,
-    2.346126938e+01f,
-    1.975987816e+01f,
-    4.874473190e+01f,
-    3.296927643e+01f,
-    5.346430779e+00f,
-    9.578304291e+01f,
-    8.951514363e-01f,
-    4.003113881e-02f,
-    9.969934821e-02f,
-    3.151468086e+01f,
-    4.195167065e+00f,
-    2.119846802e+02f,
-    5.372036457e+00f,
-    4.807238388e+01f,
-    7.992717743e+01f,
-    1.531942129e+00f,
-    2.724561393e-01f,
-    6.532304883e-01f,
-    7.761260986e+01f,
-    7.756255341e+01f,
-    2.096954834e+03f,
-    5.019272804e+00f,
-    3.488442600e-01f,
-    1.499818444e+00f,
-    1.062124252e+00f,
-    3.070409775e+00f,
-    5.988003731e+00f,
-    8.176011086e+00f,
-    6.864170551e+00f,
-    3.992298889e+01f,
-    9.330386353e+01f,
-    2.273351431e+00f,
-    2.022527218e+00f,
-    5.752760172e-01f,
-    1.112168074e+00f,
-    1.638870239e+01f,
-    7.632442017e+02f,
-    3.097473860e+00f,
-    1.422254028e+02f,
-    7.079602661e+02f,
-    3.945059061e+00f,
-    3.793632984e-02f,
-    8.175158501e-02f,
-    5.913003534e-02f,
-    1.794419861e+01f,
-    2.129380417e+01f,
-    1.120751762e+01f,
-    2.038357407e-02f,
-    1.572057456e-01f,
-    2.333900705e-02f,
-    9.233204275e-02f,
-    5.927953124e-01f,
-    1.823324561e-01f,
-    6.519779205e+00f,
-    8.598153114e+00f,
-    3.507828712e+00f,
-    1.709873676e-01f,
-    5.919176936e-01f,
-    2.924295664e-01f,
-    1.376106590e-01f,
-    1.754900366e-01f,
-    2.240088135e-01f,
-    1.430540085e+01f,
-    6.929841518e+00f,
-    6.762509823e+00f,
-    5.205346644e-02f,
-    3.860128820e-01f,
-    7.857882231e-02f,
-    2.223226428e-01f,
-    1.494043159e+01f,
-    1.037668037e+01f,
-    2.983910799e+00f,
-    6.821393967e+00f,
-    1.013032532e+01f,
-    2.206078720e+01f,
-    2.505653572e+01f,
-    6.030407429e+00f,
-    1.582174778e+01f,
-    4.651545525e+00f,
-    2.516542435e+00f,
-    1.224407673e+01f,
-    7.721529961e+00f,
-    6.595205307e+00f,
-    8.809774399e+00f,
-    1.100111294e+01f,
-    3.168581009e+00f,
-    8.110860825e+00f,
-    1.035416126e+01f,
-    5.002085686e+00f,
-    3.542786598e+00f,
-    5.507793903e+00f,
-    2.925838232e+00f,
-    1.137043381e+01f,
-    3.660515976e+01f,
-    4.042176723e+00f,
-    4.824515152e+01f,
-    2.550710678e+00f,
-    1.125432923e-02f,
-    3.524499536e-01f,
-    2.478233352e-02f,
-    1.195018539e+02f,
-    3.446643448e+01f,
-    7.716351318e+01f,
-    8.699595928e-02f,
-    1.510899425e+00f,
-    2.502662838e-01f,
-    1.333535165e-01f,
-    6.091280580e-01f,
-    2.040628344e-01f,
-    1.834478569e+01f,
-    2.587495804e+01f,
-    2.029409027e+01f,
-    1.299182892e+00f,
-    6.210511684e+00f,
-    2.571275711e+00f,
-    5.566176400e-02f,
-    4.224746823e-01f,
-    6.698809564e-02f,
-    5.637712479e+01f,
-    6.831369877e+00f,
-    5.461895370e+01f,
-    2.403773069e-01f,
-    4.421200275e+00f,
-    4.493253827e-01f,
-    3.485908210e-01f,
-    2.329589874e-01f,
-    1.959100342e+01f,
-    5.422253013e-01f,
-    1.462733173e+01f,
-    6.902050972e+00f,
-    1.721669579e+01f,
-    5.533506274e-01f,
-    2.406235695e+00f,
-    1.343594193e+00f,
-    3.085487783e-01f,
-    1.157282162e+01f,
-    3.244558871e-01f,
-    3.395806551e-01f,
-    2.523386776e-01f,
-    4.833834991e-02f,
-    2.240758985e-01f,
-    8.652257323e-01f,
-    1.099849492e-01f,
-    7.696545869e-02f,
-    4.747933388e+00f,
-    1.047704890e-01f,
-    8.339406848e-01f,
-    5.929120779e-01f,
-    2.326456606e-01f,
-    5.315605178e-02f,
-    1.093208075e+00f,
-    1.943113804e-01f,
-    6.161853075e-01f,
-    3.329413986e+01f,
-    2.295126343e+01f,
-    1.511271057e+02f,
-    1.806498766e+00f,
-    2.790108621e-01f,
-    9.296355844e-01f,
-    4.545010376e+01f,
-    6.548637867e+00f,
-    6.681618500e+01f,
-    4.652920914e+01f,
-    3.811608887e+01f,
-    7.597253418e+01f,
-    5.597615242e-01f,
-    9.531807154e-03f,
-    2.844408154e-02f,
-    1.439776516e+01f,
-    3.184848726e-01f,
-    2.675656557e+00f,
-    8.281101990e+01f,
-    6.514544678e+01f,
-    1.567704926e+02f,
-    1.054393291e+00f,
-    2.930938080e-02f,
-    5.504504964e-02f,
-    7.342848206e+01f,
-    8.803011179e-01f,
-    5.046408081e+01f,
-    1.951173097e-01f,
-    2.270819187e+00f,
-    9.131731415e+01f,
-    1.735931587e+01f,
-    2.342904472e+01f,
-    1.289315033e+01f,
-    1.705348778e+01f,
-    1.512711143e+01f,
-    1.071137905e+01f,
-    9.315631104e+01f,
-    2.071758270e+00f,
-    5.855072021e+01f,
-    6.433986664e+00f,
-    5.087779760e-01f,
-    1.053322013e-02f,
-    2.748336457e-02f,
-    2.036006689e+00f,
-    2.322605997e-01f,
-    6.015329957e-01f,
-    3.529656231e-01f,
-    3.762974930e+01f,
-    9.409061432e+00f,
-    2.271358728e+00f,
-    4.724657536e-02f,
-    1.980290413e-01f,
-    2.599226713e+00f,
-    1.866235733e+00f,
-    1.091557980e+01f,
-    4.157540500e-01f,
-    2.228845656e-02f,
-    1.132519394e-01f,
-    7.059254497e-02f,
-    1.568328738e+00f,
-    1.737415791e+00f,
-    2.541718483e+00f,
-    7.258283347e-02f,
-    1.174583912e+00f,
-    1.159493774e-01f,
-    2.517741621e-01f,
-    9.620977044e-01f,
-    3.192044497e-01f,
-    6.517450213e-01f,
-    6.973108649e-01f,
-    2.187265754e-01f,
-    1.645089984e-01f,
-    2.006281853e+00f,
-    2.010663450e-01f,
-    8.282364905e-02f,
-    4.537436366e-01f,
-    5.301477760e-02f,
-    6.744371057e-01f,
-    9.253205657e-01f,
-    5.594797134e-01f,
-    1.491036117e-01f,
-    4.370734692e-01f,
-    1.006323695e-01f,
-    1.968346536e-01f,
-    2.508627892e+01f,
-    2.862745094e+01f,
-    1.214989948e+01f,
-    1.070945501e+00f,
-    2.663347423e-01f,
-    4.413528442e+00f,
-    4.906940460e+01f,
-    1.822106552e+01f,
-    1.849887390e+02f,
-    1.751688194e+01f,
-    2.242577934e+01f,
-    6.389394760e+01f,
-    4.060941219e+00f,
-    7.504911721e-02f,
-    2.800882161e-01f,
-    7.524713898e+01f,
-    4.255035400e+00f,
-    1.009136734e+02f,
-    1.402240601e+02f,
-    1.007008286e+02f,
-    2.209878082e+02f,
-    3.431900978e+00f,
-    1.750904173e-01f,
-    4.693449736e-01f,
-    4.879519958e+02f,
-    4.255911636e+01f,
-    5.066449219e+03f,
-    3.565699100e+00f,
-    4.365205020e-02f,
-    7.180408239e-01f,
-    6.064969301e-02f,
-    1.876705933e+01f,
-    1.994885921e+00f,
-    1.650467110e+01f,
-    2.935321629e-01f,
-    1.932532692e+01f,
-    2.670322895e+00f,
-    8.198873997e-01f,
-    1.186810136e+00f,
-    1.130486012e+00f,
-    3.634757757e+00f,
-    1.364085078e-01f,
-    5.322360396e-01f,
-    1.703645349e+00f,
-    8.749570847e+00f,
-    2.757578850e+00f,
-    1.330043674e-01f,
-    2.074161291e+00f,
-    2.145917714e-01f,
-    3.133399248e+00f,
-    4.178634286e-01f,
-    1.956814051e+00f,
-    6.492611170e-01f,
-    1.472891693e+02f,
-    2.024052143e+00f,
-    1.221961454e-01f,
-    9.433697909e-02f,
-    2.905133486e+00f,
-    2.769328952e-01f,
-    4.593639374e-01f,
-    5.427098751e+00f,
-    4.725366831e-01f,
-    6.149637103e-01f,
-    1.506613135e+00f,
-    2.004425526e-01f,
-    7.220641971e-01f,
-    5.265359879e+00f,
-    1.919077277e+00f,
-    1.880789757e+01f,
-    1.937681317e+00f,
-    1.601193845e-01f,
-    1.464770913e+00f,
-    1.652296543e+00f,
-    3.933079839e-01f,
-    2.098902702e+00f,
-    2.549816370e-01f,
-    2.033639550e-01f,
-    5.877240896e-01f,
-    7.110460401e-01f,
-    9.865190387e-01f,
-    1.836240411e+00f,
-    2.660068750e+00f,
-    7.047174573e-01f,
-    9.959844351e-01f,
-    1.464673519e+00f,
-    2.256844565e-02f,
-    6.431184411e-01f,
-    3.400000572e+00f,
-    7.836513519e-01f,
-    1.527103806e+01f,
-    2.937617302e+01f,
-    1.379195786e+01f,
-    1.214219213e+00f,
-    9.200387955e+00f,
-    3.031973124e+00f,
-    1.287464142e+00f,
-    1.679356456e+00f,
-    1.464674568e+01f,
-    4.694985199e+01f,
-    2.413091421e+00f,
-    2.957341671e+00f,
-    7.512261271e-01f,
-    2.856065369e+01f,
-    1.387670040e+00f,
-    8.637752533e-01f,
-    3.674818873e-01f,
-    3.774921894e-01f,
-    5.780799985e-01f,
-    4.465013123e+01f,
-    1.768348932e+00f,
-    2.681152725e+01f,
-    1.018036604e+00f,
-    2.607817948e-01f,
-    2.079612255e+00f,
-    1.199379444e+00f,
-    1.401090026e+00f,
-    1.026887774e+00f,
-    2.991497040e+01f,
-    1.707405090e+00f,
-    2.658696938e+01f,
-    5.536951065e+00f,
-    1.907668686e+01f,
-    1.393855953e+01f,
-    9.280042648e-01f,
-    8.126390576e-01f,
-    6.751756072e-01f,
-    3.766925430e+01f,
-    1.350251198e+00f,
-    2.803539276e+01f,
-    2.127345085e+00f,
-    6.438795924e-01f,
-    4.802193165e+00f,
-    7.013681412e+00f,
-    2.219044715e-01f,
-    6.404575706e-02f,
-    3.600247502e-01f,
-    6.374794006e+00f,
-    7.291622758e-01f,
-    2.117666483e+00f,
-    5.185352564e-01f,
-    1.325247139e-01f,
-    7.027089000e-01f,
-    7.561617494e-01f,
-    3.465293944e-01f,
-    3.531462252e-01f,
-    2.074151188e-01f,
-    6.584111452e-01f,
-    1.353283525e-01f,
-    1.767979562e-01f,
-    8.579000831e-02f,
-    1.463747323e-01f,
-    2.833192348e+00f,
-    6.611479819e-02f,
-    5.842744112e-01f,
-    1.204239130e-01f,
-    1.531667233e+01f,
-    1.197072792e+01f,
-    2.478152084e+01f,
-    2.533154488e-01f,
-    4.857647419e+00f,
-    4.652600884e-01f,
-    7.556948066e-01f,
-    1.872903585e+00f,
-    5.383859873e-01f,
-    2.518181610e+01f,
-    1.989370537e+01f,
-    3.951640320e+01f,
-    1.820193887e+00f,
-    7.812405586e+00f,
-    9.688386917e+00f,
-    4.050645530e-01f,
-    9.785739183e-01f,
-    3.014517725e-01f,
-    2.224663353e+01f,
-    3.002615547e+01f,
-    1.093416672e+02f,
-    3.726645410e-01f,
-    5.624545097e+00f,
-    1.294872761e+00f,
-    6.197742820e-01f,
-    3.831697702e-01f,
-    4.039478898e-01f,
-    2.682209015e-01f,
-    7.268138885e+00f,
-    6.704347730e-01f,
-    2.007300138e+00f,
-    1.328914642e+00f,
-    3.185379207e-01f,
-    3.875509202e-01f,
-    6.780562878e+00f,
-    7.212202549e+00f,
-    7.856320858e+00f,
-    1.732537460e+01f,
-    3.347040117e-01f,
-    2.030315876e+00f,
-    2.521030903e+00f,
-    1.854773164e+00f,
-    3.718038321e+00f,
-    1.542415380e+00f,
-    1.513401866e+00f,
-    5.148735046e-01f,
-    5.837872028e+00f,
-    2.885077894e-01f,
-    8.267956972e-01f,
-    2.173806906e+00f,
-    4.283193350e-01f,
-    1.978009701e+00f,
-    1.330223322e+00f,
-    9.995866567e-02f,
-    4.072622657e-01f,
-    4.927049577e-01f,
-    5.865531158e+01f,
-    1.580463505e+01f,
-    9.161843109e+01f,
-    5.551198721e-01f,
-    1.675758123e+00f,
-    1.776390672e+00f,
-    1.813082814e+00f,
-    1.728549004e+00f,
-    2.231340408e+00f,
-    4.469878387e+01f,
-    2.656652260e+01f,
-    2.816381531e+02f,
-    1.032519054e+01f,
-    5.649068451e+01f,
-    4.476006165e+02f,
-    2.093447596e-01f,
-    8.461362720e-01f,
-    6.656791568e-01f,
-    6.867402649e+01f,
-    2.651098061e+01f,
-    4.207444153e+02f,
-    1.026704311e+00f,
-    1.927309227e+01f,
-    6.782935619e+00f,
-    2.666479826e+00f,
-    1.461530775e-01f,
-    7.548769712e-01f,
-    3.357335031e-01f,
-    1.234596443e+01f,
-    9.892273903e+00f,
-    1.627289772e+01f,
-    2.499167472e-01f,
-    2.063234806e+00f,
-    4.559860826e-01f,
-    9.167665243e-02f,
-    9.170562029e-01f,
-    3.859539032e-01f,
-    5.809732080e-01f,
-    1.176174283e+00f,
-    5.218632221e-01f,
-    2.985989749e-01f,
-    6.045184612e+00f,
-    3.336243629e-01f,
-    1.990056038e-01f,
-    5.175695419e-01f,
-    2.468337566e-01f,
-    5.771433830e+00f,
-    5.707385063e+00f,
-    7.171522141e+00f,
-    1.288687438e-01f,
-    2.595198154e+00f,
-    2.592122257e-01f,
-    2.761502862e-01f,
-    6.465066075e-01f,
-    4.603008926e-01f,
-    1.102380231e-01f,
-    1.221020699e+00f,
-    1.105744243e+00f,
-    5.367624760e-01f,
-    8.685881495e-01f,
-    9.111554921e-02f,
-    1.465135962e-01f,
-    1.469092846e+00f,
-    7.202467322e-01f,
-    8.783670068e-01f,
-    1.432299614e+00f,
-    1.638863564e+00f,
-    2.867789507e+00f,
-    1.068373919e-01f,
-    1.134084389e-01f,
-    5.106226355e-02f,
-    2.287479639e+00f,
-    9.837853312e-01f,
-    4.682967663e-01f,
-    1.149520636e+00f,
-    5.856926441e-01f,
-    1.032683849e+00f,
-    8.874186128e-02f,
-    2.768976800e-02f,
-    1.977629773e-02f,
-    1.275228262e+00f,
-    8.462889493e-02f,
-    2.338348329e-01f,
-    2.511076629e-01f,
-    1.533679199e+01f,
-    4.546411932e-01f,
-    3.427883387e+00f,
-    3.555275500e-01f,
-    1.543120623e+00f,
-    1.065812230e+00f,
-    2.240700424e-01f,
-    1.473647714e+00f,
-    6.817605495e-01f,
-    4.927790761e-01f,
-    9.745489806e-02f,
-    8.369483799e-02f,
-    3.786947429e-01f,
-    3.426884413e-01f,
-    3.129942715e-01f,
-    1.140089035e-01f,
-    8.130633831e-01f,
-    1.259641647e-01f,
-    7.929950953e-01f,
-    6.424645334e-02f,
-    5.921263620e-02f,
-    5.269268751e-01f,
-    3.456282914e-01f,
-    1.371369809e-01f,
-    4.453642666e-02f,
-    4.459411800e-01f,
-    1.116800785e+01f,
-    1.306728482e+00f,
-    1.354741096e+00f,
-    1.383788872e+01f,
-    4.278552628e+01f,
-    1.539992452e+00f,
-    3.266718388e+00f,
-    3.126777172e+00f,
-    7.585705519e-01f,
-    1.399583369e-01f,
-    4.842571616e-01f,
-    2.200632691e-01f,
-    3.416936874e+00f,
-    4.050224423e-01f,
-    9.717293084e-02f,
-    5.738572478e-01f,
-    5.786468983e-01f,
-    1.127820369e-02f,
-    3.313011825e-01f,
-    1.695560813e-01f,
-    7.331048250e-01f,
-    9.472191930e-01f,
-    1.076879859e+00f,
-    4.554994404e-02f,
-    7.424083352e-02f,
-    2.619722486e-02f,
-    3.848555386e-01f,
-    7.420567870e-01f,
-    9.564540386e-01f,
-    2.446454465e-01f,
-    2.396379411e-01f,
-    1.811954975e-01f,
-    2.047721446e-01f,
-    2.605584450e-02f,
-    3.305754364e-01f,
-    1.453318596e-01f,
-    1.410452574e-01f,
-    1.423202395e+00f,
-    1.072015464e-01f,
-    7.724624872e-01f,
-    3.860959411e-01f,
-    8.924565464e-02f,
-    1.575490683e-01f,
-    8.633431435e+00f,
-    7.669791579e-01f,
-    2.310492277e+00f,
-    2.870522738e+00f,
-    1.542302370e-01f,
-    4.980947077e-01f,
-    8.887481093e-01f,
-    3.914999664e-01f,
-    8.617300391e-01f,
-    3.610426784e-01f,
-    2.236621082e-01f,
-    3.586917520e-01f,
-    8.415734291e+00f,
-    7.017373294e-02f,
-    2.205548882e-01f,
-    8.958336711e-01f,
-    9.876561165e-02f,
-    2.343235761e-01f,
-    1.353120685e+00f,
-    1.908123307e-02f,
-    5.804683268e-02f,
-    1.781023107e-02f,
-    3.211892605e+00f,
-    3.442892730e-01f,
-    1.931035757e+00f,
-    3.117283992e-02f,
-    6.412526965e-02f,
-    1.598820835e-02f,
-    9.213127941e-02f,
-    4.333129227e-01f,
-    7.862801850e-02f,
-    2.147791624e+00f,
-    4.533682168e-01f,
-    1.072843909e+00f,
-    3.104835153e-01f,
-    9.680320024e-01f,
-    2.637642026e-01f,
-    2.691025846e-02f,
-    2.044206113e-01f,
-    2.506715618e-02f,
-    1.878564715e+00f,
-    1.054671183e-01f,
-    4.042587876e-01f,
-    5.294958502e-02f,
-    6.699777395e-02f,
-    2.466369793e-02f,
-    1.145441383e-01f,
-    1.457886410e+01f,
-    1.357425213e+01f,
-    2.879465294e+01f,
-    2.347408831e-01f,
-    2.717274129e-01f,
-    2.257846296e-01f,
-    9.861054420e+00f,
-    2.975041151e+00f,
-    1.751877403e+01f,
-    1.225424290e+01f,
-    6.761017609e+01f,
-    6.363784522e-02f,
-    7.445327193e-02f,
-    2.665913999e-01f,
-    7.761980891e-01f,
-    2.694397163e+01f,
-    2.236923724e-01f,
-    1.846220970e+00f,
-    1.152724147e+00f,
-    1.482193708e+00f,
-    1.487832451e+01f,
-    2.320751905e+00f,
-    2.804650545e+00f,
-    3.095481157e+00f,
-    3.950557709e+00f,
-    5.460619926e+00f,
-    6.824674129e+00f,
-    3.993330002e+01f,
-    4.596104920e-01f,
-    1.340385914e+01f,
-    1.785014749e+00f,
-    3.630686998e-01f,
-    6.601932645e-02f,
-    8.390018344e-02f,
-    4.807499349e-01f,
-    3.541946411e-01f,
-    1.448351145e-01f,
-    6.099612117e-01f,
-    2.933918953e+01f,
-    2.324921370e+00f,
-    1.312640190e+00f,
-    2.639583945e-01f,
-    1.486957967e-01f,
-    5.719100833e-01f,
-    1.053317428e+00f,
-    9.719226360e-01f,
-    8.354512453e-01f,
-    5.460945889e-02f,
-    3.077529371e-01f,
-    4.637454078e-02f,
-    7.551227570e+00f,
-    9.980008006e-01f,
-    3.085060596e+00f,
-    1.558001339e-01f,
-    6.648545265e-01f,
-    2.652343512e-01f,
-    2.278238535e+00f,
-    4.276655316e-01f,
-    1.035885438e-01f,
-    1.570627540e-01f,
-    5.978562236e-01f,
-    3.920540512e-01f,
-    5.397405103e-02f,
-    7.392676473e-01f,
-    2.750804424e-01f,
-    1.268795505e-02f,
-    1.927160740e+00f,
-    9.820212610e-03f,
-    3.212266862e-01f,
-    1.511210799e+00f,
-    7.432575524e-02f,
-    7.968316078e-01f,
-    1.071122754e-02f,
-    4.632438660e+00f,
-    8.576146960e-01f,
-    1.032964230e+01f,
-    3.072719574e+00f,
-    9.498526342e-03f,
-    1.457247883e-01f,
-    4.718250632e-01f,
-    1.772864610e-01f,
-    4.304516912e-01f,
-    5.992915854e-02f,
-    2.731637843e-02f,
-    1.698103428e+00f,
-    7.416304201e-02f,
-    9.047084451e-01f,
-    1.960902363e-01f,
-    1.653284431e-01f,
-    1.480160654e-01f,
-    9.519940615e-01f,
-    7.148770243e-02f,
-    7.616756018e-03f,
-    4.736758769e-02f,
-    1.273122728e-01f,
-    1.992878914e-01f,
-    1.425278282e+01f,
-    5.963169479e+01f,
-    5.244608688e+01f,
-    4.570758045e-01f,
-    4.601643980e-01f,
-    9.449405223e-02f,
-    1.184357762e+00f,
-    2.723185122e-01f,
-    9.734801292e+00f,
-    4.630856323e+01f,
-    1.431118965e+01f,
-    6.920770645e+00f,
-    2.950809300e-01f,
-    3.755008698e+01f,
-    6.051283479e-01f,
-    3.512674868e-01f,
-    6.678380370e-01f,
-    1.703396142e-01f,
-    1.985011250e-01f,
-    1.810792208e+00f,
-    2.659192383e-01f,
-    7.448651791e-01f,
-    1.327839375e+00f,
-    1.349395365e-01f,
-    1.884264648e-01f,
-    9.115749359e+00f,
-    4.010508060e+00f,
-    3.095534086e+00f,
-    5.966393948e+00f,
-    1.969819218e-01f,
-    4.470769763e-01f,
-    3.907297373e+00f,
-    6.321080923e-01f,
-    1.611497998e+00f,
-    1.244436264e+00f,
-    8.619318604e-01f,
-    4.001037478e-01f,
-    3.212705135e+00f,
-    1.739875227e-01f,
-    3.442511857e-01f,
-    1.903834939e+00f,
-    1.990557015e-01f,
-    2.926964760e-01f,
-    6.433122158e-01f,
-    6.345027685e-02f,
-    3.718014359e-01f,
-    2.208036929e-01f,
-    1.521458530e+01f,
-    2.814950466e+00f,
-    1.467233658e+01f,
-    3.710866570e-01f,
-    3.870805800e-01f,
-    2.394884974e-01f,
-    1.232434511e+00f,
-    2.109400511e+00f,
-    1.628742099e+00f,
-    2.475737381e+01f,
-    2.187787533e+00f,
-    3.560057068e+01f,
-    3.559845686e+00f,
-    1.089494801e+01f,
-    1.156956177e+02f,
-    1.354969740e-01f,
-    4.467261732e-01f,
-    1.701893955e-01f,
-    2.505598450e+01f,
-    1.832285881e+00f,
-    3.384512711e+01f,
-    7.238649130e-01f,
-    1.607183576e+00f,
-    5.737396479e-01f,
-    4.864739180e-01f,
-    1.777270555e+00f,
-    1.776062369e+00f,
-    1.048912525e+00f,
-    1.196478367e+00f,
-    1.068026304e+00f,
-    1.029917717e+00f,
-    1.077480316e+00f,
-    7.102297544e-01f,
-    3.980917931e+00f,
-    2.248863697e+00f,
-    3.861342669e-01f,
-    5.257409811e-01f,
-    5.942810774e-01f,
-    1.588666081e+00f,
-    1.604178309e+00f,
-    7.423564196e-01f,
-    2.124322653e+00f,
-    1.544617295e+00f,
-    2.263575554e+00f,
-    2.070352584e-01f,
-    9.725767374e-02f,
-    2.327271849e-01f,
-    2.713794708e+00f,
-    1.027711511e+00f,
-    4.221371114e-01f,
-    7.816775441e-01f,
-    1.130043387e+00f,
-    1.077730209e-01f,
-    1.067581475e-01f,
-    1.428568922e-02f,
-    2.826391160e-01f,
-    2.452563763e+00f,
-    5.148751140e-01f,
-    7.912557721e-01f,
-    1.580377221e+00f,
-    5.990945697e-01f,
-    2.527165115e-01f,
-    5.525424331e-02f,
-    1.726517268e-02f,
-    1.226953030e+00f,
-    1.491780877e-01f,
-    4.767827094e-01f,
-    2.099791467e-01f,
-    3.147047758e+00f,
-    3.772506714e-01f,
-    1.365965366e+00f,
-    4.166740179e-01f,
-    1.327512741e+00f,
-    8.015912175e-01f,
-    3.438539267e+00f,
-    2.160322666e+00f,
-    8.472716808e-02f,
-    7.476042956e-02f,
-    7.360413671e-01f,
-    6.434019804e-01f,
-    1.691110134e-01f,
-    5.772573501e-02f,
-    2.328210622e-01f,
-    4.655978829e-02f,
-    1.856898144e-02f,
-    9.921770096e+00f,
-    1.004449427e-01f,
-    1.060236216e+00f,
-    3.521236420e+01f,
-    2.613700485e+01f,
-    2.482997775e-01f,
-    3.981794357e+00f,
-    2.699964941e-01f,
-    1.000274420e-01f,
-    9.453861713e-01f,
-    1.672434807e-01f,
-    1.753710628e+00f,
-    5.039834976e-01f,
-    1.700277328e+00f,
-    3.592115045e-01f,
-    4.129036143e-02f,
-    1.239291549e+00f,
-    6.027465314e-02f,
-    1.701319695e+00f,
-    6.258368492e-01f,
-    2.770360745e-02f,
-    6.405886412e-01f,
-    8.175420165e-01f,
-    1.347559877e-02f,
-    1.709585041e-01f,
-    1.099366508e-02f,
-    7.973873615e-01f,
-    5.193063021e-01f,
-    8.424701542e-02f,
-    9.078995325e-03f,
-    6.066272501e-03f,
-    3.683203366e-03f,
-    2.619557641e-02f,
-    2.960100956e-02f,
-    4.359771609e-01f,
-    4.468336329e-02f,
-    8.742920309e-02f,
-    1.824519783e-02f,
-    1.091368943e-01f,
-    5.924555007e-03f,
-    2.263549566e+00f,
-    3.712090552e-01f,
-    4.986417890e-01f,
-    9.288408756e-01f,
-    7.466990501e-02f,
-    1.245316118e-01f,
-    2.240885162e+01f,
-    1.720501709e+01f,
-    1.768066788e+01f,
-    8.571295738e+00f,
-    4.104400873e-01f,
-    5.539147258e-01f,
-    6.155876517e-01f,
-    5.712254643e-01f,
-    4.549823999e-01f,
-    8.239204884e-01f,
-    5.717131495e-01f,
-    1.438962072e-01f,
-    1.949933410e+00f,
-    2.900874242e-02f,
-    7.291187346e-02f,
-    1.388771415e+00f,
-    8.654889464e-02f,
-    5.544386506e-01f,
-    1.317813873e+00f,
-    5.847031996e-02f,
-    1.167360879e-02f,
-    5.952413194e-03f,
-    8.249578997e-03f,
-    6.933593005e-02f,
-    1.087763812e-02f,
-    1.017572284e+00f,
-    7.248282433e-02f,
-    4.542348161e-02f,
-    4.289389029e-02f,
-    7.612292469e-02f,
-    3.179808334e-02f,
-    1.545285620e-02f,
-    3.242298961e-02f,
-    1.103550382e-02f,
-    3.364166319e-01f,
-    2.254330553e-02f,
-    4.177877307e-02f,
-    2.131392993e-02f,
-    1.532943547e-02f,
-    9.241756052e-03f,
-    3.957440145e-03f,
-    2.143760681e+01f,
-    8.110130310e+01f,
-    7.068130493e+01f,
-    2.824964046e+00f,
-    6.404350758e+00f,
-    3.862365723e+00f,
-    5.373614120e+01f,
-    3.664901352e+01f,
-    1.044294205e+02f,
-    1.775024414e+01f,
-    3.682958984e+01f,
-    4.347814322e-01f,
-    4.325643480e-01f,
-    8.633621335e-01f,
-    9.300059319e+00f,
-    6.053276062e+01f,
-    7.820387483e-01f,
-    4.730836105e+01f,
-    3.978823185e+00f,
-    1.486636996e+00f,
-    2.909453583e+01f,
-    5.362165928e+00f,
-    6.539954185e+00f,
-    1.695080566e+01f,
-    1.058801937e+01f,
-    7.890033722e+00f,
-    4.604477406e+00f,
-    1.484985256e+01f,
-    6.841567159e-01f,
-    1.529777145e+01f,
-    1.707619071e+00f,
-    6.669266820e-01f,
-    6.415762752e-02f,
-    4.439497367e-02f,
-    3.586293459e-01f,
-    2.358939350e-01f,
-    3.888061941e-01f,
-    3.685666025e-01f,
-    1.983975601e+01f,
-    2.078512430e+00f,
-    1.300912261e+00f,
-    2.322400063e-01f,
-    3.201132119e-01f,
-    8.038454056e-01f,
-    4.165001512e-01f,
-    3.027636766e+00f,
-    2.404917717e+00f,
-    4.632279277e-02f,
-    1.918561570e-02f,
-    1.309680194e-02f,
-    6.493551731e-01f,
-    4.302043617e-01f,
-    2.741911113e-01f,
-    5.937527865e-02f,
-    5.707375333e-02f,
-    4.286327213e-02f,
-    1.167935729e-01f,
-    5.225257576e-02f,
-    4.048476368e-02f,
-    3.340940922e-02f,
-    1.158553958e-01f,
-    3.538708761e-02f,
-    2.437409572e-02f,
-    2.855850011e-02f,
-    3.017397970e-02f,
-    9.715726599e-03f,
-    2.602091804e-02f,
-    3.667261302e-01f,
-    1.480732709e-01f,
-    2.539479065e+01f,
-    1.503173065e+01f,
-    5.102373123e+00f,
-    4.929796606e-02f,
-    3.342709243e-01f,
-    2.817154527e-01f,
-    3.537892923e-02f,
-    5.605341494e-02f,
-    1.607214063e-01f,
-    1.132664776e+01f,
-    3.416485310e+00f,
-    1.559781075e+00f,
-    9.576476179e-03f,
-    2.101528198e-01f,
-    1.641027629e-02f,
-    3.535317257e-02f,
-    4.483458042e+00f,
-    4.670533538e-01f,
-    2.941220105e-01f,
-    7.781299353e-01f,
-    5.315634608e-01f,
-    2.157082260e-01f,
-    6.210910678e-01f,
-    4.942965806e-01f,
-    9.789878875e-02f,
-    9.369836807e+00f,
-    2.679512836e-02f,
-    8.088713884e-02f,
-    9.300371408e-01f,
-    1.078398302e-01f,
-    1.969299614e-01f,
-    5.922916532e-01f,
-    7.638214231e-01f,
-    1.379247427e+00f,
-    3.641614020e-01f,
-    3.366052732e-02f,
-    2.503556609e-01f,
-    9.222918749e-02f,
-    6.931785345e-01f,
-    1.601474732e-01f,
-    9.276106954e-02f,
-    1.231415942e-01f,
-    1.944277585e-01f,
-    8.438922465e-02f,
-    3.887320310e-02f,
-    4.236127853e+00f,
-    1.681302452e+01f,
-    3.224450111e+00f,
-    4.259347916e+00f,
-    3.691844225e+00f,
-    1.812297668e+02f,
-    7.307985306e+00f,
-    3.850011444e+01f,
-    6.752900124e+00f,
-    1.118950844e+01f,
-    1.230086994e+01f,
-    8.213451385e+00f,
-    7.240856647e+00f,
-    1.899419212e+01f,
-    1.097723675e+01f,
-    1.692630005e+01f,
-    5.522959709e+00f,
-    1.144562721e+01f,
-    3.448800087e+00f,
-    1.072894859e+01f,
-    8.428061485e+00f,
-    1.538252354e+01f,
-    5.688134670e+00f,
-    2.322013474e+01f,
-    2.589607000e+00f,
-    3.146482277e+01f,
-    6.130637360e+01f,
-    5.029409885e+00f,
-    2.309439087e+01f,
-    4.944398403e+00f,
-    6.134014893e+01f,
-    1.795612144e+01f,
-    1.149558182e+02f,
-    1.241201401e+01f,
-    4.723494720e+01f,
-    2.542000198e+01f,
-    2.059097290e+01f,
-    3.849446774e-01f,
-    3.091780543e-01f,
-    1.531220627e+01f,
-    1.095693350e+00f,
-    8.815544128e+00f,
-    5.954585648e+01f,
-    4.327804947e+01f,
-    9.437916565e+01f,
-    9.427728653e+00f,
-    3.711512089e-01f,
-    5.649353266e-01f,
-    3.327352905e+01f,
-    5.479782104e+00f,
-    3.227311707e+01f,
-    3.899399519e+00f,
-    1.664006996e+01f,
-    7.484499359e+01f,
-    2.406234026e+00f,
-    6.191496849e+00f,
-    1.621768832e+00f,
-    7.348966980e+01f,
-    5.429013824e+01f,
-    2.745597839e+02f,
-    3.142672157e+01f,
-    1.479436016e+01f,
-    6.877748871e+01f,
-    8.892229795e-01f,
-    4.154928029e-01f,
-    2.591807842e-01f,
-    5.243560791e+01f,
-    1.442607880e+01f,
-    1.297485352e+02f,
-    8.067326546e+00f,
-    2.044362450e+01f,
-    1.055006561e+02f,
-    1.797276974e+00f,
-    1.743963361e+00f,
-    1.223952174e+00f,
-    6.802876282e+01f,
-    3.308891678e+01f,
-    2.095550537e+03f,
-    1.645879745e+01f,
-    4.973695427e-02f,
-    2.235582285e-02f,
-    1.759720993e+01f,
-    2.742573929e+01f,
-    3.402405605e-02f,
-    3.051734567e-01f,
-    4.950466380e-02f,
-    3.305273652e-01f,
-    2.837256193e-01f,
-    1.864525986e+01f,
-    4.159440517e+00f,
-    8.211725950e-01f,
-    2.009503603e+00f,
-    1.042217612e+00f,
-    6.589377671e-02f,
-    2.451572381e-02f,
-    9.187566757e+00f,
-    1.579726601e+01f,
-    4.593541101e-02f,
-    8.401174545e-01f,
-    8.154772967e-02f,
-    2.081224471e-01f,
-    5.960459709e-01f,
-    7.399691641e-02f,
-    1.988486671e+01f,
-    4.679290056e-01f,
-    1.071761847e+00f,
-    6.409290791e+00f,
-    2.890118957e-01f,
-    2.639517188e-01f,
-    1.088566303e+01f,
-    1.374955845e+01f,
-    2.013917160e+01f,
-    3.218437359e-02f,
-    1.304727346e-01f,
-    2.841176987e+00f,
-    1.241680458e-01f,
-    2.511593401e-01f,
-    2.494472265e+00f,
-    9.087306261e-01f,
-    4.868367314e-01f,
-    1.339339447e+01f,
-    4.258787632e-02f,
-    1.433083862e-01f,
-    1.715797806e+01f,
-    2.255457342e-01f,
-    1.484212041e+00f,
-    1.118691683e+00f,
-    7.056573629e-01f,
-    3.980496153e-02f,
-    3.447243929e+00f,
-    6.906407475e-01f,
-    1.119154572e+00f,
-    1.221164316e-01f,
-    8.114401102e-01f,
-    3.738783300e-01f,
-    5.141636729e-01f,
-    1.902822852e+00f,
-    5.767978430e-01f,
-    6.020914316e-01f,
-    2.209081352e-01f,
-    1.397865117e-01f,
-    5.040595531e+00f,
-    3.877521753e+00f,
-    2.785459280e+00f,
-    5.549348146e-02f,
-    7.188683748e-01f,
-    6.096580252e-02f,
-    1.547605753e+00f,
-    3.983100057e-01f,
-    4.265807271e-01f,
-    2.646574974e-01f,
-    1.245238423e+00f,
-    6.267650127e-01f,
-    1.037243977e-01f,
-    4.055348039e-01f,
-    1.787674725e-01f,
-    1.908874661e-01f,
-    9.346424788e-02f,
-    1.353259198e-02f,
-    1.133884862e-01f,
-    1.008943189e-02f,
-    3.223921537e+00f,
-    5.494377390e-02f,
-    6.156313419e-02f,
-    6.850062609e-01f,
-    6.789508462e-02f,
-    9.137941897e-02f,
-    2.173412144e-01f,
-    4.948632419e-02f,
-    5.456556007e-02f,
-    1.204221603e-02f,
-    4.728961270e-03f,
-    1.091276169e+00f,
-    3.857797623e+00f,
-    8.941675186e+00f,
-    8.612667084e+00f,
-    7.184824944e-01f,
-    1.570329547e+00f,
-    1.142078161e+00f,
-    7.024151325e+00f,
-    1.140861511e+00f,
-    4.384833276e-01f,
-    5.056912303e-01f,
-    9.348983318e-02f,
-    1.821283847e-01f,
-    1.023079991e+00f,
-    2.127902061e-01f,
-    3.903094292e+00f,
-    2.328569591e-01f,
-    1.149131894e+00f,
-    7.886473536e-01f,
-    2.649995983e-01f,
-    4.579413831e-01f,
-    1.016321182e+00f,
-    6.862248778e-01f,
-    1.103814602e+00f,
-    6.451712036e+01f,
-    1.416809916e+00f,
-    2.807700157e+00f,
-    3.463158131e+00f,
-    6.554808807e+01f,
-    1.187491798e+01f,
-    1.612792816e+02f,
-    1.389468689e+02f,
-    2.857650452e+02f,
-    4.935117245e+00f,
-    2.435408533e-02f,
-    7.131064683e-02f,
-    4.710958099e+01f,
-    8.286697865e-01f,
-    7.194613457e+00f,
-    2.655898666e+01f,
-    1.396738586e+02f,
-    2.457798004e+02f,
-    5.202292919e+00f,
-    1.008336022e-01f,
-    1.780567169e-01f,
-    1.437722931e+02f,
-    2.586984634e+00f,
-    2.717344971e+02f,
-    1.816202521e+00f,
-    1.430887318e+01f,
-    8.380812645e+00f,
-    2.693421555e+01f,
-    1.134502506e+01f,
-    1.793404007e+01f,
-    2.363343620e+01f,
-    9.931708527e+01f,
-    3.417530060e+01f,
-    5.706737995e+00f,
-    1.071521163e+00f,
-    4.539148137e-02f,
-    2.695220113e-01f,
-    2.136297226e+00f,
-    5.829227567e-01f,
-    1.711869836e+00f,
-    1.961176515e+00f,
-    1.856110382e+01f,
-    1.273081207e+01f,
-    1.767780542e+00f,
-    2.836168408e-01f,
-    1.284006596e+00f,
-    2.704254389e+00f,
-    3.555449963e+00f,
-    1.816173363e+01f,
-    9.508805275e+00f,
-    1.901954599e-02f,
-    7.362210751e-01f,
-    4.502106905e-01f,
-    4.682996124e-02f,
-    1.442445964e-01f,
-    2.036649361e-02f,
-    3.406716287e-01f,
-    7.554374635e-02f,
-    2.689505816e-01f,
-    5.958261713e-02f,
-    3.443359956e-02f,
-    3.015096486e-01f,
-    2.829158120e-02f,
-    5.085763708e-02f,
-    2.339806035e-02f,
-    1.293754578e-01f,
-    7.688291371e-02f,
-    2.887616493e-02f,
-    1.282861680e-01f,
-    1.377499662e-02f,
-    4.009910300e-02f,
-    1.019747034e-01f,
-    5.683780193e+00f,
-    1.241819039e-01f,
-    3.566671312e-01f,
-    4.136209965e+00f,
-    9.711331874e-02f,
-    1.712527573e-01f,
-    1.539762378e+00f,
-    5.850192070e+00f,
-    8.178876877e+00f,
-    1.675409265e-02f,
-    7.245552540e-02f,
-    2.858017921e+00f,
-    1.325701624e-01f,
-    2.661072910e-01f,
-    3.295312226e-01f,
-    7.775462866e-01f,
-    5.215394974e+00f,
-    1.922333613e-02f,
-    1.201751903e-01f,
-    5.085329533e+00f,
-    1.541149169e-01f,
-    4.933235347e-01f,
-    1.098531842e+00f,
-    2.071034536e-02f,
-    2.271929741e+00f,
-    3.056513667e-01f,
-    1.008312345e+00f,
-    4.198348150e-02f,
-    6.266279519e-02f,
-    3.724379838e-02f,
-    7.461913824e-01f,
-    1.013962999e-01f,
-    7.344655991e-01f,
-    5.585866421e-02f,
-    8.253131807e-02f,
-    2.391934544e-01f,
-    2.094078809e-01f,
-    1.114261821e-01f,
-    2.820303291e-02f,
-    1.356246769e-01f,
-    1.598548703e-02f,
-    6.834661961e-01f,
-    5.837898329e-02f,
-    7.802176476e-02f,
-    4.623680562e-02f,
-    6.787422299e-02f,
-    2.161406167e-02f,
-    3.086101729e-03f,
-    2.411690235e+00f,
-    1.421656966e+00f,
-    2.757083130e+01f,
-    4.230162621e+00f,
-    4.056567550e-01f,
-    3.367826700e+00f,
-    9.437225461e-01f,
-    3.830180168e-01f,
-    8.282509804e+00f,
-    1.623686314e+00f,
-    1.548794005e-02f,
-    2.228811979e+00f,
-    3.082519770e-02f,
-    5.488803610e-02f,
-    1.443355381e-01f,
-    4.279958084e-02f,
-    2.517482638e-02f,
-    5.556153655e-01f,
-    8.761074394e-03f,
-    3.251818474e-03f,
-    2.145914078e+00f,
-    1.129142046e+00f,
-    1.365052938e+00f,
-    2.487702608e+00f,
-    2.482536077e+00f,
-    1.044403791e+00f,
-    9.105243087e-01f,
-    3.811392784e+00f,
-    2.009815454e+00f,
-    9.805909157e+00f,
-    1.073545933e+00f,
-    1.297800303e+00f,
-    7.663856030e+00f,
-    3.484259415e+01f,
-    1.436421871e+00f,
-    6.436830163e-01f,
-    1.042191982e+00f,
-    2.364689636e+01f,
-    2.608095109e-01f,
-    2.298680782e+00f,
-    2.495120287e+00f,
-    1.137659168e+01f,
-    1.734689832e+00f,
-    7.997664809e-01f,
-    1.418825865e+00f,
-    1.926376152e+01f,
-    5.159757733e-01f,
-    1.705064535e+00f,
-    6.543698907e-01f,
-    1.237204838e+01f,
-    1.552275753e+01f,
-    3.868490219e+01f,
-    2.088554382e+01f,
-    3.973984146e+01f,
-    2.181518707e+02f,
-    4.090765953e+00f,
-    9.993179321e+00f,
-    4.885347784e-01f,
-    8.231550455e-01f,
-    1.500264359e+01f,
-    1.684574585e+02f,
-    3.417981386e+00f,
-    8.334267616e+00f,
-    1.058451172e+03f,
-    6.813843536e+01f,
-    3.081705809e+00f,
-    5.228657246e+00f,
-    1.424332142e+01f,
-    8.211235046e+00f,
-    1.271187973e+01f,
-    2.253992653e+01f,
-    4.830832481e+00f,
-    1.415095615e+01f,
-    1.050749111e+01f,
-    6.590016365e+00f,
-    4.886687279e+00f,
-    1.619291496e+01f,
-    2.978640556e+00f,
-    9.416593313e-01f,
-    4.580125213e-01f,
-    9.484608173e-01f,
-    1.074156189e+01f,
-    1.968173265e+00f,
-    7.519626021e-01f,
-    4.160782695e-01f,
-    7.567501664e-01f,
-    6.878278732e+00f,
-    2.305055782e-02f,
-    5.393682048e-02f,
-    1.225544643e+01f,
-    2.849501991e+01f,
-    5.850362182e-01f,
-    8.839882612e-01f,
-    6.062232852e-01f,
-    1.696629524e+01f,
-    6.444584578e-02f,
-    3.253005072e-02f,
-    1.233683586e+00f,
-    1.723303986e+01f,
-    7.519774628e+01f,
-    2.744027901e+01f,
-    1.097765541e+01f,
-    4.211644173e+00f,
-    1.122862935e+00f,
-    2.454163361e+01f,
-    1.757656860e+01f,
-    7.892148590e+01f,
-    1.682472801e+01f,
-    4.365636826e+00f,
-    7.725688815e-01f,
-    3.776230621e+01f,
-    5.701435089e+01f,
-    6.840528107e+01f,
-    5.188241196e+01f,
-    4.418450546e+01f,
-    1.903840601e-01f,
-    7.584948540e-01f,
-    1.572256923e+00f,
-    4.656435177e-02f,
-    6.853574514e-02f,
-    8.099057078e-01f,
-    7.198663354e-01f,
-    1.223490462e-01f,
-    3.069262803e-01f,
-    1.721123755e-01f,
-    1.495682448e-02f,
-    1.980467886e-02f,
-    7.496084571e-01f,
-    3.268646002e-01f,
-    4.356951416e-01f,
-    6.565452814e-01f,
-    2.303200662e-01f,
-    1.037397794e-02f,
-    1.109922770e-02f,
-    7.377184182e-02f,
-    8.725264072e-01f,
-    4.188097954e+00f,
-    4.621860981e+00f,
-    1.590839982e+00f,
-    3.059643269e+00f,
-    6.323554993e+00f,
-    1.649127483e+00f,
-    4.295524597e+00f,
-    2.573122829e-02f,
-    1.111967564e-01f,
-    2.503494263e+00f,
-    2.156969607e-01f,
-    8.890527487e-01f,
-    1.095380902e+00f,
-    7.150796056e-01f,
-    6.511534214e+00f,
-    3.800426424e-01f,
-    1.598047763e-01f,
-    6.394465446e+00f,
-    1.238413692e+00f,
-    2.896145105e+00f,
-    1.893595010e-01f,
-    4.079138279e+00f,
-    3.354861975e+00f,
-    7.615976334e+00f,
-    5.831032276e+00f,
-    2.767882824e+00f,
-    1.594605255e+01f,
-    7.954412103e-01f,
-    9.940627813e-01f,
-    1.192740679e+00f,
-    2.189678669e+00f,
-    1.567875290e+01f,
-    1.074017808e-01f,
-    2.681199014e-01f,
-    6.748379469e-01f,
-    6.966387939e+01f,
-    5.379782486e+01f,
-    1.651948929e+01f,
-    3.677925348e+00f,
-    1.068434596e+00f,
-    3.095085716e+01f,
-    4.016212082e+01f,
-    4.737694550e+01f,
-    9.536681366e+01f,
-    1.598924637e+01f,
-    7.576922774e-01f,
-    1.081007309e+02f,
-    3.952450867e+02f,
-    4.168658447e+02f,
-    1.669674377e+02f,
-    5.142185688e+00f,
-    1.836073279e+00f,
-    2.692134619e+00f,
-    4.511366785e-01f,
-    1.075300813e+00f,
-    2.334369898e+00f,
-    3.787271023e+00f,
-    3.399607539e-01f,
-    5.388651490e-01f,
-    8.612264991e-01f,
-    4.429777712e-02f,
-    7.466466725e-02f,
-    4.065872669e+00f,
-    1.091901898e+00f,
-    5.050775409e-01f,
-    6.589374542e-01f,
-    1.527190685e+00f,
-    8.184332401e-02f,
-    4.155911878e-02f,
-    6.015754938e-01f,
-    1.559698963e+01f,
-    6.921329498e+00f,
-    6.184251308e+00f,
-    1.913939667e+01f,
-    4.395193577e+00f,
-    7.958170891e+00f,
-    3.948697820e-02f,
-    9.695278853e-02f,
-    8.799914360e+00f,
-    1.230962396e+00f,
-    1.168569183e+01f,
-    1.042864203e+00f,
-    1.091408491e+00f,
-    1.874604607e+01f,
-    4.137903452e-01f,
-    1.284947276e+00f,
-    2.515162849e+01f,
-    1.952702522e+01f,
-    5.586679459e+01f,
-    3.063069582e-01f,
-    2.379303455e+00f,
-    1.482332993e+01f,
-    1.796167254e+00f,
-    5.009984970e-01f,
-    1.065697595e-01f,
-    1.289911509e+00f,
-    7.164651155e-01f,
-    1.289669752e+00f,
-    2.751971781e-01f,
-    1.219252646e-01f,
-    5.616502762e-01f,
-    1.921135038e-01f,
-    1.116012812e+00f,
-    2.303283364e-01f,
-    1.971152276e-01f,
-    2.208558619e-01f,
-    9.211238027e-01f,
-    7.517620921e-01f,
-    9.459023923e-02f,
-    7.615273595e-01f,
-    1.433849186e-01f,
-    5.550500378e-02f,
-    1.562097430e+00f,
-    1.408766985e+00f,
-    1.751380920e+01f,
-    1.390051365e+01f,
-    1.756380463e+01f,
-    9.109016418e+00f,
-    6.823797226e-01f,
-    2.105081081e-01f,
-    2.215445709e+01f,
-    7.725765991e+01f,
-    1.165655804e+01f,
-    7.733724117e-01f,
-    2.871894538e-01f,
-    1.232698373e-02f,
-    3.628704697e-02f,
-    1.095193326e-01f,
-    1.246156022e-01f,
-    1.620207787e+00f,
-    5.879065394e-01f,
-    4.804249387e-03f,
-    4.594690353e-02f,
-    1.190039963e-01f,
-    5.848494768e-01f,
-    1.483329106e-02f,
-    1.308298397e+01f,
-    4.099576473e+00f,
-    2.110964584e+01f,
-    1.810297608e+00f,
-    2.321069092e-01f,
-    2.240617126e-01f,
-    6.626685858e-01f,
-    7.509336472e+00f,
-    2.535311937e+00f,
-    4.102033138e+00f,
-    9.289441258e-02f,
-    3.594322801e-01f,
-    3.804579377e-02f,
-    1.759029984e+00f,
-    7.961671352e-01f,
-    1.381998658e+00f,
-    5.437311158e-02f,
-    2.494921535e-01f,
-    5.835436657e-02f,
-    2.331567258e-01f,
-    2.840243280e-01f,
-    7.530593276e-01f,
-    5.302642584e-01f,
-    1.984440923e+00f,
-    2.003261089e+00f,
-    6.201537848e-01f,
-    2.683054283e-02f,
-    9.608205408e-03f,
-    9.589166045e-01f,
-    6.742230654e-01f,
-    3.222076893e+00f,
-    2.019356966e+00f,
-    6.581980586e-01f,
-    5.025843382e-01f,
-    2.582390606e-01f,
-    1.520968795e+00f,
-    2.163050026e-01f,
-    5.355581045e-01f,
-    3.958700418e+00f,
-    8.970844269e+00f,
-    3.535439253e+00f,
-    2.850524187e+00f,
-    5.729645252e+00f,
-    1.465515852e+00f,
-    3.560455561e+00f,
-    1.274189854e+01f,
-    5.983716488e+00f,
-    5.477819443e+00f,
-    2.786155701e+00f,
-    3.128551245e+00f,
-    8.667615056e-01f,
-    1.062161326e+00f,
-    5.895208716e-01f,
-    2.764769793e+00f,
-    5.201160431e+00f,
-    2.621289968e+00f,
-    9.656164646e-01f,
-    5.799233913e-01f,
-    1.014924717e+01f,
-    2.320521927e+01f,
-    3.191824257e-01f,
-    4.097483456e-01f,
-    1.055685520e+00f,
-    9.765588760e+00f,
-    5.436700058e+01f,
-    6.336721182e-01f,
-    4.922453308e+01f,
-    4.420380116e+00f,
-    3.107735395e+00f,
-    4.315356445e+01f,
-    3.351120055e-01f,
-    2.111622095e-01f,
-    1.627833366e+01f,
-    8.238667297e+01f,
-    4.403060532e+01f,
-    3.699086761e+01f,
-    5.802698135e-01f,
-    2.343019247e+00f,
-    1.917203369e+02f,
-    1.432969604e+03f,
-    1.622821999e+01f,
-    9.723864198e-01f,
-    1.913686991e+00f,
-    9.545809627e-01f,
-    1.593427181e+00f,
-    1.294978619e+01f,
-    2.036433105e+02f,
-    1.119410157e+00f,
-    4.328543854e+01f,
-    7.084708405e+01f,
-    5.363591194e+00f,
-    6.038209796e-01f,
-    6.152355671e-01f,
-    5.194577694e+00f,
-    2.359275103e+00f,
-    3.893862665e-01f,
-    8.022220433e-02f,
-    2.603591979e-01f,
-    2.191429138e+00f,
-    5.115429878e+00f,
-    3.088465452e+00f,
-    2.111738777e+01f,
-    2.623721838e+00f,
-    1.890715480e+00f,
-    1.518885344e-01f,
-    1.065847278e-01f,
-    3.115766048e-01f,
-    7.414596677e-01f,
-    9.990603477e-02f,
-    5.071329474e-01f,
-    2.920636237e-01f,
-    1.469508410e-01f,
-    9.340875745e-01f,
-    1.524040550e-01f,
-    7.600128055e-01f,
-    2.600532174e-01f,
-    1.426960468e+00f,
-    1.220367508e+02f,
-    2.994780988e-02f,
-    9.209003299e-02f,
-    4.597120881e-01f,
-    5.183596611e+00f,
-    4.601176834e+01f,
-    4.112317505e+02f,
-    1.053075716e-01f,
-    2.794674337e-01f,
-    3.712215424e+00f,
-    3.067883606e+02f,
-    5.055349350e+00f,
-    2.495761633e+00f,
-    4.256970808e-02f,
-    1.045160666e-01f,
-    5.696469545e-01f,
-    2.185435772e+00f,
-    6.189457321e+01f,
-    1.787128568e+00f,
-    2.082727253e-01f,
-    7.771708369e-01f,
-    5.279941082e+00f,
-    1.668454170e+01f,
-    2.017192841e+00f,
-    4.517201483e-01f,
-    4.287236631e-01f,
-    1.295206904e+00f,
-    4.869677722e-01f,
-    1.021862999e-01f,
-    5.750505924e-01f,
-    6.707958579e-01f,
-    1.387682408e-01f,
-    1.951130927e-01f,
-    3.870233917e+01f,
-    1.720595062e-01f,
-    4.365048110e-01f,
-    1.284636307e+01f,
-    1.397253418e+02f,
-    1.937111969e+02f,
-    1.910037398e-01f,
-    1.445000887e+00f,
-    3.115053940e+01f,
-    1.165015991e+03f,
-    1.368076897e+01f,
-    9.763557911e-01f,
-    4.045227468e-01f,
-    9.924421310e-01f,
-    1.215134811e+01f,
-    8.290617943e+00f,
-    1.165138364e+00f,
-    1.892461330e-01f,
-    8.978952765e-01f,
-    2.039284229e+00f,
-    1.855357361e+01f,
-    1.833676577e+00f,
-    3.048063815e-01f,
-    2.132543474e-01f,
-    1.441621065e+00f,
-    1.276456237e+00f,
-    4.282001495e+00f,
-    1.442953348e+00f,
-    1.736773491e+00f,
-    5.305966377e+00f,
-    1.563254714e+00f,
-    9.337124228e-01f,
-    1.440559030e+00f,
-    3.024514675e+00f,
-    5.105652809e-01f,
-    7.573712468e-01f,
-    2.704105854e+00f,
-    5.427617952e-02f,
-    3.310196698e-01f,
-    1.749350280e-01f,
-    4.111740366e-02f,
-    5.103452802e-01f,
-    1.917450316e-02f,
-    3.268690547e-03f,
-    2.469925210e-02f,
-    1.313983083e+00f,
-    8.028479815e-01f,
-    2.083907463e-02f,
-    3.002246609e-03f,
-    9.035937488e-02f,
-    3.584630415e-02f,
-    2.784176543e-02f,
-    1.718132198e-01f,
-    4.396910593e-02f,
-    5.857581645e-02f,
-    2.017041668e-02f,
-    1.656089909e-02f,
-    7.473767269e-03f,
-    7.938371599e-02f,
-    3.437063098e-02f,
-    5.366548896e-02f,
-    5.340271592e-01f,
-    5.332444310e-01f,
-    4.101272225e-01f,
-    2.302231081e-02f,
-    6.983868312e-03f,
-    1.308178455e-01f,
-    5.075954795e-01f,
-    2.862652242e-01f,
-    8.072211593e-02f,
-    2.601337433e+00f,
-    6.369437575e-01f,
-    1.204535723e+00f,
-    1.522938848e+00f,
-    2.778976597e-02f,
-    3.571718559e-02f,
-    7.926995307e-02f,
-    5.314346552e-01f,
-    2.510853484e-02f,
-    6.713365205e-03f,
-    8.651716113e-01f,
-    4.975683242e-02f,
-    9.475001693e-02f,
-    4.454482719e-02f,
-    1.147889346e-01f,
-    3.551613167e-02f,
-    1.510881074e-02f,
-    4.626689851e-02f,
-    3.511366993e-02f,
-    1.243628375e-02f,
-    3.563271463e-01f,
-    1.544308849e-02f,
-    2.507906854e-01f,
-    2.818794250e-01f,
-    4.704883788e-03f,
-    1.943344474e-01f,
-    3.549976647e-01f,
-    4.339289963e-01f,
-    3.610242605e-01f,
-    2.157560587e-01f,
-    4.866844714e-01f,
-    1.083661541e-01f,
-    4.392164201e-02f,
-    3.922111750e+00f,
-    2.206678391e-01f,
-    4.772524834e-01f,
-    3.747911006e-02f,
-    9.473985434e-02f,
-    5.810631439e-02f,
-    2.498003578e+01f,
-    2.219764709e+00f,
-    1.221933682e-02f,
-    5.184558220e-03f,
-    1.259642541e-01f,
-    3.708994016e-02f,
-    1.326550841e-01f,
-    1.201005429e-01f,
-    9.304033518e-01f,
-    1.498397905e-02f,
-    3.042578697e-02f,
-    2.239696350e+02f,
-    1.494488418e-01f,
-    3.552144470e+02f,
-    6.256647110e-01f,
-    1.147260666e+01f,
-    1.272438467e-01f,
-    5.644392490e+00f,
-    2.517356634e+00f,
-    5.914530531e-02f,
-    2.018945664e-01f,
-    6.457240880e-02f,
-    9.509602562e-03f,
-    2.636435628e-01f,
-    9.120963216e-01f,
-    2.174026489e+00f,
-    5.403859615e-01f,
-    1.672558039e-01f,
-    9.915047884e-01f,
-    1.636180133e-01f,
-    1.616658643e-02f,
-    7.577888370e-01f,
-    7.777656894e-03f,
-    3.591119349e-01f,
-    3.969476372e-02f,
-    1.084953845e-01f,
-    3.028351255e-02f,
-    6.608402133e-01f,
-    3.161843121e-02f,
-    4.498634636e-01f,
-    7.292074203e+00f,
-    7.099695504e-03f,
-    7.843043422e-04f
-};
@@ -6,11 +6,29 @@
 #include "Random.h"
 #include "Utils.h"
 
+std::atomic<uint32> Random::s_generation{0};
+std::atomic<uint32> Random::s_threads_seeded{0};
+uint32 Random::s_seed;
+
 Random* Random::get_Rng(void) {
     static thread_local Random s_rng;
+    static thread_local uint32 s_rng_generation = 0;
+    uint32 generation = s_generation.load(std::memory_order_acquire);
+    if (s_rng_generation != generation) {
+        s_rng_generation = generation;
+        uint32 index = s_threads_seeded++;
+        s_rng.seedrandom(s_seed + index * 0x9E3779B9);
+    }
     return &s_rng;
 }
 
+void Random::seed_all(uint32 seed) {
+    s_seed = seed;
+    s_threads_seeded = 0;
+    s_generation.fetch_add(1, std::memory_order_release);
+    get_Rng();
+}
+
 Random::Random(int seed) {
     if (seed == -1) {
         size_t thread_id =
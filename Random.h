@@ -2,6 +2,7 @@
 #define RANDOM_H_INCLUDED
 
 #include "config.h"
+#include <atomic>
 #include <limits>
 
 /*
@@ -32,8 +33,18 @@ public:
 
     // return the thread local RNG
     static Random* get_Rng(void);
+    /*
+        Reseed the RNGs of all threads from seed. Each thread picks
+        up a seed of its own the next time it asks for its RNG, the
+        calling thread gets the first one.
+    */
+    static void seed_all(uint32 seed);
 
 private:
+    static std::atomic<uint32> s_generation;
+    static std::atomic<uint32> s_threads_seeded;
+    static uint32 s_seed;
+
     uint64 random(void);
     uint64 m_s[2];
 };
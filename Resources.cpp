@@ -0,0 +1,142 @@
+#include "config.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "Resources.h"
+#include "GTP.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+constexpr uint32 Resources::VERSION;
+
+namespace {
+    // Little endian, as written by params/mkdata.py
+    struct FileHeader {
+        char m_magic[4];
+        uint32 m_version;
+        uint32 m_entries;
+        uint32 m_reserved;
+    };
+
+    struct FileEntry {
+        char m_name[24];
+        char m_type;
+        char m_pad[3];
+        uint32 m_count;
+        uint64 m_offset;
+        uint64 m_checksum;
+    };
+
+    const char MAGIC[4] = {'L', 'Z', 'D', 'T'};
+
+    size_t type_size(char type) {
+        switch (type) {
+        case 'i':
+        case 'f':
+            return 4;
+        case 'd':
+        case 'q':
+            return 8;
+        default:
+            return 0;
+        }
+    }
+}
+
+Resources * Resources::get_Resources() {
+    static Resources s_resources;
+    return &s_resources;
+}
+
+Resources::Resources() {
+    if (!open(cfg_data_file)) {
+        myprintf("Could not load the data file %s\n", cfg_data_file.c_str());
+        exit(EXIT_FAILURE);
+    }
+}
+
+bool Resources::open(const std::string & filename) {
+    if (!m_file.open(filename)) {
+        return false;
+    }
+    const char * data = m_file.data();
+    size_t size = m_file.size();
+
+    FileHeader header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.m_magic, MAGIC, sizeof(MAGIC))) {
+        return false;
+    }
+    if (header.m_version != VERSION) {
+        myprintf("%s has version %d, expected %d\n",
+                 filename.c_str(), header.m_version, VERSION);
+        return false;
+    }
+    if (header.m_entries > (size - sizeof(header)) / sizeof(FileEntry)) {
+        return false;
+    }
+
+    for (uint32 i = 0; i < header.m_entries; i++) {
+        FileEntry entry;
+        std::memcpy(&entry, data + sizeof(header) + i * sizeof(entry),
+                    sizeof(entry));
+        std::string name(entry.m_name,
+                         strnlen(entry.m_name, sizeof(entry.m_name)));
+        size_t bytes = entry.m_count * type_size(entry.m_type);
+        if (!type_size(entry.m_type)
+            || entry.m_offset > size || bytes > size - entry.m_offset
+            || Utils::fnv1a(data + entry.m_offset, bytes) != entry.m_checksum) {
+            myprintf("Table %s in %s is damaged\n",
+                     name.c_str(), filename.c_str());
+            return false;
+        }
+        Table table;
+        table.m_type = entry.m_type;
+        table.m_count = entry.m_count;
+        table.m_data = data + entry.m_offset;
+        table.m_checksum = entry.m_checksum;
+        m_tables.emplace(name, table);
+    }
+    return true;
+}
+
+const void * Resources::find(const char * name, char type,
+                             size_t count) const {
+    auto it = m_tables.find(name);
+    if (it == m_tables.end()) {
+        myprintf("Table %s is missing from %s\n", name, cfg_data_file.c_str());
+        exit(EXIT_FAILURE);
+    }
+    const Table & table = it->second;
+    if (table.m_type != type || table.m_count != count) {
+        myprintf("Table %s in %s has %d elements of type %c, expected %d of %c\n",
+                 name, cfg_data_file.c_str(), (int)table.m_count,
+                 table.m_type, (int)count, type);
+        exit(EXIT_FAILURE);
+    }
+    return table.m_data;
+}
+
+size_t Resources::size(const char * name) {
+    const Resources * resources = get_Resources();
+    auto it = resources->m_tables.find(name);
+    if (it == resources->m_tables.end()) {
+        return 0;
+    }
+    return it->second.m_count;
+}
+
+uint64 Resources::checksum(const char * name) {
+    const Resources * resources = get_Resources();
+    auto it = resources->m_tables.find(name);
+    if (it == resources->m_tables.end()) {
+        return 0;
+    }
+    return it->second.m_checksum;
+}
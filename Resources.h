@@ -0,0 +1,54 @@
+#ifndef RESOURCES_H_INCLUDED
+#define RESOURCES_H_INCLUDED
+
+#include "config.h"
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include "MappedFile.h"
+
+/*
+    The generated tables (patterns, policy weights, the opening book...)
+    live in a data file that is mapped at startup, rather than being
+    compiled in. Every table carries a checksum that is verified when
+    the file is opened. params/mkdata.py writes the file.
+*/
+class Resources {
+public:
+    static constexpr uint32 VERSION = 1;
+
+    // A table of exactly count elements, exits if it is missing
+    template <typename T>
+    static const T * get(const char * name, size_t count) {
+        return static_cast<const T *>(
+            get_Resources()->find(name, type_code(T()), count));
+    }
+    // Number of elements in a table, 0 if it is missing
+    static size_t size(const char * name);
+    static uint64 checksum(const char * name);
+
+private:
+    struct Table {
+        char m_type;
+        size_t m_count;
+        const char * m_data;
+        uint64 m_checksum;
+    };
+
+    Resources();
+    static Resources * get_Resources();
+    bool open(const std::string & filename);
+    const void * find(const char * name, char type, size_t count) const;
+
+    static char type_code(int) { return 'i'; }
+    static char type_code(float) { return 'f'; }
+    static char type_code(double) { return 'd'; }
+    static char type_code(uint64) { return 'q'; }
+
+    MappedFile m_file;
+    std::unordered_map<std::string, Table> m_tables;
+};
+
+#endif
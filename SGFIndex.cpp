@@ -0,0 +1,310 @@
+#include "config.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "SGFIndex.h"
+#include "SGFStream.h"
+#include "Utils.h"
+
+namespace {
+    /*
+        All numbers little endian, like the data file of Resources.
+
+        header  magic "LZSI", uint32 version, uint64 file count
+        file    uint32 name length, name, uint64 size, int64 mtime,
+                uint64 checksum, uint64 game count
+        game    uint64 offset, uint64 size, for each game of the file
+    */
+    constexpr size_t HEADER_SIZE = 4 + 4 + 8;
+    constexpr size_t FILE_SIZE = 4 + 8 + 8 + 8 + 8;
+    constexpr size_t GAME_SIZE = 8 + 8;
+
+    // Bytes at the start and at the end of a file that are checksummed
+    constexpr uint64 CHECK_BYTES = 4096;
+
+    template <typename T>
+    void put(std::string & out, T value) {
+        auto bits = static_cast<uint64>(value);
+        for (size_t i = 0; i < sizeof(value); i++) {
+            out.push_back(static_cast<char>(bits & 0xFF));
+            bits >>= 8;
+        }
+    }
+
+    template <typename T>
+    T get(const std::string & in, size_t pos) {
+        uint64 bits = 0;
+        for (size_t i = sizeof(T); i-- > 0; ) {
+            bits = (bits << 8) | static_cast<unsigned char>(in[pos + i]);
+        }
+        return static_cast<T>(bits);
+    }
+
+    bool is_directory(const std::string & path) {
+        struct stat info;
+        return stat(path.c_str(), &info) == 0
+               && (info.st_mode & S_IFMT) == S_IFDIR;
+    }
+}
+
+SGFIndex::SGFIndex(const std::string & path) {
+    const bool directory = is_directory(path);
+    const std::string index_name =
+        directory ? path + "/.leela.idx" : path + ".idx";
+    // Names in the index don't include where the index is
+    size_t prefix = 0;
+    if (directory) {
+        prefix = path.size() + 1;
+    } else {
+        auto slash = path.find_last_of("/\\");
+        if (slash != std::string::npos) {
+            prefix = slash + 1;
+        }
+    }
+
+    size_t regular = 0;
+    for (auto & filename : SGFStream::list_files(path)) {
+        File file;
+        file.m_filename = filename;
+        file.m_name = filename.substr(prefix);
+        file.m_regular = get_stamp(filename, file.m_stamp);
+        if (!file.m_regular || !directory) {
+            // Throws if it can't be read
+            file.m_collection.reset(new SGFCollection(filename));
+        }
+        if (file.m_regular) {
+            regular++;
+        }
+        m_files.push_back(std::move(file));
+    }
+    if (regular == 0) {
+        // Pipes, there is nothing to stamp an index with
+        for (auto & file : m_files) {
+            file.m_games = scan(*file.m_collection);
+        }
+    } else {
+        size_t entries = load(index_name, m_files);
+        bool changed = entries != regular;
+        for (auto & file : m_files) {
+            if (file.m_indexed) {
+                continue;
+            }
+            if (file.m_collection) {
+                file.m_games = scan(*file.m_collection);
+            } else {
+                // One mapping at a time
+                file.m_games = scan(SGFCollection(file.m_filename));
+            }
+            changed |= file.m_regular;
+        }
+        if (changed) {
+            save(index_name, m_files);
+        }
+    }
+
+    for (auto & file : m_files) {
+        file.m_first = m_size;
+        m_size += file.m_games.size();
+    }
+}
+
+size_t SGFIndex::size() const {
+    return m_size;
+}
+
+std::string SGFIndex::get_game(size_t index) const {
+    if (index >= m_size) {
+        throw std::runtime_error("No such game in file");
+    }
+    // The last file starting at or before index. Files without games
+    // start where the next one does, so they are never picked.
+    auto file = std::upper_bound(m_files.begin(), m_files.end(), index,
+        [](size_t i, const File & f) { return i < f.m_first; }) - 1;
+    auto & game = file->m_games[index - file->m_first];
+    if (file->m_collection) {
+        return std::string(file->m_collection->data() + game.m_offset,
+                           game.m_size);
+    }
+
+    std::ifstream in(file->m_filename, std::ifstream::binary);
+    std::string result(game.m_size, '\0');
+    in.seekg(game.m_offset);
+    in.read(&result[0], result.size());
+    if (!in) {
+        throw std::runtime_error("Error reading file");
+    }
+    return result;
+}
+
+std::vector<SGFIndex::Game> SGFIndex::scan(const SGFCollection & collection) {
+    std::vector<Game> games;
+    SGFScanner scanner = collection.scanner();
+    boost::string_view game;
+
+    while (scanner.next(game)) {
+        games.push_back({uint64(game.data() - collection.data()),
+                         game.size()});
+    }
+    if (games.empty() && scanner.has_unclosed_game()) {
+        game = scanner.remainder();
+        games.push_back({uint64(game.data() - collection.data()),
+                         game.size()});
+    }
+
+    return games;
+}
+
+// false if it isn't a regular file, pipes get no index
+bool SGFIndex::get_stamp(const std::string & filename, Stamp & stamp) {
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0
+        || (info.st_mode & S_IFMT) != S_IFREG) {
+        return false;
+    }
+    stamp.m_size = info.st_size;
+#if defined(__APPLE__)
+    stamp.m_mtime = int64(info.st_mtimespec.tv_sec) * 1000000000
+                    + info.st_mtimespec.tv_nsec;
+#elif defined(WIN32)
+    stamp.m_mtime = int64(info.st_mtime) * 1000000000;
+#else
+    stamp.m_mtime = int64(info.st_mtim.tv_sec) * 1000000000
+                    + info.st_mtim.tv_nsec;
+#endif
+
+    std::ifstream in(filename, std::ifstream::binary);
+    std::string head(std::min(stamp.m_size, CHECK_BYTES), '\0');
+    in.read(&head[0], head.size());
+    stamp.m_checksum = Utils::fnv1a(head.data(), head.size());
+    if (stamp.m_size > CHECK_BYTES) {
+        std::string tail(std::min(stamp.m_size - CHECK_BYTES, CHECK_BYTES),
+                         '\0');
+        in.seekg(stamp.m_size - tail.size());
+        in.read(&tail[0], tail.size());
+        stamp.m_checksum = Utils::fnv1a(tail.data(), tail.size(),
+                                        stamp.m_checksum);
+    }
+    return bool(in);
+}
+
+// Returns the number of files in the index
+size_t SGFIndex::load(const std::string & filename, std::vector<File> & files) {
+    std::ifstream in(filename, std::ifstream::binary);
+    if (!in) {
+        return 0;
+    }
+    std::string data((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+
+    if (data.size() < HEADER_SIZE
+        || data.compare(0, 4, "LZSI") != 0
+        || get<uint32>(data, 4) != VERSION) {
+        return 0;
+    }
+
+    std::unordered_map<std::string, File *> by_name;
+    for (auto & file : files) {
+        if (file.m_regular) {
+            by_name.emplace(file.m_name, &file);
+        }
+    }
+
+    auto count = get<uint64>(data, 8);
+    size_t pos = HEADER_SIZE;
+    for (uint64 i = 0; i < count; i++) {
+        if (data.size() - pos < 4) {
+            return i;
+        }
+        auto name_size = get<uint32>(data, pos);
+        if (data.size() - pos < name_size + FILE_SIZE) {
+            return i;
+        }
+        pos += 4;
+        std::string name = data.substr(pos, name_size);
+        pos += name_size;
+        Stamp stamp;
+        stamp.m_size = get<uint64>(data, pos);
+        stamp.m_mtime = get<int64>(data, pos + 8);
+        stamp.m_checksum = get<uint64>(data, pos + 16);
+        auto games = get<uint64>(data, pos + 24);
+        pos += FILE_SIZE - 4;
+        if ((data.size() - pos) / GAME_SIZE < games) {
+            return i;
+        }
+
+        auto it = by_name.find(name);
+        if (it != by_name.end()
+            && it->second->m_stamp.m_size == stamp.m_size
+            && it->second->m_stamp.m_mtime == stamp.m_mtime
+            && it->second->m_stamp.m_checksum == stamp.m_checksum) {
+            File & file = *it->second;
+            file.m_games.resize(games);
+            file.m_indexed = true;
+            for (size_t j = 0; j < games; j++) {
+                file.m_games[j].m_offset = get<uint64>(data, pos);
+                file.m_games[j].m_size = get<uint64>(data, pos + 8);
+                pos += GAME_SIZE;
+                if (file.m_games[j].m_offset + file.m_games[j].m_size
+                    > stamp.m_size) {
+                    file.m_games.clear();
+                    file.m_indexed = false;
+                    return i;
+                }
+            }
+        } else {
+            pos += games * GAME_SIZE;
+        }
+    }
+
+    return count;
+}
+
+void SGFIndex::save(const std::string & filename,
+                    const std::vector<File> & files) {
+    uint64 count = std::count_if(files.begin(), files.end(),
+        [](const File & file) { return file.m_regular; });
+
+    std::string data("LZSI");
+    put<uint32>(data, VERSION);
+    put<uint64>(data, count);
+    for (auto & file : files) {
+        if (!file.m_regular) {
+            continue;
+        }
+        put<uint32>(data, file.m_name.size());
+        data.append(file.m_name);
+        put<uint64>(data, file.m_stamp.m_size);
+        put<int64>(data, file.m_stamp.m_mtime);
+        put<uint64>(data, file.m_stamp.m_checksum);
+        put<uint64>(data, file.m_games.size());
+        for (auto & game : file.m_games) {
+            put<uint64>(data, game.m_offset);
+            put<uint64>(data, game.m_size);
+        }
+    }
+
+    // Readers never see half an index
+    auto tmpname = filename + ".tmp";
+    {
+        std::ofstream out(tmpname, std::ofstream::binary);
+        out.write(data.data(), data.size());
+        if (!out) {
+            // A read-only directory, we'll scan again next time
+            std::remove(tmpname.c_str());
+            return;
+        }
+    }
+    std::remove(filename.c_str());
+    if (std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+        std::remove(tmpname.c_str());
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef SGFINDEX_H_INCLUDED
+#define SGFINDEX_H_INCLUDED
+
+#include "config.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SGFScanner.h"
+
+/*
+    The games of an SGF file, or of all .sgf files in a directory, by
+    number. Where each game starts and ends is kept in one index file,
+    the SGF file's name plus ".idx", or ".leela.idx" inside the
+    directory. So a collection is only scanned the first time, and a
+    file again after it changed.
+
+    A single file stays mapped and a game is a copy out of it. Files in
+    a directory are only opened to read a game, there can be more of
+    them than the system allows mappings.
+*/
+class SGFIndex {
+public:
+    static constexpr uint32 VERSION = 2;
+
+    // Throws std::runtime_error if path can't be read
+    explicit SGFIndex(const std::string & path);
+
+    size_t size() const;
+    std::string get_game(size_t index) const;
+
+private:
+    struct Game {
+        uint64 m_offset;
+        uint64 m_size;
+    };
+    /*
+        What the index remembers of a file to tell it changed. The
+        time has nanoseconds where the system keeps them, the checksum
+        covers the start and end of the file for writes within the
+        same tick.
+    */
+    struct Stamp {
+        uint64 m_size;
+        int64 m_mtime;
+        uint64 m_checksum;
+    };
+    struct File {
+        std::string m_filename;
+        // Name in the index, relative to where the index is
+        std::string m_name;
+        Stamp m_stamp;
+        std::vector<Game> m_games;
+        // Games in the files before this one
+        size_t m_first;
+        // Has a stamp, so it goes into the index
+        bool m_regular{false};
+        // Games came from the index
+        bool m_indexed{false};
+        // Only kept for a single file or one that can't be reopened
+        std::unique_ptr<SGFCollection> m_collection;
+    };
+
+    static std::vector<Game> scan(const SGFCollection & collection);
+    static bool get_stamp(const std::string & filename, Stamp & stamp);
+    /*
+        Fills in the games of the files whose stamps still match.
+        Returns how many files the index has.
+    */
+    static size_t load(const std::string & filename,
+                       std::vector<File> & files);
+    static void save(const std::string & filename,
+                     const std::vector<File> & files);
+
+    std::vector<File> m_files;
+    size_t m_size{0};
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
 #include <cctype>
 #include <string>
 #include <memory>
@@ -9,83 +10,61 @@
 
 #include "Utils.h"
 #include "SGFParser.h"
+#include "SGFIndex.h"
+#include "SGFScanner.h"
 
-std::vector<std::string> SGFParser::chop_stream(std::istream& ins,
+std::vector<std::string> SGFParser::chop_buffer(const char * data,
+                                                size_t size,
                                                 size_t stopat) {
     std::vector<std::string> result;
-    std::string gamebuff;
-
-    ins >> std::noskipws;
-
-    int nesting = 0;      // parentheses
-    bool intag = false;   // brackets
-    int line = 0;
-    gamebuff.clear();
+    SGFScanner scanner(data, size);
+    boost::string_view game;
 
-    char c;
-    while (ins >> c && result.size() <= stopat) {
-        if (c == '\n') line++;
-
-        gamebuff.push_back(c);
-        if (c == '\\') {
-            // read literal char
-            ins >> c;
-            gamebuff.push_back(c);
-            // Skip special char parsing
-            continue;
-        }
-
-        if (c == '(' && !intag) {
-            if (nesting == 0) {
-                // eat ; too
-                do {
-                    ins >> c;
-                } while(std::isspace(c) && c != ';');
-                gamebuff.clear();
-            }
-            nesting++;
-        } else if (c == ')' && !intag) {
-            nesting--;
-
-            if (nesting == 0) {
-                result.push_back(gamebuff);
-            }
-        } else if (c == '[' && !intag) {
-            intag = true;
-        } else if (c == ']') {
-            if (intag == false) {
-                Utils::myprintf("Tag error on line %d", line);
-            }
-            intag = false;
-        }
+    while (result.size() <= stopat && scanner.next(game)) {
+        result.emplace_back(game.data(), game.size());
     }
 
     // No game found? Assume closing tag was missing (OGS)
     if (result.size() == 0) {
-        result.push_back(gamebuff);
+        auto remainder = scanner.remainder();
+        result.emplace_back(remainder.data(), remainder.size());
     }
 
     return result;
 }
 
+std::vector<std::string> SGFParser::chop_stream(std::istream& ins,
+                                                size_t stopat) {
+    std::string buffer((std::istreambuf_iterator<char>(ins)),
+                       std::istreambuf_iterator<char>());
+    return chop_buffer(buffer.data(), buffer.size(), stopat);
+}
+
 std::vector<std::string> SGFParser::chop_all(std::string filename,
                                              size_t stopat) {
-    std::ifstream ins(filename.c_str(), std::ifstream::binary | std::ifstream::in);
+    SGFCollection collection(filename);
+    return chop_buffer(collection.data(), collection.size(), stopat);
+}
 
-    if (ins.fail()) {
-        throw std::runtime_error("Error opening file");
+// extract the game with number index from the file
+std::string SGFParser::chop_from_file(std::string filename, size_t index) {
+    // Later games are looked up in the index, which is built
+    // the first time
+    if (index > 0) {
+        return SGFIndex(filename).get_game(index);
     }
 
-    auto result = chop_stream(ins, stopat);
-    ins.close();
+    // The first one doesn't need the rest of the file
+    SGFCollection collection(filename);
+    SGFScanner scanner = collection.scanner();
+    boost::string_view game;
 
-    return result;
-}
+    if (!scanner.next(game)) {
+        // Same as chop_all, a game without its closing tag
+        game = scanner.remainder();
+    }
 
-// scan the file and extract the game with number index
-std::string SGFParser::chop_from_file(std::string filename, size_t index) {
-    auto vec = chop_all(filename, index);
-    return vec[index];
+    return std::string(game.data(), game.size());
 }
 
 std::string SGFParser::parse_property_name(std::istringstream & strm) {
@@ -207,46 +186,5 @@ void SGFParser::parse(std::istringstream & strm, SGFTree * node) {
 }
 
 int SGFParser::count_games_in_file(std::string filename) {
-    std::ifstream ins(filename.c_str(), std::ifstream::binary | std::ifstream::in);
-
-    if (ins.fail()) {
-        throw std::runtime_error("Error opening file");
-    }
-
-    int count = 0;
-    int nesting = 0;
-
-    char c;
-    while (ins >> c) {
-        if (!isascii(c)) {
-            do {
-                ins >> c;
-            } while (!isascii(c));
-            continue;
-        }
-
-        if (c == '\\') {
-            // read literal char
-            ins >> c;
-            // Skip special char parsing
-            continue;
-        }
-
-        if (c == '(') {
-            nesting++;
-        } else if (c == ')') {
-            nesting--;
-
-            assert(nesting >= 0);
-
-            if (nesting == 0) {
-                // one game processed
-                count++;
-            }
-        }
-    }
-
-    ins.close();
-
-    return count;
+    return SGFIndex(filename).size();
 }
@@ -17,6 +17,9 @@ public:
                                              size_t stopat = SIZE_MAX);
     static std::vector<std::string> chop_stream(std::istream& ins,
                                                 size_t stopat = SIZE_MAX);
+    static std::vector<std::string> chop_buffer(const char * data,
+                                                size_t size,
+                                                size_t stopat = SIZE_MAX);
     static void parse(std::istringstream & strm, SGFTree * node);
     static int count_games_in_file(std::string filename);
 };
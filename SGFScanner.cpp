@@ -0,0 +1,158 @@
+#include "config.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "SGFScanner.h"
+#include "Utils.h"
+
+namespace {
+    // Outside of property values only these change the state
+    struct SpecialChars {
+        std::array<bool, 256> m_special{};
+        SpecialChars() {
+            for (auto c : {'(', ')', '[', ']', '\\'}) {
+                m_special[(unsigned char)c] = true;
+            }
+        }
+    };
+    const SpecialChars s_special;
+}
+
+SGFScanner::SGFScanner(const char * data, size_t size)
+    : m_data(data), m_size(size) {
+}
+
+bool SGFScanner::next(boost::string_view & game) {
+    int nesting = 0;
+    bool intag = false;
+
+    while (m_pos < m_size) {
+        if (intag) {
+            // Only the closing bracket matters, unless it is escaped
+            // by an odd number of backslashes
+            auto found = static_cast<const char *>(
+                std::memchr(m_data + m_pos, ']', m_size - m_pos));
+            if (found == nullptr) {
+                m_pos = m_size;
+                break;
+            }
+            size_t end = found - m_data;
+            size_t escapes = 0;
+            while (m_data[end - escapes - 1] == '\\') {
+                escapes++;
+            }
+            m_pos = end + 1;
+            if (escapes % 2 == 0) {
+                intag = false;
+            }
+            continue;
+        }
+
+        while (m_pos < m_size
+               && !s_special.m_special[(unsigned char)m_data[m_pos]]) {
+            m_pos++;
+        }
+        if (m_pos == m_size) {
+            break;
+        }
+
+        char c = m_data[m_pos++];
+        if (c == '\\') {
+            // Skip the literal char
+            if (m_pos < m_size) {
+                m_pos++;
+            }
+        } else if (c == '(') {
+            if (nesting == 0) {
+                // Eat the ; too
+                while (m_pos < m_size) {
+                    c = m_data[m_pos++];
+                    if (!std::isspace((unsigned char)c) || c == ';') {
+                        break;
+                    }
+                }
+                m_start = m_pos;
+            }
+            nesting++;
+        } else if (c == ')') {
+            nesting--;
+            if (nesting == 0) {
+                game = boost::string_view(m_data + m_start, m_pos - m_start);
+                m_start = m_pos;
+                return true;
+            }
+        } else if (c == '[') {
+            intag = true;
+        } else {
+            // A closing bracket outside of a value
+            Utils::myprintf("Tag error on line %d\n", line());
+        }
+    }
+
+    return false;
+}
+
+int SGFScanner::line() {
+    m_line += std::count(m_data + m_line_pos, m_data + m_pos, '\n');
+    m_line_pos = m_pos;
+    return m_line;
+}
+
+boost::string_view SGFScanner::remainder() const {
+    return boost::string_view(m_data + m_start, m_size - m_start);
+}
+
+bool SGFScanner::has_unclosed_game() const {
+    auto text = remainder();
+    return !std::all_of(text.begin(), text.end(), [](char c) {
+        return std::isspace((unsigned char)c) != 0;
+    });
+}
+
+SGFCollection::SGFCollection(const std::string & filename) {
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0
+        || (info.st_mode & S_IFMT) == S_IFDIR) {
+        throw std::runtime_error("Error opening file");
+    }
+
+    if ((info.st_mode & S_IFMT) == S_IFREG) {
+        // Empty files can't be mapped but are fine
+        if (info.st_size == 0) {
+            return;
+        }
+        if (!m_file.open(filename)) {
+            throw std::runtime_error("Error opening file");
+        }
+        m_data = m_file.data();
+        m_size = m_file.size();
+        return;
+    }
+
+    // A pipe or device can't be mapped, and a pipe can only be
+    // opened once, so read it like a stream
+    std::ifstream ins(filename.c_str(), std::ifstream::binary);
+    if (ins.fail()) {
+        throw std::runtime_error("Error opening file");
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(ins),
+                    std::istreambuf_iterator<char>());
+    if (ins.bad()) {
+        throw std::runtime_error("Error reading file");
+    }
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+}
+
+SGFScanner SGFCollection::scanner() const {
+    return SGFScanner(m_data, m_size);
+}
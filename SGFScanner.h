@@ -0,0 +1,66 @@
+#ifndef SGFSCANNER_H_INCLUDED
+#define SGFSCANNER_H_INCLUDED
+
+#include "config.h"
+
+#include <cstddef>
+#include <string>
+#include <boost/utility/string_view.hpp>
+
+#include "MappedFile.h"
+
+/*
+    Splits a collection of SGF games into the text of each game, as
+    views into the buffer that is scanned, without copying. A game
+    starts after its opening "(;" and includes the closing parenthesis,
+    the same text SGFParser::chop_stream returns.
+*/
+class SGFScanner {
+public:
+    SGFScanner(const char * data, size_t size);
+
+    // The next complete game, false once there are no more
+    bool next(boost::string_view & game);
+    // Where the scan is, in bytes from the start of the buffer
+    size_t offset() const { return m_pos; }
+    // Text after the last complete game, once next returned false
+    boost::string_view remainder() const;
+    // The remainder is more than whitespace, so likely a game whose
+    // closing parenthesis is missing (OGS)
+    bool has_unclosed_game() const;
+
+private:
+    // Line of m_pos, for error messages. Counted up to m_line_pos.
+    int line();
+
+    const char * m_data;
+    size_t m_size;
+    size_t m_pos{0};
+    // Start of the game being scanned
+    size_t m_start{0};
+    size_t m_line_pos{0};
+    int m_line{1};
+};
+
+/*
+    A file of SGF games mapped into memory. Pipes and devices can't be
+    mapped, those are read into memory instead. The views a scanner
+    returns stay valid as long as the collection exists.
+*/
+class SGFCollection {
+public:
+    // Throws std::runtime_error if the file can't be read
+    explicit SGFCollection(const std::string & filename);
+
+    SGFScanner scanner() const;
+    const char * data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    MappedFile m_file;
+    std::string m_buffer;
+    const char * m_data{nullptr};
+    size_t m_size{0};
+};
+
+#endif
@@ -0,0 +1,186 @@
+#include "config.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "SGFStream.h"
+#include "Random.h"
+
+namespace {
+    bool is_directory(const std::string & path) {
+#ifdef WIN32
+        DWORD attributes = GetFileAttributesA(path.c_str());
+        return attributes != INVALID_FILE_ATTRIBUTES
+               && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+        struct stat info;
+        return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+#endif
+    }
+
+    // The .sgf files in a directory, in name order
+    std::vector<std::string> list_sgf_files(const std::string & dir) {
+        std::vector<std::string> names;
+#ifdef WIN32
+        WIN32_FIND_DATAA found;
+        HANDLE handle = FindFirstFileA((dir + "\\*.sgf").c_str(), &found);
+        if (handle != INVALID_HANDLE_VALUE) {
+            do {
+                if (!(found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+                    names.emplace_back(found.cFileName);
+                }
+            } while (FindNextFileA(handle, &found));
+            FindClose(handle);
+        }
+#else
+        DIR * handle = opendir(dir.c_str());
+        if (handle != nullptr) {
+            while (auto entry = readdir(handle)) {
+                std::string name = entry->d_name;
+                if (name.size() < 4) {
+                    continue;
+                }
+                std::string ext = name.substr(name.size() - 4);
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+                if (ext == ".sgf" && !is_directory(dir + "/" + name)) {
+                    names.push_back(name);
+                }
+            }
+            closedir(handle);
+        }
+#endif
+        std::sort(names.begin(), names.end());
+        for (auto & name : names) {
+            name = dir + "/" + name;
+        }
+        return names;
+    }
+}
+
+SGFStream::SGFStream(const std::string & path)
+    : m_files(list_files(path)) {
+    // Fail now if the first file can't be read
+    open_next_file();
+}
+
+std::vector<std::string> SGFStream::list_files(const std::string & path) {
+    if (!is_directory(path)) {
+        return {path};
+    }
+    auto files = list_sgf_files(path);
+    if (files.empty()) {
+        throw std::runtime_error("No SGF files in directory");
+    }
+    return files;
+}
+
+void SGFStream::set_sample_rate(float rate) {
+    m_sample_rate = rate;
+}
+
+void SGFStream::set_shuffle(size_t buffer_size) {
+    m_shuffle_size = buffer_size;
+    m_buffer.reserve(buffer_size);
+}
+
+void SGFStream::set_repeat(bool repeat) {
+    m_repeat = repeat;
+}
+
+size_t SGFStream::get_file_count() const {
+    return m_files.size();
+}
+
+size_t SGFStream::get_games_read() const {
+    return m_games_read;
+}
+
+bool SGFStream::next(std::string & game) {
+    if (m_shuffle_size == 0) {
+        return read(game);
+    }
+
+    while (m_buffer.size() < m_shuffle_size) {
+        std::string buffered;
+        if (!read(buffered)) {
+            break;
+        }
+        m_buffer.push_back(std::move(buffered));
+    }
+    if (m_buffer.empty()) {
+        return false;
+    }
+
+    auto pick = Random::get_Rng()->randuint32(m_buffer.size());
+    std::swap(m_buffer[pick], m_buffer.back());
+    game = std::move(m_buffer.back());
+    m_buffer.pop_back();
+    return true;
+}
+
+bool SGFStream::next_batch(std::vector<std::string> & games, size_t count) {
+    games.resize(count);
+    size_t found = 0;
+    while (found < count && next(games[found])) {
+        found++;
+    }
+    games.resize(found);
+    return found > 0;
+}
+
+bool SGFStream::read(std::string & game) {
+    for (;;) {
+        boost::string_view found;
+        if (m_collection && m_scanner.next(found)) {
+            m_file_games++;
+        } else if (m_collection && m_file_games == 0
+                   && m_scanner.has_unclosed_game()) {
+            // No game found? Assume closing tag was missing (OGS)
+            found = m_scanner.remainder();
+            m_file_games++;
+        } else if (open_next_file()) {
+            continue;
+        } else {
+            return false;
+        }
+
+        m_games_read++;
+        m_pass_games++;
+        if (m_sample_rate < 1.0f
+            && Random::get_Rng()->randflt() >= m_sample_rate) {
+            continue;
+        }
+        game.assign(found.data(), found.size());
+        return true;
+    }
+}
+
+bool SGFStream::open_next_file() {
+    m_scanner = SGFScanner(nullptr, 0);
+    m_collection.reset();
+
+    if (m_next_file == m_files.size()) {
+        // Give up on a pass that found nothing, or we'd spin forever
+        if (!m_repeat || m_pass_games == 0) {
+            return false;
+        }
+        m_next_file = 0;
+        m_pass_games = 0;
+    }
+
+    m_collection.reset(new SGFCollection(m_files[m_next_file++]));
+    m_scanner = m_collection->scanner();
+    m_file_games = 0;
+    return true;
+}
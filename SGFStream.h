@@ -0,0 +1,63 @@
+#ifndef SGFSTREAM_H_INCLUDED
+#define SGFSTREAM_H_INCLUDED
+
+#include "config.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SGFScanner.h"
+
+/*
+    The games of an SGF file, or of all .sgf files in a directory, read
+    one at a time. Only the file being read is mapped, so memory stays
+    bounded however large the collection is, and the first game is
+    there as soon as its file is opened.
+*/
+class SGFStream {
+public:
+    // Throws std::runtime_error if path can't be read
+    explicit SGFStream(const std::string & path);
+
+    // Only keep each game with this probability
+    void set_sample_rate(float rate);
+    // Return the games in random order, picked from a buffer of
+    // this many games that is refilled as they are taken out
+    void set_shuffle(size_t buffer_size);
+    // Start over after the last game, forever
+    void set_repeat(bool repeat);
+
+    // The next game, false once there are no more
+    bool next(std::string & game);
+    // Up to count next games, false if there were none
+    bool next_batch(std::vector<std::string> & games, size_t count);
+
+    size_t get_file_count() const;
+    // Games read from the files so far, before sampling
+    size_t get_games_read() const;
+
+    // path itself, or the .sgf files in it if it is a directory
+    static std::vector<std::string> list_files(const std::string & path);
+
+private:
+    bool read(std::string & game);
+    bool open_next_file();
+
+    std::vector<std::string> m_files;
+    size_t m_next_file{0};
+    std::unique_ptr<SGFCollection> m_collection;
+    SGFScanner m_scanner{nullptr, 0};
+    // Games found in the open file
+    size_t m_file_games{0};
+    // Games kept during the current pass over the files
+    size_t m_pass_games{0};
+    size_t m_games_read{0};
+
+    float m_sample_rate{1.0f};
+    size_t m_shuffle_size{0};
+    std::vector<std::string> m_buffer;
+    bool m_repeat{false};
+};
+
+#endif
@@ -17,15 +17,47 @@ using namespace Utils;
 
 void SGFTree::init_state(void) {
     m_initialized = true;
+    m_root = this;
     // Initialize with defaults.
     // The SGF might be missing boardsize or komi
     // which means we'll never initialize properly.
-    m_state.init_game(19, 7.5f);
+    m_checkpoint.reset(new KoState);
+    m_checkpoint->init_game(19, 7.5f);
+    m_cursor.reset(new StateCursor);
 }
 
 KoState * SGFTree::get_state(void) {
     assert(m_initialized);
-    return &m_state;
+    auto & cursor = *m_root->m_cursor;
+    if (cursor.m_node == this) {
+        return &cursor.m_copy;
+    }
+
+    // Go up to the last state or a checkpoint, whichever is nearer.
+    // The root always has a checkpoint.
+    std::vector<SGFTree *> path;
+    SGFTree * start = this;
+    while (start != cursor.m_node && !start->m_checkpoint) {
+        path.push_back(start);
+        start = start->m_parent;
+    }
+    if (start != cursor.m_node) {
+        cursor.m_state = *start->m_checkpoint;
+    }
+
+    // Not good to resume from if a move turns out to be illegal
+    cursor.m_node = nullptr;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        SGFTree * node = *it;
+        node->play_node(cursor.m_state);
+        if (node->m_depth % CHECKPOINT_INTERVAL == 0) {
+            node->m_checkpoint.reset(new KoState(cursor.m_state));
+        }
+    }
+    cursor.m_node = this;
+    cursor.m_copy = cursor.m_state;
+
+    return &cursor.m_copy;
 }
 
 SGFTree * SGFTree::get_child(unsigned int count) {
@@ -120,6 +152,11 @@ void SGFTree::populate_states(void) {
     PropertyMap::iterator it;
     bool valid_size = false;
     bool has_handicap = false;
+    KoState & state = *m_checkpoint;
+
+    for (auto& child : m_children) {
+        child.link_nodes(this);
+    }
 
     // first check for go game setup in properties
     it = m_properties.find("GM");
@@ -144,7 +181,7 @@ void SGFTree::populate_states(void) {
         strm >> bsize;
         if (bsize <= FastBoard::MAXBOARDSIZE) {
             // Assume 7.5 komi if not specified
-            m_state.init_game(bsize, 7.5f);
+            state.init_game(bsize, 7.5f);
             valid_size = true;
         } else {
             throw std::runtime_error("Board size not supported.");
@@ -158,14 +195,14 @@ void SGFTree::populate_states(void) {
         std::istringstream strm(foo);
         float komi;
         strm >> komi;
-        int handicap = m_state.get_handicap();
+        int handicap = state.get_handicap();
         // last ditch effort: if no GM or SZ, assume 19x19 Go here
         int bsize = 19;
         if (valid_size) {
-            bsize = m_state.board.get_boardsize();
+            bsize = state.board.get_boardsize();
         }
-        m_state.init_game(bsize, komi);
-        m_state.set_handicap(handicap);
+        state.init_game(bsize, komi);
+        state.set_handicap(handicap);
     }
 
     // handicap
@@ -176,7 +213,7 @@ void SGFTree::populate_states(void) {
         float handicap;
         strm >> handicap;
         has_handicap = (handicap > 0.0f);
-        m_state.set_handicap((int)handicap);
+        state.set_handicap((int)handicap);
     }
 
     // result
@@ -218,65 +255,71 @@ void SGFTree::populate_states(void) {
     }
 
     // handicap stones
-    auto prop_pair_ab = m_properties.equal_range("AB");
     // Do we have a handicap specified but no handicap stones placed in
     // the same node? Then the SGF file is corrupt. Let's see if we can find
     // them in the next node, which is a common bug in some Go apps.
-    if (has_handicap && prop_pair_ab.first == prop_pair_ab.second) {
-        if (!m_children.empty()) {
-            auto& successor = m_children[0];
-            prop_pair_ab = successor.m_properties.equal_range("AB");
-        }
+    if (has_handicap && !m_properties.count("AB") && !m_children.empty()) {
+        m_children[0].apply_stones(state, "AB", FastBoard::BLACK);
     }
-    // Loop through the stone list and apply
-    for (auto it = prop_pair_ab.first; it != prop_pair_ab.second; ++it) {
-        auto move = it->second;
-        int vtx = string_to_vertex(move);
-        apply_move(FastBoard::BLACK, vtx);
+    apply_setup(state);
+
+    // Replay the main line now, so illegal moves are found while
+    // loading, and leave checkpoints along it
+    SGFTree * link = this;
+    while (!link->m_children.empty()) {
+        link = &link->m_children[0];
     }
+    link->get_state();
+}
 
-    // XXX: count handicap stones
-    const auto& prop_pair_aw = m_properties.equal_range("AW");
-    for (auto it = prop_pair_aw.first; it != prop_pair_aw.second; ++it) {
-        auto move = it->second;
-        int vtx = string_to_vertex(move);
-        apply_move(FastBoard::WHITE, vtx);
+void SGFTree::link_nodes(SGFTree * parent) {
+    m_initialized = true;
+    m_root = parent->m_root;
+    m_parent = parent;
+    m_depth = parent->m_depth + 1;
+
+    for (auto& child : m_children) {
+        child.link_nodes(this);
     }
+}
 
-    it = m_properties.find("PL");
+// Plays the move of this node on the state of its parent
+void SGFTree::play_node(KoState & state) {
+    int move = get_move(state.get_to_move());
+    if (move != EOT) {
+        apply_move(state, state.get_to_move(), move);
+    }
+    apply_setup(state);
+}
+
+void SGFTree::apply_setup(KoState & state) {
+    apply_stones(state, "AB", FastBoard::BLACK);
+    // XXX: count handicap stones
+    apply_stones(state, "AW", FastBoard::WHITE);
+
+    auto it = m_properties.find("PL");
     if (it != m_properties.end()) {
         std::string who = it->second;
         if (who == "W") {
-            m_state.set_to_move(FastBoard::WHITE);
+            state.set_to_move(FastBoard::WHITE);
         } else if (who == "B") {
-            m_state.set_to_move(FastBoard::BLACK);
+            state.set_to_move(FastBoard::BLACK);
         }
     }
-
-    // now for all children play out the moves
-    for (auto& child_state : m_children) {
-        // propagate state
-        child_state.copy_state(*this);
-
-        // XXX: maybe move this to the recursive call
-        // get move for side to move
-        int move = child_state.get_move(m_state.get_to_move());
-        if (move != EOT) {
-            child_state.apply_move(move);
-        }
-
-        child_state.populate_states();
-    }
 }
 
-void SGFTree::copy_state(const SGFTree& tree) {
-    m_initialized = tree.m_initialized;
-    m_state = tree.m_state;
+void SGFTree::apply_stones(KoState & state, const char * property, int color) {
+    auto prop_pair = m_properties.equal_range(property);
+    // Loop through the stone list and apply
+    for (auto it = prop_pair.first; it != prop_pair.second; ++it) {
+        int vtx = string_to_vertex(it->second);
+        apply_move(state, color, vtx);
+    }
 }
 
-void SGFTree::apply_move(int color, int move) {
+void SGFTree::apply_move(KoState & state, int color, int move) {
     if (move != FastBoard::PASS && move != FastBoard::RESIGN) {
-        int curr_sq = m_state.board.get_square(move);
+        int curr_sq = state.board.get_square(move);
         if (curr_sq == !color || curr_sq == FastBoard::INVAL) {
             throw std::runtime_error("Illegal move");
         }
@@ -287,12 +330,7 @@ void SGFTree::apply_move(int color, int move) {
         }
         assert(curr_sq == FastBoard::EMPTY);
     }
-    m_state.play_move(color, move);
-}
-
-void SGFTree::apply_move(int move) {
-    int color = m_state.get_to_move();
-    apply_move(color, move);
+    state.play_move(color, move);
 }
 
 void SGFTree::add_property(std::string property, std::string value) {
@@ -313,14 +351,15 @@ int SGFTree::string_to_vertex(const std::string& movestring) const {
         return FastBoard::PASS;
     }
 
-    if (m_state.board.get_boardsize() <= 19) {
+    const auto& board = m_root->m_checkpoint->board;
+    int bsize = board.get_boardsize();
+
+    if (bsize <= 19) {
         if (movestring == "tt") {
             return FastBoard::PASS;
         }
     }
 
-    int bsize = m_state.board.get_boardsize();
-
     char c1 = movestring[0];
     char c2 = movestring[1];
 
@@ -344,7 +383,7 @@ int SGFTree::string_to_vertex(const std::string& movestring) const {
         throw std::runtime_error("Illegal SGF move");
     }
 
-    int vtx = m_state.board.get_vertex(cc1, cc2);
+    int vtx = board.get_vertex(cc1, cc2);
 
     return vtx;
 }
@@ -377,7 +416,7 @@ std::vector<int> SGFTree::get_mainline() {
     std::vector<int> moves;
 
     SGFTree * link = this;
-    int tomove = link->m_state.get_to_move();
+    int tomove = link->get_state()->get_to_move();
     link = link->get_child(0);
 
     while (link != NULL) {
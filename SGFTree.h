@@ -3,18 +3,29 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
 #include <sstream>
 #include "KoState.h"
 #include "GameState.h"
 
+/*
+    A game tree keeps only the moves and properties of its nodes. The
+    state of a node is replayed when asked for, from the nearest of the
+    checkpoints kept every CHECKPOINT_INTERVAL moves, or from the state
+    asked for before if that was an ancestor, so walking down a line is
+    one move per node.
+*/
 class SGFTree {
 public:
     static const int EOT = 0;               // End-Of-Tree marker
+    static constexpr int CHECKPOINT_INTERVAL = 16;
 
     SGFTree() = default;
     void init_state();
 
+    // The state is shared by all nodes of the tree: it stays valid
+    // until the state of another node is asked for
     KoState * get_state();
     KoState * get_state_from_mainline(unsigned int movenum = 999);
     GameState follow_mainline_state(unsigned int movenum = 999);
@@ -33,19 +44,37 @@ public:
     static std::string state_to_string(GameState * state, int compcolor);
 
 private:
+    // The node whose state was asked for last
+    struct StateCursor {
+        const SGFTree * m_node{nullptr};
+        KoState m_state;
+        // What get_state hands out, callers may change it
+        KoState m_copy;
+    };
+
     void populate_states(void);
-    void apply_move(int color, int move);
-    void apply_move(int move);
-    void copy_state(const SGFTree& state);
+    void link_nodes(SGFTree * parent);
+    void play_node(KoState & state);
+    void apply_setup(KoState & state);
+    void apply_stones(KoState & state, const char * property, int color);
+    void apply_move(KoState & state, int color, int move);
     int string_to_vertex(const std::string& move) const;
 
     using PropertyMap = std::multimap<std::string, std::string>;
 
     bool m_initialized{false};
-    KoState m_state;
     FastBoard::square_t m_winner{FastBoard::INVAL};
     std::vector<SGFTree> m_children;
     PropertyMap m_properties;
+
+    SGFTree * m_root{this};
+    SGFTree * m_parent{nullptr};
+    int m_depth{0};
+    // Always set for the root, and every CHECKPOINT_INTERVAL moves
+    // once a line was replayed
+    std::unique_ptr<KoState> m_checkpoint;
+    // Only the root has one
+    std::unique_ptr<StateCursor> m_cursor;
 };
 
 #endif
@@ -1,7 +1,43 @@
 #include "config.h"
 #include "SMP.h"
+#include "SearchTrace.h"
 
 #include <thread>
+#include <vector>
+#ifdef __linux__
+#include <cstdio>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#define SMP_HAVE_PAUSE
+#endif
+#ifdef SMP_LOCK_STATS
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Utils.h"
+#endif
+
+namespace {
+    /*
+        Spin this many pause rounds at most before giving the
+        core away, waiters shouldn't starve a hyperthread sibling
+        or the lock holder on an oversubscribed machine.
+    */
+    constexpr int MAX_BACKOFF = 64;
+
+    inline void cpu_relax() {
+#ifdef SMP_HAVE_PAUSE
+        _mm_pause();
+#endif
+    }
+}
 
 SMP::Mutex::Mutex() {
     m_lock = false;
@@ -11,13 +47,59 @@ bool SMP::Mutex::is_held() {
     return m_lock.load(std::memory_order_acquire);
 }
 
+#ifdef SMP_LOCK_STATS
+SMP::Lock::Lock(Mutex & m, LockSite * site) {
+    m_mutex = &m;
+    m_site = site;
+    lock();
+}
+#else
 SMP::Lock::Lock(Mutex & m) {
     m_mutex = &m;
     lock();
 }
+#endif
 
 void SMP::Lock::lock() {
-    while (m_mutex->m_lock.exchange(true, std::memory_order_acquire) == true);
+    // Uncontended case is a single exchange
+    if (!m_mutex->m_lock.exchange(true, std::memory_order_acquire)) {
+#ifdef SMP_LOCK_STATS
+        m_site->record(0, 0);
+#endif
+        return;
+    }
+
+#ifdef SMP_LOCK_STATS
+    auto start = std::chrono::steady_clock::now();
+#endif
+    const bool tracing = SearchTrace::enabled();
+    const uint64 trace_start = tracing ? SearchTrace::now() : 0;
+    int spins = 0;
+    int backoff = 1;
+    do {
+        // Spin on a plain load so the cache line stays shared
+        while (m_mutex->m_lock.load(std::memory_order_relaxed)) {
+            if (backoff <= MAX_BACKOFF) {
+                for (int i = 0; i < backoff; i++) {
+                    cpu_relax();
+                }
+                backoff *= 2;
+            } else {
+                std::this_thread::yield();
+            }
+            spins++;
+        }
+    } while (m_mutex->m_lock.exchange(true, std::memory_order_acquire));
+
+    if (tracing) {
+        SearchTrace::complete("lock_wait", trace_start);
+    }
+
+#ifdef SMP_LOCK_STATS
+    auto wait = std::chrono::steady_clock::now() - start;
+    m_site->record(std::max(spins, 1),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count());
+#endif
 }
 
 void SMP::Lock::unlock() {
@@ -31,3 +113,218 @@ SMP::Lock::~Lock() {
 int SMP::get_num_cpus() {
     return std::thread::hardware_concurrency();
 }
+
+namespace {
+    thread_local int t_node = 0;
+
+#ifdef __linux__
+    // From <numaif.h>, which needs libnuma
+    constexpr int MPOL_PREFERRED_MODE = 1;
+    constexpr int MPOL_INTERLEAVE_MODE = 3;
+    constexpr unsigned MPOL_MF_MOVE_FLAG = 1 << 1;
+
+    struct Topology {
+        // system node number and the cores we may run on, per node
+        std::vector<int> m_ids;
+        std::vector<std::vector<int>> m_cpus;
+    };
+
+    // "0-3,8-11" to 0 1 2 3 8 9 10 11
+    std::vector<int> parse_cpulist(FILE * in) {
+        std::vector<int> cpus;
+        int first, last;
+        while (fscanf(in, "%d", &first) == 1) {
+            last = first;
+            int c = fgetc(in);
+            if (c == '-') {
+                if (fscanf(in, "%d", &last) != 1) {
+                    break;
+                }
+                c = fgetc(in);
+            }
+            for (int cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+            if (c != ',') {
+                break;
+            }
+        }
+        return cpus;
+    }
+
+    Topology read_topology() {
+        Topology topology;
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        sched_getaffinity(0, sizeof(allowed), &allowed);
+
+        for (int node = 0; node < 1024; node++) {
+            char path[64];
+            snprintf(path, sizeof(path),
+                     "/sys/devices/system/node/node%d/cpulist", node);
+            FILE * in = fopen(path, "r");
+            if (in == nullptr) {
+                continue;
+            }
+            std::vector<int> cpus;
+            for (auto cpu : parse_cpulist(in)) {
+                if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+                    cpus.push_back(cpu);
+                }
+            }
+            fclose(in);
+            if (!cpus.empty()) {
+                topology.m_ids.push_back(node);
+                topology.m_cpus.push_back(cpus);
+            }
+        }
+
+        if (topology.m_ids.empty()) {
+            std::vector<int> cpus;
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, &allowed)) {
+                    cpus.push_back(cpu);
+                }
+            }
+            topology.m_ids.push_back(0);
+            topology.m_cpus.push_back(cpus);
+        }
+        return topology;
+    }
+
+    const Topology & get_topology() {
+        static const Topology s_topology = read_topology();
+        return s_topology;
+    }
+
+    void set_policy(void * addr, size_t size, int mode,
+                    const std::vector<int> & nodes, unsigned flags) {
+        const size_t page = sysconf(_SC_PAGESIZE);
+        size_t start = ((size_t)addr + page - 1) & ~(page - 1);
+        size_t end = ((size_t)addr + size) & ~(page - 1);
+        if (end <= start) {
+            return;
+        }
+        const size_t bits = 8 * sizeof(unsigned long);
+        std::vector<unsigned long> mask(1);
+        for (auto node : nodes) {
+            if ((size_t)node / bits >= mask.size()) {
+                mask.resize(node / bits + 1);
+            }
+            mask[node / bits] |= 1UL << (node % bits);
+        }
+        // Only fails when the kernel has no NUMA support, nothing to do then
+        syscall(SYS_mbind, start, end - start, mode,
+                mask.data(), mask.size() * bits + 1, flags);
+    }
+#endif
+}
+
+int SMP::get_numa_nodes() {
+#ifdef __linux__
+    return get_topology().m_ids.size();
+#else
+    return 1;
+#endif
+}
+
+void SMP::pin_thread(int index) {
+#ifdef __linux__
+    const Topology & topology = get_topology();
+    int nodes = topology.m_ids.size();
+    int node = index % nodes;
+    const std::vector<int> & cpus = topology.m_cpus[node];
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpus[(index / nodes) % cpus.size()], &set);
+    if (sched_setaffinity(0, sizeof(set), &set) == 0) {
+        t_node = node;
+    }
+#endif
+}
+
+int SMP::get_thread_node() {
+    return t_node;
+}
+
+void SMP::interleave_memory(void * addr, size_t size) {
+#ifdef __linux__
+    const Topology & topology = get_topology();
+    if (topology.m_ids.size() > 1) {
+        set_policy(addr, size, MPOL_INTERLEAVE_MODE,
+                   topology.m_ids, MPOL_MF_MOVE_FLAG);
+    }
+#endif
+}
+
+void SMP::bind_memory(void * addr, size_t size, int node) {
+#ifdef __linux__
+    const Topology & topology = get_topology();
+    if (topology.m_ids.size() > 1) {
+        set_policy(addr, size, MPOL_PREFERRED_MODE,
+                   {topology.m_ids[node % topology.m_ids.size()]}, 0);
+    }
+#endif
+}
+
+#ifdef SMP_LOCK_STATS
+namespace {
+    std::mutex s_sites_mutex;
+
+    std::vector<SMP::LockSite*> & get_sites() {
+        static std::vector<SMP::LockSite*> s_sites;
+        return s_sites;
+    }
+}
+
+SMP::LockSite::LockSite(const char * file, int line)
+    : m_file(file), m_line(line) {
+    std::lock_guard<std::mutex> lock(s_sites_mutex);
+    get_sites().push_back(this);
+}
+
+void SMP::LockSite::record(int spins, uint64 wait_ns) {
+    m_acquires.fetch_add(1, std::memory_order_relaxed);
+    if (!spins) {
+        return;
+    }
+    m_contended.fetch_add(1, std::memory_order_relaxed);
+    m_spins.fetch_add(spins, std::memory_order_relaxed);
+    uint64 max_wait = m_max_wait_ns.load(std::memory_order_relaxed);
+    while (wait_ns > max_wait
+           && !m_max_wait_ns.compare_exchange_weak(max_wait, wait_ns));
+}
+
+void SMP::dump_lock_stats() {
+    std::lock_guard<std::mutex> lock(s_sites_mutex);
+    Utils::myprintf("%-24s %12s %10s %12s %10s\n",
+                    "Lock site", "acquires", "contended", "spins", "max wait");
+    for (auto site : get_sites()) {
+        if (!site->m_acquires) {
+            continue;
+        }
+        std::string where = site->m_file;
+        where = where.substr(where.find_last_of("/\\") + 1)
+                + ":" + std::to_string(site->m_line);
+        Utils::myprintf("%-24s %12llu %9.2f%% %12llu %8.1fus\n",
+                        where.c_str(),
+                        (unsigned long long)site->m_acquires,
+                        100.0 * site->m_contended / site->m_acquires,
+                        (unsigned long long)site->m_spins,
+                        site->m_max_wait_ns / 1000.0);
+    }
+}
+
+void SMP::reset_lock_stats() {
+    std::lock_guard<std::mutex> lock(s_sites_mutex);
+    for (auto site : get_sites()) {
+        site->m_acquires = 0;
+        site->m_contended = 0;
+        site->m_spins = 0;
+        site->m_max_wait_ns = 0;
+    }
+}
+#endif
@@ -3,10 +3,27 @@
 
 #include "config.h"
 #include <atomic>
+#include <cstddef>
 
 namespace SMP {
     int get_num_cpus();
 
+    /*
+        NUMA placement. Only Linux is supported, elsewhere there is
+        a single node and pinning or binding does nothing. Nodes are
+        numbered from 0 in the order the system lists them.
+    */
+    int get_numa_nodes();
+    // Pin the calling thread to a core, consecutive indices go
+    // to different nodes
+    void pin_thread(int index);
+    // Node the calling thread was pinned to, 0 if it wasn't
+    int get_thread_node();
+    // Spread the pages of a block round robin over all nodes
+    void interleave_memory(void * addr, size_t size);
+    // Put the pages of a block that wasn't touched yet on node
+    void bind_memory(void * addr, size_t size, int node);
+
     class Mutex {
     public:
         Mutex();
@@ -17,18 +34,52 @@ namespace SMP {
         std::atomic<bool> m_lock;
     };
 
+#ifdef SMP_LOCK_STATS
+    /*
+        Contention counters for one place in the source that takes a lock.
+    */
+    class LockSite {
+    public:
+        LockSite(const char * file, int line);
+        void record(int spins, uint64 wait_ns);
+
+        const char * m_file;
+        int m_line;
+        std::atomic<uint64> m_acquires{0};
+        std::atomic<uint64> m_contended{0};
+        std::atomic<uint64> m_spins{0};
+        std::atomic<uint64> m_max_wait_ns{0};
+    };
+
+    void dump_lock_stats();
+    void reset_lock_stats();
+#endif
+
     class Lock {
     public:
+#ifdef SMP_LOCK_STATS
+        Lock(Mutex & m, LockSite * site);
+#else
         explicit Lock(Mutex & m);
+#endif
         ~Lock();
         void lock();
         void unlock();
     private:
         Mutex * m_mutex;
+#ifdef SMP_LOCK_STATS
+        LockSite * m_site;
+#endif
     };
 }
 
 // Avoids accidentally creating a temporary
+#ifdef SMP_LOCK_STATS
+#define LOCK(mutex, lock) \
+    static SMP::LockSite lock##_site(__FILE__, __LINE__); \
+    SMP::Lock lock((mutex), &lock##_site)
+#else
 #define LOCK(mutex, lock) SMP::Lock lock((mutex))
+#endif
 
 #endif
@@ -0,0 +1,152 @@
+#include "config.h"
+
+#ifdef SEARCH_PROFILE
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "SearchProfiler.h"
+
+constexpr int SearchProfiler::NUM_BINS;
+
+namespace {
+    const char * s_phase_names[SearchProfiler::NUM_PHASES] = {
+        "tt_sync", "select", "expand", "netscore", "value_net",
+        "playout", "backup", "rave", "tt_update"
+    };
+
+    std::mutex s_mutex;
+    // Counters of every thread so far, those of exited threads are
+    // kept for the profile they count in and handed to new threads
+    std::vector<SearchProfiler::Stats*> s_threads;
+    std::vector<SearchProfiler::Stats*> s_free_stats;
+    SearchProfiler::Stats s_last;
+    bool s_have_last = false;
+
+    int bin_of(uint64 ns) {
+        if (ns < 4) {
+            return (int)ns;
+        }
+        int exp = 2;
+        while ((ns >> (exp + 1)) != 0 && exp < 48) {
+            exp++;
+        }
+        int mantissa = (int)((ns >> (exp - 2)) & 3);
+        return 4 * (exp - 1) + mantissa;
+    }
+
+    struct StatsSlot {
+        SearchProfiler::Stats * m_stats{nullptr};
+        ~StatsSlot() {
+            if (m_stats != nullptr) {
+                std::lock_guard<std::mutex> lock(s_mutex);
+                s_free_stats.push_back(m_stats);
+            }
+        }
+    };
+
+    // Largest duration that falls into a bin
+    uint64 bin_limit(int bin) {
+        if (bin < 4) {
+            return bin;
+        }
+        int exp = bin / 4 + 1;
+        uint64 mantissa = bin % 4 + 4;
+        return ((mantissa + 1) << (exp - 2)) - 1;
+    }
+}
+
+SearchProfiler::Stats & SearchProfiler::thread_stats() {
+    thread_local StatsSlot slot;
+    if (slot.m_stats == nullptr) {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_free_stats.empty()) {
+            // Adds to the counts of the thread before us
+            slot.m_stats = s_free_stats.back();
+            s_free_stats.pop_back();
+        } else {
+            slot.m_stats = new Stats();
+            s_threads.push_back(slot.m_stats);
+        }
+    }
+    return *slot.m_stats;
+}
+
+void SearchProfiler::record(Phase phase, uint64 ns) {
+    PhaseStats & stats = thread_stats()[phase];
+    stats.m_count++;
+    stats.m_total_ns += ns;
+    stats.m_bins[std::min(bin_of(ns), NUM_BINS - 1)]++;
+}
+
+void SearchProfiler::reset() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (auto stats : s_threads) {
+        *stats = Stats();
+    }
+}
+
+void SearchProfiler::collect() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_last = Stats();
+    for (auto stats : s_threads) {
+        for (int i = 0; i < NUM_PHASES; i++) {
+            const PhaseStats & from = (*stats)[i];
+            PhaseStats & to = s_last[i];
+            to.m_count += from.m_count;
+            to.m_total_ns += from.m_total_ns;
+            for (int bin = 0; bin < NUM_BINS; bin++) {
+                to.m_bins[bin] += from.m_bins[bin];
+            }
+        }
+    }
+    s_have_last = true;
+}
+
+std::string SearchProfiler::report() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_have_last) {
+        return "no search profiled yet";
+    }
+
+    uint64 total_ns = 0;
+    for (int i = 0; i < NUM_PHASES; i++) {
+        total_ns += s_last[i].m_total_ns;
+    }
+
+    char line[128];
+    std::snprintf(line, sizeof(line), "%-10s %10s %10s %10s %9s %6s",
+                  "phase", "count", "mean us", "p99 us", "total s", "share");
+    std::string result(line);
+
+    for (int i = 0; i < NUM_PHASES; i++) {
+        const PhaseStats & stats = s_last[i];
+        if (!stats.m_count) {
+            continue;
+        }
+        // First bin that reaches 99% of the samples
+        uint64 seen = 0;
+        uint64 needed = (stats.m_count * 99 + 99) / 100;
+        int bin = 0;
+        for (; bin < NUM_BINS - 1; bin++) {
+            seen += stats.m_bins[bin];
+            if (seen >= needed) {
+                break;
+            }
+        }
+        std::snprintf(line, sizeof(line),
+                      "\n%-10s %10llu %10.2f %10.2f %9.3f %5.1f%%",
+                      s_phase_names[i],
+                      (unsigned long long)stats.m_count,
+                      stats.m_total_ns / 1000.0 / stats.m_count,
+                      bin_limit(bin) / 1000.0,
+                      stats.m_total_ns / 1e9,
+                      total_ns ? 100.0 * stats.m_total_ns / total_ns : 0.0);
+        result += line;
+    }
+
+    return result;
+}
+#endif
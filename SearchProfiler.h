@@ -0,0 +1,72 @@
+#ifndef SEARCHPROFILER_H_INCLUDED
+#define SEARCHPROFILER_H_INCLUDED
+
+#include "config.h"
+
+#ifdef SEARCH_PROFILE
+#include <array>
+#include <chrono>
+#include <string>
+
+/*
+    Wall time spent in each phase of a simulation. Every searching
+    thread counts into its own buffers, they are summed up when
+    a search ends.
+*/
+class SearchProfiler {
+public:
+    enum Phase {
+        TT_SYNC, SELECT, EXPAND, NETSCORE, VALUE_NET,
+        PLAYOUT, BACKUP, RAVE, TT_UPDATE, NUM_PHASES
+    };
+
+    // Durations are binned with 4 bins per power of two
+    static constexpr int NUM_BINS = 4 * 48;
+
+    struct PhaseStats {
+        uint64 m_count;
+        uint64 m_total_ns;
+        std::array<uint32, NUM_BINS> m_bins;
+    };
+    using Stats = std::array<PhaseStats, NUM_PHASES>;
+
+    static void record(Phase phase, uint64 ns);
+    // Clear the counters of all threads, before a search starts
+    static void reset();
+    // Sum them up, after all threads stopped searching
+    static void collect();
+    // Table of the last collected search
+    static std::string report();
+
+    class Scope {
+    public:
+        explicit Scope(Phase phase)
+            : m_phase(phase), m_start(std::chrono::steady_clock::now()) {}
+        ~Scope() {
+            auto end = std::chrono::steady_clock::now();
+            record(m_phase,
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       end - m_start).count());
+        }
+    private:
+        Phase m_phase;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+private:
+    static Stats & thread_stats();
+};
+
+#define PROFILE_CAT2(a, b) a##b
+#define PROFILE_CAT(a, b) PROFILE_CAT2(a, b)
+#define PROFILE_SCOPE(phase) \
+    SearchProfiler::Scope PROFILE_CAT(profile_scope_, __LINE__)(SearchProfiler::phase)
+#define PROFILE_RESET() SearchProfiler::reset()
+#define PROFILE_COLLECT() SearchProfiler::collect()
+#else
+#define PROFILE_SCOPE(phase)
+#define PROFILE_RESET()
+#define PROFILE_COLLECT()
+#endif
+
+#endif
@@ -0,0 +1,188 @@
+#include "config.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "SearchTrace.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+std::atomic<bool> SearchTrace::s_enabled{false};
+
+namespace {
+    // Events kept per thread, about 2.5M of memory each
+    constexpr size_t RING_SIZE = 1 << 16;
+
+    struct Event {
+        const char * m_name;
+        uint64 m_start;
+        uint64 m_dur;
+        uint64 m_id;
+        char m_phase;
+    };
+
+    /*
+        Written only by its own thread. The dump reads it once all
+        threads stopped searching.
+    */
+    struct Ring {
+        int m_tid;
+        std::unique_ptr<Event[]> m_events{new Event[RING_SIZE]};
+        std::atomic<uint64> m_count{0};
+    };
+
+    std::mutex s_mutex;
+    /*
+        One ring per thread slot. A thread that exits (OpenCL callback
+        threads come and go) leaves its ring for the next new thread,
+        so there are never more rings than threads alive at once.
+    */
+    std::vector<Ring*> s_rings;
+    std::vector<Ring*> s_free_rings;
+    std::string s_filename;
+    bool s_armed = false;
+    std::chrono::steady_clock::time_point s_epoch;
+
+    struct RingSlot {
+        Ring * m_ring{nullptr};
+        ~RingSlot() {
+            if (m_ring != nullptr) {
+                std::lock_guard<std::mutex> lock(s_mutex);
+                s_free_rings.push_back(m_ring);
+            }
+        }
+    };
+
+    Ring & thread_ring() {
+        thread_local RingSlot slot;
+        if (slot.m_ring == nullptr) {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (!s_free_rings.empty()) {
+                // Keeps the events of the thread before us
+                slot.m_ring = s_free_rings.back();
+                s_free_rings.pop_back();
+            } else {
+                slot.m_ring = new Ring();
+                slot.m_ring->m_tid = s_rings.size() + 1;
+                s_rings.push_back(slot.m_ring);
+            }
+        }
+        return *slot.m_ring;
+    }
+
+    void push(const char * name, char phase,
+              uint64 start, uint64 dur, uint64 id) {
+        Ring & ring = thread_ring();
+        uint64 count = ring.m_count.load(std::memory_order_relaxed);
+        Event & event = ring.m_events[count % RING_SIZE];
+        event.m_name = name;
+        event.m_phase = phase;
+        event.m_start = start;
+        event.m_dur = dur;
+        event.m_id = id;
+        ring.m_count.store(count + 1, std::memory_order_release);
+    }
+}
+
+uint64 SearchTrace::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+void SearchTrace::arm(const std::string & filename) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_filename = filename;
+    s_armed = true;
+}
+
+void SearchTrace::start_search() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_armed) {
+        return;
+    }
+    for (auto ring : s_rings) {
+        ring->m_count = 0;
+    }
+    s_epoch = std::chrono::steady_clock::now();
+    s_enabled = true;
+}
+
+void SearchTrace::finish_search() {
+    if (!enabled()) {
+        return;
+    }
+    s_enabled = false;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_armed = false;
+
+    FILE * out = fopen(s_filename.c_str(), "w");
+    if (out == nullptr) {
+        myprintf("Could not write search trace to %s\n", s_filename.c_str());
+        return;
+    }
+
+    size_t written = 0;
+    fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\","
+                 "\"args\":{\"name\":\"" PROGRAM_NAME "\"}}");
+    for (auto ring : s_rings) {
+        uint64 count = ring->m_count.load(std::memory_order_acquire);
+        if (!count) {
+            continue;
+        }
+        fprintf(out, ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                     "\"name\":\"thread_name\","
+                     "\"args\":{\"name\":\"thread %d\"}}",
+                ring->m_tid, ring->m_tid);
+        uint64 first = count > RING_SIZE ? count - RING_SIZE : 0;
+        for (uint64 i = first; i < count; i++) {
+            const Event & event = ring->m_events[i % RING_SIZE];
+            fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,"
+                         "\"tid\":%d,\"ts\":%.3f",
+                    event.m_name, event.m_phase, ring->m_tid,
+                    event.m_start / 1000.0);
+            if (event.m_phase == 'X') {
+                fprintf(out, ",\"dur\":%.3f", event.m_dur / 1000.0);
+            } else if (event.m_phase == 'b' || event.m_phase == 'e') {
+                fprintf(out, ",\"cat\":\"nn\",\"id\":\"0x%llx\"",
+                        (unsigned long long)event.m_id);
+            } else if (event.m_phase == 'i') {
+                fprintf(out, ",\"s\":\"t\"");
+            }
+            fprintf(out, "}");
+            written++;
+        }
+    }
+    fprintf(out, "\n]}\n");
+    fclose(out);
+
+    myprintf("Wrote %d trace events to %s\n", (int)written, s_filename.c_str());
+}
+
+void SearchTrace::complete(const char * name, uint64 start) {
+    push(name, 'X', start, now() - start, 0);
+}
+
+void SearchTrace::async_begin(const char * name, uint64 id) {
+    if (enabled()) {
+        push(name, 'b', now(), 0, id);
+    }
+}
+
+void SearchTrace::async_end(const char * name, uint64 id) {
+    if (enabled()) {
+        push(name, 'e', now(), 0, id);
+    }
+}
+
+void SearchTrace::instant(const char * name) {
+    if (enabled()) {
+        push(name, 'i', now(), 0, 0);
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef SEARCHTRACE_H_INCLUDED
+#define SEARCHTRACE_H_INCLUDED
+
+#include "config.h"
+
+#include <atomic>
+#include <string>
+
+/*
+    Timeline of what the search threads do during one genmove, written
+    as a Chrome trace (chrome://tracing or ui.perfetto.dev). Each thread
+    records into its own ring buffer, the oldest events are overwritten
+    when it fills up. Recording costs a flag check while not armed.
+*/
+class SearchTrace {
+public:
+    // Record the next search and write it to filename
+    static void arm(const std::string & filename);
+    static void start_search();
+    static void finish_search();
+
+    static bool enabled() {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+    static uint64 now();
+    // An event from start until now
+    static void complete(const char * name, uint64 start);
+    // Events that begin on one thread and end on another
+    static void async_begin(const char * name, uint64 id);
+    static void async_end(const char * name, uint64 id);
+    static void instant(const char * name);
+
+    class Scope {
+    public:
+        explicit Scope(const char * name)
+            : m_name(name), m_active(enabled()),
+              m_start(m_active ? now() : 0) {}
+        ~Scope() {
+            if (m_active) {
+                complete(m_name, m_start);
+            }
+        }
+    private:
+        const char * m_name;
+        bool m_active;
+        uint64 m_start;
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+#define TRACE_CAT2(a, b) a##b
+#define TRACE_CAT(a, b) TRACE_CAT2(a, b)
+#define TRACE_SCOPE(name) \
+    SearchTrace::Scope TRACE_CAT(trace_scope_, __LINE__)(name)
+
+#endif
@@ -3,6 +3,8 @@
 #include <vector>
 
 #include "Utils.h"
+#include "GTP.h"
+#include "SMP.h"
 #include "TTable.h"
 
 TTable* TTable::get_TT(void) {
@@ -13,6 +15,19 @@ TTable* TTable::get_TT(void) {
 TTable::TTable(int size) {
     LOCK(m_mutex, lock);
     m_buckets.resize(size);
+    // Every thread probes it, no node should own it
+    if (cfg_numa) {
+        SMP::interleave_memory(m_buckets.data(), get_memory_usage());
+    }
+}
+
+size_t TTable::get_memory_usage() const {
+    return m_buckets.size() * sizeof(TTEntry);
+}
+
+void TTable::clear() {
+    LOCK(m_mutex, lock);
+    std::fill(begin(m_buckets), end(m_buckets), TTEntry());
 }
 
 void TTable::update(uint64 hash, const float komi, const UCTNode * node) {
@@ -38,6 +38,16 @@ public:
     */
     void sync(uint64 hash, const float komi, UCTNode * node);
 
+    /*
+        bytes taken by the table
+    */
+    size_t get_memory_usage() const;
+
+    /*
+        forget everything, for repeatable searches
+    */
+    void clear();
+
 private:
     TTable(int size = 500000);
 
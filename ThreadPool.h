@@ -27,71 +27,162 @@
 #include <cstddef>
 #include <vector>
 #include <thread>
-#include <queue>
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
-#include <memory>
-#include <future>
+#include <algorithm>
 #include <functional>
 
 namespace Utils {
 
+class ThreadPool;
+
+/*
+    A batch of indexed tasks. It lives on the stack of the thread that
+    started it, the pool threads and the owner claim indices from it
+    until none are left. No allocations are made per task.
+*/
+class ThreadGroup {
+public:
+    ThreadGroup(ThreadPool & pool) : m_pool(pool) {};
+    ~ThreadGroup() { wait_all(); };
+    /*
+        Run f(i) for every i in [0, count). f has to stay alive
+        until wait_all() returns.
+    */
+    template<class F>
+    void run(F & f, int count);
+    /*
+        Help with whatever wasn't picked up yet, then wait for
+        the pool threads to finish theirs.
+    */
+    void wait_all();
+private:
+    friend class ThreadPool;
+    template<class F>
+    static void call(void * f, int i) {
+        (*static_cast<F*>(f))(i);
+    };
+    void work();
+
+    ThreadPool & m_pool;
+    void (*m_fn)(void *, int){nullptr};
+    void * m_arg{nullptr};
+    int m_count{0};
+    bool m_queued{false};
+    std::atomic<int> m_next{0};
+    std::atomic<int> m_done{0};
+    // pool threads currently holding a pointer to us
+    std::atomic<int> m_active{0};
+    // wait_all() sleeps on this once spinning didn't pay off
+    std::mutex m_mutex;
+    std::condition_variable m_finished;
+};
+
 class ThreadPool {
 public:
     ThreadPool() = default;
     ~ThreadPool();
-    void initialize(std::size_t);
-    template<class F, class... Args>
-    auto add_task(F&& f, Args&&... args)
-        -> std::future<typename std::result_of<F(Args...)>::type>;
+    /*
+        Start the threads. Each one calls init with its number
+        first, to set itself up (pinning to a core and the like).
+    */
+    void initialize(std::size_t threads,
+                    std::function<void(std::size_t)> init = nullptr);
+    /*
+        Stop the threads and start this many instead, set up with the
+        same init. Nothing may be running on the pool.
+    */
+    void resize(std::size_t threads);
+    std::size_t size() const { return m_threads.size(); };
+    /*
+        Run f(i) for every i in [begin, end) and wait for it.
+        The calling thread takes part in the work.
+    */
+    template<class F>
+    void parallel_for(int begin, int end, F && f);
 private:
+    friend class ThreadGroup;
+    void submit(ThreadGroup * group);
+    void retire(ThreadGroup * group);
+    void stop();
+
     std::vector<std::thread> m_threads;
-    std::queue<std::function<void()>> m_tasks;
+    std::function<void(std::size_t)> m_init;
+    std::vector<ThreadGroup *> m_groups;
 
     std::mutex m_mutex;
     std::condition_variable m_condvar;
     bool m_exit{false};
 };
 
-inline void ThreadPool::initialize(size_t threads) {
+inline void ThreadPool::initialize(size_t threads,
+                                   std::function<void(std::size_t)> init) {
+    m_init = init;
     for (size_t i = 0; i < threads; i++) {
-        m_threads.emplace_back([this] {
+        m_threads.emplace_back([this, i, init] {
+            if (init) {
+                init(i);
+            }
             for (;;) {
-                std::function<void()> task;
+                ThreadGroup * group;
                 {
                     std::unique_lock<std::mutex> lock(m_mutex);
-                    m_condvar.wait(lock, [this]{ return m_exit || !m_tasks.empty(); });
-                    if (m_exit && m_tasks.empty()) {
+                    m_condvar.wait(lock, [this]{ return m_exit || !m_groups.empty(); });
+                    if (m_exit && m_groups.empty()) {
                         return;
                     }
-                    task = std::move(m_tasks.front());
-                    m_tasks.pop();
+                    group = m_groups.front();
+                    if (group->m_next >= group->m_count) {
+                        // Everything handed out, let the others through
+                        m_groups.erase(m_groups.begin());
+                        continue;
+                    }
+                    group->m_active++;
                 }
-                task();
+                group->work();
+                group->m_active--;
             }
         });
     }
 }
 
-template<class F, class... Args>
-auto ThreadPool::add_task(F&& f, Args&&... args)
-    -> std::future<typename std::result_of<F(Args...)>::type> {
-    using return_type = typename std::result_of<F(Args...)>::type;
-
-    auto task = std::make_shared< std::packaged_task<return_type()> >(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-    );
-
-    std::future<return_type> res = task->get_future();
+inline void ThreadPool::submit(ThreadGroup * group) {
     {
         std::unique_lock<std::mutex> lock(m_mutex);
-        m_tasks.emplace([task](){(*task)();});
+        m_groups.push_back(group);
     }
-    m_condvar.notify_one();
-    return res;
+    m_condvar.notify_all();
 }
 
-inline ThreadPool::~ThreadPool() {
+inline void ThreadPool::retire(ThreadGroup * group) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = std::find(m_groups.begin(), m_groups.end(), group);
+    if (it != m_groups.end()) {
+        m_groups.erase(it);
+    }
+}
+
+template<class F>
+void ThreadPool::parallel_for(int begin, int end, F && f) {
+    auto body = [begin, &f](int i) {
+        f(begin + i);
+    };
+    ThreadGroup tg(*this);
+    tg.run(body, end - begin);
+    tg.wait_all();
+}
+
+inline void ThreadPool::resize(size_t threads) {
+    if (threads == m_threads.size()) {
+        return;
+    }
+    stop();
+    m_exit = false;
+    initialize(threads, m_init);
+}
+
+inline void ThreadPool::stop() {
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_exit = true;
@@ -100,27 +191,64 @@ inline ThreadPool::~ThreadPool() {
     for (std::thread & worker: m_threads) {
         worker.join();
     }
+    m_threads.clear();
 }
 
-class ThreadGroup {
-public:
-    ThreadGroup(ThreadPool & pool) : m_pool(pool) {};
-    template<class F, class... Args>
-    void add_task(F&& f, Args&&... args) {
-        m_taskresults.emplace_back(
-            m_pool.add_task(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-    };
-    void wait_all() {
-        for (auto && result: m_taskresults) {
-            result.get();
+inline ThreadPool::~ThreadPool() {
+    stop();
+}
+
+template<class F>
+void ThreadGroup::run(F & f, int count) {
+    wait_all();
+    if (count <= 0) {
+        return;
+    }
+    m_fn = &call<F>;
+    m_arg = &f;
+    m_count = count;
+    m_next = 0;
+    m_done = 0;
+    m_queued = true;
+    m_pool.submit(this);
+}
+
+inline void ThreadGroup::work() {
+    int i;
+    while ((i = m_next++) < m_count) {
+        m_fn(m_arg, i);
+        if (++m_done == m_count) {
+            // Notify under the lock, so the owner can't miss it. The
+            // group outlives this because m_active is still held.
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished.notify_all();
         }
-    };
-private:
-    ThreadPool & m_pool;
-    std::vector<std::future<void>> m_taskresults;
-};
+    }
+}
+
+inline void ThreadGroup::wait_all() {
+    if (!m_queued) {
+        return;
+    }
+    work();
+    // Short batches end while we spin, long ones (mc_owner, leaf
+    // playouts) shouldn't have us compete with the threads doing them
+    for (int spins = 0; m_done < m_count; spins++) {
+        if (spins < 64) {
+            std::this_thread::yield();
+        } else {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_finished.wait(lock, [this]{ return m_done >= m_count; });
+        }
+    }
+    // No new pool threads can pick us up after this
+    m_pool.retire(this);
+    while (m_active > 0) {
+        std::this_thread::yield();
+    }
+    m_queued = false;
+}
 
 }
 
-#endif
\ No newline at end of file
+#endif
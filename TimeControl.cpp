@@ -25,6 +25,8 @@ void TimeControl::reset_clocks() {
     m_periods_left[1] = m_byoperiods;
     m_inbyo[0] = m_maintime <= 0;
     m_inbyo[1] = m_maintime <= 0;
+    m_carryover[0] = 0;
+    m_carryover[1] = 0;
     // Now that byo-yomi status is set, add time
     // back to our clocks
     if (m_inbyo[0]) {
@@ -65,6 +67,7 @@ void TimeControl::stop(int color) {
         m_stones_left[color] = m_byostones;
         m_periods_left[color] = m_byoperiods;
         m_inbyo[color] = true;
+        m_carryover[color] = 0;
     } else if (m_inbyo[color] && m_byostones && m_stones_left[color] <= 0) {
         // reset byoyomi time and stones
         m_remaining_time[color] = m_byotime;
@@ -114,7 +117,18 @@ void TimeControl::display_times() {
     myprintf("\n");
 }
 
-int TimeControl::max_time_for_move(int color) {
+int TimeControl::max_time_for_move(int color) const {
+    int timealloc = base_time_for_move(color);
+    timealloc += carryover_bonus(color, timealloc);
+    timealloc = std::max<int>(timealloc, 0);
+    return timealloc;
+}
+
+void TimeControl::use_carryover(int color) {
+    m_carryover[color] -= carryover_bonus(color, base_time_for_move(color));
+}
+
+int TimeControl::base_time_for_move(int color) const {
     /*
         always keep a 1 second margin for net hiccups
     */
@@ -170,10 +184,35 @@ int TimeControl::max_time_for_move(int color) {
         }
     }
 
-    timealloc = std::max<int>(timealloc, 0);
     return timealloc;
 }
 
+int TimeControl::carryover_bonus(int color, int timealloc) const {
+    /*
+        spend half of what earlier moves saved, as far as
+        the clock allows
+    */
+    if (m_carryover[color] <= 0) {
+        return 0;
+    }
+    int bonus = m_carryover[color] / 2;
+    bonus = std::min(bonus, m_remaining_time[color] - cfg_lagbuffer_cs
+                            - timealloc);
+    return std::max(bonus, 0);
+}
+
+void TimeControl::add_carryover(int color, int time) {
+    // byo yomi periods are reset every move, nothing to save
+    if (m_inbyo[color] && m_byoperiods && !m_byostones) {
+        return;
+    }
+    m_carryover[color] += std::max(time, 0);
+}
+
+int TimeControl::get_carryover(int color) {
+    return m_carryover[color];
+}
+
 void TimeControl::adjust_time(int color, int time, int stones) {
     m_remaining_time[color] = time;
     // From pachi: some GTP things send 0 0 at the end of main time
@@ -16,14 +16,26 @@ public:
 
     void start(int color);
     void stop(int color);
-    int max_time_for_move(int color);
+    // Includes part of the carryover, use_carryover() takes it out
+    int max_time_for_move(int color) const;
     void adjust_time(int color, int time, int stones);
     void set_boardsize(int boardsize);
     void display_times();
     int get_remaining_time(int color);
     void reset_clocks();
+    /*
+        Time a search didn't use of its allocation. Part of it is
+        added to each following allocation.
+    */
+    void add_carryover(int color, int time);
+    // Once we really search with what max_time_for_move() gave
+    void use_carryover(int color);
+    int get_carryover(int color);
 
 private:
+    int base_time_for_move(int color) const;
+    int carryover_bonus(int color, int timealloc) const;
+
     int m_maintime;
     int m_byotime;
     int m_byostones;
@@ -34,6 +46,7 @@ private:
     std::array<int,  2> m_stones_left;       /* stones to play in byo period */
     std::array<int,  2> m_periods_left;      /* byo periods */
     std::array<bool, 2> m_inbyo;             /* player is in byo yomi */
+    std::array<int,  2> m_carryover;         /* time saved by earlier moves */
 
     std::array<Time, 2> m_times;             /* storage for player times */
 };
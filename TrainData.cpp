@@ -0,0 +1,175 @@
+#include "config.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "TrainData.h"
+#include "Utils.h"
+
+using namespace Utils;
+
+namespace {
+    // Little endian, whatever the host order, readers unpack with '<'
+    template <typename T>
+    void put(std::string & out, T value) {
+        for (size_t i = 0; i < sizeof(value); i++) {
+            out.push_back(static_cast<char>(value & 0xFF));
+            value >>= 8;
+        }
+    }
+
+    template <>
+    void put<float>(std::string & out, float value) {
+        uint32 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        put<uint32>(out, bits);
+    }
+}
+
+TrainDataWriter::TrainDataWriter(const std::string & filename)
+    : m_filename(filename),
+      m_out(filename, std::ofstream::binary | std::ofstream::trunc) {
+    if (!m_out) {
+        myprintf("Could not create %s\n", filename.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    std::string header("LZTR");
+    put<uint32>(header, VERSION);
+    put<uint32>(header, PLANES);
+    put<uint32>(header, RECORD_SIZE);
+    m_out.write(header.data(), header.size());
+    m_offset = header.size();
+
+    m_chunk.m_positions = 0;
+    m_chunk.m_data.reserve(CHUNK_POSITIONS * RECORD_SIZE);
+    m_thread = std::thread(&TrainDataWriter::write_chunks, this);
+}
+
+TrainDataWriter::~TrainDataWriter() {
+    close();
+}
+
+void TrainDataWriter::add(const Network::TrainPosition & position) {
+    assert(position.planes.size() == PLANES);
+
+    auto & data = m_chunk.m_data;
+    for (auto & plane : position.planes) {
+        char bytes[PLANE_BYTES] = {};
+        for (size_t b = 0; b < plane.size(); b++) {
+            if (plane[b]) {
+                bytes[b / 8] |= 1 << (b % 8);
+            }
+        }
+        data.append(bytes, PLANE_BYTES);
+    }
+    for (auto move : position.moves) {
+        put<uint16>(data, move);
+    }
+    put<float>(data, position.stm_won);
+
+    m_positions++;
+    if (++m_chunk.m_positions == CHUNK_POSITIONS) {
+        queue_chunk();
+    }
+}
+
+size_t TrainDataWriter::get_positions() const {
+    return m_positions;
+}
+
+void TrainDataWriter::queue_chunk() {
+    if (m_chunk.m_positions == 0) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_full.wait(lock, [this]{ return m_queue.size() < QUEUE_CHUNKS; });
+        m_queue.push_back(std::move(m_chunk));
+    }
+    m_not_empty.notify_one();
+
+    m_chunk = Chunk();
+    m_chunk.m_positions = 0;
+    m_chunk.m_data.reserve(CHUNK_POSITIONS * RECORD_SIZE);
+}
+
+void TrainDataWriter::write_chunks() {
+    for (;;) {
+        Chunk chunk;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_not_empty.wait(lock, [this]{ return m_closing || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                return;
+            }
+            chunk = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        m_not_full.notify_one();
+        write_chunk(chunk);
+    }
+}
+
+void TrainDataWriter::write_chunk(const Chunk & chunk) {
+    std::string compressed;
+#ifdef USE_ZLIB
+    uLongf size = compressBound(chunk.m_data.size());
+    compressed.resize(size);
+    int result = compress2(reinterpret_cast<Bytef *>(&compressed[0]), &size,
+                           reinterpret_cast<const Bytef *>(chunk.m_data.data()),
+                           chunk.m_data.size(), Z_DEFAULT_COMPRESSION);
+    // Random looking data can come out bigger, store that as it is
+    if (result == Z_OK && size < chunk.m_data.size()) {
+        compressed.resize(size);
+    } else {
+        compressed.clear();
+    }
+#endif
+    const std::string & stored = compressed.empty() ? chunk.m_data : compressed;
+
+    m_out.write(stored.data(), stored.size());
+    if (!m_out) {
+        myprintf("Error writing %s\n", m_filename.c_str());
+        exit(EXIT_FAILURE);
+    }
+    m_index.push_back({m_offset, (uint32)stored.size(), chunk.m_positions});
+    m_offset += stored.size();
+}
+
+void TrainDataWriter::close() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    queue_chunk();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_closing = true;
+    }
+    m_not_empty.notify_one();
+    m_thread.join();
+
+    std::string tail;
+    for (auto & entry : m_index) {
+        put<uint64>(tail, entry.m_offset);
+        put<uint32>(tail, entry.m_size);
+        put<uint32>(tail, entry.m_positions);
+    }
+    put<uint64>(tail, m_offset);
+    put<uint64>(tail, m_positions);
+    put<uint32>(tail, m_index.size());
+    tail.append("LZTI");
+
+    m_out.write(tail.data(), tail.size());
+    m_out.close();
+    if (!m_out) {
+        myprintf("Error writing %s\n", m_filename.c_str());
+        exit(EXIT_FAILURE);
+    }
+}
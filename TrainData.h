@@ -0,0 +1,92 @@
+#ifndef TRAINDATA_H_INCLUDED
+#define TRAINDATA_H_INCLUDED
+
+#include "config.h"
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Network.h"
+
+/*
+    Training positions in a file that needs nothing but (optionally)
+    zlib to read. params/traindata.py reads it back.
+
+    A position is a fixed size record: the 32 input planes with 361
+    bits each, packed into 46 bytes per plane, then the move played
+    and the 2 after it as uint16, then the game result for the side
+    to move as a float. The records are in the orientation of the
+    game, symmetries are for the reader to apply.
+
+    Records are grouped in chunks, which are zlib compressed when
+    built with USE_ZLIB. An index of the chunks at the end of the file
+    gives their offsets, so readers can pick chunks at random.
+
+    All numbers are little endian, floats are IEEE 754 single.
+
+    header  magic "LZTR", uint32 version, planes, record size
+    chunks  stored size bytes each
+    index   per chunk: uint64 offset, uint32 stored size, positions
+    footer  uint64 index offset, uint64 positions, uint32 chunks,
+            magic "LZTI"
+
+    A chunk is compressed if its stored size is less than positions
+    times the record size.
+*/
+class TrainDataWriter {
+public:
+    static constexpr uint32 VERSION = 1;
+    static constexpr int PLANES = 32;
+    static constexpr int PLANE_BYTES = (19 * 19 + 7) / 8;
+    static constexpr int RECORD_SIZE = PLANES * PLANE_BYTES + 3 * 2 + 4;
+    static constexpr int CHUNK_POSITIONS = 4096;
+    // Chunks waiting for the writer thread before add() blocks
+    static constexpr int QUEUE_CHUNKS = 4;
+
+    // Exits if the file can't be created
+    explicit TrainDataWriter(const std::string & filename);
+    ~TrainDataWriter();
+
+    void add(const Network::TrainPosition & position);
+    // Write what is left and the index. Called by the destructor.
+    void close();
+    size_t get_positions() const;
+
+private:
+    struct Chunk {
+        std::string m_data;
+        uint32 m_positions;
+    };
+    struct IndexEntry {
+        uint64 m_offset;
+        uint32 m_size;
+        uint32 m_positions;
+    };
+
+    void queue_chunk();
+    void write_chunks();
+    void write_chunk(const Chunk & chunk);
+
+    std::string m_filename;
+    std::ofstream m_out;
+    Chunk m_chunk;
+    size_t m_positions{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_not_full;
+    std::condition_variable m_not_empty;
+    std::deque<Chunk> m_queue;
+    bool m_closing{false};
+    std::thread m_thread;
+
+    // Only the writer thread touches these until it is joined
+    uint64 m_offset{0};
+    std::vector<IndexEntry> m_index;
+};
+
+#endif
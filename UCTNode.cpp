@@ -5,6 +5,8 @@
 #include <stdio.h>
 #include <assert.h>
 #include <cmath>
+#include <new>
+#include <chrono>
 
 #include <iostream>
 #include <vector>
@@ -20,34 +22,177 @@
 #include "Network.h"
 #include "GTP.h"
 #include "Random.h"
+#include "SearchTrace.h"
 #ifdef USE_OPENCL
 #include "OpenCL.h"
 #endif
 
 using namespace Utils;
 
+static_assert(sizeof(UCTNode) <= 56, "UCTNode should stay compact");
+
+constexpr UCTNodePool::index_t UCTNodePool::NONE;
+constexpr size_t UCTNodePool::BATCH;
+std::array<UCTNode *, UCTNodePool::MAX_CHUNKS> UCTNodePool::s_chunks;
+std::array<uint8, UCTNodePool::MAX_CHUNKS> UCTNodePool::s_chunk_arena;
+std::array<UCTNodePool::Arena, UCTNodePool::MAX_ARENAS> UCTNodePool::s_arenas;
+int UCTNodePool::s_chunks_used = 0;
+std::mutex UCTNodePool::s_mutex;
+
+constexpr uint32 UCTNode::RAVE_ONE;
+constexpr uint32 UCTNode::RAVE_MAX_VISITS;
+constexpr int64 UCTNode::SUM_ONE;
+std::atomic<int> UCTNode::s_rave_tables(0);
+
+UCTNodePool::Cache & UCTNodePool::thread_cache() {
+    // Given back to the arena when the thread exits
+    thread_local Cache cache;
+    return cache;
+}
+
+UCTNodePool::Cache::~Cache() {
+    spill(m_free.size());
+}
+
+void UCTNodePool::Cache::refill(int arena_id) {
+    if (arena_id != m_arena) {
+        // Keep nodes of other arenas out of this thread's hands
+        spill(m_free.size());
+        m_arena = arena_id;
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    Arena & arena = s_arenas[arena_id];
+    while (m_free.size() < BATCH && !arena.m_free.empty()) {
+        m_free.push_back(arena.m_free.back());
+        arena.m_free.pop_back();
+    }
+    while (m_free.size() < BATCH) {
+        if (arena.m_next == arena.m_end) {
+            int chunk = s_chunks_used++;
+            assert(chunk < MAX_CHUNKS);
+            size_t size = sizeof(UCTNode) << CHUNK_BITS;
+            s_chunks[chunk] = static_cast<UCTNode*>(::operator new(size));
+            if (cfg_numa) {
+                SMP::bind_memory(s_chunks[chunk], size, arena_id);
+            }
+            s_chunk_arena[chunk] = arena_id;
+            // index 0 is NONE
+            arena.m_next = std::max<index_t>(chunk << CHUNK_BITS, 1);
+            arena.m_end = (chunk + 1) << CHUNK_BITS;
+        }
+        m_free.push_back(arena.m_next++);
+    }
+    // Hand out fresh nodes in address order
+    std::reverse(m_free.end() - std::min(m_free.size(), BATCH),
+                 m_free.end());
+}
+
+void UCTNodePool::Cache::spill(size_t count) {
+    if (count == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto & free = s_arenas[m_arena].m_free;
+    free.insert(free.end(), m_free.end() - count, m_free.end());
+    m_free.resize(m_free.size() - count);
+}
+
+UCTNodePool::index_t UCTNodePool::create(int vertex, float score,
+                                         int expand_threshold,
+                                         int netscore_threshold,
+                                         int movenum) {
+    int arena_id = cfg_numa ? SMP::get_thread_node() % MAX_ARENAS : 0;
+    Cache & cache = thread_cache();
+    if (cache.m_free.empty() || cache.m_arena != arena_id) {
+        cache.refill(arena_id);
+    }
+    index_t index = cache.m_free.back();
+    cache.m_free.pop_back();
+
+    new (get(index)) UCTNode(vertex, score,
+                             expand_threshold, netscore_threshold, movenum);
+    return index;
+}
+
+int UCTNodePool::release(index_t index) {
+    UCTNode * node = get(index);
+    // Children first, so we can count them
+    int count = 1 + release_siblings(node->m_firstchild);
+    node->m_firstchild = NONE;
+    node->~UCTNode();
+
+    int arena_id = s_chunk_arena[index >> CHUNK_BITS];
+    Cache & cache = thread_cache();
+    if (cache.m_arena < 0) {
+        cache.m_arena = arena_id;
+    }
+    if (arena_id != cache.m_arena) {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_arenas[arena_id].m_free.push_back(index);
+        return count;
+    }
+    cache.m_free.push_back(index);
+    if (cache.m_free.size() > 2 * BATCH) {
+        cache.spill(BATCH);
+    }
+    return count;
+}
+
+int UCTNodePool::release_siblings(index_t first) {
+    int count = 0;
+    while (first != NONE) {
+        index_t next = get(first)->m_nextsibling;
+        count += release(first);
+        first = next;
+    }
+    return count;
+}
+
+int64 UCTNode::to_sum(double value) {
+    return std::llround(value * SUM_ONE);
+}
+
+double UCTNode::from_sum(int64 sum) {
+    return sum / (double)SUM_ONE;
+}
+
 UCTNode::UCTNode(int vertex, float score, int expand_threshold,
                  int netscore_threshold, int movenum)
-    : m_has_children(false), m_firstchild(nullptr), m_nextsibling(nullptr),
-      m_move(vertex), m_blackwins(0.0), m_visits(0), m_score(score),
-      m_eval_propagated(false), m_blackevals(0.0f),
-      m_evalcount(0), m_movenum(movenum), m_is_evaluating(false),
-      m_valid(true), m_expand_cnt(expand_threshold), m_is_expanding(false),
-      m_has_netscore(false), m_netscore_thresh(netscore_threshold),
-      m_symmetries_done(0), m_is_netscoring(false) {
-    m_ravevisits = 20;
-    m_ravestmwins = 10.0;
+    : m_visits(0), m_score(score), m_blackwins(0), m_rave(nullptr),
+      m_nextsibling(UCTNodePool::NONE),
+      m_firstchild(UCTNodePool::NONE), m_blackevals(0), m_evalcount(0),
+      m_move(vertex), m_movenum(movenum), m_symmetries_done(0),
+      m_flags(VALID) {
+    set_expand_cnt(expand_threshold, netscore_threshold);
 }
 
 UCTNode::~UCTNode() {
     LOCK(get_mutex(), lock);
-    UCTNode * next = m_firstchild;
+    index_t next = m_firstchild;
 
-    while (next != NULL) {
-        UCTNode * tmp = next->m_nextsibling;
-        delete next;
+    while (next != UCTNodePool::NONE) {
+        index_t tmp = UCTNodePool::get(next)->m_nextsibling;
+        UCTNodePool::release(next);
         next = tmp;
     }
+
+    if (m_rave != nullptr) {
+        delete[] m_rave.load();
+        s_rave_tables--;
+    }
+}
+
+bool UCTNode::get_flag(uint8 flag) const {
+    return (m_flags & flag) != 0;
+}
+
+void UCTNode::set_flag(uint8 flag, bool value) {
+    if (value) {
+        m_flags |= flag;
+    } else {
+        m_flags &= ~flag;
+    }
 }
 
 bool UCTNode::first_visit() const {
@@ -62,8 +207,8 @@ bool UCTNode::should_netscore() const {
     return m_visits > m_netscore_thresh;
 }
 
-void UCTNode::link_child(UCTNode * newchild) {
-    newchild->m_nextsibling = m_firstchild;
+void UCTNode::link_child(index_t newchild) {
+    UCTNodePool::get(newchild)->m_nextsibling = m_firstchild;
     m_firstchild = newchild;
 }
 
@@ -71,12 +216,46 @@ SMP::Mutex & UCTNode::get_mutex() {
     return m_nodemutex;
 }
 
+/*
+    Called with the lock held, before the first children are linked.
+    The table outlives pruning so a node expanded again keeps its
+    statistics.
+*/
+void UCTNode::create_rave_table(FastBoard & board) {
+    if (m_rave != nullptr) {
+        return;
+    }
+    const int size = board.get_boardsize() + 2;
+    RaveEntry * table = new RaveEntry[size * size];
+    for (int i = 0; i < size * size; i++) {
+        // prior of 10 wins in 20 games
+        table[i].m_visits = 20;
+        table[i].m_wins = 10 * RAVE_ONE;
+    }
+    s_rave_tables++;
+    m_rave = table;
+}
+
+size_t UCTNode::get_rave_table_size(int boardsize) {
+    const size_t size = boardsize + 2;
+    return size * size * sizeof(RaveEntry);
+}
+
+size_t UCTNode::get_rave_memory(int boardsize) {
+    return s_rave_tables * get_rave_table_size(boardsize);
+}
+
+int UCTNode::rave_slot(int move) {
+    return move == FastBoard::PASS ? 0 : move;
+}
+
 void UCTNode::netscore_children(std::atomic<int> & nodecount,
-                                FastState & state, bool at_root) {
+                                FastState & state, bool at_root,
+                                std::atomic<int> * pending) {
     // acquire the lock
     LOCK(get_mutex(), lock);
     // check whether somebody beat us to it
-    if (at_root && m_has_netscore) {
+    if (at_root && has_netscore()) {
         return;
     }
     if (m_symmetries_done >= 8) {
@@ -91,26 +270,31 @@ void UCTNode::netscore_children(std::atomic<int> & nodecount,
     if (!opencl.thread_can_issue()) {
         // We don't abort them when the search ends
         // assert(!at_root);
+        SearchTrace::instant("nn_queue_full");
         return;
     }
 #endif
     // Someone else is running the expansion
-    if (m_is_netscoring) {
+    if (get_flag(IS_NETSCORING)) {
         return;
     }
     // We'll be the one queueing this node for expansion, stop others
-    m_is_netscoring = true;
+    set_flag(IS_NETSCORING);
     // Let simulations proceed
     lock.unlock();
 
 #ifdef USE_OPENCL
-    if (at_root) {
+    // Asynchronous results arrive at a different point of the search
+    // every run
+    if (at_root || cfg_deterministic) {
         auto raw_netlist = Network::get_Network()->get_scored_moves(
-            &state, Network::Ensemble::AVERAGE_ALL);
+            &state, (at_root ? Network::Ensemble::AVERAGE_ALL :
+                               Network::Ensemble::DIRECT), m_symmetries_done);
         scoring_cb(&nodecount, state, raw_netlist, at_root);
     } else {
         Network::get_Network()->async_scored_moves(
-            &nodecount, &state, this, Network::Ensemble::DIRECT, m_symmetries_done);
+            &nodecount, pending, &state, this, Network::Ensemble::DIRECT,
+            m_symmetries_done);
     }
 #else
     auto raw_netlist = Network::get_Network()->get_scored_moves(
@@ -133,11 +317,11 @@ void UCTNode::create_children(std::atomic<int> & nodecount,
         return;
     }
     // Someone else is running the expansion
-    if (m_is_expanding) {
+    if (get_flag(IS_EXPANDING)) {
         return;
     }
     // We'll be the one queueing this node for expansion, stop others
-    m_is_expanding = true;
+    set_flag(IS_EXPANDING);
     lock.unlock();
 
     FastBoard & board = state.board;
@@ -202,24 +386,26 @@ void UCTNode::rescore_nodelist(std::atomic<int> & nodecount,
     int movenum = board.get_stone_count();
 
     LOCK(get_mutex(), lock);
+    create_rave_table(board);
 
     for (auto it = nodelist.cbegin(); it != nodelist.cend(); ++it) {
         // Check for duplicate moves, O(N^2)
         bool found = false;
-        UCTNode * child = m_firstchild;
+        UCTNode * child = get_first_child();
         while (child != NULL) {
             if (child->get_move() == it->second) {
                 found = true;
                 break;
             }
-            child = child->m_nextsibling;
+            child = child->get_sibling();
         }
         if (!found) {
             // Not added yet, is it highly scored?
             if (std::distance(it, nodelist.cend()) <= max_net_childs) {
-                UCTNode * vtx = new UCTNode(it->second, it->first,
-                                            expand_threshold, netscore_threshold,
-                                            movenum);
+                index_t index = UCTNodePool::create(it->second, it->first,
+                                                    expand_threshold, netscore_threshold,
+                                                    movenum);
+                UCTNode * vtx = UCTNodePool::get(index);
                 if (it->second != FastBoard::PASS) {
                     // atari giving
                     // was == 2, == 1
@@ -230,7 +416,7 @@ void UCTNode::rescore_nodelist(std::atomic<int> & nodecount,
                         vtx->set_expand_cnt(expand_threshold / 3, netscore_threshold / 3);
                     }
                 }
-                link_child(vtx);
+                link_child(index);
                 childrenadded++;
             }
         } else {
@@ -251,9 +437,9 @@ void UCTNode::rescore_nodelist(std::atomic<int> & nodecount,
 
     nodecount += childrenadded;
     sort_children();
-    m_has_children = true;
-    m_has_netscore = true;
-    m_is_netscoring = false;
+    set_flag(HAS_CHILDREN);
+    set_flag(HAS_NETSCORE);
+    set_flag(IS_NETSCORING, false);
     if (all_symmetries) {
         m_symmetries_done = 8;
     } else {
@@ -284,12 +470,14 @@ void UCTNode::link_nodelist(std::atomic<int> & nodecount,
     int movenum = board.get_stone_count();
 
     LOCK(get_mutex(), lock);
+    create_rave_table(board);
 
     for (auto it = nodelist.cbegin(); it != nodelist.cend(); ++it) {
         if (totalchildren - childrenseen <= maxchilds) {
-            UCTNode * vtx = new UCTNode(it->second, it->first,
-                                        expand_threshold, netscore_threshold,
-                                        movenum);
+            index_t index = UCTNodePool::create(it->second, it->first,
+                                                expand_threshold, netscore_threshold,
+                                                movenum);
+            UCTNode * vtx = UCTNodePool::get(index);
             if (it->second != FastBoard::PASS) {
                 // atari giving
                 // was == 2, == 1
@@ -303,14 +491,14 @@ void UCTNode::link_nodelist(std::atomic<int> & nodecount,
                     vtx->set_expand_cnt(expand_threshold / 3, netscore_threshold / 3);
                 }
             }
-            link_child(vtx);
+            link_child(index);
             childrenadded++;
         }
         childrenseen++;
     }
 
     nodecount += childrenadded;
-    m_has_children = true;
+    set_flag(HAS_CHILDREN);
 }
 
 void UCTNode::run_value_net(FastState & state) {
@@ -320,13 +508,13 @@ void UCTNode::run_value_net(FastState & state) {
     }
     // acquire the lock
     LOCK(get_mutex(), lock);
-    if (m_is_evaluating) {
+    if (get_flag(IS_EVALUATING)) {
         return;
     }
     assert(!has_eval_propagated());
 
     // We'll be the one evaluating this node, stop others
-    m_is_evaluating = true;
+    set_flag(IS_EVALUATING);
     // Let simulations proceed
     lock.unlock();
 
@@ -344,7 +532,7 @@ void UCTNode::run_value_net(FastState & state) {
 }
 
 void UCTNode::kill_superkos(KoState & state) {        
-    UCTNode * child = m_firstchild;
+    UCTNode * child = get_first_child();
     
     while (child != NULL) {
         int move = child->get_move();                
@@ -354,13 +542,13 @@ void UCTNode::kill_superkos(KoState & state) {
             mystate.play_move(move);
             
             if (mystate.superko()) {                                    
-                UCTNode * tmp = child->m_nextsibling;
+                UCTNode * tmp = child->get_sibling();
                 delete_child(child);                
                 child = tmp;
                 continue;                               
             }    
         }                   
-        child = child->m_nextsibling;
+        child = child->get_sibling();
     }                 
 }
 
@@ -373,36 +561,29 @@ void UCTNode::set_move(int move) {
 }
 
 void UCTNode::set_expand_cnt(int runs, int netscore_cnt) {
-    m_expand_cnt = runs;
-    m_netscore_thresh = netscore_cnt;
+    // Saturate, anything this large never triggers anyway
+    m_expand_cnt = std::min(runs, 0xFFFF);
+    m_netscore_thresh = std::min(netscore_cnt, 0xFFFF);
 }
 
-void UCTNode::update(Playout & gameresult, int color, bool update_eval) {
-    m_visits++;
-    m_ravevisits++;
-
-    // prefer winning with more territory
-    float score = gameresult.get_score();
-    double blackwins_inc = 0.05 * score;
-    if (score > 0.0f) {
-        blackwins_inc += 1.0;
-    } else if (score == 0.0f) {
-        blackwins_inc += 0.5;
-    }
-    atomic_add(m_blackwins, blackwins_inc);
+void UCTNode::update(Playout & gameresult, bool update_eval) {
+    const int runs = gameresult.get_runs();
+    float blackwins_inc = 0.0f;
 
-    // We're inspected from one level above and scores
-    // are side to move, so invert here
-    if (color == FastBoard::BLACK) {
-        if (score < 0.0f) {
-            atomic_add(m_ravestmwins, 1.0 + 0.05 * -score);
-        }
-    } else if (color == FastBoard::WHITE) {
+    for (int run = 0; run < runs; run++) {
+        // prefer winning with more territory
+        float score = gameresult.get_score(run);
+        blackwins_inc += 0.05f * score;
         if (score > 0.0f) {
-            atomic_add(m_ravestmwins, 1.0 + 0.05 * score);
+            blackwins_inc += 1.0f;
+        } else if (score == 0.0f) {
+            blackwins_inc += 0.5f;
         }
     }
 
+    m_visits += runs;
+    m_blackwins += to_sum(blackwins_inc);
+
     // evals
     if (gameresult.has_eval() && update_eval) {
         accumulate_eval(gameresult.get_eval());
@@ -410,15 +591,15 @@ void UCTNode::update(Playout & gameresult, int color, bool update_eval) {
 }
 
 bool UCTNode::has_children() const {
-    return m_has_children;
+    return get_flag(HAS_CHILDREN);
 }
 
 bool UCTNode::has_netscore() const {
-    return m_has_netscore;
+    return get_flag(HAS_NETSCORE);
 }
 
 double UCTNode::get_blackwins() const {
-    return m_blackwins;
+    return from_sum(m_blackwins);
 }
 
 void UCTNode::set_visits(int visits) {
@@ -426,7 +607,7 @@ void UCTNode::set_visits(int visits) {
 }
 
 void UCTNode::set_blackwins(double wins) {
-    m_blackwins = wins;
+    m_blackwins = to_sum(wins);
 }
 
 float UCTNode::get_score() const {
@@ -449,8 +630,9 @@ float UCTNode::get_winrate(int tomove) const {
     return rate;
 }
 
-float UCTNode::get_raverate() const {
-    float rate = m_ravestmwins / m_ravevisits;
+float UCTNode::get_raverate(int move) const {
+    const RaveEntry & entry = m_rave.load()[rave_slot(move)];
+    float rate = entry.m_wins / (float)(RAVE_ONE * entry.m_visits);
 
     return rate;
 }
@@ -459,12 +641,12 @@ int UCTNode::get_visits() const {
     return m_visits;
 }
 
-int UCTNode::get_ravevisits() const {
-    return m_ravevisits;
+int UCTNode::get_ravevisits(int move) const {
+    return m_rave.load()[rave_slot(move)].m_visits;
 }
 
 float UCTNode::get_eval(int tomove) const {
-    float score = m_blackevals / (double)m_evalcount;
+    float score = get_blackevals() / m_evalcount;
     if (tomove == FastBoard::WHITE) {
         score = 1.0f - score;
     }
@@ -472,11 +654,11 @@ float UCTNode::get_eval(int tomove) const {
 }
 
 double UCTNode::get_blackevals() const {
-    return m_blackevals;
+    return from_sum(m_blackevals);
 }
 
 void UCTNode::set_blackevals(double blackevals) {
-    m_blackevals = blackevals;
+    m_blackevals = to_sum(blackevals);
 }
 
 void UCTNode::set_evalcount(int evalcount) {
@@ -493,15 +675,15 @@ int UCTNode::get_evalcount() const {
 }
 
 bool UCTNode::has_eval_propagated() const {
-    return m_eval_propagated;
+    return get_flag(EVAL_PROPAGATED);
 }
 
 void UCTNode::set_eval_propagated() {
-    m_eval_propagated = true;
+    set_flag(EVAL_PROPAGATED);
 }
 
 void UCTNode::accumulate_eval(float eval) {
-    atomic_add(m_blackevals, (double)eval);
+    m_blackevals += to_sum(eval);
     m_evalcount  += 1;
 }
 
@@ -544,46 +726,38 @@ UCTNode* UCTNode::uct_select_child(int color, bool use_nets) {
     UCTNode * best = NULL;
     float best_value = -1000.0f;
     int childbound;
-    int parentvisits = 1; // XXX: this can be 0 now that we sqrt
     float best_probability = 0.0f;
 
     LOCK(get_mutex(), lock);
+    // Pruned from under us
+    if (m_firstchild == UCTNodePool::NONE) {
+        return nullptr;
+    }
+    // Every simulation through here, including those that went down
+    // children invalidated since, or came in through the TT.
+    const int parentvisits = std::max(1, get_visits());
     if (has_netscore()) {
         childbound = 35;
     } else {
         if (use_nets) {
             childbound = cfg_rave_moves;
         } else {
-            childbound = std::max(2, (int)(((log((double)get_visits()) - 3.0) * 3.0) + 2.0));
+            childbound = std::max(2, (int)(((fast_log(parentvisits) - 3.0) * 3.0) + 2.0));
         }
     }
 
-    int childcount = 0;
-    UCTNode * child = m_firstchild;
-
-    // count parentvisits
-    // XXX: wtf do we count this??? don't we know?
-    // make sure we are at a valid successor
-    while (child != NULL && !child->valid()) {
-        child = child->m_nextsibling;
-    }
-    while (child != NULL && childcount < childbound) {
-        parentvisits      += child->get_visits();
-        child = child->m_nextsibling;
-        // make sure we are at a valid successor
-        while (child != NULL && !child->valid()) {
-            child = child->m_nextsibling;
-        }
-        childcount++;
-    }
-    float numerator = std::log((float)parentvisits);
+    const float numerator = fast_log(parentvisits);
+    const float sqrt_parent = fast_sqrt(parentvisits);
+    // sqrt(log(N) / N) and sqrt(log(N))
+    const float explore = std::sqrt(numerator) / sqrt_parent;
+    const float sqrt_numerator = std::sqrt(numerator);
 
     float cutoff_ratio;
-    childcount = 0;
-    child = m_firstchild;
+    int childcount = 0;
+    UCTNode * child = get_first_child();
     // make sure we are at a valid successor
     while (child != NULL && !child->valid()) {
-        child = child->m_nextsibling;
+        child = child->get_sibling();
     }
     if (has_netscore()) {
         // first move
@@ -608,8 +782,8 @@ UCTNode* UCTNode::uct_select_child(int color, bool use_nets) {
                 float psa = child->get_score();
                 float denom = 1.0f + child->get_visits();
 
-                float mti = (cfg_psa / psa) * std::sqrt(numerator / parentvisits);
-                float puct = cfg_puct * psa * ((float)std::sqrt(parentvisits) / denom);
+                float mti = (cfg_psa / psa) * explore;
+                float puct = cfg_puct * psa * (sqrt_parent / denom);
                 // float cts = cfg_puct * std::sqrt(numerator / denom);
                 // Alternate is to remove psa in puct but without log(parentvis)
 
@@ -620,33 +794,36 @@ UCTNode* UCTNode::uct_select_child(int color, bool use_nets) {
                 float psa = child->get_score();
                 float mti;
                 if (parentvisits > 1) {
-                    mti = (cfg_psa / psa) * std::sqrt(numerator / parentvisits);
+                    mti = (cfg_psa / psa) * explore;
                 } else {
                     mti = (cfg_psa / psa);
                 }
 
-                value = winrate - mti + cfg_puct * psa * (float)std::sqrt(parentvisits);
+                value = winrate - mti + cfg_puct * psa * sqrt_parent;
                 assert(value > -1000.0f);
             }
         } else {
             float uctvalue;
             float patternbonus;
-            assert(child->get_ravevisits() > 0);
-            if (!child->first_visit()) {
+            const int move = child->get_move();
+            const int visits = child->get_visits();
+            assert(get_ravevisits(move) > 0);
+            if (visits > 0) {
                 // "UCT" part
                 float winrate = child->get_mixed_score(color);
                 winrate += smp_noise();
-                uctvalue = winrate + cfg_uct * std::sqrt(numerator / child->get_visits());
-                patternbonus = sqrtf((child->get_score() * cfg_patternbonus) / child->get_visits());
+                float sqrt_visits = fast_sqrt(visits);
+                uctvalue = winrate + cfg_uct * sqrt_numerator / sqrt_visits;
+                patternbonus = std::sqrt(child->get_score() * cfg_patternbonus) / sqrt_visits;
             } else {
                 uctvalue = 1.1f;
-                patternbonus = sqrtf(child->get_score() * cfg_patternbonus);
+                patternbonus = std::sqrt(child->get_score() * cfg_patternbonus);
             }
 
             // RAVE part
-            float ravewinrate = child->get_raverate();
+            float ravewinrate = get_raverate(move);
             float ravevalue = ravewinrate + patternbonus;
-            float beta = std::max(0.0, 1.0 - log(1.0 + child->get_visits()) / cfg_beta);
+            float beta = std::max(0.0f, 1.0f - fast_log(1 + visits) / cfg_beta);
 
             value = beta * ravevalue + (1.0f - beta) * uctvalue;
             assert(value > -1000.0f);
@@ -658,10 +835,10 @@ UCTNode* UCTNode::uct_select_child(int color, bool use_nets) {
             best = child;
         }
 
-        child = child->m_nextsibling;
+        child = child->get_sibling();
         // make sure we are at a valid successor
         while (child != NULL && !child->valid()) {
-            child = child->m_nextsibling;
+            child = child->get_sibling();
         }
         childcount++;
     }
@@ -671,6 +848,59 @@ UCTNode* UCTNode::uct_select_child(int color, bool use_nets) {
     return best;
 }
 
+void UCTNode::select_benchmark(FastState & state) {
+    const int iterations = 1000000;
+    const int parentvisits = 100000;
+    const int color = state.get_to_move();
+    const int movenum = state.board.get_stone_count();
+    std::atomic<int> nodecount{0};
+
+    // Net priors falling off like a typical policy output
+    Network::Netresult netlist;
+    for (int i = 0; i < state.board.get_empty(); i++) {
+        int vertex = state.board.get_empty_vertex(i);
+        netlist.emplace_back(0.5f / (i + 1), vertex);
+    }
+
+    UCTNode rave_node(FastBoard::PASS, 0.0f, 1, 1, movenum);
+    rave_node.create_children(nodecount, state, true, false);
+    UCTNode net_node(FastBoard::PASS, 0.0f, 1, 1, movenum);
+    net_node.scoring_cb(&nodecount, state, netlist, true);
+
+    for (auto node : { &rave_node, &net_node }) {
+        if (!node->has_children()) {
+            myprintf("No moves to select from.\n");
+            return;
+        }
+        // Visits spread out like after a search
+        node->set_visits(parentvisits);
+        int i = 0;
+        for (auto child = node->get_first_child(); child != nullptr;
+             child = child->get_sibling(), i++) {
+            int visits = parentvisits / (2 * (i + 1) * (i + 1));
+            child->set_visits(visits);
+            child->set_blackwins(visits * 0.5);
+        }
+    }
+
+    for (auto use_nets : { false, true }) {
+        UCTNode & node = use_nets ? net_node : rave_node;
+        UCTNode * best = nullptr;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            best = node.uct_select_child(color, use_nets);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            end - start).count();
+        myprintf("%s selection: %d in %5.2f ms -> %5.1f ns per node (best %d)\n",
+                 use_nets ? "PUCT" : "RAVE", iterations, ns / 1e6,
+                 (double)ns / iterations, best->get_move());
+    }
+}
+
 class NodeComp : public std::binary_function<UCTNode::sortnode_t, UCTNode::sortnode_t, bool> {   
 private:
     const int m_maxvisits;
@@ -731,93 +961,136 @@ public:
 */
 void UCTNode::sort_children() {
     assert(get_mutex().is_held());
-    std::vector<std::tuple<float, UCTNode*>> tmp;
+    std::vector<std::tuple<float, index_t>> tmp;
 
-    UCTNode * child = m_firstchild;
+    index_t index = m_firstchild;
 
-    while (child != nullptr) {
-        tmp.push_back(std::make_tuple(child->get_score(), child));
-        child = child->m_nextsibling;
+    while (index != UCTNodePool::NONE) {
+        UCTNode * child = UCTNodePool::get(index);
+        tmp.push_back(std::make_tuple(child->get_score(), index));
+        index = child->m_nextsibling;
     }
 
     std::sort(tmp.begin(), tmp.end());
 
-    m_firstchild = nullptr;
+    m_firstchild = UCTNodePool::NONE;
 
     for (auto it = tmp.begin(); it != tmp.end(); ++it) {
         link_child(std::get<1>(*it));
     }
 }
 
+int UCTNode::subtree_size(bool & busy, int & tablecount) const {
+    int size = 0;
+    UCTNode * child = get_first_child();
+
+    while (child != nullptr) {
+        busy |= child->get_flag(IS_NETSCORING);
+        if (child->m_rave != nullptr) {
+            tablecount++;
+        }
+        size += 1 + child->subtree_size(busy, tablecount);
+        child = child->get_sibling();
+    }
+
+    return size;
+}
+
+UCTNode::index_t UCTNode::detach_children(int & nodecount, int & tablecount) {
+    LOCK(get_mutex(), lock);
+    nodecount = 0;
+    tablecount = 0;
+
+    if (!has_children() || get_flag(IS_NETSCORING)) {
+        return UCTNodePool::NONE;
+    }
+    bool busy = false;
+    int tables = 0;
+    int size = subtree_size(busy, tables);
+    if (busy) {
+        return UCTNodePool::NONE;
+    }
+
+    index_t first = m_firstchild;
+    m_firstchild = UCTNodePool::NONE;
+    m_symmetries_done = 0;
+    set_flag(HAS_CHILDREN | HAS_NETSCORE | IS_EXPANDING, false);
+    nodecount = size;
+    tablecount = tables;
+
+    return first;
+}
+
 void UCTNode::sort_root_children(int color) {
     LOCK(get_mutex(), lock);
     std::vector<sortnode_t> tmp;
 
-    UCTNode * child = m_firstchild;
+    index_t index = m_firstchild;
     int maxvisits = 0;
 
-    while (child != nullptr) {
+    while (index != UCTNodePool::NONE) {
+        UCTNode * child = UCTNodePool::get(index);
         int visits = child->get_visits();
         if (visits) {
             float winrate = child->get_mixed_score(color);
-            tmp.push_back(std::make_tuple(winrate, visits, child));
+            tmp.push_back(std::make_tuple(winrate, visits, child, index));
         } else {
-            tmp.push_back(std::make_tuple(0.0f, 0, child));
+            tmp.push_back(std::make_tuple(0.0f, 0, child, index));
         }
         maxvisits = std::max(maxvisits, visits);
-        child = child->m_nextsibling;
+        index = child->m_nextsibling;
     }
 
     // reverse sort, because list reconstruction is backwards
     std::stable_sort(tmp.rbegin(), tmp.rend(), NodeComp(maxvisits));
 
-    m_firstchild = nullptr;
+    m_firstchild = UCTNodePool::NONE;
 
     for (auto it = tmp.begin(); it != tmp.end(); ++it) {
-        link_child(std::get<2>(*it));
+        link_child(std::get<3>(*it));
     }
 }
 
 UCTNode* UCTNode::get_first_child() const {
-    return m_firstchild;
+    return UCTNodePool::get(m_firstchild);
 }
 
 UCTNode* UCTNode::get_sibling() const {
-    return m_nextsibling;
+    return UCTNodePool::get(m_nextsibling);
 }
 
 UCTNode* UCTNode::get_pass_child() const {
-    UCTNode * child = m_firstchild;
+    UCTNode * child = get_first_child();
 
     while (child != nullptr) {
         if (child->m_move == FastBoard::PASS) {
             return child;
         }
-        child = child->m_nextsibling;
+        child = child->get_sibling();
     }
 
     return nullptr;
 }
 
 UCTNode* UCTNode::get_nopass_child() const {
-    UCTNode * child = m_firstchild;
+    UCTNode * child = get_first_child();
 
     while (child != NULL) {
         if (child->m_move != FastBoard::PASS) {
             return child;
         }
-        child = child->m_nextsibling;
+        child = child->get_sibling();
     }
 
     return nullptr;
 }
 
 void UCTNode::invalidate() {
-    m_valid = false;
+    set_flag(VALID, false);
 }
 
 bool UCTNode::valid() const {
-    return m_valid;
+    return get_flag(VALID);
 }
 
 // unsafe in SMP, we don't know if people hold pointers to the 
@@ -826,66 +1099,71 @@ void UCTNode::delete_child(UCTNode * del_child) {
     LOCK(get_mutex(), lock);
     assert(del_child != NULL);
 
-    if (del_child == m_firstchild) {           
-        m_firstchild = m_firstchild->m_nextsibling; 
-        delete del_child;       
-        return;
-    } else {
-        UCTNode * child = m_firstchild;    
-        UCTNode * prev  = NULL;
-    
-        do {
-            prev  = child;            
-            child = child->m_nextsibling;
-            
-            if (child == del_child) {                
-                prev->m_nextsibling = child->m_nextsibling;
-                delete del_child;
-                return;
-            }                                    
-        } while (child != NULL);     
-    }         
-
-    assert(0 && "Child to delete not found");           
-}
+    index_t * link = &m_firstchild;
 
-// update siblings with matching RAVE info
-void UCTNode::updateRAVE(Playout & playout, int color) {
-    float score = playout.get_score();
+    while (*link != UCTNodePool::NONE) {
+        UCTNode * child = UCTNodePool::get(*link);
 
-    LOCK(get_mutex(), lock);
-    // siblings
-    UCTNode * child = m_firstchild;
-
-    while (child != NULL) {
-        int move = child->get_move();
-
-        if (color == FastBoard::BLACK) {
-            bool bpass = playout.passthrough(FastBoard::BLACK, move);
+        if (child == del_child) {
+            index_t index = *link;
+            *link = child->m_nextsibling;
+            UCTNodePool::release(index);
+            return;
+        }
+        link = &child->m_nextsibling;
+    }
 
-            if (bpass) {
-                child->m_ravevisits++;
+    assert(0 && "Child to delete not found");
+}
 
-                if (score > 0.0f) {
-                    atomic_add(child->m_ravestmwins, 1.0 + 0.05 * score);
-                } else if (score == 0.0f) {
-                    atomic_add(child->m_ravestmwins, 0.5);
-                }
-            }
-        } else {
-            bool wpass = playout.passthrough(FastBoard::WHITE, move);
+void UCTNode::rave_add(RaveEntry & entry, int visits, float wins) {
+    if (entry.m_visits.load(std::memory_order_relaxed) >= RAVE_MAX_VISITS) {
+        return;
+    }
+    entry.m_visits.fetch_add(visits, std::memory_order_relaxed);
+    if (wins > 0.0f) {
+        entry.m_wins.fetch_add((uint32)(wins * RAVE_ONE + 0.5f),
+                               std::memory_order_relaxed);
+    }
+}
 
-            if (wpass) {
-                child->m_ravevisits++;
+/*
+    Credit the moves color played first in the playouts, and the move
+    the simulation took from here, which the children would have been
+    given as tree visits.
+*/
+void UCTNode::updateRAVE(Playout & playout, int color, int treemove) {
+    RaveEntry * table = m_rave.load(std::memory_order_acquire);
+    if (table == nullptr) {
+        return;
+    }
+    const int runs = playout.get_runs();
+    int treevisits = 0;
+    float treewins = 0.0f;
+
+    for (int run = 0; run < runs; run++) {
+        // prefer winning with more territory
+        float score = playout.get_score(run);
+        if (color == FastBoard::WHITE) {
+            score = -score;
+        }
+        float wins = 0.0f;
+        if (score > 0.0f) {
+            wins = 1.0f + 0.05f * score;
+        }
+        treevisits++;
+        treewins += wins;
+        if (score == 0.0f) {
+            wins = 0.5f;
+        }
 
-                if (score < 0.0f) {
-                    atomic_add(child->m_ravestmwins, 1.0 + 0.05 * -score);
-                } else if (score == 0.0f) {
-                    atomic_add(child->m_ravestmwins, 0.5);
-                }
-            }
+        const Playout::amaf_t & amaf = playout.get_amaf(run);
+        for (int i = 0; i < amaf.m_count[color]; i++) {
+            rave_add(table[amaf.m_moves[color][i]], 1, wins);
         }
+    }
 
-        child = child->m_nextsibling;
+    if (treemove != FastBoard::RESIGN) {
+        rave_add(table[rave_slot(treemove)], treevisits, treewins);
     }
 }
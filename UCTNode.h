@@ -5,6 +5,9 @@
 
 #include <tuple>
 #include <atomic>
+#include <array>
+#include <mutex>
+#include <vector>
 
 #include "SMP.h"
 #include "GameState.h"
@@ -13,7 +16,9 @@
 
 class UCTNode {
 public:
-    typedef std::tuple<float, int, UCTNode*> sortnode_t;
+    // nodes refer to their children by index into UCTNodePool
+    using index_t = uint32;
+    typedef std::tuple<float, int, UCTNode*, index_t> sortnode_t;
 
     UCTNode(int vertex, float score,
             int expand_threshold, int netscore_threshold,
@@ -22,12 +27,18 @@ public:
     bool first_visit() const;
     bool has_children() const;
     float get_winrate(int tomove) const;
-    float get_raverate() const;
+    // AMAF statistics of the children, by move
+    float get_raverate(int move) const;
+    int get_ravevisits(int move) const;
+    static size_t get_rave_table_size(int boardsize);
+    static size_t get_rave_memory(int boardsize);
     double get_blackwins() const;
     void create_children(std::atomic<int> & nodecount,
                          FastState & state, bool at_root, bool use_nets);
+    // pending counts the evaluation while it is queued, if any
     void netscore_children(std::atomic<int> & nodecount,
-                           FastState & state, bool at_root);
+                           FastState & state, bool at_root,
+                           std::atomic<int> * pending = nullptr);
     void scoring_cb(std::atomic<int> * nodecount,
                     FastState & state,
                     Network::Netresult & raw_netlist,
@@ -41,13 +52,14 @@ public:
     bool should_netscore() const;
     int get_move() const;
     int get_visits() const;
-    int get_ravevisits() const;
     bool has_netscore() const;
     float get_score() const;
     void set_score(float score);
     float get_eval(int tomove) const;
     float get_mixed_score(int tomove);
     static float score_mix_function(int movenum, float eval, float winrate);
+    // Time uct_select_child with the RAVE and the net formula
+    static void select_benchmark(FastState & state);
     double get_blackevals() const;
     int get_evalcount() const;
     bool has_eval_propagated() const;
@@ -62,8 +74,8 @@ public:
     void set_expand_cnt(int runs);
     void set_eval(float eval);
     void accumulate_eval(float eval);
-    void update(Playout & gameresult, int color, bool update_eval);
-    void updateRAVE(Playout & playout, int color);
+    void update(Playout & gameresult, bool update_eval);
+    void updateRAVE(Playout & playout, int color, int treemove);
 
     UCTNode* uct_select_child(int color, bool use_nets);
     UCTNode* get_first_child() const;
@@ -71,13 +83,52 @@ public:
     UCTNode* get_nopass_child() const;
     UCTNode* get_sibling() const;
 
+    /*
+        Cut off the subtree below this node so it can be expanded
+        again later. Returns the first detached child, the caller
+        releases them once no simulation can be walking them anymore.
+        Nothing is detached while net results for the subtree are
+        still pending. The counts are an estimate, simulations that
+        are still inside can add to the subtree.
+    */
+    index_t detach_children(int & nodecount, int & tablecount);
+
     void sort_root_children(int color);
     void sort_children();
     SMP::Mutex & get_mutex();
 
 private:
+    friend class UCTNodePool;
+
+    /*
+        AMAF statistics are kept by the parent in a flat table indexed
+        by vertex, so a playout updates them without visiting the
+        children or taking the lock. Slot 0 is off the board and holds
+        the pass move. Wins are fixed point, RAVE_ONE to a win.
+    */
+    struct RaveEntry {
+        std::atomic<uint32> m_visits;
+        std::atomic<uint32> m_wins;
+    };
+    static constexpr uint32 RAVE_ONE = 256;
+    // Saturate well before the fixed point wins could overflow
+    static constexpr uint32 RAVE_MAX_VISITS = 1 << 23;
+    static std::atomic<int> s_rave_tables;
+
+    enum : uint8 {
+        HAS_CHILDREN    = 1 << 0,
+        VALID           = 1 << 1,
+        EVAL_PROPAGATED = 1 << 2,
+        IS_EVALUATING   = 1 << 3,
+        IS_EXPANDING    = 1 << 4,
+        HAS_NETSCORE    = 1 << 5,
+        IS_NETSCORING   = 1 << 6
+    };
+
     UCTNode();
-    void link_child(UCTNode * newchild);
+    bool get_flag(uint8 flag) const;
+    void set_flag(uint8 flag, bool value = true);
+    void link_child(index_t newchild);
     void link_nodelist(std::atomic<int> & nodecount,
                        FastBoard & state,
                        Network::Netresult & nodes,
@@ -87,37 +138,106 @@ private:
                          Network::Netresult & nodes,
                          bool all_symmetries);
     float smp_noise();
-    // Tree data
-    std::atomic<bool> m_has_children;
-    UCTNode* m_firstchild;
-    UCTNode* m_nextsibling;
-    // Move
-    int m_move;
+    int subtree_size(bool & busy, int & tablecount) const;
+    void create_rave_table(FastBoard & board);
+    static int rave_slot(int move);
+    static void rave_add(RaveEntry & entry, int visits, float wins);
+
+    /*
+        Win and eval sums are fixed point, SUM_ONE to 1.0. A float
+        stops counting single results once the sum passes 2^24, a
+        64-bit integer is exact for as many visits as an int holds.
+    */
+    static constexpr int64 SUM_ONE = 1 << 16;
+    static int64 to_sum(double value);
+    static double from_sum(int64 sum);
+
+    /*
+        Packed into 56 bytes. The fields read while selecting
+        a child come first.
+    */
     // UCT
-    std::atomic<double> m_blackwins;
     std::atomic<int> m_visits;
-    // RAVE
-    std::atomic<double> m_ravestmwins;
-    std::atomic<int> m_ravevisits;
     // move order
     float m_score;
+    std::atomic<int64> m_blackwins;
+    // RAVE, allocated along with the children
+    std::atomic<RaveEntry*> m_rave;
+    // Tree data, indices into UCTNodePool
+    index_t m_nextsibling;
+    index_t m_firstchild;
     // board eval
-    bool m_eval_propagated;
-    std::atomic<double> m_blackevals;
+    std::atomic<int64> m_blackevals;
     std::atomic<int> m_evalcount;
-    int m_movenum;
-    bool m_is_evaluating;    // mutex
-    // alive (superko)
-    std::atomic<bool> m_valid;
+    // Move
+    int16 m_move;
+    int16 m_movenum;
     // extend node
-    int m_expand_cnt;
-    bool m_is_expanding;
+    uint16 m_expand_cnt;
     // dcnn node
-    bool m_has_netscore;
-    int m_netscore_thresh;
-    int m_symmetries_done;
-    bool m_is_netscoring;
+    uint16 m_netscore_thresh;
+    uint8 m_symmetries_done;
+    std::atomic<uint8> m_flags;
     SMP::Mutex m_nodemutex;
 };
 
+/*
+    All nodes except the root live in chunks of this pool and refer to
+    each other by 32-bit index. Index 0 is never handed out. With --numa
+    every node hands out nodes from chunks placed on its own memory.
+    Threads keep a few free nodes of their own and only take the lock
+    to trade batches of them with the arena.
+*/
+class UCTNodePool {
+public:
+    using index_t = UCTNode::index_t;
+    static constexpr index_t NONE = 0;
+
+    static index_t create(int vertex, float score,
+                          int expand_threshold, int netscore_threshold,
+                          int movenum);
+    // Destroys the node and its subtree, returns how many nodes went
+    static int release(index_t index);
+    // Same for the node and all of its later siblings
+    static int release_siblings(index_t first);
+    static UCTNode * get(index_t index);
+
+private:
+    static constexpr int CHUNK_BITS = 16;
+    static constexpr index_t CHUNK_MASK = (1 << CHUNK_BITS) - 1;
+    static constexpr int MAX_CHUNKS = 1 << 12;
+    static constexpr int MAX_ARENAS = 8;
+    // Nodes moved between a thread and its arena at a time
+    static constexpr size_t BATCH = 256;
+
+    struct Arena {
+        // rest of the chunk being handed out
+        index_t m_next{0};
+        index_t m_end{0};
+        std::vector<index_t> m_free;
+    };
+    // Free nodes of one thread, all from the same arena
+    struct Cache {
+        ~Cache();
+        void refill(int arena_id);
+        void spill(size_t count);
+        int m_arena{-1};
+        std::vector<index_t> m_free;
+    };
+    static Cache & thread_cache();
+
+    static std::array<UCTNode *, MAX_CHUNKS> s_chunks;
+    static std::array<uint8, MAX_CHUNKS> s_chunk_arena;
+    static std::array<Arena, MAX_ARENAS> s_arenas;
+    static int s_chunks_used;
+    static std::mutex s_mutex;
+};
+
+inline UCTNode * UCTNodePool::get(index_t index) {
+    if (index == NONE) {
+        return nullptr;
+    }
+    return &s_chunks[index >> CHUNK_BITS][index & CHUNK_MASK];
+}
+
 #endif
@@ -7,6 +7,7 @@
 #include <utility>
 #include <thread>
 #include <algorithm>
+#include <chrono>
 
 #include "FastBoard.h"
 #include "UCTSearch.h"
@@ -18,6 +19,8 @@
 #include "Network.h"
 #include "GTP.h"
 #include "Book.h"
+#include "SearchProfiler.h"
+#include "SearchTrace.h"
 #ifdef USE_OPENCL
 #include "OpenCL.h"
 #endif
@@ -28,13 +31,32 @@ UCTSearch::UCTSearch(GameState & g)
     : m_rootstate(g),
       m_root(FastBoard::PASS, 0.0f, 1, 1, g.board.get_stone_count()),
       m_nodes(0),
+      m_epoch(0),
+      m_sim_epoch(new std::atomic<int>[cfg_num_threads]),
+      m_sim_slots(1),
       m_playouts(0),
       m_hasrunflag(false),
       m_runflag(NULL),
       m_analyzing(false),
-      m_quiet(false) {
+      m_quiet(false),
+      m_record_latency(false) {
     set_use_nets(cfg_enable_nets);
     set_playout_limit(cfg_max_playouts);
+
+    // Whatever the tables leave of the budget goes to the tree
+    size_t budget = (size_t)cfg_max_memory * 1024 * 1024;
+    size_t tables = TTable::get_TT()->get_memory_usage()
+                    + sizeof(MCOwnerTable);
+    m_max_tree = budget > tables ? budget - tables : 0;
+    m_prune_tree = (size_t)(m_max_tree * PRUNE_START);
+    m_prune_share = PRUNE_SHARE;
+
+    for (int i = 0; i < cfg_num_threads; i++) {
+        m_sim_epoch[i] = 0;
+    }
+    for (auto & pending : m_pending_evals) {
+        pending = 0;
+    }
     if (m_use_nets) {
         cfg_uct = 0.085f;
         cfg_beta = 42.5;
@@ -76,19 +98,194 @@ void UCTSearch::set_use_nets(bool flag) {
     }
 }
 
-Playout UCTSearch::play_simulation(KoState & currstate, UCTNode* const node) {
+UCTSearch::~UCTSearch() {
+    free_retired(true);
+}
+
+/*
+    Called by every searching thread before it starts walking down
+    from the root, so pruned subtrees know when they can be freed.
+*/
+int UCTSearch::enter_simulation(int slot) {
+    int epoch = m_epoch.load();
+    m_sim_epoch[slot] = epoch;
+    return epoch;
+}
+
+void UCTSearch::simulate(int slot) {
+    auto start = std::chrono::steady_clock::now();
+    KoState currstate = m_rootstate;
+    int epoch = enter_simulation(slot);
+    Playout result;
+    {
+        TRACE_SCOPE("simulation");
+        result = play_simulation(currstate, &m_root, epoch);
+    }
+    increment_playouts(result.get_runs());
+    if (m_record_latency) {
+        auto end = std::chrono::steady_clock::now();
+        m_latencies[slot].push_back(
+            std::chrono::duration<float, std::micro>(end - start).count());
+    }
+}
+
+size_t UCTSearch::get_tree_memory() const {
+    return m_nodes * sizeof(UCTNode)
+           + UCTNode::get_rave_memory(m_rootstate.board.get_boardsize());
+}
+
+size_t UCTSearch::get_memory_usage() const {
+    return get_tree_memory()
+           + TTable::get_TT()->get_memory_usage()
+           + sizeof(MCOwnerTable);
+}
+
+/*
+    Run from the main search thread between its own simulations.
+*/
+void UCTSearch::manage_memory() {
+    if (!m_retired.empty()) {
+        free_retired(false);
+        // What's left still counts until it is freed
+        if (!m_retired.empty()) {
+            return;
+        }
+    }
+    if (get_tree_memory() > m_prune_tree) {
+        prune_tree();
+    }
+}
+
+void UCTSearch::collect_prunable(UCTNode * node, float share,
+                                 std::vector<std::pair<int, UCTNode*>> & prunable) {
+    std::vector<UCTNode*> children;
+    {
+        LOCK(node->get_mutex(), lock);
+        UCTNode * child = node->get_first_child();
+        while (child != nullptr) {
+            children.push_back(child);
+            child = child->get_sibling();
+        }
+    }
+
+    const float parentvisits = std::max(1, node->get_visits());
+    for (auto child : children) {
+        if (!child->has_children()) {
+            continue;
+        }
+        if (child->get_visits() < parentvisits * share) {
+            // Take the whole subtree, don't look inside
+            prunable.emplace_back(child->get_visits(), child);
+        } else {
+            collect_prunable(child, share, prunable);
+        }
+    }
+}
+
+void UCTSearch::prune_tree() {
+    TRACE_SCOPE("prune");
+    std::vector<std::pair<int, UCTNode*>> prunable;
+    collect_prunable(&m_root, m_prune_share, prunable);
+
+    // Least visited subtrees go first
+    std::sort(prunable.begin(), prunable.end(),
+              [](const std::pair<int, UCTNode*> & a,
+                 const std::pair<int, UCTNode*> & b) {
+                  return a.first < b.first;
+              });
+
+    const size_t usage = get_tree_memory();
+    const size_t target = usage - (size_t)(m_max_tree * PRUNE_TARGET);
+    const size_t table_size =
+        UCTNode::get_rave_table_size(m_rootstate.board.get_boardsize());
+    const int epoch = m_epoch;
+    size_t freed = 0;
+    for (auto & entry : prunable) {
+        if (freed >= target) {
+            break;
+        }
+        int nodecount, tablecount;
+        auto first = entry.second->detach_children(nodecount, tablecount);
+        if (first != UCTNodePool::NONE) {
+            // m_nodes goes down once they are really released
+            m_retired.emplace_back(epoch, first);
+            freed += nodecount * sizeof(UCTNode) + tablecount * table_size;
+        }
+    }
+    // Simulations starting from here on can't reach what we cut off
+    m_epoch++;
+
+    if (freed >= target) {
+        m_prune_tree = (size_t)(m_max_tree * PRUNE_START);
+    } else {
+        // Not enough to cut, be less picky once the tree grew some more
+        m_prune_share = std::min(0.5f, m_prune_share * 2.0f);
+        m_prune_tree = usage - freed + m_max_tree / 64;
+    }
+}
+
+void UCTSearch::free_retired(bool all) {
+    int oldest = INT_MAX;
+    if (!all) {
+        // Slots past m_sim_slots have no thread searching with them
+        for (int i = 0; i < m_sim_slots; i++) {
+            oldest = std::min(oldest, m_sim_epoch[i].load());
+        }
+    }
+
+    // Nothing can add to these anymore, so this count is exact
+    int released = 0;
+    auto keep = m_retired.begin();
+    for (auto it = m_retired.begin(); it != m_retired.end(); ++it) {
+        if (it->first < oldest && (all || !evals_pending(it->first))) {
+            released += UCTNodePool::release_siblings(it->second);
+        } else {
+            *keep++ = *it;
+        }
+    }
+    m_retired.erase(keep, m_retired.end());
+    m_nodes -= released;
+
+    if (!m_quiet && !all && released) {
+        myprintf("Pruned %d nodes, tree uses %d MiB.\n", released,
+                 (int)(get_memory_usage() / (1024 * 1024)));
+    }
+}
+
+/*
+    Whether a policy net evaluation queued in epoch or before it
+    hasn't called back yet. Looks at a whole lap of the ring,
+    so older epochs sharing a counter are covered.
+*/
+bool UCTSearch::evals_pending(int epoch) const {
+    for (int i = std::max(0, epoch - EPOCH_RING + 1); i <= epoch; i++) {
+        if (m_pending_evals[i % EPOCH_RING].load() > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Playout UCTSearch::play_simulation(KoState & currstate, UCTNode* const node,
+                                   int epoch) {
     const int color = currstate.get_to_move();
     const uint64 hash = currstate.board.get_hash();
     const float komi = currstate.get_komi();
     Playout noderesult;
     bool update_eval = true;
 
-    TTable::get_TT()->sync(hash, komi, node);
+    {
+        PROFILE_SCOPE(TT_SYNC);
+        TTable::get_TT()->sync(hash, komi, node);
+    }
 
     if (m_use_nets
         && !node->get_evalcount()
         && node->get_visits() > cfg_eval_thresh) {
-        node->run_value_net(currstate);
+        {
+            PROFILE_SCOPE(VALUE_NET);
+            node->run_value_net(currstate);
+        }
 
         LOCK(node->get_mutex(), lock);
         // Check whether we have new evals to back up
@@ -104,7 +301,9 @@ Playout UCTSearch::play_simulation(KoState & currstate, UCTNode* const node) {
 
     if (!node->has_children()
         && node->should_expand()
-        && m_nodes < MAX_TREE_SIZE) {
+        && get_tree_memory() < m_max_tree) {
+        PROFILE_SCOPE(EXPAND);
+        TRACE_SCOPE("expand");
         node->create_children(m_nodes, currstate, false, m_use_nets);
     }
     // This can happen at the same time as the previous one if this
@@ -112,11 +311,20 @@ Playout UCTSearch::play_simulation(KoState & currstate, UCTNode* const node) {
     if (m_use_nets
         && node->has_children()
         && node->should_netscore()) {
-        node->netscore_children(m_nodes, currstate, false);
+        PROFILE_SCOPE(NETSCORE);
+        TRACE_SCOPE("netscore");
+        node->netscore_children(m_nodes, currstate, false,
+                                &m_pending_evals[epoch % EPOCH_RING]);
     }
 
     if (node->has_children()) {
-        UCTNode * next = node->uct_select_child(color, m_use_nets);
+        UCTNode * next;
+        {
+            PROFILE_SCOPE(SELECT);
+            next = node->uct_select_child(color, m_use_nets);
+        }
+        // the move we went down, if any
+        int treemove = FastBoard::RESIGN;
 
         if (next != NULL) {
             int move = next->get_move();
@@ -125,29 +333,69 @@ Playout UCTSearch::play_simulation(KoState & currstate, UCTNode* const node) {
                 currstate.play_move(move);
 
                 if (!currstate.superko()) {
-                    noderesult = play_simulation(currstate, next);
+                    noderesult = play_simulation(currstate, next, epoch);
+                    treemove = move;
                 } else {
                     next->invalidate();
-                    noderesult.run(currstate, false, true);
+                    run_leaf_playouts(currstate, noderesult);
                 }
             } else {
                 currstate.play_pass();
-                noderesult = play_simulation(currstate, next);
+                noderesult = play_simulation(currstate, next, epoch);
+                treemove = move;
             }
         } else {
-            noderesult.run(currstate, false, true);
+            run_leaf_playouts(currstate, noderesult);
         }
-        node->updateRAVE(noderesult, color);
+        PROFILE_SCOPE(RAVE);
+        node->updateRAVE(noderesult, color, treemove);
     } else {
-        noderesult.run(currstate, false, true);
+        run_leaf_playouts(currstate, noderesult);
     }
 
-    node->update(noderesult, color, update_eval);
-    TTable::get_TT()->update(hash, komi, node);
+    {
+        PROFILE_SCOPE(BACKUP);
+        node->update(noderesult, update_eval);
+    }
+    {
+        PROFILE_SCOPE(TT_UPDATE);
+        TTable::get_TT()->update(hash, komi, node);
+    }
 
     return noderesult;
 }
 
+/*
+    Play the configured number of games from a leaf. Any games beyond
+    the first are handed to the thread pool, and the results are
+    merged so they back up through the tree as one update.
+*/
+void UCTSearch::run_leaf_playouts(KoState & state, Playout & result) {
+    PROFILE_SCOPE(PLAYOUT);
+    const int runs = m_use_nets ? 1 : cfg_leaf_playouts;
+    if (runs == 1) {
+        result.run(state, false, true);
+        return;
+    }
+
+    const FastState leaf = state;
+    std::vector<Playout> extra(runs - 1);
+    auto extra_run = [&extra, &leaf](int i) {
+        FastState tmp = leaf;
+        extra[i].run(tmp, false, true);
+    };
+
+    // Any thread left over, including this one, picks these up
+    ThreadGroup tg(thread_pool);
+    tg.run(extra_run, extra.size());
+    result.run(state, false, true);
+    tg.wait_all();
+
+    for (const auto & playout : extra) {
+        result.merge(playout);
+    }
+}
+
 void UCTSearch::dump_GUI_stats(GameState & state, UCTNode & parent) {
 #ifndef _CONSOLE
     const int color = state.get_to_move();
@@ -268,8 +516,8 @@ void UCTSearch::dump_stats(KoState & state, UCTNode & parent) {
                         tmp.c_str(),
                         node->get_visits(),
                         node->get_visits() > 0 ? node->get_winrate(color)*100.0f : 0.0f,
-                        node->get_visits() > 0 ? node->get_raverate()*100.0f : 0.0f,
-                        node->get_ravevisits(),
+                        node->get_visits() > 0 ? parent.get_raverate(node->get_move())*100.0f : 0.0f,
+                        parent.get_ravevisits(node->get_move()),
                         node->get_score() * 100.0f);
         } else {
             myprintf("%4s -> %7d (W: %5.2f%%) (U: %5.2f%%) (V: %5.2f%%: %6d) (N: %4.1f%%) PV: ",
@@ -409,8 +657,14 @@ bool UCTSearch::allow_easy_move() {
     return false;
 }
 
-bool UCTSearch::allow_early_exit() {
-    if (!m_root.has_children()) {
+/*
+    Stop once the runner up can't overtake the best move in the time
+    that is left. That is when it couldn't catch up in visits even if
+    it got every remaining playout, or when the confidence bounds on
+    the winrates say it is worse, so it won't get most of them.
+*/
+bool UCTSearch::allow_early_exit(int elapsed_centis, int time_for_move) {
+    if (!m_root.has_children() || elapsed_centis <= 0) {
         return false;
     }
 
@@ -419,29 +673,32 @@ bool UCTSearch::allow_early_exit() {
 
     // do we have statistics on the moves?
     UCTNode * first = m_root.get_first_child();
-    if (first != NULL) {
-        if (first->first_visit()) {
-            return false;
-        }
-    } else {
+    if (first == NULL || first->first_visit()) {
         return false;
     }
 
     UCTNode * second = first->get_sibling();
-    if (second != NULL) {
-        if (second->first_visit()) {
-            // Stil not visited? Seems unlikely to happen then.
-            return true;
-        }
-    } else {
-        // We have a first move, but no sibling, after
-        // already searching half the time
+    if (second == NULL) {
+        myprintf("Allowing early exit: only move\n");
         return true;
     }
 
+    // Playouts we can still expect at the rate measured so far
+    double remaining = (double)m_playouts
+                       * (time_for_move - elapsed_centis) / elapsed_centis;
+
     double n1 = first->get_visits();
-    double p1 = first->get_mixed_score(color);
     double n2 = second->get_visits();
+    if (n1 - n2 > remaining) {
+        myprintf("Allowing early exit: lead %d > %d playouts left\n",
+                 (int)(n1 - n2), (int)remaining);
+        return true;
+    }
+    if (second->first_visit()) {
+        return false;
+    }
+
+    double p1 = first->get_mixed_score(color);
     double p2 = second->get_mixed_score(color);
     double low, high;
 
@@ -455,10 +712,6 @@ bool UCTSearch::allow_early_exit() {
         myprintf("Allowing early exit: low: %f%% > high: %f%%\n", low * 100.0f, high * 100.0f);
         return true;
     }
-    if (p1 < 0.10 || p1 > 0.95) {
-        myprintf("Allowing early exit: score: %f%%\n", p1 * 100.0f);
-        return true;
-    }
 
     return false;
 }
@@ -776,11 +1029,9 @@ bool UCTSearch::stop_thinking(int elapsed_centis, int time_for_move) const {
            || elapsed_centis >= time_for_move;
 }
 
-void UCTWorker::operator()() {
+void UCTWorker::operator()(int slot) {
     do {
-        KoState currstate = m_rootstate;
-        m_search->play_simulation(currstate, m_root);
-        m_search->increment_playouts();
+        m_search->simulate(slot);
     } while(m_search->is_running() && !m_search->playout_limit_reached());
 #ifdef USE_OPENCL
     opencl.join_outstanding_cb();
@@ -811,8 +1062,24 @@ std::tuple<float, float, float> UCTSearch::get_scores() {
     return std::make_tuple(bestscore, bestmc, bestvn);
 }
 
-void UCTSearch::increment_playouts() {
-    m_playouts++;
+void UCTSearch::increment_playouts(int playouts) {
+    m_playouts += playouts;
+}
+
+int UCTSearch::get_playouts() const {
+    return m_playouts;
+}
+
+int UCTSearch::get_node_count() const {
+    return m_nodes;
+}
+
+std::vector<float> UCTSearch::get_latencies() const {
+    std::vector<float> all;
+    for (auto & slot : m_latencies) {
+        all.insert(end(all), begin(slot), end(slot));
+    }
+    return all;
 }
 
 int UCTSearch::think(int color, passflag_t passflag) {
@@ -831,6 +1098,10 @@ int UCTSearch::think(int color, passflag_t passflag) {
         time_for_move = m_rootstate.get_timecontrol().max_time_for_move(color);
 
         GUIprintf("Thinking at most %.1f seconds...", time_for_move/100.0f);
+        if (cfg_deterministic) {
+            // the clock would make every run different
+            time_for_move = INT_MAX;
+        }
 #ifdef KGS
         if (m_rootstate.get_handicap() > 3
             || m_rootstate.get_komi() < 0.0f
@@ -847,6 +1118,8 @@ int UCTSearch::think(int color, passflag_t passflag) {
             }
         }
 #endif
+        // A book move keeps the saved time for later
+        m_rootstate.get_timecontrol().use_carryover(color);
     } else {
         time_for_move = INT_MAX;
         GUIprintf("Thinking...");
@@ -880,24 +1153,36 @@ int UCTSearch::think(int color, passflag_t passflag) {
 
     m_run = true;
     m_playouts = 0;
+#ifdef SMP_LOCK_STATS
+    SMP::reset_lock_stats();
+#endif
+    PROFILE_RESET();
+    SearchTrace::start_search();
 
     int cpus = cfg_num_threads;
-    ThreadGroup tg(thread_pool);
-    for (int i = 1; i < cpus; i++) {
-        tg.add_task(UCTWorker(m_rootstate, this, &m_root));
+    if (!m_use_nets) {
+        // Leave those threads free to help with leaf playouts
+        cpus -= cfg_leaf_threads;
     }
+    m_sim_slots = cpus;
+    UCTWorker worker(this);
+    auto worker_run = [&worker](int i) {
+        // slot 0 is ours
+        worker(i + 1);
+    };
+    ThreadGroup tg(thread_pool);
+    tg.run(worker_run, cpus - 1);
 
     // If easy move precondition doesn't hold, pretend we
     // checked (and failed).
     bool easy_move_tested = !easy_move_precondition();
     bool keeprunning = true;
+    bool stopped_early = false;
     int last_update = 0;
     auto last_output = 0;
     do {
-        KoState currstate = m_rootstate;
-
-        play_simulation(currstate, &m_root);
-        increment_playouts();
+        simulate(0);
+        manage_memory();
 
         Time elapsed;
         int centiseconds_elapsed = Time::timediff(start, elapsed);
@@ -921,17 +1206,17 @@ int UCTSearch::think(int color, passflag_t passflag) {
             keeprunning = (!m_hasrunflag || (*m_runflag));
             keeprunning &= !stop_thinking(centiseconds_elapsed, time_for_move);
 
-            // check for early exit
+            // check for early exit, once the playout rate is known
             if (keeprunning && ((m_playouts & 127) == 0)) {
-                if (centiseconds_elapsed > time_for_move/5) {
-                    if (!easy_move_tested) {
-                        keeprunning &= !allow_easy_move();
-                        easy_move_tested = true;
-                    }
-                    if (centiseconds_elapsed > time_for_move/3) {
-                         keeprunning &= !allow_early_exit();
-                    }
+                if (centiseconds_elapsed > time_for_move/5 && !easy_move_tested) {
+                    stopped_early = allow_easy_move();
+                    easy_move_tested = true;
+                }
+                if (!stopped_early && centiseconds_elapsed > time_for_move/10) {
+                    stopped_early = allow_early_exit(centiseconds_elapsed,
+                                                     time_for_move);
                 }
+                keeprunning &= !stopped_early;
             }
         } else {
             if (centiseconds_elapsed - last_update > 100) {
@@ -949,6 +1234,14 @@ int UCTSearch::think(int color, passflag_t passflag) {
     opencl.join_outstanding_cb();
 #endif
     tg.wait_all();
+    free_retired(true);
+    PROFILE_COLLECT();
+    SearchTrace::finish_search();
+#ifdef SMP_LOCK_STATS
+    if (!m_quiet) {
+        SMP::dump_lock_stats();
+    }
+#endif
     if (!m_root.has_children()) {
         return FastBoard::PASS;
     }
@@ -1000,6 +1293,17 @@ int UCTSearch::think(int color, passflag_t passflag) {
 
     Time elapsed;
     int centiseconds_elapsed = Time::timediff(start, elapsed);
+    if (!m_analyzing) {
+        int saved = 0;
+        TimeControl & tc = m_rootstate.get_timecontrol();
+        if (stopped_early) {
+            saved = std::max(0, time_for_move - centiseconds_elapsed);
+            tc.add_carryover(color, saved);
+        }
+        myprintf("\nTime: used %.2fs of %.2fs, saved %.2fs, %.2fs carried over\n",
+                 centiseconds_elapsed / 100.0f, time_for_move / 100.0f,
+                 saved / 100.0f, tc.get_carryover(color) / 100.0f);
+    }
     if (centiseconds_elapsed > 0) {
         myprintf("\n%d visits, %d nodes, %d playouts, %d p/s\n\n",
                  m_root.get_visits(),
@@ -1029,17 +1333,27 @@ void UCTSearch::ponder() {
 #ifdef USE_SEARCH
     m_run = true;
     m_playouts = 0;
+#ifdef SMP_LOCK_STATS
+    SMP::reset_lock_stats();
+#endif
     Time start;
     auto last_output = 0;
     int cpus = cfg_num_threads;
-    ThreadGroup tg(thread_pool);
-    for (int i = 1; i < cpus; i++) {
-        tg.add_task(UCTWorker(m_rootstate, this, &m_root));
+    if (!m_use_nets) {
+        // Leave those threads free to help with leaf playouts
+        cpus -= cfg_leaf_threads;
     }
+    m_sim_slots = cpus;
+    UCTWorker worker(this);
+    auto worker_run = [&worker](int i) {
+        // slot 0 is ours
+        worker(i + 1);
+    };
+    ThreadGroup tg(thread_pool);
+    tg.run(worker_run, cpus - 1);
     do {
-        KoState currstate = m_rootstate;
-        play_simulation(currstate, &m_root);
-        increment_playouts();
+        simulate(0);
+        manage_memory();
         // imported from Leela Zero 0.17
         if (cfg_analyze_tags.interval_centis()) {
             Time elapsed;
@@ -1057,6 +1371,12 @@ void UCTSearch::ponder() {
     opencl.join_outstanding_cb();
 #endif
     tg.wait_all();
+    free_retired(true);
+#ifdef SMP_LOCK_STATS
+    if (!m_quiet) {
+        SMP::dump_lock_stats();
+    }
+#endif
     // display search info
     myprintf("\n");
     dump_stats(m_rootstate, m_root);
@@ -1081,3 +1401,11 @@ void UCTSearch::set_analyzing(bool flag) {
 void UCTSearch::set_quiet(bool flag) {
     m_quiet = flag;
 }
+
+void UCTSearch::set_record_latency(bool flag) {
+    m_record_latency = flag;
+    m_latencies.clear();
+    if (flag) {
+        m_latencies.resize(cfg_num_threads);
+    }
+}
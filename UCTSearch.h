@@ -1,9 +1,12 @@
 #ifndef UCTSEARCH_H_INCLUDED
 #define UCTSEARCH_H_INCLUDED
 
+#include <array>
 #include <memory>
 #include <atomic>
 #include <tuple>
+#include <vector>
+#include <utility>
 
 #include "GameState.h"
 #include "UCTNode.h"
@@ -22,25 +25,43 @@ public:
     static const passflag_t NORESIGN = 1 << 1;
 
     /*
-        Maximum size of the tree in memory.
+        Once the tree fills this much of its memory budget, subtrees
+        with less than PRUNE_SHARE of their parent's visits are cut
+        back until it is down to PRUNE_TARGET. If that isn't enough
+        the share is raised for the next pass.
     */
-    static constexpr int MAX_TREE_SIZE = 10000000;
+    static constexpr float PRUNE_START = 0.9f;
+    static constexpr float PRUNE_TARGET = 0.75f;
+    static constexpr float PRUNE_SHARE = 0.02f;
 
     UCTSearch(GameState & g);
+    ~UCTSearch();
     int think(int color, passflag_t passflag = NORMAL);
     void set_playout_limit(int playouts);
     void set_use_nets(bool usenets);
     void set_runflag(std::atomic<bool> * flag);
     void set_analyzing(bool flag);
     void set_quiet(bool flag);
+    // Keep the duration of every simulation, for benchmarks
+    void set_record_latency(bool flag);
     void ponder();
     bool is_running();
     bool playout_limit_reached();
-    void increment_playouts();
-    Playout play_simulation(KoState & currstate, UCTNode * const node);
+    void increment_playouts(int playouts = 1);
+    // Returns the epoch the simulation runs in
+    int enter_simulation(int slot);
+    // One walk from the root, by the searching thread in slot
+    void simulate(int slot);
+    Playout play_simulation(KoState & currstate, UCTNode * const node,
+                            int epoch);
     std::tuple<float, float, float> get_scores();
+    int get_playouts() const;
+    int get_node_count() const;
+    // Simulation durations in microseconds, of all threads
+    std::vector<float> get_latencies() const;
 
 private:
+    void run_leaf_playouts(KoState & state, Playout & result);
     void dump_stats(KoState & state, UCTNode & parent);
     void dump_GUI_stats(GameState & state, UCTNode & parent);
     std::string get_pv(KoState & state, UCTNode & parent);
@@ -51,14 +72,44 @@ private:
     int get_best_move(passflag_t passflag);
     int get_best_move_nosearch(std::vector<std::pair<float, int>> moves,
                                float score, passflag_t passflag);
-    bool allow_early_exit();
+    bool allow_early_exit(int elapsed_centis, int time_for_move);
     bool allow_easy_move();
     bool easy_move_precondition();
     void output_analysis(GameState & state, UCTNode & parent);
+    size_t get_memory_usage() const;
+    size_t get_tree_memory() const;
+    void manage_memory();
+    void prune_tree();
+    void collect_prunable(UCTNode * node, float share,
+                          std::vector<std::pair<int, UCTNode*>> & prunable);
+    void free_retired(bool all);
+    bool evals_pending(int epoch) const;
 
     GameState & m_rootstate;
     UCTNode m_root;
     std::atomic<int> m_nodes;
+    // tree budget in bytes, nodes and their RAVE tables
+    size_t m_max_tree;
+    size_t m_prune_tree;
+    float m_prune_share;
+
+    // Subtrees cut off by pruning, with the epoch they were cut in.
+    // Freed once every searching thread started a newer simulation
+    // and the evaluations queued from that epoch called back.
+    std::vector<std::pair<int, UCTNode::index_t>> m_retired;
+    std::atomic<int> m_epoch;
+    std::unique_ptr<std::atomic<int>[]> m_sim_epoch;
+    // Slots of m_sim_epoch the running search uses, the rest are idle
+    int m_sim_slots;
+    /*
+        Policy net evaluations still queued, by the epoch of the
+        simulation that queued them. Their callbacks write into the
+        tree, so they hold back retired subtrees like the simulations
+        do. Epochs share counters modulo EPOCH_RING, which can only
+        make a count too high.
+    */
+    static constexpr int EPOCH_RING = 64;
+    std::array<std::atomic<int>, EPOCH_RING> m_pending_evals;
     std::atomic<int> m_playouts;
     std::atomic<bool> m_run;
     int m_maxplayouts;
@@ -71,17 +122,17 @@ private:
     bool m_use_nets;
     bool m_analyzing;
     bool m_quiet;
+    bool m_record_latency;
+    // one list per thread slot
+    std::vector<std::vector<float>> m_latencies;
 };
 
 class UCTWorker {
 public:
-    UCTWorker(GameState & state, UCTSearch * search, UCTNode * root)
-      : m_rootstate(state), m_search(search), m_root(root) {};
-    void operator()();
+    UCTWorker(UCTSearch * search) : m_search(search) {};
+    void operator()(int slot);
 private:
-    GameState & m_rootstate;
     UCTSearch * m_search;
-    UCTNode * m_root;
 };
 
 #endif
@@ -7,10 +7,21 @@
 #include <stdarg.h>
 #include <thread>
 #include <mutex>
+#include <cmath>
 #ifdef WIN32
 #include <windows.h>
+#include <direct.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
 #else
 #include <sys/select.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <climits>
+#endif
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
 #endif
 
 #include "Utils.h"
@@ -18,6 +29,21 @@
 
 Utils::ThreadPool thread_pool;
 
+float Utils::log_table[VISIT_TABLE_SIZE];
+float Utils::sqrt_table[VISIT_TABLE_SIZE];
+
+static struct VisitTableInit {
+    VisitTableInit() {
+        // log(0) is never asked for
+        Utils::log_table[0] = 0.0f;
+        Utils::sqrt_table[0] = 0.0f;
+        for (int i = 1; i < Utils::VISIT_TABLE_SIZE; i++) {
+            Utils::log_table[i] = std::log((float)i);
+            Utils::sqrt_table[i] = std::sqrt((float)i);
+        }
+    }
+} visit_table_init;
+
 bool Utils::input_causes_stop() {
     return true;
 }
@@ -242,3 +268,83 @@ void Utils::log_input(std::string input) {
     }
 #endif
 }
+
+size_t Utils::get_peak_memory() {
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+std::string Utils::get_cache_path(const std::string & name) {
+    if (cfg_cache_dir.empty()) {
+        return "";
+    }
+    // Make every missing directory along the path
+    for (size_t pos = 1; pos <= cfg_cache_dir.size(); pos++) {
+        if (pos == cfg_cache_dir.size()
+            || cfg_cache_dir[pos] == '/' || cfg_cache_dir[pos] == '\\') {
+            std::string dir = cfg_cache_dir.substr(0, pos);
+#ifdef WIN32
+            _mkdir(dir.c_str());
+#else
+            mkdir(dir.c_str(), 0755);
+#endif
+        }
+    }
+    return cfg_cache_dir + "/" + name;
+}
+
+uint64 Utils::fnv1a(const void * data, size_t size, uint64 hash) {
+    auto bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string Utils::get_executable_dir(const char * argv0) {
+    std::string path;
+#ifdef WIN32
+    char buff[MAX_PATH];
+    DWORD len = GetModuleFileNameA(NULL, buff, sizeof(buff));
+    if (len > 0 && len < sizeof(buff)) {
+        path.assign(buff, len);
+    }
+#elif defined(__APPLE__)
+    char buff[PATH_MAX];
+    uint32_t size = sizeof(buff);
+    if (_NSGetExecutablePath(buff, &size) == 0) {
+        path = buff;
+    }
+#elif defined(__linux__)
+    char buff[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", buff, sizeof(buff));
+    if (len > 0 && len < (ssize_t)sizeof(buff)) {
+        path.assign(buff, len);
+    }
+#endif
+    if (path.empty() && argv0 != nullptr) {
+        path = argv0;
+    }
+
+    auto slash = path.find_last_of("/\\");
+    if (slash == std::string::npos) {
+        return "";
+    }
+    return path.substr(0, slash + 1);
+}
@@ -37,6 +37,23 @@ namespace Utils {
     void log_input(std::string input);
     bool input_pending();
     bool input_causes_stop();
+    // Largest resident set of the process so far, in bytes
+    size_t get_peak_memory();
+    /*
+        Where a cache file called name goes, creating the directory
+        if needed. Empty when caching is off.
+    */
+    std::string get_cache_path(const std::string & name);
+    /*
+        Directory of the running executable, with a trailing separator.
+        Found through the OS, so it works when started from $PATH.
+        Falls back to the directory part of argv0.
+    */
+    std::string get_executable_dir(const char * argv0);
+
+    // FNV-1a, for checksums of tables and files
+    constexpr uint64 FNV_OFFSET = 0xcbf29ce484222325ULL;
+    uint64 fnv1a(const void * data, size_t size, uint64 hash = FNV_OFFSET);
 
     template<class T>
     void atomic_add(std::atomic<T> &f, T d) {
@@ -44,6 +61,33 @@ namespace Utils {
         while (!f.compare_exchange_weak(old, old + d));
     }
 
+    /*
+        log and sqrt of visit counts, which the tree search takes for
+        every child it looks at. Counts below VISIT_TABLE_SIZE come from
+        tables, larger ones are shifted down into their range first.
+    */
+    constexpr int VISIT_TABLE_SIZE = 1 << 12;
+    extern float log_table[VISIT_TABLE_SIZE];
+    extern float sqrt_table[VISIT_TABLE_SIZE];
+
+    inline float fast_log(int x) {
+        int shift = 0;
+        while (x >= VISIT_TABLE_SIZE) {
+            x >>= 1;
+            shift++;
+        }
+        return log_table[x] + shift * 0.69314718f;
+    }
+
+    inline float fast_sqrt(int x) {
+        int scale = 1;
+        while (x >= VISIT_TABLE_SIZE) {
+            x >>= 2;
+            scale <<= 1;
+        }
+        return sqrt_table[x] * scale;
+    }
+
     template<class T>
     bool is_aligned(T* ptr, size_t alignment) {
         return (uintptr_t(ptr) & (alignment - 1)) == 0;
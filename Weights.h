@@ -1,5334 +0,0 @@
-std::array<double, 110> internal_weights = { {
-0.247502,
-0.53654,
-0.840366,
-1.07029,
-1.08584,
-1.12097,
-0.935879,
-0.911372,
-0.976673,
-1.11632,
-0.845717,
-0.947717,
-1.03109,
-1.14597,
-1.28094,
-1.46708,
-1.64066,
-6.77389,
-7.3244,
-13.0834,
-18.8928,
-0.738059,
-1.69322,
-1.83926,
-2.92978,
-2.04135,
-0.802093,
-0.63031,
-2.31337,
-1.26386,
-1.10441,
-0.968453,
-1.03174,
-1.03361,
-3.41002,
-1.72428,
-0.898603,
-0.500523,
-0.475731,
-0.445787,
-0.814612,
-7.96028,
-2.26805,
-3.07216,
-4.02244,
-0.924824,
-2.51789,
-7.85382,
-0.0924487,
-2.38167,
-1.99822,
-3.52567,
-2.13816,
-1.45704,
-0.962269,
-0.837179,
-0.768853,
-1.32536,
-1.37702,
-1.0646,
-0.947798,
-0.671975,
-1.64417,
-1.15037,
-1.09435,
-0.18686,
-428.718,
-1.37896,
-1.55034,
-1.60835,
-1.09134,
-0.764886,
-0.7585,
-0.569211,
-0.698755,
-8.56649,
-4.75319,
-3.19842,
-3.9142,
-2.43945,
-2.13524,
-1.63133,
-1.3635,
-1.1695,
-0.984175,
-0.884126,
-0.789039,
-0.693148,
-0.615211,
-0.607057,
-0.428604,
-2.2375,
-2.12237,
-1.67053,
-1.49644,
-1.20673,
-1.17389,
-1.02362,
-1.0364,
-0.993678,
-0.955545,
-0.932712,
-0.896019,
-0.85821,
-0.834751,
-0.835812,
-0.748266,
-0.155432,
-1.31846,
-2.05524
-} };
-
-std::array<int, 2608> internal_patterns = { {
-11184810,
-11184895,
-11184811,
-6990591,
-2796287,
-11185151,
-6990506,
-2796202,
-10922666,
-10660522,
-10136234,
-9087658,
-11251711,
-10136235,
-9087659,
-6990507,
-2796203,
-10922667,
-11185067,
-10660523,
-10136319,
-9087743,
-5942015,
-699135,
-16777215,
-5941930,
-699050,
-5941931,
-1747626,
-6986410,
-4893354,
-699051,
-2788010,
-1747711,
-4631295,
-4893439,
-1223423,
-9022122,
-10135210,
-2792106,
-1485567,
-6982314,
-9022123,
-9085610,
-4369151,
-10660506,
-6990490,
-371455,
-4303615,
-2796170,
-10922751,
-1485482,
-2779818,
-6990442,
-10070698,
-4369066,
-10660607,
-2796074,
-8956586,
-5679871,
-174847,
-1485483,
-4369067,
-6990847,
-9874090,
-10134186,
-9086634,
-2796543,
-8825599,
-9612031,
-8563370,
-9874091,
-8563371,
-6728362,
-6728447,
-2271999,
-2271914,
-10136575,
-9087999,
-10922650,
-2534058,
-5679786,
-1419946,
-174762,
-10660490,
-6466218,
-6990762,
-4237994,
-5417727,
-2796458,
-436991,
-1419947,
-4237995,
-4631211,
-2534143,
-2796138,
-6990378,
-1223339,
-6466303,
-2796201,
-1420031,
-4238079,
-9874175,
-5876479,
-8563455,
-568063,
-6974122,
-2763434,
-10918570,
-6986666,
-10070699,
-10652330,
-2796186,
-6990474,
-4893355,
-2788266,
-1747627,
-8956587,
-9611947,
-8825515,
-6990505,
-10203135,
-4303531,
-371371,
-2529962,
-9154559,
-4565759,
-1746602,
-109311,
-2796200,
-5942186,
-6458026,
-10656426,
-6724266,
-9607850,
-4891306,
-699306,
-2263722,
-6008750,
-765870,
-5679787,
-174763,
-6728363,
-8559274,
-2271915,
-10136491,
-6990763,
-9087915,
-2796459,
-8825514,
-1403562,
-4631210,
-5417642,
-674346,
-1485226,
-5937834,
-9611946,
-1731242,
-2771498,
-682666,
-350890,
-690858,
-1198634,
-435967,
-436906,
-5415679,
-1219242,
-1223338,
-633599,
-5941866,
-6981290,
-4827903,
-4623018,
-698922,
-5925631,
-2786986,
-1485738,
-666367,
-4369322,
-1747562,
-10070783,
-4893226,
-2791082,
-10922922,
-4893610,
-6974123,
-8956671,
-1747882,
-6980266,
-5925547,
-5942271,
-2763435,
-4892330,
-1403563,
-5352191,
-699391,
-674602,
-9022207,
-10660778,
-666283,
-367274,
-5663402,
-1745578,
-5941914,
-305919,
-350891,
-141994,
-6711978,
-367359,
-5614335,
-699018,
-4301482,
-1198890,
-7057326,
-4827819,
-5941929,
-4627199,
-43775,
-633515,
-9022118,
-4301567,
-10135211,
-2239146,
-1215231,
-699048,
-2863022,
-8956522,
-9085611,
-6724351,
-6466219,
-1469098,
-2263807,
-2534059,
-5417643,
-4303530,
-1484458,
-674474,
-367275,
-1485227,
-5876394,
-6990698,
-5925546,
-5938090,
-1485481,
-2771754,
-4367018,
-5413546,
-691114,
-567978,
-2796330,
-4627114,
-2796041,
-666282,
-4301483,
-371370,
-436907,
-6008831,
-4762283,
-4827818,
-1682091,
-1743530,
-765951,
-5876395,
-428714,
-4893611,
-4885162,
-1747883,
-10656427,
-633514,
-567979,
-5939882,
-2517674,
-2771626,
-1485823,
-10656682,
-1215146,
-175019,
-5680043,
-8760063,
-4369407,
-2775722,
-9022106,
-1207039,
-2255530,
-698026,
-6982570,
-5941802,
-8497919,
-745390,
-698986,
-9874346,
-2792362,
-1747610,
-5940906,
-8563626,
-9022090,
-5860095,
-1469354,
-4893322,
-1485466,
-4631551,
-5942187,
-6728346,
-697002,
-535295,
-1223679,
-4876970,
-674475,
-6974207,
-10070666,
-1485418,
-4369034,
-699307,
-1747625,
-1714858,
-9087654,
-6728298,
-2530218,
-4368938,
-2271882,
-6986346,
-5663487,
-2763519,
-5941674,
-2796073,
-10918655,
-6458282,
-142079,
-8956570,
-2787882,
-10652415,
-2271786,
-698538,
-1469099,
-674730,
-10918571,
-4631194,
-8956518,
-4302507,
-9607834,
-6728361,
-363179,
-8759979,
-1747967,
-4893695,
-4500223,
-1157887,
-10652331,
-8497835,
-8557226,
-2271912,
-1223306,
-5663403,
-682667,
-6720170,
-5680042,
-1747370,
-2267818,
-1731498,
-367258,
-10923007,
-141995,
-4221610,
-175018,
-1387178,
-4893290,
-6986411,
-9874026,
-1682175,
-1485739,
-4301450,
-4302506,
-1403647,
-6986394,
-4369323,
-2779690,
-6711979,
-5942122,
-10660863,
-2534314,
-4762367,
-363178,
-2788011,
-334442,
-8821503,
-5614251,
-741166,
-6990426,
-8563242,
-699178,
-2787978,
-8821418,
-2239147,
-4301218,
-43691,
-9874058,
-6466474,
-4885418,
-4827786,
-2778794,
-2534399,
-432810,
-1747498,
-633498,
-2796042,
-4293003,
-5679785,
-5409450,
-1743786,
-8563354,
-6973098,
-6466559,
-2779786,
-4623014,
-9603839,
-1746603,
-174760,
-7057407,
-9874431,
-6008751,
-1219234,
-5663658,
-8563711,
-4893098,
-765871,
-4891307,
-2792105,
-2761386,
-142250,
-5606143,
-39679,
-1552302,
-2863103,
-6000558,
-158463,
-2779754,
-1747114,
-10134170,
-432895,
-2788009,
-1793966,
-2796137,
-9607851,
-761774,
-698794,
-6466186,
-8825498,
-2534042,
-699049,
-5933738,
-4435886,
-1452714,
-9605802,
-5409535,
-5937835,
-4352682,
-1219226,
-694954,
-4827814,
-9874074,
-9603754,
-690859,
-4622986,
-9611930,
-8559530,
-4762282,
-1419945,
-1219243,
-5941898,
-8559258,
-2792090,
-4623019,
-1682090,
-633386,
-1469183,
-6466090,
-8563338,
-9085594,
-699034,
-1677994,
-6982282,
-2796033,
-2533994,
-334490,
-1731327,
-5679722,
-2786970,
-10656410,
-2513578,
-749486,
-4301194,
-4754090,
-1198762,
-741294,
-6981258,
-8825855,
-2247338,
-8892415,
-371354,
-6990374,
-9874347,
-5397162,
-5614250,
-174634,
-2774698,
-416426,
-8563627,
-4627370,
-5941675,
-2779802,
-6990438,
-4302591,
-6449834,
-1727146,
-1419882,
-158378,
-9611914,
-137898,
-9612287,
-2796070,
-43690,
-8825482,
-2501290,
-2777770,
-4303498,
-6985386,
-6986602,
-9678847,
-10651306,
-2255498,
-698539,
-5680127,
-4237866,
-363263,
-4893338,
-5860010,
-6986409,
-4565675,
-1215402,
-2788138,
-175103,
-8821419,
-9808639,
-2796066,
-109227,
-350634,
-4631402,
-535210,
-4893353,
-5671594,
-2785962,
-674376,
-5941926,
-8432383,
-1198763,
-1747594,
-2788008,
-4892202,
-10922923,
-5746606,
-8825450,
-5872298,
-2530047,
-9611882,
-8820394,
-431786,
-6728703,
-1745514,
-4631146,
-1223466,
-4303359,
-1477546,
-4301227,
-1747624,
-5679530,
-6724522,
-338687,
-2272255,
-1730218,
-2796169,
-241582,
-4365226,
-10660779,
-559786,
-6458111,
-682751,
-6466202,
-170666,
-699042,
-174250,
-2534057,
-9086618,
-2263978,
-682634,
-1485478,
-416682,
-5407402,
-2534026,
-5409706,
-1403498,
-5679770,
-1223210,
-9601706,
-10134154,
-2779819,
-4213419,
-543274,
-1383083,
-4369058,
-1665706,
-174730,
-1219327,
-334507,
-1798062,
-1485674,
-4960174,
-4610730,
-8825386,
-4610731,
-2517930,
-9808555,
-1742506,
-4623103,
-682538,
-2771627,
-9603755,
-8825771,
-4623002,
-6986406,
-4369194,
-4237930,
-8432299,
-1182379,
-4883114,
-1419818,
-1219210,
-9021098,
-5407487,
-4893546,
-2796134,
-4630271,
-5730222,
-1814446,
-2780074,
-1182378,
-6986378,
-433066,
-6990370,
-1411754,
-350874,
-1221375,
-1485450,
-9808554,
-1747754,
-5417626,
-8825706,
-4627115,
-1196586,
-208814,
-8563306,
-4233898,
-415402,
-6004654,
-2788002,
-6728330,
-2787994,
-9612203,
-8432298,
-1677995,
-4368810,
-9020074,
-9086635,
-6008686,
-2792102,
-10070634,
-6466346,
-4561663,
-4369050,
-1484202,
-1198730,
-765742,
-2534250,
-4754091,
-757678,
-1481386,
-2271898,
-4892266,
-6982306,
-1484543,
-2247210,
-9674751,
-5860011,
-1484970,
-2779817,
-10136230,
-10134187,
-436874,
-4627050,
-8626175,
-2779814,
-4367103,
-1746346,
-4360874,
-1469034,
-107263,
-535211,
-5597867,
-2763178,
-1485480,
-8956458,
-1745450,
-4621994,
-543402,
-5937770,
-4369065,
-5659391,
-1419914,
-1484459,
-1196683,
-4893482,
-1215018,
-367018,
-2779810,
-5937919,
-4237978,
-2255402,
-1223274,
-1665707,
-133887,
-9020075,
-10923,
-1747818,
-2534315,
-5663338,
-690730,
-4893350,
-2529963,
-1739434,
-1217194,
-6466475,
-1477290,
-6724267,
-5942058,
-4367019,
-6982298,
-5937833,
-1219238,
-9087650,
-141866,
-674378,
-4889258,
-690943,
-4221611,
-1747622,
-682794,
-5597866,
-6458027,
-699242,
-1481642,
-6986314,
-1215147,
-1452650,
-1747618,
-4951982,
-690856,
-4361130,
-1395370,
-1810350,
-2263723,
-4623010,
-2516650,
-10922,
-5352107,
-4631178,
-4631082,
-4352554,
-412202,
-1387179,
-8759978,
-2771594,
-6990634,
-1535918,
-4303514,
-4893346,
-674559,
-6707882,
-1485354,
-4892314,
-1219498,
-2787866,
-4369002,
-9085590,
-2513834,
-5730158,
-2596782,
-4364970,
-2230954,
-6986495,
-363098,
-2792074,
-1223322,
-5597951,
-208686,
-2247339,
-2792042,
-350635,
-8559270,
-5678762,
-4623274,
-9873066,
-1468074,
-1452906,
-6524846,
-1745546,
-674632,
-6973866,
-6982186,
-2788095,
-4496127,
-674442,
-2796394,
-4884138,
-11007,
-4301226,
-7057327,
-8497834,
-2796122,
-4302466,
-6724265,
-4352810,
-404223,
-4876971,
-371338,
-6990346,
-1661610,
-5401343,
-9546495,
-367273,
-1741482,
-334186,
-1727402,
-1714859,
-172714,
-2529961,
-674369,
-8561322,
-2762922,
-1468842,
-5679531,
-2525866,
-4303871,
-1731243,
-1149695,
-2263720,
-4827802,
-158379,
-387839,
-158250,
-682922,
-305835,
-6462122,
-4237993,
-2787977,
-5938026,
-8694527,
-674472,
-1419944,
-4627098,
-1469290,
-174251,
-1746538,
-2786906,
-2787905,
-2863023,
-543403,
-1682026,
-690986,
-745326,
-2786985,
-109055,
-633482,
-367270,
-5936810,
-677546,
-350886,
-9021099,
-334506,
-350889,
-9607846,
-1206922,
-4762154,
-4891178,
-1219241,
-1215114,
-6981250,
-6728234,
-4631209,
-5348010,
-1481471,
-5678847,
-2787930,
-1198626,
-8563562,
-1198122,
-4293002,
-4302474,
-5941922,
-4301354,
-363162,
-688810,
-2271850,
-4360959,
-6972074,
-2787865,
-6986402,
-174506,
-699046,
-5411498,
-2775658,
-678570,
-172799,
-2762410,
-8559266,
-5925290,
-1223336,
-8559359,
-8825770,
-6986250,
-2788006,
-8820395,
-9674670,
-4631466,
-4631467,
-6711962,
-741230,
-427690,
-154282,
-1202858,
-1219137,
-2533930,
-371199,
-363033,
-297642,
-1485610,
-4233983,
-9601707,
-5937818,
-9608106,
-6466154,
-6724607,
-1387114,
-1476351,
-2264063,
-1731178,
-1411839,
-4565674,
-4369258,
-665770,
-4363007,
-690826,
-2255531,
-2239114,
-5407370,
-6982234,
-1403561,
-4302490,
-551594,
-4221695,
-109226,
-1223595,
-2251434,
-1206954,
-2796185,
-2775978,
-5415594,
-4221482,
-5407626,
-1399467,
-5872299,
-5411583,
-673834,
-4545194,
-4352683,
-363146,
-2534056,
-2271913,
-9940991,
-1387263,
-2796106,
-8559275,
-6981274,
-5417610,
-8630271,
-427775,
-559787,
-5679754,
-5941913,
-6466217,
-174761,
-150314,
-6728618,
-4614826,
-174746,
-8755882,
-5413530,
-2796121,
-367210,
-1452715,
-697962,
-106666,
-4435967,
-4301474,
-4435887,
-5663386,
-1552383,
-1452698,
-1552303,
-674410,
-404138,
-5417578,
-4303526,
-6990362,
-4302378,
-699016,
-1747558,
-1403306,
-4827562,
-2272170,
-435882,
-1485417,
-2786954,
-600831,
-363174,
-4827647,
-5876330,
-5939754,
-10070682,
-141962,
-428682,
-674344,
-6707883,
-1399466,
-9022054,
-9606826,
-600746,
-371242,
-4352650,
-5413547,
-431787,
-1747561,
-2791946,
-682602,
-4627113,
-5924522,
-6710954,
-682650,
-4827686,
-633258,
-150058,
-2230955,
-4893218,
-367019,
-371114,
-698889,
-4627306,
-5939818,
-5939866,
-5401258,
-698921,
-8496810,
-1746601,
-1223594,
-5942185,
-1729194,
-5417983,
-567850,
-436778,
-437247,
-5940907,
-8495786,
-6712234,
-8559210,
-633382,
-84522,
-9607935,
-5675946,
-8956454,
-1531822,
-2255514,
-1399338,
-5407403,
-4811434,
-1215274,
-8956554,
-664234,
-412330,
-2779903,
-699304,
-1460906,
-4609706,
-1383082,
-6728554,
-5937578,
-1415935,
-2773674,
-333413,
-7053230,
-1190570,
-8824362,
-174698,
-2239402,
-674666,
-371225,
-697003,
-166826,
-2272042,
-2237098,
-5663401,
-8626094,
-4610815,
-5679658,
-9022058,
-697994,
-541249,
-371115,
-1180330,
-2854830,
-674634,
-4213418,
-4237926,
-150271,
-4565503,
-697898,
-4875946,
-1485210,
-1215144,
-4827690,
-5397163,
-4827563,
-1223233,
-4302442,
-334438,
-1419930,
-1485225,
-5941759,
-8559242,
-1419810,
-141992,
-1182463,
-1403434,
-6711977,
-428715,
-5941794,
-633002,
-138154,
-1747306,
-9609834,
-690346,
-5679978,
-6707967,
-600747,
-608810,
-2788001,
-698982,
-1726122,
-4229887,
-4301090,
-5663146,
-2231039,
-76543,
-2769450,
-6974118,
-6986266,
-4237962,
-633510,
-2517675,
-363170,
-2771882,
-7057262,
-174890,
-158346,
-2239144,
-9874086,
-2761122,
-4293375,
-698623,
-1483946,
-1415850,
-1469226,
-1186474,
-673322,
-1403530,
-5663594,
-9607818,
-142122,
-338586,
-2779682,
-8755883,
-2517658,
-4366762,
-141482,
-1712810,
-10656394,
-2763426,
-8824490,
-608939,
-6449802,
-1484203,
-4303242,
-4229802,
-4348586,
-2862894,
-5679782,
-10989567,
-4293258,
-346795,
-2247466,
-2769578,
-1730986,
-6982310,
-1461034,
-8563362,
-2779562,
-1387177,
-9612202,
-2792089,
-2846638,
-1399551,
-2779649,
-350826,
-5931690,
-1485465,
-436890,
-9022114,
-4221594,
-4623013,
-4545195,
-2600878,
-2501274,
-5417514,
-1468843,
-5331626,
-174754,
-10727423,
-2263721,
-9874282,
-693930,
-412331,
-4302251,
-4610474,
-1485162,
-2792098,
-4622938,
-6981146,
-4615018,
-106914,
-106667,
-2787946,
-4303275,
-6533038,
-4893222,
-350975,
-2271753,
-2779816,
-8558250,
-682664,
-697988,
-1420287,
-9873151,
-1419881,
-4238335,
-1403546,
-2786950,
-1181866,
-5413802,
-9873067,
-137834,
-1219082,
-138090,
-9608107,
-1387146,
-4302250,
-2771490,
-674728,
-1461162,
-8563498,
-216878,
-5938089,
-8495787,
-363158,
-1419880,
-5417898,
-1265454,
-9607786,
-6981254,
-432794,
-4352767,
-6712063,
-630955,
-4302346,
-5352106,
-1465258,
-8559531,
-338603,
-1420202,
-4631078,
-1747554,
-137770,
-2792010,
-1485737,
-1465003,
-1190571,
-4303402,
-672298,
-4614827,
-5925887,
-371306,
-5940650,
-666623,
-428970,
-4237865,
-8561407,
-2786842,
-4626090,
-6008622,
-150187,
-1483947,
-4366763,
-698985,
-8561323,
-6449835,
-698881,
-5941865,
-371366,
-9872042,
-437162,
-1452799,
-1469082,
-765806,
-691112,
-2796297,
-2239231,
-5331627,
-4238250,
-5696170,
-1535854,
-2787914,
-4303522,
-138026,
-1223266,
-8496811,
-8562346,
-4893286,
-2501291,
-150442,
-2796037,
-6986282,
-1387162,
-696490,
-6986665,
-698920,
-541323,
-4615082,
-1747371,
-191146,
-6982170,
-5409418,
-8428202,
-543487,
-2497194,
-6719146,
-6441642,
-672426,
-8559466,
-1468250,
-1745562,
-1485222,
-1419777,
-2775706,
-4565419,
-2528938,
-415403,
-2788264,
-4221578,
-9940910,
-2247423,
-1649322,
-2792107,
-1190826,
-696738,
-613034,
-9609898,
-1743274,
-2796058,
-76459,
-1484457,
-8956506,
-4891050,
-5417641,
-2584494,
-1198986,
-1186410,
-4892298,
-8563302,
-2253482,
-1395242,
-150186,
-6455978,
-613035,
-1465002,
-4626858,
-4287231,
-2775466,
-6990410,
-4745898,
-5413545,
-8630190,
-346666,
-334182,
-2262698,
-2779946,
-5933994,
-5675690,
-4368042,
-10655402,
-543297,
-371369,
-370943,
-695210,
-1207082,
-4217514,
-617130,
-1747490,
-5872383,
-2580398,
-4826795,
-2787969,
-5409578,
-1206826,
-1469355,
-1213098,
-2779658,
-1403393,
-2771562,
-2255528,
-2771711,
-1383167,
-1731114,
-4622762,
-6720166,
-5662378,
-139946,
-4614911,
-1469097,
-674731,
-5671850,
-551679,
-4368778,
-625323,
-1746090,
-1484954,
-607270,
-1219233,
-1403307,
-1739690,
-4302335,
-142251,
-4213503,
-5663659,
-166570,
-4303398,
-5941862,
-559871,
-436904,
-1214634,
-2796105,
-6974379,
-6982315,
-170922,
-1745553,
-1797998,
-1483434,
-4352938,
-4889514,
-1452970,
-371238,
-5335807,
-4622873,
-1190655,
-2796057,
-428712,
-4368937,
-1196682,
-1218730,
-1485416,
-1219144,
-2251430,
-383386,
-5746687,
-204654,
-4237929,
-6458025,
-1419814,
-1199018,
-2267810,
-7049134,
-672331,
-5409451,
-4630954,
-1386922,
-674345,
-241663,
-673962,
-674600,
-433002,
-2763691,
-2529960,
-4623001,
-4877055,
-1484426,
-1448619,
-2267819,
-1485311,
-273151,
-698914,
-4819626,
-698964,
-333418,
-1476266,
-4631065,
-2251426,
-4301449,
-1196554,
-1714943,
-4237862,
-432811,
-1219208,
-5659307,
-367256,
-6004590,
-108287,
-416427,
-383642,
-6981162,
-4557482,
-4344491,
-133803,
-1403426,
-5941850,
-2596783,
-1222826,
-551595,
-4301706,
-4362922,
-4557567,
-5397098,
-2529946,
-350374,
-1731241,
-608806,
-362582,
-2838318,
-4301219,
-334443,
-6458283,
-4960255,
-8892334,
-1223240,
-1747609,
-416666,
-4630186,
-2530219,
-4367002,
-2271785,
-632490,
-6982313,
-108202,
-1731434,
-757550,
-4293026,
-334491,
-2786982,
-6826,
-1485477,
-1814527,
-698010,
-2858926,
-698890,
-6990761,
-682154,
-4631039,
-1501951,
-5940991,
-4285954,
-5939850,
-10918911,
-4892186,
-1198625,
-436842,
-4385535,
-1419817,
-6457994,
-6524847,
-5391018,
-2796456,
-4302470,
-10652671,
-4302342,
-5678506,
-1223337,
-4631066,
-761710,
-6720171,
-4301195,
-4876714,
-1223242,
-6724202,
-1661611,
-5401259,
-1218218,
-5935786,
-1217174,
-4561578,
-172202,
-697087,
-404139,
-1196715,
-191147,
-363030,
-1745482,
-689834,
-6000430,
-563967,
-4622998,
-1222911,
-1218986,
-1221290,
-5696171,
-1747457,
-2529958,
-4621954,
-4561579,
-699009,
-158506,
-436905,
-5876266,
-4285962,
-2792104,
-5343999,
-1714346,
-1743529,
-5876393,
-362646,
-433050,
-2787881,
-5941610,
-1415851,
-346714,
-2263594,
-4620970,
-5348095,
-436650,
-4352666,
-4622870,
-4369062,
-363034,
-4348842,
-1403560,
-1723050,
-5679721,
-674650,
-6458018,
-420522,
-399018,
-1219138,
-8755967,
-1419781,
-1403818,
-5407498,
-5347994,
-4237914,
-2526122,
-363094,
-148297,
-1452682,
-4287146,
-674090,
-1219202,
-698410,
-1419786,
-1485474,
-1452634,
-371201,
-4630955,
-567976,
-191231,
-4369033,
-1451690,
-1186475,
-674394,
-5409674,
-2255466,
-1403499,
-5696255,
-4229803,
-2775562,
-1485464,
-371302,
-633003,
-4352522,
-297610,
-5876735,
-297727,
-362922,
-5606058,
-543530,
-174632,
-360866,
-5348011,
-4811435,
-349350,
-682665,
-1213183,
-567914,
-1403497,
-1745513,
-1747546,
-6441643,
-6462378,
-4627455,
-4302338,
-2791081,
-362923,
-107179,
-5417386,
-2792097,
-5923498,
-107178,
-297643,
-4960175,
-4631206,
-5940905,
-1747366,
-6458154,
-4893289,
-4303394,
-1196074,
-674347,
-1745577,
-4350634,
-2530154,
-1198593,
-540933,
-1730730,
-568319,
-666026,
-2517546,
-2779753,
-4892329,
-697897,
-332901,
-431530,
-350873,
-697000,
-8563290,
-1219240,
-2600959,
-305834,
-4303274,
-1481643,
-4631145,
-367257,
-697770,
-698786,
-532898,
-8495871,
-5413290,
-338602,
-1215487,
-5925291,
-1731210,
-2517610,
-1469338,
-412458,
-625322,
-1222827,
-4361131,
-1419850,
-5677738,
-5938091,
-4303494,
-39594,
-6533119,
-332902,
-672427,
-173738,
-2497195,
-370431,
-4213313,
-73986,
-698025,
-1664682,
-4893194,
-4623017,
-681642,
-5434111,
-5412522,
-633343,
-8759962,
-4826794,
-5413482,
-691115,
-698952,
-2785961,
-4631142,
-1745576,
-5932714,
-4237850,
-170751,
-1814447,
-4295423,
-2263617,
-696746,
-665771,
-665258,
-2792041,
-349797,
-371226,
-108203,
-698984,
-9022086,
-2529898,
-1223330,
-692906,
-1745322,
-4287147,
-4892331,
-4621958,
-4630058,
-350630,
-4893099,
-4627049,
-428586,
-4302505,
-749422,
-2533993,
-1419801,
-1223202,
-1468970,
-1484966,
-1206955,
-543304,
-617114,
-690857,
-1395371,
-1217169,
-2247242,
-2788005,
-1202859,
-4221542,
-1217170,
-4557483,
-6447786,
-436394,
-5678763,
-98699,
-1745579,
-154538,
-1223169,
-5939862,
-5941673,
-633259,
-1729066,
-415146,
-428202,
-6982250,
-10660762,
-301823,
-1747115,
-699017,
-682506,
-426666,
-4221546,
-1221226,
-4292995,
-4892970,
-5663147,
-370859,
-682858,
-349611,
-678826,
-1484330,
-2796069,
-4368802,
-631846,
-2517866,
-2791978,
-5941858,
-5659306,
-4888234,
-608938,
-1743466,
-633513,
-141483,
-1223304,
-4885034,
-690760,
-4631193,
-6728282,
-1403242,
-6980138,
-6457898,
-133802,
-5391019,
-1727082,
-1484969,
-2791018,
-9538303,
-399019,
-172715,
-366251,
-1198728,
-2500266,
-1747050,
-666539,
-5417770,
-6711722,
-8825382,
-629418,
-2779777,
-363176,
-1747621,
-5925803,
-4286986,
-4237829,
-1746600,
-371284,
-6445738,
-370838,
-1731226,
-27306,
-698918,
-6711974,
-4367017,
-1403558,
-696747,
-697986,
-9086630,
-1484456,
-8559206,
-4825770,
-543272,
-4368811,
-349867,
-8690431,
-5868287,
-563882,
-1747354,
-4366954,
-9085606,
-2513579,
-1485337,
-1743531,
-334489,
-2235050,
-8563366,
-2238634,
-435866,
-150344,
-1713834,
-631974,
-4885163,
-8496682,
-698795,
-367002,
-1419802,
-2777706,
-370858,
-8497802,
-698536,
-5397418,
-2247594,
-698778,
-4627110,
-8824575,
-349866,
-8824491,
-4891305,
-674338,
-2247233,
-672330,
-333926,
-435883,
-5671595,
-5941798,
-1198858,
-1465194,
-4293291,
-6457002,
-9609899,
-6457946,
-2271754,
-4874922,
-170667,
-5746607,
-137899,
-4893225,
-1198602,
-6711946,
-92927,
-2524842,
-1747560,
-1219178,
-2730,
-158362,
-8825510,
-5593770,
-1141503,
-680618,
-1737386,
-1747455,
-4827817,
-2239130,
-4237898,
-1452458,
-2780010,
-4284706,
-1726890,
-6724458,
-5670570,
-5415562,
-2777642,
-9609983,
-5868202,
-5393066,
-9605738,
-1223177,
-745262,
-4960046,
-2779750,
-6724170,
-633450,
-694955,
-19115,
-2530217,
-2263850,
-1484971,
-2771497,
-4299519,
-2239138,
-168618,
-4622890,
-241583,
-5671679,
-5679769,
-608858,
-453375,
-366746,
-2512554,
-158376,
-699041,
-682410,
-1814382,
-633512,
-541256,
-2775594,
-4892074,
-350614,
-2775721,
-4885290,
-5678507,
-6981210,
-4631130,
-5413542,
-4827810,
-4286122,
-1196330,
-350872,
-1725098,
-4285066,
-437098,
-1731240,
-2529802,
-1196810,
-2517673,
-4303462,
-1743722,
-1793838,
-106923,
-5415595,
-362914,
-371098,
-2786841,
-2788233,
-1218202,
-365995,
-4614762,
-2238890,
-698978,
-4302210,
-2247306,
-633446,
-10719231,
-4233882,
-4211265,
-5937962,
-2761130,
-1411722,
-8428186,
-1747545,
-416410,
-2263578,
-4352618,
-1219146,
-428706,
-698666,
-1223082,
-1215138,
-1217193,
-631978,
-672362,
-4827682,
-2513770,
-174728,
-1223178,
-1196714,
-4302341,
-4302362,
-10917546,
-1745066,
-4621978,
-5679615,
-629419,
-1481578,
-363142,
-691050,
-1665791,
-2517759,
-174954,
-1467818,
-1481387,
-4823722,
-5679914,
-4620938,
-174633,
-172203,
-71274,
-150346,
-1217162,
-1485673,
-2846510,
-5409322,
-2786946,
-416618,
-174335,
-371234,
-630954,
-674440,
-363028,
-1265422,
-172459,
-350618,
-1452649,
-1485218,
-4500139,
-6458010,
-1382827,
-10650282,
-4544938,
-2787942,
-4622874,
-4360875,
-1198633,
-5939626,
-8497818,
-367209,
-749358,
-8428287,
-1742250,
-2838446,
-633369,
-5352090,
-362666,
-699145,
-10989486,
-2247336,
-2513322,
-5876378,
-366758,
-400042,
-5941786,
-4825771,
-5407371,
-631466,
-1223530,
-8557206,
-8759946,
-4361002,
-4631338,
-432746,
-672328,
-1223265,
-4217515,
-2791080,
-2267786,
-2771242,
-4892294,
-674569,
-1714602,
-148033,
-1745314,
-690753,
-682505,
-2255370,
-2267802,
-349610,
-1485722,
-1383019,
-350378,
-9674606,
-677290,
-150088,
-672329,
-73898,
-1383018,
-1198760,
-1186666,
-6980265,
-4233899,
-369407,
-4303466,
-1485224,
-6449818,
-6004526,
-427691,
-9605786,
-5416618,
-2779689,
-4285958,
-305802,
-2501258,
-8557210,
-1745558,
-1395306,
-4823723,
-6707626,
-5746542,
-437163,
-2534041,
-7053166,
-6986274,
-8825446,
-698970,
-334234,
-1722922,
-4369290,
-2771546,
-6724234,
-1746347,
-1206920,
-757614,
-4292998,
-697990,
-682923,
-5417899,
-1460778,
-1745554,
-241454,
-4237849,
-6986342,
-697514,
-1223252,
-5411499,
-346662,
-346794,
-5941658,
-362518,
-1485338,
-2263706,
-1452394,
-5941770,
-4284970,
-4889259,
-5940842,
-150081,
-567946,
-2513514,
-174694,
-1395234,
-4213290,
-9678766,
-698954,
-5679650,
-1731499,
-416170,
-281130,
-6720154,
-2230442,
-333162,
-1198847,
-1399402,
-1411755,
-2255658,
-8759846,
-6720138,
-1403496,
-74146,
-2271881,
-5411482,
-4892290,
-5937830,
-9869995,
-4301311,
-1747369,
-1484454,
-350825,
-8555179,
-6724250,
-6982442,
-1469066,
-4213291,
-607269,
-5939858,
-1469353,
-428458,
-1746598,
-4827750,
-5409791,
-1793902,
-673450,
-27391,
-172458,
-267866,
-8562330,
-2263577,
-1468778,
-543018,
-366762,
-9021034,
-367206,
-5614186,
-4751962,
-5942170,
-4285098,
-433151,
-6981289,
-5417634,
-1676810,
-4292994,
-1219225,
-1485476,
-6728230,
-1739435,
-427658,
-18986,
-2771489,
-543400,
-1402538,
-698506,
-366250,
-1485414,
-2731,
-1395338,
-1484162,
-4366998,
-2787874,
-698730,
-2763170,
-631467,
-2529930,
-411178,
-2778778,
-2792298,
-2779498,
-5730157,
-6724258,
-674342,
-2854702,
-2774634,
-9611866,
-43562,
-5593771,
-4367010,
-2788202,
-367103,
-673963,
-8562282,
-371353,
-1401514,
-690850,
-434858,
-2255615,
-1403466,
-168703,
-1468075,
-4303529,
-1196809,
-8497830,
-1729962,
-2778730,
-10727342,
-8497702,
-1747497,
-1747617,
-5933739,
-4237861,
-1484418,
-5663337,
-4301346,
-2786984,
-1216930,
-2263718,
-2263690,
-633378,
-2271782,
-633428,
-1452713,
-2267814,
-9872010,
-4237913,
-8759850,
-5670655,
-1448618,
-2786922,
-9022102,
-4891298,
-363029,
-1217178,
-1411750,
-350868,
-2787913,
-4621962,
-6974463,
-2771624,
-333157,
-4369057,
-2517418,
-4233890,
-354986,
-696874,
-367014,
-6986538,
-8956490,
-699274,
-4368930,
-4368970,
-2771625,
-542250,
-2779746,
-141978,
-4293290,
-1403554,
-674314,
-5663370,
-4811418,
-174474,
-9021066,
-674330,
-6985322,
-698792,
-1469033,
-2501034,
-2777738,
-1206785,
-108037,
-6456063,
-8563298,
-5671578,
-350804,
-6728619,
-2247274,
-2785834,
-76458,
-4368998,
-682632,
-1196618,
-541258,
-2271749,
-141864,
-366998,
-208684,
-1196322,
-4565418,
-4827754,
-1202943,
-1157803,
-2533978,
-5940902,
-8453,
-9605803,
-5937817,
-2763775,
-5859839,
-5390986,
-698762,
-1731238,
-674698,
-2770474,
-741198,
-2779657,
-611494,
-8559514,
-1213066,
-10918827,
-432809,
-4626091,
-4893034,
-1463978,
-9873034,
-8563226,
-1660586,
-6466058,
-4238251,
-141738,
-174676,
-6791086,
-1485402,
-4631401,
-2272171,
-696994,
-6973094,
-4630187,
-532906,
-2792191,
-8821759,
-1465087,
-6720426,
-174758,
-543306,
-1484422,
-6720162,
-4892201,
-690824,
-5595903,
-158218,
-4287018,
-1196609,
-2842542,
-2771530,
-221102,
-8563238,
-284314,
-1217195,
-5941925,
-1485346,
-8558234,
-432554,
-5415530,
-1387174,
-1420203,
-350362,
-1218970,
-370854,
-2775657,
-371290,
-4344490,
-674633,
-4893321,
-141930,
-4631129,
-435626,
-2245194,
-4366994,
-9605782,
-1213099,
-267610,
-9983,
-355071,
-4754082,
-698027,
-6986650,
-1196585,
-150154,
-4282026,
-1810351,
-4221609,
-1677990,
-4951854,
-1747608,
-4893210,
-2792001,
-4951983,
-6974114,
-2513577,
-361899,
-2773514,
-1119850,
-5680041,
-4621995,
-534783,
-2330542,
-2763430,
-350548,
-632970,
-150362,
-2236842,
-2517642,
-5614249,
-371368,
-5343914,
-4614810,
-8755866,
-175016,
-1746536,
-2268074,
-4883113,
-682658,
-1745512
-} };
-
-std::array<double, 2608> internal_patweights = { {
-0.564767,
-0.00289212,
-0.0374317,
-0.0514899,
-0.00739935,
-0.00264856,
-1.64941,
-1.81659,
-0.417523,
-0.0617707,
-1.03007,
-0.481053,
-0.000196618,
-0.31234,
-0.0946012,
-0.843889,
-0.259294,
-0.242291,
-0.00469701,
-0.0683604,
-0.00414685,
-0.0237935,
-0.0883796,
-0.293262,
-5.7515,
-1.51529,
-1.37886,
-0.349914,
-1.28922,
-0.315824,
-0.446568,
-0.336796,
-0.128124,
-0.0607948,
-0.974583,
-0.0489628,
-0.225653,
-1.12202,
-0.5245,
-1.43792,
-0.0106537,
-0.310851,
-0.632727,
-0.0358147,
-0.00736879,
-0.113117,
-0.534526,
-0.814652,
-0.167487,
-0.0380744,
-0.0121512,
-0.0155776,
-4.38314,
-1.42706,
-2.31056,
-0.00417863,
-0.00520621,
-0.584096,
-0.0976581,
-0.0178115,
-0.00332398,
-0.0220867,
-0.00805196,
-0.0367584,
-0.0160492,
-0.12212,
-0.569507,
-0.241979,
-0.214681,
-0.134657,
-0.0028161,
-0.00758433,
-0.0183986,
-0.188471,
-0.0169397,
-0.0385166,
-0.0618688,
-0.0508597,
-0.0421476,
-0.067389,
-0.344697,
-0.0271042,
-0.0107095,
-0.00362401,
-0.00494921,
-0.115724,
-0.416721,
-0.00438724,
-0.155992,
-0.334604,
-0.381202,
-0.00539457,
-0.00448479,
-2.07432,
-0.0112148,
-2.01298,
-1.48369,
-1.7834,
-0.00891984,
-1.83001,
-0.00258613,
-0.00880015,
-0.00683304,
-0.735526,
-0.00424813,
-0.518342,
-1.69742,
-1.70352,
-0.00737455,
-0.240161,
-0.484262,
-0.00267616,
-0.39869,
-0.0563232,
-0.336808,
-0.0703787,
-0.760185,
-0.264579,
-1.07078,
-1.81712,
-2.64462,
-0.00749692,
-0.31226,
-0.571769,
-0.0199466,
-0.0125754,
-0.613604,
-0.805038,
-0.188686,
-0.931549,
-1.21061,
-0.00640241,
-2.91416,
-0.0227145,
-0.996354,
-0.0799468,
-2.08513,
-0.00331386,
-0.0566851,
-0.05154,
-0.0179734,
-0.0567454,
-0.187751,
-1.47302,
-0.141297,
-0.0664455,
-0.163748,
-0.145867,
-0.391934,
-4.8113,
-0.0137319,
-3.50013,
-3.83211,
-0.0296971,
-0.0396702,
-0.0156071,
-4.29846,
-1.25975,
-0.0150509,
-0.662748,
-1.5873,
-0.0341262,
-0.125819,
-0.122906,
-2.16463,
-0.0322658,
-2.20582,
-9.03504,
-0.280632,
-1.78221,
-0.0614632,
-0.278826,
-2.80893,
-0.41539,
-0.295134,
-0.575314,
-0.0816941,
-0.241403,
-0.0116113,
-2.24041,
-0.065529,
-0.131723,
-0.0987563,
-0.467317,
-0.0914456,
-0.799698,
-0.105886,
-0.62542,
-0.00961416,
-1.25118,
-0.501295,
-0.546567,
-0.763395,
-0.0122298,
-0.0660151,
-0.83308,
-0.64974,
-0.158968,
-0.0316338,
-2.35931,
-1.01496,
-0.0301593,
-1.15653,
-0.375148,
-1.05068,
-0.630875,
-0.0092221,
-0.302907,
-7.66656,
-0.00573456,
-0.1336,
-0.167818,
-0.871418,
-0.0129004,
-1.3624,
-1.8458,
-0.780056,
-0.00576929,
-1.60075,
-1.36036,
-1.19788,
-0.167311,
-0.274838,
-1.03426,
-0.532765,
-0.212824,
-0.289952,
-0.021797,
-0.0296578,
-0.193414,
-0.0162101,
-0.00675891,
-0.353467,
-0.94314,
-0.0816057,
-0.00384499,
-0.0199232,
-0.755348,
-0.052652,
-6.68395,
-0.800832,
-1.5976,
-0.0117026,
-0.0383489,
-0.135789,
-0.00596823,
-0.471669,
-0.520808,
-0.248631,
-0.479578,
-3.79651,
-0.00968868,
-1.79796,
-0.230275,
-0.675649,
-0.990623,
-0.0101664,
-0.0277792,
-0.703844,
-0.128155,
-0.127222,
-0.0622642,
-1.50089,
-0.504419,
-0.054292,
-0.006117,
-0.410568,
-2.0863,
-1.46077,
-0.378694,
-0.130282,
-0.692728,
-0.361871,
-0.0839597,
-1.33987,
-2.70232,
-0.0398741,
-0.038442,
-0.461411,
-0.0146948,
-1.13412,
-0.279823,
-2.08129,
-0.376424,
-1.6482,
-0.275793,
-1.02958,
-0.185706,
-1.45859,
-0.924759,
-0.0386818,
-1.0514,
-0.484847,
-0.335984,
-0.0331996,
-0.105663,
-1.60244,
-0.0853753,
-0.0467633,
-0.016025,
-1.19381,
-0.825363,
-0.12756,
-0.284749,
-0.421572,
-1.07549,
-0.920993,
-0.0173393,
-0.402075,
-0.681446,
-0.0235378,
-0.00706137,
-4.49073,
-1.52818,
-2.29998,
-1.06957,
-0.459487,
-0.0363152,
-0.00875082,
-0.0234594,
-0.0281708,
-0.0704943,
-0.32946,
-1.95946,
-0.655333,
-0.0478171,
-0.00579609,
-0.0389953,
-0.132365,
-0.0211417,
-0.0107393,
-0.0299306,
-0.816154,
-0.0213355,
-0.540253,
-0.00539364,
-0.515399,
-0.308476,
-0.578706,
-0.0562578,
-0.423002,
-0.54509,
-0.394294,
-0.00590977,
-0.00616852,
-4.25199,
-0.645442,
-0.0110218,
-0.380938,
-0.0328267,
-0.0495135,
-0.135257,
-0.0298913,
-0.352998,
-1.60776,
-0.0355374,
-1.47579,
-2.39417,
-1.89354,
-0.0465227,
-0.112173,
-0.4219,
-0.0117143,
-0.0182443,
-0.011684,
-1.78887,
-0.135395,
-0.0156935,
-0.0131273,
-0.324046,
-0.0110229,
-0.0771173,
-0.153031,
-0.00770382,
-0.0995377,
-1.01083,
-0.168564,
-1.36815,
-0.0119281,
-0.878617,
-0.0377243,
-0.169147,
-0.0591207,
-0.577893,
-0.174831,
-0.011275,
-0.0275489,
-0.0264321,
-0.0165671,
-2.90039,
-0.0123844,
-4.53128,
-0.281631,
-0.12137,
-0.0826458,
-0.0214882,
-0.132444,
-0.0797965,
-0.268441,
-1.98346,
-0.033978,
-3.56238,
-0.828403,
-0.368117,
-0.0422339,
-0.0107898,
-0.073943,
-4.15166,
-0.0303797,
-0.0182896,
-0.597061,
-0.0141325,
-0.184222,
-0.966106,
-0.52259,
-0.676633,
-0.0209171,
-0.0119762,
-0.0423273,
-0.2108,
-0.550522,
-0.0306361,
-0.0167249,
-1.01576,
-0.0934605,
-0.055798,
-1.07414,
-0.126128,
-0.0188373,
-0.139393,
-0.809402,
-0.00699041,
-0.0120318,
-1.14397,
-0.0279019,
-2.98754,
-2.74978,
-0.961222,
-0.408799,
-0.263984,
-0.154423,
-2.13436,
-0.645179,
-0.705755,
-2.36936,
-0.0130226,
-0.647181,
-0.058859,
-1.67108,
-4.19198,
-0.00897324,
-0.373076,
-0.03802,
-0.247251,
-0.016934,
-0.0134635,
-0.259171,
-2.84533,
-1.69036,
-0.0236473,
-7.28842,
-0.0237861,
-0.0877305,
-1.47408,
-0.933305,
-0.0492288,
-0.0150179,
-1.55667,
-0.333998,
-0.352479,
-0.0175991,
-1.96741,
-0.784119,
-0.307224,
-0.0832971,
-0.114271,
-0.0122107,
-0.523385,
-0.866747,
-0.0432035,
-0.00592506,
-0.0263721,
-1.45607,
-1.06082,
-0.206956,
-0.0871746,
-0.100603,
-0.166615,
-0.0572713,
-0.195873,
-0.0281501,
-0.013475,
-2.25542,
-0.0315269,
-0.00978862,
-1.39482,
-0.0105178,
-0.113264,
-0.141403,
-1.12681,
-0.015626,
-0.32203,
-0.0297831,
-0.0225539,
-0.184334,
-3.48002,
-0.0391418,
-0.566463,
-0.788697,
-0.680066,
-2.02699,
-0.601094,
-0.185534,
-0.301192,
-0.0413868,
-0.0143613,
-0.335196,
-0.550094,
-0.977615,
-1.35514,
-0.0299361,
-1.26899,
-0.649795,
-0.236862,
-0.0194476,
-0.0480869,
-0.0169266,
-0.00905021,
-0.081823,
-0.0155612,
-1.02139,
-0.0968449,
-0.0256239,
-1.44437,
-0.569991,
-3.93976,
-0.340362,
-0.628758,
-0.694798,
-0.0886505,
-0.0168092,
-1.68504,
-0.0161245,
-0.153994,
-0.399509,
-1.13606,
-0.787411,
-0.279113,
-0.99841,
-0.606936,
-0.0172275,
-0.237341,
-2.43471,
-0.0294695,
-7.08384,
-1.11872,
-0.131995,
-0.195867,
-1.12406,
-0.0133158,
-2.23119,
-0.0687973,
-0.0601737,
-3.39545,
-0.0627415,
-0.0949126,
-0.158764,
-1.93002,
-2.23167,
-1.10782,
-1.89527,
-1.07183,
-3.56836,
-1.61172,
-0.0529527,
-0.0284959,
-0.719017,
-0.0726547,
-1.02349,
-0.123997,
-0.0113076,
-0.927303,
-0.108564,
-0.0522408,
-0.0163014,
-0.899625,
-0.610341,
-1.46843,
-1.04284,
-0.0311735,
-0.836462,
-0.0232202,
-0.0322189,
-0.125044,
-0.0832737,
-2.85608,
-0.0904351,
-0.0841185,
-4.47884,
-0.072473,
-0.0180265,
-2.6839,
-0.0209138,
-0.00807821,
-1.93521,
-0.0148565,
-0.0278858,
-0.0132556,
-0.0434843,
-0.391081,
-0.0149295,
-0.66664,
-3.13168,
-0.202404,
-0.151707,
-0.0146037,
-4.62405,
-3.59227,
-1.16924,
-1.2745,
-0.0173438,
-0.0443556,
-1.49572,
-0.103252,
-0.475201,
-0.392384,
-1.87038,
-1.76685,
-0.450516,
-0.0127238,
-0.0297796,
-0.0763679,
-1.55549,
-0.0114807,
-0.0187634,
-1.20559,
-0.0136005,
-0.35908,
-0.292242,
-5.42552,
-0.215884,
-0.00620453,
-0.028564,
-2.50701,
-1.19442,
-1.66481,
-2.04546,
-0.295333,
-0.104825,
-0.905251,
-0.054676,
-0.0109525,
-0.0194473,
-0.48208,
-0.652341,
-3.52382,
-0.954582,
-0.0204773,
-0.0201383,
-0.0267485,
-0.153009,
-0.297477,
-0.077764,
-0.0995259,
-0.145766,
-2.09582,
-1.21204,
-0.0454612,
-0.0112856,
-0.0140028,
-3.00121,
-1.07673,
-0.344142,
-1.20076,
-2.85564,
-0.379547,
-6.47317,
-0.0231151,
-0.014591,
-0.0678212,
-0.308262,
-1.6367,
-0.022216,
-0.0703143,
-0.0163105,
-0.18243,
-0.761328,
-0.0695426,
-0.0844841,
-0.0184338,
-0.0106287,
-2.96453,
-0.169213,
-3.09585,
-3.25285,
-0.184351,
-0.440586,
-0.862357,
-0.0926334,
-3.46736,
-0.0222905,
-0.672319,
-0.0200692,
-0.0981496,
-1.37073,
-2.36468,
-0.020541,
-2.76678,
-0.0420562,
-0.18037,
-0.274806,
-0.435675,
-0.0167428,
-0.0248181,
-0.0127904,
-0.0737298,
-0.00486674,
-0.0127891,
-0.0210403,
-0.152401,
-0.0569911,
-0.8174,
-1.1057,
-0.0191097,
-0.0180141,
-0.0806412,
-10.0962,
-0.379454,
-0.0141014,
-1.13302,
-0.406212,
-0.903149,
-1.17507,
-0.263479,
-0.0923141,
-0.980439,
-0.00791261,
-3.13943,
-0.117084,
-0.116935,
-0.675446,
-0.0133349,
-1.95227,
-0.0193504,
-4.87971,
-0.0377082,
-1.42805,
-0.278552,
-0.0643086,
-0.412717,
-1.09986,
-0.0198809,
-0.0369739,
-4.36145,
-0.378205,
-0.0218041,
-0.0184234,
-2.29436,
-0.0142363,
-0.731821,
-0.628577,
-0.0496879,
-1.75472,
-0.0549912,
-0.0369835,
-0.0197777,
-0.0959647,
-0.0434447,
-0.0228455,
-0.439292,
-0.0110386,
-0.0351683,
-2.07292,
-2.53944,
-4.41628,
-0.0126393,
-0.0751976,
-0.0122582,
-0.232234,
-0.0182885,
-0.801436,
-0.0256426,
-0.450392,
-0.554026,
-0.00944407,
-0.190791,
-0.0243509,
-0.11374,
-2.10986,
-0.904041,
-0.0103365,
-0.513142,
-0.125004,
-0.107039,
-1.08965,
-1.53909,
-0.0466443,
-0.0239147,
-0.729467,
-4.83925,
-1.74369,
-0.135732,
-0.0650715,
-0.0171802,
-0.0771697,
-0.943818,
-1.18798,
-0.0284565,
-2.38122,
-0.012844,
-0.0148823,
-0.0847477,
-0.0203691,
-0.0540903,
-0.796628,
-1.36629,
-0.0453154,
-0.0209401,
-0.778056,
-0.112186,
-1.82398,
-0.037444,
-0.0196853,
-0.444516,
-0.0630098,
-0.0389196,
-0.0379315,
-0.388053,
-0.036795,
-0.0375536,
-0.398245,
-0.519715,
-0.823387,
-0.0222258,
-0.03144,
-0.396519,
-0.987479,
-0.528276,
-0.326578,
-0.63357,
-0.192033,
-0.955143,
-0.0221372,
-0.0336243,
-0.230588,
-0.0232268,
-0.977234,
-0.0339315,
-0.0539716,
-0.515171,
-1.11164,
-1.75577,
-0.771815,
-0.0498773,
-0.976695,
-0.185693,
-1.19305,
-0.0266196,
-1.07846,
-0.658231,
-0.648045,
-0.0273634,
-0.0185576,
-0.0335845,
-0.974751,
-0.0246607,
-0.0491517,
-0.0950833,
-0.508463,
-0.170587,
-0.761771,
-0.343995,
-0.0932538,
-0.0231817,
-0.197013,
-0.730428,
-0.650156,
-0.779649,
-0.43442,
-1.76103,
-0.216437,
-0.401711,
-0.0354134,
-0.670699,
-0.929623,
-0.212374,
-1.84047,
-0.981342,
-0.72193,
-0.0832182,
-0.0616278,
-0.0766576,
-1.47375,
-0.108613,
-0.0989544,
-0.273437,
-2.97957,
-1.05665,
-0.114147,
-0.100408,
-1.03113,
-0.0556187,
-0.0233541,
-0.154604,
-0.0279249,
-0.245879,
-1.37708,
-0.0569433,
-1.60878,
-0.11711,
-0.315961,
-0.0283646,
-0.701335,
-1.09484,
-0.500611,
-0.0270126,
-1.5267,
-0.212588,
-0.20709,
-6.62837,
-0.0267566,
-1.76601,
-0.465113,
-1.14026,
-3.02939,
-1.36772,
-5.42305,
-1.30553,
-0.449752,
-0.412473,
-0.500874,
-2.40922,
-2.57812,
-0.140741,
-1.02636,
-0.624274,
-2.00353,
-1.51801,
-0.439322,
-0.385466,
-1.33649,
-1.73745,
-0.76068,
-0.569247,
-1.40779,
-0.040439,
-0.0209811,
-1.82522,
-0.158512,
-0.156822,
-0.0194775,
-0.0266591,
-0.0441117,
-4.24541,
-0.551212,
-0.67584,
-0.0297114,
-0.877,
-0.184883,
-0.0569986,
-0.45144,
-0.0322988,
-0.0326773,
-1.08838,
-0.0358008,
-0.0551904,
-0.184099,
-0.0122156,
-0.0750175,
-1.53768,
-2.15418,
-3.79053,
-0.197409,
-1.37579,
-0.0964416,
-0.0364774,
-0.0321827,
-0.0224676,
-0.121824,
-0.930714,
-0.0487355,
-0.975174,
-0.379433,
-0.0400004,
-0.320418,
-0.276341,
-0.140871,
-0.0241509,
-4.18859,
-2.12743,
-0.272036,
-0.894322,
-0.0404211,
-2.34795,
-0.0971349,
-0.0698333,
-0.355765,
-0.141536,
-0.0591399,
-0.0246086,
-0.179558,
-1.30809,
-0.0284683,
-0.531372,
-0.0645579,
-0.0501959,
-0.539549,
-0.395591,
-0.519976,
-0.239241,
-0.0290428,
-0.0268326,
-0.0290787,
-0.023557,
-0.137486,
-0.206124,
-0.0231019,
-0.178744,
-1.23552,
-1.73622,
-0.33075,
-4.41827,
-0.0625087,
-0.143565,
-3.27164,
-0.0315865,
-1.18584,
-0.0346655,
-1.1401,
-0.0475473,
-0.456717,
-0.598711,
-0.335961,
-0.911408,
-3.0918,
-0.274904,
-0.533601,
-0.0627681,
-0.0386926,
-0.0375705,
-0.0417097,
-0.0285577,
-2.05905,
-1.2012,
-1.89447,
-1.31247,
-0.0370661,
-0.310684,
-0.932953,
-2.186,
-0.858738,
-1.07834,
-0.666964,
-0.259564,
-0.0478991,
-0.843454,
-0.707158,
-1.20017,
-0.0285266,
-0.030773,
-0.235752,
-1.23541,
-0.457369,
-0.0367941,
-0.508411,
-1.10499,
-1.3833,
-2.09934,
-0.444856,
-0.0484912,
-0.844111,
-0.995322,
-2.07034,
-1.02793,
-0.160039,
-0.165428,
-1.16784,
-1.31034,
-0.110201,
-0.0233719,
-0.134001,
-0.16637,
-0.818649,
-0.0196364,
-0.499787,
-0.0268607,
-0.104051,
-0.0998219,
-0.25189,
-0.0153373,
-0.07478,
-1.04497,
-1.8,
-0.076826,
-0.926243,
-0.727986,
-0.285184,
-1.78183,
-0.375071,
-0.306413,
-0.0308843,
-0.356734,
-0.0910327,
-0.157414,
-0.600247,
-0.932958,
-0.249779,
-3.40605,
-0.869692,
-0.0268714,
-0.0511434,
-0.447846,
-0.630589,
-0.0452131,
-0.0340385,
-0.0834499,
-0.0365671,
-0.0703859,
-0.562725,
-4.72486,
-0.0320597,
-7.27125,
-0.685842,
-0.0347677,
-0.673942,
-0.0347402,
-0.1278,
-0.573769,
-0.0319025,
-0.0698305,
-0.0166748,
-1.17003,
-0.534957,
-0.804618,
-0.0487601,
-0.29233,
-0.213885,
-0.184481,
-2.44893,
-0.414127,
-0.474811,
-0.539925,
-0.0195113,
-0.0697436,
-0.383709,
-0.60327,
-0.013724,
-0.0524498,
-2.74551,
-0.057036,
-0.409586,
-0.591801,
-0.303543,
-1.16281,
-0.439364,
-2.22491,
-0.0295627,
-0.110774,
-0.14113,
-3.28025,
-2.87668,
-0.062436,
-0.133527,
-1.59931,
-0.132851,
-0.0344922,
-0.0476246,
-0.0385824,
-0.0788202,
-0.750726,
-0.0390845,
-1.6122,
-1.53578,
-0.0295826,
-1.91026,
-0.342251,
-0.310849,
-0.253005,
-0.131168,
-0.0948782,
-0.022972,
-0.18328,
-0.0286731,
-0.113168,
-1.11239,
-0.536914,
-0.015475,
-0.0369583,
-0.702521,
-1.5872,
-0.1009,
-0.0111231,
-0.128303,
-2.89978,
-0.087576,
-0.345555,
-0.491967,
-0.834935,
-0.114131,
-0.027445,
-0.111785,
-1.03823,
-7.19728,
-0.537796,
-0.116507,
-0.0665586,
-0.0390031,
-0.0484002,
-0.0275489,
-0.0336056,
-2.04126,
-0.94414,
-0.136143,
-0.0999306,
-0.0431709,
-0.157935,
-0.0342833,
-0.150764,
-1.64432,
-0.374968,
-0.892844,
-0.0679132,
-6.01678,
-0.163041,
-2.34062,
-0.0425404,
-1.10446,
-0.129304,
-0.0497816,
-0.469313,
-0.354537,
-0.0476189,
-3.86039,
-0.589428,
-0.0521797,
-2.17968,
-0.819637,
-0.0336723,
-0.312782,
-11.3571,
-0.164603,
-0.92944,
-0.06385,
-0.0413099,
-0.0179254,
-0.019224,
-0.690256,
-0.749425,
-0.692216,
-1.36328,
-0.0293093,
-2.21045,
-1.5555,
-1.04346,
-0.588426,
-0.0884426,
-1.26413,
-2.8372,
-2.03378,
-0.023493,
-0.348337,
-19.9162,
-0.0349337,
-3.2444,
-3.325,
-0.483318,
-0.638112,
-0.245822,
-0.167165,
-0.0423681,
-0.0681261,
-0.0301891,
-0.178937,
-0.377021,
-0.837326,
-0.0250439,
-0.272997,
-0.932375,
-0.501114,
-0.595488,
-0.148138,
-0.135931,
-0.0499717,
-1.0818,
-0.648329,
-0.0539258,
-0.0267858,
-0.0912701,
-0.16495,
-0.136256,
-0.118994,
-1.59897,
-2.89902,
-0.0797994,
-0.0896226,
-0.110298,
-0.029292,
-0.654834,
-0.628501,
-0.0367649,
-6.966,
-0.0259511,
-2.13557,
-2.57038,
-0.0274248,
-1.56831,
-2.54963,
-0.472054,
-2.52441,
-0.173314,
-0.0193239,
-0.639787,
-0.00956868,
-0.162557,
-0.726784,
-1.45625,
-1.06845,
-0.62039,
-0.780868,
-1.34329,
-0.0597643,
-0.0436341,
-0.887928,
-0.227923,
-0.604901,
-0.0334231,
-0.0137634,
-0.0272398,
-1.74839,
-0.0431505,
-0.287192,
-0.132703,
-1.36956,
-0.3667,
-0.0730596,
-3.46445,
-0.186995,
-0.0235156,
-0.418258,
-1.62153,
-0.0540187,
-0.35806,
-0.216985,
-0.0452807,
-0.0248434,
-0.25385,
-1.21919,
-0.291383,
-0.199289,
-1.61076,
-0.780577,
-0.344227,
-1.69478,
-0.419666,
-0.033744,
-0.352775,
-3.25185,
-0.062696,
-0.421117,
-0.236008,
-0.585759,
-0.0469577,
-0.453145,
-0.786168,
-0.0550989,
-2.63548,
-0.0510463,
-0.220929,
-0.249434,
-0.207698,
-0.26311,
-0.0278356,
-0.185154,
-0.450226,
-0.169653,
-3.18538,
-0.122355,
-0.01887,
-0.0441326,
-0.774425,
-0.162019,
-2.77437,
-0.519363,
-0.0274748,
-0.0181108,
-0.0542794,
-1.32149,
-2.55167,
-0.4117,
-0.191033,
-3.17939,
-0.0518342,
-0.351582,
-3.82973,
-0.561865,
-0.0313562,
-0.0286062,
-0.264452,
-2.13229,
-0.385583,
-0.043637,
-0.172823,
-0.939917,
-0.134897,
-0.0220798,
-0.0288614,
-0.0361179,
-0.0414054,
-1.50359,
-0.0310875,
-1.34541,
-0.118752,
-1.72565,
-2.86701,
-0.170248,
-0.280923,
-0.0786802,
-0.0269875,
-0.629377,
-0.233592,
-0.654824,
-2.04521,
-0.0297504,
-0.11398,
-3.45122,
-0.127079,
-1.11138,
-0.808912,
-1.92188,
-1.07604,
-0.427632,
-1.54089,
-0.653724,
-0.229825,
-0.93748,
-0.362993,
-0.0385334,
-3.05725,
-1.40371,
-1.31023,
-0.183719,
-0.0449932,
-0.0200456,
-5.11088,
-0.340302,
-0.0587979,
-0.153448,
-0.773218,
-2.29835,
-0.843113,
-0.0331835,
-0.115325,
-0.354467,
-0.209919,
-4.10394,
-0.379413,
-1.344,
-0.0212387,
-0.0427022,
-1.97049,
-0.0959438,
-0.019523,
-0.543876,
-0.349217,
-0.42578,
-0.758341,
-2.87394,
-0.0482192,
-0.92667,
-0.0411618,
-0.313472,
-1.46812,
-0.0848245,
-1.11084,
-0.931315,
-3.28055,
-3.64379,
-0.502481,
-1.69642,
-2.07756,
-0.983456,
-0.059263,
-0.0405138,
-0.525894,
-1.1988,
-0.743893,
-1.85869,
-3.27686,
-0.214005,
-2.81084,
-0.230667,
-0.0753075,
-0.0479244,
-1.69162,
-0.120867,
-0.450385,
-0.853781,
-4.29768,
-0.168747,
-0.94537,
-0.0462268,
-0.0154524,
-0.0857606,
-0.524586,
-0.56426,
-0.126343,
-0.039242,
-2.05084,
-3.37521,
-0.0807946,
-0.0399883,
-0.0385821,
-0.0802298,
-2.86367,
-1.38381,
-4.47342,
-0.0613545,
-1.95542,
-0.0253785,
-0.028939,
-0.0184858,
-4.75596,
-0.162495,
-0.524979,
-0.440764,
-0.0288252,
-0.0426618,
-0.238573,
-0.212607,
-1.02512,
-0.431422,
-0.0483596,
-0.0497551,
-0.19612,
-0.0513715,
-2.52013,
-0.552905,
-0.0362129,
-0.215875,
-0.158437,
-0.723394,
-1.97539,
-1.68974,
-0.0290781,
-0.204805,
-0.0326952,
-0.0396797,
-0.070124,
-0.0769115,
-1.50964,
-3.09848,
-0.190052,
-0.0422696,
-0.187811,
-0.840393,
-0.0864695,
-0.157626,
-0.236743,
-2.55408,
-0.442321,
-0.090722,
-0.0397368,
-1.20487,
-0.819878,
-0.0471212,
-0.0273363,
-3.42039,
-0.401391,
-0.550771,
-0.554496,
-0.473578,
-0.086676,
-0.00895831,
-0.104863,
-0.039692,
-0.271894,
-0.124826,
-2.3057,
-0.0863762,
-0.0506885,
-0.518763,
-0.142844,
-0.0639254,
-0.172806,
-0.0285866,
-0.391593,
-0.810165,
-0.232249,
-0.368983,
-0.643437,
-2.23933,
-0.106516,
-0.0674958,
-0.0691356,
-0.0237071,
-0.242829,
-0.610808,
-0.193758,
-5.74025,
-0.0516217,
-0.0490443,
-0.046388,
-0.0579369,
-0.46139,
-0.923217,
-0.345087,
-0.075813,
-0.131522,
-0.0345701,
-4.62317,
-1.30762,
-0.501573,
-2.40035,
-0.143149,
-0.953014,
-1.59083,
-0.0398558,
-0.0539478,
-0.714697,
-2.52828,
-0.0494221,
-0.139462,
-1.24259,
-0.0455048,
-0.221924,
-0.651962,
-0.0899557,
-0.0756259,
-0.409682,
-0.174846,
-0.512165,
-1.73159,
-1.49834,
-0.41805,
-1.15057,
-4.23103,
-0.0517928,
-0.0349512,
-0.0998034,
-0.0194062,
-0.391594,
-0.777555,
-0.130675,
-0.0443601,
-2.77513,
-5.9201,
-0.0156282,
-4.29988,
-0.315986,
-1.98878,
-0.151878,
-2.96781,
-0.146679,
-0.441651,
-0.0537671,
-1.68484,
-0.0500679,
-0.917427,
-0.0545979,
-2.00111,
-0.710434,
-2.63168,
-0.03862,
-1.03766,
-0.089763,
-1.96281,
-1.27509,
-0.0612452,
-2.75142,
-0.049427,
-0.867924,
-0.0417765,
-1.56371,
-0.505495,
-0.185918,
-3.89272,
-0.57444,
-0.0286687,
-0.0513495,
-0.210677,
-0.0207036,
-0.300754,
-0.212596,
-0.0455859,
-0.242257,
-2.84228,
-0.0590115,
-0.133224,
-0.2963,
-0.0188475,
-0.0797556,
-0.0199825,
-0.554427,
-3.23516,
-0.168696,
-0.0527738,
-0.034583,
-0.067298,
-2.16699,
-0.180613,
-0.0423169,
-0.671088,
-0.196617,
-0.0352523,
-0.0490848,
-2.63262,
-0.0190304,
-0.673429,
-0.464772,
-0.0344115,
-0.207942,
-2.38586,
-0.176036,
-0.300864,
-0.0691785,
-0.425864,
-0.0781678,
-0.742537,
-0.153062,
-0.229048,
-0.480327,
-1.34944,
-1.46906,
-0.128705,
-0.0578887,
-2.27696,
-0.109941,
-0.0685277,
-0.715156,
-12.5813,
-0.0530299,
-0.339133,
-0.874489,
-0.451029,
-2.64959,
-1.51932,
-0.680546,
-0.192229,
-0.216913,
-0.116503,
-2.48788,
-0.0949152,
-3.83079,
-0.0387027,
-1.10941,
-0.0263105,
-0.171303,
-0.0424889,
-1.19209,
-0.0304228,
-0.020228,
-0.08344,
-0.0466425,
-2.3628,
-0.94488,
-3.03408,
-0.867993,
-3.30684,
-0.916543,
-0.432179,
-1.11524,
-0.256126,
-2.22429,
-0.217993,
-0.0172269,
-3.06004,
-0.0781924,
-2.24292,
-0.194049,
-0.0598128,
-1.8985,
-0.208402,
-1.30776,
-1.22101,
-0.597047,
-0.642605,
-0.25654,
-1.40044,
-1.33546,
-2.58451,
-0.42118,
-1.01968,
-0.0355722,
-1.06493,
-0.0398334,
-2.82042,
-0.0770558,
-0.120211,
-0.223315,
-0.346027,
-0.231975,
-0.140813,
-0.0321364,
-0.229717,
-0.0550851,
-0.175673,
-0.0638819,
-0.305757,
-0.0446366,
-0.0526742,
-0.910066,
-0.0693787,
-0.0656616,
-3.99388,
-0.957635,
-2.87063,
-0.559388,
-1.09672,
-0.0629094,
-0.0335507,
-0.0586493,
-0.457204,
-1.13915,
-0.0330637,
-1.83119,
-1.15423,
-1.35077,
-0.368051,
-1.90204,
-0.100674,
-0.0270066,
-0.0561599,
-0.296284,
-2.35782,
-1.25725,
-0.0961214,
-0.879153,
-0.839524,
-1.06185,
-0.860845,
-1.86829,
-0.0222199,
-1.84882,
-0.612225,
-2.06717,
-0.306688,
-1.01747,
-0.1853,
-0.81287,
-1.5181,
-2.09916,
-0.785136,
-0.0820056,
-0.132641,
-0.605842,
-0.784225,
-0.255578,
-0.717239,
-0.0240877,
-0.395247,
-4.58499,
-0.202475,
-0.948586,
-0.0481403,
-0.220188,
-0.438406,
-0.32593,
-0.546949,
-1.42858,
-0.127798,
-0.259366,
-0.435916,
-0.0432795,
-1.51184,
-0.0351039,
-0.0488936,
-0.703543,
-1.47505,
-0.116772,
-0.885036,
-1.19026,
-2.05269,
-0.55185,
-0.176788,
-0.447495,
-4.08685,
-0.304523,
-0.729283,
-2.36721,
-0.0868879,
-0.0600699,
-0.308838,
-0.053681,
-0.10588,
-0.0387668,
-0.622362,
-0.323431,
-1.06162,
-3.52031,
-0.70581,
-6.38789,
-0.034986,
-1.63962,
-0.0657991,
-0.116401,
-1.54258,
-5.46988,
-2.3338,
-0.0501959,
-0.655546,
-0.0330134,
-0.0359946,
-2.23491,
-1.13118,
-0.124764,
-0.0793909,
-0.156702,
-0.49638,
-0.0786528,
-0.114004,
-0.0328893,
-0.0467533,
-0.0561572,
-0.281949,
-0.0724991,
-0.458019,
-0.0817692,
-0.259897,
-0.879452,
-0.0552004,
-0.223864,
-0.110914,
-0.0122186,
-4.00465,
-6.08778,
-2.32153,
-0.303225,
-2.92331,
-2.43622,
-0.0577995,
-0.611998,
-3.61156,
-3.91357,
-0.0390221,
-0.0329887,
-1.54763,
-0.116473,
-0.458851,
-0.0209528,
-0.879521,
-0.0687717,
-0.651051,
-0.464302,
-0.0284019,
-0.0597936,
-0.418104,
-0.546973,
-0.0828888,
-0.0313511,
-0.447154,
-1.3838,
-0.202868,
-0.30446,
-0.241587,
-0.208087,
-0.712169,
-1.44423,
-0.746531,
-0.0260352,
-2.26901,
-0.0318809,
-0.470932,
-0.285773,
-0.83461,
-0.625506,
-0.0511025,
-0.212128,
-0.106561,
-0.0522188,
-1.24002,
-0.0487099,
-0.0479102,
-0.0488201,
-1.50642,
-0.87115,
-0.178598,
-0.420161,
-1.29258,
-0.029335,
-0.274303,
-0.440781,
-0.0513317,
-0.679938,
-1.25479,
-0.111976,
-0.259876,
-0.0292696,
-0.321257,
-0.168882,
-0.119275,
-0.0642024,
-0.269559,
-1.55048,
-0.737578,
-1.99075,
-0.0573834,
-0.043511,
-0.0669422,
-0.0874737,
-0.0273208,
-0.19175,
-0.0617475,
-0.226874,
-2.23745,
-0.0331433,
-1.18721,
-0.259829,
-0.0546411,
-0.124738,
-0.295525,
-0.162801,
-2.58657,
-0.159015,
-0.0547047,
-0.0716786,
-2.81193,
-0.0583376,
-3.28809,
-0.19801,
-2.89961,
-1.38541,
-0.874802,
-1.64682,
-0.0339318,
-0.882751,
-3.31521,
-0.108546,
-0.333626,
-0.0481785,
-0.240765,
-0.031519,
-0.224044,
-0.0342903,
-4.65253,
-8.67651,
-0.0317197,
-0.229705,
-3.46586,
-0.202798,
-5.2383,
-0.270961,
-4.15216,
-5.79443,
-0.0543847,
-0.0315027,
-0.0633178,
-0.396223,
-0.0859012,
-0.283402,
-0.219801,
-0.162747,
-0.389153,
-0.0584056,
-0.899113,
-0.0442995,
-0.48248,
-0.544398,
-2.93946,
-0.234098,
-0.0725105,
-1.29304,
-1.37987,
-0.230384,
-1.82678,
-0.0664034,
-8.48832,
-0.52593,
-6.17643,
-1.94352,
-0.0792458,
-0.0420796,
-0.237452,
-0.235531,
-0.263072,
-0.65059,
-0.241969,
-0.0665429,
-0.588457,
-0.221476,
-0.137517,
-3.14936,
-2.68282,
-0.1429,
-0.051444,
-0.967475,
-1.76627,
-0.0488828,
-0.892709,
-3.37713,
-0.0271607,
-0.372425,
-0.1725,
-0.801524,
-0.0466829,
-0.892433,
-1.37606,
-2.03062,
-0.422615,
-0.640964,
-0.727016,
-0.0643524,
-2.26166,
-0.0921043,
-0.140455,
-0.061916,
-1.22919,
-0.156917,
-0.058356,
-0.159913,
-0.119176,
-0.32193,
-0.0919132,
-0.0657395,
-0.87503,
-0.304768,
-1.21502,
-11.6088,
-0.275003,
-0.149888,
-0.0995931,
-0.235124,
-0.133697,
-0.0249728,
-0.0597707,
-0.134019,
-0.1131,
-0.163957,
-0.41288,
-0.279836,
-2.35216,
-0.407364,
-0.118296,
-3.2709,
-0.065086,
-0.4298,
-0.976357,
-0.123744,
-0.132392,
-0.108424,
-0.050831,
-0.0510152,
-1.82162,
-0.386211,
-0.108151,
-0.0811918,
-0.057606,
-1.66905,
-0.0561329,
-0.128352,
-0.589866,
-2.16353,
-0.159095,
-0.0955746,
-1.99202,
-0.049983,
-1.12516,
-1.53151,
-0.0557638,
-1.41424,
-2.83274,
-0.0474327,
-1.57806,
-0.0313845,
-0.184722,
-11.2577,
-0.340894,
-0.045489,
-0.0770619,
-1.16517,
-2.42605,
-2.55216,
-0.0663501,
-0.622896,
-0.433467,
-0.512,
-0.689658,
-0.104572,
-1.07736,
-0.0696193,
-0.0881888,
-2.04494,
-0.36454,
-0.722892,
-0.690685,
-0.371679,
-0.0604008,
-0.0369292,
-0.439335,
-0.322862,
-2.48637,
-2.38586,
-1.91036,
-0.0811695,
-3.02098,
-5.50166,
-0.18217,
-0.499061,
-0.0690109,
-4.52557,
-0.829218,
-0.509013,
-2.12351,
-1.84113,
-0.277911,
-3.78644,
-0.25994,
-0.378386,
-0.0566265,
-3.24999,
-0.0593949,
-0.634899,
-0.111195,
-0.0432876,
-0.0505558,
-0.358268,
-0.267442,
-0.0283382,
-0.0464189,
-2.20632,
-0.289672,
-0.617593,
-0.0546439,
-0.343459,
-0.458515,
-0.0662954,
-1.40679,
-1.26781,
-0.028659,
-2.3864,
-2.42482,
-3.46811,
-0.126193,
-0.129789,
-0.660102,
-0.852432,
-0.0641659,
-1.34351,
-2.90583,
-0.0190405,
-0.931528,
-0.23032,
-0.138873,
-2.16738,
-0.431083,
-1.1066,
-0.123985,
-0.0277505,
-1.86236,
-0.233798,
-0.0703952,
-2.51042,
-1.63748,
-0.0738999,
-0.993295,
-0.235532,
-0.0594361,
-0.888814,
-0.137166,
-0.672234,
-0.20272,
-1.31126,
-0.482564,
-0.40963,
-0.849478,
-0.87623,
-0.181501,
-1.93784,
-0.0447537,
-1.08918,
-0.0661072,
-0.350262,
-0.367213,
-0.621168,
-0.307686,
-0.307312,
-0.80061,
-0.402272,
-0.260069,
-0.0537997,
-0.075721,
-0.256332,
-0.129196,
-1.04886,
-0.168949,
-0.0636322,
-0.155158,
-0.0666247,
-0.346874,
-0.126497,
-0.0580836,
-0.345641,
-1.90827,
-0.159079,
-1.90341,
-2.29657,
-0.280142,
-2.35784,
-0.0741823,
-0.691726,
-3.17599,
-0.0707458,
-0.414906,
-0.482484,
-0.781285,
-0.140341,
-0.0579359,
-0.1932,
-0.0461297,
-0.151519,
-0.417693,
-0.0585841,
-0.0712112,
-2.681,
-1.89538,
-0.0569326,
-0.420472,
-0.0787338,
-0.31362,
-0.168993,
-0.0124876,
-0.0398953,
-0.0321807,
-1.57723,
-0.491455,
-0.611765,
-0.0959162,
-2.32372,
-2.59834,
-0.0289081,
-0.185397,
-0.0310874,
-0.0574432,
-1.87881,
-0.0299885,
-0.0940795,
-0.32992,
-0.10113,
-1.38142,
-0.170522,
-0.309615,
-0.0653931,
-0.0241819,
-0.55698,
-1.25907,
-8.77428,
-0.0894994,
-4.22697,
-0.126918,
-0.0679389,
-0.405722,
-0.11554,
-0.411639,
-3.14902,
-0.395204,
-0.0604636,
-0.0541263,
-0.0670226,
-0.0820659,
-0.468223,
-0.21082,
-0.0951545,
-0.0557226,
-0.109819,
-0.410302,
-0.124911,
-0.125792,
-2.41185,
-0.393423,
-1.5415,
-0.197598,
-0.392015,
-0.0892076,
-0.151974,
-5.2004,
-0.313322,
-0.0968623,
-0.0730793,
-0.0635642,
-0.142239,
-0.251174,
-0.117132,
-0.0584311,
-0.0727808,
-1.7316,
-14.3387,
-0.962045,
-0.423146,
-0.442687,
-0.259985,
-0.944932,
-1.10364,
-0.473432,
-0.551394,
-0.112356,
-0.0447045,
-0.601294,
-0.0703962,
-0.483603,
-0.773182,
-1.75209,
-0.0393102,
-0.125339,
-1.64554,
-1.14868,
-2.30633,
-0.1535,
-0.106213,
-0.0755478,
-0.111739,
-1.05868,
-0.126434,
-0.0801128,
-0.0870268,
-0.638272,
-0.0712605,
-0.306746,
-0.995763,
-1.67207,
-0.0407544,
-0.0689125,
-1.15535,
-0.0934247,
-0.0420345,
-2.16664,
-0.0553995,
-0.106399,
-0.958497,
-0.117524,
-0.148234,
-0.88036,
-2.7964,
-0.158447,
-3.03719,
-0.549354,
-0.930334,
-0.0777338,
-0.604994,
-0.119524,
-0.366349,
-0.587951,
-1.3892,
-2.03842,
-0.49219,
-0.323581,
-0.0710887,
-0.237579,
-0.198266,
-0.225656,
-1.76646,
-0.382296,
-0.0641023,
-0.0368945,
-0.0737363,
-0.123501,
-1.23212,
-0.0401248,
-0.0887501,
-0.144458,
-0.0593762,
-1.77611,
-0.117496,
-1.10951,
-0.0447094,
-0.0512246,
-0.158308,
-0.100918,
-0.0747496,
-0.657424,
-0.284069,
-0.243499,
-0.150524,
-0.0890774,
-0.158827,
-0.236935,
-0.186091,
-0.814718,
-0.171378,
-0.032641,
-0.10334,
-5.99986,
-0.265762,
-0.0663942,
-0.32581,
-3.68292,
-1.19386,
-2.1788,
-0.0306543,
-0.089127,
-0.0614441,
-0.377578,
-0.0703343,
-5.86854,
-2.36742,
-0.0793274,
-0.37407,
-3.81228,
-0.0625242,
-0.815525,
-2.63832,
-0.103947,
-0.226163,
-0.517104,
-0.0967388,
-0.0638174,
-3.29347,
-1.98205,
-2.12456,
-0.294898,
-0.0669148,
-0.366264,
-0.0788389,
-0.0599031,
-0.103201,
-0.0657807,
-0.0348013,
-4.00543,
-0.0455913,
-0.786988,
-0.0998594,
-0.137226,
-0.094344,
-0.364134,
-0.298522,
-0.498325,
-9.77535,
-0.156553,
-1.92235,
-0.0665573,
-0.17425,
-0.0303761,
-0.791262,
-0.348269,
-0.0760257,
-0.580157,
-0.0523513,
-0.120347,
-1.10689,
-1.64728,
-3.19068,
-0.845994,
-0.0765441,
-2.31216,
-0.573349,
-1.67122,
-0.0597045,
-0.737451,
-3.70334,
-0.132051,
-0.165262,
-0.0718149,
-2.15409,
-0.980662,
-0.160011,
-0.38977,
-0.173542,
-0.062562,
-7.76759,
-0.0255211,
-0.0659255,
-0.347453,
-0.768393,
-0.0834153,
-0.0715687,
-0.0904908,
-0.089043,
-0.999889,
-1.02049,
-0.221971,
-0.0933579,
-2.82198,
-0.0582436,
-0.0593447,
-0.0744117,
-2.39073,
-0.0778969,
-0.0810533,
-0.0523469,
-0.039233,
-0.844211,
-4.89449,
-0.627781,
-0.0532386,
-1.7075,
-0.0934941,
-0.282323,
-0.545151,
-1.86493,
-0.148566,
-0.569218,
-0.203544,
-0.0674512,
-3.05014,
-1.93511,
-0.60612,
-0.119616,
-0.0699961,
-0.18056,
-0.0864358,
-1.35149,
-3.43422,
-0.663563,
-0.286134,
-0.124186,
-0.799044,
-2.57988,
-0.0434146,
-0.641585,
-1.99479
-} };
@@ -23,11 +23,17 @@
 //#define USE_OPENBLAS
 //#define USE_MKL
 //#define USE_CAFFE
+/*  Compress the chunks of the training data files, needs zlib */
+//#define USE_ZLIB
 #ifndef USE_BLAS
 #define USE_OPENCL
 #endif
 //#define USE_TUNER
 #define USE_SEARCH
+/*  Count acquires, spins and waits per LOCK() site, dumped after a search */
+//#define SMP_LOCK_STATS
+/*  Time the phases of each simulation, shown by the search_profile command */
+//#define SEARCH_PROFILE
 
 /* #define PROGRAM_NAME "Leela" */
 #define PROGRAM_NAME "Leela Zero"
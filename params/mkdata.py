@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# Builds leela.dat, the file with the tables the engine loads at startup.
+#
+# Usage: mkdata.py leela.dat [group=textfile ...]
+#        mkdata.py leela.dat --list
+#
+# Tables of an existing leela.dat are kept unless a group replaces them.
+# A text file holds the numbers of a group, split by commas or whitespace.
+# If the group has several tables, they are separated by blank lines, or
+# by "};" in C++ initializer lists. Where the files come from:
+#
+#   patterns        sortpat.txt, the keys given to mphf.py
+#   pattern_hash    g_mphf.txt, written by mphf.py
+#   live_patterns   the patterns that have a weight
+#   mc_weights      rltune_*.txt, written by the MC policy tuner
+#   mc_weights_sl   sltune_*.txt, written by the MC policy tuner
+#   book            book.txt, written by the bookgen command
+#   attrib          r_fparam*.txt, written by the attribute tuner
+
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"LZDT"
+VERSION = 1
+ALIGN = 64
+
+# Element types, as in Resources.h
+TYPES = {
+    'i': ('<i', int),
+    'f': ('<f', float),
+    'd': ('<d', float),
+    'q': ('<Q', int),
+}
+
+GROUPS = {
+    'patterns': [('patterns', 'i')],
+    'pattern_hash': [('pattern_hash', 'i')],
+    'live_patterns': [('live_patterns', 'i')],
+    'mc_weights': [('feature_weights', 'f'), ('pattern_weights', 'f')],
+    'mc_weights_sl': [('feature_weights_sl', 'f'),
+                      ('pattern_weights_sl', 'f')],
+    # Pairs of position hash and count, split into two tables
+    'book': [('book_keys', 'q'), ('book_counts', 'i')],
+    'attrib': [('attrib_weights', 'd'), ('attrib_patterns', 'i'),
+               ('attrib_patweights', 'd')],
+}
+
+HEADER = struct.Struct('<4sIII')
+ENTRY = struct.Struct('<24sc3xIQQ')
+
+NUMBER = re.compile(r'[-+]?(?:0[xX][0-9a-fA-F]+|(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?)')
+
+
+def fnv1a(data):
+    h = 0xcbf29ce484222325
+    for b in data:
+        h ^= b
+        h = (h * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def parse_number(text, kind):
+    if kind == 'f' or kind == 'd':
+        return float(text)
+    return int(text, 0)
+
+
+def read_chunks(filename):
+    text = open(filename, "rt").read()
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', ' ', text)
+    if '{' in text:
+        # C++ initializers, the declaration ends before the first brace
+        chunks = [c[c.index('{') + 1:] for c in text.split('};') if '{' in c]
+    else:
+        chunks = re.split(r'\n\s*\n', text.strip())
+    return [NUMBER.findall(c) for c in chunks]
+
+
+def read_group(group, filename):
+    tables = GROUPS[group]
+    chunks = read_chunks(filename)
+    if group == 'book':
+        numbers = [n for c in chunks for n in c]
+        if len(numbers) % 2:
+            sys.exit("%s: odd number of values for the book" % filename)
+        pairs = sorted((int(numbers[i], 0), int(numbers[i + 1], 0))
+                       for i in range(0, len(numbers), 2))
+        return {
+            'book_keys': ('q', [k for k, _ in pairs]),
+            'book_counts': ('i', [v for _, v in pairs]),
+        }
+    if len(chunks) != len(tables):
+        sys.exit("%s: expected %d tables for %s, found %d"
+                 % (filename, len(tables), group, len(chunks)))
+    result = {}
+    for (name, kind), chunk in zip(tables, chunks):
+        result[name] = (kind, [parse_number(n, kind) for n in chunk])
+    return result
+
+
+def pack(kind, values):
+    fmt, _ = TYPES[kind]
+    return struct.pack('<%d%s' % (len(values), fmt[1]), *values)
+
+
+def read_datafile(filename):
+    tables = {}
+    data = open(filename, "rb").read()
+    magic, version, count, _ = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        sys.exit("%s: not a version %d data file" % (filename, VERSION))
+    for i in range(count):
+        name, kind, elements, offset, checksum = \
+            ENTRY.unpack_from(data, HEADER.size + i * ENTRY.size)
+        name = name.rstrip(b'\0').decode()
+        kind = kind.decode()
+        size = elements * struct.calcsize(TYPES[kind][0])
+        blob = data[offset:offset + size]
+        if len(blob) != size or fnv1a(blob) != checksum:
+            sys.exit("%s: table %s is damaged" % (filename, name))
+        tables[name] = (kind, elements, blob)
+    return tables
+
+
+def write_datafile(filename, tables):
+    names = sorted(tables)
+    offset = HEADER.size + len(names) * ENTRY.size
+    entries = b''
+    body = b''
+    for name in names:
+        kind, elements, blob = tables[name]
+        pad = -offset % ALIGN
+        body += b'\0' * pad
+        offset += pad
+        entries += ENTRY.pack(name.encode(), kind.encode(), elements,
+                              offset, fnv1a(blob))
+        body += blob
+        offset += len(blob)
+    header = HEADER.pack(MAGIC, VERSION, len(names), 0)
+    tmpname = filename + ".tmp"
+    with open(tmpname, "wb") as out:
+        out.write(header + entries + body)
+    os.replace(tmpname, filename)
+
+
+def main(args):
+    if not args:
+        sys.exit("usage: mkdata.py leela.dat [group=textfile ... | --list]")
+    filename = args[0]
+    tables = {}
+    if os.path.exists(filename):
+        tables = read_datafile(filename)
+
+    if args[1:] == ['--list']:
+        for name in sorted(tables):
+            kind, elements, blob = tables[name]
+            print("%-24s %s %8d %016x" % (name, kind, elements, fnv1a(blob)))
+        return
+
+    for arg in args[1:]:
+        group, _, source = arg.partition('=')
+        if group not in GROUPS or not source:
+            sys.exit("Unknown group %s, expected one of: %s"
+                     % (group, ", ".join(sorted(GROUPS))))
+        for name, (kind, values) in read_group(group, source).items():
+            tables[name] = (kind, len(values), pack(kind, values))
+            print("%s: %d values from %s" % (name, len(values), source))
+
+    write_datafile(filename, tables)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
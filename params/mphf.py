@@ -181,7 +181,8 @@ print("Creating perfect hash for %d patterns" % (len(pdict)))
 # printing phf specification
 print("Printing g[]")
 #print(g)
-with open('g_mphf.txt', 'a') as out_file:
+# mkdata.py leela.dat pattern_hash=g_mphf.txt patterns=sortpat.txt
+with open('g_mphf.txt', 'w') as out_file:
     for i, g_v in enumerate(g):
         if i % 10 == 9:
             out_file.write("\n")
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+# Reads the training data files written by the nettune command,
+# leela_train.bin and leela_test.bin. The layout is described in
+# TrainData.h.
+#
+# Usage: traindata.py file.bin            print what is in the file
+#        traindata.py file.bin --check    also decode every position
+#
+# A trainer imports it and iterates over positions(), which applies
+# one of the 8 symmetries of the board to each position at random.
+
+import random
+import struct
+import sys
+import zlib
+
+HEADER = struct.Struct('<4sIII')
+INDEX = struct.Struct('<QII')
+FOOTER = struct.Struct('<QQI4s')
+
+SIZE = 19
+POINTS = SIZE * SIZE
+MOVES = 3
+
+
+def rotate(vertex, symmetry):
+    # Same as Network::rotate_nn_idx
+    x, y = vertex % SIZE, vertex // SIZE
+    if symmetry >= 4:
+        x, y = y, x
+        symmetry -= 4
+    if symmetry in (2, 3):
+        x = SIZE - x - 1
+    if symmetry in (1, 3):
+        y = SIZE - y - 1
+    return y * SIZE + x
+
+
+# Where each point goes, for every symmetry
+ROTATIONS = [[rotate(v, s) for v in range(POINTS)] for s in range(8)]
+
+
+class TrainData:
+    def __init__(self, filename):
+        self.file = open(filename, "rb")
+        magic, version, self.planes, self.record_size = \
+            HEADER.unpack(self.file.read(HEADER.size))
+        if magic != b"LZTR" or version != 1:
+            sys.exit("%s: not a version 1 training data file" % filename)
+        self.plane_bytes = (POINTS + 7) // 8
+
+        self.file.seek(-FOOTER.size, 2)
+        index_offset, self.count, chunks, magic = \
+            FOOTER.unpack(self.file.read(FOOTER.size))
+        if magic != b"LZTI":
+            sys.exit("%s: no index, the file was not closed" % filename)
+        self.file.seek(index_offset)
+        data = self.file.read(chunks * INDEX.size)
+        self.chunks = [INDEX.unpack_from(data, i * INDEX.size)
+                       for i in range(chunks)]
+
+    def read_chunk(self, chunk):
+        offset, size, positions = self.chunks[chunk]
+        self.file.seek(offset)
+        data = self.file.read(size)
+        if size < positions * self.record_size:
+            data = zlib.decompress(data)
+        return [data[i:i + self.record_size]
+                for i in range(0, len(data), self.record_size)]
+
+    def decode(self, record, symmetry=0):
+        # The planes as lists of 0 and 1 per point, the moves as points
+        rotation = ROTATIONS[symmetry]
+        planes = []
+        for p in range(self.planes):
+            bits = record[p * self.plane_bytes:(p + 1) * self.plane_bytes]
+            plane = [0] * POINTS
+            for v in range(POINTS):
+                if bits[v >> 3] >> (v & 7) & 1:
+                    plane[rotation[v]] = 1
+            planes.append(plane)
+        offset = self.planes * self.plane_bytes
+        moves = struct.unpack_from('<%dH' % MOVES, record, offset)
+        (stm_won,) = struct.unpack_from('<f', record, offset + 2 * MOVES)
+        return planes, [rotation[m] for m in moves], stm_won
+
+    def positions(self, shuffle=True):
+        chunks = list(range(len(self.chunks)))
+        if shuffle:
+            random.shuffle(chunks)
+        for chunk in chunks:
+            records = self.read_chunk(chunk)
+            if shuffle:
+                random.shuffle(records)
+            for record in records:
+                symmetry = random.randrange(8) if shuffle else 0
+                yield self.decode(record, symmetry)
+
+
+def main(args):
+    if not args:
+        sys.exit("usage: traindata.py file.bin [--check]")
+    data = TrainData(args[0])
+    stored = sum(size for _, size, _ in data.chunks)
+    raw = data.count * data.record_size
+    print("%d positions in %d chunks, %d bytes, %.1f%% of the records"
+          % (data.count, len(data.chunks), stored,
+             100.0 * stored / max(raw, 1)))
+    if args[1:] == ['--check']:
+        count = 0
+        for planes, moves, stm_won in data.positions():
+            # The move played is on an empty point
+            assert planes[0][moves[0]] == 1
+            assert stm_won in (0.0, 1.0)
+            count += 1
+        assert count == data.count
+        print("all positions decode")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])